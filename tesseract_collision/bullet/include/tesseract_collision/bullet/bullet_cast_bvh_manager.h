@@ -73,6 +73,12 @@ public:
                           const tesseract_common::VectorIsometry3d& shape_poses,
                           bool enabled = true) override final;
 
+  bool addCollisionObjects(const std::vector<std::string>& names,
+                           const int& mask_id,
+                           const std::vector<CollisionShapesConst>& shapes,
+                           const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                           bool enabled = true) override final;
+
   const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
 
   const tesseract_common::VectorIsometry3d&
@@ -88,6 +94,10 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  bool getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const override final;
+
+  using ContinuousContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -106,12 +116,18 @@ public:
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
                                     const tesseract_common::TransformMap& pose2) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
 
   const std::vector<std::string>& getActiveCollisionObjects() const override final;
 
+  void setCollisionObjectsActive(const std::vector<std::string>& names, bool active) override final;
+
   void setCollisionMarginData(
       CollisionMarginData collision_margin_data,
       CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
@@ -130,6 +146,20 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  void setPoolConfig(const ContactManagerPoolConfig& config) override final;
+
+  std::optional<ContactManagerPoolConfig> getPoolConfig() const override final;
+
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -147,7 +177,7 @@ private:
   TesseractCollisionConfiguration coll_config_; /**< @brief The bullet collision configuration */
   std::unique_ptr<btBroadphaseInterface> broadphase_; /**< @brief The bullet broadphase interface */
   Link2Cow link2cow_;                                 /**< @brief A map of collision objects being managed */
-  Link2Cow link2castcow_;                             /**< @brief A map of cast collision objects being managed. */
+  Link2Cow link2castcow_;                             /**< @brief A map of cast collision objects of active links */
 
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
@@ -155,11 +185,53 @@ private:
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The statistics collected during contact tests, contact_test_data_ points to it while enabled */
+  ContactManagerStatistics statistics_;
+
+  /** @brief The order the overlapping pairs are processed in, kept to reuse the storage */
+  std::vector<std::pair<btScalar, int>> pair_order_;
+
   /** @brief Filter collision objects before broadphase check */
   TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief The sizes of the memory pools of the collision configuration */
+  ContactManagerPoolConfig pool_config_;
+
+  /** @brief The number of collision objects the memory pools are sized for */
+  std::size_t pool_object_count_{ 0 };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Size the memory pools for a number of collision objects
+   * @details The collision algorithms allocated from the pools are freed first, so they are created again by the next
+   * contact test.
+   * @param object_count The number of collision objects
+   */
+  void resizePools(std::size_t object_count);
+
+  /**
+   * @brief Update the allowed collision matrix used by the broadphase filter from the contact allowed function
+   * @details When the function provides a compiled allowed collision matrix the allowed pairs are never added to the
+   * overlapping pair cache. The proxies are refreshed when it is replaced so the pair cache is rebuilt with it.
+   */
+  void updateBroadphaseAllowedCollisionMatrix();
+
+  /**
+   * @brief Get the cast collision object of a collision object, creating it the first time the link is active
+   * @details Static links never use their cast collision object, so cloning a manager shares their shapes instead of
+   * building cast shapes for all of their geometry.
+   * @param cow The collision object
+   * @return The cast collision object
+   */
+  COW::Ptr& getCastCollisionObject(const COW::Ptr& cow);
+
+  /**
+   * @brief Move a collision object between the static and active sets of the broadphase after active_ changed
+   * @param cow The collision object
+   */
+  void updateActiveCollisionObject(const COW::Ptr& cow);
 };
 }  // namespace tesseract_collision::tesseract_collision_bullet
 
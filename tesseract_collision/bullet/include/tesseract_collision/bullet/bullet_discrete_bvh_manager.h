@@ -41,6 +41,8 @@
 #ifndef TESSERACT_COLLISION_BULLET_DISCRETE_BVH_MANAGERS_H
 #define TESSERACT_COLLISION_BULLET_DISCRETE_BVH_MANAGERS_H
 
+#include <tesseract_common/executor.h>
+#include <tesseract_collision/bullet/bullet_static_collision_world.h>
 #include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
@@ -73,6 +75,12 @@ public:
                           const tesseract_common::VectorIsometry3d& shape_poses,
                           bool enabled = true) override final;
 
+  bool addCollisionObjects(const std::vector<std::string>& names,
+                           const int& mask_id,
+                           const std::vector<CollisionShapesConst>& shapes,
+                           const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                           bool enabled = true) override final;
+
   const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
 
   const tesseract_common::VectorIsometry3d&
@@ -88,19 +96,35 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
                                     const tesseract_common::VectorIsometry3d& poses) override final;
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
 
   const std::vector<std::string>& getActiveCollisionObjects() const override final;
 
+  void setCollisionObjectsActive(const std::vector<std::string>& names, bool active) override final;
+
   void setCollisionMarginData(
       CollisionMarginData collision_margin_data,
       CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
@@ -119,13 +143,111 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  void setPoolConfig(const ContactManagerPoolConfig& config) override final;
+
+  std::optional<ContactManagerPoolConfig> getPoolConfig() const override final;
+
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<tesseract_common::TransformMap>& transforms,
+                        const ContactRequest& request) override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<std::string>& names,
+                        const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                        const ContactRequest& request) override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
    */
   void addCollisionObject(const COW::Ptr& cow);
 
+  /**
+   * @brief Set the number of threads used to process the narrowphase of the overlapping pairs
+   * @details The default of one processes all pairs on the calling thread. When more than one thread is requested the
+   * overlapping pairs are split into contiguous chunks, each processed with its own dispatcher, contact test data and
+   * result buffer, after which the results are merged so they match the single threaded results.
+   * Requests of type ContactTestType::FIRST and contact tests collecting statistics are always processed on the
+   * calling thread.
+   * @note The IsContactAllowedFn and ContactRequest::is_valid functions are called from multiple threads so they must
+   * be thread safe when this is enabled.
+   * @param threads The number of threads, zero is treated as one
+   */
+  void setNarrowphaseThreads(std::size_t threads);
+
+  /**
+   * @brief Get the number of threads used to process the narrowphase of the overlapping pairs
+   * @return The number of threads
+   */
+  std::size_t getNarrowphaseThreads() const;
+
+  /**
+   * @brief Set the executor processing the chunks of the narrowphase when more than one thread is used
+   * @param executor The executor, nullptr uses the default executor
+   */
+  void setNarrowphaseExecutor(tesseract_common::Executor::Ptr executor);
+
+  /**
+   * @brief Get the executor processing the chunks of the narrowphase
+   * @return The executor, nullptr if the default executor is used
+   */
+  const tesseract_common::Executor::Ptr& getNarrowphaseExecutor() const;
+
+  /**
+   * @brief Enable or disable seeding GJK with the separating axis found for the same pair of shapes by the previous
+   * contact test
+   * @details This is disabled by default. When the same pairs are checked at nearby poses, as in trajectory checking
+   * or optimization, GJK converges in fewer iterations. The contacts found are the same up to the GJK tolerance.
+   * @param enabled Indicate if GJK queries should be warm started
+   */
+  void setGjkWarmStart(bool enabled);
+
+  /**
+   * @brief Check if GJK queries are warm started
+   * @return True if enabled, otherwise false
+   */
+  bool getGjkWarmStart() const;
+
+  /**
+   * @brief Attach a static collision world shared with other contact managers
+   * @details The active collision objects are also checked against the objects of the world, which are reported in
+   * the contact results with their names and a handle of -1. The objects of the world are not part of the collision
+   * objects of the manager and are not affected by its transforms, so they are never checked against each other.
+   * @param world The static collision world, nullptr detaches the current world
+   */
+  void setStaticCollisionWorld(BulletStaticCollisionWorld::ConstPtr world);
+
+  /**
+   * @brief Get the attached static collision world
+   * @return The static collision world, nullptr if none is attached
+   */
+  const BulletStaticCollisionWorld::ConstPtr& getStaticCollisionWorld() const;
+
 private:
+  /**
+   * @brief The data owned by a single narrowphase thread
+   * @details The dispatcher pool allocators used to create collision algorithms are not thread safe, so each thread is
+   * given its own collision configuration and dispatcher.
+   */
+  struct NarrowphaseWorker
+  {
+    NarrowphaseWorker(const btDefaultCollisionConstructionInfo& info);
+
+    TesseractCollisionConfiguration coll_config;       /**< @brief The bullet collision configuration */
+    std::unique_ptr<btCollisionDispatcher> dispatcher; /**< @brief The bullet collision dispatcher */
+    ContactResultMap results;                          /**< @brief The contacts found by this thread */
+  };
+
   std::string name_;
   std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
   std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
@@ -137,17 +259,93 @@ private:
   std::unique_ptr<btBroadphaseInterface> broadphase_; /**< @brief The bullet broadphase interface */
   Link2Cow link2cow_; /**< @brief A map of all (static and active) collision objects being managed */
 
+  /** @brief The collision objects indexed by handle, ordered the same as collision_objects_ */
+  std::vector<COW::Ptr> handle2cow_;
+
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
    * so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The statistics collected during contact tests, contact_test_data_ points to it while enabled */
+  ContactManagerStatistics statistics_;
+
   /** @brief Filter collision objects before broadphase check */
   TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief Indicates the broadphase changed since the overlapping pairs were last calculated */
+  bool broadphase_changed_{ true };
+
+  /** @brief The order the overlapping pairs are processed in, kept to reuse the storage */
+  std::vector<std::pair<btScalar, int>> pair_order_;
+
+  /** @brief The number of threads used to process the narrowphase */
+  std::size_t narrowphase_threads_{ 1 };
+
+  /** @brief The executor processing the narrowphase chunks, nullptr uses the default executor */
+  tesseract_common::Executor::Ptr narrowphase_executor_;
+
+  /** @brief The per thread data used when the narrowphase is processed in parallel, one less than the thread count */
+  std::vector<std::unique_ptr<NarrowphaseWorker>> narrowphase_workers_;
+
+  /** @brief The attached static collision world, nullptr if none is attached */
+  BulletStaticCollisionWorld::ConstPtr static_world_;
+
+  /**
+   * @brief The collision objects of this manager for the objects of the static collision world
+   * @details They share the collision shapes of the world but point to the contact test data of this manager
+   */
+  std::vector<COW::Ptr> static_world_cows_;
+
+  /** @brief The indices of the static world objects overlapping an object, kept to reuse the storage */
+  std::vector<int> static_world_overlaps_;
+
+  /** @brief The sizes of the memory pools of the collision configuration */
+  ContactManagerPoolConfig pool_config_;
+
+  /** @brief The number of collision objects the memory pools are sized for */
+  std::size_t pool_object_count_{ 0 };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Size the memory pools for a number of collision objects
+   * @details The collision algorithms allocated from the pools are freed first, so they are created again by the next
+   * contact test.
+   * @param object_count The number of collision objects
+   */
+  void resizePools(std::size_t object_count);
+
+  /**
+   * @brief Update the allowed collision matrix used by the broadphase filter from the contact allowed function
+   * @details When the function provides a compiled allowed collision matrix the allowed pairs are never added to the
+   * overlapping pair cache. The proxies are refreshed when it is replaced so the pair cache is rebuilt with it.
+   */
+  void updateBroadphaseAllowedCollisionMatrix();
+
+  /**
+   * @brief Run the broadphase and narrowphase for the current transforms using the provided callback
+   * @details The contact request must already be stored in contact_test_data_
+   * @param collisions The contact results data
+   * @param collision_callback The pair callback to process the overlapping pairs with
+   */
+  void runContactTest(ContactResultMap& collisions, TesseractCollisionPairCallback& collision_callback);
+
+  /**
+   * @brief Process the narrowphase of the overlapping pairs in parallel and merge the results into collisions
+   * @details The broadphase must already be updated and the contact request stored in contact_test_data_
+   * @param collisions The contact results data
+   * @param collision_callback The pair callback used to process the first chunk on the calling thread
+   */
+  void runParallelNarrowphase(ContactResultMap& collisions, TesseractCollisionPairCallback& collision_callback);
+
+  /**
+   * @brief Process the pairs of the active collision objects and the objects of the static collision world
+   * @param collision_callback The pair callback to process the pairs with
+   */
+  void processStaticCollisionWorld(TesseractCollisionPairCallback& collision_callback);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -42,12 +42,18 @@
 #define TESSERACT_COLLISION_BULLET_DISCRETE_SIMPLE_MANAGERS_H
 
 #include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/core/aabb_soa.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
-/** @brief A simple implementation of a bullet manager which does not use BHV */
+/**
+ * @brief A simple implementation of a bullet manager which does not use BHV
+ * @details Each contact test gathers the bounding boxes of the objects into an AABBSoA and tests each active object
+ * against all the following objects in one vectorized pass, only the pairs that overlap reach the narrowphase. For
+ * small scenes this is faster than maintaining a tree.
+ */
 class BulletDiscreteSimpleManager : public DiscreteContactManager
 {
 public:
@@ -57,7 +63,7 @@ public:
   using ConstUPtr = std::unique_ptr<const BulletDiscreteSimpleManager>;
 
   BulletDiscreteSimpleManager(std::string name = "BulletDiscreteSimpleManager");
-  ~BulletDiscreteSimpleManager() override = default;
+  ~BulletDiscreteSimpleManager() override;
   BulletDiscreteSimpleManager(const BulletDiscreteSimpleManager&) = delete;
   BulletDiscreteSimpleManager& operator=(const BulletDiscreteSimpleManager&) = delete;
   BulletDiscreteSimpleManager(BulletDiscreteSimpleManager&&) = delete;
@@ -73,6 +79,12 @@ public:
                           const tesseract_common::VectorIsometry3d& shape_poses,
                           bool enabled = true) override final;
 
+  bool addCollisionObjects(const std::vector<std::string>& names,
+                           const int& mask_id,
+                           const std::vector<CollisionShapesConst>& shapes,
+                           const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                           bool enabled = true) override final;
+
   const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
 
   const tesseract_common::VectorIsometry3d&
@@ -88,13 +100,27 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
                                     const tesseract_common::VectorIsometry3d& poses) override final;
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
@@ -119,12 +145,59 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  void setPoolConfig(const ContactManagerPoolConfig& config) override final;
+
+  std::optional<ContactManagerPoolConfig> getPoolConfig() const override final;
+
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
    */
   void addCollisionObject(const COW::Ptr& cow);
 
+  /**
+   * @brief Enable or disable seeding GJK with the separating axis found for the same pair of shapes by the previous
+   * contact test
+   * @details This is disabled by default. When the same pairs are checked at nearby poses, as in trajectory checking
+   * or optimization, GJK converges in fewer iterations. The contacts found are the same up to the GJK tolerance.
+   * @param enabled Indicate if GJK queries should be warm started
+   */
+  void setGjkWarmStart(bool enabled);
+
+  /**
+   * @brief Check if GJK queries are warm started
+   * @return True if enabled, otherwise false
+   */
+  bool getGjkWarmStart() const;
+
+  /**
+   * @brief Enable or disable the self collision mode
+   * @details In this mode a contact test only checks the active collision objects against each other, for example a
+   * robot when filtering IK solutions. The pairs of active objects whose contact is not allowed are computed once and
+   * the narrowphase algorithm of each pair is kept between contact tests instead of being found for every pair of
+   * every test. The pairs are recomputed when objects are added or removed, the active objects change or a contact
+   * allowed function is set, so if the ACM used by the function changes setIsContactAllowedFn must be called again.
+   * This is disabled by default.
+   * @param enabled True to only check the active objects against each other
+   */
+  void setSelfCollisionOnly(bool enabled);
+
+  /**
+   * @brief Check if the self collision mode is enabled
+   * @return True if enabled, otherwise false
+   */
+  bool getSelfCollisionOnly() const;
+
 private:
   std::string name_;
   std::vector<std::string> active_;            /**< @brief A list of the active collision objects */
@@ -137,14 +210,74 @@ private:
   Link2Cow link2cow_;          /**< @brief A map of all (static and active) collision objects being managed */
   std::vector<COW::Ptr> cows_; /**< @brief A vector of collision objects (active followed by static) */
 
+  /** @brief The collision objects indexed by handle, ordered the same as collision_objects_ */
+  std::vector<COW::Ptr> handle2cow_;
+
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
    * so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The statistics collected during contact tests, contact_test_data_ points to it while enabled */
+  ContactManagerStatistics statistics_;
+
+  /** @brief The bounding boxes of cows_ gathered by each contact test, kept to reuse the storage */
+  AABBSoA aabbs_;
+
+  /** @brief The separation of one object from the following objects, kept to reuse the storage */
+  std::vector<double> separations_;
+
+  /** @brief A pair of active collision objects checked by the self collision mode */
+  struct SelfCollisionPair
+  {
+    /** @brief The index of the first object in cows_ */
+    std::size_t index1{ 0 };
+
+    /** @brief The index of the second object in cows_ */
+    std::size_t index2{ 0 };
+
+    /** @brief The narrowphase algorithm of the pair, created by the first contact test that reaches it */
+    btCollisionAlgorithm* algorithm{ nullptr };
+  };
+
+  /** @brief Indicate if only the active objects are checked against each other */
+  bool self_collision_only_{ false };
+
+  /** @brief Indicate if self_collision_pairs_ must be recomputed before the next self collision contact test */
+  bool self_collision_pairs_dirty_{ true };
+
+  /** @brief The pairs of active objects whose contact is not allowed, ordered by the first object */
+  std::vector<SelfCollisionPair> self_collision_pairs_;
+
+  /** @brief The sizes of the memory pools of the collision configuration */
+  ContactManagerPoolConfig pool_config_;
+
+  /** @brief The number of collision objects the memory pools are sized for */
+  std::size_t pool_object_count_{ 0 };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Size the memory pools for a number of collision objects
+   * @details The collision algorithms allocated from the pools are freed first, so they are created again by the next
+   * contact test.
+   * @param object_count The number of collision objects
+   */
+  void resizePools(std::size_t object_count);
+
+  /** @brief Free the cached algorithms and mark the self collision pairs to be recomputed */
+  void clearSelfCollisionPairs();
+
+  /** @brief Compute the self collision pairs from the active objects and the contact allowed function */
+  void updateSelfCollisionPairs();
+
+  /**
+   * @brief The contact test of the self collision mode
+   * @param statistics The statistics of the contact test, nullptr if disabled
+   */
+  void selfCollisionContactTest(ContactManagerStatistics* statistics);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -0,0 +1,127 @@
+/**
+ * @file bullet_static_collision_world.h
+ * @brief Static bullet collision objects shared by several contact managers
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+#ifndef TESSERACT_COLLISION_BULLET_STATIC_COLLISION_WORLD_H
+#define TESSERACT_COLLISION_BULLET_STATIC_COLLISION_WORLD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDbvt.h>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Static collision objects shared read only by several bullet contact managers
+ * @details When many environments contain the same fixtures, for example one environment per robot in a shared cell,
+ * the collision shapes of the fixtures and the bounding volume tree over them are built once here instead of once per
+ * contact manager. A contact manager attached to the world only creates a light weight collision object per static
+ * object, sharing its collision shape, and checks its active objects against the tree of the world.
+ *
+ * Objects can only be added before the world is shared, the contact managers hold it through a ConstPtr and only read
+ * it, so the world may be used by contact managers on different threads.
+ */
+class BulletStaticCollisionWorld
+{
+public:
+  using Ptr = std::shared_ptr<BulletStaticCollisionWorld>;
+  using ConstPtr = std::shared_ptr<const BulletStaticCollisionWorld>;
+
+  BulletStaticCollisionWorld() = default;
+  ~BulletStaticCollisionWorld() = default;
+  BulletStaticCollisionWorld(const BulletStaticCollisionWorld&) = delete;
+  BulletStaticCollisionWorld& operator=(const BulletStaticCollisionWorld&) = delete;
+  BulletStaticCollisionWorld(BulletStaticCollisionWorld&&) = delete;
+  BulletStaticCollisionWorld& operator=(BulletStaticCollisionWorld&&) = delete;
+
+  /**
+   * @brief Add a static collision object
+   * @details An object with the same name is replaced
+   * @param name The name of the object, it must not be used by the objects of the contact managers
+   * @param mask_id User defined id which gets stored in the results structure
+   * @param shapes The shapes of the object
+   * @param shape_poses The poses of the shapes in the frame of the object
+   * @param pose The pose of the object in the world
+   * @return true if successfully added, otherwise false
+   */
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          const Eigen::Isometry3d& pose);
+
+  /**
+   * @brief Check if the world has a collision object
+   * @param name The name of the object
+   * @return True if the world has the object, otherwise false
+   */
+  bool hasCollisionObject(const std::string& name) const;
+
+  /** @brief Get the names of the collision objects in the order they were added */
+  const std::vector<std::string>& getCollisionObjects() const;
+
+  /**
+   * @brief Get the bullet collision objects of the world
+   * @details Contact managers clone these, the clones share the collision shapes
+   */
+  const std::vector<COW::Ptr>& getBulletCollisionObjects() const;
+
+  /**
+   * @brief Find the objects whose bounding box overlaps a bounding box
+   * @param aabb_min The minimum corner of the bounding box
+   * @param aabb_max The maximum corner of the bounding box
+   * @param indices Populated with the indices of the overlapping objects in getBulletCollisionObjects
+   */
+  void findOverlappingObjects(const btVector3& aabb_min, const btVector3& aabb_max, std::vector<int>& indices) const;
+
+private:
+  std::vector<std::string> collision_objects_; /**< @brief The names of the collision objects */
+  std::vector<COW::Ptr> cows_;                 /**< @brief The collision objects, ordered the same as the names */
+  std::vector<btDbvtNode*> leaves_;            /**< @brief The leaves of the tree, ordered the same as the names */
+
+  /** @brief The tree of the bounding boxes of the collision objects, the data of a leaf is the index of its object */
+  btDbvt tree_;
+};
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_BULLET_STATIC_COLLISION_WORLD_H
@@ -49,10 +49,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionDispatch/btManifoldResult.h>
 #include <btBulletCollisionCommon.h>
 #include <console_bridge/console.h>
+#include <atomic>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/impl/octree.h>
+#include <tesseract_common/memory_usage.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -109,6 +113,10 @@ public:
   const std::string& getName() const;
   /** @brief Get a user defined type */
   const int& getTypeID() const;
+  /** @brief Get the handle assigned by the contact manager, -1 if not assigned */
+  int getHandle() const;
+  /** @brief Set the handle assigned by the contact manager */
+  void setHandle(int handle);
   /** \brief Check if two CollisionObjectWrapper objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const;
 
@@ -118,11 +126,21 @@ public:
 
   /**
    * @brief Get the collision objects axis aligned bounding box
+   * @details The box is inflated by the contact processing threshold. If the local bounding box of the collision shape
+   * is cached it is transformed by the world transform instead of querying the collision shape.
    * @param aabb_min The minimum point
    * @param aabb_max The maximum point
    */
   void getAABB(btVector3& aabb_min, btVector3& aabb_max) const;
 
+  /**
+   * @brief Cache the bounding box of the collision shape in the frame of the collision object
+   * @details The cache is only used while the collision shape is the one it was computed for. Shapes whose local
+   * bounding box changes, like octrees and cast shapes, and spheres, whose bounding box does not depend on the
+   * orientation, are not cached.
+   */
+  void updateLocalAABB();
+
   /**
    * @brief This clones the collision objects but not the collision shape wich is const.
    * @return Shared Pointer to the cloned collision object
@@ -133,17 +151,34 @@ public:
 
   void manageReserve(std::size_t s);
 
+  /**
+   * @brief Get the memory used by the collision object
+   * @details The geometries are reported as children and the bullet shapes built from them as the acceleration
+   * structure, the shapes are shared by the clones of the collision object.
+   * @param tracker Tracks the storage already counted
+   * @return The memory usage report
+   */
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
 protected:
   /** @brief The name of the collision object */
   std::string m_name;
   /** @brief A user defined type id */
   int m_type_id{ -1 };
+  /** @brief The handle assigned by the contact manager */
+  int m_handle{ -1 };
   /* @brief The shapes that define the collision object */
   CollisionShapesConst m_shapes{};
   /**< @brief The shapes poses information */
   tesseract_common::VectorIsometry3d m_shape_poses{};
   /** @brief This manages the collision shape pointer so they get destroyed */
   std::vector<std::shared_ptr<btCollisionShape>> m_data{};
+  /** @brief The collision shape the local bounding box was cached for, nullptr if not cached */
+  const btCollisionShape* m_local_aabb_shape{ nullptr };
+  /** @brief The center of the cached local bounding box */
+  btVector3 m_local_aabb_center{ 0, 0, 0 };
+  /** @brief The half extents of the cached local bounding box */
+  btVector3 m_local_aabb_half_extents{ 0, 0, 0 };
 };
 
 using COW = CollisionObjectWrapper;
@@ -168,12 +203,20 @@ public:
   const char* getName() const override;
   btVector3 localGetSupportingVertexWithoutMargin(const btVector3& v) const override;
 
-  // LCOV_EXCL_START
-  // notice that the vectors should be unit length
+  /**
+   * @brief Get the supporting vertices for a set of directions
+   * @details This uses the batched query of the underlying shape for both ends of the cast, which for convex hulls
+   * evaluates each direction against the vertex set using Bullet's vectorized max dot product. The results match
+   * localGetSupportingVertexWithoutMargin and the fourth component stores the support distance.
+   * @param vectors The unit length directions
+   * @param supportVerticesOut The supporting vertices, must be the same size as vectors
+   * @param numVectors The number of directions
+   */
   void batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* vectors,
                                                          btVector3* supportVerticesOut,
                                                          int numVectors) const override;
 
+  // LCOV_EXCL_START
   void getAabbSlow(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
 
   void setLocalScaling(const btVector3& scaling) override;
@@ -192,6 +235,58 @@ public:
   // LCOV_EXCL_STOP
 };
 
+/**
+ * @brief A convex hull that answers support queries by hill climbing over the hull edges
+ * @details btConvexHullShape scans every vertex for each support query, so GJK costs O(V) per iteration on large hulls.
+ * This precomputes the vertex adjacency from the hull faces and walks from the previous support vertex to a neighbor
+ * with a larger dot product until none is larger. On a convex hull a local maximum is the global maximum, and because
+ * consecutive GJK queries use similar directions the walk is usually a few steps.
+ *
+ * Hill climbing is only used when the hull has at least MIN_HILL_CLIMBING_VERTICES vertices and every vertex is on a
+ * face, otherwise the queries fall back to the linear scan of btConvexHullShape.
+ */
+class HillClimbingConvexHullShape : public btConvexHullShape
+{
+public:
+  /** @brief Below this vertex count the vectorized linear scan is faster than hill climbing */
+  static constexpr int MIN_HILL_CLIMBING_VERTICES = 32;
+
+  /**
+   * @brief Create the hull shape
+   * @param vertices The hull vertices
+   * @param faces The hull faces, each face is the vertex count followed by the vertex indices
+   */
+  HillClimbingConvexHullShape(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces);
+
+  btVector3 localGetSupportingVertexWithoutMargin(const btVector3& vec) const override;
+
+  void batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* vectors,
+                                                         btVector3* supportVerticesOut,
+                                                         int numVectors) const override;
+
+  /** @brief Check if support queries use hill climbing */
+  bool isHillClimbing() const { return !adjacency_offsets_.empty(); }
+
+private:
+  /** @brief The neighbors of vertex i are adjacency_[adjacency_offsets_[i]] to adjacency_[adjacency_offsets_[i + 1]] */
+  std::vector<int> adjacency_offsets_;
+  std::vector<int> adjacency_;
+
+  /**
+   * @brief The previous support vertex, where the next walk starts
+   * @details The shape is shared between collision objects and threads, this is only a hint so relaxed atomics are used
+   */
+  mutable std::atomic<int> last_support_{ 0 };
+
+  /**
+   * @brief Find the support vertex of a direction in the unscaled vertex frame
+   * @param direction The direction multiplied by the local scaling
+   * @param max_dot The dot product of the direction and the support vertex
+   * @return The index of the support vertex
+   */
+  int findSupportVertex(const btVector3& direction, btScalar& max_dot) const;
+};
+
 void GetAverageSupport(const btConvexShape* shape,
                        const btVector3& localNormal,
                        btScalar& outsupport,
@@ -215,6 +310,30 @@ btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow);
  */
 bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowedFn& acm, bool verbose = false);
 
+/**
+ * @brief Get the geometry type a collision object is reported with in the contact manager statistics
+ * @param cow The collision object
+ * @return The type of its shape, UNINITIALIZED if it has multiple shapes
+ */
+tesseract_geometry::GeometryType getStatisticsGeometryType(const COW& cow);
+
+/**
+ * @brief Run the narrowphase collision algorithm of two collision objects
+ * @details If statistics are provided the narrowphase call and its time are added to them
+ * @param algorithm The collision algorithm of the pair
+ * @param obj0_wrap The first collision object
+ * @param obj1_wrap The second collision object
+ * @param dispatch_info The dispatcher info
+ * @param result The result the contacts are reported to
+ * @param statistics The statistics of the contact test, nullptr if disabled
+ */
+void processCollisionAlgorithm(btCollisionAlgorithm& algorithm,
+                               const btCollisionObjectWrapper& obj0_wrap,
+                               const btCollisionObjectWrapper& obj1_wrap,
+                               const btDispatcherInfo& dispatch_info,
+                               btManifoldResult& result,
+                               ContactManagerStatistics* statistics);
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  const btCollisionObjectWrapper* colObj1Wrap,
@@ -318,6 +437,17 @@ struct TesseractBroadphaseBridgedManifoldResult : public btManifoldResult
   void addContactPoint(const btVector3& normalOnBInWorld, const btVector3& pointInWorld, btScalar depth) override;
 };
 
+/**
+ * @brief Get the contact test data the contacts of a manifold result are stored in
+ * @details When the narrowphase runs in parallel each thread stores its contacts in its own contact test data, while
+ * the user pointer of the collision objects is the contact test data of the contact manager. The collision algorithms
+ * must use this to read the contacts found so far.
+ * @param result The manifold result passed to the collision algorithm
+ * @param co The collision object whose user pointer is used if the result is not a broadphase manifold result
+ * @return The contact test data
+ */
+ContactTestData* getContactTestData(const btManifoldResult& result, const btCollisionObject& co);
+
 /**
  * @brief A callback function that is called as part of the broadphase collision checking.
  *
@@ -344,7 +474,28 @@ public:
   bool processOverlap(btBroadphasePair& pair) override;
 };
 
-/** @brief This class is used to filter broadphase */
+/**
+ * @brief Process the pairs of an overlapping pair cache until the contact test is done
+ * @details Unlike btOverlappingPairCache::processAllOverlappingPairs this stops at the pair that completes the contact
+ * test, for example the first contact of a FIRST contact test or the contact reaching the contact limit. For a FIRST
+ * contact test the pairs are processed in order of how deep their bounding boxes overlap, since those are the most
+ * likely to be in contact.
+ * @param pair_cache The overlapping pair cache
+ * @param callback The callback processing a pair
+ * @param cdata The contact test data the callback reports to
+ * @param order Storage for the processing order of the pairs, kept by the caller to reuse the allocation
+ */
+void processOverlappingPairs(btOverlappingPairCache& pair_cache,
+                             TesseractCollisionPairCallback& callback,
+                             const ContactTestData& cdata,
+                             std::vector<std::pair<btScalar, int>>& order);
+
+/**
+ * @brief This class is used to filter broadphase
+ * @details Pairs which are disabled or filtered are never added to the overlapping pair cache. If a compiled allowed
+ * collision matrix is set the pairs it allows are not added either, the contact manager must refresh the broadphase
+ * proxies when it changes, since the filter is only called when a pair is added.
+ */
 class TesseractOverlapFilterCallback : public btOverlapFilterCallback
 {
 public:
@@ -352,12 +503,147 @@ public:
 
   bool needBroadphaseCollision(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) const override;
 
+  /** @brief Set the compiled allowed collision matrix used to filter pairs, nullptr to not filter allowed pairs */
+  void setAllowedCollisionMatrix(tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr acm);
+
+  /** @brief Get the compiled allowed collision matrix used to filter pairs */
+  const tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr& getAllowedCollisionMatrix() const;
+
 private:
   bool verbose_{ false };
+
+  /** @brief The compiled allowed collision matrix used to filter pairs */
+  tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr acm_;
+};
+
+/**
+ * @brief A collision shape which checks the occupied cells of an octree directly
+ * @details Instead of storing a child shape for every occupied cell, the octree hierarchy is traversed during the
+ * narrowphase by the TesseractOctreeCollisionAlgorithm. Nodes that do not overlap the other shape or that have no
+ * occupied children are skipped, so only the occupied cells close to the other shape are checked. Each cell is checked
+ * as a box or sphere depending on the sub type, the same as if it was a child of a compound shape.
+ *
+ * The occupancy of the inner nodes is used to skip unoccupied regions, so it must be up to date. This is maintained by
+ * octomap unless lazy evaluation is used without calling updateInnerOccupancy.
+ *
+ * The contacts reported for a cell use the shape index of the octree and a subshape index of -1.
+ */
+struct OctreeShape : public btCollisionShape
+{
+public:
+  /**
+   * @brief Constructor
+   * @param octree The octree, changes to its occupancy must be followed by a call to updateLocalAabb
+   * @param sub_type The shape used for the occupied cells
+   * @param shape_index The index of the collision shape, used for the cells of the octree
+   */
+  OctreeShape(std::shared_ptr<const octomap::OcTree> octree,
+              tesseract_geometry::Octree::SubType sub_type,
+              int shape_index);
+
+  /** @brief Get the octree */
+  const octomap::OcTree& getOctree() const;
+
+  /** @brief Get the shape used for the occupied cells */
+  tesseract_geometry::Octree::SubType getSubType() const;
+
+  /**
+   * @brief Get the shape used for the occupied cells at a depth of the octree
+   * @param depth The depth of the cell
+   * @return The collision shape centered at the cell
+   */
+  btConvexShape* getCellShape(unsigned depth) const;
+
+  /**
+   * @brief Get the distance from the center of a cell to the furthest point of its shape along an axis
+   * @param depth The depth of the cell
+   */
+  btScalar getCellExtent(unsigned depth) const;
+
+  /**
+   * @brief Enable casting the cells of the octree between the current transform and the provided transform
+   * @param t01 The transform from the start to the end of the cast, in the frame of the octree
+   */
+  void updateCastTransform(const btTransform& t01);
+
+  /** @brief Check if the cells of the octree are cast */
+  bool isCast() const;
+
+  /**
+   * @brief Set the error allowed in distance queries, see tesseract_geometry::Octree::setDistanceTolerance
+   * @param tolerance The allowed error
+   */
+  void setDistanceTolerance(double tolerance);
+
+  /**
+   * @brief Get the depth from which the occupied nodes are checked as cells instead of being refined
+   * @details This is the depth of the tree unless a distance tolerance allows checking larger boxes
+   */
+  unsigned getCoarseDepth() const;
+
+  /** @brief Get the transform from the start to the end of the cast, in the frame of the octree */
+  const btTransform& getCastTransform() const;
+
+  /** @brief Recalculate the bounding box of the occupied cells */
+  void recalculateLocalAabb();
+
+  /**
+   * @brief Update the bounding box of the occupied cells after some of their occupancy changed
+   * @param delta The cells whose occupancy changed, which must already be applied to the octree
+   */
+  void updateLocalAabb(const OctreeDelta& delta);
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  const char* getName() const override;
+
+  // LCOV_EXCL_START
+  void setLocalScaling(const btVector3& scaling) override;
+
+  const btVector3& getLocalScaling() const override;
+
+  void calculateLocalInertia(btScalar mass, btVector3& inertia) const override;
+
+  void setMargin(btScalar margin) override;
+
+  btScalar getMargin() const override;
+  // LCOV_EXCL_STOP
+
+private:
+  /** @brief The octree */
+  std::shared_ptr<const octomap::OcTree> m_octree;
+
+  /** @brief The shape used for the occupied cells */
+  tesseract_geometry::Octree::SubType m_subType;
+
+  /** @brief The cell shape for each depth of the octree */
+  std::vector<std::shared_ptr<btConvexShape>> m_cellShapes;
+
+  /** @brief The cell extent for each depth of the octree */
+  std::vector<btScalar> m_cellExtents;
+
+  /** @brief The ratio between the cell extent and half the size of the cell */
+  double m_cellScale{ 1 };
+
+  /** @brief The bounding box of the occupied cells in the frame of the octree */
+  btVector3 m_localAabbMin;
+  btVector3 m_localAabbMax;
+
+  /** @brief The transform from the start to the end of the cast */
+  btTransform m_t01;
+
+  /** @brief Indicate if the cells are cast */
+  bool m_isCast{ false };
+
+  /** @brief The depth from which the occupied nodes are checked as cells */
+  unsigned m_coarseDepth{ 0 };
 };
 
 /**
  * @brief Create a bullet collision shape from tesseract collision shape
+ * @details The compound of triangles created for a mesh and the hull created for a convex mesh are attached to the
+ * mesh for each shape index and shared between the collision objects using the mesh or its clones, so they must not be
+ * modified.
  * @param geom Tesseract collision shape
  * @param cow The collision object wrapper the collision shape is associated with
  * @param shape_index The collision shapes index within the collision shape wrapper. This can be accessed from the
@@ -368,6 +654,21 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
                                                        CollisionObjectWrapper* cow,
                                                        int shape_index);
 
+/**
+ * @brief Estimate the bytes of the trees and the pair cache of a broadphase
+ * @param broadphase The broadphase, only the dynamic bounding volume tree broadphase is estimated
+ * @return The bytes of the broadphase
+ */
+std::size_t getBroadphaseBytes(const btBroadphaseInterface& broadphase);
+
+/**
+ * @brief Free the collision algorithms cached in the overlapping pairs of a broadphase
+ * @details The algorithms are created again when the pairs are processed by the next contact test
+ * @param broadphase The broadphase
+ * @param dispatcher The dispatcher which allocated the algorithms
+ */
+void clearBroadphaseAlgorithms(btBroadphaseInterface& broadphase, btDispatcher& dispatcher);
+
 /**
  * @brief Update a collision objects filters
  * @param active A list of active collision objects
@@ -381,6 +682,18 @@ COW::Ptr createCollisionObject(const std::string& name,
                                const tesseract_common::VectorIsometry3d& shape_poses,
                                bool enabled = true);
 
+/**
+ * @brief Create several collision objects in parallel
+ * @details The objects are created the same as createCollisionObject using up to one thread per hardware thread. The
+ * conversion of meshes is cached, see createShapePrimitive, so a mesh shared by several objects is converted once.
+ * @return The collision objects ordered the same as names, an object which could not be created is a nullptr
+ */
+std::vector<COW::Ptr> createCollisionObjects(const std::vector<std::string>& names,
+                                             const int& type_id,
+                                             const std::vector<CollisionShapesConst>& shapes,
+                                             const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                             bool enabled = true);
+
 struct DiscreteCollisionCollector : public btCollisionWorld::ContactResultCallback
 {
   ContactTestData& collisions_;
@@ -426,13 +739,37 @@ struct CastCollisionCollector : public btCollisionWorld::ContactResultCallback
 
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow);
 
+/**
+ * @brief Update the bounding boxes of an octree of a collision object after some of its cells changed
+ * @details This only updates the collision shapes, the broadphase must be updated afterwards
+ * @param cow The collision object
+ * @param shape_index The index of the octree in the collision object's geometries
+ * @param delta The cells whose occupancy changed, which must already be applied to the octree
+ * @return True if the collision object has an octree at the shape index, otherwise false
+ */
+bool updateCollisionObjectOctree(const COW::Ptr& cow, std::size_t shape_index, const OctreeDelta& delta);
+
+/**
+ * @brief Set the contact processing threshold of a collision object from the collision margin data
+ * @details The threshold inflates the bounding box of the object in the broadphase, so the largest margin of the pairs
+ * the object is part of is used instead of the largest margin of all pairs. Two objects are still paired by the
+ * broadphase if their distance is within the margin of the pair, because the threshold of either object bounds it.
+ * @param cow The collision object
+ * @param collision_margin_data The collision margin data
+ */
+void updateCollisionObjectMargin(const COW::Ptr& cow, const CollisionMarginData& collision_margin_data);
+
 /**
  * @brief Update the Broadphase AABB for the input collision object
+ * @details The broadphase is only updated if the AABB differs from the one it already stores for the object. This
+ * keeps objects that did not move out of the broadphase dynamic set, so the overlapping pair cache is only updated
+ * for the objects that changed.
  * @param cow The collision objects
  * @param broadphase The bullet broadphase interface
  * @param dispatcher The bullet collision dispatcher
+ * @return True if the broadphase AABB was updated, otherwise false
  */
-void updateBroadphaseAABB(const COW::Ptr& cow,
+bool updateBroadphaseAABB(const COW::Ptr& cow,
                           const std::unique_ptr<btBroadphaseInterface>& broadphase,
                           const std::unique_ptr<btCollisionDispatcher>& dispatcher);
 
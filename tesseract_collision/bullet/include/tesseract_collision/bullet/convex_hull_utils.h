@@ -26,6 +26,7 @@
 #ifndef TESSERACT_COLLISION_BULLET_CONVEX_HULL_UTILS_H
 #define TESSERACT_COLLISION_BULLET_CONVEX_HULL_UTILS_H
 
+#include <tesseract_common/executor.h>
 #include <tesseract_common/types.h>
 #include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
@@ -34,6 +35,8 @@ namespace tesseract_collision
 {
 /**
  * @brief Create a convex hull from vertices using Bullet Convex Hull Computer
+ * @details Large inputs are first reduced to the points which are not strictly inside the hull of their extreme points
+ * along a fixed set of directions, which leaves the hull unchanged.
  * @param (Output) vertices A vector of vertices
  * @param (Output) faces The first values indicates the number of vertices that define the face followed by the vertices
  * index
@@ -50,7 +53,38 @@ int createConvexHull(tesseract_common::VectorVector3d& vertices,
                      double shrink = -1,
                      double shrinkClamp = -1);
 
-tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mesh& mesh);
+/**
+ * @brief Remove the points which are strictly inside the hull of the extreme points along a fixed set of directions
+ * @details The convex hull of the remaining points is the convex hull of the input. Most of the vertices of a dense
+ * mesh are removed in linear time, which reduces the work of the hull computation.
+ * @param input A vector of points
+ * @return The points which may be vertices of the convex hull
+ */
+tesseract_common::VectorVector3d filterInteriorPoints(const tesseract_common::VectorVector3d& input);
+
+/**
+ * @brief Create a convex mesh from the vertices of a mesh
+ * @param mesh The mesh
+ * @param max_vertices If positive, the convex hull is simplified to at most this many vertices (at least four) by
+ * keeping the hull vertices which are extreme along evenly spread directions. The simplified hull lies inside the
+ * original hull. Fewer vertices speed up GJK based distance queries.
+ * @return The convex mesh
+ */
+tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mesh& mesh, int max_vertices = 0);
+
+/**
+ * @brief Create the convex meshes of several meshes in parallel
+ * @param meshes The meshes
+ * @param max_vertices If positive, each convex hull is simplified to at most this many vertices
+ * @param threads The maximum number of meshes processed at the same time, zero uses the concurrency of the executor
+ * @param executor The executor processing the meshes, nullptr uses the default executor
+ * @return The convex meshes in the order of the meshes
+ */
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+makeConvexMeshes(const std::vector<tesseract_geometry::Mesh::Ptr>& meshes,
+                 int max_vertices = 0,
+                 std::size_t threads = 0,
+                 const tesseract_common::Executor::Ptr& executor = nullptr);
 
 }  // namespace tesseract_collision
 
@@ -44,8 +44,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
+#include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_collision/core/types.h>
+
+#include <tesseract_collision/bullet/tesseract_gjk_pair_detector.h>
+
 namespace tesseract_collision::tesseract_collision_bullet
 {
 /**
@@ -55,12 +61,105 @@ namespace tesseract_collision::tesseract_collision_bullet
  *     - Compound to Collision
  *     - Compound to Compound
  *     - Convex to Convex
+ *
+ * It also adds the algorithms for the octree collision shape and the closed form algorithm for sphere, capsule and
+ * box pairs.
  */
 class TesseractCollisionConfiguration : public btDefaultCollisionConfiguration
 {
 public:
   TesseractCollisionConfiguration(
       const btDefaultCollisionConstructionInfo& constructionInfo = btDefaultCollisionConstructionInfo());
+  ~TesseractCollisionConfiguration() override;
+  TesseractCollisionConfiguration(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration& operator=(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration(TesseractCollisionConfiguration&&) = delete;
+  TesseractCollisionConfiguration& operator=(TesseractCollisionConfiguration&&) = delete;
+
+  btCollisionAlgorithmCreateFunc* getCollisionAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+  btCollisionAlgorithmCreateFunc* getClosestPointsAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+  /**
+   * @brief Enable or disable seeding GJK with the separating axis found by the previous query of the same shape pair
+   * @details This is disabled by default. Disabling it clears the stored separating axes.
+   * @param enabled Indicate if GJK queries should be warm started
+   */
+  void setGjkWarmStart(bool enabled);
+
+  /**
+   * @brief Check if GJK queries are warm started
+   * @return True if enabled, otherwise false
+   */
+  bool getGjkWarmStart() const;
+
+  /**
+   * @brief Get the separating axes stored for warm starting GJK
+   * @return The warm start cache
+   */
+  GjkWarmStartCache& getGjkWarmStartCache();
+
+  /**
+   * @brief Replace the memory pools of the collision algorithms and persistent manifolds with pools of other sizes
+   * @details Only pools owned by the configuration are replaced and only if none of their elements is in use, so all
+   * collision algorithms and manifolds allocated by the dispatchers of the configuration must be freed first. The
+   * dispatchers keep pointers to the pools, so they must be created again if the pools are replaced.
+   * @param collision_algorithm_pool_size The number of collision algorithms of the pool
+   * @param persistent_manifold_pool_size The number of persistent manifolds of the pool
+   * @return True if the pools were replaced, otherwise false
+   */
+  bool setPoolSizes(int collision_algorithm_pool_size, int persistent_manifold_pool_size);
+
+  /** @brief Get the number of collision algorithms of the pool */
+  int getCollisionAlgorithmPoolSize() const;
+
+  /** @brief Get the number of persistent manifolds of the pool */
+  int getPersistentManifoldPoolSize() const;
+
+  /** @brief Get the number of bytes allocated by the pools */
+  std::size_t getPoolBytes() const;
+
+private:
+  GjkWarmStartCache m_gjkWarmStartCache;
+
+  /** @brief The algorithm used for an octree shape and a shape that is not a compound */
+  btCollisionAlgorithmCreateFunc* m_octreeCreateFunc{ nullptr };
+
+  /** @brief The algorithm used for a shape that is not a compound and an octree shape */
+  btCollisionAlgorithmCreateFunc* m_swappedOctreeCreateFunc{ nullptr };
+
+  /** @brief The closed form algorithm used for sphere, capsule and box pairs */
+  btCollisionAlgorithmCreateFunc* m_primitiveCreateFunc{ nullptr };
 };
+
+/**
+ * @brief Get the construction information of a collision configuration with the pools sized for a number of objects
+ * @param pool_config The pool configuration
+ * @param object_count The number of collision objects
+ * @return The construction information
+ */
+btDefaultCollisionConstructionInfo getCollisionConstructionInfo(const ContactManagerPoolConfig& pool_config,
+                                                                std::size_t object_count);
+
+/**
+ * @brief Create a dispatcher configured the same way for all contact managers
+ * @param coll_config The collision configuration providing the algorithms and pool allocators
+ * @return The dispatcher
+ */
+std::unique_ptr<btCollisionDispatcher> createDispatcher(TesseractCollisionConfiguration& coll_config);
+
+/**
+ * @brief Size the pools of a collision configuration for a number of objects and create its dispatcher again
+ * @details All collision algorithms and manifolds allocated by the dispatcher must be freed first, otherwise the
+ * current pools are kept.
+ * @param coll_config The collision configuration
+ * @param dispatcher The dispatcher of the collision configuration
+ * @param pool_config The pool configuration
+ * @param object_count The number of collision objects
+ */
+void resizeCollisionPools(TesseractCollisionConfiguration& coll_config,
+                          std::unique_ptr<btCollisionDispatcher>& dispatcher,
+                          const ContactManagerPoolConfig& pool_config,
+                          std::size_t object_count);
 }  // namespace tesseract_collision::tesseract_collision_bullet
 #endif  // TESSERACT_COLLISION_TESSERACT_COLLISION_CONFIGURATION_H
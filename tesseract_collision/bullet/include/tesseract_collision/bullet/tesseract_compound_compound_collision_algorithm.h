@@ -48,6 +48,11 @@ namespace tesseract_collision::tesseract_collision_bullet
  * the user data is located. This was modifed to check if collision is done for the contact test type FIRST during the
  * internal broadphase of the compound shapes and exit early.
  *
+ * The child closest point algorithms are cached per child pair, the same as the contact point algorithms, so a
+ * compound pair that persists across queries does not create and free them for every child pair of every query. For
+ * ContactTestType::CLOSEST and FIRST the traversal threshold shrinks to the distance of the best contact found so far
+ * and child pairs whose bounding boxes are farther apart than it are skipped.
+ *
  * Note: This could be removed in the future but the callback need to be modifed to accept the collision object along
  * with the collision shape. I don't believe this will be an issue since all of the other callback in Bullet accept
  * both.
@@ -55,12 +60,14 @@ namespace tesseract_collision::tesseract_collision_bullet
 class TesseractCompoundCompoundCollisionAlgorithm : public TesseractCompoundCollisionAlgorithm  // NOLINT
 {
   class btHashedSimplePairCache* m_childCollisionAlgorithmCache;
+  class btHashedSimplePairCache* m_childClosestPointAlgorithmCache;
   btSimplePairArray m_removePairs;
 
   int m_compoundShapeRevision0;  // to keep track of changes, so that childAlgorithm array can be updated
   int m_compoundShapeRevision1;
 
   void removeChildAlgorithms();
+  void removeChildAlgorithms(btHashedSimplePairCache& cache);
 
 public:
   TesseractCompoundCompoundCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
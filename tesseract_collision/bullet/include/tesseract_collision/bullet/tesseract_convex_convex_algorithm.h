@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
+#include <tesseract_collision/bullet/tesseract_gjk_pair_detector.h>
 
 class btConvexPenetrationDepthSolver;
 
@@ -82,6 +83,7 @@ class TesseractConvexConvexAlgorithm : public btActivatingCollisionAlgorithm
   ContactTestData* m_cdata;
 
   /// cache separating vector to speedup collision detection
+  GjkWarmStartCache* m_warmStartCache;
 
 public:
   TesseractConvexConvexAlgorithm(btPersistentManifold* mf,
@@ -90,7 +92,8 @@ public:
                                  const btCollisionObjectWrapper* body1Wrap,
                                  btConvexPenetrationDepthSolver* pdSolver,
                                  int numPerturbationIterations,
-                                 int minimumPointsPerturbationThreshold);
+                                 int minimumPointsPerturbationThreshold,
+                                 GjkWarmStartCache* warmStartCache = nullptr);
 
   ~TesseractConvexConvexAlgorithm() override;
   TesseractConvexConvexAlgorithm(const TesseractConvexConvexAlgorithm&) = delete;
@@ -124,6 +127,7 @@ public:
     btConvexPenetrationDepthSolver* m_pdSolver;
     int m_numPerturbationIterations{ 0 };
     int m_minimumPointsPerturbationThreshold{ 3 };
+    GjkWarmStartCache* m_warmStartCache{ nullptr };
 
     CreateFunc(btConvexPenetrationDepthSolver* pdSolver);
 
@@ -138,7 +142,8 @@ public:
                                                       body1Wrap,
                                                       m_pdSolver,
                                                       m_numPerturbationIterations,
-                                                      m_minimumPointsPerturbationThreshold);
+                                                      m_minimumPointsPerturbationThreshold,
+                                                      m_warmStartCache);
     }
   };
 };
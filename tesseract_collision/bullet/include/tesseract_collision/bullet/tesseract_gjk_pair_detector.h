@@ -22,9 +22,11 @@ software.
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/NarrowPhaseCollision/btDiscreteCollisionDetectorInterface.h>
 #include <BulletCollision/CollisionShapes/btCollisionMargin.h>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 class btConvexShape;
+class btCollisionObject;
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/NarrowPhaseCollision/btSimplexSolverInterface.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -64,6 +66,8 @@ class TesseractGjkPairDetector : public btDiscreteCollisionDetectorInterface
 
   const ContactTestData* m_cdata;
 
+  btVector3* m_warmStartAxis{ nullptr };
+
 public:
   // some debugging to fix degeneracy problems
   int m_lastUsedMethod;
@@ -110,6 +114,70 @@ public:
 
   /// don't use setIgnoreMargin, it's for Bullet's internal use
   void setIgnoreMargin(bool ignoreMargin) { m_ignoreMargin = ignoreMargin; }
+
+  /**
+   * @brief Provide a separating axis used to seed the next query and updated with the result of the query
+   * @details A zero axis is ignored, so a newly created entry starts from the default search direction
+   * @param warmStartAxis The separating axis, it must outlive the calls to getClosestPoints
+   */
+  void setWarmStartAxis(btVector3* warmStartAxis) { m_warmStartAxis = warmStartAxis; }
+};
+
+/**
+ * @brief Stores the last separating axis found by GJK for each pair of shapes
+ * @details The key is the collision object and child shape index of both shapes, so each shape of a compound is
+ * stored separately. Consecutive queries of the same pair at nearby poses converge in fewer iterations when seeded
+ * with the previous axis.
+ */
+class GjkWarmStartCache
+{
+public:
+  /**
+   * @brief Get the separating axis for a pair of shapes, a zero axis is inserted if the pair is not stored
+   * @param obj0 The collision object of the first shape
+   * @param index0 The child shape index of the first shape, -1 if it is not part of a compound
+   * @param obj1 The collision object of the second shape
+   * @param index1 The child shape index of the second shape, -1 if it is not part of a compound
+   * @return The stored separating axis
+   */
+  btVector3& get(const btCollisionObject* obj0, int index0, const btCollisionObject* obj1, int index1);
+
+  /** @brief Remove all stored separating axes, this must be called when collision objects are removed */
+  void clear();
+
+  /** @brief The number of stored pairs */
+  std::size_t size() const;
+
+  /**
+   * @brief Enable or disable the use of the cache by the collision algorithms, disabling it clears the cache
+   * @param enabled Indicate if the cache should be used
+   */
+  void setEnabled(bool enabled);
+
+  /** @brief Check if the cache is used by the collision algorithms */
+  bool isEnabled() const;
+
+private:
+  struct Key
+  {
+    const btCollisionObject* obj0;
+    int index0;
+    const btCollisionObject* obj1;
+    int index1;
+
+    bool operator==(const Key& other) const
+    {
+      return obj0 == other.obj0 && index0 == other.index0 && obj1 == other.obj1 && index1 == other.index1;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  std::unordered_map<Key, btVector3, KeyHash> data_;
+  bool enabled_{ false };
 };
 }  // namespace tesseract_collision::tesseract_collision_bullet
 #endif  // TESSERACT_COLLISION_TESSERACT_GJK_PAIR_DETECTOR_H
@@ -0,0 +1,106 @@
+/**
+ * @file tesseract_octree_collision_algorithm.h
+ * @brief Bullet collision algorithm for the octree collision shape
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Supports collision between an OctreeShape and other collision shapes
+ *
+ * The octree is traversed from the root, skipping nodes which do not overlap the bounding box of the other shape or
+ * have no occupied children. Each occupied leaf is checked against the other shape using the algorithm provided by the
+ * dispatcher for the shape of the cell, which is cast when the octree shape is cast. The cell algorithms only exist for
+ * the duration of the check, so nothing is allocated per cell between contact tests.
+ */
+class TesseractOctreeCollisionAlgorithm : public btActivatingCollisionAlgorithm
+{
+public:
+  TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                    const btCollisionObjectWrapper* body0Wrap,
+                                    const btCollisionObjectWrapper* body1Wrap,
+                                    bool isSwapped);
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  void getAllContactManifolds(btManifoldArray& manifoldArray) override;
+
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, false);
+    }
+  };
+
+  struct SwappedCreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, true);
+    }
+  };
+
+private:
+  bool m_isSwapped;
+};
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
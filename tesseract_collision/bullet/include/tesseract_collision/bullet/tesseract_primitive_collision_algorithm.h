@@ -0,0 +1,107 @@
+/**
+ * @file tesseract_primitive_collision_algorithm.h
+ * @brief Bullet collision algorithm with closed form kernels for sphere, capsule and box pairs
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_PRIMITIVE_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_PRIMITIVE_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Calculates the distance of sphere-sphere, sphere-capsule, capsule-capsule, sphere-box and box-box pairs with
+ * the closed form kernels of primitive_distance.h instead of GJK and EPA
+ * @details A single contact point with the exact nearest points and normal is added to the manifold.
+ */
+class TesseractPrimitiveCollisionAlgorithm : public btActivatingCollisionAlgorithm
+{
+public:
+  TesseractPrimitiveCollisionAlgorithm(btPersistentManifold* mf,
+                                       const btCollisionAlgorithmConstructionInfo& ci,
+                                       const btCollisionObjectWrapper* body0Wrap,
+                                       const btCollisionObjectWrapper* body1Wrap);
+
+  ~TesseractPrimitiveCollisionAlgorithm() override;
+  TesseractPrimitiveCollisionAlgorithm(const TesseractPrimitiveCollisionAlgorithm&) = delete;
+  TesseractPrimitiveCollisionAlgorithm& operator=(const TesseractPrimitiveCollisionAlgorithm&) = delete;
+  TesseractPrimitiveCollisionAlgorithm(TesseractPrimitiveCollisionAlgorithm&&) = delete;
+  TesseractPrimitiveCollisionAlgorithm& operator=(TesseractPrimitiveCollisionAlgorithm&&) = delete;
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  void getAllContactManifolds(btManifoldArray& manifoldArray) override;
+
+  /**
+   * @brief Check if a pair of shape proxy types has a closed form kernel
+   * @param proxyType0 The proxy type of the first shape
+   * @param proxyType1 The proxy type of the second shape
+   * @return True if the pair is handled by this algorithm
+   */
+  static bool isSupported(int proxyType0, int proxyType1);
+
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractPrimitiveCollisionAlgorithm));
+      return new (mem) TesseractPrimitiveCollisionAlgorithm(ci.m_manifold, ci, body0Wrap, body1Wrap);
+    }
+  };
+
+private:
+  bool m_ownManifold{ false };
+  btPersistentManifold* m_manifoldPtr;
+};
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_TESSERACT_PRIMITIVE_COLLISION_ALGORITHM_H
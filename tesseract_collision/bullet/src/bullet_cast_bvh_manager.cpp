@@ -39,7 +39,14 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include "tesseract_collision/bullet/bullet_cast_bvh_manager.h"
+#include "tesseract_collision/core/common.h"
+#include "tesseract_common/tracing.h"
 
 extern btScalar gDbvtMargin;  // NOLINT
 
@@ -48,20 +55,13 @@ namespace tesseract_collision::tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletCastBVHManager::BulletCastBVHManager(std::string name) : name_(std::move(name))
+BulletCastBVHManager::BulletCastBVHManager(std::string name)
+  : name_(std::move(name)), coll_config_(getCollisionConstructionInfo(ContactManagerPoolConfig(), 0))
 {
   // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
   gDbvtMargin = 0;
 
-  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
-
-  dispatcher_->registerCollisionCreateFunc(
-      BOX_SHAPE_PROXYTYPE,
-      BOX_SHAPE_PROXYTYPE,
-      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
-
-  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
-                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+  dispatcher_ = createDispatcher(coll_config_);
 
   broadphase_ = std::make_unique<btDbvtBroadphase>();
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
@@ -84,10 +84,11 @@ std::string BulletCastBVHManager::getName() const { return name_; }
 
 ContinuousContactManager::UPtr BulletCastBVHManager::clone() const
 {
+  TESSERACT_TRACE_ZONE("BulletCastBVHManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("BulletCastBVHManager");
+  clones.increment();
   auto manager = std::make_unique<BulletCastBVHManager>();
 
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-
   for (const auto& cow : link2cow_)
   {
     COW::Ptr new_cow = cow.second->clone();
@@ -96,14 +97,16 @@ ContinuousContactManager::UPtr BulletCastBVHManager::clone() const
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
     new_cow->setWorldTransform(cow.second->getWorldTransform());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
 
     manager->addCollisionObject(new_cow);
   }
 
   manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setPoolConfig(pool_config_);
 
   return manager;
 }
@@ -120,8 +123,7 @@ bool BulletCastBVHManager::addCollisionObject(const std::string& name,
   COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
   if (new_cow != nullptr)
   {
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
     addCollisionObject(new_cow);
     return true;
   }
@@ -129,6 +131,34 @@ bool BulletCastBVHManager::addCollisionObject(const std::string& name,
   return false;
 }
 
+bool BulletCastBVHManager::addCollisionObjects(const std::vector<std::string>& names,
+                                               const int& mask_id,
+                                               const std::vector<CollisionShapesConst>& shapes,
+                                               const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                               bool enabled)
+{
+  // The collision objects are independent so they are created in parallel and then added in order
+  std::vector<COW::Ptr> new_cows = createCollisionObjects(names, mask_id, shapes, shape_poses, enabled);
+
+  bool added = true;
+  for (const auto& new_cow : new_cows)
+  {
+    if (new_cow == nullptr)
+    {
+      added = false;
+      continue;
+    }
+
+    if (link2cow_.find(new_cow->getName()) != link2cow_.end())
+      removeCollisionObject(new_cow->getName());
+
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
+    addCollisionObject(new_cow);
+  }
+
+  return added;
+}
+
 const CollisionShapesConst& BulletCastBVHManager::getCollisionObjectGeometries(const std::string& name) const
 {
   auto cow = link2cow_.find(name);
@@ -159,9 +189,12 @@ bool BulletCastBVHManager::removeCollisionObject(const std::string& name)
     removeCollisionObjectFromBroadphase(cow1, broadphase_, dispatcher_);
     link2cow_.erase(name);
 
-    COW::Ptr& cow2 = link2castcow_[name];
-    removeCollisionObjectFromBroadphase(cow2, broadphase_, dispatcher_);
-    link2castcow_.erase(name);
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+    {
+      removeCollisionObjectFromBroadphase(cast_it->second, broadphase_, dispatcher_);
+      link2castcow_.erase(cast_it);
+    }
 
     return true;
   }
@@ -182,14 +215,18 @@ bool BulletCastBVHManager::enableCollisionObject(const std::string& name)
     if (it->second->getBroadphaseHandle() != nullptr)
       broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
 
-    auto cast_cow = link2castcow_[name];
-    cast_cow->m_enabled = true;
-
-    // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
-    // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
-    // this must be called or contacts between shapes will be missed.
-    if (cast_cow->getBroadphaseHandle() != nullptr)
-      broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cast_cow->getBroadphaseHandle(), dispatcher_.get());
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+    {
+      const COW::Ptr& cast_cow = cast_it->second;
+      cast_cow->m_enabled = true;
+
+      // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
+      // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like
+      // filters this must be called or contacts between shapes will be missed.
+      if (cast_cow->getBroadphaseHandle() != nullptr)
+        broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cast_cow->getBroadphaseHandle(), dispatcher_.get());
+    }
 
     return true;
   }
@@ -210,14 +247,18 @@ bool BulletCastBVHManager::disableCollisionObject(const std::string& name)
     if (it->second->getBroadphaseHandle() != nullptr)
       broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
 
-    auto cast_cow = link2castcow_[name];
-    cast_cow->m_enabled = false;
-
-    // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
-    // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
-    // this must be called or contacts between shapes will be missed.
-    if (cast_cow->getBroadphaseHandle() != nullptr)
-      broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cast_cow->getBroadphaseHandle(), dispatcher_.get());
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+    {
+      const COW::Ptr& cast_cow = cast_it->second;
+      cast_cow->m_enabled = false;
+
+      // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
+      // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like
+      // filters this must be called or contacts between shapes will be missed.
+      if (cast_cow->getBroadphaseHandle() != nullptr)
+        broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cast_cow->getBroadphaseHandle(), dispatcher_.get());
+    }
 
     return true;
   }
@@ -234,6 +275,16 @@ bool BulletCastBVHManager::isCollisionObjectEnabled(const std::string& name) con
   return false;
 }
 
+bool BulletCastBVHManager::getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  pose = convertBtToEigen(it->second->getWorldTransform());
+  return true;
+}
+
 void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -244,7 +295,10 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
     COW::Ptr& cow = it->second;
     btTransform tf = convertEigenToBt(pose);
     cow->setWorldTransform(tf);
-    link2castcow_[name]->setWorldTransform(tf);
+
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+      cast_it->second->setWorldTransform(tf);
 
     // Now update Broadphase AABB (See BulletWorld updateSingleAabb function)
     if (cow->getBroadphaseHandle() != nullptr)
@@ -292,6 +346,11 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        assert(dynamic_cast<OctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<OctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -307,6 +366,15 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+          {
+            assert(dynamic_cast<OctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<OctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -365,6 +433,34 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const tesseract_common::
   }
 }
 
+bool BulletCastBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                       std::size_t shape_index,
+                                                       const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  COW::Ptr& cow = it->second;
+  if (!tesseract_collision_bullet::updateCollisionObjectOctree(cow, shape_index, delta))
+    return false;
+
+  // Only one of the collision objects is in the broadphase depending on if it is active
+  if (cow->getBroadphaseHandle() != nullptr)
+    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+
+  auto cast_it = link2castcow_.find(name);
+  if (cast_it != link2castcow_.end())
+  {
+    COW::Ptr& cast_cow = cast_it->second;
+    tesseract_collision_bullet::updateCollisionObjectOctree(cast_cow, shape_index, delta);
+    if (cast_cow->getBroadphaseHandle() != nullptr)
+      updateBroadphaseAABB(cast_cow, broadphase_, dispatcher_);
+  }
+
+  return true;
+}
+
 const std::vector<std::string>& BulletCastBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletCastBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -374,57 +470,31 @@ void BulletCastBVHManager::setActiveCollisionObjects(const std::vector<std::stri
 
   // Now need to update the broadphase with correct aabb
   for (auto& co : link2cow_)
-  {
-    COW::Ptr& cow = co.second;
-
-    // Need to check if a collision object is still active
-    if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
-    {
-      // Update with active
-      updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
-
-      // Get the active collision object
-      COW::Ptr& active_cow = link2castcow_[cow->getName()];
+    updateActiveCollisionObject(co.second);
+}
 
-      // Update with active
-      updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
+const std::vector<std::string>& BulletCastBVHManager::getActiveCollisionObjects() const { return active_; }
 
-      // Check if the link is still active.
-      if (!isLinkActive(active_, cow->getName()))
-      {
-        // Remove the active collision object from the broadphase
-        removeCollisionObjectFromBroadphase(active_cow, broadphase_, dispatcher_);
+void BulletCastBVHManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  // Only the changed objects move between the static and active sets
+  for (const auto& name : names)
+  {
+    auto it = std::find(active_.begin(), active_.end(), name);
+    if ((it != active_.end()) == active)
+      continue;
 
-        // Add the active collision object to the broadphase
-        addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
-      }
-    }
+    if (active)
+      active_.push_back(name);
     else
-    {
-      // Update with active
-      updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
+      active_.erase(it);
 
-      // Get the active collision object
-      COW::Ptr& active_cow = link2castcow_[cow->getName()];
-
-      // Update with active
-      updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
-
-      // Check if link is now active
-      if (isLinkActive(active_, cow->getName()))
-      {
-        // Remove the static collision object from the broadphase
-        removeCollisionObjectFromBroadphase(cow, broadphase_, dispatcher_);
-
-        // Add the active collision object to the broadphase
-        addCollisionObjectToBroadphase(active_cow, broadphase_, dispatcher_);
-      }
-    }
+    auto cow_it = link2cow_.find(name);
+    if (cow_it != link2cow_.end())
+      updateActiveCollisionObject(cow_it->second);
   }
 }
 
-const std::vector<std::string>& BulletCastBVHManager::getActiveCollisionObjects() const { return active_; }
-
 void BulletCastBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
                                                   CollisionMarginOverrideType override_type)
 {
@@ -452,12 +522,73 @@ const CollisionMarginData& BulletCastBVHManager::getCollisionMarginData() const
 }
 void BulletCastBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
 IsContactAllowedFn BulletCastBVHManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
+void BulletCastBVHManager::setStatisticsEnabled(bool enabled)
+{
+  contact_test_data_.statistics = enabled ? &statistics_ : nullptr;
+}
+
+bool BulletCastBVHManager::getStatisticsEnabled() const { return (contact_test_data_.statistics != nullptr); }
+
+ContactManagerStatistics BulletCastBVHManager::getStatistics() const { return statistics_; }
+
+void BulletCastBVHManager::clearStatistics() { statistics_.clear(); }
+
+void BulletCastBVHManager::setPoolConfig(const ContactManagerPoolConfig& config)
+{
+  if (config == pool_config_ && link2cow_.size() <= pool_object_count_)
+    return;
+
+  pool_config_ = config;
+  resizePools(link2cow_.size());
+}
+
+std::optional<ContactManagerPoolConfig> BulletCastBVHManager::getPoolConfig() const { return pool_config_; }
+
+void BulletCastBVHManager::resizePools(std::size_t object_count)
+{
+  // The collision algorithms cached for the overlapping pairs are allocated from the pools
+  clearBroadphaseAlgorithms(*broadphase_, *dispatcher_);
+  resizeCollisionPools(coll_config_, dispatcher_, pool_config_, object_count);
+
+  pool_object_count_ = object_count;
+}
+
+tesseract_common::MemoryUsage BulletCastBVHManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(BulletCastBVHManager);
+  for (const auto& cow : link2cow_)
+    usage.children.push_back(cow.second->getMemoryUsage(tracker));
+
+  usage.addChild("broadphase").unique_bytes = getBroadphaseBytes(*broadphase_);
+
+  usage.addChild("pools").unique_bytes = coll_config_.getPoolBytes();
+
+  return usage;
+}
+
 void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_TRACE_ZONE("BulletCastBVHManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("BulletCastBVHManager");
+  const tesseract_common::MetricTimer latency_timer(latency);
+
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
+  ContactManagerStatistics* statistics = contact_test_data_.statistics;
+  if (statistics != nullptr)
+    ++statistics->contact_tests;
+
+  ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->contact_test_time : nullptr);
+
+  updateBroadphaseAllowedCollisionMatrix();
+
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
   btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
@@ -467,7 +598,23 @@ void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const Conta
 
   TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
 
-  pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  processOverlappingPairs(*pairCache, collisionCallback, contact_test_data_, pair_order_);
+}
+
+void BulletCastBVHManager::updateBroadphaseAllowedCollisionMatrix()
+{
+  auto acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (acm == broadphase_overlap_cb_.getAllowedCollisionMatrix())
+    return;
+
+  broadphase_overlap_cb_.setAllowedCollisionMatrix(std::move(acm));
+
+  // The overlap filter is only called when a pair is added, so the proxies are recreated to rebuild the pair cache
+  for (auto& co : link2cow_)
+    refreshBroadphaseProxy(co.second, broadphase_, dispatcher_);
+
+  for (auto& co : link2castcow_)
+    refreshBroadphaseProxy(co.second, broadphase_, dispatcher_);
 }
 
 void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
@@ -476,14 +623,9 @@ void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
-  // Create cast collision object
-  COW::Ptr cast_cow = makeCastCollisionObject(cow);
-  cast_cow->setUserPointer(&contact_test_data_);
-
-  // Add it to the cast map
-  link2castcow_[cast_cow->getName()] = cast_cow;
-
-  const COW::Ptr& selected_cow = (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter) ? cast_cow : cow;
+  // The cast collision object is only created for active links, static links share their shapes with the clones
+  const COW::Ptr& selected_cow =
+      (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter) ? getCastCollisionObject(cow) : cow;
 
   btVector3 aabb_min, aabb_max;
   selected_cow->getAABB(aabb_min, aabb_max);
@@ -498,13 +640,72 @@ void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
                                                              dispatcher_.get()));
 }
 
+COW::Ptr& BulletCastBVHManager::getCastCollisionObject(const COW::Ptr& cow)
+{
+  COW::Ptr& cast_cow = link2castcow_[cow->getName()];
+  if (cast_cow == nullptr)
+  {
+    cast_cow = makeCastCollisionObject(cow);
+    cast_cow->setUserPointer(&contact_test_data_);
+    cast_cow->setContactProcessingThreshold(cow->getContactProcessingThreshold());
+  }
+
+  return cast_cow;
+}
+
+void BulletCastBVHManager::updateActiveCollisionObject(const COW::Ptr& cow)
+{
+  // Need to check if a collision object is still active
+  if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+  {
+    // Update with active
+    updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
+
+    // Get the active collision object
+    COW::Ptr& active_cow = getCastCollisionObject(cow);
+
+    // Update with active
+    updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
+
+    // Check if the link is still active.
+    if (!isLinkActive(active_, cow->getName()))
+    {
+      // Remove the active collision object from the broadphase
+      removeCollisionObjectFromBroadphase(active_cow, broadphase_, dispatcher_);
+
+      // Add the active collision object to the broadphase
+      addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
+    }
+  }
+  else
+  {
+    // Update with active
+    updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
+
+    // Check if link is now active
+    if (isLinkActive(active_, cow->getName()))
+    {
+      // Get the active collision object, it is created the first time the link is active
+      COW::Ptr& active_cow = getCastCollisionObject(cow);
+
+      // Update with active
+      updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
+
+      // Remove the static collision object from the broadphase
+      removeCollisionObjectFromBroadphase(cow, broadphase_, dispatcher_);
+
+      // Add the active collision object to the broadphase
+      addCollisionObjectToBroadphase(active_cow, broadphase_, dispatcher_);
+    }
+  }
+}
+
 void BulletCastBVHManager::onCollisionMarginDataChanged()
 {
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
-    cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(cow, contact_test_data_.collision_margin_data);
     if (cow->getBroadphaseHandle() != nullptr)
       updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
@@ -512,7 +713,7 @@ void BulletCastBVHManager::onCollisionMarginDataChanged()
   for (auto& co : link2castcow_)
   {
     COW::Ptr& cow = co.second;
-    cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(cow, contact_test_data_.collision_margin_data);
     if (cow->getBroadphaseHandle() != nullptr)
       updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
@@ -39,24 +39,24 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include "tesseract_collision/bullet/bullet_cast_simple_manager.h"
+#include "tesseract_collision/core/common.h"
+#include "tesseract_common/tracing.h"
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletCastSimpleManager::BulletCastSimpleManager(std::string name) : name_(std::move(name))
+BulletCastSimpleManager::BulletCastSimpleManager(std::string name)
+  : name_(std::move(name)), coll_config_(getCollisionConstructionInfo(ContactManagerPoolConfig(), 0))
 {
-  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
-
-  dispatcher_->registerCollisionCreateFunc(
-      BOX_SHAPE_PROXYTYPE,
-      BOX_SHAPE_PROXYTYPE,
-      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
-
-  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
-                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+  dispatcher_ = createDispatcher(coll_config_);
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
 }
 
@@ -64,10 +64,11 @@ std::string BulletCastSimpleManager::getName() const { return name_; }
 
 ContinuousContactManager::UPtr BulletCastSimpleManager::clone() const
 {
+  TESSERACT_TRACE_ZONE("BulletCastSimpleManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("BulletCastSimpleManager");
+  clones.increment();
   auto manager = std::make_unique<BulletCastSimpleManager>();
 
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-
   for (const auto& cow : link2cow_)
   {
     COW::Ptr new_cow = cow.second->clone();
@@ -76,14 +77,16 @@ ContinuousContactManager::UPtr BulletCastSimpleManager::clone() const
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
     new_cow->setWorldTransform(cow.second->getWorldTransform());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
 
     manager->addCollisionObject(new_cow);
   }
 
   manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setPoolConfig(pool_config_);
 
   return manager;
 }
@@ -100,8 +103,7 @@ bool BulletCastSimpleManager::addCollisionObject(const std::string& name,
   COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
   if (new_cow != nullptr)
   {
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
     addCollisionObject(new_cow);
     return true;
   }
@@ -109,6 +111,34 @@ bool BulletCastSimpleManager::addCollisionObject(const std::string& name,
   return false;
 }
 
+bool BulletCastSimpleManager::addCollisionObjects(const std::vector<std::string>& names,
+                                                  const int& mask_id,
+                                                  const std::vector<CollisionShapesConst>& shapes,
+                                                  const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                  bool enabled)
+{
+  // The collision objects are independent so they are created in parallel and then added in order
+  std::vector<COW::Ptr> new_cows = createCollisionObjects(names, mask_id, shapes, shape_poses, enabled);
+
+  bool added = true;
+  for (const auto& new_cow : new_cows)
+  {
+    if (new_cow == nullptr)
+    {
+      added = false;
+      continue;
+    }
+
+    if (link2cow_.find(new_cow->getName()) != link2cow_.end())
+      removeCollisionObject(new_cow->getName());
+
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
+    addCollisionObject(new_cow);
+  }
+
+  return added;
+}
+
 const CollisionShapesConst& BulletCastSimpleManager::getCollisionObjectGeometries(const std::string& name) const
 {
   auto cow = link2cow_.find(name);
@@ -150,7 +180,11 @@ bool BulletCastSimpleManager::enableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = true;
-    link2castcow_[name]->m_enabled = true;
+
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+      cast_it->second->m_enabled = true;
+
     return true;
   }
 
@@ -163,7 +197,11 @@ bool BulletCastSimpleManager::disableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = false;
-    link2castcow_[name]->m_enabled = false;
+
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+      cast_it->second->m_enabled = false;
+
     return true;
   }
 
@@ -179,6 +217,16 @@ bool BulletCastSimpleManager::isCollisionObjectEnabled(const std::string& name)
   return false;
 }
 
+bool BulletCastSimpleManager::getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  pose = convertBtToEigen(it->second->getWorldTransform());
+  return true;
+}
+
 void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -188,7 +236,10 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
   {
     btTransform tf = convertEigenToBt(pose);
     it->second->setWorldTransform(tf);
-    link2castcow_[name]->setWorldTransform(tf);
+
+    auto cast_it = link2castcow_.find(name);
+    if (cast_it != link2castcow_.end())
+      cast_it->second->setWorldTransform(tf);
   }
 }
 
@@ -232,6 +283,11 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        assert(dynamic_cast<OctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<OctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -247,6 +303,15 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+          {
+            assert(dynamic_cast<OctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<OctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -300,6 +365,24 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const tesseract_commo
   }
 }
 
+bool BulletCastSimpleManager::updateCollisionObjectOctree(const std::string& name,
+                                                          std::size_t shape_index,
+                                                          const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  if (!tesseract_collision_bullet::updateCollisionObjectOctree(it->second, shape_index, delta))
+    return false;
+
+  auto cast_it = link2castcow_.find(name);
+  if (cast_it != link2castcow_.end())
+    tesseract_collision_bullet::updateCollisionObjectOctree(cast_it->second, shape_index, delta);
+
+  return true;
+}
+
 const std::vector<std::string>& BulletCastSimpleManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -318,15 +401,15 @@ void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::s
     // Update with request
     updateCollisionObjectFilters(active_, cow);
 
-    // Get the cast collision object
-    COW::Ptr cast_cow = link2castcow_[cow->getName()];
-
-    // Update with request
-    updateCollisionObjectFilters(active_, cast_cow);
-
     // Add to collision object vector
     if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
     {
+      // Get the cast collision object, it is created the first time the link is active
+      COW::Ptr cast_cow = getCastCollisionObject(cow);
+
+      // Update with request
+      updateCollisionObjectFilters(active_, cast_cow);
+
       cows_.insert(cows_.begin(), cast_cow);
     }
     else
@@ -365,12 +448,68 @@ const CollisionMarginData& BulletCastSimpleManager::getCollisionMarginData() con
 }
 void BulletCastSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
 IsContactAllowedFn BulletCastSimpleManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
+void BulletCastSimpleManager::setStatisticsEnabled(bool enabled)
+{
+  contact_test_data_.statistics = enabled ? &statistics_ : nullptr;
+}
+
+bool BulletCastSimpleManager::getStatisticsEnabled() const { return (contact_test_data_.statistics != nullptr); }
+
+ContactManagerStatistics BulletCastSimpleManager::getStatistics() const { return statistics_; }
+
+void BulletCastSimpleManager::clearStatistics() { statistics_.clear(); }
+
+void BulletCastSimpleManager::setPoolConfig(const ContactManagerPoolConfig& config)
+{
+  if (config == pool_config_ && link2cow_.size() <= pool_object_count_)
+    return;
+
+  pool_config_ = config;
+  resizePools(link2cow_.size());
+}
+
+std::optional<ContactManagerPoolConfig> BulletCastSimpleManager::getPoolConfig() const { return pool_config_; }
+
+void BulletCastSimpleManager::resizePools(std::size_t object_count)
+{
+  resizeCollisionPools(coll_config_, dispatcher_, pool_config_, object_count);
+
+  pool_object_count_ = object_count;
+}
+
+tesseract_common::MemoryUsage
+BulletCastSimpleManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(BulletCastSimpleManager);
+  for (const auto& cow : link2cow_)
+    usage.children.push_back(cow.second->getMemoryUsage(tracker));
+
+  usage.addChild("pools").unique_bytes = coll_config_.getPoolBytes();
+
+  return usage;
+}
+
 void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_TRACE_ZONE("BulletCastSimpleManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("BulletCastSimpleManager");
+  const tesseract_common::MetricTimer latency_timer(latency);
+
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
+  ContactManagerStatistics* statistics = contact_test_data_.statistics;
+  if (statistics != nullptr)
+    ++statistics->contact_tests;
+
+  ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->contact_test_time : nullptr);
+
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
     const COW::Ptr& cow1 = *cow1_iter;
@@ -400,6 +539,9 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 
       if (aabb_check)
       {
+        if (statistics != nullptr)
+          ++statistics->broadphase_pairs;
+
         bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
 
         if (needs_collision)
@@ -416,12 +558,16 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
             contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
 
             // discrete collision detection query
-            algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
+            processCollisionAlgorithm(*algorithm, obA, obB, dispatch_info_, contactPointResult, statistics);
 
             algorithm->~btCollisionAlgorithm();
             dispatcher_->freeCollisionAlgorithm(algorithm);
           }
         }
+        else if (statistics != nullptr)
+        {
+          ++statistics->rejected_pairs;
+        }
       }
 
       if (contact_test_data_.done)
@@ -439,27 +585,33 @@ void BulletCastSimpleManager::addCollisionObject(const COW::Ptr& cow)
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
-  // Create cast collision object
-  COW::Ptr cast_cow = makeCastCollisionObject(cow);
-  cast_cow->setUserPointer(&contact_test_data_);
-
-  // Add it to the cast map
-  link2castcow_[cast_cow->getName()] = cast_cow;
-
+  // The cast collision object is only created for active links, static links share their shapes with the clones
   if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
-    cows_.insert(cows_.begin(), cast_cow);
+    cows_.insert(cows_.begin(), getCastCollisionObject(cow));
   else
     cows_.push_back(cow);
 }
 
+COW::Ptr& BulletCastSimpleManager::getCastCollisionObject(const COW::Ptr& cow)
+{
+  COW::Ptr& cast_cow = link2castcow_[cow->getName()];
+  if (cast_cow == nullptr)
+  {
+    cast_cow = makeCastCollisionObject(cow);
+    cast_cow->setUserPointer(&contact_test_data_);
+    cast_cow->setContactProcessingThreshold(cow->getContactProcessingThreshold());
+  }
+
+  return cast_cow;
+}
+
 void BulletCastSimpleManager::onCollisionMarginDataChanged()
 {
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
-    co.second->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(co.second, contact_test_data_.collision_margin_data);
 
   for (auto& co : link2castcow_)
-    co.second->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(co.second, contact_test_data_.collision_margin_data);
 }
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
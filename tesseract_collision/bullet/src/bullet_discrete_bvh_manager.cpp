@@ -39,7 +39,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/tracing.h>
 
 extern btScalar gDbvtMargin;  // NOLINT
 
@@ -48,20 +56,18 @@ namespace tesseract_collision::tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name) : name_(std::move(name))
+BulletDiscreteBVHManager::NarrowphaseWorker::NarrowphaseWorker(const btDefaultCollisionConstructionInfo& info)
+  : coll_config(info), dispatcher(createDispatcher(coll_config))
+{
+}
+
+BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name)
+  : name_(std::move(name)), coll_config_(getCollisionConstructionInfo(ContactManagerPoolConfig(), 0))
 {
   // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
   gDbvtMargin = 0;
 
-  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
-
-  dispatcher_->registerCollisionCreateFunc(
-      BOX_SHAPE_PROXYTYPE,
-      BOX_SHAPE_PROXYTYPE,
-      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
-
-  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
-                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+  dispatcher_ = createDispatcher(coll_config_);
 
   broadphase_ = std::make_unique<btDbvtBroadphase>();
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
@@ -80,26 +86,34 @@ std::string BulletDiscreteBVHManager::getName() const { return name_; }
 
 DiscreteContactManager::UPtr BulletDiscreteBVHManager::clone() const
 {
+  TESSERACT_TRACE_ZONE("BulletDiscreteBVHManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("BulletDiscreteBVHManager");
+  clones.increment();
   auto manager = std::make_unique<BulletDiscreteBVHManager>();
 
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-
-  for (const auto& cow : link2cow_)
+  // Add in handle order so the clone provides the same handles
+  for (const auto& cow : handle2cow_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
-    new_cow->setContactProcessingThreshold(margin);
+    new_cow->setWorldTransform(cow->getWorldTransform());
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
 
     manager->addCollisionObject(new_cow);
   }
 
   manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setNarrowphaseThreads(narrowphase_threads_);
+  manager->setNarrowphaseExecutor(narrowphase_executor_);
+  manager->setGjkWarmStart(coll_config_.getGjkWarmStart());
+  manager->setStaticCollisionWorld(static_world_);
+  manager->setPoolConfig(pool_config_);
 
   return manager;
 }
@@ -116,8 +130,7 @@ bool BulletDiscreteBVHManager::addCollisionObject(const std::string& name,
   COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
   if (new_cow != nullptr)
   {
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
     addCollisionObject(new_cow);
     return true;
   }
@@ -125,6 +138,34 @@ bool BulletDiscreteBVHManager::addCollisionObject(const std::string& name,
   return false;
 }
 
+bool BulletDiscreteBVHManager::addCollisionObjects(const std::vector<std::string>& names,
+                                                   const int& mask_id,
+                                                   const std::vector<CollisionShapesConst>& shapes,
+                                                   const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                   bool enabled)
+{
+  // The collision objects are independent so they are created in parallel and then added in order
+  std::vector<COW::Ptr> new_cows = createCollisionObjects(names, mask_id, shapes, shape_poses, enabled);
+
+  bool added = true;
+  for (const auto& new_cow : new_cows)
+  {
+    if (new_cow == nullptr)
+    {
+      added = false;
+      continue;
+    }
+
+    if (link2cow_.find(new_cow->getName()) != link2cow_.end())
+      removeCollisionObject(new_cow->getName());
+
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
+    addCollisionObject(new_cow);
+  }
+
+  return added;
+}
+
 const CollisionShapesConst& BulletDiscreteBVHManager::getCollisionObjectGeometries(const std::string& name) const
 {
   auto cow = link2cow_.find(name);
@@ -150,9 +191,21 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
   auto it = link2cow_.find(name);  // Levi TODO: Should these check be removed?
   if (it != link2cow_.end())
   {
-    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    // Objects after the removed one shift down so their handle remains their index
+    auto handle = static_cast<std::size_t>(it->second->getHandle());
+    handle2cow_.erase(handle2cow_.begin() + static_cast<long>(handle));
+    for (std::size_t i = handle; i < handle2cow_.size(); ++i)
+      handle2cow_[i]->setHandle(static_cast<int>(i));
+
+    collision_objects_.erase(collision_objects_.begin() + static_cast<long>(handle));
     removeCollisionObjectFromBroadphase(it->second, broadphase_, dispatcher_);
     link2cow_.erase(name);
+    broadphase_changed_ = true;
+
+    // The warm start data is keyed on the collision object address which may be reused
+    coll_config_.getGjkWarmStartCache().clear();
+    for (auto& worker : narrowphase_workers_)
+      worker->coll_config.getGjkWarmStartCache().clear();
     return true;
   }
 
@@ -161,34 +214,12 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
 
 bool BulletDiscreteBVHManager::enableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);  // Levi TODO: Should these check be removed?
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = true;
-
-    // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
-    // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
-    // this must be called or contacts between shapes will be missed.
-    broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
-    return true;
-  }
-  return false;
+  return enableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool BulletDiscreteBVHManager::disableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);  // Levi TODO: Should these check be removed?
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = false;
-
-    // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
-    // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
-    // this must be called or contacts between shapes will be missed.
-    broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(it->second->getBroadphaseHandle(), dispatcher_.get());
-    return true;
-  }
-  return false;
+  return disableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool BulletDiscreteBVHManager::isCollisionObjectEnabled(const std::string& name) const
@@ -200,19 +231,60 @@ bool BulletDiscreteBVHManager::isCollisionObjectEnabled(const std::string& name)
   return false;
 }
 
+int BulletDiscreteBVHManager::getCollisionObjectHandle(const std::string& name) const
+{
+  auto it = link2cow_.find(name);
+  return (it != link2cow_.end()) ? it->second->getHandle() : -1;
+}
+
+bool BulletDiscreteBVHManager::enableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  const COW::Ptr& cow = handle2cow_[static_cast<std::size_t>(handle)];
+  cow->m_enabled = true;
+
+  // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
+  // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
+  // this must be called or contacts between shapes will be missed.
+  broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cow->getBroadphaseHandle(), dispatcher_.get());
+  return true;
+}
+
+bool BulletDiscreteBVHManager::disableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  const COW::Ptr& cow = handle2cow_[static_cast<std::size_t>(handle)];
+  cow->m_enabled = false;
+
+  // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
+  // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
+  // this must be called or contacts between shapes will be missed.
+  broadphase_->getOverlappingPairCache()->cleanProxyFromPairs(cow->getBroadphaseHandle(), dispatcher_.get());
+  return true;
+}
+
 void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
   // geometry
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-  {
-    COW::Ptr& cow = it->second;
-    cow->setWorldTransform(convertEigenToBt(pose));
+  setCollisionObjectsTransform(getCollisionObjectHandle(name), pose);
+}
 
-    // Update Collision Object Broadphase AABB
-    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
-  }
+void BulletDiscreteBVHManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return;
+
+  const COW::Ptr& cow = handle2cow_[static_cast<std::size_t>(handle)];
+  cow->setWorldTransform(convertEigenToBt(pose));
+
+  // Update Collision Object Broadphase AABB
+  if (updateBroadphaseAABB(cow, broadphase_, dispatcher_))
+    broadphase_changed_ = true;
 }
 
 void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -229,6 +301,24 @@ void BulletDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_comm
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+bool BulletDiscreteBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                           std::size_t shape_index,
+                                                           const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  if (!tesseract_collision_bullet::updateCollisionObjectOctree(it->second, shape_index, delta))
+    return false;
+
+  // Update Collision Object Broadphase AABB
+  if (updateBroadphaseAABB(it->second, broadphase_, dispatcher_))
+    broadphase_changed_ = true;
+
+  return true;
+}
+
 const std::vector<std::string>& BulletDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -243,9 +333,35 @@ void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::
     updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
     refreshBroadphaseProxy(cow, broadphase_, dispatcher_);
   }
+  broadphase_changed_ = true;
 }
 
 const std::vector<std::string>& BulletDiscreteBVHManager::getActiveCollisionObjects() const { return active_; }
+
+void BulletDiscreteBVHManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  // Only the changed objects move between the static and active sets
+  for (const auto& name : names)
+  {
+    auto it = std::find(active_.begin(), active_.end(), name);
+    if ((it != active_.end()) == active)
+      continue;
+
+    if (active)
+      active_.push_back(name);
+    else
+      active_.erase(it);
+
+    auto cow_it = link2cow_.find(name);
+    if (cow_it == link2cow_.end())
+      continue;
+
+    updateCollisionObjectFilters(active_, cow_it->second, broadphase_, dispatcher_);
+    refreshBroadphaseProxy(cow_it->second, broadphase_, dispatcher_);
+    broadphase_changed_ = true;
+  }
+}
+
 void BulletDiscreteBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
                                                       CollisionMarginOverrideType override_type)
 {
@@ -273,43 +389,410 @@ const CollisionMarginData& BulletDiscreteBVHManager::getCollisionMarginData() co
 }
 void BulletDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
 IsContactAllowedFn BulletDiscreteBVHManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
+void BulletDiscreteBVHManager::setStatisticsEnabled(bool enabled)
+{
+  contact_test_data_.statistics = enabled ? &statistics_ : nullptr;
+}
+
+bool BulletDiscreteBVHManager::getStatisticsEnabled() const { return (contact_test_data_.statistics != nullptr); }
+
+ContactManagerStatistics BulletDiscreteBVHManager::getStatistics() const { return statistics_; }
+
+void BulletDiscreteBVHManager::clearStatistics() { statistics_.clear(); }
+
+void BulletDiscreteBVHManager::setPoolConfig(const ContactManagerPoolConfig& config)
+{
+  if (config == pool_config_ && link2cow_.size() <= pool_object_count_)
+    return;
+
+  pool_config_ = config;
+  resizePools(link2cow_.size());
+}
+
+std::optional<ContactManagerPoolConfig> BulletDiscreteBVHManager::getPoolConfig() const { return pool_config_; }
+
+void BulletDiscreteBVHManager::resizePools(std::size_t object_count)
+{
+  // The collision algorithms cached for the overlapping pairs are allocated from the pools
+  clearBroadphaseAlgorithms(*broadphase_, *dispatcher_);
+  resizeCollisionPools(coll_config_, dispatcher_, pool_config_, object_count);
+  for (auto& worker : narrowphase_workers_)
+    resizeCollisionPools(worker->coll_config, worker->dispatcher, pool_config_, object_count);
+
+  pool_object_count_ = object_count;
+}
+
+tesseract_common::MemoryUsage
+BulletDiscreteBVHManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(BulletDiscreteBVHManager);
+  for (const auto& cow : link2cow_)
+    usage.children.push_back(cow.second->getMemoryUsage(tracker));
+
+  // The objects of an attached static world share its shapes, so they are only counted once
+  if (!static_world_cows_.empty())
+  {
+    tesseract_common::MemoryUsage& static_usage = usage.addChild("static_world");
+    for (const auto& cow : static_world_cows_)
+      static_usage.children.push_back(cow->getMemoryUsage(tracker));
+  }
+
+  usage.addChild("broadphase").unique_bytes = getBroadphaseBytes(*broadphase_);
+
+  tesseract_common::MemoryUsage& pool_usage = usage.addChild("pools");
+  pool_usage.unique_bytes = coll_config_.getPoolBytes();
+  for (const auto& worker : narrowphase_workers_)
+    pool_usage.unique_bytes += worker->coll_config.getPoolBytes();
+
+  return usage;
+}
+
 void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
-  contact_test_data_.res = &collisions;
+  TESSERACT_TRACE_ZONE("BulletDiscreteBVHManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("BulletDiscreteBVHManager");
+  const tesseract_common::MetricTimer timer(latency);
+
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
+
   contact_test_data_.req = request;
-  contact_test_data_.done = false;
 
-  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  runContactTest(collisions, collisionCallback);
+}
+
+void BulletDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                                const std::vector<tesseract_common::TransformMap>& transforms,
+                                                const ContactRequest& request)
+{
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
+
+  // The request and callbacks are the same for every state so only set them up once
+  contact_test_data_.req = request;
+
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  collisions.resize(transforms.size());
+  for (std::size_t i = 0; i < transforms.size(); ++i)
+  {
+    setCollisionObjectsTransform(transforms[i]);
+    collisions[i].clear();
+    runContactTest(collisions[i], collisionCallback);
+  }
+}
+
+void BulletDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                                const std::vector<std::string>& names,
+                                                const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                                                const ContactRequest& request)
+{
+  // Look up the collision objects once for the whole batch, names not managed are stored as nullptr
+  std::vector<COW::Ptr> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    cows.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
 
-  broadphase_->calculateOverlappingPairs(dispatcher_.get());
+  contact_test_data_.req = request;
 
   DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
                                              contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
   TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
 
-  pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  collisions.resize(poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    if (poses[i].size() != cows.size())
+      throw std::runtime_error("BulletDiscreteBVHManager, batchContactTest number of poses does not match names!");
+
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      if (cows[j] == nullptr)
+        continue;
+
+      cows[j]->setWorldTransform(convertEigenToBt(poses[i][j]));
+
+      // Update Collision Object Broadphase AABB
+      if (updateBroadphaseAABB(cows[j], broadphase_, dispatcher_))
+        broadphase_changed_ = true;
+    }
+
+    collisions[i].clear();
+    runContactTest(collisions[i], collisionCallback);
+  }
 }
 
 void BulletDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setHandle(static_cast<int>(handle2cow_.size()));
   link2cow_[cow->getName()] = cow;
+  handle2cow_.push_back(cow);
   collision_objects_.push_back(cow->getName());
 
   // Add collision object to broadphase
   addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
+  broadphase_changed_ = true;
+}
+
+void BulletDiscreteBVHManager::setNarrowphaseThreads(std::size_t threads)
+{
+  narrowphase_threads_ = std::max<std::size_t>(threads, 1);
+
+  narrowphase_workers_.resize(narrowphase_threads_ - 1);
+  for (auto& worker : narrowphase_workers_)
+  {
+    if (worker == nullptr)
+    {
+      worker = std::make_unique<NarrowphaseWorker>(getCollisionConstructionInfo(pool_config_, pool_object_count_));
+      worker->coll_config.setGjkWarmStart(coll_config_.getGjkWarmStart());
+    }
+  }
+}
+
+std::size_t BulletDiscreteBVHManager::getNarrowphaseThreads() const { return narrowphase_threads_; }
+
+void BulletDiscreteBVHManager::setNarrowphaseExecutor(tesseract_common::Executor::Ptr executor)
+{
+  narrowphase_executor_ = std::move(executor);
+}
+
+const tesseract_common::Executor::Ptr& BulletDiscreteBVHManager::getNarrowphaseExecutor() const
+{
+  return narrowphase_executor_;
+}
+
+void BulletDiscreteBVHManager::setGjkWarmStart(bool enabled)
+{
+  coll_config_.setGjkWarmStart(enabled);
+  for (auto& worker : narrowphase_workers_)
+    worker->coll_config.setGjkWarmStart(enabled);
+}
+
+bool BulletDiscreteBVHManager::getGjkWarmStart() const { return coll_config_.getGjkWarmStart(); }
+
+void BulletDiscreteBVHManager::setStaticCollisionWorld(BulletStaticCollisionWorld::ConstPtr world)
+{
+  static_world_ = std::move(world);
+  static_world_cows_.clear();
+  if (static_world_ == nullptr)
+    return;
+
+  // The collision algorithms find the contact test data through the collision objects, so each manager needs its own
+  // collision objects for the shared shapes
+  static_world_cows_.reserve(static_world_->getBulletCollisionObjects().size());
+  for (const auto& cow : static_world_->getBulletCollisionObjects())
+  {
+    COW::Ptr new_cow = cow->clone();
+    new_cow->setUserPointer(&contact_test_data_);
+    static_world_cows_.push_back(new_cow);
+  }
+}
+
+const BulletStaticCollisionWorld::ConstPtr& BulletDiscreteBVHManager::getStaticCollisionWorld() const
+{
+  return static_world_;
 }
 
 void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
 {
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
-    cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(cow, contact_test_data_.collision_margin_data);
     assert(cow->getBroadphaseHandle() != nullptr);
-    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+    if (updateBroadphaseAABB(cow, broadphase_, dispatcher_))
+      broadphase_changed_ = true;
+  }
+}
+
+void BulletDiscreteBVHManager::updateBroadphaseAllowedCollisionMatrix()
+{
+  auto acm = getCompiledAllowedCollisionMatrix(contact_test_data_.fn);
+  if (acm == broadphase_overlap_cb_.getAllowedCollisionMatrix())
+    return;
+
+  broadphase_overlap_cb_.setAllowedCollisionMatrix(std::move(acm));
+
+  // The overlap filter is only called when a pair is added, so the proxies are recreated to rebuild the pair cache
+  for (auto& co : link2cow_)
+    refreshBroadphaseProxy(co.second, broadphase_, dispatcher_);
+
+  broadphase_changed_ = true;
+}
+
+void BulletDiscreteBVHManager::runContactTest(ContactResultMap& collisions,
+                                              TesseractCollisionPairCallback& collision_callback)
+{
+  contact_test_data_.res = &collisions;
+  contact_test_data_.done = false;
+
+  ContactManagerStatistics* statistics = contact_test_data_.statistics;
+  if (statistics != nullptr)
+    ++statistics->contact_tests;
+
+  ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->contact_test_time : nullptr);
+
+  updateBroadphaseAllowedCollisionMatrix();
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  // The overlapping pairs are kept between calls, so they only need to be updated if an object was added, removed or
+  // its broadphase AABB changed since the last contact test
+  if (broadphase_changed_)
+  {
+    broadphase_->calculateOverlappingPairs(dispatcher_.get());
+    broadphase_changed_ = false;
+  }
+
+  // Stopping at the first contact or the contact limit depends on the order the pairs are processed so it is always
+  // done serially. The statistics are shared with the collision algorithms through the collision objects so they are
+  // also collected serially.
+  if (narrowphase_threads_ > 1 && contact_test_data_.req.type != ContactTestType::FIRST &&
+      contact_test_data_.req.contact_limit <= 0 && statistics == nullptr && pairCache->getNumOverlappingPairs() > 1)
+  {
+    runParallelNarrowphase(collisions, collision_callback);
+  }
+  else
+  {
+    processOverlappingPairs(*pairCache, collision_callback, contact_test_data_, pair_order_);
+  }
+
+  processStaticCollisionWorld(collision_callback);
+}
+
+void BulletDiscreteBVHManager::runParallelNarrowphase(ContactResultMap& collisions,
+                                                      TesseractCollisionPairCallback& collision_callback)
+{
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+  const auto num_pairs = static_cast<std::size_t>(pairCache->getNumOverlappingPairs());
+  btBroadphasePair* pairs = pairCache->getOverlappingPairArrayPtr();
+
+  // The first chunk uses the manager dispatcher so only the remaining chunks need a worker
+  const std::size_t num_chunks = std::min(narrowphase_threads_, num_pairs);
+  const std::size_t chunk_size = (num_pairs + num_chunks - 1) / num_chunks;
+  const double contact_distance = contact_test_data_.collision_margin_data.getMaxCollisionMargin();
+
+  auto process_chunk = [this, pairs, num_pairs, chunk_size, contact_distance](NarrowphaseWorker& worker,
+                                                                              std::size_t chunk) {
+    // The results go to the worker buffer. The collision algorithms get the contact test data from the manifold result
+    // instead of the user pointer of the collision objects, so they only read the contacts found by this worker.
+    ContactTestData cdata = contact_test_data_;
+    worker.results.clear();
+    cdata.res = &worker.results;
+    cdata.done = false;
+
+    DiscreteBroadphaseContactResultCallback cc(cdata, contact_distance);
+    TesseractCollisionPairCallback collision_callback(dispatch_info_, worker.dispatcher.get(), cc);
+
+    const std::size_t begin = chunk * chunk_size;
+    const std::size_t end = std::min(begin + chunk_size, num_pairs);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      // The algorithms stored in the pair cache belong to the manager dispatcher, so use a temporary pair whose
+      // algorithm is created and released by this worker's dispatcher
+      btBroadphasePair pair(*pairs[i].m_pProxy0, *pairs[i].m_pProxy1);
+      collision_callback.processOverlap(pair);
+      if (pair.m_algorithm != nullptr)
+      {
+        pair.m_algorithm->~btCollisionAlgorithm();
+        worker.dispatcher->freeCollisionAlgorithm(pair.m_algorithm);
+      }
+    }
+  };
+
+  // The first chunk is processed with the manager dispatcher, writing directly to collisions. No other thread accesses
+  // collisions until the chunks are merged.
+  auto run_chunk = [&](std::size_t chunk) {
+    if (chunk > 0)
+    {
+      process_chunk(*narrowphase_workers_[chunk - 1], chunk);
+      return;
+    }
+
+    for (std::size_t i = 0; i < chunk_size; ++i)
+      collision_callback.processOverlap(pairs[i]);
+  };
+
+  const tesseract_common::Executor::Ptr executor =
+      (narrowphase_executor_ != nullptr) ? narrowphase_executor_ : tesseract_common::getDefaultExecutor();
+  executor->parallelFor(num_chunks, run_chunk);
+
+  // Each pair of objects produces a unique key so the results from different chunks only need to be combined with
+  // the results already in the map when the caller did not clear it
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk)
+  {
+    for (const auto& pair : narrowphase_workers_[chunk - 1]->results)
+    {
+      ContactResultVector& dr = collisions[pair.first];
+      if (dr.empty() || contact_test_data_.req.type == ContactTestType::ALL)
+      {
+        dr.insert(dr.end(), pair.second.begin(), pair.second.end());
+      }
+      else if (contact_test_data_.req.type == ContactTestType::CLOSEST)
+      {
+        if (pair.second.front().distance < dr.front().distance)
+          dr.front() = pair.second.front();
+      }
+    }
+  }
+}
+
+void BulletDiscreteBVHManager::processStaticCollisionWorld(TesseractCollisionPairCallback& collision_callback)
+{
+  if (static_world_ == nullptr)
+    return;
+
+  for (const auto& cow : handle2cow_)
+  {
+    // Only the enabled active objects can collide with the static objects
+    if (!cow->m_enabled || cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      continue;
+
+    // The broadphase bounding box is already extended by the contact distance
+    btBroadphaseProxy* bp = cow->getBroadphaseHandle();
+    static_world_->findOverlappingObjects(bp->m_aabbMin, bp->m_aabbMax, static_world_overlaps_);
+    for (int index : static_world_overlaps_)
+    {
+      if (contact_test_data_.done)
+        return;
+
+      // The static objects are not in the broadphase, so the pair uses a temporary proxy and algorithm
+      const COW::Ptr& static_cow = static_world_cows_[static_cast<std::size_t>(index)];
+      btBroadphaseProxy static_proxy(bp->m_aabbMin,
+                                     bp->m_aabbMax,
+                                     static_cow.get(),
+                                     static_cow->m_collisionFilterGroup,
+                                     static_cow->m_collisionFilterMask);
+      static_proxy.m_uniqueId = -1;
+
+      btBroadphasePair pair(*bp, static_proxy);
+      collision_callback.processOverlap(pair);
+      if (pair.m_algorithm != nullptr)
+      {
+        pair.m_algorithm->~btCollisionAlgorithm();
+        dispatcher_->freeCollisionAlgorithm(pair.m_algorithm);
+      }
+    }
   }
 }
 }  // namespace tesseract_collision::tesseract_collision_bullet
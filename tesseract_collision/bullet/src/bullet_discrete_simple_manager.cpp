@@ -39,52 +39,60 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include "tesseract_collision/bullet/bullet_discrete_simple_manager.h"
+#include "tesseract_collision/core/common.h"
+#include "tesseract_common/tracing.h"
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name) : name_(std::move(name))
+BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name)
+  : name_(std::move(name)), coll_config_(getCollisionConstructionInfo(ContactManagerPoolConfig(), 0))
 {
-  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
-
-  dispatcher_->registerCollisionCreateFunc(
-      BOX_SHAPE_PROXYTYPE,
-      BOX_SHAPE_PROXYTYPE,
-      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
-
-  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
-                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+  dispatcher_ = createDispatcher(coll_config_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
 }
 
+BulletDiscreteSimpleManager::~BulletDiscreteSimpleManager() { clearSelfCollisionPairs(); }
+
 std::string BulletDiscreteSimpleManager::getName() const { return name_; }
 
 DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
 {
+  TESSERACT_TRACE_ZONE("BulletDiscreteSimpleManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("BulletDiscreteSimpleManager");
+  clones.increment();
   auto manager = std::make_unique<BulletDiscreteSimpleManager>();
 
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-
-  for (const auto& cow : link2cow_)
+  // Add in handle order so the clone provides the same handles
+  for (const auto& cow : handle2cow_)
   {
-    COW::Ptr new_cow = cow.second->clone();
+    COW::Ptr new_cow = cow->clone();
 
     assert(new_cow->getCollisionShape());
     assert(new_cow->getCollisionShape()->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);
 
-    new_cow->setWorldTransform(cow.second->getWorldTransform());
-    new_cow->setContactProcessingThreshold(margin);
+    new_cow->setWorldTransform(cow->getWorldTransform());
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
 
     manager->addCollisionObject(new_cow);
   }
 
   manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setGjkWarmStart(coll_config_.getGjkWarmStart());
+  manager->setSelfCollisionOnly(self_collision_only_);
+  manager->setPoolConfig(pool_config_);
 
   return manager;
 }
@@ -101,8 +109,7 @@ bool BulletDiscreteSimpleManager::addCollisionObject(const std::string& name,
   COW::Ptr new_cow = createCollisionObject(name, mask_id, shapes, shape_poses, enabled);
   if (new_cow != nullptr)
   {
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
-    new_cow->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
     addCollisionObject(new_cow);
     return true;
   }
@@ -110,6 +117,35 @@ bool BulletDiscreteSimpleManager::addCollisionObject(const std::string& name,
   return false;
 }
 
+bool BulletDiscreteSimpleManager::addCollisionObjects(
+    const std::vector<std::string>& names,
+    const int& mask_id,
+    const std::vector<CollisionShapesConst>& shapes,
+    const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+    bool enabled)
+{
+  // The collision objects are independent so they are created in parallel and then added in order
+  std::vector<COW::Ptr> new_cows = createCollisionObjects(names, mask_id, shapes, shape_poses, enabled);
+
+  bool added = true;
+  for (const auto& new_cow : new_cows)
+  {
+    if (new_cow == nullptr)
+    {
+      added = false;
+      continue;
+    }
+
+    if (link2cow_.find(new_cow->getName()) != link2cow_.end())
+      removeCollisionObject(new_cow->getName());
+
+    updateCollisionObjectMargin(new_cow, contact_test_data_.collision_margin_data);
+    addCollisionObject(new_cow);
+  }
+
+  return added;
+}
+
 const CollisionShapesConst& BulletDiscreteSimpleManager::getCollisionObjectGeometries(const std::string& name) const
 {
   auto cow = link2cow_.find(name);
@@ -135,9 +171,21 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
   auto it = link2cow_.find(name);
   if (it != link2cow_.end())
   {
+    // Free the cached algorithms while the shapes of the object are alive
+    clearSelfCollisionPairs();
+
+    // Objects after the removed one shift down so their handle remains their index
+    auto handle = static_cast<std::size_t>(it->second->getHandle());
+    handle2cow_.erase(handle2cow_.begin() + static_cast<long>(handle));
+    for (std::size_t i = handle; i < handle2cow_.size(); ++i)
+      handle2cow_[i]->setHandle(static_cast<int>(i));
+
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
-    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    collision_objects_.erase(collision_objects_.begin() + static_cast<long>(handle));
     link2cow_.erase(name);
+
+    // The warm start data is keyed on the collision object address which may be reused
+    coll_config_.getGjkWarmStartCache().clear();
     return true;
   }
 
@@ -146,24 +194,12 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
 
 bool BulletDiscreteSimpleManager::enableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = true;
-    return true;
-  }
-  return false;
+  return enableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool BulletDiscreteSimpleManager::disableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = false;
-    return true;
-  }
-  return false;
+  return disableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool BulletDiscreteSimpleManager::isCollisionObjectEnabled(const std::string& name) const
@@ -175,13 +211,43 @@ bool BulletDiscreteSimpleManager::isCollisionObjectEnabled(const std::string& na
   return false;
 }
 
+int BulletDiscreteSimpleManager::getCollisionObjectHandle(const std::string& name) const
+{
+  auto it = link2cow_.find(name);
+  return (it != link2cow_.end()) ? it->second->getHandle() : -1;
+}
+
+bool BulletDiscreteSimpleManager::enableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = true;
+  return true;
+}
+
+bool BulletDiscreteSimpleManager::disableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = false;
+  return true;
+}
+
 void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
   // geometry
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-    it->second->setWorldTransform(convertEigenToBt(pose));
+  setCollisionObjectsTransform(getCollisionObjectHandle(name), pose);
+}
+
+void BulletDiscreteSimpleManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->setWorldTransform(convertEigenToBt(pose));
 }
 
 void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -198,12 +264,26 @@ void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const tesseract_c
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+bool BulletDiscreteSimpleManager::updateCollisionObjectOctree(const std::string& name,
+                                                              std::size_t shape_index,
+                                                              const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  // The cached algorithms of the pairs may refer to the cells of the octree
+  clearSelfCollisionPairs();
+  return tesseract_collision_bullet::updateCollisionObjectOctree(it->second, shape_index, delta);
+}
+
 const std::vector<std::string>& BulletDiscreteSimpleManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
 {
   active_ = names;
   contact_test_data_.active = &active_;
+  clearSelfCollisionPairs();
   cows_.clear();
   cows_.reserve(link2cow_.size());
 
@@ -248,17 +328,99 @@ const CollisionMarginData& BulletDiscreteSimpleManager::getCollisionMarginData()
 {
   return contact_test_data_.collision_margin_data;
 }
-void BulletDiscreteSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
+void BulletDiscreteSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  contact_test_data_.fn = fn;
+  clearSelfCollisionPairs();
+}
+
 IsContactAllowedFn BulletDiscreteSimpleManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
+void BulletDiscreteSimpleManager::setStatisticsEnabled(bool enabled)
+{
+  contact_test_data_.statistics = enabled ? &statistics_ : nullptr;
+}
+
+bool BulletDiscreteSimpleManager::getStatisticsEnabled() const { return (contact_test_data_.statistics != nullptr); }
+
+ContactManagerStatistics BulletDiscreteSimpleManager::getStatistics() const { return statistics_; }
+
+void BulletDiscreteSimpleManager::clearStatistics() { statistics_.clear(); }
+
+void BulletDiscreteSimpleManager::setPoolConfig(const ContactManagerPoolConfig& config)
+{
+  if (config == pool_config_ && link2cow_.size() <= pool_object_count_)
+    return;
+
+  pool_config_ = config;
+  resizePools(link2cow_.size());
+}
+
+std::optional<ContactManagerPoolConfig> BulletDiscreteSimpleManager::getPoolConfig() const { return pool_config_; }
+
+void BulletDiscreteSimpleManager::resizePools(std::size_t object_count)
+{
+  // The collision algorithms cached for the self collision pairs are allocated from the pools
+  clearSelfCollisionPairs();
+  resizeCollisionPools(coll_config_, dispatcher_, pool_config_, object_count);
+
+  pool_object_count_ = object_count;
+}
+
+tesseract_common::MemoryUsage
+BulletDiscreteSimpleManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(BulletDiscreteSimpleManager);
+  for (const auto& cow : link2cow_)
+    usage.children.push_back(cow.second->getMemoryUsage(tracker));
+
+  usage.addChild("cache").unique_bytes = (6 * aabbs_.size() * sizeof(double)) +
+                                         tesseract_common::getVectorBytes(separations_) +
+                                         tesseract_common::getVectorBytes(self_collision_pairs_);
+
+  usage.addChild("pools").unique_bytes = coll_config_.getPoolBytes();
+
+  return usage;
+}
+
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_TRACE_ZONE("BulletDiscreteSimpleManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("BulletDiscreteSimpleManager");
+  const tesseract_common::MetricTimer latency_timer(latency);
+
+  // Grow the memory pools geometrically as collision objects are added
+  if (link2cow_.size() > pool_object_count_)
+    resizePools(std::max(link2cow_.size(), 2 * pool_object_count_));
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
-  for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
+  ContactManagerStatistics* statistics = contact_test_data_.statistics;
+  if (statistics != nullptr)
+    ++statistics->contact_tests;
+
+  ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->contact_test_time : nullptr);
+
+  if (self_collision_only_)
   {
-    const COW::Ptr& cow1 = *cow1_iter;
+    selfCollisionContactTest(statistics);
+    return;
+  }
+
+  aabbs_.clear();
+  aabbs_.reserve(cows_.size());
+  for (const COW::Ptr& cow : cows_)
+  {
+    btVector3 aabb_min, aabb_max;
+    cow->getAABB(aabb_min, aabb_max);
+    aabbs_.push_back(convertBtToEigen(aabb_min), convertBtToEigen(aabb_max));
+  }
+
+  for (std::size_t i = 0; i < cows_.size(); ++i)
+  {
+    const COW::Ptr& cow1 = cows_[i];
 
     if (cow1->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
       break;
@@ -266,48 +428,47 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
     if (!cow1->m_enabled)
       continue;
 
-    btVector3 min_aabb[2], max_aabb[2];  // NOLINT
-    cow1->getAABB(min_aabb[0], max_aabb[0]);
+    aabbs_.separations(i, i + 1, cows_.size(), separations_);
 
     btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
 
     DiscreteCollisionCollector cc(contact_test_data_, cow1, cow1->getContactProcessingThreshold());
-    for (auto cow2_iter = cow1_iter + 1; cow2_iter != cows_.end(); cow2_iter++)
+    for (std::size_t j = 0; j < separations_.size(); ++j)
     {
       assert(!contact_test_data_.done);
 
-      const COW::Ptr& cow2 = *cow2_iter;
-      cow2->getAABB(min_aabb[1], max_aabb[1]);
+      if (separations_[j] > 0)
+        continue;
+
+      const COW::Ptr& cow2 = cows_[i + 1 + j];
 
-      bool aabb_check = (min_aabb[0][0] <= max_aabb[1][0] && max_aabb[0][0] >= min_aabb[1][0]) &&
-                        (min_aabb[0][1] <= max_aabb[1][1] && max_aabb[0][1] >= min_aabb[1][1]) &&
-                        (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
+      if (statistics != nullptr)
+        ++statistics->broadphase_pairs;
 
-      if (aabb_check)
+      bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
+
+      if (needs_collision)
       {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
+        btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
 
-        if (needs_collision)
+        btCollisionAlgorithm* algorithm = dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+        assert(algorithm != nullptr);
+        if (algorithm != nullptr)
         {
-          btCollisionObjectWrapper obB(
-              nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
-
-          btCollisionAlgorithm* algorithm =
-              dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
-          assert(algorithm != nullptr);
-          if (algorithm != nullptr)
-          {
-            TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
-            contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
-
-            // discrete collision detection query
-            algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
-
-            algorithm->~btCollisionAlgorithm();
-            dispatcher_->freeCollisionAlgorithm(algorithm);
-          }
+          TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+          contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+          // discrete collision detection query
+          processCollisionAlgorithm(*algorithm, obA, obB, dispatch_info_, contactPointResult, statistics);
+
+          algorithm->~btCollisionAlgorithm();
+          dispatcher_->freeCollisionAlgorithm(algorithm);
         }
       }
+      else if (statistics != nullptr)
+      {
+        ++statistics->rejected_pairs;
+      }
 
       if (contact_test_data_.done)
         break;
@@ -321,8 +482,11 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
 void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setHandle(static_cast<int>(handle2cow_.size()));
   link2cow_[cow->getName()] = cow;
+  handle2cow_.push_back(cow);
   collision_objects_.push_back(cow->getName());
+  clearSelfCollisionPairs();
 
   if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
     cows_.insert(cows_.begin(), cow);
@@ -330,11 +494,125 @@ void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
     cows_.push_back(cow);
 }
 
+void BulletDiscreteSimpleManager::setGjkWarmStart(bool enabled) { coll_config_.setGjkWarmStart(enabled); }
+
+bool BulletDiscreteSimpleManager::getGjkWarmStart() const { return coll_config_.getGjkWarmStart(); }
+
+void BulletDiscreteSimpleManager::setSelfCollisionOnly(bool enabled) { self_collision_only_ = enabled; }
+
+bool BulletDiscreteSimpleManager::getSelfCollisionOnly() const { return self_collision_only_; }
+
+void BulletDiscreteSimpleManager::clearSelfCollisionPairs()
+{
+  for (SelfCollisionPair& pair : self_collision_pairs_)
+  {
+    if (pair.algorithm != nullptr)
+    {
+      pair.algorithm->~btCollisionAlgorithm();
+      dispatcher_->freeCollisionAlgorithm(pair.algorithm);
+    }
+  }
+
+  self_collision_pairs_.clear();
+  self_collision_pairs_dirty_ = true;
+}
+
+void BulletDiscreteSimpleManager::updateSelfCollisionPairs()
+{
+  clearSelfCollisionPairs();
+
+  // The active objects are at the front of cows_
+  std::size_t active_count = 0;
+  while (active_count < cows_.size() &&
+         cows_[active_count]->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+    ++active_count;
+
+  for (std::size_t i = 0; i < active_count; ++i)
+  {
+    const COW& cow1 = *cows_[i];
+    for (std::size_t j = i + 1; j < active_count; ++j)
+    {
+      const COW& cow2 = *cows_[j];
+      bool filtered = ((cow2.m_collisionFilterGroup & cow1.m_collisionFilterMask) == 0) ||
+                      ((cow1.m_collisionFilterGroup & cow2.m_collisionFilterMask) == 0);
+
+      if (!filtered && !isContactAllowed(cow1.getName(), cow2.getName(), contact_test_data_.fn, false))
+        self_collision_pairs_.push_back({ i, j, nullptr });
+    }
+  }
+
+  self_collision_pairs_dirty_ = false;
+}
+
+void BulletDiscreteSimpleManager::selfCollisionContactTest(ContactManagerStatistics* statistics)
+{
+  if (self_collision_pairs_dirty_)
+    updateSelfCollisionPairs();
+
+  aabbs_.clear();
+  for (const COW::Ptr& cow : cows_)
+  {
+    if (cow->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      break;
+
+    btVector3 aabb_min, aabb_max;
+    cow->getAABB(aabb_min, aabb_max);
+    aabbs_.push_back(convertBtToEigen(aabb_min), convertBtToEigen(aabb_max));
+  }
+
+  // The pairs are ordered by the first object so the wrapper and collector of an object are created once
+  std::size_t p = 0;
+  while (p < self_collision_pairs_.size() && !contact_test_data_.done)
+  {
+    const std::size_t index1 = self_collision_pairs_[p].index1;
+    std::size_t end = p + 1;
+    while (end < self_collision_pairs_.size() && self_collision_pairs_[end].index1 == index1)
+      ++end;
+
+    const COW::Ptr& cow1 = cows_[index1];
+    if (!cow1->m_enabled)
+    {
+      p = end;
+      continue;
+    }
+
+    btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+
+    DiscreteCollisionCollector cc(contact_test_data_, cow1, cow1->getContactProcessingThreshold());
+    for (; p < end && !contact_test_data_.done; ++p)
+    {
+      SelfCollisionPair& pair = self_collision_pairs_[p];
+      const COW::Ptr& cow2 = cows_[pair.index2];
+      if (!cow2->m_enabled || aabbs_.separation(index1, pair.index2) > 0)
+        continue;
+
+      if (statistics != nullptr)
+        ++statistics->broadphase_pairs;
+
+      btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
+
+      if (pair.algorithm == nullptr)
+        pair.algorithm = dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+
+      assert(pair.algorithm != nullptr);
+      if (pair.algorithm != nullptr)
+      {
+        TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+        contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+        // discrete collision detection query
+        processCollisionAlgorithm(*pair.algorithm, obA, obB, dispatch_info_, contactPointResult, statistics);
+      }
+    }
+
+    p = end;
+  }
+}
+
 void BulletDiscreteSimpleManager::onCollisionMarginDataChanged()
 {
-  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
   for (auto& co : link2cow_)
-    co.second->setContactProcessingThreshold(margin);
+    updateCollisionObjectMargin(co.second, contact_test_data_.collision_margin_data);
 }
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -39,9 +39,16 @@ DiscreteContactManager::UPtr BulletDiscreteBVHManagerFactory::create(const std::
 }
 
 DiscreteContactManager::UPtr BulletDiscreteSimpleManagerFactory::create(const std::string& name,
-                                                                        const YAML::Node& /*config*/) const
+                                                                        const YAML::Node& config) const
 {
-  return std::make_unique<BulletDiscreteSimpleManager>(name);
+  auto manager = std::make_unique<BulletDiscreteSimpleManager>(name);
+  if (config)
+  {
+    if (YAML::Node n = config["self_collision_only"])
+      manager->setSelfCollisionOnly(n.as<bool>());
+  }
+
+  return manager;
 }
 
 ContinuousContactManager::UPtr BulletCastBVHManagerFactory::create(const std::string& name,
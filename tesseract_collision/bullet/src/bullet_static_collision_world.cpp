@@ -0,0 +1,118 @@
+/**
+ * @file bullet_static_collision_world.cpp
+ * @brief Static bullet collision objects shared by several contact managers
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/bullet_static_collision_world.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+namespace
+{
+/** @brief Collects the indices of the objects of the leaves overlapping a bounding box */
+struct OverlappingObjectsCollector : btDbvt::ICollide
+{
+  explicit OverlappingObjectsCollector(std::vector<int>& indices) : indices(indices) {}
+
+  void Process(const btDbvtNode* leaf) { indices.push_back(leaf->dataAsInt); }  // NOLINT
+
+  std::vector<int>& indices;
+};
+}  // namespace
+
+bool BulletStaticCollisionWorld::addCollisionObject(const std::string& name,
+                                                    const int& mask_id,
+                                                    const CollisionShapesConst& shapes,
+                                                    const tesseract_common::VectorIsometry3d& shape_poses,
+                                                    const Eigen::Isometry3d& pose)
+{
+  COW::Ptr cow = createCollisionObject(name, mask_id, shapes, shape_poses, true);
+  if (cow == nullptr)
+    return false;
+
+  // The objects of the world only collide with the active objects of the contact managers
+  cow->m_collisionFilterGroup = btBroadphaseProxy::StaticFilter;
+  cow->m_collisionFilterMask = btBroadphaseProxy::KinematicFilter;
+  cow->setContactProcessingThreshold(0);
+  cow->setWorldTransform(convertEigenToBt(pose));
+
+  // The contact managers extend the bounding boxes of their own objects by the contact distance
+  btVector3 aabb_min, aabb_max;
+  cow->getAABB(aabb_min, aabb_max);
+  btDbvtVolume volume = btDbvtVolume::FromMM(aabb_min, aabb_max);
+
+  auto it = std::find(collision_objects_.begin(), collision_objects_.end(), name);
+  if (it != collision_objects_.end())
+  {
+    const auto index = static_cast<std::size_t>(std::distance(collision_objects_.begin(), it));
+    cows_[index] = cow;
+    tree_.update(leaves_[index], volume);
+    return true;
+  }
+
+  btDbvtNode* leaf = tree_.insert(volume, nullptr);
+  leaf->dataAsInt = static_cast<int>(cows_.size());
+  collision_objects_.push_back(name);
+  cows_.push_back(cow);
+  leaves_.push_back(leaf);
+  return true;
+}
+
+bool BulletStaticCollisionWorld::hasCollisionObject(const std::string& name) const
+{
+  return std::find(collision_objects_.begin(), collision_objects_.end(), name) != collision_objects_.end();
+}
+
+const std::vector<std::string>& BulletStaticCollisionWorld::getCollisionObjects() const { return collision_objects_; }
+
+const std::vector<COW::Ptr>& BulletStaticCollisionWorld::getBulletCollisionObjects() const { return cows_; }
+
+void BulletStaticCollisionWorld::findOverlappingObjects(const btVector3& aabb_min,
+                                                        const btVector3& aabb_max,
+                                                        std::vector<int>& indices) const
+{
+  indices.clear();
+  OverlappingObjectsCollector collector(indices);
+  tree_.collideTV(tree_.m_root, btDbvtVolume::FromMM(aabb_min, aabb_max), collector);
+}
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
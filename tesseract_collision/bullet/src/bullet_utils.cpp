@@ -42,6 +42,7 @@
  */
 
 #include "tesseract_collision/bullet/bullet_utils.h"
+#include "tesseract_common/executor.h"
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <LinearMath/btConvexHullComputer.h>
@@ -49,7 +50,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionShapes/btShapeHull.h>
 #include <BulletCollision/Gimpact/btTriangleShapeEx.h>
 #include <boost/thread/mutex.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <string>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -141,52 +146,72 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return std::make_shared<btCapsuleShapeZ>(r, l);
 }
 
-std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom,
-                                                       CollisionObjectWrapper* cow,
-                                                       int shape_index)
+namespace
 {
-  int vertice_count = geom->getVertexCount();
-  int triangle_count = geom->getFaceCount();
-  const tesseract_common::VectorVector3d& vertices = *(geom->getVertices());
-  const Eigen::VectorXi& triangles = *(geom->getFaces());
+/** @brief The compound of triangles created for a mesh, which owns the triangle shapes */
+struct MeshCompoundShape
+{
+  std::shared_ptr<btCompoundShape> compound;
+  std::vector<std::shared_ptr<btCollisionShape>> triangles;
+};
+
+std::shared_ptr<btCollisionShape> buildMeshShape(const tesseract_geometry::Mesh& geom, int shape_index)
+{
+  int vertice_count = geom.getVertexCount();
+  int triangle_count = geom.getFaceCount();
+  const tesseract_geometry::PolygonMesh::VertexMap vertices = geom.getVertexMap();
+  const tesseract_geometry::PolygonMesh::TriangleMap triangles = geom.getTriangleMap();
 
   if (vertice_count > 0 && triangle_count > 0)
   {
-    auto compound =
+    auto mesh_shape = std::make_shared<MeshCompoundShape>();
+    mesh_shape->compound =
         std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(triangle_count));
-    compound->setMargin(BULLET_MARGIN);  // margin: compound. seems to have no
-                                         // effect when positive but has an
-                                         // effect when negative
+    mesh_shape->triangles.reserve(static_cast<std::size_t>(triangle_count));
+
+    btCompoundShape& compound = *mesh_shape->compound;
+    compound.setMargin(BULLET_MARGIN);  // margin: compound. seems to have no
+                                        // effect when positive but has an
+                                        // effect when negative
+    compound.setUserIndex(shape_index);
 
     for (int i = 0; i < triangle_count; ++i)
     {
       btVector3 v[3];  // NOLINT
-      assert(triangles[4L * i] == 3);
-      for (unsigned x = 0; x < 3; ++x)
+      for (Eigen::Index x = 0; x < 3; ++x)
       {
-        // Note: triangles structure is number of vertices that represent the triangle followed by vertex indexes
-        const Eigen::Vector3d& vertice = vertices[static_cast<size_t>(triangles[(4 * i) + (static_cast<int>(x) + 1)])];
-        for (unsigned y = 0; y < 3; ++y)
-          v[x][y] = static_cast<btScalar>(vertice[y]);
+        const auto vertice = vertices.col(triangles(x, i));
+        v[x] = btVector3(static_cast<btScalar>(vertice[0]),  // NOLINT
+                         static_cast<btScalar>(vertice[1]),
+                         static_cast<btScalar>(vertice[2]));
       }
 
       std::shared_ptr<btCollisionShape> subshape = std::make_shared<btTriangleShapeEx>(v[0], v[1], v[2]);
       if (subshape != nullptr)
       {
         subshape->setUserIndex(shape_index);
-        cow->manage(subshape);
         subshape->setMargin(BULLET_MARGIN);
+        mesh_shape->triangles.push_back(subshape);
         btTransform geomTrans;
         geomTrans.setIdentity();
-        compound->addChildShape(geomTrans, subshape.get());
+        compound.addChildShape(geomTrans, subshape.get());
       }
     }
 
-    return compound;
+    // The returned pointer keeps the triangles alive as long as the compound is used
+    return { mesh_shape, mesh_shape->compound.get() };
   }
   CONSOLE_BRIDGE_logError("The mesh is empty!");
   return nullptr;
 }
+}  // namespace
+
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom, int shape_index)
+{
+  // The shape index is stored in the shapes, so there is a compound for each index the mesh is used with
+  return geom->getAttachment<btCollisionShape>("bullet_compound_" + std::to_string(shape_index),
+                                               [&geom, shape_index]() { return buildMeshShape(*geom, shape_index); });
+}
 
 std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::ConvexMesh::ConstPtr& geom)
 {
@@ -195,14 +220,8 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   const tesseract_common::VectorVector3d& vertices = *(geom->getVertices());
 
   if (vertice_count > 0 && triangle_count > 0)
-  {
-    auto subshape = std::make_shared<btConvexHullShape>();
-    for (const auto& v : vertices)
-      subshape->addPoint(
-          btVector3(static_cast<btScalar>(v[0]), static_cast<btScalar>(v[1]), static_cast<btScalar>(v[2])));
+    return std::make_shared<HillClimbingConvexHullShape>(vertices, *geom->getFaces());
 
-    return subshape;
-  }
   CONSOLE_BRIDGE_logError("The mesh is empty!");
   return nullptr;
 }
@@ -211,119 +230,41 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
                                                        CollisionObjectWrapper* cow,
                                                        int shape_index)
 {
-  const octomap::OcTree& octree = *(geom->getOctree());
-  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
-  double occupancy_threshold = octree.getOccupancyThres();
-
-  std::vector<std::shared_ptr<btCollisionShape>> managed_shapes;
-  managed_shapes.resize(octree.getTreeDepth() + 1);
   switch (geom->getSubType())
   {
     case tesseract_geometry::Octree::SubType::BOX:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto l = static_cast<btScalar>(size / 2.0);
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btBoxShape>(btVector3(l, l, l));
-            childshape->setUserIndex(shape_index);
-            childshape->setMargin(BULLET_MARGIN);
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
-    }
     case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
-      }
-
-      return subshape;
+      auto shape = std::make_shared<OctreeShape>(geom->getOctree(), geom->getSubType(), shape_index);
+      shape->setDistanceTolerance(geom->getDistanceTolerance());
+      return shape;
     }
-    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+    case tesseract_geometry::Octree::SubType::MERGED_BOX:
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
+      // The merged boxes are baked into a compound, so incremental octree updates do not apply to it
+      std::vector<Eigen::AlignedBox3d> boxes = tesseract_geometry::Octree::getMergedBoxes(*geom->getOctree());
+      auto subshape =
+          std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(boxes.size()));
+      cow->manageReserve(boxes.size());
+      for (const auto& box : boxes)
       {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape =
-                std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
-            childshape->setUserIndex(shape_index);
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
+        const Eigen::Vector3d center = box.center();
+        const Eigen::Vector3d half_size = box.sizes() / 2.0;
+        auto childshape = std::make_shared<btBoxShape>(btVector3(static_cast<btScalar>(half_size.x()),
+                                                                 static_cast<btScalar>(half_size.y()),
+                                                                 static_cast<btScalar>(half_size.z())));
+        childshape->setUserIndex(shape_index);
+        childshape->setMargin(BULLET_MARGIN);
+        cow->manage(childshape);
 
-      cow->manageReserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          cow->manage(managed_shape);
+        btTransform geomTrans;
+        geomTrans.setIdentity();
+        geomTrans.setOrigin(btVector3(static_cast<btScalar>(center.x()),
+                                      static_cast<btScalar>(center.y()),
+                                      static_cast<btScalar>(center.z())));
+        subshape->addChildShape(geomTrans, childshape.get());
       }
-
       return subshape;
     }
   }
@@ -333,6 +274,33 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return nullptr;
 }
 
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::PointCloud::ConstPtr& geom,
+                                                       CollisionObjectWrapper* cow,
+                                                       int shape_index)
+{
+  if (geom->getPointCount() == 0)
+  {
+    CONSOLE_BRIDGE_logError("The point cloud is empty!");
+    return nullptr;
+  }
+
+  // The points share one sphere and the dynamic tree of the compound is the spatial index of the cloud
+  const tesseract_common::VectorVector3d& points = *geom->getPoints();
+  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(points.size()));
+  auto childshape = std::make_shared<btSphereShape>(static_cast<btScalar>(geom->getPointRadius()));
+  childshape->setUserIndex(shape_index);
+  cow->manage(childshape);
+  for (const auto& point : points)
+  {
+    btTransform geomTrans;
+    geomTrans.setIdentity();
+    geomTrans.setOrigin(btVector3(
+        static_cast<btScalar>(point.x()), static_cast<btScalar>(point.y()), static_cast<btScalar>(point.z())));
+    subshape->addChildShape(geomTrans, childshape.get());
+  }
+  return subshape;
+}
+
 std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConstPtr& geom,
                                                        CollisionObjectWrapper* cow,
                                                        int shape_index)
@@ -378,16 +346,24 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
     }
     case tesseract_geometry::GeometryType::MESH:
     {
-      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), cow, shape_index);
-      shape->setUserIndex(shape_index);
-      shape->setMargin(BULLET_MARGIN);
+      // The mesh shape is shared between collision objects and already configured, so it must not be modified
+      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), shape_index);
       break;
     }
     case tesseract_geometry::GeometryType::CONVEX_MESH:
     {
-      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(geom));
-      shape->setUserIndex(shape_index);
-      shape->setMargin(BULLET_MARGIN);
+      // The hull is shared between collision objects and configured once, so it must not be modified
+      const auto convex = std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(geom);
+      shape = convex->getAttachment<btCollisionShape>("bullet_convex_hull_" + std::to_string(shape_index),
+                                                      [&convex, shape_index]() {
+                                                        auto hull = createShapePrimitive(convex);
+                                                        if (hull != nullptr)
+                                                        {
+                                                          hull->setUserIndex(shape_index);
+                                                          hull->setMargin(BULLET_MARGIN);
+                                                        }
+                                                        return hull;
+                                                      });
       break;
     }
     case tesseract_geometry::GeometryType::OCTREE:
@@ -397,6 +373,17 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
       shape->setMargin(BULLET_MARGIN);
       break;
     }
+    case tesseract_geometry::GeometryType::POINT_CLOUD:
+    {
+      shape = createShapePrimitive(
+          std::static_pointer_cast<const tesseract_geometry::PointCloud>(geom), cow, shape_index);
+      if (shape != nullptr)
+      {
+        shape->setUserIndex(shape_index);
+        shape->setMargin(BULLET_MARGIN);
+      }
+      break;
+    }
     // LCOV_EXCL_START
     default:
     {
@@ -429,6 +416,35 @@ void updateCollisionObjectFilters(const std::vector<std::string>& active, const
   }
 }
 
+namespace
+{
+/**
+ * @brief Check if the bounding box of a shape in its own frame never changes
+ * @details Octrees are updated in place and the bounding box of a cast shape depends on the cast transform, so a
+ * shape containing either is not fixed.
+ * @param shape The shape
+ * @return True if the local bounding box is fixed, otherwise false
+ */
+bool hasFixedLocalAABB(const btCollisionShape& shape)
+{
+  const int type = shape.getShapeType();
+  if (type == CUSTOM_CONVEX_SHAPE_TYPE || type == CUSTOM_CONCAVE_SHAPE_TYPE)
+    return false;
+
+  if (btBroadphaseProxy::isCompound(type))
+  {
+    const auto& compound = static_cast<const btCompoundShape&>(shape);  // NOLINT
+    for (int i = 0; i < compound.getNumChildShapes(); ++i)
+    {
+      if (!hasFixedLocalAABB(*compound.getChildShape(i)))
+        return false;
+    }
+  }
+
+  return true;
+}
+}  // namespace
+
 CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
@@ -474,12 +490,18 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
   btTransform trans;
   trans.setIdentity();
   setWorldTransform(trans);
+
+  updateLocalAABB();
 }
 
 const std::string& CollisionObjectWrapper::getName() const { return m_name; }
 
 const int& CollisionObjectWrapper::getTypeID() const { return m_type_id; }
 
+int CollisionObjectWrapper::getHandle() const { return m_handle; }
+
+void CollisionObjectWrapper::setHandle(int handle) { m_handle = handle; }
+
 bool CollisionObjectWrapper::sameObject(const CollisionObjectWrapper& other) const
 {
   return m_name == other.m_name && m_type_id == other.m_type_id && m_shapes.size() == other.m_shapes.size() &&
@@ -500,13 +522,45 @@ const tesseract_common::VectorIsometry3d& CollisionObjectWrapper::getCollisionGe
 
 void CollisionObjectWrapper::getAABB(btVector3& aabb_min, btVector3& aabb_max) const
 {
-  getCollisionShape()->getAabb(getWorldTransform(), aabb_min, aabb_max);
+  if (m_local_aabb_shape != nullptr && m_local_aabb_shape == getCollisionShape())
+  {
+    const btTransform& t = getWorldTransform();
+    const btMatrix3x3 abs_basis = t.getBasis().absolute();
+    const btVector3 center = t(m_local_aabb_center);
+    const btVector3 extent(abs_basis[0].dot(m_local_aabb_half_extents),
+                           abs_basis[1].dot(m_local_aabb_half_extents),
+                           abs_basis[2].dot(m_local_aabb_half_extents));
+    aabb_min = center - extent;
+    aabb_max = center + extent;
+  }
+  else
+  {
+    getCollisionShape()->getAabb(getWorldTransform(), aabb_min, aabb_max);
+  }
+
   const btScalar& d = getContactProcessingThreshold();
   btVector3 contactThreshold(d, d, d);
   aabb_min -= contactThreshold;
   aabb_max += contactThreshold;
 }
 
+void CollisionObjectWrapper::updateLocalAABB()
+{
+  m_local_aabb_shape = nullptr;
+  const btCollisionShape* shape = getCollisionShape();
+  if (shape == nullptr || shape->getShapeType() == SPHERE_SHAPE_PROXYTYPE || !hasFixedLocalAABB(*shape))
+    return;
+
+  btTransform identity;
+  identity.setIdentity();
+  btVector3 aabb_min, aabb_max;
+  shape->getAabb(identity, aabb_min, aabb_max);
+
+  m_local_aabb_center = btScalar(0.5) * (aabb_min + aabb_max);
+  m_local_aabb_half_extents = btScalar(0.5) * (aabb_max - aabb_min);
+  m_local_aabb_shape = shape;
+}
+
 std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
 {
   auto clone_cow = std::make_shared<CollisionObjectWrapper>();
@@ -521,6 +575,9 @@ std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
   clone_cow->m_collisionFilterMask = m_collisionFilterMask;
   clone_cow->m_enabled = m_enabled;
   clone_cow->setBroadphaseHandle(nullptr);
+  clone_cow->m_local_aabb_shape = m_local_aabb_shape;
+  clone_cow->m_local_aabb_center = m_local_aabb_center;
+  clone_cow->m_local_aabb_half_extents = m_local_aabb_half_extents;
   return clone_cow;
 }
 
@@ -528,6 +585,210 @@ void CollisionObjectWrapper::manage(const std::shared_ptr<btCollisionShape>& t)
 
 void CollisionObjectWrapper::manageReserve(std::size_t s) { m_data.reserve(s); }
 
+namespace
+{
+/**
+ * @brief Estimate the bytes of a bullet shape and the child shapes of a compound not counted before
+ * @param shape The shape
+ * @param tracker Tracks the child shapes already counted
+ * @return The bytes of the shape
+ */
+std::size_t getShapeBytes(const btCollisionShape& shape, tesseract_common::MemoryUsageTracker& tracker)
+{
+  if (shape.isCompound())
+  {
+    const auto& compound = static_cast<const btCompoundShape&>(shape);
+    const auto child_count = static_cast<std::size_t>(compound.getNumChildShapes());
+    std::size_t bytes = sizeof(btCompoundShape) + (child_count * sizeof(btCompoundShapeChild));
+    if (const btDbvt* tree = compound.getDynamicAabbTree())
+      bytes += 2 * static_cast<std::size_t>(tree->m_leaves) * sizeof(btDbvtNode);
+
+    for (int i = 0; i < compound.getNumChildShapes(); ++i)
+    {
+      const btCollisionShape* child = compound.getChildShape(i);
+      if (tracker.visit(child))
+        bytes += getShapeBytes(*child, tracker);
+    }
+    return bytes;
+  }
+
+  if (shape.getShapeType() == CONVEX_HULL_SHAPE_PROXYTYPE)
+  {
+    const auto& hull = static_cast<const btConvexHullShape&>(shape);
+    return sizeof(HillClimbingConvexHullShape) + (static_cast<std::size_t>(hull.getNumPoints()) * sizeof(btVector3));
+  }
+
+  return static_cast<std::size_t>(shape.calculateSerializeBufferSize());
+}
+}  // namespace
+
+tesseract_common::MemoryUsage
+CollisionObjectWrapper::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(m_name);
+  usage.unique_bytes = sizeof(CollisionObjectWrapper) + tesseract_common::getVectorBytes(m_shapes) +
+                       tesseract_common::getVectorBytes(m_shape_poses) + tesseract_common::getVectorBytes(m_data);
+
+  for (const auto& shape : m_shapes)
+    usage.children.push_back(shape->getMemoryUsage(tracker));
+
+  // The bullet shapes are shared by the clones of the collision object and the mesh shapes by all objects using a mesh
+  tesseract_common::MemoryUsage& shapes_usage = usage.addChild("acceleration_structure");
+  for (const auto& shape : m_data)
+  {
+    if (shape == nullptr || !tracker.visit(shape.get()))
+      continue;
+
+    const std::size_t bytes = getShapeBytes(*shape, tracker);
+    if (shape.use_count() > 1)
+      shapes_usage.shared_bytes += bytes;
+    else
+      shapes_usage.unique_bytes += bytes;
+  }
+
+  return usage;
+}
+
+std::size_t getBroadphaseBytes(const btBroadphaseInterface& broadphase)
+{
+  const auto* dbvt_broadphase = dynamic_cast<const btDbvtBroadphase*>(&broadphase);
+  if (dbvt_broadphase == nullptr)
+    return sizeof(btBroadphaseInterface);
+
+  const btDbvt* sets = dbvt_broadphase->m_sets;  // NOLINT
+  const auto leaves = static_cast<std::size_t>(sets[0].m_leaves + sets[1].m_leaves);
+  std::size_t bytes = sizeof(btDbvtBroadphase) + (leaves * (sizeof(btDbvtProxy) + (2 * sizeof(btDbvtNode))));
+  if (const btOverlappingPairCache* pair_cache = dbvt_broadphase->m_paircache)
+    bytes += static_cast<std::size_t>(pair_cache->getNumOverlappingPairs()) * sizeof(btBroadphasePair);
+
+  return bytes;
+}
+
+void clearBroadphaseAlgorithms(btBroadphaseInterface& broadphase, btDispatcher& dispatcher)
+{
+  btOverlappingPairCache* pair_cache = broadphase.getOverlappingPairCache();
+  btBroadphasePairArray& pairs = pair_cache->getOverlappingPairArray();
+  for (int i = 0; i < pairs.size(); ++i)
+    pair_cache->cleanOverlappingPair(pairs[i], &dispatcher);
+}
+
+HillClimbingConvexHullShape::HillClimbingConvexHullShape(const tesseract_common::VectorVector3d& vertices,
+                                                         const Eigen::VectorXi& faces)
+{
+  for (const auto& v : vertices)
+    addPoint(btVector3(static_cast<btScalar>(v[0]), static_cast<btScalar>(v[1]), static_cast<btScalar>(v[2])), false);
+
+  recalcLocalAabb();
+
+  const auto vertex_count = static_cast<int>(vertices.size());
+  if (vertex_count < MIN_HILL_CLIMBING_VERTICES)
+    return;
+
+  // Collect both directions of every face edge, then remove the duplicates shared by neighboring faces
+  std::vector<std::vector<int>> neighbors(vertices.size());
+  for (Eigen::Index i = 0; i < faces.size(); i += faces[i] + 1)
+  {
+    const int face_size = faces[i];
+    if (face_size <= 0 || i + face_size >= faces.size())
+      return;
+
+    for (int j = 0; j < face_size; ++j)
+    {
+      const int v0 = faces[i + 1 + j];
+      const int v1 = faces[i + 1 + ((j + 1) % face_size)];
+      if (v0 < 0 || v1 < 0 || v0 >= vertex_count || v1 >= vertex_count)
+        return;
+
+      neighbors[static_cast<std::size_t>(v0)].push_back(v1);
+      neighbors[static_cast<std::size_t>(v1)].push_back(v0);
+    }
+  }
+
+  std::vector<int> offsets;
+  std::vector<int> adjacency;
+  offsets.reserve(vertices.size() + 1);
+  offsets.push_back(0);
+  for (auto& vertex_neighbors : neighbors)
+  {
+    // A vertex that is not on a face can not be reached by the walk
+    if (vertex_neighbors.empty())
+      return;
+
+    std::sort(vertex_neighbors.begin(), vertex_neighbors.end());
+    vertex_neighbors.erase(std::unique(vertex_neighbors.begin(), vertex_neighbors.end()), vertex_neighbors.end());
+    adjacency.insert(adjacency.end(), vertex_neighbors.begin(), vertex_neighbors.end());
+    offsets.push_back(static_cast<int>(adjacency.size()));
+  }
+
+  adjacency_offsets_ = std::move(offsets);
+  adjacency_ = std::move(adjacency);
+}
+
+int HillClimbingConvexHullShape::findSupportVertex(const btVector3& direction, btScalar& max_dot) const
+{
+  const btVector3* points = getUnscaledPoints();
+  const int num_points = getNumPoints();
+
+  int current = last_support_.load(std::memory_order_relaxed);
+  if (current < 0 || current >= num_points)
+    current = 0;
+
+  // Move to the best neighbor until no neighbor is better, only strict improvements so the walk terminates
+  max_dot = direction.dot(points[current]);
+  bool improved{ true };
+  while (improved)
+  {
+    improved = false;
+    const auto begin = static_cast<std::size_t>(adjacency_offsets_[static_cast<std::size_t>(current)]);
+    const auto end = static_cast<std::size_t>(adjacency_offsets_[static_cast<std::size_t>(current) + 1]);
+    int best = current;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const int neighbor = adjacency_[i];
+      const btScalar dot = direction.dot(points[neighbor]);
+      if (dot > max_dot)
+      {
+        max_dot = dot;
+        best = neighbor;
+        improved = true;
+      }
+    }
+    current = best;
+  }
+
+  last_support_.store(current, std::memory_order_relaxed);
+  return current;
+}
+
+btVector3 HillClimbingConvexHullShape::localGetSupportingVertexWithoutMargin(const btVector3& vec) const
+{
+  if (!isHillClimbing())
+    return btConvexHullShape::localGetSupportingVertexWithoutMargin(vec);
+
+  // dot(vec * scaling, point) is dot(vec, point * scaling) so the walk uses the unscaled points
+  btScalar max_dot{ 0 };
+  return getScaledPoint(findSupportVertex(vec * getLocalScaling(), max_dot));
+}
+
+void HillClimbingConvexHullShape::batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* vectors,
+                                                                                    btVector3* supportVerticesOut,
+                                                                                    int numVectors) const
+{
+  if (!isHillClimbing())
+  {
+    btConvexHullShape::batchedUnitVectorGetSupportingVertexWithoutMargin(vectors, supportVerticesOut, numVectors);
+    return;
+  }
+
+  // The fourth component stores the support distance, the same as btConvexHullShape
+  for (int i = 0; i < numVectors; ++i)
+  {
+    btScalar max_dot{ 0 };
+    supportVerticesOut[i] = getScaledPoint(findSupportVertex(vectors[i] * getLocalScaling(), max_dot));
+    supportVerticesOut[i][3] = max_dot;
+  }
+}
+
 CastHullShape::CastHullShape(btConvexShape* shape, const btTransform& t01) : m_shape(shape), m_t01(t01)
 {
   m_shapeType = CUSTOM_CONVEX_SHAPE_TYPE;
@@ -558,17 +819,41 @@ btVector3 CastHullShape::localGetSupportingVertexWithoutMargin(const btVector3&
   return localGetSupportingVertex(v);
 }
 
-// LCOV_EXCL_START
 // notice that the vectors should be unit length
-void CastHullShape::batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* /*vectors*/,
-                                                                      btVector3* /*supportVerticesOut*/,
-                                                                      int /*numVectors*/) const
+void CastHullShape::batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* vectors,
+                                                                      btVector3* supportVerticesOut,
+                                                                      int numVectors) const
 {
-  throw std::runtime_error("If you are seeing this error message then something in Bullet must have changed. Attach "
-                           "a debugger and inspect the call stack to find the function in Bullet calling this "
-                           "function, then review commit history to determine what change.");
+  if (numVectors <= 0)
+    return;
+
+  // The directions in the frame of the shape at the end of the cast
+  btAlignedObjectArray<btVector3> vectors1;
+  btAlignedObjectArray<btVector3> support1;
+  vectors1.resize(numVectors);
+  support1.resize(numVectors);
+  for (int i = 0; i < numVectors; ++i)
+    vectors1[i] = vectors[i] * m_t01.getBasis();
+
+  m_shape->batchedUnitVectorGetSupportingVertexWithoutMargin(vectors, supportVerticesOut, numVectors);
+  m_shape->batchedUnitVectorGetSupportingVertexWithoutMargin(&vectors1[0], &support1[0], numVectors);
+
+  // The cast hull has no margin so the margin of the shape is part of its surface, the same as
+  // localGetSupportingVertex
+  const btScalar margin = m_shape->getMargin();
+  for (int i = 0; i < numVectors; ++i)
+  {
+    btVector3 sv0 = supportVerticesOut[i] + (vectors[i] * margin);
+    btVector3 sv1 = m_t01 * (support1[i] + (vectors1[i] * margin));
+    btScalar d0 = vectors[i].dot(sv0);
+    btScalar d1 = vectors[i].dot(sv1);
+
+    supportVerticesOut[i] = (d0 > d1) ? sv0 : sv1;
+    supportVerticesOut[i][3] = btMax(d0, d1);
+  }
 }
 
+// LCOV_EXCL_START
 void CastHullShape::getAabbSlow(const btTransform& /*t*/, btVector3& /*aabbMin*/, btVector3& /*aabbMax*/) const
 {
   throw std::runtime_error("If you are seeing this error message then something in Bullet must have changed. Attach "
@@ -609,6 +894,142 @@ void CastHullShape::calculateLocalInertia(btScalar, btVector3&) const
                            "function, then review commit history to determine what change.");
 }
 
+OctreeShape::OctreeShape(std::shared_ptr<const octomap::OcTree> octree,
+                         tesseract_geometry::Octree::SubType sub_type,
+                         int shape_index)
+  : m_octree(std::move(octree)), m_subType(sub_type)
+{
+  m_shapeType = CUSTOM_CONCAVE_SHAPE_TYPE;
+  setUserIndex(shape_index);
+  m_t01.setIdentity();
+
+  // The cells at the same depth have the same size so they share a shape
+  const unsigned tree_depth = m_octree->getTreeDepth();
+  m_cellShapes.resize(tree_depth + 1);
+  m_cellExtents.resize(tree_depth + 1);
+  for (unsigned depth = 0; depth <= tree_depth; ++depth)
+  {
+    double size = m_octree->getNodeSize(depth);
+    switch (m_subType)
+    {
+      case tesseract_geometry::Octree::SubType::BOX:
+      case tesseract_geometry::Octree::SubType::MERGED_BOX:
+      {
+        auto l = static_cast<btScalar>(size / 2.0);
+        m_cellShapes[depth] = std::make_shared<btBoxShape>(btVector3(l, l, l));
+        m_cellShapes[depth]->setMargin(BULLET_MARGIN);
+        m_cellExtents[depth] = l;
+        break;
+      }
+      case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+      {
+        auto r = static_cast<btScalar>(size / 2.0);
+        // Sphere is a special case where you do not modify the margin which is internally set to the radius
+        m_cellShapes[depth] = std::make_shared<btSphereShape>(r);
+        m_cellExtents[depth] = r;
+        break;
+      }
+      case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+      {
+        auto r = static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2))));
+        // Sphere is a special case where you do not modify the margin which is internally set to the radius
+        m_cellShapes[depth] = std::make_shared<btSphereShape>(r);
+        m_cellExtents[depth] = r;
+        break;
+      }
+    }
+    m_cellShapes[depth]->setUserIndex(shape_index);
+  }
+  m_cellScale = m_cellExtents[tree_depth] / (m_octree->getNodeSize(tree_depth) / 2.0);
+  m_coarseDepth = tree_depth;
+
+  recalculateLocalAabb();
+}
+
+const octomap::OcTree& OctreeShape::getOctree() const { return *m_octree; }
+
+tesseract_geometry::Octree::SubType OctreeShape::getSubType() const { return m_subType; }
+
+btConvexShape* OctreeShape::getCellShape(unsigned depth) const { return m_cellShapes[depth].get(); }
+
+btScalar OctreeShape::getCellExtent(unsigned depth) const { return m_cellExtents[depth]; }
+
+void OctreeShape::updateCastTransform(const btTransform& t01)
+{
+  m_t01 = t01;
+  m_isCast = true;
+}
+
+bool OctreeShape::isCast() const { return m_isCast; }
+
+void OctreeShape::setDistanceTolerance(double tolerance)
+{
+  const unsigned tree_depth = m_octree->getTreeDepth();
+  m_coarseDepth = tree_depth;
+  if (m_subType != tesseract_geometry::Octree::SubType::BOX)
+    return;
+
+  // The distance to the box of a node is at most its diagonal less than the distance to the boxes inside of it
+  while (m_coarseDepth > 0 && std::sqrt(3.0) * m_octree->getNodeSize(m_coarseDepth - 1) <= tolerance)
+    --m_coarseDepth;
+}
+
+unsigned OctreeShape::getCoarseDepth() const { return m_coarseDepth; }
+
+const btTransform& OctreeShape::getCastTransform() const { return m_t01; }
+
+void OctreeShape::recalculateLocalAabb()
+{
+  Eigen::Vector3d aabb_min, aabb_max;
+  calcOctreeOccupiedAABB(aabb_min, aabb_max, *m_octree, m_cellScale);
+  m_localAabbMin = convertEigenToBt(aabb_min);
+  m_localAabbMax = convertEigenToBt(aabb_max);
+}
+
+void OctreeShape::updateLocalAabb(const OctreeDelta& delta)
+{
+  Eigen::Vector3d aabb_min = convertBtToEigen(m_localAabbMin);
+  Eigen::Vector3d aabb_max = convertBtToEigen(m_localAabbMax);
+  updateOctreeOccupiedAABB(aabb_min, aabb_max, *m_octree, delta, m_cellScale);
+  m_localAabbMin = convertEigenToBt(aabb_min);
+  m_localAabbMax = convertEigenToBt(aabb_max);
+}
+
+void OctreeShape::getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  btTransformAabb(m_localAabbMin, m_localAabbMax, 0, t, aabbMin, aabbMax);
+  if (m_isCast)
+  {
+    btVector3 min1, max1;
+    btTransformAabb(m_localAabbMin, m_localAabbMax, 0, t * m_t01, min1, max1);
+    aabbMin.setMin(min1);
+    aabbMax.setMax(max1);
+  }
+}
+
+const char* OctreeShape::getName() const { return "Octree"; }
+
+// LCOV_EXCL_START
+void OctreeShape::setLocalScaling(const btVector3& /*scaling*/)
+{
+  throw std::runtime_error("If you are seeing this error message then something in Bullet must have changed. Attach "
+                           "a debugger and inspect the call stack to find the function in Bullet calling this "
+                           "function, then review commit history to determine what change.");
+}
+
+const btVector3& OctreeShape::getLocalScaling() const
+{
+  static btVector3 out(1, 1, 1);
+  return out;
+}
+
+void OctreeShape::calculateLocalInertia(btScalar /*mass*/, btVector3& inertia) const { inertia.setZero(); }
+
+void OctreeShape::setMargin(btScalar /*margin*/) {}
+
+btScalar OctreeShape::getMargin() const { return 0; }
+// LCOV_EXCL_STOP
+
 void GetAverageSupport(const btConvexShape* shape, const btVector3& localNormal, btScalar& outsupport, btVector3& outpt)
 {
   btVector3 ptSum(0, 0, 0);
@@ -669,6 +1090,35 @@ btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow)
   return cow->getWorldTransform();
 }
 
+tesseract_geometry::GeometryType getStatisticsGeometryType(const COW& cow)
+{
+  const CollisionShapesConst& shapes = cow.getCollisionGeometries();
+  return (shapes.size() == 1) ? shapes.front()->getType() : tesseract_geometry::GeometryType::UNINITIALIZED;
+}
+
+void processCollisionAlgorithm(btCollisionAlgorithm& algorithm,
+                               const btCollisionObjectWrapper& obj0_wrap,
+                               const btCollisionObjectWrapper& obj1_wrap,
+                               const btDispatcherInfo& dispatch_info,
+                               btManifoldResult& result,
+                               ContactManagerStatistics* statistics)
+{
+  if (statistics == nullptr)
+  {
+    algorithm.processCollision(&obj0_wrap, &obj1_wrap, dispatch_info, &result);
+    return;
+  }
+
+  {
+    ContactManagerStatisticsTimer timer(&statistics->narrowphase_time);
+    algorithm.processCollision(&obj0_wrap, &obj1_wrap, dispatch_info, &result);
+  }
+
+  const auto* cow0 = static_cast<const CollisionObjectWrapper*>(obj0_wrap.getCollisionObject());
+  const auto* cow1 = static_cast<const CollisionObjectWrapper*>(obj1_wrap.getCollisionObject());
+  statistics->addNarrowphaseCall(getStatisticsGeometryType(*cow0), getStatisticsGeometryType(*cow1));
+}
+
 bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowedFn& acm, bool verbose)
 {
   return cow1.m_enabled && cow2.m_enabled && (cow2.m_collisionFilterGroup & cow1.m_collisionFilterMask) &&  // NOLINT
@@ -700,28 +1150,36 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
 
   //    }
 
-  btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
-  btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
-  btTransform tf0_inv = tf0.inverse();
-  btTransform tf1_inv = tf1.inverse();
-
   ContactResult contact;
   contact.link_names[0] = cd0->getName();
   contact.link_names[1] = cd1->getName();
+  contact.link_handles[0] = cd0->getHandle();
+  contact.link_handles[1] = cd1->getHandle();
   contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
   contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
-  contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
-  contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
-  contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
-  contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
-  contact.transform[0] = convertBtToEigen(tf0);
-  contact.transform[1] = convertBtToEigen(tf1);
   contact.type_id[0] = cd0->getTypeID();
   contact.type_id[1] = cd1->getTypeID();
   contact.distance = static_cast<double>(cp.m_distance1);
-  contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
+
+  if (collisions.req.detail != ContactResultDetail::BINARY)
+    contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
+
+  if (collisions.req.detail == ContactResultDetail::FULL)
+  {
+    btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
+    btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
+    btTransform tf0_inv = tf0.inverse();
+    btTransform tf1_inv = tf1.inverse();
+
+    contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
+    contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
+    contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
+    contact.transform[0] = convertBtToEigen(tf0);
+    contact.transform[1] = convertBtToEigen(tf1);
+  }
 
   if (processResult(collisions, contact, pc, found) == nullptr)
     return 0;
@@ -832,28 +1290,40 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   //          return 0;
   //    }
 
-  btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
-  btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
-  btTransform tf0_inv = tf0.inverse();
-  btTransform tf1_inv = tf1.inverse();
+  const bool full_detail = (collisions.req.detail == ContactResultDetail::FULL);
 
   ContactResult contact;
   contact.link_names[0] = cd0->getName();
   contact.link_names[1] = cd1->getName();
+  contact.link_handles[0] = cd0->getHandle();
+  contact.link_handles[1] = cd1->getHandle();
   contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
   contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
-  contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
-  contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
-  contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
-  contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
-  contact.transform[0] = convertBtToEigen(tf0);
-  contact.transform[1] = convertBtToEigen(tf1);
   contact.type_id[0] = cd0->getTypeID();
   contact.type_id[1] = cd1->getTypeID();
   contact.distance = static_cast<double>(cp.m_distance1);
-  contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
+
+  if (collisions.req.detail != ContactResultDetail::BINARY)
+    contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
+
+  btTransform tf0_inv;
+  btTransform tf1_inv;
+  if (full_detail)
+  {
+    btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
+    btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
+    tf0_inv = tf0.inverse();
+    tf1_inv = tf1.inverse();
+
+    contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
+    contact.nearest_points[1] = convertBtToEigen(cp.m_positionWorldOnB);
+    contact.nearest_points_local[0] = convertBtToEigen(tf0_inv * cp.m_positionWorldOnA);
+    contact.nearest_points_local[1] = convertBtToEigen(tf1_inv * cp.m_positionWorldOnB);
+    contact.transform[0] = convertBtToEigen(tf0);
+    contact.transform[1] = convertBtToEigen(tf1);
+  }
 
   ContactResult* col = processResult(collisions, contact, pc, found);
   if (col == nullptr)
@@ -862,16 +1332,16 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   if (cd0->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter &&
       cd1->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
   {
-    calculateContinuousData(col, colObj0Wrap, cp.m_positionWorldOnA, -1 * cp.m_normalWorldOnB, tf0_inv, 0);
-    calculateContinuousData(col, colObj1Wrap, cp.m_positionWorldOnB, cp.m_normalWorldOnB, tf1_inv, 1);
+    // The continuous data is only calculated when the full contact detail is requested
+    if (full_detail)
+    {
+      calculateContinuousData(col, colObj0Wrap, cp.m_positionWorldOnA, -1 * cp.m_normalWorldOnB, tf0_inv, 0);
+      calculateContinuousData(col, colObj1Wrap, cp.m_positionWorldOnB, cp.m_normalWorldOnB, tf1_inv, 1);
+    }
   }
   else
   {
     bool castShapeIsFirst = (cd0->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
-    btVector3 normalWorldFromCast = -(castShapeIsFirst ? 1 : -1) * cp.m_normalWorldOnB;
-    const btCollisionObjectWrapper* firstColObjWrap = (castShapeIsFirst ? colObj0Wrap : colObj1Wrap);
-    const btTransform& first_tf_inv = (castShapeIsFirst ? tf0_inv : tf1_inv);
-    const btVector3& ptOnCast = castShapeIsFirst ? cp.m_positionWorldOnA : cp.m_positionWorldOnB;
 
     if (castShapeIsFirst)
     {
@@ -879,13 +1349,22 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
       std::swap(col->nearest_points_local[0], col->nearest_points_local[1]);
       std::swap(col->transform[0], col->transform[1]);
       std::swap(col->link_names[0], col->link_names[1]);
+      std::swap(col->link_handles[0], col->link_handles[1]);
       std::swap(col->type_id[0], col->type_id[1]);
       std::swap(col->shape_id[0], col->shape_id[1]);
       std::swap(col->subshape_id[0], col->subshape_id[1]);
       col->normal *= -1;
     }
 
-    calculateContinuousData(col, firstColObjWrap, ptOnCast, normalWorldFromCast, first_tf_inv, 1);
+    // The continuous data is only calculated when the full contact detail is requested
+    if (full_detail)
+    {
+      btVector3 normalWorldFromCast = -(castShapeIsFirst ? 1 : -1) * cp.m_normalWorldOnB;
+      const btCollisionObjectWrapper* firstColObjWrap = (castShapeIsFirst ? colObj0Wrap : colObj1Wrap);
+      const btTransform& first_tf_inv = (castShapeIsFirst ? tf0_inv : tf1_inv);
+      const btVector3& ptOnCast = castShapeIsFirst ? cp.m_positionWorldOnA : cp.m_positionWorldOnB;
+      calculateContinuousData(col, firstColObjWrap, ptOnCast, normalWorldFromCast, first_tf_inv, 1);
+    }
   }
 
   return 1;
@@ -1056,6 +1535,15 @@ void TesseractBroadphaseBridgedManifoldResult::addContactPoint(const btVector3&
       newPt, obj0Wrap, newPt.m_partId0, newPt.m_index0, obj1Wrap, newPt.m_partId1, newPt.m_index1);
 }
 
+ContactTestData* getContactTestData(const btManifoldResult& result, const btCollisionObject& co)
+{
+  const auto* broadphase_result = dynamic_cast<const TesseractBroadphaseBridgedManifoldResult*>(&result);
+  if (broadphase_result != nullptr)
+    return &broadphase_result->result_callback_.collisions_;
+
+  return static_cast<ContactTestData*>(co.getUserPointer());
+}
+
 TesseractCollisionPairCallback::TesseractCollisionPairCallback(const btDispatcherInfo& dispatchInfo,
                                                                btCollisionDispatcher* dispatcher,
                                                                BroadphaseContactResultCallback& results_callback)
@@ -1071,6 +1559,10 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
   const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy0->m_clientObject);
   const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy1->m_clientObject);
 
+  ContactManagerStatistics* statistics = results_callback_.collisions_.statistics;
+  if (statistics != nullptr)
+    ++statistics->broadphase_pairs;
+
   if (results_callback_.needsCollision(cow0, cow1))
   {
     btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
@@ -1088,22 +1580,80 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
       contactPointResult.m_closestPointDistanceThreshold = static_cast<btScalar>(results_callback_.contact_distance_);
 
       // discrete collision detection query
-      pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
+      processCollisionAlgorithm(*pair.m_algorithm, obj0Wrap, obj1Wrap, dispatch_info_, contactPointResult, statistics);
     }
   }
+  else if (statistics != nullptr)
+  {
+    ++statistics->rejected_pairs;
+  }
   return false;
 }
 
+void processOverlappingPairs(btOverlappingPairCache& pair_cache,
+                             TesseractCollisionPairCallback& callback,
+                             const ContactTestData& cdata,
+                             std::vector<std::pair<btScalar, int>>& order)
+{
+  const int num_pairs = pair_cache.getNumOverlappingPairs();
+  btBroadphasePair* pairs = pair_cache.getOverlappingPairArrayPtr();
+
+  if (cdata.req.type != ContactTestType::FIRST)
+  {
+    for (int i = 0; i < num_pairs && !cdata.done; ++i)
+      callback.processOverlap(pairs[i]);
+
+    return;
+  }
+
+  // The separation of the bounding boxes is the largest gap along any axis, it is most negative for the deepest overlap
+  order.clear();
+  order.reserve(static_cast<std::size_t>(num_pairs));
+  for (int i = 0; i < num_pairs; ++i)
+  {
+    const btBroadphaseProxy& proxy0 = *pairs[i].m_pProxy0;
+    const btBroadphaseProxy& proxy1 = *pairs[i].m_pProxy1;
+    btVector3 gap = (proxy0.m_aabbMin - proxy1.m_aabbMax);
+    gap.setMax(proxy1.m_aabbMin - proxy0.m_aabbMax);
+    order.emplace_back(std::max(std::max(gap.x(), gap.y()), gap.z()), i);
+  }
+
+  std::sort(order.begin(), order.end());
+  for (const auto& entry : order)
+  {
+    if (cdata.done)
+      break;
+
+    callback.processOverlap(pairs[entry.second]);
+  }
+}
+
 TesseractOverlapFilterCallback::TesseractOverlapFilterCallback(bool verbose) : verbose_(verbose) {}
 
 bool TesseractOverlapFilterCallback::needBroadphaseCollision(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) const
 {
-  // Note: We do not pass the allowed collision matrix because if it changes we do not know and this function only
-  // gets called under certain cases and it could cause overlapping pairs to not be processed.
-  return needsCollisionCheck(*(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)),
-                             *(static_cast<CollisionObjectWrapper*>(proxy1->m_clientObject)),
-                             nullptr,
-                             verbose_);
+  const auto* cow0 = static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject);
+  const auto* cow1 = static_cast<CollisionObjectWrapper*>(proxy1->m_clientObject);
+
+  // Note: We do not pass the contact allowed function because if it changes we do not know and this function only
+  // gets called under certain cases and it could cause overlapping pairs to not be processed. The compiled allowed
+  // collision matrix is immutable and the contact manager refreshes the proxies when it is replaced.
+  if (!needsCollisionCheck(*cow0, *cow1, nullptr, verbose_))
+    return false;
+
+  return (acm_ == nullptr || !acm_->isCollisionAllowed(cow0->getName(), cow1->getName()));
+}
+
+void TesseractOverlapFilterCallback::setAllowedCollisionMatrix(
+    tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr acm)
+{
+  acm_ = std::move(acm);
+}
+
+const tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr&
+TesseractOverlapFilterCallback::getAllowedCollisionMatrix() const
+{
+  return acm_;
 }
 
 COW::Ptr createCollisionObject(const std::string& name,
@@ -1128,6 +1678,45 @@ COW::Ptr createCollisionObject(const std::string& name,
   return new_cow;
 }
 
+std::vector<COW::Ptr> createCollisionObjects(const std::vector<std::string>& names,
+                                             const int& type_id,
+                                             const std::vector<CollisionShapesConst>& shapes,
+                                             const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                             bool enabled)
+{
+  if (shapes.size() != names.size() || shape_poses.size() != names.size())
+    throw std::runtime_error("createCollisionObjects, number of shapes does not match names!");
+
+  std::vector<COW::Ptr> cows(names.size());
+  const tesseract_common::Executor::Ptr executor = tesseract_common::getDefaultExecutor();
+  const std::size_t num_workers = std::min(executor->getConcurrency(), names.size());
+
+  std::atomic<std::size_t> next{ 0 };
+  std::vector<std::exception_ptr> errors(num_workers);
+  auto worker = [&](std::size_t worker_idx) {
+    try
+    {
+      for (std::size_t i = next++; i < names.size(); i = next++)
+        cows[i] = createCollisionObject(names[i], type_id, shapes[i], shape_poses[i], enabled);
+    }
+    catch (...)
+    {
+      errors[worker_idx] = std::current_exception();
+      next = names.size();
+    }
+  };
+
+  executor->parallelFor(num_workers, worker);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  return cows;
+}
+
 DiscreteCollisionCollector::DiscreteCollisionCollector(ContactTestData& collisions,
                                                        COW::Ptr cow,
                                                        btScalar contact_distance,
@@ -1213,6 +1802,18 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
     new_cow->manage(shape);
     new_cow->setCollisionShape(shape.get());
   }
+  else if (new_cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+  {
+    assert(dynamic_cast<OctreeShape*>(new_cow->getCollisionShape()) != nullptr);
+    auto* octree = static_cast<OctreeShape*>(new_cow->getCollisionShape());  // NOLINT
+    assert(!octree->isCast());  // This checks if the collision object is already a cast collision object
+
+    auto shape = std::make_shared<OctreeShape>(*octree);
+    shape->updateCastTransform(tf);
+
+    new_cow->manage(shape);
+    new_cow->setCollisionShape(shape.get());
+  }
   else if (btBroadphaseProxy::isCompound(new_cow->getCollisionShape()->getShapeType()))
   {
     assert(dynamic_cast<btCompoundShape*>(new_cow->getCollisionShape()) != nullptr);
@@ -1236,6 +1837,19 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
         subshape->setMargin(BULLET_MARGIN);
         new_compound->addChildShape(geomTrans, subshape.get());
       }
+      else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        auto* octree = static_cast<OctreeShape*>(compound->getChildShape(i));  // NOLINT
+        assert(!octree->isCast());  // This checks if already a cast collision object
+
+        btTransform geomTrans = compound->getChildTransform(i);
+
+        auto subshape = std::make_shared<OctreeShape>(*octree);
+        subshape->updateCastTransform(tf);
+
+        new_cow->manage(subshape);
+        new_compound->addChildShape(geomTrans, subshape.get());
+      }
       else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
       {
         auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));  // NOLINT
@@ -1295,7 +1909,49 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
   return new_cow;
 }
 
-void updateBroadphaseAABB(const COW::Ptr& cow,
+bool updateCollisionObjectOctree(const COW::Ptr& cow, std::size_t shape_index, const OctreeDelta& delta)
+{
+  const auto index = static_cast<int>(shape_index);
+  btCollisionShape* shape = cow->getCollisionShape();
+  if (shape->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+  {
+    if (shape->getUserIndex() != index)
+      return false;
+
+    static_cast<OctreeShape*>(shape)->updateLocalAabb(delta);
+    return true;
+  }
+
+  if (shape->isCompound())
+  {
+    auto* compound = static_cast<btCompoundShape*>(shape);
+    for (int i = 0; i < compound->getNumChildShapes(); ++i)
+    {
+      btCollisionShape* child = compound->getChildShape(i);
+      if (child->getUserIndex() != index)
+        continue;
+
+      if (child->getShapeType() != CUSTOM_CONCAVE_SHAPE_TYPE)
+        return false;
+
+      static_cast<OctreeShape*>(child)->updateLocalAabb(delta);
+
+      // Refresh the bounding box of the child in the compound's dynamic tree along with the compound's bounding box
+      compound->updateChildTransform(i, compound->getChildTransform(i), true);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void updateCollisionObjectMargin(const COW::Ptr& cow, const CollisionMarginData& collision_margin_data)
+{
+  const double margin = collision_margin_data.getMaxCollisionMargin(cow->getName());
+  cow->setContactProcessingThreshold(static_cast<btScalar>(margin));
+}
+
+bool updateBroadphaseAABB(const COW::Ptr& cow,
                           const std::unique_ptr<btBroadphaseInterface>& broadphase,
                           const std::unique_ptr<btCollisionDispatcher>& dispatcher)
 {
@@ -1303,9 +1959,16 @@ void updateBroadphaseAABB(const COW::Ptr& cow,
   btVector3 aabb_min, aabb_max;
   cow->getAABB(aabb_min, aabb_max);
 
+  // Skip the update if the aabb has not changed, setAabb would move the proxy back into the dynamic tree
+  btBroadphaseProxy* bp = cow->getBroadphaseHandle();
+  assert(bp != nullptr);
+  if (bp->m_aabbMin.x() == aabb_min.x() && bp->m_aabbMin.y() == aabb_min.y() && bp->m_aabbMin.z() == aabb_min.z() &&
+      bp->m_aabbMax.x() == aabb_max.x() && bp->m_aabbMax.y() == aabb_max.y() && bp->m_aabbMax.z() == aabb_max.z())
+    return false;
+
   // Update the broadphase aabb
-  assert(cow->getBroadphaseHandle() != nullptr);
-  broadphase->setAabb(cow->getBroadphaseHandle(), aabb_min, aabb_max, dispatcher.get());
+  broadphase->setAabb(bp, aabb_min, aabb_max, dispatcher.get());
+  return true;
 }
 
 void removeCollisionObjectFromBroadphase(const COW::Ptr& cow,
@@ -26,6 +26,14 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <console_bridge/console.h>
 #include <LinearMath/btConvexHullComputer.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -34,6 +42,127 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
 {
+namespace
+{
+/** @brief Inputs smaller than this are passed to the hull computer as is */
+const std::size_t FILTER_INTERIOR_POINTS_MIN_SIZE = 64;
+
+/** @brief The coordinate axes, face diagonals and body diagonals of a cube */
+const std::array<Eigen::Vector3d, 13> EXTREME_POINT_DIRECTIONS{
+  Eigen::Vector3d(1, 0, 0),  Eigen::Vector3d(0, 1, 0),  Eigen::Vector3d(0, 0, 1),  Eigen::Vector3d(1, 1, 0),
+  Eigen::Vector3d(1, -1, 0), Eigen::Vector3d(1, 0, 1),  Eigen::Vector3d(1, 0, -1), Eigen::Vector3d(0, 1, 1),
+  Eigen::Vector3d(0, 1, -1), Eigen::Vector3d(1, 1, 1),  Eigen::Vector3d(1, 1, -1), Eigen::Vector3d(1, -1, 1),
+  Eigen::Vector3d(-1, 1, 1)
+};
+
+/** @brief Get the points which are extreme along evenly spread directions, at most one point per direction */
+tesseract_common::VectorVector3d getExtremePoints(const tesseract_common::VectorVector3d& points, int count)
+{
+  // The directions are spread over the sphere on a Fibonacci spiral
+  const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+  std::vector<std::size_t> indices;
+  indices.reserve(static_cast<std::size_t>(count));
+  for (int i = 0; i < count; ++i)
+  {
+    const double z = 1.0 - ((2.0 * i + 1.0) / count);
+    const double r = std::sqrt(1.0 - (z * z));
+    const Eigen::Vector3d direction(r * std::cos(golden_angle * i), r * std::sin(golden_angle * i), z);
+
+    std::size_t best{ 0 };
+    for (std::size_t j = 1; j < points.size(); ++j)
+    {
+      if (points[j].dot(direction) > points[best].dot(direction))
+        best = j;
+    }
+    indices.push_back(best);
+  }
+
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+  tesseract_common::VectorVector3d extreme_points;
+  extreme_points.reserve(indices.size());
+  for (std::size_t i : indices)
+    extreme_points.push_back(points[i]);
+
+  return extreme_points;
+}
+}  // namespace
+
+tesseract_common::VectorVector3d filterInteriorPoints(const tesseract_common::VectorVector3d& input)
+{
+  if (input.size() < FILTER_INTERIOR_POINTS_MIN_SIZE)
+    return input;
+
+  // Find the extreme points along each direction
+  std::array<std::size_t, 2 * EXTREME_POINT_DIRECTIONS.size()> extreme_indices{};
+  for (std::size_t i = 1; i < input.size(); ++i)
+  {
+    for (std::size_t d = 0; d < EXTREME_POINT_DIRECTIONS.size(); ++d)
+    {
+      const double value = input[i].dot(EXTREME_POINT_DIRECTIONS[d]);
+      if (value < input[extreme_indices[2 * d]].dot(EXTREME_POINT_DIRECTIONS[d]))
+        extreme_indices[2 * d] = i;
+
+      if (value > input[extreme_indices[(2 * d) + 1]].dot(EXTREME_POINT_DIRECTIONS[d]))
+        extreme_indices[(2 * d) + 1] = i;
+    }
+  }
+
+  // The size of the bounding box along the coordinate axes
+  double extent{ 0 };
+  for (std::size_t d = 0; d < 3; ++d)
+    extent = std::max(extent, (input[extreme_indices[(2 * d) + 1]] - input[extreme_indices[2 * d]]).norm());
+
+  std::sort(extreme_indices.begin(), extreme_indices.end());
+  auto last = std::unique(extreme_indices.begin(), extreme_indices.end());
+  tesseract_common::VectorVector3d extreme_points;
+  for (auto it = extreme_indices.begin(); it != last; ++it)
+    extreme_points.push_back(input[*it]);
+
+  tesseract_common::VectorVector3d hull_vertices;
+  Eigen::VectorXi hull_faces;
+  int hull_num_faces = createConvexHull(hull_vertices, hull_faces, extreme_points);
+  if (hull_num_faces < 4)
+    return input;
+
+  // Get the outward facing plane of each face of the hull of the extreme points
+  const Eigen::Vector3d center =
+      std::accumulate(hull_vertices.begin(), hull_vertices.end(), Eigen::Vector3d(Eigen::Vector3d::Zero())) /
+      static_cast<double>(hull_vertices.size());
+  tesseract_common::VectorVector4d planes;
+  planes.reserve(static_cast<std::size_t>(hull_num_faces));
+  for (Eigen::Index i = 0; i < hull_faces.size(); i += hull_faces[i] + 1)
+  {
+    const Eigen::Vector3d& v0 = hull_vertices[static_cast<std::size_t>(hull_faces[i + 1])];
+    const Eigen::Vector3d& v1 = hull_vertices[static_cast<std::size_t>(hull_faces[i + 2])];
+    const Eigen::Vector3d& v2 = hull_vertices[static_cast<std::size_t>(hull_faces[i + 3])];
+    Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+    if (normal.norm() < std::numeric_limits<double>::epsilon())
+      return input;
+
+    normal.normalize();
+    if (normal.dot(center - v0) > 0)
+      normal = -normal;
+
+    planes.emplace_back(normal.x(), normal.y(), normal.z(), -normal.dot(v0));
+  }
+
+  // The hull computer may round the vertices, so only points well inside every plane are removed
+  const double tolerance = 1e-6 * std::max(extent, 1.0);
+  tesseract_common::VectorVector3d filtered;
+  for (const auto& point : input)
+  {
+    const Eigen::Vector4d p(point.x(), point.y(), point.z(), 1);
+    if (std::any_of(planes.begin(), planes.end(), [&p, tolerance](const Eigen::Vector4d& plane) {
+          return plane.dot(p) > -tolerance;
+        }))
+      filtered.push_back(point);
+  }
+
+  return filtered;
+}
+
 int createConvexHull(tesseract_common::VectorVector3d& vertices,
                      Eigen::VectorXi& faces,
                      const tesseract_common::VectorVector3d& input,
@@ -42,10 +171,12 @@ int createConvexHull(tesseract_common::VectorVector3d& vertices,
 {
   vertices.clear();
 
+  const tesseract_common::VectorVector3d filtered = filterInteriorPoints(input);
+
   btConvexHullComputer conv;
   std::vector<double> points;
-  points.reserve(input.size() * 3);
-  for (const auto& v : input)
+  points.reserve(filtered.size() * 3);
+  for (const auto& v : filtered)
   {
     points.push_back(v[0]);
     points.push_back(v[1]);
@@ -54,7 +185,7 @@ int createConvexHull(tesseract_common::VectorVector3d& vertices,
 
   btScalar val = conv.compute(points.data(),
                               3 * sizeof(double),
-                              static_cast<int>(input.size()),
+                              static_cast<int>(filtered.size()),
                               static_cast<btScalar>(shrink),
                               static_cast<btScalar>(shrinkClamp));
   if (val < 0)
@@ -111,15 +242,71 @@ int createConvexHull(tesseract_common::VectorVector3d& vertices,
   return conv.faces.size();
 }
 
-tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mesh& mesh)
+tesseract_geometry::ConvexMesh::Ptr makeConvexMesh(const tesseract_geometry::Mesh& mesh, int max_vertices)
 {
   std::shared_ptr<tesseract_common::VectorVector3d> ch_vertices = std::make_shared<tesseract_common::VectorVector3d>();
   std::shared_ptr<Eigen::VectorXi> ch_faces = std::make_shared<Eigen::VectorXi>();
   int ch_num_faces = createConvexHull(*ch_vertices, *ch_faces, *mesh.getVertices());
+  if (max_vertices > 0 && ch_num_faces > 0 && static_cast<int>(ch_vertices->size()) > max_vertices)
+  {
+    tesseract_common::VectorVector3d extreme_points = getExtremePoints(*ch_vertices, std::max(max_vertices, 4));
+    ch_num_faces = createConvexHull(*ch_vertices, *ch_faces, extreme_points);
+  }
+
   auto convex_mesh =
       std::make_shared<tesseract_geometry::ConvexMesh>(ch_vertices, ch_faces, ch_num_faces, mesh.getResource());
   convex_mesh->setCreationMethod(tesseract_geometry::ConvexMesh::MESH);
   return convex_mesh;
 }
 
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+makeConvexMeshes(const std::vector<tesseract_geometry::Mesh::Ptr>& meshes,
+                 int max_vertices,
+                 std::size_t threads,
+                 const tesseract_common::Executor::Ptr& executor)
+{
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> convex_meshes(meshes.size());
+  const tesseract_common::Executor::Ptr pool =
+      (executor != nullptr) ? executor : tesseract_common::getDefaultExecutor();
+  if (threads == 0)
+    threads = pool->getConcurrency();
+
+  threads = std::min(threads, meshes.size());
+  if (threads <= 1)
+  {
+    for (std::size_t i = 0; i < meshes.size(); ++i)
+      convex_meshes[i] = makeConvexMesh(*meshes[i], max_vertices);
+
+    return convex_meshes;
+  }
+
+  std::atomic<std::size_t> next{ 0 };
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto run = [&]() {
+    for (std::size_t i = next++; i < meshes.size(); i = next++)
+    {
+      try
+      {
+        convex_meshes[i] = makeConvexMesh(*meshes[i], max_vertices);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error == nullptr)
+          error = std::current_exception();
+
+        next = meshes.size();
+      }
+    }
+  };
+
+  pool->parallelFor(threads, [&run](std::size_t /*worker*/) { run(); });
+
+  if (error != nullptr)
+    std::rethrow_exception(error);
+
+  return convex_meshes;
+}
+
 }  // namespace tesseract_collision
@@ -49,6 +49,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_convex_convex_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_primitive_collision_algorithm.h>
 
 namespace tesseract_collision::tesseract_collision_bullet
 {
@@ -82,7 +84,9 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(
   }
 
   mem = btAlignedAlloc(sizeof(TesseractConvexConvexAlgorithm::CreateFunc), 16);
-  m_convexConvexCreateFunc = new (mem) TesseractConvexConvexAlgorithm::CreateFunc(m_pdSolver);
+  auto* convexConvexCreateFunc = new (mem) TesseractConvexConvexAlgorithm::CreateFunc(m_pdSolver);
+  convexConvexCreateFunc->m_warmStartCache = &m_gjkWarmStartCache;
+  m_convexConvexCreateFunc = convexConvexCreateFunc;
 
   mem = btAlignedAlloc(sizeof(TesseractCompoundCollisionAlgorithm::CreateFunc), 16);
   m_compoundCreateFunc = new (mem) TesseractCompoundCollisionAlgorithm::CreateFunc;
@@ -93,16 +97,29 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(
   mem = btAlignedAlloc(sizeof(TesseractCompoundCollisionAlgorithm::SwappedCreateFunc), 16);
   m_swappedCompoundCreateFunc = new (mem) TesseractCompoundCollisionAlgorithm::SwappedCreateFunc;
 
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::CreateFunc), 16);
+  m_octreeCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::CreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::SwappedCreateFunc), 16);
+  m_swappedOctreeCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::SwappedCreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractPrimitiveCollisionAlgorithm::CreateFunc), 16);
+  m_primitiveCreateFunc = new (mem) TesseractPrimitiveCollisionAlgorithm::CreateFunc;
+
   /// calculate maximum element size, big enough to fit any collision algorithm in the memory pool
   int maxSize = sizeof(TesseractConvexConvexAlgorithm);
   int maxSize2 = sizeof(btConvexConcaveCollisionAlgorithm);
   int maxSize3 = sizeof(TesseractCompoundCollisionAlgorithm);
   int maxSize4 = sizeof(TesseractCompoundCompoundCollisionAlgorithm);
+  int maxSize5 = sizeof(TesseractOctreeCollisionAlgorithm);
+  int maxSize6 = sizeof(TesseractPrimitiveCollisionAlgorithm);
 
   int collisionAlgorithmMaxElementSize = btMax(maxSize, constructionInfo.m_customCollisionAlgorithmMaxElementSize);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize2);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize3);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize4);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize5);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize6);
 
   if (constructionInfo.m_persistentManifoldPool != nullptr)
   {
@@ -137,4 +154,149 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(
   }
 }
 
+TesseractCollisionConfiguration::~TesseractCollisionConfiguration()
+{
+  m_octreeCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_octreeCreateFunc);
+
+  m_swappedOctreeCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_swappedOctreeCreateFunc);
+
+  m_primitiveCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_primitiveCreateFunc);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getCollisionAlgorithmCreateFunc(int proxyType0,
+                                                                                                 int proxyType1)
+{
+  if (TesseractPrimitiveCollisionAlgorithm::isSupported(proxyType0, proxyType1))
+    return m_primitiveCreateFunc;
+
+  // Compound shapes are handled first so the octree is checked against the children of the compound
+  if (!btBroadphaseProxy::isCompound(proxyType0) && !btBroadphaseProxy::isCompound(proxyType1))
+  {
+    if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE)
+      return m_octreeCreateFunc;
+
+    if (proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE)
+      return m_swappedOctreeCreateFunc;
+  }
+
+  return btDefaultCollisionConfiguration::getCollisionAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(int proxyType0,
+                                                                                                     int proxyType1)
+{
+  if (TesseractPrimitiveCollisionAlgorithm::isSupported(proxyType0, proxyType1))
+    return m_primitiveCreateFunc;
+
+  if (!btBroadphaseProxy::isCompound(proxyType0) && !btBroadphaseProxy::isCompound(proxyType1))
+  {
+    if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE)
+      return m_octreeCreateFunc;
+
+    if (proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE)
+      return m_swappedOctreeCreateFunc;
+  }
+
+  return btDefaultCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+void TesseractCollisionConfiguration::setGjkWarmStart(bool enabled) { m_gjkWarmStartCache.setEnabled(enabled); }
+
+bool TesseractCollisionConfiguration::getGjkWarmStart() const { return m_gjkWarmStartCache.isEnabled(); }
+
+GjkWarmStartCache& TesseractCollisionConfiguration::getGjkWarmStartCache() { return m_gjkWarmStartCache; }
+
+bool TesseractCollisionConfiguration::setPoolSizes(int collision_algorithm_pool_size, int persistent_manifold_pool_size)
+{
+  if (!m_ownsCollisionAlgorithmPool || !m_ownsPersistentManifoldPool)
+    return false;
+
+  if (m_collisionAlgorithmPool->getUsedCount() > 0 || m_persistentManifoldPool->getUsedCount() > 0)
+    return false;
+
+  const int collisionAlgorithmElementSize = m_collisionAlgorithmPool->getElementSize();
+  m_collisionAlgorithmPool->~btPoolAllocator();
+  btAlignedFree(m_collisionAlgorithmPool);
+
+  void* mem = btAlignedAlloc(sizeof(btPoolAllocator), 16);
+  // NOLINTNEXTLINE
+  m_collisionAlgorithmPool = new (mem) btPoolAllocator(collisionAlgorithmElementSize, collision_algorithm_pool_size);
+
+  m_persistentManifoldPool->~btPoolAllocator();
+  btAlignedFree(m_persistentManifoldPool);
+
+  mem = btAlignedAlloc(sizeof(btPoolAllocator), 16);
+  // NOLINTNEXTLINE
+  m_persistentManifoldPool = new (mem) btPoolAllocator(sizeof(btPersistentManifold), persistent_manifold_pool_size);
+
+  return true;
+}
+
+int TesseractCollisionConfiguration::getCollisionAlgorithmPoolSize() const
+{
+  return m_collisionAlgorithmPool->getMaxCount();
+}
+
+int TesseractCollisionConfiguration::getPersistentManifoldPoolSize() const
+{
+  return m_persistentManifoldPool->getMaxCount();
+}
+
+std::size_t TesseractCollisionConfiguration::getPoolBytes() const
+{
+  std::size_t bytes{ 0 };
+  if (m_ownsCollisionAlgorithmPool)
+    bytes += static_cast<std::size_t>(m_collisionAlgorithmPool->getMaxCount()) *
+             static_cast<std::size_t>(m_collisionAlgorithmPool->getElementSize());
+
+  if (m_ownsPersistentManifoldPool)
+    bytes += static_cast<std::size_t>(m_persistentManifoldPool->getMaxCount()) *
+             static_cast<std::size_t>(m_persistentManifoldPool->getElementSize());
+
+  return bytes;
+}
+
+btDefaultCollisionConstructionInfo getCollisionConstructionInfo(const ContactManagerPoolConfig& pool_config,
+                                                                std::size_t object_count)
+{
+  btDefaultCollisionConstructionInfo info;
+  info.m_defaultMaxCollisionAlgorithmPoolSize = pool_config.getCollisionAlgorithmPoolSize(object_count);
+  info.m_defaultMaxPersistentManifoldPoolSize = pool_config.getPersistentManifoldPoolSize(object_count);
+  return info;
+}
+
+std::unique_ptr<btCollisionDispatcher> createDispatcher(TesseractCollisionConfiguration& coll_config)
+{
+  auto dispatcher = std::make_unique<btCollisionDispatcher>(&coll_config);
+
+  dispatcher->registerCollisionCreateFunc(
+      BOX_SHAPE_PROXYTYPE,
+      BOX_SHAPE_PROXYTYPE,
+      coll_config.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
+
+  dispatcher->setDispatcherFlags(dispatcher->getDispatcherFlags() &
+                                 ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+
+  return dispatcher;
+}
+
+void resizeCollisionPools(TesseractCollisionConfiguration& coll_config,
+                          std::unique_ptr<btCollisionDispatcher>& dispatcher,
+                          const ContactManagerPoolConfig& pool_config,
+                          std::size_t object_count)
+{
+  const int collision_algorithm_pool_size = pool_config.getCollisionAlgorithmPoolSize(object_count);
+  const int persistent_manifold_pool_size = pool_config.getPersistentManifoldPoolSize(object_count);
+  if (collision_algorithm_pool_size == coll_config.getCollisionAlgorithmPoolSize() &&
+      persistent_manifold_pool_size == coll_config.getPersistentManifoldPoolSize())
+    return;
+
+  // The dispatcher keeps pointers to the pools, so it is only replaced together with them
+  if (coll_config.setPoolSizes(collision_algorithm_pool_size, persistent_manifold_pool_size))
+    dispatcher = createDispatcher(coll_config);
+}
+
 }  // namespace tesseract_collision::tesseract_collision_bullet
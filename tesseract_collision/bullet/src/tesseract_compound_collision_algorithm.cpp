@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/types.h>
 
 // LCOV_EXCL_START
@@ -128,7 +129,7 @@ public:
     , m_resultOut(resultOut)
     , m_childCollisionAlgorithms(childCollisionAlgorithms)
     , m_sharedManifold(sharedManifold)
-    , m_contact_test_data(static_cast<ContactTestData*>(compoundObjWrap->m_collisionObject->getUserPointer()))
+    , m_contact_test_data(getContactTestData(*resultOut, *compoundObjWrap->getCollisionObject()))
   {
   }
 
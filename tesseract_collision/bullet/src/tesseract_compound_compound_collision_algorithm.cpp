@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #define USE_LOCAL_STACK 1
 
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/core/types.h>
 
 // LCOV_EXCL_START
@@ -51,6 +52,9 @@ TesseractCompoundCompoundCollisionAlgorithm::TesseractCompoundCompoundCollisionA
   void* ptr = btAlignedAlloc(sizeof(btHashedSimplePairCache), 16);
   m_childCollisionAlgorithmCache = new (ptr) btHashedSimplePairCache();  // NOLINT
 
+  ptr = btAlignedAlloc(sizeof(btHashedSimplePairCache), 16);
+  m_childClosestPointAlgorithmCache = new (ptr) btHashedSimplePairCache();  // NOLINT
+
   const btCollisionObjectWrapper* col0ObjWrap = body0Wrap;
   btAssert(col0ObjWrap->getCollisionShape()->isCompound());
 
@@ -69,6 +73,8 @@ TesseractCompoundCompoundCollisionAlgorithm::~TesseractCompoundCompoundCollision
   removeChildAlgorithms();
   m_childCollisionAlgorithmCache->~btHashedSimplePairCache();
   btAlignedFree(m_childCollisionAlgorithmCache);
+  m_childClosestPointAlgorithmCache->~btHashedSimplePairCache();
+  btAlignedFree(m_childClosestPointAlgorithmCache);
 }
 
 void TesseractCompoundCompoundCollisionAlgorithm::getAllContactManifolds(btManifoldArray& manifoldArray)
@@ -85,7 +91,13 @@ void TesseractCompoundCompoundCollisionAlgorithm::getAllContactManifolds(btManif
 
 void TesseractCompoundCompoundCollisionAlgorithm::removeChildAlgorithms()
 {
-  btSimplePairArray& pairs = m_childCollisionAlgorithmCache->getOverlappingPairArray();
+  removeChildAlgorithms(*m_childCollisionAlgorithmCache);
+  removeChildAlgorithms(*m_childClosestPointAlgorithmCache);
+}
+
+void TesseractCompoundCompoundCollisionAlgorithm::removeChildAlgorithms(btHashedSimplePairCache& cache)
+{
+  btSimplePairArray& pairs = cache.getOverlappingPairArray();
 
   int numChildren = pairs.size();
   for (int i = 0; i < numChildren; i++)
@@ -97,7 +109,20 @@ void TesseractCompoundCompoundCollisionAlgorithm::removeChildAlgorithms()
       m_dispatcher->freeCollisionAlgorithm(algo);
     }
   }
-  m_childCollisionAlgorithmCache->removeAllPairs();
+  cache.removeAllPairs();
+}
+
+/** @brief The distance between two axis aligned bounding boxes, zero if they overlap */
+static inline btScalar calcAabbDistance(const btVector3& aabbMin0,
+                                        const btVector3& aabbMax0,
+                                        const btVector3& aabbMin1,
+                                        const btVector3& aabbMax1)
+{
+  btVector3 gap(0, 0, 0);
+  for (int i = 0; i < 3; ++i)
+    gap[i] = btMax(btScalar(0), btMax(aabbMin1[i] - aabbMax0[i], aabbMin0[i] - aabbMax1[i]));
+
+  return gap.length();
 }
 
 struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
@@ -111,17 +136,32 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
   btManifoldResult* m_resultOut;
 
   class btHashedSimplePairCache* m_childCollisionAlgorithmCache;
+  class btHashedSimplePairCache* m_childClosestPointAlgorithmCache;
 
   btPersistentManifold* m_sharedManifold;
 
   ContactTestData* m_contact_test_data;
 
+  /** @brief Indicate if a single contact is kept per pair, ContactTestType::CLOSEST and FIRST */
+  bool m_single_contact{ false };
+
+  /** @brief The key of this pair of collision objects in the contact results */
+  ObjectPairKey m_pair_key;
+
+  /**
+   * @brief The stored contacts of this pair of collision objects when a single contact is kept per pair
+   * @details The first contact is the best one found so far, so child pairs farther apart than it can not change the
+   * result and are skipped. This is nullptr until the contact results have an entry for the pair.
+   */
+  const ContactResultVector* m_best_contacts{ nullptr };
+
   TesseractCompoundCompoundLeafCallback(const btCollisionObjectWrapper* compound1ObjWrap,
                                         const btCollisionObjectWrapper* compound0ObjWrap,
                                         btDispatcher* dispatcher,
                                         const btDispatcherInfo& dispatchInfo,
                                         btManifoldResult* resultOut,
                                         btHashedSimplePairCache* childAlgorithmsCache,
+                                        btHashedSimplePairCache* childClosestPointAlgorithmsCache,
                                         btPersistentManifold* sharedManifold)
     : m_compound0ColObjWrap(compound1ObjWrap)
     , m_compound1ColObjWrap(compound0ObjWrap)
@@ -129,9 +169,50 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
     , m_dispatchInfo(dispatchInfo)
     , m_resultOut(resultOut)
     , m_childCollisionAlgorithmCache(childAlgorithmsCache)
+    , m_childClosestPointAlgorithmCache(childClosestPointAlgorithmsCache)
     , m_sharedManifold(sharedManifold)
-    , m_contact_test_data(static_cast<ContactTestData*>(compound1ObjWrap->m_collisionObject->getUserPointer()))
+    , m_contact_test_data(getContactTestData(*resultOut, *compound1ObjWrap->getCollisionObject()))
   {
+    const ContactTestType type = m_contact_test_data->req.type;
+    if (m_contact_test_data->res != nullptr && (type == ContactTestType::CLOSEST || type == ContactTestType::FIRST))
+    {
+      const auto* cow0 = static_cast<const CollisionObjectWrapper*>(compound0ObjWrap->getCollisionObject());  // NOLINT
+      const auto* cow1 = static_cast<const CollisionObjectWrapper*>(compound1ObjWrap->getCollisionObject());  // NOLINT
+      m_single_contact = true;
+      m_pair_key = getObjectPairKey(cow0->getName(), cow1->getName());
+      findBestContacts();
+    }
+  }
+
+  /**
+   * @brief Find the stored contacts of this pair in the contact results without adding an entry
+   * @details The contact results are only written by the thread running this algorithm. Map entries do not move on
+   * insertion, so once found the contacts are not searched again.
+   */
+  void findBestContacts()
+  {
+    const auto& container = m_contact_test_data->res->getContainer();
+    auto it = container.find(m_pair_key);
+    if (it != container.end())
+      m_best_contacts = &it->second;
+  }
+
+  /**
+   * @brief The distance beyond which child pairs can not contribute a contact
+   * @details This is the contact threshold, shrunk to the distance of the best contact found so far when a single
+   * contact is kept per pair. When the best contact is penetrating only child pairs with overlapping bounding boxes
+   * can improve it, so the bound does not go below zero.
+   */
+  btScalar getDistanceBound()
+  {
+    btScalar bound = m_resultOut->m_closestPointDistanceThreshold;
+    if (m_single_contact && m_best_contacts == nullptr)
+      findBestContacts();
+
+    if (m_best_contacts != nullptr && !m_best_contacts->empty())
+      bound = btMin(bound, btMax(btScalar(0), static_cast<btScalar>(m_best_contacts->front().distance)));
+
+    return bound;
   }
 
   void Process(const btDbvtNode* leaf0, const btDbvtNode* leaf1)  // NOLINT
@@ -168,6 +249,15 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
     childShape0->getAabb(newChildWorldTrans0, aabbMin0, aabbMax0);
     childShape1->getAabb(newChildWorldTrans1, aabbMin1, aabbMax1);
 
+    if (m_contact_test_data->done)
+      return;
+
+    // The distance between the bounding boxes is a lower bound of the distance between the child shapes
+    const btScalar bound = getDistanceBound();
+    const btScalar aabb_distance = calcAabbDistance(aabbMin0, aabbMax0, aabbMin1, aabbMax1);
+    if (aabb_distance > bound)
+      return;
+
     btVector3 thresholdVec(m_resultOut->m_closestPointDistanceThreshold,
                            m_resultOut->m_closestPointDistanceThreshold,
                            m_resultOut->m_closestPointDistanceThreshold);
@@ -175,9 +265,6 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
     aabbMin0 -= thresholdVec;
     aabbMax0 += thresholdVec;
 
-    if (m_contact_test_data->done)
-      return;
-
     if (TestAabbAgainstAabb2(aabbMin0, aabbMax0, aabbMin1, aabbMax1))
     {
       btCollisionObjectWrapper compoundWrap0(this->m_compound0ColObjWrap,
@@ -193,16 +280,27 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
                                              -1,
                                              childIndex1);
 
-      btSimplePair* pair = m_childCollisionAlgorithmCache->findPair(childIndex0, childIndex1);
-      bool removePair = false;
       btCollisionAlgorithm* colAlgo = nullptr;
       if (m_resultOut->m_closestPointDistanceThreshold > 0)
       {
-        colAlgo = m_dispatcher->findAlgorithm(&compoundWrap0, &compoundWrap1, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
-        removePair = true;
+        // The closest point algorithms own their manifold, so they are kept per child pair like the contact point
+        // algorithms instead of being created and freed for every query
+        btSimplePair* pair = m_childClosestPointAlgorithmCache->findPair(childIndex0, childIndex1);
+        if (pair != nullptr)
+        {
+          colAlgo = (btCollisionAlgorithm*)pair->m_userPointer;  // NOLINT
+        }
+        else
+        {
+          colAlgo = m_dispatcher->findAlgorithm(&compoundWrap0, &compoundWrap1, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+          pair = m_childClosestPointAlgorithmCache->addOverlappingPair(childIndex0, childIndex1);
+          btAssert(pair);
+          pair->m_userPointer = colAlgo;
+        }
       }
       else
       {
+        btSimplePair* pair = m_childCollisionAlgorithmCache->findPair(childIndex0, childIndex1);
         if (pair != nullptr)
         {
           colAlgo = (btCollisionAlgorithm*)pair->m_userPointer;  // NOLINT
@@ -235,12 +333,6 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
 
       m_resultOut->setBody0Wrap(tmpWrap0);
       m_resultOut->setBody1Wrap(tmpWrap1);
-
-      if (removePair)
-      {
-        colAlgo->~btCollisionAlgorithm();
-        m_dispatcher->freeCollisionAlgorithm(colAlgo);
-      }
     }
   }
 };
@@ -259,8 +351,7 @@ MyIntersect(const btDbvtAabbMm& a, const btDbvtAabbMm& b, const btTransform& xfo
 static inline void MycollideTT(const btDbvtNode* root0,
                                const btDbvtNode* root1,
                                const btTransform& xform,
-                               TesseractCompoundCompoundLeafCallback* callback,
-                               btScalar distanceThreshold)
+                               TesseractCompoundCompoundLeafCallback* callback)
 {
   if (root0 != nullptr && root1 != nullptr)
   {
@@ -276,8 +367,12 @@ static inline void MycollideTT(const btDbvtNode* root0,
     stkStack[0] = btDbvt::sStkNN(root0, root1);
     do
     {
+      if (callback->m_contact_test_data->done)
+        break;
+
+      // The bound shrinks as closer contacts are found, pruning the node pairs that can no longer improve on them
       btDbvt::sStkNN p = stkStack[--depth];
-      if (MyIntersect(p.a->volume, p.b->volume, xform, distanceThreshold))
+      if (MyIntersect(p.a->volume, p.b->volume, xform, callback->getDistanceBound()))
       {
         if (depth > treshold)
         {
@@ -382,20 +477,21 @@ void TesseractCompoundCompoundCollisionAlgorithm::processCollision(const btColli
                                                  dispatchInfo,
                                                  resultOut,
                                                  this->m_childCollisionAlgorithmCache,
+                                                 this->m_childClosestPointAlgorithmCache,
                                                  m_sharedManifold);
 
   const btTransform xform = col0ObjWrap->getWorldTransform().inverse() * col1ObjWrap->getWorldTransform();
-  MycollideTT(tree0->m_root, tree1->m_root, xform, &callback, resultOut->m_closestPointDistanceThreshold);
+  MycollideTT(tree0->m_root, tree1->m_root, xform, &callback);
 
   // printf("#compound-compound child/leaf overlap =%d                      \r",callback.m_numOverlapPairs);
 
-  // remove non-overlapping child pairs
-
+  // remove non-overlapping child pairs, from both the contact point and closest point algorithm caches
+  for (btHashedSimplePairCache* cache : { m_childCollisionAlgorithmCache, m_childClosestPointAlgorithmCache })
   {
     btAssert(m_removePairs.size() == 0);
 
     // iterate over all children, perform an AABB check inside ProcessChildShape
-    btSimplePairArray& pairs = m_childCollisionAlgorithmCache->getOverlappingPairArray();
+    btSimplePairArray& pairs = cache->getOverlappingPairArray();
 
     btManifoldArray manifoldArray;
 
@@ -444,7 +540,7 @@ void TesseractCompoundCompoundCollisionAlgorithm::processCollision(const btColli
     }
     for (int i = 0; i < m_removePairs.size(); i++)
     {
-      m_childCollisionAlgorithmCache->removeOverlappingPair(m_removePairs[i].m_indexA, m_removePairs[i].m_indexB);
+      cache->removeOverlappingPair(m_removePairs[i].m_indexA, m_removePairs[i].m_indexB);
     }
     m_removePairs.clear();
   }
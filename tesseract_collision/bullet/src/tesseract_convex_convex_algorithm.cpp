@@ -191,7 +191,8 @@ TesseractConvexConvexAlgorithm::TesseractConvexConvexAlgorithm(btPersistentManif
                                                                const btCollisionObjectWrapper* body1Wrap,
                                                                btConvexPenetrationDepthSolver* pdSolver,
                                                                int numPerturbationIterations,
-                                                               int minimumPointsPerturbationThreshold)
+                                                               int minimumPointsPerturbationThreshold,
+                                                               GjkWarmStartCache* warmStartCache)
   : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap)
   , m_pdSolver(pdSolver)
   , m_manifoldPtr(mf)
@@ -204,6 +205,7 @@ TesseractConvexConvexAlgorithm::TesseractConvexConvexAlgorithm(btPersistentManif
   m_numPerturbationIterations(numPerturbationIterations)
   , m_minimumPointsPerturbationThreshold(minimumPointsPerturbationThreshold)
   , m_cdata(static_cast<ContactTestData*>(body0Wrap->m_collisionObject->getUserPointer()))
+  , m_warmStartCache(warmStartCache)
 {
   (void)body0Wrap;
   (void)body1Wrap;
@@ -413,6 +415,12 @@ void TesseractConvexConvexAlgorithm::processCollision(const btCollisionObjectWra
     gjkPairDetector.setMinkowskiA(min0);
     gjkPairDetector.setMinkowskiB(min1);
 
+    if (m_warmStartCache != nullptr && m_warmStartCache->isEnabled())
+    {
+      gjkPairDetector.setWarmStartAxis(&m_warmStartCache->get(
+          body0Wrap->getCollisionObject(), body0Wrap->m_index, body1Wrap->getCollisionObject(), body1Wrap->m_index));
+    }
+
 #ifdef USE_SEPDISTANCE_UTIL2
     if (dispatchInfo.m_useConvexConservativeDistanceUtil)
     {
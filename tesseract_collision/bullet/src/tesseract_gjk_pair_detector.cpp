@@ -695,10 +695,19 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
     marginB = btScalar(0.);
   }
 
+  ContactManagerStatistics* statistics = m_cdata->statistics;
+  if (statistics != nullptr)
+    ++statistics->gjk_calls;
+
   m_curIter = 0;
   int gGjkMaxIter = 1000;  // this is to catch invalid input, perhaps check for #NaN?
   m_cachedSeparatingAxis.setValue(0, 1, 0);
 
+  // seed the search with the separating axis of the previous query of this pair
+  bool warmStart = (m_warmStartAxis != nullptr && m_warmStartAxis->length2() > SIMD_EPSILON);
+  if (warmStart)
+    m_cachedSeparatingAxis = *m_warmStartAxis;
+
   bool isValid = false;
   bool checkSimplex = false;
   bool checkPenetration = true;
@@ -724,6 +733,8 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
     btSimplexInit(simplex);
 
     btVector3 dir(1, 0, 0);
+    if (warmStart)
+      dir = -m_cachedSeparatingAxis;
 
     {
       btVector3 lastSupV;
@@ -815,7 +826,11 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
 
     if (status == -1 && !m_cdata->req.calculate_distance)
     {
-      // The shapes do not intersect and we did not request distance data so return.
+      // The shapes do not intersect and we did not request distance data so return. The last search direction
+      // separates the shapes so keep it for the next query.
+      if (m_warmStartAxis != nullptr && dir.length2() > SIMD_EPSILON)
+        *m_warmStartAxis = -dir;
+
       return;
     }
 
@@ -1008,6 +1023,9 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
 
         m_cachedSeparatingAxis.setZero();
 
+        if (statistics != nullptr)
+          ++statistics->epa_calls;
+
         bool isValid2 = m_penetrationDepthSolver->calcPenDepth(*m_simplexSolver,
                                                                m_minkowskiA,
                                                                m_minkowskiB,
@@ -1099,6 +1117,8 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
   {
     m_cachedSeparatingAxis = normalInB;
     m_cachedSeparatingDistance = distance;
+    if (m_warmStartAxis != nullptr)
+      *m_warmStartAxis = normalInB;
     if (1)  // NOLINT
     {
       /// todo: need to track down this EPA penetration solver degeneracy
@@ -1169,5 +1189,39 @@ void TesseractGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInpu
   {
     // printf("invalid gjk query\n");
   }
+
+  // The queries returning early only run the intersection test which does not use the GJK iterations
+  if (statistics != nullptr)
+    statistics->gjk_iterations += static_cast<std::size_t>(m_curIter);
 }
+btVector3& GjkWarmStartCache::get(const btCollisionObject* obj0,
+                                  int index0,
+                                  const btCollisionObject* obj1,
+                                  int index1)
+{
+  return data_.try_emplace(Key{ obj0, index0, obj1, index1 }, btScalar(0.), btScalar(0.), btScalar(0.)).first->second;
+}
+
+void GjkWarmStartCache::clear() { data_.clear(); }
+
+std::size_t GjkWarmStartCache::size() const { return data_.size(); }
+
+void GjkWarmStartCache::setEnabled(bool enabled)
+{
+  enabled_ = enabled;
+  if (!enabled_)
+    clear();
+}
+
+bool GjkWarmStartCache::isEnabled() const { return enabled_; }
+
+std::size_t GjkWarmStartCache::KeyHash::operator()(const Key& key) const
+{
+  std::size_t seed = std::hash<const btCollisionObject*>()(key.obj0);
+  seed ^= std::hash<int>()(key.index0) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  seed ^= std::hash<const btCollisionObject*>()(key.obj1) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  seed ^= std::hash<int>()(key.index1) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return seed;
+}
+
 }  // namespace tesseract_collision::tesseract_collision_bullet
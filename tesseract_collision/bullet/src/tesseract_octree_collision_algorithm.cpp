@@ -0,0 +1,369 @@
+/**
+ * @file tesseract_octree_collision_algorithm.cpp
+ * @brief Bullet collision algorithm for the octree collision shape
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <LinearMath/btAabbUtil2.h>
+#include <octomap/octomap.h>
+#include <algorithm>
+#include <array>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+namespace
+{
+struct TesseractOctreeLeafCallback
+{
+  const btCollisionObjectWrapper* m_octreeColObjWrap;
+  const btCollisionObjectWrapper* m_otherObjWrap;
+  btDispatcher* m_dispatcher;
+  const btDispatcherInfo& m_dispatchInfo;
+  btManifoldResult* m_resultOut;
+  const OctreeShape* m_octreeShape;
+  const octomap::OcTree& m_octree;
+  const ContactTestData* m_contact_test_data;
+  double m_occupancyThreshold;
+
+  /** @brief The bounding box of the other shape in the frame of the octree, used to cull the nodes */
+  btVector3 m_otherLocalAabbMin;
+  btVector3 m_otherLocalAabbMax;
+
+  /** @brief The bounding box of the other shape in the world frame, used to check the cells */
+  btVector3 m_otherAabbMin;
+  btVector3 m_otherAabbMax;
+
+  /** @brief The bounding box of the other shape in the frame of the octree without the contact distance */
+  btVector3 m_otherShapeLocalAabbMin;
+  btVector3 m_otherShapeLocalAabbMax;
+
+  /**
+   * @brief Indicate if only the closest contact is needed
+   * @details The children of a node are then visited nearest first and the nodes further than the closest contact
+   * found so far are skipped, so only the branches which may contain a closer cell are refined.
+   */
+  bool m_closest{ false };
+
+  /** @brief The key of the pair in the contact results, used to find the closest contact found so far */
+  ObjectPairKey m_pairKey;
+
+  /** @brief The distance of the closest contact found so far */
+  btScalar m_closestDistance{ std::numeric_limits<btScalar>::max() };
+
+  TesseractOctreeLeafCallback(const btCollisionObjectWrapper* octreeObjWrap,
+                              const btCollisionObjectWrapper* otherObjWrap,
+                              btDispatcher* dispatcher,
+                              const btDispatcherInfo& dispatchInfo,
+                              btManifoldResult* resultOut)
+    : m_octreeColObjWrap(octreeObjWrap)
+    , m_otherObjWrap(otherObjWrap)
+    , m_dispatcher(dispatcher)
+    , m_dispatchInfo(dispatchInfo)
+    , m_resultOut(resultOut)
+    , m_octreeShape(static_cast<const OctreeShape*>(octreeObjWrap->getCollisionShape()))
+    , m_octree(m_octreeShape->getOctree())
+    , m_contact_test_data(getContactTestData(*resultOut, *octreeObjWrap->getCollisionObject()))
+    , m_occupancyThreshold(m_octree.getOccupancyThres())
+  {
+    const btTransform& octree_tf = m_octreeColObjWrap->getWorldTransform();
+    const btTransform& other_tf = m_otherObjWrap->getWorldTransform();
+    m_otherObjWrap->getCollisionShape()->getAabb(other_tf, m_otherAabbMin, m_otherAabbMax);
+    m_otherObjWrap->getCollisionShape()->getAabb(
+        octree_tf.inverseTimes(other_tf), m_otherLocalAabbMin, m_otherLocalAabbMax);
+
+    btScalar extend = m_resultOut->m_closestPointDistanceThreshold;
+    if (m_octreeShape->isCast())
+    {
+      // A point of a cast cell is never further than this from the same point at the start of the cast, so extending
+      // the bounding box by it keeps every node which the cast cells could overlap
+      const btTransform& t01 = m_octreeShape->getCastTransform();
+      btVector3 local_min, local_max;
+      m_octreeShape->getAabb(btTransform::getIdentity(), local_min, local_max);
+      btScalar radius = btMax(local_min.length(), local_max.length());
+      btMatrix3x3 delta = t01.getBasis();
+      btScalar rotation{ 0 };
+      for (int i = 0; i < 3; ++i)
+      {
+        delta[i][i] -= btScalar(1);
+        rotation += delta[i].length2();
+      }
+      extend += t01.getOrigin().length() + (btSqrt(rotation) * radius);
+    }
+
+    m_otherShapeLocalAabbMin = m_otherLocalAabbMin;
+    m_otherShapeLocalAabbMax = m_otherLocalAabbMax;
+
+    btVector3 extend_aabb(extend, extend, extend);
+    m_otherLocalAabbMin -= extend_aabb;
+    m_otherLocalAabbMax += extend_aabb;
+
+    // The distance bounds of the nodes do not account for casting the cells
+    if (m_contact_test_data != nullptr && m_contact_test_data->res != nullptr &&
+        m_contact_test_data->req.type == ContactTestType::CLOSEST && !m_octreeShape->isCast())
+    {
+      m_closest = true;
+      m_pairKey =
+          getObjectPairKey(static_cast<const CollisionObjectWrapper*>(octreeObjWrap->getCollisionObject())->getName(),
+                           static_cast<const CollisionObjectWrapper*>(otherObjWrap->getCollisionObject())->getName());
+      updateClosestDistance();
+    }
+  }
+
+  /**
+   * @brief Update the distance of the closest contact of the pair from the contact results
+   * @details These are the contact results of the manifold result, which are only written by the thread running this
+   * algorithm.
+   */
+  void updateClosestDistance()
+  {
+    auto it = m_contact_test_data->res->find(m_pairKey);
+    if (it != m_contact_test_data->res->end())
+      m_closestDistance = btMin(m_closestDistance, static_cast<btScalar>(it->second.front().distance));
+  }
+
+  /**
+   * @brief Calculate a lower bound of the distance between a cell and the other shape
+   * @details This is the distance between the box around the cell and the bounding box of the other shape, zero if
+   * they overlap.
+   */
+  btScalar calcDistanceLowerBound(const btVector3& center, btScalar extent) const
+  {
+    btScalar distance2{ 0 };
+    for (int i = 0; i < 3; ++i)
+    {
+      btScalar gap = btMax(m_otherShapeLocalAabbMin[i] - (center[i] + extent),
+                           (center[i] - extent) - m_otherShapeLocalAabbMax[i]);
+      if (gap > 0)
+        distance2 += gap * gap;
+    }
+    return btSqrt(distance2);
+  }
+
+  void Process(const octomap::OcTreeNode* node, const octomap::OcTreeKey& key, unsigned depth)  // NOLINT
+  {
+    if (m_contact_test_data != nullptr && m_contact_test_data->done)
+      return;
+
+    // The occupancy of an inner node is the maximum occupancy of its children
+    if (node->getOccupancy() < m_occupancyThreshold)
+      return;
+
+    // The cell shapes of the children never extend further from the center of the node than the cell shape of the
+    // node itself
+    octomap::point3d c = m_octree.keyToCoord(key, depth);
+    btVector3 center(static_cast<btScalar>(c.x()), static_cast<btScalar>(c.y()), static_cast<btScalar>(c.z()));
+    btScalar e = m_octreeShape->getCellExtent(depth);
+    btVector3 extent(e, e, e);
+    if (!TestAabbAgainstAabb2(center - extent, center + extent, m_otherLocalAabbMin, m_otherLocalAabbMax))
+      return;
+
+    // Below the coarse depth the occupied node is checked as a single cell containing its children
+    if (!m_octree.nodeHasChildren(node) || depth >= m_octreeShape->getCoarseDepth())
+    {
+      ProcessCell(center, depth);
+      if (m_closest)
+        updateClosestDistance();
+
+      return;
+    }
+
+    auto center_offset_key = static_cast<octomap::key_type>((1U << (m_octree.getTreeDepth() - 1)) >> (depth + 1));
+    if (!m_closest)
+    {
+      for (unsigned i = 0; i < 8; ++i)
+      {
+        if (m_octree.nodeChildExists(node, i))
+        {
+          octomap::OcTreeKey child_key;
+          octomap::computeChildKey(i, center_offset_key, key, child_key);
+          Process(m_octree.getNodeChild(node, i), child_key, depth + 1);
+        }
+      }
+      return;
+    }
+
+    // Visit the children nearest first, so a close cell is found early and the further children can be skipped
+    std::array<std::pair<btScalar, unsigned>, 8> order;
+    std::array<octomap::OcTreeKey, 8> child_keys;
+    std::size_t count{ 0 };
+    const btScalar child_extent = m_octreeShape->getCellExtent(depth + 1);
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      if (!m_octree.nodeChildExists(node, i))
+        continue;
+
+      octomap::computeChildKey(i, center_offset_key, key, child_keys[i]);
+      octomap::point3d cc = m_octree.keyToCoord(child_keys[i], depth + 1);
+      btVector3 child(static_cast<btScalar>(cc.x()), static_cast<btScalar>(cc.y()), static_cast<btScalar>(cc.z()));
+      order[count++] = { calcDistanceLowerBound(child, child_extent), i };
+    }
+    std::sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(count));
+
+    for (std::size_t j = 0; j < count; ++j)
+    {
+      // The children are sorted, so none of the remaining children can have a closer cell
+      if (order[j].first > 0 && order[j].first > m_closestDistance)
+        break;
+
+      Process(m_octree.getNodeChild(node, order[j].second), child_keys[order[j].second], depth + 1);
+    }
+  }
+
+  void ProcessCell(const btVector3& center, unsigned depth)  // NOLINT
+  {
+    btTransform cell_tf;
+    cell_tf.setIdentity();
+    cell_tf.setOrigin(center);
+    btTransform cell_world_tf = m_octreeColObjWrap->getWorldTransform() * cell_tf;
+
+    btConvexShape* cell_shape = m_octreeShape->getCellShape(depth);
+    if (m_octreeShape->isCast())
+    {
+      CastHullShape cast_shape(cell_shape, cell_tf.inverseTimes(m_octreeShape->getCastTransform() * cell_tf));
+      ProcessCellShape(&cast_shape, cell_world_tf);
+    }
+    else
+    {
+      ProcessCellShape(cell_shape, cell_world_tf);
+    }
+  }
+
+  void ProcessCellShape(const btCollisionShape* cell_shape, const btTransform& cell_world_tf)  // NOLINT
+  {
+    // perform an AABB check first
+    btVector3 aabbMin0, aabbMax0;
+    cell_shape->getAabb(cell_world_tf, aabbMin0, aabbMax0);
+
+    btVector3 extendAabb(m_resultOut->m_closestPointDistanceThreshold,
+                         m_resultOut->m_closestPointDistanceThreshold,
+                         m_resultOut->m_closestPointDistanceThreshold);
+    aabbMin0 -= extendAabb;
+    aabbMax0 += extendAabb;
+
+    if (!TestAabbAgainstAabb2(aabbMin0, aabbMax0, m_otherAabbMin, m_otherAabbMax))
+      return;
+
+    btCollisionObjectWrapper cellWrap(
+        m_octreeColObjWrap, cell_shape, m_octreeColObjWrap->getCollisionObject(), cell_world_tf, -1, -1);
+
+    btCollisionAlgorithm* algo =
+        m_dispatcher->findAlgorithm(&cellWrap, m_otherObjWrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+
+    const btCollisionObjectWrapper* tmpWrap = nullptr;
+
+    /// detect swapping case
+    if (m_resultOut->getBody0Internal() == m_octreeColObjWrap->getCollisionObject())
+    {
+      tmpWrap = m_resultOut->getBody0Wrap();
+      m_resultOut->setBody0Wrap(&cellWrap);
+      m_resultOut->setShapeIdentifiersA(-1, -1);
+    }
+    else
+    {
+      tmpWrap = m_resultOut->getBody1Wrap();
+      m_resultOut->setBody1Wrap(&cellWrap);
+      m_resultOut->setShapeIdentifiersB(-1, -1);
+    }
+
+    algo->processCollision(&cellWrap, m_otherObjWrap, m_dispatchInfo, m_resultOut);
+
+    if (m_resultOut->getBody0Internal() == m_octreeColObjWrap->getCollisionObject())
+      m_resultOut->setBody0Wrap(tmpWrap);
+    else
+      m_resultOut->setBody1Wrap(tmpWrap);
+
+    algo->~btCollisionAlgorithm();
+    m_dispatcher->freeCollisionAlgorithm(algo);
+  }
+};
+}  // namespace
+
+TesseractOctreeCollisionAlgorithm::TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                                                     const btCollisionObjectWrapper* body0Wrap,
+                                                                     const btCollisionObjectWrapper* body1Wrap,
+                                                                     bool isSwapped)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_isSwapped(isSwapped)
+{
+}
+
+void TesseractOctreeCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                         const btCollisionObjectWrapper* body1Wrap,
+                                                         const btDispatcherInfo& dispatchInfo,
+                                                         btManifoldResult* resultOut)
+{
+  const btCollisionObjectWrapper* colObjWrap = m_isSwapped ? body1Wrap : body0Wrap;
+  const btCollisionObjectWrapper* otherObjWrap = m_isSwapped ? body0Wrap : body1Wrap;
+
+  assert(dynamic_cast<const OctreeShape*>(colObjWrap->getCollisionShape()) != nullptr);
+  const auto* octreeShape = static_cast<const OctreeShape*>(colObjWrap->getCollisionShape());
+  const octomap::OcTree& octree = octreeShape->getOctree();
+  if (octree.getRoot() == nullptr)
+    return;
+
+  TesseractOctreeLeafCallback callback(colObjWrap, otherObjWrap, m_dispatcher, dispatchInfo, resultOut);
+
+  // The key of the root node is the center of the key range
+  auto root_key_value = static_cast<octomap::key_type>(1U << (octree.getTreeDepth() - 1));
+  octomap::OcTreeKey root_key(root_key_value, root_key_value, root_key_value);
+  callback.Process(octree.getRoot(), root_key, 0);
+}
+
+btScalar TesseractOctreeCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                  btCollisionObject* /*body1*/,
+                                                                  const btDispatcherInfo& /*dispatchInfo*/,
+                                                                  btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+
+void TesseractOctreeCollisionAlgorithm::getAllContactManifolds(btManifoldArray& /*manifoldArray*/)
+{
+  // The cell algorithms only exist while processing the collision so there are no persistent manifolds
+}
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
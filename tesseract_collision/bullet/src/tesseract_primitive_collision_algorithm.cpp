@@ -0,0 +1,226 @@
+/**
+ * @file tesseract_primitive_collision_algorithm.cpp
+ * @brief Bullet collision algorithm with closed form kernels for sphere, capsule and box pairs
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+#include <BulletCollision/CollisionShapes/btCapsuleShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
+#include <cmath>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_primitive_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/core/primitive_distance.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+namespace
+{
+/** @brief The parameters of a sphere, capsule or box, the pair is ordered by rank so each kernel is called once */
+struct PrimitiveShape
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief Sphere 0, capsule 1 and box 2 */
+  int rank{ 0 };
+  double radius{ 0 };
+  double half_length{ 0 };
+  Eigen::Vector3d half_extents{ Eigen::Vector3d::Zero() };
+
+  /** @brief The world transform, for capsules the segment is along its z axis */
+  Eigen::Isometry3d transform{ Eigen::Isometry3d::Identity() };
+};
+
+int getPrimitiveRank(int proxy_type)
+{
+  switch (proxy_type)
+  {
+    case SPHERE_SHAPE_PROXYTYPE:
+      return 0;
+    case CAPSULE_SHAPE_PROXYTYPE:
+      return 1;
+    case BOX_SHAPE_PROXYTYPE:
+      return 2;
+    default:
+      return -1;
+  }
+}
+
+PrimitiveShape getPrimitiveShape(const btCollisionObjectWrapper* wrap)
+{
+  const btCollisionShape* shape = wrap->getCollisionShape();
+  PrimitiveShape primitive;
+  primitive.rank = getPrimitiveRank(shape->getShapeType());
+  primitive.transform = convertBtToEigen(wrap->getWorldTransform());
+  switch (shape->getShapeType())
+  {
+    case SPHERE_SHAPE_PROXYTYPE:
+    {
+      primitive.radius = static_cast<double>(static_cast<const btSphereShape*>(shape)->getRadius());
+      break;
+    }
+    case CAPSULE_SHAPE_PROXYTYPE:
+    {
+      const auto* capsule = static_cast<const btCapsuleShape*>(shape);
+      primitive.radius = static_cast<double>(capsule->getRadius());
+      primitive.half_length = static_cast<double>(capsule->getHalfHeight());
+
+      // The kernels expect the capsule along z
+      if (capsule->getUpAxis() == 0)
+        primitive.transform.rotate(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()));
+      else if (capsule->getUpAxis() == 1)
+        primitive.transform.rotate(Eigen::AngleAxisd(-M_PI_2, Eigen::Vector3d::UnitX()));
+      break;
+    }
+    default:
+    {
+      primitive.half_extents = convertBtToEigen(static_cast<const btBoxShape*>(shape)->getHalfExtentsWithMargin());
+      break;
+    }
+  }
+  return primitive;
+}
+
+void calcDistance(PrimitiveDistanceResult& result, const PrimitiveShape& shape1, const PrimitiveShape& shape2)
+{
+  if (shape1.rank == 0 && shape2.rank == 0)
+    calcSphereSphereDistance(result, shape1.radius, shape1.transform, shape2.radius, shape2.transform);
+  else if (shape1.rank == 0 && shape2.rank == 1)
+    calcSphereCapsuleDistance(
+        result, shape1.radius, shape1.transform, shape2.radius, shape2.half_length, shape2.transform);
+  else if (shape1.rank == 1 && shape2.rank == 1)
+    calcCapsuleCapsuleDistance(result,
+                               shape1.radius,
+                               shape1.half_length,
+                               shape1.transform,
+                               shape2.radius,
+                               shape2.half_length,
+                               shape2.transform);
+  else if (shape1.rank == 0 && shape2.rank == 2)
+    calcSphereBoxDistance(result, shape1.radius, shape1.transform, shape2.half_extents, shape2.transform);
+  else
+    calcBoxBoxDistance(result, shape1.half_extents, shape1.transform, shape2.half_extents, shape2.transform);
+}
+}  // namespace
+
+TesseractPrimitiveCollisionAlgorithm::TesseractPrimitiveCollisionAlgorithm(
+    btPersistentManifold* mf,
+    const btCollisionAlgorithmConstructionInfo& ci,
+    const btCollisionObjectWrapper* body0Wrap,
+    const btCollisionObjectWrapper* body1Wrap)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_manifoldPtr(mf)
+{
+}
+
+TesseractPrimitiveCollisionAlgorithm::~TesseractPrimitiveCollisionAlgorithm()
+{
+  if (m_ownManifold && m_manifoldPtr != nullptr)
+    m_dispatcher->releaseManifold(m_manifoldPtr);
+}
+
+void TesseractPrimitiveCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                            const btCollisionObjectWrapper* body1Wrap,
+                                                            const btDispatcherInfo& /*dispatchInfo*/,
+                                                            btManifoldResult* resultOut)
+{
+  if (m_manifoldPtr == nullptr)
+  {
+    m_manifoldPtr = m_dispatcher->getNewManifold(body0Wrap->getCollisionObject(), body1Wrap->getCollisionObject());
+    m_ownManifold = true;
+  }
+  resultOut->setPersistentManifold(m_manifoldPtr);
+
+  const PrimitiveShape shape0 = getPrimitiveShape(body0Wrap);
+  const PrimitiveShape shape1 = getPrimitiveShape(body1Wrap);
+
+  PrimitiveDistanceResult result;
+  if (shape0.rank <= shape1.rank)
+  {
+    calcDistance(result, shape0, shape1);
+  }
+  else
+  {
+    calcDistance(result, shape1, shape0);
+    std::swap(result.nearest_points[0], result.nearest_points[1]);
+    result.normal = -result.normal;
+  }
+
+  // Bullet expects the normal on the second body pointing towards the first body and the point on the second body
+  const btScalar threshold = m_manifoldPtr->getContactBreakingThreshold() + resultOut->m_closestPointDistanceThreshold;
+  const auto distance = static_cast<btScalar>(result.distance);
+  if (distance < threshold)
+    resultOut->addContactPoint(
+        convertEigenToBt(Eigen::Vector3d(-result.normal)), convertEigenToBt(result.nearest_points[1]), distance);
+
+  resultOut->refreshContactPoints();
+}
+
+btScalar TesseractPrimitiveCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                     btCollisionObject* /*body1*/,
+                                                                     const btDispatcherInfo& /*dispatchInfo*/,
+                                                                     btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+
+void TesseractPrimitiveCollisionAlgorithm::getAllContactManifolds(btManifoldArray& manifoldArray)
+{
+  if (m_manifoldPtr != nullptr && m_ownManifold)
+    manifoldArray.push_back(m_manifoldPtr);
+}
+
+bool TesseractPrimitiveCollisionAlgorithm::isSupported(int proxyType0, int proxyType1)
+{
+  const int rank0 = getPrimitiveRank(proxyType0);
+  const int rank1 = getPrimitiveRank(proxyType1);
+  if (rank0 < 0 || rank1 < 0)
+    return false;
+
+  // There is no closed form kernel for box-capsule
+  return !((rank0 == 1 && rank1 == 2) || (rank0 == 2 && rank1 == 1));
+}
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
@@ -0,0 +1,117 @@
+/**
+ * @file aabb_soa.h
+ * @brief Axis aligned bounding boxes stored as a structure of arrays for batched overlap tests
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CORE_AABB_SOA_H
+#define TESSERACT_COLLISION_CORE_AABB_SOA_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision
+{
+/**
+ * @brief Axis aligned bounding boxes stored as a structure of arrays
+ * @details Each bound of each axis is a contiguous array, so testing one box against a range of boxes is a branch free
+ * loop over six arrays which the compiler vectorizes for the enabled instruction set. For the few tens of objects of a
+ * self collision check or a gripper this all pairs test is faster than maintaining and traversing a tree.
+ */
+class AABBSoA
+{
+public:
+  /** @brief Remove all boxes, the capacity is kept */
+  void clear();
+
+  /** @brief Reserve storage for a number of boxes */
+  void reserve(std::size_t size);
+
+  /** @brief The number of boxes */
+  std::size_t size() const { return min_x_.size(); }
+
+  /** @brief Check if there are no boxes */
+  bool empty() const { return min_x_.empty(); }
+
+  /**
+   * @brief Add a box
+   * @param aabb_min The minimum corner
+   * @param aabb_max The maximum corner
+   */
+  void push_back(const Eigen::Vector3d& aabb_min, const Eigen::Vector3d& aabb_max);  // NOLINT
+
+  /** @brief The minimum corner of a box */
+  Eigen::Vector3d getMin(std::size_t index) const;
+
+  /** @brief The maximum corner of a box */
+  Eigen::Vector3d getMax(std::size_t index) const;
+
+  /**
+   * @brief Compute the separation of two of the boxes
+   * @details The separation is the largest gap between the boxes along any axis, it is zero for boxes that touch and
+   * negative for boxes that overlap. It is a lower bound on the distance between the boxes.
+   * @param index1 The index of the first box
+   * @param index2 The index of the second box
+   * @return The separation of the boxes
+   */
+  double separation(std::size_t index1, std::size_t index2) const;
+
+  /**
+   * @brief Compute the separation of a box from a range of the boxes
+   * @details The separation is the largest gap between the boxes along any axis, it is zero for boxes that touch and
+   * negative for boxes that overlap. It is a lower bound on the distance between the boxes.
+   * @param aabb_min The minimum corner of the box
+   * @param aabb_max The maximum corner of the box
+   * @param begin The index of the first box of the range
+   * @param end One past the index of the last box of the range
+   * @param result Resized to the size of the range, the separation from each box of the range
+   */
+  void separations(const Eigen::Vector3d& aabb_min,
+                   const Eigen::Vector3d& aabb_max,
+                   std::size_t begin,
+                   std::size_t end,
+                   std::vector<double>& result) const;
+
+  /**
+   * @brief Compute the separation of one of the boxes from a range of the boxes
+   * @param index The index of the box
+   * @param begin The index of the first box of the range
+   * @param end One past the index of the last box of the range
+   * @param result Resized to the size of the range, the separation from each box of the range
+   */
+  void separations(std::size_t index, std::size_t begin, std::size_t end, std::vector<double>& result) const;
+
+private:
+  std::vector<double> min_x_;
+  std::vector<double> min_y_;
+  std::vector<double> min_z_;
+  std::vector<double> max_x_;
+  std::vector<double> max_y_;
+  std::vector<double> max_z_;
+};
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_CORE_AABB_SOA_H
@@ -0,0 +1,263 @@
+/**
+ * @file cached_discrete_contact_manager.h
+ * @brief A discrete contact manager which caches the contact results of recently checked states
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CACHED_DISCRETE_CONTACT_MANAGER_H
+#define TESSERACT_COLLISION_CACHED_DISCRETE_CONTACT_MANAGER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief A discrete contact manager which wraps another manager and caches the results of contactTest
+ * @details The results are stored in a least recently used cache keyed on the transforms of the active collision
+ * objects, quantized to the provided tolerances, along with the contact request. Any other change which can affect the
+ * results, like moving a static object, changing the collision margin data, the contact allowed function, the active
+ * collision objects or enabling and disabling objects, clears the cache.
+ *
+ * All calls must go through this manager so it can track the transforms of the collision objects. Contact requests
+ * with an is_valid function are always forwarded to the wrapped manager because the function cannot be compared.
+ * Cached results are added to the provided results the same way the wrapped manager adds them.
+ */
+class CachedDiscreteContactManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<CachedDiscreteContactManager>;
+  using ConstPtr = std::shared_ptr<const CachedDiscreteContactManager>;
+  using UPtr = std::unique_ptr<CachedDiscreteContactManager>;
+  using ConstUPtr = std::unique_ptr<const CachedDiscreteContactManager>;
+
+  /**
+   * @brief Constructor
+   * @param manager The contact manager to cache the results of
+   * @param memory_budget The approximate maximum memory in bytes used by the cached results
+   * @param linear_tolerance The tolerance used to quantize the translation of the transforms
+   * @param angular_tolerance The tolerance used to quantize the rotation matrix of the transforms
+   */
+  CachedDiscreteContactManager(DiscreteContactManager::UPtr manager,
+                               std::size_t memory_budget = 64 * 1024 * 1024,
+                               double linear_tolerance = 1e-6,
+                               double angular_tolerance = 1e-6);
+  ~CachedDiscreteContactManager() override = default;
+  CachedDiscreteContactManager(const CachedDiscreteContactManager&) = delete;
+  CachedDiscreteContactManager& operator=(const CachedDiscreteContactManager&) = delete;
+  CachedDiscreteContactManager(CachedDiscreteContactManager&&) = delete;
+  CachedDiscreteContactManager& operator=(CachedDiscreteContactManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionObjectsActive(const std::vector<std::string>& names, bool active) override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  /**
+   * @brief Get the wrapped contact manager
+   * @note Changes made directly to the wrapped manager are not tracked, call clearCache after making them
+   * @return The wrapped contact manager
+   */
+  DiscreteContactManager& getManager();
+  const DiscreteContactManager& getManager() const;
+
+  /**
+   * @brief Set the tolerances used to quantize the transforms, this clears the cache
+   * @details The transforms of two states that fall within the same quantization cell return the same results. A
+   * tolerance of zero or less compares the exact values.
+   * @param linear_tolerance The tolerance used to quantize the translation of the transforms
+   * @param angular_tolerance The tolerance used to quantize the rotation matrix of the transforms
+   */
+  void setCacheTolerance(double linear_tolerance, double angular_tolerance);
+
+  /** @brief Get the tolerance used to quantize the translation of the transforms */
+  double getCacheLinearTolerance() const;
+
+  /** @brief Get the tolerance used to quantize the rotation matrix of the transforms */
+  double getCacheAngularTolerance() const;
+
+  /**
+   * @brief Set the approximate maximum memory in bytes used by the cached results
+   * @details Least recently used results are removed until the cache is within the budget
+   * @param memory_budget The memory budget in bytes
+   */
+  void setCacheMemoryBudget(std::size_t memory_budget);
+
+  /** @brief Get the approximate maximum memory in bytes used by the cached results */
+  std::size_t getCacheMemoryBudget() const;
+
+  /** @brief Get the approximate memory in bytes currently used by the cached results */
+  std::size_t getCacheMemoryUsage() const;
+
+  /** @brief Get the number of cached results */
+  std::size_t getCacheSize() const;
+
+  /** @brief Get the number of contact tests returned from the cache */
+  std::size_t getCacheHits() const;
+
+  /** @brief Get the number of contact tests forwarded to the wrapped manager */
+  std::size_t getCacheMisses() const;
+
+  /** @brief Remove all cached results */
+  void clearCache();
+
+  /** @brief Reset the cache hit and miss counters */
+  void resetCacheStatistics();
+
+private:
+  using CacheKey = std::vector<std::int64_t>;
+
+  struct CacheKeyHash
+  {
+    std::size_t operator()(const CacheKey& key) const;
+  };
+
+  struct CacheEntry
+  {
+    CacheKey key;
+    ContactResultMap results;
+    std::size_t memory{ 0 };
+  };
+
+  /** @brief The wrapped contact manager */
+  DiscreteContactManager::UPtr manager_;
+
+  /** @brief The transforms of the collision objects indexed by handle */
+  tesseract_common::VectorIsometry3d transforms_;
+
+  /** @brief Indicates if a collision object is active indexed by handle */
+  std::vector<bool> is_active_;
+
+  /** @brief The handles of the active collision objects */
+  std::vector<int> active_handles_;
+
+  std::size_t memory_budget_;     /**< @brief The memory budget of the cached results */
+  std::size_t memory_usage_{ 0 }; /**< @brief The memory used by the cached results */
+  double linear_tolerance_;       /**< @brief The translation quantization tolerance */
+  double angular_tolerance_;      /**< @brief The rotation quantization tolerance */
+  std::size_t hits_{ 0 };         /**< @brief The number of cache hits */
+  std::size_t misses_{ 0 };       /**< @brief The number of cache misses */
+
+  /** @brief The cached results, most recently used first */
+  std::list<CacheEntry> entries_;
+
+  /** @brief The cached results by key */
+  std::unordered_map<CacheKey, std::list<CacheEntry>::iterator, CacheKeyHash> lookup_;
+
+  /** @brief Storage reused to build the key of a contact request */
+  CacheKey key_;
+
+  /** @brief Update the tracked objects and active handles from the wrapped manager */
+  void updateActiveHandles();
+
+  /**
+   * @brief Build the key of the current state for the contact request
+   * @param request The contact request
+   */
+  void buildKey(const ContactRequest& request);
+
+  /** @brief Remove least recently used results until the memory usage is within the budget */
+  void evict();
+};
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_CACHED_DISCRETE_CONTACT_MANAGER_H
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/metrics.h>
 #include <tesseract_collision/core/types.h>
 
 namespace tesseract_collision
@@ -79,6 +80,14 @@ bool isContactAllowed(const std::string& name1,
                       const IsContactAllowedFn& acm,
                       bool verbose = false);
 
+/**
+ * @brief Get the compiled allowed collision matrix currently queried by the contact allowed function
+ * @param acm The contact allowed function
+ * @return The compiled allowed collision matrix, nullptr if the function is not a CompiledAllowedCollisionMatrixFn
+ */
+tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr
+getCompiledAllowedCollisionMatrix(const IsContactAllowedFn& acm);
+
 /**
  * @brief processResult Processes the ContactResult based on the information in the ContactTestData
  * @param cdata Information used to process the results
@@ -152,6 +161,79 @@ int loadSimplePlyFile(const std::string& path,
                       Eigen::VectorXi& faces,
                       bool triangles_only = false);
 
+/**
+ * @brief Apply the changes of an octree delta to an octree
+ * @details Occupied cells are set to the maximum clamping threshold and free cells to the minimum clamping threshold.
+ * The inner nodes are updated along the way so the octree can be checked directly after.
+ * @param octree The octree to modify
+ * @param delta The cells whose occupancy changed
+ */
+void applyOctreeDelta(octomap::OcTree& octree, const OctreeDelta& delta);
+
+/**
+ * @brief Calculate the bounding box of the occupied cells of an octree
+ * @details An octree without occupied cells is represented by an empty box at its origin
+ * @param aabb_min The minimum corner of the bounding box
+ * @param aabb_max The maximum corner of the bounding box
+ * @param octree The octree
+ * @param cell_scale The scale applied to the half size of the cells, for shapes which extend past the cell
+ * @return False if the octree has no occupied cells, otherwise true
+ */
+bool calcOctreeOccupiedAABB(Eigen::Vector3d& aabb_min,
+                            Eigen::Vector3d& aabb_max,
+                            const octomap::OcTree& octree,
+                            double cell_scale = 1.0);
+
+/**
+ * @brief Update the bounding box of the occupied cells of an octree after a delta was applied to it
+ * @details The bounding box grows to include the cells which became occupied. It is only recalculated from the whole
+ * octree if a cell which became free touches the previous bounding box or the previous bounding box is empty.
+ * @param aabb_min The minimum corner of the bounding box provided by calcOctreeOccupiedAABB
+ * @param aabb_max The maximum corner of the bounding box provided by calcOctreeOccupiedAABB
+ * @param octree The octree with the delta already applied
+ * @param delta The cells whose occupancy changed
+ * @param cell_scale The scale applied to the half size of the cells, for shapes which extend past the cell
+ * @return False if the octree has no occupied cells, otherwise true
+ */
+bool updateOctreeOccupiedAABB(Eigen::Vector3d& aabb_min,
+                              Eigen::Vector3d& aabb_max,
+                              const octomap::OcTree& octree,
+                              const OctreeDelta& delta,
+                              double cell_scale = 1.0);
+
+/**
+ * @brief Calculate the bounding box of the shapes of a collision object in the frame of the collision object
+ * @details Octrees are bounded by their occupied cells. Shapes which can not be bounded, like planes, give an infinite
+ * box.
+ * @param shapes The shapes of the collision object
+ * @param shape_poses The transform of each shape in the frame of the collision object
+ * @return The bounding box, empty if there are no shapes
+ */
+Eigen::AlignedBox3d calcCollisionObjectAABB(const CollisionShapesConst& shapes,
+                                            const tesseract_common::VectorIsometry3d& shape_poses);
+
+/**
+ * @brief Transform a bounding box
+ * @param aabb The bounding box
+ * @param transform The transform
+ * @return The axis aligned bounding box of the transformed box, infinite boxes stay infinite
+ */
+Eigen::AlignedBox3d transformAABB(const Eigen::AlignedBox3d& aabb, const Eigen::Isometry3d& transform);
+
+/**
+ * @brief Get the contact test latency histogram of a contact manager type from the metrics registry
+ * @param manager_type The type of the contact manager, used as the manager label
+ * @return The histogram, valid for the lifetime of the process
+ */
+tesseract_common::MetricHistogram& getContactTestLatencyMetric(const std::string& manager_type);
+
+/**
+ * @brief Get the clone counter of a contact manager type from the metrics registry
+ * @param manager_type The type of the contact manager, used as the manager label
+ * @return The counter, valid for the lifetime of the process
+ */
+tesseract_common::MetricCounter& getContactManagerCloneMetric(const std::string& manager_type);
+
 }  // namespace tesseract_collision
 
 #endif  // TESSERACT_COLLISION_COMMON_H
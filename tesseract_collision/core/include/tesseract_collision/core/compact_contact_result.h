@@ -0,0 +1,187 @@
+/**
+ * @file compact_contact_result.h
+ * @brief A compact storage of contact results for high volume queries
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_COMPACT_CONTACT_RESULT_H
+#define TESSERACT_COLLISION_COMPACT_CONTACT_RESULT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief A compact storage of contact results
+ * @details Each contact only stores the distance along with the link handles, shape ids and subshape ids identifying
+ * the pair, which is less than a tenth of the size of a ContactResult. The link handles are the indices of the links
+ * in the contact manager's getCollisionObjects(), so the results can only be stored from contact managers providing
+ * handles.
+ *
+ * The remaining data is stored separately depending on the detail the storage is created with, matching the data
+ * populated by the contact request detail:
+ *   - BINARY: no additional data
+ *   - DISTANCE: the normal
+ *   - FULL: the normal, the nearest points and the continuous contact time and type
+ *
+ * Reuse a ContactResultMap for the contact tests and append its results here, so the full results only exist for a
+ * single contact test at a time.
+ *
+ * @tparam FloatType The precision the distance, normal, nearest points and continuous contact time are stored with,
+ * double or float
+ */
+template <typename FloatType = double>
+class CompactContactResults
+{
+public:
+  using Vector3 = Eigen::Matrix<FloatType, 3, 1>;
+
+  /** @brief The data stored for every contact */
+  struct Contact
+  {
+    /** @brief The distance between the two links */
+    FloatType distance{ std::numeric_limits<FloatType>::max() };
+    /** @brief The handles of the two links that are in contact */
+    std::array<int, 2> link_handles{ -1, -1 };
+    /** @brief The two shapes that are in contact */
+    std::array<int, 2> shape_id{ -1, -1 };
+    /** @brief The subshapes that are in contact, like the boxes of an octree and the triangles of a mesh */
+    std::array<int, 2> subshape_id{ -1, -1 };
+  };
+
+  /**
+   * @brief Constructor
+   * @param detail The detail of the contacts stored, see ContactResultDetail
+   */
+  explicit CompactContactResults(ContactResultDetail detail = ContactResultDetail::BINARY);
+
+  /** @brief Get the detail of the contacts stored */
+  ContactResultDetail getDetail() const;
+
+  /**
+   * @brief Append a contact result
+   * @throws std::runtime_error if the contact result does not have link handles
+   */
+  void append(const ContactResult& result);
+
+  /**
+   * @brief Append the contact results of all pairs
+   * @throws std::runtime_error if a contact result does not have link handles
+   */
+  void append(const ContactResultMap& results);
+
+  /** @brief The number of contacts stored */
+  std::size_t size() const;
+
+  /** @brief Check if no contacts are stored */
+  bool empty() const;
+
+  /** @brief Remove all contacts, keeping the storage for reuse */
+  void clear();
+
+  /** @brief Reserve the storage for a number of contacts */
+  void reserve(std::size_t size);
+
+  /** @brief Get the contact data of a contact */
+  const Contact& operator[](std::size_t index) const;
+
+  /**
+   * @brief Get the normal of a contact, see ContactResult::normal
+   * @throws std::runtime_error if the detail does not include the normal
+   */
+  const Vector3& getNormal(std::size_t index) const;
+
+  /**
+   * @brief Get the nearest points of a contact in world coordinates, see ContactResult::nearest_points
+   * @throws std::runtime_error if the detail does not include the nearest points
+   */
+  const std::array<Vector3, 2>& getNearestPoints(std::size_t index) const;
+
+  /**
+   * @brief Get the continuous contact time of a contact, see ContactResult::cc_time
+   * @throws std::runtime_error if the detail does not include the continuous contact data
+   */
+  const std::array<FloatType, 2>& getContinuousContactTime(std::size_t index) const;
+
+  /**
+   * @brief Get the continuous contact type of a contact, see ContactResult::cc_type
+   * @throws std::runtime_error if the detail does not include the continuous contact data
+   */
+  const std::array<ContinuousCollisionType, 2>& getContinuousContactType(std::size_t index) const;
+
+  /**
+   * @brief Convert a contact to a full contact result
+   * @details The data which is not stored keeps its default value
+   * @param index The index of the contact
+   * @param link_names The collision objects of the contact manager the contact was stored from, which maps the link
+   * handles to the link names
+   * @return The contact result
+   */
+  ContactResult toContactResult(std::size_t index, const std::vector<std::string>& link_names) const;
+
+  /**
+   * @brief Convert all contacts to full contact results keyed by link pair
+   * @param results The contact results, the converted contacts are added to the existing results
+   * @param link_names The collision objects of the contact manager the contacts were stored from
+   */
+  void toContactResultMap(ContactResultMap& results, const std::vector<std::string>& link_names) const;
+
+private:
+  /** @brief The detail of the contacts stored */
+  ContactResultDetail detail_;
+
+  /** @brief The data stored for every contact */
+  std::vector<Contact> contacts_;
+
+  /** @brief The normals, only stored if the detail is DISTANCE or FULL */
+  std::vector<Vector3> normals_;
+
+  /** @brief The nearest points, only stored if the detail is FULL */
+  std::vector<std::array<Vector3, 2>> nearest_points_;
+
+  /** @brief The continuous contact times, only stored if the detail is FULL */
+  std::vector<std::array<FloatType, 2>> cc_time_;
+
+  /** @brief The continuous contact types, only stored if the detail is FULL */
+  std::vector<std::array<ContinuousCollisionType, 2>> cc_type_;
+
+  /** @brief Check if the normals are stored */
+  bool hasNormals() const;
+
+  /** @brief Check if the nearest points and continuous contact data are stored */
+  bool hasFullData() const;
+};
+
+extern template class CompactContactResults<double>;
+extern template class CompactContactResults<float>;
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_COMPACT_CONTACT_RESULT_H
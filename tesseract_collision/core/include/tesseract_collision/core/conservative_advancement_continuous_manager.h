@@ -0,0 +1,233 @@
+/**
+ * @file conservative_advancement_continuous_manager.h
+ * @brief A continuous contact manager using conservative advancement on a discrete contact manager
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONSERVATIVE_ADVANCEMENT_CONTINUOUS_MANAGER_H
+#define TESSERACT_COLLISION_CONSERVATIVE_ADVANCEMENT_CONTINUOUS_MANAGER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief A continuous contact manager which finds the time of impact using conservative advancement
+ * @details The active collision objects move from their start to their end transform, interpolating the translation
+ * linearly and the rotation spherically. Starting at the start transforms the wrapped discrete contact manager provides
+ * the distance of every pair which can come within its collision margin before the end of the motion. Since no point
+ * of a collision object moves further than the bound of its motion, calculated from the bounding sphere of its
+ * geometry, the objects are advanced by the time it takes the fastest pair to close its distance. This repeats until
+ * every pair has either come within its collision margin plus the tolerance or the end of the motion is reached.
+ *
+ * This works for any geometry the wrapped manager provides distances for, including meshes and octrees, and gives the
+ * time of impact of each pair directly in ContactResult::cc_time. Only the first contact of a pair along the motion is
+ * reported, so ContactTestType::ALL returns a single contact per pair. The nearest points are those at the time of
+ * impact, while ContactResult::transform and ContactResult::cc_transform are the start and end transforms.
+ *
+ * All calls must go through this manager so it can track the transforms of the collision objects.
+ */
+class ConservativeAdvancementContinuousManager : public ContinuousContactManager
+{
+public:
+  using Ptr = std::shared_ptr<ConservativeAdvancementContinuousManager>;
+  using ConstPtr = std::shared_ptr<const ConservativeAdvancementContinuousManager>;
+  using UPtr = std::unique_ptr<ConservativeAdvancementContinuousManager>;
+  using ConstUPtr = std::unique_ptr<const ConservativeAdvancementContinuousManager>;
+
+  /**
+   * @brief Constructor
+   * @details Collision objects already in the wrapped manager are assumed to be at the identity until their transform
+   * is set through this manager.
+   * @param manager The discrete contact manager used to calculate the distances
+   * @param tolerance The distance past the collision margin at which a pair is considered in contact
+   * @param max_iterations The maximum number of advancement steps of a contact test
+   */
+  ConservativeAdvancementContinuousManager(DiscreteContactManager::UPtr manager,
+                                           double tolerance = 1e-4,
+                                           std::size_t max_iterations = 100);
+  ~ConservativeAdvancementContinuousManager() override = default;
+  ConservativeAdvancementContinuousManager(const ConservativeAdvancementContinuousManager&) = delete;
+  ConservativeAdvancementContinuousManager& operator=(const ConservativeAdvancementContinuousManager&) = delete;
+  ConservativeAdvancementContinuousManager(ConservativeAdvancementContinuousManager&&) = delete;
+  ConservativeAdvancementContinuousManager& operator=(ConservativeAdvancementContinuousManager&&) = delete;
+
+  std::string getName() const override final;
+
+  ContinuousContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  bool addCollisionObjects(const std::vector<std::string>& names,
+                           const int& mask_id,
+                           const std::vector<CollisionShapesConst>& shapes,
+                           const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                           bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  bool getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const override final;
+
+  using ContinuousContactManager::setCollisionObjectsTransform;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  void setCollisionObjectsTransform(const std::string& name,
+                                    const Eigen::Isometry3d& pose1,
+                                    const Eigen::Isometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& pose1,
+                                    const tesseract_common::VectorIsometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                    const tesseract_common::TransformMap& pose2) override final;
+
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionObjectsActive(const std::vector<std::string>& names, bool active) override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  /**
+   * @brief Get the wrapped contact manager
+   * @note Changes made directly to the wrapped manager are not tracked
+   * @return The wrapped contact manager
+   */
+  const DiscreteContactManager& getManager() const;
+
+  /**
+   * @brief Set the distance past the collision margin at which a pair is considered in contact
+   * @details A smaller tolerance gives a more accurate time of impact at the cost of more advancement steps
+   */
+  void setTolerance(double tolerance);
+
+  /** @brief Get the distance past the collision margin at which a pair is considered in contact */
+  double getTolerance() const;
+
+  /**
+   * @brief Set the maximum number of advancement steps of a contact test
+   * @details Pairs which are neither in contact nor past the end of the motion when the limit is reached are not
+   * reported, a warning is logged when this happens.
+   */
+  void setMaxIterations(std::size_t max_iterations);
+
+  /** @brief Get the maximum number of advancement steps of a contact test */
+  std::size_t getMaxIterations() const;
+
+  /**
+   * @brief Get the radius of the bounding sphere of a collision object about its origin
+   * @param name The collision object name
+   * @return The radius, zero if the collision object does not exist
+   */
+  double getCollisionObjectRadius(const std::string& name) const;
+
+private:
+  /** @brief The motion of a collision object */
+  struct CollisionObject
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    Eigen::Isometry3d pose1{ Eigen::Isometry3d::Identity() }; /**< @brief The start transform */
+    Eigen::Isometry3d pose2{ Eigen::Isometry3d::Identity() }; /**< @brief The end transform */
+    double radius{ 0 }; /**< @brief The radius of the bounding sphere of the geometry about the origin */
+  };
+
+  /** @brief The wrapped contact manager */
+  DiscreteContactManager::UPtr manager_;
+
+  /** @brief The distance past the collision margin at which a pair is considered in contact */
+  double tolerance_;
+
+  /** @brief The maximum number of advancement steps of a contact test */
+  std::size_t max_iterations_;
+
+  /** @brief The collision margin data, the wrapped manager uses increased margins during a contact test */
+  CollisionMarginData margin_data_;
+
+  /** @brief The motion of the collision objects */
+  tesseract_common::AlignedUnorderedMap<std::string, CollisionObject> objects_;
+
+  /** @brief Add the motion of a collision object added to the wrapped manager */
+  void addObject(const std::string& name);
+};
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_CONSERVATIVE_ADVANCEMENT_CONTINUOUS_MANAGER_H
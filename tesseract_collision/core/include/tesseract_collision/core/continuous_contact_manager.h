@@ -33,6 +33,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/link_transforms.h>
+#include <tesseract_common/memory_usage.h>
 #include <tesseract_collision/core/types.h>
 
 namespace tesseract_collision
@@ -91,6 +93,23 @@ public:
                                   const tesseract_common::VectorIsometry3d& shape_poses,
                                   bool enabled = true) = 0;
 
+  /**
+   * @brief Add several objects to the checker
+   * @details This is the same as calling addCollisionObject for each object, but implementations may construct the
+   * collision objects in parallel.
+   * @param names           The names of the objects, must be unique.
+   * @param mask_id         User defined id which gets stored in the results structure.
+   * @param shapes          The shapes that make up each collision object, ordered the same as names.
+   * @param shape_poses     The poses of the shapes of each collision object, ordered the same as names.
+   * @param enabled         Indicate if the objects are enabled for collision checking.
+   * @return true if all objects were successfully added, otherwise false.
+   */
+  virtual bool addCollisionObjects(const std::vector<std::string>& names,
+                                   const int& mask_id,
+                                   const std::vector<CollisionShapesConst>& shapes,
+                                   const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                   bool enabled = true);
+
   /**
    * @brief Get a collision objects collision geometries
    * @param name The collision objects name
@@ -139,6 +158,15 @@ public:
    */
   virtual bool isCollisionObjectEnabled(const std::string& name) const = 0;
 
+  /**
+   * @brief Get the world transform of a collision object, for cast(moving) objects it is the start transform
+   * @details Managers which do not track the transforms return false
+   * @param name The name of the object
+   * @param pose The world transform of the object
+   * @return True if the object exists and its transform is known, otherwise false
+   */
+  virtual bool getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const;
+
   /**
    * @brief Set a single static collision object's tansforms
    * @param name The name of the object
@@ -160,6 +188,13 @@ public:
    */
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) = 0;
 
+  /**
+   * @brief Set a series of static collision object's tranforms
+   * @details The transforms are stored contiguously in the order of their name table, so no map is walked
+   * @param transforms The link transforms, links that are not collision objects are ignored
+   */
+  virtual void setCollisionObjectsTransform(const tesseract_common::LinkTransforms& transforms);
+
   /**
    * @brief Set a single cast(moving) collision object's tansforms
    *
@@ -200,6 +235,33 @@ public:
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
                                             const tesseract_common::TransformMap& pose2) = 0;
 
+  /**
+   * @brief Set a series of cast(moving) collision object's tranforms
+   *
+   * This should only be used for moving objects. Use the base
+   * class methods for static objects. Throws std::runtime_error if the start and end transforms are not of the same
+   * links.
+   *
+   * @param pose1 The start link transforms
+   * @param pose2 The end link transforms
+   */
+  virtual void setCollisionObjectsTransform(const tesseract_common::LinkTransforms& pose1,
+                                            const tesseract_common::LinkTransforms& pose2);
+
+  /**
+   * @brief Update a collision object after the occupancy of some of the cells of one of its octrees changed
+   * @details The octree is shared with the collision geometry, so the delta must be applied to it before calling this,
+   * see applyOctreeDelta. Only the bounding boxes of the touched regions are refreshed, the collision object is not
+   * recreated. Managers sharing the octree, like clones, must each be updated with the same delta.
+   * @param name The name of the object
+   * @param shape_index The index of the octree in the collision object's geometries
+   * @param delta The cells whose occupancy changed
+   * @return true if the object has an octree at the shape index, otherwise false.
+   */
+  virtual bool updateCollisionObjectOctree(const std::string& name,
+                                           std::size_t shape_index,
+                                           const OctreeDelta& delta) = 0;
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -218,6 +280,51 @@ public:
    */
   virtual const std::vector<std::string>& getActiveCollisionObjects() const = 0;
 
+  /**
+   * @brief Change whether some collision objects can move, leaving the others unchanged
+   * @details This is used when an object is attached to or detached from a robot. The default calls
+   * setActiveCollisionObjects with the changed list, a manager can override it to only move these objects between its
+   * static and active sets.
+   * @param names The collision object names
+   * @param active True if the collision objects can move
+   */
+  virtual void setCollisionObjectsActive(const std::vector<std::string>& names, bool active);
+
+  /**
+   * @brief Add a named profile of active collision objects, replacing the profile with the same name
+   * @details A profile is typically the active links of a kinematic group, so a planner switching between groups does
+   * not provide the active links each time, see applyActiveCollisionObjectsProfile. The profiles are shared with the
+   * clones of the manager.
+   * @param name The name of the profile
+   * @param names The names of the active collision objects
+   */
+  void addActiveCollisionObjectsProfile(const std::string& name, std::vector<std::string> names);
+
+  /**
+   * @brief Remove a profile of active collision objects
+   * @param name The name of the profile
+   * @return False if the profile does not exist
+   */
+  bool removeActiveCollisionObjectsProfile(const std::string& name);
+
+  /** @brief Get the profiles of active collision objects */
+  std::shared_ptr<const ActiveCollisionObjectsProfiles> getActiveCollisionObjectsProfiles() const;
+
+  /**
+   * @brief Replace the profiles of active collision objects
+   * @param profiles The profiles, these are shared and not copied
+   */
+  void setActiveCollisionObjectsProfiles(std::shared_ptr<const ActiveCollisionObjectsProfiles> profiles);
+
+  /**
+   * @brief Make the collision objects of a profile the active collision objects
+   * @details Only the collision objects whose state changes are updated using setCollisionObjectsActive, so applying
+   * the profile which is already active does not update any collision object.
+   * @param name The name of the profile
+   * @return False if the profile does not exist, the active collision objects are unchanged
+   */
+  bool applyActiveCollisionObjectsProfile(const std::string& name);
+
   /**
    * @brief Set the contact distance thresholds for which collision should be considered on a per pair basis
    * @param collision_margin_data Contains the data that will replace the current settings
@@ -266,11 +373,72 @@ public:
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
 
+  /**
+   * @brief Perform a contact test for each segment of a sequence of poses of the cast(moving) collision objects
+   * @details Segment i moves from poses[i] to poses[i + 1], so the caller computes each pose once and it is used as the
+   * end of one segment and the start of the next. If the request type is ContactTestType::FIRST the sweep stops at the
+   * first segment in collision. Throws std::runtime_error if there are less than two poses or the poses are not of the
+   * same links.
+   * @param collisions The contact results of each segment, resized to the number of segments
+   * @param poses The link transforms of each pose, typically sharing one name table
+   * @param request The contact request of each segment
+   * @return The index of the first segment in collision, -1 if no segment is in collision
+   */
+  virtual long contactTestSweep(std::vector<ContactResultMap>& collisions,
+                                const std::vector<tesseract_common::LinkTransforms>& poses,
+                                const ContactRequest& request);
+
   /**
    * @brief Applies settings in the config
    * @param config Settings to be applies
    */
   virtual void applyContactManagerConfig(const ContactManagerConfig& config);
+
+  /**
+   * @brief Enable or disable collecting statistics during contact tests, see ContactManagerStatistics
+   * @details Managers which do not support collecting statistics ignore this. Clones do not collect statistics until
+   * enabled.
+   * @param enabled True to collect statistics, otherwise false
+   */
+  virtual void setStatisticsEnabled(bool enabled);
+
+  /** @brief Check if statistics are collected during contact tests */
+  virtual bool getStatisticsEnabled() const;
+
+  /** @brief Get the statistics collected since they were last cleared */
+  virtual ContactManagerStatistics getStatistics() const;
+
+  /** @brief Clear the collected statistics */
+  virtual void clearStatistics();
+
+  /**
+   * @brief Set the sizes of the memory pools the narrowphase data of object pairs is allocated from
+   * @details Managers which do not use memory pools ignore this. Clones use the same configuration.
+   * @param config The pool configuration
+   */
+  virtual void setPoolConfig(const ContactManagerPoolConfig& config);
+
+  /**
+   * @brief Get the configuration of the memory pools
+   * @return The pool configuration, empty if the manager does not use memory pools
+   */
+  virtual std::optional<ContactManagerPoolConfig> getPoolConfig() const;
+
+  /**
+   * @brief Get the memory used by the contact manager
+   * @details The report has a part for each collision object with its geometry. Managers building acceleration
+   * structures, like the shapes and bounding volume hierarchies of the geometry and the broadphase, add them. Storage
+   * shared with the scene graph or the clones of the manager is only counted by the first report passed the tracker.
+   * @param tracker Tracks the storage shared with other objects
+   * @return The memory used by the contact manager
+   */
+  virtual tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
+protected:
+  /** @brief The profiles of active collision objects, shared with the clones of the manager */
+  std::shared_ptr<const ActiveCollisionObjectsProfiles> active_profiles_{
+    std::make_shared<const ActiveCollisionObjectsProfiles>()
+  };
 };
 
 }  // namespace tesseract_collision
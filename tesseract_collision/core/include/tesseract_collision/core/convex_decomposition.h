@@ -26,10 +26,13 @@
 #ifndef TESSERACT_COLLISION_CONVEX_DECOMPOSITION_H
 #define TESSERACT_COLLISION_CONVEX_DECOMPOSITION_H
 
+#include <future>
 #include <vector>
 #include <memory>
+#include <tesseract_common/executor.h>
 #include <tesseract_common/types.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_geometry/impl/polygon_mesh.h>
 
 namespace tesseract_collision
 {
@@ -55,6 +58,35 @@ public:
    */
   virtual std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                                    const Eigen::VectorXi& faces) const = 0;
+
+  /**
+   * @brief Run convex decomposition algorithm asynchronously on an executor
+   * @details The decomposition must not be destroyed before the result is available
+   * @param vertices The vertices
+   * @param faces A vector of triangle indicies. Every face starts with the number of vertices followed the the vertice
+   * index
+   * @param executor The executor running the decomposition, nullptr uses the default executor
+   * @return The future result
+   */
+  std::future<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+  computeAsync(tesseract_common::VectorVector3d vertices,
+               Eigen::VectorXi faces,
+               const tesseract_common::Executor::Ptr& executor = nullptr) const;
+
+  /**
+   * @brief Run convex decomposition algorithm on several meshes in parallel
+   * @details If the decomposition of a mesh throws the remaining meshes are skipped and the exception is rethrown once
+   * the meshes which are already being decomposed are finished. A nullptr mesh throws a std::runtime_error before any
+   * mesh is decomposed.
+   * @param meshes The meshes
+   * @param threads The maximum number of meshes decomposed at the same time, zero uses the concurrency of the executor
+   * @param executor The executor decomposing the meshes, nullptr uses the default executor
+   * @return The convex meshes of each mesh in the order of the meshes
+   */
+  std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+  computeBatch(const std::vector<std::shared_ptr<const tesseract_geometry::PolygonMesh>>& meshes,
+               std::size_t threads = 0,
+               const tesseract_common::Executor::Ptr& executor = nullptr) const;
 };
 
 }  // namespace tesseract_collision
@@ -33,6 +33,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/link_transforms.h>
+#include <tesseract_common/memory_usage.h>
 #include <tesseract_collision/core/types.h>
 
 namespace tesseract_collision
@@ -84,6 +86,23 @@ public:
                                   const tesseract_common::VectorIsometry3d& shape_poses,
                                   bool enabled = true) = 0;
 
+  /**
+   * @brief Add several objects to the checker
+   * @details This is the same as calling addCollisionObject for each object, but implementations may construct the
+   * collision objects in parallel.
+   * @param names           The names of the objects, must be unique.
+   * @param mask_id         User defined id which gets stored in the results structure.
+   * @param shapes          The shapes that make up each collision object, ordered the same as names.
+   * @param shape_poses     The poses of the shapes of each collision object, ordered the same as names.
+   * @param enabled         Indicate if the objects are enabled for collision checking.
+   * @return true if all objects were successfully added, otherwise false.
+   */
+  virtual bool addCollisionObjects(const std::vector<std::string>& names,
+                                   const int& mask_id,
+                                   const std::vector<CollisionShapesConst>& shapes,
+                                   const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                   bool enabled = true);
+
   /**
    * @brief Get a collision objects collision geometries
    * @param name The collision objects name
@@ -132,6 +151,29 @@ public:
    */
   virtual bool isCollisionObjectEnabled(const std::string& name) const = 0;
 
+  /**
+   * @brief Get the handle of a collision object
+   * @details The handle is the index of the collision object in getCollisionObjects(). Handles of objects added after
+   * the removed object are shifted when an object is removed, so handles must be retrieved again after a removal.
+   * @param name The name of the object
+   * @return The handle of the object, -1 if it does not exist
+   */
+  virtual int getCollisionObjectHandle(const std::string& name) const;
+
+  /**
+   * @brief Enable an object
+   * @param handle The handle of the object
+   * @return true if the object exists, otherwise false.
+   */
+  virtual bool enableCollisionObject(int handle);
+
+  /**
+   * @brief Disable an object
+   * @param handle The handle of the object
+   * @return true if the object exists, otherwise false.
+   */
+  virtual bool disableCollisionObject(int handle);
+
   /**
    * @brief Set a single collision object's transforms
    * @param name The name of the object
@@ -139,6 +181,13 @@ public:
    */
   virtual void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) = 0;
 
+  /**
+   * @brief Set a single collision object's transforms
+   * @param handle The handle of the object provided by getCollisionObjectHandle
+   * @param pose The transformation in world
+   */
+  virtual void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose);
+
   /**
    * @brief Set a series of collision object's transforms
    * @param names The name of the object
@@ -153,6 +202,27 @@ public:
    */
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) = 0;
 
+  /**
+   * @brief Set a series of collision object's transforms
+   * @details The transforms are stored contiguously in the order of their name table, so no map is walked
+   * @param transforms The link transforms, links that are not collision objects are ignored
+   */
+  virtual void setCollisionObjectsTransform(const tesseract_common::LinkTransforms& transforms);
+
+  /**
+   * @brief Update a collision object after the occupancy of some of the cells of one of its octrees changed
+   * @details The octree is shared with the collision geometry, so the delta must be applied to it before calling this,
+   * see applyOctreeDelta. Only the bounding boxes of the touched regions are refreshed, the collision object is not
+   * recreated. Managers sharing the octree, like clones, must each be updated with the same delta.
+   * @param name The name of the object
+   * @param shape_index The index of the octree in the collision object's geometries
+   * @param delta The cells whose occupancy changed
+   * @return true if the object has an octree at the shape index, otherwise false.
+   */
+  virtual bool updateCollisionObjectOctree(const std::string& name,
+                                           std::size_t shape_index,
+                                           const OctreeDelta& delta) = 0;
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -171,6 +241,51 @@ public:
    */
   virtual const std::vector<std::string>& getActiveCollisionObjects() const = 0;
 
+  /**
+   * @brief Change whether some collision objects can move, leaving the others unchanged
+   * @details This is used when an object is attached to or detached from a robot. The default calls
+   * setActiveCollisionObjects with the changed list, a manager can override it to only move these objects between its
+   * static and active sets.
+   * @param names The collision object names
+   * @param active True if the collision objects can move
+   */
+  virtual void setCollisionObjectsActive(const std::vector<std::string>& names, bool active);
+
+  /**
+   * @brief Add a named profile of active collision objects, replacing the profile with the same name
+   * @details A profile is typically the active links of a kinematic group, so a planner switching between groups does
+   * not provide the active links each time, see applyActiveCollisionObjectsProfile. The profiles are shared with the
+   * clones of the manager.
+   * @param name The name of the profile
+   * @param names The names of the active collision objects
+   */
+  void addActiveCollisionObjectsProfile(const std::string& name, std::vector<std::string> names);
+
+  /**
+   * @brief Remove a profile of active collision objects
+   * @param name The name of the profile
+   * @return False if the profile does not exist
+   */
+  bool removeActiveCollisionObjectsProfile(const std::string& name);
+
+  /** @brief Get the profiles of active collision objects */
+  std::shared_ptr<const ActiveCollisionObjectsProfiles> getActiveCollisionObjectsProfiles() const;
+
+  /**
+   * @brief Replace the profiles of active collision objects
+   * @param profiles The profiles, these are shared and not copied
+   */
+  void setActiveCollisionObjectsProfiles(std::shared_ptr<const ActiveCollisionObjectsProfiles> profiles);
+
+  /**
+   * @brief Make the collision objects of a profile the active collision objects
+   * @details Only the collision objects whose state changes are updated using setCollisionObjectsActive, so applying
+   * the profile which is already active does not update any collision object.
+   * @param name The name of the profile
+   * @return False if the profile does not exist, the active collision objects are unchanged
+   */
+  bool applyActiveCollisionObjectsProfile(const std::string& name);
+
   /**
    * @brief Set the contact distance thresholds for which collision should be considered on a per pair basis
    * @param collision_margin_data Contains the data that will replace the current settings
@@ -219,11 +334,84 @@ public:
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
 
+  /**
+   * @brief Perform a contact test for a batch of states
+   * @details For each state the collision object transforms are applied and a contact test is performed. The
+   * transforms of the last state remain applied to the manager after the call. The result maps already stored in
+   * collisions are cleared and reused so their storage is not reallocated between calls.
+   * @param collisions The contact results data, resized to one entry per state
+   * @param transforms The collision object transforms <name, pose> for each state
+   * @param request The contact request data
+   */
+  virtual void batchContactTest(std::vector<ContactResultMap>& collisions,
+                                const std::vector<tesseract_common::TransformMap>& transforms,
+                                const ContactRequest& request);
+
+  /**
+   * @brief Perform a contact test for a batch of states
+   * @details This is the same as the transform map version but every state provides a pose for each of the provided
+   * names in the same order, which allows implementations to look up the collision objects once for the whole batch.
+   * @param collisions The contact results data, resized to one entry per state
+   * @param names The names of the collision objects to update for every state
+   * @param poses The collision object poses for each state, ordered the same as names
+   * @param request The contact request data
+   */
+  virtual void batchContactTest(std::vector<ContactResultMap>& collisions,
+                                const std::vector<std::string>& names,
+                                const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                                const ContactRequest& request);
+
   /**
    * @brief Applies settings in the config
    * @param config Settings to be applies
    */
   virtual void applyContactManagerConfig(const ContactManagerConfig& config);
+
+  /**
+   * @brief Enable or disable collecting statistics during contact tests, see ContactManagerStatistics
+   * @details Managers which do not support collecting statistics ignore this. Clones do not collect statistics until
+   * enabled.
+   * @param enabled True to collect statistics, otherwise false
+   */
+  virtual void setStatisticsEnabled(bool enabled);
+
+  /** @brief Check if statistics are collected during contact tests */
+  virtual bool getStatisticsEnabled() const;
+
+  /** @brief Get the statistics collected since they were last cleared */
+  virtual ContactManagerStatistics getStatistics() const;
+
+  /** @brief Clear the collected statistics */
+  virtual void clearStatistics();
+
+  /**
+   * @brief Set the sizes of the memory pools the narrowphase data of object pairs is allocated from
+   * @details Managers which do not use memory pools ignore this. Clones use the same configuration.
+   * @param config The pool configuration
+   */
+  virtual void setPoolConfig(const ContactManagerPoolConfig& config);
+
+  /**
+   * @brief Get the configuration of the memory pools
+   * @return The pool configuration, empty if the manager does not use memory pools
+   */
+  virtual std::optional<ContactManagerPoolConfig> getPoolConfig() const;
+
+  /**
+   * @brief Get the memory used by the contact manager
+   * @details The report has a part for each collision object with its geometry. Managers building acceleration
+   * structures, like the shapes and bounding volume hierarchies of the geometry and the broadphase, add them. Storage
+   * shared with the scene graph or the clones of the manager is only counted by the first report passed the tracker.
+   * @param tracker Tracks the storage shared with other objects
+   * @return The memory used by the contact manager
+   */
+  virtual tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
+protected:
+  /** @brief The profiles of active collision objects, shared with the clones of the manager */
+  std::shared_ptr<const ActiveCollisionObjectsProfiles> active_profiles_{
+    std::make_shared<const ActiveCollisionObjectsProfiles>()
+  };
 };
 
 }  // namespace tesseract_collision
@@ -0,0 +1,164 @@
+/**
+ * @file primitive_distance.h
+ * @brief Closed form distance and penetration of primitive shape pairs
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CORE_PRIMITIVE_DISTANCE_H
+#define TESSERACT_COLLISION_CORE_PRIMITIVE_DISTANCE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/geometry.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief The signed distance between two shapes and its witness points
+ * @details The nearest points satisfy nearest_points[1] - nearest_points[0] = distance * normal, so when the shapes
+ * penetrate the distance is negative and moving the second shape along the normal by the penetration depth separates
+ * them.
+ */
+struct PrimitiveDistanceResult
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief The signed distance, negative when the shapes penetrate */
+  double distance{ 0 };
+
+  /** @brief The nearest point on each shape in world coordinates */
+  std::array<Eigen::Vector3d, 2> nearest_points{ Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero() };
+
+  /** @brief The unit normal from the first shape to the second shape in world coordinates */
+  Eigen::Vector3d normal{ Eigen::Vector3d::UnitX() };
+};
+
+/**
+ * @brief Calculate the distance between two spheres
+ * @param result The distance, nearest points and normal
+ * @param radius1 The radius of the first sphere
+ * @param tf1 The world transform of the first sphere
+ * @param radius2 The radius of the second sphere
+ * @param tf2 The world transform of the second sphere
+ */
+void calcSphereSphereDistance(PrimitiveDistanceResult& result,
+                              double radius1,
+                              const Eigen::Isometry3d& tf1,
+                              double radius2,
+                              const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Calculate the distance between a sphere and a capsule
+ * @param result The distance, nearest points and normal
+ * @param radius1 The radius of the sphere
+ * @param tf1 The world transform of the sphere
+ * @param radius2 The radius of the capsule
+ * @param half_length2 The half length of the capsule segment, the segment is along the z axis
+ * @param tf2 The world transform of the capsule
+ */
+void calcSphereCapsuleDistance(PrimitiveDistanceResult& result,
+                               double radius1,
+                               const Eigen::Isometry3d& tf1,
+                               double radius2,
+                               double half_length2,
+                               const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Calculate the distance between two capsules
+ * @details When the capsule segments intersect the penetration is measured perpendicular to both segments
+ * @param result The distance, nearest points and normal
+ * @param radius1 The radius of the first capsule
+ * @param half_length1 The half length of the first capsule segment, the segment is along the z axis
+ * @param tf1 The world transform of the first capsule
+ * @param radius2 The radius of the second capsule
+ * @param half_length2 The half length of the second capsule segment, the segment is along the z axis
+ * @param tf2 The world transform of the second capsule
+ */
+void calcCapsuleCapsuleDistance(PrimitiveDistanceResult& result,
+                                double radius1,
+                                double half_length1,
+                                const Eigen::Isometry3d& tf1,
+                                double radius2,
+                                double half_length2,
+                                const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Calculate the distance between a sphere and a box
+ * @details When the sphere center is inside the box the penetration is measured to the nearest face of the box
+ * @param result The distance, nearest points and normal
+ * @param radius1 The radius of the sphere
+ * @param tf1 The world transform of the sphere
+ * @param half_extents2 The half extents of the box
+ * @param tf2 The world transform of the box
+ */
+void calcSphereBoxDistance(PrimitiveDistanceResult& result,
+                           double radius1,
+                           const Eigen::Isometry3d& tf1,
+                           const Eigen::Vector3d& half_extents2,
+                           const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Calculate the distance between two boxes
+ * @details Separated boxes are measured exactly from their vertices and edges. Penetrating boxes use the separating
+ * axis test, the penetration depth is the smallest overlap along the 15 candidate axes which is the exact translational
+ * penetration depth of two boxes.
+ * @param result The distance, nearest points and normal
+ * @param half_extents1 The half extents of the first box
+ * @param tf1 The world transform of the first box
+ * @param half_extents2 The half extents of the second box
+ * @param tf2 The world transform of the second box
+ */
+void calcBoxBoxDistance(PrimitiveDistanceResult& result,
+                        const Eigen::Vector3d& half_extents1,
+                        const Eigen::Isometry3d& tf1,
+                        const Eigen::Vector3d& half_extents2,
+                        const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Check if the distance between two geometry types has a closed form kernel
+ * @details The supported pairs are sphere-sphere, sphere-capsule, capsule-capsule, sphere-box and box-box in any order
+ */
+bool hasPrimitiveDistance(const tesseract_geometry::Geometry& shape1, const tesseract_geometry::Geometry& shape2);
+
+/**
+ * @brief Calculate the distance between two primitive shapes with a closed form kernel
+ * @param result The distance, nearest points and normal
+ * @param shape1 The first shape
+ * @param tf1 The world transform of the first shape
+ * @param shape2 The second shape
+ * @param tf2 The world transform of the second shape
+ * @return False if the pair is not supported, see hasPrimitiveDistance
+ */
+bool calcPrimitiveDistance(PrimitiveDistanceResult& result,
+                           const tesseract_geometry::Geometry& shape1,
+                           const Eigen::Isometry3d& tf1,
+                           const tesseract_geometry::Geometry& shape2,
+                           const Eigen::Isometry3d& tf2);
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_CORE_PRIMITIVE_DISTANCE_H
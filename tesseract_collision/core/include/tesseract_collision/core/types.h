@@ -34,8 +34,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <map>
 #include <array>
+#include <chrono>
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
+#include <optional>
+#include <boost/iterator/filter_iterator.hpp>
 #include <tesseract_geometry/geometries.h>
 #include <tesseract_common/types.h>
 #include <tesseract_common/collision_margin_data.h>
@@ -58,6 +62,23 @@ using PairsCollisionMarginData = tesseract_common::PairsCollisionMarginData;
  */
 using IsContactAllowedFn = std::function<bool(const std::string&, const std::string&)>;
 
+/**
+ * @brief An IsContactAllowedFn which queries the compiled allowed collision matrix stored at a location
+ * @details The compiled allowed collision matrix is immutable and replaced when the allowed collision matrix changes.
+ * Contact managers retrieve it using getCompiledAllowedCollisionMatrix, so anything derived from it like the pairs
+ * filtered from the broadphase stays valid until it is replaced.
+ */
+struct CompiledAllowedCollisionMatrixFn
+{
+  /** @brief The location of the compiled allowed collision matrix in use, it must outlive the function */
+  const tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr* acm{ nullptr };
+
+  bool operator()(const std::string& link_name1, const std::string& link_name2) const
+  {
+    return (*acm)->isCollisionAllowed(link_name1, link_name2);
+  }
+};
+
 enum class ContinuousCollisionType
 {
   CCType_None,
@@ -91,6 +112,8 @@ struct ContactResult
   std::array<int, 2> type_id{ 0, 0 };
   /** @brief The two links that are in contact */
   std::array<std::string, 2> link_names;
+  /** @brief The handles of the two links that are in contact, -1 if the contact manager does not provide handles */
+  std::array<int, 2> link_handles{ -1, -1 };
   /** @brief The two shapes that are in contact. Each link can be made up of multiple shapes */
   std::array<int, 2> shape_id{ -1, -1 };
   /** @brief Some shapes like octomap and mesh have subshape (boxes and triangles) */
@@ -132,7 +155,96 @@ struct ContactResult
 };
 
 using ContactResultVector = tesseract_common::AlignedVector<ContactResult>;
-using ContactResultMap = tesseract_common::AlignedMap<std::pair<std::string, std::string>, ContactResultVector>;
+
+/**
+ * @brief A map of contact results keyed by link pair which keeps its storage when cleared
+ * @details Calling clear() only clears the contact vectors, the pair entries and the capacity of their vectors are kept.
+ * Iteration, find, count, size and empty ignore pairs without contacts so a cleared map behaves like an empty map. When
+ * the same map is reused for repeated contact tests it reaches a steady state where storing contacts for previously
+ * seen pairs does not allocate. Use release() to free the storage and shrinkToFit() to remove the pairs without
+ * contacts.
+ */
+class ContactResultMap
+{
+public:
+  using KeyType = std::pair<std::string, std::string>;
+  using MappedType = ContactResultVector;
+  using ContainerType = tesseract_common::AlignedMap<KeyType, MappedType>;
+  using key_type = KeyType;
+  using mapped_type = MappedType;
+  using value_type = ContainerType::value_type;
+  using size_type = ContainerType::size_type;
+
+  /** @brief Predicate used to skip pairs without contacts */
+  struct HasContacts
+  {
+    bool operator()(const value_type& pair) const { return !pair.second.empty(); }
+  };
+
+  using iterator = boost::filter_iterator<HasContacts, ContainerType::iterator>;
+  using const_iterator = boost::filter_iterator<HasContacts, ContainerType::const_iterator>;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  /** @brief Check if there are no pairs with contacts */
+  bool empty() const;
+
+  /** @brief The number of pairs with contacts */
+  size_type size() const;
+
+  /** @brief The number of contacts for all pairs */
+  long numContacts() const;
+
+  /**
+   * @brief Find the contacts for a pair
+   * @return An iterator to the pair, end() if the pair has no contacts
+   */
+  iterator find(const KeyType& key);
+  const_iterator find(const KeyType& key) const;
+
+  /** @brief Returns 1 if the pair has contacts, otherwise 0 */
+  size_type count(const KeyType& key) const;
+
+  /**
+   * @brief Get the contacts for a pair
+   * @throws std::out_of_range if the pair has no contacts
+   */
+  MappedType& at(const KeyType& key);
+  const MappedType& at(const KeyType& key) const;
+
+  /**
+   * @brief Get the contacts for a pair, an entry is added if it does not exist
+   * @note Unlike find this also provides access to the storage of pairs without contacts
+   */
+  MappedType& operator[](const KeyType& key);
+
+  /**
+   * @brief Insert the contacts for a pair if the pair has no contacts
+   * @details If the pair exists without contacts its storage is reused
+   * @return An iterator to the pair and true if the contacts were inserted
+   */
+  std::pair<iterator, bool> insert(const value_type& value);
+
+  /** @brief Clear the contacts of all pairs, keeping the storage for reuse */
+  void clear();
+
+  /** @brief Remove the pairs without contacts */
+  void shrinkToFit();
+
+  /** @brief Remove all pairs freeing the storage */
+  void release();
+
+  /** @brief Get the underlying container, this includes the pairs without contacts */
+  const ContainerType& getContainer() const;
+
+private:
+  ContainerType data_;
+};
 
 /**
  * @brief Should return true if contact results are valid, otherwise false.
@@ -141,6 +253,27 @@ using ContactResultMap = tesseract_common::AlignedMap<std::pair<std::string, std
  */
 using IsContactResultValidFn = std::function<bool(const ContactResult&)>;
 
+/**
+ * @brief Controls which contact result data is populated by the contact managers
+ *
+ * FULL - All contact result data is populated
+ * DISTANCE - Only the link names, link handles, type ids, shape ids, subshape ids, distance and normal are populated
+ * BINARY - Only the link names, link handles, type ids, shape ids, subshape ids and distance are populated
+ *
+ * @note DISTANCE and BINARY do not calculate the continuous contact data (cc_time, cc_type and cc_transform). Use
+ * DISTANCE with ContactTestType::CLOSEST to get the minimum distance per pair, and BINARY with ContactTestType::FIRST
+ * for a boolean collision query.
+ */
+enum class ContactResultDetail
+{
+  /** @brief All contact result data is populated */
+  FULL,
+  /** @brief Only the data identifying the pair along with the distance and normal is populated */
+  DISTANCE,
+  /** @brief Only the data identifying the pair along with the distance is populated */
+  BINARY
+};
+
 /** @brief The ContactRequest struct */
 struct ContactRequest
 {
@@ -153,13 +286,18 @@ struct ContactRequest
   /** @brief This enables the calculation of distance data if two objects are within the contact threshold */
   bool calculate_distance = true;
 
-  /** @brief This is used if the ContactTestType is set to LIMITED, where the test will exit when number of contacts
-   * reach this limit */
+  /**
+   * @brief The contact test exits when the number of contacts in the results reaches this limit, zero for no limit
+   * @details The managers stop traversing the remaining pairs once the limit is reached
+   */
   long contact_limit = 0;
 
   /** @brief This provides a user defined function approve/reject contact results */
   IsContactResultValidFn is_valid = nullptr;
 
+  /** @brief This controls which contact result data is populated, reducing it removes the per contact cost */
+  ContactResultDetail detail = ContactResultDetail::FULL;
+
   ContactRequest(ContactTestType type = ContactTestType::ALL);
 };
 
@@ -167,6 +305,82 @@ std::size_t flattenMoveResults(ContactResultMap&& m, ContactResultVector& v);
 
 std::size_t flattenCopyResults(const ContactResultMap& m, ContactResultVector& v);
 
+/**
+ * @brief Statistics collected by a contact manager during its contact tests
+ * @details Collecting statistics is disabled by default and is enabled through the contact manager or the
+ * ContactManagerConfig. The counts and times accumulate over all contact tests until they are cleared.
+ */
+struct ContactManagerStatistics
+{
+  /** @brief A pair of geometry types, the smaller type is first */
+  using GeometryTypePair = std::pair<tesseract_geometry::GeometryType, tesseract_geometry::GeometryType>;
+
+  /** @brief The number of contact tests */
+  std::size_t contact_tests{ 0 };
+
+  /** @brief The number of object pairs with overlapping bounding boxes found by the broadphase */
+  std::size_t broadphase_pairs{ 0 };
+
+  /** @brief The number of broadphase pairs not checked because they are disabled or allowed to be in contact */
+  std::size_t rejected_pairs{ 0 };
+
+  /** @brief The number of narrowphase checks */
+  std::size_t narrowphase_calls{ 0 };
+
+  /**
+   * @brief The number of narrowphase checks by the geometry types checked
+   * @details Managers which check all shapes of an object together report objects with multiple shapes as
+   * UNINITIALIZED
+   */
+  std::map<GeometryTypePair, std::size_t> narrowphase_calls_by_geometry_type;
+
+  /** @brief The number of GJK queries, only counted by managers using the tesseract GJK implementation */
+  std::size_t gjk_calls{ 0 };
+
+  /** @brief The total number of GJK iterations */
+  std::size_t gjk_iterations{ 0 };
+
+  /** @brief The number of EPA penetration depth queries */
+  std::size_t epa_calls{ 0 };
+
+  /** @brief The total time spent in contact tests */
+  std::chrono::nanoseconds contact_test_time{ 0 };
+
+  /** @brief The time spent in the narrowphase */
+  std::chrono::nanoseconds narrowphase_time{ 0 };
+
+  /** @brief The time spent in contact tests outside the narrowphase, which is the broadphase and filtering */
+  std::chrono::nanoseconds getBroadphaseTime() const;
+
+  /** @brief Count a narrowphase check between two geometry types */
+  void addNarrowphaseCall(tesseract_geometry::GeometryType type1, tesseract_geometry::GeometryType type2);
+
+  /** @brief Reset all counts and times to zero */
+  void clear();
+};
+
+/**
+ * @brief Adds the time spent in its scope to a statistics time
+ * @details Constructed with a nullptr it does nothing, so it may be used unconditionally when statistics are disabled
+ */
+class ContactManagerStatisticsTimer
+{
+public:
+  explicit ContactManagerStatisticsTimer(std::chrono::nanoseconds* time);
+  ~ContactManagerStatisticsTimer();
+  ContactManagerStatisticsTimer(const ContactManagerStatisticsTimer&) = delete;
+  ContactManagerStatisticsTimer& operator=(const ContactManagerStatisticsTimer&) = delete;
+  ContactManagerStatisticsTimer(ContactManagerStatisticsTimer&&) = delete;
+  ContactManagerStatisticsTimer& operator=(ContactManagerStatisticsTimer&&) = delete;
+
+private:
+  /** @brief The time to add to, nullptr if disabled */
+  std::chrono::nanoseconds* time_;
+
+  /** @brief The start of the scope */
+  std::chrono::steady_clock::time_point start_;
+};
+
 /**
  * @brief This data is intended only to be used internal to the collision checkers as a container and should not
  *        be externally used by other libraries or packages.
@@ -199,6 +413,9 @@ struct ContactTestData
 
   /** @brief Indicate if search is finished */
   bool done = false;
+
+  /** @brief The statistics collected during the contact test, nullptr if collecting statistics is disabled */
+  ContactManagerStatistics* statistics = nullptr;
 };
 
 /**
@@ -237,6 +454,33 @@ enum class ACMOverrideType
   OR,
 };
 
+/**
+ * @brief The sizes of the memory pools a contact manager allocates the narrowphase data of object pairs from
+ * @details The pools hold the collision algorithms and contact manifolds created for pairs of collision objects. Each
+ * pool is sized for the number of collision objects of the manager and limited to the minimum and maximum size. When a
+ * pool is exhausted the elements are allocated from the heap.
+ */
+struct ContactManagerPoolConfig
+{
+  /** @brief The number of collision algorithms per collision object */
+  int collision_algorithms_per_object{ 32 };
+  /** @brief The number of persistent manifolds per collision object */
+  int persistent_manifolds_per_object{ 8 };
+  /** @brief The minimum number of elements of a pool */
+  int min_size{ 128 };
+  /** @brief The maximum number of elements of a pool */
+  int max_size{ 65536 };
+
+  /** @brief Get the number of collision algorithms of the pool for a number of collision objects */
+  int getCollisionAlgorithmPoolSize(std::size_t object_count) const;
+
+  /** @brief Get the number of persistent manifolds of the pool for a number of collision objects */
+  int getPersistentManifoldPoolSize(std::size_t object_count) const;
+
+  bool operator==(const ContactManagerPoolConfig& rhs) const;
+  bool operator!=(const ContactManagerPoolConfig& rhs) const;
+};
+
 /**
  * @brief Contains parameters used to configure a contact manager before a series of contact checks.
  *
@@ -264,6 +508,61 @@ struct ContactManagerConfig
   /** @brief Each key is an object name. Objects will be enabled/disabled based on the value. Objects that aren't in the
    * map are unmodified from the defaults*/
   std::unordered_map<std::string, bool> modify_object_enabled;
+
+  /**
+   * @brief If true the contact manager starts collecting statistics, see ContactManagerStatistics
+   * @details If false the current setting of the contact manager is unmodified
+   */
+  bool enable_statistics{ false };
+
+  /**
+   * @brief If set the contact manager sizes its memory pools with it, see ContactManagerPoolConfig
+   * @details If not set the current setting of the contact manager is unmodified
+   */
+  std::optional<ContactManagerPoolConfig> pool_config;
+};
+
+/**
+ * @brief A named set of active collision objects, typically the active links of a kinematic group
+ * @details The names are kept in a set as well, so a contact manager switching to the profile only finds which
+ * collision objects change and does not update the others.
+ */
+struct ActiveCollisionObjectsProfile
+{
+  using ConstPtr = std::shared_ptr<const ActiveCollisionObjectsProfile>;
+
+  ActiveCollisionObjectsProfile() = default;
+  ActiveCollisionObjectsProfile(std::vector<std::string> names);
+
+  /** @brief The names of the active collision objects */
+  std::vector<std::string> names;
+
+  /** @brief The same names for lookup */
+  std::unordered_set<std::string> name_set;
+};
+
+/** @brief The active collision object profiles by name */
+using ActiveCollisionObjectsProfiles = std::map<std::string, ActiveCollisionObjectsProfile::ConstPtr>;
+
+/**
+ * @brief The cells of an octree whose occupancy changed
+ * @details The keys are at the maximum depth of the octree. The changes are applied to the octree using
+ * applyOctreeDelta and the same delta is provided to the contact managers so they only need to refresh the bounding
+ * boxes of the touched regions.
+ */
+struct OctreeDelta
+{
+  /** @brief The keys of the cells which became occupied */
+  std::vector<octomap::OcTreeKey> occupied;
+
+  /** @brief The keys of the cells which became free */
+  std::vector<octomap::OcTreeKey> free;
+
+  /** @brief Check if the delta does not contain any changes */
+  bool empty() const;
+
+  /** @brief Remove all changes */
+  void clear();
 };
 
 /**
@@ -287,6 +586,28 @@ struct CollisionCheckConfig
   CollisionEvaluatorType type{ CollisionEvaluatorType::DISCRETE };
   /** @brief Longest valid segment to use if type supports lvs. Default: 0.005*/
   double longest_valid_segment_length{ 0.005 };
+  /**
+   * @brief Skip the lvs sub states which can not be in contact given the clearance of the last checked sub state.
+   * @details Only used by LVS_DISCRETE when the trajectory is checked with a joint group, which provides the bound on
+   * the motion of the links. The results are identical to checking every sub state. Default: false
+   */
+  bool adaptive_longest_valid_segment{ false };
+  /**
+   * @brief Check the states, including the lvs sub states, in bisection order when the contact test type is FIRST.
+   * @details The middle state is checked first, followed by the quarter states and so on, so collisions in the middle
+   * of the trajectory are found sooner. The reported collision is the first one found, which is not necessarily the
+   * earliest along the trajectory. Only used by the serial discrete checks and takes precedence over the adaptive lvs.
+   * Default: false
+   */
+  bool bisection_order{ false };
+  /**
+   * @brief Cull the trajectory segments with a coarse swept volume pass before the continuous checks.
+   * @details The boxes swept by the links are intersected with the boxes of the other objects and only the object
+   * pairs which may be in contact during a segment are passed to the narrow phase. Only used by the continuous checks
+   * when the trajectory is checked with a joint group, which provides the bound on the motion of the links.
+   * Default: false
+   */
+  bool swept_volume_broadphase{ false };
 };
 }  // namespace tesseract_collision
 
@@ -27,6 +27,10 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
@@ -81,6 +85,127 @@ inline void applyModifyObjectEnabled(ManagerType& manager,
       manager.disableCollisionObject(entry.first);
   }
 }
+
+/**
+ * @brief Undoes the contact manager config applied to a manager when it is destroyed, so the manager can be reused
+ * @details The settings changed by applyContactManagerConfig are recorded when the guard is created, so it must be
+ * created before the config is applied.
+ */
+template <typename ManagerType>
+class ContactManagerConfigGuard
+{
+public:
+  /**
+   * @param manager The manager the config is applied to, its current settings are restored
+   * @param config The config applied to the manager
+   */
+  ContactManagerConfigGuard(ManagerType& manager, const ContactManagerConfig& config)
+    : manager_(manager)
+    , restore_margin_data_(config.margin_data_override_type != CollisionMarginOverrideType::NONE)
+    , restore_statistics_(config.enable_statistics)
+    , margin_data_(manager.getCollisionMarginData())
+    , fn_(manager.getIsContactAllowedFn())
+    , statistics_enabled_(manager.getStatisticsEnabled())
+  {
+    for (const auto& entry : config.modify_object_enabled)
+    {
+      if (manager_.hasCollisionObject(entry.first))
+        enabled_.emplace_back(entry.first, manager_.isCollisionObjectEnabled(entry.first));
+    }
+  }
+  ~ContactManagerConfigGuard() { restore(); }
+  ContactManagerConfigGuard(const ContactManagerConfigGuard&) = delete;
+  ContactManagerConfigGuard& operator=(const ContactManagerConfigGuard&) = delete;
+  ContactManagerConfigGuard(ContactManagerConfigGuard&&) = delete;
+  ContactManagerConfigGuard& operator=(ContactManagerConfigGuard&&) = delete;
+
+  /** @brief Restore the settings of the manager, the config may be applied again afterwards */
+  void restore()
+  {
+    if (restore_margin_data_)
+      manager_.setCollisionMarginData(margin_data_);
+
+    manager_.setIsContactAllowedFn(fn_);
+    if (restore_statistics_)
+      manager_.setStatisticsEnabled(statistics_enabled_);
+
+    for (const auto& entry : enabled_)
+    {
+      if (entry.second)
+        manager_.enableCollisionObject(entry.first);
+      else
+        manager_.disableCollisionObject(entry.first);
+    }
+  }
+
+private:
+  ManagerType& manager_;
+  bool restore_margin_data_;
+  bool restore_statistics_;
+  CollisionMarginData margin_data_;
+  IsContactAllowedFn fn_;
+  bool statistics_enabled_;
+  std::vector<std::pair<std::string, bool>> enabled_;
+};
+
+/**
+ * @brief Change the active collision objects of a manager, only updating the collision objects which change
+ * @details The changed collision objects are updated using setCollisionObjectsActive. Once a large part of the
+ * collision objects changed they are all updated using setActiveCollisionObjects instead.
+ * @param manager Manager that will be modified
+ * @param names The names of the active collision objects
+ * @param name_set The same names for lookup
+ */
+template <typename ManagerType>
+inline void updateActiveCollisionObjects(ManagerType& manager,
+                                         const std::vector<std::string>& names,
+                                         const std::unordered_set<std::string>& name_set)
+{
+  const std::vector<std::string>& current = manager.getActiveCollisionObjects();
+  if (current == names)
+    return;
+
+  std::vector<std::string> deactivated;
+  for (const auto& name : current)
+  {
+    if (name_set.find(name) == name_set.end())
+      deactivated.push_back(name);
+  }
+
+  std::vector<std::string> activated;
+  const std::unordered_set<std::string> current_set(current.begin(), current.end());
+  for (const auto& name : names)
+  {
+    if (current_set.find(name) == current_set.end())
+      activated.push_back(name);
+  }
+
+  if (activated.empty() && deactivated.empty())
+    return;
+
+  if (2 * (activated.size() + deactivated.size()) > manager.getCollisionObjects().size())
+  {
+    manager.setActiveCollisionObjects(names);
+    return;
+  }
+
+  if (!deactivated.empty())
+    manager.setCollisionObjectsActive(deactivated, false);
+
+  if (!activated.empty())
+    manager.setCollisionObjectsActive(activated, true);
+}
+
+/**
+ * @brief Change the active collision objects of a manager, only updating the collision objects which change
+ * @param manager Manager that will be modified
+ * @param names The names of the active collision objects
+ */
+template <typename ManagerType>
+inline void updateActiveCollisionObjects(ManagerType& manager, const std::vector<std::string>& names)
+{
+  updateActiveCollisionObjects(manager, names, std::unordered_set<std::string>(names.begin(), names.end()));
+}
 }  // namespace tesseract_collision
 
 #endif  // TESSERACT_COLLISION_TYPES_H
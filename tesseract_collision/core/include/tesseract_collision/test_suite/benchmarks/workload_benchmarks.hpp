@@ -0,0 +1,457 @@
+#ifndef TESSERACT_COLLISION_WORKLOAD_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_WORKLOAD_BENCHMARKS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <octomap/octomap.h>
+#include <tesseract_geometry/mesh_parser.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief Load the meshes of a file as convex hulls */
+inline CollisionShapesConst loadConvexMeshes(const std::string& path)
+{
+  CollisionShapesConst shapes;
+  for (const auto& mesh :
+       tesseract_geometry::createMeshFromPath<tesseract_geometry::Mesh>(path, Eigen::Vector3d(1, 1, 1), true))
+    shapes.push_back(makeConvexMesh(*mesh));
+
+  return shapes;
+}
+
+/** @brief Load the detailed sphere mesh */
+inline CollisionShapePtr loadSphereMesh()
+{
+  auto mesh_vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto mesh_faces = std::make_shared<Eigen::VectorXi>();
+  loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *mesh_vertices, *mesh_faces, true);
+  return std::make_shared<tesseract_geometry::Mesh>(mesh_vertices, mesh_faces);
+}
+
+/**
+ * @brief Add the collision links of the iiwa7 as convex hulls stacked along the z axis
+ * @return The names of the links
+ */
+template <typename ManagerType>
+inline std::vector<std::string> addRobot(ManagerType& checker, const Eigen::Isometry3d& base_pose)
+{
+  std::vector<std::string> link_names;
+  for (int i = 0; i < 8; ++i)
+  {
+    std::string path =
+        std::string(TESSERACT_SUPPORT_DIR) + "/meshes/iiwa7/collision/link_" + std::to_string(i) + ".stl";
+    CollisionShapesConst shapes = loadConvexMeshes(path);
+    Eigen::Isometry3d pose = base_pose;
+    pose.translate(Eigen::Vector3d(0, 0, 0.15 * static_cast<double>(i)));
+    tesseract_common::VectorIsometry3d poses(shapes.size(), pose);
+
+    link_names.push_back("robot_link_" + std::to_string(i));
+    checker.addCollisionObject(link_names.back(), 0, shapes, poses);
+  }
+
+  return link_names;
+}
+
+/** @brief Add the convex decomposition of the car as a single link */
+template <typename ManagerType>
+inline void addConvexDecomposition(ManagerType& checker, const std::string& name, const Eigen::Isometry3d& pose)
+{
+  CollisionShapesConst shapes;
+  for (int i = 1; i <= 34; ++i)
+  {
+    std::string path =
+        std::string(TESSERACT_SUPPORT_DIR) + "/meshes/car_seat/collision/car_" + std::to_string(i) + ".stl";
+    CollisionShapesConst pieces = loadConvexMeshes(path);
+    shapes.insert(shapes.end(), pieces.begin(), pieces.end());
+  }
+
+  tesseract_common::VectorIsometry3d poses(shapes.size(), pose);
+  checker.addCollisionObject(name, 0, shapes, poses);
+}
+}  // namespace detail
+
+/** @brief Benchmark that checks the contactTest function in continuous contact managers with a link sweeping past a
+ * static link */
+static void BM_CAST_CONTACT_TEST(benchmark::State& state,
+                                 ContinuousContactManager::Ptr checker,  // NOLINT
+                                 tesseract_geometry::GeometryType type,
+                                 ContactTestType test_type)
+{
+  CollisionShapePtr shape;
+  switch (type)
+  {
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+      shape = makeConvexMesh(*std::static_pointer_cast<tesseract_geometry::Mesh>(detail::loadSphereMesh()));
+      break;
+    case tesseract_geometry::GeometryType::SPHERE:
+      shape = std::make_shared<tesseract_geometry::Sphere>(0.25);
+      break;
+    case tesseract_geometry::GeometryType::BOX:
+      shape = std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5);
+      break;
+    default:
+      throw(std::runtime_error("Invalid geometry type"));
+      break;
+  }
+
+  CollisionShapesConst shapes{ shape };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  checker->addCollisionObject("moving_link", 0, shapes, poses);
+  checker->addCollisionObject("static_link", 0, shapes, poses);
+
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = Eigen::Vector3d(-2, 0, 0.1);
+  end_pose.translation() = Eigen::Vector3d(2, 0, 0.1);
+
+  checker->setActiveCollisionObjects({ "moving_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.1));
+  checker->setCollisionObjectsTransform("moving_link", start_pose, end_pose);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    checker->contactTest(result, ContactRequest(test_type));
+  }
+}
+
+/** @brief Benchmark that checks the clone method in continuous contact managers */
+static void BM_CAST_CLONE(benchmark::State& state,
+                          ContinuousContactManager::Ptr checker,  // NOLINT
+                          std::size_t num_obj)
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  std::vector<std::string> active_obj;
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    active_obj.push_back("geom_" + std::to_string(ind));
+    checker->addCollisionObject(active_obj.back(), 0, shapes, poses);
+  }
+  checker->setActiveCollisionObjects(active_obj);
+  checker->setCollisionMarginData(CollisionMarginData(0.5));
+
+  ContinuousContactManager::Ptr clone;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(clone = checker->clone());
+  }
+}
+
+/** @brief Benchmark that checks the contactTest function in discrete contact managers between two detailed meshes */
+static void BM_MESH_MESH_CONTACT_TEST(benchmark::State& state,
+                                      DiscreteContactManager::Ptr checker,  // NOLINT
+                                      ContactTestType test_type)
+{
+  CollisionShapesConst shapes{ detail::loadSphereMesh() };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  checker->addCollisionObject("mesh_link_1", 0, shapes, poses);
+  checker->addCollisionObject("mesh_link_2", 0, shapes, poses);
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.4, 0, 0);
+
+  checker->setActiveCollisionObjects({ "mesh_link_1", "mesh_link_2" });
+  checker->setCollisionMarginData(CollisionMarginData(0.1));
+  checker->setCollisionObjectsTransform("mesh_link_2", pose);
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    checker->contactTest(result, ContactRequest(test_type));
+  }
+}
+
+/** @brief Benchmark that checks the contactTest function in discrete contact managers between an octree and a robot
+ * made from convex hulls */
+static void BM_OCTREE_ROBOT_CONTACT_TEST(benchmark::State& state,
+                                         DiscreteContactManager::Ptr checker,  // NOLINT
+                                         tesseract_geometry::Octree::SubType sub_type,
+                                         ContactTestType test_type)
+{
+  auto ot = std::make_shared<octomap::OcTree>(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/blender_monkey.bt");
+  CollisionShapesConst octree_shapes{ std::make_shared<tesseract_geometry::Octree>(ot, sub_type) };
+  tesseract_common::VectorIsometry3d octree_poses{ Eigen::Isometry3d::Identity() };
+  checker->addCollisionObject("octomap_link", 0, octree_shapes, octree_poses);
+
+  Eigen::Isometry3d base_pose = Eigen::Isometry3d::Identity();
+  base_pose.translation() = Eigen::Vector3d(0, 0, -0.5);
+  std::vector<std::string> link_names = detail::addRobot(*checker, base_pose);
+
+  checker->setActiveCollisionObjects(link_names);
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setIsContactAllowedFn([](const std::string& link_name1, const std::string& link_name2) {
+    return (link_name1 != "octomap_link" && link_name2 != "octomap_link");
+  });
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    checker->contactTest(result, ContactRequest(test_type));
+  }
+}
+
+/** @brief Benchmark that checks the contactTest function in discrete contact managers between a robot made from convex
+ * hulls and an object made from a convex decomposition */
+static void BM_CONVEX_DECOMPOSITION_CONTACT_TEST(benchmark::State& state,
+                                                 DiscreteContactManager::Ptr checker,  // NOLINT
+                                                 ContactTestType test_type)
+{
+  std::vector<std::string> link_names = detail::addRobot(*checker, Eigen::Isometry3d::Identity());
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.2, 0, 0.3);
+  detail::addConvexDecomposition(*checker, "decomposition_link", pose);
+
+  checker->setActiveCollisionObjects(link_names);
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setIsContactAllowedFn([](const std::string& link_name1, const std::string& link_name2) {
+    return (link_name1 != "decomposition_link" && link_name2 != "decomposition_link");
+  });
+
+  ContactResultMap result;
+  for (auto _ : state)  // NOLINT
+  {
+    result.clear();
+    checker->contactTest(result, ContactRequest(test_type));
+  }
+}
+
+/** @brief Benchmark that checks the clone method in discrete contact managers containing a robot made from convex hulls
+ * and an object made from a convex decomposition */
+static void BM_CONVEX_DECOMPOSITION_CLONE(benchmark::State& state, DiscreteContactManager::Ptr checker)  // NOLINT
+{
+  std::vector<std::string> link_names = detail::addRobot(*checker, Eigen::Isometry3d::Identity());
+  detail::addConvexDecomposition(*checker, "decomposition_link", Eigen::Isometry3d::Identity());
+  checker->setActiveCollisionObjects(link_names);
+
+  DiscreteContactManager::Ptr clone;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(clone = checker->clone());
+  }
+}
+
+/** @brief Benchmark that checks the setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+ * method in discrete contact managers. Moves all active links like a robot state update*/
+static void BM_SET_COLLISION_OBJECTS_TRANSFORM_ALL(benchmark::State& state,
+                                                   DiscreteContactManager::Ptr checker,  // NOLINT
+                                                   std::size_t num_obj)
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  tesseract_common::TransformMap transforms;
+  for (std::size_t ind = 0; ind < num_obj; ind++)
+  {
+    std::string name = "geom_" + std::to_string(ind);
+    checker->addCollisionObject(name, 0, shapes, poses);
+    transforms[name] = Eigen::Isometry3d::Identity();
+  }
+  checker->setActiveCollisionObjects(checker->getCollisionObjects());
+  checker->setCollisionMarginData(CollisionMarginData(0.5));
+
+  double offset{ 0 };
+  for (auto _ : state)  // NOLINT
+  {
+    offset = (offset > 1) ? 0 : offset + 0.01;
+    for (auto& transform : transforms)
+      transform.second.translation().x() = offset;
+
+    checker->setCollisionObjectsTransform(transforms);
+  }
+}
+
+/** @brief Benchmark that checks the batchContactTest method in discrete contact managers with a robot made from convex
+ * hulls moving through a number of states */
+static void BM_BATCH_CONTACT_TEST(benchmark::State& state,
+                                  DiscreteContactManager::Ptr checker,  // NOLINT
+                                  std::size_t num_states)
+{
+  std::vector<std::string> link_names = detail::addRobot(*checker, Eigen::Isometry3d::Identity());
+  detail::addConvexDecomposition(*checker, "decomposition_link", Eigen::Isometry3d::Identity());
+  checker->setActiveCollisionObjects(link_names);
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setIsContactAllowedFn([](const std::string& link_name1, const std::string& link_name2) {
+    return (link_name1 != "decomposition_link" && link_name2 != "decomposition_link");
+  });
+
+  std::vector<tesseract_common::TransformMap> transforms(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    for (std::size_t j = 0; j < link_names.size(); ++j)
+    {
+      Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+      pose.translation() = Eigen::Vector3d(1.0 - (2.0 * static_cast<double>(i) / static_cast<double>(num_states)),
+                                           0,
+                                           0.15 * static_cast<double>(j));
+      transforms[i][link_names[j]] = pose;
+    }
+  }
+
+  std::vector<ContactResultMap> results;
+  for (auto _ : state)  // NOLINT
+  {
+    checker->batchContactTest(results, transforms, ContactRequest(ContactTestType::FIRST));
+  }
+}
+
+/**
+ * @brief Register the continuous, mesh, octree, convex decomposition, clone and batched benchmarks for a pair of
+ * contact managers
+ * @param checker The discrete contact manager
+ * @param cast_checker The continuous contact manager, the continuous benchmarks are skipped if nullptr
+ */
+inline void registerWorkloadBenchmarks(const DiscreteContactManager::ConstPtr& checker,
+                                       const ContinuousContactManager::ConstPtr& cast_checker)
+{
+  const std::vector<ContactTestType> test_types = { ContactTestType::ALL,
+                                                    ContactTestType::FIRST,
+                                                    ContactTestType::CLOSEST };
+
+  //////////////////////////////////////
+  // Continuous contactTest and clone
+  //////////////////////////////////////
+  if (cast_checker != nullptr)
+  {
+    std::function<void(
+        benchmark::State&, ContinuousContactManager::Ptr, tesseract_geometry::GeometryType, ContactTestType)>
+        BM_CAST_CONTACT_TEST_FUNC = BM_CAST_CONTACT_TEST;
+    const std::vector<tesseract_geometry::GeometryType> geometry_types = {
+      tesseract_geometry::GeometryType::BOX,
+      tesseract_geometry::GeometryType::SPHERE,
+      tesseract_geometry::GeometryType::CONVEX_MESH
+    };
+    for (const auto& test_type : test_types)
+    {
+      for (const auto& type : geometry_types)
+      {
+        std::string name = "BM_CAST_CONTACT_TEST_" + cast_checker->getName() + "_" +
+                           ContactTestTypeStrings[static_cast<std::size_t>(test_type)] + "_" +
+                           tesseract_geometry::GeometryTypeStrings[type];
+        ContinuousContactManager::Ptr clone = cast_checker->clone();
+        benchmark::RegisterBenchmark(name.c_str(), BM_CAST_CONTACT_TEST_FUNC, clone, type, test_type)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, std::size_t)> BM_CAST_CLONE_FUNC =
+        BM_CAST_CLONE;
+    const std::vector<std::size_t> num_links = { 2, 8, 32, 128, 512 };
+    for (const auto& num_link : num_links)
+    {
+      std::string name = "BM_CAST_CLONE_" + cast_checker->getName() + "_ACTIVE_OBJ_" + std::to_string(num_link);
+      ContinuousContactManager::Ptr clone = cast_checker->clone();
+      benchmark::RegisterBenchmark(name.c_str(), BM_CAST_CLONE_FUNC, clone, num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Mesh, octree and convex decomposition contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, ContactTestType)>
+        BM_MESH_MESH_CONTACT_TEST_FUNC = BM_MESH_MESH_CONTACT_TEST;
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, ContactTestType)>
+        BM_CONVEX_DECOMPOSITION_CONTACT_TEST_FUNC = BM_CONVEX_DECOMPOSITION_CONTACT_TEST;
+    std::function<void(
+        benchmark::State&, DiscreteContactManager::Ptr, tesseract_geometry::Octree::SubType, ContactTestType)>
+        BM_OCTREE_ROBOT_CONTACT_TEST_FUNC = BM_OCTREE_ROBOT_CONTACT_TEST;
+
+    for (const auto& test_type : test_types)
+    {
+      const std::string type_name = ContactTestTypeStrings[static_cast<std::size_t>(test_type)];
+
+      DiscreteContactManager::Ptr clone = checker->clone();
+      std::string name = "BM_MESH_MESH_CONTACT_TEST_" + checker->getName() + "_" + type_name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_MESH_MESH_CONTACT_TEST_FUNC, clone, test_type)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      clone = checker->clone();
+      name = "BM_CONVEX_DECOMPOSITION_CONTACT_TEST_" + checker->getName() + "_" + type_name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_CONVEX_DECOMPOSITION_CONTACT_TEST_FUNC, clone, test_type)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      clone = checker->clone();
+      name = "BM_OCTREE_ROBOT_CONTACT_TEST_" + checker->getName() + "_" + type_name + "_BOX";
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_OCTREE_ROBOT_CONTACT_TEST_FUNC,
+                                   clone,
+                                   tesseract_geometry::Octree::BOX,
+                                   test_type)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+
+      clone = checker->clone();
+      name = "BM_OCTREE_ROBOT_CONTACT_TEST_" + checker->getName() + "_" + type_name + "_SPHERE_INSIDE";
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_OCTREE_ROBOT_CONTACT_TEST_FUNC,
+                                   clone,
+                                   tesseract_geometry::Octree::SPHERE_INSIDE,
+                                   test_type)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Clone, batched setCollisionObjectsTransform and batchContactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr)> BM_CONVEX_DECOMPOSITION_CLONE_FUNC =
+        BM_CONVEX_DECOMPOSITION_CLONE;
+    DiscreteContactManager::Ptr clone = checker->clone();
+    std::string name = "BM_CONVEX_DECOMPOSITION_CLONE_" + checker->getName();
+    benchmark::RegisterBenchmark(name.c_str(), BM_CONVEX_DECOMPOSITION_CLONE_FUNC, clone)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, std::size_t)>
+        BM_SET_COLLISION_OBJECTS_TRANSFORM_ALL_FUNC = BM_SET_COLLISION_OBJECTS_TRANSFORM_ALL;
+    const std::vector<std::size_t> num_links = { 2, 8, 32, 128, 512 };
+    for (const auto& num_link : num_links)
+    {
+      clone = checker->clone();
+      name = "BM_SET_COLLISION_OBJECTS_TRANSFORM_ALL_" + checker->getName() + "_ACTIVE_OBJ_" + std::to_string(num_link);
+      benchmark::RegisterBenchmark(name.c_str(), BM_SET_COLLISION_OBJECTS_TRANSFORM_ALL_FUNC, clone, num_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, std::size_t)> BM_BATCH_CONTACT_TEST_FUNC =
+        BM_BATCH_CONTACT_TEST;
+    const std::vector<std::size_t> num_states = { 1, 10, 100 };
+    for (const auto& num_state : num_states)
+    {
+      name = "BM_BATCH_CONTACT_TEST_" + checker->getName() + "_STATES_" + std::to_string(num_state);
+      clone = checker->clone();
+      benchmark::RegisterBenchmark(name.c_str(), BM_BATCH_CONTACT_TEST_FUNC, clone, num_state)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+}
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
@@ -2,6 +2,7 @@
 #define TESSERACT_COLLISION_COLLISION_CLONE_UNIT_HPP
 
 #include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_geometry/geometries.h>
 
 namespace tesseract_collision::test_suite
@@ -105,6 +106,37 @@ inline void addCollisionObjects(DiscreteContactManager& checker)
     }
   }
 }
+
+inline void addCollisionObjects(ContinuousContactManager& checker)
+{
+  ////////////////////////////
+  // Add static box to checker
+  ////////////////////////////
+  CollisionShapePtr static_box = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  Eigen::Isometry3d static_box_pose;
+  static_box_pose.setIdentity();
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(static_box);
+  obj1_poses.push_back(static_box_pose);
+
+  checker.addCollisionObject("static_box_link", 0, obj1_shapes, obj1_poses);
+
+  ////////////////////////////
+  // Add moving box to checker
+  ////////////////////////////
+  CollisionShapePtr moving_box = std::make_shared<tesseract_geometry::Box>(0.25, 0.25, 0.25);
+  Eigen::Isometry3d moving_box_pose;
+  moving_box_pose.setIdentity();
+
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(moving_box);
+  obj2_poses.push_back(moving_box_pose);
+
+  checker.addCollisionObject("moving_box_link", 0, obj2_shapes, obj2_poses);
+}
 }  // namespace detail
 
 inline void
@@ -191,5 +223,59 @@ runTest(DiscreteContactManager& checker, double dist_tol = 0.001, double nearest
   EXPECT_NEAR(result_vector[0].normal[1] * idx[2], cloned_result_vector[0].normal[1] * cloned_idx[2], normal_tol);
   EXPECT_NEAR(result_vector[0].normal[2] * idx[2], cloned_result_vector[0].normal[2] * cloned_idx[2], normal_tol);
 }
+
+/**
+ * @brief Check a clone of a continuous contact manager is independent of the original
+ * @details A link which is static when the manager is cloned is made active in the clone and in the original and cast
+ * along different paths, so any state shared between them would change the results.
+ */
+inline void runTest(ContinuousContactManager& checker)
+{
+  // Check name which should not be empty
+  EXPECT_FALSE(checker.getName().empty());
+
+  // Add collision objects
+  detail::addCollisionObjects(checker);
+
+  checker.setActiveCollisionObjects({ "moving_box_link" });
+  checker.setDefaultCollisionMarginData(0.1);
+
+  ContinuousContactManager::Ptr cloned_checker = checker.clone();
+  EXPECT_TRUE(tesseract_common::isIdentical<std::string>(
+      checker.getActiveCollisionObjects(), cloned_checker->getActiveCollisionObjects(), false));
+  EXPECT_NEAR(cloned_checker->getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+
+  // Make the link which was static when cloned active in both managers
+  std::vector<std::string> active_links{ "static_box_link" };
+  checker.setActiveCollisionObjects(active_links);
+  cloned_checker->setActiveCollisionObjects(active_links);
+
+  checker.setCollisionObjectsTransform("moving_box_link", Eigen::Isometry3d::Identity());
+  cloned_checker->setCollisionObjectsTransform("moving_box_link", Eigen::Isometry3d::Identity());
+
+  // The clone casts the box through the moving box and the original casts it past the moving box
+  Eigen::Isometry3d start_pos, end_pos;
+  start_pos.setIdentity();
+  start_pos.translation()(0) = -1.9;
+  end_pos.setIdentity();
+  end_pos.translation()(0) = 1.9;
+  cloned_checker->setCollisionObjectsTransform("static_box_link", start_pos, end_pos);
+
+  start_pos.translation()(1) = 3;
+  end_pos.translation()(1) = 3;
+  checker.setCollisionObjectsTransform("static_box_link", start_pos, end_pos);
+
+  ContactResultMap cloned_result;
+  cloned_checker->contactTest(cloned_result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector cloned_result_vector;
+  flattenMoveResults(std::move(cloned_result), cloned_result_vector);
+  ASSERT_FALSE(cloned_result_vector.empty());
+  EXPECT_LT(cloned_result_vector[0].distance, 0);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+}
 }  // namespace tesseract_collision::test_suite
 #endif  // TESSERACT_COLLISION_COLLISION_CLONE_UNIT_HPP
@@ -102,6 +102,19 @@ inline void runTestCompound(DiscreteContactManager& checker)
   {
     EXPECT_NEAR(cr.distance, 0.20, 0.001);
   }
+
+  // The closest contact prunes the child pairs, check it twice so the cached child algorithms are reused
+  for (int i = 0; i < 2; ++i)
+  {
+    result.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    result_vector.clear();
+    flattenCopyResults(result, result_vector);
+
+    ASSERT_EQ(result_vector.size(), 1);
+    EXPECT_NEAR(result_vector[0].distance, 0.20, 0.001);
+  }
 }
 
 inline void runTestCompound(ContinuousContactManager& checker)
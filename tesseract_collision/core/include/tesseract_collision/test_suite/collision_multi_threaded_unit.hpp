@@ -5,16 +5,23 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
 #include <chrono>
+#include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/common.h>
 #include <tesseract_geometry/geometries.h>
 
 namespace tesseract_collision::test_suite
 {
-inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = false)
+namespace detail
+{
+inline void addSphereGrid(DiscreteContactManager& checker,
+                          std::vector<std::string>& link_names,
+                          tesseract_common::TransformMap& location,
+                          bool use_convex_mesh)
 {
   // Add Meshed Sphere to checker
   CollisionShapePtr sphere;
@@ -37,8 +44,6 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
   double delta = 0.55;
 
   std::size_t t = 10;
-  std::vector<std::string> link_names;
-  tesseract_common::TransformMap location;
   for (std::size_t x = 0; x < t; ++x)
   {
     for (std::size_t y = 0; y < t; ++y)
@@ -62,6 +67,14 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
       }
     }
   }
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = false)
+{
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  detail::addSphereGrid(checker, link_names, location, use_convex_mesh);
 
   // Check if they are in collision
   checker.setActiveCollisionObjects(link_names);
@@ -135,6 +148,146 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
     EXPECT_TRUE(result_vector[static_cast<std::size_t>(i)].size() == 2700);
   }
 }
+
+inline void runTestParallelNarrowphase(tesseract_collision_bullet::BulletDiscreteBVHManager& checker,
+                                       bool use_convex_mesh = false)
+{
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  detail::addSphereGrid(checker, link_names, location, use_convex_mesh);
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setCollisionObjectsTransform(location);
+
+  EXPECT_EQ(checker.getNarrowphaseThreads(), 1);
+  checker.setNarrowphaseThreads(0);
+  EXPECT_EQ(checker.getNarrowphaseThreads(), 1);
+
+  std::vector<ContactTestType> types{ ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST };
+  for (const auto& type : types)
+  {
+    checker.setNarrowphaseThreads(1);
+    ContactResultMap serial_result;
+    checker.contactTest(serial_result, ContactRequest(type));
+
+    checker.setNarrowphaseThreads(4);
+    EXPECT_EQ(checker.getNarrowphaseThreads(), 4);
+
+    // Run twice to make sure the per thread buffers are cleared between calls
+    ContactResultMap parallel_result;
+    checker.contactTest(parallel_result, ContactRequest(type));
+    parallel_result.clear();
+    checker.contactTest(parallel_result, ContactRequest(type));
+
+    EXPECT_EQ(parallel_result.size(), serial_result.size());
+    EXPECT_EQ(parallel_result.numContacts(), serial_result.numContacts());
+    if (type == ContactTestType::FIRST)
+      continue;
+
+    for (const auto& pair : serial_result)
+    {
+      auto it = parallel_result.find(pair.first);
+      ASSERT_TRUE(it != parallel_result.end());
+      ASSERT_EQ(it->second.size(), pair.second.size());
+      for (std::size_t i = 0; i < pair.second.size(); ++i)
+      {
+        EXPECT_NEAR(it->second[i].distance, pair.second[i].distance, 1e-6);
+        EXPECT_TRUE(it->second[i].link_names == pair.second[i].link_names);
+        EXPECT_TRUE(it->second[i].nearest_points[0].isApprox(pair.second[i].nearest_points[0], 1e-6));
+        EXPECT_TRUE(it->second[i].nearest_points[1].isApprox(pair.second[i].nearest_points[1], 1e-6));
+      }
+    }
+  }
+
+  // The setting is preserved when cloning
+  DiscreteContactManager::UPtr clone = checker.clone();
+  auto* bvh_clone = dynamic_cast<tesseract_collision_bullet::BulletDiscreteBVHManager*>(clone.get());
+  ASSERT_TRUE(bvh_clone != nullptr);
+  EXPECT_EQ(bvh_clone->getNarrowphaseThreads(), 4);
+
+  ContactResultMap clone_result;
+  bvh_clone->contactTest(clone_result, ContactRequest(ContactTestType::ALL));
+  ContactResultVector clone_vector;
+  flattenMoveResults(std::move(clone_result), clone_vector);
+  EXPECT_EQ(clone_vector.size(), 2700);
+}
+/**
+ * @brief Check the parallel narrowphase with collision algorithms which read the contacts found so far
+ * @details The links have multiple shapes, so pairs of them use the compound compound algorithm, and they are above an
+ * octree. For ContactTestType::CLOSEST both algorithms skip the children farther than the closest contact of the pair.
+ */
+inline void runTestParallelNarrowphaseCompound(tesseract_collision_bullet::BulletDiscreteBVHManager& checker)
+{
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  for (int x = 0; x < 16; ++x)
+  {
+    for (int y = 0; y < 16; ++y)
+      ot->updateNode((x * 0.1) + 0.05, (y * 0.1) + 0.05, 0.05, true);
+  }
+  CollisionShapesConst octree_shapes{ std::make_shared<tesseract_geometry::Octree>(ot,
+                                                                                  tesseract_geometry::Octree::BOX) };
+  tesseract_common::VectorIsometry3d octree_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("octree_link", 0, octree_shapes, octree_poses);
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  location["octree_link"] = Eigen::Isometry3d::Identity();
+  for (std::size_t x = 0; x < 5; ++x)
+  {
+    for (std::size_t y = 0; y < 5; ++y)
+    {
+      CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1),
+                                   std::make_shared<tesseract_geometry::Sphere>(0.05),
+                                   std::make_shared<tesseract_geometry::Cylinder>(0.04, 0.2) };
+      tesseract_common::VectorIsometry3d poses(3, Eigen::Isometry3d::Identity());
+      poses[1].translation() = Eigen::Vector3d(0.1, 0, 0);
+      poses[2].translation() = Eigen::Vector3d(0, 0.1, 0.05);
+
+      link_names.push_back("compound_link_" + std::to_string(x) + std::to_string(y));
+      checker.addCollisionObject(link_names.back(), 0, shapes, poses);
+
+      Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+      pose.translation() = Eigen::Vector3d((static_cast<double>(x) * 0.3) + 0.1,
+                                           (static_cast<double>(y) * 0.3) + 0.1,
+                                           0.2 + (0.02 * static_cast<double>(x)));
+      location[link_names.back()] = pose;
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.3));
+  checker.setCollisionObjectsTransform(location);
+
+  std::vector<ContactTestType> types{ ContactTestType::ALL, ContactTestType::CLOSEST };
+  for (const auto& type : types)
+  {
+    checker.setNarrowphaseThreads(1);
+    ContactResultMap serial_result;
+    checker.contactTest(serial_result, ContactRequest(type));
+    EXPECT_FALSE(serial_result.empty());
+
+    // Run repeatedly so the threads reuse the collision algorithms and the results of the previous contact test
+    checker.setNarrowphaseThreads(4);
+    ContactResultMap parallel_result;
+    for (int i = 0; i < 10; ++i)
+    {
+      parallel_result.clear();
+      checker.contactTest(parallel_result, ContactRequest(type));
+    }
+
+    EXPECT_EQ(parallel_result.size(), serial_result.size());
+    EXPECT_EQ(parallel_result.numContacts(), serial_result.numContacts());
+    for (const auto& pair : serial_result)
+    {
+      auto it = parallel_result.find(pair.first);
+      ASSERT_TRUE(it != parallel_result.end());
+      ASSERT_EQ(it->second.size(), pair.second.size());
+      for (std::size_t i = 0; i < pair.second.size(); ++i)
+        EXPECT_NEAR(it->second[i].distance, pair.second[i].distance, 1e-6);
+    }
+  }
+}
 }  // namespace tesseract_collision::test_suite
 
 #endif  // TESSERACT_COLLISION_COLLISION_MULTI_THREADED_UNIT_HPP
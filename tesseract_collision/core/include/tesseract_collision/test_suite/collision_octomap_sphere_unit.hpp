@@ -6,6 +6,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <octomap/octomap.h>
 #include <console_bridge/console.h>
 #include <chrono>
+#include <limits>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/convex_hull_utils.h>
@@ -140,6 +141,219 @@ inline void runTest(DiscreteContactManager& checker, double tol, bool use_convex
   detail::runTestTyped(checker, tol, ContactTestType::ALL);
 }
 
+/**
+ * @brief Check the distances to the individual cells of a sparse octree
+ * @param checker The contact manager
+ * @param octree_pose The pose of the octree in the link, which adds it as a child of a compound if not identity
+ */
+inline void runTestOctreeCells(DiscreteContactManager& checker, const Eigen::Isometry3d& octree_pose)
+{
+  // Two occupied cells, [0, 0.1] and [0.5, 0.6] along x
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(0.05, 0.05, 0.05, true);
+  ot->updateNode(0.55, 0.05, 0.05, true);
+  CollisionShapePtr octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+
+  CollisionShapesConst obj1_shapes{ octree };
+  tesseract_common::VectorIsometry3d obj1_poses{ octree_pose };
+  checker.addCollisionObject("octomap_link", 0, obj1_shapes, obj1_poses);
+
+  CollisionShapesConst obj2_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.05) };
+  tesseract_common::VectorIsometry3d obj2_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+
+  checker.setActiveCollisionObjects({ "octomap_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.2));
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+
+  auto check = [&checker, &octree_pose](double x, long expected_contacts, double expected_distance) {
+    Eigen::Isometry3d sphere_pose = octree_pose;
+    sphere_pose.translation() += octree_pose.linear() * Eigen::Vector3d(x, 0.05, 0.05);
+    checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.numContacts(), expected_contacts);
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    double distance = std::numeric_limits<double>::max();
+    for (const auto& r : result_vector)
+      distance = std::min(distance, r.distance);
+
+    if (expected_contacts > 0)
+    {
+      EXPECT_NEAR(distance, expected_distance, 1e-4);
+    }
+  };
+
+  // Close to the first cell, the second is outside of the margin
+  check(0.23, 1, 0.08);
+
+  // Between the cells
+  check(0.3, 2, 0.15);
+
+  // Close to the second cell
+  check(0.8, 1, 0.15);
+
+  // Far from both cells
+  check(2.0, 0, 0);
+
+  // In collision with the first cell
+  check(0.12, 1, -0.03);
+}
+
+/**
+ * @brief Check updating an octree with a delta without recreating the collision object
+ * @param checker The contact manager
+ * @param tol The distance tolerance
+ */
+inline void runTestOctreeUpdate(DiscreteContactManager& checker, double tol)
+{
+  // A single occupied cell at [0, 0.1] along x
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(0.05, 0.05, 0.05, true);
+  CollisionShapePtr octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+
+  CollisionShapesConst obj1_shapes{ octree };
+  tesseract_common::VectorIsometry3d obj1_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("octomap_link", 0, obj1_shapes, obj1_poses);
+
+  CollisionShapesConst obj2_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.05) };
+  tesseract_common::VectorIsometry3d obj2_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.2));
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(0.8, 0.05, 0.05);
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  auto check = [&checker, tol](long expected_contacts, double expected_distance) {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.numContacts(), expected_contacts);
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    if (expected_contacts > 0)
+    {
+      EXPECT_NEAR(result_vector[0].distance, expected_distance, tol);
+    }
+  };
+
+  // The only cell is outside of the margin
+  check(0, 0);
+
+  Eigen::Vector3d aabb_min, aabb_max;
+  EXPECT_TRUE(calcOctreeOccupiedAABB(aabb_min, aabb_max, *ot));
+  EXPECT_TRUE(aabb_min.isApprox(Eigen::Vector3d(0, 0, 0), 1e-6));
+  EXPECT_TRUE(aabb_max.isApprox(Eigen::Vector3d(0.1, 0.1, 0.1), 1e-6));
+
+  // Occupy a cell close to the sphere, which is outside of the original bounding box of the octree
+  OctreeDelta delta;
+  delta.occupied.push_back(ot->coordToKey(0.55, 0.05, 0.05));
+  EXPECT_FALSE(delta.empty());
+  applyOctreeDelta(*ot, delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, delta));
+  check(1, 0.15);
+
+  EXPECT_TRUE(updateOctreeOccupiedAABB(aabb_min, aabb_max, *ot, delta));
+  EXPECT_NEAR(aabb_max.x(), 0.6, 1e-6);
+
+  // Free the cell again, which touches the bounding box so it is recalculated
+  delta.clear();
+  EXPECT_TRUE(delta.empty());
+  delta.free.push_back(ot->coordToKey(0.55, 0.05, 0.05));
+  applyOctreeDelta(*ot, delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, delta));
+  check(0, 0);
+
+  EXPECT_TRUE(updateOctreeOccupiedAABB(aabb_min, aabb_max, *ot, delta));
+  EXPECT_NEAR(aabb_max.x(), 0.1, 1e-6);
+
+  // Free the last cell
+  delta.free.clear();
+  delta.free.push_back(ot->coordToKey(0.05, 0.05, 0.05));
+  applyOctreeDelta(*ot, delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, delta));
+  EXPECT_FALSE(updateOctreeOccupiedAABB(aabb_min, aabb_max, *ot, delta));
+  EXPECT_TRUE(aabb_min.isZero());
+  EXPECT_TRUE(aabb_max.isZero());
+
+  // Occupy a cell in the empty octree
+  delta.clear();
+  delta.occupied.push_back(ot->coordToKey(0.75, 0.25, 0.05));
+  applyOctreeDelta(*ot, delta);
+  EXPECT_TRUE(checker.updateCollisionObjectOctree("octomap_link", 0, delta));
+  check(1, 0.1);
+
+  // Only octrees can be updated
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("sphere_link", 0, delta));
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("octomap_link", 1, delta));
+  EXPECT_FALSE(checker.updateCollisionObjectOctree("missing_link", 0, delta));
+}
+
+/**
+ * @brief Check the closest distance to a dense octree with and without a distance tolerance
+ * @param checker The contact manager
+ * @param tol The distance tolerance of the exact distance
+ */
+inline void runTestOctreeDistanceTolerance(DiscreteContactManager& checker, double tol)
+{
+  // A block of occupied cells from 0 to 0.95 along each axis
+  auto ot = std::make_shared<octomap::OcTree>(0.05);
+  for (int i = 0; i < 19; ++i)
+    for (int j = 0; j < 19; ++j)
+      for (int k = 0; k < 19; ++k)
+        ot->updateNode(0.025 + (0.05 * i), 0.025 + (0.05 * j), 0.025 + (0.05 * k), true);
+
+  auto add_octree = [&checker, &ot](double distance_tolerance) {
+    auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+    octree->setDistanceTolerance(distance_tolerance);
+    CollisionShapesConst shapes{ octree };
+    tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+    checker.addCollisionObject("octomap_link", 0, shapes, poses);
+    checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+  };
+  add_octree(0);
+
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.05) };
+  tesseract_common::VectorIsometry3d sphere_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  checker.setActiveCollisionObjects({ "octomap_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.5));
+
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(1.3, 0.5, 0.5);
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  auto closest_distance = [&checker](ContactTestType type) {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(type));
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    EXPECT_FALSE(result_vector.empty());
+    double distance = std::numeric_limits<double>::max();
+    for (const auto& r : result_vector)
+      distance = std::min(distance, r.distance);
+
+    return distance;
+  };
+
+  // Only visiting the cells which may be closer gives the same distance as checking all of them
+  EXPECT_NEAR(closest_distance(ContactTestType::ALL), 0.3, tol);
+  EXPECT_NEAR(closest_distance(ContactTestType::CLOSEST), 0.3, tol);
+
+  // With a tolerance the distance may be calculated to coarser cells
+  add_octree(0.2);
+  EXPECT_NEAR(closest_distance(ContactTestType::CLOSEST), 0.3, 0.2 + tol);
+}
+
 }  // namespace tesseract_collision::test_suite
 
 #endif  // TESSERACT_COLLISION_COLLISION_OCTOMAP_SPHERE_UNIT_HPP
@@ -0,0 +1,111 @@
+#ifndef TESSERACT_COLLISION_COLLISION_POINT_CLOUD_SPHERE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_POINT_CLOUD_SPHERE_UNIT_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+/**
+ * @brief Add a link with a point cloud as its second shape, the first shape is a sphere far from the other link
+ * @param checker The contact manager
+ * @param points The points of the cloud
+ * @param cloud_pose The pose of the cloud in the link
+ */
+inline void addPointCloudLink(DiscreteContactManager& checker,
+                              const std::shared_ptr<const tesseract_common::VectorVector3d>& points,
+                              const Eigen::Isometry3d& cloud_pose)
+{
+  Eigen::Isometry3d far_pose = Eigen::Isometry3d::Identity();
+  far_pose.translation() = Eigen::Vector3d(10, 0, 0);
+
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Sphere>(0.05),
+                               std::make_shared<tesseract_geometry::PointCloud>(points, 0.05) };
+  tesseract_common::VectorIsometry3d poses{ far_pose, cloud_pose };
+  checker.addCollisionObject("point_cloud_link", 0, shapes, poses);
+  checker.setCollisionObjectsTransform("point_cloud_link", Eigen::Isometry3d::Identity());
+}
+}  // namespace detail
+
+/**
+ * @brief Check the distances to the spheres of a point cloud and replacing the cloud
+ * @param checker The contact manager
+ * @param cloud_pose The pose of the cloud in the link
+ */
+inline void runTest(DiscreteContactManager& checker, const Eigen::Isometry3d& cloud_pose)
+{
+  // Two points at 0.05 and 0.55 along x, the same layout as the cells of the octree test
+  auto points = std::make_shared<tesseract_common::VectorVector3d>();
+  points->emplace_back(0.05, 0.05, 0.05);
+  points->emplace_back(0.55, 0.05, 0.05);
+  detail::addPointCloudLink(checker, points, cloud_pose);
+
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.05) };
+  tesseract_common::VectorIsometry3d sphere_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  checker.setActiveCollisionObjects({ "point_cloud_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.2));
+
+  auto check = [&checker, &cloud_pose](double x, long expected_contacts, double expected_distance) {
+    Eigen::Isometry3d sphere_pose = cloud_pose;
+    sphere_pose.translation() += cloud_pose.linear() * Eigen::Vector3d(x, 0.05, 0.05);
+    checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.numContacts(), expected_contacts);
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    double distance = std::numeric_limits<double>::max();
+    for (const auto& r : result_vector)
+    {
+      distance = std::min(distance, r.distance);
+
+      // The contacts are reported with the index of the point cloud in the link
+      const std::size_t cloud_side = (r.link_names[0] == "point_cloud_link") ? 0 : 1;
+      EXPECT_EQ(r.shape_id[cloud_side], 1);
+    }
+
+    if (expected_contacts > 0)
+    {
+      EXPECT_NEAR(distance, expected_distance, 1e-4);
+    }
+  };
+
+  // Close to the first point, the second is outside of the margin
+  check(0.23, 1, 0.08);
+
+  // Between the points
+  check(0.3, 2, 0.15);
+
+  // Close to the second point
+  check(0.8, 1, 0.15);
+
+  // Far from both points
+  check(2.0, 0, 0);
+
+  // In collision with the first point
+  check(0.12, 1, -0.03);
+
+  // Replace the cloud with one that only has the second point
+  auto new_points = std::make_shared<tesseract_common::VectorVector3d>();
+  new_points->emplace_back(0.55, 0.05, 0.05);
+  detail::addPointCloudLink(checker, new_points, cloud_pose);
+  EXPECT_EQ(checker.getCollisionObjects().size(), 2);
+
+  check(0.12, 0, 0);
+  check(0.8, 1, 0.15);
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_POINT_CLOUD_SPHERE_UNIT_HPP
@@ -216,6 +216,32 @@ inline void runTestPrimitive(ContinuousContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[1], idx[2] * 0.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
 
+  ////////////////////////////////////////////////////////////////
+  // Test distance only detail skips the continuous contact data
+  ////////////////////////////////////////////////////////////////
+  {
+    ContactRequest request(ContactTestType::CLOSEST);
+    request.detail = ContactResultDetail::DISTANCE;
+
+    ContactResultMap detail_result;
+    checker.contactTest(detail_result, request);
+
+    ContactResultVector detail_result_vector;
+    flattenMoveResults(std::move(detail_result), detail_result_vector);
+
+    ASSERT_EQ(detail_result_vector.size(), 1U);
+    EXPECT_NEAR(detail_result_vector[0].distance, -0.1, 0.0001);
+    EXPECT_NEAR(std::abs(detail_result_vector[0].normal[0]), 1.0, 0.001);
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+      EXPECT_NEAR(detail_result_vector[0].cc_time[i], -1, 1e-8);
+      EXPECT_EQ(detail_result_vector[0].cc_type[i], ContinuousCollisionType::CCType_None);
+      EXPECT_TRUE(detail_result_vector[0].nearest_points[i].isApprox(Eigen::Vector3d::Zero()));
+      EXPECT_TRUE(detail_result_vector[0].transform[i].isApprox(Eigen::Isometry3d::Identity()));
+      EXPECT_TRUE(detail_result_vector[0].cc_transform[i].isApprox(Eigen::Isometry3d::Identity()));
+    }
+  }
+
   /////////////////////////////////////////////////////////////
   // Test when object is in collision at cc_time 0.333 and 0.5
   /////////////////////////////////////////////////////////////
@@ -443,6 +469,38 @@ inline void runTestConvex(ContinuousContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[1], idx[2] * 0.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
 }
+
+inline void runTestSweep(ContinuousContactManager& checker)
+{
+  ///////////////////////////////////////////////////////////////////
+  // Test a sweep where only the second segment is in collision
+  ///////////////////////////////////////////////////////////////////
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  auto name_table = std::make_shared<const tesseract_common::LinkNameTable>(active_links);
+  std::vector<tesseract_common::LinkTransforms> poses;
+  for (double value : { -1.0, -0.5, 1.0 })
+  {
+    tesseract_common::LinkTransforms pose(name_table);
+    pose[0].translation() = Eigen::Vector3d(-0.2, value, 0);
+    pose[1].translation() = Eigen::Vector3d(0.2, 0, value);
+    poses.push_back(pose);
+  }
+
+  std::vector<ContactResultMap> results;
+  EXPECT_EQ(checker.contactTestSweep(results, poses, ContactRequest(ContactTestType::CLOSEST)), 1);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_TRUE(results[0].empty());
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(results[1]), result_vector);
+  ASSERT_FALSE(result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, -0.1, 0.0001);
+
+  EXPECT_ANY_THROW(checker.contactTestSweep(results, { poses[0] }, ContactRequest()));  // NOLINT
+}
 }  // namespace detail
 
 inline void runTest(ContinuousContactManager& checker, bool use_convex_mesh)
@@ -456,7 +514,10 @@ inline void runTest(ContinuousContactManager& checker, bool use_convex_mesh)
   if (use_convex_mesh)
     detail::runTestConvex(checker);
   else
+  {
     detail::runTestPrimitive(checker);
+    detail::runTestSweep(checker);
+  }
 }
 
 }  // namespace tesseract_collision::test_suite
@@ -2,6 +2,7 @@
 #define TESSERACT_COLLISION_COLLISION_SPHERE_SPHERE_UNIT_HPP
 
 #include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/core/cached_discrete_contact_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/common.h>
 #include <tesseract_geometry/geometries.h>
@@ -429,6 +430,256 @@ inline void runTestConvex3(DiscreteContactManager& checker)
   EXPECT_LT(std::abs(std::acos((idx[2] * result_vector[0].normal).dot(Eigen::Vector3d(0, 1, 0)))), 0.4);
 }
 
+inline void runTestBatch(DiscreteContactManager& checker)
+{
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // Build states with the spheres in collision, within the margin and outside the margin
+  std::vector<double> offsets{ 0.2, 0.55, 1.0, 0.2 };
+  std::vector<double> expected_distances{ -0.30, 0.05, 1.0, -0.30 };
+  std::vector<std::string> names{ "sphere_link", "sphere1_link" };
+  std::vector<tesseract_common::TransformMap> transforms;
+  std::vector<tesseract_common::VectorIsometry3d> poses;
+  for (double offset : offsets)
+  {
+    Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+    sphere1_pose.translation()(0) = offset;
+
+    tesseract_common::TransformMap location;
+    location["sphere_link"] = Eigen::Isometry3d::Identity();
+    location["sphere1_link"] = sphere1_pose;
+    transforms.push_back(location);
+
+    poses.push_back({ Eigen::Isometry3d::Identity(), sphere1_pose });
+  }
+
+  // Pre-populate the results to make sure they get cleared and resized
+  std::vector<ContactResultMap> map_results(10);
+  map_results.front()[std::make_pair("a", "b")].push_back(ContactResult());
+  checker.batchContactTest(map_results, transforms, ContactRequest(ContactTestType::CLOSEST));
+
+  std::vector<ContactResultMap> pose_results;
+  checker.batchContactTest(pose_results, names, poses, ContactRequest(ContactTestType::CLOSEST));
+
+  EXPECT_EQ(map_results.size(), offsets.size());
+  EXPECT_EQ(pose_results.size(), offsets.size());
+  for (std::size_t i = 0; i < offsets.size(); ++i)
+  {
+    // Compare against a contact test of the same state
+    checker.setCollisionObjectsTransform(transforms[i]);
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    for (const auto* batch_result : { &map_results[i], &pose_results[i] })
+    {
+      ContactResultVector result_vector;
+      flattenCopyResults(*batch_result, result_vector);
+      EXPECT_EQ(batch_result->size(), result.size());
+      if (expected_distances[i] > 0.1)
+      {
+        EXPECT_TRUE(result_vector.empty());
+      }
+      else
+      {
+        ASSERT_EQ(result_vector.size(), 1U);
+        EXPECT_NEAR(result_vector[0].distance, expected_distances[i], 0.0001);
+      }
+    }
+  }
+
+  // The number of poses must match the number of names
+  poses.back().pop_back();
+  EXPECT_ANY_THROW(checker.batchContactTest(pose_results, names, poses, ContactRequest(ContactTestType::CLOSEST)));
+}
+
+inline void runTestDetail(DiscreteContactManager& checker)
+{
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  tesseract_common::TransformMap location;
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["sphere1_link"] = Eigen::Isometry3d::Identity();
+  location["sphere1_link"].translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform(location);
+
+  for (auto detail : { ContactResultDetail::DISTANCE, ContactResultDetail::BINARY })
+  {
+    ContactRequest request(ContactTestType::CLOSEST);
+    request.detail = detail;
+
+    ContactResultMap result;
+    checker.contactTest(result, request);
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+    EXPECT_FALSE(result_vector[0].link_names[0].empty());
+    EXPECT_FALSE(result_vector[0].link_names[1].empty());
+
+    if (detail == ContactResultDetail::DISTANCE)
+      EXPECT_NEAR(std::abs(result_vector[0].normal[0]), 1.0, 0.001);
+    else
+      EXPECT_TRUE(result_vector[0].normal.isApprox(Eigen::Vector3d::Zero()));
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+      EXPECT_TRUE(result_vector[0].nearest_points[i].isApprox(Eigen::Vector3d::Zero()));
+      EXPECT_TRUE(result_vector[0].nearest_points_local[i].isApprox(Eigen::Vector3d::Zero()));
+      EXPECT_TRUE(result_vector[0].transform[i].isApprox(Eigen::Isometry3d::Identity()));
+    }
+  }
+}
+
+inline void runTestHandles(DiscreteContactManager& checker)
+{
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // Handles are the index into the collision objects
+  const std::vector<std::string>& names = checker.getCollisionObjects();
+  for (const auto& name : names)
+  {
+    int handle = checker.getCollisionObjectHandle(name);
+    ASSERT_GE(handle, 0);
+    EXPECT_EQ(names[static_cast<std::size_t>(handle)], name);
+  }
+  EXPECT_EQ(checker.getCollisionObjectHandle("link_does_not_exist"), -1);
+
+  int sphere_handle = checker.getCollisionObjectHandle("sphere_link");
+  int sphere1_handle = checker.getCollisionObjectHandle("sphere1_link");
+
+  Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform(sphere_handle, Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform(sphere1_handle, sphere1_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1U);
+  EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+  for (std::size_t i = 0; i < 2; ++i)
+    EXPECT_EQ(result_vector[0].link_handles[i], checker.getCollisionObjectHandle(result_vector[0].link_names[i]));
+
+  // Set the transforms from flat link transforms, links that are not collision objects are ignored
+  auto name_table = std::make_shared<const tesseract_common::LinkNameTable>(
+      std::vector<std::string>{ "sphere_link", "link_does_not_exist", "sphere1_link" });
+  tesseract_common::LinkTransforms link_transforms(name_table);
+  link_transforms[2].translation()(0) = 0.25;
+  checker.setCollisionObjectsTransform(link_transforms);
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1U);
+  EXPECT_NEAR(result_vector[0].distance, -0.25, 0.0001);
+  checker.setCollisionObjectsTransform(sphere1_handle, sphere1_pose);
+
+  // Disable and enable using the handle
+  EXPECT_TRUE(checker.disableCollisionObject(sphere1_handle));
+  EXPECT_FALSE(checker.isCollisionObjectEnabled("sphere1_link"));
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+
+  EXPECT_TRUE(checker.enableCollisionObject(sphere1_handle));
+  EXPECT_TRUE(checker.isCollisionObjectEnabled("sphere1_link"));
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_FALSE(result.empty());
+
+  // Invalid handles
+  EXPECT_FALSE(checker.enableCollisionObject(-1));
+  EXPECT_FALSE(checker.disableCollisionObject(static_cast<int>(names.size())));
+  checker.setCollisionObjectsTransform(-1, Eigen::Isometry3d::Identity());
+
+  // The clone should provide the same handles
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  for (const auto& name : names)
+    EXPECT_EQ(cloned_checker->getCollisionObjectHandle(name), checker.getCollisionObjectHandle(name));
+
+  // Removing an object shifts the handles of objects added after it
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1) };
+  tesseract_common::VectorIsometry3d box_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("handle_box_link", 0, box_shapes, box_poses);
+  checker.addCollisionObject("handle_box1_link", 0, box_shapes, box_poses);
+  int box1_handle = checker.getCollisionObjectHandle("handle_box1_link");
+  EXPECT_TRUE(checker.removeCollisionObject("handle_box_link"));
+  EXPECT_EQ(checker.getCollisionObjectHandle("handle_box1_link"), box1_handle - 1);
+  EXPECT_EQ(checker.getCollisionObjects()[static_cast<std::size_t>(box1_handle - 1)], "handle_box1_link");
+  EXPECT_TRUE(checker.removeCollisionObject("handle_box1_link"));
+  EXPECT_EQ(checker.getCollisionObjectHandle("sphere_link"), sphere_handle);
+  EXPECT_EQ(checker.getCollisionObjectHandle("sphere1_link"), sphere1_handle);
+}
+
+inline void runTestRepeated(DiscreteContactManager& checker)
+{
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+  sphere1_pose.translation()(0) = 0.2;
+
+  // Setting the same transforms between calls must produce the same results
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity());
+    checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+  }
+
+  // Small motions of one object between calls
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    sphere1_pose.translation()(0) += 0.01;
+    checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, -0.30 + (0.01 * static_cast<double>(i + 1)), 0.0001);
+  }
+
+  // Move out of range, the result must not change when the transform is set again
+  sphere1_pose.translation()(0) = 2.0;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+  }
+
+  // Move back into collision
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(result.size(), 1U);
+}
+
 inline void runTestConvex(DiscreteContactManager& checker)
 {
   runTestConvex1(checker);
@@ -448,7 +699,214 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh)
   if (use_convex_mesh)
     detail::runTestConvex(checker);
   else
+  {
     detail::runTestPrimitive(checker);
+    detail::runTestBatch(checker);
+    detail::runTestHandles(checker);
+    detail::runTestDetail(checker);
+    detail::runTestRepeated(checker);
+  }
+}
+inline void runTestResultCache(DiscreteContactManager::UPtr manager)
+{
+  CachedDiscreteContactManager checker(std::move(manager), 1024 * 1024, 1e-4, 1e-4);
+  detail::addCollisionObjects(checker);
+
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+  auto check = [&checker](double expected_distance) {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, expected_distance, 0.001);
+  };
+
+  // The first test is forwarded and the second is returned from the cache
+  checker.clearCache();
+  checker.resetCacheStatistics();
+  check(-0.30);
+  EXPECT_EQ(checker.getCacheMisses(), 1U);
+  EXPECT_EQ(checker.getCacheHits(), 0U);
+  EXPECT_EQ(checker.getCacheSize(), 1U);
+  EXPECT_GT(checker.getCacheMemoryUsage(), 0U);
+  check(-0.30);
+  EXPECT_EQ(checker.getCacheMisses(), 1U);
+  EXPECT_EQ(checker.getCacheHits(), 1U);
+
+  // Cached results are added to the provided results the same as the wrapped manager
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_EQ(result.numContacts(), 1);
+  }
+
+  // A motion within the tolerance returns the cached results
+  checker.resetCacheStatistics();
+  sphere1_pose.translation()(0) = 0.2 + 1e-6;
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+  check(-0.30);
+  EXPECT_EQ(checker.getCacheHits(), 1U);
+
+  // A motion outside the tolerance is forwarded
+  sphere1_pose.translation()(0) = 0.25;
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+  check(-0.25);
+  EXPECT_EQ(checker.getCacheMisses(), 1U);
+  EXPECT_EQ(checker.getCacheSize(), 2U);
+
+  // Returning to a previous state uses the cached results
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+  check(-0.30);
+  EXPECT_EQ(checker.getCacheHits(), 2U);
+
+  // A different request is cached separately
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.size(), 1U);
+    EXPECT_EQ(checker.getCacheMisses(), 2U);
+    EXPECT_EQ(checker.getCacheSize(), 3U);
+  }
+
+  // Requests with a validation function are not cached
+  {
+    ContactRequest request(ContactTestType::CLOSEST);
+    request.is_valid = [](const ContactResult&) { return false; };
+    ContactResultMap result;
+    checker.contactTest(result, request);
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(checker.getCacheMisses(), 2U);
+    EXPECT_EQ(checker.getCacheHits(), 2U);
+  }
+
+  // Changing the margin or moving a static object clears the cache
+  checker.setCollisionMarginData(CollisionMarginData(0.2));
+  EXPECT_EQ(checker.getCacheSize(), 0U);
+  EXPECT_EQ(checker.getCacheMemoryUsage(), 0U);
+  check(-0.30);
+  EXPECT_EQ(checker.getCacheSize(), 1U);
+
+  Eigen::Isometry3d thin_box_pose = Eigen::Isometry3d::Identity();
+  thin_box_pose.translation()(2) = 1.0;
+  checker.setCollisionObjectsTransform("thin_box_link", thin_box_pose);
+  EXPECT_EQ(checker.getCacheSize(), 0U);
+
+  // Setting the same static transform keeps the cache
+  check(-0.30);
+  checker.setCollisionObjectsTransform("thin_box_link", thin_box_pose);
+  EXPECT_EQ(checker.getCacheSize(), 1U);
+
+  // The least recently used results are removed to stay within the memory budget
+  std::size_t entry_memory = checker.getCacheMemoryUsage();
+  checker.setCacheMemoryBudget(entry_memory);
+  sphere1_pose.translation()(0) = 0.25;
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+  check(-0.25);
+  EXPECT_EQ(checker.getCacheSize(), 1U);
+  EXPECT_LE(checker.getCacheMemoryUsage(), checker.getCacheMemoryBudget());
+
+  // Results larger than the budget are returned without being stored
+  checker.setCacheMemoryBudget(0);
+  EXPECT_EQ(checker.getCacheSize(), 0U);
+  check(-0.25);
+  EXPECT_EQ(checker.getCacheSize(), 0U);
+
+  // The clone tracks the same state with an empty cache
+  checker.setCacheMemoryBudget(1024 * 1024);
+  check(-0.25);
+  DiscreteContactManager::UPtr cloned = checker.clone();
+  auto* cloned_checker = dynamic_cast<CachedDiscreteContactManager*>(cloned.get());
+  ASSERT_TRUE(cloned_checker != nullptr);
+  EXPECT_EQ(cloned_checker->getCacheSize(), 0U);
+  EXPECT_EQ(cloned_checker->getCacheMemoryBudget(), checker.getCacheMemoryBudget());
+  EXPECT_NEAR(cloned_checker->getCacheLinearTolerance(), 1e-4, 1e-12);
+  ContactResultMap result;
+  cloned_checker->contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(result.size(), 1U);
+  EXPECT_EQ(cloned_checker->getCacheMisses(), 1U);
+}
+inline void runTestStatistics(DiscreteContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  std::vector<std::string> active_links{ "sphere_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+
+  Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform("sphere_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+  auto check = [&checker]() {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_EQ(result.size(), 1U);
+  };
+
+  // Statistics are not collected by default
+  EXPECT_FALSE(checker.getStatisticsEnabled());
+  check();
+  EXPECT_EQ(checker.getStatistics().contact_tests, 0U);
+  EXPECT_EQ(checker.getStatistics().narrowphase_calls, 0U);
+
+  // Enable through the contact manager config
+  ContactManagerConfig config;
+  config.enable_statistics = true;
+  checker.applyContactManagerConfig(config);
+  EXPECT_TRUE(checker.getStatisticsEnabled());
+
+  check();
+  check();
+  ContactManagerStatistics statistics = checker.getStatistics();
+  EXPECT_EQ(statistics.contact_tests, 2U);
+  EXPECT_GE(statistics.broadphase_pairs, 2U);
+  EXPECT_EQ(statistics.narrowphase_calls, 2U);
+  EXPECT_EQ(statistics.broadphase_pairs - statistics.rejected_pairs, statistics.narrowphase_calls);
+  ContactManagerStatistics::GeometryTypePair sphere_sphere{ tesseract_geometry::GeometryType::SPHERE,
+                                                            tesseract_geometry::GeometryType::SPHERE };
+  ASSERT_EQ(statistics.narrowphase_calls_by_geometry_type.size(), 1U);
+  EXPECT_EQ(statistics.narrowphase_calls_by_geometry_type.at(sphere_sphere), 2U);
+  EXPECT_GE(statistics.contact_test_time, statistics.narrowphase_time);
+  EXPECT_GE(statistics.getBroadphaseTime().count(), 0);
+
+  // Pairs allowed to be in contact are rejected before the narrowphase
+  checker.clearStatistics();
+  EXPECT_EQ(checker.getStatistics().contact_tests, 0U);
+  IsContactAllowedFn fn = checker.getIsContactAllowedFn();
+  checker.setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  {
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+  }
+  statistics = checker.getStatistics();
+  EXPECT_EQ(statistics.contact_tests, 1U);
+  EXPECT_EQ(statistics.narrowphase_calls, 0U);
+  EXPECT_EQ(statistics.broadphase_pairs, statistics.rejected_pairs);
+  checker.setIsContactAllowedFn(fn);
+
+  // Clones start without statistics
+  DiscreteContactManager::UPtr cloned = checker.clone();
+  EXPECT_FALSE(cloned->getStatisticsEnabled());
+  EXPECT_EQ(cloned->getStatistics().contact_tests, 0U);
+
+  // Disabling keeps the collected statistics
+  checker.setStatisticsEnabled(false);
+  EXPECT_FALSE(checker.getStatisticsEnabled());
+  check();
+  EXPECT_EQ(checker.getStatistics().contact_tests, 1U);
 }
 }  // namespace tesseract_collision::test_suite
 
@@ -0,0 +1,95 @@
+#ifndef TESSERACT_COLLISION_COLLISION_STATIC_WORLD_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_STATIC_WORLD_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+/**
+ * @brief Add the objects of the static collision world used by runTest, a unit box at the origin
+ * @param world The static collision world of any of the contact managers
+ */
+template <typename StaticCollisionWorld>
+inline void addStaticWorldObjects(StaticCollisionWorld& world)
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(world.addCollisionObject("static_box", 0, shapes, shape_poses, Eigen::Isometry3d::Identity()));
+  EXPECT_TRUE(world.hasCollisionObject("static_box"));
+  EXPECT_FALSE(world.hasCollisionObject("missing_link"));
+  EXPECT_EQ(world.getCollisionObjects().size(), 1);
+
+  // Objects without shapes are not added
+  EXPECT_FALSE(world.addCollisionObject("empty_link", 0, {}, {}, Eigen::Isometry3d::Identity()));
+}
+
+/**
+ * @brief Check the contacts of a contact manager with the objects of an attached static collision world
+ * @param checker The contact manager, which must have a world populated by addStaticWorldObjects attached
+ */
+inline void runTest(DiscreteContactManager& checker)
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, shapes, shape_poses);
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setDefaultCollisionMarginData(0.5);
+
+  // The objects of the world are not objects of the manager
+  EXPECT_EQ(checker.getCollisionObjects().size(), 1);
+  EXPECT_FALSE(checker.hasCollisionObject("static_box"));
+
+  auto check = [&checker](double x, long expected_contacts, double expected_distance) {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(x, 0, 0);
+    checker.setCollisionObjectsTransform("sphere_link", pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_EQ(result.numContacts(), expected_contacts);
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+    if (expected_contacts > 0)
+    {
+      EXPECT_NEAR(result_vector[0].distance, expected_distance, 1e-3);
+      const std::size_t static_side = (result_vector[0].link_names[0] == "static_box") ? 0 : 1;
+      EXPECT_EQ(result_vector[0].link_names[static_side], "static_box");
+      EXPECT_EQ(result_vector[0].link_names[1 - static_side], "sphere_link");
+    }
+  };
+
+  // In collision with the box
+  check(0.6, 1, -0.15);
+
+  // Within the margin of the box
+  check(1.0, 1, 0.25);
+
+  // Outside of the margin of the box
+  check(1.5, 0, 0);
+
+  // Contacts with the objects of the world follow the allowed collision function
+  checker.setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  check(0.6, 0, 0);
+  checker.setIsContactAllowedFn(nullptr);
+
+  // Disabled objects are not checked against the world
+  checker.disableCollisionObject("sphere_link");
+  check(0.6, 0, 0);
+  checker.enableCollisionObject("sphere_link");
+
+  // A clone shares the world
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.6, 0, 0);
+  cloned_checker->setCollisionObjectsTransform("sphere_link", pose);
+
+  ContactResultMap result;
+  cloned_checker->contactTest(result, ContactRequest(ContactTestType::FIRST));
+  EXPECT_EQ(result.numContacts(), 1);
+}
+}  // namespace tesseract_collision::test_suite
+
+#endif  // TESSERACT_COLLISION_COLLISION_STATIC_WORLD_UNIT_HPP
@@ -0,0 +1,119 @@
+/**
+ * @file aabb_soa.cpp
+ * @brief Axis aligned bounding boxes stored as a structure of arrays for batched overlap tests
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/aabb_soa.h>
+
+namespace tesseract_collision
+{
+void AABBSoA::clear()
+{
+  min_x_.clear();
+  min_y_.clear();
+  min_z_.clear();
+  max_x_.clear();
+  max_y_.clear();
+  max_z_.clear();
+}
+
+void AABBSoA::reserve(std::size_t size)
+{
+  min_x_.reserve(size);
+  min_y_.reserve(size);
+  min_z_.reserve(size);
+  max_x_.reserve(size);
+  max_y_.reserve(size);
+  max_z_.reserve(size);
+}
+
+void AABBSoA::push_back(const Eigen::Vector3d& aabb_min, const Eigen::Vector3d& aabb_max)  // NOLINT
+{
+  min_x_.push_back(aabb_min.x());
+  min_y_.push_back(aabb_min.y());
+  min_z_.push_back(aabb_min.z());
+  max_x_.push_back(aabb_max.x());
+  max_y_.push_back(aabb_max.y());
+  max_z_.push_back(aabb_max.z());
+}
+
+Eigen::Vector3d AABBSoA::getMin(std::size_t index) const
+{
+  return { min_x_[index], min_y_[index], min_z_[index] };
+}
+
+Eigen::Vector3d AABBSoA::getMax(std::size_t index) const
+{
+  return { max_x_[index], max_y_[index], max_z_[index] };
+}
+
+double AABBSoA::separation(std::size_t index1, std::size_t index2) const
+{
+  double separation = std::max(min_x_[index2] - max_x_[index1], min_x_[index1] - max_x_[index2]);
+  separation = std::max(separation, std::max(min_y_[index2] - max_y_[index1], min_y_[index1] - max_y_[index2]));
+  return std::max(separation, std::max(min_z_[index2] - max_z_[index1], min_z_[index1] - max_z_[index2]));
+}
+
+void AABBSoA::separations(const Eigen::Vector3d& aabb_min,
+                          const Eigen::Vector3d& aabb_max,
+                          std::size_t begin,
+                          std::size_t end,
+                          std::vector<double>& result) const
+{
+  const std::size_t count = (end > begin) ? end - begin : 0;
+  result.resize(count);
+
+  // Comparisons of doubles may trap so the compiler does not vectorize them, std::max maps to a packed max instruction
+  const double* min_x = min_x_.data() + begin;
+  const double* min_y = min_y_.data() + begin;
+  const double* min_z = min_z_.data() + begin;
+  const double* max_x = max_x_.data() + begin;
+  const double* max_y = max_y_.data() + begin;
+  const double* max_z = max_z_.data() + begin;
+  double* out = result.data();
+
+  const double q_min_x = aabb_min.x();
+  const double q_min_y = aabb_min.y();
+  const double q_min_z = aabb_min.z();
+  const double q_max_x = aabb_max.x();
+  const double q_max_y = aabb_max.y();
+  const double q_max_z = aabb_max.z();
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    double separation = std::max(min_x[i] - q_max_x, q_min_x - max_x[i]);
+    separation = std::max(separation, std::max(min_y[i] - q_max_y, q_min_y - max_y[i]));
+    out[i] = std::max(separation, std::max(min_z[i] - q_max_z, q_min_z - max_z[i]));
+  }
+}
+
+void AABBSoA::separations(std::size_t index, std::size_t begin, std::size_t end, std::vector<double>& result) const
+{
+  separations(getMin(index), getMax(index), begin, end, result);
+}
+
+}  // namespace tesseract_collision
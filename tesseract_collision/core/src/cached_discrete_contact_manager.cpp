@@ -0,0 +1,488 @@
+/**
+ * @file cached_discrete_contact_manager.cpp
+ * @brief A discrete contact manager which caches the contact results of recently checked states
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/cached_discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_collision
+{
+namespace
+{
+/** @brief Quantize a value to the provided tolerance, a tolerance of zero or less uses the exact value */
+std::int64_t quantize(double value, double tolerance)
+{
+  if (tolerance > 0)
+    return static_cast<std::int64_t>(std::llround(value / tolerance));
+
+  // Treat negative zero the same as zero
+  if (value == 0)
+    value = 0;
+
+  std::int64_t bits{ 0 };
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+/** @brief Estimate the memory in bytes used by contact results */
+std::size_t estimateMemory(const ContactResultMap& results)
+{
+  // Approximate overhead of a node in the underlying map
+  constexpr std::size_t node_overhead = 4 * sizeof(void*);
+
+  std::size_t memory{ 0 };
+  for (const auto& pair : results.getContainer())
+  {
+    memory += sizeof(ContactResultMap::value_type) + node_overhead;
+    memory += pair.first.first.capacity() + pair.first.second.capacity();
+    memory += pair.second.capacity() * sizeof(ContactResult);
+    for (const auto& r : pair.second)
+      memory += r.link_names[0].capacity() + r.link_names[1].capacity();
+  }
+  return memory;
+}
+
+/**
+ * @brief Add the cached results to the provided results the same way the contact managers do
+ * @details Only the closest contact is kept per pair for ContactTestType::CLOSEST, otherwise the contacts are appended
+ */
+void appendResults(ContactResultMap& collisions, const ContactResultMap& results, ContactTestType type)
+{
+  for (const auto& pair : results)
+  {
+    auto& dst = collisions[pair.first];
+    if (type == ContactTestType::CLOSEST && !dst.empty())
+    {
+      const ContactResult& closest = pair.second.front();
+      if (closest.distance < dst.front().distance)
+        dst.front() = closest;
+
+      continue;
+    }
+
+    dst.insert(dst.end(), pair.second.begin(), pair.second.end());
+  }
+}
+}  // namespace
+
+std::size_t CachedDiscreteContactManager::CacheKeyHash::operator()(const CacheKey& key) const
+{
+  std::size_t seed = key.size();
+  for (const auto& v : key)
+    seed ^= std::hash<std::int64_t>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+  return seed;
+}
+
+CachedDiscreteContactManager::CachedDiscreteContactManager(DiscreteContactManager::UPtr manager,
+                                                           std::size_t memory_budget,
+                                                           double linear_tolerance,
+                                                           double angular_tolerance)
+  : manager_(std::move(manager))
+  , memory_budget_(memory_budget)
+  , linear_tolerance_(linear_tolerance)
+  , angular_tolerance_(angular_tolerance)
+{
+  if (manager_ == nullptr)
+    throw std::runtime_error("CachedDiscreteContactManager, the provided contact manager is a nullptr!");
+
+  transforms_.resize(manager_->getCollisionObjects().size(), Eigen::Isometry3d::Identity());
+  updateActiveHandles();
+}
+
+std::string CachedDiscreteContactManager::getName() const { return manager_->getName(); }
+
+DiscreteContactManager::UPtr CachedDiscreteContactManager::clone() const
+{
+  TESSERACT_TRACE_ZONE("CachedDiscreteContactManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("CachedDiscreteContactManager");
+  clones.increment();
+  auto manager = std::make_unique<CachedDiscreteContactManager>(
+      manager_->clone(), memory_budget_, linear_tolerance_, angular_tolerance_);
+  manager->transforms_ = transforms_;
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
+  return manager;
+}
+
+bool CachedDiscreteContactManager::addCollisionObject(const std::string& name,
+                                                      const int& mask_id,
+                                                      const CollisionShapesConst& shapes,
+                                                      const tesseract_common::VectorIsometry3d& shape_poses,
+                                                      bool enabled)
+{
+  // An existing object with the same name is removed first, which moves it to the end of the handles. It stays
+  // removed if the new object could not be added.
+  int handle = manager_->getCollisionObjectHandle(name);
+  const bool added = manager_->addCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  const bool removed = (handle >= 0 && (added || !manager_->hasCollisionObject(name)));
+  if (!added && !removed)
+    return false;
+
+  if (removed && handle < static_cast<int>(transforms_.size()))
+    transforms_.erase(std::next(transforms_.begin(), handle));
+
+  transforms_.resize(manager_->getCollisionObjects().size(), Eigen::Isometry3d::Identity());
+  updateActiveHandles();
+  clearCache();
+  return added;
+}
+
+const CollisionShapesConst& CachedDiscreteContactManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometries(name);
+}
+
+const tesseract_common::VectorIsometry3d&
+CachedDiscreteContactManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometriesTransforms(name);
+}
+
+bool CachedDiscreteContactManager::hasCollisionObject(const std::string& name) const
+{
+  return manager_->hasCollisionObject(name);
+}
+
+bool CachedDiscreteContactManager::removeCollisionObject(const std::string& name)
+{
+  int handle = manager_->getCollisionObjectHandle(name);
+  if (!manager_->removeCollisionObject(name))
+    return false;
+
+  if (handle >= 0 && handle < static_cast<int>(transforms_.size()))
+    transforms_.erase(std::next(transforms_.begin(), handle));
+
+  transforms_.resize(manager_->getCollisionObjects().size(), Eigen::Isometry3d::Identity());
+  updateActiveHandles();
+  clearCache();
+  return true;
+}
+
+bool CachedDiscreteContactManager::enableCollisionObject(const std::string& name)
+{
+  if (!manager_->enableCollisionObject(name))
+    return false;
+
+  clearCache();
+  return true;
+}
+
+bool CachedDiscreteContactManager::disableCollisionObject(const std::string& name)
+{
+  if (!manager_->disableCollisionObject(name))
+    return false;
+
+  clearCache();
+  return true;
+}
+
+bool CachedDiscreteContactManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  return manager_->isCollisionObjectEnabled(name);
+}
+
+int CachedDiscreteContactManager::getCollisionObjectHandle(const std::string& name) const
+{
+  return manager_->getCollisionObjectHandle(name);
+}
+
+bool CachedDiscreteContactManager::enableCollisionObject(int handle)
+{
+  if (!manager_->enableCollisionObject(handle))
+    return false;
+
+  clearCache();
+  return true;
+}
+
+bool CachedDiscreteContactManager::disableCollisionObject(int handle)
+{
+  if (!manager_->disableCollisionObject(handle))
+    return false;
+
+  clearCache();
+  return true;
+}
+
+void CachedDiscreteContactManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(manager_->getCollisionObjectHandle(name), pose);
+}
+
+void CachedDiscreteContactManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(transforms_.size()))
+    return;
+
+  manager_->setCollisionObjectsTransform(handle, pose);
+
+  // Only the transforms of the active objects are part of the key
+  auto h = static_cast<std::size_t>(handle);
+  if (!is_active_[h] && transforms_[h].matrix() != pose.matrix())
+    clearCache();
+
+  transforms_[h] = pose;
+}
+
+void CachedDiscreteContactManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                                const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void CachedDiscreteContactManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+bool CachedDiscreteContactManager::updateCollisionObjectOctree(const std::string& name,
+                                                               std::size_t shape_index,
+                                                               const OctreeDelta& delta)
+{
+  if (!manager_->updateCollisionObjectOctree(name, shape_index, delta))
+    return false;
+
+  clearCache();
+  return true;
+}
+
+const std::vector<std::string>& CachedDiscreteContactManager::getCollisionObjects() const
+{
+  return manager_->getCollisionObjects();
+}
+
+void CachedDiscreteContactManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  manager_->setActiveCollisionObjects(names);
+  updateActiveHandles();
+  clearCache();
+}
+
+const std::vector<std::string>& CachedDiscreteContactManager::getActiveCollisionObjects() const
+{
+  return manager_->getActiveCollisionObjects();
+}
+
+void CachedDiscreteContactManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  manager_->setCollisionObjectsActive(names, active);
+  updateActiveHandles();
+  clearCache();
+}
+
+void CachedDiscreteContactManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                          CollisionMarginOverrideType override_type)
+{
+  manager_->setCollisionMarginData(std::move(collision_margin_data), override_type);
+  clearCache();
+}
+
+void CachedDiscreteContactManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  manager_->setDefaultCollisionMarginData(default_collision_margin);
+  clearCache();
+}
+
+void CachedDiscreteContactManager::setPairCollisionMarginData(const std::string& name1,
+                                                              const std::string& name2,
+                                                              double collision_margin)
+{
+  manager_->setPairCollisionMarginData(name1, name2, collision_margin);
+  clearCache();
+}
+
+const CollisionMarginData& CachedDiscreteContactManager::getCollisionMarginData() const
+{
+  return manager_->getCollisionMarginData();
+}
+
+void CachedDiscreteContactManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  manager_->setIsContactAllowedFn(std::move(fn));
+  clearCache();
+}
+
+IsContactAllowedFn CachedDiscreteContactManager::getIsContactAllowedFn() const
+{
+  return manager_->getIsContactAllowedFn();
+}
+
+void CachedDiscreteContactManager::setStatisticsEnabled(bool enabled) { manager_->setStatisticsEnabled(enabled); }
+
+bool CachedDiscreteContactManager::getStatisticsEnabled() const { return manager_->getStatisticsEnabled(); }
+
+ContactManagerStatistics CachedDiscreteContactManager::getStatistics() const { return manager_->getStatistics(); }
+
+void CachedDiscreteContactManager::clearStatistics() { manager_->clearStatistics(); }
+
+void CachedDiscreteContactManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_TRACE_ZONE("CachedDiscreteContactManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("CachedDiscreteContactManager");
+  const tesseract_common::MetricTimer timer(latency);
+  // The result of a user provided validation function cannot be cached
+  if (request.is_valid != nullptr)
+  {
+    manager_->contactTest(collisions, request);
+    return;
+  }
+
+  const ContactResultMap* results{ nullptr };
+  buildKey(request);
+  auto it = lookup_.find(key_);
+  if (it != lookup_.end())
+  {
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    results = &it->second->results;
+  }
+  else
+  {
+    ++misses_;
+    CacheEntry entry;
+    manager_->contactTest(entry.results, request);
+    entry.memory = estimateMemory(entry.results) + sizeof(CacheEntry) + (2 * key_.capacity() * sizeof(std::int64_t));
+    if (entry.memory > memory_budget_)
+    {
+      // The results do not fit in the cache so they are returned without being stored
+      appendResults(collisions, entry.results, request.type);
+      return;
+    }
+
+    entry.key = key_;
+    memory_usage_ += entry.memory;
+    entries_.push_front(std::move(entry));
+    lookup_[key_] = entries_.begin();
+    results = &entries_.front().results;
+    evict();
+  }
+
+  appendResults(collisions, *results, request.type);
+}
+
+DiscreteContactManager& CachedDiscreteContactManager::getManager() { return *manager_; }
+const DiscreteContactManager& CachedDiscreteContactManager::getManager() const { return *manager_; }
+
+void CachedDiscreteContactManager::setCacheTolerance(double linear_tolerance, double angular_tolerance)
+{
+  linear_tolerance_ = linear_tolerance;
+  angular_tolerance_ = angular_tolerance;
+  clearCache();
+}
+
+double CachedDiscreteContactManager::getCacheLinearTolerance() const { return linear_tolerance_; }
+
+double CachedDiscreteContactManager::getCacheAngularTolerance() const { return angular_tolerance_; }
+
+void CachedDiscreteContactManager::setCacheMemoryBudget(std::size_t memory_budget)
+{
+  memory_budget_ = memory_budget;
+  evict();
+}
+
+std::size_t CachedDiscreteContactManager::getCacheMemoryBudget() const { return memory_budget_; }
+
+std::size_t CachedDiscreteContactManager::getCacheMemoryUsage() const { return memory_usage_; }
+
+std::size_t CachedDiscreteContactManager::getCacheSize() const { return entries_.size(); }
+
+std::size_t CachedDiscreteContactManager::getCacheHits() const { return hits_; }
+
+std::size_t CachedDiscreteContactManager::getCacheMisses() const { return misses_; }
+
+void CachedDiscreteContactManager::clearCache()
+{
+  lookup_.clear();
+  entries_.clear();
+  memory_usage_ = 0;
+}
+
+void CachedDiscreteContactManager::resetCacheStatistics()
+{
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void CachedDiscreteContactManager::updateActiveHandles()
+{
+  const std::vector<std::string>& names = manager_->getCollisionObjects();
+  const std::vector<std::string>& active = manager_->getActiveCollisionObjects();
+
+  is_active_.assign(names.size(), false);
+  active_handles_.clear();
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    if (std::find(active.begin(), active.end(), names[i]) != active.end())
+    {
+      is_active_[i] = true;
+      active_handles_.push_back(static_cast<int>(i));
+    }
+  }
+}
+
+void CachedDiscreteContactManager::buildKey(const ContactRequest& request)
+{
+  key_.clear();
+  key_.reserve(5 + (active_handles_.size() * 12));
+  key_.push_back(static_cast<std::int64_t>(request.type));
+  key_.push_back(static_cast<std::int64_t>(request.calculate_penetration));
+  key_.push_back(static_cast<std::int64_t>(request.calculate_distance));
+  key_.push_back(static_cast<std::int64_t>(request.contact_limit));
+  key_.push_back(static_cast<std::int64_t>(request.detail));
+
+  for (const auto& handle : active_handles_)
+  {
+    const Eigen::Isometry3d& tf = transforms_[static_cast<std::size_t>(handle)];
+    for (Eigen::Index i = 0; i < 3; ++i)
+      key_.push_back(quantize(tf.translation()(i), linear_tolerance_));
+
+    for (Eigen::Index c = 0; c < 3; ++c)
+      for (Eigen::Index r = 0; r < 3; ++r)
+        key_.push_back(quantize(tf.linear()(r, c), angular_tolerance_));
+  }
+}
+
+void CachedDiscreteContactManager::evict()
+{
+  while (memory_usage_ > memory_budget_ && !entries_.empty())
+  {
+    const CacheEntry& entry = entries_.back();
+    memory_usage_ -= entry.memory;
+    lookup_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace tesseract_collision
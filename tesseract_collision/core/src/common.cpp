@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <cmath>
+#include <limits>
 #include <boost/algorithm/string.hpp>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -56,7 +58,7 @@ std::vector<ObjectPairKey> getCollisionObjectPairs(const std::vector<std::string
   clp.reserve(num_pairs);
 
   // Create active to active pairs
-  for (std::size_t i = 0; i < active_links.size() - 1; ++i)
+  for (std::size_t i = 0; i + 1 < active_links.size(); ++i)
   {
     const std::string& l1 = active_links[i];
     for (std::size_t j = i + 1; j < active_links.size(); ++j)
@@ -109,6 +111,25 @@ bool isContactAllowed(const std::string& name1, const std::string& name2, const
   return false;
 }
 
+tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr
+getCompiledAllowedCollisionMatrix(const IsContactAllowedFn& acm)
+{
+  const auto* fn = acm.target<CompiledAllowedCollisionMatrixFn>();
+  if (fn == nullptr || fn->acm == nullptr)
+    return nullptr;
+
+  return *fn->acm;
+}
+
+namespace
+{
+/** @brief Check if the results hold the number of contacts the request is limited to */
+bool isContactLimitReached(const ContactTestData& cdata)
+{
+  return (cdata.req.contact_limit > 0 && cdata.res->numContacts() >= cdata.req.contact_limit);
+}
+}  // namespace
+
 ContactResult* processResult(ContactTestData& cdata,
                              ContactResult& contact,
                              const std::pair<std::string, std::string>& key,
@@ -123,19 +144,14 @@ ContactResult* processResult(ContactTestData& cdata,
 
   if (!found)
   {
-    ContactResultVector data;
-    if (cdata.req.type == ContactTestType::FIRST)
-    {
-      data.emplace_back(contact);
+    // This reuses the storage of the pair if it was cleared from a previous contact test
+    ContactResultVector& data = (*cdata.res)[key];
+    data.emplace_back(contact);
+
+    if (cdata.req.type == ContactTestType::FIRST || isContactLimitReached(cdata))
       cdata.done = true;
-    }
-    else
-    {
-      data.reserve(100);  // TODO: Need better way to initialize this
-      data.emplace_back(contact);
-    }
 
-    return &(cdata.res->insert(std::make_pair(key, data)).first->second.back());
+    return &(data.back());
   }
 
   assert(cdata.req.type != ContactTestType::FIRST);
@@ -143,6 +159,9 @@ ContactResult* processResult(ContactTestData& cdata,
   if (cdata.req.type == ContactTestType::ALL)
   {
     dr.emplace_back(contact);
+    if (isContactLimitReached(cdata))
+      cdata.done = true;
+
     return &(dr.back());
   }
 
@@ -436,4 +455,206 @@ int loadSimplePlyFile(const std::string& path,
   return static_cast<int>(num_faces);
 }
 
+
+void applyOctreeDelta(octomap::OcTree& octree, const OctreeDelta& delta)
+{
+  for (const auto& key : delta.occupied)
+    octree.setNodeValue(key, octree.getClampingThresMaxLog());
+
+  for (const auto& key : delta.free)
+    octree.setNodeValue(key, octree.getClampingThresMinLog());
+}
+
+bool calcOctreeOccupiedAABB(Eigen::Vector3d& aabb_min,
+                            Eigen::Vector3d& aabb_max,
+                            const octomap::OcTree& octree,
+                            double cell_scale)
+{
+  aabb_min.setConstant(std::numeric_limits<double>::max());
+  aabb_max.setConstant(-std::numeric_limits<double>::max());
+
+  const double occupancy_threshold = octree.getOccupancyThres();
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() >= occupancy_threshold)
+    {
+      const double extent = cell_scale * it.getSize() / 2.0;
+      const Eigen::Vector3d center(it.getX(), it.getY(), it.getZ());
+      aabb_min = aabb_min.cwiseMin((center.array() - extent).matrix());
+      aabb_max = aabb_max.cwiseMax((center.array() + extent).matrix());
+    }
+  }
+
+  if (aabb_min.x() > aabb_max.x())
+  {
+    aabb_min.setZero();
+    aabb_max.setZero();
+    return false;
+  }
+
+  return true;
+}
+
+bool updateOctreeOccupiedAABB(Eigen::Vector3d& aabb_min,
+                              Eigen::Vector3d& aabb_max,
+                              const octomap::OcTree& octree,
+                              const OctreeDelta& delta,
+                              double cell_scale)
+{
+  // There are no occupied cells to define the box so it must be calculated from the whole octree
+  if (aabb_min == aabb_max)
+    return calcOctreeOccupiedAABB(aabb_min, aabb_max, octree, cell_scale);
+
+  const double extent = cell_scale * octree.getResolution() / 2.0;
+  const double tolerance = 1e-3 * extent;
+
+  // Only the cells touching the box define it, so a free cell inside of it does not change it
+  for (const auto& key : delta.free)
+  {
+    const octomap::point3d c = octree.keyToCoord(key);
+    const Eigen::Vector3d center(c.x(), c.y(), c.z());
+    if (((center.array() - extent) <= (aabb_min.array() + tolerance)).any() ||
+        ((center.array() + extent) >= (aabb_max.array() - tolerance)).any())
+      return calcOctreeOccupiedAABB(aabb_min, aabb_max, octree, cell_scale);
+  }
+
+  const double occupancy_threshold = octree.getOccupancyThres();
+  for (const auto& key : delta.occupied)
+  {
+    const octomap::OcTreeNode* node = octree.search(key);
+    if (node == nullptr || node->getOccupancy() < occupancy_threshold)
+      continue;
+
+    const octomap::point3d c = octree.keyToCoord(key);
+    const Eigen::Vector3d center(c.x(), c.y(), c.z());
+    aabb_min = aabb_min.cwiseMin((center.array() - extent).matrix());
+    aabb_max = aabb_max.cwiseMax((center.array() + extent).matrix());
+  }
+
+  return true;
+}
+
+Eigen::AlignedBox3d calcCollisionObjectAABB(const CollisionShapesConst& shapes,
+                                            const tesseract_common::VectorIsometry3d& shape_poses)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const Eigen::AlignedBox3d infinite_aabb(Eigen::Vector3d::Constant(-inf), Eigen::Vector3d::Constant(inf));
+
+  Eigen::AlignedBox3d aabb;
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    Eigen::Vector3d half_extents;
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::BOX:
+      {
+        const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+        half_extents = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ());
+        break;
+      }
+      case tesseract_geometry::GeometryType::SPHERE:
+      {
+        half_extents.setConstant(static_cast<const tesseract_geometry::Sphere&>(shape).getRadius());
+        break;
+      }
+      case tesseract_geometry::GeometryType::CYLINDER:
+      {
+        const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+        half_extents = Eigen::Vector3d(cylinder.getRadius(), cylinder.getRadius(), cylinder.getLength() / 2.0);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+        half_extents = Eigen::Vector3d(cone.getRadius(), cone.getRadius(), cone.getLength() / 2.0);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+        half_extents = Eigen::Vector3d(
+            capsule.getRadius(), capsule.getRadius(), capsule.getRadius() + (capsule.getLength() / 2.0));
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        const auto vertices = static_cast<const tesseract_geometry::PolygonMesh&>(shape).getVertexMap();
+        if (vertices.cols() == 0)
+          continue;
+
+        const Eigen::Vector3d vertex_min = vertices.rowwise().minCoeff();
+        const Eigen::Vector3d vertex_max = vertices.rowwise().maxCoeff();
+        center = 0.5 * (vertex_min + vertex_max);
+        half_extents = 0.5 * (vertex_max - vertex_min);
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        // The shapes of the cells, like spheres outside of the cell, may extend past the cells
+        const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+        Eigen::Vector3d octree_min, octree_max;
+        if (!calcOctreeOccupiedAABB(octree_min, octree_max, *octree.getOctree(), std::sqrt(3.0)))
+          continue;
+
+        center = 0.5 * (octree_min + octree_max);
+        half_extents = 0.5 * (octree_max - octree_min);
+        break;
+      }
+      case tesseract_geometry::GeometryType::POINT_CLOUD:
+      {
+        const auto& cloud = static_cast<const tesseract_geometry::PointCloud&>(shape);
+        if (cloud.getPointCount() == 0)
+          continue;
+
+        Eigen::Vector3d point_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+        Eigen::Vector3d point_max = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+        for (const auto& point : *cloud.getPoints())
+        {
+          point_min = point_min.cwiseMin(point);
+          point_max = point_max.cwiseMax(point);
+        }
+
+        center = 0.5 * (point_min + point_max);
+        half_extents = (0.5 * (point_max - point_min)).array() + cloud.getPointRadius();
+        break;
+      }
+      default:
+        return infinite_aabb;
+    }
+
+    aabb.extend(transformAABB(Eigen::AlignedBox3d(center - half_extents, center + half_extents), shape_poses[i]));
+  }
+
+  return aabb;
+}
+
+Eigen::AlignedBox3d transformAABB(const Eigen::AlignedBox3d& aabb, const Eigen::Isometry3d& transform)
+{
+  if (aabb.isEmpty() || !aabb.min().allFinite() || !aabb.max().allFinite())
+    return aabb;
+
+  const Eigen::Vector3d center = transform * aabb.center();
+  const Eigen::Vector3d half_extents = transform.linear().cwiseAbs() * (0.5 * aabb.sizes());
+  return { center - half_extents, center + half_extents };
+}
+
+tesseract_common::MetricHistogram& getContactTestLatencyMetric(const std::string& manager_type)
+{
+  return tesseract_common::MetricsRegistry::getInstance().getHistogram("tesseract_contact_test_seconds",
+                                                                       "The latency of contact manager contact tests",
+                                                                       { { "manager", manager_type } });
+}
+
+tesseract_common::MetricCounter& getContactManagerCloneMetric(const std::string& manager_type)
+{
+  return tesseract_common::MetricsRegistry::getInstance().getCounter("tesseract_contact_manager_clones_total",
+                                                                     "The number of contact manager clones",
+                                                                     { { "manager", manager_type } });
+}
+
 }  // namespace tesseract_collision
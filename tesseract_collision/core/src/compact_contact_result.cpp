@@ -0,0 +1,221 @@
+/**
+ * @file compact_contact_result.cpp
+ * @brief A compact storage of contact results for high volume queries
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/compact_contact_result.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision
+{
+template <typename FloatType>
+CompactContactResults<FloatType>::CompactContactResults(ContactResultDetail detail) : detail_(detail)
+{
+}
+
+template <typename FloatType>
+ContactResultDetail CompactContactResults<FloatType>::getDetail() const
+{
+  return detail_;
+}
+
+template <typename FloatType>
+void CompactContactResults<FloatType>::append(const ContactResult& result)
+{
+  if (result.link_handles[0] < 0 || result.link_handles[1] < 0)
+    throw std::runtime_error("CompactContactResults, the contact result between '" + result.link_names[0] + "' and '" +
+                             result.link_names[1] + "' does not have link handles!");
+
+  Contact contact;
+  contact.distance = static_cast<FloatType>(result.distance);
+  contact.link_handles = result.link_handles;
+  contact.shape_id = result.shape_id;
+  contact.subshape_id = result.subshape_id;
+  contacts_.push_back(contact);
+
+  if (hasNormals())
+    normals_.push_back(result.normal.cast<FloatType>());
+
+  if (hasFullData())
+  {
+    nearest_points_.push_back(
+        { result.nearest_points[0].cast<FloatType>(), result.nearest_points[1].cast<FloatType>() });
+    cc_time_.push_back({ static_cast<FloatType>(result.cc_time[0]), static_cast<FloatType>(result.cc_time[1]) });
+    cc_type_.push_back(result.cc_type);
+  }
+}
+
+template <typename FloatType>
+void CompactContactResults<FloatType>::append(const ContactResultMap& results)
+{
+  reserve(contacts_.size() + static_cast<std::size_t>(results.numContacts()));
+  for (const auto& pair : results)
+  {
+    for (const auto& result : pair.second)
+      append(result);
+  }
+}
+
+template <typename FloatType>
+std::size_t CompactContactResults<FloatType>::size() const
+{
+  return contacts_.size();
+}
+
+template <typename FloatType>
+bool CompactContactResults<FloatType>::empty() const
+{
+  return contacts_.empty();
+}
+
+template <typename FloatType>
+void CompactContactResults<FloatType>::clear()
+{
+  contacts_.clear();
+  normals_.clear();
+  nearest_points_.clear();
+  cc_time_.clear();
+  cc_type_.clear();
+}
+
+template <typename FloatType>
+void CompactContactResults<FloatType>::reserve(std::size_t size)
+{
+  contacts_.reserve(size);
+  if (hasNormals())
+    normals_.reserve(size);
+
+  if (hasFullData())
+  {
+    nearest_points_.reserve(size);
+    cc_time_.reserve(size);
+    cc_type_.reserve(size);
+  }
+}
+
+template <typename FloatType>
+const typename CompactContactResults<FloatType>::Contact&
+CompactContactResults<FloatType>::operator[](std::size_t index) const
+{
+  return contacts_[index];
+}
+
+template <typename FloatType>
+const typename CompactContactResults<FloatType>::Vector3&
+CompactContactResults<FloatType>::getNormal(std::size_t index) const
+{
+  if (!hasNormals())
+    throw std::runtime_error("CompactContactResults, the normals are not stored with detail BINARY!");
+
+  return normals_.at(index);
+}
+
+template <typename FloatType>
+const std::array<typename CompactContactResults<FloatType>::Vector3, 2>&
+CompactContactResults<FloatType>::getNearestPoints(std::size_t index) const
+{
+  if (!hasFullData())
+    throw std::runtime_error("CompactContactResults, the nearest points are only stored with detail FULL!");
+
+  return nearest_points_.at(index);
+}
+
+template <typename FloatType>
+const std::array<FloatType, 2>& CompactContactResults<FloatType>::getContinuousContactTime(std::size_t index) const
+{
+  if (!hasFullData())
+    throw std::runtime_error("CompactContactResults, the continuous contact time is only stored with detail FULL!");
+
+  return cc_time_.at(index);
+}
+
+template <typename FloatType>
+const std::array<ContinuousCollisionType, 2>&
+CompactContactResults<FloatType>::getContinuousContactType(std::size_t index) const
+{
+  if (!hasFullData())
+    throw std::runtime_error("CompactContactResults, the continuous contact type is only stored with detail FULL!");
+
+  return cc_type_.at(index);
+}
+
+template <typename FloatType>
+ContactResult CompactContactResults<FloatType>::toContactResult(std::size_t index,
+                                                                const std::vector<std::string>& link_names) const
+{
+  const Contact& contact = contacts_.at(index);
+
+  ContactResult result;
+  result.distance = static_cast<double>(contact.distance);
+  result.link_handles = contact.link_handles;
+  result.link_names[0] = link_names.at(static_cast<std::size_t>(contact.link_handles[0]));
+  result.link_names[1] = link_names.at(static_cast<std::size_t>(contact.link_handles[1]));
+  result.shape_id = contact.shape_id;
+  result.subshape_id = contact.subshape_id;
+
+  if (hasNormals())
+    result.normal = normals_[index].template cast<double>();
+
+  if (hasFullData())
+  {
+    result.nearest_points[0] = nearest_points_[index][0].template cast<double>();
+    result.nearest_points[1] = nearest_points_[index][1].template cast<double>();
+    result.cc_time[0] = static_cast<double>(cc_time_[index][0]);
+    result.cc_time[1] = static_cast<double>(cc_time_[index][1]);
+    result.cc_type = cc_type_[index];
+  }
+
+  return result;
+}
+
+template <typename FloatType>
+void CompactContactResults<FloatType>::toContactResultMap(ContactResultMap& results,
+                                                          const std::vector<std::string>& link_names) const
+{
+  for (std::size_t i = 0; i < contacts_.size(); ++i)
+  {
+    ContactResult result = toContactResult(i, link_names);
+    results[getObjectPairKey(result.link_names[0], result.link_names[1])].push_back(std::move(result));
+  }
+}
+
+template <typename FloatType>
+bool CompactContactResults<FloatType>::hasNormals() const
+{
+  return (detail_ != ContactResultDetail::BINARY);
+}
+
+template <typename FloatType>
+bool CompactContactResults<FloatType>::hasFullData() const
+{
+  return (detail_ == ContactResultDetail::FULL);
+}
+
+template class CompactContactResults<double>;
+template class CompactContactResults<float>;
+}  // namespace tesseract_collision
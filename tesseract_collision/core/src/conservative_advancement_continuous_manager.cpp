@@ -0,0 +1,553 @@
+/**
+ * @file conservative_advancement_continuous_manager.cpp
+ * @brief A continuous contact manager using conservative advancement on a discrete contact manager
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/conservative_advancement_continuous_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_collision
+{
+namespace
+{
+/** @brief Calculate the radius of the bounding sphere of a shape about its origin */
+double calcShapeRadius(const tesseract_geometry::Geometry& shape)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      return 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ()).norm();
+    }
+    case tesseract_geometry::GeometryType::SPHERE:
+      return static_cast<const tesseract_geometry::Sphere&>(shape).getRadius();
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      return std::hypot(cylinder.getRadius(), cylinder.getLength() / 2.0);
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      return std::hypot(cone.getRadius(), cone.getLength() / 2.0);
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      return capsule.getRadius() + (capsule.getLength() / 2.0);
+    }
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+    {
+      const auto vertices = static_cast<const tesseract_geometry::PolygonMesh&>(shape).getVertexMap();
+      return (vertices.cols() > 0) ? vertices.colwise().norm().maxCoeff() : 0.0;
+    }
+    case tesseract_geometry::GeometryType::OCTREE:
+    {
+      const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+      Eigen::Vector3d aabb_min, aabb_max;
+      if (!calcOctreeOccupiedAABB(aabb_min, aabb_max, *octree.getOctree()))
+        return 0;
+
+      // Every corner of the box is at most this far from the origin
+      return aabb_min.cwiseAbs().cwiseMax(aabb_max.cwiseAbs()).norm();
+    }
+    case tesseract_geometry::GeometryType::POINT_CLOUD:
+    {
+      const auto& cloud = static_cast<const tesseract_geometry::PointCloud&>(shape);
+      double radius{ 0 };
+      for (const auto& point : *cloud.getPoints())
+        radius = std::max(radius, point.norm());
+
+      return radius + cloud.getPointRadius();
+    }
+    default:
+      return std::numeric_limits<double>::infinity();
+  }
+}
+
+/** @brief Calculate the radius of the bounding sphere of the shapes of a collision object about its origin */
+double calcCollisionObjectRadius(const CollisionShapesConst& shapes, const tesseract_common::VectorIsometry3d& poses)
+{
+  double radius{ 0 };
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+    radius = std::max(radius, poses[i].translation().norm() + calcShapeRadius(*shapes[i]));
+
+  return radius;
+}
+
+/** @brief Interpolate between two transforms, linearly for the translation and spherically for the rotation */
+Eigen::Isometry3d interpolate(const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2, double t)
+{
+  const Eigen::Quaterniond q1(pose1.linear());
+  const Eigen::Quaterniond q2(pose2.linear());
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.linear() = q1.slerp(t, q2).toRotationMatrix();
+  pose.translation() = ((1.0 - t) * pose1.translation()) + (t * pose2.translation());
+  return pose;
+}
+}  // namespace
+
+ConservativeAdvancementContinuousManager::ConservativeAdvancementContinuousManager(
+    DiscreteContactManager::UPtr manager,
+    double tolerance,
+    std::size_t max_iterations)
+  : manager_(std::move(manager)), tolerance_(tolerance), max_iterations_(max_iterations)
+{
+  if (manager_ == nullptr)
+    throw std::runtime_error("ConservativeAdvancementContinuousManager, the provided contact manager is a nullptr!");
+
+  margin_data_ = manager_->getCollisionMarginData();
+  for (const auto& name : manager_->getCollisionObjects())
+    addObject(name);
+}
+
+std::string ConservativeAdvancementContinuousManager::getName() const { return manager_->getName(); }
+
+ContinuousContactManager::UPtr ConservativeAdvancementContinuousManager::clone() const
+{
+  TESSERACT_TRACE_ZONE("ConservativeAdvancementContinuousManager::clone");
+  static tesseract_common::MetricCounter& clones =
+      getContactManagerCloneMetric("ConservativeAdvancementContinuousManager");
+  clones.increment();
+  auto manager =
+      std::make_unique<ConservativeAdvancementContinuousManager>(manager_->clone(), tolerance_, max_iterations_);
+  manager->margin_data_ = margin_data_;
+  manager->objects_ = objects_;
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
+  return manager;
+}
+
+bool ConservativeAdvancementContinuousManager::addCollisionObject(const std::string& name,
+                                                                  const int& mask_id,
+                                                                  const CollisionShapesConst& shapes,
+                                                                  const tesseract_common::VectorIsometry3d& shape_poses,
+                                                                  bool enabled)
+{
+  objects_.erase(name);
+  if (!manager_->addCollisionObject(name, mask_id, shapes, shape_poses, enabled))
+    return false;
+
+  addObject(name);
+  return true;
+}
+
+bool ConservativeAdvancementContinuousManager::addCollisionObjects(
+    const std::vector<std::string>& names,
+    const int& mask_id,
+    const std::vector<CollisionShapesConst>& shapes,
+    const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+    bool enabled)
+{
+  for (const auto& name : names)
+    objects_.erase(name);
+
+  const bool added = manager_->addCollisionObjects(names, mask_id, shapes, shape_poses, enabled);
+  for (const auto& name : names)
+  {
+    if (manager_->hasCollisionObject(name))
+      addObject(name);
+  }
+
+  return added;
+}
+
+const CollisionShapesConst&
+ConservativeAdvancementContinuousManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometries(name);
+}
+
+const tesseract_common::VectorIsometry3d&
+ConservativeAdvancementContinuousManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometriesTransforms(name);
+}
+
+bool ConservativeAdvancementContinuousManager::hasCollisionObject(const std::string& name) const
+{
+  return manager_->hasCollisionObject(name);
+}
+
+bool ConservativeAdvancementContinuousManager::removeCollisionObject(const std::string& name)
+{
+  objects_.erase(name);
+  return manager_->removeCollisionObject(name);
+}
+
+bool ConservativeAdvancementContinuousManager::enableCollisionObject(const std::string& name)
+{
+  return manager_->enableCollisionObject(name);
+}
+
+bool ConservativeAdvancementContinuousManager::disableCollisionObject(const std::string& name)
+{
+  return manager_->disableCollisionObject(name);
+}
+
+bool ConservativeAdvancementContinuousManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  return manager_->isCollisionObjectEnabled(name);
+}
+
+bool ConservativeAdvancementContinuousManager::getCollisionObjectTransform(const std::string& name,
+                                                                            Eigen::Isometry3d& pose) const
+{
+  auto it = objects_.find(name);
+  if (it == objects_.end())
+    return false;
+
+  pose = it->second.pose1;
+  return true;
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(const std::string& name,
+                                                                            const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(name, pose, pose);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(
+    const std::vector<std::string>& names,
+    const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i], poses[i]);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(
+    const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second, transform.second);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(const std::string& name,
+                                                                            const Eigen::Isometry3d& pose1,
+                                                                            const Eigen::Isometry3d& pose2)
+{
+  auto it = objects_.find(name);
+  if (it == objects_.end())
+    return;
+
+  it->second.pose1 = pose1;
+  it->second.pose2 = pose2;
+  manager_->setCollisionObjectsTransform(name, pose1);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(
+    const std::vector<std::string>& names,
+    const tesseract_common::VectorIsometry3d& pose1,
+    const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(names.size() == pose1.size());
+  assert(names.size() == pose2.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], pose1[i], pose2[i]);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsTransform(
+    const tesseract_common::TransformMap& pose1,
+    const tesseract_common::TransformMap& pose2)
+{
+  assert(pose1.size() == pose2.size());
+  for (const auto& transform : pose1)
+  {
+    auto it = pose2.find(transform.first);
+    assert(it != pose2.end());
+    setCollisionObjectsTransform(transform.first, transform.second, it->second);
+  }
+}
+
+bool ConservativeAdvancementContinuousManager::updateCollisionObjectOctree(const std::string& name,
+                                                                           std::size_t shape_index,
+                                                                           const OctreeDelta& delta)
+{
+  if (!manager_->updateCollisionObjectOctree(name, shape_index, delta))
+    return false;
+
+  // The occupied cells changed so the bounding sphere may have changed
+  auto it = objects_.find(name);
+  if (it != objects_.end())
+    it->second.radius = calcCollisionObjectRadius(manager_->getCollisionObjectGeometries(name),
+                                                  manager_->getCollisionObjectGeometriesTransforms(name));
+
+  return true;
+}
+
+const std::vector<std::string>& ConservativeAdvancementContinuousManager::getCollisionObjects() const
+{
+  return manager_->getCollisionObjects();
+}
+
+void ConservativeAdvancementContinuousManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  manager_->setActiveCollisionObjects(names);
+}
+
+const std::vector<std::string>& ConservativeAdvancementContinuousManager::getActiveCollisionObjects() const
+{
+  return manager_->getActiveCollisionObjects();
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionObjectsActive(const std::vector<std::string>& names,
+                                                                         bool active)
+{
+  manager_->setCollisionObjectsActive(names, active);
+}
+
+void ConservativeAdvancementContinuousManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                                      CollisionMarginOverrideType override_type)
+{
+  margin_data_.apply(collision_margin_data, override_type);
+  manager_->setCollisionMarginData(margin_data_);
+}
+
+void ConservativeAdvancementContinuousManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  margin_data_.setDefaultCollisionMargin(default_collision_margin);
+  manager_->setCollisionMarginData(margin_data_);
+}
+
+void ConservativeAdvancementContinuousManager::setPairCollisionMarginData(const std::string& name1,
+                                                                          const std::string& name2,
+                                                                          double collision_margin)
+{
+  margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+  manager_->setCollisionMarginData(margin_data_);
+}
+
+const CollisionMarginData& ConservativeAdvancementContinuousManager::getCollisionMarginData() const
+{
+  return margin_data_;
+}
+
+void ConservativeAdvancementContinuousManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  manager_->setIsContactAllowedFn(std::move(fn));
+}
+
+IsContactAllowedFn ConservativeAdvancementContinuousManager::getIsContactAllowedFn() const
+{
+  return manager_->getIsContactAllowedFn();
+}
+
+void ConservativeAdvancementContinuousManager::setStatisticsEnabled(bool enabled)
+{
+  manager_->setStatisticsEnabled(enabled);
+}
+
+bool ConservativeAdvancementContinuousManager::getStatisticsEnabled() const { return manager_->getStatisticsEnabled(); }
+
+ContactManagerStatistics ConservativeAdvancementContinuousManager::getStatistics() const
+{
+  return manager_->getStatistics();
+}
+
+void ConservativeAdvancementContinuousManager::clearStatistics() { manager_->clearStatistics(); }
+
+void ConservativeAdvancementContinuousManager::contactTest(ContactResultMap& collisions,
+                                                           const ContactRequest& request)
+{
+  TESSERACT_TRACE_ZONE("ConservativeAdvancementContinuousManager::contactTest");
+  static tesseract_common::MetricHistogram& latency =
+      getContactTestLatencyMetric("ConservativeAdvancementContinuousManager");
+  const tesseract_common::MetricTimer timer(latency);
+  const std::vector<std::string>& active = manager_->getActiveCollisionObjects();
+
+  // The bound of the distance each point of an active collision object moves over the whole motion
+  std::unordered_map<std::string, double> bounds;
+  double max_bound{ 0 };
+  double second_max_bound{ 0 };
+  for (const auto& name : active)
+  {
+    auto it = objects_.find(name);
+    if (it == objects_.end())
+      continue;
+
+    const CollisionObject& object = it->second;
+    const double angle = Eigen::AngleAxisd(object.pose1.linear().transpose() * object.pose2.linear()).angle();
+    double bound = (object.pose2.translation() - object.pose1.translation()).norm();
+    if (angle > 0)
+    {
+      if (!std::isfinite(object.radius))
+        throw std::runtime_error("ConservativeAdvancementContinuousManager, the motion of the rotating collision "
+                                 "object '" +
+                                 name + "' cannot be bounded!");
+
+      bound += angle * object.radius;
+    }
+
+    bounds[name] = bound;
+    if (bound > max_bound)
+    {
+      second_max_bound = max_bound;
+      max_bound = bound;
+    }
+    else if (bound > second_max_bound)
+    {
+      second_max_bound = bound;
+    }
+  }
+
+  auto getBound = [&bounds](const std::string& name) {
+    auto it = bounds.find(name);
+    return (it != bounds.end()) ? it->second : 0.0;
+  };
+
+  // The results are processed with the contact tolerance so pairs found within it are reported
+  CollisionMarginData result_margin_data = margin_data_;
+  result_margin_data.incrementMargins(tolerance_);
+  ContactTestData cdata(active, result_margin_data, manager_->getIsContactAllowedFn(), request, collisions);
+
+  // No pair closes its distance faster than the sum of the two largest bounds
+  const double max_pair_bound = max_bound + second_max_bound;
+  const ContactRequest distance_request(ContactTestType::CLOSEST);
+  std::set<ObjectPairKey> found;
+  ContactResultMap distances;
+  double t{ 0 };
+  std::size_t iteration{ 0 };
+  for (; iteration < max_iterations_; ++iteration)
+  {
+    for (const auto& name : active)
+    {
+      auto it = objects_.find(name);
+      if (it != objects_.end())
+        manager_->setCollisionObjectsTransform(name, interpolate(it->second.pose1, it->second.pose2, t));
+    }
+
+    // Only the pairs within the distance they can close over the rest of the motion can come in contact
+    CollisionMarginData distance_margin_data = margin_data_;
+    distance_margin_data.incrementMargins(tolerance_ + (max_pair_bound * (1.0 - t)));
+    manager_->setCollisionMarginData(distance_margin_data);
+
+    distances.clear();
+    manager_->contactTest(distances, distance_request);
+
+    double dt = std::numeric_limits<double>::infinity();
+    for (const auto& pair : distances)
+    {
+      if (found.find(pair.first) != found.end())
+        continue;
+
+      ContactResult contact = pair.second.front();
+      const double margin = margin_data_.getPairCollisionMargin(pair.first.first, pair.first.second);
+      if (contact.distance <= margin + tolerance_)
+      {
+        // The pair reached its collision margin at this time
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+          auto it = objects_.find(contact.link_names[i]);
+          if (it == objects_.end())
+            continue;
+
+          contact.transform[i] = it->second.pose1;
+          contact.cc_transform[i] = it->second.pose2;
+          if (isLinkActive(active, contact.link_names[i]))
+          {
+            contact.cc_time[i] = t;
+            if (t <= 0)
+              contact.cc_type[i] = ContinuousCollisionType::CCType_Time0;
+            else if (t >= 1)
+              contact.cc_type[i] = ContinuousCollisionType::CCType_Time1;
+            else
+              contact.cc_type[i] = ContinuousCollisionType::CCType_Between;
+          }
+        }
+
+        found.insert(pair.first);
+        processResult(cdata, contact, pair.first, collisions.find(pair.first) != collisions.end());
+        if (cdata.done)
+          break;
+
+        continue;
+      }
+
+      const double bound = getBound(pair.first.first) + getBound(pair.first.second);
+      if (bound > 0)
+        dt = std::min(dt, (contact.distance - margin) / bound);
+    }
+
+    if (cdata.done || t >= 1 || !std::isfinite(dt))
+      break;
+
+    t = std::min(1.0, t + dt);
+  }
+
+  if (iteration == max_iterations_)
+    CONSOLE_BRIDGE_logWarn("ConservativeAdvancementContinuousManager, reached the maximum number of iterations at time "
+                           "%f, contacts after this time are not reported",
+                           t);
+
+  // Restore the state of the wrapped manager
+  manager_->setCollisionMarginData(margin_data_);
+  for (const auto& name : active)
+  {
+    auto it = objects_.find(name);
+    if (it != objects_.end())
+      manager_->setCollisionObjectsTransform(name, it->second.pose1);
+  }
+}
+
+const DiscreteContactManager& ConservativeAdvancementContinuousManager::getManager() const { return *manager_; }
+
+void ConservativeAdvancementContinuousManager::setTolerance(double tolerance) { tolerance_ = tolerance; }
+
+double ConservativeAdvancementContinuousManager::getTolerance() const { return tolerance_; }
+
+void ConservativeAdvancementContinuousManager::setMaxIterations(std::size_t max_iterations)
+{
+  max_iterations_ = max_iterations;
+}
+
+std::size_t ConservativeAdvancementContinuousManager::getMaxIterations() const { return max_iterations_; }
+
+double ConservativeAdvancementContinuousManager::getCollisionObjectRadius(const std::string& name) const
+{
+  auto it = objects_.find(name);
+  return (it != objects_.end()) ? it->second.radius : 0;
+}
+
+void ConservativeAdvancementContinuousManager::addObject(const std::string& name)
+{
+  CollisionObject& object = objects_[name];
+  object.radius = calcCollisionObjectRadius(manager_->getCollisionObjectGeometries(name),
+                                            manager_->getCollisionObjectGeometriesTransforms(name));
+}
+
+}  // namespace tesseract_collision
@@ -24,15 +24,177 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/utils.h>
 
 namespace tesseract_collision
 {
+bool ContinuousContactManager::addCollisionObjects(const std::vector<std::string>& names,
+                                                   const int& mask_id,
+                                                   const std::vector<CollisionShapesConst>& shapes,
+                                                   const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                   bool enabled)
+{
+  if (shapes.size() != names.size() || shape_poses.size() != names.size())
+    throw std::runtime_error("ContinuousContactManager, addCollisionObjects number of shapes does not match names!");
+
+  bool added = true;
+  for (std::size_t i = 0; i < names.size(); ++i)
+    added = addCollisionObject(names[i], mask_id, shapes[i], shape_poses[i], enabled) && added;
+
+  return added;
+}
+
+bool ContinuousContactManager::getCollisionObjectTransform(const std::string& /*name*/,
+                                                           Eigen::Isometry3d& /*pose*/) const
+{
+  return false;
+}
+
+void ContinuousContactManager::setCollisionObjectsTransform(const tesseract_common::LinkTransforms& transforms)
+{
+  setCollisionObjectsTransform(transforms.getNames(), transforms.getTransforms());
+}
+
+void ContinuousContactManager::setCollisionObjectsTransform(const tesseract_common::LinkTransforms& pose1,
+                                                            const tesseract_common::LinkTransforms& pose2)
+{
+  if (pose1.getNameTable() != pose2.getNameTable() && pose1.getNames() != pose2.getNames())
+    throw std::runtime_error("ContinuousContactManager, the start and end transforms are not of the same links!");
+
+  setCollisionObjectsTransform(pose1.getNames(), pose1.getTransforms(), pose2.getTransforms());
+}
+
+long ContinuousContactManager::contactTestSweep(std::vector<ContactResultMap>& collisions,
+                                                const std::vector<tesseract_common::LinkTransforms>& poses,
+                                                const ContactRequest& request)
+{
+  if (poses.size() < 2)
+    throw std::runtime_error("ContinuousContactManager, a sweep requires at least two poses!");
+
+  collisions.resize(poses.size() - 1);
+  for (auto& segment_collisions : collisions)
+    segment_collisions.clear();
+
+  long first_index = -1;
+  for (std::size_t i = 0; i < collisions.size(); ++i)
+  {
+    setCollisionObjectsTransform(poses[i], poses[i + 1]);
+    contactTest(collisions[i], request);
+    if (collisions[i].empty())
+      continue;
+
+    if (first_index < 0)
+      first_index = static_cast<long>(i);
+
+    if (request.type == ContactTestType::FIRST)
+      break;
+  }
+
+  return first_index;
+}
+
+void ContinuousContactManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  std::vector<std::string> active_names = getActiveCollisionObjects();
+  for (const auto& name : names)
+  {
+    auto it = std::find(active_names.begin(), active_names.end(), name);
+    if (active && it == active_names.end())
+      active_names.push_back(name);
+    else if (!active && it != active_names.end())
+      active_names.erase(it);
+  }
+
+  setActiveCollisionObjects(active_names);
+}
+
+void ContinuousContactManager::addActiveCollisionObjectsProfile(const std::string& name, std::vector<std::string> names)
+{
+  // The profiles may be shared with clones, so they are copied before they are changed
+  auto profiles = std::make_shared<ActiveCollisionObjectsProfiles>(*active_profiles_);
+  (*profiles)[name] = std::make_shared<const ActiveCollisionObjectsProfile>(std::move(names));
+  active_profiles_ = std::move(profiles);
+}
+
+bool ContinuousContactManager::removeActiveCollisionObjectsProfile(const std::string& name)
+{
+  if (active_profiles_->find(name) == active_profiles_->end())
+    return false;
+
+  auto profiles = std::make_shared<ActiveCollisionObjectsProfiles>(*active_profiles_);
+  profiles->erase(name);
+  active_profiles_ = std::move(profiles);
+  return true;
+}
+
+std::shared_ptr<const ActiveCollisionObjectsProfiles>
+ContinuousContactManager::getActiveCollisionObjectsProfiles() const
+{
+  return active_profiles_;
+}
+
+void ContinuousContactManager::setActiveCollisionObjectsProfiles(
+    std::shared_ptr<const ActiveCollisionObjectsProfiles> profiles)
+{
+  if (profiles == nullptr)
+    profiles = std::make_shared<const ActiveCollisionObjectsProfiles>();
+
+  active_profiles_ = std::move(profiles);
+}
+
+bool ContinuousContactManager::applyActiveCollisionObjectsProfile(const std::string& name)
+{
+  auto it = active_profiles_->find(name);
+  if (it == active_profiles_->end())
+    return false;
+
+  updateActiveCollisionObjects(*this, it->second->names, it->second->name_set);
+  return true;
+}
+
 void ContinuousContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   setCollisionMarginData(config.margin_data, config.margin_data_override_type);
   applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
+  if (config.enable_statistics)
+    setStatisticsEnabled(true);
+  if (config.pool_config)
+    setPoolConfig(*config.pool_config);
+}
+
+void ContinuousContactManager::setStatisticsEnabled(bool /*enabled*/) {}
+
+bool ContinuousContactManager::getStatisticsEnabled() const { return false; }
+
+ContactManagerStatistics ContinuousContactManager::getStatistics() const { return {}; }
+
+void ContinuousContactManager::clearStatistics() {}
+
+void ContinuousContactManager::setPoolConfig(const ContactManagerPoolConfig& /*config*/) {}
+
+std::optional<ContactManagerPoolConfig> ContinuousContactManager::getPoolConfig() const { return std::nullopt; }
+
+tesseract_common::MemoryUsage
+ContinuousContactManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(getName());
+  for (const auto& name : getCollisionObjects())
+  {
+    tesseract_common::MemoryUsage& object_usage = usage.addChild(name);
+    for (const auto& shape : getCollisionObjectGeometries(name))
+      object_usage.children.push_back(shape->getMemoryUsage(tracker));
+  }
+
+  return usage;
 }
 }  // namespace tesseract_collision
@@ -0,0 +1,98 @@
+/**
+ * @file convex_decomposition.cpp
+ * @brief Convex decomposition interface
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/convex_decomposition.h>
+
+namespace tesseract_collision
+{
+std::future<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+ConvexDecomposition::computeAsync(tesseract_common::VectorVector3d vertices,
+                                  Eigen::VectorXi faces,
+                                  const tesseract_common::Executor::Ptr& executor) const
+{
+  const tesseract_common::Executor::Ptr pool =
+      (executor != nullptr) ? executor : tesseract_common::getDefaultExecutor();
+  return pool->async([this, vertices = std::move(vertices), faces = std::move(faces)]() {
+    return compute(vertices, faces);
+  });
+}
+
+std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>>
+ConvexDecomposition::computeBatch(const std::vector<std::shared_ptr<const tesseract_geometry::PolygonMesh>>& meshes,
+                                  std::size_t threads,
+                                  const tesseract_common::Executor::Ptr& executor) const
+{
+  if (std::any_of(meshes.begin(), meshes.end(), [](const auto& mesh) { return mesh == nullptr; }))
+    throw std::runtime_error("ConvexDecomposition::computeBatch, the meshes must not be nullptr");
+
+  std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>> results(meshes.size());
+  const tesseract_common::Executor::Ptr pool =
+      (executor != nullptr) ? executor : tesseract_common::getDefaultExecutor();
+  if (threads == 0)
+    threads = pool->getConcurrency();
+
+  threads = std::min(threads, meshes.size());
+
+  std::atomic<std::size_t> next{ 0 };
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto run = [&]() {
+    for (std::size_t i = next++; i < meshes.size(); i = next++)
+    {
+      try
+      {
+        const tesseract_geometry::PolygonMesh& mesh = *meshes[i];
+        results[i] = compute(*mesh.getVertices(), *mesh.getFaces());
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error == nullptr)
+          error = std::current_exception();
+
+        next = meshes.size();
+      }
+    }
+  };
+
+  pool->parallelFor(threads, [&run](std::size_t /*worker*/) { run(); });
+
+  if (error != nullptr)
+    std::rethrow_exception(error);
+
+  return results;
+}
+
+}  // namespace tesseract_collision
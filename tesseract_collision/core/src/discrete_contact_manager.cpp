@@ -24,15 +24,196 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/utils.h>
 
 namespace tesseract_collision
 {
+int DiscreteContactManager::getCollisionObjectHandle(const std::string& name) const
+{
+  const std::vector<std::string>& names = getCollisionObjects();
+  auto it = std::find(names.begin(), names.end(), name);
+  return (it != names.end()) ? static_cast<int>(std::distance(names.begin(), it)) : -1;
+}
+
+bool DiscreteContactManager::enableCollisionObject(int handle)
+{
+  const std::vector<std::string>& names = getCollisionObjects();
+  if (handle < 0 || handle >= static_cast<int>(names.size()))
+    return false;
+
+  return enableCollisionObject(names[static_cast<std::size_t>(handle)]);
+}
+
+bool DiscreteContactManager::disableCollisionObject(int handle)
+{
+  const std::vector<std::string>& names = getCollisionObjects();
+  if (handle < 0 || handle >= static_cast<int>(names.size()))
+    return false;
+
+  return disableCollisionObject(names[static_cast<std::size_t>(handle)]);
+}
+
+void DiscreteContactManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  const std::vector<std::string>& names = getCollisionObjects();
+  if (handle < 0 || handle >= static_cast<int>(names.size()))
+    return;
+
+  setCollisionObjectsTransform(names[static_cast<std::size_t>(handle)], pose);
+}
+
+void DiscreteContactManager::setCollisionObjectsTransform(const tesseract_common::LinkTransforms& transforms)
+{
+  setCollisionObjectsTransform(transforms.getNames(), transforms.getTransforms());
+}
+
+bool DiscreteContactManager::addCollisionObjects(const std::vector<std::string>& names,
+                                                 const int& mask_id,
+                                                 const std::vector<CollisionShapesConst>& shapes,
+                                                 const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                 bool enabled)
+{
+  if (shapes.size() != names.size() || shape_poses.size() != names.size())
+    throw std::runtime_error("DiscreteContactManager, addCollisionObjects number of shapes does not match names!");
+
+  bool added = true;
+  for (std::size_t i = 0; i < names.size(); ++i)
+    added = addCollisionObject(names[i], mask_id, shapes[i], shape_poses[i], enabled) && added;
+
+  return added;
+}
+
+void DiscreteContactManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  std::vector<std::string> active_names = getActiveCollisionObjects();
+  for (const auto& name : names)
+  {
+    auto it = std::find(active_names.begin(), active_names.end(), name);
+    if (active && it == active_names.end())
+      active_names.push_back(name);
+    else if (!active && it != active_names.end())
+      active_names.erase(it);
+  }
+
+  setActiveCollisionObjects(active_names);
+}
+
+void DiscreteContactManager::addActiveCollisionObjectsProfile(const std::string& name, std::vector<std::string> names)
+{
+  // The profiles may be shared with clones, so they are copied before they are changed
+  auto profiles = std::make_shared<ActiveCollisionObjectsProfiles>(*active_profiles_);
+  (*profiles)[name] = std::make_shared<const ActiveCollisionObjectsProfile>(std::move(names));
+  active_profiles_ = std::move(profiles);
+}
+
+bool DiscreteContactManager::removeActiveCollisionObjectsProfile(const std::string& name)
+{
+  if (active_profiles_->find(name) == active_profiles_->end())
+    return false;
+
+  auto profiles = std::make_shared<ActiveCollisionObjectsProfiles>(*active_profiles_);
+  profiles->erase(name);
+  active_profiles_ = std::move(profiles);
+  return true;
+}
+
+std::shared_ptr<const ActiveCollisionObjectsProfiles>
+DiscreteContactManager::getActiveCollisionObjectsProfiles() const
+{
+  return active_profiles_;
+}
+
+void DiscreteContactManager::setActiveCollisionObjectsProfiles(
+    std::shared_ptr<const ActiveCollisionObjectsProfiles> profiles)
+{
+  if (profiles == nullptr)
+    profiles = std::make_shared<const ActiveCollisionObjectsProfiles>();
+
+  active_profiles_ = std::move(profiles);
+}
+
+bool DiscreteContactManager::applyActiveCollisionObjectsProfile(const std::string& name)
+{
+  auto it = active_profiles_->find(name);
+  if (it == active_profiles_->end())
+    return false;
+
+  updateActiveCollisionObjects(*this, it->second->names, it->second->name_set);
+  return true;
+}
+
 void DiscreteContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   setCollisionMarginData(config.margin_data, config.margin_data_override_type);
   applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
+  if (config.enable_statistics)
+    setStatisticsEnabled(true);
+  if (config.pool_config)
+    setPoolConfig(*config.pool_config);
+}
+
+void DiscreteContactManager::setStatisticsEnabled(bool /*enabled*/) {}
+
+bool DiscreteContactManager::getStatisticsEnabled() const { return false; }
+
+ContactManagerStatistics DiscreteContactManager::getStatistics() const { return {}; }
+
+void DiscreteContactManager::clearStatistics() {}
+
+void DiscreteContactManager::setPoolConfig(const ContactManagerPoolConfig& /*config*/) {}
+
+std::optional<ContactManagerPoolConfig> DiscreteContactManager::getPoolConfig() const { return std::nullopt; }
+
+tesseract_common::MemoryUsage
+DiscreteContactManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(getName());
+  for (const auto& name : getCollisionObjects())
+  {
+    tesseract_common::MemoryUsage& object_usage = usage.addChild(name);
+    for (const auto& shape : getCollisionObjectGeometries(name))
+      object_usage.children.push_back(shape->getMemoryUsage(tracker));
+  }
+
+  return usage;
+}
+
+void DiscreteContactManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                              const std::vector<tesseract_common::TransformMap>& transforms,
+                                              const ContactRequest& request)
+{
+  collisions.resize(transforms.size());
+  for (std::size_t i = 0; i < transforms.size(); ++i)
+  {
+    setCollisionObjectsTransform(transforms[i]);
+    collisions[i].clear();
+    contactTest(collisions[i], request);
+  }
+}
+
+void DiscreteContactManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                              const std::vector<std::string>& names,
+                                              const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                                              const ContactRequest& request)
+{
+  collisions.resize(poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    if (poses[i].size() != names.size())
+      throw std::runtime_error("DiscreteContactManager, batchContactTest number of poses does not match names!");
+
+    setCollisionObjectsTransform(names, poses[i]);
+    collisions[i].clear();
+    contactTest(collisions[i], request);
+  }
 }
 }  // namespace tesseract_collision
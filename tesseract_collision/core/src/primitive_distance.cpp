@@ -0,0 +1,513 @@
+/**
+ * @file primitive_distance.cpp
+ * @brief Closed form distance and penetration of primitive shape pairs
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/primitive_distance.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace
+{
+/** @brief Below this length a direction is degenerate and a fallback normal is used */
+constexpr double DEGENERATE_LENGTH = 1e-12;
+
+/** @brief Below this norm the cross product of two box edges is parallel and covered by the face axes */
+constexpr double PARALLEL_EDGE_TOLERANCE = 1e-9;
+
+/**
+ * @brief Calculate the closest points between the segments p1-q1 and p2-q2
+ * @details This is the method from Ericson, Real-Time Collision Detection, section 5.1.9
+ */
+void calcSegmentSegmentClosestPoints(Eigen::Vector3d& c1,
+                                     Eigen::Vector3d& c2,
+                                     const Eigen::Vector3d& p1,
+                                     const Eigen::Vector3d& q1,
+                                     const Eigen::Vector3d& p2,
+                                     const Eigen::Vector3d& q2)
+{
+  const Eigen::Vector3d d1 = q1 - p1;
+  const Eigen::Vector3d d2 = q2 - p2;
+  const Eigen::Vector3d r = p1 - p2;
+  const double a = d1.squaredNorm();
+  const double e = d2.squaredNorm();
+  const double f = d2.dot(r);
+  constexpr double eps = std::numeric_limits<double>::epsilon();
+
+  double s{ 0 };
+  double t{ 0 };
+  if (a <= eps && e <= eps)
+  {
+    s = 0;
+    t = 0;
+  }
+  else if (a <= eps)
+  {
+    s = 0;
+    t = std::clamp(f / e, 0.0, 1.0);
+  }
+  else
+  {
+    const double c = d1.dot(r);
+    if (e <= eps)
+    {
+      t = 0;
+      s = std::clamp(-c / a, 0.0, 1.0);
+    }
+    else
+    {
+      const double b = d1.dot(d2);
+      const double denom = (a * e) - (b * b);
+      s = (denom > 0) ? std::clamp(((b * f) - (c * e)) / denom, 0.0, 1.0) : 0.0;
+      t = ((b * s) + f) / e;
+      if (t < 0)
+      {
+        t = 0;
+        s = std::clamp(-c / a, 0.0, 1.0);
+      }
+      else if (t > 1)
+      {
+        t = 1;
+        s = std::clamp((b - c) / a, 0.0, 1.0);
+      }
+    }
+  }
+
+  c1 = p1 + (d1 * s);
+  c2 = p2 + (d2 * t);
+}
+
+/** @brief The distance between two spheres, which is also the distance between capsules given their closest points */
+void calcSpheresDistance(PrimitiveDistanceResult& result,
+                         const Eigen::Vector3d& center1,
+                         double radius1,
+                         const Eigen::Vector3d& center2,
+                         double radius2,
+                         const Eigen::Vector3d& fallback_normal)
+{
+  const Eigen::Vector3d delta = center2 - center1;
+  const double length = delta.norm();
+  result.normal = (length > DEGENERATE_LENGTH) ? Eigen::Vector3d(delta / length) : fallback_normal;
+  result.distance = length - radius1 - radius2;
+  result.nearest_points[0] = center1 + (result.normal * radius1);
+  result.nearest_points[1] = center2 - (result.normal * radius2);
+}
+
+/** @brief Swap the roles of the two shapes of a result */
+void swapResult(PrimitiveDistanceResult& result)
+{
+  std::swap(result.nearest_points[0], result.nearest_points[1]);
+  result.normal = -result.normal;
+}
+
+/** @brief The vertices of a box in world coordinates */
+std::array<Eigen::Vector3d, 8> getBoxVertices(const Eigen::Vector3d& half_extents, const Eigen::Isometry3d& tf)
+{
+  std::array<Eigen::Vector3d, 8> vertices;
+  for (std::size_t k = 0; k < 8; ++k)
+  {
+    const Eigen::Vector3d local(((k & 1U) != 0) ? half_extents.x() : -half_extents.x(),
+                                ((k & 2U) != 0) ? half_extents.y() : -half_extents.y(),
+                                ((k & 4U) != 0) ? half_extents.z() : -half_extents.z());
+    vertices[k] = tf * local;
+  }
+  return vertices;
+}
+
+/** @brief The edges of a box as pairs of vertex indices of getBoxVertices */
+const std::array<std::array<std::size_t, 2>, 12>& getBoxEdges()
+{
+  static const std::array<std::array<std::size_t, 2>, 12> edges{ { { 0, 1 },
+                                                                   { 2, 3 },
+                                                                   { 4, 5 },
+                                                                   { 6, 7 },
+                                                                   { 0, 2 },
+                                                                   { 1, 3 },
+                                                                   { 4, 6 },
+                                                                   { 5, 7 },
+                                                                   { 0, 4 },
+                                                                   { 1, 5 },
+                                                                   { 2, 6 },
+                                                                   { 3, 7 } } };
+  return edges;
+}
+
+/** @brief The vertex of a box that is furthest along a direction given in the box frame */
+Eigen::Vector3d getBoxSupport(const Eigen::Vector3d& half_extents, const Eigen::Vector3d& local_direction)
+{
+  return { (local_direction.x() >= 0) ? half_extents.x() : -half_extents.x(),
+           (local_direction.y() >= 0) ? half_extents.y() : -half_extents.y(),
+           (local_direction.z() >= 0) ? half_extents.z() : -half_extents.z() };
+}
+
+/** @brief The distance between separated boxes, the closest features are a vertex and a box or two edges */
+void calcSeparatedBoxBoxDistance(PrimitiveDistanceResult& result,
+                                 const Eigen::Vector3d& half_extents1,
+                                 const Eigen::Isometry3d& tf1,
+                                 const Eigen::Vector3d& half_extents2,
+                                 const Eigen::Isometry3d& tf2)
+{
+  const std::array<Eigen::Vector3d, 8> vertices1 = getBoxVertices(half_extents1, tf1);
+  const std::array<Eigen::Vector3d, 8> vertices2 = getBoxVertices(half_extents2, tf2);
+  const Eigen::Isometry3d tf1_inv = tf1.inverse();
+  const Eigen::Isometry3d tf2_inv = tf2.inverse();
+
+  double best = std::numeric_limits<double>::max();
+  for (const Eigen::Vector3d& vertex : vertices1)
+  {
+    const Eigen::Vector3d local = tf2_inv * vertex;
+    const Eigen::Vector3d closest = local.cwiseMax(-half_extents2).cwiseMin(half_extents2);
+    const double distance = (local - closest).norm();
+    if (distance < best)
+    {
+      best = distance;
+      result.nearest_points[0] = vertex;
+      result.nearest_points[1] = tf2 * closest;
+    }
+  }
+
+  for (const Eigen::Vector3d& vertex : vertices2)
+  {
+    const Eigen::Vector3d local = tf1_inv * vertex;
+    const Eigen::Vector3d closest = local.cwiseMax(-half_extents1).cwiseMin(half_extents1);
+    const double distance = (local - closest).norm();
+    if (distance < best)
+    {
+      best = distance;
+      result.nearest_points[0] = tf1 * closest;
+      result.nearest_points[1] = vertex;
+    }
+  }
+
+  // Edge pairs are skipped when their bounding spheres cannot beat the best distance found so far
+  for (const auto& edge1 : getBoxEdges())
+  {
+    const Eigen::Vector3d& p1 = vertices1[edge1[0]];
+    const Eigen::Vector3d& q1 = vertices1[edge1[1]];
+    const Eigen::Vector3d mid1 = 0.5 * (p1 + q1);
+    const double half_length1 = 0.5 * (q1 - p1).norm();
+    for (const auto& edge2 : getBoxEdges())
+    {
+      const Eigen::Vector3d& p2 = vertices2[edge2[0]];
+      const Eigen::Vector3d& q2 = vertices2[edge2[1]];
+      const Eigen::Vector3d mid2 = 0.5 * (p2 + q2);
+      if ((mid2 - mid1).norm() - half_length1 - (0.5 * (q2 - p2).norm()) >= best)
+        continue;
+
+      Eigen::Vector3d c1;
+      Eigen::Vector3d c2;
+      calcSegmentSegmentClosestPoints(c1, c2, p1, q1, p2, q2);
+      const double distance = (c2 - c1).norm();
+      if (distance < best)
+      {
+        best = distance;
+        result.nearest_points[0] = c1;
+        result.nearest_points[1] = c2;
+      }
+    }
+  }
+
+  result.distance = best;
+  const Eigen::Vector3d delta = result.nearest_points[1] - result.nearest_points[0];
+  result.normal = (best > DEGENERATE_LENGTH) ? Eigen::Vector3d(delta / best) :
+                                               Eigen::Vector3d((tf2.translation() - tf1.translation()).normalized());
+}
+}  // namespace
+
+void calcSphereSphereDistance(PrimitiveDistanceResult& result,
+                              double radius1,
+                              const Eigen::Isometry3d& tf1,
+                              double radius2,
+                              const Eigen::Isometry3d& tf2)
+{
+  calcSpheresDistance(result, tf1.translation(), radius1, tf2.translation(), radius2, Eigen::Vector3d::UnitX());
+}
+
+void calcSphereCapsuleDistance(PrimitiveDistanceResult& result,
+                               double radius1,
+                               const Eigen::Isometry3d& tf1,
+                               double radius2,
+                               double half_length2,
+                               const Eigen::Isometry3d& tf2)
+{
+  const Eigen::Vector3d axis2 = tf2.linear().col(2);
+  const Eigen::Vector3d& center1 = tf1.translation();
+  const double t = std::clamp(axis2.dot(center1 - tf2.translation()), -half_length2, half_length2);
+  const Eigen::Vector3d closest2 = tf2.translation() + (t * axis2);
+  calcSpheresDistance(result, center1, radius1, closest2, radius2, axis2.unitOrthogonal());
+}
+
+void calcCapsuleCapsuleDistance(PrimitiveDistanceResult& result,
+                                double radius1,
+                                double half_length1,
+                                const Eigen::Isometry3d& tf1,
+                                double radius2,
+                                double half_length2,
+                                const Eigen::Isometry3d& tf2)
+{
+  const Eigen::Vector3d axis1 = tf1.linear().col(2);
+  const Eigen::Vector3d axis2 = tf2.linear().col(2);
+  Eigen::Vector3d c1;
+  Eigen::Vector3d c2;
+  calcSegmentSegmentClosestPoints(c1,
+                                  c2,
+                                  tf1.translation() - (half_length1 * axis1),
+                                  tf1.translation() + (half_length1 * axis1),
+                                  tf2.translation() - (half_length2 * axis2),
+                                  tf2.translation() + (half_length2 * axis2));
+
+  // Intersecting segments are pushed apart perpendicular to both of them
+  Eigen::Vector3d fallback_normal = axis1.cross(axis2);
+  const double fallback_length = fallback_normal.norm();
+  fallback_normal = (fallback_length > PARALLEL_EDGE_TOLERANCE) ? Eigen::Vector3d(fallback_normal / fallback_length) :
+                                                                  axis1.unitOrthogonal();
+  calcSpheresDistance(result, c1, radius1, c2, radius2, fallback_normal);
+}
+
+void calcSphereBoxDistance(PrimitiveDistanceResult& result,
+                           double radius1,
+                           const Eigen::Isometry3d& tf1,
+                           const Eigen::Vector3d& half_extents2,
+                           const Eigen::Isometry3d& tf2)
+{
+  const Eigen::Vector3d& center1 = tf1.translation();
+  const Eigen::Vector3d local = tf2.inverse() * center1;
+  Eigen::Vector3d closest = local.cwiseMax(-half_extents2).cwiseMin(half_extents2);
+  const double outside = (closest - local).norm();
+  if (outside > DEGENERATE_LENGTH)
+  {
+    result.normal = tf2.linear() * ((closest - local) / outside);
+    result.distance = outside - radius1;
+  }
+  else
+  {
+    // The center is inside the box so the box is pushed out through the nearest face
+    Eigen::Index axis{ 0 };
+    (half_extents2 - local.cwiseAbs()).minCoeff(&axis);
+    const double side = (local(axis) >= 0) ? 1.0 : -1.0;
+    closest(axis) = side * half_extents2(axis);
+    result.normal = -side * tf2.linear().col(axis);
+    result.distance = -(half_extents2(axis) - std::abs(local(axis))) - radius1;
+  }
+
+  result.nearest_points[0] = center1 + (result.normal * radius1);
+  result.nearest_points[1] = tf2 * closest;
+}
+
+void calcBoxBoxDistance(PrimitiveDistanceResult& result,
+                        const Eigen::Vector3d& half_extents1,
+                        const Eigen::Isometry3d& tf1,
+                        const Eigen::Vector3d& half_extents2,
+                        const Eigen::Isometry3d& tf2)
+{
+  const Eigen::Matrix3d& rotation1 = tf1.linear();
+  const Eigen::Matrix3d& rotation2 = tf2.linear();
+  const Eigen::Vector3d translation = tf2.translation() - tf1.translation();
+
+  // The separating axis test, the axis of least overlap points from the first box to the second
+  enum class AxisType
+  {
+    FACE1,
+    FACE2,
+    EDGE
+  };
+  double min_overlap = std::numeric_limits<double>::max();
+  Eigen::Vector3d min_axis = Eigen::Vector3d::UnitX();
+  AxisType min_type{ AxisType::FACE1 };
+  Eigen::Index min_edge1{ 0 };
+  Eigen::Index min_edge2{ 0 };
+
+  auto test_axis = [&](const Eigen::Vector3d& axis, AxisType type, Eigen::Index i, Eigen::Index j) {
+    const double r1 = half_extents1.dot((rotation1.transpose() * axis).cwiseAbs());
+    const double r2 = half_extents2.dot((rotation2.transpose() * axis).cwiseAbs());
+    const double projection = axis.dot(translation);
+    const double overlap = r1 + r2 - std::abs(projection);
+    if (overlap < 0)
+      return false;
+
+    if (overlap < min_overlap)
+    {
+      min_overlap = overlap;
+      min_axis = (projection < 0) ? Eigen::Vector3d(-axis) : axis;
+      min_type = type;
+      min_edge1 = i;
+      min_edge2 = j;
+    }
+    return true;
+  };
+
+  bool separated{ false };
+  for (Eigen::Index i = 0; i < 3 && !separated; ++i)
+    separated = !test_axis(rotation1.col(i), AxisType::FACE1, i, 0);
+
+  for (Eigen::Index j = 0; j < 3 && !separated; ++j)
+    separated = !test_axis(rotation2.col(j), AxisType::FACE2, 0, j);
+
+  for (Eigen::Index i = 0; i < 3 && !separated; ++i)
+  {
+    for (Eigen::Index j = 0; j < 3 && !separated; ++j)
+    {
+      const Eigen::Vector3d axis = rotation1.col(i).cross(rotation2.col(j));
+      const double length = axis.norm();
+      if (length > PARALLEL_EDGE_TOLERANCE)
+        separated = !test_axis(axis / length, AxisType::EDGE, i, j);
+    }
+  }
+
+  if (separated)
+  {
+    calcSeparatedBoxBoxDistance(result, half_extents1, tf1, half_extents2, tf2);
+    return;
+  }
+
+  const Eigen::Vector3d& normal = min_axis;
+  const Eigen::Vector3d local_normal1 = rotation1.transpose() * normal;
+  const Eigen::Vector3d local_normal2 = rotation2.transpose() * normal;
+  result.distance = -min_overlap;
+  result.normal = normal;
+  switch (min_type)
+  {
+    case AxisType::FACE1:
+    {
+      // The deepest vertex of the second box and its projection on the face of the first box
+      result.nearest_points[1] = tf2 * getBoxSupport(half_extents2, -local_normal2);
+      result.nearest_points[0] = result.nearest_points[1] + (normal * min_overlap);
+      break;
+    }
+    case AxisType::FACE2:
+    {
+      result.nearest_points[0] = tf1 * getBoxSupport(half_extents1, local_normal1);
+      result.nearest_points[1] = result.nearest_points[0] - (normal * min_overlap);
+      break;
+    }
+    case AxisType::EDGE:
+    {
+      // The supporting edges of both boxes along the axis, the witness points straddle their closest points
+      Eigen::Vector3d edge1 = getBoxSupport(half_extents1, local_normal1);
+      Eigen::Vector3d edge2 = getBoxSupport(half_extents2, -local_normal2);
+      const Eigen::Vector3d offset1 = half_extents1(min_edge1) * Eigen::Vector3d::Unit(min_edge1);
+      const Eigen::Vector3d offset2 = half_extents2(min_edge2) * Eigen::Vector3d::Unit(min_edge2);
+      edge1(min_edge1) = 0;
+      edge2(min_edge2) = 0;
+
+      Eigen::Vector3d c1;
+      Eigen::Vector3d c2;
+      calcSegmentSegmentClosestPoints(
+          c1, c2, tf1 * (edge1 - offset1), tf1 * (edge1 + offset1), tf2 * (edge2 - offset2), tf2 * (edge2 + offset2));
+      const Eigen::Vector3d mid = 0.5 * (c1 + c2);
+      result.nearest_points[0] = mid + (0.5 * min_overlap * normal);
+      result.nearest_points[1] = mid - (0.5 * min_overlap * normal);
+      break;
+    }
+  }
+}
+
+bool hasPrimitiveDistance(const tesseract_geometry::Geometry& shape1, const tesseract_geometry::Geometry& shape2)
+{
+  using tesseract_geometry::GeometryType;
+  const GeometryType type1 = shape1.getType();
+  const GeometryType type2 = shape2.getType();
+  auto is_primitive = [](GeometryType type) {
+    return type == GeometryType::SPHERE || type == GeometryType::CAPSULE || type == GeometryType::BOX;
+  };
+
+  // Every pair of the three types is supported except box-capsule
+  if (!is_primitive(type1) || !is_primitive(type2))
+    return false;
+
+  return !((type1 == GeometryType::BOX && type2 == GeometryType::CAPSULE) ||
+           (type1 == GeometryType::CAPSULE && type2 == GeometryType::BOX));
+}
+
+bool calcPrimitiveDistance(PrimitiveDistanceResult& result,
+                           const tesseract_geometry::Geometry& shape1,
+                           const Eigen::Isometry3d& tf1,
+                           const tesseract_geometry::Geometry& shape2,
+                           const Eigen::Isometry3d& tf2)
+{
+  using tesseract_geometry::GeometryType;
+  if (!hasPrimitiveDistance(shape1, shape2))
+    return false;
+
+  // Order the pair as sphere, capsule, box so each kernel is written once
+  const bool swapped = (shape1.getType() > shape2.getType());
+  const tesseract_geometry::Geometry& first = swapped ? shape2 : shape1;
+  const tesseract_geometry::Geometry& second = swapped ? shape1 : shape2;
+  const Eigen::Isometry3d& first_tf = swapped ? tf2 : tf1;
+  const Eigen::Isometry3d& second_tf = swapped ? tf1 : tf2;
+
+  auto half_extents = [](const tesseract_geometry::Geometry& shape) {
+    const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+    return Eigen::Vector3d(0.5 * box.getX(), 0.5 * box.getY(), 0.5 * box.getZ());
+  };
+
+  if (first.getType() == GeometryType::SPHERE)
+  {
+    const double radius1 = static_cast<const tesseract_geometry::Sphere&>(first).getRadius();
+    if (second.getType() == GeometryType::SPHERE)
+    {
+      const double radius2 = static_cast<const tesseract_geometry::Sphere&>(second).getRadius();
+      calcSphereSphereDistance(result, radius1, first_tf, radius2, second_tf);
+    }
+    else if (second.getType() == GeometryType::CAPSULE)
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(second);
+      calcSphereCapsuleDistance(
+          result, radius1, first_tf, capsule.getRadius(), 0.5 * capsule.getLength(), second_tf);
+    }
+    else
+    {
+      calcSphereBoxDistance(result, radius1, first_tf, half_extents(second), second_tf);
+    }
+  }
+  else if (first.getType() == GeometryType::CAPSULE)
+  {
+    const auto& capsule1 = static_cast<const tesseract_geometry::Capsule&>(first);
+    const auto& capsule2 = static_cast<const tesseract_geometry::Capsule&>(second);
+    calcCapsuleCapsuleDistance(result,
+                               capsule1.getRadius(),
+                               0.5 * capsule1.getLength(),
+                               first_tf,
+                               capsule2.getRadius(),
+                               0.5 * capsule2.getLength(),
+                               second_tf);
+  }
+  else
+  {
+    calcBoxBoxDistance(result, half_extents(first), first_tf, half_extents(second), second_tf);
+  }
+
+  if (swapped)
+    swapResult(result);
+
+  return true;
+}
+
+}  // namespace tesseract_collision
@@ -24,6 +24,14 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/core/types.h>
 
 namespace tesseract_collision
@@ -39,6 +47,8 @@ void ContactResult::clear()
   transform[1] = Eigen::Isometry3d::Identity();
   link_names[0] = "";
   link_names[1] = "";
+  link_handles[0] = -1;
+  link_handles[1] = -1;
   shape_id[0] = -1;
   shape_id[1] = -1;
   subshape_id[0] = -1;
@@ -57,10 +67,119 @@ void ContactResult::clear()
 
 ContactRequest::ContactRequest(ContactTestType type) : type(type) {}
 
+ContactResultMap::iterator ContactResultMap::begin() { return { HasContacts(), data_.begin(), data_.end() }; }
+
+ContactResultMap::iterator ContactResultMap::end() { return { HasContacts(), data_.end(), data_.end() }; }
+
+ContactResultMap::const_iterator ContactResultMap::begin() const { return cbegin(); }
+
+ContactResultMap::const_iterator ContactResultMap::end() const { return cend(); }
+
+ContactResultMap::const_iterator ContactResultMap::cbegin() const
+{
+  return { HasContacts(), data_.cbegin(), data_.cend() };
+}
+
+ContactResultMap::const_iterator ContactResultMap::cend() const { return { HasContacts(), data_.cend(), data_.cend() }; }
+
+bool ContactResultMap::empty() const { return (begin() == end()); }
+
+ContactResultMap::size_type ContactResultMap::size() const
+{
+  return static_cast<size_type>(std::distance(begin(), end()));
+}
+
+long ContactResultMap::numContacts() const
+{
+  long cnt{ 0 };
+  for (const auto& pair : data_)
+    cnt += static_cast<long>(pair.second.size());
+
+  return cnt;
+}
+
+ContactResultMap::iterator ContactResultMap::find(const KeyType& key)
+{
+  auto it = data_.find(key);
+  if (it == data_.end() || it->second.empty())
+    return end();
+
+  return { HasContacts(), it, data_.end() };
+}
+
+ContactResultMap::const_iterator ContactResultMap::find(const KeyType& key) const
+{
+  auto it = data_.find(key);
+  if (it == data_.end() || it->second.empty())
+    return end();
+
+  return { HasContacts(), it, data_.cend() };
+}
+
+ContactResultMap::size_type ContactResultMap::count(const KeyType& key) const { return (find(key) != end()) ? 1 : 0; }
+
+ContactResultMap::MappedType& ContactResultMap::at(const KeyType& key)
+{
+  auto it = find(key);
+  if (it == end())
+    throw std::out_of_range("ContactResultMap, the pair '" + key.first + "', '" + key.second + "' has no contacts!");
+
+  return it->second;
+}
+
+const ContactResultMap::MappedType& ContactResultMap::at(const KeyType& key) const
+{
+  auto it = find(key);
+  if (it == end())
+    throw std::out_of_range("ContactResultMap, the pair '" + key.first + "', '" + key.second + "' has no contacts!");
+
+  return it->second;
+}
+
+ContactResultMap::MappedType& ContactResultMap::operator[](const KeyType& key) { return data_[key]; }
+
+std::pair<ContactResultMap::iterator, bool> ContactResultMap::insert(const value_type& value)
+{
+  auto it = data_.find(value.first);
+  if (it == data_.end())
+  {
+    it = data_.insert(value).first;
+    return std::make_pair(iterator(HasContacts(), it, data_.end()), !it->second.empty());
+  }
+
+  if (!it->second.empty())
+    return std::make_pair(iterator(HasContacts(), it, data_.end()), false);
+
+  // Reuse the storage of the cleared pair
+  it->second.assign(value.second.begin(), value.second.end());
+  return std::make_pair(iterator(HasContacts(), it, data_.end()), !it->second.empty());
+}
+
+void ContactResultMap::clear()
+{
+  for (auto& pair : data_)
+    pair.second.clear();
+}
+
+void ContactResultMap::shrinkToFit()
+{
+  for (auto it = data_.begin(); it != data_.end();)
+  {
+    if (it->second.empty())
+      it = data_.erase(it);
+    else
+      ++it;
+  }
+}
+
+void ContactResultMap::release() { data_.clear(); }
+
+const ContactResultMap::ContainerType& ContactResultMap::getContainer() const { return data_; }
+
 std::size_t flattenMoveResults(ContactResultMap&& m, ContactResultVector& v)
 {
   v.clear();
-  v.reserve(m.size());
+  v.reserve(static_cast<std::size_t>(m.numContacts()));
   for (const auto& mv : m)
     std::move(mv.second.begin(), mv.second.end(), std::back_inserter(v));
 
@@ -70,7 +189,7 @@ std::size_t flattenMoveResults(ContactResultMap&& m, ContactResultVector& v)
 std::size_t flattenCopyResults(const ContactResultMap& m, ContactResultVector& v)
 {
   v.clear();
-  v.reserve(m.size());
+  v.reserve(static_cast<std::size_t>(m.numContacts()));
   for (const auto& mv : m)
     std::copy(mv.second.begin(), mv.second.end(), std::back_inserter(v));
 
@@ -90,11 +209,78 @@ ContactTestData::ContactTestData(const std::vector<std::string>& active,
 {
 }
 
+std::chrono::nanoseconds ContactManagerStatistics::getBroadphaseTime() const
+{
+  return contact_test_time - narrowphase_time;
+}
+
+void ContactManagerStatistics::addNarrowphaseCall(tesseract_geometry::GeometryType type1,
+                                                  tesseract_geometry::GeometryType type2)
+{
+  ++narrowphase_calls;
+  ++narrowphase_calls_by_geometry_type[std::minmax(type1, type2)];
+}
+
+void ContactManagerStatistics::clear() { *this = ContactManagerStatistics(); }
+
+ContactManagerStatisticsTimer::ContactManagerStatisticsTimer(std::chrono::nanoseconds* time) : time_(time)
+{
+  if (time_ != nullptr)
+    start_ = std::chrono::steady_clock::now();
+}
+
+ContactManagerStatisticsTimer::~ContactManagerStatisticsTimer()
+{
+  if (time_ != nullptr)
+    *time_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+}
+
+namespace
+{
+int getPoolSize(const ContactManagerPoolConfig& config, int per_object, std::size_t object_count)
+{
+  const auto size = static_cast<long long>(per_object) * static_cast<long long>(object_count);
+  return static_cast<int>(std::clamp<long long>(size, config.min_size, std::max(config.min_size, config.max_size)));
+}
+}  // namespace
+
+int ContactManagerPoolConfig::getCollisionAlgorithmPoolSize(std::size_t object_count) const
+{
+  return getPoolSize(*this, collision_algorithms_per_object, object_count);
+}
+
+int ContactManagerPoolConfig::getPersistentManifoldPoolSize(std::size_t object_count) const
+{
+  return getPoolSize(*this, persistent_manifolds_per_object, object_count);
+}
+
+bool ContactManagerPoolConfig::operator==(const ContactManagerPoolConfig& rhs) const
+{
+  return (collision_algorithms_per_object == rhs.collision_algorithms_per_object &&
+          persistent_manifolds_per_object == rhs.persistent_manifolds_per_object && min_size == rhs.min_size &&
+          max_size == rhs.max_size);
+}
+
+bool ContactManagerPoolConfig::operator!=(const ContactManagerPoolConfig& rhs) const { return !operator==(rhs); }
+
 ContactManagerConfig::ContactManagerConfig(double default_margin)
   : margin_data_override_type(CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN), margin_data(default_margin)
 {
 }
 
+ActiveCollisionObjectsProfile::ActiveCollisionObjectsProfile(std::vector<std::string> names)
+  : names(std::move(names)), name_set(this->names.begin(), this->names.end())
+{
+}
+
+bool OctreeDelta::empty() const { return occupied.empty() && free.empty(); }
+
+void OctreeDelta::clear()
+{
+  occupied.clear();
+  free.clear();
+}
+
 CollisionCheckConfig::CollisionCheckConfig(double default_margin,
                                            ContactRequest request,
                                            CollisionEvaluatorType type,
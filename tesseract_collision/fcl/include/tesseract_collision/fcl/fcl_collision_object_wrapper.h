@@ -65,8 +65,21 @@ public:
    */
   void updateAABB();
 
+  /**
+   * @brief Set the index of the shape of the tesseract collision object this was created from
+   * @param shape_index The shape index
+   */
+  void setShapeIndex(int shape_index);
+
+  /**
+   * @brief Get the index of the shape of the tesseract collision object this was created from
+   * @return The shape index
+   */
+  int getShapeIndex() const;
+
 protected:
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold. */
+  int shape_index_{ -1 };        /**< @brief The index of the shape this was created from */
 };
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
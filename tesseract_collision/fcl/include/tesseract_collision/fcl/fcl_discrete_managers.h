@@ -43,10 +43,30 @@
 #define TESSERACT_COLLISION_FCL_DISCRETE_MANAGERS_H
 
 #include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/fcl/fcl_static_collision_world.h>
 #include <tesseract_collision/fcl/fcl_utils.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
+/** @brief The broadphase and bounding volume hierarchy configuration of the FCL discrete contact manager */
+struct FCLDiscreteBVHManagerConfig
+{
+  /** @brief The broadphase algorithm, it is used for both the static and the dynamic objects */
+  FCLBroadphaseType broadphase_type{ FCLBroadphaseType::DYNAMIC_AABB_TREE };
+
+  /** @brief The bounding volume type of the hierarchies built for meshes */
+  FCLMeshBVType mesh_bv_type{ FCLMeshBVType::OBBRSS };
+
+  /** @brief The cell size of the spatial hash broadphase */
+  double spatial_hash_cell_size{ 0.1 };
+
+  /** @brief The minimum corner of the volume covered by the spatial hash grid, objects outside it are still checked */
+  Eigen::Vector3d spatial_hash_scene_min{ -5, -5, -5 };
+
+  /** @brief The maximum corner of the volume covered by the spatial hash grid, objects outside it are still checked */
+  Eigen::Vector3d spatial_hash_scene_max{ 5, 5, 5 };
+};
+
 /** @brief A FCL implementation of the discrete contact manager */
 class FCLDiscreteBVHManager : public DiscreteContactManager
 {
@@ -56,7 +76,8 @@ public:
   using UPtr = std::unique_ptr<FCLDiscreteBVHManager>;
   using ConstUPtr = std::unique_ptr<const FCLDiscreteBVHManager>;
 
-  FCLDiscreteBVHManager(std::string name = "FCLDiscreteBVHManager");
+  FCLDiscreteBVHManager(std::string name = "FCLDiscreteBVHManager",
+                        FCLDiscreteBVHManagerConfig config = FCLDiscreteBVHManagerConfig());
   ~FCLDiscreteBVHManager() override = default;
   FCLDiscreteBVHManager(const FCLDiscreteBVHManager&) = delete;
   FCLDiscreteBVHManager& operator=(const FCLDiscreteBVHManager&) = delete;
@@ -65,6 +86,9 @@ public:
 
   std::string getName() const override final;
 
+  /** @brief The broadphase and bounding volume hierarchy configuration */
+  const FCLDiscreteBVHManagerConfig& getConfig() const;
+
   DiscreteContactManager::UPtr clone() const override final;
 
   bool addCollisionObject(const std::string& name,
@@ -73,6 +97,12 @@ public:
                           const tesseract_common::VectorIsometry3d& shape_poses,
                           bool enabled = true) override final;
 
+  bool addCollisionObjects(const std::vector<std::string>& names,
+                           const int& mask_id,
+                           const std::vector<CollisionShapesConst>& shapes,
+                           const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                           bool enabled = true) override final;
+
   const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
 
   const tesseract_common::VectorIsometry3d&
@@ -88,19 +118,35 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
                                     const tesseract_common::VectorIsometry3d& poses) override final;
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
 
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
   const std::vector<std::string>& getCollisionObjects() const override final;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
 
   const std::vector<std::string>& getActiveCollisionObjects() const override final;
 
+  void setCollisionObjectsActive(const std::vector<std::string>& names, bool active) override final;
+
   void setCollisionMarginData(
       CollisionMarginData collision_margin_data,
       CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
@@ -119,14 +165,50 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<tesseract_common::TransformMap>& transforms,
+                        const ContactRequest& request) override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<std::string>& names,
+                        const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                        const ContactRequest& request) override final;
+
   /**
    * @brief Add a fcl collision object to the manager
    * @param cow The tesseract fcl collision object
    */
   void addCollisionObject(const COW::Ptr& cow);
 
+  /**
+   * @brief Attach a static collision world shared with other contact managers
+   * @details The active collision objects are also checked against the objects of the world, which are reported in
+   * the contact results with their names and a handle of -1. The objects of the world are not part of the collision
+   * objects of the manager and are not affected by its transforms, so they are never checked against each other.
+   * The contact distance of the world must not be less than the collision margin of the manager.
+   * @param world The static collision world, nullptr detaches the current world
+   */
+  void setStaticCollisionWorld(FCLStaticCollisionWorld::ConstPtr world);
+
+  /**
+   * @brief Get the attached static collision world
+   * @return The static collision world, nullptr if none is attached
+   */
+  const FCLStaticCollisionWorld::ConstPtr& getStaticCollisionWorld() const;
+
 private:
   std::string name_;
+  FCLDiscreteBVHManagerConfig config_;
 
   /** @brief Broad-phase Collision Manager for active collision objects */
   std::unique_ptr<fcl::BroadPhaseCollisionManagerd> static_manager_;
@@ -141,14 +223,45 @@ private:
   IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
   std::size_t fcl_co_count_{ 0 };              /**< @brief The number fcl collision objects */
 
+  /** @brief The collision objects indexed by handle, ordered the same as collision_objects_ */
+  std::vector<COW::Ptr> handle2cow_;
+
   /** @brief This is used to store static collision objects to update */
   std::vector<CollisionObjectRawPtr> static_update_;
 
   /** @brief This is used to store dynamic collision objects to update */
   std::vector<CollisionObjectRawPtr> dynamic_update_;
 
+  /** @brief The statistics collected during contact tests */
+  ContactManagerStatistics statistics_;
+
+  /** @brief Indicate if statistics are collected during contact tests */
+  bool statistics_enabled_{ false };
+
+  /** @brief The attached static collision world, nullptr if none is attached */
+  FCLStaticCollisionWorld::ConstPtr static_world_;
+
+  /**
+   * @brief Register a fcl collision object with the broadphase managers without refitting their bvh trees
+   * @param cow The tesseract fcl collision object
+   */
+  void registerCollisionObject(const COW::Ptr& cow);
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Run the collision check for the current transforms
+   * @param cdata The contact test data, its result map is populated
+   */
+  void runContactTest(ContactTestData& cdata);
+
+  /**
+   * @brief Check the active collision objects against the objects of the static collision world
+   * @param cdata The contact test data, its result map is populated
+   * @param callback The fcl callback processing a pair
+   */
+  void collideStaticCollisionWorld(ContactTestData& cdata, fcl::CollisionCallBack<double> callback);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
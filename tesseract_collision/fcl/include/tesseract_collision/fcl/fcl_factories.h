@@ -30,12 +30,32 @@
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
+/**
+ * @brief Creates the FCL discrete BVH manager
+ * @details The config accepts the optional keys below, see FCLDiscreteBVHManagerConfig.
+ *   - broadphase_type: DYNAMIC_AABB_TREE (default), SAP, SSAP, INTERVAL_TREE or SPATIAL_HASH
+ *   - mesh_bv_type: OBBRSS (default), RSS, KIOS or AABB
+ *   - spatial_hash_cell_size: The cell size of the SPATIAL_HASH broadphase
+ *   - spatial_hash_scene_min, spatial_hash_scene_max: The corners of the volume covered by the spatial hash grid
+ */
 class FCLDiscreteBVHManagerFactory : public DiscreteContactManagerFactory
 {
 public:
   DiscreteContactManager::UPtr create(const std::string& name, const YAML::Node& config) const override final;
 };
 
+/**
+ * @brief Creates a continuous contact manager using conservative advancement on the FCL discrete BVH manager
+ * @details The config accepts the optional keys tolerance and max_iterations, see
+ * ConservativeAdvancementContinuousManager, along with the keys of FCLDiscreteBVHManagerFactory for the wrapped
+ * discrete manager.
+ */
+class FCLCastBVHManagerFactory : public ContinuousContactManagerFactory
+{
+public:
+  ContinuousContactManager::UPtr create(const std::string& name, const YAML::Node& config) const override final;
+};
+
 TESSERACT_PLUGIN_ANCHOR_DECL(FCLFactoriesAnchor)
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
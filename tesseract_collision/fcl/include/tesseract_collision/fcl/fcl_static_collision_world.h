@@ -0,0 +1,132 @@
+/**
+ * @file fcl_static_collision_world.h
+ * @brief Static FCL collision objects shared by several contact managers
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+#ifndef TESSERACT_COLLISION_FCL_STATIC_COLLISION_WORLD_H
+#define TESSERACT_COLLISION_FCL_STATIC_COLLISION_WORLD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <fcl/broadphase/broadphase_dynamic_AABB_tree-inl.h>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/fcl/fcl_utils.h>
+
+namespace tesseract_collision::tesseract_collision_fcl
+{
+/**
+ * @brief Static collision objects shared read only by several FCL contact managers
+ * @details When many environments contain the same fixtures, for example one environment per robot in a shared cell,
+ * the collision geometries of the fixtures, including the bounding volume hierarchies of meshes, and the broadphase
+ * tree over them are built once here instead of once per contact manager. A contact manager attached to the world
+ * checks its active objects against the broadphase tree of the world.
+ *
+ * Objects can only be added before the world is shared, the contact managers hold it through a ConstPtr and only read
+ * it, so the world may be used by contact managers on different threads.
+ */
+class FCLStaticCollisionWorld
+{
+public:
+  using Ptr = std::shared_ptr<FCLStaticCollisionWorld>;
+  using ConstPtr = std::shared_ptr<const FCLStaticCollisionWorld>;
+
+  /**
+   * @brief Constructor
+   * @param contact_distance The largest collision margin of the contact managers using the world, the bounding boxes
+   * of the static objects are extended by half of it the same as the objects of the contact managers
+   * @param mesh_bv_type The bounding volume type of the hierarchies built for meshes
+   */
+  explicit FCLStaticCollisionWorld(double contact_distance = 0, FCLMeshBVType mesh_bv_type = FCLMeshBVType::OBBRSS);
+  ~FCLStaticCollisionWorld() = default;
+  FCLStaticCollisionWorld(const FCLStaticCollisionWorld&) = delete;
+  FCLStaticCollisionWorld& operator=(const FCLStaticCollisionWorld&) = delete;
+  FCLStaticCollisionWorld(FCLStaticCollisionWorld&&) = delete;
+  FCLStaticCollisionWorld& operator=(FCLStaticCollisionWorld&&) = delete;
+
+  /**
+   * @brief Add a static collision object
+   * @details An object with the same name is replaced
+   * @param name The name of the object, it must not be used by the objects of the contact managers
+   * @param mask_id User defined id which gets stored in the results structure
+   * @param shapes The shapes of the object
+   * @param shape_poses The poses of the shapes in the frame of the object
+   * @param pose The pose of the object in the world
+   * @return true if successfully added, otherwise false
+   */
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          const Eigen::Isometry3d& pose);
+
+  /**
+   * @brief Check if the world has a collision object
+   * @param name The name of the object
+   * @return True if the world has the object, otherwise false
+   */
+  bool hasCollisionObject(const std::string& name) const;
+
+  /** @brief Get the names of the collision objects in the order they were added */
+  const std::vector<std::string>& getCollisionObjects() const;
+
+  /** @brief Get the contact distance the bounding boxes of the static objects are extended for */
+  double getContactDistance() const;
+
+  /**
+   * @brief Check a fcl collision object against the objects of the world
+   * @details The callback is called with the object of the world first
+   * @param co The fcl collision object
+   * @param cdata The data passed to the callback
+   * @param callback The callback called for each pair with overlapping bounding boxes
+   */
+  void collide(fcl::CollisionObjectd* co, void* cdata, fcl::CollisionCallBack<double> callback) const;
+
+private:
+  double contact_distance_;
+  FCLMeshBVType mesh_bv_type_;
+  std::vector<std::string> collision_objects_; /**< @brief The names of the collision objects */
+  Link2COW link2cow_;                          /**< @brief The collision objects */
+
+  /** @brief The broadphase tree of the collision objects */
+  std::unique_ptr<fcl::DynamicAABBTreeCollisionManagerd> manager_;
+};
+
+}  // namespace tesseract_collision::tesseract_collision_fcl
+#endif  // TESSERACT_COLLISION_FCL_STATIC_COLLISION_WORLD_H
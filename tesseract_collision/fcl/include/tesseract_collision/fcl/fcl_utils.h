@@ -49,9 +49,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/narrowphase/distance-inl.h>
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/compact_transform.h>
+#include <tesseract_common/memory_usage.h>
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/common.h>
 #include <tesseract_collision/fcl/fcl_collision_object_wrapper.h>
@@ -63,6 +67,40 @@ using CollisionObjectPtr = std::shared_ptr<FCLCollisionObjectWrapper>;
 using CollisionObjectRawPtr = fcl::CollisionObjectd*;
 using CollisionObjectConstPtr = std::shared_ptr<const fcl::CollisionObjectd>;
 
+/** @brief The FCL broadphase algorithms the contact managers can use for their static and dynamic objects */
+enum class FCLBroadphaseType
+{
+  /** @brief A dynamic AABB tree, good default for mostly static scenes with a moving robot */
+  DYNAMIC_AABB_TREE = 0,
+  /** @brief Sweep and prune along the three axes, fast when few objects move between queries */
+  SAP = 1,
+  /** @brief Simple sweep and prune along the axis of largest variance, the cheapest to update */
+  SSAP = 2,
+  /** @brief An interval tree per axis */
+  INTERVAL_TREE = 3,
+  /** @brief A uniform spatial hash grid over a fixed scene volume, suited to many similarly sized objects */
+  SPATIAL_HASH = 4
+};
+
+static const std::vector<std::string> FCLBroadphaseTypeStrings = {
+  "DYNAMIC_AABB_TREE", "SAP", "SSAP", "INTERVAL_TREE", "SPATIAL_HASH"
+};
+
+/**
+ * @brief The bounding volume types of the FCL bounding volume hierarchies built for meshes
+ * @note FCL only computes distances for OBBRSS, RSS and kIOS, so AABB can only be used when the contact distance is
+ * zero and only collisions are checked
+ */
+enum class FCLMeshBVType
+{
+  OBBRSS = 0,
+  RSS = 1,
+  KIOS = 2,
+  AABB = 3
+};
+
+static const std::vector<std::string> FCLMeshBVTypeStrings = { "OBBRSS", "RSS", "KIOS", "AABB" };
+
 enum CollisionFilterGroups
 {
   DefaultFilter = 1,
@@ -87,7 +125,8 @@ public:
   CollisionObjectWrapper(std::string name,
                          const int& type_id,
                          CollisionShapesConst shapes,
-                         tesseract_common::VectorIsometry3d shape_poses);
+                         tesseract_common::VectorIsometry3d shape_poses,
+                         FCLMeshBVType mesh_bv_type = FCLMeshBVType::OBBRSS);
 
   short int m_collisionFilterGroup{ CollisionFilterGroups::KinematicFilter };
   short int m_collisionFilterMask{ CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter };
@@ -95,6 +134,10 @@ public:
 
   const std::string& getName() const { return name_; }
   const int& getTypeID() const { return type_id_; }
+  /** @brief Get the handle assigned by the contact manager, -1 if not assigned */
+  int getHandle() const { return handle_; }
+  /** @brief Set the handle assigned by the contact manager */
+  void setHandle(int handle) { handle_ = handle; }
   /** \brief Check if two objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const
   {
@@ -114,10 +157,12 @@ public:
   void setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
   {
     world_pose_ = pose;
+    const tesseract_common::CompactTransform compact_pose(pose);
     for (unsigned i = 0; i < collision_objects_.size(); ++i)
     {
       CollisionObjectPtr& co = collision_objects_[i];
-      co->setTransform(pose * shape_poses_[i]);
+      const tesseract_common::CompactTransform shape_pose = compact_pose * compact_object_poses_[i];
+      co->setTransform(shape_pose.linear, shape_pose.translation);
       co->updateAABB();  // This a tesseract function that updates abb to take into account contact distance
     }
   }
@@ -131,6 +176,7 @@ public:
 
   double getContactDistanceThreshold() const { return contact_distance_; }
   const Eigen::Isometry3d& getCollisionObjectsTransform() const { return world_pose_; }
+  const std::vector<CollisionGeometryPtr>& getFCLCollisionGeometries() const { return collision_geometries_; }
   const std::vector<CollisionObjectPtr>& getCollisionObjects() const { return collision_objects_; }
   std::vector<CollisionObjectPtr>& getCollisionObjects() { return collision_objects_; }
   const std::vector<CollisionObjectRawPtr>& getCollisionObjectsRaw() const { return collision_objects_raw_; }
@@ -142,6 +188,7 @@ public:
     clone_cow->type_id_ = type_id_;
     clone_cow->shapes_ = shapes_;
     clone_cow->shape_poses_ = shape_poses_;
+    clone_cow->compact_object_poses_ = compact_object_poses_;
     clone_cow->collision_geometries_ = collision_geometries_;
 
     clone_cow->collision_objects_.reserve(collision_objects_.size());
@@ -171,14 +218,29 @@ public:
    */
   int getShapeIndex(const fcl::CollisionObjectd* co) const;
 
+  /**
+   * @brief Get the memory used by the collision object
+   * @details The geometries are reported as children and the fcl collision geometries built from them as the
+   * acceleration structure, the collision geometries are shared by the clones of the collision object.
+   * @param tracker Tracks the storage already counted
+   * @return The memory usage report
+   */
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
 protected:
   std::string name_;                                              // name of the collision object
   int type_id_{ -1 };                                             // user defined type id
+  int handle_{ -1 };                                              // handle assigned by the contact manager
   Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() }; /**< @brief Collision Object World Transformation */
   CollisionShapesConst shapes_;
   tesseract_common::VectorIsometry3d shape_poses_;
   std::vector<CollisionGeometryPtr> collision_geometries_;
   std::vector<CollisionObjectPtr> collision_objects_;
+  /**
+   * @brief The pose of each collision object in the frame of the wrapper in compact form
+   * @details A shape has one collision object except a point cloud which has one for each point
+   */
+  tesseract_common::VectorCompactTransform compact_object_poses_;
   /**
    * @brief The raw pointer is also stored because FCL accepts vectors for batch process.
    * Note: They are updating the API to Shared Pointers but the broadphase has not been updated yet.
@@ -188,7 +250,26 @@ protected:
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold */
 };
 
-CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom);
+/**
+ * @brief Create the FCL collision geometry of a shape
+ * @param geom The shape
+ * @param mesh_bv_type The bounding volume type of the hierarchy built for a mesh, it is ignored for other shapes
+ * @return The collision geometry, nullptr if the shape is not supported
+ */
+CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom,
+                                          FCLMeshBVType mesh_bv_type = FCLMeshBVType::OBBRSS);
+
+/**
+ * @brief Update the bounding box of an octree of a collision object after some of its cells changed
+ * @details This only updates the collision object, the broadphase must be updated afterwards
+ * @param cow The collision object
+ * @param shape_index The index of the octree in the collision object's geometries
+ * @param delta The cells whose occupancy changed, which must already be applied to the octree
+ * @return The fcl collision object of the octree, or nullptr if the collision object has no octree at the shape index
+ */
+CollisionObjectRawPtr updateCollisionObjectOctree(CollisionObjectWrapper& cow,
+                                                  std::size_t shape_index,
+                                                  const OctreeDelta& delta);
 
 using COW = CollisionObjectWrapper;
 using Link2COW = std::map<std::string, COW::Ptr>;
@@ -198,7 +279,8 @@ inline COW::Ptr createFCLCollisionObject(const std::string& name,
                                          const int& type_id,
                                          const CollisionShapesConst& shapes,
                                          const tesseract_common::VectorIsometry3d& shape_poses,
-                                         bool enabled)
+                                         bool enabled,
+                                         FCLMeshBVType mesh_bv_type = FCLMeshBVType::OBBRSS)
 {
   // dont add object that does not have geometry
   if (shapes.empty() || shape_poses.empty() || (shapes.size() != shape_poses.size()))
@@ -207,13 +289,26 @@ inline COW::Ptr createFCLCollisionObject(const std::string& name,
     return nullptr;
   }
 
-  auto new_cow = std::make_shared<COW>(name, type_id, shapes, shape_poses);
+  auto new_cow = std::make_shared<COW>(name, type_id, shapes, shape_poses, mesh_bv_type);
 
   new_cow->m_enabled = enabled;
   CONSOLE_BRIDGE_logDebug("Created collision object for link %s", new_cow->getName().c_str());
   return new_cow;
 }
 
+/**
+ * @brief Create several collision objects in parallel
+ * @details The objects are created the same as createFCLCollisionObject using up to one thread per hardware thread, so
+ * the bounding volume hierarchies of meshes are built in parallel.
+ * @return The collision objects ordered the same as names, an object which could not be created is a nullptr
+ */
+std::vector<COW::Ptr> createFCLCollisionObjects(const std::vector<std::string>& names,
+                                                const int& type_id,
+                                                const std::vector<CollisionShapesConst>& shapes,
+                                                const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                bool enabled = true,
+                                                FCLMeshBVType mesh_bv_type = FCLMeshBVType::OBBRSS);
+
 /**
  * @brief Update collision objects filters
  * @param active The active collision objects
@@ -54,4 +54,8 @@ void FCLCollisionObjectWrapper::updateAABB()
   }
 }
 
+void FCLCollisionObjectWrapper::setShapeIndex(int shape_index) { shape_index_ = shape_index; }
+
+int FCLCollisionObjectWrapper::getShapeIndex() const { return shape_index_; }
+
 }  // namespace tesseract_collision::tesseract_collision_fcl
@@ -39,32 +39,90 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <fcl/broadphase/broadphase_SaP-inl.h>
+#include <fcl/broadphase/broadphase_SSaP-inl.h>
+#include <fcl/broadphase/broadphase_interval_tree-inl.h>
+#include <fcl/broadphase/broadphase_spatialhash-inl.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/tracing.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-FCLDiscreteBVHManager::FCLDiscreteBVHManager(std::string name) : name_(std::move(name))
+/**
+ * @brief Create the broadphase manager of the configured type
+ * @details The static and dynamic managers must be of the same type because FCL casts the other manager to its own
+ * type when colliding two managers.
+ */
+static std::unique_ptr<fcl::BroadPhaseCollisionManagerd>
+createBroadphaseManager(const FCLDiscreteBVHManagerConfig& config)
+{
+  switch (config.broadphase_type)
+  {
+    case FCLBroadphaseType::SAP:
+      return std::make_unique<fcl::SaPCollisionManagerd>();
+    case FCLBroadphaseType::SSAP:
+      return std::make_unique<fcl::SSaPCollisionManagerd>();
+    case FCLBroadphaseType::INTERVAL_TREE:
+      return std::make_unique<fcl::IntervalTreeCollisionManagerd>();
+    case FCLBroadphaseType::SPATIAL_HASH:
+      return std::make_unique<fcl::SpatialHashingCollisionManager<double>>(
+          config.spatial_hash_cell_size, config.spatial_hash_scene_min, config.spatial_hash_scene_max);
+    case FCLBroadphaseType::DYNAMIC_AABB_TREE:
+    default:
+      return std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  }
+}
+
+/** @brief Warn if the bounding boxes of the static collision world are not extended enough for the margin */
+static void checkStaticCollisionWorldContactDistance(const FCLStaticCollisionWorld::ConstPtr& world,
+                                                     const CollisionMarginData& collision_margin_data)
+{
+  if (world != nullptr && world->getContactDistance() < collision_margin_data.getMaxCollisionMargin())
+    CONSOLE_BRIDGE_logWarn("FCLDiscreteBVHManager, the contact distance of the static collision world is less than "
+                           "the collision margin, contacts with its objects may be missed!");
+}
+
+FCLDiscreteBVHManager::FCLDiscreteBVHManager(std::string name, FCLDiscreteBVHManagerConfig config)
+  : name_(std::move(name)), config_(std::move(config))
 {
-  static_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
-  dynamic_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  if (config_.broadphase_type == FCLBroadphaseType::SPATIAL_HASH &&
+      (config_.spatial_hash_cell_size <= 0 ||
+       (config_.spatial_hash_scene_max.array() <= config_.spatial_hash_scene_min.array()).any()))
+    throw std::runtime_error("FCLDiscreteBVHManager, the spatial hash cell size or scene volume is invalid!");
+
+  static_manager_ = createBroadphaseManager(config_);
+  dynamic_manager_ = createBroadphaseManager(config_);
   collision_margin_data_ = CollisionMarginData(0);
 }
 
 std::string FCLDiscreteBVHManager::getName() const { return name_; }
 
+const FCLDiscreteBVHManagerConfig& FCLDiscreteBVHManager::getConfig() const { return config_; }
+
 DiscreteContactManager::UPtr FCLDiscreteBVHManager::clone() const
 {
-  auto manager = std::make_unique<FCLDiscreteBVHManager>();
+  TESSERACT_TRACE_ZONE("FCLDiscreteBVHManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("FCLDiscreteBVHManager");
+  clones.increment();
+  auto manager = std::make_unique<FCLDiscreteBVHManager>(name_, config_);
 
-  for (const auto& cow : link2cow_)
-    manager->addCollisionObject(cow.second->clone());
+  // Add in handle order so the clone provides the same handles
+  for (const auto& cow : handle2cow_)
+    manager->addCollisionObject(cow->clone());
 
   manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
   manager->setCollisionMarginData(collision_margin_data_);
   manager->setIsContactAllowedFn(fn_);
+  manager->setStaticCollisionWorld(static_world_);
 
   return manager;
 }
@@ -78,7 +136,7 @@ bool FCLDiscreteBVHManager::addCollisionObject(const std::string& name,
   if (link2cow_.find(name) != link2cow_.end())
     removeCollisionObject(name);
 
-  COW::Ptr new_cow = createFCLCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  COW::Ptr new_cow = createFCLCollisionObject(name, mask_id, shapes, shape_poses, enabled, config_.mesh_bv_type);
   if (new_cow != nullptr)
   {
     addCollisionObject(new_cow);
@@ -88,6 +146,38 @@ bool FCLDiscreteBVHManager::addCollisionObject(const std::string& name,
   return false;
 }
 
+bool FCLDiscreteBVHManager::addCollisionObjects(const std::vector<std::string>& names,
+                                                const int& mask_id,
+                                                const std::vector<CollisionShapesConst>& shapes,
+                                                const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                bool enabled)
+{
+  // The collision objects are independent so they are created in parallel and then added in order
+  std::vector<COW::Ptr> new_cows =
+      createFCLCollisionObjects(names, mask_id, shapes, shape_poses, enabled, config_.mesh_bv_type);
+
+  bool added = true;
+  for (const auto& new_cow : new_cows)
+  {
+    if (new_cow == nullptr)
+    {
+      added = false;
+      continue;
+    }
+
+    if (link2cow_.find(new_cow->getName()) != link2cow_.end())
+      removeCollisionObject(new_cow->getName());
+
+    registerCollisionObject(new_cow);
+  }
+
+  // The bvh trees are refit once for all of the new collision objects
+  dynamic_manager_->update();
+  static_manager_->update();
+
+  return added;
+}
+
 const CollisionShapesConst& FCLDiscreteBVHManager::getCollisionObjectGeometries(const std::string& name) const
 {
   auto cow = link2cow_.find(name);
@@ -135,7 +225,13 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
         dynamic_manager_->unregisterObject(co.get());
     }
 
-    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    // Objects after the removed one shift down so their handle remains their index
+    auto handle = static_cast<std::size_t>(it->second->getHandle());
+    handle2cow_.erase(handle2cow_.begin() + static_cast<long>(handle));
+    for (std::size_t i = handle; i < handle2cow_.size(); ++i)
+      handle2cow_[i]->setHandle(static_cast<int>(i));
+
+    collision_objects_.erase(collision_objects_.begin() + static_cast<long>(handle));
     link2cow_.erase(name);
     return true;
   }
@@ -144,24 +240,12 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
 
 bool FCLDiscreteBVHManager::enableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = true;
-    return true;
-  }
-  return false;
+  return enableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool FCLDiscreteBVHManager::disableCollisionObject(const std::string& name)
 {
-  auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
-  {
-    it->second->m_enabled = false;
-    return true;
-  }
-  return false;
+  return disableCollisionObject(getCollisionObjectHandle(name));
 }
 
 bool FCLDiscreteBVHManager::isCollisionObjectEnabled(const std::string& name) const
@@ -173,26 +257,55 @@ bool FCLDiscreteBVHManager::isCollisionObjectEnabled(const std::string& name) co
   return false;
 }
 
-void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+int FCLDiscreteBVHManager::getCollisionObjectHandle(const std::string& name) const
 {
   auto it = link2cow_.find(name);
-  if (it != link2cow_.end())
+  return (it != link2cow_.end()) ? it->second->getHandle() : -1;
+}
+
+bool FCLDiscreteBVHManager::enableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = true;
+  return true;
+}
+
+bool FCLDiscreteBVHManager::disableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = false;
+  return true;
+}
+
+void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(getCollisionObjectHandle(name), pose);
+}
+
+void FCLDiscreteBVHManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return;
+
+  const COW::Ptr& cow = handle2cow_[static_cast<std::size_t>(handle)];
+  const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+  // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+  if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) || !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
   {
-    const Eigen::Isometry3d& cur_tf = it->second->getCollisionObjectsTransform();
-    // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
-    if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) || !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
+    cow->setCollisionObjectsTransform(pose);
+    if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
     {
-      it->second->setCollisionObjectsTransform(pose);
-      if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
-      {
-        // Note: Calling update causes a re-balance of the AABB tree, which is expensive
-        static_manager_->update(it->second->getCollisionObjectsRaw());
-      }
-      else
-      {
-        // Note: Calling update causes a re-balance of the AABB tree, which is expensive
-        dynamic_manager_->update(it->second->getCollisionObjectsRaw());
-      }
+      // Note: Calling update causes a re-balance of the AABB tree, which is expensive
+      static_manager_->update(cow->getCollisionObjectsRaw());
+    }
+    else
+    {
+      // Note: Calling update causes a re-balance of the AABB tree, which is expensive
+      dynamic_manager_->update(cow->getCollisionObjectsRaw());
     }
   }
 }
@@ -271,6 +384,28 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_common:
     dynamic_manager_->update(dynamic_update_);
 }
 
+bool FCLDiscreteBVHManager::updateCollisionObjectOctree(const std::string& name,
+                                                        std::size_t shape_index,
+                                                        const OctreeDelta& delta)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  const COW::Ptr& cow = it->second;
+  CollisionObjectRawPtr co = tesseract_collision_fcl::updateCollisionObjectOctree(*cow, shape_index, delta);
+  if (co == nullptr)
+    return false;
+
+  // Only refit the broadphase for the octree's collision object
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+    static_manager_->update(co);
+  else
+    dynamic_manager_->update(co);
+
+  return true;
+}
+
 const std::vector<std::string>& FCLDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void FCLDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -286,6 +421,38 @@ void FCLDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::str
 }
 
 const std::vector<std::string>& FCLDiscreteBVHManager::getActiveCollisionObjects() const { return active_; }
+
+void FCLDiscreteBVHManager::setCollisionObjectsActive(const std::vector<std::string>& names, bool active)
+{
+  // Only the changed objects move between the static and dynamic managers
+  bool changed{ false };
+  for (const auto& name : names)
+  {
+    auto it = std::find(active_.begin(), active_.end(), name);
+    if ((it != active_.end()) == active)
+      continue;
+
+    if (active)
+      active_.push_back(name);
+    else
+      active_.erase(it);
+
+    auto cow_it = link2cow_.find(name);
+    if (cow_it == link2cow_.end())
+      continue;
+
+    updateCollisionObjectFilters(active_, cow_it->second, static_manager_, dynamic_manager_);
+    changed = true;
+  }
+
+  // This causes a refit on the bvh tree.
+  if (changed)
+  {
+    dynamic_manager_->update();
+    static_manager_->update();
+  }
+}
+
 void FCLDiscreteBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
                                                    CollisionMarginOverrideType override_type)
 {
@@ -311,40 +478,151 @@ const CollisionMarginData& FCLDiscreteBVHManager::getCollisionMarginData() const
 void FCLDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
 IsContactAllowedFn FCLDiscreteBVHManager::getIsContactAllowedFn() const { return fn_; }
 
+void FCLDiscreteBVHManager::setStatisticsEnabled(bool enabled) { statistics_enabled_ = enabled; }
+
+bool FCLDiscreteBVHManager::getStatisticsEnabled() const { return statistics_enabled_; }
+
+ContactManagerStatistics FCLDiscreteBVHManager::getStatistics() const { return statistics_; }
+
+void FCLDiscreteBVHManager::clearStatistics() { statistics_.clear(); }
+
+tesseract_common::MemoryUsage
+FCLDiscreteBVHManager::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(FCLDiscreteBVHManager) + tesseract_common::getVectorBytes(handle2cow_);
+  for (const auto& cow : link2cow_)
+    usage.children.push_back(cow.second->getMemoryUsage(tracker));
+
+  // The dynamic AABB tree managers have an internal and a leaf node for each fcl collision object
+  using NodeType = fcl::detail::NodeBase<fcl::AABBd>;
+  usage.addChild("broadphase").unique_bytes = 2 * fcl_co_count_ * (sizeof(NodeType) + sizeof(void*));
+
+  return usage;
+}
+
+void FCLDiscreteBVHManager::setStaticCollisionWorld(FCLStaticCollisionWorld::ConstPtr world)
+{
+  static_world_ = std::move(world);
+  checkStaticCollisionWorldContactDistance(static_world_, collision_margin_data_);
+}
+
+const FCLStaticCollisionWorld::ConstPtr& FCLDiscreteBVHManager::getStaticCollisionWorld() const
+{
+  return static_world_;
+}
+
 void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+  TESSERACT_TRACE_ZONE("FCLDiscreteBVHManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("FCLDiscreteBVHManager");
+  const tesseract_common::MetricTimer timer(latency);
   ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
-  if (collision_margin_data_.getMaxCollisionMargin() > 0 && request.calculate_distance)
+  runContactTest(cdata);
+}
+
+void FCLDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                             const std::vector<tesseract_common::TransformMap>& transforms,
+                                             const ContactRequest& request)
+{
+  collisions.resize(transforms.size());
+  if (collisions.empty())
+    return;
+
+  // The contact test data copies the margin data, allowed collision function and request so only create it once
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions.front());
+  for (std::size_t i = 0; i < transforms.size(); ++i)
   {
-    // TODO: Should the order be flipped?
-    if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &distanceCallback);
+    setCollisionObjectsTransform(transforms[i]);
+    collisions[i].clear();
+    cdata.res = &collisions[i];
+    cdata.done = false;
+    runContactTest(cdata);
+  }
+}
 
-    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &distanceCallback);
+void FCLDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                             const std::vector<std::string>& names,
+                                             const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                                             const ContactRequest& request)
+{
+  collisions.resize(poses.size());
+  if (collisions.empty())
+    return;
+
+  // Look up the collision objects once for the whole batch, names not managed are stored as nullptr
+  std::vector<COW::Ptr> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    cows.push_back((it != link2cow_.end()) ? it->second : nullptr);
   }
-  else
+
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions.front());
+  for (std::size_t i = 0; i < poses.size(); ++i)
   {
-    // TODO: Should the order be flipped?
-    if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &collisionCallback);
+    if (poses[i].size() != cows.size())
+      throw std::runtime_error("FCLDiscreteBVHManager, batchContactTest number of poses does not match names!");
 
-    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &collisionCallback);
+    static_update_.clear();
+    dynamic_update_.clear();
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      if (cows[j] == nullptr)
+        continue;
+
+      const Eigen::Isometry3d& cur_tf = cows[j]->getCollisionObjectsTransform();
+      // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+      if (!cur_tf.translation().isApprox(poses[i][j].translation(), 1e-8) ||
+          !cur_tf.rotation().isApprox(poses[i][j].rotation(), 1e-8))
+      {
+        cows[j]->setCollisionObjectsTransform(poses[i][j]);
+        std::vector<CollisionObjectRawPtr>& co = cows[j]->getCollisionObjectsRaw();
+        if (cows[j]->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+          static_update_.insert(static_update_.end(), co.begin(), co.end());
+        else
+          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+      }
+    }
+
+    // This is because FCL supports batch update which only re-balances the tree once
+    if (!static_update_.empty())
+      static_manager_->update(static_update_);
+
+    if (!dynamic_update_.empty())
+      dynamic_manager_->update(dynamic_update_);
+
+    collisions[i].clear();
+    cdata.res = &collisions[i];
+    cdata.done = false;
+    runContactTest(cdata);
   }
 }
 
 void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
+{
+  registerCollisionObject(cow);
+
+  // This causes a refit on the bvh tree.
+  dynamic_manager_->update();
+  static_manager_->update();
+}
+
+void FCLDiscreteBVHManager::registerCollisionObject(const COW::Ptr& cow)
 {
   std::size_t cnt = cow->getCollisionObjectsRaw().size();
   fcl_co_count_ += cnt;
   static_update_.reserve(fcl_co_count_);
   dynamic_update_.reserve(fcl_co_count_);
+  cow->setHandle(static_cast<int>(handle2cow_.size()));
   link2cow_[cow->getName()] = cow;
+  handle2cow_.push_back(cow);
   collision_objects_.push_back(cow->getName());
 
+  // Objects added after the margin was set, like a replaced point cloud, must have their bounding boxes expanded too
+  cow->setContactDistanceThreshold(collision_margin_data_.getMaxCollisionMargin() / 2.0);
+
   std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
   if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
   {
@@ -361,10 +639,6 @@ void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
   // If active links is not empty update filters to replace the active links list
   if (!active_.empty())
     updateCollisionObjectFilters(active_, cow, static_manager_, dynamic_manager_);
-
-  // This causes a refit on the bvh tree.
-  dynamic_manager_->update();
-  static_manager_->update();
 }
 
 void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
@@ -391,5 +665,64 @@ void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
 
   if (!dynamic_update_.empty())
     dynamic_manager_->update(dynamic_update_);
+
+  checkStaticCollisionWorldContactDistance(static_world_, collision_margin_data_);
+}
+
+void FCLDiscreteBVHManager::runContactTest(ContactTestData& cdata)
+{
+  ContactManagerStatistics* statistics = statistics_enabled_ ? &statistics_ : nullptr;
+  if (statistics != nullptr)
+    ++statistics->contact_tests;
+
+  ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->contact_test_time : nullptr);
+  cdata.statistics = statistics;
+
+  if (collision_margin_data_.getMaxCollisionMargin() > 0 && cdata.req.calculate_distance)
+  {
+    // TODO: Should the order be flipped?
+    if (!static_manager_->empty())
+      static_manager_->collide(dynamic_manager_.get(), &cdata, &distanceCallback);
+
+    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
+    if (!cdata.done && !dynamic_manager_->empty())
+      dynamic_manager_->collide(&cdata, &distanceCallback);
+
+    collideStaticCollisionWorld(cdata, &distanceCallback);
+  }
+  else
+  {
+    // TODO: Should the order be flipped?
+    if (!static_manager_->empty())
+      static_manager_->collide(dynamic_manager_.get(), &cdata, &collisionCallback);
+
+    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
+    if (!cdata.done && !dynamic_manager_->empty())
+      dynamic_manager_->collide(&cdata, &collisionCallback);
+
+    collideStaticCollisionWorld(cdata, &collisionCallback);
+  }
+}
+
+void FCLDiscreteBVHManager::collideStaticCollisionWorld(ContactTestData& cdata,
+                                                        fcl::CollisionCallBack<double> callback)
+{
+  if (static_world_ == nullptr)
+    return;
+
+  // The world may use a different broadphase than the dynamic manager, so each active object is checked on its own
+  for (const auto& cow : handle2cow_)
+  {
+    if (!cow->m_enabled || cow->m_collisionFilterGroup != CollisionFilterGroups::KinematicFilter)
+      continue;
+
+    for (auto* co : cow->getCollisionObjectsRaw())
+    {
+      if (cdata.done)
+        return;
+
+      static_world_->collide(co, &cdata, callback);
+    }
+  }
 }
 }  // namespace tesseract_collision::tesseract_collision_fcl
@@ -24,15 +24,91 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/fcl/fcl_factories.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/core/conservative_advancement_continuous_manager.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
+namespace
+{
+/** @brief Get the index of a config value in a list of enum strings, throws if it is not in the list */
+std::size_t parseEnum(const YAML::Node& node, const std::string& key, const std::vector<std::string>& strings)
+{
+  const auto value = node.as<std::string>();
+  auto it = std::find(strings.begin(), strings.end(), value);
+  if (it == strings.end())
+    throw std::runtime_error("FCLDiscreteBVHManagerFactory, " + key + " '" + value + "' is not supported!");
+
+  return static_cast<std::size_t>(std::distance(strings.begin(), it));
+}
+
+Eigen::Vector3d parseVector3d(const YAML::Node& node, const std::string& key)
+{
+  const auto values = node.as<std::vector<double>>();
+  if (values.size() != 3)
+    throw std::runtime_error("FCLDiscreteBVHManagerFactory, " + key + " must have three values!");
+
+  return { values[0], values[1], values[2] };
+}
+
+FCLDiscreteBVHManagerConfig parseConfig(const YAML::Node& config)
+{
+  FCLDiscreteBVHManagerConfig manager_config;
+  if (!config)
+    return manager_config;
+
+  if (YAML::Node n = config["broadphase_type"])
+    manager_config.broadphase_type =
+        static_cast<FCLBroadphaseType>(parseEnum(n, "broadphase_type", FCLBroadphaseTypeStrings));
+
+  if (YAML::Node n = config["mesh_bv_type"])
+    manager_config.mesh_bv_type = static_cast<FCLMeshBVType>(parseEnum(n, "mesh_bv_type", FCLMeshBVTypeStrings));
+
+  if (YAML::Node n = config["spatial_hash_cell_size"])
+    manager_config.spatial_hash_cell_size = n.as<double>();
+
+  if (YAML::Node n = config["spatial_hash_scene_min"])
+    manager_config.spatial_hash_scene_min = parseVector3d(n, "spatial_hash_scene_min");
+
+  if (YAML::Node n = config["spatial_hash_scene_max"])
+    manager_config.spatial_hash_scene_max = parseVector3d(n, "spatial_hash_scene_max");
+
+  if (manager_config.mesh_bv_type == FCLMeshBVType::AABB)
+    CONSOLE_BRIDGE_logWarn("FCLDiscreteBVHManagerFactory, the AABB mesh_bv_type only supports collision checks, FCL "
+                           "does not compute distances for it!");
+
+  return manager_config;
+}
+}  // namespace
+
 DiscreteContactManager::UPtr FCLDiscreteBVHManagerFactory::create(const std::string& name,
-                                                                  const YAML::Node& /*config*/) const
+                                                                  const YAML::Node& config) const
 {
-  return std::make_unique<FCLDiscreteBVHManager>(name);
+  return std::make_unique<FCLDiscreteBVHManager>(name, parseConfig(config));
+}
+
+ContinuousContactManager::UPtr FCLCastBVHManagerFactory::create(const std::string& name,
+                                                                const YAML::Node& config) const
+{
+  double tolerance{ 1e-4 };
+  std::size_t max_iterations{ 100 };
+
+  if (YAML::Node n = config["tolerance"])
+    tolerance = n.as<double>();
+
+  if (YAML::Node n = config["max_iterations"])
+    max_iterations = n.as<std::size_t>();
+
+  return std::make_unique<ConservativeAdvancementContinuousManager>(
+      std::make_unique<FCLDiscreteBVHManager>(name, parseConfig(config)), tolerance, max_iterations);
 }
 
 TESSERACT_PLUGIN_ANCHOR_IMPL(FCLFactoriesAnchor)  // LCOV_EXCL_LINE
@@ -42,3 +118,6 @@ TESSERACT_PLUGIN_ANCHOR_IMPL(FCLFactoriesAnchor)  // LCOV_EXCL_LINE
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_fcl::FCLDiscreteBVHManagerFactory,
                                       FCLDiscreteBVHManagerFactory);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_CONTINUOUS_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_fcl::FCLCastBVHManagerFactory,
+                                        FCLCastBVHManagerFactory);
@@ -0,0 +1,113 @@
+/**
+ * @file fcl_static_collision_world.cpp
+ * @brief Static FCL collision objects shared by several contact managers
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/fcl/fcl_static_collision_world.h>
+
+namespace tesseract_collision::tesseract_collision_fcl
+{
+FCLStaticCollisionWorld::FCLStaticCollisionWorld(double contact_distance, FCLMeshBVType mesh_bv_type)
+  : contact_distance_(contact_distance)
+  , mesh_bv_type_(mesh_bv_type)
+  , manager_(std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>())
+{
+  if (contact_distance_ < 0)
+    throw std::runtime_error("FCLStaticCollisionWorld, the contact distance must not be negative!");
+}
+
+bool FCLStaticCollisionWorld::addCollisionObject(const std::string& name,
+                                                 const int& mask_id,
+                                                 const CollisionShapesConst& shapes,
+                                                 const tesseract_common::VectorIsometry3d& shape_poses,
+                                                 const Eigen::Isometry3d& pose)
+{
+  COW::Ptr cow = createFCLCollisionObject(name, mask_id, shapes, shape_poses, true, mesh_bv_type_);
+  if (cow == nullptr)
+    return false;
+
+  // The objects of the world only collide with the active objects of the contact managers
+  cow->m_collisionFilterGroup = CollisionFilterGroups::StaticFilter;
+  cow->m_collisionFilterMask = CollisionFilterGroups::KinematicFilter;
+  cow->setContactDistanceThreshold(contact_distance_ / 2.0);
+  cow->setCollisionObjectsTransform(pose);
+
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    for (auto& co : it->second->getCollisionObjects())
+      manager_->unregisterObject(co.get());
+
+    it->second = cow;
+  }
+  else
+  {
+    link2cow_[name] = cow;
+    collision_objects_.push_back(name);
+  }
+
+  for (auto& co : cow->getCollisionObjects())
+    manager_->registerObject(co.get());
+
+  // This causes a refit on the bvh tree.
+  manager_->update();
+  return true;
+}
+
+bool FCLStaticCollisionWorld::hasCollisionObject(const std::string& name) const
+{
+  return (link2cow_.find(name) != link2cow_.end());
+}
+
+const std::vector<std::string>& FCLStaticCollisionWorld::getCollisionObjects() const { return collision_objects_; }
+
+double FCLStaticCollisionWorld::getContactDistance() const { return contact_distance_; }
+
+void FCLStaticCollisionWorld::collide(fcl::CollisionObjectd* co,
+                                      void* cdata,
+                                      fcl::CollisionCallBack<double> callback) const
+{
+  if (!manager_->empty())
+    manager_->collide(co, cdata, callback);
+}
+
+}  // namespace tesseract_collision::tesseract_collision_fcl
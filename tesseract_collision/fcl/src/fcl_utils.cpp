@@ -41,6 +41,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/geometry/bvh/BVH_model-inl.h>
+#include <fcl/math/bv/AABB-inl.h>
+#include <fcl/math/bv/kIOS-inl.h>
+#include <fcl/math/bv/OBBRSS-inl.h>
+#include <fcl/math/bv/RSS-inl.h>
 #include <fcl/geometry/shape/box-inl.h>
 #include <fcl/geometry/shape/cylinder-inl.h>
 #include <fcl/geometry/shape/convex-inl.h>
@@ -49,10 +53,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/geometry/shape/cone-inl.h>
 #include <fcl/geometry/shape/capsule-inl.h>
 #include <fcl/geometry/octree/octree-inl.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <stdexcept>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/fcl/fcl_utils.h>
+#include <tesseract_collision/core/primitive_distance.h>
+#include <tesseract_common/executor.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
@@ -86,30 +96,54 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Capsule::Con
   return std::make_shared<fcl::Capsuled>(geom->getRadius(), geom->getLength());
 }
 
-CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom)
+namespace
 {
-  int vertice_count = geom->getVertexCount();
-  int triangle_count = geom->getFaceCount();
-  const tesseract_common::VectorVector3d& vertices = *(geom->getVertices());
-  const Eigen::VectorXi& triangles = *(geom->getFaces());
-
-  auto g = std::make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
-  if (vertice_count > 0 && triangle_count > 0)
-  {
+/**
+ * @brief Get the bounding volume hierarchy of a mesh, it is built on first use
+ * @details The hierarchy is only read by the queries, so it is built once per bounding volume type and shared by
+ * every manager
+ */
+template <typename BV>
+CollisionGeometryPtr getMeshBVHModel(const tesseract_geometry::Mesh::ConstPtr& geom, const std::string& key)
+{
+  return geom->getAttachment<fcl::BVHModel<BV>>(key, [&geom]() {
+    const int triangle_count = geom->getFaceCount();
+    const tesseract_geometry::PolygonMesh::TriangleMap triangles = geom->getTriangleMap();
     std::vector<fcl::Triangle> tri_indices(static_cast<size_t>(triangle_count));
     for (int i = 0; i < triangle_count; ++i)
     {
-      assert(triangles[4L * i] == 3);
-      tri_indices[static_cast<size_t>(i)] = fcl::Triangle(static_cast<size_t>(triangles[(4 * i) + 1]),
-                                                          static_cast<size_t>(triangles[(4 * i) + 2]),
-                                                          static_cast<size_t>(triangles[(4 * i) + 3]));
+      tri_indices[static_cast<size_t>(i)] = fcl::Triangle(static_cast<size_t>(triangles(0, i)),
+                                                          static_cast<size_t>(triangles(1, i)),
+                                                          static_cast<size_t>(triangles(2, i)));
     }
 
+    auto g = std::make_shared<fcl::BVHModel<BV>>();
     g->beginModel();
-    g->addSubModel(vertices, tri_indices);
+    g->addSubModel(*geom->getVertices(), tri_indices);
     g->endModel();
-
     return g;
+  });
+}
+}  // namespace
+
+CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom, FCLMeshBVType bv_type)
+{
+  int vertice_count = geom->getVertexCount();
+  int triangle_count = geom->getFaceCount();
+  if (vertice_count > 0 && triangle_count > 0)
+  {
+    switch (bv_type)
+    {
+      case FCLMeshBVType::RSS:
+        return getMeshBVHModel<fcl::RSSd>(geom, "fcl_bvh_rss");
+      case FCLMeshBVType::KIOS:
+        return getMeshBVHModel<fcl::kIOSd>(geom, "fcl_bvh_kios");
+      case FCLMeshBVType::AABB:
+        return getMeshBVHModel<fcl::AABBd>(geom, "fcl_bvh_aabb");
+      case FCLMeshBVType::OBBRSS:
+      default:
+        return getMeshBVHModel<fcl::OBBRSSd>(geom, "fcl_bvh_obbrss");
+    }
   }
 
   CONSOLE_BRIDGE_logError("The mesh is empty!");
@@ -123,21 +157,144 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::ConvexMesh::
 
   if (vertice_count > 0 && face_count > 0)
   {
-    auto faces = std::make_shared<const std::vector<int>>(geom->getFaces()->data(),
-                                                          geom->getFaces()->data() + geom->getFaces()->size());
-    return std::make_shared<fcl::Convexd>(geom->getVertices(), face_count, faces);
+    return geom->getAttachment<fcl::Convexd>("fcl_convex", [&geom, face_count]() {
+      auto faces = std::make_shared<const std::vector<int>>(geom->getFaces()->data(),
+                                                            geom->getFaces()->data() + geom->getFaces()->size());
+      return std::make_shared<fcl::Convexd>(geom->getVertices(), face_count, faces);
+    });
   }
 
   CONSOLE_BRIDGE_logError("The mesh is empty!");
   return nullptr;
 }
 
+namespace
+{
+/**
+ * @brief Set the local bounding box of an octree
+ * @details FCL uses the bounding box of the whole key space of the octree, which prevents the broadphase from culling
+ * it. The octree traversal uses its own root bounding box so a smaller local bounding box only affects the broadphase.
+ */
+void setOctreeLocalAABB(fcl::CollisionGeometryd& octree,
+                        const Eigen::Vector3d& aabb_min,
+                        const Eigen::Vector3d& aabb_max)
+{
+  octree.aabb_local = fcl::AABBd(aabb_min, aabb_max);
+  octree.aabb_center = octree.aabb_local.center();
+  octree.aabb_radius = (octree.aabb_local.min_ - octree.aabb_center).norm();
+}
+
+/** @brief Get the type of the shape a fcl collision object is reported with in the contact manager statistics */
+tesseract_geometry::GeometryType getStatisticsGeometryType(const CollisionObjectWrapper& cow,
+                                                           const fcl::CollisionObjectd* co)
+{
+  const int index = cow.getShapeIndex(co);
+  if (index < 0)
+    return tesseract_geometry::GeometryType::UNINITIALIZED;
+
+  return cow.getCollisionGeometries()[static_cast<std::size_t>(index)]->getType();
+}
+
+/** @brief Get the distance tolerance of a fcl collision object, zero unless its shape is an octree with a tolerance */
+double getOctreeDistanceTolerance(const CollisionObjectWrapper& cow, const fcl::CollisionObjectd* co)
+{
+  const int index = cow.getShapeIndex(co);
+  if (index < 0)
+    return 0;
+
+  const auto& shape = cow.getCollisionGeometries()[static_cast<std::size_t>(index)];
+  if (shape->getType() != tesseract_geometry::GeometryType::OCTREE)
+    return 0;
+
+  return static_cast<const tesseract_geometry::Octree&>(*shape).getDistanceTolerance();
+}
+
+/**
+ * @brief Calculate the distance of sphere, capsule and box pairs with the closed form kernels of primitive_distance.h
+ * instead of the generic GJK solver of fcl
+ * @details The supported pairs are sphere-sphere, sphere-capsule, capsule-capsule, sphere-box and box-box
+ * @return False if the pair is not supported
+ */
+bool calcPrimitiveDistance(fcl::DistanceResultd& fcl_result,
+                           const fcl::CollisionObjectd* o1,
+                           const fcl::CollisionObjectd* o2)
+{
+  const fcl::CollisionGeometryd* g1 = o1->collisionGeometry().get();
+  const fcl::CollisionGeometryd* g2 = o2->collisionGeometry().get();
+  const fcl::NODE_TYPE type1 = g1->getNodeType();
+  const fcl::NODE_TYPE type2 = g2->getNodeType();
+  const Eigen::Isometry3d& tf1 = o1->getTransform();
+  const Eigen::Isometry3d& tf2 = o2->getTransform();
+
+  PrimitiveDistanceResult result;
+  if (type1 == fcl::GEOM_SPHERE && type2 == fcl::GEOM_SPHERE)
+  {
+    calcSphereSphereDistance(result,
+                             static_cast<const fcl::Sphered*>(g1)->radius,
+                             tf1,
+                             static_cast<const fcl::Sphered*>(g2)->radius,
+                             tf2);
+  }
+  else if (type1 == fcl::GEOM_SPHERE && type2 == fcl::GEOM_CAPSULE)
+  {
+    const auto* capsule = static_cast<const fcl::Capsuled*>(g2);
+    calcSphereCapsuleDistance(
+        result, static_cast<const fcl::Sphered*>(g1)->radius, tf1, capsule->radius, 0.5 * capsule->lz, tf2);
+  }
+  else if (type1 == fcl::GEOM_CAPSULE && type2 == fcl::GEOM_SPHERE)
+  {
+    const auto* capsule = static_cast<const fcl::Capsuled*>(g1);
+    calcSphereCapsuleDistance(
+        result, static_cast<const fcl::Sphered*>(g2)->radius, tf2, capsule->radius, 0.5 * capsule->lz, tf1);
+    std::swap(result.nearest_points[0], result.nearest_points[1]);
+  }
+  else if (type1 == fcl::GEOM_CAPSULE && type2 == fcl::GEOM_CAPSULE)
+  {
+    const auto* capsule1 = static_cast<const fcl::Capsuled*>(g1);
+    const auto* capsule2 = static_cast<const fcl::Capsuled*>(g2);
+    calcCapsuleCapsuleDistance(
+        result, capsule1->radius, 0.5 * capsule1->lz, tf1, capsule2->radius, 0.5 * capsule2->lz, tf2);
+  }
+  else if (type1 == fcl::GEOM_SPHERE && type2 == fcl::GEOM_BOX)
+  {
+    calcSphereBoxDistance(
+        result, static_cast<const fcl::Sphered*>(g1)->radius, tf1, 0.5 * static_cast<const fcl::Boxd*>(g2)->side, tf2);
+  }
+  else if (type1 == fcl::GEOM_BOX && type2 == fcl::GEOM_SPHERE)
+  {
+    calcSphereBoxDistance(
+        result, static_cast<const fcl::Sphered*>(g2)->radius, tf2, 0.5 * static_cast<const fcl::Boxd*>(g1)->side, tf1);
+    std::swap(result.nearest_points[0], result.nearest_points[1]);
+  }
+  else if (type1 == fcl::GEOM_BOX && type2 == fcl::GEOM_BOX)
+  {
+    calcBoxBoxDistance(
+        result, 0.5 * static_cast<const fcl::Boxd*>(g1)->side, tf1, 0.5 * static_cast<const fcl::Boxd*>(g2)->side, tf2);
+  }
+  else
+  {
+    return false;
+  }
+
+  fcl_result.update(result.distance,
+                    g1,
+                    g2,
+                    fcl::DistanceResultd::NONE,
+                    fcl::DistanceResultd::NONE,
+                    result.nearest_points[0],
+                    result.nearest_points[1]);
+  return true;
+}
+}  // namespace
+
 CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom)
 {
   switch (geom->getSubType())
   {
     case tesseract_geometry::Octree::SubType::BOX:
+    case tesseract_geometry::Octree::SubType::MERGED_BOX:
     {
+      // The FCL octree already traverses the pruned cells as boxes
       return std::make_shared<fcl::OcTreed>(geom->getOctree());
     }
     default:
@@ -149,7 +306,7 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Octree::Cons
   }
 }
 
-CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom)
+CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom, FCLMeshBVType mesh_bv_type)
 {
   switch (geom->getType())
   {
@@ -179,7 +336,7 @@ CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom)
     }
     case tesseract_geometry::GeometryType::MESH:
     {
-      return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom));
+      return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), mesh_bv_type);
     }
     case tesseract_geometry::GeometryType::CONVEX_MESH:
     {
@@ -209,6 +366,10 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
   const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
   assert(cd1->getName() != cd2->getName());
 
+  ContactManagerStatistics* statistics = cdata->statistics;
+  if (statistics != nullptr)
+    ++statistics->broadphase_pairs;
+
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
@@ -218,7 +379,12 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
 
   if (!needs_collision)
+  {
+    if (statistics != nullptr)
+      ++statistics->rejected_pairs;
+
     return false;
+  }
 
   std::size_t num_contacts = (cdata->req.contact_limit > 0) ? static_cast<std::size_t>(cdata->req.contact_limit) :
                                                               std::numeric_limits<std::size_t>::max();
@@ -226,14 +392,21 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
     num_contacts = 1;
 
   fcl::CollisionResultd col_result;
-  fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
+  {
+    ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->narrowphase_time : nullptr);
+    fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
+  }
+
+  if (statistics != nullptr)
+    statistics->addNarrowphaseCall(getStatisticsGeometryType(*cd1, o1), getStatisticsGeometryType(*cd2, o2));
 
   if (col_result.isCollision())
   {
     const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
     const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
-    Eigen::Isometry3d tf1_inv = tf1.inverse();
-    Eigen::Isometry3d tf2_inv = tf2.inverse();
+    const bool full_detail = (cdata->req.detail == ContactResultDetail::FULL);
+    Eigen::Isometry3d tf1_inv = full_detail ? tf1.inverse() : Eigen::Isometry3d::Identity();
+    Eigen::Isometry3d tf2_inv = full_detail ? tf2.inverse() : Eigen::Isometry3d::Identity();
 
     for (size_t i = 0; i < col_result.numContacts(); ++i)
     {
@@ -241,20 +414,28 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
       ContactResult contact;
       contact.link_names[0] = cd1->getName();
       contact.link_names[1] = cd2->getName();
+      contact.link_handles[0] = cd1->getHandle();
+      contact.link_handles[1] = cd2->getHandle();
       contact.shape_id[0] = static_cast<int>(cd1->getShapeIndex(o1));
       contact.shape_id[1] = static_cast<int>(cd2->getShapeIndex(o2));
       contact.subshape_id[0] = static_cast<int>(fcl_contact.b1);
       contact.subshape_id[1] = static_cast<int>(fcl_contact.b2);
-      contact.nearest_points[0] = fcl_contact.pos;
-      contact.nearest_points[1] = fcl_contact.pos;
-      contact.nearest_points_local[0] = tf1_inv * contact.nearest_points[0];
-      contact.nearest_points_local[1] = tf2_inv * contact.nearest_points[1];
-      contact.transform[0] = tf1;
-      contact.transform[1] = tf2;
       contact.type_id[0] = cd1->getTypeID();
       contact.type_id[1] = cd2->getTypeID();
       contact.distance = -1.0 * fcl_contact.penetration_depth;
-      contact.normal = fcl_contact.normal;
+
+      if (cdata->req.detail != ContactResultDetail::BINARY)
+        contact.normal = fcl_contact.normal;
+
+      if (full_detail)
+      {
+        contact.nearest_points[0] = fcl_contact.pos;
+        contact.nearest_points[1] = fcl_contact.pos;
+        contact.nearest_points_local[0] = tf1_inv * contact.nearest_points[0];
+        contact.nearest_points_local[1] = tf2_inv * contact.nearest_points[1];
+        contact.transform[0] = tf1;
+        contact.transform[1] = tf2;
+      }
 
       ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
       const auto& it = cdata->res->find(pc);
@@ -278,6 +459,10 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
   assert(cd1->getName() != cd2->getName());
 
+  ContactManagerStatistics* statistics = cdata->statistics;
+  if (statistics != nullptr)
+    ++statistics->broadphase_pairs;
+
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
@@ -287,39 +472,66 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
 
   if (!needs_collision)
+  {
+    if (statistics != nullptr)
+      ++statistics->rejected_pairs;
+
     return false;
+  }
 
+  // The nearest points are only needed to calculate the normal and nearest point data
   fcl::DistanceResultd fcl_result;
-  fcl::DistanceRequestd fcl_request(true, true);
-  double d = fcl::distance(o1, o2, fcl_request, fcl_result);
+  fcl::DistanceRequestd fcl_request(cdata->req.detail != ContactResultDetail::BINARY, true);
 
-  if (d < cdata->collision_margin_data.getMaxCollisionMargin())
+  // The octree traversal of fcl is already nearest first, the tolerance lets it stop refining the nodes early
+  fcl_request.abs_err = std::max(getOctreeDistanceTolerance(*cd1, o1), getOctreeDistanceTolerance(*cd2, o2));
+  double d{ 0 };
   {
-    const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
-    const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
-    Eigen::Isometry3d tf1_inv = tf1.inverse();
-    Eigen::Isometry3d tf2_inv = tf2.inverse();
+    ContactManagerStatisticsTimer timer((statistics != nullptr) ? &statistics->narrowphase_time : nullptr);
+    if (calcPrimitiveDistance(fcl_result, o1, o2))
+      d = fcl_result.min_distance;
+    else
+      d = fcl::distance(o1, o2, fcl_request, fcl_result);
+  }
+
+  if (statistics != nullptr)
+    statistics->addNarrowphaseCall(getStatisticsGeometryType(*cd1, o1), getStatisticsGeometryType(*cd2, o2));
 
+  if (d < cdata->collision_margin_data.getMaxCollisionMargin())
+  {
     ContactResult contact;
     contact.link_names[0] = cd1->getName();
     contact.link_names[1] = cd2->getName();
+    contact.link_handles[0] = cd1->getHandle();
+    contact.link_handles[1] = cd2->getHandle();
     contact.shape_id[0] = cd1->getShapeIndex(o1);
     contact.shape_id[1] = cd2->getShapeIndex(o2);
     contact.subshape_id[0] = static_cast<int>(fcl_result.b1);
     contact.subshape_id[1] = static_cast<int>(fcl_result.b2);
-    contact.nearest_points[0] = fcl_result.nearest_points[0];
-    contact.nearest_points[1] = fcl_result.nearest_points[1];
-    contact.nearest_points_local[0] = tf1_inv * contact.nearest_points[0];
-    contact.nearest_points_local[1] = tf2_inv * contact.nearest_points[1];
-    contact.transform[0] = tf1;
-    contact.transform[1] = tf2;
     contact.type_id[0] = cd1->getTypeID();
     contact.type_id[1] = cd2->getTypeID();
     contact.distance = fcl_result.min_distance;
-    contact.normal = (fcl_result.min_distance * (contact.nearest_points[1] - contact.nearest_points[0])).normalized();
 
-    // TODO: There is an issue with FCL need to track down
-    assert(!std::isnan(contact.nearest_points[0](0)));
+    if (cdata->req.detail != ContactResultDetail::BINARY)
+    {
+      contact.normal =
+          (fcl_result.min_distance * (fcl_result.nearest_points[1] - fcl_result.nearest_points[0])).normalized();
+
+      // TODO: There is an issue with FCL need to track down
+      assert(!std::isnan(fcl_result.nearest_points[0](0)));
+    }
+
+    if (cdata->req.detail == ContactResultDetail::FULL)
+    {
+      const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
+      const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
+      contact.nearest_points[0] = fcl_result.nearest_points[0];
+      contact.nearest_points[1] = fcl_result.nearest_points[1];
+      contact.nearest_points_local[0] = tf1.inverse() * contact.nearest_points[0];
+      contact.nearest_points_local[1] = tf2.inverse() * contact.nearest_points[1];
+      contact.transform[0] = tf1;
+      contact.transform[1] = tf2;
+    }
 
     ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
     const auto& it = cdata->res->find(pc);
@@ -334,8 +546,12 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
 CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
-                                               tesseract_common::VectorIsometry3d shape_poses)
-  : name_(std::move(name)), type_id_(type_id), shapes_(std::move(shapes)), shape_poses_(std::move(shape_poses))
+                                               tesseract_common::VectorIsometry3d shape_poses,
+                                               FCLMeshBVType mesh_bv_type)
+  : name_(std::move(name))
+  , type_id_(type_id)
+  , shapes_(std::move(shapes))
+  , shape_poses_(std::move(shape_poses))
 {
   assert(!shapes_.empty());                       // NOLINT
   assert(!shape_poses_.empty());                  // NOLINT
@@ -348,32 +564,178 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
   collision_geometries_.reserve(shapes_.size());
   collision_objects_.reserve(shapes_.size());
   collision_objects_raw_.reserve(shapes_.size());
+  compact_object_poses_.reserve(shapes_.size());
   for (std::size_t i = 0; i < shapes_.size(); ++i)
   {
-    CollisionGeometryPtr subshape = createShapePrimitive(shapes_[i]);
+    if (shapes_[i]->getType() == tesseract_geometry::GeometryType::POINT_CLOUD)
+    {
+      // Each point is a sphere object in the broadphase which is the spatial index of the cloud
+      const auto& cloud = std::static_pointer_cast<const tesseract_geometry::PointCloud>(shapes_[i]);
+      auto sphere = std::make_shared<fcl::Sphered>(cloud->getPointRadius());
+      collision_geometries_.push_back(sphere);
+      for (const auto& point : *cloud->getPoints())
+      {
+        const Eigen::Isometry3d point_pose = shape_poses_[i] * Eigen::Translation3d(point);
+        auto co = std::make_shared<FCLCollisionObjectWrapper>(sphere);
+        co->setShapeIndex(static_cast<int>(i));
+        co->setUserData(this);
+        co->setTransform(point_pose);
+        co->updateAABB();
+        collision_objects_.push_back(co);
+        collision_objects_raw_.push_back(co.get());
+        compact_object_poses_.emplace_back(point_pose);
+      }
+      continue;
+    }
+
+    CollisionGeometryPtr subshape = createShapePrimitive(shapes_[i], mesh_bv_type);
     if (subshape != nullptr)
     {
       collision_geometries_.push_back(subshape);
       auto co = std::make_shared<FCLCollisionObjectWrapper>(subshape);
+      co->setShapeIndex(static_cast<int>(i));
+      if (shapes_[i]->getType() == tesseract_geometry::GeometryType::OCTREE)
+      {
+        Eigen::Vector3d aabb_min, aabb_max;
+        const auto& octree = std::static_pointer_cast<const tesseract_geometry::Octree>(shapes_[i])->getOctree();
+        calcOctreeOccupiedAABB(aabb_min, aabb_max, *octree);
+        setOctreeLocalAABB(*subshape, aabb_min, aabb_max);
+      }
       co->setUserData(this);
       co->setTransform(shape_poses_[i]);
       co->updateAABB();
       collision_objects_.push_back(co);
       collision_objects_raw_.push_back(co.get());
+      compact_object_poses_.emplace_back(shape_poses_[i]);
     }
   }
 }
 
-int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co) const
+std::vector<COW::Ptr> createFCLCollisionObjects(const std::vector<std::string>& names,
+                                                const int& type_id,
+                                                const std::vector<CollisionShapesConst>& shapes,
+                                                const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                                bool enabled,
+                                                FCLMeshBVType mesh_bv_type)
+{
+  if (shapes.size() != names.size() || shape_poses.size() != names.size())
+    throw std::runtime_error("createFCLCollisionObjects, number of shapes does not match names!");
+
+  std::vector<COW::Ptr> cows(names.size());
+  const tesseract_common::Executor::Ptr executor = tesseract_common::getDefaultExecutor();
+  const std::size_t num_workers = std::min(executor->getConcurrency(), names.size());
+
+  std::atomic<std::size_t> next{ 0 };
+  std::vector<std::exception_ptr> errors(num_workers);
+  auto worker = [&](std::size_t worker_idx) {
+    try
+    {
+      for (std::size_t i = next++; i < names.size(); i = next++)
+        cows[i] = createFCLCollisionObject(names[i], type_id, shapes[i], shape_poses[i], enabled, mesh_bv_type);
+    }
+    catch (...)
+    {
+      errors[worker_idx] = std::current_exception();
+      next = names.size();
+    }
+  };
+
+  executor->parallelFor(num_workers, worker);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  return cows;
+}
+
+CollisionObjectRawPtr updateCollisionObjectOctree(CollisionObjectWrapper& cow,
+                                                  std::size_t shape_index,
+                                                  const OctreeDelta& delta)
 {
-  auto it = std::find_if(collision_objects_.begin(), collision_objects_.end(), [&co](const CollisionObjectPtr& c) {
-    return c.get() == co;
+  const CollisionShapesConst& shapes = cow.getCollisionGeometries();
+  const std::vector<CollisionGeometryPtr>& geometries = cow.getFCLCollisionGeometries();
+  if (shape_index >= shapes.size() || shape_index >= geometries.size() ||
+      shapes[shape_index]->getType() != tesseract_geometry::GeometryType::OCTREE ||
+      geometries[shape_index]->getNodeType() != fcl::GEOM_OCTREE)
+    return nullptr;
+
+  const CollisionGeometryPtr& geometry = geometries[shape_index];
+  const auto& octree = std::static_pointer_cast<const tesseract_geometry::Octree>(shapes[shape_index])->getOctree();
+
+  Eigen::Vector3d aabb_min = geometry->aabb_local.min_;
+  Eigen::Vector3d aabb_max = geometry->aabb_local.max_;
+  updateOctreeOccupiedAABB(aabb_min, aabb_max, *octree, delta);
+  setOctreeLocalAABB(*geometry, aabb_min, aabb_max);
+
+  const std::vector<CollisionObjectPtr>& objects = cow.getCollisionObjects();
+  auto it = std::find_if(objects.begin(), objects.end(), [&cow, shape_index](const CollisionObjectPtr& c) {
+    return cow.getShapeIndex(c.get()) == static_cast<int>(shape_index);
   });
+  if (it == objects.end())
+    return nullptr;
 
-  if (it != collision_objects_.end())
-    return static_cast<int>(std::distance(collision_objects_.begin(), it));
+  (*it)->updateAABB();
+
+  return it->get();
+}
+
+int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co) const
+{
+  // A point cloud has an object for each point, so the index is stored in the objects instead of searching for them
+  if (co == nullptr || co->getUserData() != this)
+    return -1;
+
+  assert(dynamic_cast<const FCLCollisionObjectWrapper*>(co) != nullptr);
+  return static_cast<const FCLCollisionObjectWrapper*>(co)->getShapeIndex();
+}
+
+namespace
+{
+/** @brief Estimate the bytes of an fcl collision geometry, including the bounding volume hierarchy of a mesh */
+std::size_t getCollisionGeometryBytes(const fcl::CollisionGeometryd& geometry)
+{
+  if (const auto* model = dynamic_cast<const fcl::BVHModel<fcl::OBBRSSd>*>(&geometry))
+    return static_cast<std::size_t>(model->memUsage(0));
+  if (const auto* model = dynamic_cast<const fcl::BVHModel<fcl::RSSd>*>(&geometry))
+    return static_cast<std::size_t>(model->memUsage(0));
+  if (const auto* model = dynamic_cast<const fcl::BVHModel<fcl::kIOSd>*>(&geometry))
+    return static_cast<std::size_t>(model->memUsage(0));
+  if (const auto* model = dynamic_cast<const fcl::BVHModel<fcl::AABBd>*>(&geometry))
+    return static_cast<std::size_t>(model->memUsage(0));
+  // The vertices of a convex hull are shared with the geometry, the faces are copied
+  if (const auto* convex = dynamic_cast<const fcl::Convexd*>(&geometry))
+    return sizeof(fcl::Convexd) + (convex->getFaces().size() * sizeof(int));
+
+  // The octree is counted by the geometry, the other shapes are primitives
+  return sizeof(fcl::CollisionGeometryd);
+}
+}  // namespace
+
+tesseract_common::MemoryUsage
+CollisionObjectWrapper::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(name_);
+  usage.unique_bytes = sizeof(CollisionObjectWrapper) + tesseract_common::getVectorBytes(shapes_) +
+                       tesseract_common::getVectorBytes(shape_poses_) +
+                       tesseract_common::getVectorBytes(collision_geometries_) +
+                       tesseract_common::getVectorBytes(compact_object_poses_) +
+                       tesseract_common::getVectorBytes(collision_objects_raw_) +
+                       (collision_objects_.size() * (sizeof(CollisionObjectPtr) + sizeof(FCLCollisionObjectWrapper)));
+
+  for (const auto& shape : shapes_)
+    usage.children.push_back(shape->getMemoryUsage(tracker));
+
+  tesseract_common::MemoryUsage& geometries_usage = usage.addChild("acceleration_structure");
+  for (const auto& geometry : collision_geometries_)
+  {
+    if (geometry != nullptr)
+      tracker.count(geometries_usage, geometry, getCollisionGeometryBytes(*geometry));
+  }
 
-  return -1;
+  return usage;
 }
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
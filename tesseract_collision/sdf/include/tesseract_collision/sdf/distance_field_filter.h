@@ -0,0 +1,163 @@
+/**
+ * @file distance_field_filter.h
+ * @brief Skips the contact tests of links which are far from the static collision objects
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTER_H
+#define TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/sdf/static_distance_field.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief Decides which active collision objects of a contact manager are far from the static collision objects
+ * represented by a StaticDistanceField
+ * @details Each active object is bounded by a sphere. An object is filtered when the distance bound of the field at the
+ * center of its sphere minus its radius is larger than the largest collision margin, in which case no contact can be
+ * found between it and the static objects of the field. For continuous tests the sphere also covers the motion
+ * between the two transforms.
+ *
+ * This is used by the contact managers wrapping a manager with the field, which track the transforms of the objects and
+ * call update before each contact test. A static object of the field stops being used by the filter once it is moved
+ * away from the transform the field was created with or its geometry changes.
+ */
+class DistanceFieldFilter
+{
+public:
+  /**
+   * @brief Constructor
+   * @param field The distance field of the static collision objects, nullptr disables the filter
+   */
+  explicit DistanceFieldFilter(StaticDistanceField::ConstPtr field = nullptr);
+
+  /** @brief Set the distance field of the static collision objects, nullptr disables the filter */
+  void setField(StaticDistanceField::ConstPtr field);
+
+  /** @brief Get the distance field of the static collision objects */
+  const StaticDistanceField::ConstPtr& getField() const;
+
+  /** @brief Indicate the collision objects, their enabled state or the active collision objects changed */
+  void setObjectsChanged();
+
+  /**
+   * @brief Stop using the field for a collision object, for example because its geometry changed
+   * @param name The name of the collision object
+   */
+  void invalidateObject(const std::string& name);
+
+  /**
+   * @brief Set the transform of a collision object
+   * @param name The name of the collision object
+   * @param pose The world transform
+   */
+  void setTransform(const std::string& name, const Eigen::Isometry3d& pose);
+
+  /**
+   * @brief Set the start and end transform of a collision object for a continuous contact test
+   * @param name The name of the collision object
+   * @param pose1 The world transform at the start
+   * @param pose2 The world transform at the end
+   */
+  void setTransform(const std::string& name, const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2);
+
+  /**
+   * @brief Decide which active collision objects are filtered before a contact test
+   * @param manager The wrapped contact manager
+   * @param fn The contact allowed function provided by the user
+   * @return False if no contact can be found, so the contact test can be skipped
+   */
+  bool update(const DiscreteContactManager& manager, const IsContactAllowedFn& fn);
+  bool update(const ContinuousContactManager& manager, const IsContactAllowedFn& fn);
+
+  /**
+   * @brief Check if the contact test of a pair of collision objects is skipped
+   * @details This is true if one object is an active object filtered by the last update and the other is a static
+   * object represented by the field.
+   */
+  bool isFiltered(const std::string& name1, const std::string& name2) const;
+
+  /** @brief Get the names of the active collision objects filtered by the last update */
+  std::vector<std::string> getFilteredObjects() const;
+
+private:
+  struct ObjectData
+  {
+    Eigen::Vector3d center{ Eigen::Vector3d::Zero() }; /**< @brief The bounding sphere center in the object frame */
+    double radius{ 0 };                                 /**< @brief The bounding sphere radius */
+    bool bounded{ false };                              /**< @brief False if the object has unbounded shapes */
+    bool enabled{ false };                              /**< @brief Indicates if the object is enabled */
+    bool in_field{ false };                             /**< @brief A static object represented by the field */
+    bool filtered{ false };                             /**< @brief An active object far from the field */
+  };
+
+  /** @brief The bounding sphere of an active object in world coordinates */
+  struct ActiveSphere
+  {
+    std::string name;
+    Eigen::Vector3d center{ Eigen::Vector3d::Zero() };
+    double radius{ 0 };
+    bool known{ false };
+  };
+
+  /** @brief The distance field of the static collision objects */
+  StaticDistanceField::ConstPtr field_;
+
+  /** @brief The data of each collision object, updated when the objects changed */
+  std::unordered_map<std::string, ObjectData> objects_;
+
+  /** @brief The enabled active collision objects */
+  std::vector<ActiveSphere> active_;
+
+  /** @brief Indicates if there are enabled static collision objects which are not represented by the field */
+  bool other_static_{ false };
+
+  /** @brief Indicates the collision objects changed since the last update */
+  bool changed_{ true };
+
+  /** @brief The static collision objects of the field which are no longer represented by it */
+  std::set<std::string> invalid_;
+
+  /** @brief The start transforms of the collision objects */
+  tesseract_common::TransformMap poses1_;
+
+  /** @brief The end transforms of the collision objects, the same as the start for discrete contact tests */
+  tesseract_common::TransformMap poses2_;
+
+  template <typename ManagerType>
+  bool updateHelper(const ManagerType& manager, const IsContactAllowedFn& fn);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+#endif  // TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTER_H
@@ -0,0 +1,194 @@
+/**
+ * @file distance_field_filtered_continuous_manager.h
+ * @brief A continuous contact manager which skips links far from the static distance field
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTERED_CONTINUOUS_MANAGER_H
+#define TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTERED_CONTINUOUS_MANAGER_H
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/sdf/distance_field_filter.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A continuous contact manager which wraps another manager and skips the active collision objects which are far
+ * from the static collision objects of a StaticDistanceField
+ * @details Before each contact test the bounding sphere of every active object is checked against the field, see
+ * DistanceFieldFilter. The pairs of a filtered object and a static object of the field are rejected by the contact
+ * allowed function of the wrapped manager before its narrowphase. When every active object is filtered, every static
+ * object is represented by the field and the bounding spheres of the active objects are apart, the wrapped manager is
+ * not called at all. The results are the same as the wrapped manager, only the work to find them is reduced.
+ *
+ * The bounding sphere of an active object covers its motion between the start and end transforms. Sweeps use the
+ * contactTestSweep of the base class so every segment is filtered. All calls must go through this manager so it can
+ * track the transforms of the collision objects. Active objects are not filtered until their transform is set through
+ * this manager.
+ */
+class DistanceFieldFilteredContinuousManager : public ContinuousContactManager
+{
+public:
+  using Ptr = std::shared_ptr<DistanceFieldFilteredContinuousManager>;
+  using ConstPtr = std::shared_ptr<const DistanceFieldFilteredContinuousManager>;
+  using UPtr = std::unique_ptr<DistanceFieldFilteredContinuousManager>;
+  using ConstUPtr = std::unique_ptr<const DistanceFieldFilteredContinuousManager>;
+
+  /**
+   * @brief Constructor
+   * @param manager The contact manager to wrap
+   * @param field The distance field of the static collision objects, nullptr disables the filter
+   */
+  DistanceFieldFilteredContinuousManager(ContinuousContactManager::UPtr manager, StaticDistanceField::ConstPtr field);
+  ~DistanceFieldFilteredContinuousManager() override = default;
+  DistanceFieldFilteredContinuousManager(const DistanceFieldFilteredContinuousManager&) = delete;
+  DistanceFieldFilteredContinuousManager& operator=(const DistanceFieldFilteredContinuousManager&) = delete;
+  DistanceFieldFilteredContinuousManager(DistanceFieldFilteredContinuousManager&&) = delete;
+  DistanceFieldFilteredContinuousManager& operator=(DistanceFieldFilteredContinuousManager&&) = delete;
+
+  std::string getName() const override final;
+
+  ContinuousContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  bool getCollisionObjectTransform(const std::string& name, Eigen::Isometry3d& pose) const override final;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::LinkTransforms& transforms) override final;
+
+  void setCollisionObjectsTransform(const std::string& name,
+                                    const Eigen::Isometry3d& pose1,
+                                    const Eigen::Isometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& pose1,
+                                    const tesseract_common::VectorIsometry3d& pose2) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                    const tesseract_common::TransformMap& pose2) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::LinkTransforms& pose1,
+                                    const tesseract_common::LinkTransforms& pose2) override final;
+
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void setStatisticsEnabled(bool enabled) override final;
+
+  bool getStatisticsEnabled() const override final;
+
+  ContactManagerStatistics getStatistics() const override final;
+
+  void clearStatistics() override final;
+
+  /**
+   * @brief Set the distance field of the static collision objects
+   * @param field The distance field, nullptr disables the filter
+   */
+  void setStaticDistanceField(StaticDistanceField::ConstPtr field);
+
+  /** @brief Get the distance field of the static collision objects */
+  const StaticDistanceField::ConstPtr& getStaticDistanceField() const;
+
+  /** @brief Get the names of the active collision objects filtered by the last contact test */
+  std::vector<std::string> getFilteredCollisionObjects() const;
+
+  /** @brief Get the number of contact tests which did not call the wrapped manager */
+  std::size_t getSkippedContactTests() const;
+
+  /**
+   * @brief Get the wrapped contact manager
+   * @note Changes made directly to the wrapped manager are not tracked
+   * @return The wrapped contact manager
+   */
+  const ContinuousContactManager& getManager() const;
+
+private:
+  /** @brief The wrapped contact manager */
+  ContinuousContactManager::UPtr manager_;
+
+  /** @brief Decides which active collision objects are far from the static collision objects */
+  DistanceFieldFilter filter_;
+
+  /** @brief The contact allowed function provided by the user */
+  IsContactAllowedFn fn_;
+
+  /** @brief The number of contact tests which did not call the wrapped manager */
+  std::size_t skipped_{ 0 };
+
+  /** @brief Set the contact allowed function of the wrapped manager, which also rejects the filtered pairs */
+  void updateIsContactAllowedFn();
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+#endif  // TESSERACT_COLLISION_SDF_DISTANCE_FIELD_FILTERED_CONTINUOUS_MANAGER_H
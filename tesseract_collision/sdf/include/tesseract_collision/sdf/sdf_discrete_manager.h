@@ -0,0 +1,207 @@
+/**
+ * @file sdf_discrete_manager.h
+ * @brief Tesseract signed distance field contact checker implementation.
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/sdf/sdf_utils.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A signed distance field implementation of the discrete contact manager
+ * @details Each collision object is represented by a signed distance field and samples of its surface in its own frame,
+ * so moving an object does not require rebuilding either. The distance between two objects is the minimum signed
+ * distance of the surface samples of each object within the field of the other, so each pair reports a single contact.
+ * Queries are constant time per sample, which makes this well suited for large static environments like meshes and
+ * octrees, but the accuracy of the distance is on the order of the resolution.
+ */
+class SDFDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<SDFDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const SDFDiscreteManager>;
+  using UPtr = std::unique_ptr<SDFDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const SDFDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the contact manager
+   * @param resolution The resolution of the signed distance fields
+   * @param padding The distance the signed distance fields extend past the shapes
+   * @param sample_resolution The maximum distance between neighboring surface samples
+   */
+  SDFDiscreteManager(std::string name = "SDFDiscreteManager",
+                     double resolution = 0.01,
+                     double padding = 0.05,
+                     double sample_resolution = 0.01);
+  ~SDFDiscreteManager() override = default;
+  SDFDiscreteManager(const SDFDiscreteManager&) = delete;
+  SDFDiscreteManager& operator=(const SDFDiscreteManager&) = delete;
+  SDFDiscreteManager(SDFDiscreteManager&&) = delete;
+  SDFDiscreteManager& operator=(SDFDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<tesseract_common::TransformMap>& transforms,
+                        const ContactRequest& request) override final;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<std::string>& names,
+                        const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                        const ContactRequest& request) override final;
+
+  /**
+   * @brief Add a signed distance field collision object to the manager
+   * @param cow The tesseract signed distance field collision object
+   */
+  void addCollisionObject(const COW::Ptr& cow);
+
+  /** @brief Get the resolution of the signed distance fields */
+  double getResolution() const;
+
+  /** @brief Get the distance the signed distance fields extend past the shapes */
+  double getPadding() const;
+
+  /** @brief Get the maximum distance between neighboring surface samples */
+  double getSampleResolution() const;
+
+  /**
+   * @brief Set the number of threads used to evaluate the states of a batch contact test
+   * @details The default of one evaluates the states on the calling thread. When more than one thread is requested the
+   * signed distance fields and surface samples of the enabled objects are created once, then each thread checks states
+   * on a clone sharing them. The results are the same as the single threaded results.
+   * @note The IsContactAllowedFn and ContactRequest::is_valid functions are called from multiple threads so they must
+   * be thread safe when this is enabled.
+   * @param threads The number of threads, zero is treated as one
+   */
+  void setBatchThreads(std::size_t threads);
+
+  /**
+   * @brief Get the number of threads used to evaluate the states of a batch contact test
+   * @return The number of threads
+   */
+  std::size_t getBatchThreads() const;
+
+private:
+  std::string name_;
+  double resolution_;        /**< @brief The resolution of the signed distance fields */
+  double padding_;           /**< @brief The padding of the signed distance fields */
+  double sample_resolution_; /**< @brief The maximum distance between neighboring surface samples */
+
+  Link2COW link2cow_;               /**< @brief A map of all (static and active) collision objects being managed */
+  std::vector<std::string> active_; /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+
+  /** @brief The collision objects indexed by handle, ordered the same as collision_objects_ */
+  std::vector<COW::Ptr> handle2cow_;
+
+  /** @brief The number of threads used to evaluate the states of a batch contact test */
+  std::size_t batch_threads_{ 1 };
+
+  /**
+   * @brief Evaluate the states of a batch contact test in parallel
+   * @param collisions The contact results data, already sized to one entry per state
+   * @param apply_state Function applying the transforms of a state to a manager
+   * @param request The contact request data
+   */
+  void parallelBatchContactTest(std::vector<ContactResultMap>& collisions,
+                                const std::function<void(SDFDiscreteManager&, std::size_t)>& apply_state,
+                                const ContactRequest& request);
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SDF_DISCRETE_MANAGER_H
@@ -0,0 +1,202 @@
+/**
+ * @file sdf_utils.h
+ * @brief Tesseract signed distance field utility functions
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SDF_UTILS_H
+#define TESSERACT_COLLISION_SDF_SDF_UTILS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <memory>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/sdf/signed_distance_field.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/** @brief A sphere on the surface of a collision object used to query the signed distance field of other objects */
+struct SurfaceSample
+{
+  /** @brief The center of the sphere in the frame of the collision object */
+  Eigen::Vector3d point{ Eigen::Vector3d::Zero() };
+
+  /** @brief The radius of the sphere, zero for points on the surface */
+  double radius{ 0 };
+
+  /** @brief The index of the shape the sample belongs to */
+  int shape_id{ 0 };
+};
+
+/**
+ * @brief Sample the surface of collision shapes
+ * @details Spheres are represented by their center and capsules by spheres along their axis. Other primitives and
+ * meshes are represented by points on their surface no further apart than the sample resolution, and octrees by a
+ * sphere for each occupied cell sized by the sub type of the octree.
+ * @param shapes The collision shapes
+ * @param shape_poses The transforms of the collision shapes
+ * @param sample_resolution The maximum distance between neighboring samples
+ * @return The surface samples in the frame of the shapes
+ */
+std::vector<SurfaceSample> sampleCollisionShapes(const CollisionShapesConst& shapes,
+                                                 const tesseract_common::VectorIsometry3d& shape_poses,
+                                                 double sample_resolution);
+
+/**
+ * @brief A collision object represented by a signed distance field and samples of its surface
+ * @details The signed distance field and the surface samples are in the frame of the collision object, so they do not
+ * change when it moves. Both are created the first time they are requested and are shared by clones.
+ */
+class CollisionObjectWrapper
+{
+public:
+  using Ptr = std::shared_ptr<CollisionObjectWrapper>;
+  using ConstPtr = std::shared_ptr<const CollisionObjectWrapper>;
+
+  /**
+   * @brief Constructor
+   * @param name The name of the collision object
+   * @param type_id The user defined type id
+   * @param shapes The collision shapes
+   * @param shape_poses The transforms of the collision shapes in the frame of the collision object
+   * @param resolution The resolution of the signed distance field
+   * @param padding The distance the signed distance field extends past the shapes
+   * @param sample_resolution The maximum distance between neighboring surface samples
+   */
+  CollisionObjectWrapper(std::string name,
+                         const int& type_id,
+                         CollisionShapesConst shapes,
+                         tesseract_common::VectorIsometry3d shape_poses,
+                         double resolution,
+                         double padding,
+                         double sample_resolution);
+
+  /** @brief Indicates if the collision object is enabled */
+  bool m_enabled{ true };
+
+  const std::string& getName() const;
+  const int& getTypeID() const;
+  const CollisionShapesConst& getCollisionGeometries() const;
+  const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const;
+
+  void setCollisionObjectsTransform(const Eigen::Isometry3d& pose);
+  const Eigen::Isometry3d& getCollisionObjectsTransform() const;
+
+  /** @brief Get the signed distance field of the collision object, created if needed */
+  const SignedDistanceField& getSignedDistanceField();
+
+  /** @brief Get the surface samples of the collision object, created if needed */
+  const std::vector<SurfaceSample>& getSurfaceSamples();
+
+  /** @brief Get the center of the bounding sphere in the world frame */
+  Eigen::Vector3d getBoundingSphereCenter() const;
+
+  /** @brief Get the radius of the bounding sphere */
+  double getBoundingSphereRadius() const;
+
+  /**
+   * @brief Get the index of the shape closest to a point
+   * @param point The point in the frame of the collision object
+   * @return The index of the shape whose bounding box is closest to the point
+   */
+  int getClosestShapeIndex(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Discard the signed distance field, surface samples and bounds after the shapes changed
+   * @details This is used after an octree shape was modified. Clones keep the data they already share.
+   */
+  void invalidate();
+
+  /**
+   * @brief Set the handle of the collision object
+   * @param handle The handle, which is its index in the contact manager
+   */
+  void setHandle(int handle);
+
+  /** @brief Get the handle of the collision object, or -1 if it is not managed */
+  int getHandle() const;
+
+  /**
+   * @brief Clone the collision object, sharing the signed distance field and surface samples
+   * @return The cloned collision object
+   */
+  std::shared_ptr<CollisionObjectWrapper> clone() const;
+
+protected:
+  std::string name_; /**< @brief The name of the collision object */
+  int type_id_;      /**< @brief A user defined type id */
+  CollisionShapesConst shapes_;
+  tesseract_common::VectorIsometry3d shape_poses_;
+  double resolution_;        /**< @brief The resolution of the signed distance field */
+  double padding_;           /**< @brief The padding of the signed distance field */
+  double sample_resolution_; /**< @brief The maximum distance between neighboring surface samples */
+  int handle_{ -1 };         /**< @brief The index of the collision object in the contact manager */
+
+  /** @brief The transform of the collision object in the world frame */
+  Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() };
+
+  /** @brief The bounding box of each shape in the frame of the collision object */
+  tesseract_common::VectorVector3d shape_aabbs_;
+
+  Eigen::Vector3d sphere_center_{ Eigen::Vector3d::Zero() }; /**< @brief The local bounding sphere center */
+  double sphere_radius_{ 0 };                                 /**< @brief The bounding sphere radius */
+
+  std::shared_ptr<const SignedDistanceField> sdf_;
+  std::shared_ptr<const std::vector<SurfaceSample>> samples_;
+
+  /** @brief Calculate the bounding box of each shape and the bounding sphere of the collision object */
+  void updateBounds();
+};
+
+using COW = CollisionObjectWrapper;
+using Link2COW = std::map<std::string, COW::Ptr>;
+
+/**
+ * @brief Create a signed distance field collision object
+ * @return The collision object, or nullptr if the shapes are empty or do not match the shape poses
+ */
+COW::Ptr createSDFCollisionObject(const std::string& name,
+                                  const int& type_id,
+                                  const CollisionShapesConst& shapes,
+                                  const tesseract_common::VectorIsometry3d& shape_poses,
+                                  double resolution,
+                                  double padding,
+                                  double sample_resolution,
+                                  bool enabled);
+
+/**
+ * @brief Calculate the signed distance between two collision objects and add it to the contact test data
+ * @details The surface samples of each object are queried against the signed distance field of the other, keeping the
+ * closest. Samples which can not be within the collision margin of the other object are skipped.
+ * @param cdata The contact test data
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @return True if the contact test is done
+ */
+bool distanceCheck(ContactTestData& cdata, COW& cow1, COW& cow2);
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SDF_UTILS_H
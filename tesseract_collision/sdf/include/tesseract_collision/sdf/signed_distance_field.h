@@ -0,0 +1,153 @@
+/**
+ * @file signed_distance_field.h
+ * @brief A voxelized signed distance field of collision shapes
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
+#define TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <memory>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/** @brief The squared distance used for voxels without a site in calcSquaredDistanceTransform */
+constexpr double DISTANCE_TRANSFORM_INF = 1e20;
+
+/**
+ * @brief A voxelized signed distance field of a set of collision shapes
+ * @details The shapes are rasterized into an occupancy grid, where a voxel is solid if its center is inside of a shape.
+ * Meshes are rasterized by marking the voxels touching their triangles and filling the voxels which can not be reached
+ * from the border of the grid, so open meshes are only represented by their shell. An exact euclidean distance
+ * transform then provides the distance from each voxel to the surface, which is negative inside of the shapes.
+ *
+ * Queries use trilinear interpolation, so the error of the distance is on the order of the resolution. Shapes thinner
+ * than the resolution may not be represented. Points outside of the grid add the distance to the grid.
+ */
+class SignedDistanceField
+{
+public:
+  using Ptr = std::shared_ptr<SignedDistanceField>;
+  using ConstPtr = std::shared_ptr<const SignedDistanceField>;
+
+  SignedDistanceField() = default;
+
+  /**
+   * @brief Create the signed distance field of collision shapes
+   * @param shapes The collision shapes
+   * @param shape_poses The transforms of the collision shapes in the frame of the signed distance field
+   * @param resolution The size of the voxels
+   * @param padding The distance the grid extends past the bounding box of the shapes
+   * @param max_voxels The maximum number of voxels, the resolution is increased to stay within it
+   */
+  SignedDistanceField(const CollisionShapesConst& shapes,
+                      const tesseract_common::VectorIsometry3d& shape_poses,
+                      double resolution,
+                      double padding,
+                      std::size_t max_voxels = 16 * 1024 * 1024);
+
+  /**
+   * @brief Get the signed distance at a point
+   * @param point The point in the frame of the signed distance field
+   * @return The signed distance, negative inside of the shapes
+   */
+  double getDistance(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Get the signed distance and its gradient at a point
+   * @param point The point in the frame of the signed distance field
+   * @param gradient The normalized gradient of the distance, pointing away from the shapes
+   * @return The signed distance, negative inside of the shapes
+   */
+  double getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient) const;
+
+  /** @brief Check if the signed distance field does not contain any solid voxels */
+  bool empty() const;
+
+  /** @brief Get the size of the voxels */
+  double getResolution() const;
+
+  /** @brief Get the center of the first voxel in the frame of the signed distance field */
+  const Eigen::Vector3d& getOrigin() const;
+
+  /** @brief Get the number of voxels along each axis */
+  const std::array<int, 3>& getDimensions() const;
+
+  /** @brief Get the memory in bytes used by the voxels */
+  std::size_t getMemoryUsage() const;
+
+  /**
+   * @brief Get the signed distance stored for a voxel
+   * @note The signed distance field must not be empty and the voxel must be within the dimensions
+   * @return The signed distance of the voxel, negative for solid voxels
+   */
+  double getVoxelDistance(int x, int y, int z) const;
+
+  /** @brief Get the center of a voxel in the frame of the signed distance field */
+  Eigen::Vector3d getVoxelCenter(int x, int y, int z) const;
+
+private:
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() }; /**< @brief The center of the first voxel */
+  double resolution_{ 0 };                            /**< @brief The size of the voxels */
+  std::array<int, 3> dims_{ 0, 0, 0 };                /**< @brief The number of voxels along each axis */
+
+  /** @brief The signed distance of each voxel, ordered by x then y then z */
+  std::vector<float> data_;
+
+  /** @brief Get the index of a voxel */
+  std::size_t index(int x, int y, int z) const;
+};
+
+/**
+ * @brief Calculate the bounding box of collision shapes
+ * @param aabb_min The minimum corner of the bounding box
+ * @param aabb_max The maximum corner of the bounding box
+ * @param shapes The collision shapes
+ * @param shape_poses The transforms of the collision shapes
+ * @return False if none of the shapes are supported, otherwise true
+ */
+bool calcCollisionShapesAABB(Eigen::Vector3d& aabb_min,
+                             Eigen::Vector3d& aabb_max,
+                             const CollisionShapesConst& shapes,
+                             const tesseract_common::VectorIsometry3d& shape_poses);
+
+/**
+ * @brief The exact squared euclidean distance transform of a voxel grid in voxel units
+ * @details This is the lower envelope of parabolas from Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled
+ * Functions", applied along each axis in turn. Throws std::runtime_error if the number of values does not match the
+ * dimensions.
+ * @param values The voxels ordered by x then y then z, with a value of zero at the sites and DISTANCE_TRANSFORM_INF
+ * elsewhere. They are replaced by the squared distance between the voxel and the closest site in voxels.
+ * @param dims The number of voxels along each axis
+ */
+void calcSquaredDistanceTransform(std::vector<double>& values, const std::array<int, 3>& dims);
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+#endif  // TESSERACT_COLLISION_SDF_SIGNED_DISTANCE_FIELD_H
@@ -0,0 +1,125 @@
+/**
+ * @file sphere_approximation.h
+ * @brief Approximate collision shapes by sets of spheres
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_H
+#define TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/** @brief A set of spheres approximating a collision shape in the frame of the shape */
+struct SphereApproximation
+{
+  tesseract_common::VectorVector3d centers; /**< @brief The centers of the spheres */
+  std::vector<double> radii;                /**< @brief The radii of the spheres */
+
+  /** @brief The number of spheres */
+  std::size_t size() const;
+
+  /** @brief Check if there are no spheres */
+  bool empty() const;
+};
+
+/**
+ * @brief Approximate a collision shape by a set of spheres covering it
+ * @details The shape is converted to a signed distance field and the spheres are placed greedily, largest first, at
+ * the uncovered solid voxel with the largest inscribed sphere. Each sphere is inflated by the error bound past its
+ * inscribed radius and covers the solid voxels within it, so the spheres extend at most the error bound past the
+ * surface of the shape. A sphere is returned as is, octrees and unsupported shapes return an empty approximation. When
+ * the resolution is at most half of the error bound the spheres cover the whole shape.
+ * @param shape The collision shape
+ * @param error_bound The maximum distance the spheres may extend past the surface of the shape
+ * @param resolution The resolution of the signed distance field, zero or less uses half of the error bound
+ * @return The spheres in the frame of the shape
+ */
+SphereApproximation approximateWithSpheres(const tesseract_geometry::Geometry& shape,
+                                           double error_bound,
+                                           double resolution = 0);
+
+/**
+ * @brief Get a fingerprint identifying the sphere approximation of a shape
+ * @details This is used to verify a cached approximation matches the shape and parameters
+ */
+std::size_t getSphereApproximationFingerprint(const tesseract_geometry::Geometry& shape,
+                                              double error_bound,
+                                              double resolution);
+
+/**
+ * @brief Save a sphere approximation to a file
+ * @param path The file path
+ * @param spheres The sphere approximation
+ * @param fingerprint The fingerprint of the shape and parameters
+ * @return True if the file was written
+ */
+bool saveSphereApproximation(const std::string& path, const SphereApproximation& spheres, std::size_t fingerprint);
+
+/**
+ * @brief Load a sphere approximation from a file
+ * @param spheres The loaded sphere approximation
+ * @param path The file path
+ * @param fingerprint The expected fingerprint of the shape and parameters
+ * @return False if the file does not exist, is invalid or its fingerprint does not match
+ */
+bool loadSphereApproximation(SphereApproximation& spheres, const std::string& path, std::size_t fingerprint);
+
+/**
+ * @brief Get the sphere approximation of a shape, cached next to its mesh file
+ * @details Meshes loaded from a file use the file path with ".spheres" appended as the cache. A valid cache is loaded,
+ * otherwise the approximation is calculated and written to the cache if the directory is writable.
+ * @param shape The collision shape
+ * @param error_bound The maximum distance the spheres may extend past the surface of the shape
+ * @param resolution The resolution of the signed distance field, zero or less uses half of the error bound
+ * @return The spheres in the frame of the shape
+ */
+SphereApproximation getCachedSphereApproximation(const tesseract_geometry::Geometry& shape,
+                                                 double error_bound,
+                                                 double resolution = 0);
+
+/**
+ * @brief Replace collision shapes by the spheres approximating them
+ * @details Shapes which are not approximated, like octrees, are kept as is
+ * @param approx_shapes The shapes of the approximation
+ * @param approx_shape_poses The transforms of the shapes of the approximation
+ * @param shapes The collision shapes
+ * @param shape_poses The transforms of the collision shapes
+ * @param error_bound The maximum distance the spheres may extend past the surface of the shapes
+ * @param use_cache Indicate if the approximation of meshes should be cached next to their file
+ */
+void approximateCollisionShapes(CollisionShapesConst& approx_shapes,
+                                tesseract_common::VectorIsometry3d& approx_shape_poses,
+                                const CollisionShapesConst& shapes,
+                                const tesseract_common::VectorIsometry3d& shape_poses,
+                                double error_bound,
+                                bool use_cache = true);
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_H
@@ -0,0 +1,226 @@
+/**
+ * @file sphere_approximation_discrete_manager.h
+ * @brief A discrete contact manager which checks the active collision objects using sphere approximations
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_DISCRETE_MANAGER_H
+#define TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_DISCRETE_MANAGER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A discrete contact manager which wraps another manager and replaces the geometry of the active collision
+ * objects by the spheres approximating it
+ * @details The spheres extend at most the error bound past the surface of the original geometry, so contacts are
+ * conservative. Only the objects explicitly listed as active are approximated, the static collision objects and all
+ * objects when the list of active objects is empty keep their original geometry. When the active collision objects
+ * change the affected objects are added back to the wrapped manager with the new geometry, keeping the order of the
+ * handles.
+ * Approximations of meshes loaded from a file are cached next to the file, see getCachedSphereApproximation.
+ *
+ * All calls must go through this manager so it can restore the state of the objects it adds back. The geometries
+ * returned are the original geometries, use getCollisionObjectApproximatedGeometries for the geometries used.
+ */
+class SphereApproximationDiscreteManager : public DiscreteContactManager
+{
+public:
+  using Ptr = std::shared_ptr<SphereApproximationDiscreteManager>;
+  using ConstPtr = std::shared_ptr<const SphereApproximationDiscreteManager>;
+  using UPtr = std::unique_ptr<SphereApproximationDiscreteManager>;
+  using ConstUPtr = std::unique_ptr<const SphereApproximationDiscreteManager>;
+
+  /**
+   * @brief Constructor
+   * @details Collision objects already in the wrapped manager keep their geometry and are assumed to be at the identity
+   * until their transform is set through this manager.
+   * @param manager The contact manager to wrap
+   * @param error_bound The maximum distance the spheres may extend past the surface of the geometry
+   * @param use_cache Indicate if the approximation of meshes should be cached next to their file
+   */
+  SphereApproximationDiscreteManager(DiscreteContactManager::UPtr manager, double error_bound, bool use_cache = true);
+  ~SphereApproximationDiscreteManager() override = default;
+  SphereApproximationDiscreteManager(const SphereApproximationDiscreteManager&) = delete;
+  SphereApproximationDiscreteManager& operator=(const SphereApproximationDiscreteManager&) = delete;
+  SphereApproximationDiscreteManager(SphereApproximationDiscreteManager&&) = delete;
+  SphereApproximationDiscreteManager& operator=(SphereApproximationDiscreteManager&&) = delete;
+
+  std::string getName() const override final;
+
+  DiscreteContactManager::UPtr clone() const override final;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override final;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override final;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override final;
+
+  bool hasCollisionObject(const std::string& name) const override final;
+
+  bool removeCollisionObject(const std::string& name) override final;
+
+  bool enableCollisionObject(const std::string& name) override final;
+
+  bool disableCollisionObject(const std::string& name) override final;
+
+  bool isCollisionObjectEnabled(const std::string& name) const override final;
+
+  int getCollisionObjectHandle(const std::string& name) const override final;
+
+  bool enableCollisionObject(int handle) override final;
+
+  bool disableCollisionObject(int handle) override final;
+
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  bool updateCollisionObjectOctree(const std::string& name,
+                                   std::size_t shape_index,
+                                   const OctreeDelta& delta) override final;
+
+  const std::vector<std::string>& getCollisionObjects() const override final;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override final;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override final;
+
+  void setPairCollisionMarginData(const std::string& name1,
+                                  const std::string& name2,
+                                  double collision_margin) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+  /**
+   * @brief Get the geometries used for the collision object
+   * @details These are the spheres approximating the geometry if the object is active, otherwise the original geometry
+   * @param name The collision object name
+   * @return The geometries used for the collision object
+   */
+  const CollisionShapesConst& getCollisionObjectApproximatedGeometries(const std::string& name) const;
+
+  /**
+   * @brief Get the transforms of the geometries used for the collision object
+   * @param name The collision object name
+   * @return The transforms of the geometries used for the collision object
+   */
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectApproximatedGeometriesTransforms(const std::string& name) const;
+
+  /** @brief Get the maximum distance the spheres may extend past the surface of the geometry */
+  double getErrorBound() const;
+
+  /**
+   * @brief Get the wrapped contact manager
+   * @note Changes made directly to the wrapped manager are not tracked
+   * @return The wrapped contact manager
+   */
+  const DiscreteContactManager& getManager() const;
+
+private:
+  /** @brief The state of a collision object */
+  struct CollisionObject
+  {
+    std::string name;
+    int mask_id{ 0 };
+    CollisionShapesConst shapes;
+    tesseract_common::VectorIsometry3d shape_poses;
+    bool enabled{ true };
+    Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+
+    /** @brief Indicates if the wrapped manager contains the approximated geometry */
+    bool approximated{ false };
+
+    /** @brief The approximated geometry, calculated the first time the object is active */
+    CollisionShapesConst approx_shapes;
+    tesseract_common::VectorIsometry3d approx_shape_poses;
+
+    /** @brief The index of the approximated geometry replacing each of the original geometries */
+    std::vector<std::size_t> approx_shape_indices;
+  };
+
+  /** @brief The wrapped contact manager */
+  DiscreteContactManager::UPtr manager_;
+
+  /** @brief The maximum distance the spheres may extend past the surface of the geometry */
+  double error_bound_;
+
+  /** @brief Indicate if the approximation of meshes should be cached next to their file */
+  bool use_cache_;
+
+  /** @brief The collision objects indexed by handle */
+  std::vector<CollisionObject> objects_;
+
+  /** @brief The names of the collision objects indexed by handle */
+  std::vector<std::string> names_;
+
+  /** @brief The handles of the collision objects in the wrapped manager indexed by handle */
+  std::vector<int> manager_handles_;
+
+  /** @brief The handles of the collision objects indexed by their handle in the wrapped manager */
+  std::vector<int> handles_;
+
+  /** @brief Get the handle of a collision object, -1 if it does not exist */
+  int findHandle(const std::string& name) const;
+
+  /** @brief Calculate the approximated geometry of a collision object if it has not been calculated */
+  void approximate(CollisionObject& object) const;
+
+  /** @brief Add a collision object to the wrapped manager with the geometry matching its state */
+  bool addToManager(const CollisionObject& object);
+
+  /** @brief Update the handles of the collision objects in the wrapped manager */
+  void updateManagerHandles();
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+#endif  // TESSERACT_COLLISION_SDF_SPHERE_APPROXIMATION_DISCRETE_MANAGER_H
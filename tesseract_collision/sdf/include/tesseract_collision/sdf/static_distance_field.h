@@ -0,0 +1,131 @@
+/**
+ * @file static_distance_field.h
+ * @brief A conservative distance field of the static collision objects of an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SDF_STATIC_DISTANCE_FIELD_H
+#define TESSERACT_COLLISION_SDF_STATIC_DISTANCE_FIELD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+/**
+ * @brief A voxelized unsigned distance field of static collision objects which only provides lower bounds of the
+ * distance to them
+ * @details Unlike SignedDistanceField, which approximates the distance, this field is conservative so it can be used to
+ * prove that a point is far from the objects without running the narrowphase. A voxel is occupied if any part of a
+ * shape may touch it. Primitives and convex meshes occupy the voxels touching their bounding box, meshes the voxels
+ * touching their triangles and octrees the voxels touching the bounding sphere of their occupied cells. The distance
+ * between the centers of the voxels and the closest occupied voxel is then computed with an exact euclidean distance
+ * transform, and queries subtract the diagonal of a voxel from it.
+ *
+ * Collision objects with shapes which can not be bounded, like planes, are not represented by the field, see hasObject.
+ * Meshes are represented by their surface like in the contact managers, so a point inside of a closed mesh is not
+ * reported as close to it.
+ */
+class StaticDistanceField
+{
+public:
+  using Ptr = std::shared_ptr<StaticDistanceField>;
+  using ConstPtr = std::shared_ptr<const StaticDistanceField>;
+
+  StaticDistanceField() = default;
+
+  /**
+   * @brief Create the distance field of static collision objects
+   * @details Throws std::runtime_error if the number of shapes or transforms does not match the names
+   * @param names The names of the collision objects
+   * @param shapes The shapes of each collision object
+   * @param shape_poses The transforms of the shapes of each collision object in the frame of the collision object
+   * @param poses The world transform of each collision object
+   * @param resolution The size of the voxels
+   * @param max_voxels The maximum number of voxels, the resolution is increased to stay within it
+   */
+  StaticDistanceField(const std::vector<std::string>& names,
+                      const std::vector<CollisionShapesConst>& shapes,
+                      const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                      const tesseract_common::VectorIsometry3d& poses,
+                      double resolution,
+                      std::size_t max_voxels = 16 * 1024 * 1024);
+
+  /**
+   * @brief Get a lower bound of the distance between a point and the collision objects of the field
+   * @details Points outside of the grid combine the distance to the grid with the bound at the closest point of the
+   * grid, which stays a lower bound because the occupied voxels are inside of the grid.
+   * @param point The point in world coordinates
+   * @return The lower bound of the distance, infinity if the field does not contain any occupied voxels
+   */
+  double getDistanceBound(const Eigen::Vector3d& point) const;
+
+  /** @brief Check if a collision object is represented by the field */
+  bool hasObject(const std::string& name) const;
+
+  /**
+   * @brief Get the world transform of a collision object when the field was created
+   * @param name The name of the collision object
+   * @return The transform, nullptr if the object is not represented by the field
+   */
+  const Eigen::Isometry3d* getObjectPose(const std::string& name) const;
+
+  /** @brief Get the names of the collision objects represented by the field */
+  std::vector<std::string> getObjectNames() const;
+
+  /** @brief Check if the field does not contain any occupied voxels */
+  bool empty() const;
+
+  /** @brief Get the size of the voxels */
+  double getResolution() const;
+
+  /** @brief Get the number of voxels along each axis */
+  const std::array<int, 3>& getDimensions() const;
+
+  /** @brief Get the memory in bytes used by the voxels */
+  std::size_t getMemoryUsage() const;
+
+private:
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() }; /**< @brief The center of the first voxel */
+  double resolution_{ 0 };                            /**< @brief The size of the voxels */
+  std::array<int, 3> dims_{ 0, 0, 0 };                /**< @brief The number of voxels along each axis */
+
+  /** @brief The distance between each voxel center and the closest occupied voxel center, ordered by x then y then z */
+  std::vector<float> data_;
+
+  /** @brief The world transforms of the collision objects represented by the field */
+  tesseract_common::TransformMap poses_;
+
+  /** @brief Get the index of a voxel */
+  std::size_t index(int x, int y, int z) const;
+};
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+#endif  // TESSERACT_COLLISION_SDF_STATIC_DISTANCE_FIELD_H
@@ -0,0 +1,237 @@
+/**
+ * @file distance_field_filter.cpp
+ * @brief Skips the contact tests of links which are far from the static collision objects
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <unordered_set>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/distance_field_filter.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+namespace
+{
+/**
+ * @brief Get a sphere containing the bounding sphere of a collision object at every transform between two transforms
+ * @details Without rotation the sphere moves along a line. Otherwise the object may rotate about its origin while the
+ * origin moves along a line, so the sphere is centered between the two origins.
+ */
+void calcSweptSphere(Eigen::Vector3d& center,
+                     double& radius,
+                     const Eigen::Vector3d& local_center,
+                     double local_radius,
+                     const Eigen::Isometry3d& pose1,
+                     const Eigen::Isometry3d& pose2)
+{
+  if (pose1.linear() == pose2.linear())
+  {
+    const Eigen::Vector3d center1 = pose1 * local_center;
+    const Eigen::Vector3d center2 = pose2 * local_center;
+    center = 0.5 * (center1 + center2);
+    radius = local_radius + (0.5 * (center2 - center1).norm());
+    return;
+  }
+
+  center = 0.5 * (pose1.translation() + pose2.translation());
+  radius = local_radius + local_center.norm() + (0.5 * (pose2.translation() - pose1.translation()).norm());
+}
+}  // namespace
+
+DistanceFieldFilter::DistanceFieldFilter(StaticDistanceField::ConstPtr field) : field_(std::move(field)) {}
+
+void DistanceFieldFilter::setField(StaticDistanceField::ConstPtr field)
+{
+  field_ = std::move(field);
+  invalid_.clear();
+  changed_ = true;
+
+  // Static objects already moved away from the transform of the new field are not represented by it
+  if (field_ == nullptr)
+    return;
+
+  for (const auto& pose : poses1_)
+  {
+    const Eigen::Isometry3d* field_pose = field_->getObjectPose(pose.first);
+    if (field_pose != nullptr && !field_pose->isApprox(pose.second, 1e-9))
+      invalid_.insert(pose.first);
+  }
+}
+
+const StaticDistanceField::ConstPtr& DistanceFieldFilter::getField() const { return field_; }
+
+void DistanceFieldFilter::setObjectsChanged() { changed_ = true; }
+
+void DistanceFieldFilter::invalidateObject(const std::string& name)
+{
+  if (field_ == nullptr || !field_->hasObject(name))
+    return;
+
+  invalid_.insert(name);
+  changed_ = true;
+}
+
+void DistanceFieldFilter::setTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setTransform(name, pose, pose);
+}
+
+void DistanceFieldFilter::setTransform(const std::string& name,
+                                       const Eigen::Isometry3d& pose1,
+                                       const Eigen::Isometry3d& pose2)
+{
+  poses1_[name] = pose1;
+  poses2_[name] = pose2;
+  if (field_ == nullptr || invalid_.find(name) != invalid_.end())
+    return;
+
+  const Eigen::Isometry3d* field_pose = field_->getObjectPose(name);
+  if (field_pose != nullptr && (!field_pose->isApprox(pose1, 1e-9) || !field_pose->isApprox(pose2, 1e-9)))
+  {
+    invalid_.insert(name);
+    changed_ = true;
+  }
+}
+
+bool DistanceFieldFilter::update(const DiscreteContactManager& manager, const IsContactAllowedFn& fn)
+{
+  return updateHelper(manager, fn);
+}
+
+bool DistanceFieldFilter::update(const ContinuousContactManager& manager, const IsContactAllowedFn& fn)
+{
+  return updateHelper(manager, fn);
+}
+
+bool DistanceFieldFilter::isFiltered(const std::string& name1, const std::string& name2) const
+{
+  auto it1 = objects_.find(name1);
+  auto it2 = objects_.find(name2);
+  if (it1 == objects_.end() || it2 == objects_.end())
+    return false;
+
+  return (it1->second.filtered && it2->second.in_field) || (it2->second.filtered && it1->second.in_field);
+}
+
+std::vector<std::string> DistanceFieldFilter::getFilteredObjects() const
+{
+  std::vector<std::string> names;
+  for (const auto& sphere : active_)
+  {
+    if (objects_.at(sphere.name).filtered)
+      names.push_back(sphere.name);
+  }
+
+  return names;
+}
+
+template <typename ManagerType>
+bool DistanceFieldFilter::updateHelper(const ManagerType& manager, const IsContactAllowedFn& fn)
+{
+  if (changed_)
+  {
+    objects_.clear();
+    active_.clear();
+    other_static_ = false;
+
+    const std::vector<std::string>& active_names = manager.getActiveCollisionObjects();
+    const std::unordered_set<std::string> active_set(active_names.begin(), active_names.end());
+    for (const auto& name : manager.getCollisionObjects())
+    {
+      ObjectData& data = objects_[name];
+      data.enabled = manager.isCollisionObjectEnabled(name);
+      if (active_set.find(name) == active_set.end())
+      {
+        data.in_field = (field_ != nullptr && field_->hasObject(name) && invalid_.find(name) == invalid_.end());
+        other_static_ = other_static_ || (data.enabled && !data.in_field);
+        continue;
+      }
+
+      const Eigen::AlignedBox3d aabb = calcCollisionObjectAABB(manager.getCollisionObjectGeometries(name),
+                                                               manager.getCollisionObjectGeometriesTransforms(name));
+      data.bounded = aabb.isEmpty() || (aabb.min().allFinite() && aabb.max().allFinite());
+      if (!aabb.isEmpty() && data.bounded)
+      {
+        data.center = aabb.center();
+        data.radius = 0.5 * aabb.sizes().norm();
+      }
+
+      if (data.enabled)
+        active_.push_back(ActiveSphere{ name, Eigen::Vector3d::Zero(), 0, false });
+    }
+
+    changed_ = false;
+  }
+
+  if (field_ == nullptr || active_.empty())
+  {
+    for (const auto& sphere : active_)
+      objects_[sphere.name].filtered = false;
+
+    return true;
+  }
+
+  const double margin = manager.getCollisionMarginData().getMaxCollisionMargin();
+  bool all_filtered = !other_static_;
+  for (auto& sphere : active_)
+  {
+    ObjectData& data = objects_[sphere.name];
+    auto it = poses1_.find(sphere.name);
+    sphere.known = (data.bounded && it != poses1_.end());
+    data.filtered = false;
+    if (!sphere.known)
+    {
+      all_filtered = false;
+      continue;
+    }
+
+    calcSweptSphere(sphere.center, sphere.radius, data.center, data.radius, it->second, poses2_.at(sphere.name));
+    data.filtered = (field_->getDistanceBound(sphere.center) - sphere.radius) > margin;
+    all_filtered = all_filtered && data.filtered;
+  }
+
+  if (!all_filtered)
+    return true;
+
+  // Every active object is far from the static objects, so only pairs of active objects may be in contact
+  for (std::size_t i = 0; i < active_.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < active_.size(); ++j)
+    {
+      if (fn != nullptr && fn(active_[i].name, active_[j].name))
+        continue;
+
+      const double distance = (active_[i].center - active_[j].center).norm() - active_[i].radius - active_[j].radius;
+      if (distance <= margin)
+        return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
@@ -0,0 +1,279 @@
+/**
+ * @file distance_field_filtered_discrete_manager.cpp
+ * @brief A discrete contact manager which skips links far from the static distance field
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/distance_field_filtered_discrete_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+DistanceFieldFilteredDiscreteManager::DistanceFieldFilteredDiscreteManager(DiscreteContactManager::UPtr manager,
+                                                                           StaticDistanceField::ConstPtr field)
+  : manager_(std::move(manager)), filter_(std::move(field))
+{
+  if (manager_ == nullptr)
+    throw std::runtime_error("DistanceFieldFilteredDiscreteManager, the provided contact manager is a nullptr!");
+
+  fn_ = manager_->getIsContactAllowedFn();
+  setActiveCollisionObjectsProfiles(manager_->getActiveCollisionObjectsProfiles());
+  updateIsContactAllowedFn();
+}
+
+std::string DistanceFieldFilteredDiscreteManager::getName() const { return manager_->getName(); }
+
+DiscreteContactManager::UPtr DistanceFieldFilteredDiscreteManager::clone() const
+{
+  TESSERACT_TRACE_ZONE("DistanceFieldFilteredDiscreteManager::clone");
+  static tesseract_common::MetricCounter& clones =
+      getContactManagerCloneMetric("DistanceFieldFilteredDiscreteManager");
+  clones.increment();
+
+  // The contact allowed function of the wrapped manager refers to the filter of this manager
+  DiscreteContactManager::UPtr wrapped = manager_->clone();
+  wrapped->setIsContactAllowedFn(fn_);
+  auto manager = std::make_unique<DistanceFieldFilteredDiscreteManager>(std::move(wrapped), filter_.getField());
+  manager->filter_ = filter_;
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
+  return manager;
+}
+
+bool DistanceFieldFilteredDiscreteManager::addCollisionObject(const std::string& name,
+                                                              const int& mask_id,
+                                                              const CollisionShapesConst& shapes,
+                                                              const tesseract_common::VectorIsometry3d& shape_poses,
+                                                              bool enabled)
+{
+  // An existing object with the same name is replaced, so its geometry is no longer the one of the field
+  filter_.invalidateObject(name);
+  filter_.setObjectsChanged();
+  return manager_->addCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+}
+
+const CollisionShapesConst&
+DistanceFieldFilteredDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometries(name);
+}
+
+const tesseract_common::VectorIsometry3d&
+DistanceFieldFilteredDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometriesTransforms(name);
+}
+
+bool DistanceFieldFilteredDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return manager_->hasCollisionObject(name);
+}
+
+bool DistanceFieldFilteredDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  if (!manager_->removeCollisionObject(name))
+    return false;
+
+  filter_.invalidateObject(name);
+  filter_.setObjectsChanged();
+  return true;
+}
+
+bool DistanceFieldFilteredDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  if (!manager_->enableCollisionObject(name))
+    return false;
+
+  filter_.setObjectsChanged();
+  return true;
+}
+
+bool DistanceFieldFilteredDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  if (!manager_->disableCollisionObject(name))
+    return false;
+
+  filter_.setObjectsChanged();
+  return true;
+}
+
+bool DistanceFieldFilteredDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  return manager_->isCollisionObjectEnabled(name);
+}
+
+int DistanceFieldFilteredDiscreteManager::getCollisionObjectHandle(const std::string& name) const
+{
+  return manager_->getCollisionObjectHandle(name);
+}
+
+void DistanceFieldFilteredDiscreteManager::setCollisionObjectsTransform(const std::string& name,
+                                                                        const Eigen::Isometry3d& pose)
+{
+  manager_->setCollisionObjectsTransform(name, pose);
+  filter_.setTransform(name, pose);
+}
+
+void DistanceFieldFilteredDiscreteManager::setCollisionObjectsTransform(
+    const std::vector<std::string>& names,
+    const tesseract_common::VectorIsometry3d& poses)
+{
+  manager_->setCollisionObjectsTransform(names, poses);
+  for (auto i = 0U; i < names.size(); ++i)
+    filter_.setTransform(names[i], poses[i]);
+}
+
+void DistanceFieldFilteredDiscreteManager::setCollisionObjectsTransform(
+    const tesseract_common::TransformMap& transforms)
+{
+  manager_->setCollisionObjectsTransform(transforms);
+  for (const auto& transform : transforms)
+    filter_.setTransform(transform.first, transform.second);
+}
+
+void DistanceFieldFilteredDiscreteManager::setCollisionObjectsTransform(
+    const tesseract_common::LinkTransforms& transforms)
+{
+  manager_->setCollisionObjectsTransform(transforms);
+  const std::vector<std::string>& names = transforms.getNames();
+  for (std::size_t i = 0; i < names.size(); ++i)
+    filter_.setTransform(names[i], transforms[i]);
+}
+
+bool DistanceFieldFilteredDiscreteManager::updateCollisionObjectOctree(const std::string& name,
+                                                                       std::size_t shape_index,
+                                                                       const OctreeDelta& delta)
+{
+  if (!manager_->updateCollisionObjectOctree(name, shape_index, delta))
+    return false;
+
+  filter_.invalidateObject(name);
+  filter_.setObjectsChanged();
+  return true;
+}
+
+const std::vector<std::string>& DistanceFieldFilteredDiscreteManager::getCollisionObjects() const
+{
+  return manager_->getCollisionObjects();
+}
+
+void DistanceFieldFilteredDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  manager_->setActiveCollisionObjects(names);
+  filter_.setObjectsChanged();
+}
+
+const std::vector<std::string>& DistanceFieldFilteredDiscreteManager::getActiveCollisionObjects() const
+{
+  return manager_->getActiveCollisionObjects();
+}
+
+void DistanceFieldFilteredDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                                  CollisionMarginOverrideType override_type)
+{
+  manager_->setCollisionMarginData(std::move(collision_margin_data), override_type);
+}
+
+void DistanceFieldFilteredDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  manager_->setDefaultCollisionMarginData(default_collision_margin);
+}
+
+void DistanceFieldFilteredDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                                      const std::string& name2,
+                                                                      double collision_margin)
+{
+  manager_->setPairCollisionMarginData(name1, name2, collision_margin);
+}
+
+const CollisionMarginData& DistanceFieldFilteredDiscreteManager::getCollisionMarginData() const
+{
+  return manager_->getCollisionMarginData();
+}
+
+void DistanceFieldFilteredDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  fn_ = std::move(fn);
+  updateIsContactAllowedFn();
+}
+
+IsContactAllowedFn DistanceFieldFilteredDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void DistanceFieldFilteredDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_TRACE_ZONE("DistanceFieldFilteredDiscreteManager::contactTest");
+  if (!filter_.update(*manager_, fn_))
+  {
+    ++skipped_;
+    return;
+  }
+
+  manager_->contactTest(collisions, request);
+}
+
+void DistanceFieldFilteredDiscreteManager::setStatisticsEnabled(bool enabled)
+{
+  manager_->setStatisticsEnabled(enabled);
+}
+
+bool DistanceFieldFilteredDiscreteManager::getStatisticsEnabled() const { return manager_->getStatisticsEnabled(); }
+
+ContactManagerStatistics DistanceFieldFilteredDiscreteManager::getStatistics() const
+{
+  return manager_->getStatistics();
+}
+
+void DistanceFieldFilteredDiscreteManager::clearStatistics() { manager_->clearStatistics(); }
+
+void DistanceFieldFilteredDiscreteManager::setStaticDistanceField(StaticDistanceField::ConstPtr field)
+{
+  filter_.setField(std::move(field));
+}
+
+const StaticDistanceField::ConstPtr& DistanceFieldFilteredDiscreteManager::getStaticDistanceField() const
+{
+  return filter_.getField();
+}
+
+std::vector<std::string> DistanceFieldFilteredDiscreteManager::getFilteredCollisionObjects() const
+{
+  return filter_.getFilteredObjects();
+}
+
+std::size_t DistanceFieldFilteredDiscreteManager::getSkippedContactTests() const { return skipped_; }
+
+const DiscreteContactManager& DistanceFieldFilteredDiscreteManager::getManager() const { return *manager_; }
+
+void DistanceFieldFilteredDiscreteManager::updateIsContactAllowedFn()
+{
+  manager_->setIsContactAllowedFn([filter = &filter_, fn = fn_](const std::string& name1, const std::string& name2) {
+    return filter->isFiltered(name1, name2) || (fn != nullptr && fn(name1, name2));
+  });
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
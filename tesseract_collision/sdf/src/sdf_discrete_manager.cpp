@@ -0,0 +1,399 @@
+/**
+ * @file sdf_discrete_manager.cpp
+ * @brief Tesseract signed distance field contact checker implementation.
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <exception>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/executor.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+SDFDiscreteManager::SDFDiscreteManager(std::string name, double resolution, double padding, double sample_resolution)
+  : name_(std::move(name)), resolution_(resolution), padding_(padding), sample_resolution_(sample_resolution)
+{
+  if (resolution_ <= 0 || sample_resolution_ <= 0)
+    throw std::runtime_error("SDFDiscreteManager, the resolution and sample resolution must be greater than zero!");
+
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+std::string SDFDiscreteManager::getName() const { return name_; }
+
+DiscreteContactManager::UPtr SDFDiscreteManager::clone() const
+{
+  TESSERACT_TRACE_ZONE("SDFDiscreteManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("SDFDiscreteManager");
+  clones.increment();
+  auto manager = std::make_unique<SDFDiscreteManager>(name_, resolution_, padding_, sample_resolution_);
+
+  // Add in handle order so the clone provides the same handles
+  for (const auto& cow : handle2cow_)
+    manager->addCollisionObject(cow->clone());
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+  manager->setBatchThreads(batch_threads_);
+
+  return manager;
+}
+
+bool SDFDiscreteManager::addCollisionObject(const std::string& name,
+                                            const int& mask_id,
+                                            const CollisionShapesConst& shapes,
+                                            const tesseract_common::VectorIsometry3d& shape_poses,
+                                            bool enabled)
+{
+  if (link2cow_.find(name) != link2cow_.end())
+    removeCollisionObject(name);
+
+  COW::Ptr new_cow =
+      createSDFCollisionObject(name, mask_id, shapes, shape_poses, resolution_, padding_, sample_resolution_, enabled);
+  if (new_cow != nullptr)
+  {
+    addCollisionObject(new_cow);
+    return true;
+  }
+
+  return false;
+}
+
+const CollisionShapesConst& SDFDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (cow != link2cow_.end()) ? cow->second->getCollisionGeometries() : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+SDFDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (cow != link2cow_.end()) ? cow->second->getCollisionGeometriesTransforms() :
+                                    EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool SDFDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2cow_.find(name) != link2cow_.end());
+}
+
+bool SDFDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  // Objects after the removed one shift down so their handle remains their index
+  auto handle = static_cast<std::size_t>(it->second->getHandle());
+  handle2cow_.erase(handle2cow_.begin() + static_cast<long>(handle));
+  for (std::size_t i = handle; i < handle2cow_.size(); ++i)
+    handle2cow_[i]->setHandle(static_cast<int>(i));
+
+  collision_objects_.erase(collision_objects_.begin() + static_cast<long>(handle));
+  link2cow_.erase(it);
+  return true;
+}
+
+bool SDFDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  return enableCollisionObject(getCollisionObjectHandle(name));
+}
+
+bool SDFDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  return disableCollisionObject(getCollisionObjectHandle(name));
+}
+
+bool SDFDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+    return it->second->m_enabled;
+
+  return false;
+}
+
+int SDFDiscreteManager::getCollisionObjectHandle(const std::string& name) const
+{
+  auto it = link2cow_.find(name);
+  return (it != link2cow_.end()) ? it->second->getHandle() : -1;
+}
+
+bool SDFDiscreteManager::enableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = true;
+  return true;
+}
+
+bool SDFDiscreteManager::disableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return false;
+
+  handle2cow_[static_cast<std::size_t>(handle)]->m_enabled = false;
+  return true;
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(getCollisionObjectHandle(name), pose);
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(handle2cow_.size()))
+    return;
+
+  // The signed distance field is in the frame of the object so only the transform changes
+  handle2cow_[static_cast<std::size_t>(handle)]->setCollisionObjectsTransform(pose);
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                      const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void SDFDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+bool SDFDiscreteManager::updateCollisionObjectOctree(const std::string& name,
+                                                     std::size_t shape_index,
+                                                     const OctreeDelta& /*delta*/)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  const CollisionShapesConst& shapes = it->second->getCollisionGeometries();
+  if (shape_index >= shapes.size() || shapes[shape_index]->getType() != tesseract_geometry::GeometryType::OCTREE)
+    return false;
+
+  // The signed distance field depends on every occupied cell, so it is rebuilt the next time it is needed
+  it->second->invalidate();
+  return true;
+}
+
+const std::vector<std::string>& SDFDiscreteManager::getCollisionObjects() const { return collision_objects_; }
+
+void SDFDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names) { active_ = names; }
+
+const std::vector<std::string>& SDFDiscreteManager::getActiveCollisionObjects() const { return active_; }
+
+void SDFDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+}
+
+void SDFDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+}
+
+void SDFDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                    const std::string& name2,
+                                                    double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+}
+
+const CollisionMarginData& SDFDiscreteManager::getCollisionMarginData() const { return collision_margin_data_; }
+void SDFDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn SDFDiscreteManager::getIsContactAllowedFn() const { return fn_; }
+
+void SDFDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_TRACE_ZONE("SDFDiscreteManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("SDFDiscreteManager");
+  const tesseract_common::MetricTimer timer(latency);
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+
+  // Each pair with at least one active object is checked once
+  for (std::size_t i = 0; i < handle2cow_.size() && !cdata.done; ++i)
+  {
+    COW& cow1 = *handle2cow_[i];
+    if (!cow1.m_enabled)
+      continue;
+
+    const bool active1 = isLinkActive(active_, cow1.getName());
+    for (std::size_t j = i + 1; j < handle2cow_.size() && !cdata.done; ++j)
+    {
+      COW& cow2 = *handle2cow_[j];
+      if (!cow2.m_enabled || (!active1 && !isLinkActive(active_, cow2.getName())))
+        continue;
+
+      if (isContactAllowed(cow1.getName(), cow2.getName(), fn_, false))
+        continue;
+
+      distanceCheck(cdata, cow1, cow2);
+    }
+  }
+}
+
+void SDFDiscreteManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                          const std::vector<tesseract_common::TransformMap>& transforms,
+                                          const ContactRequest& request)
+{
+  if (batch_threads_ <= 1 || transforms.size() <= 1)
+  {
+    DiscreteContactManager::batchContactTest(collisions, transforms, request);
+    return;
+  }
+
+  collisions.resize(transforms.size());
+  parallelBatchContactTest(
+      collisions,
+      [&transforms](SDFDiscreteManager& manager, std::size_t i) {
+        manager.setCollisionObjectsTransform(transforms[i]);
+      },
+      request);
+}
+
+void SDFDiscreteManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                          const std::vector<std::string>& names,
+                                          const std::vector<tesseract_common::VectorIsometry3d>& poses,
+                                          const ContactRequest& request)
+{
+  if (batch_threads_ <= 1 || poses.size() <= 1)
+  {
+    DiscreteContactManager::batchContactTest(collisions, names, poses, request);
+    return;
+  }
+
+  for (const auto& state : poses)
+  {
+    if (state.size() != names.size())
+      throw std::runtime_error("SDFDiscreteManager, batchContactTest number of poses does not match names!");
+  }
+
+  // Resolve the collision objects once for the whole batch
+  std::vector<int> handles;
+  handles.reserve(names.size());
+  for (const auto& name : names)
+    handles.push_back(getCollisionObjectHandle(name));
+
+  collisions.resize(poses.size());
+  parallelBatchContactTest(
+      collisions,
+      [&handles, &poses](SDFDiscreteManager& manager, std::size_t i) {
+        for (std::size_t j = 0; j < handles.size(); ++j)
+          manager.setCollisionObjectsTransform(handles[j], poses[i][j]);
+      },
+      request);
+}
+
+void SDFDiscreteManager::parallelBatchContactTest(
+    std::vector<ContactResultMap>& collisions,
+    const std::function<void(SDFDiscreteManager&, std::size_t)>& apply_state,
+    const ContactRequest& request)
+{
+  // Create the fields and samples up front so the clones share them instead of each creating their own
+  for (const auto& cow : handle2cow_)
+  {
+    if (!cow->m_enabled)
+      continue;
+
+    cow->getSignedDistanceField();
+    cow->getSurfaceSamples();
+  }
+
+  const std::size_t num_workers = std::min(batch_threads_, collisions.size());
+  std::vector<DiscreteContactManager::UPtr> workers;
+  workers.reserve(num_workers);
+  for (std::size_t i = 0; i < num_workers; ++i)
+    workers.push_back(clone());
+
+  std::atomic<std::size_t> next_state{ 0 };
+  std::atomic<bool> abort{ false };
+  std::vector<std::exception_ptr> errors(num_workers);
+  auto worker = [&](std::size_t worker_idx) {
+    auto& manager = static_cast<SDFDiscreteManager&>(*workers[worker_idx]);
+    try
+    {
+      for (std::size_t i = next_state++; i < collisions.size() && !abort; i = next_state++)
+      {
+        apply_state(manager, i);
+        collisions[i].clear();
+        manager.contactTest(collisions[i], request);
+      }
+    }
+    catch (...)
+    {
+      errors[worker_idx] = std::current_exception();
+      abort = true;
+    }
+  };
+
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, worker);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  // The transforms of the last state remain applied like the serial implementation
+  apply_state(*this, collisions.size() - 1);
+}
+
+void SDFDiscreteManager::addCollisionObject(const COW::Ptr& cow)
+{
+  cow->setHandle(static_cast<int>(handle2cow_.size()));
+  link2cow_[cow->getName()] = cow;
+  handle2cow_.push_back(cow);
+  collision_objects_.push_back(cow->getName());
+}
+
+double SDFDiscreteManager::getResolution() const { return resolution_; }
+
+double SDFDiscreteManager::getPadding() const { return padding_; }
+
+double SDFDiscreteManager::getSampleResolution() const { return sample_resolution_; }
+
+void SDFDiscreteManager::setBatchThreads(std::size_t threads) { batch_threads_ = std::max<std::size_t>(threads, 1); }
+
+std::size_t SDFDiscreteManager::getBatchThreads() const { return batch_threads_; }
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
@@ -0,0 +1,61 @@
+/**
+ * @file sdf_factories.cpp
+ * @brief Factories for loading signed distance field contact managers as plugins
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_collision/sdf/sdf_factories.h>
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+DiscreteContactManager::UPtr SDFDiscreteManagerFactory::create(const std::string& name, const YAML::Node& config) const
+{
+  double resolution{ 0.01 };
+  double padding{ 0.05 };
+  double sample_resolution{ 0.01 };
+  std::size_t batch_threads{ 1 };
+
+  if (YAML::Node n = config["resolution"])
+    resolution = n.as<double>();
+
+  if (YAML::Node n = config["padding"])
+    padding = n.as<double>();
+
+  if (YAML::Node n = config["sample_resolution"])
+    sample_resolution = n.as<double>();
+
+  if (YAML::Node n = config["batch_threads"])
+    batch_threads = n.as<std::size_t>();
+
+  auto manager = std::make_unique<SDFDiscreteManager>(name, resolution, padding, sample_resolution);
+  manager->setBatchThreads(batch_threads);
+  return manager;
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(SDFFactoriesAnchor)  // LCOV_EXCL_LINE
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_DISCRETE_MANAGER_PLUGIN(tesseract_collision::tesseract_collision_sdf::SDFDiscreteManagerFactory,
+                                      SDFDiscreteManagerFactory);
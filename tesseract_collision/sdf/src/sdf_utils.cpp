@@ -0,0 +1,554 @@
+/**
+ * @file sdf_utils.cpp
+ * @brief Tesseract signed distance field utility functions
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sdf_utils.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+namespace
+{
+/** @brief Get the number of segments needed so neighboring samples are no further apart than the resolution */
+int numSegments(double length, double sample_resolution, int min_segments = 1)
+{
+  return std::max(min_segments, static_cast<int>(std::ceil(length / sample_resolution)));
+}
+
+void sampleTriangle(std::vector<SurfaceSample>& samples,
+                    const Eigen::Vector3d& a,
+                    const Eigen::Vector3d& b,
+                    const Eigen::Vector3d& c,
+                    double sample_resolution,
+                    int shape_id)
+{
+  const double max_edge = std::max({ (b - a).norm(), (c - a).norm(), (c - b).norm() });
+  const int steps = numSegments(max_edge, sample_resolution);
+  for (int i = 0; i <= steps; ++i)
+  {
+    for (int j = 0; j <= steps - i; ++j)
+    {
+      const Eigen::Vector3d p =
+          a + ((b - a) * (static_cast<double>(i) / steps)) + ((c - a) * (static_cast<double>(j) / steps));
+      samples.push_back({ p, 0, shape_id });
+    }
+  }
+}
+
+/** @brief Sample a circle of radius rho at height z in the frame of the shape */
+void sampleCircle(std::vector<SurfaceSample>& samples,
+                  const Eigen::Isometry3d& pose,
+                  double rho,
+                  double z,
+                  double sample_resolution,
+                  int shape_id)
+{
+  if (rho <= 0)
+  {
+    samples.push_back({ pose * Eigen::Vector3d(0, 0, z), 0, shape_id });
+    return;
+  }
+
+  const int n = numSegments(2 * M_PI * rho, sample_resolution, 8);
+  for (int i = 0; i < n; ++i)
+  {
+    const double theta = (2 * M_PI * i) / n;
+    samples.push_back({ pose * Eigen::Vector3d(rho * std::cos(theta), rho * std::sin(theta), z), 0, shape_id });
+  }
+}
+
+/** @brief Sample a disc of radius r at height z in the frame of the shape */
+void sampleDisc(std::vector<SurfaceSample>& samples,
+                const Eigen::Isometry3d& pose,
+                double r,
+                double z,
+                double sample_resolution,
+                int shape_id)
+{
+  const int n = numSegments(r, sample_resolution);
+  for (int i = 0; i <= n; ++i)
+    sampleCircle(samples, pose, (r * i) / n, z, sample_resolution, shape_id);
+}
+
+void sampleBox(std::vector<SurfaceSample>& samples,
+               const tesseract_geometry::Box& box,
+               const Eigen::Isometry3d& pose,
+               double sample_resolution,
+               int shape_id)
+{
+  const Eigen::Vector3d half_extent = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ());
+  for (Eigen::Index axis = 0; axis < 3; ++axis)
+  {
+    const Eigen::Index a1 = (axis + 1) % 3;
+    const Eigen::Index a2 = (axis + 2) % 3;
+    const int n1 = numSegments(2 * half_extent(a1), sample_resolution);
+    const int n2 = numSegments(2 * half_extent(a2), sample_resolution);
+    for (double side : { -1.0, 1.0 })
+    {
+      for (int i = 0; i <= n1; ++i)
+      {
+        for (int j = 0; j <= n2; ++j)
+        {
+          Eigen::Vector3d p;
+          p(axis) = side * half_extent(axis);
+          p(a1) = half_extent(a1) * ((2.0 * i / n1) - 1);
+          p(a2) = half_extent(a2) * ((2.0 * j / n2) - 1);
+          samples.push_back({ pose * p, 0, shape_id });
+        }
+      }
+    }
+  }
+}
+
+void sampleMesh(std::vector<SurfaceSample>& samples,
+                const tesseract_geometry::PolygonMesh& mesh,
+                const Eigen::Isometry3d& pose,
+                double sample_resolution,
+                int shape_id)
+{
+  const tesseract_common::VectorVector3d& vertices = *mesh.getVertices();
+  const Eigen::VectorXi& faces = *mesh.getFaces();
+  for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+  {
+    const int num_vertices = faces[f];
+    const Eigen::Vector3d a = pose * vertices[static_cast<std::size_t>(faces[f + 1])];
+    for (int k = 2; k < num_vertices; ++k)
+    {
+      const Eigen::Vector3d b = pose * vertices[static_cast<std::size_t>(faces[f + k])];
+      const Eigen::Vector3d c = pose * vertices[static_cast<std::size_t>(faces[f + k + 1])];
+      sampleTriangle(samples, a, b, c, sample_resolution, shape_id);
+    }
+  }
+}
+
+void sampleOctree(std::vector<SurfaceSample>& samples,
+                  const tesseract_geometry::Octree& shape,
+                  const Eigen::Isometry3d& pose,
+                  int shape_id)
+{
+  const octomap::OcTree& octree = *shape.getOctree();
+  const double occupancy_threshold = octree.getOccupancyThres();
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold)
+      continue;
+
+    const double half_size = it.getSize() / 2.0;
+    double radius{ 0 };
+    switch (shape.getSubType())
+    {
+      case tesseract_geometry::Octree::SubType::BOX:
+      case tesseract_geometry::Octree::SubType::MERGED_BOX:
+        radius = std::sqrt(3.0) * half_size;
+        break;
+      case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+        radius = half_size;
+        break;
+      case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+        radius = std::sqrt(2.0) * half_size;
+        break;
+    }
+
+    samples.push_back({ pose * Eigen::Vector3d(it.getX(), it.getY(), it.getZ()), radius, shape_id });
+  }
+}
+
+/** @brief The closest surface sample of one collision object to the signed distance field of another */
+struct ClosestSample
+{
+  bool found{ false };
+  double distance{ std::numeric_limits<double>::max() };
+  Eigen::Vector3d point;    /**< @brief The center of the sample in the frame of the signed distance field */
+  Eigen::Vector3d gradient; /**< @brief The gradient of the distance in the frame of the signed distance field */
+  double radius{ 0 };
+  int shape_id{ 0 };
+};
+
+/**
+ * @brief Query the surface samples of a collision object against the signed distance field of another
+ * @param sampled The collision object providing the surface samples
+ * @param field The collision object providing the signed distance field
+ * @param margin The collision margin, samples further than this from the bounds of the field are skipped
+ */
+ClosestSample querySamples(COW& sampled, COW& field, double margin)
+{
+  ClosestSample closest;
+  const SignedDistanceField& sdf = field.getSignedDistanceField();
+  if (sdf.empty())
+    return closest;
+
+  const Eigen::Isometry3d field_inv = field.getCollisionObjectsTransform().inverse();
+  const Eigen::Isometry3d sampled_to_field = field_inv * sampled.getCollisionObjectsTransform();
+  const Eigen::Vector3d center = field_inv * field.getBoundingSphereCenter();
+  const double max_distance = field.getBoundingSphereRadius() + margin;
+
+  Eigen::Vector3d gradient;
+  for (const SurfaceSample& sample : sampled.getSurfaceSamples())
+  {
+    const Eigen::Vector3d q = sampled_to_field * sample.point;
+    if ((q - center).norm() - sample.radius > max_distance)
+      continue;
+
+    const double d = sdf.getDistance(q, gradient) - sample.radius;
+    if (d < closest.distance)
+    {
+      closest.found = true;
+      closest.distance = d;
+      closest.point = q;
+      closest.gradient = gradient;
+      closest.radius = sample.radius;
+      closest.shape_id = sample.shape_id;
+    }
+  }
+
+  return closest;
+}
+}  // namespace
+
+std::vector<SurfaceSample> sampleCollisionShapes(const CollisionShapesConst& shapes,
+                                                 const tesseract_common::VectorIsometry3d& shape_poses,
+                                                 double sample_resolution)
+{
+  std::vector<SurfaceSample> samples;
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    const Eigen::Isometry3d& pose = shape_poses[i];
+    const auto shape_id = static_cast<int>(i);
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::SPHERE:
+      {
+        samples.push_back(
+            { pose.translation(), static_cast<const tesseract_geometry::Sphere&>(shape).getRadius(), shape_id });
+        break;
+      }
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+        const double length = capsule.getLength();
+        const int n = numSegments(length, sample_resolution);
+        for (int k = 0; k <= n; ++k)
+        {
+          const Eigen::Vector3d p(0, 0, length * ((static_cast<double>(k) / n) - 0.5));
+          samples.push_back({ pose * p, capsule.getRadius(), shape_id });
+        }
+        break;
+      }
+      case tesseract_geometry::GeometryType::BOX:
+      {
+        sampleBox(samples, static_cast<const tesseract_geometry::Box&>(shape), pose, sample_resolution, shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CYLINDER:
+      {
+        const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+        const double r = cylinder.getRadius();
+        const double length = cylinder.getLength();
+        const int n = numSegments(length, sample_resolution);
+        for (int k = 1; k < n; ++k)
+          sampleCircle(samples, pose, r, length * ((static_cast<double>(k) / n) - 0.5), sample_resolution, shape_id);
+
+        sampleDisc(samples, pose, r, -0.5 * length, sample_resolution, shape_id);
+        sampleDisc(samples, pose, r, 0.5 * length, sample_resolution, shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        // The apex is at the top of the cone along z
+        const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+        const double r = cone.getRadius();
+        const double length = cone.getLength();
+        const int n = numSegments(std::sqrt((r * r) + (length * length)), sample_resolution);
+        for (int k = 1; k <= n; ++k)
+        {
+          const double t = static_cast<double>(k) / n;
+          sampleCircle(samples, pose, r * (1 - t), length * (t - 0.5), sample_resolution, shape_id);
+        }
+
+        sampleDisc(samples, pose, r, -0.5 * length, sample_resolution, shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        sampleMesh(samples,
+                   static_cast<const tesseract_geometry::PolygonMesh&>(shape),
+                   pose,
+                   sample_resolution,
+                   shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        sampleOctree(samples, static_cast<const tesseract_geometry::Octree&>(shape), pose, shape_id);
+        break;
+      }
+      case tesseract_geometry::GeometryType::POINT_CLOUD:
+      {
+        const auto& cloud = static_cast<const tesseract_geometry::PointCloud&>(shape);
+        for (const auto& point : *cloud.getPoints())
+          samples.push_back({ pose * point, cloud.getPointRadius(), shape_id });
+        break;
+      }
+      default:
+      {
+        CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported by the signed distance field",
+                                static_cast<int>(shape.getType()));
+        break;
+      }
+    }
+  }
+
+  return samples;
+}
+
+CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
+                                               const int& type_id,
+                                               CollisionShapesConst shapes,
+                                               tesseract_common::VectorIsometry3d shape_poses,
+                                               double resolution,
+                                               double padding,
+                                               double sample_resolution)
+  : name_(std::move(name))
+  , type_id_(type_id)
+  , shapes_(std::move(shapes))
+  , shape_poses_(std::move(shape_poses))
+  , resolution_(resolution)
+  , padding_(padding)
+  , sample_resolution_(sample_resolution)
+{
+  assert(!shapes_.empty());                       // NOLINT
+  assert(!shape_poses_.empty());                  // NOLINT
+  assert(!name_.empty());                         // NOLINT
+  assert(shapes_.size() == shape_poses_.size());  // NOLINT
+
+  updateBounds();
+}
+
+const std::string& CollisionObjectWrapper::getName() const { return name_; }
+const int& CollisionObjectWrapper::getTypeID() const { return type_id_; }
+const CollisionShapesConst& CollisionObjectWrapper::getCollisionGeometries() const { return shapes_; }
+const tesseract_common::VectorIsometry3d& CollisionObjectWrapper::getCollisionGeometriesTransforms() const
+{
+  return shape_poses_;
+}
+
+void CollisionObjectWrapper::setCollisionObjectsTransform(const Eigen::Isometry3d& pose) { world_pose_ = pose; }
+const Eigen::Isometry3d& CollisionObjectWrapper::getCollisionObjectsTransform() const { return world_pose_; }
+
+const SignedDistanceField& CollisionObjectWrapper::getSignedDistanceField()
+{
+  if (sdf_ == nullptr)
+    sdf_ = std::make_shared<const SignedDistanceField>(shapes_, shape_poses_, resolution_, padding_);
+
+  return *sdf_;
+}
+
+const std::vector<SurfaceSample>& CollisionObjectWrapper::getSurfaceSamples()
+{
+  if (samples_ == nullptr)
+    samples_ = std::make_shared<const std::vector<SurfaceSample>>(
+        sampleCollisionShapes(shapes_, shape_poses_, sample_resolution_));
+
+  return *samples_;
+}
+
+Eigen::Vector3d CollisionObjectWrapper::getBoundingSphereCenter() const { return world_pose_ * sphere_center_; }
+double CollisionObjectWrapper::getBoundingSphereRadius() const { return sphere_radius_; }
+
+int CollisionObjectWrapper::getClosestShapeIndex(const Eigen::Vector3d& point) const
+{
+  int index{ 0 };
+  double min_distance{ std::numeric_limits<double>::max() };
+  for (std::size_t i = 0; i < shapes_.size(); ++i)
+  {
+    const Eigen::Vector3d& aabb_min = shape_aabbs_[2 * i];
+    const Eigen::Vector3d& aabb_max = shape_aabbs_[(2 * i) + 1];
+    const double d = (point - point.cwiseMax(aabb_min).cwiseMin(aabb_max)).squaredNorm();
+    if (d < min_distance)
+    {
+      min_distance = d;
+      index = static_cast<int>(i);
+    }
+  }
+
+  return index;
+}
+
+void CollisionObjectWrapper::invalidate()
+{
+  sdf_ = nullptr;
+  samples_ = nullptr;
+  updateBounds();
+}
+
+void CollisionObjectWrapper::setHandle(int handle) { handle_ = handle; }
+int CollisionObjectWrapper::getHandle() const { return handle_; }
+
+std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone() const
+{
+  auto clone_cow = std::make_shared<CollisionObjectWrapper>(*this);
+  clone_cow->handle_ = -1;
+  return clone_cow;
+}
+
+void CollisionObjectWrapper::updateBounds()
+{
+  shape_aabbs_.resize(2 * shapes_.size());
+
+  Eigen::Vector3d aabb_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d aabb_max = Eigen::Vector3d::Constant(-std::numeric_limits<double>::max());
+  bool found{ false };
+  for (std::size_t i = 0; i < shapes_.size(); ++i)
+  {
+    if (!calcCollisionShapesAABB(shape_aabbs_[2 * i], shape_aabbs_[(2 * i) + 1], { shapes_[i] }, { shape_poses_[i] }))
+      continue;
+
+    aabb_min = aabb_min.cwiseMin(shape_aabbs_[2 * i]);
+    aabb_max = aabb_max.cwiseMax(shape_aabbs_[(2 * i) + 1]);
+    found = true;
+  }
+
+  if (!found)
+  {
+    sphere_center_.setZero();
+    sphere_radius_ = 0;
+    return;
+  }
+
+  sphere_center_ = 0.5 * (aabb_min + aabb_max);
+  sphere_radius_ = 0.5 * (aabb_max - aabb_min).norm();
+}
+
+COW::Ptr createSDFCollisionObject(const std::string& name,
+                                  const int& type_id,
+                                  const CollisionShapesConst& shapes,
+                                  const tesseract_common::VectorIsometry3d& shape_poses,
+                                  double resolution,
+                                  double padding,
+                                  double sample_resolution,
+                                  bool enabled)
+{
+  // dont add object that does not have geometry
+  if (shapes.empty() || shape_poses.empty() || (shapes.size() != shape_poses.size()))
+  {
+    CONSOLE_BRIDGE_logDebug("ignoring link %s", name.c_str());
+    return nullptr;
+  }
+
+  auto new_cow = std::make_shared<COW>(name, type_id, shapes, shape_poses, resolution, padding, sample_resolution);
+
+  new_cow->m_enabled = enabled;
+  CONSOLE_BRIDGE_logDebug("Created collision object for link %s", new_cow->getName().c_str());
+  return new_cow;
+}
+
+bool distanceCheck(ContactTestData& cdata, COW& cow1, COW& cow2)
+{
+  if (cdata.done)
+    return true;
+
+  const double margin = cdata.collision_margin_data.getPairCollisionMargin(cow1.getName(), cow2.getName());
+  const double threshold = cdata.req.calculate_distance ? margin : 0;
+
+  // The bounding spheres are checked first since they are cheap compared to querying the samples
+  const double sphere_distance = (cow1.getBoundingSphereCenter() - cow2.getBoundingSphereCenter()).norm() -
+                                 cow1.getBoundingSphereRadius() - cow2.getBoundingSphereRadius();
+  if (sphere_distance >= threshold)
+    return false;
+
+  // Each object is checked against the other so a small object inside of a large one is found
+  const ClosestSample closest12 = querySamples(cow1, cow2, threshold);
+  const ClosestSample closest21 = querySamples(cow2, cow1, threshold);
+  const bool use12 = closest12.distance <= closest21.distance;
+  const ClosestSample& closest = use12 ? closest12 : closest21;
+  if (!closest.found || closest.distance >= threshold)
+    return false;
+
+  const COW& field = use12 ? cow2 : cow1;
+  const Eigen::Isometry3d& field_tf = field.getCollisionObjectsTransform();
+
+  // The nearest point on the field is found by following the gradient back to the surface
+  const Eigen::Vector3d field_point = closest.point - (closest.gradient * (closest.distance + closest.radius));
+  const Eigen::Vector3d gradient = field_tf.linear() * closest.gradient;
+  const Eigen::Vector3d point = field_tf * closest.point;
+  std::array<Eigen::Vector3d, 2> nearest_points{ point - (gradient * closest.radius), field_tf * field_point };
+  std::array<int, 2> shape_ids{ closest.shape_id, field.getClosestShapeIndex(field_point) };
+
+  // The normal points from the sampled object to the field, so flip the results when the field is the first object
+  Eigen::Vector3d normal = -gradient;
+  if (!use12)
+  {
+    std::swap(nearest_points[0], nearest_points[1]);
+    std::swap(shape_ids[0], shape_ids[1]);
+    normal = gradient;
+  }
+
+  ContactResult contact;
+  contact.link_names[0] = cow1.getName();
+  contact.link_names[1] = cow2.getName();
+  contact.link_handles[0] = cow1.getHandle();
+  contact.link_handles[1] = cow2.getHandle();
+  contact.shape_id[0] = shape_ids[0];
+  contact.shape_id[1] = shape_ids[1];
+  contact.type_id[0] = cow1.getTypeID();
+  contact.type_id[1] = cow2.getTypeID();
+  contact.distance = closest.distance;
+
+  if (cdata.req.detail != ContactResultDetail::BINARY)
+    contact.normal = normal;
+
+  if (cdata.req.detail == ContactResultDetail::FULL)
+  {
+    const Eigen::Isometry3d& tf1 = cow1.getCollisionObjectsTransform();
+    const Eigen::Isometry3d& tf2 = cow2.getCollisionObjectsTransform();
+    contact.nearest_points[0] = nearest_points[0];
+    contact.nearest_points[1] = nearest_points[1];
+    contact.nearest_points_local[0] = tf1.inverse() * contact.nearest_points[0];
+    contact.nearest_points_local[1] = tf2.inverse() * contact.nearest_points[1];
+    contact.transform[0] = tf1;
+    contact.transform[1] = tf2;
+  }
+
+  ObjectPairKey pc = getObjectPairKey(cow1.getName(), cow2.getName());
+  const auto& it = cdata.res->find(pc);
+  bool found = (it != cdata.res->end());
+
+  processResult(cdata, contact, pc, found);
+
+  return cdata.done;
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
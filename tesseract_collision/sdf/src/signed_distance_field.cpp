@@ -0,0 +1,752 @@
+/**
+ * @file signed_distance_field.cpp
+ * @brief A voxelized signed distance field of collision shapes
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/signed_distance_field.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+namespace
+{
+/** @brief The grid the shapes are rasterized into */
+struct VoxelGrid
+{
+  Eigen::Vector3d origin;
+  double resolution{ 0 };
+  std::array<int, 3> dims{ 0, 0, 0 };
+
+  /** @brief The occupancy of the voxels, ordered by x then y then z */
+  std::vector<std::uint8_t> solid;
+
+  std::size_t index(int x, int y, int z) const
+  {
+    return static_cast<std::size_t>(x) +
+           (static_cast<std::size_t>(dims[0]) *
+            (static_cast<std::size_t>(y) + (static_cast<std::size_t>(dims[1]) * static_cast<std::size_t>(z))));
+  }
+
+  Eigen::Vector3d center(int x, int y, int z) const
+  {
+    return origin + (resolution * Eigen::Vector3d(x, y, z));
+  }
+
+  /** @brief Get the range of voxels whose centers are within the box, clamped to the grid */
+  void range(const Eigen::Vector3d& aabb_min,
+             const Eigen::Vector3d& aabb_max,
+             std::array<int, 3>& lower,
+             std::array<int, 3>& upper) const
+  {
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      const auto k = static_cast<Eigen::Index>(i);
+      lower[i] = std::max(0, static_cast<int>(std::ceil((aabb_min(k) - origin(k)) / resolution)));
+      upper[i] = std::min(dims[i] - 1, static_cast<int>(std::floor((aabb_max(k) - origin(k)) / resolution)));
+    }
+  }
+
+  /** @brief Get the voxel closest to a point, clamped to the grid */
+  std::array<int, 3> nearest(const Eigen::Vector3d& point) const
+  {
+    std::array<int, 3> voxel{};
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      const auto k = static_cast<Eigen::Index>(i);
+      voxel[i] = std::clamp(static_cast<int>(std::lround((point(k) - origin(k)) / resolution)), 0, dims[i] - 1);
+    }
+    return voxel;
+  }
+};
+
+/** @brief Transform a box and get the bounding box of the result */
+void transformAABB(Eigen::Vector3d& aabb_min,
+                   Eigen::Vector3d& aabb_max,
+                   const Eigen::Vector3d& local_min,
+                   const Eigen::Vector3d& local_max,
+                   const Eigen::Isometry3d& pose)
+{
+  const Eigen::Vector3d center = pose * (0.5 * (local_min + local_max));
+  const Eigen::Vector3d extent = pose.linear().cwiseAbs() * (0.5 * (local_max - local_min));
+  aabb_min = center - extent;
+  aabb_max = center + extent;
+}
+
+/** @brief Get the bounding box of a primitive shape in its own frame */
+bool calcPrimitiveLocalAABB(Eigen::Vector3d& aabb_min,
+                            Eigen::Vector3d& aabb_max,
+                            const tesseract_geometry::Geometry& shape)
+{
+  Eigen::Vector3d extent;
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      extent = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ());
+      break;
+    }
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      extent.setConstant(static_cast<const tesseract_geometry::Sphere&>(shape).getRadius());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      extent = Eigen::Vector3d(cylinder.getRadius(), cylinder.getRadius(), 0.5 * cylinder.getLength());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      extent = Eigen::Vector3d(cone.getRadius(), cone.getRadius(), 0.5 * cone.getLength());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      extent = Eigen::Vector3d(
+          capsule.getRadius(), capsule.getRadius(), (0.5 * capsule.getLength()) + capsule.getRadius());
+      break;
+    }
+    default:
+      return false;
+  }
+
+  aabb_min = -extent;
+  aabb_max = extent;
+  return true;
+}
+
+/** @brief Check if a point in the frame of a primitive shape is inside of it */
+bool isInsidePrimitive(const tesseract_geometry::Geometry& shape, const Eigen::Vector3d& p)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      return std::abs(p.x()) <= 0.5 * box.getX() && std::abs(p.y()) <= 0.5 * box.getY() &&
+             std::abs(p.z()) <= 0.5 * box.getZ();
+    }
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      const double r = static_cast<const tesseract_geometry::Sphere&>(shape).getRadius();
+      return p.squaredNorm() <= r * r;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      const double r = cylinder.getRadius();
+      return std::abs(p.z()) <= 0.5 * cylinder.getLength() && p.head<2>().squaredNorm() <= r * r;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      // The apex is at the top of the cone along z
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      const double half_length = 0.5 * cone.getLength();
+      if (std::abs(p.z()) > half_length)
+        return false;
+
+      const double r = cone.getRadius() * (half_length - p.z()) / cone.getLength();
+      return p.head<2>().squaredNorm() <= r * r;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      const double r = capsule.getRadius();
+      const double z = std::clamp(p.z(), -0.5 * capsule.getLength(), 0.5 * capsule.getLength());
+      return (p - Eigen::Vector3d(0, 0, z)).squaredNorm() <= r * r;
+    }
+    // LCOV_EXCL_START
+    default:
+      return false;
+      // LCOV_EXCL_STOP
+  }
+}
+
+void rasterizePrimitive(VoxelGrid& grid, const tesseract_geometry::Geometry& shape, const Eigen::Isometry3d& pose)
+{
+  Eigen::Vector3d local_min, local_max, aabb_min, aabb_max;
+  calcPrimitiveLocalAABB(local_min, local_max, shape);
+  transformAABB(aabb_min, aabb_max, local_min, local_max, pose);
+
+  std::array<int, 3> lower{}, upper{};
+  grid.range(aabb_min, aabb_max, lower, upper);
+
+  const Eigen::Isometry3d pose_inv = pose.inverse();
+  for (int z = lower[2]; z <= upper[2]; ++z)
+    for (int y = lower[1]; y <= upper[1]; ++y)
+      for (int x = lower[0]; x <= upper[0]; ++x)
+        if (isInsidePrimitive(shape, pose_inv * grid.center(x, y, z)))
+          grid.solid[grid.index(x, y, z)] = 1;
+
+  // Make sure shapes smaller than a voxel are represented
+  const std::array<int, 3> voxel = grid.nearest(pose.translation());
+  grid.solid[grid.index(voxel[0], voxel[1], voxel[2])] = 1;
+}
+
+void rasterizeMesh(VoxelGrid& grid, const tesseract_geometry::PolygonMesh& mesh, const Eigen::Isometry3d& pose)
+{
+  const tesseract_common::VectorVector3d& local_vertices = *mesh.getVertices();
+  const Eigen::VectorXi& faces = *mesh.getFaces();
+  if (local_vertices.empty())
+    return;
+
+  tesseract_common::VectorVector3d vertices;
+  vertices.reserve(local_vertices.size());
+  Eigen::Vector3d aabb_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d aabb_max = Eigen::Vector3d::Constant(-std::numeric_limits<double>::max());
+  for (const auto& v : local_vertices)
+  {
+    vertices.emplace_back(pose * v);
+    aabb_min = aabb_min.cwiseMin(vertices.back());
+    aabb_max = aabb_max.cwiseMax(vertices.back());
+  }
+
+  // Work in a sub grid around the mesh with a layer of voxels outside of it so the fill can reach around the mesh
+  std::array<int, 3> lower{}, upper{};
+  grid.range(aabb_min.array() - (2 * grid.resolution), aabb_max.array() + (2 * grid.resolution), lower, upper);
+  const std::array<int, 3> size{ upper[0] - lower[0] + 1, upper[1] - lower[1] + 1, upper[2] - lower[2] + 1 };
+  auto sub_index = [&size, &lower](int x, int y, int z) {
+    return static_cast<std::size_t>(x - lower[0]) +
+           (static_cast<std::size_t>(size[0]) *
+            (static_cast<std::size_t>(y - lower[1]) +
+             (static_cast<std::size_t>(size[1]) * static_cast<std::size_t>(z - lower[2]))));
+  };
+
+  // 0 is unknown, 1 is the surface and 2 is outside of the mesh
+  std::vector<std::uint8_t> state(static_cast<std::size_t>(size[0]) * static_cast<std::size_t>(size[1]) *
+                                      static_cast<std::size_t>(size[2]),
+                                  0);
+
+  // Mark the voxels touching the triangles by sampling them at half of the resolution
+  auto mark = [&grid, &state, &sub_index, &lower, &upper](const Eigen::Vector3d& point) {
+    const std::array<int, 3> voxel = grid.nearest(point);
+    if (voxel[0] >= lower[0] && voxel[0] <= upper[0] && voxel[1] >= lower[1] && voxel[1] <= upper[1] &&
+        voxel[2] >= lower[2] && voxel[2] <= upper[2])
+      state[sub_index(voxel[0], voxel[1], voxel[2])] = 1;
+  };
+
+  for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+  {
+    const int num_vertices = faces[f];
+    const Eigen::Vector3d& a = vertices[static_cast<std::size_t>(faces[f + 1])];
+    for (int k = 2; k < num_vertices; ++k)
+    {
+      const Eigen::Vector3d& b = vertices[static_cast<std::size_t>(faces[f + k])];
+      const Eigen::Vector3d& c = vertices[static_cast<std::size_t>(faces[f + k + 1])];
+      const double max_edge = std::max({ (b - a).norm(), (c - a).norm(), (c - b).norm() });
+      const int steps = std::max(1, static_cast<int>(std::ceil(max_edge / (0.5 * grid.resolution))));
+      for (int i = 0; i <= steps; ++i)
+        for (int j = 0; j <= steps - i; ++j)
+          mark(a + ((b - a) * (static_cast<double>(i) / steps)) + ((c - a) * (static_cast<double>(j) / steps)));
+    }
+  }
+
+  // Flood fill the outside of the mesh from the border of the sub grid
+  std::vector<std::array<int, 3>> stack;
+  auto push = [&state, &stack, &sub_index](int x, int y, int z) {
+    std::uint8_t& s = state[sub_index(x, y, z)];
+    if (s == 0)
+    {
+      s = 2;
+      stack.push_back({ x, y, z });
+    }
+  };
+
+  for (int z = lower[2]; z <= upper[2]; ++z)
+  {
+    for (int y = lower[1]; y <= upper[1]; ++y)
+    {
+      for (int x = lower[0]; x <= upper[0]; ++x)
+      {
+        if (x == lower[0] || x == upper[0] || y == lower[1] || y == upper[1] || z == lower[2] || z == upper[2])
+          push(x, y, z);
+      }
+    }
+  }
+
+  while (!stack.empty())
+  {
+    const std::array<int, 3> v = stack.back();
+    stack.pop_back();
+    if (v[0] > lower[0])
+      push(v[0] - 1, v[1], v[2]);
+    if (v[0] < upper[0])
+      push(v[0] + 1, v[1], v[2]);
+    if (v[1] > lower[1])
+      push(v[0], v[1] - 1, v[2]);
+    if (v[1] < upper[1])
+      push(v[0], v[1] + 1, v[2]);
+    if (v[2] > lower[2])
+      push(v[0], v[1], v[2] - 1);
+    if (v[2] < upper[2])
+      push(v[0], v[1], v[2] + 1);
+  }
+
+  // Everything which was not reached is either the surface or inside of the mesh
+  for (int z = lower[2]; z <= upper[2]; ++z)
+    for (int y = lower[1]; y <= upper[1]; ++y)
+      for (int x = lower[0]; x <= upper[0]; ++x)
+        if (state[sub_index(x, y, z)] != 2)
+          grid.solid[grid.index(x, y, z)] = 1;
+}
+
+void rasterizeOctree(VoxelGrid& grid, const tesseract_geometry::Octree& shape, const Eigen::Isometry3d& pose)
+{
+  const octomap::OcTree& octree = *shape.getOctree();
+  const double occupancy_threshold = octree.getOccupancyThres();
+  const Eigen::Isometry3d pose_inv = pose.inverse();
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold)
+      continue;
+
+    const double half_size = it.getSize() / 2.0;
+    const Eigen::Vector3d cell_center(it.getX(), it.getY(), it.getZ());
+    Eigen::Vector3d aabb_min, aabb_max;
+    transformAABB(aabb_min, aabb_max, cell_center.array() - half_size, cell_center.array() + half_size, pose);
+
+    std::array<int, 3> lower{}, upper{};
+    grid.range(aabb_min, aabb_max, lower, upper);
+    for (int z = lower[2]; z <= upper[2]; ++z)
+      for (int y = lower[1]; y <= upper[1]; ++y)
+        for (int x = lower[0]; x <= upper[0]; ++x)
+          if (((pose_inv * grid.center(x, y, z)) - cell_center).cwiseAbs().maxCoeff() <= half_size)
+            grid.solid[grid.index(x, y, z)] = 1;
+
+    // Make sure cells smaller than a voxel are represented
+    const std::array<int, 3> voxel = grid.nearest(pose * cell_center);
+    grid.solid[grid.index(voxel[0], voxel[1], voxel[2])] = 1;
+  }
+}
+
+/**
+ * @brief The one dimensional squared euclidean distance transform
+ * @details This is the lower envelope of parabolas from Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled
+ * Functions"
+ */
+void distanceTransform1D(const std::vector<double>& f,
+                         std::vector<double>& d,
+                         std::vector<int>& v,
+                         std::vector<double>& z,
+                         int n)
+{
+  int k = 0;
+  v[0] = 0;
+  z[0] = -DISTANCE_TRANSFORM_INF;
+  z[1] = DISTANCE_TRANSFORM_INF;
+  for (int q = 1; q < n; ++q)
+  {
+    const auto uq = static_cast<std::size_t>(q);
+    auto intersect = [&f, &v, q, uq](int k) {
+      const int p = v[static_cast<std::size_t>(k)];
+      const auto up = static_cast<std::size_t>(p);
+      return ((f[uq] + static_cast<double>(q * q)) - (f[up] + static_cast<double>(p * p))) /
+             static_cast<double>(2 * (q - p));
+    };
+
+    // The first boundary is at negative infinity so the new parabola never removes all of the others
+    double s = intersect(k);
+    while (s <= z[static_cast<std::size_t>(k)])
+      s = intersect(--k);
+
+    ++k;
+    v[static_cast<std::size_t>(k)] = q;
+    z[static_cast<std::size_t>(k)] = s;
+    z[static_cast<std::size_t>(k) + 1] = DISTANCE_TRANSFORM_INF;
+  }
+
+  k = 0;
+  for (int q = 0; q < n; ++q)
+  {
+    while (z[static_cast<std::size_t>(k) + 1] < q)
+      ++k;
+
+    const int p = v[static_cast<std::size_t>(k)];
+    d[static_cast<std::size_t>(q)] = static_cast<double>((q - p) * (q - p)) + f[static_cast<std::size_t>(p)];
+  }
+}
+
+}  // namespace
+
+void calcSquaredDistanceTransform(std::vector<double>& values, const std::array<int, 3>& dims)
+{
+  const std::size_t num_voxels =
+      static_cast<std::size_t>(dims[0]) * static_cast<std::size_t>(dims[1]) * static_cast<std::size_t>(dims[2]);
+  if (values.size() != num_voxels)
+    throw std::runtime_error("calcSquaredDistanceTransform, the number of values does not match the dimensions!");
+
+  auto index = [&dims](const std::array<int, 3>& voxel) {
+    return static_cast<std::size_t>(voxel[0]) +
+           (static_cast<std::size_t>(dims[0]) *
+            (static_cast<std::size_t>(voxel[1]) +
+             (static_cast<std::size_t>(dims[1]) * static_cast<std::size_t>(voxel[2]))));
+  };
+
+  const int max_dim = std::max({ dims[0], dims[1], dims[2] });
+  std::vector<double> f(static_cast<std::size_t>(max_dim));
+  std::vector<double> d(static_cast<std::size_t>(max_dim));
+  std::vector<int> v(static_cast<std::size_t>(max_dim));
+  std::vector<double> z(static_cast<std::size_t>(max_dim) + 1);
+
+  // Transform along each axis in turn, where other is the two axes which select the line
+  for (std::size_t axis = 0; axis < 3; ++axis)
+  {
+    const std::size_t a1 = (axis + 1) % 3;
+    const std::size_t a2 = (axis + 2) % 3;
+    const int n = dims[axis];
+    for (int j = 0; j < dims[a2]; ++j)
+    {
+      for (int i = 0; i < dims[a1]; ++i)
+      {
+        std::array<int, 3> voxel{};
+        voxel[a1] = i;
+        voxel[a2] = j;
+        for (int q = 0; q < n; ++q)
+        {
+          voxel[axis] = q;
+          f[static_cast<std::size_t>(q)] = values[index(voxel)];
+        }
+
+        distanceTransform1D(f, d, v, z, n);
+
+        for (int q = 0; q < n; ++q)
+        {
+          voxel[axis] = q;
+          values[index(voxel)] = d[static_cast<std::size_t>(q)];
+        }
+      }
+    }
+  }
+}
+
+bool calcCollisionShapesAABB(Eigen::Vector3d& aabb_min,
+                             Eigen::Vector3d& aabb_max,
+                             const CollisionShapesConst& shapes,
+                             const tesseract_common::VectorIsometry3d& shape_poses)
+{
+  aabb_min.setConstant(std::numeric_limits<double>::max());
+  aabb_max.setConstant(-std::numeric_limits<double>::max());
+
+  bool found{ false };
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    const Eigen::Isometry3d& pose = shape_poses[i];
+    Eigen::Vector3d shape_min, shape_max;
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::BOX:
+      case tesseract_geometry::GeometryType::SPHERE:
+      case tesseract_geometry::GeometryType::CYLINDER:
+      case tesseract_geometry::GeometryType::CONE:
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        Eigen::Vector3d local_min, local_max;
+        calcPrimitiveLocalAABB(local_min, local_max, shape);
+        transformAABB(shape_min, shape_max, local_min, local_max, pose);
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(shape);
+        if (mesh.getVertices()->empty())
+          continue;
+
+        const Eigen::Matrix3Xd points = (pose.linear() * mesh.getVertexMap()).colwise() + pose.translation();
+        shape_min = points.rowwise().minCoeff();
+        shape_max = points.rowwise().maxCoeff();
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        const auto& octree = static_cast<const tesseract_geometry::Octree&>(shape);
+        Eigen::Vector3d local_min, local_max;
+        if (!calcOctreeOccupiedAABB(local_min, local_max, *octree.getOctree()))
+          continue;
+
+        transformAABB(shape_min, shape_max, local_min, local_max, pose);
+        break;
+      }
+      case tesseract_geometry::GeometryType::POINT_CLOUD:
+      {
+        const auto& cloud = static_cast<const tesseract_geometry::PointCloud&>(shape);
+        if (cloud.getPointCount() == 0)
+          continue;
+
+        shape_min.setConstant(std::numeric_limits<double>::max());
+        shape_max.setConstant(-std::numeric_limits<double>::max());
+        for (const auto& point : *cloud.getPoints())
+        {
+          const Eigen::Vector3d center = pose * point;
+          shape_min = shape_min.cwiseMin(center);
+          shape_max = shape_max.cwiseMax(center);
+        }
+        shape_min.array() -= cloud.getPointRadius();
+        shape_max.array() += cloud.getPointRadius();
+        break;
+      }
+      default:
+        continue;
+    }
+
+    aabb_min = aabb_min.cwiseMin(shape_min);
+    aabb_max = aabb_max.cwiseMax(shape_max);
+    found = true;
+  }
+
+  if (!found)
+  {
+    aabb_min.setZero();
+    aabb_max.setZero();
+  }
+
+  return found;
+}
+
+SignedDistanceField::SignedDistanceField(const CollisionShapesConst& shapes,
+                                         const tesseract_common::VectorIsometry3d& shape_poses,
+                                         double resolution,
+                                         double padding,
+                                         std::size_t max_voxels)
+  : resolution_(resolution)
+{
+  if (resolution <= 0)
+    throw std::runtime_error("SignedDistanceField, the resolution must be greater than zero!");
+
+  if (shapes.size() != shape_poses.size())
+    throw std::runtime_error("SignedDistanceField, the number of shapes and shape poses must match!");
+
+  Eigen::Vector3d aabb_min, aabb_max;
+  if (!calcCollisionShapesAABB(aabb_min, aabb_max, shapes, shape_poses))
+    return;
+
+  // Increase the resolution until the grid fits within the maximum number of voxels
+  std::size_t num_voxels{ 0 };
+  while (true)
+  {
+    const Eigen::Vector3d size = (aabb_max - aabb_min).array() + (2 * (padding + resolution_));
+    for (std::size_t i = 0; i < 3; ++i)
+      dims_[i] = std::max(2, static_cast<int>(std::ceil(size(static_cast<Eigen::Index>(i)) / resolution_)) + 1);
+
+    num_voxels = static_cast<std::size_t>(dims_[0]) * static_cast<std::size_t>(dims_[1]) *
+                 static_cast<std::size_t>(dims_[2]);
+    if (num_voxels <= max_voxels)
+      break;
+
+    resolution_ *= std::cbrt(static_cast<double>(num_voxels) / static_cast<double>(max_voxels)) * 1.01;
+  }
+
+  if (resolution_ > resolution)
+  {
+    CONSOLE_BRIDGE_logWarn("SignedDistanceField, the resolution was increased from %f to %f to stay within %zu voxels",
+                           resolution,
+                           resolution_,
+                           max_voxels);
+  }
+
+  origin_ = aabb_min.array() - (padding + resolution_);
+
+  VoxelGrid grid;
+  grid.origin = origin_;
+  grid.resolution = resolution_;
+  grid.dims = dims_;
+  grid.solid.resize(num_voxels, 0);
+
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const tesseract_geometry::Geometry& shape = *shapes[i];
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::BOX:
+      case tesseract_geometry::GeometryType::SPHERE:
+      case tesseract_geometry::GeometryType::CYLINDER:
+      case tesseract_geometry::GeometryType::CONE:
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        rasterizePrimitive(grid, shape, shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      case tesseract_geometry::GeometryType::POLYGON_MESH:
+      {
+        rasterizeMesh(grid, static_cast<const tesseract_geometry::PolygonMesh&>(shape), shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::OCTREE:
+      {
+        rasterizeOctree(grid, static_cast<const tesseract_geometry::Octree&>(shape), shape_poses[i]);
+        break;
+      }
+      case tesseract_geometry::GeometryType::POINT_CLOUD:
+      {
+        const auto& cloud = static_cast<const tesseract_geometry::PointCloud&>(shape);
+        const tesseract_geometry::Sphere sphere(cloud.getPointRadius());
+        for (const auto& point : *cloud.getPoints())
+          rasterizePrimitive(grid, sphere, shape_poses[i] * Eigen::Translation3d(point));
+        break;
+      }
+      default:
+      {
+        CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported by the signed distance field",
+                                static_cast<int>(shape.getType()));
+        break;
+      }
+    }
+  }
+
+  if (std::find(grid.solid.begin(), grid.solid.end(), 1) == grid.solid.end())
+    return;
+
+  // The distance from the free voxels to the solid voxels and from the solid voxels to the free voxels
+  std::vector<double> outside(num_voxels);
+  std::vector<double> inside(num_voxels);
+  for (std::size_t i = 0; i < num_voxels; ++i)
+  {
+    outside[i] = (grid.solid[i] != 0) ? 0 : DISTANCE_TRANSFORM_INF;
+    inside[i] = (grid.solid[i] != 0) ? DISTANCE_TRANSFORM_INF : 0;
+  }
+
+  calcSquaredDistanceTransform(outside, grid.dims);
+  calcSquaredDistanceTransform(inside, grid.dims);
+
+  // The surface is half way between the centers of neighboring solid and free voxels
+  const double half_resolution = 0.5 * resolution_;
+  data_.resize(num_voxels);
+  for (std::size_t i = 0; i < num_voxels; ++i)
+  {
+    if (grid.solid[i] != 0)
+      data_[i] = static_cast<float>(-((std::sqrt(inside[i]) * resolution_) - half_resolution));
+    else
+      data_[i] = static_cast<float>((std::sqrt(outside[i]) * resolution_) - half_resolution);
+  }
+}
+
+double SignedDistanceField::getDistance(const Eigen::Vector3d& point) const
+{
+  Eigen::Vector3d gradient;
+  return getDistance(point, gradient);
+}
+
+double SignedDistanceField::getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient) const
+{
+  if (data_.empty())
+  {
+    gradient.setZero();
+    return std::numeric_limits<double>::max();
+  }
+
+  const Eigen::Vector3d g = (point - origin_) / resolution_;
+  const Eigen::Vector3d upper(dims_[0] - 1, dims_[1] - 1, dims_[2] - 1);
+  const Eigen::Vector3d c = g.cwiseMax(Eigen::Vector3d::Zero()).cwiseMin(upper);
+
+  const int x = std::min(static_cast<int>(c.x()), dims_[0] - 2);
+  const int y = std::min(static_cast<int>(c.y()), dims_[1] - 2);
+  const int z = std::min(static_cast<int>(c.z()), dims_[2] - 2);
+  const double tx = c.x() - x;
+  const double ty = c.y() - y;
+  const double tz = c.z() - z;
+
+  const double v000 = data_[index(x, y, z)];
+  const double v100 = data_[index(x + 1, y, z)];
+  const double v010 = data_[index(x, y + 1, z)];
+  const double v110 = data_[index(x + 1, y + 1, z)];
+  const double v001 = data_[index(x, y, z + 1)];
+  const double v101 = data_[index(x + 1, y, z + 1)];
+  const double v011 = data_[index(x, y + 1, z + 1)];
+  const double v111 = data_[index(x + 1, y + 1, z + 1)];
+
+  // Interpolate along x, then y, then z
+  const double v00 = v000 + (tx * (v100 - v000));
+  const double v10 = v010 + (tx * (v110 - v010));
+  const double v01 = v001 + (tx * (v101 - v001));
+  const double v11 = v011 + (tx * (v111 - v011));
+  const double v0 = v00 + (ty * (v10 - v00));
+  const double v1 = v01 + (ty * (v11 - v01));
+  double distance = v0 + (tz * (v1 - v0));
+
+  // Points outside of the grid add the distance to the grid and move away from it
+  const Eigen::Vector3d outside = (g - c) * resolution_;
+  const double outside_distance = outside.norm();
+  if (outside_distance > 0)
+  {
+    gradient = outside / outside_distance;
+    return distance + outside_distance;
+  }
+
+  const double dx = ((1 - tz) * (((1 - ty) * (v100 - v000)) + (ty * (v110 - v010)))) +
+                    (tz * (((1 - ty) * (v101 - v001)) + (ty * (v111 - v011))));
+  const double dy = ((1 - tz) * (v10 - v00)) + (tz * (v11 - v01));
+  const double dz = v1 - v0;
+  gradient = Eigen::Vector3d(dx, dy, dz);
+
+  const double norm = gradient.norm();
+  if (norm > 0)
+    gradient /= norm;
+
+  return distance;
+}
+
+bool SignedDistanceField::empty() const { return data_.empty(); }
+
+double SignedDistanceField::getResolution() const { return resolution_; }
+
+const Eigen::Vector3d& SignedDistanceField::getOrigin() const { return origin_; }
+
+const std::array<int, 3>& SignedDistanceField::getDimensions() const { return dims_; }
+
+std::size_t SignedDistanceField::getMemoryUsage() const { return data_.capacity() * sizeof(float); }
+
+double SignedDistanceField::getVoxelDistance(int x, int y, int z) const { return data_[index(x, y, z)]; }
+
+Eigen::Vector3d SignedDistanceField::getVoxelCenter(int x, int y, int z) const
+{
+  return origin_ + (resolution_ * Eigen::Vector3d(x, y, z));
+}
+
+std::size_t SignedDistanceField::index(int x, int y, int z) const
+{
+  return static_cast<std::size_t>(x) +
+         (static_cast<std::size_t>(dims_[0]) *
+          (static_cast<std::size_t>(y) + (static_cast<std::size_t>(dims_[1]) * static_cast<std::size_t>(z))));
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
@@ -0,0 +1,360 @@
+/**
+ * @file sphere_approximation.cpp
+ * @brief Approximate collision shapes by sets of spheres
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sphere_approximation.h>
+#include <tesseract_collision/sdf/signed_distance_field.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+namespace
+{
+/** @brief The first line of a sphere approximation file */
+const std::string SPHERE_APPROXIMATION_HEADER = "tesseract_sphere_approximation 1";
+
+/** @brief Incrementally hash values using FNV-1a */
+class Fingerprint
+{
+public:
+  template <typename T>
+  void add(const T& value)
+  {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (unsigned char byte : bytes)
+    {
+      hash_ ^= byte;
+      hash_ *= 1099511628211ULL;
+    }
+  }
+
+  std::size_t get() const { return static_cast<std::size_t>(hash_); }
+
+private:
+  std::uint64_t hash_{ 14695981039346656037ULL };
+};
+
+bool isPolygonMesh(const tesseract_geometry::Geometry& shape)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+std::size_t SphereApproximation::size() const { return radii.size(); }
+
+bool SphereApproximation::empty() const { return radii.empty(); }
+
+SphereApproximation approximateWithSpheres(const tesseract_geometry::Geometry& shape,
+                                           double error_bound,
+                                           double resolution)
+{
+  if (error_bound <= 0)
+    throw std::runtime_error("approximateWithSpheres, the error bound must be greater than zero!");
+
+  SphereApproximation spheres;
+  if (shape.getType() == tesseract_geometry::GeometryType::SPHERE)
+  {
+    spheres.centers.emplace_back(Eigen::Vector3d::Zero());
+    spheres.radii.push_back(static_cast<const tesseract_geometry::Sphere&>(shape).getRadius());
+    return spheres;
+  }
+
+  if (shape.getType() == tesseract_geometry::GeometryType::OCTREE)
+    return spheres;
+
+  if (resolution <= 0)
+    resolution = error_bound / 2.0;
+
+  // The padding leaves free voxels around the shape so the border of the shape is represented
+  const SignedDistanceField sdf({ shape.clone() }, { Eigen::Isometry3d::Identity() }, resolution, 2 * resolution);
+  if (sdf.empty())
+    return spheres;
+
+  const std::array<int, 3>& dims = sdf.getDimensions();
+  const double res = sdf.getResolution();
+  auto index = [&dims](int x, int y, int z) {
+    return static_cast<std::size_t>(x) +
+           (static_cast<std::size_t>(dims[0]) *
+            (static_cast<std::size_t>(y) + (static_cast<std::size_t>(dims[1]) * static_cast<std::size_t>(z))));
+  };
+
+  std::vector<std::array<int, 3>> solid;
+  std::vector<double> depth;
+  for (int z = 0; z < dims[2]; ++z)
+  {
+    for (int y = 0; y < dims[1]; ++y)
+    {
+      for (int x = 0; x < dims[0]; ++x)
+      {
+        const double d = sdf.getVoxelDistance(x, y, z);
+        if (d < 0)
+        {
+          solid.push_back({ x, y, z });
+          depth.push_back(-d);
+        }
+      }
+    }
+  }
+
+  // Place the spheres with the largest inscribed radius first so they cover as much of the shape as possible
+  std::vector<std::size_t> order(solid.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&depth](std::size_t a, std::size_t b) { return depth[a] > depth[b]; });
+
+  std::vector<std::uint8_t> covered(static_cast<std::size_t>(dims[0]) * static_cast<std::size_t>(dims[1]) *
+                                        static_cast<std::size_t>(dims[2]),
+                                    0);
+  for (std::size_t i : order)
+  {
+    const std::array<int, 3>& voxel = solid[i];
+    if (covered[index(voxel[0], voxel[1], voxel[2])] != 0)
+      continue;
+
+    const Eigen::Vector3d center = sdf.getVoxelCenter(voxel[0], voxel[1], voxel[2]);
+    const double radius = depth[i] + error_bound;
+    spheres.centers.push_back(center);
+    spheres.radii.push_back(radius);
+
+    const int extent = static_cast<int>(std::ceil(radius / res));
+    for (int z = std::max(0, voxel[2] - extent); z <= std::min(dims[2] - 1, voxel[2] + extent); ++z)
+    {
+      for (int y = std::max(0, voxel[1] - extent); y <= std::min(dims[1] - 1, voxel[1] + extent); ++y)
+      {
+        for (int x = std::max(0, voxel[0] - extent); x <= std::min(dims[0] - 1, voxel[0] + extent); ++x)
+        {
+          if ((sdf.getVoxelCenter(x, y, z) - center).norm() <= radius)
+            covered[index(x, y, z)] = 1;
+        }
+      }
+    }
+  }
+
+  return spheres;
+}
+
+std::size_t getSphereApproximationFingerprint(const tesseract_geometry::Geometry& shape,
+                                              double error_bound,
+                                              double resolution)
+{
+  Fingerprint fingerprint;
+  fingerprint.add(static_cast<int>(shape.getType()));
+  fingerprint.add(error_bound);
+  fingerprint.add(resolution);
+
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      fingerprint.add(box.getX());
+      fingerprint.add(box.getY());
+      fingerprint.add(box.getZ());
+      break;
+    }
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      fingerprint.add(static_cast<const tesseract_geometry::Sphere&>(shape).getRadius());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      fingerprint.add(cylinder.getRadius());
+      fingerprint.add(cylinder.getLength());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(shape);
+      fingerprint.add(cone.getRadius());
+      fingerprint.add(cone.getLength());
+      break;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      fingerprint.add(capsule.getRadius());
+      fingerprint.add(capsule.getLength());
+      break;
+    }
+    default:
+    {
+      if (!isPolygonMesh(shape))
+        break;
+
+      const auto& mesh = static_cast<const tesseract_geometry::PolygonMesh&>(shape);
+      for (const auto& v : *mesh.getVertices())
+      {
+        fingerprint.add(v.x());
+        fingerprint.add(v.y());
+        fingerprint.add(v.z());
+      }
+
+      const Eigen::VectorXi& faces = *mesh.getFaces();
+      for (Eigen::Index i = 0; i < faces.size(); ++i)
+        fingerprint.add(faces[i]);
+
+      break;
+    }
+  }
+
+  return fingerprint.get();
+}
+
+bool saveSphereApproximation(const std::string& path, const SphereApproximation& spheres, std::size_t fingerprint)
+{
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file.is_open())
+    return false;
+
+  file << SPHERE_APPROXIMATION_HEADER << "\n";
+  file << "fingerprint " << fingerprint << "\n";
+  file << "spheres " << spheres.size() << "\n";
+  file << std::setprecision(17);
+  for (std::size_t i = 0; i < spheres.size(); ++i)
+  {
+    const Eigen::Vector3d& c = spheres.centers[i];
+    file << c.x() << " " << c.y() << " " << c.z() << " " << spheres.radii[i] << "\n";
+  }
+
+  return file.good();
+}
+
+bool loadSphereApproximation(SphereApproximation& spheres, const std::string& path, std::size_t fingerprint)
+{
+  std::ifstream file(path);
+  if (!file.is_open())
+    return false;
+
+  std::string header;
+  std::getline(file, header);
+  if (header != SPHERE_APPROXIMATION_HEADER)
+    return false;
+
+  std::string key;
+  std::size_t file_fingerprint{ 0 };
+  if (!(file >> key >> file_fingerprint) || key != "fingerprint" || file_fingerprint != fingerprint)
+    return false;
+
+  std::size_t count{ 0 };
+  if (!(file >> key >> count) || key != "spheres")
+    return false;
+
+  SphereApproximation loaded;
+  loaded.centers.reserve(count);
+  loaded.radii.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Eigen::Vector3d c;
+    double r{ 0 };
+    if (!(file >> c.x() >> c.y() >> c.z() >> r))
+      return false;
+
+    loaded.centers.push_back(c);
+    loaded.radii.push_back(r);
+  }
+
+  spheres = std::move(loaded);
+  return true;
+}
+
+SphereApproximation getCachedSphereApproximation(const tesseract_geometry::Geometry& shape,
+                                                 double error_bound,
+                                                 double resolution)
+{
+  std::string path;
+  if (isPolygonMesh(shape))
+  {
+    tesseract_common::Resource::ConstPtr resource =
+        static_cast<const tesseract_geometry::PolygonMesh&>(shape).getResource();
+    if (resource != nullptr && resource->isFile())
+      path = resource->getFilePath() + ".spheres";
+  }
+
+  if (path.empty())
+    return approximateWithSpheres(shape, error_bound, resolution);
+
+  const std::size_t fingerprint = getSphereApproximationFingerprint(shape, error_bound, resolution);
+  SphereApproximation spheres;
+  if (loadSphereApproximation(spheres, path, fingerprint))
+    return spheres;
+
+  spheres = approximateWithSpheres(shape, error_bound, resolution);
+  if (!saveSphereApproximation(path, spheres, fingerprint))
+    CONSOLE_BRIDGE_logDebug("Failed to write the sphere approximation cache %s", path.c_str());
+
+  return spheres;
+}
+
+void approximateCollisionShapes(CollisionShapesConst& approx_shapes,
+                                tesseract_common::VectorIsometry3d& approx_shape_poses,
+                                const CollisionShapesConst& shapes,
+                                const tesseract_common::VectorIsometry3d& shape_poses,
+                                double error_bound,
+                                bool use_cache)
+{
+  approx_shapes.clear();
+  approx_shape_poses.clear();
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    const SphereApproximation spheres = use_cache ? getCachedSphereApproximation(*shapes[i], error_bound) :
+                                                    approximateWithSpheres(*shapes[i], error_bound);
+    if (spheres.empty())
+    {
+      approx_shapes.push_back(shapes[i]);
+      approx_shape_poses.push_back(shape_poses[i]);
+      continue;
+    }
+
+    for (std::size_t j = 0; j < spheres.size(); ++j)
+    {
+      approx_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(spheres.radii[j]));
+      approx_shape_poses.push_back(shape_poses[i] * Eigen::Translation3d(spheres.centers[j]));
+    }
+  }
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
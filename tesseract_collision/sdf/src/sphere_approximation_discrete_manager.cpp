@@ -0,0 +1,396 @@
+/**
+ * @file sphere_approximation_discrete_manager.cpp
+ * @brief A discrete contact manager which checks the active collision objects using sphere approximations
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/sphere_approximation_discrete_manager.h>
+#include <tesseract_collision/sdf/sphere_approximation.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+namespace
+{
+/** @brief Check if a collision object is explicitly listed as active */
+bool isListedActive(const std::vector<std::string>& active, const std::string& name)
+{
+  return std::find(active.begin(), active.end(), name) != active.end();
+}
+}  // namespace
+
+SphereApproximationDiscreteManager::SphereApproximationDiscreteManager(DiscreteContactManager::UPtr manager,
+                                                                       double error_bound,
+                                                                       bool use_cache)
+  : manager_(std::move(manager)), error_bound_(error_bound), use_cache_(use_cache)
+{
+  if (manager_ == nullptr)
+    throw std::runtime_error("SphereApproximationDiscreteManager, the provided contact manager is a nullptr!");
+
+  if (error_bound_ <= 0)
+    throw std::runtime_error("SphereApproximationDiscreteManager, the error bound must be greater than zero!");
+
+  for (const auto& name : manager_->getCollisionObjects())
+  {
+    CollisionObject object;
+    object.name = name;
+    object.shapes = manager_->getCollisionObjectGeometries(name);
+    object.shape_poses = manager_->getCollisionObjectGeometriesTransforms(name);
+    object.enabled = manager_->isCollisionObjectEnabled(name);
+    objects_.push_back(std::move(object));
+  }
+
+  updateManagerHandles();
+}
+
+std::string SphereApproximationDiscreteManager::getName() const { return manager_->getName(); }
+
+DiscreteContactManager::UPtr SphereApproximationDiscreteManager::clone() const
+{
+  TESSERACT_TRACE_ZONE("SphereApproximationDiscreteManager::clone");
+  static tesseract_common::MetricCounter& clones = getContactManagerCloneMetric("SphereApproximationDiscreteManager");
+  clones.increment();
+  auto manager = std::make_unique<SphereApproximationDiscreteManager>(manager_->clone(), error_bound_, use_cache_);
+
+  // The clone of the wrapped manager contains the same geometry in the same order
+  manager->objects_ = objects_;
+  manager->updateManagerHandles();
+  manager->setActiveCollisionObjectsProfiles(active_profiles_);
+  return manager;
+}
+
+bool SphereApproximationDiscreteManager::addCollisionObject(const std::string& name,
+                                                            const int& mask_id,
+                                                            const CollisionShapesConst& shapes,
+                                                            const tesseract_common::VectorIsometry3d& shape_poses,
+                                                            bool enabled)
+{
+  // An existing object with the same name is replaced and moved to the end of the handles like the other managers
+  if (findHandle(name) >= 0)
+    removeCollisionObject(name);
+
+  CollisionObject object;
+  object.name = name;
+  object.mask_id = mask_id;
+  object.shapes = shapes;
+  object.shape_poses = shape_poses;
+  object.enabled = enabled;
+  object.approximated = isListedActive(manager_->getActiveCollisionObjects(), name);
+  if (object.approximated)
+    approximate(object);
+
+  if (!addToManager(object))
+    return false;
+
+  objects_.push_back(std::move(object));
+  updateManagerHandles();
+  return true;
+}
+
+const CollisionShapesConst&
+SphereApproximationDiscreteManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  int handle = findHandle(name);
+  return (handle >= 0) ? objects_[static_cast<std::size_t>(handle)].shapes : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+SphereApproximationDiscreteManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  int handle = findHandle(name);
+  return (handle >= 0) ? objects_[static_cast<std::size_t>(handle)].shape_poses : EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool SphereApproximationDiscreteManager::hasCollisionObject(const std::string& name) const
+{
+  return manager_->hasCollisionObject(name);
+}
+
+bool SphereApproximationDiscreteManager::removeCollisionObject(const std::string& name)
+{
+  int handle = findHandle(name);
+  if (handle < 0 || !manager_->removeCollisionObject(name))
+    return false;
+
+  objects_.erase(std::next(objects_.begin(), handle));
+  updateManagerHandles();
+  return true;
+}
+
+bool SphereApproximationDiscreteManager::enableCollisionObject(const std::string& name)
+{
+  return enableCollisionObject(findHandle(name));
+}
+
+bool SphereApproximationDiscreteManager::disableCollisionObject(const std::string& name)
+{
+  return disableCollisionObject(findHandle(name));
+}
+
+bool SphereApproximationDiscreteManager::isCollisionObjectEnabled(const std::string& name) const
+{
+  return manager_->isCollisionObjectEnabled(name);
+}
+
+int SphereApproximationDiscreteManager::getCollisionObjectHandle(const std::string& name) const
+{
+  return findHandle(name);
+}
+
+bool SphereApproximationDiscreteManager::enableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(objects_.size()))
+    return false;
+
+  auto h = static_cast<std::size_t>(handle);
+  if (!manager_->enableCollisionObject(manager_handles_[h]))
+    return false;
+
+  objects_[h].enabled = true;
+  return true;
+}
+
+bool SphereApproximationDiscreteManager::disableCollisionObject(int handle)
+{
+  if (handle < 0 || handle >= static_cast<int>(objects_.size()))
+    return false;
+
+  auto h = static_cast<std::size_t>(handle);
+  if (!manager_->disableCollisionObject(manager_handles_[h]))
+    return false;
+
+  objects_[h].enabled = false;
+  return true;
+}
+
+void SphereApproximationDiscreteManager::setCollisionObjectsTransform(const std::string& name,
+                                                                      const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(findHandle(name), pose);
+}
+
+void SphereApproximationDiscreteManager::setCollisionObjectsTransform(int handle, const Eigen::Isometry3d& pose)
+{
+  if (handle < 0 || handle >= static_cast<int>(objects_.size()))
+    return;
+
+  auto h = static_cast<std::size_t>(handle);
+  manager_->setCollisionObjectsTransform(manager_handles_[h], pose);
+  objects_[h].pose = pose;
+}
+
+void SphereApproximationDiscreteManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                                      const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void SphereApproximationDiscreteManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+bool SphereApproximationDiscreteManager::updateCollisionObjectOctree(const std::string& name,
+                                                                     std::size_t shape_index,
+                                                                     const OctreeDelta& delta)
+{
+  int handle = findHandle(name);
+  if (handle < 0)
+    return false;
+
+  const CollisionObject& object = objects_[static_cast<std::size_t>(handle)];
+  if (shape_index >= object.shapes.size())
+    return false;
+
+  // Octrees are not approximated so they are forwarded at their index in the approximated geometry
+  if (object.approximated)
+    shape_index = object.approx_shape_indices[shape_index];
+
+  return manager_->updateCollisionObjectOctree(name, shape_index, delta);
+}
+
+const std::vector<std::string>& SphereApproximationDiscreteManager::getCollisionObjects() const { return names_; }
+
+void SphereApproximationDiscreteManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  // Find the first object whose geometry changes, it and all objects after it are added back so the handles
+  // keep their order
+  std::size_t first = objects_.size();
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+  {
+    if (objects_[i].approximated != isListedActive(names, objects_[i].name))
+    {
+      first = i;
+      break;
+    }
+  }
+
+  for (std::size_t i = first; i < objects_.size(); ++i)
+    manager_->removeCollisionObject(objects_[i].name);
+
+  manager_->setActiveCollisionObjects(names);
+
+  for (std::size_t i = first; i < objects_.size(); ++i)
+  {
+    CollisionObject& object = objects_[i];
+    object.approximated = isListedActive(names, object.name);
+    if (object.approximated)
+      approximate(object);
+
+    addToManager(object);
+  }
+
+  updateManagerHandles();
+}
+
+const std::vector<std::string>& SphereApproximationDiscreteManager::getActiveCollisionObjects() const
+{
+  return manager_->getActiveCollisionObjects();
+}
+
+void SphereApproximationDiscreteManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                                CollisionMarginOverrideType override_type)
+{
+  manager_->setCollisionMarginData(std::move(collision_margin_data), override_type);
+}
+
+void SphereApproximationDiscreteManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  manager_->setDefaultCollisionMarginData(default_collision_margin);
+}
+
+void SphereApproximationDiscreteManager::setPairCollisionMarginData(const std::string& name1,
+                                                                    const std::string& name2,
+                                                                    double collision_margin)
+{
+  manager_->setPairCollisionMarginData(name1, name2, collision_margin);
+}
+
+const CollisionMarginData& SphereApproximationDiscreteManager::getCollisionMarginData() const
+{
+  return manager_->getCollisionMarginData();
+}
+
+void SphereApproximationDiscreteManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  manager_->setIsContactAllowedFn(std::move(fn));
+}
+
+IsContactAllowedFn SphereApproximationDiscreteManager::getIsContactAllowedFn() const
+{
+  return manager_->getIsContactAllowedFn();
+}
+
+void SphereApproximationDiscreteManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  TESSERACT_TRACE_ZONE("SphereApproximationDiscreteManager::contactTest");
+  static tesseract_common::MetricHistogram& latency = getContactTestLatencyMetric("SphereApproximationDiscreteManager");
+  const tesseract_common::MetricTimer timer(latency);
+  manager_->contactTest(collisions, request);
+}
+
+const CollisionShapesConst&
+SphereApproximationDiscreteManager::getCollisionObjectApproximatedGeometries(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometries(name);
+}
+
+const tesseract_common::VectorIsometry3d&
+SphereApproximationDiscreteManager::getCollisionObjectApproximatedGeometriesTransforms(const std::string& name) const
+{
+  return manager_->getCollisionObjectGeometriesTransforms(name);
+}
+
+double SphereApproximationDiscreteManager::getErrorBound() const { return error_bound_; }
+
+const DiscreteContactManager& SphereApproximationDiscreteManager::getManager() const { return *manager_; }
+
+int SphereApproximationDiscreteManager::findHandle(const std::string& name) const
+{
+  int handle = manager_->getCollisionObjectHandle(name);
+  if (handle < 0 || handle >= static_cast<int>(handles_.size()))
+    return -1;
+
+  return handles_[static_cast<std::size_t>(handle)];
+}
+
+void SphereApproximationDiscreteManager::approximate(CollisionObject& object) const
+{
+  if (!object.approx_shape_indices.empty() || object.shapes.empty())
+    return;
+
+  object.approx_shapes.clear();
+  object.approx_shape_poses.clear();
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  for (std::size_t i = 0; i < object.shapes.size(); ++i)
+  {
+    approximateCollisionShapes(
+        shapes, shape_poses, { object.shapes[i] }, { object.shape_poses[i] }, error_bound_, use_cache_);
+    object.approx_shape_indices.push_back(object.approx_shapes.size());
+    object.approx_shapes.insert(object.approx_shapes.end(), shapes.begin(), shapes.end());
+    object.approx_shape_poses.insert(object.approx_shape_poses.end(), shape_poses.begin(), shape_poses.end());
+  }
+}
+
+bool SphereApproximationDiscreteManager::addToManager(const CollisionObject& object)
+{
+  const CollisionShapesConst& shapes = object.approximated ? object.approx_shapes : object.shapes;
+  const tesseract_common::VectorIsometry3d& shape_poses =
+      object.approximated ? object.approx_shape_poses : object.shape_poses;
+  if (!manager_->addCollisionObject(object.name, object.mask_id, shapes, shape_poses, object.enabled))
+    return false;
+
+  manager_->setCollisionObjectsTransform(object.name, object.pose);
+  return true;
+}
+
+void SphereApproximationDiscreteManager::updateManagerHandles()
+{
+  names_.clear();
+  manager_handles_.clear();
+  handles_.assign(manager_->getCollisionObjects().size(), -1);
+  for (std::size_t i = 0; i < objects_.size(); ++i)
+  {
+    int handle = manager_->getCollisionObjectHandle(objects_[i].name);
+    names_.push_back(objects_[i].name);
+    manager_handles_.push_back(handle);
+    if (handle >= 0 && handle < static_cast<int>(handles_.size()))
+      handles_[static_cast<std::size_t>(handle)] = static_cast<int>(i);
+  }
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
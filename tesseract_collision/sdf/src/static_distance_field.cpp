@@ -0,0 +1,336 @@
+/**
+ * @file static_distance_field.cpp
+ * @brief A conservative distance field of the static collision objects of an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/static_distance_field.h>
+#include <tesseract_collision/sdf/signed_distance_field.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision::tesseract_collision_sdf
+{
+namespace
+{
+/** @brief The grid the collision objects are rasterized into */
+struct OccupancyGrid
+{
+  Eigen::Vector3d origin;
+  double resolution{ 0 };
+  std::array<int, 3> dims{ 0, 0, 0 };
+
+  /** @brief The occupancy of the voxels, ordered by x then y then z */
+  std::vector<std::uint8_t> occupied;
+
+  std::size_t index(int x, int y, int z) const
+  {
+    return static_cast<std::size_t>(x) +
+           (static_cast<std::size_t>(dims[0]) *
+            (static_cast<std::size_t>(y) + (static_cast<std::size_t>(dims[1]) * static_cast<std::size_t>(z))));
+  }
+
+  /** @brief Mark the voxels touching a box as occupied, the box is clamped to the grid */
+  void mark(const Eigen::Vector3d& aabb_min, const Eigen::Vector3d& aabb_max)
+  {
+    std::array<int, 3> lower{}, upper{};
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      const auto k = static_cast<Eigen::Index>(i);
+      const auto lower_voxel = static_cast<int>(std::floor(((aabb_min(k) - origin(k)) / resolution) + 0.5));
+      const auto upper_voxel = static_cast<int>(std::floor(((aabb_max(k) - origin(k)) / resolution) + 0.5));
+      lower[i] = std::clamp(lower_voxel, 0, dims[i] - 1);
+      upper[i] = std::clamp(upper_voxel, 0, dims[i] - 1);
+    }
+
+    for (int z = lower[2]; z <= upper[2]; ++z)
+      for (int y = lower[1]; y <= upper[1]; ++y)
+        for (int x = lower[0]; x <= upper[0]; ++x)
+          occupied[index(x, y, z)] = 1;
+  }
+};
+
+/**
+ * @brief Mark the voxels touching the triangles of a mesh
+ * @details The triangles are sampled so the samples are less than half of a voxel apart, then the voxels touching a
+ * box of half a voxel around each sample are marked, which covers every point of the triangles.
+ */
+void markMesh(OccupancyGrid& grid, const tesseract_geometry::PolygonMesh& mesh, const Eigen::Isometry3d& pose)
+{
+  const tesseract_common::VectorVector3d& local_vertices = *mesh.getVertices();
+  const Eigen::VectorXi& faces = *mesh.getFaces();
+  if (local_vertices.empty())
+    return;
+
+  tesseract_common::VectorVector3d vertices;
+  vertices.reserve(local_vertices.size());
+  for (const auto& v : local_vertices)
+    vertices.emplace_back(pose * v);
+
+  const Eigen::Vector3d half_extent = Eigen::Vector3d::Constant(0.5 * grid.resolution);
+  for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+  {
+    const int num_vertices = faces[f];
+    const Eigen::Vector3d& a = vertices[static_cast<std::size_t>(faces[f + 1])];
+    for (int k = 2; k < num_vertices; ++k)
+    {
+      const Eigen::Vector3d& b = vertices[static_cast<std::size_t>(faces[f + k])];
+      const Eigen::Vector3d& c = vertices[static_cast<std::size_t>(faces[f + k + 1])];
+      const double max_edge = std::max({ (b - a).norm(), (c - a).norm(), (c - b).norm() });
+      const int steps = std::max(1, static_cast<int>(std::ceil(max_edge / (0.5 * grid.resolution))));
+      for (int i = 0; i <= steps; ++i)
+      {
+        for (int j = 0; j <= steps - i; ++j)
+        {
+          const Eigen::Vector3d p =
+              a + ((b - a) * (static_cast<double>(i) / steps)) + ((c - a) * (static_cast<double>(j) / steps));
+          grid.mark(p - half_extent, p + half_extent);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Mark the voxels touching the occupied cells of an octree
+ * @details The contact managers may represent a cell by a sphere outside of it, so the voxels touching the world
+ * aligned box around that sphere are marked.
+ */
+void markOctree(OccupancyGrid& grid, const tesseract_geometry::Octree& shape, const Eigen::Isometry3d& pose)
+{
+  const octomap::OcTree& octree = *shape.getOctree();
+  const double occupancy_threshold = octree.getOccupancyThres();
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold)
+      continue;
+
+    const Eigen::Vector3d center = pose * Eigen::Vector3d(it.getX(), it.getY(), it.getZ());
+    const Eigen::Vector3d half_extent = Eigen::Vector3d::Constant(std::sqrt(3.0) * it.getSize() / 2.0);
+    grid.mark(center - half_extent, center + half_extent);
+  }
+}
+
+/** @brief Mark the voxels touching the spheres of a point cloud */
+void markPointCloud(OccupancyGrid& grid, const tesseract_geometry::PointCloud& shape, const Eigen::Isometry3d& pose)
+{
+  const Eigen::Vector3d half_extent = Eigen::Vector3d::Constant(shape.getPointRadius());
+  for (const auto& point : *shape.getPoints())
+  {
+    const Eigen::Vector3d center = pose * point;
+    grid.mark(center - half_extent, center + half_extent);
+  }
+}
+
+/** @brief Check if a bounding box is not empty and finite */
+bool isBounded(const Eigen::AlignedBox3d& aabb) { return aabb.min().allFinite() && aabb.max().allFinite(); }
+}  // namespace
+
+StaticDistanceField::StaticDistanceField(const std::vector<std::string>& names,
+                                         const std::vector<CollisionShapesConst>& shapes,
+                                         const std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                         const tesseract_common::VectorIsometry3d& poses,
+                                         double resolution,
+                                         std::size_t max_voxels)
+  : resolution_(resolution)
+{
+  if (resolution <= 0)
+    throw std::runtime_error("StaticDistanceField, the resolution must be greater than zero!");
+
+  if (shapes.size() != names.size() || shape_poses.size() != names.size() || poses.size() != names.size())
+    throw std::runtime_error("StaticDistanceField, the number of shapes and poses does not match names!");
+
+  // Objects which can not be bounded are not represented
+  Eigen::AlignedBox3d aabb;
+  std::vector<std::size_t> objects;
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    const Eigen::AlignedBox3d object_aabb = calcCollisionObjectAABB(shapes[i], shape_poses[i]);
+    if (object_aabb.isEmpty())
+    {
+      poses_[names[i]] = poses[i];
+      continue;
+    }
+
+    if (!isBounded(object_aabb))
+      continue;
+
+    poses_[names[i]] = poses[i];
+    aabb.extend(transformAABB(object_aabb, poses[i]));
+    objects.push_back(i);
+  }
+
+  if (objects.empty())
+    return;
+
+  // Increase the resolution until the grid fits within the maximum number of voxels
+  std::size_t num_voxels{ 0 };
+  while (true)
+  {
+    const Eigen::Vector3d size = aabb.sizes();
+    for (std::size_t i = 0; i < 3; ++i)
+      dims_[i] = static_cast<int>(std::ceil(size(static_cast<Eigen::Index>(i)) / resolution_)) + 1;
+
+    num_voxels = static_cast<std::size_t>(dims_[0]) * static_cast<std::size_t>(dims_[1]) *
+                 static_cast<std::size_t>(dims_[2]);
+    if (num_voxels <= max_voxels)
+      break;
+
+    resolution_ *= std::cbrt(static_cast<double>(num_voxels) / static_cast<double>(max_voxels)) * 1.01;
+  }
+
+  if (resolution_ > resolution)
+  {
+    CONSOLE_BRIDGE_logWarn("StaticDistanceField, the resolution was increased from %f to %f to stay within %zu voxels",
+                           resolution,
+                           resolution_,
+                           max_voxels);
+  }
+
+  // The voxels cover the bounding box, including half of a voxel past it on each side
+  origin_ = aabb.min();
+
+  OccupancyGrid grid;
+  grid.origin = origin_;
+  grid.resolution = resolution_;
+  grid.dims = dims_;
+  grid.occupied.resize(num_voxels, 0);
+
+  for (const std::size_t i : objects)
+  {
+    for (std::size_t j = 0; j < shapes[i].size(); ++j)
+    {
+      const tesseract_geometry::Geometry& shape = *shapes[i][j];
+      const Eigen::Isometry3d pose = poses[i] * shape_poses[i][j];
+      switch (shape.getType())
+      {
+        case tesseract_geometry::GeometryType::MESH:
+        case tesseract_geometry::GeometryType::POLYGON_MESH:
+        {
+          markMesh(grid, static_cast<const tesseract_geometry::PolygonMesh&>(shape), pose);
+          break;
+        }
+        case tesseract_geometry::GeometryType::OCTREE:
+        {
+          markOctree(grid, static_cast<const tesseract_geometry::Octree&>(shape), pose);
+          break;
+        }
+        case tesseract_geometry::GeometryType::POINT_CLOUD:
+        {
+          markPointCloud(grid, static_cast<const tesseract_geometry::PointCloud&>(shape), pose);
+          break;
+        }
+        default:
+        {
+          const Eigen::AlignedBox3d shape_aabb =
+              calcCollisionObjectAABB({ shapes[i][j] }, tesseract_common::VectorIsometry3d{ pose });
+          if (!shape_aabb.isEmpty())
+            grid.mark(shape_aabb.min(), shape_aabb.max());
+
+          break;
+        }
+      }
+    }
+  }
+
+  if (std::find(grid.occupied.begin(), grid.occupied.end(), 1) == grid.occupied.end())
+    return;
+
+  std::vector<double> values(num_voxels);
+  for (std::size_t i = 0; i < num_voxels; ++i)
+    values[i] = (grid.occupied[i] != 0) ? 0 : DISTANCE_TRANSFORM_INF;
+
+  calcSquaredDistanceTransform(values, dims_);
+
+  // Round down so the stored distances never exceed the exact distances
+  data_.resize(num_voxels);
+  for (std::size_t i = 0; i < num_voxels; ++i)
+    data_[i] = std::nextafter(static_cast<float>(std::sqrt(values[i]) * resolution_), 0.0F);
+}
+
+double StaticDistanceField::getDistanceBound(const Eigen::Vector3d& point) const
+{
+  if (data_.empty())
+    return std::numeric_limits<double>::infinity();
+
+  const Eigen::Vector3d half_resolution = Eigen::Vector3d::Constant(0.5 * resolution_);
+  const Eigen::Vector3d upper = origin_ + (resolution_ * Eigen::Vector3d(dims_[0] - 1, dims_[1] - 1, dims_[2] - 1));
+  const Eigen::Vector3d closest = point.cwiseMax(origin_ - half_resolution).cwiseMin(upper + half_resolution);
+
+  std::array<int, 3> voxel{};
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const auto k = static_cast<Eigen::Index>(i);
+    voxel[i] = std::clamp(static_cast<int>(std::lround((closest(k) - origin_(k)) / resolution_)), 0, dims_[i] - 1);
+  }
+
+  // The closest point and the occupied shapes may be anywhere within their voxels
+  const double inside =
+      std::max(0.0, static_cast<double>(data_[index(voxel[0], voxel[1], voxel[2])]) - (std::sqrt(3.0) * resolution_));
+
+  // The occupied voxels are inside of the grid, so the distance to the grid and the bound within it are orthogonal
+  return std::sqrt((point - closest).squaredNorm() + (inside * inside));
+}
+
+bool StaticDistanceField::hasObject(const std::string& name) const { return poses_.find(name) != poses_.end(); }
+
+const Eigen::Isometry3d* StaticDistanceField::getObjectPose(const std::string& name) const
+{
+  auto it = poses_.find(name);
+  return (it != poses_.end()) ? &it->second : nullptr;
+}
+
+std::vector<std::string> StaticDistanceField::getObjectNames() const
+{
+  std::vector<std::string> names;
+  names.reserve(poses_.size());
+  for (const auto& pose : poses_)
+    names.push_back(pose.first);
+
+  return names;
+}
+
+bool StaticDistanceField::empty() const { return data_.empty(); }
+
+double StaticDistanceField::getResolution() const { return resolution_; }
+
+const std::array<int, 3>& StaticDistanceField::getDimensions() const { return dims_; }
+
+std::size_t StaticDistanceField::getMemoryUsage() const { return data_.capacity() * sizeof(float); }
+
+std::size_t StaticDistanceField::index(int x, int y, int z) const
+{
+  return static_cast<std::size_t>(x) +
+         (static_cast<std::size_t>(dims_[0]) *
+          (static_cast<std::size_t>(y) + (static_cast<std::size_t>(dims_[1]) * static_cast<std::size_t>(z))));
+}
+
+}  // namespace tesseract_collision::tesseract_collision_sdf
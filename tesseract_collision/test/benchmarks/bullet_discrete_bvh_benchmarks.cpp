@@ -4,7 +4,9 @@
 #include <tesseract_collision/test_suite/benchmarks/primatives_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/large_dataset_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
+#include <tesseract_collision/test_suite/benchmarks/workload_benchmarks.hpp>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 
 using namespace tesseract_collision;
 using namespace test_suite;
@@ -14,6 +16,8 @@ int main(int argc, char** argv)
 {
   const tesseract_collision_bullet::BulletDiscreteBVHManager::ConstPtr checker =
       std::make_shared<tesseract_collision_bullet::BulletDiscreteBVHManager>();
+  const tesseract_collision_bullet::BulletCastBVHManager::ConstPtr cast_checker =
+      std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>();
 
   //////////////////////////////////////
   // Clone
@@ -294,6 +298,11 @@ int main(int argc, char** argv)
     }
   }
 
+  //////////////////////////////////////
+  // Continuous, mesh, octree, convex decomposition, clone and batched workloads
+  //////////////////////////////////////
+  registerWorkloadBenchmarks(checker, cast_checker);
+
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -4,7 +4,9 @@
 #include <tesseract_collision/test_suite/benchmarks/primatives_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/large_dataset_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
+#include <tesseract_collision/test_suite/benchmarks/workload_benchmarks.hpp>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/core/conservative_advancement_continuous_manager.h>
 
 using namespace tesseract_collision;
 using namespace test_suite;
@@ -17,6 +19,9 @@ int main(int argc, char** argv)
 {
   const tesseract_collision_fcl::FCLDiscreteBVHManager::ConstPtr checker =
       std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>();
+  const ConservativeAdvancementContinuousManager::ConstPtr cast_checker =
+      std::make_shared<ConservativeAdvancementContinuousManager>(
+          std::make_unique<tesseract_collision_fcl::FCLDiscreteBVHManager>());
 
   //////////////////////////////////////
   // Clone
@@ -309,6 +314,74 @@ int main(int argc, char** argv)
     }
   }
 
+  //////////////////////////////////////
+  // Broadphase and mesh bounding volume types
+  //////////////////////////////////////
+  {
+    using tesseract_collision_fcl::FCLBroadphaseType;
+    using tesseract_collision_fcl::FCLMeshBVType;
+
+    // A grid of many small objects is dominated by the broadphase
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, tesseract_geometry::GeometryType)>
+        BM_LARGE_DATASET_MULTILINK_FUNC = BM_LARGE_DATASET_MULTILINK;
+    for (auto broadphase_type : { FCLBroadphaseType::DYNAMIC_AABB_TREE,
+                                  FCLBroadphaseType::SAP,
+                                  FCLBroadphaseType::SSAP,
+                                  FCLBroadphaseType::INTERVAL_TREE,
+                                  FCLBroadphaseType::SPATIAL_HASH })
+    {
+      tesseract_collision_fcl::FCLDiscreteBVHManagerConfig config;
+      config.broadphase_type = broadphase_type;
+      const std::string type_name =
+          tesseract_collision_fcl::FCLBroadphaseTypeStrings[static_cast<std::size_t>(broadphase_type)];
+
+      for (int edge_size : { 4, 8 })
+      {
+        auto clone = std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>(checker->getName(), config);
+        std::string name = "BM_LARGE_DATASET_MULTILINK_" + checker->getName() + "_" + type_name +
+                           "_PRIMATIVE_EDGE_SIZE_" + std::to_string(edge_size);
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_LARGE_DATASET_MULTILINK_FUNC, clone, edge_size, tesseract_geometry::GeometryType::SPHERE)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMillisecond);
+      }
+    }
+
+    // Detailed meshes are dominated by the bounding volume hierarchy traversal. These workloads compute distances which
+    // FCL does not support for AABB, so it is not included.
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, ContactTestType)>
+        BM_MESH_MESH_CONTACT_TEST_FUNC = BM_MESH_MESH_CONTACT_TEST;
+    for (auto bv_type : { FCLMeshBVType::OBBRSS, FCLMeshBVType::RSS, FCLMeshBVType::KIOS })
+    {
+      tesseract_collision_fcl::FCLDiscreteBVHManagerConfig config;
+      config.mesh_bv_type = bv_type;
+      const std::string type_name = tesseract_collision_fcl::FCLMeshBVTypeStrings[static_cast<std::size_t>(bv_type)];
+
+      for (auto test_type : { ContactTestType::ALL, ContactTestType::CLOSEST })
+      {
+        auto clone = std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>(checker->getName(), config);
+        std::string name = "BM_MESH_MESH_CONTACT_TEST_" + checker->getName() + "_" + type_name + "_" +
+                           ContactTestTypeStrings[static_cast<std::size_t>(test_type)];
+        benchmark::RegisterBenchmark(name.c_str(), BM_MESH_MESH_CONTACT_TEST_FUNC, clone, test_type)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+
+      auto clone = std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>(checker->getName(), config);
+      std::string name =
+          "BM_LARGE_DATASET_MULTILINK_" + checker->getName() + "_" + type_name + "_DETAILED_MESH_EDGE_SIZE_4";
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_LARGE_DATASET_MULTILINK_FUNC, clone, 4, tesseract_geometry::GeometryType::MESH)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Continuous, mesh, octree, convex decomposition, clone and batched workloads
+  //////////////////////////////////////
+  registerWorkloadBenchmarks(checker, cast_checker);
+
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
 }
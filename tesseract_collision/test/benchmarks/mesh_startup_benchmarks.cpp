@@ -0,0 +1,234 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_collision/core/contact_managers_plugin_factory.h>
+#ifdef TESSERACT_BUILD_VHACD
+#include <tesseract_collision/vhacd/convex_decomposition_vhacd.h>
+#endif
+#include <tesseract_geometry/mesh_cache.h>
+#include <tesseract_geometry/mesh_parser.h>
+
+using namespace tesseract_collision;
+using namespace tesseract_geometry;
+
+/** @brief The meshes of tesseract_support the benchmarks are run with */
+struct MeshInfo
+{
+  /** @brief The name used in the benchmark names */
+  std::string name;
+  /** @brief The mesh file path */
+  std::string path;
+};
+
+/**
+ * @brief Write a mesh as a Wavefront OBJ file
+ * @details tesseract_support does not provide OBJ files, so the sphere is converted to have the same geometry for the
+ * STL, DAE and OBJ loaders
+ */
+void writeObjFile(const Mesh& mesh, const std::string& path)
+{
+  std::ofstream file(path);
+  if (!file)
+    throw std::runtime_error("Failed to open file: " + path);
+
+  for (const auto& v : *mesh.getVertices())
+    file << "v " << v.x() << " " << v.y() << " " << v.z() << "\n";
+
+  const Eigen::VectorXi& faces = *mesh.getFaces();
+  for (Eigen::Index i = 0; i < faces.size(); i += faces[i] + 1)
+  {
+    file << "f";
+    for (Eigen::Index j = 1; j <= faces[i]; ++j)
+      file << " " << faces[i + j] + 1;
+    file << "\n";
+  }
+}
+
+std::vector<MeshInfo> getMeshes(const std::string& obj_path)
+{
+  const std::string mesh_dir = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/";
+  return { { "SPHERE_STL", mesh_dir + "sphere_p25m.stl" },
+           { "SPHERE_DAE", mesh_dir + "sphere_p25m.dae" },
+           { "SPHERE_OBJ", obj_path },
+           { "ABB_LINK_2_STL", mesh_dir + "abb_irb2400/irb2400/collision/link_2.stl" },
+           { "PUZZLE_BENT_DAE", mesh_dir + "puzzle_piece/puzzle_bent.dae" } };
+}
+
+/** @brief Load a mesh from a file with all of its meshes combined into one */
+Mesh::Ptr loadMesh(const std::string& path)
+{
+  std::vector<Mesh::Ptr> meshes = createMeshFromPath<Mesh>(path, Eigen::Vector3d(1, 1, 1), true, true);
+  if (meshes.empty())
+    throw std::runtime_error("Failed to load mesh: " + path);
+
+  return meshes.front();
+}
+
+/** @brief Benchmark that loads a mesh from a file */
+static void BM_CREATE_MESH_FROM_PATH(benchmark::State& state, const std::string& path)
+{
+  std::vector<Mesh::Ptr> meshes;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(meshes = createMeshFromPath<Mesh>(path));
+}
+
+/** @brief Benchmark that loads a mesh from a file with a warm mesh cache */
+static void BM_CREATE_MESH_FROM_PATH_CACHED(benchmark::State& state,
+                                            const std::string& path,
+                                            const std::string& cache_dir)
+{
+  MeshCache& cache = MeshCache::getInstance();
+  cache.setDirectory(cache_dir);
+  std::vector<Mesh::Ptr> meshes = createMeshFromPath<Mesh>(path);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(meshes = createMeshFromPath<Mesh>(path));
+
+  cache.setDirectory("");
+}
+
+/** @brief Benchmark that computes the convex hull of a mesh */
+static void BM_MAKE_CONVEX_MESH(benchmark::State& state, const Mesh::Ptr& mesh, int max_vertices)
+{
+  ConvexMesh::Ptr convex_mesh;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(convex_mesh = makeConvexMesh(*mesh, max_vertices));
+}
+
+#ifdef TESSERACT_BUILD_VHACD
+/** @brief Benchmark that computes the convex decomposition of a mesh */
+static void BM_VHACD(benchmark::State& state, const Mesh::Ptr& mesh)
+{
+  ConvexDecompositionVHACD decomposition;
+  std::vector<ConvexMesh::Ptr> convex_meshes;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(convex_meshes = decomposition.compute(*mesh->getVertices(), *mesh->getFaces()));
+}
+#endif
+
+/** @brief Benchmark that constructs the contact managers plugin factory from a YAML file */
+static void BM_CONTACT_MANAGERS_PLUGIN_FACTORY(benchmark::State& state, const std::string& config_path)
+{
+  for (auto _ : state)
+  {
+    ContactManagersPluginFactory factory{ tesseract_common::fs::path(config_path) };
+    benchmark::DoNotOptimize(factory);
+  }
+}
+
+/** @brief Benchmark that constructs the contact managers plugin factory and creates the default managers */
+static void BM_CONTACT_MANAGERS_PLUGIN_FACTORY_CREATE(benchmark::State& state, const std::string& config_path)
+{
+  for (auto _ : state)
+  {
+    ContactManagersPluginFactory factory{ tesseract_common::fs::path(config_path) };
+    DiscreteContactManager::UPtr discrete_manager;
+    ContinuousContactManager::UPtr continuous_manager;
+    benchmark::DoNotOptimize(
+        discrete_manager = factory.createDiscreteContactManager(factory.getDefaultDiscreteContactManagerPlugin()));
+    benchmark::DoNotOptimize(continuous_manager = factory.createContinuousContactManager(
+                                 factory.getDefaultContinuousContactManagerPlugin()));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // Measure the cold start of the loaders, the cache is only enabled by the cached benchmarks
+  MeshCache::getInstance().setDirectory("");
+
+  const tesseract_common::fs::path tmp_dir =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path("tesseract_mesh_%%%%%%%%");
+  tesseract_common::fs::create_directories(tmp_dir);
+  const std::string obj_path = (tmp_dir / "sphere_p25m.obj").string();
+  const std::string cache_dir = (tmp_dir / "cache").string();
+  writeObjFile(*loadMesh(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.stl"), obj_path);
+
+  for (const auto& mesh_info : getMeshes(obj_path))
+  {
+    //////////////////////////////////////
+    // Mesh Loading
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, std::string)> BM_CREATE_MESH_FROM_PATH_FUNC = BM_CREATE_MESH_FROM_PATH;
+      std::string name = "BM_CREATE_MESH_FROM_PATH_" + mesh_info.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_CREATE_MESH_FROM_PATH_FUNC, mesh_info.path)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, std::string, std::string)> BM_CREATE_MESH_FROM_PATH_CACHED_FUNC =
+          BM_CREATE_MESH_FROM_PATH_CACHED;
+      std::string name = "BM_CREATE_MESH_FROM_PATH_CACHED_" + mesh_info.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_CREATE_MESH_FROM_PATH_CACHED_FUNC, mesh_info.path, cache_dir)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Convex Hull
+    //////////////////////////////////////
+
+    Mesh::Ptr mesh = loadMesh(mesh_info.path);
+    for (int max_vertices : { 0, 64 })
+    {
+      std::function<void(benchmark::State&, Mesh::Ptr, int)> BM_MAKE_CONVEX_MESH_FUNC = BM_MAKE_CONVEX_MESH;
+      std::string name = "BM_MAKE_CONVEX_MESH_" + mesh_info.name + "_" + std::to_string(max_vertices);
+      benchmark::RegisterBenchmark(name.c_str(), BM_MAKE_CONVEX_MESH_FUNC, mesh, max_vertices)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+#ifdef TESSERACT_BUILD_VHACD
+    //////////////////////////////////////
+    // Convex Decomposition
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Mesh::Ptr)> BM_VHACD_FUNC = BM_VHACD;
+      std::string name = "BM_VHACD_" + mesh_info.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_VHACD_FUNC, mesh)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+#endif
+  }
+
+  //////////////////////////////////////
+  // Plugin Factory
+  //////////////////////////////////////
+
+  const std::string config_path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/contact_manager_plugins.yaml";
+
+  {
+    std::function<void(benchmark::State&, std::string)> BM_CONTACT_MANAGERS_PLUGIN_FACTORY_FUNC =
+        BM_CONTACT_MANAGERS_PLUGIN_FACTORY;
+    benchmark::RegisterBenchmark(
+        "BM_CONTACT_MANAGERS_PLUGIN_FACTORY", BM_CONTACT_MANAGERS_PLUGIN_FACTORY_FUNC, config_path)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::string)> BM_CONTACT_MANAGERS_PLUGIN_FACTORY_CREATE_FUNC =
+        BM_CONTACT_MANAGERS_PLUGIN_FACTORY_CREATE;
+    benchmark::RegisterBenchmark(
+        "BM_CONTACT_MANAGERS_PLUGIN_FACTORY_CREATE", BM_CONTACT_MANAGERS_PLUGIN_FACTORY_CREATE_FUNC, config_path)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  tesseract_common::fs::remove_all(tmp_dir);
+}
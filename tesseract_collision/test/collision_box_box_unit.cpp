@@ -34,10 +34,127 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionBoxBoxConvexHullUnit)  //
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionBoxBoxGjkWarmStartUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  EXPECT_FALSE(checker.getGjkWarmStart());
+  checker.setGjkWarmStart(true);
+  EXPECT_TRUE(checker.getGjkWarmStart());
+  test_suite::runTest(checker, true);
+
+  DiscreteContactManager::UPtr clone = checker.clone();
+  auto* simple_clone = dynamic_cast<tesseract_collision_bullet::BulletDiscreteSimpleManager*>(clone.get());
+  ASSERT_TRUE(simple_clone != nullptr);
+  EXPECT_TRUE(simple_clone->getGjkWarmStart());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionBoxBoxGjkWarmStartUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  EXPECT_FALSE(checker.getGjkWarmStart());
+  checker.setGjkWarmStart(true);
+  EXPECT_TRUE(checker.getGjkWarmStart());
+  test_suite::runTest(checker, true);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionBoxBoxGjkWarmStartPrimitiveUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  checker.setGjkWarmStart(true);
+  test_suite::runTest(checker, false);
+  checker.setGjkWarmStart(false);
+  EXPECT_FALSE(checker.getGjkWarmStart());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionBoxBoxSelfCollisionUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  EXPECT_FALSE(checker.getSelfCollisionOnly());
+  checker.setSelfCollisionOnly(true);
+  EXPECT_TRUE(checker.getSelfCollisionOnly());
+  test_suite::runTest(checker);
+
+  DiscreteContactManager::UPtr clone = checker.clone();
+  auto* simple_clone = dynamic_cast<tesseract_collision_bullet::BulletDiscreteSimpleManager*>(clone.get());
+  ASSERT_TRUE(simple_clone != nullptr);
+  EXPECT_TRUE(simple_clone->getSelfCollisionOnly());
+
+  // Only the active objects are checked against each other
+  tesseract_common::TransformMap location;
+  location["box_link"] = Eigen::Isometry3d::Identity();
+  location["second_box_link"] = Eigen::Isometry3d::Identity();
+  checker.setCollisionObjectsTransform(location);
+  checker.setActiveCollisionObjects({ "box_link" });
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  checker.setSelfCollisionOnly(false);
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_FALSE(result.empty());
+
+  // The pairs are recomputed when the active objects change
+  result.clear();
+  checker.setSelfCollisionOnly(true);
+  checker.setActiveCollisionObjects({ "box_link", "second_box_link" });
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_FALSE(result.empty());
+
+  // and when the contact allowed function changes
+  result.clear();
+  checker.setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionBoxBoxPoolUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  EXPECT_TRUE(checker.getPoolConfig().has_value());
+
+  // Pools which are too small fall back to the heap
+  ContactManagerConfig config;
+  config.pool_config = ContactManagerPoolConfig();
+  config.pool_config->collision_algorithms_per_object = 1;
+  config.pool_config->persistent_manifolds_per_object = 1;
+  config.pool_config->min_size = 1;
+  checker.applyContactManagerConfig(config);
+  EXPECT_EQ(checker.getPoolConfig(), config.pool_config);
+  test_suite::runTest(checker, true);
+
+  DiscreteContactManager::UPtr clone = checker.clone();
+  EXPECT_EQ(clone->getPoolConfig(), config.pool_config);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionBoxBoxPoolUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  EXPECT_TRUE(checker.getPoolConfig().has_value());
+
+  // Pools which are too small fall back to the heap
+  ContactManagerPoolConfig pool_config;
+  pool_config.collision_algorithms_per_object = 1;
+  pool_config.persistent_manifolds_per_object = 1;
+  pool_config.min_size = 1;
+  checker.setPoolConfig(pool_config);
+  EXPECT_EQ(checker.getPoolConfig(), pool_config);
+  test_suite::runTest(checker, true);
+
+  DiscreteContactManager::UPtr clone = checker.clone();
+  EXPECT_EQ(clone->getPoolConfig(), pool_config);
+
+  tesseract_common::MemoryUsageTracker tracker;
+  const tesseract_common::MemoryUsage usage = checker.getMemoryUsage(tracker);
+  ASSERT_TRUE(usage.getChild("pools") != nullptr);
+  EXPECT_GT(usage.getChild("pools")->unique_bytes, 0U);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBoxBoxUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
   test_suite::runTest(checker, false);
+  EXPECT_FALSE(checker.getPoolConfig().has_value());
 }
 
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBoxBoxConvexHullUnit)  // NOLINT
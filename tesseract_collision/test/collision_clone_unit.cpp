@@ -6,6 +6,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/test_suite/collision_clone_unit.hpp>
 #include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
 
 using namespace tesseract_collision;
@@ -22,6 +24,18 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionCloneUnit)  // NOLINT
   test_suite::runTest(checker, 0.001, 0.001, 0.001);
 }
 
+TEST(TesseractCollisionUnit, BulletContinuousSimpleCollisionCloneUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionCloneUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletCastBVHManager checker;
+  test_suite::runTest(checker);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionCloneUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -5,7 +5,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_collision/core/aabb_soa.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/compact_contact_result.h>
+#include <tesseract_collision/core/primitive_distance.h>
 #include <tesseract_common/utils.h>
 
 TEST(TesseractCoreUnit, getCollisionObjectPairsUnit)  // NOLINT
@@ -48,6 +51,36 @@ TEST(TesseractCoreUnit, getCollisionObjectPairsUnit)  // NOLINT
   pairs = tesseract_collision::getCollisionObjectPairs(active_links, static_links, acm);
 
   EXPECT_TRUE(tesseract_common::isIdentical<tesseract_collision::ObjectPairKey>(pairs, check_pairs, false));
+
+  // Only static links
+  pairs = tesseract_collision::getCollisionObjectPairs({}, static_links);
+  EXPECT_TRUE(pairs.empty());
+}
+
+TEST(TesseractCoreUnit, getCompiledAllowedCollisionMatrixUnit)  // NOLINT
+{
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("base_link", "link_1", "Adjacent");
+
+  auto compiled_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm);
+  tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr current_acm = compiled_acm;
+
+  tesseract_collision::IsContactAllowedFn fn = tesseract_collision::CompiledAllowedCollisionMatrixFn{ &current_acm };
+  EXPECT_TRUE(fn("base_link", "link_1"));
+  EXPECT_TRUE(fn("link_1", "base_link"));
+  EXPECT_FALSE(fn("base_link", "link_2"));
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(fn), compiled_acm);
+
+  // The function always uses the current compiled allowed collision matrix
+  acm.addAllowedCollision("base_link", "link_2", "Never");
+  current_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm);
+  EXPECT_TRUE(fn("base_link", "link_2"));
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(fn), current_acm);
+
+  // Any other function does not provide one
+  fn = [](const std::string&, const std::string&) { return false; };
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(fn), nullptr);
+  EXPECT_EQ(tesseract_collision::getCompiledAllowedCollisionMatrix(nullptr), nullptr);
 }
 
 TEST(TesseractCoreUnit, isContactAllowedUnit)  // NOLINT
@@ -187,6 +220,190 @@ TEST(TesseractCoreUnit, ContactResultsUnit)  // NOLINT
   EXPECT_EQ(results.single_contact_point, false);
 }
 
+TEST(TesseractCoreUnit, ContactResultMapUnit)  // NOLINT
+{
+  tesseract_collision::ContactResultMap result_map;
+  EXPECT_TRUE(result_map.empty());
+  EXPECT_EQ(result_map.size(), 0);
+  EXPECT_EQ(result_map.numContacts(), 0);
+
+  auto key1 = tesseract_common::makeOrderedLinkPair("link1", "link2");
+  auto key2 = tesseract_common::makeOrderedLinkPair("link1", "link3");
+
+  tesseract_collision::ContactResult contact;
+  contact.distance = -0.1;
+  result_map[key1].push_back(contact);
+  result_map[key1].push_back(contact);
+  result_map[key2].push_back(contact);
+  EXPECT_FALSE(result_map.empty());
+  EXPECT_EQ(result_map.size(), 2);
+  EXPECT_EQ(result_map.numContacts(), 3);
+  EXPECT_EQ(result_map.count(key1), 1);
+  EXPECT_EQ(result_map.at(key1).size(), 2);
+  EXPECT_TRUE(result_map.find(key2) != result_map.end());
+
+  // Clearing keeps the storage but hides the pairs
+  const tesseract_collision::ContactResult* key1_data = result_map.at(key1).data();
+  result_map.clear();
+  EXPECT_TRUE(result_map.empty());
+  EXPECT_EQ(result_map.size(), 0);
+  EXPECT_EQ(result_map.numContacts(), 0);
+  EXPECT_EQ(result_map.count(key1), 0);
+  EXPECT_TRUE(result_map.find(key1) == result_map.end());
+  EXPECT_TRUE(result_map.begin() == result_map.end());
+  EXPECT_ANY_THROW(result_map.at(key1));  // NOLINT
+  EXPECT_EQ(result_map.getContainer().size(), 2);
+
+  // Reusing a cleared pair does not reallocate
+  result_map[key1].push_back(contact);
+  EXPECT_EQ(result_map.at(key1).data(), key1_data);
+  EXPECT_EQ(result_map.size(), 1);
+  for (const auto& pair : result_map)
+    EXPECT_EQ(pair.first, key1);
+
+  // Insert does not replace existing contacts but does reuse cleared pairs
+  tesseract_collision::ContactResultVector contacts(3, contact);
+  EXPECT_FALSE(result_map.insert(std::make_pair(key1, contacts)).second);
+  EXPECT_EQ(result_map.at(key1).size(), 1);
+  EXPECT_TRUE(result_map.insert(std::make_pair(key2, contacts)).second);
+  EXPECT_EQ(result_map.at(key2).size(), 3);
+  EXPECT_EQ(result_map.numContacts(), 4);
+
+  tesseract_collision::ContactResultVector flat_results;
+  EXPECT_EQ(tesseract_collision::flattenCopyResults(result_map, flat_results), 4);
+
+  // Shrink removes the cleared pairs and release removes everything
+  result_map.at(key2).clear();
+  result_map.shrinkToFit();
+  EXPECT_EQ(result_map.getContainer().size(), 1);
+  result_map.release();
+  EXPECT_TRUE(result_map.getContainer().empty());
+}
+
+TEST(TesseractCoreUnit, CompactContactResultsUnit)  // NOLINT
+{
+  const std::vector<std::string> link_names{ "link_1", "link_2", "link_3" };
+
+  tesseract_collision::ContactResult result;
+  result.distance = -0.25;
+  result.link_names = { link_names[2], link_names[0] };
+  result.link_handles = { 2, 0 };
+  result.shape_id = { 1, 0 };
+  result.subshape_id = { 3, -1 };
+  result.type_id = { 4, 5 };
+  result.normal = Eigen::Vector3d(0, 0, 1);
+  result.nearest_points[0] = Eigen::Vector3d(1, 2, 3);
+  result.nearest_points[1] = Eigen::Vector3d(1, 2, 3.25);
+  result.cc_time = { 0.5, -1 };
+  result.cc_type = { tesseract_collision::ContinuousCollisionType::CCType_Between,
+                     tesseract_collision::ContinuousCollisionType::CCType_None };
+
+  tesseract_collision::ContactResultMap result_map;
+  result_map[tesseract_collision::getObjectPairKey(result.link_names[0], result.link_names[1])].push_back(result);
+
+  {  // Binary only stores the pair and distance
+    tesseract_collision::CompactContactResults<> compact;
+    EXPECT_EQ(compact.getDetail(), tesseract_collision::ContactResultDetail::BINARY);
+    EXPECT_TRUE(compact.empty());
+    compact.append(result_map);
+    EXPECT_EQ(compact.size(), 1);
+    EXPECT_DOUBLE_EQ(compact[0].distance, -0.25);
+    EXPECT_EQ(compact[0].link_handles[0], 2);
+    EXPECT_EQ(compact[0].link_handles[1], 0);
+    EXPECT_EQ(compact[0].shape_id[0], 1);
+    EXPECT_EQ(compact[0].subshape_id[0], 3);
+    EXPECT_ANY_THROW(compact.getNormal(0));                 // NOLINT
+    EXPECT_ANY_THROW(compact.getNearestPoints(0));          // NOLINT
+    EXPECT_ANY_THROW(compact.getContinuousContactTime(0));  // NOLINT
+
+    tesseract_collision::ContactResult full = compact.toContactResult(0, link_names);
+    EXPECT_EQ(full.link_names[0], result.link_names[0]);
+    EXPECT_EQ(full.link_names[1], result.link_names[1]);
+    EXPECT_EQ(full.link_handles, result.link_handles);
+    EXPECT_DOUBLE_EQ(full.distance, result.distance);
+    EXPECT_TRUE(full.normal.isApprox(Eigen::Vector3d::Zero()));
+    EXPECT_EQ(full.cc_time[0], -1);
+
+    compact.clear();
+    EXPECT_TRUE(compact.empty());
+  }
+
+  {  // Distance adds the normal
+    tesseract_collision::CompactContactResults<float> compact(tesseract_collision::ContactResultDetail::DISTANCE);
+    compact.append(result);
+    EXPECT_FLOAT_EQ(compact[0].distance, -0.25F);
+    EXPECT_TRUE(compact.getNormal(0).isApprox(Eigen::Vector3f(0, 0, 1)));
+    EXPECT_ANY_THROW(compact.getNearestPoints(0));  // NOLINT
+  }
+
+  {  // Full adds the nearest points and the continuous contact data
+    tesseract_collision::CompactContactResults<float> compact(tesseract_collision::ContactResultDetail::FULL);
+    compact.append(result);
+    compact.append(result);
+    EXPECT_EQ(compact.size(), 2);
+    EXPECT_TRUE(compact.getNearestPoints(1)[1].isApprox(Eigen::Vector3f(1, 2, 3.25F)));
+    EXPECT_FLOAT_EQ(compact.getContinuousContactTime(1)[0], 0.5F);
+    EXPECT_EQ(compact.getContinuousContactType(1)[0], tesseract_collision::ContinuousCollisionType::CCType_Between);
+
+    tesseract_collision::ContactResultMap converted;
+    compact.toContactResultMap(converted, link_names);
+    EXPECT_EQ(converted.size(), 1);
+    EXPECT_EQ(converted.numContacts(), 2);
+    const auto& contacts = converted.at(tesseract_collision::getObjectPairKey(link_names[0], link_names[2]));
+    EXPECT_TRUE(contacts[0].nearest_points[1].isApprox(result.nearest_points[1], 1e-6));
+    EXPECT_TRUE(contacts[0].normal.isApprox(result.normal, 1e-6));
+    EXPECT_NEAR(contacts[0].cc_time[0], 0.5, 1e-6);
+    EXPECT_EQ(contacts[0].cc_type, result.cc_type);
+  }
+
+  {  // Contact results without link handles can not be stored
+    tesseract_collision::CompactContactResults<> compact;
+    result.link_handles = { -1, -1 };
+    EXPECT_ANY_THROW(compact.append(result));  // NOLINT
+    EXPECT_TRUE(compact.empty());
+  }
+}
+
+TEST(TesseractCoreUnit, processResultContactLimitUnit)  // NOLINT
+{
+  using namespace tesseract_collision;
+
+  std::vector<std::string> active{ "link_1", "link_2", "link_3" };
+  ContactRequest request(ContactTestType::ALL);
+  request.contact_limit = 3;
+
+  ContactResultMap result;
+  ContactTestData cdata(active, CollisionMarginData(0.1), nullptr, request, result);
+
+  ContactResult contact;
+  contact.distance = -0.01;
+  auto key = getObjectPairKey("link_1", "link_2");
+  EXPECT_TRUE(processResult(cdata, contact, key, false) != nullptr);
+  EXPECT_TRUE(processResult(cdata, contact, key, true) != nullptr);
+  EXPECT_FALSE(cdata.done);
+
+  key = getObjectPairKey("link_1", "link_3");
+  EXPECT_TRUE(processResult(cdata, contact, key, false) != nullptr);
+  EXPECT_TRUE(cdata.done);
+  EXPECT_EQ(result.numContacts(), 3);
+
+  // Contacts rejected by the margin do not count
+  result.clear();
+  cdata.done = false;
+  contact.distance = 0.2;
+  EXPECT_TRUE(processResult(cdata, contact, key, false) == nullptr);
+  EXPECT_FALSE(cdata.done);
+
+  // Without a limit only FIRST finishes the contact test
+  cdata.req.contact_limit = 0;
+  contact.distance = -0.01;
+  for (int i = 0; i < 5; ++i)
+    processResult(cdata, contact, key, i > 0);
+
+  EXPECT_FALSE(cdata.done);
+  EXPECT_EQ(result.numContacts(), 5);
+}
+
 TEST(TesseractCoreUnit, CollisionCheckConfigUnit)  // NOLINT
 {
   tesseract_collision::ContactRequest request;
@@ -197,6 +414,180 @@ TEST(TesseractCoreUnit, CollisionCheckConfigUnit)  // NOLINT
   EXPECT_NEAR(config.longest_valid_segment_length, 0.5, 1e-6);
 }
 
+TEST(TesseractCoreUnit, CollisionObjectAABBUnit)  // NOLINT
+{
+  using namespace tesseract_collision;
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  EXPECT_TRUE(calcCollisionObjectAABB(shapes, shape_poses).isEmpty());
+
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 2, 3));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+  shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.5));
+  shape_poses.push_back(Eigen::Isometry3d::Identity() * Eigen::Translation3d(2, 0, 0));
+
+  Eigen::AlignedBox3d aabb = calcCollisionObjectAABB(shapes, shape_poses);
+  EXPECT_TRUE(aabb.min().isApprox(Eigen::Vector3d(-0.5, -1, -1.5)));
+  EXPECT_TRUE(aabb.max().isApprox(Eigen::Vector3d(2.5, 1, 1.5)));
+
+  // A quarter turn about z swaps the x and y extents
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity() * Eigen::Translation3d(1, 1, 1);
+  pose.rotate(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ()));
+  Eigen::AlignedBox3d world_aabb = transformAABB(aabb, pose);
+  EXPECT_TRUE(world_aabb.min().isApprox(Eigen::Vector3d(0, 0.5, -0.5)));
+  EXPECT_TRUE(world_aabb.max().isApprox(Eigen::Vector3d(2, 3.5, 2.5)));
+
+  // Shapes without a bound make the box infinite, which stays infinite when transformed
+  shapes.push_back(std::make_shared<tesseract_geometry::Plane>(0, 0, 1, 0));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+  aabb = calcCollisionObjectAABB(shapes, shape_poses);
+  EXPECT_FALSE(aabb.isEmpty());
+  EXPECT_FALSE(std::isfinite(aabb.volume()));
+  EXPECT_FALSE(std::isfinite(transformAABB(aabb, pose).volume()));
+}
+
+TEST(TesseractCoreUnit, PrimitiveDistanceUnit)  // NOLINT
+{
+  using namespace tesseract_collision;
+  auto check_witness = [](const PrimitiveDistanceResult& result) {
+    EXPECT_NEAR(result.normal.norm(), 1, 1e-9);
+    EXPECT_TRUE((result.nearest_points[1] - result.nearest_points[0]).isApprox(result.distance * result.normal, 1e-9));
+  };
+
+  const Eigen::Isometry3d identity = Eigen::Isometry3d::Identity();
+  PrimitiveDistanceResult result;
+
+  calcSphereSphereDistance(result, 0.5, identity, 0.25, identity * Eigen::Translation3d(1, 0, 0));
+  EXPECT_NEAR(result.distance, 0.25, 1e-9);
+  EXPECT_TRUE(result.nearest_points[0].isApprox(Eigen::Vector3d(0.5, 0, 0)));
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(0.75, 0, 0)));
+  EXPECT_TRUE(result.normal.isApprox(Eigen::Vector3d::UnitX()));
+
+  calcSphereCapsuleDistance(result, 0.1, identity * Eigen::Translation3d(0.5, 0, 0.2), 0.2, 0.5, identity);
+  EXPECT_NEAR(result.distance, 0.2, 1e-9);
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(0.2, 0, 0.2)));
+  EXPECT_TRUE(result.normal.isApprox(-Eigen::Vector3d::UnitX()));
+  check_witness(result);
+
+  // Crossed capsules, the second one is along x
+  Eigen::Isometry3d crossed = identity * Eigen::Translation3d(0, 1, 0);
+  crossed.rotate(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()));
+  calcCapsuleCapsuleDistance(result, 0.2, 0.5, identity, 0.3, 0.5, crossed);
+  EXPECT_NEAR(result.distance, 0.5, 1e-9);
+  EXPECT_TRUE(result.nearest_points[0].isApprox(Eigen::Vector3d(0, 0.2, 0)));
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(0, 0.7, 0)));
+  check_witness(result);
+
+  calcCapsuleCapsuleDistance(result, 0.2, 0.5, identity, 0.3, 0.5, identity * Eigen::Translation3d(0.4, 0, 0));
+  EXPECT_NEAR(result.distance, -0.1, 1e-9);
+  check_witness(result);
+
+  // A sphere center inside a box is pushed out through the nearest face
+  const Eigen::Vector3d unit_half_extents(1, 1, 1);
+  calcSphereBoxDistance(result, 0.1, identity * Eigen::Translation3d(0.8, 0, 0), unit_half_extents, identity);
+  EXPECT_NEAR(result.distance, -0.3, 1e-9);
+  EXPECT_TRUE(result.nearest_points[0].isApprox(Eigen::Vector3d(0.7, 0, 0)));
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(1, 0, 0)));
+  EXPECT_TRUE(result.normal.isApprox(-Eigen::Vector3d::UnitX()));
+
+  calcSphereBoxDistance(result, 0.5, identity * Eigen::Translation3d(2, 2, 0), unit_half_extents, identity);
+  EXPECT_NEAR(result.distance, std::sqrt(2.0) - 0.5, 1e-9);
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(1, 1, 0)));
+  check_witness(result);
+
+  // Separated boxes whose closest features are two edges
+  const Eigen::Vector3d half_extents(0.5, 0.5, 0.5);
+  Eigen::Isometry3d box1 = identity;
+  box1.rotate(Eigen::AngleAxisd(M_PI_4, Eigen::Vector3d::UnitZ()));
+  Eigen::Isometry3d box2 = identity * Eigen::Translation3d(2, 0, 0);
+  box2.rotate(Eigen::AngleAxisd(M_PI_4, Eigen::Vector3d::UnitY()));
+  calcBoxBoxDistance(result, half_extents, box1, half_extents, box2);
+  EXPECT_NEAR(result.distance, 2 - std::sqrt(2.0), 1e-9);
+  EXPECT_TRUE(result.nearest_points[0].isApprox(Eigen::Vector3d(std::sqrt(0.5), 0, 0)));
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(2 - std::sqrt(0.5), 0, 0)));
+  check_witness(result);
+
+  // A box inside a box
+  calcBoxBoxDistance(result, half_extents, identity * Eigen::Translation3d(0.2, 0.1, 0), unit_half_extents, identity);
+  EXPECT_NEAR(result.distance, -1.3, 1e-9);
+  EXPECT_TRUE(result.normal.isApprox(-Eigen::Vector3d::UnitX()));
+  EXPECT_NEAR(result.nearest_points[0].x(), -0.3, 1e-9);
+  EXPECT_NEAR(result.nearest_points[1].x(), 1, 1e-9);
+  check_witness(result);
+
+  // Moving the second box by the penetration depth along the normal separates the boxes
+  for (int i = 0; i < 100; ++i)
+  {
+    Eigen::Isometry3d tf1 = identity * Eigen::Translation3d(0.3 * Eigen::Vector3d::Random());
+    tf1.rotate(Eigen::Quaterniond::UnitRandom());
+    Eigen::Isometry3d tf2 = identity * Eigen::Translation3d(0.3 * Eigen::Vector3d::Random());
+    tf2.rotate(Eigen::Quaterniond::UnitRandom());
+    const Eigen::Vector3d half_extents2(0.2, 0.4, 0.6);
+    calcBoxBoxDistance(result, half_extents, tf1, half_extents2, tf2);
+    EXPECT_LT(result.distance, 0);
+    check_witness(result);
+
+    tf2.pretranslate((-result.distance + 1e-6) * result.normal);
+    PrimitiveDistanceResult separated;
+    calcBoxBoxDistance(separated, half_extents, tf1, half_extents2, tf2);
+    EXPECT_GT(separated.distance, 0);
+    EXPECT_LT(separated.distance, 1e-5);
+  }
+
+  // The geometry overload orders the pair and swaps the result back
+  const tesseract_geometry::Box box(2, 2, 2);
+  const tesseract_geometry::Sphere sphere(0.5);
+  const tesseract_geometry::Capsule capsule(0.2, 1);
+  EXPECT_TRUE(hasPrimitiveDistance(box, sphere));
+  EXPECT_TRUE(hasPrimitiveDistance(capsule, capsule));
+  EXPECT_FALSE(hasPrimitiveDistance(box, capsule));
+  EXPECT_FALSE(hasPrimitiveDistance(sphere, tesseract_geometry::Cylinder(1, 1)));
+  EXPECT_FALSE(calcPrimitiveDistance(result, capsule, identity, box, identity));
+
+  EXPECT_TRUE(calcPrimitiveDistance(result, box, identity, sphere, identity * Eigen::Translation3d(2, 0, 0)));
+  EXPECT_NEAR(result.distance, 0.5, 1e-9);
+  EXPECT_TRUE(result.nearest_points[0].isApprox(Eigen::Vector3d(1, 0, 0)));
+  EXPECT_TRUE(result.nearest_points[1].isApprox(Eigen::Vector3d(1.5, 0, 0)));
+  EXPECT_TRUE(result.normal.isApprox(Eigen::Vector3d::UnitX()));
+}
+
+TEST(TesseractCoreUnit, AABBSoAUnit)  // NOLINT
+{
+  using namespace tesseract_collision;
+
+  AABBSoA aabbs;
+  EXPECT_TRUE(aabbs.empty());
+
+  aabbs.push_back(Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1));
+  aabbs.push_back(Eigen::Vector3d(0.5, 0.5, 0.5), Eigen::Vector3d(2, 2, 2));
+  aabbs.push_back(Eigen::Vector3d(1, 0, 0), Eigen::Vector3d(2, 1, 1));
+  aabbs.push_back(Eigen::Vector3d(0, 0, 3), Eigen::Vector3d(1, 1, 4));
+  aabbs.push_back(Eigen::Vector3d(-3, -1, -1), Eigen::Vector3d(-2, 1, 1));
+  EXPECT_EQ(aabbs.size(), 5);
+  EXPECT_TRUE(aabbs.getMin(1).isApprox(Eigen::Vector3d(0.5, 0.5, 0.5)));
+  EXPECT_TRUE(aabbs.getMax(3).isApprox(Eigen::Vector3d(1, 1, 4)));
+
+  std::vector<double> separations;
+  aabbs.separations(0, 1, aabbs.size(), separations);
+  ASSERT_EQ(separations.size(), 4);
+  EXPECT_NEAR(separations[0], -0.5, 1e-9);  // Overlapping
+  EXPECT_NEAR(separations[1], 0, 1e-9);     // Touching
+  EXPECT_NEAR(separations[2], 2, 1e-9);
+  EXPECT_NEAR(separations[3], 2, 1e-9);
+
+  aabbs.separations(Eigen::Vector3d(-2.5, 0, 0), Eigen::Vector3d(-1.5, 0.5, 0.5), 0, aabbs.size(), separations);
+  ASSERT_EQ(separations.size(), 5);
+  EXPECT_NEAR(separations[0], 1.5, 1e-9);
+  EXPECT_NEAR(separations[4], -0.5, 1e-9);
+
+  // An empty range
+  aabbs.separations(4, 5, aabbs.size(), separations);
+  EXPECT_TRUE(separations.empty());
+
+  aabbs.clear();
+  EXPECT_TRUE(aabbs.empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
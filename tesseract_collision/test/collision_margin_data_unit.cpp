@@ -283,6 +283,62 @@ TEST(TesseractCollisionUnit, CollisionMarginDataUnit)  // NOLINT
     EXPECT_NEAR(data.getPairCollisionMargin("link_1", "link_3"), pair_margin * 3, tol);
     EXPECT_EQ(data.getPairCollisionMargins().size(), 2);
   }
+
+  {  // Test the pair margins match the lookup table for many pairs
+    double default_margin = 0.0254;
+    std::vector<std::string> names{ "link_1", "link_2", "link_3", "link_4", "link_5", "link_does_not_have_pairs" };
+    CollisionMarginData data(default_margin);
+    for (std::size_t i = 0; i < 5; ++i)
+      for (std::size_t j = i; j < 5; j += 2)
+        data.setPairCollisionMargin(names[j], names[i], 0.1 * static_cast<double>(i + j + 1));
+
+    auto check_pairs = [&names, &data, default_margin, tol](double scale, double increment) {
+      for (const auto& name1 : names)
+      {
+        for (const auto& name2 : names)
+        {
+          const auto& pairs = data.getPairCollisionMargins();
+          auto it = pairs.find(tesseract_common::makeOrderedLinkPair(name1, name2));
+          double expected = (it != pairs.end()) ? it->second : data.getDefaultCollisionMargin();
+          EXPECT_NEAR(data.getPairCollisionMargin(name1, name2), expected, tol);
+          EXPECT_NEAR(data.getPairCollisionMargin(name2, name1), expected, tol);
+          EXPECT_NEAR(data.getPairCollisionMargin(tesseract_common::NameId(name1), tesseract_common::NameId(name2)),
+                      expected,
+                      tol);
+        }
+      }
+      EXPECT_NEAR(data.getDefaultCollisionMargin(), (default_margin * scale) + increment, 1e-12);
+    };
+
+    check_pairs(1, 0);
+
+    data.incrementMargins(0.2);
+    check_pairs(1, 0.2);
+
+    data.scaleMargins(2);
+    check_pairs(2, 0.4);
+
+    data.setDefaultCollisionMargin(default_margin);
+    check_pairs(1, 0);
+  }
+
+  {  // Test the max collision margin of an object
+    double default_margin = 0.0254;
+    CollisionMarginData data(default_margin);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_1"), default_margin, tol);
+
+    data.setPairCollisionMargin("link_1", "link_2", 0.5);
+    data.setPairCollisionMargin("link_2", "link_3", 0.01);
+    data.setPairCollisionMargin("link_3", "link_4", 0.01);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_1"), 0.5, tol);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_2"), 0.5, tol);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_3"), default_margin, tol);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_5"), default_margin, tol);
+
+    data.incrementMargins(0.1);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_1"), 0.6, 1e-12);
+    EXPECT_NEAR(data.getMaxCollisionMargin("link_3"), default_margin + 0.1, 1e-12);
+  }
 }
 
 int main(int argc, char** argv)
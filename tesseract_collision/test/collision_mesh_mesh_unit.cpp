@@ -1,12 +1,16 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <cmath>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/test_suite/collision_mesh_mesh_unit.hpp>
 #include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/bullet/convex_hull_utils.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_utils.h>
 
 using namespace tesseract_collision;
 
@@ -28,6 +32,220 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionMeshMeshUnit)  // NOLINT
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteMeshBVTypesCollisionMeshMeshUnit)  // NOLINT
+{
+  // AABB is not checked, FCL does not compute distances for it
+  using tesseract_collision_fcl::FCLMeshBVType;
+  for (auto type : { FCLMeshBVType::RSS, FCLMeshBVType::KIOS })
+  {
+    SCOPED_TRACE(tesseract_collision_fcl::FCLMeshBVTypeStrings[static_cast<std::size_t>(type)]);
+    tesseract_collision_fcl::FCLDiscreteBVHManagerConfig config;
+    config.mesh_bv_type = type;
+    tesseract_collision_fcl::FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", config);
+    test_suite::runTest(checker);
+  }
+}
+
+TEST(TesseractCollisionUnit, BulletMeshShapeCacheUnit)  // NOLINT
+{
+  using namespace tesseract_collision::tesseract_collision_bullet;
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(0, 0, 0);
+  vertices->emplace_back(1, 0, 0);
+  vertices->emplace_back(0, 1, 0);
+  vertices->emplace_back(0, 0, 1);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(16);
+  *faces << 3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3;
+
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+  auto other_mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+
+  // The same mesh is only converted once and shared between the collision objects
+  COW::Ptr cow1 = createCollisionObject("link1", 0, { mesh }, poses);
+  COW::Ptr cow2 = createCollisionObject("link2", 0, { mesh }, poses);
+  COW::Ptr cow3 = createCollisionObject("link3", 0, { other_mesh }, poses);
+  ASSERT_TRUE(cow1 != nullptr && cow2 != nullptr && cow3 != nullptr);
+  EXPECT_EQ(cow1->getCollisionShape(), cow2->getCollisionShape());
+  EXPECT_NE(cow1->getCollisionShape(), cow3->getCollisionShape());
+  EXPECT_EQ(static_cast<btCompoundShape*>(cow1->getCollisionShape())->getNumChildShapes(), 4);
+
+  // The shape index is stored in the shapes so a different index is a different shape
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Sphere>(0.1), mesh };
+  tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+  COW::Ptr cow4 = createCollisionObject("link4", 0, shapes, shape_poses);
+  ASSERT_TRUE(cow4 != nullptr);
+  auto* compound = static_cast<btCompoundShape*>(cow4->getCollisionShape());
+  ASSERT_EQ(compound->getNumChildShapes(), 2);
+  EXPECT_NE(compound->getChildShape(1), cow1->getCollisionShape());
+  EXPECT_EQ(compound->getChildShape(1)->getUserIndex(), 1);
+
+  // Collision objects created in parallel, including an invalid one, are ordered the same as the names
+  std::vector<std::string> names{ "link5", "link6", "link7" };
+  std::vector<CollisionShapesConst> cow_shapes{ { mesh }, {}, { other_mesh } };
+  std::vector<tesseract_common::VectorIsometry3d> cow_poses{ poses, {}, poses };
+  std::vector<COW::Ptr> cows = createCollisionObjects(names, 0, cow_shapes, cow_poses);
+  ASSERT_EQ(cows.size(), 3);
+  ASSERT_TRUE(cows[0] != nullptr);
+  EXPECT_TRUE(cows[1] == nullptr);
+  ASSERT_TRUE(cows[2] != nullptr);
+  EXPECT_EQ(cows[0]->getName(), "link5");
+  EXPECT_EQ(cows[0]->getCollisionShape(), cow1->getCollisionShape());
+  EXPECT_EQ(cows[2]->getCollisionShape(), cow3->getCollisionShape());
+
+  // The manager adds the valid objects and reports the invalid one
+  BulletDiscreteBVHManager checker;
+  EXPECT_FALSE(checker.addCollisionObjects(names, 0, cow_shapes, cow_poses));
+  EXPECT_EQ(checker.getCollisionObjects(), std::vector<std::string>({ "link5", "link7" }));
+  EXPECT_ANY_THROW(checker.addCollisionObjects(names, 0, cow_shapes, {}));  // NOLINT
+}
+
+TEST(TesseractCollisionUnit, MeshAttachmentUnit)  // NOLINT
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(0, 0, 0);
+  vertices->emplace_back(1, 0, 0);
+  vertices->emplace_back(0, 1, 0);
+  vertices->emplace_back(0, 0, 1);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(16);
+  *faces << 3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3;
+
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+  auto mesh_clone = std::static_pointer_cast<const tesseract_geometry::Mesh>(mesh->clone());
+  auto convex = std::make_shared<tesseract_geometry::ConvexMesh>(vertices, faces);
+  auto convex_clone = std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(convex->clone());
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+
+  {  // The bounding volume hierarchy of fcl is built once for the mesh and its clones
+    EXPECT_FALSE(mesh->hasAttachment("fcl_bvh_obbrss"));
+    tesseract_collision_fcl::CollisionGeometryPtr bvh = tesseract_collision_fcl::createShapePrimitive(mesh);
+    ASSERT_TRUE(bvh != nullptr);
+    EXPECT_TRUE(mesh->hasAttachment("fcl_bvh_obbrss"));
+    EXPECT_TRUE(mesh_clone->hasAttachment("fcl_bvh_obbrss"));
+    EXPECT_EQ(tesseract_collision_fcl::createShapePrimitive(mesh_clone), bvh);
+
+    tesseract_collision_fcl::CollisionGeometryPtr hull = tesseract_collision_fcl::createShapePrimitive(convex);
+    ASSERT_TRUE(hull != nullptr);
+    EXPECT_EQ(tesseract_collision_fcl::createShapePrimitive(convex_clone), hull);
+
+    // A mesh created from the same arrays is not a clone and has its own attachments
+    auto other_mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+    EXPECT_NE(tesseract_collision_fcl::createShapePrimitive(other_mesh), bvh);
+  }
+
+  {  // The bullet shapes are shared by the collision objects of the mesh and its clones
+    using namespace tesseract_collision::tesseract_collision_bullet;
+    COW::Ptr cow1 = createCollisionObject("link1", 0, { mesh }, poses);
+    COW::Ptr cow2 = createCollisionObject("link2", 0, { mesh_clone }, poses);
+    ASSERT_TRUE(cow1 != nullptr && cow2 != nullptr);
+    EXPECT_EQ(cow1->getCollisionShape(), cow2->getCollisionShape());
+
+    COW::Ptr cow3 = createCollisionObject("link3", 0, { convex }, poses);
+    COW::Ptr cow4 = createCollisionObject("link4", 0, { convex_clone }, poses);
+    ASSERT_TRUE(cow3 != nullptr && cow4 != nullptr);
+    EXPECT_EQ(cow3->getCollisionShape(), cow4->getCollisionShape());
+    EXPECT_EQ(cow3->getCollisionShape()->getUserIndex(), 0);
+  }
+}
+
+TEST(TesseractCollisionUnit, BulletConvexHullUnit)  // NOLINT
+{
+  // The points inside a cube are removed before the hull is computed
+  tesseract_common::VectorVector3d cube_points;
+  for (int i = 0; i < 1000; ++i)
+    cube_points.emplace_back(-0.9 + (0.2 * (i % 10)), -0.9 + (0.2 * ((i / 10) % 10)), -0.9 + (0.2 * (i / 100)));
+
+  for (int i = 0; i < 8; ++i)
+    cube_points.emplace_back((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1);
+
+  EXPECT_EQ(filterInteriorPoints(cube_points).size(), 8U);
+
+  tesseract_common::VectorVector3d hull_vertices;
+  Eigen::VectorXi hull_faces;
+  EXPECT_GE(createConvexHull(hull_vertices, hull_faces, cube_points), 6);
+  EXPECT_EQ(hull_vertices.size(), 8U);
+
+  // The hull of points on a sphere is simplified to the vertex limit
+  auto sphere_vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 100; ++i)
+  {
+    const double z = 1.0 - ((2.0 * i + 1.0) / 100.0);
+    const double r = std::sqrt(1.0 - (z * z));
+    sphere_vertices->emplace_back(r * std::cos(2.4 * i), r * std::sin(2.4 * i), z);
+  }
+  auto sphere_faces = std::make_shared<Eigen::VectorXi>(4);
+  *sphere_faces << 3, 0, 1, 2;
+  auto sphere = std::make_shared<tesseract_geometry::Mesh>(sphere_vertices, sphere_faces);
+
+  EXPECT_EQ(makeConvexMesh(*sphere)->getVertexCount(), 100);
+
+  tesseract_geometry::ConvexMesh::Ptr simplified = makeConvexMesh(*sphere, 20);
+  EXPECT_LE(simplified->getVertexCount(), 20);
+  EXPECT_GE(simplified->getVertexCount(), 4);
+  for (const auto& v : *simplified->getVertices())
+    EXPECT_NEAR(v.norm(), 1.0, 1e-6);
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> convex_meshes = makeConvexMeshes({ sphere, sphere, sphere }, 20, 2);
+  ASSERT_EQ(convex_meshes.size(), 3U);
+  for (const auto& convex_mesh : convex_meshes)
+    EXPECT_EQ(convex_mesh->getVertexCount(), simplified->getVertexCount());
+}
+
+TEST(TesseractCollisionUnit, BulletHillClimbingConvexHullUnit)  // NOLINT
+{
+  using tesseract_collision_bullet::HillClimbingConvexHullShape;
+  auto sphere_vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 200; ++i)
+  {
+    const double z = 1.0 - ((2.0 * i + 1.0) / 200.0);
+    const double r = std::sqrt(1.0 - (z * z));
+    sphere_vertices->emplace_back(r * std::cos(2.4 * i), 0.5 * r * std::sin(2.4 * i), z);
+  }
+  auto sphere_faces = std::make_shared<Eigen::VectorXi>(4);
+  *sphere_faces << 3, 0, 1, 2;
+  tesseract_geometry::ConvexMesh::Ptr hull = makeConvexMesh(tesseract_geometry::Mesh(sphere_vertices, sphere_faces));
+
+  HillClimbingConvexHullShape shape(*hull->getVertices(), *hull->getFaces());
+  EXPECT_TRUE(shape.isHillClimbing());
+  shape.setLocalScaling(btVector3(1, 2, 0.5));
+
+  // The walk finds the same support distance as scanning every vertex
+  btConvexHullShape reference;
+  for (const auto& v : *hull->getVertices())
+    reference.addPoint(tesseract_collision_bullet::convertEigenToBt(v));
+  reference.setLocalScaling(btVector3(1, 2, 0.5));
+
+  btAlignedObjectArray<btVector3> vectors;
+  for (int i = 0; i < 500; ++i)
+  {
+    vectors.push_back(tesseract_collision_bullet::convertEigenToBt(Eigen::Vector3d::Random().normalized()));
+  }
+
+  btAlignedObjectArray<btVector3> supports;
+  supports.resize(vectors.size());
+  shape.batchedUnitVectorGetSupportingVertexWithoutMargin(&vectors[0], &supports[0], vectors.size());
+  for (int i = 0; i < vectors.size(); ++i)
+  {
+    const btScalar expected = vectors[i].dot(reference.localGetSupportingVertexWithoutMargin(vectors[i]));
+    EXPECT_NEAR(vectors[i].dot(shape.localGetSupportingVertexWithoutMargin(vectors[i])), expected, 1e-6);
+    EXPECT_NEAR(vectors[i].dot(supports[i]), expected, 1e-6);
+    EXPECT_NEAR(supports[i][3], expected, 1e-6);
+  }
+
+  // Small hulls and vertices that are not on a face use the linear scan
+  tesseract_common::VectorVector3d cube_vertices;
+  for (int i = 0; i < 8; ++i)
+    cube_vertices.emplace_back((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1);
+  EXPECT_FALSE(HillClimbingConvexHullShape(cube_vertices, Eigen::VectorXi()).isHillClimbing());
+
+  tesseract_common::VectorVector3d extra_vertices = *hull->getVertices();
+  extra_vertices.emplace_back(0, 0, 0);
+  EXPECT_FALSE(HillClimbingConvexHullShape(extra_vertices, *hull->getFaces()).isHillClimbing());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
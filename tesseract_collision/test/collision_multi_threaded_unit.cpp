@@ -34,6 +34,24 @@ TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionMultiThreade
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionParallelNarrowphaseConvexHullUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestParallelNarrowphase(checker, true);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionParallelNarrowphaseUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestParallelNarrowphase(checker);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionParallelNarrowphaseCompoundUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestParallelNarrowphaseCompound(checker);
+}
+
 TEST(TesseractCollisionMultiThreadedUnit, FCLDiscreteBVHCollisionMultiThreadedConvexHullUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -34,6 +34,28 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctomapSphereConvexHullUn
   test_suite::runTest(checker, 0.02, true);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionOctreeCellsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTestOctreeCells(checker, Eigen::Isometry3d::Identity());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctreeCellsUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestOctreeCells(checker, Eigen::Isometry3d::Identity());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctreeCellsCompoundUnit)  // NOLINT
+{
+  Eigen::Isometry3d octree_pose = Eigen::Isometry3d::Identity();
+  octree_pose.translation() = Eigen::Vector3d(0.3, -0.2, 1.0);
+  octree_pose.linear() = Eigen::AngleAxisd(M_PI_4, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestOctreeCells(checker, octree_pose);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctomapSphereUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -46,6 +68,42 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctomapSphereConvexHullUnit)
   test_suite::runTest(checker, 0.16, true);  // TODO: There appears to be an issue in fcl for octomap::OcTree.
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionOctreeUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTestOctreeUpdate(checker, 1e-4);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctreeUpdateUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestOctreeUpdate(checker, 1e-4);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctreeUpdateUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTestOctreeUpdate(checker, 1e-3);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionOctreeDistanceToleranceUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTestOctreeDistanceTolerance(checker, 1e-4);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionOctreeDistanceToleranceUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestOctreeDistanceTolerance(checker, 1e-4);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctreeDistanceToleranceUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTestOctreeDistanceTolerance(checker, 1e-3);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,47 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_point_cloud_sphere_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+namespace
+{
+Eigen::Isometry3d getCloudPose()
+{
+  Eigen::Isometry3d cloud_pose = Eigen::Isometry3d::Identity();
+  cloud_pose.translation() = Eigen::Vector3d(0.3, -0.2, 1.0);
+  cloud_pose.linear() = Eigen::AngleAxisd(M_PI_4, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  return cloud_pose;
+}
+}  // namespace
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionPointCloudSphereUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker, getCloudPose());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionPointCloudSphereUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker, getCloudPose());
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionPointCloudSphereUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker, getCloudPose());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,582 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <limits>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/sdf/signed_distance_field.h>
+#include <tesseract_collision/sdf/sdf_discrete_manager.h>
+#include <tesseract_collision/sdf/sdf_factories.h>
+#include <tesseract_collision/sdf/sphere_approximation.h>
+#include <tesseract_collision/sdf/sphere_approximation_discrete_manager.h>
+#include <tesseract_collision/sdf/static_distance_field.h>
+#include <tesseract_collision/sdf/distance_field_filtered_discrete_manager.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_geometry/geometries.h>
+
+using namespace tesseract_collision;
+using namespace tesseract_collision::tesseract_collision_sdf;
+
+namespace
+{
+/** @brief Create a mesh of an axis aligned unit cube centered at the origin */
+tesseract_geometry::Mesh::Ptr createCubeMesh()
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (double z : { -0.5, 0.5 })
+    for (double y : { -0.5, 0.5 })
+      for (double x : { -0.5, 0.5 })
+        vertices->emplace_back(x, y, z);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(48);
+  *faces << 3, 0, 2, 1, 3, 1, 2, 3,  // bottom
+      3, 4, 5, 6, 3, 5, 7, 6,        // top
+      3, 0, 1, 5, 3, 0, 5, 4,        // front
+      3, 2, 6, 7, 3, 2, 7, 3,        // back
+      3, 0, 4, 6, 3, 0, 6, 2,        // left
+      3, 1, 3, 7, 3, 1, 7, 5;        // right
+
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+}
+
+void checkUnitBoxField(const SignedDistanceField& sdf, double tol)
+{
+  EXPECT_FALSE(sdf.empty());
+
+  Eigen::Vector3d gradient;
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0.7, 0, 0), gradient), 0.2, tol);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d(1, 0, 0), 0.1));
+
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, -0.6, 0), gradient), 0.1, tol);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d(0, -1, 0), 0.1));
+
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, 0, 0.4)), -0.1, tol);
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, 0, 0)), -0.5, tol);
+
+  // Points outside of the grid add the distance to the grid
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(3, 0, 0), gradient), 2.5, tol);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d(1, 0, 0), 1e-6));
+}
+
+void addBoxSphere(DiscreteContactManager& manager)
+{
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d box_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(manager.addCollisionObject("box_link", 0, box_shapes, box_poses));
+
+  CollisionShapesConst sphere_shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d sphere_poses{ Eigen::Isometry3d::Identity() };
+  EXPECT_TRUE(manager.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses));
+
+  manager.setActiveCollisionObjects({ "sphere_link" });
+  manager.setDefaultCollisionMarginData(0.1);
+}
+
+void checkBoxSphereContact(DiscreteContactManager& manager, double x, double expected_distance, double tol)
+{
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(x, 0, 0);
+  manager.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap result;
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_TRUE(result_vector.size() == 1);
+
+  const ContactResult& contact = result_vector[0];
+  EXPECT_EQ(contact.link_names[0], "box_link");
+  EXPECT_EQ(contact.link_names[1], "sphere_link");
+  EXPECT_EQ(contact.link_handles[0], 0);
+  EXPECT_EQ(contact.link_handles[1], 1);
+  EXPECT_EQ(contact.shape_id[0], 0);
+  EXPECT_EQ(contact.shape_id[1], 0);
+  EXPECT_NEAR(contact.distance, expected_distance, tol);
+  EXPECT_TRUE(contact.normal.isApprox(Eigen::Vector3d(1, 0, 0), 0.1));
+  EXPECT_NEAR(contact.nearest_points[0][0], 0.5, tol);
+  EXPECT_NEAR(contact.nearest_points[1][0], x - 0.25, tol);
+  EXPECT_TRUE(contact.transform[1].isApprox(sphere_pose));
+  EXPECT_NEAR(contact.nearest_points_local[1][0], -0.25, tol);
+}
+}  // namespace
+
+TEST(TesseractCollisionSDFUnit, SignedDistanceFieldPrimitiveUnit)  // NOLINT
+{
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  SignedDistanceField sdf(shapes, poses, 0.01, 0.05);
+  EXPECT_NEAR(sdf.getResolution(), 0.01, 1e-12);
+  EXPECT_GT(sdf.getMemoryUsage(), 0);
+  checkUnitBoxField(sdf, 0.015);
+
+  // The field is in the frame of the shapes
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(1, 2, 3);
+  SignedDistanceField sphere_sdf({ std::make_shared<tesseract_geometry::Sphere>(0.25) }, { sphere_pose }, 0.01, 0.05);
+  EXPECT_NEAR(sphere_sdf.getDistance(Eigen::Vector3d(1, 2, 3.5)), 0.25, 0.015);
+  EXPECT_NEAR(sphere_sdf.getDistance(Eigen::Vector3d(1, 2, 3)), -0.25, 0.015);
+
+  // Limiting the number of voxels increases the resolution
+  SignedDistanceField coarse_sdf(shapes, poses, 0.01, 0.05, 30 * 30 * 30);
+  EXPECT_GT(coarse_sdf.getResolution(), 0.01);
+  const std::array<int, 3>& dims = coarse_sdf.getDimensions();
+  EXPECT_LE(dims[0] * dims[1] * dims[2], 30 * 30 * 30);
+  EXPECT_NEAR(coarse_sdf.getDistance(Eigen::Vector3d(0.7, 0, 0)), 0.2, coarse_sdf.getResolution());
+}
+
+TEST(TesseractCollisionSDFUnit, SignedDistanceFieldMeshUnit)  // NOLINT
+{
+  CollisionShapesConst shapes{ createCubeMesh() };
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity() };
+  SignedDistanceField sdf(shapes, poses, 0.01, 0.05);
+  checkUnitBoxField(sdf, 0.015);
+
+  Eigen::Vector3d aabb_min, aabb_max;
+  EXPECT_TRUE(calcCollisionShapesAABB(aabb_min, aabb_max, shapes, poses));
+  EXPECT_TRUE(aabb_min.isApprox(Eigen::Vector3d(-0.5, -0.5, -0.5)));
+  EXPECT_TRUE(aabb_max.isApprox(Eigen::Vector3d(0.5, 0.5, 0.5)));
+}
+
+TEST(TesseractCollisionSDFUnit, SignedDistanceFieldEmptyUnit)  // NOLINT
+{
+  SignedDistanceField sdf;
+  EXPECT_TRUE(sdf.empty());
+
+  Eigen::Vector3d gradient;
+  EXPECT_EQ(sdf.getDistance(Eigen::Vector3d::Zero(), gradient), std::numeric_limits<double>::max());
+  EXPECT_TRUE(gradient.isZero());
+
+  EXPECT_ANY_THROW(SignedDistanceField({}, {}, 0, 0.05));  // NOLINT
+}
+
+TEST(TesseractCollisionSDFUnit, SDFDiscreteManagerUnit)  // NOLINT
+{
+  SDFDiscreteManager manager;
+  EXPECT_EQ(manager.getName(), "SDFDiscreteManager");
+  addBoxSphere(manager);
+
+  checkBoxSphereContact(manager, 0.8, 0.05, 0.02);
+  checkBoxSphereContact(manager, 0.6, -0.15, 0.02);
+
+  // Out of the collision margin
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(2, 0, 0);
+  manager.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap result;
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+
+  // Either object of a pair can be the active one
+  sphere_pose.translation() = Eigen::Vector3d(0.6, 0, 0);
+  manager.setCollisionObjectsTransform("sphere_link", sphere_pose);
+  manager.setActiveCollisionObjects({ "box_link" });
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.size() == 1);
+
+  // Disabled objects and allowed contacts are skipped
+  result.clear();
+  EXPECT_TRUE(manager.disableCollisionObject("sphere_link"));
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+  EXPECT_TRUE(manager.enableCollisionObject("sphere_link"));
+
+  manager.setIsContactAllowedFn([](const std::string&, const std::string&) { return true; });
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+  manager.setIsContactAllowedFn(nullptr);
+
+  // Only octree shapes can be updated
+  EXPECT_FALSE(manager.updateCollisionObjectOctree("box_link", 0, OctreeDelta()));
+  EXPECT_FALSE(manager.updateCollisionObjectOctree("missing_link", 0, OctreeDelta()));
+
+  // The clone shares the fields and provides the same results
+  DiscreteContactManager::UPtr clone = manager.clone();
+  EXPECT_EQ(clone->getCollisionObjectHandle("sphere_link"), 1);
+  clone->setActiveCollisionObjects({ "sphere_link" });
+  checkBoxSphereContact(*clone, 0.8, 0.05, 0.02);
+
+  EXPECT_TRUE(manager.removeCollisionObject("box_link"));
+  EXPECT_FALSE(manager.hasCollisionObject("box_link"));
+  EXPECT_EQ(manager.getCollisionObjectHandle("sphere_link"), 0);
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(TesseractCollisionSDFUnit, SDFDiscreteManagerBatchUnit)  // NOLINT
+{
+  SDFDiscreteManager manager;
+  addBoxSphere(manager);
+  EXPECT_EQ(manager.getBatchThreads(), 1);
+
+  std::vector<tesseract_common::TransformMap> transforms;
+  std::vector<tesseract_common::VectorIsometry3d> poses;
+  for (int i = 0; i < 16; ++i)
+  {
+    Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+    sphere_pose.translation() = Eigen::Vector3d(0.55 + (0.05 * i), 0.01 * i, 0);
+    transforms.push_back({ { "sphere_link", sphere_pose } });
+    poses.push_back({ sphere_pose });
+  }
+
+  std::vector<ContactResultMap> serial_results;
+  manager.batchContactTest(serial_results, transforms, ContactRequest(ContactTestType::CLOSEST));
+  ASSERT_EQ(serial_results.size(), transforms.size());
+
+  auto check_results = [&serial_results](const std::vector<ContactResultMap>& results) {
+    ASSERT_EQ(results.size(), serial_results.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      ASSERT_EQ(results[i].size(), serial_results[i].size());
+      for (const auto& pair : serial_results[i])
+      {
+        const auto it = results[i].find(pair.first);
+        ASSERT_TRUE(it != results[i].end());
+        ASSERT_EQ(it->second.size(), pair.second.size());
+        EXPECT_DOUBLE_EQ(it->second.front().distance, pair.second.front().distance);
+      }
+    }
+  };
+
+  // The parallel results match the serial results and the last state remains applied
+  manager.setBatchThreads(4);
+  EXPECT_EQ(manager.getBatchThreads(), 4);
+  std::vector<ContactResultMap> results;
+  manager.batchContactTest(results, transforms, ContactRequest(ContactTestType::CLOSEST));
+  check_results(results);
+
+  ContactResultMap result;
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(result.size(), serial_results.back().size());
+
+  manager.batchContactTest(results, { "sphere_link" }, poses, ContactRequest(ContactTestType::CLOSEST));
+  check_results(results);
+
+  poses.back().push_back(Eigen::Isometry3d::Identity());
+  EXPECT_ANY_THROW(manager.batchContactTest(  // NOLINT
+      results,
+      { "sphere_link" },
+      poses,
+      ContactRequest(ContactTestType::CLOSEST)));
+
+  manager.setBatchThreads(0);
+  EXPECT_EQ(manager.getBatchThreads(), 1);
+  EXPECT_EQ(manager.clone()->getName(), manager.getName());
+}
+
+TEST(TesseractCollisionSDFUnit, SDFDiscreteManagerFactoryUnit)  // NOLINT
+{
+  YAML::Node config = YAML::Load("{resolution: 0.02, padding: 0.1, sample_resolution: 0.03, batch_threads: 4}");
+  SDFDiscreteManagerFactory factory;
+  DiscreteContactManager::UPtr manager = factory.create("SDFManager", config);
+  ASSERT_TRUE(manager != nullptr);
+  EXPECT_EQ(manager->getName(), "SDFManager");
+
+  auto* sdf_manager = dynamic_cast<SDFDiscreteManager*>(manager.get());
+  ASSERT_TRUE(sdf_manager != nullptr);
+  EXPECT_NEAR(sdf_manager->getResolution(), 0.02, 1e-12);
+  EXPECT_NEAR(sdf_manager->getPadding(), 0.1, 1e-12);
+  EXPECT_NEAR(sdf_manager->getSampleResolution(), 0.03, 1e-12);
+  EXPECT_EQ(sdf_manager->getBatchThreads(), 4);
+}
+
+TEST(TesseractCollisionSDFUnit, SphereApproximationUnit)  // NOLINT
+{
+  const double error_bound = 0.02;
+  const Eigen::Vector3d half_extents(0.5, 0.25, 0.15);
+  tesseract_geometry::Box box(2 * half_extents.x(), 2 * half_extents.y(), 2 * half_extents.z());
+  SphereApproximation spheres = approximateWithSpheres(box, error_bound);
+  ASSERT_FALSE(spheres.empty());
+  EXPECT_EQ(spheres.centers.size(), spheres.radii.size());
+
+  // The spheres extend at most the error bound past the box, the resolution is half of the error bound
+  const double tol = error_bound / 2.0;
+  for (std::size_t i = 0; i < spheres.size(); ++i)
+  {
+    const Eigen::Vector3d& c = spheres.centers[i];
+    const double face_distance = (half_extents - c.cwiseAbs()).minCoeff();
+    EXPECT_GE(face_distance, 0);
+    EXPECT_LE(spheres.radii[i] - face_distance, error_bound + tol);
+  }
+
+  // The spheres cover the box
+  for (double x = -0.45; x < 0.5; x += 0.05)
+  {
+    for (double y = -0.2; y < 0.25; y += 0.05)
+    {
+      for (double z = -0.1; z < 0.15; z += 0.05)
+      {
+        double distance = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+          distance = std::min(distance, (Eigen::Vector3d(x, y, z) - spheres.centers[i]).norm() - spheres.radii[i]);
+
+        EXPECT_LE(distance, tol);
+      }
+    }
+  }
+
+  // A sphere is returned as is and octrees are not approximated
+  spheres = approximateWithSpheres(tesseract_geometry::Sphere(0.3), error_bound);
+  ASSERT_EQ(spheres.size(), 1);
+  EXPECT_TRUE(spheres.centers[0].isApprox(Eigen::Vector3d::Zero()));
+  EXPECT_NEAR(spheres.radii[0], 0.3, 1e-12);
+
+  EXPECT_ANY_THROW(approximateWithSpheres(box, 0));  // NOLINT
+
+  // Shapes which are not approximated are kept
+  auto octree = std::make_shared<octomap::OcTree>(0.1);
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Box>(box),
+                               std::make_shared<tesseract_geometry::Octree>(
+                                   octree, tesseract_geometry::Octree::SubType::BOX) };
+  Eigen::Isometry3d box_pose = Eigen::Isometry3d::Identity();
+  box_pose.translation() = Eigen::Vector3d(1, 2, 3);
+  tesseract_common::VectorIsometry3d shape_poses{ box_pose, Eigen::Isometry3d::Identity() };
+  CollisionShapesConst approx_shapes;
+  tesseract_common::VectorIsometry3d approx_shape_poses;
+  approximateCollisionShapes(approx_shapes, approx_shape_poses, shapes, shape_poses, error_bound, false);
+  ASSERT_EQ(approx_shapes.size(), approximateWithSpheres(box, error_bound).size() + 1);
+  ASSERT_EQ(approx_shapes.size(), approx_shape_poses.size());
+  EXPECT_EQ(approx_shapes.front()->getType(), tesseract_geometry::GeometryType::SPHERE);
+  EXPECT_EQ(approx_shapes.back(), shapes.back());
+  EXPECT_LE((approx_shape_poses.front().translation() - box_pose.translation()).norm(), 0.5);
+}
+
+TEST(TesseractCollisionSDFUnit, SphereApproximationCacheUnit)  // NOLINT
+{
+  const std::string mesh_path = tesseract_common::getTempPath() + "sphere_approximation_cube.stl";
+  const std::string cache_path = mesh_path + ".spheres";
+  std::filesystem::remove(cache_path);
+
+  tesseract_geometry::Mesh::Ptr cube = createCubeMesh();
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(
+      cube->getVertices(),
+      cube->getFaces(),
+      std::make_shared<tesseract_common::SimpleLocatedResource>(mesh_path, mesh_path));
+
+  SphereApproximation spheres = getCachedSphereApproximation(*mesh, 0.05);
+  ASSERT_FALSE(spheres.empty());
+  EXPECT_TRUE(std::filesystem::exists(cache_path));
+
+  const std::size_t fingerprint = getSphereApproximationFingerprint(*mesh, 0.05, 0);
+  EXPECT_NE(fingerprint, getSphereApproximationFingerprint(*mesh, 0.04, 0));
+  EXPECT_NE(fingerprint, getSphereApproximationFingerprint(tesseract_geometry::Box(1, 1, 1), 0.05, 0));
+
+  SphereApproximation loaded;
+  EXPECT_FALSE(loadSphereApproximation(loaded, cache_path, fingerprint + 1));
+  EXPECT_TRUE(loaded.empty());
+  ASSERT_TRUE(loadSphereApproximation(loaded, cache_path, fingerprint));
+  ASSERT_EQ(loaded.size(), spheres.size());
+  for (std::size_t i = 0; i < spheres.size(); ++i)
+  {
+    EXPECT_TRUE(loaded.centers[i].isApprox(spheres.centers[i]));
+    EXPECT_DOUBLE_EQ(loaded.radii[i], spheres.radii[i]);
+  }
+
+  // The cached approximation is loaded
+  SphereApproximation cached = getCachedSphereApproximation(*mesh, 0.05);
+  EXPECT_EQ(cached.size(), spheres.size());
+
+  EXPECT_FALSE(loadSphereApproximation(loaded, mesh_path + ".missing", fingerprint));
+  std::filesystem::remove(cache_path);
+}
+
+TEST(TesseractCollisionSDFUnit, SphereApproximationDiscreteManagerUnit)  // NOLINT
+{
+  const double error_bound = 0.02;
+  SphereApproximationDiscreteManager manager(std::make_unique<SDFDiscreteManager>(), error_bound, false);
+  EXPECT_EQ(manager.getName(), "SDFDiscreteManager");
+  EXPECT_NEAR(manager.getErrorBound(), error_bound, 1e-12);
+  addBoxSphere(manager);
+
+  // Spheres are exact so the results match the wrapped manager
+  checkBoxSphereContact(manager, 0.8, 0.05, 0.02);
+  EXPECT_EQ(manager.getCollisionObjectApproximatedGeometries("sphere_link").size(), 1);
+  EXPECT_EQ(manager.getCollisionObjectApproximatedGeometries("box_link").front()->getType(),
+            tesseract_geometry::GeometryType::BOX);
+
+  // The state of the objects added back is restored and the handles keep their order
+  EXPECT_TRUE(manager.disableCollisionObject("sphere_link"));
+  manager.setActiveCollisionObjects({ "box_link" });
+  EXPECT_FALSE(manager.isCollisionObjectEnabled("sphere_link"));
+  EXPECT_TRUE(manager.enableCollisionObject("sphere_link"));
+  EXPECT_EQ(manager.getCollisionObjectHandle("box_link"), 0);
+  EXPECT_EQ(manager.getCollisionObjectHandle("sphere_link"), 1);
+  EXPECT_EQ(manager.getCollisionObjects(), std::vector<std::string>({ "box_link", "sphere_link" }));
+
+  const CollisionShapesConst& approx_shapes = manager.getCollisionObjectApproximatedGeometries("box_link");
+  EXPECT_GT(approx_shapes.size(), 1);
+  for (const auto& shape : approx_shapes)
+    EXPECT_EQ(shape->getType(), tesseract_geometry::GeometryType::SPHERE);
+
+  EXPECT_EQ(manager.getCollisionObjectGeometries("box_link").size(), 1);
+  EXPECT_EQ(manager.getCollisionObjectGeometries("box_link").front()->getType(),
+            tesseract_geometry::GeometryType::BOX);
+
+  // The approximation extends at most the error bound past the box
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(0.8, 0, 0);
+  manager.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap result;
+  manager.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_TRUE(result_vector.size() == 1);
+  EXPECT_LE(result_vector[0].distance, 0.05 + 0.02);
+  EXPECT_GE(result_vector[0].distance, 0.05 - error_bound - 0.02);
+
+  // The clone uses the same geometry
+  DiscreteContactManager::UPtr clone = manager.clone();
+  auto* approx_clone = dynamic_cast<SphereApproximationDiscreteManager*>(clone.get());
+  ASSERT_TRUE(approx_clone != nullptr);
+  EXPECT_EQ(approx_clone->getCollisionObjectApproximatedGeometries("box_link").size(), approx_shapes.size());
+  clone->setActiveCollisionObjects({ "sphere_link" });
+  checkBoxSphereContact(*clone, 0.8, 0.05, 0.02);
+
+  EXPECT_TRUE(manager.removeCollisionObject("box_link"));
+  EXPECT_FALSE(manager.hasCollisionObject("box_link"));
+  EXPECT_EQ(manager.getCollisionObjectHandle("sphere_link"), 0);
+  EXPECT_TRUE(manager.getCollisionObjectGeometries("box_link").empty());
+}
+
+TEST(TesseractCollisionSDFUnit, StaticDistanceFieldUnit)  // NOLINT
+{
+  const double resolution = 0.05;
+  Eigen::Isometry3d mesh_pose = Eigen::Isometry3d::Identity();
+  mesh_pose.translation() = Eigen::Vector3d(0, 3, 0);
+  mesh_pose.linear() = Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+
+  std::vector<std::string> names{ "box_link", "mesh_link", "plane_link" };
+  std::vector<CollisionShapesConst> shapes{ { std::make_shared<tesseract_geometry::Box>(1, 1, 1) },
+                                            { createCubeMesh() },
+                                            { std::make_shared<tesseract_geometry::Plane>(0, 0, 1, 0) } };
+  std::vector<tesseract_common::VectorIsometry3d> shape_poses(3, { Eigen::Isometry3d::Identity() });
+  tesseract_common::VectorIsometry3d poses{ Eigen::Isometry3d::Identity(), mesh_pose, Eigen::Isometry3d::Identity() };
+  StaticDistanceField field(names, shapes, shape_poses, poses, resolution);
+
+  // Planes can not be bounded so they are not represented
+  EXPECT_FALSE(field.empty());
+  EXPECT_TRUE(field.hasObject("box_link"));
+  EXPECT_TRUE(field.hasObject("mesh_link"));
+  EXPECT_FALSE(field.hasObject("plane_link"));
+  EXPECT_EQ(field.getObjectNames(), std::vector<std::string>({ "box_link", "mesh_link" }));
+  ASSERT_TRUE(field.getObjectPose("mesh_link") != nullptr);
+  EXPECT_TRUE(field.getObjectPose("mesh_link")->isApprox(mesh_pose));
+  EXPECT_TRUE(field.getObjectPose("plane_link") == nullptr);
+  EXPECT_NEAR(field.getResolution(), resolution, 1e-12);
+  EXPECT_GT(field.getMemoryUsage(), 0);
+
+  // The bound never exceeds the distance to the shapes and is within a few voxels of it
+  auto distance = [&mesh_pose](const Eigen::Vector3d& point) {
+    const double box = (point.cwiseAbs().array() - 0.5).cwiseMax(0).matrix().norm();
+    const Eigen::Vector3d local = mesh_pose.inverse() * point;
+    const double mesh = (local.cwiseAbs().array() - 0.5).cwiseMax(0).matrix().norm();
+    return std::min(box, mesh);
+  };
+
+  for (const Eigen::Vector3d& point : { Eigen::Vector3d(0.7, 0, 0),
+                                        Eigen::Vector3d(1.5, 1.5, 0.2),
+                                        Eigen::Vector3d(0, 1.5, -0.8),
+                                        Eigen::Vector3d(-0.6, 3.9, 0.1),
+                                        Eigen::Vector3d(5, -2, 3),
+                                        Eigen::Vector3d(0.6, 0.6, 0.6) })
+  {
+    const double bound = field.getDistanceBound(point);
+    EXPECT_LE(bound, distance(point));
+    EXPECT_GE(bound, distance(point) - (6 * resolution));
+  }
+
+  // Meshes are represented by their surface
+  EXPECT_NEAR(field.getDistanceBound(Eigen::Vector3d(0, 3, 0)), 0.5, 6 * resolution);
+  EXPECT_LE(field.getDistanceBound(Eigen::Vector3d(0, 0, 0)), 0);
+
+  // The resolution is increased to stay within the maximum number of voxels
+  StaticDistanceField coarse(names, shapes, shape_poses, poses, resolution, 1000);
+  EXPECT_GT(coarse.getResolution(), resolution);
+  const std::array<int, 3>& dims = coarse.getDimensions();
+  EXPECT_LE(dims[0] * dims[1] * dims[2], 1000);
+  EXPECT_LE(coarse.getDistanceBound(Eigen::Vector3d(1.5, 1.5, 0.2)), distance(Eigen::Vector3d(1.5, 1.5, 0.2)));
+
+  StaticDistanceField empty({ "plane_link" }, { shapes[2] }, { shape_poses[2] }, { poses[2] }, resolution);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(std::isinf(empty.getDistanceBound(Eigen::Vector3d::Zero())));
+
+  EXPECT_ANY_THROW(StaticDistanceField(names, shapes, shape_poses, poses, 0));                    // NOLINT
+  EXPECT_ANY_THROW(StaticDistanceField(names, shapes, shape_poses, { poses[0] }, resolution));  // NOLINT
+}
+
+TEST(TesseractCollisionSDFUnit, DistanceFieldFilteredDiscreteManagerUnit)  // NOLINT
+{
+  auto field = std::make_shared<const StaticDistanceField>(
+      std::vector<std::string>{ "box_link" },
+      std::vector<CollisionShapesConst>{ { std::make_shared<tesseract_geometry::Box>(1, 1, 1) } },
+      std::vector<tesseract_common::VectorIsometry3d>{ { Eigen::Isometry3d::Identity() } },
+      tesseract_common::VectorIsometry3d{ Eigen::Isometry3d::Identity() },
+      0.05);
+
+  DistanceFieldFilteredDiscreteManager manager(std::make_unique<SDFDiscreteManager>(), field);
+  EXPECT_EQ(manager.getName(), "SDFDiscreteManager");
+  EXPECT_EQ(manager.getStaticDistanceField(), field);
+  addBoxSphere(manager);
+  manager.setCollisionObjectsTransform("box_link", Eigen::Isometry3d::Identity());
+
+  // Close to the box the contact test is forwarded and the results match the wrapped manager
+  checkBoxSphereContact(manager, 0.8, 0.05, 0.02);
+  EXPECT_TRUE(manager.getFilteredCollisionObjects().empty());
+  EXPECT_EQ(manager.getSkippedContactTests(), 0);
+
+  // Far from the box the wrapped manager is not called
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(2, 0, 0);
+  manager.setCollisionObjectsTransform("sphere_link", sphere_pose);
+  ContactResultMap result;
+  manager.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  EXPECT_EQ(manager.getFilteredCollisionObjects(), std::vector<std::string>({ "sphere_link" }));
+  EXPECT_EQ(manager.getSkippedContactTests(), 1);
+
+  // The contact allowed function of the user is kept
+  EXPECT_TRUE(manager.getIsContactAllowedFn() == nullptr);
+  manager.setIsContactAllowedFn([](const std::string&, const std::string&) { return false; });
+  EXPECT_TRUE(manager.getIsContactAllowedFn() != nullptr);
+  EXPECT_FALSE(manager.getManager().getIsContactAllowedFn()("box_link", "sphere_link"));
+
+  // A clone filters the same way
+  DiscreteContactManager::UPtr clone = manager.clone();
+  result.clear();
+  clone->contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  EXPECT_EQ(dynamic_cast<DistanceFieldFilteredDiscreteManager&>(*clone).getSkippedContactTests(), 1);
+  checkBoxSphereContact(*clone, 0.8, 0.05, 0.02);
+
+  // Once the box moves away from the field the contact tests are forwarded
+  Eigen::Isometry3d box_pose = Eigen::Isometry3d::Identity();
+  box_pose.translation() = Eigen::Vector3d(2.8, 0, 0);
+  manager.setCollisionObjectsTransform("box_link", box_pose);
+  result.clear();
+  manager.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+  EXPECT_EQ(manager.getSkippedContactTests(), 1);
+
+  // Without a field nothing is filtered
+  manager.setCollisionObjectsTransform("box_link", Eigen::Isometry3d::Identity());
+  manager.setStaticDistanceField(nullptr);
+  result.clear();
+  manager.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  EXPECT_TRUE(manager.getFilteredCollisionObjects().empty());
+  EXPECT_EQ(manager.getSkippedContactTests(), 1);
+
+  EXPECT_ANY_THROW(DistanceFieldFilteredDiscreteManager(nullptr, field));  // NOLINT
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -6,6 +6,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/test_suite/collision_sphere_sphere_cast_unit.hpp>
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/core/conservative_advancement_continuous_manager.h>
 
 using namespace tesseract_collision;
 
@@ -33,6 +36,150 @@ TEST(TesseractCollisionUnit, BulletContinuousBVHCollisionSphereSphereConvexHullU
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, BulletCastHullShapeBatchedSupportUnit)  // NOLINT
+{
+  btTransform t01;
+  t01.setIdentity();
+  t01.setOrigin(btVector3(0.5, 0.2, -0.1));
+  t01.setRotation(btQuaternion(btVector3(0, 0, 1), 0.3));
+
+  btBoxShape box(btVector3(0.1, 0.2, 0.3));
+  box.setMargin(0.01);
+
+  btConvexHullShape hull;
+  hull.addPoint(btVector3(0, 0, 0), false);
+  hull.addPoint(btVector3(0.2, 0, 0), false);
+  hull.addPoint(btVector3(0, 0.3, 0), false);
+  hull.addPoint(btVector3(0, 0, 0.4), true);
+
+  std::vector<btConvexShape*> shapes{ &box, &hull };
+  for (auto* shape : shapes)
+  {
+    tesseract_collision_bullet::CastHullShape cast_shape(shape, t01);
+
+    btAlignedObjectArray<btVector3> vectors;
+    for (int x = -1; x <= 1; ++x)
+      for (int y = -1; y <= 1; ++y)
+        for (int z = -1; z <= 1; ++z)
+          if (x != 0 || y != 0 || z != 0)
+            vectors.push_back(btVector3(x, y, z).normalized());
+
+    btAlignedObjectArray<btVector3> supports;
+    supports.resize(vectors.size());
+    cast_shape.batchedUnitVectorGetSupportingVertexWithoutMargin(&vectors[0], &supports[0], vectors.size());
+
+    for (int i = 0; i < vectors.size(); ++i)
+    {
+      btVector3 expected = cast_shape.localGetSupportingVertexWithoutMargin(vectors[i]);
+      EXPECT_NEAR(vectors[i].dot(supports[i]), vectors[i].dot(expected), 1e-6);
+      EXPECT_NEAR(supports[i][3], vectors[i].dot(expected), 1e-6);
+    }
+  }
+}
+
+namespace
+{
+void runConservativeAdvancementTest(DiscreteContactManager::UPtr manager)
+{
+  const std::string name = manager->getName();
+  ConservativeAdvancementContinuousManager checker(std::move(manager), 1e-5);
+  EXPECT_EQ(checker.getName(), name);
+  EXPECT_ANY_THROW(ConservativeAdvancementContinuousManager(nullptr));  // NOLINT
+
+  CollisionShapesConst shapes{ std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity() };
+  Eigen::Isometry3d offset_pose = Eigen::Isometry3d::Identity();
+  offset_pose.translation() = Eigen::Vector3d(0, 0, 0.5);
+  EXPECT_TRUE(checker.addCollisionObject("sphere_link", 0, shapes, shape_poses));
+  EXPECT_TRUE(checker.addCollisionObject("sphere1_link", 0, shapes, { offset_pose }));
+  EXPECT_NEAR(checker.getCollisionObjectRadius("sphere_link"), 0.25, 1e-8);
+  EXPECT_NEAR(checker.getCollisionObjectRadius("sphere1_link"), 0.75, 1e-8);
+  EXPECT_NEAR(checker.getCollisionObjectRadius("link_does_not_exist"), 0, 1e-8);
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setDefaultCollisionMarginData(0.1);
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-8);
+
+  // The static sphere is centered at (0, 0, 0.5) so the spheres come within the margin at x = -0.6, t = 0.35
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = Eigen::Vector3d(-2, 0, 0.5);
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  end_pose.translation() = Eigen::Vector3d(2, 0, 0.5);
+  checker.setCollisionObjectsTransform("sphere1_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+
+  ContactResultVector result_vector;
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+
+  std::size_t idx = (result_vector[0].link_names[0] == "sphere_link") ? 0 : 1;
+  EXPECT_LT(result_vector[0].distance, 0.1 + 1e-5);
+  EXPECT_GT(result_vector[0].distance, 0.1 - 1e-5);
+  EXPECT_NEAR(result_vector[0].cc_time[idx], 0.35, 1e-4);
+  EXPECT_TRUE(result_vector[0].cc_type[idx] == ContinuousCollisionType::CCType_Between);
+  EXPECT_NEAR(result_vector[0].cc_time[1 - idx], -1, 1e-8);
+  EXPECT_TRUE(result_vector[0].cc_type[1 - idx] == ContinuousCollisionType::CCType_None);
+  EXPECT_TRUE(result_vector[0].transform[idx].isApprox(start_pose, 1e-8));
+  EXPECT_TRUE(result_vector[0].cc_transform[idx].isApprox(end_pose, 1e-8));
+
+  // The wrapped manager is restored to the start of the motion
+  EXPECT_NEAR(checker.getManager().getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-8);
+
+  // Starting in contact is reported at the start of the motion
+  start_pose.translation() = Eigen::Vector3d(-0.3, 0, 0.5);
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+  idx = (result_vector[0].link_names[0] == "sphere_link") ? 0 : 1;
+  EXPECT_NEAR(result_vector[0].cc_time[idx], 0, 1e-8);
+  EXPECT_TRUE(result_vector[0].cc_type[idx] == ContinuousCollisionType::CCType_Time0);
+
+  // Passing by the static sphere is not in contact
+  start_pose.translation() = Eigen::Vector3d(-2, 1, 0.5);
+  end_pose.translation() = Eigen::Vector3d(2, 1, 0.5);
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  // Rotating while moving towards the static sphere, reaching the margin at the end of the motion
+  start_pose.translation() = Eigen::Vector3d(2, 0, 0.5);
+  end_pose = Eigen::Isometry3d::Identity();
+  end_pose.linear() = Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()).toRotationMatrix();
+  end_pose.translation() = Eigen::Vector3d(0.6, 0, 0.5);
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  flattenMoveResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1);
+  idx = (result_vector[0].link_names[0] == "sphere_link") ? 0 : 1;
+  EXPECT_NEAR(result_vector[0].cc_time[idx], 1, 1e-4);
+
+  ContinuousContactManager::UPtr clone = checker.clone();
+  EXPECT_EQ(clone->getName(), name);
+  result.clear();
+  clone->contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+}
+}  // namespace
+
+TEST(TesseractCollisionUnit, BulletConservativeAdvancementCollisionSphereSphereUnit)  // NOLINT
+{
+  runConservativeAdvancementTest(std::make_unique<tesseract_collision_bullet::BulletDiscreteBVHManager>());
+}
+
+TEST(TesseractCollisionUnit, FCLConservativeAdvancementCollisionSphereSphereUnit)  // NOLINT
+{
+  runConservativeAdvancementTest(std::make_unique<tesseract_collision_fcl::FCLDiscreteBVHManager>());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -34,12 +34,51 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionSphereSphereConvexHullUni
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCachedCollisionSphereSphereUnit)  // NOLINT
+{
+  CachedDiscreteContactManager checker(std::make_unique<tesseract_collision_bullet::BulletDiscreteBVHManager>());
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHResultCacheSphereSphereUnit)  // NOLINT
+{
+  test_suite::runTestResultCache(std::make_unique<tesseract_collision_bullet::BulletDiscreteBVHManager>());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleStatisticsSphereSphereUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTestStatistics(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHStatisticsSphereSphereUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTestStatistics(checker);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereSphereUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
   test_suite::runTest(checker, false);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBroadphaseTypesCollisionSphereSphereUnit)  // NOLINT
+{
+  using tesseract_collision_fcl::FCLBroadphaseType;
+  for (auto type : { FCLBroadphaseType::SAP,
+                     FCLBroadphaseType::SSAP,
+                     FCLBroadphaseType::INTERVAL_TREE,
+                     FCLBroadphaseType::SPATIAL_HASH })
+  {
+    SCOPED_TRACE(tesseract_collision_fcl::FCLBroadphaseTypeStrings[static_cast<std::size_t>(type)]);
+    tesseract_collision_fcl::FCLDiscreteBVHManagerConfig config;
+    config.broadphase_type = type;
+    tesseract_collision_fcl::FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", config);
+    test_suite::runTest(checker, false);
+  }
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereSphereConvexHullUnit)  // NOLINT
 {
   tesseract_collision_fcl::FCLDiscreteBVHManager checker;
@@ -49,6 +88,23 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereSphereConvexHullUnit)
   test_suite::detail::runTestConvex3(checker);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCachedCollisionSphereSphereUnit)  // NOLINT
+{
+  CachedDiscreteContactManager checker(std::make_unique<tesseract_collision_fcl::FCLDiscreteBVHManager>());
+  test_suite::runTest(checker, false);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHResultCacheSphereSphereUnit)  // NOLINT
+{
+  test_suite::runTestResultCache(std::make_unique<tesseract_collision_fcl::FCLDiscreteBVHManager>());
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHStatisticsSphereSphereUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTestStatistics(checker);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
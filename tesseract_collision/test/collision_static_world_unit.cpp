@@ -0,0 +1,56 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_static_world_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionStaticWorldUnit)  // NOLINT
+{
+  auto world = std::make_shared<tesseract_collision_bullet::BulletStaticCollisionWorld>();
+  test_suite::addStaticWorldObjects(*world);
+
+  // Several managers share the same world
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker1;
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker2;
+  checker1.setStaticCollisionWorld(world);
+  checker2.setStaticCollisionWorld(world);
+  EXPECT_EQ(checker1.getStaticCollisionWorld(), checker2.getStaticCollisionWorld());
+
+  test_suite::runTest(checker1);
+  test_suite::runTest(checker2);
+
+  checker1.setStaticCollisionWorld(nullptr);
+  EXPECT_TRUE(checker1.getStaticCollisionWorld() == nullptr);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionStaticWorldUnit)  // NOLINT
+{
+  auto world = std::make_shared<tesseract_collision_fcl::FCLStaticCollisionWorld>(0.5);
+  test_suite::addStaticWorldObjects(*world);
+  EXPECT_NEAR(world->getContactDistance(), 0.5, 1e-10);
+
+  // Several managers share the same world
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker1;
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker2;
+  checker1.setStaticCollisionWorld(world);
+  checker2.setStaticCollisionWorld(world);
+  EXPECT_EQ(checker1.getStaticCollisionWorld(), checker2.getStaticCollisionWorld());
+
+  test_suite::runTest(checker1);
+  test_suite::runTest(checker2);
+
+  checker1.setStaticCollisionWorld(nullptr);
+  EXPECT_TRUE(checker1.getStaticCollisionWorld() == nullptr);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -73,7 +73,7 @@ void runContactManagersFactoryTest(const tesseract_common::fs::path& config_path
     EXPECT_TRUE(cm != nullptr);
   }
 
-  EXPECT_EQ(continuous_plugins.size(), 2);
+  EXPECT_EQ(continuous_plugins.size(), 3);
   for (auto cm_it = continuous_plugins.begin(); cm_it != continuous_plugins.end(); ++cm_it)
   {
     auto name = cm_it->first.as<std::string>();
@@ -0,0 +1,207 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/convex_decomposition.h>
+#include <tesseract_common/executor.h>
+#include <tesseract_common/types.h>
+#ifdef TESSERACT_BUILD_VHACD
+#include <tesseract_collision/vhacd/convex_decomposition_vhacd.h>
+#include <tesseract_geometry/mesh_cache.h>
+#endif
+
+using namespace tesseract_collision;
+
+/** @brief Returns a single convex mesh with the vertices of the input and throws for a mesh starting below the origin */
+class TestConvexDecomposition : public ConvexDecomposition
+{
+public:
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces) const override
+  {
+    ++active;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --active;
+    ++computed;
+
+    if (vertices.front().x() < 0)
+      throw std::runtime_error("Test decomposition failure");
+
+    return { std::make_shared<tesseract_geometry::ConvexMesh>(
+        std::make_shared<const tesseract_common::VectorVector3d>(vertices),
+        std::make_shared<const Eigen::VectorXi>(faces)) };
+  }
+
+  /** @brief The number of decompositions running */
+  mutable std::atomic<int> active{ 0 };
+
+  /** @brief The number of finished decompositions */
+  mutable std::atomic<int> computed{ 0 };
+};
+
+/** @brief Create a tetrahedron translated along the x axis */
+tesseract_geometry::PolygonMesh::Ptr createTetrahedron(double x)
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(x, 0, 0);
+  vertices->emplace_back(x + 1, 0, 0);
+  vertices->emplace_back(x, 1, 0);
+  vertices->emplace_back(x, 0, 1);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(16);
+  (*faces) << 3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3;
+  return std::make_shared<tesseract_geometry::PolygonMesh>(vertices, faces);
+}
+
+TEST(TesseractConvexDecompositionUnit, ComputeBatchUnit)  // NOLINT
+{
+  TestConvexDecomposition decomposition;
+  auto executor = std::make_shared<tesseract_common::ThreadPoolExecutor>(4);
+
+  EXPECT_TRUE(decomposition.computeBatch({}, 0, executor).empty());
+
+  // The results are in the order of the meshes
+  std::vector<std::shared_ptr<const tesseract_geometry::PolygonMesh>> meshes;
+  for (int i = 0; i < 10; ++i)
+    meshes.push_back(createTetrahedron(i));
+
+  std::vector<std::vector<tesseract_geometry::ConvexMesh::Ptr>> results =
+      decomposition.computeBatch(meshes, 0, executor);
+  ASSERT_EQ(results.size(), meshes.size());
+  for (std::size_t i = 0; i < meshes.size(); ++i)
+  {
+    ASSERT_EQ(results[i].size(), 1U);
+    EXPECT_TRUE(*results[i].front()->getVertices() == *meshes[i]->getVertices());
+  }
+
+  // A nullptr mesh is rejected before any mesh is decomposed
+  decomposition.computed = 0;
+  meshes.push_back(nullptr);
+  EXPECT_THROW(decomposition.computeBatch(meshes, 0, executor), std::runtime_error);  // NOLINT
+  EXPECT_EQ(decomposition.computed, 0);
+}
+
+TEST(TesseractConvexDecompositionUnit, ComputeBatchExceptionUnit)  // NOLINT
+{
+  TestConvexDecomposition decomposition;
+  auto executor = std::make_shared<tesseract_common::ThreadPoolExecutor>(4);
+
+  std::vector<std::shared_ptr<const tesseract_geometry::PolygonMesh>> meshes;
+  for (int i = 0; i < 20; ++i)
+    meshes.push_back(createTetrahedron(i == 2 ? -1 : i));
+
+  // The exception is rethrown once the running decompositions are finished and the remaining meshes are skipped
+  EXPECT_THROW(decomposition.computeBatch(meshes, 4, executor), std::runtime_error);  // NOLINT
+  EXPECT_EQ(decomposition.active, 0);
+  EXPECT_LT(decomposition.computed, static_cast<int>(meshes.size()));
+}
+
+TEST(TesseractConvexDecompositionUnit, ComputeAsyncUnit)  // NOLINT
+{
+  TestConvexDecomposition decomposition;
+  auto executor = std::make_shared<tesseract_common::ThreadPoolExecutor>(2);
+  tesseract_geometry::PolygonMesh::Ptr mesh = createTetrahedron(1);
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> expected =
+      decomposition.compute(*mesh->getVertices(), *mesh->getFaces());
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> results =
+      decomposition.computeAsync(*mesh->getVertices(), *mesh->getFaces(), executor).get();
+  ASSERT_EQ(results.size(), expected.size());
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_TRUE(*results[i]->getVertices() == *expected[i]->getVertices());
+    EXPECT_TRUE(*results[i]->getFaces() == *expected[i]->getFaces());
+  }
+
+  // The exception of the decomposition is stored in the future
+  mesh = createTetrahedron(-1);
+  auto future = decomposition.computeAsync(*mesh->getVertices(), *mesh->getFaces(), executor);
+  EXPECT_THROW(future.get(), std::runtime_error);  // NOLINT
+}
+
+#ifdef TESSERACT_BUILD_VHACD
+TEST(TesseractConvexDecompositionUnit, VHACDCacheKeyUnit)  // NOLINT
+{
+  tesseract_geometry::PolygonMesh::Ptr mesh = createTetrahedron(0);
+  const std::string key = ConvexDecompositionVHACD().getCacheKey(*mesh->getVertices(), *mesh->getFaces());
+  EXPECT_EQ(key, ConvexDecompositionVHACD().getCacheKey(*mesh->getVertices(), *mesh->getFaces()));
+
+  tesseract_geometry::PolygonMesh::Ptr other_mesh = createTetrahedron(1);
+  EXPECT_NE(key, ConvexDecompositionVHACD().getCacheKey(*other_mesh->getVertices(), *other_mesh->getFaces()));
+
+  // Every parameter changes the key
+  std::vector<std::function<void(VHACDParameters&)>> changes{
+    [](VHACDParameters& p) { p.concavity *= 2; },
+    [](VHACDParameters& p) { p.alpha *= 2; },
+    [](VHACDParameters& p) { p.beta *= 2; },
+    [](VHACDParameters& p) { p.min_volume_per_ch *= 2; },
+    [](VHACDParameters& p) { p.resolution *= 2; },
+    [](VHACDParameters& p) { p.max_num_vertices_per_ch *= 2; },
+    [](VHACDParameters& p) { p.plane_downsampling *= 2; },
+    [](VHACDParameters& p) { p.convexhull_downsampling *= 2; },
+    [](VHACDParameters& p) { p.pca = 1 - p.pca; },
+    [](VHACDParameters& p) { p.mode = 1 - p.mode; },
+    [](VHACDParameters& p) { p.convexhull_approximation = 1 - p.convexhull_approximation; },
+    [](VHACDParameters& p) { p.ocl_acceleration = 1 - p.ocl_acceleration; },
+    [](VHACDParameters& p) { p.max_convehulls *= 2; },
+    [](VHACDParameters& p) { p.project_hull_vertices = !p.project_hull_vertices; },
+  };
+
+  for (std::size_t i = 0; i < changes.size(); ++i)
+  {
+    VHACDParameters params;
+    changes[i](params);
+    EXPECT_NE(key, ConvexDecompositionVHACD(params).getCacheKey(*mesh->getVertices(), *mesh->getFaces())) << i;
+  }
+}
+
+TEST(TesseractConvexDecompositionUnit, VHACDCacheUnit)  // NOLINT
+{
+  tesseract_geometry::MeshCache& cache = tesseract_geometry::MeshCache::getInstance();
+  const std::string directory = cache.getDirectory();
+  const tesseract_common::fs::path cache_dir =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path("tesseract_vhacd_%%%%-%%%%");
+  cache.setDirectory(cache_dir.string());
+
+  ConvexDecompositionVHACD decomposition;
+  tesseract_geometry::PolygonMesh::Ptr mesh = createTetrahedron(0);
+  const std::string key = decomposition.getCacheKey(*mesh->getVertices(), *mesh->getFaces());
+
+  std::vector<tesseract_geometry::MeshCacheData> cached;
+  EXPECT_FALSE(cache.load(key, cached));
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> results =
+      decomposition.compute(*mesh->getVertices(), *mesh->getFaces());
+  ASSERT_FALSE(results.empty());
+  EXPECT_TRUE(cache.load(key, cached));
+  EXPECT_EQ(cached.size(), results.size());
+
+  // Replace the entry so the second decomposition can only return it if it is read from the cache
+  tesseract_geometry::PolygonMesh::Ptr other_mesh = createTetrahedron(5);
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> entry{ std::make_shared<tesseract_geometry::ConvexMesh>(
+      other_mesh->getVertices(), other_mesh->getFaces()) };
+  EXPECT_TRUE(cache.store(key, tesseract_geometry::MeshCache::getData(entry)));
+
+  results = decomposition.compute(*mesh->getVertices(), *mesh->getFaces());
+  ASSERT_EQ(results.size(), 1U);
+  EXPECT_TRUE(*results.front()->getVertices() == *other_mesh->getVertices());
+
+  cache.clear();
+  cache.setDirectory(directory);
+  tesseract_common::fs::remove_all(cache_dir);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -66,6 +66,15 @@ public:
   std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                            const Eigen::VectorXi& faces) const override;
 
+  /**
+   * @brief Get the key of the mesh cache entry the decomposition of a mesh is stored under
+   * @param vertices The vertices
+   * @param faces A vector of triangle indicies. Every face starts with the number of vertices followed the the vertice
+   * index
+   * @return The key, it changes with every parameter of the decomposition
+   */
+  std::string getCacheKey(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const;
+
 private:
   VHACDParameters params_;
 };
@@ -1,16 +1,68 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <tesseract_collision/vhacd/VHACD.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/convex_hull_utils.h>
 #include <tesseract_collision/vhacd/convex_decomposition_vhacd.h>
+#include <tesseract_geometry/mesh_cache.h>
 
 namespace tesseract_collision
 {
+namespace
+{
+/** @brief Convert the vertices and triangle faces of a mesh to the arrays passed to V-HACD */
+void getVHACDArrays(std::vector<double>& points,
+                    std::vector<unsigned int>& triangles,
+                    const tesseract_common::VectorVector3d& vertices,
+                    const Eigen::VectorXi& faces)
+{
+  points.reserve(vertices.size() * 3);
+  for (const auto& v : vertices)
+  {
+    points.push_back(v.x());
+    points.push_back(v.y());
+    points.push_back(v.z());
+  }
+
+  triangles.reserve(static_cast<std::size_t>(faces.size()) / 4);
+  for (Eigen::Index i = 0; i < faces.rows();)
+  {
+    int face_vertice_cnt = faces(i++);
+    if (face_vertice_cnt != 3)
+      throw std::runtime_error("Currently only supports triangle meshes");
+
+    triangles.push_back(static_cast<unsigned int>(faces(i++)));
+    triangles.push_back(static_cast<unsigned int>(faces(i++)));
+    triangles.push_back(static_cast<unsigned int>(faces(i++)));
+  }
+}
+
+/** @brief Get the mesh cache key of the decomposition of the V-HACD arrays with the parameters */
+std::string getVHACDCacheKey(const std::vector<double>& points,
+                             const std::vector<unsigned int>& triangles,
+                             const VHACDParameters& params)
+{
+  std::vector<uint8_t> data(points.size() * sizeof(double) + triangles.size() * sizeof(unsigned int));
+  std::memcpy(data.data(), points.data(), points.size() * sizeof(double));
+  std::memcpy(
+      data.data() + (points.size() * sizeof(double)), triangles.data(), triangles.size() * sizeof(unsigned int));
+
+  std::stringstream options;
+  options << std::setprecision(17) << "vhacd " << params.concavity << " " << params.alpha << " " << params.beta << " "
+          << params.min_volume_per_ch << " " << params.resolution << " " << params.max_num_vertices_per_ch << " "
+          << params.plane_downsampling << " " << params.convexhull_downsampling << " " << params.pca << " "
+          << params.mode << " " << params.convexhull_approximation << " " << params.ocl_acceleration << " "
+          << params.max_convehulls << " " << params.project_hull_vertices;
+  return tesseract_geometry::MeshCache::getKey(data, options.str());
+}
+}  // namespace
+
 class ProgressCallback : public VHACD::IVHACD::IUserCallback
 {
 public:
@@ -42,25 +94,19 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
   params_.print();
 
   std::vector<double> points_local;
-  points_local.reserve(vertices.size() * 3);
-  for (const auto& v : vertices)
-  {
-    points_local.push_back(v.x());
-    points_local.push_back(v.y());
-    points_local.push_back(v.z());
-  }
-
   std::vector<unsigned int> triangles_local;
-  triangles_local.reserve(static_cast<std::size_t>(faces.size()) / 4);
-  for (Eigen::Index i = 0; i < faces.rows();)
-  {
-    int face_vertice_cnt = faces(i++);
-    if (face_vertice_cnt != 3)
-      throw std::runtime_error("Currently only supports triangle meshes");
+  getVHACDArrays(points_local, triangles_local, vertices, faces);
 
-    triangles_local.push_back(static_cast<unsigned int>(faces(i++)));
-    triangles_local.push_back(static_cast<unsigned int>(faces(i++)));
-    triangles_local.push_back(static_cast<unsigned int>(faces(i++)));
+  // Reuse a previous decomposition of the same mesh with the same parameters
+  tesseract_geometry::MeshCache& cache = tesseract_geometry::MeshCache::getInstance();
+  std::string key;
+  if (cache.isEnabled())
+  {
+    key = getVHACDCacheKey(points_local, triangles_local, params_);
+    std::vector<tesseract_geometry::MeshCacheData> cached;
+    if (cache.load(key, cached))
+      return tesseract_geometry::MeshCache::createMeshes<tesseract_geometry::ConvexMesh>(
+          cached, nullptr, Eigen::Vector3d::Ones());
   }
 
   // run V-HACD
@@ -121,9 +167,21 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
   interfaceVHACD->Clean();
   interfaceVHACD->Release();
 
+  if (!key.empty() && !output.empty())
+    cache.store(key, tesseract_geometry::MeshCache::getData(output));
+
   return output;
 }
 
+std::string ConvexDecompositionVHACD::getCacheKey(const tesseract_common::VectorVector3d& vertices,
+                                                  const Eigen::VectorXi& faces) const
+{
+  std::vector<double> points_local;
+  std::vector<unsigned int> triangles_local;
+  getVHACDArrays(points_local, triangles_local, vertices, faces);
+  return getVHACDCacheKey(points_local, triangles_local, params_);
+}
+
 void VHACDParameters::print() const
 {
   std::stringstream msg;
@@ -193,19 +193,31 @@ macro(tesseract_cpack)
   include(CPack)
 endmacro()
 
+# The precision of Bullet is fixed when Bullet is built, so TESSERACT_BULLET_SINGLE_PRECISION selects which Bullet
+# installation is used and the contact managers are built with the same btScalar
 macro(find_bullet)
-  find_package(
-    Bullet
-    REQUIRED
-    CONFIGS
-    BulletConfig-float64.cmake
-    BulletConfig.cmake)
-  if(NOT
-     ${BULLET_DEFINITIONS}
-     MATCHES
-     ".*-DBT_USE_DOUBLE_PRECISION.*")
-    message(
-      WARNING "Bullet does not appear to be build with double precision, current definitions: ${BULLET_DEFINITIONS}")
+  if(TESSERACT_BULLET_SINGLE_PRECISION)
+    find_package(Bullet REQUIRED CONFIGS BulletConfig.cmake)
+    if("${BULLET_DEFINITIONS}"
+       MATCHES
+       ".*-DBT_USE_DOUBLE_PRECISION.*")
+      message(FATAL_ERROR "TESSERACT_BULLET_SINGLE_PRECISION is enabled but Bullet is built with double precision, "
+                          "current definitions: ${BULLET_DEFINITIONS}")
+    endif()
+  else()
+    find_package(
+      Bullet
+      REQUIRED
+      CONFIGS
+      BulletConfig-float64.cmake
+      BulletConfig.cmake)
+    if(NOT
+       "${BULLET_DEFINITIONS}"
+       MATCHES
+       ".*-DBT_USE_DOUBLE_PRECISION.*")
+      message(
+        WARNING "Bullet does not appear to be build with double precision, current definitions: ${BULLET_DEFINITIONS}")
+    endif()
   endif()
 
   # Some Bullet installations (vcpkg) use absolute paths instead of relative to BULLET_ROOT_DIR in the CMake vars
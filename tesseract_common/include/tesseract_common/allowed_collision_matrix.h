@@ -9,6 +9,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <Eigen/Eigen>
 #include <unordered_map>
+#include <tesseract_common/name_id.h>
 #include <tesseract_common/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -50,6 +51,31 @@ public:
     lookup_table_[link_pair] = reason;
   }
 
+  /**
+   * @brief Disable collision between many pairs of collision objects
+   * @details This is faster than adding the pairs one at a time because the entries are moved and the table is only
+   * grown once. Existing pairs are replaced.
+   * @param entries The allowed collision pairs ordered with makeOrderedLinkPair and their reasons
+   */
+  void addAllowedCollisions(AllowedCollisionEntries entries)
+  {
+    if (lookup_table_.empty())
+    {
+      lookup_table_ = std::move(entries);
+      return;
+    }
+
+    lookup_table_.reserve(lookup_table_.size() + entries.size());
+    for (auto& entry : entries)
+      lookup_table_[entry.first] = std::move(entry.second);
+  }
+
+  /**
+   * @brief Reserve space for allowed collision pairs
+   * @param size The number of allowed collision pairs
+   */
+  void reserveAllowedCollisions(std::size_t size) { lookup_table_.reserve(size); }
+
   /**
    * @brief Get all of the entries in the allowed collision matrix
    * @return AllowedCollisionEntries an unordered map containing all allowed
@@ -132,6 +158,102 @@ private:
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
 
+/**
+ * @brief An immutable form of the allowed collision matrix for fast queries
+ * @details Each link in the allowed collision matrix is assigned an index and the allowed pairs are stored as a dense
+ * bit matrix, so checking a pair of indices is a single bit lookup. Checking a pair of link names finds each name once
+ * without constructing and hashing a pair of strings. It does not track changes to the allowed collision matrix it was
+ * built from, so it must be rebuilt when it changes.
+ */
+class CompiledAllowedCollisionMatrix
+{
+public:
+  using Ptr = std::shared_ptr<CompiledAllowedCollisionMatrix>;
+  using ConstPtr = std::shared_ptr<const CompiledAllowedCollisionMatrix>;
+
+  CompiledAllowedCollisionMatrix() = default;
+  explicit CompiledAllowedCollisionMatrix(const AllowedCollisionMatrix& acm);
+
+  /**
+   * @brief Get the index of a link
+   * @param link_name The link name
+   * @return The index of the link, -1 if the link is not in any allowed pair
+   */
+  int getLinkIndex(const std::string& link_name) const
+  {
+    auto it = link_indices_.find(link_name);
+    return (it != link_indices_.end()) ? it->second : -1;
+  }
+
+  /**
+   * @brief Get the index of a link
+   * @details This is an array lookup by the id of the name, it does not hash the link name
+   * @param link_name The link name
+   * @return The index of the link, -1 if the link is not in any allowed pair
+   */
+  int getLinkIndex(const NameId& link_name) const
+  {
+    const uint32_t id = link_name.getId();
+    return (id < name_id_indices_.size()) ? name_id_indices_[id] : -1;
+  }
+
+  /** @brief Get the link names indexed by link index */
+  const std::vector<std::string>& getLinkNames() const { return link_names_; }
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_index1 First link index, see getLinkIndex
+   * @param link_index2 Second link index, see getLinkIndex
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(int link_index1, int link_index2) const
+  {
+    if (link_index1 < 0 || link_index2 < 0)
+      return false;
+
+    return allowed_[(static_cast<std::size_t>(link_index1) * link_names_.size()) +
+                    static_cast<std::size_t>(link_index2)];
+  }
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(const std::string& link_name1, const std::string& link_name2) const
+  {
+    return isCollisionAllowed(getLinkIndex(link_name1), getLinkIndex(link_name2));
+  }
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(const NameId& link_name1, const NameId& link_name2) const
+  {
+    return isCollisionAllowed(getLinkIndex(link_name1), getLinkIndex(link_name2));
+  }
+
+  bool operator==(const CompiledAllowedCollisionMatrix& rhs) const;
+  bool operator!=(const CompiledAllowedCollisionMatrix& rhs) const;
+
+private:
+  /** @brief The link names indexed by link index */
+  std::vector<std::string> link_names_;
+
+  /** @brief The link index of each link name */
+  std::unordered_map<std::string, int> link_indices_;
+
+  /** @brief The link index indexed by the id of the interned link name, -1 for other names */
+  std::vector<int> name_id_indices_;
+
+  /** @brief The symmetric matrix of allowed pairs stored row major */
+  std::vector<bool> allowed_;
+};
+
 }  // namespace tesseract_common
 
 #include <boost/serialization/export.hpp>
@@ -92,6 +92,7 @@ struct AnyInstance : tesseract_common::TypeErasureInstance<T, tesseract_common::
   using BaseType = tesseract_common::TypeErasureInstance<T, tesseract_common::TypeErasureInterface>;
   AnyInstance() = default;
   AnyInstance(const T& x) : BaseType(x) {}
+  AnyInstance(T&& x) : BaseType(std::move(x)) {}
   AnyInstance(AnyInstance&& x) noexcept : BaseType(std::move(x)) {}
 
   BOOST_CONCEPT_ASSERT((AnyConcept<T>));
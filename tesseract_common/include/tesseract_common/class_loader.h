@@ -30,6 +30,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -45,6 +46,8 @@ namespace tesseract_common
  * used for looding Example: TESSERACT_ADD_PLUGIN(my_namespace::MyPlugin, plugin)
  *
  *   auto p = ClassLoader::createSharedInstance<my_namespace::MyPluginBase>("my_plugin", "plugin");
+ *
+ * Loaded libraries and created instances are cached process wide, keyed by the library and the symbol name.
  */
 struct ClassLoader
 {
@@ -109,14 +112,95 @@ struct ClassLoader
    * @return The library name or path with prefix and suffix
    */
   static inline std::string decorate(const std::string& library_name, const std::string& library_directory = "");
+
+  /**
+   * @brief Unload the cached libraries and plugin instances
+   * @details Libraries are loaded once per process and the instance of a symbol is created once per library, so
+   * constructing many plugin factories does not repeat the library search and load. Instances that are still in use
+   * keep their library loaded.
+   */
+  static inline void clearCache();
+};
+
+/**
+ * @brief A registry of the plugins linked into the program
+ * @details When TESSERACT_STATIC_PLUGINS is defined, TESSERACT_ADD_PLUGIN registers each plugin here so the plugin
+ * loader finds it without searching the file system or loading a library. This is enabled when the libraries are
+ * built static (BUILD_SHARED_LIBS=OFF) or with the TESSERACT_STATIC_PLUGINS CMake option.
+ *
+ * A static library member is only linked if it is referenced, so the program must reference the plugin anchor of each
+ * plugin library, see TESSERACT_PLUGIN_ANCHOR_DECL, or link the plugin libraries as whole archives.
+ */
+struct StaticPluginRegistry
+{
+  /**
+   * @brief Add a plugin to the registry, replacing a plugin with the same symbol name
+   * @param section The section of the plugin
+   * @param symbol_name The symbol name of the plugin
+   * @param plugin The plugin object, which must outlive its registration
+   */
+  static inline void add(const std::string& section, const std::string& symbol_name, void* plugin);
+
+  /**
+   * @brief Remove a plugin from the registry
+   * @param symbol_name The symbol name of the plugin
+   */
+  static inline void remove(const std::string& symbol_name);
+
+  /**
+   * @brief Get a plugin from the registry
+   * @param symbol_name The symbol name of the plugin
+   * @return The plugin object, nullptr if it is not registered
+   */
+  static inline void* get(const std::string& symbol_name);
+
+  /**
+   * @brief Get the symbol names of the registered plugins under the provided section
+   * @param section The section
+   * @return A list of symbol names
+   */
+  static inline std::vector<std::string> getSymbols(const std::string& section);
+
+  /**
+   * @brief Get the sections of the registered plugins
+   * @return A list of sections
+   */
+  static inline std::vector<std::string> getSections();
+};
+
+/** @brief Registers a plugin in the StaticPluginRegistry for the lifetime of this object */
+class StaticPluginRegistrar
+{
+public:
+  StaticPluginRegistrar(const std::string& section, std::string symbol_name, void* plugin)
+    : symbol_name_(std::move(symbol_name))
+  {
+    StaticPluginRegistry::add(section, symbol_name_, plugin);
+  }
+  ~StaticPluginRegistrar() { StaticPluginRegistry::remove(symbol_name_); }
+  StaticPluginRegistrar(const StaticPluginRegistrar&) = delete;
+  StaticPluginRegistrar& operator=(const StaticPluginRegistrar&) = delete;
+  StaticPluginRegistrar(StaticPluginRegistrar&&) = delete;
+  StaticPluginRegistrar& operator=(StaticPluginRegistrar&&) = delete;
+
+private:
+  std::string symbol_name_;
 };
 }  // namespace tesseract_common
 
 // clang-format off
+#ifdef TESSERACT_STATIC_PLUGINS
+#define TESSERACT_ADD_PLUGIN_SECTIONED(DERIVED_CLASS, ALIAS, SECTION)                                                  \
+  extern "C" BOOST_SYMBOL_EXPORT DERIVED_CLASS ALIAS;                                                                  \
+  BOOST_DLL_SECTION(SECTION, read) BOOST_DLL_SELECTANY                                                                 \
+  DERIVED_CLASS ALIAS;                                                                                                 \
+  static const tesseract_common::StaticPluginRegistrar ALIAS##_static_plugin_registrar(#SECTION, #ALIAS, &ALIAS);
+#else
 #define TESSERACT_ADD_PLUGIN_SECTIONED(DERIVED_CLASS, ALIAS, SECTION)                                                  \
   extern "C" BOOST_SYMBOL_EXPORT DERIVED_CLASS ALIAS;                                                                  \
   BOOST_DLL_SECTION(SECTION, read) BOOST_DLL_SELECTANY                                                                 \
   DERIVED_CLASS ALIAS;
+#endif
 
 #define TESSERACT_ADD_PLUGIN(DERIVED_CLASS, ALIAS)                                                                     \
   TESSERACT_ADD_PLUGIN_SECTIONED(DERIVED_CLASS, ALIAS, boostdll)
@@ -28,6 +28,13 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <typeindex>
 #include <boost/config.hpp>
 #include <boost/dll/import.hpp>
 #include <boost/dll/alias.hpp>
@@ -41,42 +48,102 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_common
 {
-template <class ClassBase>
-std::shared_ptr<ClassBase> ClassLoader::createSharedInstance(const std::string& symbol_name,
-                                                             const std::string& library_name,
-                                                             const std::string& library_directory)
+/** @brief The libraries loaded and the instances created by the class loader, shared by the whole process */
+struct ClassLoaderCache
 {
-  boost::system::error_code ec;
-  boost::dll::shared_library lib;
+  /** @brief The decorated library path, the symbol name and the base class of an instance */
+  using InstanceKey = std::tuple<std::string, std::string, std::type_index>;
+
+  std::mutex mutex;
+  std::map<std::string, std::shared_ptr<const boost::dll::shared_library>> libraries;
+  std::map<InstanceKey, std::shared_ptr<void>> instances;
+
+  static ClassLoaderCache& getInstance()
+  {
+    // Intentionally never destroyed so plugins are not unloaded before static objects still using them
+    static auto* cache = new ClassLoaderCache();
+    return *cache;
+  }
+};
+
+/**
+ * @brief Load a library or get it from the cache if it was already loaded
+ * @param library_name The library name to load which does not include the prefix 'lib' or suffix '.so'
+ * @param library_directory The library directory, if empty it will enable search system directories
+ * @param ec The error if the library failed to load
+ * @return The library, nullptr if it failed to load
+ */
+inline std::shared_ptr<const boost::dll::shared_library> loadSharedLibrary(const std::string& library_name,
+                                                                           const std::string& library_directory,
+                                                                           boost::system::error_code& ec)
+{
+  ClassLoaderCache& cache = ClassLoaderCache::getInstance();
+  const std::string key = ClassLoader::decorate(library_name, library_directory);
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.libraries.find(key);
+    if (it != cache.libraries.end())
+      return it->second;
+  }
+
+  auto lib = std::make_shared<boost::dll::shared_library>();
   if (library_directory.empty())
   {
     boost::filesystem::path sl(library_name);
     boost::dll::load_mode::type mode =
         boost::dll::load_mode::append_decorations | boost::dll::load_mode::search_system_folders;
-    lib = boost::dll::shared_library(sl, ec, mode);
+    lib->load(sl, ec, mode);
   }
   else
   {
     boost::filesystem::path sl = boost::filesystem::path(library_directory) / library_name;
-    lib = boost::dll::shared_library(sl, ec, boost::dll::load_mode::append_decorations);
+    lib->load(sl, ec, boost::dll::load_mode::append_decorations);
   }
 
+  // Failures are not cached, the library may be installed later
+  if (ec)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.libraries.emplace(key, lib).first->second;
+}
+
+template <class ClassBase>
+std::shared_ptr<ClassBase> ClassLoader::createSharedInstance(const std::string& symbol_name,
+                                                             const std::string& library_name,
+                                                             const std::string& library_directory)
+{
+  boost::system::error_code ec;
+  std::shared_ptr<const boost::dll::shared_library> lib = loadSharedLibrary(library_name, library_directory, ec);
+
   // Check if it failed to find or load library
   if (ec)
     throw std::runtime_error("Failed to find or load library: " + decorate(library_name, library_directory) +
                              " with error: " + ec.message());
 
   // Check if library has symbol
-  if (!lib.has(symbol_name))
+  if (!lib->has(symbol_name))
     throw std::runtime_error("Failed to find symbol '" + symbol_name +
                              "' in library: " + decorate(library_name, library_directory));
 
+  ClassLoaderCache& cache = ClassLoaderCache::getInstance();
+  ClassLoaderCache::InstanceKey key{ decorate(library_name, library_directory), symbol_name, typeid(ClassBase) };
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.instances.find(key);
+    if (it != cache.instances.end())
+      return std::static_pointer_cast<ClassBase>(it->second);
+  }
+
 #if BOOST_VERSION >= 107600
-  boost::shared_ptr<ClassBase> plugin = boost::dll::import_symbol<ClassBase>(lib, symbol_name);
+  boost::shared_ptr<ClassBase> plugin = boost::dll::import_symbol<ClassBase>(*lib, symbol_name);
 #else
-  boost::shared_ptr<ClassBase> plugin = boost::dll::import<ClassBase>(lib, symbol_name);
+  boost::shared_ptr<ClassBase> plugin = boost::dll::import<ClassBase>(*lib, symbol_name);
 #endif
-  return std::shared_ptr<ClassBase>(plugin.get(), [plugin](ClassBase*) mutable { plugin.reset(); });
+  auto instance = std::shared_ptr<ClassBase>(plugin.get(), [plugin](ClassBase*) mutable { plugin.reset(); });
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return std::static_pointer_cast<ClassBase>(cache.instances.emplace(std::move(key), instance).first->second);
 }
 
 bool ClassLoader::isClassAvailable(const std::string& symbol_name,
@@ -84,19 +151,7 @@ bool ClassLoader::isClassAvailable(const std::string& symbol_name,
                                    const std::string& library_directory)
 {
   boost::system::error_code ec;
-  boost::dll::shared_library lib;
-  if (library_directory.empty())
-  {
-    boost::filesystem::path sl(library_name);
-    boost::dll::load_mode::type mode =
-        boost::dll::load_mode::append_decorations | boost::dll::load_mode::search_system_folders;
-    lib = boost::dll::shared_library(sl, ec, mode);
-  }
-  else
-  {
-    boost::filesystem::path sl = boost::filesystem::path(library_directory) / library_name;
-    lib = boost::dll::shared_library(sl, ec, boost::dll::load_mode::append_decorations);
-  }
+  std::shared_ptr<const boost::dll::shared_library> lib = loadSharedLibrary(library_name, library_directory, ec);
 
   // Check if it failed to find or load library
   if (ec)
@@ -107,7 +162,7 @@ bool ClassLoader::isClassAvailable(const std::string& symbol_name,
     return false;
   }
 
-  return lib.has(symbol_name);
+  return lib->has(symbol_name);
 }
 
 std::vector<std::string> ClassLoader::getAvailableSymbols(const std::string& section,
@@ -115,19 +170,7 @@ std::vector<std::string> ClassLoader::getAvailableSymbols(const std::string& sec
                                                           const std::string& library_directory)
 {
   boost::system::error_code ec;
-  boost::dll::shared_library lib;
-  if (library_directory.empty())
-  {
-    boost::filesystem::path sl(library_name);
-    boost::dll::load_mode::type mode =
-        boost::dll::load_mode::append_decorations | boost::dll::load_mode::search_system_folders;
-    lib = boost::dll::shared_library(sl, ec, mode);
-  }
-  else
-  {
-    boost::filesystem::path sl = boost::filesystem::path(library_directory) / library_name;
-    lib = boost::dll::shared_library(sl, ec, boost::dll::load_mode::append_decorations);
-  }
+  std::shared_ptr<const boost::dll::shared_library> lib = loadSharedLibrary(library_name, library_directory, ec);
 
   // Check if it failed to find or load library
   if (ec)
@@ -139,7 +182,7 @@ std::vector<std::string> ClassLoader::getAvailableSymbols(const std::string& sec
   }
 
   // Class `library_info` can extract information from a library
-  boost::dll::library_info inf(lib.location());
+  boost::dll::library_info inf(lib->location());
 
   // Getting symbols exported from he provided section
   return inf.symbols(section);
@@ -150,19 +193,7 @@ std::vector<std::string> ClassLoader::getAvailableSections(const std::string& li
                                                            bool include_hidden)
 {
   boost::system::error_code ec;
-  boost::dll::shared_library lib;
-  if (library_directory.empty())
-  {
-    boost::filesystem::path sl(library_name);
-    boost::dll::load_mode::type mode =
-        boost::dll::load_mode::append_decorations | boost::dll::load_mode::search_system_folders;
-    lib = boost::dll::shared_library(sl, ec, mode);
-  }
-  else
-  {
-    boost::filesystem::path sl = boost::filesystem::path(library_directory) / library_name;
-    lib = boost::dll::shared_library(sl, ec, boost::dll::load_mode::append_decorations);
-  }
+  std::shared_ptr<const boost::dll::shared_library> lib = loadSharedLibrary(library_name, library_directory, ec);
 
   // Check if it failed to find or load library
   if (ec)
@@ -174,7 +205,7 @@ std::vector<std::string> ClassLoader::getAvailableSections(const std::string& li
   }
 
   // Class `library_info` can extract information from a library
-  boost::dll::library_info inf(lib.location());
+  boost::dll::library_info inf(lib->location());
 
   // Getting section from library
   std::vector<std::string> sections = inf.sections();
@@ -211,6 +242,75 @@ std::string ClassLoader::decorate(const std::string& library_name, const std::st
   return actual_path.string();
 }
 
+/** @brief The plugins registered in the StaticPluginRegistry */
+struct StaticPluginRegistryData
+{
+  std::mutex mutex;
+  /** @brief The section and the plugin object, by symbol name */
+  std::map<std::string, std::pair<std::string, void*>> plugins;
+
+  static StaticPluginRegistryData& getInstance()
+  {
+    // Intentionally never destroyed so plugins registered by static objects can unregister in any order
+    static auto* data = new StaticPluginRegistryData();
+    return *data;
+  }
+};
+
+void StaticPluginRegistry::add(const std::string& section, const std::string& symbol_name, void* plugin)
+{
+  StaticPluginRegistryData& data = StaticPluginRegistryData::getInstance();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.plugins[symbol_name] = std::make_pair(section, plugin);
+}
+
+void StaticPluginRegistry::remove(const std::string& symbol_name)
+{
+  StaticPluginRegistryData& data = StaticPluginRegistryData::getInstance();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.plugins.erase(symbol_name);
+}
+
+void* StaticPluginRegistry::get(const std::string& symbol_name)
+{
+  StaticPluginRegistryData& data = StaticPluginRegistryData::getInstance();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  auto it = data.plugins.find(symbol_name);
+  return (it != data.plugins.end()) ? it->second.second : nullptr;
+}
+
+std::vector<std::string> StaticPluginRegistry::getSymbols(const std::string& section)
+{
+  StaticPluginRegistryData& data = StaticPluginRegistryData::getInstance();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  std::vector<std::string> symbols;
+  for (const auto& plugin : data.plugins)
+  {
+    if (plugin.second.first == section)
+      symbols.push_back(plugin.first);
+  }
+  return symbols;
+}
+
+std::vector<std::string> StaticPluginRegistry::getSections()
+{
+  StaticPluginRegistryData& data = StaticPluginRegistryData::getInstance();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  std::set<std::string> sections;
+  for (const auto& plugin : data.plugins)
+    sections.insert(plugin.second.first);
+
+  return { sections.begin(), sections.end() };
+}
+
+void ClassLoader::clearCache()
+{
+  ClassLoaderCache& cache = ClassLoaderCache::getInstance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.instances.clear();
+  cache.libraries.clear();
+}
+
 }  // namespace tesseract_common
 
 #endif  // TESSERACT_COMMON_CLASS_LOADER_HPP
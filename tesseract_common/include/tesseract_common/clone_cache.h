@@ -29,6 +29,8 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <algorithm>
@@ -36,6 +38,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/executor.h>
+#include <tesseract_common/metrics.h>
 #include <tesseract_common/sfinae_utils.h>
 
 namespace tesseract_common
@@ -46,6 +50,16 @@ namespace tesseract_common
  * CacheType::Ptr clone() const;
  * int getRevision() const;
  * bool update(Const CacheType::ConstPtr&);  // optional
+ *
+ * The cached objects are spread over shards, each with its own mutex. A thread takes objects from the shard it is
+ * assigned first and only looks at the other shards if it is empty, so threads rarely wait on each other. A cached
+ * object whose revision differs from the original is brought up to date with update() if available, otherwise it is
+ * cloned again.
+ *
+ * Objects taken with clone() belong to the caller. Objects taken with checkout() are returned to the cache once the
+ * last reference to them is released, so they are reused instead of cloned again. When background replenishment is
+ * enabled the cache is refilled by an executor instead of the caller cloning when the cache runs dry, which bounds the
+ * latency of getting an object under contention. The original must then be safe to clone from another thread.
  * */
 template <typename CacheType>
 class CloneCache
@@ -57,9 +71,7 @@ public:
 
   CloneCache(std::shared_ptr<CacheType> original, const long& cache_size = 5)
     : supports_update(has_member_func_signature_update<CacheType>::value)
-    , original_(std::move(original))
-    , cache_size_(static_cast<std::size_t>(cache_size))
-
+    , state_(std::make_shared<State>(std::move(original), static_cast<std::size_t>(cache_size)))
   {
     // These methods are required
     static_assert(has_member_func_signature_getRevision<CacheType>::value,
@@ -70,65 +82,80 @@ public:
       createClone();
   }
 
-  const std::shared_ptr<CacheType>& operator->() { return original_; }
+  ~CloneCache()
+  {
+    // Release the executor here, a refill task may hold the last reference to the state and must not destroy it
+    setBackgroundReplenishment(false);
+  }
+  CloneCache(const CloneCache&) = delete;
+  CloneCache& operator=(const CloneCache&) = delete;
+  CloneCache(CloneCache&&) = delete;
+  CloneCache& operator=(CloneCache&&) = delete;
+
+  const std::shared_ptr<CacheType>& operator->() { return state_->original; }
 
   /**
    * @brief Gets a clone of original_
    * @return A shared_ptr to a new clone of original_
    */
-  std::shared_ptr<CacheType> clone()
+  std::shared_ptr<CacheType> clone() { return state_->take(); }
+
+  /**
+   * @brief Gets a clone of original_ which is returned to the cache once it is no longer used
+   * @details The object is returned as it was left by the caller, so it must be left in a state in which it can be
+   * reused. It is discarded instead if the cache is full or was destroyed.
+   * @return A shared_ptr to a clone of original_, nullptr if cloning failed
+   */
+  std::shared_ptr<CacheType> checkout()
   {
-    if (!original_)
+    std::shared_ptr<CacheType> object = state_->take();
+    if (object == nullptr)
       return nullptr;
 
-    if (cache_.empty())
-    {
-      std::shared_ptr<CacheType> cache = getClone();
-      if (cache == nullptr)
-        return nullptr;
+    CacheType* raw = object.get();
+    std::weak_ptr<State> weak_state = state_;
+    return std::shared_ptr<CacheType>(raw, [weak_state, object = std::move(object)](CacheType* /*raw*/) mutable {
+      if (auto state = weak_state.lock())
+        state->giveBack(std::move(object));
+      else
+        object.reset();
+    });
+  }
 
-      return cache;
-    }
+  /**
+   * @brief Enable or disable refilling the cache on an executor
+   * @details When enabled, taking an object from the cache queues a task refilling it to the cache size. The task is
+   * skipped if a refill is already queued.
+   * @param enabled Indicates if the cache is refilled in the background
+   * @param executor The executor refilling the cache, nullptr uses the default executor
+   */
+  void setBackgroundReplenishment(bool enabled, Executor::Ptr executor = nullptr)
+  {
+    if (!enabled)
+      executor = nullptr;
+    else if (executor == nullptr)
+      executor = getDefaultExecutor();
 
-    // If the cache needs updating, then update it
-    std::unique_lock<std::mutex> lock(cache_mutex_);
-    if (cache_.back()->getRevision() != original_->getRevision())
     {
-      // Update if possible
-      std::shared_ptr<CacheType> t;
-      if constexpr (has_member_func_signature_update<CacheType>::value)
-      {
-        cache_.back()->update(original_);
-      }
-      else
-      {
-        std::shared_ptr<CacheType> cache = getClone();
-        if (cache == nullptr)
-          return nullptr;
-
-        cache_.back() = cache;
-      }
-      t = cache_.back();
-      cache_.pop_back();
-      return t;
+      std::unique_lock<std::mutex> lock(state_->executor_mutex);
+      std::swap(state_->executor, executor);
+      state_->background = enabled;
     }
 
-    std::shared_ptr<CacheType> t;
-    t = cache_.back();
-    cache_.pop_back();
-    return t;
+    // The previous executor is released outside of the lock since destroying it may wait for queued tasks
+    executor = nullptr;
   }
 
+  /** @brief Check if the cache is refilled in the background */
+  bool getBackgroundReplenishment() const { return state_->background; }
+
   /**
    * @brief Set the cache size
    * @param size The size of the cache.
    */
   void setCacheSize(long size)
   {
-    {
-      std::unique_lock<std::mutex> lock(cache_mutex_);
-      cache_size_ = static_cast<std::size_t>(size);
-    }
+    state_->cache_size = static_cast<std::size_t>(size);
     updateCache();
   }
 
@@ -136,101 +163,262 @@ public:
    * @brief Get the set cache size
    * @return The set size of the cache.
    */
-  long getCacheSize() const { return static_cast<long>(cache_size_); }
+  long getCacheSize() const { return static_cast<long>(state_->cache_size.load()); }
 
   /**
    * @brief Get the current size of the cache
    * @return The current size fo the cache
    */
-  long getCurrentCacheSize() const
-  {
-    std::unique_lock<std::mutex> lock(cache_mutex_);
-    return static_cast<long>(cache_.size());
-  }
+  long getCurrentCacheSize() const { return static_cast<long>(state_->size.load()); }
 
   /** @brief If original_ has changed it will update or rebuild the cache of objects */
   void updateCache()
   {
-    std::unique_lock<std::mutex> lock(cache_mutex_);
-    if (!original_)
+    if (!state_->original)
       return;
 
-    std::shared_ptr<CacheType> t;
-
     // Update all cached objects
-    for (auto& cache : cache_)
+    for (auto& shard : state_->shards)
     {
-      if (cache->getRevision() != original_->getRevision())
-      {
-        // Update if possible
-        if constexpr (has_member_func_signature_update<CacheType>::value)
-        {
-          cache->update(original_);
-        }
-        else
-        {  // Update is not available to assign new clone
-          cache = getClone();
-        }
-      }
-    }
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      for (auto& cache : shard.objects)
+        cache = state_->refresh(std::move(cache));
 
-    // Prune nullptr
-    cache_.erase(std::remove_if(cache_.begin(),
-                                cache_.end(),
-                                [](const std::shared_ptr<CacheType>& cache) { return (cache == nullptr); }),
-                 cache_.end());
+      // Prune nullptr
+      const std::size_t before = shard.objects.size();
+      shard.objects.erase(std::remove_if(shard.objects.begin(),
+                                         shard.objects.end(),
+                                         [](const std::shared_ptr<CacheType>& cache) { return (cache == nullptr); }),
+                          shard.objects.end());
+      state_->size -= (before - shard.objects.size());
+    }
 
-    while (cache_.size() < cache_size_)
+    while (state_->size < state_->cache_size)
     {
-      CONSOLE_BRIDGE_logDebug("Adding clone to the cache. Current cache size: %i", cache_.size());
-      std::shared_ptr<CacheType> clone = getClone();
-      if (clone != nullptr)
-        cache_.push_back(clone);
+      CONSOLE_BRIDGE_logDebug("Adding clone to the cache. Current cache size: %i",
+                              static_cast<int>(state_->size.load()));
+      std::shared_ptr<CacheType> clone = state_->getClone();
+      if (clone == nullptr)
+        break;
+
+      state_->push(std::move(clone));
     }
   }
 
   const bool supports_update;
 
 protected:
-  void createClone()
-  {
-    if (original_ == nullptr)
-      return;
+  /** @brief The number of shards the cached objects are spread over */
+  static constexpr std::size_t SHARD_COUNT = 8;
 
-    std::shared_ptr<CacheType> clone = getClone();
-    if (clone == nullptr)
-      return;
+  /** @brief The process wide count of clones taken from a cache without cloning or updating */
+  static MetricCounter& getHitMetric()
+  {
+    static MetricCounter& hits = MetricsRegistry::getInstance().getCounter(
+        "tesseract_clone_cache_hits_total", "The number of clones taken from a cache without cloning or updating");
+    return hits;
+  }
 
-    // Lock cache
-    std::unique_lock<std::mutex> lock(cache_mutex_);
-    cache_.push_back(clone);
+  /** @brief The process wide count of clones which were cloned or updated because the cache was empty or stale */
+  static MetricCounter& getMissMetric()
+  {
+    static MetricCounter& misses = MetricsRegistry::getInstance().getCounter(
+        "tesseract_clone_cache_misses_total", "The number of clones which were cloned or updated when requested");
+    return misses;
   }
 
-  std::shared_ptr<CacheType> getClone() const
+  struct alignas(64) Shard
   {
-    std::shared_ptr<CacheType> clone;
-    try
+    std::mutex mutex;
+    std::deque<std::shared_ptr<CacheType>> objects;
+  };
+
+  /** @brief The state shared with the checked out objects and the background tasks, which may outlive the cache */
+  struct State : public std::enable_shared_from_this<State>
+  {
+    State(std::shared_ptr<CacheType> original, std::size_t cache_size)
+      : original(std::move(original)), cache_size(cache_size)
+    {
+    }
+
+    std::shared_ptr<CacheType> original;
+
+    /** @brief The assigned cache size */
+    std::atomic<std::size_t> cache_size;
+
+    /** @brief The number of cached objects over all shards */
+    std::atomic<std::size_t> size{ 0 };
+
+    std::array<Shard, SHARD_COUNT> shards;
+
+    /** @brief Indicates if the cache is refilled by the executor */
+    std::atomic<bool> background{ false };
+
+    /** @brief Indicates if a refill task is queued or running */
+    std::atomic<bool> replenishing{ false };
+
+    Executor::Ptr executor;
+    std::mutex executor_mutex;
+
+    /** @brief The shard of the calling thread */
+    static std::size_t getShard() { return getMetricShard() % SHARD_COUNT; }
+
+    std::shared_ptr<CacheType> getClone() const
+    {
+      std::shared_ptr<CacheType> clone;
+      try
+      {
+        clone = original->clone();
+      }
+      catch (std::exception& e)
+      {
+        CONSOLE_BRIDGE_logError("Clone Cache failed to update cache with the following exception: %s", e.what());
+        return nullptr;
+      }
+      return clone;
+    }
+
+    /** @brief Bring a cached object up to date with the original, nullptr if it could not be */
+    std::shared_ptr<CacheType> refresh(std::shared_ptr<CacheType> cache) const
+    {
+      if (cache == nullptr || cache->getRevision() == original->getRevision())
+        return cache;
+
+      // Update if possible
+      if constexpr (has_member_func_signature_update<CacheType>::value)
+      {
+        if (cache->update(original))
+          return cache;
+      }
+
+      // Update is not available or failed so assign a new clone
+      return getClone();
+    }
+
+    void push(std::shared_ptr<CacheType> object)
     {
-      clone = original_->clone();
+      Shard& shard = shards[getShard()];
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      shard.objects.push_back(std::move(object));
+      ++size;
     }
-    catch (std::exception& e)
+
+    /** @brief Take an object, the shard of the calling thread first, then any shard which is not locked, then any */
+    std::shared_ptr<CacheType> pop()
     {
-      CONSOLE_BRIDGE_logError("Clone Cache failed to update cache with the following exception: %s", e.what());
+      const std::size_t start = getShard();
+      for (int pass = 0; pass < 2 && size > 0; ++pass)
+      {
+        for (std::size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+          Shard& shard = shards[(start + i) % SHARD_COUNT];
+          std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+          if (pass == 0 && i > 0)
+          {
+            if (!lock.try_lock())
+              continue;
+          }
+          else
+          {
+            lock.lock();
+          }
+
+          if (shard.objects.empty())
+            continue;
+
+          std::shared_ptr<CacheType> object = std::move(shard.objects.back());
+          shard.objects.pop_back();
+          --size;
+          return object;
+        }
+      }
+
       return nullptr;
     }
-    return clone;
-  }
 
-  std::shared_ptr<CacheType> original_;
+    std::shared_ptr<CacheType> take()
+    {
+      if (!original)
+        return nullptr;
+
+      std::shared_ptr<CacheType> object = pop();
+      if (object == nullptr)
+      {
+        getMissMetric().increment();
+        object = getClone();
+      }
+      else if (object->getRevision() != original->getRevision())
+      {
+        getMissMetric().increment();
+        object = refresh(std::move(object));
+      }
+      else
+      {
+        getHitMetric().increment();
+      }
+
+      replenish();
+      return object;
+    }
+
+    void giveBack(std::shared_ptr<CacheType> object)
+    {
+      if (size < cache_size)
+        push(std::move(object));
+    }
+
+    /** @brief Queue a task refilling the cache if background replenishment is enabled */
+    void replenish()
+    {
+      if (!background || size >= cache_size || replenishing.exchange(true))
+        return;
+
+      Executor::Ptr refill_executor;
+      {
+        std::unique_lock<std::mutex> lock(executor_mutex);
+        refill_executor = executor;
+      }
 
-  /** @brief The assigned cache size */
-  std::size_t cache_size_{ 5 };
+      if (refill_executor == nullptr)
+      {
+        replenishing = false;
+        return;
+      }
 
-  /** @brief A vector of cached objects */
-  std::deque<std::shared_ptr<CacheType>> cache_;
+      std::weak_ptr<State> weak_state = this->shared_from_this();
+      refill_executor->submit([weak_state]() {
+        if (auto state = weak_state.lock())
+          state->refill();
+      });
+    }
+
+    void refill()
+    {
+      while (size < cache_size)
+      {
+        std::shared_ptr<CacheType> clone = getClone();
+        if (clone == nullptr)
+          break;
+
+        push(std::move(clone));
+      }
+      replenishing = false;
+    }
+  };
+
+  void createClone()
+  {
+    if (state_->original == nullptr)
+      return;
+
+    std::shared_ptr<CacheType> clone = state_->getClone();
+    if (clone == nullptr)
+      return;
+
+    state_->push(std::move(clone));
+  }
 
-  /** @brief The mutex used when reading and writing to cache_ */
-  mutable std::mutex cache_mutex_;
+  std::shared_ptr<State> state_;
 };
 
 }  // namespace tesseract_common
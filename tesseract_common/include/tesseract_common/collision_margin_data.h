@@ -31,11 +31,15 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <algorithm>
 #include <Eigen/Core>
+#include <limits>
 #include <string>
 #include <unordered_map>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/name_id.h>
 #include <tesseract_common/types.h>
 #include <tesseract_common/utils.h>
 
@@ -87,12 +91,14 @@ public:
     : default_collision_margin_(default_collision_margin), lookup_table_(std::move(pair_collision_margins))
   {
     updateMaxCollisionMargin();
+    updatePairMarginTable();
   }
 
   CollisionMarginData(PairsCollisionMarginData pair_collision_margins)
     : lookup_table_(std::move(pair_collision_margins))
   {
     updateMaxCollisionMargin();
+    updatePairMarginTable();
   }
 
   /**
@@ -103,6 +109,7 @@ public:
   {
     default_collision_margin_ = default_collision_margin;
     updateMaxCollisionMargin();
+    updatePairMarginTable();
   }
 
   /**
@@ -126,12 +133,15 @@ public:
     auto key = tesseract_common::makeOrderedLinkPair(obj1, obj2);
     lookup_table_[key] = collision_margin;
     updateMaxCollisionMargin();
+    updatePairMarginTable();
   }
 
   /**
    * @brief Get the pairs collision margin data
    *
    * If a collision margin for the request pair does not exist it returns the default collision margin data.
+   * This is called for every pair checked by the contact managers, so it uses the pair margin table indexed by object
+   * instead of constructing and hashing the pair of names.
    *
    * @param obj1 The first object name
    * @param obj2 The second object name
@@ -139,13 +149,43 @@ public:
    */
   double getPairCollisionMargin(const std::string& obj1, const std::string& obj2) const
   {
-    auto key = tesseract_common::makeOrderedLinkPair(obj1, obj2);
-    const auto it = lookup_table_.find(key);
+    if (pair_margin_indices_.empty())
+      return default_collision_margin_;
+
+    const auto it1 = pair_margin_indices_.find(obj1);
+    if (it1 == pair_margin_indices_.end())
+      return default_collision_margin_;
 
-    if (it != lookup_table_.end())
-      return it->second;
+    const auto it2 = pair_margin_indices_.find(obj2);
+    if (it2 == pair_margin_indices_.end())
+      return default_collision_margin_;
 
-    return default_collision_margin_;
+    return pair_margin_table_[(it1->second * pair_margin_indices_.size()) + it2->second];
+  }
+
+  /**
+   * @brief Get the pairs collision margin data
+   *
+   * If a collision margin for the request pair does not exist it returns the default collision margin data.
+   * The objects are found by the ids of their interned names, so no string is hashed.
+   *
+   * @param obj1 The first object name
+   * @param obj2 The second object name
+   * @return A Vector2d[Contact Distance Threshold, Coefficient]
+   */
+  double getPairCollisionMargin(const NameId& obj1, const NameId& obj2) const
+  {
+    const uint32_t id1 = obj1.getId();
+    const uint32_t id2 = obj2.getId();
+    if (id1 >= name_id_indices_.size() || id2 >= name_id_indices_.size())
+      return default_collision_margin_;
+
+    const std::size_t i = name_id_indices_[id1];
+    const std::size_t j = name_id_indices_[id2];
+    if (i == NO_PAIR_MARGIN_INDEX || j == NO_PAIR_MARGIN_INDEX)
+      return default_collision_margin_;
+
+    return pair_margin_table_[(i * pair_margin_indices_.size()) + j];
   }
 
   /**
@@ -163,6 +203,30 @@ public:
    */
   double getMaxCollisionMargin() const { return max_collision_margin_; }
 
+  /**
+   * @brief Get the largest collision margin of the pairs which include an object
+   *
+   * This bounds the margin of every pair the object is part of, so it is used to inflate the bounding box of the object
+   * in the broadphase instead of the largest collision margin of all pairs.
+   *
+   * @param obj The object name
+   * @return Max contact distance threshold of the pairs which include the object
+   */
+  double getMaxCollisionMargin(const std::string& obj) const
+  {
+    const auto it = pair_margin_indices_.find(obj);
+    if (it == pair_margin_indices_.end())
+      return default_collision_margin_;
+
+    // The row of the object stores the default collision margin for the pairs without a pair margin
+    const std::size_t n = pair_margin_indices_.size();
+    double max_margin = default_collision_margin_;
+    for (std::size_t j = 0; j < n; ++j)
+      max_margin = std::max(max_margin, pair_margin_table_[(it->second * n) + j]);
+
+    return max_margin;
+  }
+
   /**
    * @brief Increment all margins by input amount. Useful for inflating or reducing margins
    * @param increment Amount to increment margins
@@ -173,6 +237,9 @@ public:
     max_collision_margin_ += increment;
     for (auto& pair : lookup_table_)
       pair.second += increment;
+
+    for (auto& margin : pair_margin_table_)
+      margin += increment;
   }
 
   /**
@@ -185,6 +252,9 @@ public:
     max_collision_margin_ *= scale;
     for (auto& pair : lookup_table_)
       pair.second *= scale;
+
+    for (auto& margin : pair_margin_table_)
+      margin *= scale;
   }
 
   /**
@@ -209,18 +279,21 @@ public:
           lookup_table_[p.first] = p.second;
 
         updateMaxCollisionMargin();
+        updatePairMarginTable();
         break;
       }
       case CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN:
       {
         default_collision_margin_ = collision_margin_data.default_collision_margin_;
         updateMaxCollisionMargin();
+        updatePairMarginTable();
         break;
       }
       case CollisionMarginOverrideType::OVERRIDE_PAIR_MARGIN:
       {
         lookup_table_ = collision_margin_data.lookup_table_;
         updateMaxCollisionMargin();
+        updatePairMarginTable();
         break;
       }
       case CollisionMarginOverrideType::MODIFY_PAIR_MARGIN:
@@ -229,6 +302,7 @@ public:
           lookup_table_[p.first] = p.second;
 
         updateMaxCollisionMargin();
+        updatePairMarginTable();
         break;
       }
       case CollisionMarginOverrideType::NONE:
@@ -251,6 +325,25 @@ private:
   /** @brief A map of link pair names to contact distance */
   PairsCollisionMarginData lookup_table_;
 
+  /** @brief The index in the pair margin table of each object with a pair margin */
+  std::unordered_map<std::string, std::size_t> pair_margin_indices_;
+
+  /** @brief The marker in the name id indices of objects without a pair margin */
+  static constexpr std::size_t NO_PAIR_MARGIN_INDEX = std::numeric_limits<std::size_t>::max();
+
+  /** @brief The index in the pair margin table indexed by the id of the interned object name */
+  std::vector<std::size_t> name_id_indices_;
+
+  /**
+   * @brief The symmetric table of the margins between the objects with a pair margin stored row major
+   * @details Pairs without a pair margin store the default collision margin. This is derived from the other members and
+   * rebuilt whenever the pair margins or the default margin change.
+   */
+  std::vector<double> pair_margin_table_;
+
+  /** @brief Rebuild the pair margin table from the lookup table */
+  void updatePairMarginTable();
+
   /** @brief Update the max collision margin */
   void updateMaxCollisionMargin()
   {
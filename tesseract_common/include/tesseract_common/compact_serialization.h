@@ -0,0 +1,133 @@
+/**
+ * @file compact_serialization.h
+ * @brief Compact encoding of large arrays stored in binary archives
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_COMPACT_SERIALIZATION_H
+#define TESSERACT_COMMON_COMPACT_SERIALIZATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/serialization/binary_object.hpp>
+#include <boost/serialization/nvp.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/**
+ * @brief Compress bytes with zlib
+ * @param data The bytes
+ * @param size The number of bytes
+ * @return The compressed bytes
+ */
+std::vector<uint8_t> compressBytes(const uint8_t* data, std::size_t size);
+
+/**
+ * @brief Decompress bytes compressed with compressBytes
+ * @details Throws std::runtime_error if the bytes are corrupt or do not decompress to the expected size
+ * @param data The compressed bytes
+ * @param size The number of bytes before compression
+ * @return The bytes
+ */
+std::vector<uint8_t> decompressBytes(const std::vector<uint8_t>& data, std::size_t size);
+
+/**
+ * @brief Encode integers as the zigzag varint of the difference to the previous integer
+ * @details Indices of neighboring faces are close to each other, so most of them take a single byte
+ * @param data The integers
+ * @param size The number of integers
+ * @return The encoded bytes
+ */
+std::vector<uint8_t> encodeDeltaIntegers(const int* data, std::size_t size);
+
+/**
+ * @brief Decode integers encoded with encodeDeltaIntegers
+ * @details Throws std::runtime_error if the bytes do not hold exactly size integers
+ * @param encoded The encoded bytes
+ * @param data The integers
+ * @param size The number of integers
+ */
+void decodeDeltaIntegers(const std::vector<uint8_t>& encoded, int* data, std::size_t size);
+
+/**
+ * @brief Losslessly encode doubles so they compress well
+ * @details Each double is xored with the double stride entries before it, so coordinates of nearby points share their
+ * leading bits, then byte k of every double is stored together. The sign, exponent and leading mantissa bytes become
+ * long runs of zeros.
+ * @param data The doubles
+ * @param size The number of doubles
+ * @param stride The distance to the previous value of the same kind, for example 3 for an array of points
+ * @return The encoded bytes
+ */
+std::vector<uint8_t> encodeDoubles(const double* data, std::size_t size, std::size_t stride);
+
+/**
+ * @brief Decode doubles encoded with encodeDoubles
+ * @details Throws std::runtime_error if the number of bytes does not match
+ * @param encoded The encoded bytes
+ * @param data The doubles
+ * @param size The number of doubles
+ * @param stride The stride used to encode the doubles
+ */
+void decodeDoubles(const std::vector<uint8_t>& encoded, double* data, std::size_t size, std::size_t stride);
+
+/**
+ * @brief Compress bytes and save them to an archive
+ * @param ar The archive
+ * @param data The bytes
+ */
+template <class Archive>
+void saveCompressed(Archive& ar, const std::vector<uint8_t>& data)
+{
+  std::size_t size = data.size();
+  std::vector<uint8_t> compressed = compressBytes(data.data(), data.size());
+  std::size_t compressed_size = compressed.size();
+  ar& BOOST_SERIALIZATION_NVP(size);
+  ar& BOOST_SERIALIZATION_NVP(compressed_size);
+  ar& boost::serialization::make_nvp("compressed", boost::serialization::make_binary_object(compressed.data(),
+                                                                                            compressed_size));
+}
+
+/**
+ * @brief Load bytes saved with saveCompressed from an archive
+ * @param ar The archive
+ * @return The bytes
+ */
+template <class Archive>
+std::vector<uint8_t> loadCompressed(Archive& ar)
+{
+  std::size_t size{ 0 };
+  std::size_t compressed_size{ 0 };
+  ar& BOOST_SERIALIZATION_NVP(size);
+  ar& BOOST_SERIALIZATION_NVP(compressed_size);
+  std::vector<uint8_t> compressed(compressed_size);
+  ar& boost::serialization::make_nvp("compressed", boost::serialization::make_binary_object(compressed.data(),
+                                                                                            compressed_size));
+  return decompressBytes(compressed, size);
+}
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_COMPACT_SERIALIZATION_H
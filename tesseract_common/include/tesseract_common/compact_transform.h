@@ -0,0 +1,149 @@
+/**
+ * @file compact_transform.h
+ * @brief A rigid transform stored as a rotation matrix and translation
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_COMPACT_TRANSFORM_H
+#define TESSERACT_COMMON_COMPACT_TRANSFORM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_common
+{
+/**
+ * @brief A rigid transform stored as a 3x3 rotation matrix and a translation
+ * @details An Eigen::Isometry3d stores the full 4x4 matrix, 128 bytes of which the last row is always [0 0 0 1]. This
+ * stores the 96 bytes that are used and has no alignment requirement, so it can be kept in a plain std::vector. Hot
+ * loops composing chains of transforms, like forward kinematics, use it internally and convert to Eigen::Isometry3d
+ * at the API boundary.
+ */
+struct CompactTransform
+{
+  /** @brief The rotation */
+  Eigen::Matrix3d linear{ Eigen::Matrix3d::Identity() };
+
+  /** @brief The translation */
+  Eigen::Vector3d translation{ Eigen::Vector3d::Zero() };
+
+  /** @brief The identity transform */
+  CompactTransform() = default;
+  CompactTransform(const Eigen::Matrix3d& linear, const Eigen::Vector3d& translation)
+    : linear(linear), translation(translation)
+  {
+  }
+  explicit CompactTransform(const Eigen::Isometry3d& transform)
+    : linear(transform.linear()), translation(transform.translation())
+  {
+  }
+
+  /** @brief Convert to an Eigen::Isometry3d */
+  Eigen::Isometry3d toIsometry() const
+  {
+    Eigen::Isometry3d transform;
+    transform.linear() = linear;
+    transform.translation() = translation;
+    transform.makeAffine();
+    return transform;
+  }
+
+  /** @brief Compose with another transform, this * rhs */
+  CompactTransform operator*(const CompactTransform& rhs) const
+  {
+    return { linear * rhs.linear, (linear * rhs.translation) + translation };
+  }
+
+  /** @brief Transform a point */
+  Eigen::Vector3d operator*(const Eigen::Vector3d& point) const { return (linear * point) + translation; }
+
+  /** @brief The inverse transform */
+  CompactTransform inverse() const
+  {
+    const Eigen::Matrix3d linear_t = linear.transpose();
+    return { linear_t, -(linear_t * translation) };
+  }
+
+  /** @brief Apply a rotation on the right, this = this * rotation */
+  void rotate(const Eigen::Matrix3d& rotation) { linear = linear * rotation; }
+
+  /** @brief Apply a rotation on the right, this = this * rotation */
+  void rotate(const Eigen::AngleAxisd& rotation) { rotate(rotation.toRotationMatrix()); }
+
+  /** @brief Apply a translation on the right, this = this * translation */
+  void translate(const Eigen::Vector3d& offset) { translation += linear * offset; }
+
+  bool isApprox(const CompactTransform& other, double prec = Eigen::NumTraits<double>::dummy_precision()) const
+  {
+    return linear.isApprox(other.linear, prec) && translation.isApprox(other.translation, prec);
+  }
+};
+
+using VectorCompactTransform = std::vector<CompactTransform>;
+
+/**
+ * @brief Compose a transform with each transform of a list, transforms[i] = lhs * rhs[i]
+ * @details Used to compute the world transform of each shape of a link from the link transform
+ * @param transforms The composed transforms, resized to the size of rhs
+ * @param lhs The transform applied on the left
+ * @param rhs The transforms applied on the right
+ */
+void composeTransforms(VectorCompactTransform& transforms,
+                       const CompactTransform& lhs,
+                       const VectorCompactTransform& rhs);
+
+/**
+ * @brief Compose two lists of transforms element wise, transforms[i] = lhs[i] * rhs[i]
+ * @details Throws std::runtime_error if the lists are not the same size
+ * @param transforms The composed transforms, resized to the size of the lists
+ * @param lhs The transforms applied on the left
+ * @param rhs The transforms applied on the right
+ */
+void composeTransforms(VectorCompactTransform& transforms,
+                       const VectorCompactTransform& lhs,
+                       const VectorCompactTransform& rhs);
+
+/**
+ * @brief Transform a set of points
+ * @details The points are transformed as one matrix product, which vectorizes across the points
+ * @param transformed The transformed points, must be the same size as points. It may be the points.
+ * @param transform The transform
+ * @param points The points, one per column
+ */
+void transformPoints(Eigen::Ref<Eigen::Matrix3Xd> transformed,
+                     const CompactTransform& transform,
+                     const Eigen::Ref<const Eigen::Matrix3Xd>& points);
+
+/** @brief Convert a list of transforms */
+VectorCompactTransform toCompactTransforms(const VectorIsometry3d& transforms);
+
+/** @brief Convert a list of transforms */
+VectorIsometry3d toIsometryTransforms(const VectorCompactTransform& transforms);
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_COMPACT_TRANSFORM_H
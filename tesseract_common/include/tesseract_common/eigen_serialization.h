@@ -42,6 +42,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/tracking.hpp>
 #include <boost/serialization/tracking_enum.hpp>
+#include <boost/serialization/version.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace boost::serialization
@@ -141,4 +142,7 @@ BOOST_CLASS_TRACKING(Eigen::VectorXi, boost::serialization::track_never);
 BOOST_CLASS_TRACKING(Eigen::Isometry3d, boost::serialization::track_never);
 BOOST_CLASS_TRACKING(Eigen::MatrixX2d, boost::serialization::track_never);
 
+// Version 1 stores the isometry as its 3x4 matrix in binary archives
+BOOST_CLASS_VERSION(Eigen::Isometry3d, 1)
+
 #endif  // TESSERACT_COMMON_SERIALIZATION_H
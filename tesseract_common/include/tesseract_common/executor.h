@@ -0,0 +1,285 @@
+/**
+ * @file executor.h
+ * @brief Executors running the parallel work of the libraries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_EXECUTOR_H
+#define TESSERACT_COMMON_EXECUTOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/** @brief Thrown by work which stopped early because its CancellationToken was cancelled */
+class CancelledError : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Requests asynchronous work to stop
+ * @details Copies share the same state, the work keeps a copy and checks it between its steps while the caller cancels
+ * its own copy, for example when the result of a query is superseded before it finished. Cancellation is cooperative,
+ * work which already finished or does not check the token is not affected.
+ */
+class CancellationToken
+{
+public:
+  CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+  /** @brief Request the work using this token or one of its copies to stop */
+  void cancel() { cancelled_->store(true, std::memory_order_relaxed); }
+
+  /** @brief Check if the work was requested to stop */
+  bool isCancelled() const { return cancelled_->load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Throw a CancelledError if the work was requested to stop
+   * @param what The message of the exception
+   */
+  void throwIfCancelled(const std::string& what = "The operation was cancelled") const
+  {
+    if (isCancelled())
+      throw CancelledError(what);
+  }
+
+private:
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+/**
+ * @brief Runs tasks concurrently on behalf of the libraries
+ * @details All parallel work of the libraries, like checking trajectories, narrowphase, batches of inverse kinematics,
+ * loading meshes and convex decomposition, is run through an executor instead of creating its own threads. The
+ * application controls all concurrency by providing its executor, either to the functions accepting one or by
+ * replacing the default executor with setDefaultExecutor.
+ *
+ * An implementation only has to queue tasks with submit. The functions of the libraries use parallelFor, which runs
+ * work on the calling thread as well, so it makes progress even when called from a task of the same executor.
+ */
+class Executor
+{
+public:
+  using Ptr = std::shared_ptr<Executor>;
+  using ConstPtr = std::shared_ptr<const Executor>;
+  using UPtr = std::unique_ptr<Executor>;
+  using ConstUPtr = std::unique_ptr<const Executor>;
+
+  Executor() = default;
+  virtual ~Executor() = default;
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+  Executor(Executor&&) = delete;
+  Executor& operator=(Executor&&) = delete;
+
+  /**
+   * @brief Queue a task to run asynchronously
+   * @details Tasks must not throw, an exception escaping a task is logged and dropped
+   * @param task The task
+   */
+  virtual void submit(std::function<void()> task) = 0;
+
+  /** @brief The number of tasks the executor runs at the same time */
+  virtual std::size_t getConcurrency() const = 0;
+
+  /**
+   * @brief Call a function for each index in [0, count) and wait for all calls to finish
+   * @details The calling thread takes part, so the calls are spread over it and up to max_concurrency - 1 tasks. If a
+   * call throws the remaining indices are skipped and the first exception is rethrown. The calls which are already
+   * running finish first.
+   * @param count The number of indices
+   * @param fn The function called with each index
+   * @param max_concurrency The maximum number of calls running at the same time, zero uses the concurrency of the
+   * executor
+   */
+  virtual void parallelFor(std::size_t count,
+                           const std::function<void(std::size_t)>& fn,
+                           std::size_t max_concurrency = 0);
+
+  /**
+   * @brief Run a function asynchronously
+   * @param fn The function
+   * @return The future of the result of the function, it holds the exception if the function throws
+   */
+  template <typename Fn>
+  std::future<std::invoke_result_t<std::decay_t<Fn>>> async(Fn&& fn)
+  {
+    using Result = std::invoke_result_t<std::decay_t<Fn>>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+    std::future<Result> future = task->get_future();
+    submit([task]() { (*task)(); });
+    return future;
+  }
+
+  /**
+   * @brief Run a function asynchronously unless it is cancelled before it starts
+   * @details To stop once it started the function has to check a copy of the token itself
+   * @param fn The function
+   * @param token The token, if it is cancelled before the function starts the future holds a CancelledError
+   * @return The future of the result of the function, it holds the exception if the function throws
+   */
+  template <typename Fn>
+  std::future<std::invoke_result_t<std::decay_t<Fn>>> async(Fn&& fn, CancellationToken token)
+  {
+    return async([fn = std::forward<Fn>(fn), token = std::move(token)]() mutable {
+      token.throwIfCancelled();
+      return fn();
+    });
+  }
+};
+
+/**
+ * @brief A pool of threads where each thread has its own queue of tasks and steals tasks from the other queues when its
+ * own is empty
+ * @details Tasks submitted from a thread of the pool are queued on the queue of that thread, other tasks are spread
+ * over the queues round robin. A thread takes the most recently queued task of its own queue and the oldest task of
+ * the other queues. The destructor waits for the queued tasks to run.
+ */
+class ThreadPoolExecutor : public Executor
+{
+public:
+  using Ptr = std::shared_ptr<ThreadPoolExecutor>;
+  using ConstPtr = std::shared_ptr<const ThreadPoolExecutor>;
+  using UPtr = std::unique_ptr<ThreadPoolExecutor>;
+  using ConstUPtr = std::unique_ptr<const ThreadPoolExecutor>;
+
+  /** @param threads The number of threads, zero uses one per hardware thread */
+  explicit ThreadPoolExecutor(std::size_t threads = 0);
+  ~ThreadPoolExecutor() override;
+  ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+  ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+  ThreadPoolExecutor(ThreadPoolExecutor&&) = delete;
+  ThreadPoolExecutor& operator=(ThreadPoolExecutor&&) = delete;
+
+  void submit(std::function<void()> task) override;
+
+  std::size_t getConcurrency() const override;
+
+private:
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  /** @brief The number of queued tasks, the threads sleep while it is zero */
+  std::atomic<std::size_t> pending_{ 0 };
+
+  /** @brief The queue receiving the next task submitted from outside of the pool */
+  std::atomic<std::size_t> next_queue_{ 0 };
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_{ false };
+
+  void run(std::size_t index);
+  bool pop(std::size_t index, std::function<void()>& task);
+};
+
+/** @brief Runs each task on the calling thread when it is submitted, parallel work becomes sequential */
+class SequentialExecutor : public Executor
+{
+public:
+  using Ptr = std::shared_ptr<SequentialExecutor>;
+  using ConstPtr = std::shared_ptr<const SequentialExecutor>;
+  using UPtr = std::unique_ptr<SequentialExecutor>;
+  using ConstUPtr = std::unique_ptr<const SequentialExecutor>;
+
+  void submit(std::function<void()> task) override;
+
+  std::size_t getConcurrency() const override { return 1; }
+};
+
+/**
+ * @brief Adapts another task system by forwarding the tasks to a function
+ * @details For example with a TBB task arena
+ * @code
+ * tbb::task_arena arena;
+ * FunctionExecutor executor([&arena](std::function<void()> task) { arena.enqueue(std::move(task)); },
+ *                           static_cast<std::size_t>(arena.max_concurrency()));
+ * @endcode
+ * or with a Taskflow executor
+ * @code
+ * tf::Executor tf_executor;
+ * FunctionExecutor executor([&tf_executor](std::function<void()> task) { tf_executor.silent_async(std::move(task)); },
+ *                           tf_executor.num_workers());
+ * @endcode
+ */
+class FunctionExecutor : public Executor
+{
+public:
+  using Ptr = std::shared_ptr<FunctionExecutor>;
+  using ConstPtr = std::shared_ptr<const FunctionExecutor>;
+  using UPtr = std::unique_ptr<FunctionExecutor>;
+  using ConstUPtr = std::unique_ptr<const FunctionExecutor>;
+
+  using SubmitFn = std::function<void(std::function<void()>)>;
+
+  /**
+   * @param submit The function queuing a task on the other task system
+   * @param concurrency The number of tasks the other task system runs at the same time
+   */
+  FunctionExecutor(SubmitFn submit, std::size_t concurrency);
+
+  void submit(std::function<void()> task) override;
+
+  std::size_t getConcurrency() const override { return concurrency_; }
+
+private:
+  SubmitFn submit_;
+  std::size_t concurrency_;
+};
+
+/**
+ * @brief Get the executor used by the libraries when no executor is provided
+ * @details Unless replaced this is a ThreadPoolExecutor with one thread per hardware thread, created on first use
+ */
+Executor::Ptr getDefaultExecutor();
+
+/**
+ * @brief Replace the executor used by the libraries when no executor is provided
+ * @details Work already running on the previous executor is not affected
+ * @param executor The executor, nullptr restores a ThreadPoolExecutor with one thread per hardware thread
+ */
+void setDefaultExecutor(Executor::Ptr executor);
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_EXECUTOR_H
@@ -0,0 +1,94 @@
+/**
+ * @file interpolation.h
+ * @brief Joint space interpolation shared by collision checking and trajectory playback
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_INTERPOLATION_H
+#define TESSERACT_COMMON_INTERPOLATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_common/joint_state.h>
+
+namespace tesseract_common
+{
+/** @brief The polynomial used to interpolate between two joint states */
+enum class InterpolationType
+{
+  /** @brief Only the positions are used */
+  LINEAR,
+  /** @brief The positions and velocities are used, empty velocities are zero */
+  CUBIC,
+  /** @brief The positions, velocities and accelerations are used, empty velocities and accelerations are zero */
+  QUINTIC
+};
+
+/**
+ * @brief Linearly interpolate between two joint positions, the same as Eigen::VectorXd::LinSpaced per joint
+ * @details The states are stored row by row so each state is calculated for all joints at once. The buffer is only
+ * resized if it does not have the requested size, so it can be reused without allocating.
+ * @param states The buffer the states are stored in, the first row is start and the last row is end
+ * @param start The start joint positions
+ * @param end The end joint positions
+ * @param num_states The number of states, must be at least two
+ */
+void interpolateLinear(TrajArray& states,
+                       const Eigen::Ref<const Eigen::VectorXd>& start,
+                       const Eigen::Ref<const Eigen::VectorXd>& end,
+                       long num_states);
+
+/**
+ * @brief Calculate the joint positions of the segment between two joint states
+ * @details The velocities and accelerations are scaled by the time between the two states, so they must be populated
+ * for the cubic and quintic interpolation to differ from a segment that starts and stops at rest.
+ * @param position The joint positions, must have the size of the joint states
+ * @param start The joint state at the start of the segment
+ * @param end The joint state at the end of the segment
+ * @param s The normalized time in the segment, zero is the start and one is the end
+ * @param type The polynomial used to interpolate
+ */
+void interpolateSegment(Eigen::Ref<Eigen::VectorXd> position,
+                        const JointState& start,
+                        const JointState& end,
+                        double s,
+                        InterpolationType type = InterpolationType::LINEAR);
+
+/**
+ * @brief Resample the positions of a joint trajectory at the provided times
+ * @details Times before the first state or after the last state are given the first or last state. The buffer is only
+ * resized if it does not have the requested size, so it can be reused without allocating.
+ * @param positions The buffer the positions are stored in, one row per time
+ * @param trajectory The joint trajectory, the times of its states must be increasing
+ * @param times The times to resample the trajectory at
+ * @param type The polynomial used to interpolate between the states
+ */
+void resampleJointTrajectory(TrajArray& positions,
+                             const JointTrajectory& trajectory,
+                             const Eigen::Ref<const Eigen::VectorXd>& times,
+                             InterpolationType type = InterpolationType::LINEAR);
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_INTERPOLATION_H
@@ -234,4 +234,8 @@ private:
 
 }  // namespace tesseract_common
 
+#include <boost/serialization/version.hpp>
+// Version 1 stores the states as contiguous arrays in binary archives
+BOOST_CLASS_VERSION(tesseract_common::JointTrajectory, 1)
+
 #endif  // TESSERACT_COMMON_JOINT_STATE_H
@@ -146,6 +146,144 @@ void enforcePositionLimits(Eigen::Ref<Eigen::Matrix<FloatType, Eigen::Dynamic, 1
 {
   joint_positions = joint_positions.array().min(position_limits.col(1).array()).max(position_limits.col(0).array());
 }
+
+/**
+ * @brief Check which states are within bounds or relatively equal to a limit
+ * @details This is satisfiesPositionLimits applied to every row, evaluated a joint at a time over all states
+ * @param joint_positions The joint positions to check, each row is a state
+ * @param position_limits The joint limits to perform check
+ * @param max_diff The max diff when comparing position to limit value max(abs(position - limit)) <= max_diff, if true
+ * they are considered equal
+ * @param max_rel_diff The max relative diff between position and limit abs(position - limit) <= largest * max_rel_diff,
+ * if true considered equal. The largest is the largest of the absolute values of position and limit.
+ * @return For each state, true if all positions are within the limits or relatively equal to the limit
+ */
+template <typename FloatType>
+Eigen::Array<bool, Eigen::Dynamic, 1> satisfiesPositionLimitsBatch(
+    const Eigen::Ref<const Eigen::Matrix<FloatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<FloatType, Eigen::Dynamic, 2>>& position_limits,
+    FloatType max_diff = static_cast<FloatType>(1e-6),
+    FloatType max_rel_diff = std::numeric_limits<FloatType>::epsilon())
+{
+  using BoolArray = Eigen::Array<bool, Eigen::Dynamic, 1>;
+  BoolArray result = BoolArray::Constant(joint_positions.rows(), true);
+  for (Eigen::Index j = 0; j < joint_positions.cols(); ++j)
+  {
+    auto p = joint_positions.col(j).array();
+    const FloatType l0 = position_limits(j, 0);
+    const FloatType l1 = position_limits(j, 1);
+
+    auto lower_diff_abs = (p - l0).abs();
+    auto lower_relative_diff = (lower_diff_abs <= max_rel_diff * p.abs().max(std::abs(l0)));
+    auto lower_check = p > l0 || lower_diff_abs <= max_diff || lower_relative_diff;
+
+    auto upper_diff_abs = (p - l1).abs();
+    auto upper_relative_diff = (upper_diff_abs <= max_rel_diff * p.abs().max(std::abs(l1)));
+    auto upper_check = p < l1 || upper_diff_abs <= max_diff || upper_relative_diff;
+
+    result = result && lower_check && upper_check;
+  }
+  return result;
+}
+
+/**
+ * @brief Enforce the positions of every state to be within the provided limits
+ * @param joint_positions The joint positions to enforce bounds on, each row is a state
+ * @param position_limits The limits to perform check
+ */
+template <typename FloatType>
+void enforcePositionLimitsBatch(
+    Eigen::Ref<Eigen::Matrix<FloatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<FloatType, Eigen::Dynamic, 2>>& position_limits)
+{
+  for (Eigen::Index j = 0; j < joint_positions.cols(); ++j)
+    joint_positions.col(j) = joint_positions.col(j).array().min(position_limits(j, 1)).max(position_limits(j, 0));
+}
+
+/** @brief The first and the worst violation of a limit over a trajectory */
+struct TrajectoryLimitViolation
+{
+  /** @brief The index of the first state exceeding the limit, -1 if the limit is satisfied */
+  Eigen::Index first_state{ -1 };
+
+  /** @brief The index of the state with the largest ratio, -1 if the limit was not checked */
+  Eigen::Index worst_state{ -1 };
+
+  /** @brief The index of the joint with the largest ratio, -1 if the limit was not checked */
+  Eigen::Index worst_joint{ -1 };
+
+  /**
+   * @brief The largest ratio of a value to its limit, a ratio above one exceeds the limit
+   * @details For the velocity, acceleration and jerk this is the absolute value divided by the limit. For the
+   * position it is the distance to the middle of the limits divided by half of the range, so the limits are one.
+   */
+  double max_ratio{ 0 };
+};
+
+/** @brief The result of checking a trajectory against kinematic limits, see checkTrajectoryLimits */
+struct TrajectoryLimitsResult
+{
+  /** @brief The position limit violations */
+  TrajectoryLimitViolation position;
+
+  /** @brief The velocity limit violations */
+  TrajectoryLimitViolation velocity;
+
+  /** @brief The acceleration limit violations */
+  TrajectoryLimitViolation acceleration;
+
+  /** @brief The jerk limit violations */
+  TrajectoryLimitViolation jerk;
+
+  /** @brief Get the index of the first state exceeding any limit, -1 if all limits are satisfied */
+  Eigen::Index getFirstViolation() const;
+
+  /** @brief Check if all limits are satisfied */
+  bool satisfied() const;
+};
+
+/**
+ * @brief Check a trajectory against kinematic limits, calculating its derivatives by finite differences
+ * @details The velocity of a state is the difference to the previous state divided by the time between them. The
+ * acceleration and the jerk are the differences of the velocities and accelerations in the same way, so a derivative
+ * of order k is reported at the last of the k + 1 states it is calculated from. Each limit is checked a joint at a time
+ * over all states. Empty velocity, acceleration or jerk limits are not checked, limits which are checked must be
+ * positive.
+ * @param positions The joint positions, each row is a state
+ * @param times The time of each state, must be strictly increasing
+ * @param limits The kinematic limits
+ * @param jerk_limits The jerk limits, empty to not check the jerk
+ * @param tolerance The ratio to a limit above one which is still considered to satisfy the limit
+ * @return The first and worst violation of each limit
+ */
+TrajectoryLimitsResult checkTrajectoryLimits(
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& positions,
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    const KinematicLimits& limits,
+    const Eigen::Ref<const Eigen::VectorXd>& jerk_limits = Eigen::VectorXd(),
+    double tolerance = 1e-6);
+
+/**
+ * @brief Check a trajectory with velocities and accelerations against kinematic limits
+ * @details This is the same as the finite difference version, but the provided velocities and accelerations are checked
+ * at their own states. The jerk is the difference of the accelerations.
+ * @param positions The joint positions, each row is a state
+ * @param velocities The joint velocities, the same size as the positions
+ * @param accelerations The joint accelerations, the same size as the positions
+ * @param times The time of each state, must be strictly increasing
+ * @param limits The kinematic limits
+ * @param jerk_limits The jerk limits, empty to not check the jerk
+ * @param tolerance The ratio to a limit above one which is still considered to satisfy the limit
+ * @return The first and worst violation of each limit
+ */
+TrajectoryLimitsResult checkTrajectoryLimits(
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& positions,
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& velocities,
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& accelerations,
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    const KinematicLimits& limits,
+    const Eigen::Ref<const Eigen::VectorXd>& jerk_limits = Eigen::VectorXd(),
+    double tolerance = 1e-6);
 }  // namespace tesseract_common
 
 #endif  // TESSERACT_COMMON_KINEMATIC_LIMITS_H
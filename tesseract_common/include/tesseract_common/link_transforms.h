@@ -0,0 +1,213 @@
+/**
+ * @file link_transforms.h
+ * @brief A contiguous container of link transforms addressed by index
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_LINK_TRANSFORMS_H
+#define TESSERACT_COMMON_LINK_TRANSFORMS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/name_id.h>
+#include <tesseract_common/types.h>
+
+namespace tesseract_common
+{
+/**
+ * @brief An immutable list of link names, the index of a name is the index of its transform in LinkTransforms
+ * @details A table is built once, for example per environment revision or per joint group, and shared by all the
+ * LinkTransforms using it so copying or storing many states does not copy the names.
+ */
+class LinkNameTable
+{
+public:
+  using Ptr = std::shared_ptr<LinkNameTable>;
+  using ConstPtr = std::shared_ptr<const LinkNameTable>;
+
+  LinkNameTable() = default;
+
+  /**
+   * @brief Create a table of link names
+   * @details Throws std::runtime_error if a name is repeated
+   * @param link_names The link names, their order is kept
+   */
+  explicit LinkNameTable(std::vector<std::string> link_names);
+
+  /** @brief The link names indexed by link index */
+  const std::vector<std::string>& getNames() const { return names_; }
+
+  /** @brief The number of links */
+  std::size_t size() const { return names_.size(); }
+
+  /**
+   * @brief Get the index of a link
+   * @param link_name The link name
+   * @return The index of the link, -1 if the link is not in the table
+   */
+  int getIndex(const std::string& link_name) const
+  {
+    auto it = indices_.find(link_name);
+    return (it != indices_.end()) ? it->second : -1;
+  }
+
+  /**
+   * @brief Get the index of a link
+   * @details This is an array lookup by the id of the name, it does not hash the link name
+   * @param link_name The link name
+   * @return The index of the link, -1 if the link is not in the table
+   */
+  int getIndex(const NameId& link_name) const
+  {
+    const uint32_t id = link_name.getId();
+    return (id < name_id_indices_.size()) ? name_id_indices_[id] : -1;
+  }
+
+  bool operator==(const LinkNameTable& rhs) const { return names_ == rhs.names_; }
+  bool operator!=(const LinkNameTable& rhs) const { return !operator==(rhs); }
+
+private:
+  /** @brief The link names indexed by link index */
+  std::vector<std::string> names_;
+
+  /** @brief The link index of each link name */
+  std::unordered_map<std::string, int> indices_;
+
+  /** @brief The link index indexed by the id of the interned link name, -1 for other names */
+  std::vector<int> name_id_indices_;
+};
+
+/**
+ * @brief The transforms of a set of links stored contiguously and addressed by the index of the link in a shared
+ * LinkNameTable
+ * @details This is a flat alternative to TransformMap for code that sets or reads the transforms of the same links
+ * repeatedly, like forward kinematics inside an optimizer or updating a contact manager for every trajectory state.
+ * Reading by index is an array access and there is one allocation for all the transforms.
+ */
+class LinkTransforms
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  LinkTransforms() = default;
+
+  /**
+   * @brief Create the transforms of the links of a table, initialized to identity
+   * @param name_table The link names
+   */
+  explicit LinkTransforms(LinkNameTable::ConstPtr name_table);
+
+  /**
+   * @brief Create the transforms of the links of a table
+   * @details Throws std::runtime_error if a link of the table is missing from the transform map
+   * @param name_table The link names
+   * @param transforms The transform of each link, links not in the table are ignored
+   */
+  LinkTransforms(LinkNameTable::ConstPtr name_table, const TransformMap& transforms);
+
+  /**
+   * @brief Create the transforms of all links of a transform map, the links are in the order of the map
+   * @param transforms The transform of each link
+   */
+  explicit LinkTransforms(const TransformMap& transforms);
+
+  /** @brief The table of the link names */
+  const LinkNameTable::ConstPtr& getNameTable() const { return name_table_; }
+
+  /** @brief The link names indexed by link index */
+  const std::vector<std::string>& getNames() const;
+
+  /** @brief The transforms indexed by link index */
+  const VectorIsometry3d& getTransforms() const { return transforms_; }
+
+  /** @brief The transforms indexed by link index */
+  VectorIsometry3d& getTransforms() { return transforms_; }
+
+  /** @brief The number of links */
+  std::size_t size() const { return transforms_.size(); }
+
+  /** @brief Check if there are no links */
+  bool empty() const { return transforms_.empty(); }
+
+  /** @brief Get the transform of a link by index */
+  const Eigen::Isometry3d& operator[](std::size_t index) const { return transforms_[index]; }
+
+  /** @brief Get the transform of a link by index */
+  Eigen::Isometry3d& operator[](std::size_t index) { return transforms_[index]; }
+
+  /**
+   * @brief Find the transform of a link
+   * @param link_name The link name
+   * @return The transform, nullptr if the link is not in the table
+   */
+  const Eigen::Isometry3d* find(const std::string& link_name) const;
+  Eigen::Isometry3d* find(const std::string& link_name);
+
+  /**
+   * @brief Find the transform of a link
+   * @param link_name The link name
+   * @return The transform, nullptr if the link is not in the table
+   */
+  const Eigen::Isometry3d* find(const NameId& link_name) const;
+  Eigen::Isometry3d* find(const NameId& link_name);
+
+  /**
+   * @brief Get the transform of a link
+   * @details Throws std::out_of_range if the link is not in the table
+   * @param link_name The link name
+   * @return The transform
+   */
+  const Eigen::Isometry3d& at(const std::string& link_name) const;
+  Eigen::Isometry3d& at(const std::string& link_name);
+
+  /**
+   * @brief Copy the transforms of the links of the table from a transform map
+   * @details Throws std::runtime_error if a link of the table is missing from the transform map
+   * @param transforms The transform of each link, links not in the table are ignored
+   */
+  void assign(const TransformMap& transforms);
+
+  /** @brief Convert to a transform map */
+  TransformMap toTransformMap() const;
+
+  bool operator==(const LinkTransforms& rhs) const;
+  bool operator!=(const LinkTransforms& rhs) const;
+
+private:
+  /** @brief The link names, shared with other link transforms */
+  LinkNameTable::ConstPtr name_table_;
+
+  /** @brief The transforms indexed by link index */
+  VectorIsometry3d transforms_;
+};
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_LINK_TRANSFORMS_H
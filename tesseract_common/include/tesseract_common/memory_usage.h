@@ -0,0 +1,155 @@
+/**
+ * @file memory_usage.h
+ * @brief A report of the memory used by objects, counting shared storage once
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_MEMORY_USAGE_H
+#define TESSERACT_COMMON_MEMORY_USAGE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/**
+ * @brief A node of a report of the memory used by an object, broken down by its parts
+ * @details The bytes of a node exclude the bytes of its children. Storage which is only referenced by the object is
+ * unique, storage which is also referenced by other objects, like a mesh used by the scene graph and the contact
+ * managers or the shapes shared by the clones of a contact manager, is shared. Shared storage is counted once, by the
+ * first node reporting it, see MemoryUsageTracker. The sizes are estimates, they include the arrays and the objects
+ * but not the overhead of the allocator.
+ */
+struct MemoryUsage
+{
+  MemoryUsage() = default;
+  explicit MemoryUsage(std::string name);
+
+  /** @brief The name of the part, for example a link, a geometry type or a cache */
+  std::string name;
+
+  /** @brief The bytes of storage only referenced by this part */
+  std::size_t unique_bytes{ 0 };
+
+  /** @brief The bytes of storage referenced by this part and other objects */
+  std::size_t shared_bytes{ 0 };
+
+  /** @brief The parts of this part */
+  std::vector<MemoryUsage> children;
+
+  /**
+   * @brief Add a part
+   * @param child_name The name of the part
+   * @return The part, it is invalidated by adding the next part
+   */
+  MemoryUsage& addChild(std::string child_name);
+
+  /**
+   * @brief Find a part by name
+   * @param child_name The name of the part
+   * @return The first part with the name, nullptr if not found
+   */
+  const MemoryUsage* getChild(const std::string& child_name) const;
+
+  /** @brief Get the unique bytes of this part and all of its parts */
+  std::size_t getTotalUniqueBytes() const;
+
+  /** @brief Get the shared bytes of this part and all of its parts */
+  std::size_t getTotalSharedBytes() const;
+
+  /** @brief Get the unique and shared bytes of this part and all of its parts */
+  std::size_t getTotalBytes() const;
+
+  /**
+   * @brief Write the report as an indented tree with the totals of each part
+   * @param os The stream
+   * @param max_depth The depth of the deepest parts written, deeper parts are included in the totals
+   */
+  void print(std::ostream& os, std::size_t max_depth = std::numeric_limits<std::size_t>::max()) const;
+
+private:
+  void print(std::ostream& os, std::size_t depth, std::size_t max_depth) const;
+};
+
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage);
+
+/**
+ * @brief Tracks the storage counted while creating memory usage reports
+ * @details Pass the same tracker to the reports of several objects, like an environment and its clones, so the storage
+ * they share is only counted once.
+ */
+class MemoryUsageTracker
+{
+public:
+  /**
+   * @brief Mark an object as counted
+   * @param object The object
+   * @return True if the object was not counted before, otherwise false
+   */
+  bool visit(const void* object);
+
+  /**
+   * @brief Count storage referenced through a shared pointer
+   * @details The storage is unique if the pointer is its only reference, otherwise it is shared. It is only counted the
+   * first time it is reported.
+   * @param usage The part the storage is counted for
+   * @param storage The pointer to the storage
+   * @param bytes The bytes of the storage
+   * @return True if the storage was counted, false if it was counted before or is a nullptr
+   */
+  template <typename T>
+  bool count(MemoryUsage& usage, const std::shared_ptr<T>& storage, std::size_t bytes)
+  {
+    if (storage == nullptr || !visit(storage.get()))
+      return false;
+
+    if (storage.use_count() > 1)
+      usage.shared_bytes += bytes;
+    else
+      usage.unique_bytes += bytes;
+
+    return true;
+  }
+
+  /** @brief Clear the counted objects */
+  void clear();
+
+private:
+  std::unordered_set<const void*> visited_;
+};
+
+/** @brief Get the bytes of the elements of a vector, including its unused capacity */
+template <typename T, typename Allocator>
+std::size_t getVectorBytes(const std::vector<T, Allocator>& vector)
+{
+  return vector.capacity() * sizeof(T);
+}
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_MEMORY_USAGE_H
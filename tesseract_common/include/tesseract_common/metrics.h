@@ -0,0 +1,217 @@
+/**
+ * @file metrics.h
+ * @brief Process wide runtime metrics with Prometheus export
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_METRICS_H
+#define TESSERACT_COMMON_METRICS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/** @brief The labels of a metric as name and value pairs, for example the type of a contact manager */
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/** @brief The number of shards of a metric, threads are spread over the shards so they rarely share a cache line */
+static constexpr std::size_t METRIC_SHARD_COUNT = 16;
+
+/** @brief Get the shard of the calling thread, threads are assigned shards round robin when they first record */
+std::size_t getMetricShard();
+
+/**
+ * @brief A monotonically increasing count, for example of contact manager clones
+ * @details Incrementing is a relaxed atomic add on the shard of the calling thread and never locks
+ */
+class MetricCounter
+{
+public:
+  /** @brief Add to the count */
+  void increment(std::uint64_t value = 1)
+  {
+    shards_[getMetricShard()].value.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /** @brief The count summed over all shards */
+  std::uint64_t getValue() const;
+
+  /** @brief Set the count to zero */
+  void reset();
+
+private:
+  struct alignas(64) Shard
+  {
+    std::atomic<std::uint64_t> value{ 0 };
+  };
+
+  std::array<Shard, METRIC_SHARD_COUNT> shards_;
+};
+
+/**
+ * @brief A histogram of durations with fixed exponential buckets
+ * @details The upper bounds of the buckets double from 1.024 microseconds to about 17 seconds, longer durations are
+ * counted in an overflow bucket. Observing is a few relaxed atomic adds on the shard of the calling thread and never
+ * locks. Quantiles are estimated by interpolating within the bucket containing the rank.
+ */
+class MetricHistogram
+{
+public:
+  /** @brief The number of buckets with a finite upper bound */
+  static constexpr std::size_t BUCKET_COUNT = 25;
+
+  /** @brief The upper bound of the first bucket in nanoseconds, the bound doubles for each following bucket */
+  static constexpr std::uint64_t FIRST_BUCKET_BOUND = 1024;
+
+  /** @brief Get the upper bound of a bucket in seconds */
+  static double getBucketBound(std::size_t bucket);
+
+  /** @brief Record a duration */
+  void observe(std::chrono::nanoseconds duration);
+
+  /** @brief Record a duration in seconds */
+  void observe(double seconds);
+
+  /** @brief The number of recorded durations */
+  std::uint64_t getCount() const;
+
+  /** @brief The sum of the recorded durations in seconds */
+  double getSum() const;
+
+  /** @brief The number of recorded durations in each bucket, the last entry is the overflow bucket */
+  std::vector<std::uint64_t> getBucketCounts() const;
+
+  /**
+   * @brief Estimate a quantile of the recorded durations
+   * @param q The quantile in [0, 1], for example 0.99
+   * @return The estimated duration in seconds, zero if nothing was recorded
+   */
+  double getQuantile(double q) const;
+
+  /** @brief Remove the recorded durations */
+  void reset();
+
+private:
+  struct alignas(64) Shard
+  {
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT + 1> buckets{};
+    std::atomic<std::uint64_t> sum_ns{ 0 };
+  };
+
+  std::array<Shard, METRIC_SHARD_COUNT> shards_;
+};
+
+/** @brief Records the time from its construction to its destruction in a histogram */
+class MetricTimer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit MetricTimer(MetricHistogram& histogram) : histogram_(histogram), start_(Clock::now()) {}
+  ~MetricTimer() { histogram_.observe(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_)); }
+
+  MetricTimer(const MetricTimer&) = delete;
+  MetricTimer& operator=(const MetricTimer&) = delete;
+  MetricTimer(MetricTimer&&) = delete;
+  MetricTimer& operator=(MetricTimer&&) = delete;
+
+private:
+  MetricHistogram& histogram_;
+  Clock::time_point start_;
+};
+
+/**
+ * @brief The process wide registry of metrics
+ * @details The libraries register always on metrics, like contact test latency and clone counts per contact manager,
+ * environment cache and clone cache hits, and inverse kinematics latency and results per solver. Getting a metric
+ * takes a lock, so the instrumented code looks its metrics up once and keeps the reference, which stays valid for the
+ * lifetime of the process. The application can read the metrics directly or export all of them in the Prometheus text
+ * exposition format.
+ */
+class MetricsRegistry
+{
+public:
+  /** @brief Get the registry, it is never destroyed so metrics can be recorded by static objects in any order */
+  static MetricsRegistry& getInstance();
+
+  /**
+   * @brief Get a counter, it is created on first use
+   * @details Throws std::runtime_error if the name is registered as a histogram
+   * @param name The metric name, by convention ending in _total
+   * @param help The description of the metric, the first description registered for a name is kept
+   * @param labels The labels distinguishing this counter from others with the same name
+   * @return The counter, valid for the lifetime of the process
+   */
+  MetricCounter& getCounter(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+  /**
+   * @brief Get a histogram, it is created on first use
+   * @details Throws std::runtime_error if the name is registered as a counter
+   * @param name The metric name, by convention ending in _seconds
+   * @param help The description of the metric, the first description registered for a name is kept
+   * @param labels The labels distinguishing this histogram from others with the same name
+   * @return The histogram, valid for the lifetime of the process
+   */
+  MetricHistogram& getHistogram(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+  /**
+   * @brief Write all metrics in the Prometheus text exposition format
+   * @param os The stream to write to
+   */
+  void writePrometheus(std::ostream& os) const;
+
+  /** @brief Reset the values of all metrics, the metrics stay registered */
+  void reset();
+
+private:
+  MetricsRegistry() = default;
+
+  /** @brief The metrics sharing a name, keyed by their formatted labels */
+  struct Family
+  {
+    std::string help;
+    bool histogram{ false };
+    std::map<std::string, std::unique_ptr<MetricCounter>> counters;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> histograms;
+  };
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Family> families_;
+
+  Family& getFamily(const std::string& name, const std::string& help, bool histogram);
+};
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_METRICS_H
@@ -0,0 +1,128 @@
+/**
+ * @file name_id.h
+ * @brief Interned link and joint names
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_NAME_ID_H
+#define TESSERACT_COMMON_NAME_ID_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/**
+ * @brief An interned name, for example of a link or joint
+ * @details Each distinct name is stored once in a process wide symbol table and assigned a small integer id in the
+ * order the names are first interned. Copying, comparing and hashing a NameId does not touch the string, and the id can
+ * index dense tables. The string hash is computed once when the name is interned.
+ *
+ * Interning takes a lock, so hot code should intern its names up front and keep the NameId. Interned names are never
+ * released, which is fine for the bounded set of link and joint names of a process.
+ */
+class NameId
+{
+public:
+  /** @brief The empty name, its id is zero */
+  NameId();
+
+  /**
+   * @brief Intern a name
+   * @param name The name
+   */
+  explicit NameId(const std::string& name);
+
+  /**
+   * @brief Intern a name
+   * @param name The name
+   */
+  explicit NameId(const char* name);
+
+  /** @brief The id of the name, ids are assigned in the order names are interned starting from zero */
+  uint32_t getId() const { return entry_->id; }
+
+  /** @brief The name, the reference is valid for the lifetime of the process */
+  const std::string& getName() const { return entry_->name; }
+
+  /** @brief The std::hash of the name, computed when it was interned */
+  std::size_t getHash() const { return entry_->hash; }
+
+  /** @brief Check if this is the empty name */
+  bool empty() const { return entry_->id == 0; }
+
+  /**
+   * @brief Get a name if it was interned, without interning it
+   * @param name The name
+   * @param id The interned name
+   * @return True if the name was interned
+   */
+  static bool find(const std::string& name, NameId& id);
+
+  /** @brief The number of interned names, an upper bound of the ids for sizing dense tables */
+  static std::size_t size();
+
+  bool operator==(const NameId& rhs) const { return entry_ == rhs.entry_; }
+  bool operator!=(const NameId& rhs) const { return entry_ != rhs.entry_; }
+
+  /** @brief Orders by id, which is the order the names were interned and not alphabetical */
+  bool operator<(const NameId& rhs) const { return entry_->id < rhs.entry_->id; }
+
+  /** @brief An entry of the symbol table */
+  struct Entry
+  {
+    std::string name;
+    std::size_t hash{ 0 };
+    uint32_t id{ 0 };
+  };
+
+private:
+  const Entry* entry_;
+
+  explicit NameId(const Entry* entry) : entry_(entry) {}
+};
+
+std::ostream& operator<<(std::ostream& os, const NameId& name);
+
+/** @brief A hash map keyed by interned names */
+template <typename Value>
+using NameIdMap = std::unordered_map<NameId, Value>;
+
+}  // namespace tesseract_common
+
+namespace std
+{
+template <>
+struct hash<tesseract_common::NameId>
+{
+  /** @brief The ids are small and distinct, so they are a perfect hash */
+  std::size_t operator()(const tesseract_common::NameId& name) const noexcept { return name.getId(); }
+};
+}  // namespace std
+
+#endif  // TESSERACT_COMMON_NAME_ID_H
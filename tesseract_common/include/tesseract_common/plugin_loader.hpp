@@ -109,6 +109,10 @@ inline std::set<std::string> extractLibrariesWithFullPath(std::set<std::string>&
 template <class PluginBase>
 std::shared_ptr<PluginBase> PluginLoader::instantiate(const std::string& plugin_name) const
 {
+  // Plugins linked into the program are owned by the registry, like symbols of a shared library
+  if (void* plugin = StaticPluginRegistry::get(plugin_name))
+    return std::shared_ptr<PluginBase>(static_cast<PluginBase*>(plugin), [](PluginBase* /*unused*/) {});
+
   // Check for environment variable for plugin definitions
   std::set<std::string> library_names = getAllSearchLibraries(search_libraries_env, search_libraries);
   if (library_names.empty())
@@ -165,6 +169,9 @@ std::shared_ptr<PluginBase> PluginLoader::instantiate(const std::string& plugin_
 
 bool PluginLoader::isPluginAvailable(const std::string& plugin_name) const
 {
+  if (StaticPluginRegistry::get(plugin_name) != nullptr)
+    return true;
+
   // Check for environment variable for plugin definitions
   std::set<std::string> library_names = getAllSearchLibraries(search_libraries_env, search_libraries);
   if (library_names.empty())
@@ -213,13 +220,15 @@ std::vector<std::string> PluginLoader::getAvailablePlugins() const
 
 std::vector<std::string> PluginLoader::getAvailablePlugins(const std::string& section) const
 {
-  std::vector<std::string> plugins;
+  std::vector<std::string> plugins = StaticPluginRegistry::getSymbols(section);
 
   // Check for environment variable for plugin definitions
   std::set<std::string> library_names = getAllSearchLibraries(search_libraries_env, search_libraries);
   if (library_names.empty())
   {
-    CONSOLE_BRIDGE_logError("No plugin libraries were provided!");
+    if (plugins.empty())
+      CONSOLE_BRIDGE_logError("No plugin libraries were provided!");
+
     return plugins;
   }
 
@@ -247,13 +256,15 @@ std::vector<std::string> PluginLoader::getAvailablePlugins(const std::string& se
 
 std::vector<std::string> PluginLoader::getAvailableSections(bool include_hidden) const
 {
-  std::vector<std::string> sections;
+  std::vector<std::string> sections = StaticPluginRegistry::getSections();
 
   // Check for environment variable for plugin definitions
   std::set<std::string> library_names = getAllSearchLibraries(search_libraries_env, search_libraries);
   if (library_names.empty())
   {
-    CONSOLE_BRIDGE_logError("No plugin libraries were provided!");
+    if (sections.empty())
+      CONSOLE_BRIDGE_logError("No plugin libraries were provided!");
+
     return sections;
   }
 
@@ -29,8 +29,16 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <cstdint>
+#include <ctime>
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_common
@@ -129,6 +137,14 @@ public:
    */
   virtual std::vector<uint8_t> getResourceContents() const = 0;
 
+  /**
+   * @brief Get the resource as bytes which may be shared with other resources referring to the same content
+   * @details The default copies the result of getResourceContents(). Resources which keep or cache their bytes return
+   * them without a copy.
+   * @return Resource bytes, never nullptr
+   */
+  virtual std::shared_ptr<const std::vector<uint8_t>> getSharedResourceContents() const;
+
   /**
    * @brief Get the resource as a std::istream. This function and the returned stream may block
    *
@@ -176,8 +192,12 @@ public:
 
   std::string getFilePath() const override final;
 
+  /** @brief Get the resource as bytes, this is a copy of the bytes held by the ResourceContentCache */
   std::vector<uint8_t> getResourceContents() const override final;
 
+  /** @brief Get the resource as bytes shared through the ResourceContentCache */
+  std::shared_ptr<const std::vector<uint8_t>> getSharedResourceContents() const override final;
+
   std::shared_ptr<std::istream> getResourceContentStream() const override final;
 
   Resource::Ptr locateResource(const std::string& url) const override final;
@@ -203,6 +223,16 @@ public:
 
   BytesResource(std::string url, std::vector<uint8_t> bytes, ResourceLocator::ConstPtr parent = nullptr);
   BytesResource(std::string url, const uint8_t* bytes, size_t bytes_len, ResourceLocator::ConstPtr parent = nullptr);
+
+  /**
+   * @brief A resource sharing bytes with other resources, copies of the resource share them as well
+   * @param url The url of the resource
+   * @param bytes The bytes of the resource, nullptr is treated as no bytes
+   * @param parent The locator used to locate the resource
+   */
+  BytesResource(std::string url,
+                std::shared_ptr<const std::vector<uint8_t>> bytes,
+                ResourceLocator::ConstPtr parent = nullptr);
   ~BytesResource() override = default;
   BytesResource(const BytesResource&) = default;
   BytesResource& operator=(const BytesResource&) = default;
@@ -213,6 +243,7 @@ public:
   std::string getUrl() const override final;
   std::string getFilePath() const override final;
   std::vector<uint8_t> getResourceContents() const override final;
+  std::shared_ptr<const std::vector<uint8_t>> getSharedResourceContents() const override final;
   std::shared_ptr<std::istream> getResourceContentStream() const override final;
   Resource::Ptr locateResource(const std::string& url) const override final;
 
@@ -221,12 +252,80 @@ public:
 
 private:
   std::string url_;
-  std::vector<uint8_t> bytes_;
+  std::shared_ptr<const std::vector<uint8_t>> bytes_{ std::make_shared<const std::vector<uint8_t>>() };
   ResourceLocator::ConstPtr parent_;
 
   friend class boost::serialization::access;
   template <class Archive>
-  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+};
+
+/**
+ * @brief A process wide cache of the contents of resource files
+ * @details The same mesh is often referenced by the visual and collision elements of a link and by many links. The
+ * cache reads a file once, memory mapping it and copying it into a buffer, and hands out the shared buffer to every
+ * resource referring to the file. An entry is keyed by the file path and is read again if the size or the last write
+ * time of the file changed.
+ *
+ * The size limit is read from the TESSERACT_RESOURCE_CACHE_MAX_SIZE (in bytes) environment variable and can be changed
+ * at runtime. Once the entries exceed the size limit the least recently used entries are removed, buffers still used by
+ * resources stay valid. Files larger than the size limit are read but not cached, a size limit of zero disables the
+ * cache.
+ */
+class ResourceContentCache
+{
+public:
+  ResourceContentCache();
+  ~ResourceContentCache() = default;
+  ResourceContentCache(const ResourceContentCache&) = delete;
+  ResourceContentCache& operator=(const ResourceContentCache&) = delete;
+  ResourceContentCache(ResourceContentCache&&) = delete;
+  ResourceContentCache& operator=(ResourceContentCache&&) = delete;
+
+  /** @brief Get the process wide cache */
+  static ResourceContentCache& getInstance();
+
+  /**
+   * @brief Get the contents of a file
+   * @param file_path The file path
+   * @return The contents of the file, nullptr if the file could not be read
+   */
+  std::shared_ptr<const std::vector<uint8_t>> getContents(const std::string& file_path);
+
+  /** @brief Set the maximum total size of the entries in bytes */
+  void setMaxSize(std::size_t max_size);
+
+  /** @brief Get the maximum total size of the entries in bytes */
+  std::size_t getMaxSize() const;
+
+  /** @brief Get the total size of the entries in bytes */
+  std::size_t getSize() const;
+
+  /** @brief Remove all entries */
+  void clear();
+
+private:
+  struct Entry
+  {
+    std::string file_path;
+    std::uintmax_t file_size{ 0 };
+    std::time_t write_time{ 0 };
+    std::shared_ptr<const std::vector<uint8_t>> contents;
+  };
+
+  mutable std::mutex mutex_;
+  std::size_t max_size_{ 0 };
+  std::size_t size_{ 0 };
+
+  /** @brief The entries ordered from the most to the least recently used */
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> lookup_;
+
+  /** @brief Remove the least recently used entries until the entries fit in the size limit */
+  void trim();
 };
 
 }  // namespace tesseract_common
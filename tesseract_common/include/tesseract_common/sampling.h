@@ -0,0 +1,106 @@
+/**
+ * @file sampling.h
+ * @brief Batch sampling of joint states within limits
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_SAMPLING_H
+#define TESSERACT_COMMON_SAMPLING_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <random>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_common/types.h>
+
+namespace tesseract_common
+{
+/**
+ * @brief Get the random number generator of the calling thread
+ * @details Each thread has its own generator so sampling from many threads does not race or contend. The generator of
+ * a thread is seeded from the process seed and the order in which the thread first used a generator.
+ * @return The generator of the calling thread
+ */
+std::mt19937& getThreadRandomGenerator();
+
+/**
+ * @brief Set the process seed of the thread generators
+ * @details The generator of every thread is reseeded the next time it is used, so a single threaded program produces
+ * the same samples for the same seed. By default the seed is taken from the clock.
+ * @param seed The process seed
+ */
+void setRandomSeed(uint32_t seed);
+
+/**
+ * @brief Sample states uniformly within limits
+ * @param samples The samples, each row is a state with a column for each limit
+ * @param limits The lower and upper limit of each joint
+ * @param generator The random number generator
+ */
+void sampleUniform(Eigen::Ref<TrajArray> samples,
+                   const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                   std::mt19937& generator);
+
+/**
+ * @brief Sample states uniformly within limits in parallel
+ * @details The samples are drawn in fixed size blocks, each with a generator seeded from the seed and the index of the
+ * block, so the result only depends on the seed and not on the executor.
+ * @param limits The lower and upper limit of each joint
+ * @param count The number of samples
+ * @param seed The seed of the samples
+ * @param executor The executor sampling the blocks, nullptr uses the default executor
+ * @return The samples, each row is a state
+ */
+TrajArray sampleUniform(const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                        Eigen::Index count,
+                        uint32_t seed,
+                        const Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Sample states from the Halton sequence scaled to the limits
+ * @details The Halton sequence covers the space more evenly than uniform samples, using the n-th prime as the base of
+ * the n-th joint. The coverage degrades for more than about twenty joints.
+ * @param samples The samples, each row is a state with a column for each limit
+ * @param limits The lower and upper limit of each joint
+ * @param offset The index in the sequence of the first sample, used to continue a sequence
+ */
+void sampleHalton(Eigen::Ref<TrajArray> samples, const Eigen::Ref<const Eigen::MatrixX2d>& limits, uint64_t offset = 0);
+
+/**
+ * @brief Sample states from the Halton sequence scaled to the limits in parallel
+ * @param limits The lower and upper limit of each joint
+ * @param count The number of samples
+ * @param offset The index in the sequence of the first sample, used to continue a sequence
+ * @param executor The executor sampling the blocks, nullptr uses the default executor
+ * @return The samples, each row is a state
+ */
+TrajArray sampleHalton(const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                       Eigen::Index count,
+                       uint64_t offset = 0,
+                       const Executor::Ptr& executor = nullptr);
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_SAMPLING_H
@@ -0,0 +1,125 @@
+/**
+ * @file shared_memory_ring_buffer.h
+ * @brief A ring buffer of fixed size slots in shared memory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_SHARED_MEMORY_RING_BUFFER_H
+#define TESSERACT_COMMON_SHARED_MEMORY_RING_BUFFER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/**
+ * @brief A ring buffer of fixed size slots in shared memory, written by one process and read by any number of others
+ * @details The writer fills a slot in place and the readers decode it in place, so a message crosses the process
+ * boundary without being serialized or copied into an intermediate buffer. Each slot is guarded by a sequence number
+ * which is odd while the slot is written. A reader never blocks the writer, instead a read reports failure if the
+ * writer reused the slot while it was read, and the reader tries again with a newer message.
+ *
+ * The layout id is stored by the writer and checked when the buffer is opened, so both sides agree on what the bytes
+ * of a slot mean.
+ */
+class SharedMemoryRingBuffer
+{
+public:
+  using Ptr = std::shared_ptr<SharedMemoryRingBuffer>;
+  using ConstPtr = std::shared_ptr<const SharedMemoryRingBuffer>;
+  using UPtr = std::unique_ptr<SharedMemoryRingBuffer>;
+  using ConstUPtr = std::unique_ptr<const SharedMemoryRingBuffer>;
+
+  /**
+   * @brief Create the ring buffer, replacing a shared memory object with the same name
+   * @details The shared memory object is removed when the writer is destroyed. Throws std::runtime_error on failure.
+   * @param name The name of the shared memory object
+   * @param slot_size The number of bytes of a slot
+   * @param slot_count The number of slots
+   * @param layout_id Identifies the layout of the slots
+   */
+  SharedMemoryRingBuffer(std::string name, std::size_t slot_size, std::size_t slot_count, uint64_t layout_id = 0);
+
+  /**
+   * @brief Open a ring buffer created by another process
+   * @details Throws std::runtime_error if it does not exist or its layout id does not match
+   * @param name The name of the shared memory object
+   * @param layout_id The expected layout of the slots
+   */
+  explicit SharedMemoryRingBuffer(std::string name, uint64_t layout_id = 0);
+
+  ~SharedMemoryRingBuffer();
+  SharedMemoryRingBuffer(const SharedMemoryRingBuffer&) = delete;
+  SharedMemoryRingBuffer& operator=(const SharedMemoryRingBuffer&) = delete;
+  SharedMemoryRingBuffer(SharedMemoryRingBuffer&&) = delete;
+  SharedMemoryRingBuffer& operator=(SharedMemoryRingBuffer&&) = delete;
+
+  /** @brief The name of the shared memory object */
+  const std::string& getName() const;
+
+  /** @brief The number of bytes of a slot */
+  std::size_t getSlotSize() const;
+
+  /** @brief The number of slots */
+  std::size_t getSlotCount() const;
+
+  /** @brief The number of messages written, the sequence of the next message */
+  uint64_t getWriteSequence() const;
+
+  /**
+   * @brief Write a message in the next slot
+   * @details Only the process which created the ring buffer may write. Throws std::runtime_error otherwise.
+   * @param fill Writes the message into the slot, which has getSlotSize() bytes
+   * @return The sequence of the message
+   */
+  uint64_t write(const std::function<void(uint8_t* slot)>& fill);
+
+  /**
+   * @brief Read a message
+   * @details The slot may be overwritten while it is read, so consume must not act on the data until read returns true
+   * @param sequence The sequence of the message
+   * @param consume Reads the message from the slot, which has getSlotSize() bytes
+   * @return True if the message was read, false if it was not written yet or was overwritten
+   */
+  bool read(uint64_t sequence, const std::function<void(const uint8_t* slot)>& consume) const;
+
+  /**
+   * @brief Read the newest message
+   * @param consume Reads the message from the slot, see read
+   * @param sequence The sequence of the message that was read
+   * @return True if a message was read, false if none was written yet
+   */
+  bool readLatest(const std::function<void(const uint8_t* slot)>& consume, uint64_t* sequence = nullptr) const;
+
+private:
+  struct Implementation;
+  std::unique_ptr<Implementation> impl_;
+};
+
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_COMMON_SHARED_MEMORY_RING_BUFFER_H
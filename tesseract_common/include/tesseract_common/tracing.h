@@ -0,0 +1,153 @@
+/**
+ * @file tracing.h
+ * @brief Scoped trace zones for profiling the libraries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_TRACING_H
+#define TESSERACT_COMMON_TRACING_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_common
+{
+/** @brief A completed trace zone */
+struct TraceEvent
+{
+  /** @brief The name of the zone, this points to a string literal */
+  const char* name{ nullptr };
+
+  /** @brief The index of the thread which recorded the zone, threads are numbered in the order they first record */
+  std::size_t thread{ 0 };
+
+  /** @brief The start time in nanoseconds since tracing was started */
+  std::int64_t start{ 0 };
+
+  /** @brief The duration in nanoseconds */
+  std::int64_t duration{ 0 };
+};
+
+/**
+ * @brief Collects the trace zones recorded by all threads and exports them
+ * @details The libraries mark their entry points, like applying environment commands, contact tests, cloning contact
+ * managers, state solver queries and kinematics, with TESSERACT_TRACE_ZONE. The zones are only compiled in when the
+ * libraries are built with TESSERACT_ENABLE_TRACING and are only recorded between start() and stop(), otherwise a zone
+ * costs a single relaxed atomic load.
+ *
+ * Each thread records into its own buffer, the buffers are kept after the thread exits until clear() is called. Events
+ * accumulate while recording, so tracing is meant for bounded periods of a program.
+ */
+class Tracer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /** @brief Clear the recorded events and start recording */
+  static void start();
+
+  /** @brief Stop recording, the recorded events are kept */
+  static void stop();
+
+  /** @brief Check if zones are being recorded */
+  static bool isRecording() { return recording_.load(std::memory_order_relaxed); }
+
+  /** @brief Remove the recorded events */
+  static void clear();
+
+  /** @brief Get the recorded events of all threads ordered by start time */
+  static std::vector<TraceEvent> getEvents();
+
+  /**
+   * @brief Write the recorded events in the Chrome trace event format
+   * @details The output can be opened in chrome://tracing or https://ui.perfetto.dev
+   * @param os The stream to write to
+   */
+  static void writeChromeTrace(std::ostream& os);
+
+  /**
+   * @brief Write the recorded events to a file in the Chrome trace event format
+   * @param file_path The file to write
+   * @return True if the file was written
+   */
+  static bool writeChromeTrace(const std::string& file_path);
+
+  /**
+   * @brief Record a zone of the calling thread
+   * @param name The name of the zone, this must be a string literal
+   * @param start The start time of the zone
+   * @param end The end time of the zone
+   */
+  static void record(const char* name, Clock::time_point start, Clock::time_point end);
+
+private:
+  static std::atomic<bool> recording_;
+};
+
+/** @brief Records the time from its construction to its destruction as a zone when tracing is recording */
+class TraceZone
+{
+public:
+  /** @param name The name of the zone, this must be a string literal */
+  explicit TraceZone(const char* name) : name_(name), active_(Tracer::isRecording())
+  {
+    if (active_)
+      start_ = Tracer::Clock::now();
+  }
+
+  ~TraceZone()
+  {
+    if (active_)
+      Tracer::record(name_, start_, Tracer::Clock::now());
+  }
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+  TraceZone(TraceZone&&) = delete;
+  TraceZone& operator=(TraceZone&&) = delete;
+
+private:
+  const char* name_;
+  bool active_;
+  Tracer::Clock::time_point start_;
+};
+
+}  // namespace tesseract_common
+
+#define TESSERACT_TRACE_CONCAT_IMPL(a, b) a##b
+#define TESSERACT_TRACE_CONCAT(a, b) TESSERACT_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef TESSERACT_ENABLE_TRACING
+/** @brief Record the rest of the enclosing scope as a zone, the name must be a string literal */
+#define TESSERACT_TRACE_ZONE(name)                                                                                     \
+  const tesseract_common::TraceZone TESSERACT_TRACE_CONCAT(tesseract_trace_zone_, __LINE__)(name)
+#else
+#define TESSERACT_TRACE_ZONE(name) (void)0
+#endif
+
+#endif  // TESSERACT_COMMON_TRACING_H
@@ -26,15 +26,25 @@
 #ifndef TESSERACT_COMMON_TYPE_ERASURE_H
 #define TESSERACT_COMMON_TYPE_ERASURE_H
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <typeindex>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
 #include <boost/serialization/unique_ptr.hpp>
 #include <tesseract_common/serialization.h>
 
 namespace tesseract_common
 {
+/**
+ * @brief The default size in bytes of the inline storage of TypeErasureBase
+ * @details Erased types whose instance fits are stored inside the type erasure instead of on the heap
+ */
+static constexpr std::size_t TYPE_ERASURE_DEFAULT_INLINE_SIZE = 64;
+
 /** @brief This is the interface that all type erasures interfaces must inherit from */
 struct TypeErasureInterface
 {
@@ -55,6 +65,14 @@ struct TypeErasureInterface
   // This is not required for user defined implementation
   virtual std::unique_ptr<TypeErasureInterface> clone() const = 0;
 
+  // This is not required for user defined implementation
+  // Copy construct in the buffer if the instance fits, otherwise return nullptr
+  virtual TypeErasureInterface* cloneInto(void* buffer, std::size_t size) const = 0;
+
+  // This is not required for user defined implementation
+  // Move construct in the buffer if the instance fits, otherwise return nullptr
+  virtual TypeErasureInterface* moveInto(void* buffer, std::size_t size) noexcept = 0;
+
 private:
   friend class boost::serialization::access;
   friend struct tesseract_common::Serialization;
@@ -70,7 +88,7 @@ struct TypeErasureInstance : ConceptInterface
 
   TypeErasureInstance() = default;
 
-  explicit TypeErasureInstance(ConcreteType value) : value_(std::move(value)) {}
+  explicit TypeErasureInstance(const ConcreteType& value) : value_(value) {}
 
   explicit TypeErasureInstance(ConcreteType&& value) : value_(std::move(value)) {}
 
@@ -111,13 +129,42 @@ struct TypeErasureInstanceWrapper : F  // NOLINT
 
   TypeErasureInstanceWrapper() = default;
   TypeErasureInstanceWrapper(const ConceptValueType& x) : F(x) {}
+  TypeErasureInstanceWrapper(ConceptValueType&& x) : F(std::move(x)) {}
   TypeErasureInstanceWrapper(TypeErasureInstanceWrapper&& x) noexcept : F(std::move(x)) {}
 
+  /**
+   * @brief Check if an instance can be stored in an inline buffer
+   * @details Only types that cannot throw when moved are stored inline so moving a type erasure stays noexcept
+   * @param size The size of the buffer in bytes, the buffer is aligned to std::max_align_t
+   */
+  static constexpr bool isInlineStorable(std::size_t size)
+  {
+    return sizeof(TypeErasureInstanceWrapper<F>) <= size &&
+           alignof(TypeErasureInstanceWrapper<F>) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible<ConceptValueType>::value;
+  }
+
   std::unique_ptr<TypeErasureInterface> clone() const final
   {
     return std::make_unique<TypeErasureInstanceWrapper<F>>(this->get());
   }
 
+  TypeErasureInterface* cloneInto(void* buffer, std::size_t size) const final
+  {
+    if (!isInlineStorable(size))
+      return nullptr;
+
+    return new (buffer) TypeErasureInstanceWrapper<F>(this->get());
+  }
+
+  TypeErasureInterface* moveInto(void* buffer, std::size_t size) noexcept final
+  {
+    if (!isInlineStorable(size))
+      return nullptr;
+
+    return new (buffer) TypeErasureInstanceWrapper<F>(std::move(*this));
+  }
+
 private:
   friend class boost::serialization::access;
   friend struct tesseract_common::Serialization;
@@ -129,7 +176,16 @@ private:
   }
 };
 
-template <typename ConceptInterface, template <typename> class ConceptInstance>
+/**
+ * @brief The base of a type erasure
+ * @details Erased types whose instance fits in InlineSize bytes and that cannot throw when moved are stored inside
+ * the type erasure, so creating, copying and moving them does not allocate. Larger types are stored on the heap and
+ * moving them only moves the pointer.
+ * @tparam InlineSize The size in bytes of the inline storage, zero always stores the erased type on the heap
+ */
+template <typename ConceptInterface,
+          template <typename> class ConceptInstance,
+          std::size_t InlineSize = TYPE_ERASURE_DEFAULT_INLINE_SIZE>
 struct TypeErasureBase
 {
 private:
@@ -146,25 +202,47 @@ public:
 
   template <typename T, generic_ctor_enabler<T> = 0>
   TypeErasureBase(T&& value)  // NOLINT
-    : value_(std::make_unique<TypeErasureInstanceWrapper<ConceptInstance<uncvref_t<T>>>>(value))
   {
+    using InstanceType = TypeErasureInstanceWrapper<ConceptInstance<uncvref_t<T>>>;
+    if constexpr (InstanceType::isInlineStorable(InlineSize))
+    {
+      value_ = new (&buffer_) InstanceType(std::forward<T>(value));
+      inline_ = true;
+    }
+    else
+    {
+      value_ = new InstanceType(std::forward<T>(value));
+    }
   }
 
-  TypeErasureBase() : value_(nullptr){};  // NOLINT
+  TypeErasureBase() = default;  // NOLINT
 
   // Destructor
-  ~TypeErasureBase() = default;
+  ~TypeErasureBase() { reset(); }
 
   // Copy constructor
-  TypeErasureBase(const TypeErasureBase& other) : value_((other.value_ != nullptr) ? other.value_->clone() : nullptr) {}
+  TypeErasureBase(const TypeErasureBase& other)
+  {
+    if (other.value_ == nullptr)
+      return;
+
+    value_ = other.value_->cloneInto(&buffer_, InlineSize);
+    inline_ = (value_ != nullptr);
+    if (!inline_)
+      value_ = other.value_->clone().release();
+  }
 
   // Move ctor.
-  TypeErasureBase(TypeErasureBase&& other) noexcept { value_.swap(other.value_); }
+  TypeErasureBase(TypeErasureBase&& other) noexcept { moveFrom(other); }
 
   // Move assignment.
   TypeErasureBase& operator=(TypeErasureBase&& other) noexcept
   {
-    value_.swap(other.value_);
+    if (this != &other)
+    {
+      reset();
+      moveFrom(other);
+    }
     return (*this);
   }
 
@@ -192,6 +270,9 @@ public:
 
   bool isNull() const { return (value_ == nullptr); }
 
+  /** @brief Check if the erased type is stored in the inline storage instead of on the heap */
+  bool isInline() const { return inline_; }
+
   bool operator==(const TypeErasureBase& rhs) const
   {
     if (value_ == nullptr && rhs.value_ == nullptr)
@@ -205,9 +286,9 @@ public:
 
   bool operator!=(const TypeErasureBase& rhs) const { return !operator==(rhs); }
 
-  ConceptInterfaceType& getInterface() { return *static_cast<ConceptInterfaceType*>(value_.get()); }
+  ConceptInterfaceType& getInterface() { return *static_cast<ConceptInterfaceType*>(value_); }
 
-  const ConceptInterfaceType& getInterface() const { return *static_cast<const ConceptInterfaceType*>(value_.get()); }
+  const ConceptInterfaceType& getInterface() const { return *static_cast<const ConceptInterfaceType*>(value_); }
 
   template <typename T>
   T& as()
@@ -235,13 +316,80 @@ private:
   friend class boost::serialization::access;
   friend struct tesseract_common::Serialization;
 
+  /** @brief Destroy the erased type, leaving this null */
+  void reset() noexcept
+  {
+    if (inline_)
+      value_->~TypeErasureInterface();
+    else
+      delete value_;
+
+    value_ = nullptr;
+    inline_ = false;
+  }
+
+  /** @brief Take the erased type of other, this must be null */
+  void moveFrom(TypeErasureBase& other) noexcept
+  {
+    if (other.value_ == nullptr)
+      return;
+
+    if (other.inline_)
+    {
+      value_ = other.value_->moveInto(&buffer_, InlineSize);
+      inline_ = true;
+      other.reset();
+    }
+    else
+    {
+      value_ = other.value_;
+      other.value_ = nullptr;
+    }
+  }
+
+  // The value is archived as an owning pointer so the format does not depend on where it is stored
   template <class Archive>
-  void serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+  void save(Archive& ar, const unsigned int /*version*/) const
+  {
+    std::unique_ptr<TypeErasureInterface> value(value_);
+    try
+    {
+      ar& boost::serialization::make_nvp("value", value);
+    }
+    catch (...)
+    {
+      value.release();  // NOLINT
+      throw;
+    }
+    value.release();  // NOLINT
+  }
+
+  template <class Archive>
+  void load(Archive& ar, const unsigned int /*version*/)
   {
-    ar& boost::serialization::make_nvp("value", value_);
+    std::unique_ptr<TypeErasureInterface> value;
+    ar& boost::serialization::make_nvp("value", value);
+
+    reset();
+    if (value == nullptr)
+      return;
+
+    value_ = value->moveInto(&buffer_, InlineSize);
+    inline_ = (value_ != nullptr);
+    if (!inline_)
+      value_ = value.release();
   }
 
-  std::unique_ptr<TypeErasureInterface> value_{ nullptr };
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+  /** @brief The erased type, it points into buffer_ when stored inline otherwise it is owned on the heap */
+  TypeErasureInterface* value_{ nullptr };
+
+  /** @brief Indicate if value_ is stored in buffer_ */
+  bool inline_{ false };
+
+  /** @brief The inline storage */
+  alignas(std::max_align_t) unsigned char buffer_[(InlineSize > 0) ? InlineSize : 1];
 };
 
 }  // namespace tesseract_common
@@ -49,7 +49,7 @@ namespace tesseract_common
 /** @brief Random number generator */
 static std::mt19937 mersenne{ static_cast<std::mt19937::result_type>(std::time(nullptr)) };
 #else
-/** @brief Random number generator */
+/** @brief Random number generator, it is not thread safe so prefer getThreadRandomGenerator() */
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 inline std::mt19937 mersenne{ static_cast<std::mt19937::result_type>(std::time(nullptr)) };
 #endif
@@ -146,6 +146,57 @@ Eigen::Vector3d calcRotationalError2(const Eigen::Ref<const Eigen::Matrix3d>& R)
  */
 Eigen::VectorXd calcTransformError(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2);
 
+/**
+ * @brief Calculate error between two transforms expressed in t1 coordinate system
+ * @details This is calcTransformError returning a fixed size vector, so it does not allocate
+ * @param t1 Target Transform
+ * @param t2 Current Transform
+ * @return error [Position, Rotational(Angle Axis)]
+ */
+Eigen::Matrix<double, 6, 1> calcTransformErrorFixed(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2);
+
+/**
+ * @brief Calculate the error between a target and each of a set of transforms
+ * @details Throws std::runtime_error if errors does not have a column per transform
+ * @param errors The error of each transform, one column per transform [Position, Rotational(Angle Axis)]
+ * @param t1 Target Transform
+ * @param t2 Current Transforms
+ */
+void calcTransformErrors(Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> errors,
+                         const Eigen::Isometry3d& t1,
+                         const VectorIsometry3d& t2);
+
+/**
+ * @brief Calculate the error between pairs of transforms
+ * @details Throws std::runtime_error if the lists are not the same size or errors does not have a column per pair
+ * @param errors The error of each pair, one column per pair [Position, Rotational(Angle Axis)]
+ * @param t1 Target Transforms
+ * @param t2 Current Transforms
+ */
+void calcTransformErrors(Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> errors,
+                         const VectorIsometry3d& t1,
+                         const VectorIsometry3d& t2);
+
+/**
+ * @brief Calculate the jacobian of the rotation error vector with respect to a rotation applied on the left
+ * @details For a rotation error vector e = log(R) this is d log(exp(w) * R) / dw at w = 0, the inverse of the left
+ * jacobian of SO(3) at e. It is well defined up to and including an angle of PI.
+ * @param error The rotation error vector from calcRotationalError
+ * @return The 3x3 jacobian
+ */
+Eigen::Matrix3d calcRotationalErrorJacobian(const Eigen::Ref<const Eigen::Vector3d>& error);
+
+/**
+ * @brief Calculate the jacobian of calcTransformError(t1, t2) with respect to a change of t2
+ * @details The change of t2 is a linear and angular velocity [v, w] expressed in the world frame about the origin of
+ * t2, which is the convention of the kinematic jacobians. The jacobian of the error with respect to joint values is
+ * then this times the kinematic jacobian of t2, so costs do not need to be numerically differentiated.
+ * @param t1 Target Transform
+ * @param t2 Current Transform
+ * @return The 6x6 jacobian, rows are [Position, Rotational] error and columns are [v, w]
+ */
+Eigen::Matrix<double, 6, 6> calcTransformErrorJacobian(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2);
+
 /**
  * @brief This computes a random color RGBA [0, 1] with alpha set to 1
  * @return A random RGBA color
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #endif
 #include <boost/serialization/unordered_map.hpp>
 #include <memory>
+#include <set>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
@@ -67,6 +68,50 @@ bool AllowedCollisionMatrix::operator==(const AllowedCollisionMatrix& rhs) const
 }
 bool AllowedCollisionMatrix::operator!=(const AllowedCollisionMatrix& rhs) const { return !operator==(rhs); }
 
+CompiledAllowedCollisionMatrix::CompiledAllowedCollisionMatrix(const AllowedCollisionMatrix& acm)
+{
+  // Sort the link names so the indices do not depend on the order of the entries
+  std::set<std::string> link_names;
+  for (const auto& entry : acm.getAllAllowedCollisions())
+  {
+    link_names.insert(entry.first.first);
+    link_names.insert(entry.first.second);
+  }
+
+  link_names_.assign(link_names.begin(), link_names.end());
+  link_indices_.reserve(link_names_.size());
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+  {
+    link_indices_[link_names_[i]] = static_cast<int>(i);
+
+    const NameId id(link_names_[i]);
+    if (id.getId() >= name_id_indices_.size())
+      name_id_indices_.resize(id.getId() + 1, -1);
+
+    name_id_indices_[id.getId()] = static_cast<int>(i);
+  }
+
+  const std::size_t n = link_names_.size();
+  allowed_.resize(n * n, false);
+  for (const auto& entry : acm.getAllAllowedCollisions())
+  {
+    const auto i = static_cast<std::size_t>(link_indices_[entry.first.first]);
+    const auto j = static_cast<std::size_t>(link_indices_[entry.first.second]);
+    allowed_[(i * n) + j] = true;
+    allowed_[(j * n) + i] = true;
+  }
+}
+
+bool CompiledAllowedCollisionMatrix::operator==(const CompiledAllowedCollisionMatrix& rhs) const
+{
+  // The link indices are derived from the sorted link names
+  return link_names_ == rhs.link_names_ && allowed_ == rhs.allowed_;
+}
+bool CompiledAllowedCollisionMatrix::operator!=(const CompiledAllowedCollisionMatrix& rhs) const
+{
+  return !operator==(rhs);
+}
+
 template <class Archive>
 void AllowedCollisionMatrix::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #endif
 #include <boost/serialization/unordered_map.hpp>
 #include <memory>
+#include <set>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
@@ -66,12 +67,53 @@ bool CollisionMarginData::operator==(const CollisionMarginData& rhs) const
 
 bool CollisionMarginData::operator!=(const CollisionMarginData& rhs) const { return !operator==(rhs); }
 
+void CollisionMarginData::updatePairMarginTable()
+{
+  pair_margin_indices_.clear();
+  pair_margin_table_.clear();
+  name_id_indices_.clear();
+  if (lookup_table_.empty())
+    return;
+
+  // Sort the object names so the table does not depend on the order of the lookup table
+  std::set<std::string> names;
+  for (const auto& pair : lookup_table_)
+  {
+    names.insert(pair.first.first);
+    names.insert(pair.first.second);
+  }
+
+  pair_margin_indices_.reserve(names.size());
+  for (const auto& name : names)
+  {
+    const NameId id(name);
+    if (id.getId() >= name_id_indices_.size())
+      name_id_indices_.resize(id.getId() + 1, NO_PAIR_MARGIN_INDEX);
+
+    name_id_indices_[id.getId()] = pair_margin_indices_.size();
+    pair_margin_indices_.emplace(name, pair_margin_indices_.size());
+  }
+
+  const std::size_t n = names.size();
+  pair_margin_table_.assign(n * n, default_collision_margin_);
+  for (const auto& pair : lookup_table_)
+  {
+    const std::size_t i = pair_margin_indices_.at(pair.first.first);
+    const std::size_t j = pair_margin_indices_.at(pair.first.second);
+    pair_margin_table_[(i * n) + j] = pair.second;
+    pair_margin_table_[(j * n) + i] = pair.second;
+  }
+}
+
 template <class Archive>
 void CollisionMarginData::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_NVP(default_collision_margin_);
   ar& BOOST_SERIALIZATION_NVP(max_collision_margin_);
   ar& BOOST_SERIALIZATION_NVP(lookup_table_);
+
+  if constexpr (Archive::is_loading::value)
+    updatePairMarginTable();
 }
 }  // namespace tesseract_common
 
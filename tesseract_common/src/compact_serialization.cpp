@@ -0,0 +1,151 @@
+/**
+ * @file compact_serialization.cpp
+ * @brief Compact encoding of large arrays stored in binary archives
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
+#include <stdexcept>
+#include <zlib.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/compact_serialization.h>
+
+namespace tesseract_common
+{
+std::vector<uint8_t> compressBytes(const uint8_t* data, std::size_t size)
+{
+  if (size == 0)
+    return {};
+
+  auto compressed_size = static_cast<uLongf>(compressBound(static_cast<uLong>(size)));
+  std::vector<uint8_t> compressed(compressed_size);
+  if (compress2(compressed.data(), &compressed_size, data, static_cast<uLong>(size), Z_DEFAULT_COMPRESSION) != Z_OK)
+    throw std::runtime_error("compressBytes, failed to compress the data!");
+
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+std::vector<uint8_t> decompressBytes(const std::vector<uint8_t>& data, std::size_t size)
+{
+  std::vector<uint8_t> decompressed(size);
+  if (size == 0)
+    return decompressed;
+
+  auto decompressed_size = static_cast<uLongf>(size);
+  if (uncompress(decompressed.data(), &decompressed_size, data.data(), static_cast<uLong>(data.size())) != Z_OK ||
+      decompressed_size != size)
+    throw std::runtime_error("decompressBytes, the compressed data is corrupt!");
+
+  return decompressed;
+}
+
+std::vector<uint8_t> encodeDeltaIntegers(const int* data, std::size_t size)
+{
+  std::vector<uint8_t> encoded;
+  encoded.reserve(size);
+  int64_t previous{ 0 };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const int64_t delta = static_cast<int64_t>(data[i]) - previous;
+    previous = data[i];
+
+    auto zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+    while (zigzag >= 0x80)
+    {
+      encoded.push_back(static_cast<uint8_t>(zigzag | 0x80));
+      zigzag >>= 7;
+    }
+    encoded.push_back(static_cast<uint8_t>(zigzag));
+  }
+  return encoded;
+}
+
+void decodeDeltaIntegers(const std::vector<uint8_t>& encoded, int* data, std::size_t size)
+{
+  std::size_t pos{ 0 };
+  int64_t previous{ 0 };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    uint64_t zigzag{ 0 };
+    for (unsigned shift = 0;; shift += 7)
+    {
+      if (pos >= encoded.size() || shift > 63)
+        throw std::runtime_error("decodeDeltaIntegers, the encoded data is corrupt!");
+
+      const uint8_t byte = encoded[pos++];
+      zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+        break;
+    }
+
+    const auto delta = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    previous += delta;
+    data[i] = static_cast<int>(previous);
+  }
+
+  if (pos != encoded.size())
+    throw std::runtime_error("decodeDeltaIntegers, the encoded data is corrupt!");
+}
+
+std::vector<uint8_t> encodeDoubles(const double* data, std::size_t size, std::size_t stride)
+{
+  std::vector<uint8_t> encoded(size * sizeof(double));
+  uint64_t bits{ 0 };
+  uint64_t previous{ 0 };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    std::memcpy(&bits, &data[i], sizeof(double));
+    if (i >= stride)
+      std::memcpy(&previous, &data[i - stride], sizeof(double));
+
+    const uint64_t value = (i >= stride) ? (bits ^ previous) : bits;
+    for (std::size_t b = 0; b < sizeof(double); ++b)
+      encoded[(b * size) + i] = static_cast<uint8_t>(value >> (8 * b));
+  }
+  return encoded;
+}
+
+void decodeDoubles(const std::vector<uint8_t>& encoded, double* data, std::size_t size, std::size_t stride)
+{
+  if (encoded.size() != size * sizeof(double))
+    throw std::runtime_error("decodeDoubles, the encoded data is corrupt!");
+
+  uint64_t previous{ 0 };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    uint64_t value{ 0 };
+    for (std::size_t b = 0; b < sizeof(double); ++b)
+      value |= static_cast<uint64_t>(encoded[(b * size) + i]) << (8 * b);
+
+    if (i >= stride)
+    {
+      std::memcpy(&previous, &data[i - stride], sizeof(double));
+      value ^= previous;
+    }
+    std::memcpy(&data[i], &value, sizeof(double));
+  }
+}
+
+}  // namespace tesseract_common
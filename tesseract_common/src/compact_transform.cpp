@@ -0,0 +1,94 @@
+/**
+ * @file compact_transform.cpp
+ * @brief A rigid transform stored as a rotation matrix and translation
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/compact_transform.h>
+
+namespace tesseract_common
+{
+void composeTransforms(VectorCompactTransform& transforms,
+                       const CompactTransform& lhs,
+                       const VectorCompactTransform& rhs)
+{
+  transforms.resize(rhs.size());
+  for (std::size_t i = 0; i < rhs.size(); ++i)
+  {
+    transforms[i].linear.noalias() = lhs.linear * rhs[i].linear;
+    transforms[i].translation.noalias() = lhs.linear * rhs[i].translation;
+    transforms[i].translation += lhs.translation;
+  }
+}
+
+void composeTransforms(VectorCompactTransform& transforms,
+                       const VectorCompactTransform& lhs,
+                       const VectorCompactTransform& rhs)
+{
+  if (lhs.size() != rhs.size())
+    throw std::runtime_error("composeTransforms, the lists of transforms must be the same size!");
+
+  transforms.resize(rhs.size());
+  for (std::size_t i = 0; i < rhs.size(); ++i)
+  {
+    transforms[i].linear.noalias() = lhs[i].linear * rhs[i].linear;
+    transforms[i].translation.noalias() = lhs[i].linear * rhs[i].translation;
+    transforms[i].translation += lhs[i].translation;
+  }
+}
+
+void transformPoints(Eigen::Ref<Eigen::Matrix3Xd> transformed,
+                     const CompactTransform& transform,
+                     const Eigen::Ref<const Eigen::Matrix3Xd>& points)
+{
+  if (transformed.cols() != points.cols())
+    throw std::runtime_error("transformPoints, the transformed points must be the same size as the points!");
+
+  // The product is evaluated into a temporary so transforming the points in place is safe
+  transformed = (transform.linear * points).colwise() + transform.translation;
+}
+
+VectorCompactTransform toCompactTransforms(const VectorIsometry3d& transforms)
+{
+  VectorCompactTransform compact;
+  compact.reserve(transforms.size());
+  for (const auto& transform : transforms)
+    compact.emplace_back(transform);
+
+  return compact;
+}
+
+VectorIsometry3d toIsometryTransforms(const VectorCompactTransform& transforms)
+{
+  VectorIsometry3d isometries;
+  isometries.reserve(transforms.size());
+  for (const auto& transform : transforms)
+    isometries.push_back(transform.toIsometry());
+
+  return isometries;
+}
+
+}  // namespace tesseract_common
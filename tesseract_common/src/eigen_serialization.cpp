@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/array.hpp>
+#include <type_traits>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/eigen_serialization.h>
@@ -151,14 +152,34 @@ void serialize(Archive& ar, Eigen::VectorXi& g, const unsigned int version)
 template <class Archive>
 void save(Archive& ar, const Eigen::Isometry3d& g, const unsigned int /*version*/)
 {
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Binary archives store the upper 3x4 block as is, which avoids converting the rotation to a quaternion and back
+    const Eigen::Matrix<double, 3, 4> affine = g.affine();
+    ar& boost::serialization::make_nvp("affine", boost::serialization::make_array(affine.data(), 12));
+    return;
+  }
+
   ar& boost::serialization::make_nvp("xyz", boost::serialization::make_array(g.translation().data(), 3));
   Eigen::Quaterniond q(g.linear());
   ar& boost::serialization::make_nvp("xyzw", boost::serialization::make_array(q.vec().data(), 4));
 }
 
 template <class Archive>
-void load(Archive& ar, Eigen::Isometry3d& g, const unsigned int /*version*/)
+void load(Archive& ar, Eigen::Isometry3d& g, const unsigned int version)
 {
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+    {
+      Eigen::Matrix<double, 3, 4> affine;
+      ar& boost::serialization::make_nvp("affine", boost::serialization::make_array(affine.data(), 12));
+      g.affine() = affine;
+      g.makeAffine();
+      return;
+    }
+  }
+
   g.setIdentity();
   ar& boost::serialization::make_nvp("xyz", boost::serialization::make_array(g.translation().data(), 3));
   Eigen::Quaterniond q;
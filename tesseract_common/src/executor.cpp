@@ -0,0 +1,278 @@
+/**
+ * @file executor.cpp
+ * @brief Executors running the parallel work of the libraries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief The pool owning the calling thread, nullptr if it is not a thread of a pool */
+thread_local const ThreadPoolExecutor* current_pool{ nullptr };
+
+/** @brief The index of the queue of the calling thread in its pool */
+thread_local std::size_t current_queue{ 0 };
+
+/** @brief The shared state of a parallelFor, tasks which start after it returned find no indices left */
+struct ParallelForState
+{
+  const std::function<void(std::size_t)>* fn{ nullptr };
+  std::size_t count{ 0 };
+  std::atomic<std::size_t> next{ 0 };
+  std::atomic<bool> failed{ false };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t finished{ 0 };
+  std::exception_ptr error;
+
+  void run()
+  {
+    std::size_t completed{ 0 };
+    for (std::size_t i = next++; i < count; i = next++)
+    {
+      if (!failed)
+      {
+        try
+        {
+          (*fn)(i);
+        }
+        catch (...)
+        {
+          std::scoped_lock lock(mutex);
+          if (!error)
+            error = std::current_exception();
+
+          failed = true;
+        }
+      }
+      ++completed;
+    }
+
+    if (completed == 0)
+      return;
+
+    std::scoped_lock lock(mutex);
+    finished += completed;
+    if (finished == count)
+      cv.notify_all();
+  }
+};
+
+/** @brief Run a submitted task, exceptions cannot be passed to anyone so they are logged */
+void runTask(const std::function<void()>& task)
+{
+  try
+  {
+    task();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Executor, a task threw an exception: %s", e.what());
+  }
+  catch (...)
+  {
+    CONSOLE_BRIDGE_logError("Executor, a task threw an unknown exception");
+  }
+}
+
+struct DefaultExecutorHolder
+{
+  std::mutex mutex;
+  Executor::Ptr executor;
+
+  static DefaultExecutorHolder& getInstance()
+  {
+    // Intentionally never destroyed so the threads of the pool are not joined during static destruction
+    static auto* holder = new DefaultExecutorHolder();
+    return *holder;
+  }
+};
+}  // namespace
+
+void Executor::parallelFor(std::size_t count, const std::function<void(std::size_t)>& fn, std::size_t max_concurrency)
+{
+  if (count == 0)
+    return;
+
+  if (max_concurrency == 0)
+    max_concurrency = getConcurrency();
+
+  const std::size_t num_tasks = std::min(std::max<std::size_t>(max_concurrency, 1), count) - 1;
+  if (num_tasks == 0)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      fn(i);
+
+    return;
+  }
+
+  auto state = std::make_shared<ParallelForState>();
+  state->fn = &fn;
+  state->count = count;
+  for (std::size_t i = 0; i < num_tasks; ++i)
+    submit([state]() { state->run(); });
+
+  state->run();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cv.wait(lock, [&state]() { return state->finished == state->count; });
+  if (state->error)
+    std::rethrow_exception(state->error);
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t threads)
+{
+  if (threads == 0)
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  queues_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i)
+    queues_.push_back(std::make_unique<Queue>());
+
+  threads_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i)
+    threads_.emplace_back(&ThreadPoolExecutor::run, this, i);
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+  {
+    std::scoped_lock lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+void ThreadPoolExecutor::submit(std::function<void()> task)
+{
+  const std::size_t index = (current_pool == this) ? current_queue : (next_queue_++ % queues_.size());
+  {
+    std::scoped_lock lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+
+  {
+    std::scoped_lock lock(mutex_);
+    ++pending_;
+  }
+  cv_.notify_one();
+}
+
+std::size_t ThreadPoolExecutor::getConcurrency() const { return threads_.size(); }
+
+void ThreadPoolExecutor::run(std::size_t index)
+{
+  current_pool = this;
+  current_queue = index;
+
+  std::function<void()> task;
+  while (true)
+  {
+    if (pop(index, task))
+    {
+      runTask(task);
+      task = nullptr;
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return stop_ || pending_ > 0; });
+    if (stop_ && pending_ == 0)
+      return;
+  }
+}
+
+bool ThreadPoolExecutor::pop(std::size_t index, std::function<void()>& task)
+{
+  // The most recent task of the own queue is the most likely to still be in cache
+  {
+    Queue& queue = *queues_[index];
+    std::scoped_lock lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --pending_;
+      return true;
+    }
+  }
+
+  // Steal the oldest task of another queue
+  for (std::size_t i = 1; i < queues_.size(); ++i)
+  {
+    Queue& queue = *queues_[(index + i) % queues_.size()];
+    std::scoped_lock lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --pending_;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void SequentialExecutor::submit(std::function<void()> task) { runTask(task); }
+
+FunctionExecutor::FunctionExecutor(SubmitFn submit, std::size_t concurrency)
+  : submit_(std::move(submit)), concurrency_(std::max<std::size_t>(concurrency, 1))
+{
+  if (!submit_)
+    throw std::runtime_error("FunctionExecutor, the submit function is empty!");
+}
+
+void FunctionExecutor::submit(std::function<void()> task) { submit_(std::move(task)); }
+
+Executor::Ptr getDefaultExecutor()
+{
+  DefaultExecutorHolder& holder = DefaultExecutorHolder::getInstance();
+  std::scoped_lock lock(holder.mutex);
+  if (holder.executor == nullptr)
+    holder.executor = std::make_shared<ThreadPoolExecutor>();
+
+  return holder.executor;
+}
+
+void setDefaultExecutor(Executor::Ptr executor)
+{
+  DefaultExecutorHolder& holder = DefaultExecutorHolder::getInstance();
+  std::scoped_lock lock(holder.mutex);
+  holder.executor = std::move(executor);
+}
+
+}  // namespace tesseract_common
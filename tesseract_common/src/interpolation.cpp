@@ -0,0 +1,154 @@
+/**
+ * @file interpolation.cpp
+ * @brief Joint space interpolation shared by collision checking and trajectory playback
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/interpolation.h>
+
+namespace tesseract_common
+{
+void interpolateLinear(TrajArray& states,
+                       const Eigen::Ref<const Eigen::VectorXd>& start,
+                       const Eigen::Ref<const Eigen::VectorXd>& end,
+                       long num_states)
+{
+  if (num_states < 2)
+    throw std::runtime_error("interpolateLinear: The number of states must be at least two!");
+
+  if (start.size() != end.size())
+    throw std::runtime_error("interpolateLinear: The start and end must have the same size!");
+
+  if (states.rows() != num_states || states.cols() != start.size())
+    states.resize(num_states, start.size());
+
+  // Each row is contiguous, so a state is calculated for all joints at once
+  const Eigen::VectorXd step = (end - start) / static_cast<double>(num_states - 1);
+  for (long i = 0; i < num_states - 1; ++i)
+    states.row(i) = (start + (static_cast<double>(i) * step)).transpose();
+
+  states.row(num_states - 1) = end.transpose();
+}
+
+void interpolateSegment(Eigen::Ref<Eigen::VectorXd> position,
+                        const JointState& start,
+                        const JointState& end,
+                        double s,
+                        InterpolationType type)
+{
+  const Eigen::Index dof = start.position.size();
+  if (end.position.size() != dof || position.size() != dof)
+    throw std::runtime_error("interpolateSegment: The joint states and position must have the same size!");
+
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+  switch (type)
+  {
+    case InterpolationType::LINEAR:
+    {
+      position = start.position + (s * (end.position - start.position));
+      break;
+    }
+    case InterpolationType::CUBIC:
+    {
+      // Cubic hermite basis
+      position = ((2 * s3 - 3 * s2 + 1) * start.position) + ((-2 * s3 + 3 * s2) * end.position);
+
+      const double dt = end.time - start.time;
+      if (start.velocity.size() == dof)
+        position += ((s3 - 2 * s2 + s) * dt) * start.velocity;
+
+      if (end.velocity.size() == dof)
+        position += ((s3 - s2) * dt) * end.velocity;
+
+      break;
+    }
+    case InterpolationType::QUINTIC:
+    {
+      // Quintic hermite basis
+      const double s4 = s3 * s;
+      const double s5 = s4 * s;
+      position = ((1 - 10 * s3 + 15 * s4 - 6 * s5) * start.position) + ((10 * s3 - 15 * s4 + 6 * s5) * end.position);
+
+      const double dt = end.time - start.time;
+      if (start.velocity.size() == dof)
+        position += ((s - 6 * s3 + 8 * s4 - 3 * s5) * dt) * start.velocity;
+
+      if (end.velocity.size() == dof)
+        position += ((-4 * s3 + 7 * s4 - 3 * s5) * dt) * end.velocity;
+
+      if (start.acceleration.size() == dof)
+        position += ((0.5 * s2 - 1.5 * s3 + 1.5 * s4 - 0.5 * s5) * dt * dt) * start.acceleration;
+
+      if (end.acceleration.size() == dof)
+        position += ((0.5 * s3 - s4 + 0.5 * s5) * dt * dt) * end.acceleration;
+
+      break;
+    }
+  }
+}
+
+void resampleJointTrajectory(TrajArray& positions,
+                             const JointTrajectory& trajectory,
+                             const Eigen::Ref<const Eigen::VectorXd>& times,
+                             InterpolationType type)
+{
+  if (trajectory.empty())
+    throw std::runtime_error("resampleJointTrajectory: The trajectory is empty!");
+
+  const Eigen::Index dof = trajectory.front().position.size();
+  if (positions.rows() != times.size() || positions.cols() != dof)
+    positions.resize(times.size(), dof);
+
+  auto compare = [](double time, const JointState& state) { return time < state.time; };
+  for (Eigen::Index i = 0; i < times.size(); ++i)
+  {
+    // The rows are contiguous so they can be written in place
+    Eigen::Map<Eigen::VectorXd> position(positions.row(i).data(), dof);
+
+    // The first state with a time after the requested time is the end of the segment
+    auto it = std::upper_bound(trajectory.begin(), trajectory.end(), times(i), compare);
+    if (it == trajectory.begin())
+    {
+      position = trajectory.front().position;
+      continue;
+    }
+
+    if (it == trajectory.end())
+    {
+      position = trajectory.back().position;
+      continue;
+    }
+
+    const JointState& start = *std::prev(it);
+    const JointState& end = *it;
+    const double s = (times(i) - start.time) / (end.time - start.time);
+    interpolateSegment(position, start, end, s, type);
+  }
+}
+}  // namespace tesseract_common
@@ -25,9 +25,12 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/array.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
+#include <stdexcept>
+#include <type_traits>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
@@ -164,10 +167,110 @@ void JointTrajectory::emplace_back(Args&&... args)
 void JointTrajectory::pop_back() { states.pop_back(); }
 void JointTrajectory::swap(std::vector<value_type>& other) { states.swap(other); }
 
+namespace
+{
+/**
+ * @brief Save the states of a trajectory as a few contiguous arrays
+ * @details Consecutive states usually share their joint names, so each distinct list of names is stored once
+ */
+void saveCompactStates(boost::archive::binary_oarchive& ar, const std::vector<JointState>& states)
+{
+  std::vector<std::vector<std::string>> joint_names;
+  std::vector<std::size_t> joint_names_index;
+  std::vector<long> sizes;
+  std::vector<double> times;
+  std::vector<double> values;
+  joint_names_index.reserve(states.size());
+  sizes.reserve(4 * states.size());
+  times.reserve(states.size());
+  for (const auto& state : states)
+  {
+    if (joint_names.empty() || joint_names.back() != state.joint_names)
+      joint_names.push_back(state.joint_names);
+
+    joint_names_index.push_back(joint_names.size() - 1);
+    times.push_back(state.time);
+    for (const Eigen::VectorXd* v : { &state.position, &state.velocity, &state.acceleration, &state.effort })
+    {
+      sizes.push_back(v->size());
+      values.insert(values.end(), v->data(), v->data() + v->size());
+    }
+  }
+
+  std::size_t count = states.size();
+  std::size_t value_count = values.size();
+  ar& BOOST_SERIALIZATION_NVP(count);
+  ar& BOOST_SERIALIZATION_NVP(joint_names);
+  ar& boost::serialization::make_nvp("joint_names_index",
+                                     boost::serialization::make_array(joint_names_index.data(), count));
+  ar& boost::serialization::make_nvp("sizes", boost::serialization::make_array(sizes.data(), sizes.size()));
+  ar& boost::serialization::make_nvp("times", boost::serialization::make_array(times.data(), count));
+  ar& BOOST_SERIALIZATION_NVP(value_count);
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), value_count));
+}
+
+/** @brief Load the states of a trajectory saved with saveCompactStates */
+void loadCompactStates(boost::archive::binary_iarchive& ar, std::vector<JointState>& states)
+{
+  std::size_t count{ 0 };
+  std::vector<std::vector<std::string>> joint_names;
+  ar& BOOST_SERIALIZATION_NVP(count);
+  ar& BOOST_SERIALIZATION_NVP(joint_names);
+
+  std::vector<std::size_t> joint_names_index(count);
+  std::vector<long> sizes(4 * count);
+  std::vector<double> times(count);
+  ar& boost::serialization::make_nvp("joint_names_index",
+                                     boost::serialization::make_array(joint_names_index.data(), count));
+  ar& boost::serialization::make_nvp("sizes", boost::serialization::make_array(sizes.data(), sizes.size()));
+  ar& boost::serialization::make_nvp("times", boost::serialization::make_array(times.data(), count));
+
+  std::size_t value_count{ 0 };
+  ar& BOOST_SERIALIZATION_NVP(value_count);
+  std::vector<double> values(value_count);
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), value_count));
+
+  states.clear();
+  states.resize(count);
+  std::size_t value_index{ 0 };
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    JointState& state = states[i];
+    state.joint_names = joint_names.at(joint_names_index[i]);
+    state.time = times[i];
+    std::size_t vector_index{ 0 };
+    for (Eigen::VectorXd* v : { &state.position, &state.velocity, &state.acceleration, &state.effort })
+    {
+      const long size = sizes[(4 * i) + vector_index++];
+      if (size < 0 || value_index + static_cast<std::size_t>(size) > value_count)
+        throw std::runtime_error("JointTrajectory, the compact states are corrupt!");
+
+      *v = Eigen::Map<const Eigen::VectorXd>(values.data() + value_index, size);
+      value_index += static_cast<std::size_t>(size);
+    }
+  }
+}
+}  // namespace
+
 template <class Archive>
 void JointTrajectory::serialize(Archive& ar, const unsigned int version)  // NOLINT
 {
-  ar& BOOST_SERIALIZATION_NVP(states);
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Binary archives are used for logging and IPC, so the states are stored as contiguous arrays
+    saveCompactStates(ar, states);
+  }
+  else if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+      loadCompactStates(ar, states);
+    else
+      ar& BOOST_SERIALIZATION_NVP(states);
+  }
+  else
+  {
+    ar& BOOST_SERIALIZATION_NVP(states);
+  }
   ar& BOOST_SERIALIZATION_NVP(description);
 }
 
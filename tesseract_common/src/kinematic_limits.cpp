@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <numeric>
+#include <stdexcept>
+#include <string>
 #include <boost/serialization/nvp.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -35,6 +37,106 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_common
 {
+namespace
+{
+using RowMajorXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * @brief Calculate the finite differences of the rows of values
+ * @param values The values, each row is a sample
+ * @param sample_times The time of each sample, replaced by the times of the differences which are the midpoints
+ * @return The differences, one row less than the values
+ */
+Eigen::ArrayXXd differentiate(const Eigen::Ref<const Eigen::ArrayXXd>& values, Eigen::ArrayXd& sample_times)
+{
+  const Eigen::Index n = values.rows() - 1;
+  if (n < 1)
+  {
+    sample_times.resize(0);
+    return Eigen::ArrayXXd(0, values.cols());
+  }
+
+  const Eigen::ArrayXd dt = sample_times.tail(n) - sample_times.head(n);
+  Eigen::ArrayXXd differences = (values.bottomRows(n) - values.topRows(n)).colwise() / dt;
+  const Eigen::ArrayXd midpoints = 0.5 * (sample_times.tail(n) + sample_times.head(n));
+  sample_times = midpoints;
+  return differences;
+}
+
+/**
+ * @brief Find the first and worst ratio above the limit
+ * @param violation The violation to update
+ * @param ratios The ratio of each value to its limit, each row is a state
+ * @param offset The index of the state of the first row
+ * @param tolerance The ratio to a limit above one which is still considered to satisfy the limit
+ */
+void checkRatios(TrajectoryLimitViolation& violation,
+                 const Eigen::Ref<const Eigen::ArrayXXd>& ratios,
+                 Eigen::Index offset,
+                 double tolerance)
+{
+  if (ratios.size() == 0)
+    return;
+
+  Eigen::Index row{ 0 };
+  Eigen::Index col{ 0 };
+  violation.max_ratio = ratios.maxCoeff(&row, &col);
+  violation.worst_state = row + offset;
+  violation.worst_joint = col;
+  if (violation.max_ratio <= 1 + tolerance)
+    return;
+
+  const Eigen::Array<bool, Eigen::Dynamic, 1> exceeded = (ratios > 1 + tolerance).rowwise().any();
+  for (Eigen::Index i = 0; i < exceeded.size(); ++i)
+  {
+    if (exceeded(i))
+    {
+      violation.first_state = i + offset;
+      return;
+    }
+  }
+}
+
+/** @brief Check the size of a limit, returns false if it is empty and should not be checked */
+bool checkLimitSize(const Eigen::Ref<const Eigen::VectorXd>& limit, Eigen::Index num_joints, const std::string& name)
+{
+  if (limit.size() == 0)
+    return false;
+
+  if (limit.size() != num_joints)
+    throw std::runtime_error("checkTrajectoryLimits, the " + name + " limits size does not match the trajectory!");
+
+  return true;
+}
+
+/** @brief Check the positions of a trajectory and the times, returns the times as an array */
+Eigen::ArrayXd checkTrajectoryPositions(TrajectoryLimitsResult& result,
+                                        const Eigen::Ref<const RowMajorXd>& positions,
+                                        const Eigen::Ref<const Eigen::VectorXd>& times,
+                                        const KinematicLimits& limits,
+                                        double tolerance)
+{
+  if (times.size() != positions.rows())
+    throw std::runtime_error("checkTrajectoryLimits, the number of times does not match the trajectory!");
+
+  if (limits.joint_limits.rows() != positions.cols())
+    throw std::runtime_error("checkTrajectoryLimits, the position limits size does not match the trajectory!");
+
+  const Eigen::ArrayXd sample_times = times.array();
+  const Eigen::Index n = sample_times.size() - 1;
+  if (n > 0 && !((sample_times.tail(n) - sample_times.head(n)) > 0).all())
+    throw std::runtime_error("checkTrajectoryLimits, the times must be strictly increasing!");
+
+  const Eigen::ArrayXd center = 0.5 * (limits.joint_limits.col(1) + limits.joint_limits.col(0)).array();
+  const Eigen::ArrayXd half_range = 0.5 * (limits.joint_limits.col(1) - limits.joint_limits.col(0)).array();
+  const Eigen::ArrayXXd ratios =
+      (positions.array().rowwise() - center.transpose()).abs().rowwise() / half_range.transpose();
+  checkRatios(result.position, ratios, 0, tolerance);
+
+  return sample_times;
+}
+}  // namespace
+
 void KinematicLimits::resize(Eigen::Index size)
 {
   joint_limits.resize(size, 2);
@@ -53,6 +155,101 @@ bool KinematicLimits::operator==(const KinematicLimits& rhs) const
 
 bool KinematicLimits::operator!=(const KinematicLimits& rhs) const { return !operator==(rhs); }
 
+Eigen::Index TrajectoryLimitsResult::getFirstViolation() const
+{
+  Eigen::Index first{ -1 };
+  for (const auto* violation : { &position, &velocity, &acceleration, &jerk })
+  {
+    if (violation->first_state >= 0 && (first < 0 || violation->first_state < first))
+      first = violation->first_state;
+  }
+  return first;
+}
+
+bool TrajectoryLimitsResult::satisfied() const { return (getFirstViolation() < 0); }
+
+TrajectoryLimitsResult checkTrajectoryLimits(const Eigen::Ref<const RowMajorXd>& positions,
+                                             const Eigen::Ref<const Eigen::VectorXd>& times,
+                                             const KinematicLimits& limits,
+                                             const Eigen::Ref<const Eigen::VectorXd>& jerk_limits,
+                                             double tolerance)
+{
+  TrajectoryLimitsResult result;
+  Eigen::ArrayXd sample_times = checkTrajectoryPositions(result, positions, times, limits, tolerance);
+
+  const Eigen::Index num_joints = positions.cols();
+  const bool check_velocity = checkLimitSize(limits.velocity_limits, num_joints, "velocity");
+  const bool check_acceleration = checkLimitSize(limits.acceleration_limits, num_joints, "acceleration");
+  const bool check_jerk = checkLimitSize(jerk_limits, num_joints, "jerk");
+  if (!check_velocity && !check_acceleration && !check_jerk)
+    return result;
+
+  const Eigen::ArrayXXd velocities = differentiate(positions.array(), sample_times);
+  if (check_velocity)
+    checkRatios(result.velocity, velocities.abs().rowwise() / limits.velocity_limits.array().transpose(), 1, tolerance);
+
+  if (!check_acceleration && !check_jerk)
+    return result;
+
+  const Eigen::ArrayXXd accelerations = differentiate(velocities, sample_times);
+  if (check_acceleration)
+  {
+    checkRatios(result.acceleration,
+                accelerations.abs().rowwise() / limits.acceleration_limits.array().transpose(),
+                2,
+                tolerance);
+  }
+
+  if (check_jerk)
+  {
+    const Eigen::ArrayXXd jerks = differentiate(accelerations, sample_times);
+    checkRatios(result.jerk, jerks.abs().rowwise() / jerk_limits.array().transpose(), 3, tolerance);
+  }
+
+  return result;
+}
+
+TrajectoryLimitsResult checkTrajectoryLimits(const Eigen::Ref<const RowMajorXd>& positions,
+                                             const Eigen::Ref<const RowMajorXd>& velocities,
+                                             const Eigen::Ref<const RowMajorXd>& accelerations,
+                                             const Eigen::Ref<const Eigen::VectorXd>& times,
+                                             const KinematicLimits& limits,
+                                             const Eigen::Ref<const Eigen::VectorXd>& jerk_limits,
+                                             double tolerance)
+{
+  if (velocities.rows() != positions.rows() || velocities.cols() != positions.cols() ||
+      accelerations.rows() != positions.rows() || accelerations.cols() != positions.cols())
+    throw std::runtime_error("checkTrajectoryLimits, the velocities and accelerations must match the positions!");
+
+  TrajectoryLimitsResult result;
+  Eigen::ArrayXd sample_times = checkTrajectoryPositions(result, positions, times, limits, tolerance);
+
+  const Eigen::Index num_joints = positions.cols();
+  if (checkLimitSize(limits.velocity_limits, num_joints, "velocity"))
+  {
+    checkRatios(result.velocity,
+                velocities.array().abs().rowwise() / limits.velocity_limits.array().transpose(),
+                0,
+                tolerance);
+  }
+
+  if (checkLimitSize(limits.acceleration_limits, num_joints, "acceleration"))
+  {
+    checkRatios(result.acceleration,
+                accelerations.array().abs().rowwise() / limits.acceleration_limits.array().transpose(),
+                0,
+                tolerance);
+  }
+
+  if (checkLimitSize(jerk_limits, num_joints, "jerk"))
+  {
+    const Eigen::ArrayXXd jerks = differentiate(accelerations.array(), sample_times);
+    checkRatios(result.jerk, jerks.abs().rowwise() / jerk_limits.array().transpose(), 1, tolerance);
+  }
+
+  return result;
+}
+
 template <class Archive>
 void KinematicLimits::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
 {
@@ -100,6 +297,26 @@ enforcePositionLimits<float>(Eigen::Ref<Eigen::Matrix<float, Eigen::Dynamic, 1>>
 template void
 enforcePositionLimits<double>(Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, 1>> joint_positions,
                               const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>>& position_limits);
+
+template Eigen::Array<bool, Eigen::Dynamic, 1> satisfiesPositionLimitsBatch<float>(
+    const Eigen::Ref<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<float, Eigen::Dynamic, 2>>& position_limits,
+    float max_diff,
+    float max_rel_diff);
+
+template Eigen::Array<bool, Eigen::Dynamic, 1> satisfiesPositionLimitsBatch<double>(
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>& joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>>& position_limits,
+    double max_diff,
+    double max_rel_diff);
+
+template void enforcePositionLimitsBatch<float>(
+    Eigen::Ref<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<float, Eigen::Dynamic, 2>>& position_limits);
+
+template void enforcePositionLimitsBatch<double>(
+    Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> joint_positions,
+    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 2>>& position_limits);
 }  // namespace tesseract_common
 
 #include <tesseract_common/serialization.h>
@@ -0,0 +1,161 @@
+/**
+ * @file link_transforms.cpp
+ * @brief A contiguous container of link transforms addressed by index
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/link_transforms.h>
+
+namespace tesseract_common
+{
+LinkNameTable::LinkNameTable(std::vector<std::string> link_names) : names_(std::move(link_names))
+{
+  indices_.reserve(names_.size());
+  for (std::size_t i = 0; i < names_.size(); ++i)
+  {
+    if (!indices_.emplace(names_[i], static_cast<int>(i)).second)
+      throw std::runtime_error("LinkNameTable, link name '" + names_[i] + "' is repeated!");
+
+    const NameId id(names_[i]);
+    if (id.getId() >= name_id_indices_.size())
+      name_id_indices_.resize(id.getId() + 1, -1);
+
+    name_id_indices_[id.getId()] = static_cast<int>(i);
+  }
+}
+
+LinkTransforms::LinkTransforms(LinkNameTable::ConstPtr name_table)
+  : name_table_(std::move(name_table))
+  , transforms_((name_table_ != nullptr) ? name_table_->size() : 0, Eigen::Isometry3d::Identity())
+{
+}
+
+LinkTransforms::LinkTransforms(LinkNameTable::ConstPtr name_table, const TransformMap& transforms)
+  : LinkTransforms(std::move(name_table))
+{
+  assign(transforms);
+}
+
+LinkTransforms::LinkTransforms(const TransformMap& transforms)
+{
+  std::vector<std::string> link_names;
+  link_names.reserve(transforms.size());
+  transforms_.reserve(transforms.size());
+  for (const auto& transform : transforms)
+  {
+    link_names.push_back(transform.first);
+    transforms_.push_back(transform.second);
+  }
+
+  name_table_ = std::make_shared<const LinkNameTable>(std::move(link_names));
+}
+
+const std::vector<std::string>& LinkTransforms::getNames() const
+{
+  static const std::vector<std::string> empty_names;
+  return (name_table_ != nullptr) ? name_table_->getNames() : empty_names;
+}
+
+const Eigen::Isometry3d* LinkTransforms::find(const std::string& link_name) const
+{
+  const int index = (name_table_ != nullptr) ? name_table_->getIndex(link_name) : -1;
+  return (index >= 0) ? &transforms_[static_cast<std::size_t>(index)] : nullptr;
+}
+
+Eigen::Isometry3d* LinkTransforms::find(const std::string& link_name)
+{
+  return const_cast<Eigen::Isometry3d*>(std::as_const(*this).find(link_name));  // NOLINT
+}
+
+const Eigen::Isometry3d* LinkTransforms::find(const NameId& link_name) const
+{
+  const int index = (name_table_ != nullptr) ? name_table_->getIndex(link_name) : -1;
+  return (index >= 0) ? &transforms_[static_cast<std::size_t>(index)] : nullptr;
+}
+
+Eigen::Isometry3d* LinkTransforms::find(const NameId& link_name)
+{
+  return const_cast<Eigen::Isometry3d*>(std::as_const(*this).find(link_name));  // NOLINT
+}
+
+const Eigen::Isometry3d& LinkTransforms::at(const std::string& link_name) const
+{
+  const Eigen::Isometry3d* transform = find(link_name);
+  if (transform == nullptr)
+    throw std::out_of_range("LinkTransforms, link '" + link_name + "' does not exist!");
+
+  return *transform;
+}
+
+Eigen::Isometry3d& LinkTransforms::at(const std::string& link_name)
+{
+  return const_cast<Eigen::Isometry3d&>(std::as_const(*this).at(link_name));  // NOLINT
+}
+
+void LinkTransforms::assign(const TransformMap& transforms)
+{
+  const std::vector<std::string>& link_names = getNames();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    auto it = transforms.find(link_names[i]);
+    if (it == transforms.end())
+      throw std::runtime_error("LinkTransforms, link '" + link_names[i] + "' is missing from the transform map!");
+
+    transforms_[i] = it->second;
+  }
+}
+
+TransformMap LinkTransforms::toTransformMap() const
+{
+  TransformMap transforms;
+  const std::vector<std::string>& link_names = getNames();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    transforms.emplace_hint(transforms.end(), link_names[i], transforms_[i]);
+
+  return transforms;
+}
+
+bool LinkTransforms::operator==(const LinkTransforms& rhs) const
+{
+  if (transforms_.size() != rhs.transforms_.size())
+    return false;
+
+  if (name_table_ != rhs.name_table_ && getNames() != rhs.getNames())
+    return false;
+
+  for (std::size_t i = 0; i < transforms_.size(); ++i)
+  {
+    if (!transforms_[i].isApprox(rhs.transforms_[i], 1e-5))
+      return false;
+  }
+
+  return true;
+}
+
+bool LinkTransforms::operator!=(const LinkTransforms& rhs) const { return !operator==(rhs); }
+
+}  // namespace tesseract_common
@@ -0,0 +1,92 @@
+/**
+ * @file memory_usage.cpp
+ * @brief A report of the memory used by objects, counting shared storage once
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ostream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/memory_usage.h>
+
+namespace tesseract_common
+{
+MemoryUsage::MemoryUsage(std::string name) : name(std::move(name)) {}
+
+MemoryUsage& MemoryUsage::addChild(std::string child_name) { return children.emplace_back(std::move(child_name)); }
+
+const MemoryUsage* MemoryUsage::getChild(const std::string& child_name) const
+{
+  for (const auto& child : children)
+  {
+    if (child.name == child_name)
+      return &child;
+  }
+
+  return nullptr;
+}
+
+std::size_t MemoryUsage::getTotalUniqueBytes() const
+{
+  std::size_t bytes = unique_bytes;
+  for (const auto& child : children)
+    bytes += child.getTotalUniqueBytes();
+
+  return bytes;
+}
+
+std::size_t MemoryUsage::getTotalSharedBytes() const
+{
+  std::size_t bytes = shared_bytes;
+  for (const auto& child : children)
+    bytes += child.getTotalSharedBytes();
+
+  return bytes;
+}
+
+std::size_t MemoryUsage::getTotalBytes() const { return getTotalUniqueBytes() + getTotalSharedBytes(); }
+
+void MemoryUsage::print(std::ostream& os, std::size_t max_depth) const { print(os, 0, max_depth); }
+
+void MemoryUsage::print(std::ostream& os, std::size_t depth, std::size_t max_depth) const
+{
+  os << std::string(2 * depth, ' ') << name << ": " << getTotalBytes() << " bytes (unique " << getTotalUniqueBytes()
+     << ", shared " << getTotalSharedBytes() << ")\n";
+
+  if (depth >= max_depth)
+    return;
+
+  for (const auto& child : children)
+    child.print(os, depth + 1, max_depth);
+}
+
+std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage)
+{
+  usage.print(os);
+  return os;
+}
+
+bool MemoryUsageTracker::visit(const void* object) { return visited_.insert(object).second; }
+
+void MemoryUsageTracker::clear() { visited_.clear(); }
+}  // namespace tesseract_common
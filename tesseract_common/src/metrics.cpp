@@ -0,0 +1,324 @@
+/**
+ * @file metrics.cpp
+ * @brief Process wide runtime metrics with Prometheus export
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/metrics.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief Escape a label value, Prometheus requires backslash, double quote and line feed to be escaped */
+std::string escapeLabelValue(const std::string& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char c : value)
+  {
+    if (c == '\\')
+      escaped += "\\\\";
+    else if (c == '"')
+      escaped += "\\\"";
+    else if (c == '\n')
+      escaped += "\\n";
+    else
+      escaped += c;
+  }
+  return escaped;
+}
+
+/** @brief Format labels as the comma separated body of a Prometheus label set, without the braces */
+std::string formatLabels(const MetricLabels& labels)
+{
+  std::string formatted;
+  for (const auto& label : labels)
+  {
+    if (!formatted.empty())
+      formatted += ',';
+
+    formatted += label.first + "=\"" + escapeLabelValue(label.second) + "\"";
+  }
+  return formatted;
+}
+
+/** @brief Write a label set, an extra label like the histogram bucket bound is appended */
+void writeLabels(std::ostream& os, const std::string& labels, const std::string& extra = std::string())
+{
+  if (labels.empty() && extra.empty())
+    return;
+
+  os << '{' << labels;
+  if (!labels.empty() && !extra.empty())
+    os << ',';
+  os << extra << '}';
+}
+}  // namespace
+
+std::size_t getMetricShard()
+{
+  static std::atomic<std::size_t> next_shard{ 0 };
+  thread_local const std::size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % METRIC_SHARD_COUNT;
+  return shard;
+}
+
+std::uint64_t MetricCounter::getValue() const
+{
+  std::uint64_t value{ 0 };
+  for (const auto& shard : shards_)
+    value += shard.value.load(std::memory_order_relaxed);
+
+  return value;
+}
+
+void MetricCounter::reset()
+{
+  for (auto& shard : shards_)
+    shard.value.store(0, std::memory_order_relaxed);
+}
+
+double MetricHistogram::getBucketBound(std::size_t bucket)
+{
+  return static_cast<double>(FIRST_BUCKET_BOUND << bucket) * 1e-9;
+}
+
+void MetricHistogram::observe(std::chrono::nanoseconds duration)
+{
+  const auto ns = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 0));
+
+  std::size_t bucket{ 0 };
+  std::uint64_t bound{ FIRST_BUCKET_BOUND };
+  while (bucket < BUCKET_COUNT && ns > bound)
+  {
+    bound <<= 1;
+    ++bucket;
+  }
+
+  Shard& shard = shards_[getMetricShard()];
+  shard.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  shard.sum_ns.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void MetricHistogram::observe(double seconds)
+{
+  observe(std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(seconds * 1e9)));
+}
+
+std::uint64_t MetricHistogram::getCount() const
+{
+  std::uint64_t count{ 0 };
+  for (const auto& shard : shards_)
+  {
+    for (const auto& bucket : shard.buckets)
+      count += bucket.load(std::memory_order_relaxed);
+  }
+
+  return count;
+}
+
+double MetricHistogram::getSum() const
+{
+  std::uint64_t sum_ns{ 0 };
+  for (const auto& shard : shards_)
+    sum_ns += shard.sum_ns.load(std::memory_order_relaxed);
+
+  return static_cast<double>(sum_ns) * 1e-9;
+}
+
+std::vector<std::uint64_t> MetricHistogram::getBucketCounts() const
+{
+  std::vector<std::uint64_t> counts(BUCKET_COUNT + 1, 0);
+  for (const auto& shard : shards_)
+  {
+    for (std::size_t i = 0; i < counts.size(); ++i)
+      counts[i] += shard.buckets[i].load(std::memory_order_relaxed);
+  }
+
+  return counts;
+}
+
+double MetricHistogram::getQuantile(double q) const
+{
+  const std::vector<std::uint64_t> counts = getBucketCounts();
+  std::uint64_t total{ 0 };
+  for (const auto count : counts)
+    total += count;
+
+  if (total == 0)
+    return 0;
+
+  const double rank = std::min(std::max(q, 0.0), 1.0) * static_cast<double>(total);
+  std::uint64_t cumulative{ 0 };
+  for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+  {
+    if (counts[i] == 0)
+      continue;
+
+    const std::uint64_t previous = cumulative;
+    cumulative += counts[i];
+    if (static_cast<double>(cumulative) >= rank)
+    {
+      const double lower = (i == 0) ? 0.0 : getBucketBound(i - 1);
+      const double upper = getBucketBound(i);
+      const double fraction = (rank - static_cast<double>(previous)) / static_cast<double>(counts[i]);
+      return lower + (fraction * (upper - lower));
+    }
+  }
+
+  // The rank is in the overflow bucket, which has no upper bound
+  return getBucketBound(BUCKET_COUNT - 1);
+}
+
+void MetricHistogram::reset()
+{
+  for (auto& shard : shards_)
+  {
+    for (auto& bucket : shard.buckets)
+      bucket.store(0, std::memory_order_relaxed);
+
+    shard.sum_ns.store(0, std::memory_order_relaxed);
+  }
+}
+
+MetricsRegistry& MetricsRegistry::getInstance()
+{
+  // Intentionally never destroyed so metrics can be recorded by static objects in any order
+  static auto* registry = new MetricsRegistry();
+  return *registry;
+}
+
+MetricsRegistry::Family& MetricsRegistry::getFamily(const std::string& name, const std::string& help, bool histogram)
+{
+  auto it = families_.find(name);
+  if (it == families_.end())
+  {
+    Family& family = families_[name];
+    family.help = help;
+    family.histogram = histogram;
+    return family;
+  }
+
+  if (it->second.histogram != histogram)
+    throw std::runtime_error("MetricsRegistry, metric '" + name + "' is already registered with a different type!");
+
+  return it->second;
+}
+
+MetricCounter& MetricsRegistry::getCounter(const std::string& name, const std::string& help, const MetricLabels& labels)
+{
+  std::scoped_lock lock(mutex_);
+  auto& counter = getFamily(name, help, false).counters[formatLabels(labels)];
+  if (counter == nullptr)
+    counter = std::make_unique<MetricCounter>();
+
+  return *counter;
+}
+
+MetricHistogram& MetricsRegistry::getHistogram(const std::string& name,
+                                               const std::string& help,
+                                               const MetricLabels& labels)
+{
+  std::scoped_lock lock(mutex_);
+  auto& histogram = getFamily(name, help, true).histograms[formatLabels(labels)];
+  if (histogram == nullptr)
+    histogram = std::make_unique<MetricHistogram>();
+
+  return *histogram;
+}
+
+void MetricsRegistry::writePrometheus(std::ostream& os) const
+{
+  std::ostringstream bound;
+  bound.imbue(std::locale::classic());
+  bound << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  std::scoped_lock lock(mutex_);
+  for (const auto& family : families_)
+  {
+    const std::string& name = family.first;
+    os << "# HELP " << name << ' ' << family.second.help << '\n';
+    os << "# TYPE " << name << ' ' << (family.second.histogram ? "histogram" : "counter") << '\n';
+
+    for (const auto& counter : family.second.counters)
+    {
+      os << name;
+      writeLabels(os, counter.first);
+      os << ' ' << counter.second->getValue() << '\n';
+    }
+
+    for (const auto& histogram : family.second.histograms)
+    {
+      // Prometheus buckets are cumulative
+      const std::vector<std::uint64_t> counts = histogram.second->getBucketCounts();
+      std::uint64_t cumulative{ 0 };
+      for (std::size_t i = 0; i < counts.size(); ++i)
+      {
+        cumulative += counts[i];
+        bound.str(std::string());
+        if (i < MetricHistogram::BUCKET_COUNT)
+          bound << MetricHistogram::getBucketBound(i);
+        else
+          bound << "+Inf";
+
+        os << name << "_bucket";
+        writeLabels(os, histogram.first, "le=\"" + bound.str() + "\"");
+        os << ' ' << cumulative << '\n';
+      }
+
+      bound.str(std::string());
+      bound << histogram.second->getSum();
+      os << name << "_sum";
+      writeLabels(os, histogram.first);
+      os << ' ' << bound.str() << '\n';
+
+      os << name << "_count";
+      writeLabels(os, histogram.first);
+      os << ' ' << cumulative << '\n';
+    }
+  }
+}
+
+void MetricsRegistry::reset()
+{
+  std::scoped_lock lock(mutex_);
+  for (auto& family : families_)
+  {
+    for (auto& counter : family.second.counters)
+      counter.second->reset();
+
+    for (auto& histogram : family.second.histograms)
+      histogram.second->reset();
+  }
+}
+
+}  // namespace tesseract_common
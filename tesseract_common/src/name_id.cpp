@@ -0,0 +1,123 @@
+/**
+ * @file name_id.cpp
+ * @brief Interned link and joint names
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/name_id.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief The process wide symbol table of interned names */
+struct NameTable
+{
+  std::shared_mutex mutex;
+
+  /** @brief The entries indexed by id, a deque so the entries never move */
+  std::deque<NameId::Entry> entries;
+
+  /** @brief The entry of each name, the keys view the names stored in the entries */
+  std::unordered_map<std::string_view, const NameId::Entry*> lookup;
+
+  NameTable() { intern(std::string()); }
+
+  const NameId::Entry* find(std::string_view name)
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = lookup.find(name);
+    return (it != lookup.end()) ? it->second : nullptr;
+  }
+
+  const NameId::Entry* intern(const std::string& name)
+  {
+    if (const NameId::Entry* entry = find(name))
+      return entry;
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = lookup.find(name);
+    if (it != lookup.end())
+      return it->second;
+
+    if (entries.size() >= std::numeric_limits<uint32_t>::max())
+      throw std::runtime_error("NameId, too many names were interned!");
+
+    NameId::Entry& entry = entries.emplace_back();
+    entry.name = name;
+    entry.hash = std::hash<std::string>()(name);
+    entry.id = static_cast<uint32_t>(entries.size() - 1);
+    lookup.emplace(entry.name, &entry);
+    return &entry;
+  }
+
+  static NameTable& getInstance()
+  {
+    // Intentionally never destroyed so names can be used by static objects in any order
+    static auto* table = new NameTable();
+    return *table;
+  }
+};
+
+const NameId::Entry* getEmptyEntry()
+{
+  static const NameId::Entry* entry = NameTable::getInstance().intern(std::string());
+  return entry;
+}
+}  // namespace
+
+NameId::NameId() : entry_(getEmptyEntry()) {}
+
+NameId::NameId(const std::string& name) : entry_(NameTable::getInstance().intern(name)) {}
+
+NameId::NameId(const char* name) : NameId(std::string(name)) {}
+
+bool NameId::find(const std::string& name, NameId& id)
+{
+  const Entry* entry = NameTable::getInstance().find(name);
+  if (entry == nullptr)
+    return false;
+
+  id = NameId(entry);
+  return true;
+}
+
+std::size_t NameId::size()
+{
+  NameTable& table = NameTable::getInstance();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  return table.entries.size();
+}
+
+std::ostream& operator<<(std::ostream& os, const NameId& name) { return os << name.getName(); }
+
+}  // namespace tesseract_common
@@ -30,7 +30,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
 #include <cassert>
 #include <iostream>
+#include <cstdlib>
 #include <mutex>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -44,6 +47,33 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_common
 {
+namespace
+{
+/** @brief The default size limit of the resource content cache, 256 MiB */
+const std::size_t RESOURCE_CACHE_DEFAULT_MAX_SIZE = 1ULL << 28U;
+
+/** @brief Read a file by memory mapping it, so the contents are copied once from the page cache */
+std::shared_ptr<const std::vector<uint8_t>> readFile(const std::string& file_path, std::uintmax_t file_size)
+{
+  auto contents = std::make_shared<std::vector<uint8_t>>();
+  if (file_size == 0)
+    return contents;
+
+  try
+  {
+    boost::interprocess::file_mapping file(file_path.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+    const auto* data = static_cast<const uint8_t*>(region.get_address());
+    contents->assign(data, data + region.get_size());  // NOLINT
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {
+    return nullptr;
+  }
+  return contents;
+}
+}  // namespace
+
 bool ResourceLocator::operator==(const ResourceLocator& /*rhs*/) const { return true; }
 bool ResourceLocator::operator!=(const ResourceLocator& /*rhs*/) const { return false; }
 
@@ -160,6 +190,11 @@ void GeneralResourceLocator::serialize(Archive& ar, const unsigned int /*version
 bool Resource::operator==(const Resource& /*rhs*/) const { return true; }
 bool Resource::operator!=(const Resource& /*rhs*/) const { return false; }
 
+std::shared_ptr<const std::vector<uint8_t>> Resource::getSharedResourceContents() const
+{
+  return std::make_shared<const std::vector<uint8_t>>(getResourceContents());
+}
+
 template <class Archive>
 void Resource::serialize(Archive& /*ar*/, const unsigned int /*version*/)
 {
@@ -176,24 +211,17 @@ std::string SimpleLocatedResource::getUrl() const { return url_; }
 
 std::string SimpleLocatedResource::getFilePath() const { return filename_; }
 
-std::vector<uint8_t> SimpleLocatedResource::getResourceContents() const
-{
-  // https://codereview.stackexchange.com/questions/22901/reading-all-bytes-from-a-file
+std::vector<uint8_t> SimpleLocatedResource::getResourceContents() const { return *getSharedResourceContents(); }
 
-  std::ifstream ifs(filename_, std::ios::binary | std::ios::ate);
-  if (ifs.fail())
+std::shared_ptr<const std::vector<uint8_t>> SimpleLocatedResource::getSharedResourceContents() const
+{
+  std::shared_ptr<const std::vector<uint8_t>> contents = ResourceContentCache::getInstance().getContents(filename_);
+  if (contents == nullptr)
   {
     CONSOLE_BRIDGE_logError("Could not read all bytes from file: %s", filename_.c_str());
-    return {};
+    return std::make_shared<const std::vector<uint8_t>>();
   }
-  std::ifstream::pos_type pos = ifs.tellg();
-
-  std::vector<uint8_t> file_contents(static_cast<size_t>(pos));
-
-  ifs.seekg(0, std::ios::beg);
-  ifs.read(reinterpret_cast<std::ifstream::char_type*>(&file_contents[0]), pos);  // NOLINT
-
-  return file_contents;
+  return contents;
 }
 
 std::shared_ptr<std::istream> SimpleLocatedResource::getResourceContentStream() const
@@ -251,25 +279,37 @@ void SimpleLocatedResource::serialize(Archive& ar, const unsigned int /*version*
 }
 
 BytesResource::BytesResource(std::string url, std::vector<uint8_t> bytes, ResourceLocator::ConstPtr parent)
-  : url_(std::move(url)), bytes_(std::move(bytes)), parent_(std::move(parent))
+  : url_(std::move(url))
+  , bytes_(std::make_shared<const std::vector<uint8_t>>(std::move(bytes)))
+  , parent_(std::move(parent))
 {
 }
 
 BytesResource::BytesResource(std::string url, const uint8_t* bytes, size_t bytes_len, ResourceLocator::ConstPtr parent)
   : url_(std::move(url))
-  , bytes_(std::vector<uint8_t>(bytes, bytes + bytes_len))  // NOLINT
+  , bytes_(std::make_shared<const std::vector<uint8_t>>(bytes, bytes + bytes_len))  // NOLINT
   , parent_(std::move(parent))
 {
 }
 
+BytesResource::BytesResource(std::string url,
+                             std::shared_ptr<const std::vector<uint8_t>> bytes,
+                             ResourceLocator::ConstPtr parent)
+  : url_(std::move(url)), bytes_(std::move(bytes)), parent_(std::move(parent))
+{
+  if (bytes_ == nullptr)
+    bytes_ = std::make_shared<const std::vector<uint8_t>>();
+}
+
 bool BytesResource::isFile() const { return false; }
 std::string BytesResource::getUrl() const { return url_; }
 std::string BytesResource::getFilePath() const { return ""; }
-std::vector<uint8_t> BytesResource::getResourceContents() const { return bytes_; }
+std::vector<uint8_t> BytesResource::getResourceContents() const { return *bytes_; }
+std::shared_ptr<const std::vector<uint8_t>> BytesResource::getSharedResourceContents() const { return bytes_; }
 std::shared_ptr<std::istream> BytesResource::getResourceContentStream() const
 {
   std::shared_ptr<std::stringstream> o = std::make_shared<std::stringstream>();
-  o->write((const char*)&bytes_.at(0), static_cast<std::streamsize>(bytes_.size()));  // NOLINT
+  o->write((const char*)&bytes_->at(0), static_cast<std::streamsize>(bytes_->size()));  // NOLINT
   o->seekg(0, o->beg);
   return o;
 }
@@ -301,7 +341,7 @@ bool BytesResource::operator==(const BytesResource& rhs) const
   bool equal = true;
   equal &= Resource::operator==(rhs);
   equal &= url_ == rhs.url_;
-  equal &= bytes_ == rhs.bytes_;
+  equal &= (bytes_ == rhs.bytes_ || *bytes_ == *rhs.bytes_);
   equal &= tesseract_common::pointersEqual(parent_, rhs.parent_);
   return equal;
 }
@@ -309,14 +349,138 @@ bool BytesResource::operator==(const BytesResource& rhs) const
 bool BytesResource::operator!=(const BytesResource& rhs) const { return !operator==(rhs); }
 
 template <class Archive>
-void BytesResource::serialize(Archive& ar, const unsigned int /*version*/)
+void BytesResource::save(Archive& ar, const unsigned int /*version*/) const
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Resource);
+  ar& BOOST_SERIALIZATION_NVP(url_);
+  ar& boost::serialization::make_nvp("bytes_", *bytes_);
+  ar& BOOST_SERIALIZATION_NVP(parent_);
+}
+
+template <class Archive>
+void BytesResource::load(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Resource);
   ar& BOOST_SERIALIZATION_NVP(url_);
-  ar& BOOST_SERIALIZATION_NVP(bytes_);
+  std::vector<uint8_t> bytes;
+  ar& boost::serialization::make_nvp("bytes_", bytes);
+  bytes_ = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
   ar& BOOST_SERIALIZATION_NVP(parent_);
 }
 
+ResourceContentCache::ResourceContentCache() : max_size_(RESOURCE_CACHE_DEFAULT_MAX_SIZE)
+{
+  if (const char* max_size = std::getenv("TESSERACT_RESOURCE_CACHE_MAX_SIZE"))
+  {
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(max_size, &end, 10);
+    if (end != max_size && *end == '\0')
+      max_size_ = static_cast<std::size_t>(value);
+    else
+      CONSOLE_BRIDGE_logWarn("ResourceContentCache, TESSERACT_RESOURCE_CACHE_MAX_SIZE is not a number of bytes: '%s'",
+                             max_size);
+  }
+}
+
+ResourceContentCache& ResourceContentCache::getInstance()
+{
+  static ResourceContentCache cache;
+  return cache;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> ResourceContentCache::getContents(const std::string& file_path)
+{
+  boost::system::error_code ec;
+  const std::uintmax_t file_size = fs::file_size(file_path, ec);
+  if (ec)
+    return nullptr;
+
+  const std::time_t write_time = fs::last_write_time(file_path, ec);
+  if (ec)
+    return nullptr;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookup_.find(file_path);
+    if (it != lookup_.end())
+    {
+      if (it->second->file_size == file_size && it->second->write_time == write_time)
+      {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->contents;
+      }
+
+      size_ -= it->second->contents->size();
+      entries_.erase(it->second);
+      lookup_.erase(it);
+    }
+  }
+
+  // The file is read without holding the lock, so files are read concurrently
+  std::shared_ptr<const std::vector<uint8_t>> contents = readFile(file_path, file_size);
+  if (contents == nullptr || contents->size() != file_size)
+    return contents;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_size > max_size_)
+    return contents;
+
+  // Another thread may have read the same file, keep the first result so the buffer is shared
+  auto it = lookup_.find(file_path);
+  if (it != lookup_.end())
+  {
+    if (it->second->file_size == file_size && it->second->write_time == write_time)
+      return it->second->contents;
+
+    size_ -= it->second->contents->size();
+    entries_.erase(it->second);
+    lookup_.erase(it);
+  }
+
+  entries_.push_front(Entry{ file_path, file_size, write_time, contents });
+  lookup_[file_path] = entries_.begin();
+  size_ += contents->size();
+  trim();
+  return contents;
+}
+
+void ResourceContentCache::setMaxSize(std::size_t max_size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_size_ = max_size;
+  trim();
+}
+
+std::size_t ResourceContentCache::getMaxSize() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_size_;
+}
+
+std::size_t ResourceContentCache::getSize() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+void ResourceContentCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  lookup_.clear();
+  size_ = 0;
+}
+
+void ResourceContentCache::trim()
+{
+  while (size_ > max_size_ && !entries_.empty())
+  {
+    size_ -= entries_.back().contents->size();
+    lookup_.erase(entries_.back().file_path);
+    entries_.pop_back();
+  }
+}
+
 }  // namespace tesseract_common
 
 #include <tesseract_common/serialization.h>
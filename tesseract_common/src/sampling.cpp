@@ -0,0 +1,197 @@
+/**
+ * @file sampling.cpp
+ * @brief Batch sampling of joint states within limits
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/sampling.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief The number of samples drawn by a task of the parallel samplers */
+const Eigen::Index SAMPLE_BLOCK_SIZE = 1024;
+
+std::atomic<uint32_t> random_seed{ static_cast<uint32_t>(std::time(nullptr)) };
+
+/** @brief Incremented when the seed is set so the thread generators know to reseed */
+std::atomic<uint32_t> random_seed_generation{ 0 };
+
+std::atomic<uint32_t> random_thread_count{ 0 };
+
+struct ThreadRandomGenerator
+{
+  uint32_t thread_index{ random_thread_count++ };
+  uint32_t generation{ std::numeric_limits<uint32_t>::max() };
+  std::mt19937 generator;
+};
+
+/** @brief The first count primes, the bases of the Halton sequence */
+std::vector<uint32_t> getPrimes(Eigen::Index count)
+{
+  std::vector<uint32_t> primes;
+  primes.reserve(static_cast<std::size_t>(count));
+  for (uint32_t candidate = 2; static_cast<Eigen::Index>(primes.size()) < count; ++candidate)
+  {
+    if (std::all_of(primes.begin(), primes.end(), [candidate](uint32_t prime) {
+          return prime * prime > candidate || candidate % prime != 0;
+        }))
+      primes.push_back(candidate);
+  }
+  return primes;
+}
+
+/** @brief The radical inverse of an index in a base, the element of the van der Corput sequence */
+double radicalInverse(uint64_t index, uint32_t base)
+{
+  const double inv_base = 1.0 / static_cast<double>(base);
+  double factor = inv_base;
+  double value = 0;
+  while (index > 0)
+  {
+    value += factor * static_cast<double>(index % base);
+    index /= base;
+    factor *= inv_base;
+  }
+  return value;
+}
+
+void sampleHaltonBlock(Eigen::Ref<TrajArray> samples,
+                       const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                       const std::vector<uint32_t>& primes,
+                       uint64_t offset)
+{
+  for (Eigen::Index i = 0; i < samples.rows(); ++i)
+  {
+    // The first element of the sequence is the lower limit of every joint so it is skipped
+    const uint64_t index = offset + static_cast<uint64_t>(i) + 1;
+    for (Eigen::Index j = 0; j < limits.rows(); ++j)
+    {
+      const double u = radicalInverse(index, primes[static_cast<std::size_t>(j)]);
+      samples(i, j) = limits(j, 0) + u * (limits(j, 1) - limits(j, 0));
+    }
+  }
+}
+
+void checkSampleSize(const Eigen::Ref<TrajArray>& samples, const Eigen::Ref<const Eigen::MatrixX2d>& limits)
+{
+  if (samples.cols() != limits.rows())
+    throw std::runtime_error("Sampling, the samples must have a column for each limit!");
+}
+
+/** @brief Run a sampler over the blocks of the samples */
+void parallelSample(TrajArray& samples,
+                    const Executor::Ptr& executor,
+                    const std::function<void(Eigen::Ref<TrajArray>, Eigen::Index, std::size_t)>& fn)
+{
+  const Eigen::Index count = samples.rows();
+  const auto blocks = static_cast<std::size_t>((count + SAMPLE_BLOCK_SIZE - 1) / SAMPLE_BLOCK_SIZE);
+  Executor& block_executor = (executor != nullptr) ? *executor : *getDefaultExecutor();
+  block_executor.parallelFor(blocks, [&samples, &fn, count](std::size_t block) {
+    const Eigen::Index begin = static_cast<Eigen::Index>(block) * SAMPLE_BLOCK_SIZE;
+    const Eigen::Index rows = std::min(SAMPLE_BLOCK_SIZE, count - begin);
+    fn(samples.middleRows(begin, rows), begin, block);
+  });
+}
+}  // namespace
+
+std::mt19937& getThreadRandomGenerator()
+{
+  thread_local ThreadRandomGenerator thread_generator;
+  const uint32_t generation = random_seed_generation.load(std::memory_order_acquire);
+  if (thread_generator.generation != generation)
+  {
+    std::seed_seq seed{ random_seed.load(), thread_generator.thread_index };
+    thread_generator.generator.seed(seed);
+    thread_generator.generation = generation;
+  }
+  return thread_generator.generator;
+}
+
+void setRandomSeed(uint32_t seed)
+{
+  random_seed = seed;
+  random_seed_generation.fetch_add(1, std::memory_order_release);
+}
+
+void sampleUniform(Eigen::Ref<TrajArray> samples,
+                   const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                   std::mt19937& generator)
+{
+  checkSampleSize(samples, limits);
+
+  // Scale a unit sample instead of a distribution per joint, which also tolerates inverted limits
+  const Eigen::VectorXd lower = limits.col(0);
+  const Eigen::VectorXd range = limits.col(1) - limits.col(0);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  for (Eigen::Index i = 0; i < samples.rows(); ++i)
+  {
+    for (Eigen::Index j = 0; j < limits.rows(); ++j)
+      samples(i, j) = lower(j) + unit(generator) * range(j);
+  }
+}
+
+TrajArray sampleUniform(const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                        Eigen::Index count,
+                        uint32_t seed,
+                        const Executor::Ptr& executor)
+{
+  TrajArray samples(count, limits.rows());
+  parallelSample(samples, executor, [&limits, seed](Eigen::Ref<TrajArray> block, Eigen::Index, std::size_t index) {
+    std::seed_seq block_seed{ seed, static_cast<uint32_t>(index) };
+    std::mt19937 generator(block_seed);
+    sampleUniform(block, limits, generator);
+  });
+  return samples;
+}
+
+void sampleHalton(Eigen::Ref<TrajArray> samples, const Eigen::Ref<const Eigen::MatrixX2d>& limits, uint64_t offset)
+{
+  checkSampleSize(samples, limits);
+  sampleHaltonBlock(samples, limits, getPrimes(limits.rows()), offset);
+}
+
+TrajArray sampleHalton(const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                       Eigen::Index count,
+                       uint64_t offset,
+                       const Executor::Ptr& executor)
+{
+  TrajArray samples(count, limits.rows());
+  const std::vector<uint32_t> primes = getPrimes(limits.rows());
+  parallelSample(
+      samples, executor, [&limits, &primes, offset](Eigen::Ref<TrajArray> block, Eigen::Index begin, std::size_t) {
+        sampleHaltonBlock(block, limits, primes, offset + static_cast<uint64_t>(begin));
+      });
+  return samples;
+}
+
+}  // namespace tesseract_common
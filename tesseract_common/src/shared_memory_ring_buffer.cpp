@@ -0,0 +1,231 @@
+/**
+ * @file shared_memory_ring_buffer.cpp
+ * @brief A ring buffer of fixed size slots in shared memory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/shared_memory_ring_buffer.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief Identifies a shared memory object created by SharedMemoryRingBuffer */
+constexpr uint64_t RING_BUFFER_MAGIC = 0x5445535352494E47;  // "TESSRING"
+
+/** @brief Slots start on their own cache line so the writer and readers of different slots do not share one */
+constexpr std::size_t RING_BUFFER_ALIGNMENT = 64;
+
+/** @brief The number of times readLatest tries again when the writer overwrites the newest message */
+constexpr int RING_BUFFER_READ_ATTEMPTS = 16;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory requires lock free atomics");
+
+struct RingBufferHeader
+{
+  uint64_t magic{ RING_BUFFER_MAGIC };
+  uint64_t layout_id{ 0 };
+  uint64_t slot_size{ 0 };
+  uint64_t slot_stride{ 0 };
+  uint64_t slot_count{ 0 };
+  std::atomic<uint64_t> write_sequence{ 0 };
+};
+
+/** @brief The sequence number of a slot is odd while it is written and 2 * (sequence + 1) once it holds a message */
+struct RingBufferSlotHeader
+{
+  std::atomic<uint64_t> sequence{ 0 };
+};
+
+constexpr std::size_t alignUp(std::size_t size)
+{
+  return (size + RING_BUFFER_ALIGNMENT - 1) & ~(RING_BUFFER_ALIGNMENT - 1);
+}
+
+constexpr std::size_t RING_BUFFER_HEADER_SIZE = alignUp(sizeof(RingBufferHeader));
+constexpr std::size_t RING_BUFFER_SLOT_HEADER_SIZE = alignUp(sizeof(RingBufferSlotHeader));
+}  // namespace
+
+struct SharedMemoryRingBuffer::Implementation
+{
+  std::string name;
+  bool writer{ false };
+  boost::interprocess::mapped_region region;
+  RingBufferHeader* header{ nullptr };
+
+  uint8_t* slotBegin(uint64_t sequence) const
+  {
+    auto* data = static_cast<uint8_t*>(region.get_address());
+    return data + RING_BUFFER_HEADER_SIZE + ((sequence % header->slot_count) * header->slot_stride);
+  }
+
+  RingBufferSlotHeader* slotHeader(uint64_t sequence) const
+  {
+    return reinterpret_cast<RingBufferSlotHeader*>(slotBegin(sequence));  // NOLINT
+  }
+
+  uint8_t* slotData(uint64_t sequence) const { return slotBegin(sequence) + RING_BUFFER_SLOT_HEADER_SIZE; }
+};
+
+SharedMemoryRingBuffer::SharedMemoryRingBuffer(std::string name,
+                                               std::size_t slot_size,
+                                               std::size_t slot_count,
+                                               uint64_t layout_id)
+  : impl_(std::make_unique<Implementation>())
+{
+  namespace bip = boost::interprocess;
+  if (slot_size == 0 || slot_count == 0)
+    throw std::runtime_error("SharedMemoryRingBuffer, the slot size and count must be greater than zero!");
+
+  impl_->name = std::move(name);
+  impl_->writer = true;
+  const std::size_t slot_stride = RING_BUFFER_SLOT_HEADER_SIZE + alignUp(slot_size);
+  try
+  {
+    bip::shared_memory_object::remove(impl_->name.c_str());
+    bip::shared_memory_object shm(bip::create_only, impl_->name.c_str(), bip::read_write);
+    shm.truncate(static_cast<bip::offset_t>(RING_BUFFER_HEADER_SIZE + (slot_stride * slot_count)));
+    impl_->region = bip::mapped_region(shm, bip::read_write);
+  }
+  catch (const bip::interprocess_exception& e)
+  {
+    throw std::runtime_error("SharedMemoryRingBuffer, failed to create '" + impl_->name + "': " + e.what());
+  }
+
+  auto* data = static_cast<uint8_t*>(impl_->region.get_address());
+  for (std::size_t i = 0; i < slot_count; ++i)
+    new (data + RING_BUFFER_HEADER_SIZE + (i * slot_stride)) RingBufferSlotHeader();
+
+  // The header is written last, so a reader does not open the buffer before its slots are initialized
+  auto* header = new (data) RingBufferHeader();
+  header->layout_id = layout_id;
+  header->slot_size = slot_size;
+  header->slot_stride = slot_stride;
+  header->slot_count = slot_count;
+  std::atomic_thread_fence(std::memory_order_release);
+  impl_->header = header;
+}
+
+SharedMemoryRingBuffer::SharedMemoryRingBuffer(std::string name, uint64_t layout_id)
+  : impl_(std::make_unique<Implementation>())
+{
+  namespace bip = boost::interprocess;
+  impl_->name = std::move(name);
+  try
+  {
+    bip::shared_memory_object shm(bip::open_only, impl_->name.c_str(), bip::read_only);
+    impl_->region = bip::mapped_region(shm, bip::read_only);
+  }
+  catch (const bip::interprocess_exception& e)
+  {
+    throw std::runtime_error("SharedMemoryRingBuffer, failed to open '" + impl_->name + "': " + e.what());
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  auto* header = static_cast<RingBufferHeader*>(impl_->region.get_address());
+  if (impl_->region.get_size() < RING_BUFFER_HEADER_SIZE || header->magic != RING_BUFFER_MAGIC ||
+      impl_->region.get_size() < RING_BUFFER_HEADER_SIZE + (header->slot_stride * header->slot_count))
+    throw std::runtime_error("SharedMemoryRingBuffer, '" + impl_->name + "' is not a ring buffer!");
+
+  if (header->layout_id != layout_id)
+    throw std::runtime_error("SharedMemoryRingBuffer, the layout of '" + impl_->name + "' does not match!");
+
+  impl_->header = header;
+}
+
+SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+{
+  if (impl_->writer)
+    boost::interprocess::shared_memory_object::remove(impl_->name.c_str());
+}
+
+const std::string& SharedMemoryRingBuffer::getName() const { return impl_->name; }
+
+std::size_t SharedMemoryRingBuffer::getSlotSize() const { return impl_->header->slot_size; }
+
+std::size_t SharedMemoryRingBuffer::getSlotCount() const { return impl_->header->slot_count; }
+
+uint64_t SharedMemoryRingBuffer::getWriteSequence() const
+{
+  return impl_->header->write_sequence.load(std::memory_order_acquire);
+}
+
+uint64_t SharedMemoryRingBuffer::write(const std::function<void(uint8_t*)>& fill)
+{
+  if (!impl_->writer)
+    throw std::runtime_error("SharedMemoryRingBuffer, '" + impl_->name + "' was opened for reading!");
+
+  const uint64_t sequence = impl_->header->write_sequence.load(std::memory_order_relaxed);
+  RingBufferSlotHeader* slot = impl_->slotHeader(sequence);
+  slot->sequence.store((2 * sequence) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  fill(impl_->slotData(sequence));
+
+  slot->sequence.store(2 * (sequence + 1), std::memory_order_release);
+  impl_->header->write_sequence.store(sequence + 1, std::memory_order_release);
+  return sequence;
+}
+
+bool SharedMemoryRingBuffer::read(uint64_t sequence, const std::function<void(const uint8_t*)>& consume) const
+{
+  const RingBufferSlotHeader* slot = impl_->slotHeader(sequence);
+  const uint64_t expected = 2 * (sequence + 1);
+  if (slot->sequence.load(std::memory_order_acquire) != expected)
+    return false;
+
+  consume(impl_->slotData(sequence));
+
+  // The message is valid only if the writer did not start to reuse the slot while it was read
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return (slot->sequence.load(std::memory_order_relaxed) == expected);
+}
+
+bool SharedMemoryRingBuffer::readLatest(const std::function<void(const uint8_t*)>& consume, uint64_t* sequence) const
+{
+  for (int attempt = 0; attempt < RING_BUFFER_READ_ATTEMPTS; ++attempt)
+  {
+    const uint64_t write_sequence = getWriteSequence();
+    if (write_sequence == 0)
+      return false;
+
+    if (read(write_sequence - 1, consume))
+    {
+      if (sequence != nullptr)
+        *sequence = write_sequence - 1;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace tesseract_common
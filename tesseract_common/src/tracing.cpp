@@ -0,0 +1,168 @@
+/**
+ * @file tracing.cpp
+ * @brief Scoped trace zones for profiling the libraries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_common
+{
+namespace
+{
+/** @brief The events recorded by a thread */
+struct ThreadEvents
+{
+  std::mutex mutex;
+  std::size_t thread{ 0 };
+  std::vector<TraceEvent> events;
+};
+
+/** @brief The events of every thread which recorded a zone */
+struct TraceRegistry
+{
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadEvents>> threads;
+  std::atomic<Tracer::Clock::rep> epoch{ Tracer::Clock::now().time_since_epoch().count() };
+
+  static TraceRegistry& getInstance()
+  {
+    // Intentionally never destroyed so zones can be recorded by static objects in any order
+    static auto* registry = new TraceRegistry();
+    return *registry;
+  }
+};
+
+ThreadEvents& getThreadEvents()
+{
+  thread_local std::shared_ptr<ThreadEvents> thread_events = [] {
+    TraceRegistry& registry = TraceRegistry::getInstance();
+    std::scoped_lock<std::mutex> lock(registry.mutex);
+    auto events = std::make_shared<ThreadEvents>();
+    events->thread = registry.threads.size();
+    registry.threads.push_back(events);
+    return events;
+  }();
+  return *thread_events;
+}
+
+void writeJsonString(std::ostream& os, const char* str)
+{
+  os << '"';
+  for (const char* c = str; *c != '\0'; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      os << '\\';
+    os << *c;
+  }
+  os << '"';
+}
+}  // namespace
+
+std::atomic<bool> Tracer::recording_{ false };
+
+void Tracer::start()
+{
+  clear();
+  TraceRegistry::getInstance().epoch = Clock::now().time_since_epoch().count();
+  recording_ = true;
+}
+
+void Tracer::stop() { recording_ = false; }
+
+void Tracer::clear()
+{
+  TraceRegistry& registry = TraceRegistry::getInstance();
+  std::scoped_lock<std::mutex> lock(registry.mutex);
+  for (auto& thread_events : registry.threads)
+  {
+    std::scoped_lock<std::mutex> thread_lock(thread_events->mutex);
+    thread_events->events.clear();
+  }
+}
+
+std::vector<TraceEvent> Tracer::getEvents()
+{
+  std::vector<TraceEvent> events;
+  TraceRegistry& registry = TraceRegistry::getInstance();
+  std::scoped_lock<std::mutex> lock(registry.mutex);
+  for (auto& thread_events : registry.threads)
+  {
+    std::scoped_lock<std::mutex> thread_lock(thread_events->mutex);
+    events.insert(events.end(), thread_events->events.begin(), thread_events->events.end());
+  }
+
+  std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.start < b.start; });
+  return events;
+}
+
+void Tracer::writeChromeTrace(std::ostream& os)
+{
+  const std::vector<TraceEvent> events = getEvents();
+  os << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < events.size(); ++i)
+  {
+    const TraceEvent& event = events[i];
+    os << ((i == 0) ? "\n" : ",\n") << "{\"name\":";
+    writeJsonString(os, event.name);
+    os << ",\"cat\":\"tesseract\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+       << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+       << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+  }
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+bool Tracer::writeChromeTrace(const std::string& file_path)
+{
+  std::ofstream os(file_path);
+  if (!os.is_open())
+    return false;
+
+  writeChromeTrace(os);
+  return os.good();
+}
+
+void Tracer::record(const char* name, Clock::time_point start, Clock::time_point end)
+{
+  const Clock::time_point epoch(Clock::duration(TraceRegistry::getInstance().epoch.load(std::memory_order_relaxed)));
+
+  TraceEvent event;
+  event.name = name;
+  event.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch).count();
+  event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  ThreadEvents& thread_events = getThreadEvents();
+  event.thread = thread_events.thread;
+
+  std::scoped_lock<std::mutex> lock(thread_events.mutex);
+  thread_events.events.push_back(event);
+}
+
+}  // namespace tesseract_common
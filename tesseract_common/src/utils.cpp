@@ -26,6 +26,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
 #include <ctime>
 #include <string>
 #include <type_traits>
@@ -34,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
+#include <tesseract_common/sampling.h>
 
 namespace tesseract_common
 {
@@ -121,58 +123,124 @@ Eigen::VectorXd concat(const Eigen::VectorXd& a, const Eigen::VectorXd& b)
   return out;
 }
 
+namespace
+{
+/**
+ * @brief The rotation vector of a unit quaternion, 2 * atan2(|v|, w) * v / |v|
+ * @details The angle is in [0, PI] if w is positive, otherwise in [PI, 2 * PI]
+ */
+Eigen::Vector3d quaternionLog(const Eigen::Quaterniond& q)
+{
+  const double n = q.vec().norm();
+
+  // For small angles atan2(n, w) / n approaches 1 / w, using it avoids dividing by zero
+  if (n < 1e-7)
+    return (2.0 / q.w()) * q.vec();
+
+  return (2.0 * std::atan2(n, q.w()) / n) * q.vec();
+}
+}  // namespace
+
 Eigen::Vector3d calcRotationalError(const Eigen::Ref<const Eigen::Matrix3d>& R)
 {
+  // Flipping the quaternion to a positive w keeps the angle on [-pi, pi]
   Eigen::Quaterniond q(R);
-  Eigen::AngleAxisd r12(q);
+  if (q.w() < 0)
+    q.coeffs() = -q.coeffs();
 
-  // Eigen angle axis flips the sign of axis so rotation is always positive which is
-  // not ideal for numerical differentiation.
-  int s = (q.vec().dot(r12.axis()) < 0) ? -1 : 1;
+  return quaternionLog(q);
+}
 
-  // Make sure that the angle is on [-pi, pi]
-  const static double two_pi = 2.0 * M_PI;
-  double angle = s * r12.angle();
-  Eigen::Vector3d axis = s * r12.axis();
-  angle = copysign(fmod(fabs(angle), two_pi), angle);
-  if (angle < -M_PI)
-    angle += two_pi;
-  else if (angle > M_PI)
-    angle -= two_pi;
+Eigen::Vector3d calcRotationalError2(const Eigen::Ref<const Eigen::Matrix3d>& R)
+{
+  // The quaternion is not flipped, a negative w gives an angle on [pi, 2 * pi] about the opposite axis so the result
+  // does not jump when numerically differentiating about an angle of zero
+  const Eigen::Quaterniond q(R);
+  return quaternionLog(q);
+}
 
-  assert(std::abs(angle) <= M_PI);
+Eigen::VectorXd calcTransformError(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2)
+{
+  return calcTransformErrorFixed(t1, t2);
+}
 
-  return axis * angle;
+Eigen::Matrix<double, 6, 1> calcTransformErrorFixed(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2)
+{
+  // t1.inverse() * t2 without forming the inverse transform
+  const Eigen::Matrix3d r1_t = t1.linear().transpose();
+  const Eigen::Matrix3d r12 = r1_t * t2.linear();
+  Eigen::Matrix<double, 6, 1> error;
+  error.head<3>().noalias() = r1_t * (t2.translation() - t1.translation());
+  error.tail<3>() = calcRotationalError(r12);
+  return error;
 }
 
-Eigen::Vector3d calcRotationalError2(const Eigen::Ref<const Eigen::Matrix3d>& R)
+void calcTransformErrors(Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> errors,
+                         const Eigen::Isometry3d& t1,
+                         const VectorIsometry3d& t2)
 {
-  Eigen::Quaterniond q(R);
-  Eigen::AngleAxisd r12(q);
+  if (errors.cols() != static_cast<Eigen::Index>(t2.size()))
+    throw std::runtime_error("calcTransformErrors, errors must have a column for each transform!");
 
-  // Eigen angle axis flips the sign of axis so rotation is always positive which is
-  // not ideal for numerical differentiation.
-  int s = (q.vec().dot(r12.axis()) < 0) ? -1 : 1;
+  const Eigen::Matrix3d r1_t = t1.linear().transpose();
+  for (std::size_t i = 0; i < t2.size(); ++i)
+  {
+    const auto col = static_cast<Eigen::Index>(i);
+    errors.col(col).head<3>().noalias() = r1_t * (t2[i].translation() - t1.translation());
+    const Eigen::Matrix3d r12 = r1_t * t2[i].linear();
+    errors.col(col).tail<3>() = calcRotationalError(r12);
+  }
+}
 
-  // Make sure that the angle is on [0, 2 * pi]
-  const static double two_pi = 2.0 * M_PI;
-  double angle = s * r12.angle();
-  Eigen::Vector3d axis = s * r12.axis();
-  angle = copysign(fmod(fabs(angle), two_pi), angle);
-  if (angle < 0)
-    angle += two_pi;
-  else if (angle > two_pi)
-    angle -= two_pi;
+void calcTransformErrors(Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> errors,
+                         const VectorIsometry3d& t1,
+                         const VectorIsometry3d& t2)
+{
+  if (t1.size() != t2.size())
+    throw std::runtime_error("calcTransformErrors, the lists of transforms must be the same size!");
 
-  assert(angle <= two_pi && angle >= 0);
+  if (errors.cols() != static_cast<Eigen::Index>(t2.size()))
+    throw std::runtime_error("calcTransformErrors, errors must have a column for each transform!");
 
-  return axis * angle;
+  for (std::size_t i = 0; i < t2.size(); ++i)
+    errors.col(static_cast<Eigen::Index>(i)) = calcTransformErrorFixed(t1[i], t2[i]);
 }
 
-Eigen::VectorXd calcTransformError(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2)
+Eigen::Matrix3d calcRotationalErrorJacobian(const Eigen::Ref<const Eigen::Vector3d>& error)
+{
+  // J^-1 = I - 0.5 * [e]x + (1 / theta^2 - cot(theta / 2) / (2 * theta)) * [e]x^2
+  const double theta_sq = error.squaredNorm();
+  Eigen::Matrix3d skew;
+  skew << 0, -error.z(), error.y(), error.z(), 0, -error.x(), -error.y(), error.x(), 0;
+
+  // The coefficient approaches 1 / 12 + theta^2 / 720 for small angles
+  double coeff{ 0 };
+  if (theta_sq < 1e-8)
+  {
+    coeff = (1.0 / 12.0) + (theta_sq / 720.0);
+  }
+  else
+  {
+    const double theta = std::sqrt(theta_sq);
+    const double half_theta = 0.5 * theta;
+    coeff = (1.0 / theta_sq) - (std::cos(half_theta) / (2.0 * theta * std::sin(half_theta)));
+  }
+
+  return Eigen::Matrix3d::Identity() - (0.5 * skew) + (coeff * (skew * skew));
+}
+
+Eigen::Matrix<double, 6, 6> calcTransformErrorJacobian(const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2)
 {
-  Eigen::Isometry3d pose_err = t1.inverse() * t2;
-  return concat(pose_err.translation(), calcRotationalError(pose_err.rotation()));
+  // The position error R1^T * (p2 - p1) only changes with the linear velocity, and the rotation error
+  // log(R1^T * exp(w) * R2) = log(exp(R1^T * w) * R1^T * R2) only changes with the angular velocity
+  const Eigen::Matrix3d r1_t = t1.linear().transpose();
+  const Eigen::Matrix3d r12 = r1_t * t2.linear();
+  const Eigen::Vector3d rot_error = calcRotationalError(r12);
+
+  Eigen::Matrix<double, 6, 6> jacobian = Eigen::Matrix<double, 6, 6>::Zero();
+  jacobian.topLeftCorner<3, 3>() = r1_t;
+  jacobian.bottomRightCorner<3, 3>().noalias() = calcRotationalErrorJacobian(rot_error) * r1_t;
+  return jacobian;
 }
 
 Eigen::Vector4d computeRandomColor()
@@ -236,7 +304,7 @@ Eigen::VectorXd generateRandomNumber(const Eigen::Ref<const Eigen::MatrixX2d>& l
   for (long i = 0; i < limits.rows(); ++i)
   {
     std::uniform_real_distribution<double> sample(limits(i, 0), limits(i, 1));
-    joint_values(i) = sample(mersenne);
+    joint_values(i) = sample(getThreadRandomGenerator());
   }
   return joint_values;
 }
@@ -1,5 +1,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -245,6 +247,135 @@ TEST(TesseractCloneCacheUnit, SupportsUpdateFailure)  // NOLINT
   }
 }
 
+TEST(TesseractCloneCacheUnit, Checkout)  // NOLINT
+{
+  auto original = std::make_shared<TestObject>();
+  original->val_1 = 1;
+  auto clone_cache = std::make_shared<CloneCache<TestObject>>(original, 2);
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 2);
+
+  // Checked out objects are returned to the cache and reused
+  TestObject* first{ nullptr };
+  {
+    auto object = clone_cache->checkout();
+    ASSERT_TRUE(object != nullptr);
+    EXPECT_EQ(object->val_1, 1);
+    EXPECT_EQ(clone_cache->getCurrentCacheSize(), 1);
+    first = object.get();
+  }
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 2);
+  {
+    auto object = clone_cache->checkout();
+    EXPECT_EQ(object.get(), first);
+  }
+
+  // Objects are not returned to a full cache
+  {
+    auto object1 = clone_cache->checkout();
+    auto object2 = clone_cache->checkout();
+    auto object3 = clone_cache->checkout();
+    EXPECT_EQ(clone_cache->getCurrentCacheSize(), 0);
+  }
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 2);
+
+  // A returned object which is stale is cloned again when checked out
+  {
+    original->revision_++;
+    original->val_1 = 3;
+    auto object = clone_cache->checkout();
+    EXPECT_EQ(object->val_1, 3);
+    EXPECT_EQ(object->getRevision(), original->getRevision());
+  }
+
+  // Objects may outlive the cache
+  auto object = clone_cache->checkout();
+  clone_cache = nullptr;
+  EXPECT_EQ(object->val_1, 3);
+  object = nullptr;
+}
+
+TEST(TesseractCloneCacheUnit, CheckoutSupportsUpdate)  // NOLINT
+{
+  auto original = std::make_shared<TestObjectSupportsUpdate>();
+  original->val_1 = 1;
+  auto clone_cache = std::make_shared<CloneCache<TestObjectSupportsUpdate>>(original, 1);
+
+  TestObjectSupportsUpdate* first{ nullptr };
+  {
+    auto object = clone_cache->checkout();
+    first = object.get();
+  }
+
+  // The stale object is updated instead of cloned again
+  original->revision_++;
+  original->val_1 = 3;
+  auto object = clone_cache->checkout();
+  EXPECT_EQ(object.get(), first);
+  EXPECT_EQ(object->val_1, 3);
+}
+
+TEST(TesseractCloneCacheUnit, BackgroundReplenishment)  // NOLINT
+{
+  auto original = std::make_shared<TestObject>();
+  original->val_1 = 1;
+  auto clone_cache = std::make_shared<CloneCache<TestObject>>(original, 3);
+  EXPECT_FALSE(clone_cache->getBackgroundReplenishment());
+
+  // A sequential executor refills the cache before clone returns
+  clone_cache->setBackgroundReplenishment(true, std::make_shared<SequentialExecutor>());
+  EXPECT_TRUE(clone_cache->getBackgroundReplenishment());
+  for (int i = 0; i < 5; i++)
+  {
+    auto clone = clone_cache->clone();
+    EXPECT_EQ(clone->val_1, 1);
+    EXPECT_EQ(clone_cache->getCurrentCacheSize(), 3);
+  }
+
+  // A thread pool refills the cache eventually
+  clone_cache->setBackgroundReplenishment(true, std::make_shared<ThreadPoolExecutor>(2));
+  for (int i = 0; i < 3; i++)
+    clone_cache->clone();
+
+  auto start = std::chrono::steady_clock::now();
+  while (clone_cache->getCurrentCacheSize() < 3 && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 3);
+
+  clone_cache->setBackgroundReplenishment(false);
+  EXPECT_FALSE(clone_cache->getBackgroundReplenishment());
+  clone_cache->clone();
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 2);
+}
+
+TEST(TesseractCloneCacheUnit, ConcurrentCheckout)  // NOLINT
+{
+  auto original = std::make_shared<TestObjectSupportsUpdate>();
+  original->val_1 = 1;
+  auto clone_cache = std::make_shared<CloneCache<TestObjectSupportsUpdate>>(original, 4);
+  clone_cache->setBackgroundReplenishment(true, std::make_shared<ThreadPoolExecutor>(2));
+
+  std::vector<std::thread> threads;
+  std::atomic<int> failed{ 0 };
+  for (int t = 0; t < 4; t++)
+  {
+    threads.emplace_back([&clone_cache, &failed]() {
+      for (int i = 0; i < 200; i++)
+      {
+        auto object = (i % 2 == 0) ? clone_cache->checkout() : clone_cache->clone();
+        if (object == nullptr || object->val_1 != 1)
+          ++failed;
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(failed, 0);
+  EXPECT_LE(clone_cache->getCurrentCacheSize(), 4 + 4);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
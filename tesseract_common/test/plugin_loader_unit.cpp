@@ -115,6 +115,30 @@ TEST(TesseractClassLoaderUnit, LoadTestPlugin)  // NOLINT
   }
 }
 
+TEST(TesseractClassLoaderUnit, CacheTestPlugin)  // NOLINT
+{
+  using tesseract_common::ClassLoader;
+  using tesseract_common::TestPluginBase;
+  const std::string lib_name = "tesseract_common_test_plugin_multiply";
+  const std::string lib_dir = std::string(TEST_PLUGIN_DIR);
+  const std::string symbol_name = "plugin";
+
+  // The library is loaded and the instance is created once
+  auto plugin = ClassLoader::createSharedInstance<TestPluginBase>(symbol_name, lib_name, lib_dir);
+  auto cached_plugin = ClassLoader::createSharedInstance<TestPluginBase>(symbol_name, lib_name, lib_dir);
+  ASSERT_TRUE(plugin != nullptr);
+  EXPECT_EQ(plugin, cached_plugin);
+
+  // Clearing the cache keeps the instances in use valid
+  ClassLoader::clearCache();
+  EXPECT_NEAR(plugin->multiply(5, 5), 25, 1e-8);
+
+  auto new_plugin = ClassLoader::createSharedInstance<TestPluginBase>(symbol_name, lib_name, lib_dir);
+  ASSERT_TRUE(new_plugin != nullptr);
+  EXPECT_NEAR(new_plugin->multiply(5, 5), 25, 1e-8);
+  EXPECT_TRUE(ClassLoader::isClassAvailable(symbol_name, lib_name, lib_dir));
+}
+
 TEST(TesseractPluginLoaderUnit, LoadTestPlugin)  // NOLINT
 {
   using tesseract_common::PluginLoader;
@@ -228,6 +252,49 @@ TEST(TesseractPluginLoaderUnit, LoadTestPlugin)  // NOLINT
   }
 }
 
+TEST(TesseractPluginLoaderUnit, StaticPluginRegistry)  // NOLINT
+{
+  using tesseract_common::PluginLoader;
+  using tesseract_common::StaticPluginRegistrar;
+  using tesseract_common::TestPluginBase;
+
+  class StaticTestPlugin : public TestPluginBase
+  {
+  public:
+    double multiply(double x, double y) override { return x * y; }
+  };
+
+  StaticTestPlugin static_plugin;
+
+  {
+    // No libraries are required to find a registered plugin
+    StaticPluginRegistrar registrar("TestBase", "static_plugin", &static_plugin);
+    PluginLoader plugin_loader;
+    EXPECT_TRUE(plugin_loader.isPluginAvailable("static_plugin"));
+    auto plugin = plugin_loader.instantiate<TestPluginBase>("static_plugin");
+    ASSERT_TRUE(plugin != nullptr);
+    EXPECT_EQ(plugin.get(), &static_plugin);
+    EXPECT_NEAR(plugin->multiply(5, 5), 25, 1e-8);
+
+    std::vector<std::string> sections = plugin_loader.getAvailableSections();
+    EXPECT_EQ(sections.size(), 1);
+    EXPECT_EQ(sections.at(0), "TestBase");
+
+    std::vector<std::string> symbols = plugin_loader.getAvailablePlugins<TestPluginBase>();
+    EXPECT_EQ(symbols.size(), 1);
+    EXPECT_EQ(symbols.at(0), "static_plugin");
+    EXPECT_TRUE(plugin_loader.getAvailablePlugins("does_not_exist").empty());
+  }
+
+  {
+    // The plugin is removed when the registrar is destroyed
+    PluginLoader plugin_loader;
+    EXPECT_FALSE(plugin_loader.isPluginAvailable("static_plugin"));
+    EXPECT_TRUE(plugin_loader.instantiate<TestPluginBase>("static_plugin") == nullptr);
+    EXPECT_TRUE(plugin_loader.getAvailableSections().empty());
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -209,6 +209,56 @@ TEST(ResourceLocatorUnit, ByteResourceUnit)  // NOLINT
   EXPECT_TRUE(resource_does_not_exist->getResourceContentStream() == nullptr);
 }
 
+TEST(ResourceLocatorUnit, ResourceContentCacheUnit)  // NOLINT
+{
+  using namespace tesseract_common;
+  ResourceContentCache& cache = ResourceContentCache::getInstance();
+  cache.clear();
+
+  ResourceLocator::Ptr locator = std::make_shared<TestResourceLocator>();
+  Resource::Ptr visual = locator->locateResource("package://tesseract_common/package.xml");
+  Resource::Ptr collision = locator->locateResource("package://tesseract_common/package.xml");
+
+  // Resources referring to the same file share the bytes
+  std::shared_ptr<const std::vector<uint8_t>> visual_contents = visual->getSharedResourceContents();
+  std::shared_ptr<const std::vector<uint8_t>> collision_contents = collision->getSharedResourceContents();
+  EXPECT_FALSE(visual_contents->empty());
+  EXPECT_EQ(visual_contents, collision_contents);
+  EXPECT_EQ(visual->getResourceContents(), *visual_contents);
+  EXPECT_EQ(cache.getSize(), visual_contents->size());
+
+  // A file which changed is read again
+  tesseract_common::fs::path file_path = tesseract_common::fs::temp_directory_path() / "resource_cache_unit.txt";
+  {
+    std::ofstream out(file_path.string());
+    out << "first";
+  }
+  auto file_resource = std::make_shared<SimpleLocatedResource>("file_path", file_path.string());
+  EXPECT_EQ(file_resource->getResourceContents(), std::vector<uint8_t>({ 'f', 'i', 'r', 's', 't' }));
+  {
+    std::ofstream out(file_path.string());
+    out << "second";
+  }
+  EXPECT_EQ(file_resource->getResourceContents(), std::vector<uint8_t>({ 's', 'e', 'c', 'o', 'n', 'd' }));
+  tesseract_common::fs::remove(file_path);
+
+  // Entries are removed once they exceed the size limit, buffers still in use stay valid
+  cache.setMaxSize(0);
+  EXPECT_EQ(cache.getSize(), 0);
+  EXPECT_FALSE(visual_contents->empty());
+  EXPECT_NE(visual->getSharedResourceContents(), visual_contents);
+  EXPECT_EQ(*visual->getSharedResourceContents(), *visual_contents);
+  cache.setMaxSize(1ULL << 28U);
+
+  // Copies of a bytes resource share the bytes
+  auto bytes = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>({ 1, 2, 3 }));
+  BytesResource bytes_resource("url", bytes);
+  BytesResource bytes_resource_copy(bytes_resource);
+  EXPECT_EQ(bytes_resource.getSharedResourceContents(), bytes);
+  EXPECT_EQ(bytes_resource_copy.getSharedResourceContents(), bytes);
+  EXPECT_EQ(bytes_resource, BytesResource("url", std::vector<uint8_t>({ 1, 2, 3 })));
+}
+
 TEST(ResourceLocatorUnit, SimpleLocatedResourceSerializUnit)  // NOLINT
 {
   using namespace tesseract_common;
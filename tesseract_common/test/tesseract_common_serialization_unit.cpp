@@ -25,10 +25,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/nvp.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/compact_serialization.h>
 #include <tesseract_common/eigen_serialization.h>
 #include <tesseract_common/serialization.h>
 #include <tesseract_common/unit_test_utils.h>
@@ -97,6 +101,20 @@ TEST(TesseractCommonSerializeUnit, JointTrajectory)  // NOLINT
   trajectory.description = "this is a test";
 
   tesseract_common::testSerialization<JointTrajectory>(trajectory, "JointTrajectory");
+
+  // Binary archives store the joint names once for consecutive states
+  joint_state.time = 101;
+  joint_state.position = Eigen::VectorXd::Constant(3, 9);
+  trajectory.states.push_back(joint_state);
+  joint_state.time = 102;
+  joint_state.joint_names = { "joint_a", "joint_b" };
+  joint_state.position = Eigen::VectorXd::Constant(2, 1);
+  joint_state.velocity = Eigen::VectorXd();
+  trajectory.states.push_back(joint_state);
+  trajectory.states.emplace_back();
+
+  tesseract_common::testSerialization<JointTrajectory>(trajectory, "JointTrajectoryMixed");
+  tesseract_common::testSerialization<JointTrajectory>(JointTrajectory(), "EmptyJointTrajectory");
 }
 
 TEST(TesseractCommonSerializeUnit, AllowedCollisionMatrix)  // NOLINT
@@ -452,6 +470,23 @@ TEST(TesseractCommonSerializeUnit, Isometry3d)  // NOLINT
     }
 
     EXPECT_TRUE(pose.isApprox(npose, 1e-5));
+
+    {
+      std::ofstream os(tesseract_common::getTempPath() + "eigen_isometry3d_boost.binary", std::ios_base::binary);
+      boost::archive::binary_oarchive oa(os);
+      oa << BOOST_SERIALIZATION_NVP(pose);
+    }
+
+    {
+      std::ifstream ifs(tesseract_common::getTempPath() + "eigen_isometry3d_boost.binary", std::ios_base::binary);
+      assert(ifs.good());
+      boost::archive::binary_iarchive ia(ifs);
+      ia >> BOOST_SERIALIZATION_NVP(npose);
+    }
+
+    // Binary archives store the matrix, so the pose is restored exactly
+    EXPECT_TRUE(pose.isApprox(npose, 1e-12));
+    EXPECT_TRUE(npose.matrix().row(3).isApprox(Eigen::RowVector4d(0, 0, 0, 1)));
   }
 }
 
@@ -496,6 +531,55 @@ TEST(TesseractCommonSerializeUnit, StdAtomic)  // NOLINT
   tesseract_common::testSerialization<TestAtomic>(object, "TestAtomic");
 }
 
+TEST(TesseractCommonSerializeUnit, CompactEncoding)  // NOLINT
+{
+  {  // Indices round trip and neighboring indices take a byte each
+    std::vector<int> indices{ 3, 0, 1, 2, 3, 2, 1, 3, 3, 100000, -5, std::numeric_limits<int>::max(),
+                              std::numeric_limits<int>::min() };
+    std::vector<uint8_t> encoded = encodeDeltaIntegers(indices.data(), indices.size());
+    EXPECT_LT(encoded.size(), indices.size() * sizeof(int));
+
+    std::vector<int> decoded(indices.size());
+    decodeDeltaIntegers(encoded, decoded.data(), decoded.size());
+    EXPECT_EQ(decoded, indices);
+
+    encoded.pop_back();
+    EXPECT_ANY_THROW(decodeDeltaIntegers(encoded, decoded.data(), decoded.size()));  // NOLINT
+  }
+
+  {  // Doubles round trip exactly and compress
+    std::vector<double> points;
+    for (int i = 0; i < 1000; ++i)
+    {
+      points.push_back(0.25 * std::cos(i * 0.01));
+      points.push_back(0.25 * std::sin(i * 0.01));
+      points.push_back(-0.0);
+    }
+    points.push_back(std::numeric_limits<double>::quiet_NaN());
+    points.push_back(std::numeric_limits<double>::infinity());
+    points.push_back(1e-300);
+
+    std::vector<uint8_t> encoded = encodeDoubles(points.data(), points.size(), 3);
+    std::vector<uint8_t> compressed = compressBytes(encoded.data(), encoded.size());
+    EXPECT_LT(compressed.size(), encoded.size());
+
+    std::vector<double> decoded(points.size());
+    decodeDoubles(decompressBytes(compressed, encoded.size()), decoded.data(), decoded.size(), 3);
+    EXPECT_EQ(std::memcmp(decoded.data(), points.data(), points.size() * sizeof(double)), 0);
+
+    EXPECT_ANY_THROW(decompressBytes(compressed, encoded.size() + 1));  // NOLINT
+    compressed.resize(compressed.size() / 2);
+    EXPECT_ANY_THROW(decompressBytes(compressed, encoded.size()));  // NOLINT
+  }
+
+  {  // Empty arrays
+    EXPECT_TRUE(compressBytes(nullptr, 0).empty());
+    EXPECT_TRUE(decompressBytes({}, 0).empty());
+    EXPECT_TRUE(encodeDeltaIntegers(nullptr, 0).empty());
+    EXPECT_TRUE(encodeDoubles(nullptr, 0, 3).empty());
+  }
+}
+
 struct ExtensionMacroTestA
 {
   double a{ 0 };
@@ -1,6 +1,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
 #include <type_traits>
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
@@ -15,6 +17,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/any_poly.h>
 #include <tesseract_common/kinematic_limits.h>
 #include <tesseract_common/yaml_utils.h>
+#include <tesseract_common/allowed_collision_matrix.h>
+#include <tesseract_common/interpolation.h>
+#include <tesseract_common/link_transforms.h>
+#include <tesseract_common/compact_transform.h>
+#include <tesseract_common/name_id.h>
+#include <tesseract_common/executor.h>
+#include <tesseract_common/sampling.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_common/tracing.h>
+#include <tesseract_common/memory_usage.h>
 
 TEST(TesseractCommonUnit, isNumeric)  // NOLINT
 {
@@ -125,6 +137,44 @@ TEST(TesseractCommonUnit, generateRandomNumber)  // NOLINT
   }
 }
 
+TEST(TesseractCommonUnit, samplingUnit)  // NOLINT
+{
+  Eigen::MatrixX2d limits(3, 2);
+  limits << -5, 5, 0, 10, -15, -5;
+
+  // Uniform samples are within the limits and only depend on the seed
+  tesseract_common::TrajArray samples = tesseract_common::sampleUniform(limits, 3000, 42);
+  EXPECT_EQ(samples.rows(), 3000);
+  EXPECT_EQ(samples.cols(), 3);
+  EXPECT_TRUE(tesseract_common::satisfiesPositionLimitsBatch<double>(samples, limits).all());
+
+  auto executor = std::make_shared<tesseract_common::SequentialExecutor>();
+  EXPECT_TRUE(samples.isApprox(tesseract_common::sampleUniform(limits, 3000, 42, executor)));
+  EXPECT_FALSE(samples.isApprox(tesseract_common::sampleUniform(limits, 3000, 43)));
+
+  // Halton samples are within the limits and can be continued from an offset
+  tesseract_common::TrajArray halton = tesseract_common::sampleHalton(limits, 3000);
+  EXPECT_TRUE(tesseract_common::satisfiesPositionLimitsBatch<double>(halton, limits).all());
+  EXPECT_NEAR(halton(0, 0), 0, 1e-12);
+  EXPECT_NEAR(halton(0, 1), 10.0 / 3.0, 1e-12);
+  EXPECT_NEAR(halton(0, 2), -13, 1e-12);
+
+  tesseract_common::TrajArray continued(1000, 3);
+  tesseract_common::sampleHalton(continued, limits, 2000);
+  EXPECT_TRUE(continued.isApprox(halton.bottomRows(1000)));
+
+  tesseract_common::TrajArray wrong_size(10, 2);
+  EXPECT_ANY_THROW(tesseract_common::sampleHalton(wrong_size, limits));  // NOLINT
+  EXPECT_ANY_THROW(  // NOLINT
+      tesseract_common::sampleUniform(wrong_size, limits, tesseract_common::getThreadRandomGenerator()));
+
+  // The thread generator is reproducible after setting the seed
+  tesseract_common::setRandomSeed(7);
+  const Eigen::VectorXd random_numbers = tesseract_common::generateRandomNumber(limits);
+  tesseract_common::setRandomSeed(7);
+  EXPECT_TRUE(random_numbers.isApprox(tesseract_common::generateRandomNumber(limits)));
+}
+
 TEST(TesseractCommonUnit, trim)  // NOLINT
 {
   std::string check1 = "    trim";
@@ -363,6 +413,95 @@ TEST(TesseractCommonUnit, anyUnit)  // NOLINT
   EXPECT_ANY_THROW(nany_type.as<tesseract_common::Toolpath>());  // NOLINT
 }
 
+namespace tesseract_common_test
+{
+/** @brief A type small enough to be stored inline by AnyPoly */
+struct SmallAnyType
+{
+  double value{ 0 };
+
+  bool operator==(const SmallAnyType& rhs) const { return value == rhs.value; }
+  bool operator!=(const SmallAnyType& rhs) const { return !operator==(rhs); }
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+  {
+    ar& BOOST_SERIALIZATION_NVP(value);
+  }
+};
+}  // namespace tesseract_common_test
+
+TESSERACT_ANY_EXPORT(tesseract_common_test, SmallAnyType);  // NOLINT
+
+TEST(TesseractCommonUnit, anyInlineStorageUnit)  // NOLINT
+{
+  using tesseract_common_test::SmallAnyType;
+
+  // Small types are stored inline
+  tesseract_common::AnyPoly small_type(SmallAnyType{ 5.0 });
+  EXPECT_FALSE(small_type.isNull());
+  EXPECT_TRUE(small_type.isInline());
+  EXPECT_DOUBLE_EQ(small_type.as<SmallAnyType>().value, 5.0);
+
+  tesseract_common::AnyPoly small_copy = small_type;
+  EXPECT_TRUE(small_copy.isInline());
+  EXPECT_TRUE(small_copy == small_type);
+  EXPECT_TRUE(&small_copy.as<SmallAnyType>() != &small_type.as<SmallAnyType>());
+
+  tesseract_common::AnyPoly small_move(std::move(small_copy));
+  EXPECT_TRUE(small_move.isInline());
+  EXPECT_TRUE(small_move == small_type);
+  EXPECT_TRUE(small_copy.isNull());  // NOLINT
+
+  // Move only construction of a string does not copy its buffer
+  std::string text(100, 'a');
+  const char* text_data = text.data();
+  tesseract_common::AnyPoly string_type(std::move(text));
+  EXPECT_TRUE(string_type.isInline());
+  EXPECT_EQ(string_type.as<std::string>().data(), text_data);
+
+  // Large types are stored on the heap and moving them keeps the instance
+  tesseract_common::JointState joint_state;
+  joint_state.joint_names = { "joint_1", "joint_2", "joint_3" };
+  joint_state.position = Eigen::VectorXd::Constant(3, 5);
+  tesseract_common::AnyPoly large_type(joint_state);
+  EXPECT_FALSE(large_type.isInline());
+  const auto* large_ptr = &large_type.as<tesseract_common::JointState>();
+
+  tesseract_common::AnyPoly large_move(std::move(large_type));
+  EXPECT_FALSE(large_move.isInline());
+  EXPECT_EQ(&large_move.as<tesseract_common::JointState>(), large_ptr);
+  EXPECT_TRUE(large_type.isNull());  // NOLINT
+
+  // Assigning between inline and heap storage
+  large_type = small_type;
+  EXPECT_TRUE(large_type.isInline());
+  EXPECT_TRUE(large_type == small_type);
+  small_type = large_move;
+  EXPECT_FALSE(small_type.isInline());
+  EXPECT_TRUE(small_type.as<tesseract_common::JointState>() == joint_state);
+  small_type = tesseract_common::AnyPoly();
+  EXPECT_TRUE(small_type.isNull());
+  EXPECT_FALSE(small_type.isInline());
+
+  // Inline values round trip through serialization
+  {
+    std::ofstream os(tesseract_common::getTempPath() + "any_inline_type_boost.xml");
+    boost::archive::xml_oarchive oa(os);
+    oa << BOOST_SERIALIZATION_NVP(large_type);
+  }
+
+  tesseract_common::AnyPoly nany_type;
+  {
+    std::ifstream ifs(tesseract_common::getTempPath() + "any_inline_type_boost.xml");
+    boost::archive::xml_iarchive ia(ifs);
+    ia >> BOOST_SERIALIZATION_NVP(nany_type);
+  }
+
+  EXPECT_TRUE(nany_type.isInline());
+  EXPECT_DOUBLE_EQ(nany_type.as<SmallAnyType>().value, 5.0);
+}
+
 TEST(TesseractCommonUnit, boundsUnit)  // NOLINT
 {
   Eigen::VectorXd v = Eigen::VectorXd::Ones(6);
@@ -412,6 +551,170 @@ TEST(TesseractCommonUnit, boundsUnit)  // NOLINT
   EXPECT_FALSE(tesseract_common::isWithinPositionLimits<double>(v, limits));
 }
 
+
+TEST(TesseractCommonUnit, compactTransformUnit)  // NOLINT
+{
+  Eigen::Isometry3d a = Eigen::Isometry3d::Identity();
+  a.rotate(Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()));
+  a.translation() = Eigen::Vector3d(1, -2, 0.5);
+  Eigen::Isometry3d b = Eigen::Isometry3d::Identity();
+  b.rotate(Eigen::AngleAxisd(-1.2, Eigen::Vector3d::UnitZ()));
+  b.translation() = Eigen::Vector3d(0.1, 0.2, 0.3);
+
+  const tesseract_common::CompactTransform compact_a(a);
+  const tesseract_common::CompactTransform compact_b(b);
+  EXPECT_TRUE(tesseract_common::CompactTransform().toIsometry().isApprox(Eigen::Isometry3d::Identity()));
+  EXPECT_TRUE(compact_a.toIsometry().isApprox(a));
+  EXPECT_TRUE((compact_a * compact_b).toIsometry().isApprox(a * b));
+  EXPECT_TRUE(compact_a.inverse().toIsometry().isApprox(a.inverse()));
+  EXPECT_TRUE((compact_a * Eigen::Vector3d(1, 2, 3)).isApprox(a * Eigen::Vector3d(1, 2, 3)));
+
+  tesseract_common::CompactTransform moved = compact_a;
+  moved.rotate(Eigen::AngleAxisd(0.7, Eigen::Vector3d::UnitX()));
+  moved.translate(Eigen::Vector3d(0, 0, 2));
+  Eigen::Isometry3d expected = a;
+  expected.rotate(Eigen::AngleAxisd(0.7, Eigen::Vector3d::UnitX()));
+  expected.translate(Eigen::Vector3d(0, 0, 2));
+  EXPECT_TRUE(moved.toIsometry().isApprox(expected));
+
+  // Batch kernels
+  const tesseract_common::VectorIsometry3d rhs{ a, b, a * b };
+  const tesseract_common::VectorCompactTransform compact_rhs = tesseract_common::toCompactTransforms(rhs);
+  tesseract_common::VectorCompactTransform composed;
+  tesseract_common::composeTransforms(composed, compact_b, compact_rhs);
+  ASSERT_EQ(composed.size(), rhs.size());
+  for (std::size_t i = 0; i < rhs.size(); ++i)
+    EXPECT_TRUE(composed[i].toIsometry().isApprox(b * rhs[i]));
+
+  tesseract_common::composeTransforms(composed, compact_rhs, compact_rhs);
+  const tesseract_common::VectorIsometry3d isometries = tesseract_common::toIsometryTransforms(composed);
+  for (std::size_t i = 0; i < rhs.size(); ++i)
+    EXPECT_TRUE(isometries[i].isApprox(rhs[i] * rhs[i]));
+
+  tesseract_common::VectorCompactTransform wrong_size(2);
+  EXPECT_ANY_THROW(tesseract_common::composeTransforms(composed, compact_rhs, wrong_size));  // NOLINT
+
+  Eigen::Matrix3Xd points = Eigen::Matrix3Xd::Random(3, 10);
+  const Eigen::Matrix3Xd original = points;
+  tesseract_common::transformPoints(points, compact_a, points);
+  for (Eigen::Index i = 0; i < points.cols(); ++i)
+    EXPECT_TRUE(points.col(i).isApprox(a * Eigen::Vector3d(original.col(i))));
+}
+
+TEST(TesseractCommonUnit, boundsBatchUnit)  // NOLINT
+{
+  Eigen::MatrixX2d limits(2, 2);
+  limits.col(0) = -Eigen::VectorXd::Ones(2);
+  limits.col(1) = Eigen::VectorXd::Ones(2);
+
+  tesseract_common::TrajArray states(4, 2);
+  states << 0, 0, 1 + std::numeric_limits<float>::epsilon(), 0, 0, -2, -1, 1;
+
+  Eigen::Array<bool, Eigen::Dynamic, 1> result = tesseract_common::satisfiesPositionLimitsBatch<double>(
+      states, limits, std::numeric_limits<double>::epsilon());
+  EXPECT_TRUE(result(0));
+  EXPECT_FALSE(result(1));
+  EXPECT_FALSE(result(2));
+  EXPECT_TRUE(result(3));
+
+  // Matches the single state check
+  for (Eigen::Index i = 0; i < states.rows(); ++i)
+  {
+    EXPECT_EQ(result(i),
+              tesseract_common::satisfiesPositionLimits<double>(
+                  states.row(i).transpose(), limits, std::numeric_limits<double>::epsilon()));
+  }
+
+  const double float_eps = std::numeric_limits<float>::epsilon();
+  result = tesseract_common::satisfiesPositionLimitsBatch<double>(states, limits, float_eps);
+  EXPECT_TRUE(result(1));
+
+  tesseract_common::enforcePositionLimitsBatch<double>(states, limits);
+  const double double_eps = std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(tesseract_common::satisfiesPositionLimitsBatch<double>(states, limits, double_eps).all());
+  EXPECT_DOUBLE_EQ(states(1, 0), 1);
+  EXPECT_DOUBLE_EQ(states(2, 1), -1);
+}
+
+TEST(TesseractCommonUnit, checkTrajectoryLimitsUnit)  // NOLINT
+{
+  tesseract_common::KinematicLimits limits;
+  limits.resize(2);
+  limits.joint_limits.col(0) = -Eigen::VectorXd::Ones(2);
+  limits.joint_limits.col(1) = Eigen::VectorXd::Ones(2);
+  limits.velocity_limits = Eigen::VectorXd::Constant(2, 2);
+  limits.acceleration_limits = Eigen::VectorXd::Constant(2, 4);
+  const Eigen::VectorXd jerk_limits = Eigen::VectorXd::Constant(2, 100);
+
+  // A constant velocity of one along the first joint
+  tesseract_common::TrajArray positions(5, 2);
+  positions << -0.5, 0, -0.25, 0, 0, 0, 0.25, 0, 0.5, 0;
+  Eigen::VectorXd times(5);
+  times << 0, 0.25, 0.5, 0.75, 1.0;
+
+  tesseract_common::TrajectoryLimitsResult result =
+      tesseract_common::checkTrajectoryLimits(positions, times, limits, jerk_limits);
+  EXPECT_TRUE(result.satisfied());
+  EXPECT_EQ(result.getFirstViolation(), -1);
+  EXPECT_NEAR(result.position.max_ratio, 0.5, 1e-12);
+  EXPECT_NEAR(result.velocity.max_ratio, 0.5, 1e-12);
+  EXPECT_EQ(result.velocity.worst_joint, 0);
+  EXPECT_NEAR(result.acceleration.max_ratio, 0, 1e-12);
+  EXPECT_NEAR(result.jerk.max_ratio, 0, 1e-12);
+
+  // The fourth state jumps, exceeding the velocity and acceleration limits but not the position limits
+  positions(3, 0) = 0.9;
+  result = tesseract_common::checkTrajectoryLimits(positions, times, limits, jerk_limits);
+  EXPECT_FALSE(result.satisfied());
+  EXPECT_EQ(result.position.first_state, -1);
+  EXPECT_NEAR(result.position.max_ratio, 0.9, 1e-12);
+  EXPECT_EQ(result.position.worst_state, 3);
+  EXPECT_EQ(result.velocity.first_state, 3);
+  EXPECT_NEAR(result.velocity.max_ratio, 1.8, 1e-12);
+  EXPECT_EQ(result.acceleration.first_state, 3);
+  EXPECT_EQ(result.jerk.first_state, 4);
+  EXPECT_EQ(result.getFirstViolation(), 3);
+
+  // Exceeding the position limit is reported at its state
+  positions(4, 1) = -1.5;
+  result = tesseract_common::checkTrajectoryLimits(positions, times, limits);
+  EXPECT_EQ(result.position.first_state, 4);
+  EXPECT_EQ(result.position.worst_joint, 1);
+  EXPECT_NEAR(result.position.max_ratio, 1.5, 1e-12);
+  EXPECT_EQ(result.jerk.worst_state, -1);
+  EXPECT_EQ(result.getFirstViolation(), 3);
+
+  // Provided velocities and accelerations are checked at their own states
+  positions.setZero();
+  tesseract_common::TrajArray velocities = tesseract_common::TrajArray::Zero(5, 2);
+  tesseract_common::TrajArray accelerations = tesseract_common::TrajArray::Zero(5, 2);
+  velocities(1, 1) = -2.5;
+  accelerations(2, 0) = 4;
+  result = tesseract_common::checkTrajectoryLimits(positions, velocities, accelerations, times, limits, jerk_limits);
+  EXPECT_EQ(result.velocity.first_state, 1);
+  EXPECT_NEAR(result.velocity.max_ratio, 1.25, 1e-12);
+  EXPECT_EQ(result.acceleration.first_state, -1);
+  EXPECT_NEAR(result.acceleration.max_ratio, 1, 1e-12);
+  EXPECT_EQ(result.jerk.first_state, -1);
+  EXPECT_NEAR(result.jerk.max_ratio, 0.16, 1e-12);
+  EXPECT_EQ(result.getFirstViolation(), 1);
+
+  // Empty limits are not checked
+  limits.velocity_limits.resize(0);
+  limits.acceleration_limits.resize(0);
+  result = tesseract_common::checkTrajectoryLimits(positions, times, limits);
+  EXPECT_EQ(result.velocity.worst_state, -1);
+  EXPECT_EQ(result.acceleration.worst_state, -1);
+  EXPECT_TRUE(result.satisfied());
+
+  // Invalid inputs
+  Eigen::VectorXd decreasing_times = times.reverse();
+  Eigen::VectorXd wrong_jerk_limits = Eigen::VectorXd::Ones(3);
+  EXPECT_ANY_THROW(tesseract_common::checkTrajectoryLimits(positions, decreasing_times, limits));          // NOLINT
+  EXPECT_ANY_THROW(tesseract_common::checkTrajectoryLimits(positions, times.head(4), limits));             // NOLINT
+  EXPECT_ANY_THROW(tesseract_common::checkTrajectoryLimits(positions, times, limits, wrong_jerk_limits));  // NOLINT
+}
+
 TEST(TesseractCommonUnit, isIdenticalUnit)  // NOLINT
 {
   std::vector<std::string> v1{ "a", "b", "c" };
@@ -1846,6 +2149,328 @@ TEST(TesseractCommonUnit, linkNamesPairUnit)  // NOLINT
   EXPECT_EQ(hash(p1), hash(p2));
 }
 
+TEST(TesseractCommonUnit, compiledAllowedCollisionMatrixUnit)  // NOLINT
+{
+  {
+    tesseract_common::CompiledAllowedCollisionMatrix compiled_acm;
+    EXPECT_TRUE(compiled_acm.getLinkNames().empty());
+    EXPECT_EQ(compiled_acm.getLinkIndex("link_1"), -1);
+    EXPECT_FALSE(compiled_acm.isCollisionAllowed("link_1", "link_2"));
+    EXPECT_FALSE(compiled_acm.isCollisionAllowed(-1, -1));
+  }
+
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("link_3", "link_1", "test");
+  acm.addAllowedCollision("link_1", "link_2", "test");
+  acm.addAllowedCollision("link_4", "link_4", "test");
+
+  tesseract_common::CompiledAllowedCollisionMatrix compiled_acm(acm);
+  std::vector<std::string> link_names{ "link_1", "link_2", "link_3", "link_4" };
+  EXPECT_EQ(compiled_acm.getLinkNames(), link_names);
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    EXPECT_EQ(compiled_acm.getLinkIndex(link_names[i]), static_cast<int>(i));
+
+  EXPECT_EQ(compiled_acm.getLinkIndex("link_5"), -1);
+
+  link_names.emplace_back("link_5");
+  for (const auto& link_name1 : link_names)
+  {
+    for (const auto& link_name2 : link_names)
+    {
+      const bool allowed = acm.isCollisionAllowed(link_name1, link_name2);
+      EXPECT_EQ(compiled_acm.isCollisionAllowed(link_name1, link_name2), allowed);
+      EXPECT_EQ(
+          compiled_acm.isCollisionAllowed(compiled_acm.getLinkIndex(link_name1), compiled_acm.getLinkIndex(link_name2)),
+          allowed);
+      EXPECT_EQ(compiled_acm.isCollisionAllowed(tesseract_common::NameId(link_name1),
+                                                tesseract_common::NameId(link_name2)),
+                allowed);
+    }
+  }
+
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    EXPECT_EQ(compiled_acm.getLinkIndex(tesseract_common::NameId(link_names[i])),
+              compiled_acm.getLinkIndex(link_names[i]));
+
+  EXPECT_EQ(compiled_acm.getLinkIndex(tesseract_common::NameId()), -1);
+}
+
+TEST(TesseractCommonUnit, nameIdUnit)  // NOLINT
+{
+  tesseract_common::NameId empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.getId(), 0);
+  EXPECT_TRUE(empty.getName().empty());
+  EXPECT_EQ(empty, tesseract_common::NameId(""));
+
+  tesseract_common::NameId found;
+  EXPECT_FALSE(tesseract_common::NameId::find("name_id_unit_link_1", found));
+
+  const std::size_t size = tesseract_common::NameId::size();
+  tesseract_common::NameId link_1("name_id_unit_link_1");
+  tesseract_common::NameId link_2(std::string("name_id_unit_link_2"));
+  EXPECT_EQ(tesseract_common::NameId::size(), size + 2);
+  EXPECT_FALSE(link_1.empty());
+  EXPECT_EQ(link_1.getName(), "name_id_unit_link_1");
+  EXPECT_EQ(link_1.getHash(), std::hash<std::string>()("name_id_unit_link_1"));
+  EXPECT_EQ(link_2.getId(), link_1.getId() + 1);
+  EXPECT_NE(link_1, link_2);
+  EXPECT_TRUE(link_1 < link_2);
+
+  // Interning the same name again returns the same id and does not grow the table
+  tesseract_common::NameId link_1_copy(std::string("name_id_unit_link_1"));
+  EXPECT_EQ(link_1, link_1_copy);
+  EXPECT_EQ(link_1.getId(), link_1_copy.getId());
+  EXPECT_EQ(&link_1.getName(), &link_1_copy.getName());
+  EXPECT_EQ(tesseract_common::NameId::size(), size + 2);
+
+  EXPECT_TRUE(tesseract_common::NameId::find("name_id_unit_link_2", found));
+  EXPECT_EQ(found, link_2);
+
+  tesseract_common::NameIdMap<int> map;
+  map[link_1] = 1;
+  map[link_2] = 2;
+  EXPECT_EQ(map.at(tesseract_common::NameId("name_id_unit_link_1")), 1);
+  EXPECT_EQ(map.at(tesseract_common::NameId("name_id_unit_link_2")), 2);
+}
+
+TEST(TesseractCommonUnit, linkTransformsUnit)  // NOLINT
+{
+  std::vector<std::string> repeated_names{ "link_1", "link_1" };
+  EXPECT_ANY_THROW(tesseract_common::LinkNameTable{ repeated_names });  // NOLINT
+
+  {
+    tesseract_common::LinkTransforms link_transforms;
+    EXPECT_TRUE(link_transforms.empty());
+    EXPECT_TRUE(link_transforms.getNames().empty());
+    EXPECT_EQ(link_transforms.find("link_1"), nullptr);
+    EXPECT_ANY_THROW(link_transforms.at("link_1"));  // NOLINT
+    EXPECT_TRUE(link_transforms.toTransformMap().empty());
+  }
+
+  tesseract_common::TransformMap transform_map;
+  transform_map["link_2"] = Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 2, 0);
+  transform_map["link_1"] = Eigen::Isometry3d::Identity() * Eigen::Translation3d(1, 0, 0);
+  transform_map["link_3"] = Eigen::Isometry3d::Identity() * Eigen::Translation3d(0, 0, 3);
+
+  // All links of a transform map, in the order of the map
+  tesseract_common::LinkTransforms link_transforms(transform_map);
+  std::vector<std::string> link_names{ "link_1", "link_2", "link_3" };
+  EXPECT_EQ(link_transforms.getNames(), link_names);
+  EXPECT_EQ(link_transforms.size(), 3);
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    EXPECT_EQ(link_transforms.getNameTable()->getIndex(link_names[i]), static_cast<int>(i));
+    EXPECT_EQ(link_transforms.getNameTable()->getIndex(tesseract_common::NameId(link_names[i])), static_cast<int>(i));
+    EXPECT_TRUE(link_transforms[i].isApprox(transform_map.at(link_names[i])));
+    EXPECT_EQ(link_transforms.find(link_names[i]), &link_transforms[i]);
+    EXPECT_EQ(link_transforms.find(tesseract_common::NameId(link_names[i])), &link_transforms[i]);
+  }
+  EXPECT_EQ(link_transforms.getNameTable()->getIndex("link_4"), -1);
+  EXPECT_EQ(link_transforms.getNameTable()->getIndex(tesseract_common::NameId("link_4")), -1);
+  EXPECT_EQ(link_transforms.find("link_4"), nullptr);
+  EXPECT_ANY_THROW(link_transforms.at("link_4"));  // NOLINT
+
+  link_transforms.at("link_2").translation() = Eigen::Vector3d(0, 4, 0);
+  EXPECT_TRUE(link_transforms[1].translation().isApprox(Eigen::Vector3d(0, 4, 0)));
+  link_transforms.assign(transform_map);
+  auto isometry_equal = [](const Eigen::Isometry3d& a, const Eigen::Isometry3d& b) { return a.isApprox(b); };
+  bool identical = tesseract_common::isIdenticalMap<tesseract_common::TransformMap, Eigen::Isometry3d>(
+      link_transforms.toTransformMap(), transform_map, isometry_equal);
+  EXPECT_TRUE(identical);
+
+  // A subset of the links sharing a name table, links missing from the transform map throw
+  auto name_table =
+      std::make_shared<const tesseract_common::LinkNameTable>(std::vector<std::string>{ "link_3", "link_1" });
+  tesseract_common::LinkTransforms subset(name_table, transform_map);
+  tesseract_common::LinkTransforms subset_copy(name_table);
+  EXPECT_EQ(subset.getNameTable(), subset_copy.getNameTable());
+  EXPECT_TRUE(subset_copy[0].isApprox(Eigen::Isometry3d::Identity()));
+  EXPECT_NE(subset, subset_copy);
+  subset_copy.assign(transform_map);
+  EXPECT_EQ(subset, subset_copy);
+  EXPECT_NE(subset, link_transforms);
+  EXPECT_TRUE(subset[0].isApprox(transform_map.at("link_3")));
+  EXPECT_TRUE(subset[1].isApprox(transform_map.at("link_1")));
+
+  transform_map.erase("link_3");
+  EXPECT_ANY_THROW(subset.assign(transform_map));  // NOLINT
+}
+
+TEST(TesseractCommonUnit, tracingUnit)  // NOLINT
+{
+  // Zones are not recorded unless tracing is started
+  tesseract_common::Tracer::clear();
+  {
+    tesseract_common::TraceZone zone("not_recorded");
+  }
+  EXPECT_TRUE(tesseract_common::Tracer::getEvents().empty());
+
+  tesseract_common::Tracer::start();
+  EXPECT_TRUE(tesseract_common::Tracer::isRecording());
+  {
+    tesseract_common::TraceZone outer("outer");
+    tesseract_common::TraceZone inner("inner");
+  }
+  std::thread([] { tesseract_common::TraceZone zone("thread"); }).join();
+  tesseract_common::Tracer::stop();
+  EXPECT_FALSE(tesseract_common::Tracer::isRecording());
+
+  {
+    tesseract_common::TraceZone zone("stopped");
+  }
+
+  std::vector<tesseract_common::TraceEvent> events = tesseract_common::Tracer::getEvents();
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_STREQ(events[0].name, "outer");
+  EXPECT_STREQ(events[1].name, "inner");
+  EXPECT_STREQ(events[2].name, "thread");
+  EXPECT_LE(events[0].start, events[1].start);
+  EXPECT_GE(events[0].duration, events[1].duration);
+  EXPECT_EQ(events[0].thread, events[1].thread);
+  EXPECT_NE(events[0].thread, events[2].thread);
+
+  std::stringstream ss;
+  tesseract_common::Tracer::writeChromeTrace(ss);
+  EXPECT_NE(ss.str().find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(ss.str().find("\"name\":\"inner\""), std::string::npos);
+  EXPECT_NE(ss.str().find("\"ph\":\"X\""), std::string::npos);
+
+  tesseract_common::Tracer::clear();
+  EXPECT_TRUE(tesseract_common::Tracer::getEvents().empty());
+}
+
+TEST(TesseractCommonUnit, executorUnit)  // NOLINT
+{
+  auto check_executor = [](tesseract_common::Executor& executor) {
+    std::vector<int> values(1000, 0);
+    executor.parallelFor(values.size(), [&values](std::size_t i) { values[i] = static_cast<int>(i); });
+    for (std::size_t i = 0; i < values.size(); ++i)
+      EXPECT_EQ(values[i], static_cast<int>(i));
+
+    // Nested loops make progress because the calling thread takes part
+    std::atomic<std::size_t> count{ 0 };
+    executor.parallelFor(8, [&executor, &count](std::size_t /*i*/) {
+      executor.parallelFor(8, [&count](std::size_t /*j*/) { ++count; });
+    });
+    EXPECT_EQ(count, 64U);
+
+    auto throw_on_five = [](std::size_t i) {
+      if (i == 5)
+        throw std::runtime_error("failed");
+    };
+    EXPECT_ANY_THROW(executor.parallelFor(10, throw_on_five));  // NOLINT
+
+    std::future<int> future = executor.async([]() { return 42; });
+    EXPECT_EQ(future.get(), 42);
+
+    std::future<void> failed = executor.async([]() { throw std::runtime_error("failed"); });
+    EXPECT_ANY_THROW(failed.get());  // NOLINT
+
+    tesseract_common::CancellationToken token;
+    EXPECT_EQ(executor.async([]() { return 42; }, token).get(), 42);
+
+    // Copies of a token share its state
+    tesseract_common::CancellationToken copy = token;
+    copy.cancel();
+    EXPECT_TRUE(token.isCancelled());
+    std::atomic<bool> called{ false };
+    std::future<void> cancelled = executor.async([&called]() { called = true; }, token);
+    EXPECT_THROW(cancelled.get(), tesseract_common::CancelledError);  // NOLINT
+    EXPECT_FALSE(called);
+  };
+
+  {
+    tesseract_common::ThreadPoolExecutor executor(4);
+    EXPECT_EQ(executor.getConcurrency(), 4U);
+    check_executor(executor);
+  }
+
+  {
+    tesseract_common::SequentialExecutor executor;
+    EXPECT_EQ(executor.getConcurrency(), 1U);
+    check_executor(executor);
+  }
+
+  {
+    tesseract_common::ThreadPoolExecutor pool(2);
+    std::atomic<std::size_t> submitted{ 0 };
+    tesseract_common::FunctionExecutor executor(
+        [&pool, &submitted](std::function<void()> task) {
+          ++submitted;
+          pool.submit(std::move(task));
+        },
+        2);
+    EXPECT_EQ(executor.getConcurrency(), 2U);
+    check_executor(executor);
+    EXPECT_GT(submitted, 0U);
+    EXPECT_ANY_THROW(tesseract_common::FunctionExecutor(nullptr, 1));  // NOLINT
+  }
+
+  // The application can replace the default executor
+  tesseract_common::Executor::Ptr default_executor = tesseract_common::getDefaultExecutor();
+  EXPECT_NE(default_executor, nullptr);
+  auto sequential = std::make_shared<tesseract_common::SequentialExecutor>();
+  tesseract_common::setDefaultExecutor(sequential);
+  EXPECT_EQ(tesseract_common::getDefaultExecutor(), sequential);
+  tesseract_common::setDefaultExecutor(nullptr);
+  EXPECT_NE(tesseract_common::getDefaultExecutor(), nullptr);
+  EXPECT_NE(tesseract_common::getDefaultExecutor(), sequential);
+}
+
+TEST(TesseractCommonUnit, metricsUnit)  // NOLINT
+{
+  auto& registry = tesseract_common::MetricsRegistry::getInstance();
+  const tesseract_common::MetricLabels labels{ { "manager", "Test\"Manager" } };
+
+  tesseract_common::MetricCounter& counter = registry.getCounter("test_metrics_total", "A test counter", labels);
+  counter.reset();
+  EXPECT_EQ(&counter, &registry.getCounter("test_metrics_total", "A test counter", labels));
+  EXPECT_NE(&counter, &registry.getCounter("test_metrics_total", "A test counter"));
+  EXPECT_ANY_THROW(registry.getHistogram("test_metrics_total", "A test counter"));  // NOLINT
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.emplace_back([&counter]() {
+      for (int j = 0; j < 1000; ++j)
+        counter.increment();
+    });
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(counter.getValue(), 4000U);
+
+  tesseract_common::MetricHistogram& histogram = registry.getHistogram("test_metrics_seconds", "A test histogram");
+  histogram.reset();
+  EXPECT_DOUBLE_EQ(histogram.getQuantile(0.5), 0);
+  for (int i = 0; i < 99; ++i)
+    histogram.observe(std::chrono::microseconds(10));
+  histogram.observe(std::chrono::milliseconds(10));
+  {
+    const tesseract_common::MetricTimer timer(histogram);
+  }
+
+  EXPECT_EQ(histogram.getCount(), 101U);
+  EXPECT_NEAR(histogram.getSum(), (99 * 10e-6) + 10e-3, 1e-3);
+  EXPECT_EQ(histogram.getBucketCounts().size(), tesseract_common::MetricHistogram::BUCKET_COUNT + 1);
+  EXPECT_GT(histogram.getQuantile(0.5), 5e-6);
+  EXPECT_LT(histogram.getQuantile(0.5), 20e-6);
+  EXPECT_GT(histogram.getQuantile(1.0), 5e-3);
+  EXPECT_LT(histogram.getQuantile(1.0), 20e-3);
+
+  std::stringstream ss;
+  registry.writePrometheus(ss);
+  const std::string text = ss.str();
+  EXPECT_NE(text.find("# TYPE test_metrics_total counter\n"), std::string::npos);
+  EXPECT_NE(text.find("test_metrics_total{manager=\"Test\\\"Manager\"} 4000\n"), std::string::npos);
+  EXPECT_NE(text.find("# TYPE test_metrics_seconds histogram\n"), std::string::npos);
+  EXPECT_NE(text.find("test_metrics_seconds_bucket{le=\"+Inf\"} 101\n"), std::string::npos);
+  EXPECT_NE(text.find("test_metrics_seconds_count 101\n"), std::string::npos);
+
+  registry.reset();
+  EXPECT_EQ(counter.getValue(), 0U);
+  EXPECT_EQ(histogram.getCount(), 0U);
+}
+
 /** @brief Tests calcRotationalError which return angle between [-PI, PI]*/
 TEST(TesseractCommonUnit, calcRotationalError)  // NOLINT
 {
@@ -2096,6 +2721,73 @@ TEST(TesseractCommonUnit, calcTransformError)  // NOLINT
   }
 }
 
+TEST(TesseractCommonUnit, calcTransformErrorFixed)  // NOLINT
+{
+  Eigen::Isometry3d t1 = Eigen::Isometry3d::Identity();
+  t1.rotate(Eigen::AngleAxisd(0.4, Eigen::Vector3d(1, 1, 0).normalized()));
+  t1.translation() = Eigen::Vector3d(0.5, -0.2, 1);
+
+  tesseract_common::VectorIsometry3d t2;
+  for (double angle : { 0.0, 1e-9, 0.3, 2.0, M_PI - 1e-4 })
+  {
+    Eigen::Isometry3d t = t1;
+    t.rotate(Eigen::AngleAxisd(angle, Eigen::Vector3d(1, -2, 0.5).normalized()));
+    t.translate(Eigen::Vector3d(0.1, 0.2, -0.3));
+    t2.push_back(t);
+  }
+
+  // Matches the angle axis of the error rotation
+  for (const auto& t : t2)
+  {
+    const Eigen::Isometry3d pose_err = t1.inverse() * t;
+    const Eigen::AngleAxisd angle_axis(pose_err.rotation());
+    const Eigen::Matrix<double, 6, 1> err = tesseract_common::calcTransformErrorFixed(t1, t);
+    EXPECT_TRUE(err.head<3>().isApprox(pose_err.translation(), 1e-8));
+    EXPECT_TRUE(err.tail<3>().isApprox(angle_axis.axis() * angle_axis.angle(), 1e-8) ||
+                err.tail<3>().norm() < 1e-8);
+    EXPECT_TRUE(tesseract_common::calcTransformError(t1, t).isApprox(err));
+  }
+
+  // Batched
+  Eigen::Matrix<double, 6, Eigen::Dynamic> errors(6, static_cast<Eigen::Index>(t2.size()));
+  tesseract_common::calcTransformErrors(errors, t1, t2);
+  tesseract_common::VectorIsometry3d targets(t2.size(), t1);
+  Eigen::Matrix<double, 6, Eigen::Dynamic> pair_errors(6, static_cast<Eigen::Index>(t2.size()));
+  tesseract_common::calcTransformErrors(pair_errors, targets, t2);
+  for (std::size_t i = 0; i < t2.size(); ++i)
+  {
+    const Eigen::Matrix<double, 6, 1> err = tesseract_common::calcTransformErrorFixed(t1, t2[i]);
+    EXPECT_TRUE(errors.col(static_cast<Eigen::Index>(i)).isApprox(err, 1e-12));
+    EXPECT_TRUE(pair_errors.col(static_cast<Eigen::Index>(i)).isApprox(err, 1e-12));
+  }
+
+  Eigen::Matrix<double, 6, Eigen::Dynamic> wrong_size(6, 2);
+  EXPECT_ANY_THROW(tesseract_common::calcTransformErrors(wrong_size, t1, t2));       // NOLINT
+  EXPECT_ANY_THROW(tesseract_common::calcTransformErrors(wrong_size, targets, t2));  // NOLINT
+  targets.pop_back();
+  EXPECT_ANY_THROW(tesseract_common::calcTransformErrors(errors, targets, t2));  // NOLINT
+
+  // The analytic jacobian matches a numerical jacobian of a world frame change of t2
+  const double delta = 1e-6;
+  for (const auto& t : t2)
+  {
+    const Eigen::Matrix<double, 6, 6> jacobian = tesseract_common::calcTransformErrorJacobian(t1, t);
+    const Eigen::Matrix<double, 6, 1> err = tesseract_common::calcTransformErrorFixed(t1, t);
+    Eigen::Matrix<double, 6, 6> numerical;
+    for (Eigen::Index c = 0; c < 6; ++c)
+    {
+      Eigen::Isometry3d moved = t;
+      if (c < 3)
+        moved.translation()(c) += delta;
+      else
+        moved.linear() = Eigen::AngleAxisd(delta, Eigen::Vector3d::Unit(c - 3)).toRotationMatrix() * t.linear();
+
+      numerical.col(c) = (tesseract_common::calcTransformErrorFixed(t1, moved) - err) / delta;
+    }
+    EXPECT_TRUE(jacobian.isApprox(numerical, 1e-4));
+  }
+}
+
 /** @brief Tests calcTransformError */
 TEST(TesseractCommonUnit, computeRandomColor)  // NOLINT
 {
@@ -2122,6 +2814,169 @@ TEST(TesseractCommonUnit, concat)  // NOLINT
   EXPECT_TRUE(c.tail(3).isApprox(b));
 }
 
+/** @brief Tests interpolateLinear */
+TEST(TesseractCommonUnit, interpolateLinear)  // NOLINT
+{
+  Eigen::VectorXd start = Eigen::VectorXd::LinSpaced(7, -1, 1);
+  Eigen::VectorXd end = Eigen::VectorXd::LinSpaced(7, 2, 0.5);
+
+  tesseract_common::TrajArray states;
+  tesseract_common::interpolateLinear(states, start, end, 5);
+  EXPECT_EQ(states.rows(), 5);
+  EXPECT_EQ(states.cols(), 7);
+  for (long i = 0; i < states.cols(); ++i)
+  {
+    EXPECT_TRUE(states.col(i).isApprox(Eigen::VectorXd::LinSpaced(5, start(i), end(i))));
+  }
+  EXPECT_TRUE(states.row(0).transpose().isApprox(start));
+  EXPECT_TRUE(states.row(4).transpose().isApprox(end));
+
+  // The buffer is reused when it has the requested size
+  const double* data = states.data();
+  tesseract_common::interpolateLinear(states, end, start, 5);
+  EXPECT_EQ(states.data(), data);
+  EXPECT_TRUE(states.row(0).transpose().isApprox(end));
+  EXPECT_TRUE(states.row(4).transpose().isApprox(start));
+
+  EXPECT_ANY_THROW(tesseract_common::interpolateLinear(states, start, end, 1));                   // NOLINT
+  EXPECT_ANY_THROW(tesseract_common::interpolateLinear(states, start, Eigen::VectorXd::Zero(3), 5));  // NOLINT
+}
+
+/** @brief Tests interpolateSegment */
+TEST(TesseractCommonUnit, interpolateSegment)  // NOLINT
+{
+  tesseract_common::JointState start({ "j1", "j2" }, Eigen::Vector2d(0, 1));
+  tesseract_common::JointState end({ "j1", "j2" }, Eigen::Vector2d(1, -1));
+  end.time = 2;
+
+  Eigen::VectorXd position(2);
+  for (auto type : { tesseract_common::InterpolationType::LINEAR,
+                     tesseract_common::InterpolationType::CUBIC,
+                     tesseract_common::InterpolationType::QUINTIC })
+  {
+    tesseract_common::interpolateSegment(position, start, end, 0, type);
+    EXPECT_TRUE(position.isApprox(start.position));
+    tesseract_common::interpolateSegment(position, start, end, 1, type);
+    EXPECT_TRUE(position.isApprox(end.position));
+    tesseract_common::interpolateSegment(position, start, end, 0.5, type);
+    EXPECT_TRUE(position.isApprox(Eigen::Vector2d(0.5, 0)));
+  }
+
+  // The velocities and accelerations are matched at the ends, checked with finite differences
+  start.velocity = Eigen::Vector2d(0.5, -1);
+  end.velocity = Eigen::Vector2d(1, 0.25);
+  start.acceleration = Eigen::Vector2d(-1, 2);
+  end.acceleration = Eigen::Vector2d(0.5, 1);
+  const double dt = end.time - start.time;
+  const double h = 1e-4;
+  Eigen::VectorXd p0(2);
+  Eigen::VectorXd p1(2);
+  Eigen::VectorXd p2(2);
+  for (auto type : { tesseract_common::InterpolationType::CUBIC, tesseract_common::InterpolationType::QUINTIC })
+  {
+    tesseract_common::interpolateSegment(p0, start, end, 0, type);
+    tesseract_common::interpolateSegment(p1, start, end, h, type);
+    tesseract_common::interpolateSegment(p2, start, end, 2 * h, type);
+    EXPECT_TRUE(((p1 - p0) / (h * dt)).isApprox(start.velocity, 1e-3));
+    if (type == tesseract_common::InterpolationType::QUINTIC)
+    {
+      EXPECT_TRUE(((p2 - 2 * p1 + p0) / (h * h * dt * dt)).isApprox(start.acceleration, 1e-2));
+    }
+
+    tesseract_common::interpolateSegment(p0, start, end, 1, type);
+    tesseract_common::interpolateSegment(p1, start, end, 1 - h, type);
+    tesseract_common::interpolateSegment(p2, start, end, 1 - 2 * h, type);
+    EXPECT_TRUE(((p0 - p1) / (h * dt)).isApprox(end.velocity, 1e-3));
+    if (type == tesseract_common::InterpolationType::QUINTIC)
+    {
+      EXPECT_TRUE(((p0 - 2 * p1 + p2) / (h * h * dt * dt)).isApprox(end.acceleration, 1e-2));
+    }
+  }
+
+  Eigen::VectorXd wrong_size(3);
+  EXPECT_ANY_THROW(tesseract_common::interpolateSegment(wrong_size, start, end, 0.5));  // NOLINT
+}
+
+/** @brief Tests resampleJointTrajectory */
+TEST(TesseractCommonUnit, resampleJointTrajectory)  // NOLINT
+{
+  tesseract_common::JointTrajectory trajectory;
+  for (int i = 0; i < 4; ++i)
+  {
+    tesseract_common::JointState state({ "j1", "j2" }, Eigen::Vector2d(i, -2 * i));
+    state.time = i;
+    trajectory.push_back(state);
+  }
+
+  Eigen::VectorXd times(6);
+  times << -1, 0, 0.5, 1.25, 3, 4;
+
+  tesseract_common::TrajArray positions;
+  tesseract_common::resampleJointTrajectory(positions, trajectory, times);
+  EXPECT_EQ(positions.rows(), 6);
+  EXPECT_EQ(positions.cols(), 2);
+  EXPECT_TRUE(positions.row(0).isApprox(Eigen::RowVector2d(0, 0)));
+  EXPECT_TRUE(positions.row(1).isApprox(Eigen::RowVector2d(0, 0)));
+  EXPECT_TRUE(positions.row(2).isApprox(Eigen::RowVector2d(0.5, -1)));
+  EXPECT_TRUE(positions.row(3).isApprox(Eigen::RowVector2d(1.25, -2.5)));
+  EXPECT_TRUE(positions.row(4).isApprox(Eigen::RowVector2d(3, -6)));
+  EXPECT_TRUE(positions.row(5).isApprox(Eigen::RowVector2d(3, -6)));
+
+  // Without velocities the cubic segments start and stop at rest
+  tesseract_common::resampleJointTrajectory(
+      positions, trajectory, times, tesseract_common::InterpolationType::CUBIC);
+  EXPECT_TRUE(positions.row(2).isApprox(Eigen::RowVector2d(0.5, -1)));
+  EXPECT_TRUE(positions.row(3).isApprox(Eigen::RowVector2d(1.15625, -2.3125)));
+
+  EXPECT_ANY_THROW(tesseract_common::resampleJointTrajectory(  // NOLINT
+      positions,
+      tesseract_common::JointTrajectory(),
+      times));
+}
+
+TEST(TesseractCommonUnit, MemoryUsageUnit)  // NOLINT
+{
+  tesseract_common::MemoryUsage usage("root");
+  usage.unique_bytes = 10;
+  usage.addChild("a").unique_bytes = 5;
+  tesseract_common::MemoryUsage& b = usage.addChild("b");
+  b.shared_bytes = 7;
+  b.addChild("c").unique_bytes = 3;
+
+  EXPECT_EQ(usage.getTotalUniqueBytes(), 18);
+  EXPECT_EQ(usage.getTotalSharedBytes(), 7);
+  EXPECT_EQ(usage.getTotalBytes(), 25);
+  ASSERT_NE(usage.getChild("b"), nullptr);
+  EXPECT_EQ(usage.getChild("b")->getTotalBytes(), 10);
+  EXPECT_EQ(usage.getChild("d"), nullptr);
+
+  std::stringstream ss;
+  usage.print(ss, 1);
+  EXPECT_EQ(ss.str(),
+            "root: 25 bytes (unique 18, shared 7)\n"
+            "  a: 5 bytes (unique 5, shared 0)\n"
+            "  b: 10 bytes (unique 3, shared 7)\n");
+
+  // Storage is unique while it has a single reference and only counted once
+  tesseract_common::MemoryUsageTracker tracker;
+  auto storage = std::make_shared<std::vector<double>>(100);
+  tesseract_common::MemoryUsage storage_usage("storage");
+  EXPECT_TRUE(tracker.count(storage_usage, storage, tesseract_common::getVectorBytes(*storage)));
+  EXPECT_FALSE(tracker.count(storage_usage, storage, tesseract_common::getVectorBytes(*storage)));
+  EXPECT_EQ(storage_usage.unique_bytes, 100 * sizeof(double));
+  EXPECT_EQ(storage_usage.shared_bytes, 0);
+
+  auto other = std::make_shared<std::vector<double>>(10);
+  auto other_copy = other;
+  EXPECT_TRUE(tracker.count(storage_usage, other, tesseract_common::getVectorBytes(*other)));
+  EXPECT_EQ(storage_usage.shared_bytes, 10 * sizeof(double));
+  EXPECT_FALSE(tracker.count(storage_usage, std::shared_ptr<std::vector<double>>(), 10));
+
+  tracker.clear();
+  EXPECT_TRUE(tracker.visit(storage.get()));
+  EXPECT_FALSE(tracker.visit(storage.get()));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,114 @@
+/**
+ * @file allowed_collision_matrix_generator.h
+ * @brief Generates the allowed collision matrix of an environment by sampling random states
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
+#define TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/allowed_collision_matrix.h>
+#include <tesseract_common/executor.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands/modify_allowed_collisions_command.h>
+
+namespace tesseract_environment
+{
+/** @brief The reasons assigned to the generated allowed collision pairs, they match the reasons used in SRDF files */
+struct AllowedCollisionReasons
+{
+  /** @brief The links are connected by a joint, possibly through links without collision geometry */
+  static const std::string ADJACENT;
+
+  /** @brief The links are in collision in the current state of the environment */
+  static const std::string DEFAULT;
+
+  /** @brief The links are in collision in (almost) every sampled state */
+  static const std::string ALWAYS;
+
+  /** @brief The links are never in collision in the sampled states */
+  static const std::string NEVER;
+};
+
+/** @brief The configuration of generateAllowedCollisionMatrix */
+struct AllowedCollisionMatrixGeneratorConfig
+{
+  /** @brief The number of random states sampled */
+  std::size_t samples{ 10000 };
+
+  /** @brief The fraction of the sampled states a pair must be in collision in to be considered always in collision */
+  double always_fraction{ 0.95 };
+
+  /** @brief The number of workers, zero uses the concurrency of the executor */
+  std::size_t threads{ 0 };
+
+  /** @brief The executor running the workers, nullptr uses the default executor */
+  tesseract_common::Executor::Ptr executor;
+
+  /** @brief The number of states checked with a single batch contact test */
+  std::size_t batch_size{ 64 };
+
+  /** @brief The seed of the random states, the result is the same for the same seed and number of workers */
+  uint32_t seed{ 0 };
+
+  /** @brief The name of the discrete contact manager used, empty uses the active discrete contact manager */
+  std::string contact_manager;
+};
+
+/**
+ * @brief Generate the allowed collision matrix of an environment
+ * @details Every pair of links with collision geometry is classified as adjacent, in collision in the current state
+ * (default), in collision in almost every sampled state (always), never in collision in the sampled states (never) or
+ * sometimes in collision. All but the last are returned as allowed collisions with the reasons in
+ * AllowedCollisionReasons. The allowed collision matrix of the environment is ignored.
+ *
+ * The random states are sampled within the joint limits by a number of workers run by the executor, each checking
+ * batches of states
+ * with its own clone of the contact manager. Adjacent and default pairs are not checked, and a worker stops checking a
+ * pair once it can no longer be classified as always or never in collision.
+ *
+ * The result can be added to an SRDF model or applied with createModifyAllowedCollisionsCommand.
+ * @param env The environment
+ * @param config The configuration
+ * @return The allowed collision matrix
+ * @throws std::runtime_error if the environment is not initialized or the contact manager is not available
+ */
+tesseract_common::AllowedCollisionMatrix
+generateAllowedCollisionMatrix(const Environment& env, const AllowedCollisionMatrixGeneratorConfig& config = {});
+
+/**
+ * @brief Create the command adding a generated allowed collision matrix to an environment
+ * @param acm The generated allowed collision matrix
+ * @return The command
+ */
+ModifyAllowedCollisionsCommand::Ptr createModifyAllowedCollisionsCommand(tesseract_common::AllowedCollisionMatrix acm);
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
@@ -60,7 +60,8 @@ enum class CommandType
   CHANGE_COLLISION_MARGINS = 17,
   ADD_CONTACT_MANAGERS_PLUGIN_INFO = 18,
   SET_ACTIVE_DISCRETE_CONTACT_MANAGER = 19,
-  SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER = 20
+  SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER = 20,
+  ATTACH_LINK = 21
 };
 
 template <class Archive>
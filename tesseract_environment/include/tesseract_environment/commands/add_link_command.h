@@ -66,7 +66,7 @@ public:
    */
   AddLinkCommand(const tesseract_scene_graph::Link& link, bool replace_allowed = false)
     : Command(CommandType::ADD_LINK)
-    , link_(std::make_shared<tesseract_scene_graph::Link>(link.clone()))
+    , link_(copyLink(link))
     , joint_(nullptr)
     , replace_allowed_(replace_allowed)
   {
@@ -96,7 +96,7 @@ public:
                  const tesseract_scene_graph::Joint& joint,
                  bool replace_allowed = false)
     : Command(CommandType::ADD_LINK)
-    , link_(std::make_shared<tesseract_scene_graph::Link>(link.clone()))
+    , link_(copyLink(link))
     , joint_(std::make_shared<tesseract_scene_graph::Joint>(joint.clone()))
     , replace_allowed_(replace_allowed)
   {
@@ -119,6 +119,9 @@ private:
   tesseract_scene_graph::Joint::ConstPtr joint_;
   bool replace_allowed_{ false };
 
+  /** @brief Clone the link, sharing its meshes with identical meshes in the GeometryPool */
+  static tesseract_scene_graph::Link::Ptr copyLink(const tesseract_scene_graph::Link& link);
+
   friend class boost::serialization::access;
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
@@ -0,0 +1,90 @@
+/**
+ * @file attach_link_command.h
+ * @brief Used to attach a link to another link, like a grasped object to a gripper
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ATTACH_LINK_COMMAND_H
+#define TESSERACT_ENVIRONMENT_ATTACH_LINK_COMMAND_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <memory>
+#include <string>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/command.h>
+
+namespace tesseract_environment
+{
+class AttachLinkCommand : public Command
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<AttachLinkCommand>;
+  using ConstPtr = std::shared_ptr<const AttachLinkCommand>;
+
+  AttachLinkCommand();
+
+  /**
+   * @brief Attach a link to another link with a fixed joint, like a grasped object to a gripper
+   *
+   * The joint of the link keeps its name and is replaced by a fixed joint, so the link and its children follow the new
+   * parent. Unlike a MoveLinkCommand the collision objects are not recreated, they only change between the static and
+   * active sets of the contact managers. A link is detached by attaching it to the root link.
+   *
+   * @param link_name The name of the link to attach
+   * @param parent_link_name The name of the link to attach it to
+   * @param origin The transform from the parent link to the link
+   */
+  AttachLinkCommand(std::string link_name,
+                    std::string parent_link_name,
+                    const Eigen::Isometry3d& origin = Eigen::Isometry3d::Identity());
+
+  const std::string& getLinkName() const;
+  const std::string& getParentLinkName() const;
+  const Eigen::Isometry3d& getOrigin() const;
+
+  bool operator==(const AttachLinkCommand& rhs) const;
+  bool operator!=(const AttachLinkCommand& rhs) const;
+
+private:
+  std::string link_name_;
+  std::string parent_link_name_;
+  Eigen::Isometry3d origin_;
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+}  // namespace tesseract_environment
+
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/tracking.hpp>
+BOOST_CLASS_EXPORT_KEY2(tesseract_environment::AttachLinkCommand, "AttachLinkCommand")
+
+#endif  // TESSERACT_ENVIRONMENT_ATTACH_LINK_COMMAND_H
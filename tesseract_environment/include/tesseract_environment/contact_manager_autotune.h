@@ -0,0 +1,188 @@
+/**
+ * @file contact_manager_autotune.h
+ * @brief Selects the fastest contact managers of an environment by benchmarking them on its scene
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_CONTACT_MANAGER_AUTOTUNE_H
+#define TESSERACT_ENVIRONMENT_CONTACT_MANAGER_AUTOTUNE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_environment
+{
+/** @brief The settings of the contact manager benchmark */
+struct ContactManagerAutotuneConfig
+{
+  /** @brief The number of random states each contact manager is checked at */
+  std::size_t num_states{ 100 };
+
+  /** @brief The number of timed passes over the states, the fastest pass is used */
+  std::size_t repetitions{ 3 };
+
+  /** @brief The contact request which is timed, the accuracy is always checked with ContactTestType::ALL */
+  tesseract_collision::ContactRequest contact_request;
+
+  /** @brief The largest difference of the distance of a pair from the reference manager */
+  double distance_tolerance{ 1e-3 };
+
+  /** @brief The seed of the random states */
+  std::uint32_t seed{ 0 };
+
+  /** @brief If true the discrete contact managers are benchmarked */
+  bool discrete{ true };
+
+  /** @brief If true the continuous contact managers are benchmarked */
+  bool continuous{ true };
+};
+
+/** @brief The benchmark of a contact manager */
+struct ContactManagerTiming
+{
+  /** @brief The name of the contact manager plugin */
+  std::string name;
+
+  /** @brief The time of a contact test in seconds */
+  double time{ std::numeric_limits<double>::max() };
+
+  /** @brief True if the contacts matched the contacts of the reference manager at every state */
+  bool accurate{ false };
+
+  /** @brief The reason the manager was rejected, empty if it is accurate */
+  std::string message;
+};
+
+/** @brief The contact managers selected for an environment */
+struct ContactManagerAutotuneResult
+{
+  /** @brief The hash of the environment, see getEnvironmentHash */
+  std::uint64_t environment_hash{ 0 };
+
+  /** @brief The fastest accurate discrete contact manager, empty if none was benchmarked */
+  std::string discrete_manager;
+
+  /** @brief The fastest accurate continuous contact manager, empty if none was benchmarked */
+  std::string continuous_manager;
+
+  /** @brief The benchmarks of the discrete contact managers, empty if the result was loaded from a file */
+  std::vector<ContactManagerTiming> discrete_timings;
+
+  /** @brief The benchmarks of the continuous contact managers, empty if the result was loaded from a file */
+  std::vector<ContactManagerTiming> continuous_timings;
+};
+
+/**
+ * @brief Get a hash of the structure of an environment
+ * @details The hash is calculated from the binary encoding of the command history, so it covers the links, joints,
+ * geometry, allowed collisions, margins and contact manager plugins, but not the joint values. Unlike std::hash it is
+ * the same in every process.
+ * @param env The environment
+ * @return The hash
+ */
+std::uint64_t getEnvironmentHash(const Environment& env);
+
+/**
+ * @brief Benchmark the contact manager plugins of an environment on its scene
+ * @details Every discrete and continuous plugin of the environment is checked at the same random states of the
+ * environment, the continuous managers from each state to the next. The active manager of the environment is the
+ * reference, a manager is accurate if it reports the same penetrating pairs at every state and the distance of each
+ * pair reported by both is within the tolerance. Settings like the broadphase or margin handling of a backend are
+ * compared by registering each variant as its own plugin.
+ * @param env The environment, it must be initialized
+ * @param config The settings of the benchmark
+ * @return The benchmarks and the fastest accurate managers
+ */
+ContactManagerAutotuneResult benchmarkContactManagers(const Environment& env,
+                                                      const ContactManagerAutotuneConfig& config = {});
+
+/** @brief The selected contact managers of environments, by the hash of the environment. It is thread safe. */
+class ContactManagerAutotuneCache
+{
+public:
+  using Ptr = std::shared_ptr<ContactManagerAutotuneCache>;
+  using ConstPtr = std::shared_ptr<const ContactManagerAutotuneCache>;
+  using UPtr = std::unique_ptr<ContactManagerAutotuneCache>;
+  using ConstUPtr = std::unique_ptr<const ContactManagerAutotuneCache>;
+
+  /**
+   * @brief Get the result of an environment
+   * @param result The result
+   * @param environment_hash The hash of the environment
+   * @return True if the cache has a result for the hash
+   */
+  bool get(ContactManagerAutotuneResult& result, std::uint64_t environment_hash) const;
+
+  /** @brief Add a result, replacing the result of the same environment hash */
+  void set(const ContactManagerAutotuneResult& result);
+
+  /** @brief The number of results */
+  std::size_t size() const;
+
+  /** @brief Remove all results */
+  void clear();
+
+  /**
+   * @brief Save the selected managers of the results to a YAML file, the benchmarks are not saved
+   * @param file_path The file path
+   * @return True if the file was written
+   */
+  bool save(const std::string& file_path) const;
+
+  /**
+   * @brief Add the results of a YAML file written by save
+   * @param file_path The file path
+   * @return True if the file was read
+   */
+  bool load(const std::string& file_path);
+
+private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::uint64_t, ContactManagerAutotuneResult> results_;
+};
+
+/**
+ * @brief Select the fastest accurate contact managers of an environment and make them active
+ * @details Intended to be called after the environment is initialized. The result is taken from the cache if it has
+ * one for the hash of the environment, otherwise the managers are benchmarked and the result added to the cache.
+ * @param env The environment, it must be initialized
+ * @param config The settings of the benchmark
+ * @param cache The cache of results, may be nullptr
+ * @return The result
+ */
+ContactManagerAutotuneResult autotuneContactManagers(Environment& env,
+                                                     const ContactManagerAutotuneConfig& config = {},
+                                                     ContactManagerAutotuneCache* cache = nullptr);
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_CONTACT_MANAGER_AUTOTUNE_H
@@ -0,0 +1,118 @@
+/**
+ * @file contact_manager_binding.h
+ * @brief Binds the links of a joint group to the collision objects of a contact manager
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_CONTACT_MANAGER_BINDING_H
+#define TESSERACT_ENVIRONMENT_CONTACT_MANAGER_BINDING_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_kinematics/core/joint_group.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief Updates the collision objects of a contact manager directly from the joint values of a joint group
+ * @details Setting the state of a contact manager normally builds the transforms of every link with
+ * StateSolver::getState and passes them to DiscreteContactManager::setCollisionObjectsTransform, which looks up each
+ * link by name. The binding resolves the link index of the joint group and the collision object handle of the
+ * manager of each bound link once, so update() only calculates the bound links and sets them by handle without any
+ * map or string lookup.
+ *
+ * The joint group and the contact manager must outlive the binding. The handles of a manager change when a collision
+ * object is removed, so rebind() must be called after the collision objects of the manager are changed.
+ */
+class ContactManagerBinding
+{
+public:
+  using Ptr = std::shared_ptr<ContactManagerBinding>;
+  using ConstPtr = std::shared_ptr<const ContactManagerBinding>;
+  using UPtr = std::unique_ptr<ContactManagerBinding>;
+  using ConstUPtr = std::unique_ptr<const ContactManagerBinding>;
+
+  /**
+   * @brief Bind the active collision objects of the manager which exist and are links of the joint group
+   * @param manip The joint group the link transforms are calculated with
+   * @param manager The contact manager updated
+   */
+  ContactManagerBinding(const tesseract_kinematics::JointGroup& manip,
+                        tesseract_collision::DiscreteContactManager& manager);
+
+  /**
+   * @brief Bind the provided links
+   * @param manip The joint group the link transforms are calculated with
+   * @param manager The contact manager updated
+   * @param link_names The links to bind, throws if a link is not a link of the joint group or not a collision object
+   * of the manager
+   */
+  ContactManagerBinding(const tesseract_kinematics::JointGroup& manip,
+                        tesseract_collision::DiscreteContactManager& manager,
+                        std::vector<std::string> link_names);
+
+  /**
+   * @brief Update the collision objects of the bound links for the provided joint values
+   * @param joint_values The joint values, in the order of the joint names of the joint group
+   */
+  void update(const Eigen::Ref<const Eigen::VectorXd>& joint_values);
+
+  /** @brief Resolve the collision object handles again, required after the collision objects of the manager change */
+  void rebind();
+
+  /** @brief Get the bound link names */
+  const std::vector<std::string>& getLinkNames() const;
+
+  /** @brief Get the transforms of the bound links calculated by the last update */
+  const tesseract_common::VectorIsometry3d& getLinkTransforms() const;
+
+private:
+  /** @brief The joint group the link transforms are calculated with */
+  const tesseract_kinematics::JointGroup& manip_;
+
+  /** @brief The contact manager updated */
+  tesseract_collision::DiscreteContactManager& manager_;
+
+  /** @brief The bound link names */
+  std::vector<std::string> link_names_;
+
+  /** @brief The index of each bound link in the joint group */
+  std::vector<long> link_indices_;
+
+  /** @brief The collision object handle of each bound link in the contact manager */
+  std::vector<int> handles_;
+
+  /** @brief The transform of each bound link */
+  tesseract_common::VectorIsometry3d link_transforms_;
+};
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_CONTACT_MANAGER_BINDING_H
@@ -29,16 +29,24 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 #include <string>
+#include <set>
 #include <shared_mutex>
+#include <mutex>
+#include <atomic>
 #include <chrono>
+#include <future>
+#include <memory>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/commands.h>
 #include <tesseract_environment/events.h>
+#include <tesseract_environment/event_dispatcher.h>
+#include <tesseract_environment/query_recorder.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/core/contact_managers_plugin_factory.h>
+#include <tesseract_collision/sdf/static_distance_field.h>
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/scene_state.h>
 #include <tesseract_state_solver/mutable_state_solver.h>
@@ -61,6 +69,50 @@ namespace tesseract_environment
  */
 using FindTCPOffsetCallbackFn = std::function<Eigen::Isometry3d(const tesseract_common::ManipulatorInfo&)>;
 
+struct DiscreteContactManagerPoolEntry;
+
+/** @brief Returns a discrete contact manager checked out of an environment to the pool of the thread */
+struct PooledDiscreteContactManagerDeleter
+{
+  /** @brief The pool entry the manager is returned to, nullptr if the manager is not pooled */
+  std::shared_ptr<DiscreteContactManagerPoolEntry> entry;
+
+  /** @brief The generation of the environment contact manager the manager was created from */
+  std::size_t generation{ 0 };
+
+  /** @brief The unique id of the thread which checked out the manager */
+  std::size_t thread_id{ 0 };
+
+  void operator()(tesseract_collision::DiscreteContactManager* manager) const;
+};
+
+/** @brief A discrete contact manager checked out of an environment, see Environment::checkoutDiscreteContactManager */
+using PooledDiscreteContactManager =
+    std::unique_ptr<tesseract_collision::DiscreteContactManager, PooledDiscreteContactManagerDeleter>;
+
+struct JointGroupPoolEntry;
+
+/** @brief Returns a joint or kinematic group checked out of an environment to the pool of the thread */
+struct PooledJointGroupDeleter
+{
+  /** @brief The pool entry the group is returned to, nullptr if the group is not pooled */
+  std::shared_ptr<JointGroupPoolEntry> entry;
+
+  /** @brief The kinematics generation of the environment the group was created from */
+  std::size_t generation{ 0 };
+
+  /** @brief The unique id of the thread which checked out the group */
+  std::size_t thread_id{ 0 };
+
+  void operator()(tesseract_kinematics::JointGroup* group) const;
+};
+
+/** @brief A joint group checked out of an environment, see Environment::checkoutJointGroup */
+using PooledJointGroup = std::unique_ptr<tesseract_kinematics::JointGroup, PooledJointGroupDeleter>;
+
+/** @brief A kinematic group checked out of an environment, see Environment::checkoutKinematicGroup */
+using PooledKinematicGroup = std::unique_ptr<tesseract_kinematics::KinematicGroup, PooledJointGroupDeleter>;
+
 class Environment
 {
 public:
@@ -75,7 +127,7 @@ public:
 
   /** @brief Default constructor */
   Environment() = default;
-  virtual ~Environment() = default;
+  virtual ~Environment();
   Environment(const Environment&) = delete;
   Environment& operator=(const Environment&) = delete;
   Environment(Environment&&) = delete;
@@ -116,10 +168,25 @@ public:
 
   /**
    * @brief Clone the environment
+   * @details The clone shares the parts of the environment which are not changed in place with this environment. The
+   * scene graph is shared until either environment applies a command changing it, the cached kinematic groups are
+   * shared, the state solver shares its compiled tree and the contact managers share the collision shapes.
    * @return A clone of the environment
    */
   Environment::UPtr clone() const;
 
+  /**
+   * @brief Bring the environment up to date with the environment it was cloned from
+   * @details Only the commands of the source applied since this environment was last in sync are applied, which keeps
+   * cached clones warm through small changes like attaching a part. If the command history of this environment is not
+   * the start of the command history of the source, for example because the source was reset, it is initialized from
+   * the command history of the source instead. The current state is set to the current state of the source.
+   * @note This is the update function used by tesseract_common::CloneCache
+   * @param source The environment to update from
+   * @return True if successful, otherwise false
+   */
+  bool update(const Environment::ConstPtr& source);
+
   /**
    * @brief reset to initialized state
    * @details If the environment has not been initialized then this returns false
@@ -145,6 +212,17 @@ public:
    */
   Commands getCommandHistory() const;
 
+  /**
+   * @brief Replace the command history with a checkpoint which initializes an environment equal to this one
+   * @details The command history grows with every command applied, so long running environments attaching and
+   * detaching parts keep an ever growing history which is copied by clone, serialization and monitors syncing from it.
+   * The checkpoint is a few commands adding the current scene graph, contact manager plugins, kinematics information
+   * and collision margins, the current state is kept. The checkpoint becomes the initialized state used by reset and
+   * the revision is set to its size, so clones and monitors following this environment initialize from it again.
+   * @return True if successful, false if the environment is not initialized
+   */
+  bool compactCommandHistory();
+
   /**
    * @brief Applies the commands to the environment
    * @param commands Commands to be applied to the environment
@@ -161,6 +239,50 @@ public:
    */
   bool applyCommand(Command::ConstPtr command);
 
+  /**
+   * @brief Applies the commands to the environment as one batch
+   * @details The scene graph edits of all commands are applied first, then the state solver is rebuilt once and the
+   * collision objects are added to the contact managers in bulk, instead of updating both after every command. This
+   * is much faster when loading a scene of many objects and otherwise behaves like applyCommands.
+   * @param commands Commands to be applied to the environment
+   * @return true if successful. If returned false, then only a partial set of commands have been applied. Call
+   * getCommandHistory to check. Some commands are not checked for success
+   */
+  bool applyCommandsBatch(const Commands& commands);
+
+  /**
+   * @brief Replace the stand-in collision geometry of the links by the geometry loaded in the background
+   * @details A link with loaded geometry is replaced by applying an AddLinkCommand, so the contact managers are updated
+   * like for any other command. Geometry which failed to load is logged and its stand-in is kept.
+   * @param wait Indicate if the geometry which is still loading is waited for, otherwise only the loaded geometry is
+   * applied
+   * @return true if successful. If returned false, then only some of the links have been replaced.
+   */
+  bool applyDeferredCollisionGeometry(bool wait = false);
+
+  /**
+   * @brief Check if any link has stand-in collision geometry, see setInitDeferCollisionMeshes
+   * @return True if a link has stand-in collision geometry, otherwise false
+   */
+  bool hasDeferredCollisionGeometry() const;
+
+  /**
+   * @brief Get the memory used by the environment
+   * @details The report is broken down into the scene graph, the command history, the contact managers, the static
+   * distance field and the kinematics caches. Geometry shared between them, for example a mesh used by the scene graph
+   * and the contact managers, is counted once.
+   * @param tracker Tracks the storage already counted, pass the same tracker to the reports of the clones of an
+   * environment so the storage they share is only counted once
+   * @return The memory usage report
+   */
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
+  /**
+   * @brief Get the memory used by the environment
+   * @return The memory usage report
+   */
+  tesseract_common::MemoryUsage getMemoryUsage() const;
+
   /**
    * @brief Get the Scene Graph
    * @return SceneGraphConstPtr
@@ -200,6 +322,29 @@ public:
   tesseract_kinematics::KinematicGroup::UPtr getKinematicGroup(const std::string& group_name,
                                                                std::string ik_solver_name = "") const;
 
+  /**
+   * @brief Check out a copy of a joint group from the pool of the calling thread
+   * @details Each thread keeps one group per environment and group name which is reused while the kinematics of the
+   * environment have not changed, so checking out does not copy the group or lock the environment. The group is copied
+   * again the first time it is checked out after the environment changed, including setting the current state.
+   * Checking out while the pooled group of the thread is in use returns a copy which is not pooled.
+   *
+   * The group is returned to the pool when it is destroyed on the thread which checked it out, otherwise it is deleted.
+   * @param group_name The group name
+   * @return A joint group, throws like getJointGroup if the group does not exist
+   */
+  PooledJointGroup checkoutJointGroup(const std::string& group_name) const;
+
+  /**
+   * @brief Check out a copy of a kinematic group from the pool of the calling thread
+   * @details The kinematic group equivalent of checkoutJointGroup, see getKinematicGroup for the arguments
+   * @param group_name The group name
+   * @param ik_solver_name The IK solver name, the default IK solver of the group if empty
+   * @return A kinematics group, nullptr if it could not be created
+   */
+  PooledKinematicGroup checkoutKinematicGroup(const std::string& group_name,
+                                              const std::string& ik_solver_name = "") const;
+
   /**
    * @brief Find tool center point provided in the manipulator info
    *
@@ -210,6 +355,8 @@ public:
    *    - Next if not found, it leverages the user defined callbacks to try an locate the tcp information.
    *    - Next throw an exception, because no tcp information was located.
    *
+   * The offsets found by name are cached until the state or the environment changes or a callback is added.
+   *
    * @param manip_info The manipulator info
    * @return The tool center point
    */
@@ -238,15 +385,45 @@ public:
    */
   void addEventCallback(std::size_t hash, const EventCallbackFn& fn);
 
+  /**
+   * @brief Add an event callback function which is called on its own thread
+   * @details The events are queued and delivered by the EventDispatcher, so a slow callback does not stall applying
+   * commands. Queued events are coalesced while the callback is busy and command applied events only hold the commands
+   * applied since the previous event, see EventDispatcher.
+   * @note These do not get cloned or serialized
+   * @param hash The id associated with the callback to allow removal
+   * @param fn User defined callback function which gets called for different event triggers
+   */
+  void addAsyncEventCallback(std::size_t hash, const EventCallbackFn& fn);
+
+  /** @brief Wait until the queued events of the asynchronous event callbacks have been delivered */
+  void waitForAsyncEvents() const;
+
   /**
    * @brief Remove event callbacks
+   * @details Removing an asynchronous callback waits for it to return if it is in progress
    * @param hash the id associated with the callback to be removed
    */
   void removeEventCallback(std::size_t hash);
 
-  /** @brief clear all event callbacks */
+  /** @brief clear all event callbacks, including the asynchronous callbacks */
   void clearEventCallbacks();
 
+  /**
+   * @brief Set the recorder the state changes of the environment are recorded to
+   * @details The contact tests, trajectory checks and inverse kinematics queries are run on the contact managers and
+   * groups of the environment, so they are recorded to the recorder by the caller, see QueryRecorder.
+   * @note The recorder is not cloned or serialized
+   * @param recorder The recorder, nullptr stops recording
+   */
+  void setQueryRecorder(QueryRecorder::Ptr recorder);
+
+  /**
+   * @brief Get the recorder the state changes of the environment are recorded to
+   * @return The recorder, nullptr if the environment is not recorded
+   */
+  QueryRecorder::Ptr getQueryRecorder() const;
+
   /**
    * @brief Get the current event callbacks stored in the environment
    * @return A map of callback functions
@@ -266,6 +443,52 @@ public:
    */
   tesseract_common::ResourceLocator::ConstPtr getResourceLocator() const;
 
+  /**
+   * @brief Set the number of threads used to parse the links when initializing from a URDF
+   * @details Loading the meshes of the links and creating their convex hulls dominates the time to initialize from a
+   * URDF, so with more than one thread the links are parsed in parallel. The resource locator must be safe to call from
+   * several threads. The default is one.
+   * @param threads The number of threads
+   */
+  void setInitThreads(std::size_t threads);
+
+  /**
+   * @brief Get the number of threads used to parse the links when initializing from a URDF
+   * @return The number of threads
+   */
+  std::size_t getInitThreads() const;
+
+  /**
+   * @brief Set if the visual geometry of the links is loaded when initializing from a URDF
+   * @details The visual meshes, materials and textures are only needed for rendering, so environments which are never
+   * rendered, like those of planning servers, can skip them to reduce the time to initialize and the memory used. The
+   * links then have no visuals. The default is true.
+   * @param load_visuals Indicate if the visual geometry is loaded
+   */
+  void setInitLoadVisuals(bool load_visuals);
+
+  /**
+   * @brief Check if the visual geometry of the links is loaded when initializing from a URDF
+   * @return True if the visual geometry is loaded, otherwise false
+   */
+  bool getInitLoadVisuals() const;
+
+  /**
+   * @brief Set if the collision meshes of the links are loaded in the background when initializing from a URDF
+   * @details Each collision mesh and convex mesh is replaced by a box around the vertices of its file, so the
+   * conversion to convex hulls, the simplification and creating the shapes of the contact managers are skipped for
+   * the initialization. The meshes are loaded on the default executor and replace the boxes when calling
+   * applyDeferredCollisionGeometry, for example before planning near the links. The default is false.
+   * @param defer_collision_meshes Indicate if the collision meshes are loaded in the background
+   */
+  void setInitDeferCollisionMeshes(bool defer_collision_meshes);
+
+  /**
+   * @brief Check if the collision meshes of the links are loaded in the background when initializing from a URDF
+   * @return True if the collision meshes are loaded in the background, otherwise false
+   */
+  bool getInitDeferCollisionMeshes() const;
+
   /** @brief Give the environment a name */
   void setName(const std::string& name);
 
@@ -285,6 +508,35 @@ public:
   void setState(const std::unordered_map<std::string, double>& joints);
   void setState(const std::vector<std::string>& joint_names, const Eigen::Ref<const Eigen::VectorXd>& joint_values);
 
+  /**
+   * @brief Register a joint state stream, used to feed joint states at a high rate
+   * @details The joint values of a stream are provided by setStreamState, which only stores them, and are applied to
+   * the current state by flushStateStreams. The joints are resolved to state solver indices once, so no joint name is
+   * looked up per update. Throws if a joint does not exist.
+   * @note The streams are not cloned or serialized
+   * @param joint_names The names of the joints of the stream, in the order of the values provided to setStreamState
+   * @return The id of the stream
+   */
+  std::size_t registerStateStream(const std::vector<std::string>& joint_names);
+
+  /**
+   * @brief Store the latest joint values of a state stream
+   * @details This does not take the environment lock. Values stored since the last flush are replaced, so only the
+   * latest values of each stream are applied. Throws if the stream does not exist or the size does not match.
+   * @param stream_id The id of the stream returned by registerStateStream
+   * @param joint_values The joint values, in the order of the joint names of the stream
+   */
+  void setStreamState(std::size_t stream_id, const Eigen::Ref<const Eigen::VectorXd>& joint_values);
+
+  /**
+   * @brief Apply the joint values stored by all state streams to the current state, intended to be called once per tick
+   * @details The link transforms are only recomputed for the links moved by joints whose value changed, and the
+   * contact managers only updated for those links. Instead of a SceneStateChangedEvent the callbacks are passed a
+   * LinkTransformsChangedEvent with the names of the links that moved. Throws if a joint of a stream was removed.
+   * @return True if any link moved, otherwise false
+   */
+  bool flushStateStreams();
+
   /**
    * @brief Get the state of the environment for a given set or subset of joint values.
    *
@@ -297,9 +549,20 @@ public:
   tesseract_scene_graph::SceneState getState(const std::vector<std::string>& joint_names,
                                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
 
-  /** @brief Get the current state of the environment */
+  /**
+   * @brief Get the current state of the environment
+   * @details The current state is read from its published snapshot without locking the environment, so it does not wait
+   * for commands being applied and returns the state from before them until they are done.
+   */
   tesseract_scene_graph::SceneState getState() const;
 
+  /**
+   * @brief Get the snapshot of the current state of the environment without copying it
+   * @details A new snapshot is published every time the current state changes, the returned snapshot is never modified.
+   * Like getState this does not lock the environment.
+   */
+  std::shared_ptr<const tesseract_scene_graph::SceneState> getStateSnapshot() const;
+
   /** @brief Last update time. Updated when any change to the environment occurs */
   std::chrono::system_clock::time_point getTimestamp() const;
 
@@ -345,6 +608,14 @@ public:
    */
   tesseract_common::AllowedCollisionMatrix::ConstPtr getAllowedCollisionMatrix() const;
 
+  /**
+   * @brief Get the compiled form of the allowed collision matrix used by the contact managers
+   * @details It is rebuilt whenever the environment changes, so the link indices are only valid for the current
+   * revision.
+   * @return The compiled allowed collision matrix
+   */
+  tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr getCompiledAllowedCollisionMatrix() const;
+
   /**
    * @brief Get a vector of joint names in the environment
    * @return A vector of joint names
@@ -360,7 +631,7 @@ public:
   /**
    * @brief Get the current state of the environment
    *
-   * Order should be the same as getActiveJointNames()
+   * Order should be the same as getActiveJointNames(). Like getState this does not lock the environment.
    *
    * @return A vector of joint values
    */
@@ -369,7 +640,7 @@ public:
   /**
    * @brief Get the current joint values for a vector of joints
    *
-   * Order should be the same as the input vector
+   * Order should be the same as the input vector. Like getState this does not lock the environment.
    *
    * @return A vector of joint values
    */
@@ -430,6 +701,8 @@ public:
 
   /**
    * @brief Get transform between two links using the current state
+   * @details The transform of links connected by fixed joints only is calculated from transforms computed when the
+   * environment changes. Other transforms are cached until the state changes.
    * @param from_link_name The link name the transform should be relative to
    * @param to_link_name The link name to get transform
    * @return The relative transform = inv(Transform(from_link_name)) * Transform(to_link_name)
@@ -466,14 +739,33 @@ public:
 
   /**
    * @brief Set the active discrete contact manager
+   * @details The manager is created on first use, see getDiscreteContactManager
    * @param name The name used to register the contact manager
    * @return True of name exists in DiscreteContactManagerFactory
    */
   bool setActiveDiscreteContactManager(const std::string& name);
 
-  /** @brief Get a copy of the environments active discrete contact manager */
+  /**
+   * @brief Get a copy of the environments active discrete contact manager
+   * @details The active manager is created and populated with the collision objects of every link the first time it is
+   * requested, so an environment which is only used for continuous checks never builds a discrete manager.
+   */
   tesseract_collision::DiscreteContactManager::UPtr getDiscreteContactManager() const;
 
+  /**
+   * @brief Check out a copy of the environments active discrete contact manager from the pool of the calling thread
+   * @details Each thread keeps one manager per environment which is reused while the contact managers of the
+   * environment have not changed, so checking out does not clone or lock the environment. The manager is copied again
+   * the first time it is checked out after the environment changed, including setting the current state. Checking out
+   * while the pooled manager of the thread is in use returns a copy which is not pooled.
+   *
+   * The manager is returned to the pool when it is destroyed on the thread which checked it out, otherwise it is
+   * deleted. It is reused as is, so changes other than the transforms of the collision objects should be reverted
+   * before it is returned. A reused manager keeps the transforms set during its last use.
+   * @return The discrete contact manager, nullptr if the active discrete contact manager could not be created
+   */
+  PooledDiscreteContactManager checkoutDiscreteContactManager() const;
+
   /**
    * @brief Set the cached internal copy of the environments active discrete contact manager not nullptr
    * @details This can be useful to save space in the event the environment is being saved
@@ -485,12 +777,17 @@ public:
 
   /**
    * @brief Set the active continuous contact manager
+   * @details The manager is created on first use, see getContinuousContactManager
    * @param name The name used to register the contact manager
    * @return True of name exists in ContinuousContactManagerFactory
    */
   bool setActiveContinuousContactManager(const std::string& name);
 
-  /** @brief Get a copy of the environments active continuous contact manager */
+  /**
+   * @brief Get a copy of the environments active continuous contact manager
+   * @details The active manager is created and populated with the collision objects of every link the first time it is
+   * requested, so an environment which is only used for discrete checks never builds a continuous manager.
+   */
   tesseract_collision::ContinuousContactManager::UPtr getContinuousContactManager() const;
 
   /**
@@ -502,6 +799,35 @@ public:
   /** @brief Get a copy of the environments available continuous contact manager by name */
   tesseract_collision::ContinuousContactManager::UPtr getContinuousContactManager(const std::string& name) const;
 
+  /**
+   * @brief Build the active contact managers in a background thread, so the first request does not have to
+   * @details The environment must outlive the build. The destructor of the returned future waits for the build.
+   * @param discrete Indicates if the active discrete contact manager is built
+   * @param continuous Indicates if the active continuous contact manager is built
+   * @return A future which is true once the requested managers are built, false if one could not be created
+   */
+  std::future<bool> prebuildContactManagers(bool discrete = true, bool continuous = true) const;
+
+  /**
+   * @brief Set the resolution of the distance field of the static links used to filter the active contact managers
+   * @details When enabled, the copies returned by getDiscreteContactManager and getContinuousContactManager wrap the
+   * active manager so active links whose bounding sphere is further than the collision margin from the static links
+   * skip the broadphase and narrowphase against them, see DistanceFieldFilteredDiscreteManager. The contacts found are
+   * the same. The field is built on first use for each revision of the environment. Managers requested by name and
+   * checked out managers created before this call are not filtered.
+   * @param resolution The size of the voxels of the distance field, zero or less disables the filter
+   */
+  void setStaticDistanceFieldResolution(double resolution);
+
+  /** @brief Get the resolution of the distance field of the static links, zero or less if the filter is disabled */
+  double getStaticDistanceFieldResolution() const;
+
+  /**
+   * @brief Get the distance field of the static links, the links which are not moved by any active joint
+   * @return The distance field of the current revision, nullptr if the filter is disabled
+   */
+  tesseract_collision::tesseract_collision_sdf::StaticDistanceField::ConstPtr getStaticDistanceField() const;
+
   /** @brief Get the environment collision margin data */
   tesseract_common::CollisionMarginData getCollisionMarginData() const;
 
@@ -563,8 +889,25 @@ protected:
    */
   tesseract_kinematics::KinematicsPluginFactory kinematics_factory_;
 
-  /** @brief Current state of the environment */
-  tesseract_scene_graph::SceneState current_state_;
+  /** @brief A snapshot of the current state with the active joint names it was calculated for */
+  struct CurrentState
+  {
+    tesseract_scene_graph::SceneState state;
+    std::shared_ptr<const std::vector<std::string>> active_joint_names;
+  };
+
+  /** @brief The active joint names of the state solver, updated when the environment changes */
+  std::shared_ptr<const std::vector<std::string>> active_joint_names_{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /**
+   * @brief Current state of the environment
+   * @details The snapshot is replaced and never modified, it is stored with std::atomic_store so the current state is
+   * read with std::atomic_load without locking mutex_. Functions holding mutex_ may read it directly.
+   */
+  std::shared_ptr<const CurrentState> current_state_{ std::make_shared<const CurrentState>(
+      CurrentState{ tesseract_scene_graph::SceneState(), active_joint_names_ }) };
 
   /** @brief Environment timestamp */
   std::chrono::system_clock::time_point timestamp_{ std::chrono::system_clock::now() };
@@ -584,6 +927,16 @@ protected:
    */
   tesseract_collision::IsContactAllowedFn is_contact_allowed_fn_;
 
+  /**
+   * @brief The compiled allowed collision matrix queried by is_contact_allowed_fn_
+   * @details It is replaced when the environment changes, which the contact managers detect to update the pairs they
+   * filter from the broadphase.
+   * @note This is intentionally not serialized it will auto updated
+   */
+  tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr compiled_acm_{
+    std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>()
+  };
+
   /**
    * @brief A vector of user defined callbacks for locating tool center point
    * @todo This needs to be switched to class so it may be serialized
@@ -596,9 +949,30 @@ protected:
    */
   std::map<std::size_t, EventCallbackFn> event_cb_{};
 
+  /**
+   * @brief Delivers the events to the asynchronous event callbacks
+   * @details This should not be cloned or serialized
+   */
+  EventDispatcher event_dispatcher_;
+
+  /**
+   * @brief The recorder the state changes are recorded to, nullptr if the environment is not recorded
+   * @details This should not be cloned or serialized
+   */
+  QueryRecorder::Ptr query_recorder_{ nullptr };
+
   /** @brief Used when initialized by URDF_STRING, URDF_STRING_SRDF_STRING, URDF_PATH, and URDF_PATH_SRDF_PATH */
   tesseract_common::ResourceLocator::ConstPtr resource_locator_{ nullptr };
 
+  /** @brief The number of threads used to parse the links when initializing from a URDF */
+  std::size_t init_threads_{ 1 };
+
+  /** @brief Indicate if the visual geometry of the links is loaded when initializing from a URDF */
+  bool init_load_visuals_{ true };
+
+  /** @brief Indicate if the collision meshes of the links are loaded in the background when initializing from a URDF */
+  bool init_defer_collision_meshes_{ false };
+
   /**
    * @brief The contact manager information
    * @note This is intentionally not serialized it will auto updated
@@ -624,6 +998,19 @@ protected:
   mutable tesseract_collision::DiscreteContactManager::UPtr discrete_manager_{ nullptr };
   mutable std::shared_mutex discrete_manager_mutex_;
 
+  /**
+   * @brief Incremented after the discrete contact manager object changed, the pooled managers of an older
+   * generation are copied again when checked out
+   * @note This is intentionally not serialized
+   */
+  mutable std::atomic<std::size_t> discrete_manager_generation_{ 0 };
+
+  /**
+   * @brief Identifies the environment in the pools of the threads, which drop their objects once it expires
+   * @note This is intentionally not serialized
+   */
+  std::shared_ptr<const int> pool_token_{ std::make_shared<const int>(0) };
+
   /**
    * @brief The continuous contact manager object
    * @note This is intentionally not serialized it will auto updated
@@ -631,6 +1018,30 @@ protected:
   mutable tesseract_collision::ContinuousContactManager::UPtr continuous_manager_{ nullptr };
   mutable std::shared_mutex continuous_manager_mutex_;
 
+  /**
+   * @brief The resolution of the distance field of the static links, zero or less disables the filter
+   * @note This is intentionally not serialized
+   */
+  double static_distance_field_resolution_{ 0 };
+
+  /**
+   * @brief The distance field of the static links, built on first use for static_distance_field_revision_
+   * @note This is intentionally not serialized it will auto updated
+   */
+  mutable tesseract_collision::tesseract_collision_sdf::StaticDistanceField::ConstPtr static_distance_field_{ nullptr };
+  mutable int static_distance_field_revision_{ -1 };
+  mutable std::mutex static_distance_field_mutex_;
+
+  /**
+   * @brief The active collision objects of each kinematic group, named by the group
+   * @details This is updated when the environment changes and shared with the contact managers, so a group can be
+   * selected with applyActiveCollisionObjectsProfile
+   * @note This is intentionally not serialized it will auto updated
+   */
+  std::shared_ptr<const tesseract_collision::ActiveCollisionObjectsProfiles> active_collision_objects_profiles_{
+    std::make_shared<const tesseract_collision::ActiveCollisionObjectsProfiles>()
+  };
+
   /**
    * @brief A cache of group joint names to provide faster access
    * @details This will cleared when environment changes
@@ -644,7 +1055,7 @@ protected:
    * @details This will cleared when environment changes
    * @note This is intentionally not serialized it will auto updated
    */
-  mutable std::unordered_map<std::string, tesseract_kinematics::JointGroup::UPtr> joint_group_cache_{};
+  mutable std::unordered_map<std::string, tesseract_kinematics::JointGroup::ConstPtr> joint_group_cache_{};
   mutable std::shared_mutex joint_group_cache_mutex_;
 
   /**
@@ -652,19 +1063,120 @@ protected:
    * @details This will cleared when environment changes
    * @note This is intentionally not serialized it will auto updated
    */
-  mutable std::map<std::pair<std::string, std::string>, tesseract_kinematics::KinematicGroup::UPtr>
+  mutable std::map<std::pair<std::string, std::string>, tesseract_kinematics::KinematicGroup::ConstPtr>
       kinematic_group_cache_{};
   mutable std::shared_mutex kinematic_group_cache_mutex_;
 
+  /**
+   * @brief The link each link is attached to by fixed joints only, which is the link itself if its parent joint is not
+   * fixed, and the transform of the link relative to it
+   * @details Links attached to the same link have a relative transform which does not depend on the state. This is
+   * updated when the environment changes.
+   * @note This is intentionally not serialized it will auto updated
+   */
+  tesseract_common::AlignedUnorderedMap<std::string, std::pair<std::string, Eigen::Isometry3d>>
+      fixed_link_transforms_{};
+
+  /**
+   * @brief A cache of the relative link transforms of the current state
+   * @details This will cleared when the state changes
+   * @note This is intentionally not serialized it will auto updated
+   */
+  mutable tesseract_common::AlignedMap<std::pair<std::string, std::string>, Eigen::Isometry3d>
+      relative_link_transform_cache_{};
+
+  /**
+   * @brief A cache of the tcp offsets found by name
+   * @details This will cleared when the state changes or a find tcp offset callback is added
+   * @note This is intentionally not serialized it will auto updated
+   */
+  mutable tesseract_common::AlignedMap<std::string, Eigen::Isometry3d> tcp_offset_cache_{};
+  mutable std::shared_mutex transform_cache_mutex_;
+
+  /**
+   * @brief Incremented after the joint and kinematic group caches are cleared, the pooled groups of an older
+   * generation are copied again when checked out
+   * @note This is intentionally not serialized
+   */
+  mutable std::atomic<std::size_t> kinematics_generation_{ 0 };
+
   /** @brief The environment can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
+  /** @brief A joint state stream registered with registerStateStream */
+  struct StateStream
+  {
+    /** @brief The names of the joints of the stream */
+    std::vector<std::string> joint_names;
+
+    /** @brief The state solver index of each joint, resolved when flushed after the environment changed */
+    std::vector<long> joint_indices;
+
+    /** @brief The latest joint values stored by setStreamState */
+    Eigen::VectorXd joint_values;
+
+    /** @brief Indicates joint values were stored since the last flush */
+    bool pending{ false };
+  };
+
+  /**
+   * @brief The registered state streams, indexed by their id
+   * @note This is intentionally not cloned or serialized
+   */
+  std::vector<StateStream> state_streams_;
+
+  /** @brief Protects the state streams, so storing joint values does not take the environment lock */
+  std::mutex state_streams_mutex_;
+
+  /**
+   * @brief The link name and joint name of each node of the state solver, used to resolve the changed links
+   * @details They are cleared when the environment changes, invalidating the joint indices of the streams
+   */
+  std::vector<std::string> state_stream_link_names_;
+  std::vector<std::string> state_stream_joint_names_;
+
+  /**
+   * @brief Shared with the clones sharing scene_graph_, which is copied before it is changed while it is shared
+   * @note This is intentionally not serialized
+   */
+  std::shared_ptr<const int> scene_graph_token_{ std::make_shared<const int>(0) };
+
+  /** @brief Copy the scene graph if it is shared with a clone, must be called before the scene graph is changed */
+  void copySceneGraphOnWrite();
+
   /** This will update the contact managers transforms */
   void currentStateChanged();
 
+  /**
+   * @brief This will update the contact managers transforms of the links moved by a state stream
+   * @param link_transforms The transforms of the links that moved, already stored in the current state
+   */
+  void currentStateStreamed(const tesseract_common::TransformMap& link_transforms);
+
   /** This will notify the state solver that the environment has changed */
   void environmentChanged();
 
+  /**
+   * @brief Update the active collision objects profiles of the kinematic groups
+   * @note This does not take a lock
+   */
+  void updateActiveCollisionObjectsProfiles();
+
+  /**
+   * @brief Update the transforms of the links relative to the link they are attached to by fixed joints only
+   * @note This does not take a lock
+   */
+  void updateFixedLinkTransforms();
+
+  /** @brief Clear the caches of the relative link transforms and tcp offsets */
+  void clearTransformCaches() const;
+
+  /**
+   * @brief Get the joint names of a group
+   * @note This does not take a lock
+   */
+  std::vector<std::string> getGroupJointNamesHelper(const std::string& group_name) const;
+
   /**
    * @brief @brief Passes a current state changed event to the callbacks
    * @note This does not take a lock
@@ -684,6 +1196,12 @@ private:
                                  tesseract_common::VectorIsometry3d& shape_poses,
                                  const tesseract_scene_graph::Link& link);
 
+  /** @brief Get the collision objects of the links which have collision geometry */
+  static void getCollisionObjects(std::vector<std::string>& names,
+                                  std::vector<tesseract_collision::CollisionShapesConst>& shapes,
+                                  std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                  const std::vector<tesseract_scene_graph::Link::ConstPtr>& links);
+
   bool setActiveDiscreteContactManagerHelper(const std::string& name);
   bool setActiveContinuousContactManagerHelper(const std::string& name);
 
@@ -691,13 +1209,51 @@ private:
 
   tesseract_collision::ContinuousContactManager::UPtr getContinuousContactManagerHelper(const std::string& name) const;
 
-  bool initHelper(const Commands& commands);
+  /** @brief Get the distance field of the static links of the current revision, the caller must lock mutex_ */
+  tesseract_collision::tesseract_collision_sdf::StaticDistanceField::ConstPtr getStaticDistanceFieldHelper() const;
+
+  /**
+   * @brief Create the active discrete contact manager if it does not exist
+   * @note The calling function should be locking mutex_ and discrete_manager_mutex_
+   */
+  bool createDiscreteContactManagerHelper() const;
+
+  /**
+   * @brief Create the active continuous contact manager if it does not exist
+   * @note The calling function should be locking mutex_ and continuous_manager_mutex_
+   */
+  bool createContinuousContactManagerHelper() const;
+
+  /**
+   * @brief Initialize the environment from the commands, this does not take a lock
+   * @param commands The commands, the first must add the scene graph
+   * @param batch Indicate if the commands are applied as one batch, see applyCommandsBatch
+   */
+  bool initHelper(const Commands& commands, bool batch = false);
   static Commands getInitCommands(const tesseract_scene_graph::SceneGraph& scene_graph,
                                   const tesseract_srdf::SRDFModel::ConstPtr& srdf_model = nullptr);
 
   /** @brief Apply Command Helper which does not lock */
   bool applyCommandsHelper(const Commands& commands);
 
+  /** @brief Indicates commands are applied as a batch, the state solver and contact managers are updated at the end */
+  bool batch_{ false };
+
+  /** @brief Indicates a command of the batch changed the state solver, it is rebuilt from the scene graph */
+  bool batch_state_solver_changed_{ false };
+
+  /** @brief The links of the batch removed from the contact managers */
+  std::set<std::string> batch_removed_links_;
+
+  /** @brief The links of the batch added to the contact managers, after the removed links */
+  std::set<std::string> batch_added_links_;
+
+  /** @brief The links of the batch which changed if collision is enabled */
+  std::set<std::string> batch_collision_enabled_links_;
+
+  /** @brief Apply the deferred state solver and contact manager changes of a batch, this does not take a lock */
+  void applyBatchChanges();
+
   // Command Helper function
   bool applyAddCommand(AddLinkCommand::ConstPtr cmd);
   bool applyMoveLinkCommand(const MoveLinkCommand::ConstPtr& cmd);
@@ -705,6 +1261,7 @@ private:
   bool applyRemoveLinkCommand(const RemoveLinkCommand::ConstPtr& cmd);
   bool applyRemoveJointCommand(const RemoveJointCommand::ConstPtr& cmd);
   bool applyReplaceJointCommand(const ReplaceJointCommand::ConstPtr& cmd);
+  bool applyAttachLinkCommand(const AttachLinkCommand::ConstPtr& cmd);
   bool applyChangeLinkOriginCommand(const ChangeLinkOriginCommand::ConstPtr& cmd);
   bool applyChangeJointOriginCommand(const ChangeJointOriginCommand::ConstPtr& cmd);
   bool applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisionEnabledCommand::ConstPtr& cmd);
@@ -733,4 +1290,7 @@ private:
 };
 }  // namespace tesseract_environment
 
+#include <boost/serialization/version.hpp>
+// Version 1 stores each command in its own archive in binary archives, so they are decoded in parallel
+BOOST_CLASS_VERSION(tesseract_environment::Environment, 1)
 #endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_H
@@ -32,6 +32,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <thread>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
@@ -74,13 +77,46 @@ public:
   virtual Environment::UPtr getCachedEnvironment() const = 0;
 };
 
+/** @brief The metrics of the requests for cached environments */
+struct EnvironmentCacheMetrics
+{
+  /** @brief The number of requests served by an up to date cached environment */
+  std::size_t hits{ 0 };
+
+  /** @brief The number of requests which had to wait for an environment to be cloned or updated */
+  std::size_t misses{ 0 };
+
+  /** @brief The total time requests waited for an environment */
+  std::chrono::nanoseconds total_wait_time{ 0 };
+
+  /** @brief The longest time a request waited for an environment */
+  std::chrono::nanoseconds max_wait_time{ 0 };
+};
+
+/**
+ * @brief A cache of clones of an environment
+ * @details By default the cache is refilled by the thread requesting an environment once it runs low or the
+ * environment changed. In the asynchronous mode a background thread keeps the cache topped up and updates the cached
+ * environments shortly after the environment changed, so a request only waits if the cache ran dry.
+ */
 class DefaultEnvironmentCache : public EnvironmentCache
 {
 public:
   using Ptr = std::shared_ptr<DefaultEnvironmentCache>;
   using ConstPtr = std::shared_ptr<const DefaultEnvironmentCache>;
 
-  DefaultEnvironmentCache(Environment::ConstPtr env, std::size_t cache_size = 5);
+  /**
+   * @brief Construct the cache
+   * @param env The environment cloned
+   * @param cache_size The number of cached environments
+   * @param async Indicates if the cache is refilled by a background thread
+   */
+  DefaultEnvironmentCache(Environment::ConstPtr env, std::size_t cache_size = 5, bool async = false);
+  ~DefaultEnvironmentCache() override;
+  DefaultEnvironmentCache(const DefaultEnvironmentCache&) = delete;
+  DefaultEnvironmentCache& operator=(const DefaultEnvironmentCache&) = delete;
+  DefaultEnvironmentCache(DefaultEnvironmentCache&&) = delete;
+  DefaultEnvironmentCache& operator=(DefaultEnvironmentCache&&) = delete;
 
   /**
    * @brief Set the cache size used to hold tesseract objects for motion planning
@@ -94,7 +130,7 @@ public:
    */
   long getCacheSize() const override final;
 
-  /** @brief If the environment has changed it will rebuild the cache of tesseract objects */
+  /** @brief If the environment has changed it will update the cache of tesseract objects */
   void refreshCache() const override final;
 
   /**
@@ -103,6 +139,15 @@ public:
    */
   Environment::UPtr getCachedEnvironment() const override final;
 
+  /** @brief Check if the cache is refilled by a background thread */
+  bool isAsync() const;
+
+  /** @brief Get the metrics of the requests for cached environments */
+  EnvironmentCacheMetrics getMetrics() const;
+
+  /** @brief Reset the metrics of the requests for cached environments */
+  void resetMetrics();
+
 protected:
   /** @brief The tesseract_object used to create the cache */
   Environment::ConstPtr env_;
@@ -119,8 +164,29 @@ protected:
   /** @brief The mutex used when reading and writing to cache_ */
   mutable std::shared_mutex cache_mutex_;
 
+  /** @brief The metrics of the requests for cached environments */
+  mutable EnvironmentCacheMetrics metrics_;
+
+  /** @brief The background thread refilling the cache, only running in the asynchronous mode */
+  std::thread refill_thread_;
+
+  /** @brief Indicates the background thread should stop */
+  bool stop_refill_{ false };
+
+  /** @brief Notifies the background thread that the cache needs to be refilled */
+  mutable std::condition_variable_any refill_cv_;
+
+  /** @brief Notifies requests waiting for a cached environment */
+  mutable std::condition_variable_any ready_cv_;
+
+  /** @brief The period the background thread checks if the environment changed */
+  static constexpr std::chrono::milliseconds refill_period_{ 10 };
+
   /** @brief This does not take a lock */
   void refreshCacheHelper() const;
+
+  /** @brief The loop of the background thread refilling the cache */
+  void refillLoop();
 };
 }  // namespace tesseract_environment
 
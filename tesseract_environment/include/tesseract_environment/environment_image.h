@@ -0,0 +1,72 @@
+/**
+ * @file environment_image.h
+ * @brief A binary image of an environment for fast startup
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ENVIRONMENT_IMAGE_H
+#define TESSERACT_ENVIRONMENT_ENVIRONMENT_IMAGE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <cstdint>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_environment
+{
+/** @brief The version of the environment image format, images of another version are rejected */
+static constexpr std::uint32_t ENVIRONMENT_IMAGE_VERSION{ 1 };
+
+/**
+ * @brief Save a binary image of the environment
+ * @details The image is a small header followed by the binary archive of the environment. The archive holds the
+ * command history with the processed geometry, the triangulated meshes and convex hulls the parsers created, so
+ * loading it does not parse URDF or SRDF or load any mesh files. Each command is stored in its own archive and decoded
+ * in parallel, the state solver is built once from the final scene graph and the contact managers and their bounding
+ * volume hierarchies are built from this geometry on first use.
+ * @param env The environment, it must be initialized
+ * @param file_path The file path of the image
+ * @return True if the image was written
+ */
+bool saveEnvironmentImage(const Environment& env, const std::string& file_path);
+
+/**
+ * @brief Load an environment from a binary image
+ * @details The file is memory mapped and the environment read directly from the mapping, without copying the file.
+ * @param file_path The file path of the image
+ * @return The environment, nullptr if the file could not be read or is not an image of this version
+ */
+Environment::UPtr loadEnvironmentImage(const std::string& file_path);
+
+/**
+ * @brief Load an environment from a binary image in memory, for example a mapping owned by the caller
+ * @param data The image
+ * @param size The size of the image in bytes
+ * @return The environment, nullptr if the data is not an image of this version
+ */
+Environment::UPtr loadEnvironmentImage(const char* data, std::size_t size);
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_IMAGE_H
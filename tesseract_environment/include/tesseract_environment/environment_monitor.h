@@ -57,7 +57,13 @@ enum class MonitoredEnvironmentMode : int
   SYNCHRONIZED = 1
 };
 
-/** @brief Tesseract Environment Monitor Interface Class */
+/**
+ * @brief Tesseract Environment Monitor Interface Class
+ * @details The functions in environment_sync.h provide the changes since a revision and a separate joint state
+ * channel in a compact binary encoding, so a monitor does not need to send the whole command history to resync.
+ * Monitors and consumers on the same host can exchange the state and trajectories through the shared memory channels
+ * in shared_memory_transport.h instead, which skips serialization altogether.
+ */
 class EnvironmentMonitor
 {
 public:
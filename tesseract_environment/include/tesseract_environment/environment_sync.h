@@ -0,0 +1,141 @@
+/**
+ * @file environment_sync.h
+ * @brief Revision based synchronization of environments with a compact binary encoding
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ENVIRONMENT_SYNC_H
+#define TESSERACT_ENVIRONMENT_ENVIRONMENT_SYNC_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/commands.h>
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief The commands which bring an environment at a revision up to date with the environment they were taken from
+ * @details This is what an environment monitor sends instead of the whole command history, so only a resync of a
+ * monitor that fell behind a reset or a compaction of the command history sends every command.
+ */
+struct EnvironmentDelta
+{
+  /** @brief The revision the commands are applied to, zero if they initialize the environment */
+  int from_revision{ 0 };
+
+  /** @brief The revision of the environment after the commands are applied */
+  int revision{ 0 };
+
+  /** @brief The commands */
+  Commands commands;
+};
+
+/**
+ * @brief The current joint values of an environment
+ * @details Sent on its own channel at a high rate, separate from the commands which change the structure. The revision
+ * is the revision of the environment the joint values were taken from, so they are only applied to the same structure.
+ */
+struct EnvironmentStateUpdate
+{
+  /** @brief The revision of the environment the joint values were taken from */
+  int revision{ 0 };
+
+  /** @brief The names of the active joints */
+  std::vector<std::string> joint_names;
+
+  /** @brief The joint values in the order of the joint names */
+  std::vector<double> joint_values;
+};
+
+/**
+ * @brief Get the commands which bring an environment at the provided revision up to date with this environment
+ * @details Like the default monitor mode, a revision newer than the environment or of zero gets the whole command
+ * history which initializes the environment. The revision is the number of commands in the command history, so a
+ * remote environment whose history diverged from this one at the same revision, for example after a reset, must be
+ * resynchronized from revision zero.
+ * @param env The environment to get the commands from
+ * @param revision The revision of the environment being updated
+ * @return The delta, from_revision is zero if it initializes the environment
+ */
+EnvironmentDelta getEnvironmentDelta(const Environment& env, int revision);
+
+/**
+ * @brief Apply a delta to an environment
+ * @param env The environment to update
+ * @param delta The delta, its from_revision must be zero or the revision of the environment
+ * @return True if successful, false if the delta is for another revision and a new one must be requested
+ */
+bool applyEnvironmentDelta(Environment& env, const EnvironmentDelta& delta);
+
+/**
+ * @brief Encode a delta in a compact binary message
+ * @details Geometry is deduplicated by its content hash, so a mesh used by several links or attached many times is
+ * encoded once even if it was loaded separately for each of them. The decoded commands share the geometry.
+ * @param delta The delta to encode
+ * @return The binary message
+ */
+std::string encodeEnvironmentDelta(const EnvironmentDelta& delta);
+
+/**
+ * @brief Decode a delta from a binary message created by encodeEnvironmentDelta
+ * @param delta The decoded delta
+ * @param data The binary message
+ * @return True if successful, false if the message could not be decoded
+ */
+bool decodeEnvironmentDelta(EnvironmentDelta& delta, const std::string& data);
+
+/**
+ * @brief Get the current joint values of the active joints of an environment
+ * @param env The environment
+ * @return The state update
+ */
+EnvironmentStateUpdate getEnvironmentStateUpdate(const Environment& env);
+
+/**
+ * @brief Set the joint values of a state update in an environment
+ * @param env The environment to update
+ * @param update The state update
+ * @return True if successful, false if the state update is for another revision of the environment
+ */
+bool applyEnvironmentStateUpdate(Environment& env, const EnvironmentStateUpdate& update);
+
+/**
+ * @brief Encode a state update in a compact binary message
+ * @param update The state update to encode
+ * @return The binary message
+ */
+std::string encodeEnvironmentStateUpdate(const EnvironmentStateUpdate& update);
+
+/**
+ * @brief Decode a state update from a binary message created by encodeEnvironmentStateUpdate
+ * @param update The decoded state update
+ * @param data The binary message
+ * @return True if successful, false if the message could not be decoded
+ */
+bool decodeEnvironmentStateUpdate(EnvironmentStateUpdate& update, const std::string& data);
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_SYNC_H
@@ -0,0 +1,115 @@
+/**
+ * @file event_dispatcher.h
+ * @brief Delivers environment events to subscribers on their own threads
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_EVENT_DISPATCHER_H
+#define TESSERACT_ENVIRONMENT_EVENT_DISPATCHER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/events.h>
+
+namespace tesseract_environment
+{
+struct EventSubscriber;
+
+/**
+ * @brief Delivers events to subscribers asynchronously, each subscriber has its own queue and thread
+ * @details Queuing an event only copies what the subscriber has not been sent yet, so a slow subscriber does not stall
+ * the environment and does not slow down the other subscribers. While a subscriber is busy its queued events are
+ * coalesced, so its queue holds at most one event of each type:
+ *   - A scene state changed event replaces the queued one and is delivered after the other queued events
+ *   - A link transforms changed event is merged into the queued one, which then holds all moved links
+ *   - A command applied event is merged into the queued one, which then holds all applied commands
+ *
+ * A command applied event only holds the commands applied since the previous event sent to the subscriber, see
+ * CommandAppliedEvent::first_command_index. If the command history was replaced, for example by a reset, it holds the
+ * full history with a first command index of zero.
+ */
+class EventDispatcher
+{
+public:
+  EventDispatcher() = default;
+  ~EventDispatcher();
+  EventDispatcher(const EventDispatcher&) = delete;
+  EventDispatcher& operator=(const EventDispatcher&) = delete;
+  EventDispatcher(EventDispatcher&&) = delete;
+  EventDispatcher& operator=(EventDispatcher&&) = delete;
+
+  /**
+   * @brief Add a subscriber, replacing the subscriber with the same id
+   * @param hash The id associated with the subscriber to allow removal
+   * @param fn The callback, it is called on the thread of the subscriber
+   */
+  void addCallback(std::size_t hash, const EventCallbackFn& fn);
+
+  /**
+   * @brief Remove a subscriber
+   * @details Waits for the callback in progress to return, unless called from the callback itself. Queued events are
+   * dropped.
+   * @param hash The id associated with the subscriber
+   */
+  void removeCallback(std::size_t hash);
+
+  /** @brief Remove all subscribers */
+  void clear();
+
+  /** @brief Check if there are no subscribers */
+  bool empty() const;
+
+  /** @brief Wait until every queued event has been delivered, this must not be called from a callback */
+  void wait() const;
+
+  /**
+   * @brief Queue a command applied event
+   * @param commands The full command history
+   * @param revision The revision after the commands were applied
+   */
+  void commandsApplied(const Commands& commands, int revision);
+
+  /**
+   * @brief Queue a scene state changed event
+   * @param state The current state
+   */
+  void stateChanged(const tesseract_scene_graph::SceneState& state);
+
+  /**
+   * @brief Queue a link transforms changed event
+   * @param link_names The names of the links that moved
+   */
+  void linkTransformsChanged(const std::vector<std::string>& link_names);
+
+private:
+  mutable std::mutex mutex_;
+  std::map<std::size_t, std::shared_ptr<EventSubscriber>> subscribers_;
+};
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_EVENT_DISPATCHER_H
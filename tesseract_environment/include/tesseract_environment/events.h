@@ -33,7 +33,8 @@ namespace tesseract_environment
 enum class Events
 {
   COMMAND_APPLIED = 0,
-  SCENE_STATE_CHANGED = 1
+  SCENE_STATE_CHANGED = 1,
+  LINK_TRANSFORMS_CHANGED = 2
 };
 
 /** @brief The event base class */
@@ -47,17 +48,22 @@ struct Event
 
 /**
  * @brief The command applied event
+ * @details The callbacks added with Environment::addEventCallback get the full command history. The asynchronous
+ * callbacks only get the commands applied since their previous event, see first_command_index.
  * @note Do not store the const& of command in your code make a copy instead
  */
 struct CommandAppliedEvent : public Event
 {
-  CommandAppliedEvent(const Commands& commands, int revision)
-    : Event(Events::COMMAND_APPLIED), commands(commands), revision(revision)
+  CommandAppliedEvent(const Commands& commands, int revision, std::size_t first_command_index = 0)
+    : Event(Events::COMMAND_APPLIED), commands(commands), revision(revision), first_command_index(first_command_index)
   {
   }
 
   const Commands& commands;
   int revision;
+
+  /** @brief The index of the first of the commands in the command history, zero if they are the full history */
+  std::size_t first_command_index;
 };
 
 /**
@@ -74,6 +80,22 @@ struct SceneStateChangedEvent : public Event
   const tesseract_scene_graph::SceneState& state;
 };
 
+/**
+ * @brief The link transforms changed event, triggered when the state streams are flushed
+ * @details Only the names of the links that moved are provided instead of a copy of the state. The current state of
+ * the environment is updated before it is triggered, so the new transforms can be queried from the environment.
+ * @note Do not store the const& of link_names in your code make a copy instead
+ */
+struct LinkTransformsChangedEvent : public Event
+{
+  LinkTransformsChangedEvent(const std::vector<std::string>& link_names)
+    : Event(Events::LINK_TRANSFORMS_CHANGED), link_names(link_names)
+  {
+  }
+
+  const std::vector<std::string>& link_names;
+};
+
 using EventCallbackFn = std::function<void(const Event& event)>;
 }  // namespace tesseract_environment
 
@@ -0,0 +1,106 @@
+/**
+ * @file query_context.h
+ * @brief Reusable scratch data for collision, kinematics and state queries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_QUERY_CONTEXT_H
+#define TESSERACT_ENVIRONMENT_QUERY_CONTEXT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/core/types.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief The scratch data of a collision, kinematics or state query, kept between queries so it is not reallocated
+ * @details The members are passed to the overloads which update their output in place, StateSolver::getLinkTransforms
+ * for the link transforms, DiscreteContactManager::contactTest and ContinuousContactManager::contactTest for the
+ * contacts and KinematicGroup::calcInvKin for the inverse kinematics solutions. Once these reach a steady size repeated
+ * queries do not allocate.
+ *
+ * A context is normally acquired through QueryContext::Scope, which provides a thread local context that is cleared
+ * when the scope ends. The trajectory collision checks use it for their per state scratch data.
+ */
+struct QueryContext
+{
+  using Ptr = std::shared_ptr<QueryContext>;
+  using ConstPtr = std::shared_ptr<const QueryContext>;
+  using UPtr = std::unique_ptr<QueryContext>;
+  using ConstUPtr = std::unique_ptr<const QueryContext>;
+
+  class Scope;
+
+  /**
+   * @brief Link transforms updated in place
+   * @details This is not cleared, only the requested links are updated so it may contain links of previous queries
+   */
+  tesseract_common::TransformMap link_transforms;
+
+  /** @brief The contact results of a single state or segment */
+  tesseract_collision::ContactResultMap contacts;
+
+  /** @brief The contact results of each segment of a sweep, see ContinuousContactManager::contactTestSweep */
+  std::vector<tesseract_collision::ContactResultMap> sweep_contacts;
+
+  /** @brief Inverse kinematics solutions */
+  tesseract_kinematics::IKSolutionsBuffer ik_solutions;
+
+  /** @brief Clear the results, keeping the storage for the next query */
+  void clear();
+
+  /** @brief Free the storage */
+  void release();
+};
+
+/**
+ * @brief Provides a thread local QueryContext for the lifetime of the scope
+ * @details Each thread keeps a stack of contexts, so a query run inside another query, like from a contact result
+ * validation function, gets its own context. Scopes must be destroyed in the reverse order they are created, which is
+ * the case for scopes created on the stack.
+ */
+class QueryContext::Scope
+{
+public:
+  Scope();
+  ~Scope();
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+  Scope(Scope&&) = delete;
+  Scope& operator=(Scope&&) = delete;
+
+  QueryContext& operator*() const { return *context_; }
+  QueryContext* operator->() const { return context_; }
+
+private:
+  QueryContext* context_;
+};
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_QUERY_CONTEXT_H
@@ -0,0 +1,226 @@
+/**
+ * @file query_recorder.h
+ * @brief Records the queries run against an environment so they can be replayed offline
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_QUERY_RECORDER_H
+#define TESSERACT_ENVIRONMENT_QUERY_RECORDER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/core/types.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+
+namespace tesseract_environment
+{
+/** @brief The version of the query log format, logs of another version are rejected */
+static constexpr std::uint32_t QUERY_LOG_VERSION{ 1 };
+
+/** @brief The type of a recorded query */
+enum class RecordedQueryType : std::uint8_t
+{
+  /** @brief Environment::setState */
+  SET_STATE = 0,
+  /** @brief DiscreteContactManager::contactTest at a state of the environment */
+  CONTACT_TEST = 1,
+  /** @brief checkTrajectory of a joint group */
+  CHECK_TRAJECTORY = 2,
+  /** @brief KinematicGroup::calcInvKin */
+  CALC_INV_KIN = 3
+};
+
+/**
+ * @brief A query recorded by the QueryRecorder with its inputs
+ * @details Only the members used by the type of the query are set. The results are not recorded, they are calculated
+ * again when the query is replayed.
+ */
+struct RecordedQuery
+{
+  /** @brief The type of the query */
+  RecordedQueryType type{ RecordedQueryType::SET_STATE };
+
+  /** @brief The revision of the environment the query was run against */
+  int revision{ 0 };
+
+  /** @brief The time the query was recorded, in seconds since the recorder was created */
+  double time{ 0 };
+
+  /** @brief The joint group of a trajectory check or the kinematic group of an inverse kinematics query */
+  std::string group_name;
+
+  /** @brief The joint names of a state or a contact test */
+  std::vector<std::string> joint_names;
+
+  /** @brief The joint values of a state or a contact test, or the seed of an inverse kinematics query */
+  Eigen::VectorXd joint_values;
+
+  /** @brief The active collision objects of a contact test, empty if the defaults of the environment were used */
+  std::vector<std::string> active_link_names;
+
+  /** @brief The request of a contact test, the validation function is not recorded */
+  tesseract_collision::ContactRequest contact_request;
+
+  /** @brief The trajectory of a trajectory check, one state per row */
+  tesseract_common::TrajArray trajectory;
+
+  /** @brief The configuration of a trajectory check, the validation function of the request is not recorded */
+  tesseract_collision::CollisionCheckConfig config;
+
+  /** @brief The inputs of an inverse kinematics query */
+  tesseract_kinematics::KinGroupIKInputs ik_inputs;
+
+private:
+  friend class boost::serialization::access;
+  template <class Archive>
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+/**
+ * @brief Records the queries run against an environment, so production traffic can be replayed and profiled offline
+ * @details Set the recorder with Environment::setQueryRecorder to record the state changes of the environment, and
+ * record the contact tests, trajectory checks and inverse kinematics queries run with the contact managers and groups
+ * of the environment next to the calls. Save the log with save and the environment with saveEnvironmentImage, and
+ * replay them with QueryReplayer or the tesseract_environment_replay_queries tool. All functions are thread safe.
+ */
+class QueryRecorder
+{
+public:
+  using Ptr = std::shared_ptr<QueryRecorder>;
+  using ConstPtr = std::shared_ptr<const QueryRecorder>;
+
+  QueryRecorder();
+
+  /**
+   * @brief Record a state change
+   * @param revision The revision of the environment
+   * @param joint_names The names of the joints
+   * @param joint_values The values of the joints
+   */
+  void recordSetState(int revision,
+                      const std::vector<std::string>& joint_names,
+                      const Eigen::Ref<const Eigen::VectorXd>& joint_values);
+
+  /**
+   * @brief Record a state change
+   * @param revision The revision of the environment
+   * @param joints The values of the joints
+   */
+  void recordSetState(int revision, const std::unordered_map<std::string, double>& joints);
+
+  /**
+   * @brief Record a contact test of the discrete contact manager of the environment
+   * @param revision The revision of the environment
+   * @param joint_names The names of the joints of the state the collision objects are placed at
+   * @param joint_values The values of the joints of the state the collision objects are placed at
+   * @param request The contact request
+   * @param active_link_names The active collision objects, empty if the defaults of the environment are used
+   */
+  void recordContactTest(int revision,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                         const tesseract_collision::ContactRequest& request,
+                         const std::vector<std::string>& active_link_names = {});
+
+  /**
+   * @brief Record a trajectory check of a joint group
+   * @param revision The revision of the environment
+   * @param group_name The name of the joint group
+   * @param trajectory The trajectory, one state per row
+   * @param config The configuration of the check, the type selects the discrete or continuous contact manager
+   */
+  void recordCheckTrajectory(int revision,
+                             const std::string& group_name,
+                             const tesseract_common::TrajArray& trajectory,
+                             const tesseract_collision::CollisionCheckConfig& config);
+
+  /**
+   * @brief Record an inverse kinematics query of a kinematic group
+   * @param revision The revision of the environment
+   * @param group_name The name of the kinematic group
+   * @param inputs The inputs of the query
+   * @param seed The seed of the query
+   */
+  void recordCalcInvKin(int revision,
+                        const std::string& group_name,
+                        const tesseract_kinematics::KinGroupIKInputs& inputs,
+                        const Eigen::Ref<const Eigen::VectorXd>& seed);
+
+  /** @brief Get a copy of the recorded queries, in the order they were recorded */
+  std::vector<RecordedQuery> getQueries() const;
+
+  /** @brief Get the number of recorded queries */
+  std::size_t size() const;
+
+  /** @brief Remove the recorded queries */
+  void clear();
+
+  /**
+   * @brief Save the recorded queries to a binary log
+   * @param file_path The file path of the log
+   * @return True if the log was written
+   */
+  bool save(const std::string& file_path) const;
+
+private:
+  mutable std::mutex mutex_;
+  std::chrono::steady_clock::time_point start_;
+  std::vector<RecordedQuery> queries_;
+
+  /** @brief Add a query, setting its time */
+  void add(RecordedQuery&& query);
+};
+
+/**
+ * @brief Save queries to a binary log
+ * @details The log is a small header followed by the binary archive of the queries.
+ * @param queries The queries
+ * @param file_path The file path of the log
+ * @return True if the log was written
+ */
+bool saveQueryLog(const std::vector<RecordedQuery>& queries, const std::string& file_path);
+
+/**
+ * @brief Load queries from a binary log
+ * @param file_path The file path of the log
+ * @param queries The loaded queries, in the order they were recorded
+ * @return True if the log was read, false if it could not be read or is not a log of this version
+ */
+bool loadQueryLog(const std::string& file_path, std::vector<RecordedQuery>& queries);
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_QUERY_RECORDER_H
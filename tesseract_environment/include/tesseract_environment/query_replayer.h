@@ -0,0 +1,107 @@
+/**
+ * @file query_replayer.h
+ * @brief Replays recorded queries against an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_QUERY_REPLAYER_H
+#define TESSERACT_ENVIRONMENT_QUERY_REPLAYER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/query_context.h>
+#include <tesseract_environment/query_recorder.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief Replays recorded queries against an environment, for example one loaded with loadEnvironmentImage
+ * @details The state changes are applied to the environment. The contact tests and trajectory checks are run with
+ * contact managers cloned from the environment once, which are kept at the current state of the environment like the
+ * managers of an application, and the groups are checked out of the environment. The results are kept in a
+ * QueryContext which is reused between the queries.
+ *
+ * The environment is not changed to the revision a query was recorded at, so the log should be replayed against the
+ * environment saved at the end of the recording. Queries recorded at another revision are replayed and reported once.
+ */
+class QueryReplayer
+{
+public:
+  using Ptr = std::shared_ptr<QueryReplayer>;
+  using ConstPtr = std::shared_ptr<const QueryReplayer>;
+
+  /**
+   * @brief Create a replayer
+   * @param env The environment the queries are replayed against, it must be initialized
+   */
+  explicit QueryReplayer(Environment::Ptr env);
+
+  /**
+   * @brief Replay a query
+   * @param query The query
+   * @return True if the query was replayed, false if it failed, for example because its group does not exist
+   */
+  bool replay(const RecordedQuery& query);
+
+  /**
+   * @brief Replay queries in order
+   * @param queries The queries
+   * @return The number of queries which were replayed
+   */
+  std::size_t replay(const std::vector<RecordedQuery>& queries);
+
+  /** @brief Get the environment the queries are replayed against */
+  const Environment::Ptr& getEnvironment() const;
+
+  /** @brief Get the results of the last query */
+  const QueryContext& getContext() const;
+
+private:
+  Environment::Ptr env_;
+  int revision_{ 0 };
+  bool revision_reported_{ false };
+  bool state_changed_{ false };
+
+  tesseract_collision::DiscreteContactManager::UPtr discrete_manager_;
+  std::vector<std::string> discrete_active_;
+  tesseract_collision::ContinuousContactManager::UPtr continuous_manager_;
+  std::vector<std::string> continuous_active_;
+
+  QueryContext context_;
+  std::vector<tesseract_collision::ContactResultMap> trajectory_contacts_;
+  Eigen::MatrixXd ik_solutions_;
+
+  /** @brief Move the collision objects of the managers to the current state of the environment if it changed */
+  void updateManagers();
+
+  bool replayContactTest(const RecordedQuery& query);
+  bool replayCheckTrajectory(const RecordedQuery& query);
+  bool replayCalcInvKin(const RecordedQuery& query);
+};
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_QUERY_REPLAYER_H
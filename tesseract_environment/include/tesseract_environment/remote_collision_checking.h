@@ -0,0 +1,258 @@
+/**
+ * @file remote_collision_checking.h
+ * @brief Distributes batches of contact tests and trajectory checks over collision checking servers
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_REMOTE_COLLISION_CHECKING_H
+#define TESSERACT_ENVIRONMENT_REMOTE_COLLISION_CHECKING_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_collision/core/types.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_sync.h>
+#include <tesseract_environment/query_recorder.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief A batch of queries sent to a RemoteCollisionServer
+ * @details The queries are RecordedQuery of the types RecordedQueryType::CONTACT_TEST and
+ * RecordedQueryType::CHECK_TRAJECTORY, so queries recorded by a QueryRecorder can be sent as they are.
+ */
+struct RemoteCollisionRequest
+{
+  /** @brief The revision of the environment the queries are checked against */
+  int revision{ 0 };
+
+  /** @brief The commands bringing the environment of the server to the revision, no commands if it is up to date */
+  EnvironmentDelta delta;
+
+  /** @brief The queries */
+  std::vector<RecordedQuery> queries;
+};
+
+/** @brief The result of a query checked by a RemoteCollisionServer */
+struct RemoteCollisionResult
+{
+  /** @brief Indicates if the query was checked, false if it could not be checked */
+  bool checked{ false };
+
+  /** @brief Indicates if a collision was found */
+  bool in_collision{ false };
+
+  /**
+   * @brief The contacts, a single entry for a contact test and the contacts of each segment or state of a trajectory
+   * check, see checkTrajectory
+   */
+  std::vector<tesseract_collision::ContactResultMap> contacts;
+
+  /** @brief The reason the query could not be checked */
+  std::string message;
+};
+
+/** @brief The reply of a RemoteCollisionServer to a RemoteCollisionRequest */
+struct RemoteCollisionResponse
+{
+  /**
+   * @brief The revision of the environment of the server after the commands of the request were applied
+   * @details If it is not the revision of the request the queries were not checked and the environment of the server
+   * must be synchronized from revision zero.
+   */
+  int revision{ 0 };
+
+  /** @brief The result of each query in the order of the request, empty if the queries were not checked */
+  std::vector<RemoteCollisionResult> results;
+
+  /** @brief The reason the queries were not checked */
+  std::string message;
+};
+
+/**
+ * @brief Encode a request in a binary message
+ * @param request The request to encode
+ * @return The binary message
+ */
+std::string encodeRemoteCollisionRequest(const RemoteCollisionRequest& request);
+
+/**
+ * @brief Decode a request from a binary message created by encodeRemoteCollisionRequest
+ * @param request The decoded request
+ * @param data The binary message
+ * @return True if successful, false if the message could not be decoded
+ */
+bool decodeRemoteCollisionRequest(RemoteCollisionRequest& request, const std::string& data);
+
+/**
+ * @brief Encode a response in a binary message
+ * @param response The response to encode
+ * @return The binary message
+ */
+std::string encodeRemoteCollisionResponse(const RemoteCollisionResponse& response);
+
+/**
+ * @brief Decode a response from a binary message created by encodeRemoteCollisionResponse
+ * @param response The decoded response
+ * @param data The binary message
+ * @return True if successful, false if the message could not be decoded
+ */
+bool decodeRemoteCollisionResponse(RemoteCollisionResponse& response, const std::string& data);
+
+/**
+ * @brief Checks the queries of requests against an environment kept in sync with the environment of the clients
+ * @details The server does not include a transport. The application receives the messages of the clients with the
+ * transport of its choice, passes them to handle and sends the reply back.
+ *
+ * The environment of the server is brought up to date with the commands of each request, like an environment monitor
+ * applies an EnvironmentDelta. The queries of a request are spread over the workers of the server on the executor,
+ * each worker keeps its own contact managers which are taken from the environment again when it changes. Contact tests
+ * use the active links of the query, or of the environment if none are provided, and trajectory checks use the active
+ * links of the joint group of the query, like the QueryReplayer. Requests are handled one at a time.
+ */
+class RemoteCollisionServer
+{
+public:
+  using Ptr = std::shared_ptr<RemoteCollisionServer>;
+  using ConstPtr = std::shared_ptr<const RemoteCollisionServer>;
+  using UPtr = std::unique_ptr<RemoteCollisionServer>;
+  using ConstUPtr = std::unique_ptr<const RemoteCollisionServer>;
+
+  /**
+   * @brief Construct the server
+   * @param env The environment of the server, it is only changed by the requests. It does not have to be initialized,
+   * the first request of a client initializes it.
+   * @param executor The executor checking the queries, nullptr uses the default executor
+   */
+  RemoteCollisionServer(Environment::Ptr env = std::make_shared<Environment>(),
+                        tesseract_common::Executor::Ptr executor = nullptr);
+  ~RemoteCollisionServer();
+  RemoteCollisionServer(const RemoteCollisionServer&) = delete;
+  RemoteCollisionServer& operator=(const RemoteCollisionServer&) = delete;
+  RemoteCollisionServer(RemoteCollisionServer&&) = delete;
+  RemoteCollisionServer& operator=(RemoteCollisionServer&&) = delete;
+
+  /**
+   * @brief Handle a request
+   * @param request The request
+   * @return The response
+   */
+  RemoteCollisionResponse handle(const RemoteCollisionRequest& request);
+
+  /**
+   * @brief Handle a request received as a binary message
+   * @param data The message created by encodeRemoteCollisionRequest
+   * @return The response encoded by encodeRemoteCollisionResponse
+   */
+  std::string handle(const std::string& data);
+
+  /** @brief Get the environment of the server */
+  const Environment::Ptr& getEnvironment() const;
+
+private:
+  struct Worker;
+
+  Environment::Ptr env_;
+  tesseract_common::Executor::Ptr executor_;
+
+  /** @brief Serializes the requests */
+  std::mutex mutex_;
+
+  /** @brief The workers, created when a request has more queries than there are workers */
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+/**
+ * @brief Sends a message to a server and returns its reply, implemented with the transport of the application
+ * @details It is called from the threads of the executor of the client and may throw if the server can not be reached
+ */
+using RemoteCollisionTransportFn = std::function<std::string(const std::string&)>;
+
+/**
+ * @brief Checks batches of queries on several RemoteCollisionServer to scale the collision checking beyond one node
+ * @details A batch is split into contiguous shards of about the same size, one per server, which are sent at the same
+ * time and merged back in the order of the queries. The client keeps track of the revision of the environment of each
+ * server and only sends the commands it is missing. A server which reports another revision, for example after it was
+ * restarted, is synchronized again from revision zero.
+ *
+ * The revision is the number of commands in the command history, so an environment of the client which was reset to
+ * the same revision with other commands is not detected. Create a new client in that case.
+ */
+class RemoteCollisionClient
+{
+public:
+  using Ptr = std::shared_ptr<RemoteCollisionClient>;
+  using ConstPtr = std::shared_ptr<const RemoteCollisionClient>;
+  using UPtr = std::unique_ptr<RemoteCollisionClient>;
+  using ConstUPtr = std::unique_ptr<const RemoteCollisionClient>;
+
+  /**
+   * @brief Construct the client
+   * @param env The environment the queries are made against, throws if it is a nullptr
+   * @param servers The transport to each server, throws if there are none
+   * @param executor The executor sending the shards, nullptr uses the default executor
+   */
+  RemoteCollisionClient(Environment::ConstPtr env,
+                        std::vector<RemoteCollisionTransportFn> servers,
+                        tesseract_common::Executor::Ptr executor = nullptr);
+
+  /**
+   * @brief Check a batch of queries at the current revision of the environment
+   * @details The queries of a shard which could not be checked, for example because its server could not be reached,
+   * are returned unchecked with the reason
+   * @param queries The queries
+   * @return The result of each query in the order of the queries
+   */
+  std::vector<RemoteCollisionResult> check(const std::vector<RecordedQuery>& queries);
+
+  /** @brief Get the number of servers */
+  std::size_t getServerCount() const;
+
+  /** @brief Get the environment the queries are made against */
+  const Environment::ConstPtr& getEnvironment() const;
+
+private:
+  Environment::ConstPtr env_;
+  std::vector<RemoteCollisionTransportFn> servers_;
+  tesseract_common::Executor::Ptr executor_;
+
+  /** @brief Serializes the batches */
+  std::mutex mutex_;
+
+  /** @brief The revision of the environment of each server, zero if it is unknown */
+  std::vector<int> server_revisions_;
+
+  /** @brief Send a shard to a server, synchronizing its environment first */
+  std::vector<RemoteCollisionResult> checkShard(std::size_t server, std::vector<RecordedQuery> queries);
+};
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_REMOTE_COLLISION_CHECKING_H
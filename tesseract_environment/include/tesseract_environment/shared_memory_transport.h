@@ -0,0 +1,242 @@
+/**
+ * @file shared_memory_transport.h
+ * @brief Exchange scene states and trajectories between processes on one host through shared memory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_SHARED_MEMORY_TRANSPORT_H
+#define TESSERACT_ENVIRONMENT_SHARED_MEMORY_TRANSPORT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/joint_state.h>
+#include <tesseract_common/shared_memory_ring_buffer.h>
+#include <tesseract_scene_graph/scene_state.h>
+
+namespace tesseract_environment
+{
+class Environment;
+
+/**
+ * @brief The fixed layout of a scene state in shared memory
+ * @details The index of a name is its id, the position of its values in a message. Both processes build the layout
+ * from an environment at the same revision, so a message only holds the revision and the values.
+ */
+struct SceneStateLayout
+{
+  SceneStateLayout() = default;
+
+  /**
+   * @brief Get the layout of the current structure of an environment
+   * @param env The environment
+   */
+  explicit SceneStateLayout(const Environment& env);
+
+  /** @brief The joints whose values are stored */
+  std::vector<std::string> active_joint_names;
+
+  /** @brief The links whose transforms are stored */
+  std::vector<std::string> link_names;
+
+  /** @brief The joints whose transforms are stored */
+  std::vector<std::string> joint_names;
+
+  /** @brief The number of bytes of a message */
+  std::size_t getMessageSize() const;
+
+  /** @brief Identifies the layout, two layouts with the same names in the same order have the same id */
+  uint64_t getId() const;
+};
+
+/** @brief Writes scene states to a shared memory ring buffer */
+class SceneStatePublisher
+{
+public:
+  using Ptr = std::shared_ptr<SceneStatePublisher>;
+  using ConstPtr = std::shared_ptr<const SceneStatePublisher>;
+  using UPtr = std::unique_ptr<SceneStatePublisher>;
+  using ConstUPtr = std::unique_ptr<const SceneStatePublisher>;
+
+  /**
+   * @brief Create the shared memory ring buffer
+   * @param name The name of the shared memory object
+   * @param layout The layout of the scene states
+   * @param slot_count The number of scene states kept in the ring buffer
+   */
+  SceneStatePublisher(std::string name, SceneStateLayout layout, std::size_t slot_count = 16);
+
+  /** @brief The layout of the scene states */
+  const SceneStateLayout& getLayout() const;
+
+  /**
+   * @brief Publish a scene state
+   * @details Values missing from the state are published as NaN
+   * @param state The scene state
+   * @param revision The revision of the environment the state was taken from
+   * @return The sequence of the message
+   */
+  uint64_t publish(const tesseract_scene_graph::SceneState& state, int revision);
+
+  /**
+   * @brief Publish the current state of an environment
+   * @details Returns false without publishing if the structure of the environment no longer matches the layout
+   * @param env The environment
+   * @return True if the state was published
+   */
+  bool publish(const Environment& env);
+
+private:
+  SceneStateLayout layout_;
+  tesseract_common::SharedMemoryRingBuffer buffer_;
+  /** @brief The last revision of the environment whose structure was checked against the layout */
+  int checked_revision_{ -1 };
+};
+
+/** @brief Reads scene states from a shared memory ring buffer created by a SceneStatePublisher */
+class SceneStateSubscriber
+{
+public:
+  using Ptr = std::shared_ptr<SceneStateSubscriber>;
+  using ConstPtr = std::shared_ptr<const SceneStateSubscriber>;
+  using UPtr = std::unique_ptr<SceneStateSubscriber>;
+  using ConstUPtr = std::unique_ptr<const SceneStateSubscriber>;
+
+  /**
+   * @brief Open the shared memory ring buffer
+   * @details Throws std::runtime_error if it does not exist or was created with another layout
+   * @param name The name of the shared memory object
+   * @param layout The layout of the scene states
+   */
+  SceneStateSubscriber(std::string name, SceneStateLayout layout);
+
+  /** @brief The layout of the scene states */
+  const SceneStateLayout& getLayout() const;
+
+  /** @brief The sequence of the next message, compare it to the sequence of the last read to check for new states */
+  uint64_t getWriteSequence() const;
+
+  /**
+   * @brief Read the newest scene state
+   * @details The values are decoded directly from shared memory into the scene state, reusing its map entries. If it
+   * returns false the state may have been partially updated.
+   * @param state The scene state to update
+   * @param revision The revision of the environment the state was taken from
+   * @param sequence The sequence of the message that was read
+   * @return True if a state was read
+   */
+  bool readLatest(tesseract_scene_graph::SceneState& state, int& revision, uint64_t* sequence = nullptr) const;
+
+  /**
+   * @brief Set the joint values of the newest scene state in an environment
+   * @param env The environment to update
+   * @return True if successful, false if no state was read or it is for another revision of the environment
+   */
+  bool update(Environment& env) const;
+
+private:
+  SceneStateLayout layout_;
+  tesseract_common::SharedMemoryRingBuffer buffer_;
+};
+
+/**
+ * @brief Writes joint trajectories to a shared memory ring buffer
+ * @details Every state of a trajectory must have the joint names of the publisher, in the same order. The velocity,
+ * acceleration and effort of a state may be empty. The description of the trajectory is not published.
+ */
+class JointTrajectoryPublisher
+{
+public:
+  using Ptr = std::shared_ptr<JointTrajectoryPublisher>;
+  using ConstPtr = std::shared_ptr<const JointTrajectoryPublisher>;
+  using UPtr = std::unique_ptr<JointTrajectoryPublisher>;
+  using ConstUPtr = std::unique_ptr<const JointTrajectoryPublisher>;
+
+  /**
+   * @brief Create the shared memory ring buffer
+   * @param name The name of the shared memory object
+   * @param joint_names The joint names of the trajectories
+   * @param max_states The maximum number of states of a trajectory
+   * @param slot_count The number of trajectories kept in the ring buffer
+   */
+  JointTrajectoryPublisher(std::string name,
+                           std::vector<std::string> joint_names,
+                           std::size_t max_states,
+                           std::size_t slot_count = 4);
+
+  /**
+   * @brief Publish a trajectory
+   * @details Throws std::runtime_error if the trajectory has too many states or a state does not match the joint names
+   * @param trajectory The trajectory
+   * @return The sequence of the message
+   */
+  uint64_t publish(const tesseract_common::JointTrajectory& trajectory);
+
+private:
+  std::vector<std::string> joint_names_;
+  std::size_t max_states_;
+  tesseract_common::SharedMemoryRingBuffer buffer_;
+};
+
+/** @brief Reads joint trajectories from a shared memory ring buffer created by a JointTrajectoryPublisher */
+class JointTrajectorySubscriber
+{
+public:
+  using Ptr = std::shared_ptr<JointTrajectorySubscriber>;
+  using ConstPtr = std::shared_ptr<const JointTrajectorySubscriber>;
+  using UPtr = std::unique_ptr<JointTrajectorySubscriber>;
+  using ConstUPtr = std::unique_ptr<const JointTrajectorySubscriber>;
+
+  /**
+   * @brief Open the shared memory ring buffer
+   * @details Throws std::runtime_error if it does not exist or was created with other joint names or maximum states
+   * @param name The name of the shared memory object
+   * @param joint_names The joint names of the trajectories
+   * @param max_states The maximum number of states of a trajectory
+   */
+  JointTrajectorySubscriber(std::string name, std::vector<std::string> joint_names, std::size_t max_states);
+
+  /** @brief The sequence of the next message, compare it to the sequence of the last read to check for new ones */
+  uint64_t getWriteSequence() const;
+
+  /**
+   * @brief Read the newest trajectory
+   * @details If it returns false the trajectory may have been partially updated
+   * @param trajectory The trajectory to update
+   * @param sequence The sequence of the message that was read
+   * @return True if a trajectory was read
+   */
+  bool readLatest(tesseract_common::JointTrajectory& trajectory, uint64_t* sequence = nullptr) const;
+
+private:
+  std::vector<std::string> joint_names_;
+  std::size_t max_states_;
+  tesseract_common::SharedMemoryRingBuffer buffer_;
+};
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_SHARED_MEMORY_TRANSPORT_H
@@ -0,0 +1,84 @@
+/**
+ * @file swept_volume_broadphase.h
+ * @brief A coarse pass finding the collision object pairs which may be in contact along a trajectory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_SWEPT_VOLUME_BROADPHASE_H
+#define TESSERACT_ENVIRONMENT_SWEPT_VOLUME_BROADPHASE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_kinematics/core/joint_group.h>
+
+namespace tesseract_environment
+{
+/** @brief A pair of collision objects which may be in contact during a range of segments of a trajectory */
+struct SweptVolumeCandidate
+{
+  /** @brief The active link */
+  std::string link_name;
+
+  /** @brief The other collision object, a static object or another active link */
+  std::string other_name;
+
+  /** @brief The first segment of the range */
+  long first_segment{ 0 };
+
+  /** @brief The last segment of the range, inclusive */
+  long last_segment{ 0 };
+};
+
+/**
+ * @brief Find the pairs of collision objects which may be in contact along a trajectory and the segments during which
+ * they may be in contact
+ * @details The trajectory is split into windows of window_size segments. The box swept by an active link during a
+ * window is the union of its bounding boxes at the states of the window, grown by half the bound on the motion of the
+ * link during the segment with the most motion, see JointGroup::getJointMotionBounds. This contains everything the link
+ * passes through when the joints move linearly between the states. The swept boxes of the whole trajectory are first
+ * intersected with the boxes of the static collision objects and with each other, and only the pairs which overlap are
+ * intersected per window. The boxes of a pair are grown by its collision margin and pairs allowed to be in contact are
+ * skipped. A pair overlapping in consecutive windows is reported once.
+ *
+ * The result is conservative, a pair which is not reported can not be in contact during the segments it is not
+ * reported for. Static objects with a geometry which can not be bounded, or whose transform the manager does not
+ * provide (see ContinuousContactManager::getCollisionObjectTransform), are treated as infinite.
+ * @param manager The contact manager, with the static collision objects at their transforms and the active links set
+ * @param manip The joint group moving the active links, its link transforms are world transforms for the manager
+ * @param traj The trajectory, throws std::runtime_error if it has less than two states
+ * @param window_size The number of segments of a window, larger windows are cheaper but coarser
+ * @return The candidates ordered by their first segment
+ */
+std::vector<SweptVolumeCandidate>
+calcSweptVolumeCandidates(const tesseract_collision::ContinuousContactManager& manager,
+                          const tesseract_kinematics::JointGroup& manip,
+                          const tesseract_common::TrajArray& traj,
+                          long window_size = 1);
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_SWEPT_VOLUME_BROADPHASE_H
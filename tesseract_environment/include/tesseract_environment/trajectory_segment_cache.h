@@ -0,0 +1,191 @@
+/**
+ * @file trajectory_segment_cache.h
+ * @brief A cache of continuous collision check results for trajectory segments
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_TRAJECTORY_SEGMENT_CACHE_H
+#define TESSERACT_ENVIRONMENT_TRAJECTORY_SEGMENT_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/allowed_collision_matrix.h>
+#include <tesseract_common/collision_margin_data.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief A cache of the contact results of continuous collision checks of trajectory segments
+ * @details A segment is identified by the start and end transform of every active link of the manager along with the
+ * contact request, so when a partially modified trajectory is checked again the unchanged segments are returned from
+ * the cache without calling the contact manager. The transforms must match exactly, which is the case for segments
+ * calculated from the same joint values.
+ *
+ * The cache is invalidated when the active links, the collision margin data or the compiled allowed collision matrix
+ * of the manager change. Any other change to the contact manager, like adding, removing or enabling collision objects,
+ * moving static links or assigning a contact allowed function which does not provide a compiled allowed collision
+ * matrix, is not detected and requires calling clear().
+ *
+ * Requests with a contact result validation function are never cached. The cache may be shared between threads.
+ */
+class TrajectorySegmentCache
+{
+public:
+  using Ptr = std::shared_ptr<TrajectorySegmentCache>;
+  using ConstPtr = std::shared_ptr<const TrajectorySegmentCache>;
+  using UPtr = std::unique_ptr<TrajectorySegmentCache>;
+  using ConstUPtr = std::unique_ptr<const TrajectorySegmentCache>;
+
+  /**
+   * @brief Constructor
+   * @param cache_size The maximum number of segments stored, the oldest segment is removed when it is reached
+   */
+  explicit TrajectorySegmentCache(std::size_t cache_size = 1024);
+  ~TrajectorySegmentCache() = default;
+  TrajectorySegmentCache(const TrajectorySegmentCache&) = delete;
+  TrajectorySegmentCache& operator=(const TrajectorySegmentCache&) = delete;
+  TrajectorySegmentCache(TrajectorySegmentCache&&) = delete;
+  TrajectorySegmentCache& operator=(TrajectorySegmentCache&&) = delete;
+
+  /**
+   * @brief Get the cached contact results of a segment
+   * @param results The cached contact results, only modified if the segment is cached
+   * @param manager The continuous contact manager the segment is checked with
+   * @param state0 The start transforms of the segment
+   * @param state1 The end transforms of the segment
+   * @param contact_request The contact request the segment is checked with
+   * @return True if the segment is cached, otherwise false
+   */
+  bool get(tesseract_collision::ContactResultMap& results,
+           const tesseract_collision::ContinuousContactManager& manager,
+           const tesseract_common::TransformMap& state0,
+           const tesseract_common::TransformMap& state1,
+           const tesseract_collision::ContactRequest& contact_request) const;
+
+  /**
+   * @brief Store the contact results of a segment
+   * @param manager The continuous contact manager the segment was checked with
+   * @param state0 The start transforms of the segment
+   * @param state1 The end transforms of the segment
+   * @param contact_request The contact request the segment was checked with
+   * @param results The contact results of the segment
+   */
+  void insert(const tesseract_collision::ContinuousContactManager& manager,
+              const tesseract_common::TransformMap& state0,
+              const tesseract_common::TransformMap& state1,
+              const tesseract_collision::ContactRequest& contact_request,
+              const tesseract_collision::ContactResultMap& results);
+
+  /** @brief Remove all cached segments */
+  void clear();
+
+  /** @brief Get the number of cached segments */
+  std::size_t size() const;
+
+  /**
+   * @brief Set the maximum number of segments stored
+   * @param size The size of the cache
+   */
+  void setCacheSize(std::size_t size);
+
+  /** @brief Get the maximum number of segments stored */
+  std::size_t getCacheSize() const;
+
+private:
+  /** @brief Identifies a segment checked with the current manager configuration */
+  struct Key
+  {
+    /** @brief The start and end transform of every active link */
+    std::vector<double> transforms;
+
+    /** @brief The contact request type */
+    tesseract_collision::ContactTestType type{ tesseract_collision::ContactTestType::ALL };
+
+    /** @brief If the penetration was calculated */
+    bool calculate_penetration{ true };
+
+    /** @brief If the distance was calculated */
+    bool calculate_distance{ true };
+
+    /** @brief The contact limit */
+    long contact_limit{ 0 };
+
+    /** @brief The contact result detail */
+    tesseract_collision::ContactResultDetail detail{ tesseract_collision::ContactResultDetail::FULL };
+
+    bool operator==(const Key& rhs) const;
+  };
+
+  /** @brief The hash of a segment key */
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  /** @brief The maximum number of segments stored */
+  std::size_t cache_size_;
+
+  /** @brief The active links of the manager the cached segments were checked with */
+  std::vector<std::string> active_links_;
+
+  /** @brief The collision margin data of the manager the cached segments were checked with */
+  tesseract_common::CollisionMarginData margin_data_;
+
+  /** @brief The compiled allowed collision matrix of the manager the cached segments were checked with */
+  tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr acm_;
+
+  /** @brief The cached contact results */
+  std::unordered_map<Key, tesseract_collision::ContactResultMap, KeyHash> cache_;
+
+  /** @brief The cached keys ordered from oldest to newest, these point to the keys stored in cache_ */
+  std::deque<const Key*> order_;
+
+  /** @brief The mutex used when reading and writing to the cache */
+  mutable std::shared_mutex mutex_;
+
+  /** @brief Check if the manager configuration matches the one the cached segments were checked with */
+  bool isCurrent(const tesseract_collision::ContinuousContactManager& manager) const;
+
+  /**
+   * @brief Create the key of a segment
+   * @return False if the segment can not be cached, otherwise true
+   */
+  static bool createKey(Key& key,
+                        const std::vector<std::string>& active_links,
+                        const tesseract_common::TransformMap& state0,
+                        const tesseract_common::TransformMap& state1,
+                        const tesseract_collision::ContactRequest& contact_request);
+
+  /** @brief Remove the oldest segments until the cache size is satisfied, this does not take a lock */
+  void shrinkHelper();
+};
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_TRAJECTORY_SEGMENT_CACHE_H
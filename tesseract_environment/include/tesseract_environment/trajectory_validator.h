@@ -0,0 +1,247 @@
+/**
+ * @file trajectory_validator.h
+ * @brief A pool of workers validating trajectories against an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_TRAJECTORY_VALIDATOR_H
+#define TESSERACT_ENVIRONMENT_TRAJECTORY_VALIDATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_environment
+{
+/** @brief A trajectory to validate */
+struct TrajectoryValidationRequest
+{
+  /** @brief The joint names corresponding to the columns of the trajectory */
+  std::vector<std::string> joint_names;
+
+  /** @brief The joint values at each time step */
+  tesseract_common::TrajArray trajectory;
+
+  /** @brief The collision check config, its type selects a discrete or continuous check */
+  tesseract_collision::CollisionCheckConfig config;
+};
+
+/** @brief The verdict of a trajectory validation */
+struct TrajectoryValidationResult
+{
+  /** @brief Indicates if the trajectory was checked, false if the request could not be checked */
+  bool checked{ false };
+
+  /** @brief Indicates if a collision was found */
+  bool in_collision{ false };
+
+  /** @brief The contacts of each segment or state, see checkTrajectory */
+  std::vector<tesseract_collision::ContactResultMap> contacts;
+
+  /** @brief The revision of the environment the trajectory was checked against */
+  int revision{ 0 };
+
+  /** @brief The reason the trajectory could not be checked */
+  std::string message;
+
+  /** @brief Check if the trajectory was checked and is collision free */
+  bool isValid() const;
+};
+
+/**
+ * @brief The callback of a batch of requests
+ * @details It is called on a worker thread once for each request with the index of the request in the batch
+ */
+using TrajectoryValidationCallbackFn = std::function<void(std::size_t, const TrajectoryValidationResult&)>;
+
+/**
+ * @brief Validates trajectories against an environment using a pool of worker threads
+ * @details Each worker owns a state solver and the contact managers of the environment, so a request does not clone
+ * the environment or its managers. Before a request is checked the worker compares the revision of the environment
+ * with the revision its objects were taken from and only takes them again if the environment changed. The contact
+ * manager config of a request is undone after it is checked, so it does not affect the next request.
+ *
+ * Requests are checked in the order they are queued. The destructor waits for the queued requests to be checked.
+ */
+class TrajectoryValidator
+{
+public:
+  using Ptr = std::shared_ptr<TrajectoryValidator>;
+  using ConstPtr = std::shared_ptr<const TrajectoryValidator>;
+  using UPtr = std::unique_ptr<TrajectoryValidator>;
+  using ConstUPtr = std::unique_ptr<const TrajectoryValidator>;
+
+  /**
+   * @brief Construct the validator
+   * @param env The environment the trajectories are validated against
+   * @param threads The number of worker threads, zero uses one per hardware thread
+   */
+  TrajectoryValidator(Environment::ConstPtr env, std::size_t threads = 0);
+  ~TrajectoryValidator();
+  TrajectoryValidator(const TrajectoryValidator&) = delete;
+  TrajectoryValidator& operator=(const TrajectoryValidator&) = delete;
+  TrajectoryValidator(TrajectoryValidator&&) = delete;
+  TrajectoryValidator& operator=(TrajectoryValidator&&) = delete;
+
+  /**
+   * @brief Queue a trajectory to validate
+   * @param request The trajectory
+   * @return The future result
+   */
+  std::future<TrajectoryValidationResult> validate(TrajectoryValidationRequest request);
+
+  /**
+   * @brief Queue a batch of trajectories to validate, the trajectories are checked in parallel
+   * @param requests The trajectories
+   * @return The future results in the order of the requests
+   */
+  std::vector<std::future<TrajectoryValidationResult>> validate(std::vector<TrajectoryValidationRequest> requests);
+
+  /**
+   * @brief Queue a batch of trajectories to validate, the trajectories are checked in parallel
+   * @param requests The trajectories
+   * @param callback Called on a worker thread with the result of each request
+   */
+  void validate(std::vector<TrajectoryValidationRequest> requests, const TrajectoryValidationCallbackFn& callback);
+
+  /** @brief Wait until every queued request has been checked, this must not be called from a callback */
+  void wait() const;
+
+  /** @brief Get the number of worker threads */
+  std::size_t getThreadCount() const;
+
+  /** @brief Get the environment the trajectories are validated against */
+  const Environment::ConstPtr& getEnvironment() const;
+
+private:
+  /** @brief A queued request and the function receiving its result */
+  struct Task
+  {
+    TrajectoryValidationRequest request;
+    std::function<void(TrajectoryValidationResult)> done;
+  };
+
+  Environment::ConstPtr env_;
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+
+  /** @brief Notifies the workers that a request was queued or they should stop */
+  std::condition_variable queued_cv_;
+
+  /** @brief Notifies the threads waiting for the queued requests to be checked */
+  mutable std::condition_variable done_cv_;
+
+  std::deque<Task> queue_;
+  std::size_t busy_{ 0 };
+  bool stop_{ false };
+
+  /** @brief Queue the tasks and notify the workers */
+  void enqueue(std::vector<Task> tasks);
+
+  /** @brief The loop of a worker thread */
+  void run();
+};
+
+/**
+ * @brief Runs contact tests and trajectory collision checks against an environment asynchronously on an executor
+ * @details Each query is a task of the executor, so the caller can do other work, like preparing the next query, while
+ * it is checked. The task takes a worker from a pool owned by the checker, which holds a state solver and the contact
+ * managers of the environment. A new worker is only created when every worker is busy, so the number of workers
+ * follows the number of queries running at the same time. Like the TrajectoryValidator the objects of a worker are
+ * taken again when the environment changed and the contact manager config of a query is undone after it is checked.
+ *
+ * A query can be cancelled with the token it was started with. A query cancelled before it starts is not checked and
+ * a trajectory check stops at the next state or segment, in both cases the future holds a
+ * tesseract_common::CancelledError.
+ * Queries may still be running when the checker is destroyed, the pool is kept alive until they finished.
+ */
+class AsyncContactChecker
+{
+public:
+  using Ptr = std::shared_ptr<AsyncContactChecker>;
+  using ConstPtr = std::shared_ptr<const AsyncContactChecker>;
+  using UPtr = std::unique_ptr<AsyncContactChecker>;
+  using ConstUPtr = std::unique_ptr<const AsyncContactChecker>;
+
+  /**
+   * @brief Construct the checker
+   * @param env The environment the queries are checked against, throws if it is a nullptr
+   * @param executor The executor running the queries, nullptr uses the default executor
+   */
+  AsyncContactChecker(Environment::ConstPtr env, tesseract_common::Executor::Ptr executor = nullptr);
+
+  /**
+   * @brief Perform a discrete contact test of a state
+   * @param joint_names The joint names corresponding to the joint values
+   * @param joint_values The joint values of the state
+   * @param config The collision check config, its contact manager config and contact request are used
+   * @param token The token used to cancel the query
+   * @return The future contacts of the state
+   */
+  std::future<tesseract_collision::ContactResultMap>
+  contactTest(std::vector<std::string> joint_names,
+              Eigen::VectorXd joint_values,
+              tesseract_collision::CollisionCheckConfig config,
+              tesseract_common::CancellationToken token = tesseract_common::CancellationToken());
+
+  /**
+   * @brief Perform a collision check of a trajectory
+   * @details The contacts are the same as the ones of the serial checkTrajectory, except that
+   * CollisionCheckConfig::bisection_order is not used. A collision was found if any entry is not empty.
+   * @param request The trajectory, the type of its config selects a discrete or continuous check
+   * @param token The token used to cancel the query
+   * @return The future contacts of each segment or state, see checkTrajectory
+   */
+  std::future<std::vector<tesseract_collision::ContactResultMap>>
+  checkTrajectory(TrajectoryValidationRequest request,
+                  tesseract_common::CancellationToken token = tesseract_common::CancellationToken());
+
+  /** @brief Get the environment the queries are checked against */
+  const Environment::ConstPtr& getEnvironment() const;
+
+  /** @brief Get the number of workers created so far */
+  std::size_t getWorkerCount() const;
+
+private:
+  struct Pool;
+
+  /** @brief The environment and the workers, shared with the running queries */
+  std::shared_ptr<Pool> pool_;
+
+  /** @brief The executor running the queries */
+  tesseract_common::Executor::Ptr executor_;
+};
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_TRAJECTORY_VALIDATOR_H
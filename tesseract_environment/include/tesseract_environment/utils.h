@@ -26,15 +26,58 @@
 #ifndef TESSERACT_ENVIRONMENT_CORE_UTILS_H
 #define TESSERACT_ENVIRONMENT_CORE_UTILS_H
 
+#include <tesseract_common/executor.h>
+#include <tesseract_common/name_id.h>
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/scene_state.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/types.h>
+#include <tesseract_kinematics/core/types.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/trajectory_segment_cache.h>
 
 namespace tesseract_environment
 {
+/**
+ * @brief A summary of the collision check of a trajectory, filled instead of a ContactResultMap per step
+ * @details For a continuous check a step is a segment of the trajectory, for a discrete check it is a state including
+ * its LVS sub states. The contacts of a step can be calculated on demand with checkTrajectoryStep.
+ */
+struct TrajectoryCollisionSummary
+{
+  /** @brief The first step in collision, -1 if there is none */
+  long first_collision_step{ -1 };
+
+  /** @brief The step with the minimum distance, -1 if there are no contacts */
+  long worst_step{ -1 };
+
+  /** @brief The number of steps in collision */
+  long num_collision_steps{ 0 };
+
+  /** @brief The minimum contact distance of each step, infinity for steps without contacts or which were not checked */
+  Eigen::VectorXd min_distances;
+
+  /** @brief The pair with the minimum distance of each step, empty names for steps without contacts */
+  std::vector<std::pair<tesseract_common::NameId, tesseract_common::NameId>> worst_pairs;
+
+  /** @brief Check if collision was found */
+  bool empty() const { return (first_collision_step < 0); }
+
+  /**
+   * @brief Reset the summary for a number of steps, keeping the storage
+   * @param num_steps The number of steps
+   */
+  void clear(long num_steps);
+
+  /**
+   * @brief Add the contacts of a step
+   * @param step The step
+   * @param contacts The contacts of the step
+   */
+  void update(long step, const tesseract_collision::ContactResultMap& contacts);
+};
+
 /**
  * @brief Get the active Link Names Recursively
  *
@@ -57,12 +100,14 @@ void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
  * @param state0 First environment state
  * @param state1 Second environment state
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, when the segment is cached the manager is not called
  * @return Return the contact results map. If empty no contacts were found
  */
 tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
                                                              const tesseract_common::TransformMap& state0,
                                                              const tesseract_common::TransformMap& state1,
-                                                             const tesseract_collision::CollisionCheckConfig& config);
+                                                             const tesseract_collision::CollisionCheckConfig& config,
+                                                             TrajectorySegmentCache* cache = nullptr);
 
 /**
  * @brief Should perform a continuous collision check between two states only passing along the contact_request to the
@@ -71,12 +116,61 @@ tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision
  * @param state0 First environment state
  * @param state1 Second environment state
  * @param contact_request Contact request passed to the manager
+ * @param cache An optional cache of segment results, when the segment is cached the manager is not called
  * @return Return the contact results map. If empty not contacts were found
  */
 tesseract_collision::ContactResultMap
 checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
                        const tesseract_common::TransformMap& state0,
                        const tesseract_common::TransformMap& state1,
+                       const tesseract_collision::ContactRequest& contact_request,
+                       TrajectorySegmentCache* cache = nullptr);
+
+/**
+ * @brief Should perform a continuous collision check between two states only passing along the contact_request to the
+ * manager, writing the results into the provided map
+ * @details The map is cleared first, reusing the same map for every segment avoids reallocating it
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param contact_request Contact request passed to the manager
+ * @param cache An optional cache of segment results, when the segment is cached the manager is not called
+ */
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::TransformMap& state0,
+                            const tesseract_common::TransformMap& state1,
+                            const tesseract_collision::ContactRequest& contact_request,
+                            TrajectorySegmentCache* cache = nullptr);
+
+/**
+ * @brief Should perform a continuous collision check between two states configuring the manager with the config
+ * @details The transform of each active collision object is found by index in the name tables of the states
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return Return the contact results map. If empty no contacts were found
+ */
+tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                                                             const tesseract_common::LinkTransforms& state0,
+                                                             const tesseract_common::LinkTransforms& state1,
+                                                             const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Should perform a continuous collision check between two states only passing along the contact_request to the
+ * manager
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param contact_request Contact request passed to the manager
+ * @return Return the contact results map. If empty not contacts were found
+ */
+tesseract_collision::ContactResultMap
+checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                       const tesseract_common::LinkTransforms& state0,
+                       const tesseract_common::LinkTransforms& state1,
                        const tesseract_collision::ContactRequest& contact_request);
 
 /**
@@ -101,6 +195,43 @@ tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::
                                                            const tesseract_common::TransformMap& state,
                                                            const tesseract_collision::ContactRequest& contact_request);
 
+/**
+ * @brief Should perform a discrete collision check a state only passing contact_request to the manager, writing the
+ * results into the provided map
+ * @details The map is cleared first, reusing the same map for every state avoids reallocating it
+ * @param contacts The contact results map. If empty no contacts were found
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request);
+
+/**
+ * @brief Should perform a discrete collision check a state first configuring manager with config
+ * @details The transform of each active collision object is found by index in the name table of the state
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return Return the contact results map. If empty no contacts were found
+ */
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::LinkTransforms& state,
+                                                           const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Should perform a discrete collision check a state only passing contact_request to the manager
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param contact_request Contact request passed to the manager
+ * @return Return the contact results map. If empty no contacts were found
+ */
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::LinkTransforms& state,
+                                                           const tesseract_collision::ContactRequest& contact_request);
+
 /**
  * @brief This processes interpolated contact results and updated cc_time and cc_type
  * @details This is copied from the trajopt utility processInterpolatedCollisionResults
@@ -127,6 +258,7 @@ void processInterpolatedSubSegmentCollisionResults(tesseract_collision::ContactR
  * @param joint_names JointNames corresponding to the values in traj (must be in same order)
  * @param traj The joint values at each time step
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
  * @return True if collision was found, otherwise false.
  */
 bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
@@ -134,7 +266,8 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_scene_graph::StateSolver& state_solver,
                      const std::vector<std::string>& joint_names,
                      const tesseract_common::TrajArray& traj,
-                     const tesseract_collision::CollisionCheckConfig& config);
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr);
 
 /**
  * @brief Should perform a continuous collision check over the trajectory and stop on first collision.
@@ -144,13 +277,15 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
  * @param manip The kinematic joint group
  * @param traj The joint values at each time step
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
  * @return True if collision was found, otherwise false.
  */
 bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
                      tesseract_collision::ContinuousContactManager& manager,
                      const tesseract_kinematics::JointGroup& manip,
                      const tesseract_common::TrajArray& traj,
-                     const tesseract_collision::CollisionCheckConfig& config);
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr);
 
 /**
  * @brief Should perform a discrete collision check over the trajectory and stop on first collision.
@@ -186,5 +321,339 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_common::TrajArray& traj,
                      const tesseract_collision::CollisionCheckConfig& config);
 
+/**
+ * @brief Should perform a continuous collision check over the trajectory using a pool of contact managers.
+ * @details The trajectory segments are distributed across the managers in order, each worker using the state solver
+ * at the same index. The results are identical to the serial checkTrajectory. When ContactTestType::FIRST is requested
+ * the workers stop once a collision is found at an earlier segment than they would process next.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory. The length should
+ * be trajectory size minus one.
+ * @param managers The continuous contact managers, one per worker. These are typically clones of the same manager.
+ * @param state_solvers The state solvers, one per worker. Must be the same size as managers.
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
+ * @param executor The executor running the workers, nullptr uses the default executor
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::ContinuousContactManager::UPtr>& managers,
+                     const std::vector<tesseract_scene_graph::StateSolver::UPtr>& state_solvers,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr,
+                     const tesseract_common::Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Should perform a continuous collision check over the trajectory using a pool of contact managers.
+ * @details The trajectory segments are distributed across the managers in order, each worker using the joint group at
+ * the same index. The results are identical to the serial checkTrajectory.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory. The length should
+ * be trajectory size minus one.
+ * @param managers The continuous contact managers, one per worker. These are typically clones of the same manager.
+ * @param manips The kinematic joint groups, one per worker. Must be the same size as managers.
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
+ * @param executor The executor running the workers, nullptr uses the default executor
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::ContinuousContactManager::UPtr>& managers,
+                     const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr,
+                     const tesseract_common::Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory using a pool of contact managers.
+ * @details The trajectory states are distributed across the managers in order, each worker using the state solver at
+ * the same index. The results are identical to the serial checkTrajectory. When ContactTestType::FIRST is requested the
+ * workers stop once a collision is found at an earlier state than they would process next.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param managers The discrete contact managers, one per worker. These are typically clones of the same manager.
+ * @param state_solvers The state solvers, one per worker. Must be the same size as managers.
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param executor The executor running the workers, nullptr uses the default executor
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                     const std::vector<tesseract_scene_graph::StateSolver::UPtr>& state_solvers,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     const tesseract_common::Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory using a pool of contact managers.
+ * @details The trajectory states are distributed across the managers in order, each worker using the joint group at the
+ * same index. The results are identical to the serial checkTrajectory.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param managers The discrete contact managers, one per worker. These are typically clones of the same manager.
+ * @param manips The kinematic joint groups, one per worker. Must be the same size as managers.
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param executor The executor running the workers, nullptr uses the default executor
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                     const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     const tesseract_common::Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Should perform a continuous collision check over the trajectory, only summarizing the contacts of each step
+ * @details The contacts of a step are checked into storage reused for every step, so the results of the whole
+ * trajectory are never stored. Use checkTrajectoryStep to get the contacts of selected steps.
+ * @param summary The summary, one entry per segment of the trajectory
+ * @param manager A continuous contact manager
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr);
+
+/**
+ * @brief Should perform a continuous collision check over the trajectory, only summarizing the contacts of each step
+ * @details The contacts of a step are checked into storage reused for every step, so the results of the whole
+ * trajectory are never stored. Use checkTrajectoryStep to get the contacts of selected steps.
+ * @param summary The summary, one entry per segment of the trajectory
+ * @param manager A continuous contact manager
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param cache An optional cache of segment results, the cached segments are not checked again
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache = nullptr);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory, only summarizing the contacts of each step
+ * @details The states are checked in order, CollisionCheckConfig::bisection_order is not used. Use checkTrajectoryStep
+ * to get the contacts of selected steps.
+ * @param summary The summary, one entry per state of the trajectory
+ * @param manager A discrete contact manager
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory, only summarizing the contacts of each step
+ * @details The states are checked in order, CollisionCheckConfig::bisection_order is not used. Use checkTrajectoryStep
+ * to get the contacts of selected steps.
+ * @param summary The summary, one entry per state of the trajectory
+ * @param manager A discrete contact manager
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Calculate the contacts of a single segment of a trajectory, including its LVS sub segments
+ * @details The contacts are the same as the ones checkTrajectory reports for the segment.
+ * @param contacts The contacts of the segment
+ * @param manager A continuous contact manager
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param step The segment, from traj.row(step) to traj.row(step + 1)
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const std::vector<std::string>& joint_names,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Calculate the contacts of a single segment of a trajectory, including its LVS sub segments
+ * @details The contacts are the same as the ones checkTrajectory reports for the segment.
+ * @param contacts The contacts of the segment
+ * @param manager A continuous contact manager
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param step The segment, from traj.row(step) to traj.row(step + 1)
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_kinematics::JointGroup& manip,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Calculate the contacts of a single state of a trajectory, including its LVS sub states
+ * @details The contacts are the same as the ones checkTrajectory reports for the state.
+ * @param contacts The contacts of the state
+ * @param manager A discrete contact manager
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param step The state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const std::vector<std::string>& joint_names,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Calculate the contacts of a single state of a trajectory, including its LVS sub states
+ * @details The contacts are the same as the ones checkTrajectory reports for the state.
+ * @param contacts The contacts of the state
+ * @param manager A discrete contact manager
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param step The state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_kinematics::JointGroup& manip,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config);
+
+/**
+ * @brief Calculate the gradient of the distance of each contact with respect to the joint values of a joint group
+ * @details The jacobian of each active link in the contacts is calculated once and shifted to the nearest point of
+ * each of its contacts. The gradient of a contact is the normal projected onto the difference of the linear
+ * velocities of the nearest points on link_names[1] and link_names[0]. Links which are not active in the group do not
+ * contribute, so a contact between two links the group does not move has a zero gradient.
+ *
+ * The contacts must be discrete contacts calculated at the joint values, with the nearest points and normal in the
+ * frame of the group base link.
+ * @param gradients The gradients, resized to one row per contact and one column per joint of the group
+ * @param group The joint group
+ * @param joint_values The joint values the contacts were calculated at
+ * @param contacts The contacts
+ */
+void calcContactDistanceGradients(Eigen::MatrixXd& gradients,
+                                  const tesseract_kinematics::JointGroup& group,
+                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                  const tesseract_collision::ContactResultVector& contacts);
+
+/**
+ * @brief Filter inverse kinematics solutions of a joint group, keeping the solutions which are not in collision
+ * @details The solutions, and optionally their redundant solutions, are sorted by their distance to the seed and
+ * checked in that order, so the returned solutions are the collision free solutions closest to the seed. A solution is
+ * in collision if the contact test reports any contact. Only the transforms of the active collision objects which are
+ * links of the group are updated, the other collision objects keep their transforms.
+ * @param manager A discrete contact manager
+ * @param manip The kinematic joint group the solutions belong to
+ * @param solutions The inverse kinematics solutions, for example from KinematicGroup::calcInvKin
+ * @param seed The seed the solutions are sorted by, must be the size of the number of joints of the group
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param max_solutions The number of collision free solutions after which the checks stop, zero checks all solutions
+ * @param include_redundant Indicate if the redundant solutions within the joint limits are checked as well
+ * @return The collision free solutions sorted by their distance to the seed
+ */
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(tesseract_collision::DiscreteContactManager& manager,
+                               const tesseract_kinematics::JointGroup& manip,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions = 0,
+                               bool include_redundant = false);
+
+/**
+ * @brief Filter inverse kinematics solutions of a joint group in parallel, keeping the solutions which are not in
+ * collision
+ * @details The sorted solutions are handed out to the workers in order, so the results are identical to the serial
+ * filterCollisionFreeIKSolutions.
+ * @param managers The discrete contact managers, one per worker. These are typically clones of the same manager.
+ * @param manips The kinematic joint groups, one per worker. Must be the same size as managers.
+ * @param solutions The inverse kinematics solutions, for example from KinematicGroup::calcInvKin
+ * @param seed The seed the solutions are sorted by, must be the size of the number of joints of the group
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param max_solutions The number of collision free solutions after which the checks stop, zero checks all solutions
+ * @param include_redundant Indicate if the redundant solutions within the joint limits are checked as well
+ * @param executor The executor running the workers, nullptr uses the default executor
+ * @return The collision free solutions sorted by their distance to the seed
+ */
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                               const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions = 0,
+                               bool include_redundant = false,
+                               const tesseract_common::Executor::Ptr& executor = nullptr);
+
+/**
+ * @brief Filter inverse kinematics solutions of a joint group against an environment
+ * @details Creates a discrete contact manager of the environment with the active links of the group as its active
+ * collision objects and a copy of the group for each thread, see filterCollisionFreeIKSolutions.
+ * @param env The environment in its current state
+ * @param manip The kinematic joint group the solutions belong to
+ * @param solutions The inverse kinematics solutions, for example from KinematicGroup::calcInvKin
+ * @param seed The seed the solutions are sorted by, must be the size of the number of joints of the group
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param max_solutions The number of collision free solutions after which the checks stop, zero checks all solutions
+ * @param include_redundant Indicate if the redundant solutions within the joint limits are checked as well
+ * @param threads The number of threads checking the solutions, one checks them on the calling thread
+ * @return The collision free solutions sorted by their distance to the seed
+ */
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(const Environment& env,
+                               const tesseract_kinematics::JointGroup& manip,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions = 0,
+                               bool include_redundant = false,
+                               std::size_t threads = 1);
+
 }  // namespace tesseract_environment
 #endif  // TESSERACT_ENVIRONMENT_CORE_UTILS_H
@@ -0,0 +1,281 @@
+/**
+ * @file allowed_collision_matrix_generator.cpp
+ * @brief Generates the allowed collision matrix of an environment by sampling random states
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/allowed_collision_matrix_generator.h>
+#include <tesseract_common/sampling.h>
+
+namespace tesseract_environment
+{
+const std::string AllowedCollisionReasons::ADJACENT = "Adjacent";
+const std::string AllowedCollisionReasons::DEFAULT = "Default";
+const std::string AllowedCollisionReasons::ALWAYS = "Always";
+const std::string AllowedCollisionReasons::NEVER = "Never";
+
+namespace
+{
+/** @brief The number of sampled states a pair was in collision in and if the worker stopped checking it */
+struct PairCount
+{
+  std::size_t count{ 0 };
+  bool skipped{ false };
+};
+
+using PairCounts = std::unordered_map<tesseract_common::LinkNamesPair, PairCount, tesseract_common::PairHash>;
+
+/**
+ * @brief Add the adjacent pairs of links with collision geometry
+ * @details Links without collision geometry are looked through, so two links connected through a chain of links
+ * without collision geometry are adjacent as well
+ */
+void addAdjacentPairs(tesseract_common::AllowedCollisionMatrix& acm,
+                      const tesseract_scene_graph::SceneGraph& scene_graph,
+                      const std::unordered_set<std::string>& collision_links)
+{
+  std::unordered_map<std::string, std::vector<std::string>> neighbors;
+  for (const auto& joint : scene_graph.getJoints())
+  {
+    neighbors[joint->parent_link_name].push_back(joint->child_link_name);
+    neighbors[joint->child_link_name].push_back(joint->parent_link_name);
+  }
+
+  for (const auto& link_name : collision_links)
+  {
+    std::unordered_set<std::string> visited{ link_name };
+    std::deque<std::string> queue{ link_name };
+    while (!queue.empty())
+    {
+      const std::string current = queue.front();
+      queue.pop_front();
+      for (const auto& neighbor : neighbors[current])
+      {
+        if (!visited.insert(neighbor).second)
+          continue;
+
+        if (collision_links.count(neighbor) != 0)
+          acm.addAllowedCollision(link_name, neighbor, AllowedCollisionReasons::ADJACENT);
+        else
+          queue.push_back(neighbor);
+      }
+    }
+  }
+}
+
+/** @brief Configure a contact manager to check every pair of collision objects which is not allowed in acm */
+void setupContactManager(tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_common::AllowedCollisionMatrix& acm)
+{
+  manager.setActiveCollisionObjects(manager.getCollisionObjects());
+  manager.setCollisionMarginData(tesseract_common::CollisionMarginData(0.0));
+  manager.setIsContactAllowedFn(
+      [&acm](const std::string& link_name1, const std::string& link_name2) {
+        return acm.isCollisionAllowed(link_name1, link_name2);
+      });
+}
+}  // namespace
+
+tesseract_common::AllowedCollisionMatrix
+generateAllowedCollisionMatrix(const Environment& env, const AllowedCollisionMatrixGeneratorConfig& config)
+{
+  if (!env.isInitialized())
+    throw std::runtime_error("generateAllowedCollisionMatrix, the environment is not initialized!");
+
+  auto getManager = [&env, &config]() {
+    return config.contact_manager.empty() ? env.getDiscreteContactManager() :
+                                            env.getDiscreteContactManager(config.contact_manager);
+  };
+
+  tesseract_collision::DiscreteContactManager::UPtr manager = getManager();
+  if (manager == nullptr)
+    throw std::runtime_error("generateAllowedCollisionMatrix, the discrete contact manager is not available!");
+
+  const tesseract_scene_graph::SceneState default_state = env.getState();
+  std::vector<std::string> names;
+  for (const auto& name : manager->getCollisionObjects())
+  {
+    if (default_state.link_transforms.find(name) != default_state.link_transforms.end())
+      names.push_back(name);
+  }
+  const std::unordered_set<std::string> collision_links(names.begin(), names.end());
+
+  // The pairs allowed so far are not checked again
+  tesseract_common::AllowedCollisionMatrix acm;
+  addAdjacentPairs(acm, *env.getSceneGraph(), collision_links);
+
+  tesseract_collision::ContactRequest request(tesseract_collision::ContactTestType::CLOSEST);
+  request.detail = tesseract_collision::ContactResultDetail::BINARY;
+
+  {
+    setupContactManager(*manager, acm);
+    manager->setCollisionObjectsTransform(default_state.link_transforms);
+
+    tesseract_collision::ContactResultMap contacts;
+    manager->contactTest(contacts, request);
+
+    tesseract_common::AllowedCollisionMatrix default_acm;
+    for (const auto& contact : contacts)
+      default_acm.addAllowedCollision(contact.first.first, contact.first.second, AllowedCollisionReasons::DEFAULT);
+    acm.insertAllowedCollisionMatrix(default_acm);
+  }
+
+  const std::size_t samples = config.samples;
+  if (samples == 0)
+    return acm;
+
+  const tesseract_common::Executor::Ptr executor =
+      (config.executor != nullptr) ? config.executor : tesseract_common::getDefaultExecutor();
+  std::size_t threads = (config.threads == 0) ? executor->getConcurrency() : config.threads;
+  threads = std::min(threads, samples);
+  const std::size_t batch_size = std::max<std::size_t>(config.batch_size, 1);
+
+  // Each worker samples a fixed range of states with its own generator, so the result only depends on the seed and
+  // the number of workers
+  std::vector<tesseract_collision::DiscreteContactManager::UPtr> managers;
+  std::vector<tesseract_scene_graph::StateSolver::UPtr> solvers;
+  for (std::size_t i = 0; i < threads; ++i)
+  {
+    managers.push_back((i == 0) ? std::move(manager) : getManager());
+    solvers.push_back(env.getStateSolver());
+  }
+
+  const double max_misses = (1.0 - config.always_fraction) * static_cast<double>(samples);
+  std::vector<PairCounts> counts(threads);
+  std::vector<std::exception_ptr> errors(threads);
+  auto run = [&](std::size_t worker) {
+    try
+    {
+      tesseract_collision::DiscreteContactManager& worker_manager = *managers[worker];
+      const tesseract_scene_graph::StateSolver& solver = *solvers[worker];
+      PairCounts& worker_counts = counts[worker];
+
+      // Pairs which can no longer be always or never in collision are allowed for the remaining states
+      tesseract_common::AllowedCollisionMatrix worker_acm = acm;
+      setupContactManager(worker_manager, worker_acm);
+
+      const std::vector<std::string> joint_names = solver.getActiveJointNames();
+      const Eigen::MatrixX2d limits = solver.getLimits().joint_limits;
+      std::mt19937 generator(config.seed + static_cast<uint32_t>(worker));
+      tesseract_common::TrajArray joint_values(static_cast<Eigen::Index>(batch_size), limits.rows());
+
+      tesseract_scene_graph::SceneState state;
+      std::vector<tesseract_common::VectorIsometry3d> poses;
+      std::vector<tesseract_collision::ContactResultMap> contacts;
+
+      const std::size_t begin = (samples * worker) / threads;
+      const std::size_t end = (samples * (worker + 1)) / threads;
+      for (std::size_t i = begin; i < end; i += batch_size)
+      {
+        poses.resize(std::min(batch_size, end - i));
+        auto batch_values = joint_values.topRows(static_cast<Eigen::Index>(poses.size()));
+        tesseract_common::sampleUniform(batch_values, limits, generator);
+        for (std::size_t k = 0; k < poses.size(); ++k)
+        {
+          auto& state_poses = poses[k];
+          solver.getState(state, joint_names, batch_values.row(static_cast<Eigen::Index>(k)).transpose());
+          state_poses.clear();
+          state_poses.reserve(names.size());
+          for (const auto& name : names)
+            state_poses.push_back(state.link_transforms.at(name));
+        }
+
+        worker_manager.batchContactTest(contacts, names, poses, request);
+        for (const auto& state_contacts : contacts)
+        {
+          for (const auto& contact : state_contacts)
+            ++worker_counts[tesseract_common::makeOrderedLinkPair(contact.first.first, contact.first.second)].count;
+        }
+
+        const std::size_t checked = i + poses.size() - begin;
+        for (auto& pair_count : worker_counts)
+        {
+          if (!pair_count.second.skipped && static_cast<double>(checked - pair_count.second.count) > max_misses)
+          {
+            pair_count.second.skipped = true;
+            worker_acm.addAllowedCollision(pair_count.first.first, pair_count.first.second, "");
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      errors[worker] = std::current_exception();
+    }
+  };
+
+  executor->parallelFor(threads, run);
+
+  for (const auto& error : errors)
+  {
+    if (error != nullptr)
+      std::rethrow_exception(error);
+  }
+
+  PairCounts total;
+  for (const auto& worker_counts : counts)
+  {
+    for (const auto& pair_count : worker_counts)
+      total[pair_count.first].count += pair_count.second.count;
+  }
+
+  tesseract_common::AllowedCollisionEntries entries;
+  std::sort(names.begin(), names.end());
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < names.size(); ++j)
+    {
+      if (acm.isCollisionAllowed(names[i], names[j]))
+        continue;
+
+      const tesseract_common::LinkNamesPair pair = tesseract_common::makeOrderedLinkPair(names[i], names[j]);
+      auto it = total.find(pair);
+      const std::size_t count = (it != total.end()) ? it->second.count : 0;
+      if (count == 0)
+        entries[pair] = AllowedCollisionReasons::NEVER;
+      else if (static_cast<double>(count) >= config.always_fraction * static_cast<double>(samples))
+        entries[pair] = AllowedCollisionReasons::ALWAYS;
+    }
+  }
+
+  acm.addAllowedCollisions(std::move(entries));
+  return acm;
+}
+
+ModifyAllowedCollisionsCommand::Ptr createModifyAllowedCollisionsCommand(tesseract_common::AllowedCollisionMatrix acm)
+{
+  return std::make_shared<ModifyAllowedCollisionsCommand>(std::move(acm), ModifyAllowedCollisionsType::ADD);
+}
+
+}  // namespace tesseract_environment
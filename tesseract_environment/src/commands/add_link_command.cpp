@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
+#include <tesseract_geometry/geometry_pool.h>
 #include <tesseract_environment/commands/add_link_command.h>
 
 namespace tesseract_environment
@@ -48,6 +49,19 @@ bool AddLinkCommand::operator==(const AddLinkCommand& rhs) const
 }
 bool AddLinkCommand::operator!=(const AddLinkCommand& rhs) const { return !operator==(rhs); }
 
+tesseract_scene_graph::Link::Ptr AddLinkCommand::copyLink(const tesseract_scene_graph::Link& link)
+{
+  auto copy = std::make_shared<tesseract_scene_graph::Link>(link.clone());
+  auto& pool = tesseract_geometry::GeometryPool::getInstance();
+  for (auto& visual : copy->visual)
+    visual->geometry = pool.intern(visual->geometry);
+
+  for (auto& collision : copy->collision)
+    collision->geometry = pool.intern(collision->geometry);
+
+  return copy;
+}
+
 template <class Archive>
 void AddLinkCommand::serialize(Archive& ar, const unsigned int /*version*/)
 {
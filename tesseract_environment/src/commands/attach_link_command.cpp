@@ -0,0 +1,79 @@
+/**
+ * @file attach_link_command.cpp
+ * @brief Used to attach a link to another link, like a grasped object to a gripper
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/eigen_serialization.h>
+#include <tesseract_environment/commands/attach_link_command.h>
+
+namespace tesseract_environment
+{
+AttachLinkCommand::AttachLinkCommand() : Command(CommandType::ATTACH_LINK), origin_(Eigen::Isometry3d::Identity()) {}
+
+AttachLinkCommand::AttachLinkCommand(std::string link_name,
+                                     std::string parent_link_name,
+                                     const Eigen::Isometry3d& origin)
+  : Command(CommandType::ATTACH_LINK)
+  , link_name_(std::move(link_name))
+  , parent_link_name_(std::move(parent_link_name))
+  , origin_(origin)
+{
+}
+
+const std::string& AttachLinkCommand::getLinkName() const { return link_name_; }
+const std::string& AttachLinkCommand::getParentLinkName() const { return parent_link_name_; }
+const Eigen::Isometry3d& AttachLinkCommand::getOrigin() const { return origin_; }
+
+bool AttachLinkCommand::operator==(const AttachLinkCommand& rhs) const
+{
+  bool equal = true;
+  equal &= Command::operator==(rhs);
+  equal &= link_name_ == rhs.link_name_;
+  equal &= parent_link_name_ == rhs.parent_link_name_;
+  equal &= origin_.isApprox(rhs.origin_, 1e-5);
+  return equal;
+}
+bool AttachLinkCommand::operator!=(const AttachLinkCommand& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void AttachLinkCommand::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Command);
+  ar& BOOST_SERIALIZATION_NVP(link_name_);
+  ar& BOOST_SERIALIZATION_NVP(parent_link_name_);
+  ar& BOOST_SERIALIZATION_NVP(origin_);
+}
+}  // namespace tesseract_environment
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_environment::AttachLinkCommand)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_environment::AttachLinkCommand)
@@ -0,0 +1,385 @@
+/**
+ * @file contact_manager_autotune.cpp
+ * @brief Selects the fastest contact managers of an environment by benchmarking them on its scene
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <random>
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/contact_manager_autotune.h>
+#include <tesseract_environment/environment_sync.h>
+#include <tesseract_common/sampling.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The smallest distance of each pair of links in contact */
+using PairDistances = std::map<tesseract_collision::ContactResultMap::KeyType, double>;
+
+PairDistances getPairDistances(const tesseract_collision::ContactResultMap& contacts)
+{
+  PairDistances distances;
+  for (const auto& pair : contacts)
+  {
+    double distance = std::numeric_limits<double>::max();
+    for (const auto& contact : pair.second)
+      distance = std::min(distance, contact.distance);
+
+    distances[pair.first] = distance;
+  }
+  return distances;
+}
+
+/** @brief Compare the contacts of a manager to the reference, returns the difference or an empty string */
+std::string compareContacts(const PairDistances& reference, const PairDistances& contacts, double tolerance)
+{
+  for (const auto& pair : reference)
+  {
+    auto it = contacts.find(pair.first);
+    if (it == contacts.end())
+    {
+      // A pair near the contact distance may only be reported by one of the managers
+      if (pair.second < -tolerance)
+        return "The penetration of " + pair.first.first + " and " + pair.first.second + " was not reported";
+
+      continue;
+    }
+
+    if (std::abs(it->second - pair.second) > tolerance)
+      return "The distance of " + pair.first.first + " and " + pair.first.second + " does not match the reference";
+  }
+
+  for (const auto& pair : contacts)
+  {
+    if (pair.second < -tolerance && reference.find(pair.first) == reference.end())
+      return "The penetration of " + pair.first.first + " and " + pair.first.second + " is not in the reference";
+  }
+
+  return {};
+}
+
+/**
+ * @brief Check the contacts of a manager against the reference and time its contact tests
+ * @details If the reference is empty the manager is the reference and its contacts are added to it.
+ */
+template <typename ManagerType, typename SetTransformsFn>
+ContactManagerTiming benchmarkManager(std::unique_ptr<ManagerType> manager,
+                                      const std::string& name,
+                                      std::size_t num_tests,
+                                      const SetTransformsFn& set_transforms,
+                                      const ContactManagerAutotuneConfig& config,
+                                      std::vector<PairDistances>& reference)
+{
+  ContactManagerTiming timing;
+  timing.name = name;
+  if (manager == nullptr)
+  {
+    timing.message = "The contact manager could not be created";
+    return timing;
+  }
+
+  try
+  {
+    // The accuracy pass also warms up the manager before it is timed
+    tesseract_collision::ContactRequest all_request = config.contact_request;
+    all_request.type = tesseract_collision::ContactTestType::ALL;
+
+    const bool is_reference = reference.empty();
+    tesseract_collision::ContactResultMap contacts;
+    for (std::size_t i = 0; i < num_tests; ++i)
+    {
+      set_transforms(*manager, i);
+      contacts.clear();
+      manager->contactTest(contacts, all_request);
+      if (is_reference)
+        reference.push_back(getPairDistances(contacts));
+      else if (timing.message.empty())
+        timing.message = compareContacts(reference[i], getPairDistances(contacts), config.distance_tolerance);
+    }
+
+    timing.accurate = timing.message.empty();
+    if (!timing.accurate)
+      return timing;
+
+    timing.time = 0;
+    if (num_tests == 0)
+      return timing;
+
+    timing.time = std::numeric_limits<double>::max();
+    for (std::size_t pass = 0; pass < std::max<std::size_t>(config.repetitions, 1); ++pass)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < num_tests; ++i)
+      {
+        set_transforms(*manager, i);
+        contacts.clear();
+        manager->contactTest(contacts, config.contact_request);
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      timing.time = std::min(timing.time, elapsed.count() / static_cast<double>(num_tests));
+    }
+  }
+  catch (const std::exception& e)
+  {
+    timing.accurate = false;
+    timing.time = std::numeric_limits<double>::max();
+    timing.message = e.what();
+  }
+
+  return timing;
+}
+
+/** @brief Get the plugin names with the default plugin first, which makes it the reference */
+std::vector<std::string> getPluginNames(const tesseract_common::PluginInfoContainer& plugin_infos)
+{
+  std::vector<std::string> names;
+  if (plugin_infos.plugins.find(plugin_infos.default_plugin) != plugin_infos.plugins.end())
+    names.push_back(plugin_infos.default_plugin);
+
+  for (const auto& plugin : plugin_infos.plugins)
+  {
+    if (plugin.first != plugin_infos.default_plugin)
+      names.push_back(plugin.first);
+  }
+  return names;
+}
+
+/** @brief Get the name of the fastest accurate manager, empty if there is none */
+std::string getFastest(const std::vector<ContactManagerTiming>& timings)
+{
+  const ContactManagerTiming* fastest{ nullptr };
+  for (const auto& timing : timings)
+  {
+    if (timing.accurate && (fastest == nullptr || timing.time < fastest->time))
+      fastest = &timing;
+  }
+  return (fastest == nullptr) ? std::string() : fastest->name;
+}
+
+ContactManagerAutotuneResult benchmarkContactManagers(const Environment& env,
+                                                      const ContactManagerAutotuneConfig& config,
+                                                      std::uint64_t environment_hash)
+{
+  ContactManagerAutotuneResult result;
+  result.environment_hash = environment_hash;
+  if (!env.isInitialized())
+  {
+    CONSOLE_BRIDGE_logError("benchmarkContactManagers, the environment is not initialized!");
+    return result;
+  }
+
+  // Only the active links move, so the transforms of the other links are left as they are
+  tesseract_scene_graph::StateSolver::UPtr state_solver = env.getStateSolver();
+  const std::vector<std::string> active_links = env.getActiveLinkNames();
+  const std::vector<std::string> joint_names = state_solver->getActiveJointNames();
+  const Eigen::MatrixX2d limits = state_solver->getLimits().joint_limits;
+  tesseract_common::TrajArray samples(static_cast<Eigen::Index>(config.num_states), limits.rows());
+  std::mt19937 generator(config.seed);
+  tesseract_common::sampleUniform(samples, limits, generator);
+
+  std::vector<tesseract_common::TransformMap> transforms;
+  transforms.reserve(config.num_states);
+  for (Eigen::Index i = 0; i < samples.rows(); ++i)
+  {
+    const Eigen::VectorXd joint_values = samples.row(i).transpose();
+    const tesseract_scene_graph::SceneState state = state_solver->getState(joint_names, joint_values);
+    tesseract_common::TransformMap& link_transforms = transforms.emplace_back();
+    for (const auto& link_name : active_links)
+      link_transforms[link_name] = state.link_transforms.at(link_name);
+  }
+
+  const tesseract_common::ContactManagersPluginInfo plugin_info = env.getContactManagersPluginInfo();
+  if (config.discrete)
+  {
+    auto set_transforms = [&transforms](tesseract_collision::DiscreteContactManager& manager, std::size_t i) {
+      manager.setCollisionObjectsTransform(transforms[i]);
+    };
+
+    std::vector<PairDistances> reference;
+    for (const auto& name : getPluginNames(plugin_info.discrete_plugin_infos))
+    {
+      tesseract_collision::DiscreteContactManager::UPtr manager = env.getDiscreteContactManager(name);
+      if (manager != nullptr)
+        manager->setActiveCollisionObjects(active_links);
+
+      result.discrete_timings.push_back(
+          benchmarkManager(std::move(manager), name, transforms.size(), set_transforms, config, reference));
+    }
+    result.discrete_manager = getFastest(result.discrete_timings);
+  }
+
+  if (config.continuous)
+  {
+    auto set_transforms = [&transforms](tesseract_collision::ContinuousContactManager& manager, std::size_t i) {
+      manager.setCollisionObjectsTransform(transforms[i], transforms[i + 1]);
+    };
+
+    std::vector<PairDistances> reference;
+    const std::size_t num_tests = transforms.empty() ? 0 : transforms.size() - 1;
+    for (const auto& name : getPluginNames(plugin_info.continuous_plugin_infos))
+    {
+      tesseract_collision::ContinuousContactManager::UPtr manager = env.getContinuousContactManager(name);
+      if (manager != nullptr)
+        manager->setActiveCollisionObjects(active_links);
+
+      result.continuous_timings.push_back(
+          benchmarkManager(std::move(manager), name, num_tests, set_transforms, config, reference));
+    }
+    result.continuous_manager = getFastest(result.continuous_timings);
+  }
+
+  return result;
+}
+}  // namespace
+
+std::uint64_t getEnvironmentHash(const Environment& env)
+{
+  // The 64 bit FNV-1a hash
+  const std::string data = encodeEnvironmentDelta(getEnvironmentDelta(env, 0));
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : data)
+  {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+ContactManagerAutotuneResult benchmarkContactManagers(const Environment& env,
+                                                      const ContactManagerAutotuneConfig& config)
+{
+  return benchmarkContactManagers(env, config, getEnvironmentHash(env));
+}
+
+bool ContactManagerAutotuneCache::get(ContactManagerAutotuneResult& result, std::uint64_t environment_hash) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = results_.find(environment_hash);
+  if (it == results_.end())
+    return false;
+
+  result = it->second;
+  return true;
+}
+
+void ContactManagerAutotuneCache::set(const ContactManagerAutotuneResult& result)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  results_[result.environment_hash] = result;
+}
+
+std::size_t ContactManagerAutotuneCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return results_.size();
+}
+
+void ContactManagerAutotuneCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  results_.clear();
+}
+
+bool ContactManagerAutotuneCache::save(const std::string& file_path) const
+{
+  YAML::Node results(YAML::NodeType::Sequence);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& result : results_)
+    {
+      YAML::Node entry;
+      entry["environment_hash"] = result.first;
+      entry["discrete_manager"] = result.second.discrete_manager;
+      entry["continuous_manager"] = result.second.continuous_manager;
+      results.push_back(entry);
+    }
+  }
+
+  YAML::Node config;
+  config["contact_manager_autotune"] = results;
+  std::ofstream fout(file_path);
+  fout << config;
+  return fout.good();
+}
+
+bool ContactManagerAutotuneCache::load(const std::string& file_path)
+{
+  std::vector<ContactManagerAutotuneResult> results;
+  try
+  {
+    const YAML::Node config = YAML::LoadFile(file_path);
+    for (const auto& entry : config["contact_manager_autotune"])
+    {
+      ContactManagerAutotuneResult& result = results.emplace_back();
+      result.environment_hash = entry["environment_hash"].as<std::uint64_t>();
+      result.discrete_manager = entry["discrete_manager"].as<std::string>();
+      result.continuous_manager = entry["continuous_manager"].as<std::string>();
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("ContactManagerAutotuneCache, failed to load '%s': %s", file_path.c_str(), e.what());
+    return false;
+  }
+
+  for (const auto& result : results)
+    set(result);
+
+  return true;
+}
+
+ContactManagerAutotuneResult autotuneContactManagers(Environment& env,
+                                                     const ContactManagerAutotuneConfig& config,
+                                                     ContactManagerAutotuneCache* cache)
+{
+  ContactManagerAutotuneResult result;
+  const std::uint64_t environment_hash = getEnvironmentHash(env);
+  if (cache == nullptr || !cache->get(result, environment_hash))
+  {
+    result = benchmarkContactManagers(env, config, environment_hash);
+    if (!env.isInitialized())
+      return result;
+
+    if (cache != nullptr)
+      cache->set(result);
+  }
+
+  if (!result.discrete_manager.empty())
+    env.setActiveDiscreteContactManager(result.discrete_manager);
+
+  if (!result.continuous_manager.empty())
+    env.setActiveContinuousContactManager(result.continuous_manager);
+
+  return result;
+}
+}  // namespace tesseract_environment
@@ -0,0 +1,91 @@
+/**
+ * @file contact_manager_binding.cpp
+ * @brief Binds the links of a joint group to the collision objects of a contact manager
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/contact_manager_binding.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+std::vector<std::string> getBoundLinkNames(const tesseract_kinematics::JointGroup& manip,
+                                           const tesseract_collision::DiscreteContactManager& manager)
+{
+  std::vector<std::string> link_names;
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+  {
+    if (manip.hasLinkName(link_name) && manager.hasCollisionObject(link_name))
+      link_names.push_back(link_name);
+  }
+  return link_names;
+}
+}  // namespace
+
+ContactManagerBinding::ContactManagerBinding(const tesseract_kinematics::JointGroup& manip,
+                                             tesseract_collision::DiscreteContactManager& manager)
+  : ContactManagerBinding(manip, manager, getBoundLinkNames(manip, manager))
+{
+}
+
+ContactManagerBinding::ContactManagerBinding(const tesseract_kinematics::JointGroup& manip,
+                                             tesseract_collision::DiscreteContactManager& manager,
+                                             std::vector<std::string> link_names)
+  : manip_(manip), manager_(manager), link_names_(std::move(link_names))
+{
+  link_indices_ = manip_.getLinkIndices(link_names_);
+  link_transforms_.resize(link_names_.size(), Eigen::Isometry3d::Identity());
+  rebind();
+}
+
+void ContactManagerBinding::update(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+{
+  TESSERACT_TRACE_ZONE("ContactManagerBinding::update");
+  manip_.calcFwdKin(link_transforms_, joint_values, link_indices_);
+  for (std::size_t i = 0; i < handles_.size(); ++i)
+    manager_.setCollisionObjectsTransform(handles_[i], link_transforms_[i]);
+}
+
+void ContactManagerBinding::rebind()
+{
+  handles_.resize(link_names_.size());
+  for (std::size_t i = 0; i < link_names_.size(); ++i)
+  {
+    handles_[i] = manager_.getCollisionObjectHandle(link_names_[i]);
+    if (handles_[i] < 0)
+      throw std::runtime_error("ContactManagerBinding: Link '" + link_names_[i] + "' is not a collision object!");
+  }
+}
+
+const std::vector<std::string>& ContactManagerBinding::getLinkNames() const { return link_names_; }
+
+const tesseract_common::VectorIsometry3d& ContactManagerBinding::getLinkTransforms() const { return link_transforms_; }
+
+}  // namespace tesseract_environment
@@ -27,12 +27,25 @@
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/utils.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/utils.h>
+#include <tesseract_collision/sdf/distance_field_filtered_continuous_manager.h>
+#include <tesseract_collision/sdf/distance_field_filtered_discrete_manager.h>
 #include <tesseract_srdf/utils.h>
 #include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
 #include <tesseract_kinematics/core/validate.h>
+#include <tesseract_common/executor.h>
+#include <tesseract_common/tracing.h>
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <queue>
+#include <sstream>
+#include <type_traits>
+#include <unordered_set>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/binary_object.hpp>
@@ -41,7 +54,239 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_environment
 {
-bool Environment::initHelper(const Commands& commands)
+/** @brief The discrete contact manager a thread keeps for an environment */
+struct DiscreteContactManagerPoolEntry
+{
+  /** @brief The pool token of the environment */
+  std::weak_ptr<const int> owner;
+
+  /** @brief The generation of the environment contact manager the manager was created from */
+  std::size_t generation{ 0 };
+
+  /** @brief The pooled manager, nullptr while checked out or before it is created */
+  tesseract_collision::DiscreteContactManager::UPtr manager;
+
+  /** @brief Indicates if the pooled manager is checked out, it is cleared by the thread the manager is returned on */
+  std::atomic<bool> checked_out{ false };
+};
+
+/** @brief The joint or kinematic group a thread keeps for an environment */
+struct JointGroupPoolEntry
+{
+  /** @brief The pool token of the environment */
+  std::weak_ptr<const int> owner;
+
+  /** @brief The group name */
+  std::string group_name;
+
+  /** @brief The IK solver name, only used by kinematic groups */
+  std::string ik_solver_name;
+
+  /** @brief Indicates if the pooled group is a kinematic group */
+  bool kinematic{ false };
+
+  /** @brief The kinematics generation of the environment the group was created from */
+  std::size_t generation{ 0 };
+
+  /** @brief The pooled group, nullptr while checked out or before it is created */
+  tesseract_kinematics::JointGroup::UPtr group;
+
+  /** @brief Indicates if the pooled group is checked out, it is cleared by the thread the group is returned on */
+  std::atomic<bool> checked_out{ false };
+};
+
+namespace
+{
+/** @brief Get the discrete contact managers the calling thread keeps for the environments */
+std::vector<std::shared_ptr<DiscreteContactManagerPoolEntry>>& getDiscreteContactManagerPool()
+{
+  thread_local std::vector<std::shared_ptr<DiscreteContactManagerPoolEntry>> pool;
+  return pool;
+}
+
+/** @brief Get the unique id of the calling thread, unlike std::thread::id these are never reused */
+std::size_t getPoolThreadId()
+{
+  static std::atomic<std::size_t> next_id{ 1 };
+  thread_local const std::size_t id = next_id++;
+  return id;
+}
+
+/** @brief Check if applying a command of the type changes the scene graph */
+bool changesSceneGraph(CommandType type)
+{
+  switch (type)
+  {
+    case CommandType::CHANGE_LINK_ORIGIN:
+    case CommandType::ADD_KINEMATICS_INFORMATION:
+    case CommandType::CHANGE_COLLISION_MARGINS:
+    case CommandType::ADD_CONTACT_MANAGERS_PLUGIN_INFO:
+    case CommandType::SET_ACTIVE_DISCRETE_CONTACT_MANAGER:
+    case CommandType::SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER:
+      return false;
+    default:
+      return true;
+  }
+}
+
+/** @brief Get the joint and kinematic groups the calling thread keeps for the environments */
+std::vector<std::shared_ptr<JointGroupPoolEntry>>& getJointGroupPool()
+{
+  thread_local std::vector<std::shared_ptr<JointGroupPoolEntry>> pool;
+  return pool;
+}
+
+/**
+ * @brief Check out a group from the pool of the calling thread
+ * @param create Creates a copy of the group from the environment
+ */
+template <typename GroupType>
+std::unique_ptr<GroupType, PooledJointGroupDeleter>
+checkoutGroupHelper(const std::shared_ptr<const int>& pool_token,
+                    const std::string& group_name,
+                    const std::string& ik_solver_name,
+                    std::size_t generation,
+                    const std::function<std::unique_ptr<GroupType>()>& create)
+{
+  const bool kinematic = std::is_same<GroupType, tesseract_kinematics::KinematicGroup>::value;
+  std::vector<std::shared_ptr<JointGroupPoolEntry>>& pool = getJointGroupPool();
+
+  std::shared_ptr<JointGroupPoolEntry> entry;
+  for (const auto& e : pool)
+  {
+    if (e->kinematic == kinematic && e->group_name == group_name && e->ik_solver_name == ik_solver_name &&
+        !e->owner.owner_before(pool_token) && !pool_token.owner_before(e->owner))
+    {
+      entry = e;
+      break;
+    }
+  }
+
+  // The pooled group is in use so return a copy which is not pooled
+  if (entry != nullptr && entry->checked_out)
+    return std::unique_ptr<GroupType, PooledJointGroupDeleter>(create().release());
+
+  if (entry == nullptr || entry->group == nullptr || entry->generation != generation)
+  {
+    // Create the group first so groups which do not exist are not added to the pool
+    std::unique_ptr<GroupType> group = create();
+    if (group == nullptr)
+      return nullptr;
+
+    if (entry == nullptr)
+    {
+      // Drop the groups of destroyed environments, entries in use are kept until their group is returned
+      pool.erase(std::remove_if(pool.begin(),
+                                pool.end(),
+                                [](const std::shared_ptr<JointGroupPoolEntry>& e) {
+                                  return !e->checked_out && e->owner.expired();
+                                }),
+                 pool.end());
+
+      entry = std::make_shared<JointGroupPoolEntry>();
+      entry->owner = pool_token;
+      entry->group_name = group_name;
+      entry->ik_solver_name = ik_solver_name;
+      entry->kinematic = kinematic;
+      pool.push_back(entry);
+    }
+
+    entry->group = std::move(group);
+    entry->generation = generation;
+  }
+
+  entry->checked_out = true;
+  return { static_cast<GroupType*>(entry->group.release()),
+           PooledJointGroupDeleter{ entry, generation, getPoolThreadId() } };
+}
+
+using FixedLinkTransforms =
+    tesseract_common::AlignedUnorderedMap<std::string, std::pair<std::string, Eigen::Isometry3d>>;
+
+/** @brief Get the link a link is attached to by fixed joints only and the transform relative to it */
+const std::pair<std::string, Eigen::Isometry3d>& findFixedLinkTransform(FixedLinkTransforms& transforms,
+                                                                        const tesseract_scene_graph::SceneGraph& graph,
+                                                                        const std::string& link_name)
+{
+  auto it = transforms.find(link_name);
+  if (it != transforms.end())
+    return it->second;
+
+  std::pair<std::string, Eigen::Isometry3d> transform(link_name, Eigen::Isometry3d::Identity());
+  std::vector<tesseract_scene_graph::Joint::ConstPtr> joints = graph.getInboundJoints(link_name);
+  if (joints.size() == 1 && joints.front()->type == tesseract_scene_graph::JointType::FIXED)
+  {
+    const auto& parent = findFixedLinkTransform(transforms, graph, joints.front()->parent_link_name);
+    transform.first = parent.first;
+    transform.second = parent.second * joints.front()->parent_to_joint_origin_transform;
+  }
+
+  // The references to the elements of an unordered map stay valid when it grows
+  return transforms[link_name] = std::move(transform);
+}
+
+/** @brief Save a command to its own binary archive */
+std::string saveCommandPayload(const Command::ConstPtr& command)
+{
+  std::ostringstream os(std::ios_base::binary);
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os);
+    oa << boost::serialization::make_nvp("command", command);
+  }
+  return os.str();
+}
+
+/** @brief Load a command from the binary archive created by saveCommandPayload */
+Command::ConstPtr loadCommandPayload(const std::string& payload)
+{
+  std::istringstream is(payload, std::ios_base::binary);
+  boost::archive::binary_iarchive ia(is);
+  Command::ConstPtr command;
+  ia >> boost::serialization::make_nvp("command", command);
+  return command;
+}
+
+/** @brief Get the key of the tcp offset cache */
+std::string getTCPOffsetKey(const tesseract_common::ManipulatorInfo& manip_info)
+{
+  return manip_info.manipulator + '\n' + manip_info.working_frame + '\n' + manip_info.tcp_frame + '\n' +
+         std::get<0>(manip_info.tcp_offset) + '\n' + manip_info.manipulator_ik_solver;
+}
+}  // namespace
+
+void PooledDiscreteContactManagerDeleter::operator()(tesseract_collision::DiscreteContactManager* manager) const
+{
+  tesseract_collision::DiscreteContactManager::UPtr owned(manager);
+  if (entry == nullptr)
+    return;
+
+  // The pool of a thread may only be accessed by that thread, so a manager returned on another thread is destroyed
+  if (thread_id == getPoolThreadId() && entry->generation == generation)
+    entry->manager = std::move(owned);
+
+  entry->checked_out = false;
+}
+
+void PooledJointGroupDeleter::operator()(tesseract_kinematics::JointGroup* group) const
+{
+  tesseract_kinematics::JointGroup::UPtr owned(group);
+  if (entry == nullptr)
+    return;
+
+  // The pool of a thread may only be accessed by that thread, so a group returned on another thread is destroyed
+  if (thread_id == getPoolThreadId() && entry->generation == generation)
+    entry->group = std::move(owned);
+
+  entry->checked_out = false;
+}
+
+Environment::~Environment()
+{
+  // Stop the asynchronous callbacks before the members they may access are destroyed
+  event_dispatcher_.clear();
+}
+
+bool Environment::initHelper(const Commands& commands, bool batch)
 {
   if (commands.empty())
     return false;
@@ -58,11 +303,11 @@ bool Environment::initHelper(const Commands& commands)
   scene_graph_ = std::make_shared<tesseract_scene_graph::SceneGraph>(
       std::static_pointer_cast<const AddSceneGraphCommand>(commands.at(0))->getSceneGraph()->getName());
   scene_graph_const_ = scene_graph_;
+  scene_graph_token_ = std::make_shared<const int>(0);
 
-  is_contact_allowed_fn_ = [this](const std::string& l1, const std::string& l2) {
-    return scene_graph_->isCollisionAllowed(l1, l2);
-  };
+  is_contact_allowed_fn_ = tesseract_collision::CompiledAllowedCollisionMatrixFn{ &compiled_acm_ };
 
+  batch_ = batch;
   if (!applyCommandsHelper(commands))
   {
     CONSOLE_BRIDGE_logError("When initializing environment from command history, it failed to apply a command!");
@@ -108,7 +353,8 @@ bool Environment::init(const std::string& urdf_string, const tesseract_common::R
   tesseract_scene_graph::SceneGraph::Ptr scene_graph;
   try
   {
-    scene_graph = tesseract_urdf::parseURDFString(urdf_string, *resource_locator_);
+    scene_graph = tesseract_urdf::parseURDFString(
+        urdf_string, *resource_locator_, init_threads_, init_load_visuals_, init_defer_collision_meshes_);
   }
   catch (const std::exception& e)
   {
@@ -131,7 +377,8 @@ bool Environment::init(const std::string& urdf_string,
   tesseract_scene_graph::SceneGraph::Ptr scene_graph;
   try
   {
-    scene_graph = tesseract_urdf::parseURDFString(urdf_string, *resource_locator_);
+    scene_graph = tesseract_urdf::parseURDFString(
+        urdf_string, *resource_locator_, init_threads_, init_load_visuals_, init_defer_collision_meshes_);
   }
   catch (const std::exception& e)
   {
@@ -166,7 +413,8 @@ bool Environment::init(const tesseract_common::fs::path& urdf_path,
   tesseract_scene_graph::SceneGraph::Ptr scene_graph;
   try
   {
-    scene_graph = tesseract_urdf::parseURDFFile(urdf_path.string(), *resource_locator_);
+    scene_graph = tesseract_urdf::parseURDFFile(
+        urdf_path.string(), *resource_locator_, init_threads_, init_load_visuals_, init_defer_collision_meshes_);
   }
   catch (const std::exception& e)
   {
@@ -189,7 +437,8 @@ bool Environment::init(const tesseract_common::fs::path& urdf_path,
   tesseract_scene_graph::SceneGraph::Ptr scene_graph;
   try
   {
-    scene_graph = tesseract_urdf::parseURDFFile(urdf_path.string(), *resource_locator_);
+    scene_graph = tesseract_urdf::parseURDFFile(
+        urdf_path.string(), *resource_locator_, init_threads_, init_load_visuals_, init_defer_collision_meshes_);
   }
   catch (const std::exception& e)
   {
@@ -248,9 +497,24 @@ void Environment::clear()
   scene_graph_ = nullptr;
   scene_graph_const_ = nullptr;
   state_solver_ = nullptr;
+  state_stream_link_names_.clear();
+  state_stream_joint_names_.clear();
+  compiled_acm_ = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>();
   commands_.clear();
   kinematics_information_.clear();
+  active_collision_objects_profiles_ = std::make_shared<const tesseract_collision::ActiveCollisionObjectsProfiles>();
   collision_margin_data_ = tesseract_collision::CollisionMarginData();
+
+  {  // The revisions start over, so the distance field of the static links must be built again
+    std::lock_guard<std::mutex> field_lock(static_distance_field_mutex_);
+    static_distance_field_ = nullptr;
+    static_distance_field_revision_ = -1;
+  }
+
+  // The solvers are kept by revision as well
+  kinematics_factory_.clearSolverCache();
+  fixed_link_transforms_.clear();
+  clearTransformCaches();
 }
 
 Commands Environment::getInitCommands(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -312,8 +576,40 @@ Commands Environment::getCommandHistory() const
   return commands_;
 }
 
+bool Environment::compactCommandHistory()
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!initialized_)
+      return false;
+
+    // The checkpoint initializes an environment equal to this one, the scene graph holds the links, joints, allowed
+    // collisions, calibrated origins and limits while the remaining commands restore what is stored outside of it
+    Commands checkpoint;
+    checkpoint.push_back(std::make_shared<AddSceneGraphCommand>(*scene_graph_));
+    checkpoint.push_back(std::make_shared<AddContactManagersPluginInfoCommand>(contact_managers_plugin_info_));
+    checkpoint.push_back(std::make_shared<AddKinematicsInformationCommand>(kinematics_information_));
+    checkpoint.push_back(std::make_shared<ChangeCollisionMarginsCommand>(
+        collision_margin_data_, tesseract_common::CollisionMarginOverrideType::REPLACE));
+
+    if (checkpoint.size() >= commands_.size())
+      return true;
+
+    commands_ = std::move(checkpoint);
+    revision_ = static_cast<int>(commands_.size());
+    init_revision_ = revision_;
+    state_solver_->setRevision(revision_);
+  }
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  triggerEnvironmentChangedCallbacks();
+
+  return true;
+}
+
 bool Environment::applyCommands(const Commands& commands)
 {
+  TESSERACT_TRACE_ZONE("Environment::applyCommands");
   bool success{ false };
   {
     std::unique_lock<std::shared_mutex> lock(mutex_);
@@ -328,11 +624,194 @@ bool Environment::applyCommands(const Commands& commands)
 
 bool Environment::applyCommand(Command::ConstPtr command) { return applyCommands({ std::move(command) }); }
 
+bool Environment::applyDeferredCollisionGeometry(bool wait)
+{
+  std::vector<tesseract_scene_graph::Link::ConstPtr> links;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& link : scene_graph_->getLinks())
+    {
+      if (std::any_of(link->collision.begin(), link->collision.end(), [](const auto& c) {
+            return c->deferred_geometry.valid();
+          }))
+        links.push_back(link);
+    }
+  }
+
+  // The geometry is waited for without holding the lock
+  Commands commands;
+  for (const auto& link : links)
+  {
+    tesseract_scene_graph::Link new_link = link->clone();
+    new_link.collision.clear();
+
+    bool replaced{ false };
+    for (const auto& collision : link->collision)
+    {
+      if (!collision->deferred_geometry.valid())
+      {
+        new_link.collision.push_back(collision);
+        continue;
+      }
+
+      if (!wait && collision->deferred_geometry.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      {
+        new_link.collision.push_back(collision);
+        continue;
+      }
+
+      replaced = true;
+      try
+      {
+        const std::vector<tesseract_scene_graph::Collision::Ptr>& loaded = collision->deferred_geometry.get();
+        new_link.collision.insert(new_link.collision.end(), loaded.begin(), loaded.end());
+      }
+      catch (const std::exception& e)
+      {
+        CONSOLE_BRIDGE_logError("Failed to load the collision geometry of link '%s', keeping its stand-in: %s",
+                                link->getName().c_str(),
+                                e.what());
+        auto stand_in = std::make_shared<tesseract_scene_graph::Collision>(*collision);
+        stand_in->deferred_geometry = {};
+        new_link.collision.push_back(stand_in);
+      }
+    }
+
+    if (replaced)
+      commands.push_back(std::make_shared<AddLinkCommand>(new_link, true));
+  }
+
+  if (commands.empty())
+    return true;
+
+  return applyCommands(commands);
+}
+
+bool Environment::hasDeferredCollisionGeometry() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  for (const auto& link : scene_graph_->getLinks())
+  {
+    for (const auto& collision : link->collision)
+    {
+      if (collision->deferred_geometry.valid())
+        return true;
+    }
+  }
+
+  return false;
+}
+
+tesseract_common::MemoryUsage Environment::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  tesseract_common::MemoryUsage usage("environment " + (scene_graph_ != nullptr ? scene_graph_->getName() : ""));
+  usage.unique_bytes = sizeof(Environment);
+
+  if (scene_graph_ != nullptr)
+    usage.children.push_back(scene_graph_->getMemoryUsage(tracker));
+
+  {
+    // The links of the commands are usually shared with the scene graph, so only the geometry not used by it is added
+    tesseract_common::MemoryUsage& commands_usage = usage.addChild("commands");
+    commands_usage.unique_bytes = tesseract_common::getVectorBytes(commands_);
+    for (const auto& command : commands_)
+    {
+      if (!tracker.count(commands_usage, command, sizeof(Command)) || command->getType() != CommandType::ADD_LINK)
+        continue;
+
+      const auto& link = std::static_pointer_cast<const AddLinkCommand>(command)->getLink();
+      if (link == nullptr || !tracker.visit(link.get()))
+        continue;
+
+      for (const auto& visual : link->visual)
+        commands_usage.children.push_back(visual->geometry->getMemoryUsage(tracker));
+      for (const auto& collision : link->collision)
+        commands_usage.children.push_back(collision->geometry->getMemoryUsage(tracker));
+    }
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> manager_lock(discrete_manager_mutex_);
+    if (discrete_manager_ != nullptr)
+      usage.children.push_back(discrete_manager_->getMemoryUsage(tracker));
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> manager_lock(continuous_manager_mutex_);
+    if (continuous_manager_ != nullptr)
+      usage.children.push_back(continuous_manager_->getMemoryUsage(tracker));
+  }
+
+  {
+    std::lock_guard<std::mutex> field_lock(static_distance_field_mutex_);
+    if (static_distance_field_ != nullptr)
+      tracker.count(usage.addChild("static_distance_field"),
+                    static_distance_field_,
+                    static_distance_field_->getMemoryUsage());
+  }
+
+  // The groups are estimated by their joint limits, the solvers are not sized
+  tesseract_common::MemoryUsage& kinematics_usage = usage.addChild("kinematics_cache");
+  {
+    std::shared_lock<std::shared_mutex> cache_lock(group_joint_names_cache_mutex_);
+    for (const auto& group : group_joint_names_cache_)
+      kinematics_usage.unique_bytes += group.first.capacity() + tesseract_common::getVectorBytes(group.second);
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> cache_lock(joint_group_cache_mutex_);
+    for (const auto& group : joint_group_cache_)
+      tracker.count(kinematics_usage,
+                    group.second,
+                    sizeof(tesseract_kinematics::JointGroup) +
+                        (static_cast<std::size_t>(group.second->numJoints()) * 4 * sizeof(double)));
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> cache_lock(kinematic_group_cache_mutex_);
+    for (const auto& group : kinematic_group_cache_)
+      tracker.count(kinematics_usage,
+                    group.second,
+                    sizeof(tesseract_kinematics::KinematicGroup) +
+                        (static_cast<std::size_t>(group.second->numJoints()) * 4 * sizeof(double)));
+  }
+
+  return usage;
+}
+
+tesseract_common::MemoryUsage Environment::getMemoryUsage() const
+{
+  tesseract_common::MemoryUsageTracker tracker;
+  return getMemoryUsage(tracker);
+}
+
+bool Environment::applyCommandsBatch(const Commands& commands)
+{
+  TESSERACT_TRACE_ZONE("Environment::applyCommandsBatch");
+  bool success{ false };
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    batch_ = true;
+    success = applyCommandsHelper(commands);
+  }
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  triggerEnvironmentChangedCallbacks();
+  triggerCurrentStateChangedCallbacks();
+
+  return success;
+}
+
 tesseract_scene_graph::SceneGraph::ConstPtr Environment::getSceneGraph() const { return scene_graph_const_; }
 
 std::vector<std::string> Environment::getGroupJointNames(const std::string& group_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
+  return getGroupJointNamesHelper(group_name);
+}
+
+std::vector<std::string> Environment::getGroupJointNamesHelper(const std::string& group_name) const
+{
   auto it =
       std::find(kinematics_information_.group_names.begin(), kinematics_information_.group_names.end(), group_name);
 
@@ -391,7 +870,7 @@ tesseract_kinematics::JointGroup::UPtr Environment::getJointGroup(const std::str
   // Store copy in cache and return
   std::vector<std::string> joint_names = getGroupJointNames(group_name);
   tesseract_kinematics::JointGroup::UPtr jg = getJointGroup(group_name, joint_names);
-  joint_group_cache_[group_name] = std::make_unique<tesseract_kinematics::JointGroup>(*jg);
+  joint_group_cache_[group_name] = std::make_shared<const tesseract_kinematics::JointGroup>(*jg);
 
   return jg;
 }
@@ -400,7 +879,8 @@ tesseract_kinematics::JointGroup::UPtr Environment::getJointGroup(const std::str
                                                                   const std::vector<std::string>& joint_names) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::make_unique<tesseract_kinematics::JointGroup>(name, joint_names, *scene_graph_const_, current_state_);
+  return std::make_unique<tesseract_kinematics::JointGroup>(
+      name, joint_names, *scene_graph_const_, current_state_->state);
 }
 
 tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const std::string& group_name,
@@ -425,8 +905,9 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
   if (ik_solver_name.empty())
     ik_solver_name = kinematics_factory_.getDefaultInvKinPlugin(group_name);
 
-  tesseract_kinematics::InverseKinematics::UPtr inv_kin =
-      kinematics_factory_.createInvKin(group_name, ik_solver_name, *scene_graph_const_, current_state_);
+  // The groups are created again whenever the state changes, so the factory reuses the solver of this revision
+  tesseract_kinematics::InverseKinematics::UPtr inv_kin = kinematics_factory_.createInvKin(
+      group_name, ik_solver_name, *scene_graph_const_, current_state_->state, revision_);
 
   // TODO add error message
   if (inv_kin == nullptr)
@@ -434,9 +915,9 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
 
   // Store copy in cache and return
   auto kg = std::make_unique<tesseract_kinematics::KinematicGroup>(
-      group_name, joint_names, std::move(inv_kin), *scene_graph_const_, current_state_);
+      group_name, joint_names, std::move(inv_kin), *scene_graph_const_, current_state_->state);
 
-  kinematic_group_cache_[key] = std::make_unique<tesseract_kinematics::KinematicGroup>(*kg);
+  kinematic_group_cache_[key] = std::make_shared<const tesseract_kinematics::KinematicGroup>(*kg);
 
 #ifndef NDEBUG
   if (!tesseract_kinematics::checkKinematics(*kg))
@@ -449,6 +930,25 @@ tesseract_kinematics::KinematicGroup::UPtr Environment::getKinematicGroup(const
   return kg;
 }
 
+PooledJointGroup Environment::checkoutJointGroup(const std::string& group_name) const
+{
+  // Read the generation before copying so a change made while copying is detected by the next check out
+  const std::size_t generation = kinematics_generation_.load();
+  return checkoutGroupHelper<tesseract_kinematics::JointGroup>(
+      pool_token_, group_name, "", generation, [this, &group_name]() { return getJointGroup(group_name); });
+}
+
+PooledKinematicGroup Environment::checkoutKinematicGroup(const std::string& group_name,
+                                                         const std::string& ik_solver_name) const
+{
+  // Read the generation before copying so a change made while copying is detected by the next check out
+  const std::size_t generation = kinematics_generation_.load();
+  return checkoutGroupHelper<tesseract_kinematics::KinematicGroup>(
+      pool_token_, group_name, ik_solver_name, generation, [this, &group_name, &ik_solver_name]() {
+        return getKinematicGroup(group_name, ik_solver_name);
+      });
+}
+
 // NOLINTNEXTLINE
 Eigen::Isometry3d Environment::findTCPOffset(const tesseract_common::ManipulatorInfo& manip_info) const
 {
@@ -464,17 +964,29 @@ Eigen::Isometry3d Environment::findTCPOffset(const tesseract_common::Manipulator
     throw std::runtime_error("The tcp offset name '" + tcp_offset_name +
                              "' should not be an existing link in the scene. Assign it as the tcp_frame instead!");
 
-  // Check Manipulator Manager for TCP
+  const std::string key = getTCPOffsetKey(manip_info);
+  {
+    std::shared_lock<std::shared_mutex> cache_lock(transform_cache_mutex_);
+    auto it = tcp_offset_cache_.find(key);
+    if (it != tcp_offset_cache_.end())
+      return it->second;
+  }
+
+  // Check Manipulator Manager for TCP, then the callbacks for TCP Offset
+  Eigen::Isometry3d tcp{ Eigen::Isometry3d::Identity() };
+  bool found{ false };
   if (kinematics_information_.hasGroupTCP(manip_info.manipulator, tcp_offset_name))
-    return kinematics_information_.group_tcps.at(manip_info.manipulator).at(tcp_offset_name);
+  {
+    tcp = kinematics_information_.group_tcps.at(manip_info.manipulator).at(tcp_offset_name);
+    found = true;
+  }
 
-  // Check callbacks for TCP Offset
-  for (const auto& fn : find_tcp_cb_)
+  for (auto it = find_tcp_cb_.begin(); !found && it != find_tcp_cb_.end(); ++it)
   {
     try
     {
-      Eigen::Isometry3d tcp = fn(manip_info);
-      return tcp;
+      tcp = (*it)(manip_info);
+      found = true;
     }
     catch (...)
     {
@@ -482,13 +994,21 @@ Eigen::Isometry3d Environment::findTCPOffset(const tesseract_common::Manipulator
     }
   }
 
-  throw std::runtime_error("Could not find tcp by name " + tcp_offset_name + "'!");
+  if (!found)
+    throw std::runtime_error("Could not find tcp by name " + tcp_offset_name + "'!");
+
+  std::unique_lock<std::shared_mutex> cache_lock(transform_cache_mutex_);
+  tcp_offset_cache_[key] = tcp;
+  return tcp;
 }
 
 void Environment::addFindTCPOffsetCallback(const FindTCPOffsetCallbackFn& fn)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   find_tcp_cb_.push_back(fn);
+
+  // A new callback may find offsets which were not found before
+  clearTransformCaches();
 }
 
 std::vector<FindTCPOffsetCallbackFn> Environment::getFindTCPOffsetCallbacks() const
@@ -503,16 +1023,44 @@ void Environment::addEventCallback(std::size_t hash, const EventCallbackFn& fn)
   event_cb_[hash] = fn;
 }
 
+void Environment::addAsyncEventCallback(std::size_t hash, const EventCallbackFn& fn)
+{
+  event_dispatcher_.addCallback(hash, fn);
+}
+
+void Environment::waitForAsyncEvents() const { event_dispatcher_.wait(); }
+
 void Environment::removeEventCallback(std::size_t hash)
 {
-  std::unique_lock<std::shared_mutex> lock(mutex_);
-  event_cb_.erase(hash);
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    event_cb_.erase(hash);
+  }
+
+  // Not locked, the asynchronous callback in progress may access the environment while it is waited for
+  event_dispatcher_.removeCallback(hash);
 }
 
 void Environment::clearEventCallbacks()
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    event_cb_.clear();
+  }
+
+  event_dispatcher_.clear();
+}
+
+void Environment::setQueryRecorder(QueryRecorder::Ptr recorder)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  event_cb_.clear();
+  query_recorder_ = std::move(recorder);
+}
+
+QueryRecorder::Ptr Environment::getQueryRecorder() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return query_recorder_;
 }
 
 std::map<std::size_t, EventCallbackFn> Environment::getEventCallbacks() const
@@ -533,9 +1081,46 @@ tesseract_common::ResourceLocator::ConstPtr Environment::getResourceLocator() co
   return resource_locator_;
 }
 
+void Environment::setInitThreads(std::size_t threads)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  init_threads_ = std::max<std::size_t>(threads, 1);
+}
+
+std::size_t Environment::getInitThreads() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return init_threads_;
+}
+
+void Environment::setInitLoadVisuals(bool load_visuals)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  init_load_visuals_ = load_visuals;
+}
+
+bool Environment::getInitLoadVisuals() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return init_load_visuals_;
+}
+
+void Environment::setInitDeferCollisionMeshes(bool defer_collision_meshes)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  init_defer_collision_meshes_ = defer_collision_meshes;
+}
+
+bool Environment::getInitDeferCollisionMeshes() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return init_defer_collision_meshes_;
+}
+
 void Environment::setName(const std::string& name)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  copySceneGraphOnWrite();
   scene_graph_->setName(name);
 }
 
@@ -547,10 +1132,13 @@ const std::string& Environment::getName() const
 
 void Environment::setState(const std::unordered_map<std::string, double>& joints)
 {
+  TESSERACT_TRACE_ZONE("Environment::setState");
   {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     state_solver_->setState(joints);
     currentStateChanged();
+    if (query_recorder_ != nullptr)
+      query_recorder_->recordSetState(revision_, joints);
   }
 
   std::shared_lock<std::shared_mutex> lock;
@@ -560,16 +1148,141 @@ void Environment::setState(const std::unordered_map<std::string, double>& joints
 void Environment::setState(const std::vector<std::string>& joint_names,
                            const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("Environment::setState");
   {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     state_solver_->setState(joint_names, joint_values);
     currentStateChanged();
+    if (query_recorder_ != nullptr)
+      query_recorder_->recordSetState(revision_, joint_names, joint_values);
   }
 
   std::shared_lock<std::shared_mutex> lock;
   triggerCurrentStateChangedCallbacks();
 }
 
+std::size_t Environment::registerStateStream(const std::vector<std::string>& joint_names)
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& joint_name : joint_names)
+    {
+      if (scene_graph_ == nullptr || scene_graph_->getJoint(joint_name) == nullptr)
+        throw std::runtime_error("Environment, Joint '" + joint_name + "' of the state stream does not exist!");
+    }
+  }
+
+  std::scoped_lock<std::mutex> streams_lock(state_streams_mutex_);
+  StateStream stream;
+  stream.joint_names = joint_names;
+  stream.joint_values.resize(static_cast<Eigen::Index>(joint_names.size()));
+  state_streams_.push_back(std::move(stream));
+  return state_streams_.size() - 1;
+}
+
+void Environment::setStreamState(std::size_t stream_id, const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+{
+  std::scoped_lock<std::mutex> streams_lock(state_streams_mutex_);
+  if (stream_id >= state_streams_.size())
+    throw std::runtime_error("Environment, State stream does not exist!");
+
+  StateStream& stream = state_streams_[stream_id];
+  if (joint_values.size() != stream.joint_values.size())
+    throw std::runtime_error("Environment, The joint values do not match the joints of the state stream!");
+
+  stream.joint_values = joint_values;
+  stream.pending = true;
+}
+
+bool Environment::flushStateStreams()
+{
+  std::vector<std::string> changed_link_names;
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!initialized_)
+      return false;
+
+    auto* state_solver = dynamic_cast<tesseract_scene_graph::OFKTStateSolver*>(state_solver_.get());
+    if (state_solver == nullptr)
+      throw std::runtime_error("Environment, State streams require the OFKT state solver!");
+
+    std::vector<long> joint_indices;
+    std::vector<double> joint_values;
+    {
+      std::scoped_lock<std::mutex> streams_lock(state_streams_mutex_);
+      if (state_stream_link_names_.empty())
+      {
+        // The environment changed since the last flush, so the joints of the streams are resolved again
+        const tesseract_scene_graph::OFKTStateSnapshot::ConstPtr snapshot = state_solver->getSnapshot();
+        state_stream_link_names_ = snapshot->getCompiledTree().link_names;
+        state_stream_joint_names_ = snapshot->getCompiledTree().joint_names;
+        for (auto& stream : state_streams_)
+          stream.joint_indices.clear();
+      }
+
+      // Only the latest values of each stream are applied, all streams in a single update
+      for (auto& stream : state_streams_)
+      {
+        if (!stream.pending)
+          continue;
+
+        if (stream.joint_indices.size() != stream.joint_names.size())
+          stream.joint_indices = state_solver->getJointIndices(stream.joint_names);
+
+        joint_indices.insert(joint_indices.end(), stream.joint_indices.begin(), stream.joint_indices.end());
+        joint_values.insert(
+            joint_values.end(), stream.joint_values.data(), stream.joint_values.data() + stream.joint_values.size());
+        stream.pending = false;
+      }
+    }
+
+    if (joint_indices.empty())
+      return false;
+
+    // The current state is updated for the links that moved instead of being copied from the state solver, in a copy
+    // of the snapshot because it may be read concurrently
+    auto current_state = std::make_shared<CurrentState>(*current_state_);
+    tesseract_common::TransformMap changed_link_transforms;
+    auto changed_fn = [this, &current_state, &changed_link_names, &changed_link_transforms](
+                          long link_index, const Eigen::Isometry3d& link_transform, double joint_value) {
+      const auto idx = static_cast<std::size_t>(link_index);
+      const std::string& link_name = state_stream_link_names_[idx];
+      const std::string& joint_name = state_stream_joint_names_[idx];
+      current_state->state.link_transforms[link_name] = link_transform;
+      current_state->state.joint_transforms[joint_name] = link_transform;
+      auto joint_it = current_state->state.joints.find(joint_name);
+      if (joint_it != current_state->state.joints.end())
+        joint_it->second = joint_value;
+
+      changed_link_transforms[link_name] = link_transform;
+      changed_link_names.push_back(link_name);
+    };
+
+    state_solver->setState(
+        joint_indices,
+        Eigen::Map<const Eigen::VectorXd>(joint_values.data(), static_cast<Eigen::Index>(joint_values.size())),
+        changed_fn);
+
+    if (changed_link_names.empty())
+      return false;
+
+    std::atomic_store(&current_state_, std::shared_ptr<const CurrentState>(std::move(current_state)));
+    currentStateStreamed(changed_link_transforms);
+  }
+
+  std::shared_lock<std::shared_mutex> lock;
+  if (!event_cb_.empty())
+  {
+    LinkTransformsChangedEvent event(changed_link_names);
+    for (const auto& cb : event_cb_)
+      cb.second(event);
+  }
+
+  event_dispatcher_.linkTransformsChanged(changed_link_names);
+
+  return true;
+}
+
 tesseract_scene_graph::SceneState Environment::getState(const std::unordered_map<std::string, double>& joints) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -583,10 +1296,12 @@ tesseract_scene_graph::SceneState Environment::getState(const std::vector<std::s
   return state_solver_->getState(joint_names, joint_values);
 }
 
-tesseract_scene_graph::SceneState Environment::getState() const
+tesseract_scene_graph::SceneState Environment::getState() const { return std::atomic_load(&current_state_)->state; }
+
+std::shared_ptr<const tesseract_scene_graph::SceneState> Environment::getStateSnapshot() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return current_state_;
+  std::shared_ptr<const CurrentState> current_state = std::atomic_load(&current_state_);
+  return { current_state, &current_state->state };
 }
 
 std::chrono::system_clock::time_point Environment::getTimestamp() const
@@ -632,6 +1347,12 @@ tesseract_common::AllowedCollisionMatrix::ConstPtr Environment::getAllowedCollis
   return scene_graph_->getAllowedCollisionMatrix();
 }
 
+tesseract_common::CompiledAllowedCollisionMatrix::ConstPtr Environment::getCompiledAllowedCollisionMatrix() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return compiled_acm_;
+}
+
 std::vector<std::string> Environment::getJointNames() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -652,23 +1373,23 @@ tesseract_scene_graph::Joint::ConstPtr Environment::getJoint(const std::string&
 
 Eigen::VectorXd Environment::getCurrentJointValues() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
+  std::shared_ptr<const CurrentState> current_state = std::atomic_load(&current_state_);
+  const std::vector<std::string>& active_joint_names = *current_state->active_joint_names;
   Eigen::VectorXd jv;
-  std::vector<std::string> active_joint_names = state_solver_->getActiveJointNames();
   jv.resize(static_cast<long int>(active_joint_names.size()));
   for (auto j = 0U; j < active_joint_names.size(); ++j)
-    jv(j) = current_state_.joints.at(active_joint_names[j]);
+    jv(j) = current_state->state.joints.at(active_joint_names[j]);
 
   return jv;
 }
 
 Eigen::VectorXd Environment::getCurrentJointValues(const std::vector<std::string>& joint_names) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
+  std::shared_ptr<const CurrentState> current_state = std::atomic_load(&current_state_);
   Eigen::VectorXd jv;
   jv.resize(static_cast<long int>(joint_names.size()));
   for (auto j = 0U; j < joint_names.size(); ++j)
-    jv(j) = current_state_.joints.at(joint_names[j]);
+    jv(j) = current_state->state.joints.at(joint_names[j]);
 
   return jv;
 }
@@ -739,7 +1460,24 @@ Eigen::Isometry3d Environment::getRelativeLinkTransform(const std::string& from_
                                                         const std::string& to_link_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return state_solver_->getRelativeLinkTransform(from_link_name, to_link_name);
+  auto from_it = fixed_link_transforms_.find(from_link_name);
+  auto to_it = fixed_link_transforms_.find(to_link_name);
+  if (from_it != fixed_link_transforms_.end() && to_it != fixed_link_transforms_.end() &&
+      from_it->second.first == to_it->second.first)
+    return from_it->second.second.inverse() * to_it->second.second;
+
+  auto key = std::make_pair(from_link_name, to_link_name);
+  {
+    std::shared_lock<std::shared_mutex> cache_lock(transform_cache_mutex_);
+    auto it = relative_link_transform_cache_.find(key);
+    if (it != relative_link_transform_cache_.end())
+      return it->second;
+  }
+
+  Eigen::Isometry3d transform = state_solver_->getRelativeLinkTransform(from_link_name, to_link_name);
+  std::unique_lock<std::shared_mutex> cache_lock(transform_cache_mutex_);
+  relative_link_transform_cache_.emplace(std::move(key), transform);
+  return transform;
 }
 
 tesseract_scene_graph::StateSolver::UPtr Environment::getStateSolver() const
@@ -775,6 +1513,7 @@ bool Environment::setActiveDiscreteContactManager(const std::string& name)
 
 tesseract_collision::DiscreteContactManager::UPtr Environment::getDiscreteContactManager(const std::string& name) const
 {
+  TESSERACT_TRACE_ZONE("Environment::getDiscreteContactManager");
   std::shared_lock<std::shared_mutex> lock(mutex_);
   tesseract_collision::DiscreteContactManager::UPtr manager = getDiscreteContactManagerHelper(name);
   if (manager == nullptr)
@@ -795,55 +1534,234 @@ bool Environment::setActiveContinuousContactManager(const std::string& name)
 
 tesseract_collision::DiscreteContactManager::UPtr Environment::getDiscreteContactManager() const
 {
+  TESSERACT_TRACE_ZONE("Environment::getDiscreteContactManager");
   std::shared_lock<std::shared_mutex> lock(mutex_);
+  tesseract_collision::DiscreteContactManager::UPtr manager;
   {  // Clone cached manager if exists
     std::shared_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
     if (discrete_manager_)
-      return discrete_manager_->clone();
+      manager = discrete_manager_->clone();
   }
 
-  {  // Try to create the default plugin
+  if (manager == nullptr)
+  {
+    // Try to create the default plugin
     std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
-    const std::string& name = contact_managers_plugin_info_.discrete_plugin_infos.default_plugin;
-    discrete_manager_ = getDiscreteContactManagerHelper(name);
-    if (discrete_manager_ == nullptr)
-    {
-      CONSOLE_BRIDGE_logError("Discrete manager with %s does not exist in factory!", name.c_str());
+    if (!createDiscreteContactManagerHelper())
       return nullptr;
+
+    manager = discrete_manager_->clone();
+  }
+
+  auto field = getStaticDistanceFieldHelper();
+  if (field == nullptr)
+    return manager;
+
+  // The filter only knows the transforms set through it, so it starts from the current state
+  auto filtered = std::make_unique<tesseract_collision::tesseract_collision_sdf::DistanceFieldFilteredDiscreteManager>(
+      std::move(manager), std::move(field));
+  filtered->setCollisionObjectsTransform(current_state_->state.link_transforms);
+  return filtered;
+}
+
+bool Environment::createDiscreteContactManagerHelper() const
+{
+  // Another thread may have created it while waiting for the lock
+  if (discrete_manager_ != nullptr)
+    return true;
+
+  const std::string& name = contact_managers_plugin_info_.discrete_plugin_infos.default_plugin;
+  discrete_manager_ = getDiscreteContactManagerHelper(name);
+  if (discrete_manager_ == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Discrete manager with %s does not exist in factory!", name.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+PooledDiscreteContactManager Environment::checkoutDiscreteContactManager() const
+{
+  // Read the generation before copying so a change made while copying is detected by the next check out
+  const std::size_t generation = discrete_manager_generation_.load();
+  std::vector<std::shared_ptr<DiscreteContactManagerPoolEntry>>& pool = getDiscreteContactManagerPool();
+
+  std::shared_ptr<DiscreteContactManagerPoolEntry> entry;
+  for (const auto& e : pool)
+  {
+    if (!e->owner.owner_before(pool_token_) && !pool_token_.owner_before(e->owner))
+    {
+      entry = e;
+      break;
     }
   }
 
-  return discrete_manager_->clone();
+  if (entry == nullptr)
+  {
+    // Drop the managers of destroyed environments, entries in use are kept until their manager is returned
+    pool.erase(std::remove_if(pool.begin(),
+                              pool.end(),
+                              [](const std::shared_ptr<DiscreteContactManagerPoolEntry>& e) {
+                                return !e->checked_out && e->owner.expired();
+                              }),
+               pool.end());
+
+    entry = std::make_shared<DiscreteContactManagerPoolEntry>();
+    entry->owner = pool_token_;
+    pool.push_back(entry);
+  }
+
+  // The pooled manager is in use so return a copy which is not pooled
+  if (entry->checked_out)
+    return PooledDiscreteContactManager(getDiscreteContactManager().release());
+
+  if (entry->manager == nullptr || entry->generation != generation)
+  {
+    entry->manager = getDiscreteContactManager();
+    entry->generation = generation;
+    if (entry->manager == nullptr)
+      return nullptr;
+  }
+
+  entry->checked_out = true;
+  return { entry->manager.release(), PooledDiscreteContactManagerDeleter{ entry, generation, getPoolThreadId() } };
+}
+
+void Environment::clearCachedDiscreteContactManager() const
+{
+  std::shared_lock<std::shared_mutex> lock;
+  std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+  discrete_manager_ = nullptr;
+  ++discrete_manager_generation_;
+}
+
+tesseract_collision::ContinuousContactManager::UPtr Environment::getContinuousContactManager() const
+{
+  TESSERACT_TRACE_ZONE("Environment::getContinuousContactManager");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  tesseract_collision::ContinuousContactManager::UPtr manager;
+  {  // Clone cached manager if exists
+    std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+    if (continuous_manager_)
+      manager = continuous_manager_->clone();
+  }
+
+  if (manager == nullptr)
+  {
+    // Try to create the default plugin
+    std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+    if (!createContinuousContactManagerHelper())
+      return nullptr;
+
+    manager = continuous_manager_->clone();
+  }
+
+  auto field = getStaticDistanceFieldHelper();
+  if (field == nullptr)
+    return manager;
+
+  // The filter only knows the transforms set through it, so it starts from the current state
+  using tesseract_collision::tesseract_collision_sdf::DistanceFieldFilteredContinuousManager;
+  auto filtered = std::make_unique<DistanceFieldFilteredContinuousManager>(std::move(manager), std::move(field));
+  filtered->setCollisionObjectsTransform(current_state_->state.link_transforms);
+  return filtered;
+}
+
+bool Environment::createContinuousContactManagerHelper() const
+{
+  // Another thread may have created it while waiting for the lock
+  if (continuous_manager_ != nullptr)
+    return true;
+
+  const std::string& name = contact_managers_plugin_info_.continuous_plugin_infos.default_plugin;
+  continuous_manager_ = getContinuousContactManagerHelper(name);
+  if (continuous_manager_ == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Continuous manager with %s does not exist in factory!", name.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void Environment::setStaticDistanceFieldResolution(double resolution)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  std::lock_guard<std::mutex> field_lock(static_distance_field_mutex_);
+  static_distance_field_resolution_ = resolution;
+  static_distance_field_ = nullptr;
+  static_distance_field_revision_ = -1;
+}
+
+double Environment::getStaticDistanceFieldResolution() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return static_distance_field_resolution_;
 }
 
-void Environment::clearCachedDiscreteContactManager() const
+tesseract_collision::tesseract_collision_sdf::StaticDistanceField::ConstPtr Environment::getStaticDistanceField() const
 {
-  std::shared_lock<std::shared_mutex> lock;
-  std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
-  discrete_manager_ = nullptr;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return getStaticDistanceFieldHelper();
 }
 
-tesseract_collision::ContinuousContactManager::UPtr Environment::getContinuousContactManager() const
+tesseract_collision::tesseract_collision_sdf::StaticDistanceField::ConstPtr
+Environment::getStaticDistanceFieldHelper() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  {  // Clone cached manager if exists
-    std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
-    if (continuous_manager_)
-      return continuous_manager_->clone();
+  if (static_distance_field_resolution_ <= 0 || scene_graph_ == nullptr)
+    return nullptr;
+
+  std::lock_guard<std::mutex> field_lock(static_distance_field_mutex_);
+  if (static_distance_field_ != nullptr && static_distance_field_revision_ == revision_)
+    return static_distance_field_;
+
+  TESSERACT_TRACE_ZONE("Environment::getStaticDistanceField");
+  const std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
+  const std::unordered_set<std::string> active_links(active_link_names.begin(), active_link_names.end());
+  std::vector<tesseract_scene_graph::Link::ConstPtr> static_links;
+  for (const auto& link : scene_graph_->getLinks())
+  {
+    if (active_links.find(link->getName()) == active_links.end() &&
+        scene_graph_->getLinkCollisionEnabled(link->getName()))
+      static_links.push_back(link);
   }
 
-  {  // Try to create the default plugin
-    std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
-    const std::string& name = contact_managers_plugin_info_.continuous_plugin_infos.default_plugin;
-    continuous_manager_ = getContinuousContactManagerHelper(name);
-    if (continuous_manager_ == nullptr)
+  std::vector<std::string> names;
+  std::vector<tesseract_collision::CollisionShapesConst> shapes;
+  std::vector<tesseract_common::VectorIsometry3d> shape_poses;
+  getCollisionObjects(names, shapes, shape_poses, static_links);
+
+  tesseract_common::VectorIsometry3d poses;
+  poses.reserve(names.size());
+  for (const auto& name : names)
+    poses.push_back(current_state_->state.link_transforms.at(name));
+
+  static_distance_field_ = std::make_shared<const tesseract_collision::tesseract_collision_sdf::StaticDistanceField>(
+      names, shapes, shape_poses, poses, static_distance_field_resolution_);
+  static_distance_field_revision_ = revision_;
+  return static_distance_field_;
+}
+
+std::future<bool> Environment::prebuildContactManagers(bool discrete, bool continuous) const
+{
+  return std::async(std::launch::async, [this, discrete, continuous]() {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    bool success{ true };
+    if (discrete)
     {
-      CONSOLE_BRIDGE_logError("Continuous manager with %s does not exist in factory!", name.c_str());
-      return nullptr;
+      std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+      success &= createDiscreteContactManagerHelper();
+    }
+
+    if (continuous)
+    {
+      std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+      success &= createContinuousContactManagerHelper();
     }
-  }
 
-  return continuous_manager_->clone();
+    return success;
+  });
 }
 
 void Environment::clearCachedContinuousContactManager() const
@@ -898,7 +1816,7 @@ bool Environment::operator==(const Environment& rhs) const
       return equal;
   }
 
-  equal &= current_state_ == rhs.current_state_;
+  equal &= current_state_->state == rhs.current_state_->state;
   equal &= timestamp_ == rhs.timestamp_;
   equal &= current_state_timestamp_ == rhs.current_state_timestamp_;
 
@@ -912,8 +1830,8 @@ bool Environment::operator!=(const Environment& rhs) const { return !operator==(
 
 bool Environment::setActiveDiscreteContactManagerHelper(const std::string& name)
 {
-  tesseract_collision::DiscreteContactManager::UPtr manager = getDiscreteContactManagerHelper(name);
-  if (manager == nullptr)
+  tesseract_common::PluginInfoMap plugins = contact_managers_factory_.getDiscreteContactManagerPlugins();
+  if (plugins.find(name) == plugins.end())
   {
     std::string msg = "\n  Discrete manager with " + name + " does not exist in factory!\n";
     msg += "    Available Managers:\n";
@@ -926,17 +1844,20 @@ bool Environment::setActiveDiscreteContactManagerHelper(const std::string& name)
 
   contact_managers_plugin_info_.discrete_plugin_infos.default_plugin = name;
 
-  // The calling function should be locking discrete_manager_mutex_
-  discrete_manager_ = std::move(manager);
+  // The calling function should be locking discrete_manager_mutex_, the new manager is created on first use
+  if (discrete_manager_ != nullptr && discrete_manager_->getName() != name)
+  {
+    discrete_manager_ = nullptr;
+    ++discrete_manager_generation_;
+  }
 
   return true;
 }
 
 bool Environment::setActiveContinuousContactManagerHelper(const std::string& name)
 {
-  tesseract_collision::ContinuousContactManager::UPtr manager = getContinuousContactManagerHelper(name);
-
-  if (manager == nullptr)
+  tesseract_common::PluginInfoMap plugins = contact_managers_factory_.getContinuousContactManagerPlugins();
+  if (plugins.find(name) == plugins.end())
   {
     std::string msg = "\n  Continuous manager with " + name + " does not exist in factory!\n";
     msg += "    Available Managers:\n";
@@ -949,8 +1870,9 @@ bool Environment::setActiveContinuousContactManagerHelper(const std::string& nam
 
   contact_managers_plugin_info_.continuous_plugin_infos.default_plugin = name;
 
-  // The calling function should be locking continuous_manager_mutex_
-  continuous_manager_ = std::move(manager);
+  // The calling function should be locking continuous_manager_mutex_, the new manager is created on first use
+  if (continuous_manager_ != nullptr && continuous_manager_->getName() != name)
+    continuous_manager_ = nullptr;
 
   return true;
 }
@@ -966,23 +1888,27 @@ Environment::getDiscreteContactManagerHelper(const std::string& name) const
   manager->setIsContactAllowedFn(is_contact_allowed_fn_);
   if (scene_graph_ != nullptr)
   {
-    for (const auto& link : scene_graph_->getLinks())
+    std::vector<std::string> names;
+    std::vector<tesseract_collision::CollisionShapesConst> shapes;
+    std::vector<tesseract_common::VectorIsometry3d> shape_poses;
+    getCollisionObjects(names, shapes, shape_poses, scene_graph_->getLinks());
+    manager->addCollisionObjects(names, 0, shapes, shape_poses, true);
+
+    // The manager may be created after collision was disabled for a link
+    for (const auto& link_name : names)
     {
-      if (!link->collision.empty())
-      {
-        tesseract_collision::CollisionShapesConst shapes;
-        tesseract_common::VectorIsometry3d shape_poses;
-        getCollisionObject(shapes, shape_poses, *link);
-        manager->addCollisionObject(link->getName(), 0, shapes, shape_poses, true);
-      }
+      if (!scene_graph_->getLinkCollisionEnabled(link_name))
+        manager->disableCollisionObject(link_name);
     }
 
     manager->setActiveCollisionObjects(state_solver_->getActiveLinkNames());
   }
 
+  manager->setActiveCollisionObjectsProfiles(active_collision_objects_profiles_);
+
   manager->setCollisionMarginData(collision_margin_data_);
 
-  manager->setCollisionObjectsTransform(current_state_.link_transforms);
+  manager->setCollisionObjectsTransform(current_state_->state.link_transforms);
 
   return manager;
 }
@@ -999,24 +1925,28 @@ Environment::getContinuousContactManagerHelper(const std::string& name) const
   manager->setIsContactAllowedFn(is_contact_allowed_fn_);
   if (scene_graph_ != nullptr)
   {
-    for (const auto& link : scene_graph_->getLinks())
+    std::vector<std::string> names;
+    std::vector<tesseract_collision::CollisionShapesConst> shapes;
+    std::vector<tesseract_common::VectorIsometry3d> shape_poses;
+    getCollisionObjects(names, shapes, shape_poses, scene_graph_->getLinks());
+    manager->addCollisionObjects(names, 0, shapes, shape_poses, true);
+
+    // The manager may be created after collision was disabled for a link
+    for (const auto& link_name : names)
     {
-      if (!link->collision.empty())
-      {
-        tesseract_collision::CollisionShapesConst shapes;
-        tesseract_common::VectorIsometry3d shape_poses;
-        getCollisionObject(shapes, shape_poses, *link);
-        manager->addCollisionObject(link->getName(), 0, shapes, shape_poses, true);
-      }
+      if (!scene_graph_->getLinkCollisionEnabled(link_name))
+        manager->disableCollisionObject(link_name);
     }
 
     manager->setActiveCollisionObjects(state_solver_->getActiveLinkNames());
   }
 
+  manager->setActiveCollisionObjectsProfiles(active_collision_objects_profiles_);
+
   manager->setCollisionMarginData(collision_margin_data_);
 
   std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
-  for (const auto& tf : current_state_.link_transforms)
+  for (const auto& tf : current_state_->state.link_transforms)
   {
     if (std::find(active_link_names.begin(), active_link_names.end(), tf.first) != active_link_names.end())
       manager->setCollisionObjectsTransform(tf.first, tf.second, tf.second);
@@ -1038,21 +1968,44 @@ void Environment::getCollisionObject(tesseract_collision::CollisionShapesConst&
   }
 }
 
+void Environment::getCollisionObjects(std::vector<std::string>& names,
+                                      std::vector<tesseract_collision::CollisionShapesConst>& shapes,
+                                      std::vector<tesseract_common::VectorIsometry3d>& shape_poses,
+                                      const std::vector<tesseract_scene_graph::Link::ConstPtr>& links)
+{
+  for (const auto& link : links)
+  {
+    if (!link->collision.empty())
+    {
+      names.push_back(link->getName());
+      shapes.emplace_back();
+      shape_poses.emplace_back();
+      getCollisionObject(shapes.back(), shape_poses.back(), *link);
+    }
+  }
+}
+
 void Environment::currentStateChanged()
 {
   timestamp_ = std::chrono::system_clock::now();
   current_state_timestamp_ = timestamp_;
-  current_state_ = state_solver_->getState();
+  auto current_state = std::make_shared<CurrentState>();
+  current_state->state = state_solver_->getState();
+  current_state->active_joint_names = active_joint_names_;
+  std::atomic_store(&current_state_, std::shared_ptr<const CurrentState>(std::move(current_state)));
 
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
   if (discrete_manager_ != nullptr)
-    discrete_manager_->setCollisionObjectsTransform(current_state_.link_transforms);
+    discrete_manager_->setCollisionObjectsTransform(current_state_->state.link_transforms);
+
+  // Every change to the environment updates the state, which invalidates the pooled discrete contact managers
+  ++discrete_manager_generation_;
 
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
   if (continuous_manager_ != nullptr)
   {
     std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
-    for (const auto& tf : current_state_.link_transforms)
+    for (const auto& tf : current_state_->state.link_transforms)
     {
       if (std::find(active_link_names.begin(), active_link_names.end(), tf.first) != active_link_names.end())
         continuous_manager_->setCollisionObjectsTransform(tf.first, tf.second, tf.second);
@@ -1066,42 +2019,136 @@ void Environment::currentStateChanged()
     std::unique_lock<std::shared_mutex> kg_lock(kinematic_group_cache_mutex_);
     joint_group_cache_.clear();
     kinematic_group_cache_.clear();
+
+    // The groups are created from the current state, so the pooled groups are invalidated as well
+    ++kinematics_generation_;
+  }
+
+  clearTransformCaches();
+}
+
+void Environment::currentStateStreamed(const tesseract_common::TransformMap& link_transforms)
+{
+  timestamp_ = std::chrono::system_clock::now();
+  current_state_timestamp_ = timestamp_;
+
+  std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+  if (discrete_manager_ != nullptr)
+    discrete_manager_->setCollisionObjectsTransform(link_transforms);
+
+  ++discrete_manager_generation_;
+
+  // The links moved by a joint are active links
+  std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+  if (continuous_manager_ != nullptr)
+    continuous_manager_->setCollisionObjectsTransform(link_transforms, link_transforms);
+
+  {  // Clear JointGroup and KinematicGroup
+    std::unique_lock<std::shared_mutex> jg_lock(joint_group_cache_mutex_);
+    std::unique_lock<std::shared_mutex> kg_lock(kinematic_group_cache_mutex_);
+    joint_group_cache_.clear();
+    kinematic_group_cache_.clear();
+    ++kinematics_generation_;
   }
+
+  clearTransformCaches();
 }
 
 void Environment::environmentChanged()
 {
   timestamp_ = std::chrono::system_clock::now();
+
+  // The state solver indices of the state streams are resolved again on the next flush
+  state_stream_link_names_.clear();
+  state_stream_joint_names_.clear();
+
+  // Kept if unchanged, so the contact managers do not rebuild the pairs they filter from their broadphase
+  auto compiled_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(
+      *scene_graph_->getAllowedCollisionMatrix());
+  if (compiled_acm_ == nullptr || *compiled_acm != *compiled_acm_)
+    compiled_acm_ = std::move(compiled_acm);
+
   std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
 
+  // Shared by the snapshots of the current state until the next change
+  active_joint_names_ = std::make_shared<const std::vector<std::string>>(state_solver_->getActiveJointNames());
+
+  {  // Clear JointGroup, KinematicGroup and GroupJointNames cache
+    std::unique_lock<std::shared_mutex> jn_lock(group_joint_names_cache_mutex_);
+    group_joint_names_cache_.clear();
+  }
+
+  updateActiveCollisionObjectsProfiles();
+  updateFixedLinkTransforms();
+
   {
     std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
     if (discrete_manager_ != nullptr)
-      discrete_manager_->setActiveCollisionObjects(active_link_names);
+    {
+      tesseract_collision::updateActiveCollisionObjects(*discrete_manager_, active_link_names);
+      discrete_manager_->setActiveCollisionObjectsProfiles(active_collision_objects_profiles_);
+    }
   }
 
   {
     std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
     if (continuous_manager_ != nullptr)
-      continuous_manager_->setActiveCollisionObjects(active_link_names);
+    {
+      tesseract_collision::updateActiveCollisionObjects(*continuous_manager_, active_link_names);
+      continuous_manager_->setActiveCollisionObjectsProfiles(active_collision_objects_profiles_);
+    }
   }
 
-  {  // Clear JointGroup, KinematicGroup and GroupJointNames cache
-    std::unique_lock<std::shared_mutex> jn_lock(group_joint_names_cache_mutex_);
-    group_joint_names_cache_.clear();
+  currentStateChanged();
+}
+
+void Environment::updateFixedLinkTransforms()
+{
+  fixed_link_transforms_.clear();
+  for (const auto& link : scene_graph_const_->getLinks())
+    findFixedLinkTransform(fixed_link_transforms_, *scene_graph_const_, link->getName());
+}
+
+void Environment::clearTransformCaches() const
+{
+  std::unique_lock<std::shared_mutex> cache_lock(transform_cache_mutex_);
+  relative_link_transform_cache_.clear();
+  tcp_offset_cache_.clear();
+}
+
+void Environment::updateActiveCollisionObjectsProfiles()
+{
+  auto profiles = std::make_shared<tesseract_collision::ActiveCollisionObjectsProfiles>();
+  for (const auto& group_name : kinematics_information_.group_names)
+  {
+    try
+    {
+      std::vector<std::string> joint_names = getGroupJointNamesHelper(group_name);
+      (*profiles)[group_name] = std::make_shared<const tesseract_collision::ActiveCollisionObjectsProfile>(
+          scene_graph_const_->getJointChildrenNames(joint_names));
+    }
+    catch (const std::exception& e)
+    {
+      // Groups which are not supported, like link groups, do not have a profile
+      CONSOLE_BRIDGE_logDebug("Environment, group '%s' does not have an active collision objects profile: %s",
+                              group_name.c_str(),
+                              e.what());
+    }
   }
 
-  currentStateChanged();
+  active_collision_objects_profiles_ = std::move(profiles);
 }
 
 void Environment::triggerCurrentStateChangedCallbacks()
 {
   if (!event_cb_.empty())
   {
-    SceneStateChangedEvent event(current_state_);
+    SceneStateChangedEvent event(current_state_->state);
     for (const auto& cb : event_cb_)
       cb.second(event);
   }
+
+  event_dispatcher_.stateChanged(current_state_->state);
 }
 
 void Environment::triggerEnvironmentChangedCallbacks()
@@ -1112,6 +2159,8 @@ void Environment::triggerEnvironmentChangedCallbacks()
     for (const auto& cb : event_cb_)
       cb.second(event);
   }
+
+  event_dispatcher_.commandsApplied(commands_, revision_);
 }
 
 bool Environment::removeLinkHelper(const std::string& name)
@@ -1129,6 +2178,13 @@ bool Environment::removeLinkHelper(const std::string& name)
 
   scene_graph_->removeLink(name, true);
 
+  if (batch_)
+  {
+    batch_removed_links_.insert(name);
+    batch_removed_links_.insert(child_link_names.begin(), child_link_names.end());
+    return true;
+  }
+
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
   if (discrete_manager_ != nullptr)
@@ -1147,8 +2203,80 @@ bool Environment::removeLinkHelper(const std::string& name)
   return true;
 }
 
+void Environment::applyBatchChanges()
+{
+  batch_ = false;
+
+  if (batch_state_solver_changed_)
+  {
+    // The joints which still exist keep their values
+    auto state_solver = std::make_unique<tesseract_scene_graph::OFKTStateSolver>(*scene_graph_);
+    std::unordered_map<std::string, double> joints;
+    for (const auto& joint_name : state_solver->getActiveJointNames())
+    {
+      auto it = current_state_->state.joints.find(joint_name);
+      if (it != current_state_->state.joints.end())
+        joints[joint_name] = it->second;
+    }
+    state_solver->setState(joints);
+    state_solver_ = std::move(state_solver);
+    batch_state_solver_changed_ = false;
+  }
+
+  // Links removed and added again within the batch are removed first, so they get their latest geometry
+  std::vector<tesseract_scene_graph::Link::ConstPtr> added_links;
+  added_links.reserve(batch_added_links_.size());
+  for (const auto& link_name : batch_added_links_)
+  {
+    tesseract_scene_graph::Link::ConstPtr link = scene_graph_->getLink(link_name);
+    if (link != nullptr)
+      added_links.push_back(link);
+  }
+
+  std::vector<std::string> names;
+  std::vector<tesseract_collision::CollisionShapesConst> shapes;
+  std::vector<tesseract_common::VectorIsometry3d> shape_poses;
+  getCollisionObjects(names, shapes, shape_poses, added_links);
+
+  auto update_manager = [this, &names, &shapes, &shape_poses](auto& manager) {
+    for (const auto& link_name : batch_removed_links_)
+      manager.removeCollisionObject(link_name);
+
+    if (!names.empty())
+      manager.addCollisionObjects(names, 0, shapes, shape_poses, true);
+
+    for (const auto& link_name : batch_collision_enabled_links_)
+    {
+      if (scene_graph_->getLink(link_name) == nullptr)
+        continue;
+
+      if (scene_graph_->getLinkCollisionEnabled(link_name))
+        manager.enableCollisionObject(link_name);
+      else
+        manager.disableCollisionObject(link_name);
+    }
+  };
+
+  {
+    std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
+    if (discrete_manager_ != nullptr)
+      update_manager(*discrete_manager_);
+  }
+
+  {
+    std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
+    if (continuous_manager_ != nullptr)
+      update_manager(*continuous_manager_);
+  }
+
+  batch_removed_links_.clear();
+  batch_added_links_.clear();
+  batch_collision_enabled_links_.clear();
+}
+
 Environment::UPtr Environment::clone() const
 {
+  TESSERACT_TRACE_ZONE("Environment::clone");
   auto cloned_env = std::make_unique<Environment>();
 
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -1165,10 +2293,14 @@ Environment::UPtr Environment::clone() const
   cloned_env->init_revision_ = revision_;
   cloned_env->revision_ = revision_;
   cloned_env->commands_ = commands_;
-  cloned_env->scene_graph_ = scene_graph_->clone();
-  cloned_env->scene_graph_const_ = cloned_env->scene_graph_;
+
+  // The scene graph is shared until either environment changes it
+  cloned_env->scene_graph_ = scene_graph_;
+  cloned_env->scene_graph_const_ = scene_graph_const_;
+  cloned_env->scene_graph_token_ = scene_graph_token_;
   cloned_env->timestamp_ = timestamp_;
   cloned_env->current_state_ = current_state_;
+  cloned_env->active_joint_names_ = active_joint_names_;
   cloned_env->current_state_timestamp_ = current_state_timestamp_;
 
   // There is not dynamic pointer cast for std::unique_ptr
@@ -1182,22 +2314,18 @@ Environment::UPtr Environment::clone() const
   cloned_env->kinematics_factory_ = kinematics_factory_;
   cloned_env->find_tcp_cb_ = find_tcp_cb_;
   cloned_env->collision_margin_data_ = collision_margin_data_;
+  cloned_env->static_distance_field_resolution_ = static_distance_field_resolution_;
 
-  // Copy cache
-  cloned_env->joint_group_cache_.reserve(joint_group_cache_.size());
-  for (const auto& c : joint_group_cache_)
-    cloned_env->joint_group_cache_[c.first] = (std::make_unique<tesseract_kinematics::JointGroup>(*c.second));
-
-  for (const auto& c : kinematic_group_cache_)
-    cloned_env->kinematic_group_cache_[c.first] = (std::make_unique<tesseract_kinematics::KinematicGroup>(*c.second));
-
+  // The cached groups are never modified, only copied when requested, so they are shared
+  cloned_env->joint_group_cache_ = joint_group_cache_;
+  cloned_env->kinematic_group_cache_ = kinematic_group_cache_;
   cloned_env->group_joint_names_cache_ = group_joint_names_cache_;
+  cloned_env->active_collision_objects_profiles_ = active_collision_objects_profiles_;
+  cloned_env->fixed_link_transforms_ = fixed_link_transforms_;
 
-  // NOLINTNEXTLINE
-  cloned_env->is_contact_allowed_fn_ = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
-                                                 cloned_env->scene_graph_,
-                                                 std::placeholders::_1,
-                                                 std::placeholders::_2);
+  cloned_env->compiled_acm_ = compiled_acm_;
+  cloned_env->is_contact_allowed_fn_ =
+      tesseract_collision::CompiledAllowedCollisionMatrixFn{ &cloned_env->compiled_acm_ };
 
   if (discrete_manager_)
   {
@@ -1216,6 +2344,61 @@ Environment::UPtr Environment::clone() const
   return cloned_env;
 }
 
+void Environment::copySceneGraphOnWrite()
+{
+  // The token is only shared with clones, so a scene graph handed out by getSceneGraph does not cause a copy
+  if (scene_graph_token_.use_count() == 1)
+    return;
+
+  scene_graph_ = scene_graph_->clone();
+  scene_graph_const_ = scene_graph_;
+  scene_graph_token_ = std::make_shared<const int>(0);
+}
+
+bool Environment::update(const Environment::ConstPtr& source)
+{
+  if (source == nullptr || source.get() == this)
+    return false;
+
+  Commands commands;
+  std::unordered_map<std::string, double> joints;
+  {
+    std::shared_lock<std::shared_mutex> source_lock(source->mutex_);
+    if (!source->initialized_)
+      return false;
+
+    commands = source->commands_;
+    joints = source->current_state_->state.joints;
+  }
+
+  bool success{ false };
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    // A clone shares the commands of the source, so the commands it is missing follow its own command history
+    const bool in_sync = initialized_ && commands_.size() <= commands.size() &&
+                         std::equal(commands_.begin(), commands_.end(), commands.begin());
+    if (!in_sync)
+      success = initHelper(commands);
+    else if (commands_.size() < commands.size())
+      success = applyCommandsHelper(Commands(commands.begin() + static_cast<long>(commands_.size()), commands.end()));
+    else
+      success = true;
+
+    if (success)
+    {
+      state_solver_->setState(joints);
+      currentStateChanged();
+    }
+  }
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  triggerEnvironmentChangedCallbacks();
+  triggerCurrentStateChangedCallbacks();
+
+  return success;
+}
+
 bool Environment::applyCommandsHelper(const Commands& commands)
 {
   bool success = true;
@@ -1227,6 +2410,9 @@ bool Environment::applyCommandsHelper(const Commands& commands)
       break;
     }
 
+    if (changesSceneGraph(command->getType()))
+      copySceneGraphOnWrite();
+
     switch (command->getType())
     {
       case tesseract_environment::CommandType::ADD_LINK:
@@ -1355,6 +2541,12 @@ bool Environment::applyCommandsHelper(const Commands& commands)
         success &= applySetActiveDiscreteContactManagerCommand(cmd);
         break;
       }
+      case tesseract_environment::CommandType::ATTACH_LINK:
+      {
+        auto cmd = std::static_pointer_cast<const AttachLinkCommand>(command);
+        success &= applyAttachLinkCommand(cmd);
+        break;
+      }
       // LCOV_EXCL_START
       default:
       {
@@ -1368,6 +2560,9 @@ bool Environment::applyCommandsHelper(const Commands& commands)
       break;
   }
 
+  if (batch_)
+    applyBatchChanges();
+
   // Update the solver revision to match environment
   state_solver_->setRevision(revision_);
 
@@ -1483,7 +2678,9 @@ bool Environment::applyAddCommand(AddLinkCommand::ConstPtr cmd)
       return false;
     }
 
-    if (!state_solver_->replaceJoint(*cmd->getJoint()))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->replaceJoint(*cmd->getJoint()))
       throw std::runtime_error("Environment, failed to replace link and joint in state solver.");
   }
   else if (!link_exists && !cmd->getJoint())
@@ -1500,7 +2697,9 @@ bool Environment::applyAddCommand(AddLinkCommand::ConstPtr cmd)
     if (!scene_graph_->addLink(*cmd->getLink(), *cmd->getJoint()))
       return false;
 
-    if (!state_solver_->addLink(*cmd->getLink(), *cmd->getJoint()))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->addLink(*cmd->getLink(), *cmd->getJoint()))
       throw std::runtime_error("Environment, failed to add link and joint in state solver.");
   }
   else
@@ -1508,12 +2707,22 @@ bool Environment::applyAddCommand(AddLinkCommand::ConstPtr cmd)
     if (!scene_graph_->addLink(*cmd->getLink(), *cmd->getJoint()))
       return false;
 
-    if (!state_solver_->addLink(*cmd->getLink(), *cmd->getJoint()))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->addLink(*cmd->getLink(), *cmd->getJoint()))
       throw std::runtime_error("Environment, failed to add link and joint in state solver.");
   }
 
+  if (batch_)
+  {
+    if (link_exists)
+      batch_removed_links_.insert(link_name);
+
+    batch_added_links_.insert(link_name);
+  }
+
   // If Link existed remove it from collision before adding the replacing links geometry
-  if (link_exists)
+  if (link_exists && !batch_)
   {
     std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
     if (discrete_manager_ != nullptr)
@@ -1525,7 +2734,7 @@ bool Environment::applyAddCommand(AddLinkCommand::ConstPtr cmd)
   }
 
   // We have moved the original objects, get a pointer to them from scene_graph
-  if (!cmd->getLink()->collision.empty())
+  if (!cmd->getLink()->collision.empty() && !batch_)
   {
     tesseract_collision::CollisionShapesConst shapes;
     tesseract_common::VectorIsometry3d shape_poses;
@@ -1551,7 +2760,9 @@ bool Environment::applyMoveLinkCommand(const MoveLinkCommand::ConstPtr& cmd)
   if (!scene_graph_->moveLink(*cmd->getJoint()))
     return false;
 
-  if (!state_solver_->moveLink(*cmd->getJoint()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->moveLink(*cmd->getJoint()))
     throw std::runtime_error("Environment, failed to move link in state solver.");
 
   ++revision_;
@@ -1565,7 +2776,9 @@ bool Environment::applyMoveJointCommand(const MoveJointCommand::ConstPtr& cmd)
   if (!scene_graph_->moveJoint(cmd->getJointName(), cmd->getParentLink()))
     return false;
 
-  if (!state_solver_->moveJoint(cmd->getJointName(), cmd->getParentLink()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->moveJoint(cmd->getJointName(), cmd->getParentLink()))
     throw std::runtime_error("Environment, failed to move joint in state solver.");
 
   ++revision_;
@@ -1579,7 +2792,9 @@ bool Environment::applyRemoveLinkCommand(const RemoveLinkCommand::ConstPtr& cmd)
   if (!removeLinkHelper(cmd->getLinkName()))
     return false;
 
-  if (!state_solver_->removeLink(cmd->getLinkName()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->removeLink(cmd->getLinkName()))
     throw std::runtime_error("Environment, failed to remove link in state solver.");
 
   ++revision_;
@@ -1601,7 +2816,9 @@ bool Environment::applyRemoveJointCommand(const RemoveJointCommand::ConstPtr& cm
   if (!removeLinkHelper(target_link_name))
     return false;
 
-  if (!state_solver_->removeJoint(cmd->getJointName()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->removeJoint(cmd->getJointName()))
     throw std::runtime_error("Environment, failed to remove joint in state solver.");
 
   ++revision_;
@@ -1638,7 +2855,9 @@ bool Environment::applyReplaceJointCommand(const ReplaceJointCommand::ConstPtr&
     return false;
   }
 
-  if (!state_solver_->replaceJoint(*cmd->getJoint()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->replaceJoint(*cmd->getJoint()))
     throw std::runtime_error("Environment, failed to replace joint in state solver.");
 
   ++revision_;
@@ -1647,6 +2866,72 @@ bool Environment::applyReplaceJointCommand(const ReplaceJointCommand::ConstPtr&
   return true;
 }
 
+bool Environment::applyAttachLinkCommand(const AttachLinkCommand::ConstPtr& cmd)
+{
+  const std::string& link_name = cmd->getLinkName();
+  const std::string& parent_link_name = cmd->getParentLinkName();
+  if (scene_graph_->getLink(link_name) == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to attach link (%s) that does not exist", link_name.c_str());
+    return false;
+  }
+
+  if (scene_graph_->getLink(parent_link_name) == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to attach link (%s) to parent link (%s) that does not exist",
+                           link_name.c_str(),
+                           parent_link_name.c_str());
+    return false;
+  }
+
+  std::vector<tesseract_scene_graph::Joint::ConstPtr> inbound_joints = scene_graph_->getInboundJoints(link_name);
+  if (inbound_joints.empty())
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to attach the root link (%s)", link_name.c_str());
+    return false;
+  }
+
+  std::vector<std::string> child_link_names = scene_graph_->getLinkChildrenNames(link_name);
+  if (parent_link_name == link_name ||
+      std::find(child_link_names.begin(), child_link_names.end(), parent_link_name) != child_link_names.end())
+  {
+    CONSOLE_BRIDGE_logWarn("Tried to attach link (%s) to itself or one of its children (%s)",
+                           link_name.c_str(),
+                           parent_link_name.c_str());
+    return false;
+  }
+
+  // The joint keeps its name, so the state solver re-parents its node instead of rebuilding it
+  const tesseract_scene_graph::Joint::ConstPtr current_joint = inbound_joints.front();
+  tesseract_scene_graph::Joint joint(current_joint->getName());
+  joint.type = tesseract_scene_graph::JointType::FIXED;
+  joint.parent_link_name = parent_link_name;
+  joint.child_link_name = link_name;
+  joint.parent_to_joint_origin_transform = cmd->getOrigin();
+
+  if (!scene_graph_->removeJoint(joint.getName()))
+    return false;
+
+  if (!scene_graph_->addJoint(joint))
+  {
+    // Add old joint back
+    if (!scene_graph_->addJoint(*current_joint))
+      throw std::runtime_error("Environment: Failed to add old joint back when attach failed!");
+
+    return false;
+  }
+
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->replaceJoint(joint))
+    throw std::runtime_error("Environment, failed to attach link in state solver.");
+
+  ++revision_;
+  commands_.push_back(cmd);
+
+  return true;
+}
+
 bool Environment::applyChangeLinkOriginCommand(const ChangeLinkOriginCommand::ConstPtr& /*cmd*/)  // NOLINT
 {
   throw std::runtime_error("Unhandled environment command: CHANGE_LINK_ORIGIN");
@@ -1657,7 +2942,9 @@ bool Environment::applyChangeJointOriginCommand(const ChangeJointOriginCommand::
   if (!scene_graph_->changeJointOrigin(cmd->getJointName(), cmd->getOrigin()))
     return false;
 
-  if (!state_solver_->changeJointOrigin(cmd->getJointName(), cmd->getOrigin()))
+  if (batch_)
+    batch_state_solver_changed_ = true;
+  else if (!state_solver_->changeJointOrigin(cmd->getJointName(), cmd->getOrigin()))
     throw std::runtime_error("Environment, failed to change joint origin in state solver.");
 
   ++revision_;
@@ -1668,8 +2955,11 @@ bool Environment::applyChangeJointOriginCommand(const ChangeJointOriginCommand::
 
 bool Environment::applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisionEnabledCommand::ConstPtr& cmd)
 {
+  if (batch_)
+    batch_collision_enabled_links_.insert(cmd->getLinkName());
+
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
-  if (discrete_manager_ != nullptr)
+  if (discrete_manager_ != nullptr && !batch_)
   {
     if (cmd->getEnabled())
       discrete_manager_->enableCollisionObject(cmd->getLinkName());
@@ -1678,7 +2968,7 @@ bool Environment::applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisi
   }
 
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
-  if (continuous_manager_ != nullptr)
+  if (continuous_manager_ != nullptr && !batch_)
   {
     if (cmd->getEnabled())
       continuous_manager_->enableCollisionObject(cmd->getLinkName());
@@ -1780,7 +3070,9 @@ bool Environment::applyAddSceneGraphCommand(AddSceneGraphCommand::ConstPtr cmd)
     if (!scene_graph_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
       return false;
 
-    if (!state_solver_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
       throw std::runtime_error("Environment, failed to insert scene graph into state solver.");
   }
   else
@@ -1788,10 +3080,23 @@ bool Environment::applyAddSceneGraphCommand(AddSceneGraphCommand::ConstPtr cmd)
     if (!scene_graph_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
       return false;
 
-    if (!state_solver_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->insertSceneGraph(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix()))
       throw std::runtime_error("Environment, failed to insert scene graph into state solver.");
   }
 
+  if (batch_)
+  {
+    for (const auto& link : cmd->getSceneGraph()->getLinks())
+      batch_added_links_.insert(cmd->getPrefix() + link->getName());
+
+    ++revision_;
+    commands_.push_back(cmd);
+
+    return true;
+  }
+
   // Now need to get list of added links to add to the contact manager
   std::vector<tesseract_scene_graph::Link::ConstPtr> post_links = scene_graph_->getLinks();
   assert(post_links.size() > pre_links.size());
@@ -1806,20 +3111,15 @@ bool Environment::applyAddSceneGraphCommand(AddSceneGraphCommand::ConstPtr cmd)
 
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
-  for (const auto& link : diff_links)
-  {
-    if (!link->collision.empty())
-    {
-      tesseract_collision::CollisionShapesConst shapes;
-      tesseract_common::VectorIsometry3d shape_poses;
-      getCollisionObject(shapes, shape_poses, *link);
-
-      if (discrete_manager_ != nullptr)
-        discrete_manager_->addCollisionObject(link->getName(), 0, shapes, shape_poses, true);
-      if (continuous_manager_ != nullptr)
-        continuous_manager_->addCollisionObject(link->getName(), 0, shapes, shape_poses, true);
-    }
-  }
+  std::vector<std::string> names;
+  std::vector<tesseract_collision::CollisionShapesConst> shapes;
+  std::vector<tesseract_common::VectorIsometry3d> shape_poses;
+  getCollisionObjects(names, shapes, shape_poses, diff_links);
+
+  if (discrete_manager_ != nullptr)
+    discrete_manager_->addCollisionObjects(names, 0, shapes, shape_poses, true);
+  if (continuous_manager_ != nullptr)
+    continuous_manager_->addCollisionObjects(names, 0, shapes, shape_poses, true);
 
   ++revision_;
   commands_.push_back(cmd);
@@ -1846,7 +3146,9 @@ bool Environment::applyChangeJointPositionLimitsCommand(const ChangeJointPositio
     if (!scene_graph_->changeJointLimits(jp.first, jl_copy))
       return false;
 
-    if (!state_solver_->changeJointPositionLimits(jp.first, jp.second.first, jp.second.second))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->changeJointPositionLimits(jp.first, jp.second.first, jp.second.second))
       throw std::runtime_error("Environment, failed to change joint position limits in state solver.");
   }
 
@@ -1874,7 +3176,9 @@ bool Environment::applyChangeJointVelocityLimitsCommand(const ChangeJointVelocit
     if (!scene_graph_->changeJointLimits(jp.first, jl_copy))
       return false;
 
-    if (!state_solver_->changeJointVelocityLimits(jp.first, jp.second))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->changeJointVelocityLimits(jp.first, jp.second))
       throw std::runtime_error("Environment, failed to change joint velocity limits in state solver.");
   }
 
@@ -1902,7 +3206,9 @@ bool Environment::applyChangeJointAccelerationLimitsCommand(const ChangeJointAcc
     if (!scene_graph_->changeJointLimits(jp.first, jl_copy))
       return false;
 
-    if (!state_solver_->changeJointAccelerationLimits(jp.first, jp.second))
+    if (batch_)
+      batch_state_solver_changed_ = true;
+    else if (!state_solver_->changeJointAccelerationLimits(jp.first, jp.second))
       throw std::runtime_error("Environment, failed to change joint acceleration limits in state solver.");
   }
 
@@ -1981,8 +3287,7 @@ bool Environment::applyAddContactManagersPluginInfoCommand(const AddContactManag
   {
     std::string discrete_default = contact_managers_factory_.getDefaultDiscreteContactManagerPlugin();
     std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex_);
-    if (discrete_manager_ == nullptr || discrete_manager_->getName() != discrete_default)
-      setActiveDiscreteContactManagerHelper(discrete_default);
+    setActiveDiscreteContactManagerHelper(discrete_default);
   }
   else
   {
@@ -1993,8 +3298,7 @@ bool Environment::applyAddContactManagersPluginInfoCommand(const AddContactManag
   {
     std::string continuous_default = contact_managers_factory_.getDefaultContinuousContactManagerPlugin();
     std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex_);
-    if (continuous_manager_ == nullptr || continuous_manager_->getName() != continuous_default)
-      setActiveContinuousContactManagerHelper(continuous_default);
+    setActiveContinuousContactManagerHelper(continuous_default);
   }
   else
   {
@@ -2053,9 +3357,22 @@ void Environment::save(Archive& ar, const unsigned int /*version*/) const
   std::shared_lock<std::shared_mutex> lock(mutex_);
 
   ar& BOOST_SERIALIZATION_NVP(resource_locator_);
-  ar& BOOST_SERIALIZATION_NVP(commands_);
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Each command is stored in its own archive, so the commands and their geometry are decoded in parallel
+    std::vector<std::string> command_payloads(commands_.size());
+    tesseract_common::getDefaultExecutor()->parallelFor(commands_.size(), [this, &command_payloads](std::size_t i) {
+      command_payloads[i] = saveCommandPayload(commands_[i]);
+    });
+    ar& BOOST_SERIALIZATION_NVP(command_payloads);
+  }
+  else
+  {
+    ar& BOOST_SERIALIZATION_NVP(commands_);
+  }
   ar& BOOST_SERIALIZATION_NVP(init_revision_);
-  ar& BOOST_SERIALIZATION_NVP(current_state_);
+  tesseract_scene_graph::SceneState current_state = current_state_->state;
+  ar& boost::serialization::make_nvp("current_state_", current_state);
   ar& boost::serialization::make_nvp("timestamp_",
                                      boost::serialization::make_binary_object(&timestamp_, sizeof(timestamp_)));
   ar& boost::serialization::make_nvp(
@@ -2064,13 +3381,41 @@ void Environment::save(Archive& ar, const unsigned int /*version*/) const
 }
 
 template <class Archive>
-void Environment::load(Archive& ar, const unsigned int /*version*/)
+void Environment::load(Archive& ar, const unsigned int version)
 {
   ar& BOOST_SERIALIZATION_NVP(resource_locator_);
 
   tesseract_environment::Commands commands;
-  ar& boost::serialization::make_nvp("commands_", commands);
-  init(commands);
+  bool loaded_command_payloads{ false };
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+    {
+      std::vector<std::string> command_payloads;
+      ar& BOOST_SERIALIZATION_NVP(command_payloads);
+      commands.resize(command_payloads.size());
+      tesseract_common::getDefaultExecutor()->parallelFor(
+          command_payloads.size(),
+          [&commands, &command_payloads](std::size_t i) { commands[i] = loadCommandPayload(command_payloads[i]); });
+      loaded_command_payloads = true;
+    }
+  }
+
+  if (!loaded_command_payloads)
+    ar& boost::serialization::make_nvp("commands_", commands);
+
+  // The commands are applied as one batch, so the state solver is built once from the final scene graph instead of
+  // being updated by every command. The contact managers are created from the final scene graph on first use.
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    initHelper(commands, true);
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    triggerEnvironmentChangedCallbacks();
+    triggerCurrentStateChangedCallbacks();
+  }
 
   ar& BOOST_SERIALIZATION_NVP(init_revision_);
 
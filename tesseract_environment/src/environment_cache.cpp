@@ -24,20 +24,46 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <vector>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/metrics.h>
 #include <tesseract_environment/environment_cache.h>
 
 namespace tesseract_environment
 {
 DefaultEnvironmentCache::DefaultEnvironmentCache(tesseract_environment::Environment::ConstPtr env,
-                                                 std::size_t cache_size)
+                                                 std::size_t cache_size,
+                                                 bool async)
   : env_(std::move(env)), cache_size_(cache_size)
 {
+  if (async)
+    refill_thread_ = std::thread(&DefaultEnvironmentCache::refillLoop, this);
+}
+
+DefaultEnvironmentCache::~DefaultEnvironmentCache()
+{
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    stop_refill_ = true;
+  }
+
+  refill_cv_.notify_all();
+  if (refill_thread_.joinable())
+    refill_thread_.join();
 }
 
 void DefaultEnvironmentCache::setCacheSize(long size)
 {
-  std::unique_lock<std::shared_mutex> lock(cache_mutex_);
-  cache_size_ = static_cast<std::size_t>(size);
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    cache_size_ = static_cast<std::size_t>(size);
+  }
+  refill_cv_.notify_one();
 }
 
 long DefaultEnvironmentCache::getCacheSize() const { return static_cast<long>(cache_size_); }
@@ -52,28 +78,95 @@ tesseract_environment::Environment::UPtr DefaultEnvironmentCache::getCachedEnvir
 {
   tesseract_scene_graph::SceneState current_state = env_->getState();
 
+  const auto start = std::chrono::steady_clock::now();
   std::unique_lock<std::shared_mutex> lock(cache_mutex_);
-  refreshCacheHelper();  // This is to make sure the cached items are updated if needed
+  auto is_ready = [this]() { return !cache_.empty() && cache_env_revision_ == env_->getRevision(); };
+  const bool hit = is_ready();
+  if (refill_thread_.joinable() && cache_size_ > 0)
+  {
+    // The background thread refills the cache, so only wait for it if the cache ran dry or is out of date
+    if (!hit)
+    {
+      refill_cv_.notify_one();
+      ready_cv_.wait(lock, is_ready);
+    }
+  }
+  else
+  {
+    refreshCacheHelper();  // This is to make sure the cached items are updated if needed
+  }
+
   assert(!cache_.empty());
   tesseract_environment::Environment::UPtr t = std::move(cache_.back());
+  cache_.pop_back();
+
+  const auto wait_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  if (hit)
+    ++metrics_.hits;
+  else
+    ++metrics_.misses;
+
+  metrics_.total_wait_time += wait_time;
+  metrics_.max_wait_time = std::max(metrics_.max_wait_time, wait_time);
+  lock.unlock();
+
+  // The same metrics aggregated over all caches of the process
+  auto& registry = tesseract_common::MetricsRegistry::getInstance();
+  static tesseract_common::MetricCounter& global_hits = registry.getCounter(
+      "tesseract_environment_cache_hits_total", "The number of cached environments which were ready when requested");
+  static tesseract_common::MetricCounter& global_misses = registry.getCounter(
+      "tesseract_environment_cache_misses_total", "The number of cached environments not ready when requested");
+  static tesseract_common::MetricHistogram& global_wait_time = registry.getHistogram(
+      "tesseract_environment_cache_wait_seconds", "The time spent waiting for a cached environment");
+  (hit ? global_hits : global_misses).increment();
+  global_wait_time.observe(wait_time);
+  refill_cv_.notify_one();
+
   // Update to the current joint values
   t->setState(current_state.joints);
 
-  cache_.pop_back();
-
   return t;
 }
 
+bool DefaultEnvironmentCache::isAsync() const { return refill_thread_.joinable(); }
+
+EnvironmentCacheMetrics DefaultEnvironmentCache::getMetrics() const
+{
+  std::shared_lock<std::shared_mutex> lock(cache_mutex_);
+  return metrics_;
+}
+
+void DefaultEnvironmentCache::resetMetrics()
+{
+  std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+  metrics_ = EnvironmentCacheMetrics();
+}
+
 void DefaultEnvironmentCache::refreshCacheHelper() const
 {
   tesseract_environment::Environment::UPtr env;
   auto lock_read = env_->lockRead();
   int rev = env_->getRevision();
-  if (rev != cache_env_revision_ || cache_.empty())
+  if (cache_.empty())
   {
     env = env_->clone();
     cache_env_revision_ = rev;
   }
+  else if (rev != cache_env_revision_)
+  {
+    // Only the commands the cached environments are missing are applied, update locks the environment itself
+    lock_read.unlock();
+    cache_.erase(std::remove_if(cache_.begin(),
+                                cache_.end(),
+                                [this](const tesseract_environment::Environment::UPtr& cached_env) {
+                                  return !cached_env->update(env_);
+                                }),
+                 cache_.end());
+    cache_env_revision_ = rev;
+
+    if (cache_.empty())
+      env = env_->clone();
+  }
 
   if (env != nullptr)
   {
@@ -88,4 +181,57 @@ void DefaultEnvironmentCache::refreshCacheHelper() const
   }
 }
 
+void DefaultEnvironmentCache::refillLoop()
+{
+  std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+  while (!stop_refill_)
+  {
+    // Stale environments are taken out of the cache and updated, so they are never handed out
+    std::deque<tesseract_environment::Environment::UPtr> stale;
+    const int rev = env_->getRevision();
+    if (rev != cache_env_revision_)
+    {
+      stale.swap(cache_);
+      cache_env_revision_ = rev;
+    }
+
+    if (cache_.size() >= cache_size_)
+    {
+      refill_cv_.wait_for(lock, refill_period_, [this]() { return stop_refill_ || cache_.size() < cache_size_; });
+      continue;
+    }
+
+    // The environments are cloned and updated without holding the lock, so requests are not blocked
+    const std::size_t missing = cache_size_ - cache_.size();
+    lock.unlock();
+    std::vector<tesseract_environment::Environment::UPtr> ready;
+    ready.reserve(missing);
+    try
+    {
+      for (auto& cached_env : stale)
+      {
+        if (ready.size() < missing && cached_env->update(env_))
+          ready.push_back(std::move(cached_env));
+      }
+
+      while (ready.size() < missing)
+        ready.push_back(env_->clone());
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("DefaultEnvironmentCache, failed to refill the cache: %s", e.what());
+    }
+    lock.lock();
+
+    // An environment of an older revision is dropped, the environment changed again while refilling
+    for (auto& cached_env : ready)
+    {
+      if (cache_.size() < cache_size_ && cached_env->getRevision() == cache_env_revision_)
+        cache_.push_back(std::move(cached_env));
+    }
+
+    ready_cv_.notify_all();
+  }
+}
+
 }  // namespace tesseract_environment
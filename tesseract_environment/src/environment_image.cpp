@@ -0,0 +1,166 @@
+/**
+ * @file environment_image.cpp
+ * @brief A binary image of an environment for fast startup
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <streambuf>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment_image.h>
+#include <tesseract_common/serialization.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The header in front of the archive of an environment image */
+struct EnvironmentImageHeader
+{
+  char magic[8]{ 'T', 'E', 'S', 'E', 'N', 'V', 'I', 'M' };  // NOLINT
+  std::uint32_t version{ ENVIRONMENT_IMAGE_VERSION };
+  std::uint32_t reserved{ 0 };
+  std::uint64_t archive_size{ 0 };
+};
+
+/** @brief A read only stream buffer over memory, so the archive is read without copying it */
+class MemoryStreamBuf : public std::streambuf
+{
+public:
+  MemoryStreamBuf(const char* data, std::size_t size)
+  {
+    // The buffer is only read, std::streambuf just does not provide a const get area
+    char* begin = const_cast<char*>(data);  // NOLINT
+    setg(begin, begin, begin + size);
+  }
+};
+}  // namespace
+
+bool saveEnvironmentImage(const Environment& env, const std::string& file_path)
+{
+  if (!env.isInitialized())
+  {
+    CONSOLE_BRIDGE_logError("saveEnvironmentImage, the environment is not initialized!");
+    return false;
+  }
+
+  std::ofstream os(file_path, std::ios_base::binary);
+  if (!os.good())
+  {
+    CONSOLE_BRIDGE_logError("saveEnvironmentImage, failed to open file '%s'!", file_path.c_str());
+    return false;
+  }
+
+  // The header is written again once the size of the archive is known
+  EnvironmentImageHeader header;
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT
+  const std::streampos start = os.tellp();
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os);
+    // Boost uses the same function for serialization and deserialization so it requires a non-const reference
+    // Because we are only serializing here it is safe to cast away const
+    oa << boost::serialization::make_nvp<Environment>("archive_type", const_cast<Environment&>(env));  // NOLINT
+  }
+
+  header.archive_size = static_cast<std::uint64_t>(os.tellp() - start);
+  os.seekp(0);
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT
+
+  return os.good();
+}
+
+Environment::UPtr loadEnvironmentImage(const std::string& file_path)
+{
+  try
+  {
+    boost::interprocess::file_mapping mapping(file_path.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+    return loadEnvironmentImage(static_cast<const char*>(region.get_address()), region.get_size());
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, failed to map file '%s': %s", file_path.c_str(), e.what());
+    return nullptr;
+  }
+}
+
+Environment::UPtr loadEnvironmentImage(const char* data, std::size_t size)
+{
+  EnvironmentImageHeader header;
+  const EnvironmentImageHeader expected;
+  if (data == nullptr || size < sizeof(header))
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, the data is smaller than the image header!");
+    return nullptr;
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0)
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, the data is not an environment image!");
+    return nullptr;
+  }
+
+  if (header.version != ENVIRONMENT_IMAGE_VERSION)
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, the image version %u is not supported, expected version %u!",
+                            header.version,
+                            ENVIRONMENT_IMAGE_VERSION);
+    return nullptr;
+  }
+
+  if (header.archive_size > size - sizeof(header))
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, the image is truncated!");
+    return nullptr;
+  }
+
+  auto env = std::make_unique<Environment>();
+  try
+  {
+    MemoryStreamBuf buffer(data + sizeof(header), static_cast<std::size_t>(header.archive_size));
+    std::istream is(&buffer);
+    boost::archive::binary_iarchive ia(is);
+    ia >> boost::serialization::make_nvp<Environment>("archive_type", *env);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, failed to read the environment: %s", e.what());
+    return nullptr;
+  }
+
+  if (!env->isInitialized())
+  {
+    CONSOLE_BRIDGE_logError("loadEnvironmentImage, failed to initialize the environment from the image!");
+    return nullptr;
+  }
+
+  return env;
+}
+}  // namespace tesseract_environment
@@ -0,0 +1,343 @@
+/**
+ * @file environment_sync.cpp
+ * @brief Revision based synchronization of environments with a compact binary encoding
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment_sync.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The geometry reference of a link without geometry */
+constexpr std::size_t NO_GEOMETRY{ std::numeric_limits<std::size_t>::max() };
+
+/**
+ * @brief The table of the geometry sent in a message, geometry with the same content is added once
+ * @details The geometry is not tracked by the archive, so it would be written for every link using it
+ */
+class GeometryTable
+{
+public:
+  /** @brief Add geometry to the table and get its index, or the index of the geometry with the same content */
+  std::size_t add(const tesseract_geometry::Geometry::Ptr& geometry)
+  {
+    if (geometry == nullptr)
+      return NO_GEOMETRY;
+
+    auto it = indices_.find(geometry.get());
+    if (it != indices_.end())
+      return it->second;
+
+    std::string content = getContent(geometry);
+    auto& bucket = content_[std::hash<std::string>()(content)];
+    for (const auto& entry : bucket)
+    {
+      if (entry.first == content)
+      {
+        indices_[geometry.get()] = entry.second;
+        return entry.second;
+      }
+    }
+
+    const std::size_t index = geometries_.size();
+    geometries_.push_back(geometry);
+    bucket.emplace_back(std::move(content), index);
+    indices_[geometry.get()] = index;
+    return index;
+  }
+
+  /** @brief Get the geometry in the table */
+  const std::vector<tesseract_geometry::Geometry::Ptr>& getGeometries() const { return geometries_; }
+
+private:
+  /** @brief The content of the geometry is its binary archive */
+  static std::string getContent(const tesseract_geometry::Geometry::Ptr& geometry)
+  {
+    std::ostringstream os;
+    {  // Must be scoped because all data is not written until the archive goes out of scope
+      boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+      oa << geometry;
+    }
+    return os.str();
+  }
+
+  std::vector<tesseract_geometry::Geometry::Ptr> geometries_;
+
+  /** @brief The index of each geometry added */
+  std::unordered_map<const tesseract_geometry::Geometry*, std::size_t> indices_;
+
+  /** @brief The content and index of the geometry in the table by the hash of the content */
+  std::unordered_map<std::size_t, std::vector<std::pair<std::string, std::size_t>>> content_;
+};
+
+/** @brief Call fn with the geometry of each collision and visual of a link, the link must not be shared */
+void forEachGeometry(const tesseract_scene_graph::Link& link,
+                     const std::function<void(tesseract_geometry::Geometry::Ptr&)>& fn)
+{
+  for (const auto& collision : link.collision)
+    fn(collision->geometry);
+
+  for (const auto& visual : link.visual)
+    fn(visual->geometry);
+}
+
+/**
+ * @brief Call fn with the geometry of the links added by a command, the command must not be shared
+ * @details The links of a scene graph are visited in name order so the order is the same in every process
+ */
+void forEachGeometry(const Command& command, const std::function<void(tesseract_geometry::Geometry::Ptr&)>& fn)
+{
+  if (command.getType() == CommandType::ADD_LINK)
+  {
+    forEachGeometry(*static_cast<const AddLinkCommand&>(command).getLink(), fn);
+  }
+  else if (command.getType() == CommandType::ADD_SCENE_GRAPH)
+  {
+    std::vector<tesseract_scene_graph::Link::ConstPtr> links =
+        static_cast<const AddSceneGraphCommand&>(command).getSceneGraph()->getLinks();
+    std::sort(links.begin(), links.end(), [](const auto& a, const auto& b) { return a->getName() < b->getName(); });
+    for (const auto& link : links)
+      forEachGeometry(*link, fn);
+  }
+}
+
+/** @brief Copy the commands adding links, so their geometry can be moved to the table without changing the original */
+Command::ConstPtr copyLinkCommand(const Command::ConstPtr& command)
+{
+  if (command->getType() == CommandType::ADD_LINK)
+  {
+    // The commands copy the link, so the copy has its own collision and visual objects
+    auto cmd = std::static_pointer_cast<const AddLinkCommand>(command);
+    if (cmd->getJoint() != nullptr)
+      return std::make_shared<AddLinkCommand>(*cmd->getLink(), *cmd->getJoint(), cmd->replaceAllowed());
+
+    return std::make_shared<AddLinkCommand>(*cmd->getLink(), cmd->replaceAllowed());
+  }
+
+  if (command->getType() == CommandType::ADD_SCENE_GRAPH)
+  {
+    auto cmd = std::static_pointer_cast<const AddSceneGraphCommand>(command);
+    if (cmd->getJoint() != nullptr)
+      return std::make_shared<AddSceneGraphCommand>(*cmd->getSceneGraph(), *cmd->getJoint(), cmd->getPrefix());
+
+    return std::make_shared<AddSceneGraphCommand>(*cmd->getSceneGraph(), cmd->getPrefix());
+  }
+
+  return command;
+}
+}  // namespace
+
+EnvironmentDelta getEnvironmentDelta(const Environment& env, int revision)
+{
+  // The revision of an environment is the number of commands in its command history
+  Commands commands = env.getCommandHistory();
+
+  EnvironmentDelta delta;
+  delta.revision = static_cast<int>(commands.size());
+  if (revision > 0 && revision <= delta.revision)
+  {
+    delta.from_revision = revision;
+    delta.commands.assign(commands.begin() + revision, commands.end());
+  }
+  else
+  {
+    delta.commands = std::move(commands);
+  }
+
+  return delta;
+}
+
+bool applyEnvironmentDelta(Environment& env, const EnvironmentDelta& delta)
+{
+  if (delta.from_revision == 0)
+  {
+    if (!env.init(delta.commands))
+      return false;
+  }
+  else
+  {
+    if (env.getRevision() != delta.from_revision)
+    {
+      CONSOLE_BRIDGE_logDebug("applyEnvironmentDelta, the delta is for revision %d but the environment is at revision "
+                              "%d!",
+                              delta.from_revision,
+                              env.getRevision());
+      return false;
+    }
+
+    if (!delta.commands.empty() && !env.applyCommands(delta.commands))
+      return false;
+  }
+
+  return env.getRevision() == delta.revision;
+}
+
+std::string encodeEnvironmentDelta(const EnvironmentDelta& delta)
+{
+  // The geometry is moved to the table and the links keep its index
+  GeometryTable table;
+  std::vector<std::size_t> geometry_indices;
+  Commands commands;
+  commands.reserve(delta.commands.size());
+  for (const auto& command : delta.commands)
+  {
+    commands.push_back(copyLinkCommand(command));
+    forEachGeometry(*commands.back(), [&table, &geometry_indices](tesseract_geometry::Geometry::Ptr& geometry) {
+      geometry_indices.push_back(table.add(geometry));
+      geometry = nullptr;
+    });
+  }
+
+  std::ostringstream os;
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << delta.from_revision << delta.revision << table.getGeometries() << geometry_indices << commands;
+  }
+  return os.str();
+}
+
+bool decodeEnvironmentDelta(EnvironmentDelta& delta, const std::string& data)
+{
+  try
+  {
+    std::vector<tesseract_geometry::Geometry::Ptr> geometries;
+    std::vector<std::size_t> geometry_indices;
+    std::istringstream is(data);
+    boost::archive::binary_iarchive ia(is, boost::archive::no_header);
+    ia >> delta.from_revision >> delta.revision >> geometries >> geometry_indices >> delta.commands;
+
+    // The decoded commands are not shared yet, so the geometry is restored in place
+    std::size_t next{ 0 };
+    auto restore_fn = [&geometries, &geometry_indices, &next](tesseract_geometry::Geometry::Ptr& geometry) {
+      const std::size_t index = geometry_indices.at(next++);
+      geometry = (index == NO_GEOMETRY) ? nullptr : geometries.at(index);
+    };
+
+    for (const auto& command : delta.commands)
+      forEachGeometry(*command, restore_fn);
+
+    if (next != geometry_indices.size())
+      throw std::runtime_error("The number of geometry references does not match the links");
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("decodeEnvironmentDelta, failed to decode the message: %s", e.what());
+    return false;
+  }
+
+  return true;
+}
+
+EnvironmentStateUpdate getEnvironmentStateUpdate(const Environment& env)
+{
+  EnvironmentStateUpdate update;
+  while (true)
+  {
+    // The revision is checked again in case the structure changed while the state was read
+    update.revision = env.getRevision();
+    update.joint_names = env.getActiveJointNames();
+    auto state = env.getStateSnapshot();
+
+    update.joint_values.clear();
+    update.joint_values.reserve(update.joint_names.size());
+    for (const auto& joint_name : update.joint_names)
+    {
+      auto it = state->joints.find(joint_name);
+      if (it == state->joints.end())
+        break;
+
+      update.joint_values.push_back(it->second);
+    }
+
+    if (update.joint_values.size() == update.joint_names.size() && update.revision == env.getRevision())
+      return update;
+  }
+}
+
+bool applyEnvironmentStateUpdate(Environment& env, const EnvironmentStateUpdate& update)
+{
+  if (update.joint_names.size() != update.joint_values.size())
+  {
+    CONSOLE_BRIDGE_logError("applyEnvironmentStateUpdate, the number of joint names and values do not match!");
+    return false;
+  }
+
+  if (env.getRevision() != update.revision)
+  {
+    CONSOLE_BRIDGE_logDebug("applyEnvironmentStateUpdate, the update is for revision %d but the environment is at "
+                            "revision %d!",
+                            update.revision,
+                            env.getRevision());
+    return false;
+  }
+
+  env.setState(update.joint_names,
+               Eigen::Map<const Eigen::VectorXd>(update.joint_values.data(),
+                                                 static_cast<Eigen::Index>(update.joint_values.size())));
+  return true;
+}
+
+std::string encodeEnvironmentStateUpdate(const EnvironmentStateUpdate& update)
+{
+  std::ostringstream os;
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << update.revision << update.joint_names << update.joint_values;
+  }
+  return os.str();
+}
+
+bool decodeEnvironmentStateUpdate(EnvironmentStateUpdate& update, const std::string& data)
+{
+  try
+  {
+    std::istringstream is(data);
+    boost::archive::binary_iarchive ia(is, boost::archive::no_header);
+    ia >> update.revision >> update.joint_names >> update.joint_values;
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("decodeEnvironmentStateUpdate, failed to decode the message: %s", e.what());
+    return false;
+  }
+
+  return true;
+}
+}  // namespace tesseract_environment
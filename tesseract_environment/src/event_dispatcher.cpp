@@ -0,0 +1,312 @@
+/**
+ * @file event_dispatcher.cpp
+ * @brief Delivers environment events to subscribers on their own threads
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/event_dispatcher.h>
+
+namespace tesseract_environment
+{
+/** @brief An event queued for a subscriber, it owns the data the delivered event refers to */
+struct QueuedEvent
+{
+  QueuedEvent(Events type) : type(type) {}
+
+  Events type;
+  Commands commands;
+  std::size_t first_command_index{ 0 };
+  int revision{ 0 };
+  std::shared_ptr<const tesseract_scene_graph::SceneState> state;
+  std::vector<std::string> link_names;
+};
+
+struct EventSubscriber
+{
+  EventCallbackFn fn;
+  std::mutex mutex;
+
+  /** @brief Notifies the thread of the subscriber that an event was queued or it should stop */
+  std::condition_variable queued_cv;
+
+  /** @brief Notifies the threads waiting for the queue to be delivered */
+  std::condition_variable delivered_cv;
+
+  std::deque<QueuedEvent> queue;
+  bool busy{ false };
+  bool stop{ false };
+
+  /** @brief The number of commands of the history queued so far and the last of them */
+  std::size_t num_commands{ 0 };
+  Command::ConstPtr last_command;
+
+  std::thread thread;
+};
+
+namespace
+{
+void deliverEvent(const EventCallbackFn& fn, const QueuedEvent& event)
+{
+  switch (event.type)
+  {
+    case Events::COMMAND_APPLIED:
+    {
+      fn(CommandAppliedEvent(event.commands, event.revision, event.first_command_index));
+      break;
+    }
+    case Events::SCENE_STATE_CHANGED:
+    {
+      fn(SceneStateChangedEvent(*event.state));
+      break;
+    }
+    case Events::LINK_TRANSFORMS_CHANGED:
+    {
+      fn(LinkTransformsChangedEvent(event.link_names));
+      break;
+    }
+  }
+}
+
+void runSubscriber(const std::shared_ptr<EventSubscriber>& subscriber)
+{
+  std::unique_lock<std::mutex> lock(subscriber->mutex);
+  while (true)
+  {
+    subscriber->queued_cv.wait(lock, [&subscriber]() { return subscriber->stop || !subscriber->queue.empty(); });
+    if (subscriber->stop)
+      return;
+
+    QueuedEvent event = std::move(subscriber->queue.front());
+    subscriber->queue.pop_front();
+    subscriber->busy = true;
+    lock.unlock();
+
+    try
+    {
+      deliverEvent(subscriber->fn, event);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("EventDispatcher, event callback threw an exception: %s", e.what());
+    }
+
+    lock.lock();
+    subscriber->busy = false;
+    subscriber->delivered_cv.notify_all();
+  }
+}
+
+void stopSubscriber(const std::shared_ptr<EventSubscriber>& subscriber)
+{
+  {
+    std::lock_guard<std::mutex> lock(subscriber->mutex);
+    subscriber->stop = true;
+    subscriber->queue.clear();
+  }
+  subscriber->queued_cv.notify_all();
+  subscriber->delivered_cv.notify_all();
+
+  // A callback removing its own subscriber can not wait for itself, its thread keeps the subscriber alive instead
+  if (subscriber->thread.get_id() == std::this_thread::get_id())
+    subscriber->thread.detach();
+  else if (subscriber->thread.joinable())
+    subscriber->thread.join();
+}
+
+QueuedEvent* findQueuedEvent(std::deque<QueuedEvent>& queue, Events type)
+{
+  auto it = std::find_if(queue.begin(), queue.end(), [type](const QueuedEvent& e) { return e.type == type; });
+  return (it == queue.end()) ? nullptr : &(*it);
+}
+}  // namespace
+
+EventDispatcher::~EventDispatcher() { clear(); }
+
+void EventDispatcher::addCallback(std::size_t hash, const EventCallbackFn& fn)
+{
+  auto subscriber = std::make_shared<EventSubscriber>();
+  subscriber->fn = fn;
+  subscriber->thread = std::thread(runSubscriber, subscriber);
+
+  std::shared_ptr<EventSubscriber> replaced;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<EventSubscriber>& entry = subscribers_[hash];
+    replaced = std::move(entry);
+    entry = std::move(subscriber);
+  }
+
+  if (replaced != nullptr)
+    stopSubscriber(replaced);
+}
+
+void EventDispatcher::removeCallback(std::size_t hash)
+{
+  std::shared_ptr<EventSubscriber> removed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = subscribers_.find(hash);
+    if (it == subscribers_.end())
+      return;
+
+    removed = std::move(it->second);
+    subscribers_.erase(it);
+  }
+
+  // Stopped without holding the lock, the callback in progress may queue events while it is waited for
+  stopSubscriber(removed);
+}
+
+void EventDispatcher::clear()
+{
+  std::map<std::size_t, std::shared_ptr<EventSubscriber>> removed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    removed.swap(subscribers_);
+  }
+
+  for (const auto& subscriber : removed)
+    stopSubscriber(subscriber.second);
+}
+
+bool EventDispatcher::empty() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return subscribers_.empty();
+}
+
+void EventDispatcher::wait() const
+{
+  std::vector<std::shared_ptr<EventSubscriber>> subscribers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& subscriber : subscribers_)
+      subscribers.push_back(subscriber.second);
+  }
+
+  for (const auto& subscriber : subscribers)
+  {
+    std::unique_lock<std::mutex> lock(subscriber->mutex);
+    subscriber->delivered_cv.wait(
+        lock, [&subscriber]() { return subscriber->stop || (subscriber->queue.empty() && !subscriber->busy); });
+  }
+}
+
+void EventDispatcher::commandsApplied(const Commands& commands, int revision)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& entry : subscribers_)
+  {
+    EventSubscriber& subscriber = *entry.second;
+    std::unique_lock<std::mutex> subscriber_lock(subscriber.mutex);
+
+    // Only the commands appended to the history since the last event are sent, unless the history was replaced
+    std::size_t first_command_index{ 0 };
+    if (subscriber.num_commands <= commands.size() &&
+        (subscriber.num_commands == 0 || commands[subscriber.num_commands - 1] == subscriber.last_command))
+      first_command_index = subscriber.num_commands;
+
+    const bool replaced = (first_command_index == 0 && subscriber.num_commands > 0);
+    if (!replaced && first_command_index == commands.size())
+      continue;
+
+    subscriber.num_commands = commands.size();
+    subscriber.last_command = commands.empty() ? nullptr : commands.back();
+
+    QueuedEvent* event = findQueuedEvent(subscriber.queue, Events::COMMAND_APPLIED);
+    if (event == nullptr)
+    {
+      subscriber.queue.emplace_back(Events::COMMAND_APPLIED);
+      event = &subscriber.queue.back();
+      event->first_command_index = first_command_index;
+    }
+    else if (first_command_index == 0)
+    {
+      event->commands.clear();
+      event->first_command_index = 0;
+    }
+
+    const auto first = commands.begin() + static_cast<long>(first_command_index);
+    event->commands.insert(event->commands.end(), first, commands.end());
+    event->revision = revision;
+    subscriber_lock.unlock();
+    subscriber.queued_cv.notify_one();
+  }
+}
+
+void EventDispatcher::stateChanged(const tesseract_scene_graph::SceneState& state)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (subscribers_.empty())
+    return;
+
+  // The state is copied once and shared by the subscribers
+  auto shared_state = std::make_shared<const tesseract_scene_graph::SceneState>(state);
+  for (const auto& entry : subscribers_)
+  {
+    EventSubscriber& subscriber = *entry.second;
+    std::unique_lock<std::mutex> subscriber_lock(subscriber.mutex);
+    subscriber.queue.erase(std::remove_if(subscriber.queue.begin(),
+                                          subscriber.queue.end(),
+                                          [](const QueuedEvent& e) { return e.type == Events::SCENE_STATE_CHANGED; }),
+                           subscriber.queue.end());
+    subscriber.queue.emplace_back(Events::SCENE_STATE_CHANGED);
+    subscriber.queue.back().state = shared_state;
+    subscriber_lock.unlock();
+    subscriber.queued_cv.notify_one();
+  }
+}
+
+void EventDispatcher::linkTransformsChanged(const std::vector<std::string>& link_names)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& entry : subscribers_)
+  {
+    EventSubscriber& subscriber = *entry.second;
+    std::unique_lock<std::mutex> subscriber_lock(subscriber.mutex);
+    QueuedEvent* event = findQueuedEvent(subscriber.queue, Events::LINK_TRANSFORMS_CHANGED);
+    if (event == nullptr)
+    {
+      subscriber.queue.emplace_back(Events::LINK_TRANSFORMS_CHANGED);
+      subscriber.queue.back().link_names = link_names;
+    }
+    else
+    {
+      for (const auto& link_name : link_names)
+      {
+        if (std::find(event->link_names.begin(), event->link_names.end(), link_name) == event->link_names.end())
+          event->link_names.push_back(link_name);
+      }
+    }
+    subscriber_lock.unlock();
+    subscriber.queued_cv.notify_one();
+  }
+}
+}  // namespace tesseract_environment
@@ -0,0 +1,129 @@
+/**
+ * @file generate_allowed_collision_matrix.cpp
+ * @brief Generates the disabled collisions of an SRDF file by sampling random states
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+#include <iostream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_environment/allowed_collision_matrix_generator.h>
+#include <tesseract_srdf/srdf_model.h>
+
+namespace
+{
+const int SUCCESS = 0;
+const int ERROR_IN_COMMAND_LINE = 1;
+const int ERROR_UNHANDLED_EXCEPTION = 2;
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string urdf;
+  std::string srdf;
+  std::string output;
+  bool replace{ false };
+  tesseract_environment::AllowedCollisionMatrixGeneratorConfig config;
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "urdf,u", po::value<std::string>(&urdf)->required(), "File path to the URDF.")(
+      "srdf,s",
+      po::value<std::string>(&srdf)->required(),
+      "File path to the SRDF, it must configure the discrete contact manager.")(
+      "output,o",
+      po::value<std::string>(&output)->required(),
+      "File path to save the SRDF with the generated disabled collisions.")(
+      "samples,n", po::value<std::size_t>(&config.samples), "The number of random states sampled.")(
+      "always,a",
+      po::value<double>(&config.always_fraction),
+      "The fraction of the sampled states a pair must be in collision in to be disabled as always in collision.")(
+      "threads,t", po::value<std::size_t>(&config.threads), "The number of threads, zero uses all hardware threads.")(
+      "seed", po::value<uint32_t>(&config.seed), "The seed of the random states.")(
+      "replace,r",
+      po::bool_switch(&replace),
+      "Replace the disabled collisions of the SRDF instead of adding the generated disabled collisions to them.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Generates the disabled collisions of an SRDF by sampling random states" << std::endl
+                << desc << std::endl;
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+    std::cerr << desc << std::endl;
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  try
+  {
+    auto locator = std::make_shared<tesseract_common::GeneralResourceLocator>();
+    tesseract_environment::Environment env;
+    if (!env.init(tesseract_common::fs::path(urdf), tesseract_common::fs::path(srdf), locator))
+    {
+      CONSOLE_BRIDGE_logError("Failed to initialize the environment!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+
+    tesseract_srdf::SRDFModel srdf_model;
+    srdf_model.initFile(*env.getSceneGraph(), srdf, *locator);
+
+    tesseract_common::AllowedCollisionMatrix acm = tesseract_environment::generateAllowedCollisionMatrix(env, config);
+    std::cout << "Generated " << acm.getAllAllowedCollisions().size() << " disabled collisions" << std::endl;
+
+    if (replace)
+      srdf_model.acm.clearAllowedCollisions();
+
+    srdf_model.acm.insertAllowedCollisionMatrix(acm);
+    if (!srdf_model.saveToFile(output))
+    {
+      CONSOLE_BRIDGE_logError("Failed to write the SRDF to file!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    tesseract_common::printNestedException(e);
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return SUCCESS;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file query_context.cpp
+ * @brief Reusable scratch data for collision, kinematics and state queries
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/query_context.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The contexts of a thread, the contexts below depth are in use */
+struct QueryContextStack
+{
+  std::vector<QueryContext::UPtr> contexts;
+  std::size_t depth{ 0 };
+};
+
+QueryContextStack& getThreadLocalStack()
+{
+  thread_local QueryContextStack stack;
+  return stack;
+}
+}  // namespace
+
+void QueryContext::clear()
+{
+  contacts.clear();
+  for (auto& segment_contacts : sweep_contacts)
+    segment_contacts.clear();
+
+  ik_solutions.clear();
+}
+
+void QueryContext::release()
+{
+  link_transforms.clear();
+  contacts.release();
+  sweep_contacts.clear();
+  ik_solutions = tesseract_kinematics::IKSolutionsBuffer();
+}
+
+QueryContext::Scope::Scope()
+{
+  QueryContextStack& stack = getThreadLocalStack();
+  if (stack.depth == stack.contexts.size())
+    stack.contexts.push_back(std::make_unique<QueryContext>());
+
+  context_ = stack.contexts[stack.depth++].get();
+}
+
+QueryContext::Scope::~Scope()
+{
+  context_->clear();
+  --getThreadLocalStack().depth;
+}
+
+}  // namespace tesseract_environment
@@ -0,0 +1,367 @@
+/**
+ * @file query_recorder.cpp
+ * @brief Records the queries run against an environment so they can be replayed offline
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
+#include <fstream>
+#include <boost/serialization/array_wrapper.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/string.hpp>
+#if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
+#include <boost/serialization/library_version_type.hpp>
+#endif
+#include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/vector.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/query_recorder.h>
+#include <tesseract_common/eigen_serialization.h>
+#include <tesseract_common/collision_margin_data.h>
+#include <tesseract_common/allowed_collision_matrix.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The header in front of the archive of a query log */
+struct QueryLogHeader
+{
+  char magic[8]{ 'T', 'E', 'S', 'Q', 'R', 'L', 'O', 'G' };  // NOLINT
+  std::uint32_t version{ QUERY_LOG_VERSION };
+  std::uint32_t reserved{ 0 };
+};
+
+template <class Archive>
+void saveContactRequest(Archive& ar, const tesseract_collision::ContactRequest& request)
+{
+  auto request_type = static_cast<int>(request.type);
+  auto detail = static_cast<int>(request.detail);
+  ar& boost::serialization::make_nvp("request_type", request_type);
+  ar& boost::serialization::make_nvp("calculate_penetration", request.calculate_penetration);
+  ar& boost::serialization::make_nvp("calculate_distance", request.calculate_distance);
+  ar& boost::serialization::make_nvp("contact_limit", request.contact_limit);
+  ar& boost::serialization::make_nvp("detail", detail);
+}
+
+template <class Archive>
+void loadContactRequest(Archive& ar, tesseract_collision::ContactRequest& request)
+{
+  int request_type{ 0 };
+  int detail{ 0 };
+  ar& boost::serialization::make_nvp("request_type", request_type);
+  ar& boost::serialization::make_nvp("calculate_penetration", request.calculate_penetration);
+  ar& boost::serialization::make_nvp("calculate_distance", request.calculate_distance);
+  ar& boost::serialization::make_nvp("contact_limit", request.contact_limit);
+  ar& boost::serialization::make_nvp("detail", detail);
+  request.type = static_cast<tesseract_collision::ContactTestType>(request_type);
+  request.detail = static_cast<tesseract_collision::ContactResultDetail>(detail);
+}
+
+template <class Archive>
+void saveConfig(Archive& ar, const tesseract_collision::CollisionCheckConfig& config)
+{
+  const tesseract_collision::ContactManagerConfig& manager_config = config.contact_manager_config;
+  auto margin_data_override_type = static_cast<int>(manager_config.margin_data_override_type);
+  auto acm_override_type = static_cast<int>(manager_config.acm_override_type);
+  auto evaluator_type = static_cast<int>(config.type);
+  ar& boost::serialization::make_nvp("margin_data_override_type", margin_data_override_type);
+  ar& boost::serialization::make_nvp("margin_data", manager_config.margin_data);
+  ar& boost::serialization::make_nvp("acm", manager_config.acm);
+  ar& boost::serialization::make_nvp("acm_override_type", acm_override_type);
+  ar& boost::serialization::make_nvp("modify_object_enabled", manager_config.modify_object_enabled);
+  ar& boost::serialization::make_nvp("enable_statistics", manager_config.enable_statistics);
+  saveContactRequest(ar, config.contact_request);
+  ar& boost::serialization::make_nvp("evaluator_type", evaluator_type);
+  ar& boost::serialization::make_nvp("longest_valid_segment_length", config.longest_valid_segment_length);
+  ar& boost::serialization::make_nvp("adaptive_longest_valid_segment", config.adaptive_longest_valid_segment);
+  ar& boost::serialization::make_nvp("bisection_order", config.bisection_order);
+  ar& boost::serialization::make_nvp("swept_volume_broadphase", config.swept_volume_broadphase);
+}
+
+template <class Archive>
+void loadConfig(Archive& ar, tesseract_collision::CollisionCheckConfig& config)
+{
+  tesseract_collision::ContactManagerConfig& manager_config = config.contact_manager_config;
+  int margin_data_override_type{ 0 };
+  int acm_override_type{ 0 };
+  int evaluator_type{ 0 };
+  ar& boost::serialization::make_nvp("margin_data_override_type", margin_data_override_type);
+  ar& boost::serialization::make_nvp("margin_data", manager_config.margin_data);
+  ar& boost::serialization::make_nvp("acm", manager_config.acm);
+  ar& boost::serialization::make_nvp("acm_override_type", acm_override_type);
+  ar& boost::serialization::make_nvp("modify_object_enabled", manager_config.modify_object_enabled);
+  ar& boost::serialization::make_nvp("enable_statistics", manager_config.enable_statistics);
+  loadContactRequest(ar, config.contact_request);
+  ar& boost::serialization::make_nvp("evaluator_type", evaluator_type);
+  ar& boost::serialization::make_nvp("longest_valid_segment_length", config.longest_valid_segment_length);
+  ar& boost::serialization::make_nvp("adaptive_longest_valid_segment", config.adaptive_longest_valid_segment);
+  ar& boost::serialization::make_nvp("bisection_order", config.bisection_order);
+  ar& boost::serialization::make_nvp("swept_volume_broadphase", config.swept_volume_broadphase);
+  manager_config.margin_data_override_type =
+      static_cast<tesseract_common::CollisionMarginOverrideType>(margin_data_override_type);
+  manager_config.acm_override_type = static_cast<tesseract_collision::ACMOverrideType>(acm_override_type);
+  config.type = static_cast<tesseract_collision::CollisionEvaluatorType>(evaluator_type);
+}
+}  // namespace
+
+template <class Archive>
+void RecordedQuery::save(Archive& ar, const unsigned int /*version*/) const
+{
+  auto query_type = static_cast<int>(type);
+  ar& boost::serialization::make_nvp("type", query_type);
+  ar& BOOST_SERIALIZATION_NVP(revision);
+  ar& BOOST_SERIALIZATION_NVP(time);
+  ar& BOOST_SERIALIZATION_NVP(group_name);
+  ar& BOOST_SERIALIZATION_NVP(joint_names);
+  ar& BOOST_SERIALIZATION_NVP(joint_values);
+  ar& BOOST_SERIALIZATION_NVP(active_link_names);
+  saveContactRequest(ar, contact_request);
+
+  Eigen::Index rows = trajectory.rows();
+  Eigen::Index cols = trajectory.cols();
+  ar& boost::serialization::make_nvp("rows", rows);
+  ar& boost::serialization::make_nvp("cols", cols);
+  ar& boost::serialization::make_nvp("trajectory",
+                                     boost::serialization::make_array(trajectory.data(), trajectory.size()));
+
+  saveConfig(ar, config);
+
+  std::size_t ik_input_count = ik_inputs.size();
+  ar& boost::serialization::make_nvp("ik_input_count", ik_input_count);
+  for (const auto& input : ik_inputs)
+  {
+    ar& boost::serialization::make_nvp("pose", input.pose);
+    ar& boost::serialization::make_nvp("working_frame", input.working_frame);
+    ar& boost::serialization::make_nvp("tip_link_name", input.tip_link_name);
+  }
+}
+
+template <class Archive>
+void RecordedQuery::load(Archive& ar, const unsigned int /*version*/)
+{
+  int query_type{ 0 };
+  ar& boost::serialization::make_nvp("type", query_type);
+  type = static_cast<RecordedQueryType>(query_type);
+  ar& BOOST_SERIALIZATION_NVP(revision);
+  ar& BOOST_SERIALIZATION_NVP(time);
+  ar& BOOST_SERIALIZATION_NVP(group_name);
+  ar& BOOST_SERIALIZATION_NVP(joint_names);
+  ar& BOOST_SERIALIZATION_NVP(joint_values);
+  ar& BOOST_SERIALIZATION_NVP(active_link_names);
+  loadContactRequest(ar, contact_request);
+
+  Eigen::Index rows{ 0 };
+  Eigen::Index cols{ 0 };
+  ar& boost::serialization::make_nvp("rows", rows);
+  ar& boost::serialization::make_nvp("cols", cols);
+  trajectory.resize(rows, cols);
+  ar& boost::serialization::make_nvp("trajectory",
+                                     boost::serialization::make_array(trajectory.data(), trajectory.size()));
+
+  loadConfig(ar, config);
+
+  std::size_t ik_input_count{ 0 };
+  ar& boost::serialization::make_nvp("ik_input_count", ik_input_count);
+  ik_inputs.resize(ik_input_count);
+  for (auto& input : ik_inputs)
+  {
+    ar& boost::serialization::make_nvp("pose", input.pose);
+    ar& boost::serialization::make_nvp("working_frame", input.working_frame);
+    ar& boost::serialization::make_nvp("tip_link_name", input.tip_link_name);
+  }
+}
+
+template <class Archive>
+void RecordedQuery::serialize(Archive& ar, const unsigned int version)
+{
+  boost::serialization::split_member(ar, *this, version);
+}
+
+QueryRecorder::QueryRecorder() : start_(std::chrono::steady_clock::now()) {}
+
+void QueryRecorder::recordSetState(int revision,
+                                   const std::vector<std::string>& joint_names,
+                                   const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::SET_STATE;
+  query.revision = revision;
+  query.joint_names = joint_names;
+  query.joint_values = joint_values;
+  add(std::move(query));
+}
+
+void QueryRecorder::recordSetState(int revision, const std::unordered_map<std::string, double>& joints)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::SET_STATE;
+  query.revision = revision;
+  query.joint_names.reserve(joints.size());
+  query.joint_values.resize(static_cast<Eigen::Index>(joints.size()));
+  for (const auto& joint : joints)
+  {
+    query.joint_values(static_cast<Eigen::Index>(query.joint_names.size())) = joint.second;
+    query.joint_names.push_back(joint.first);
+  }
+  add(std::move(query));
+}
+
+void QueryRecorder::recordContactTest(int revision,
+                                      const std::vector<std::string>& joint_names,
+                                      const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                      const tesseract_collision::ContactRequest& request,
+                                      const std::vector<std::string>& active_link_names)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::CONTACT_TEST;
+  query.revision = revision;
+  query.joint_names = joint_names;
+  query.joint_values = joint_values;
+  query.active_link_names = active_link_names;
+  query.contact_request = request;
+  query.contact_request.is_valid = nullptr;
+  add(std::move(query));
+}
+
+void QueryRecorder::recordCheckTrajectory(int revision,
+                                          const std::string& group_name,
+                                          const tesseract_common::TrajArray& trajectory,
+                                          const tesseract_collision::CollisionCheckConfig& config)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::CHECK_TRAJECTORY;
+  query.revision = revision;
+  query.group_name = group_name;
+  query.trajectory = trajectory;
+  query.config = config;
+  query.config.contact_request.is_valid = nullptr;
+  add(std::move(query));
+}
+
+void QueryRecorder::recordCalcInvKin(int revision,
+                                     const std::string& group_name,
+                                     const tesseract_kinematics::KinGroupIKInputs& inputs,
+                                     const Eigen::Ref<const Eigen::VectorXd>& seed)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::CALC_INV_KIN;
+  query.revision = revision;
+  query.group_name = group_name;
+  query.ik_inputs = inputs;
+  query.joint_values = seed;
+  add(std::move(query));
+}
+
+std::vector<RecordedQuery> QueryRecorder::getQueries() const
+{
+  std::scoped_lock<std::mutex> lock(mutex_);
+  return queries_;
+}
+
+std::size_t QueryRecorder::size() const
+{
+  std::scoped_lock<std::mutex> lock(mutex_);
+  return queries_.size();
+}
+
+void QueryRecorder::clear()
+{
+  std::scoped_lock<std::mutex> lock(mutex_);
+  queries_.clear();
+}
+
+bool QueryRecorder::save(const std::string& file_path) const { return saveQueryLog(getQueries(), file_path); }
+
+void QueryRecorder::add(RecordedQuery&& query)
+{
+  std::scoped_lock<std::mutex> lock(mutex_);
+  query.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+  queries_.push_back(std::move(query));
+}
+
+bool saveQueryLog(const std::vector<RecordedQuery>& queries, const std::string& file_path)
+{
+  std::ofstream os(file_path, std::ios_base::binary);
+  if (!os.good())
+  {
+    CONSOLE_BRIDGE_logError("saveQueryLog, failed to open file '%s'!", file_path.c_str());
+    return false;
+  }
+
+  const QueryLogHeader header;
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os);
+    oa << boost::serialization::make_nvp("queries", queries);
+  }
+
+  return os.good();
+}
+
+bool loadQueryLog(const std::string& file_path, std::vector<RecordedQuery>& queries)
+{
+  std::ifstream is(file_path, std::ios_base::binary);
+  if (!is.good())
+  {
+    CONSOLE_BRIDGE_logError("loadQueryLog, failed to open file '%s'!", file_path.c_str());
+    return false;
+  }
+
+  QueryLogHeader header;
+  const QueryLogHeader expected;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));  // NOLINT
+  if (!is.good() || std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0)
+  {
+    CONSOLE_BRIDGE_logError("loadQueryLog, the file '%s' is not a query log!", file_path.c_str());
+    return false;
+  }
+
+  if (header.version != QUERY_LOG_VERSION)
+  {
+    CONSOLE_BRIDGE_logError("loadQueryLog, the log version %u is not supported, expected version %u!",
+                            header.version,
+                            QUERY_LOG_VERSION);
+    return false;
+  }
+
+  try
+  {
+    boost::archive::binary_iarchive ia(is);
+    ia >> boost::serialization::make_nvp("queries", queries);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("loadQueryLog, failed to read the queries: %s", e.what());
+    return false;
+  }
+
+  return true;
+}
+}  // namespace tesseract_environment
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_SAVE_LOAD_ARCHIVES_INSTANTIATE(tesseract_environment::RecordedQuery)
@@ -0,0 +1,188 @@
+/**
+ * @file query_replayer.cpp
+ * @brief Replays recorded queries against an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/query_replayer.h>
+#include <tesseract_environment/utils.h>
+
+namespace tesseract_environment
+{
+QueryReplayer::QueryReplayer(Environment::Ptr env) : env_(std::move(env))
+{
+  if (env_ == nullptr || !env_->isInitialized())
+    throw std::runtime_error("QueryReplayer, the environment is not initialized!");
+
+  revision_ = env_->getRevision();
+}
+
+bool QueryReplayer::replay(const RecordedQuery& query)
+{
+  if (query.revision != revision_ && !revision_reported_)
+  {
+    CONSOLE_BRIDGE_logWarn("QueryReplayer, a query was recorded at revision %d but is replayed at revision %d!",
+                           query.revision,
+                           revision_);
+    revision_reported_ = true;
+  }
+
+  try
+  {
+    switch (query.type)
+    {
+      case RecordedQueryType::SET_STATE:
+        env_->setState(query.joint_names, query.joint_values);
+        state_changed_ = true;
+        return true;
+      case RecordedQueryType::CONTACT_TEST:
+        return replayContactTest(query);
+      case RecordedQueryType::CHECK_TRAJECTORY:
+        return replayCheckTrajectory(query);
+      case RecordedQueryType::CALC_INV_KIN:
+        return replayCalcInvKin(query);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("QueryReplayer, failed to replay a query: %s", e.what());
+    return false;
+  }
+
+  CONSOLE_BRIDGE_logError("QueryReplayer, unknown query type %d!", static_cast<int>(query.type));
+  return false;
+}
+
+std::size_t QueryReplayer::replay(const std::vector<RecordedQuery>& queries)
+{
+  std::size_t replayed{ 0 };
+  for (const auto& query : queries)
+  {
+    if (replay(query))
+      ++replayed;
+  }
+
+  return replayed;
+}
+
+const Environment::Ptr& QueryReplayer::getEnvironment() const { return env_; }
+
+const QueryContext& QueryReplayer::getContext() const { return context_; }
+
+void QueryReplayer::updateManagers()
+{
+  if (discrete_manager_ == nullptr)
+  {
+    discrete_manager_ = env_->getDiscreteContactManager();
+    discrete_active_ = discrete_manager_->getActiveCollisionObjects();
+  }
+
+  if (continuous_manager_ == nullptr)
+  {
+    continuous_manager_ = env_->getContinuousContactManager();
+    continuous_active_ = continuous_manager_->getActiveCollisionObjects();
+  }
+
+  if (!state_changed_)
+    return;
+
+  const tesseract_scene_graph::SceneState state = env_->getState();
+  discrete_manager_->setCollisionObjectsTransform(state.link_transforms);
+  continuous_manager_->setCollisionObjectsTransform(state.link_transforms);
+  state_changed_ = false;
+}
+
+bool QueryReplayer::replayContactTest(const RecordedQuery& query)
+{
+  updateManagers();
+
+  const std::vector<std::string>& active =
+      query.active_link_names.empty() ? env_->getActiveLinkNames() : query.active_link_names;
+  if (active != discrete_active_)
+  {
+    discrete_manager_->setActiveCollisionObjects(active);
+    discrete_active_ = active;
+  }
+
+  const tesseract_scene_graph::SceneState state = env_->getState(query.joint_names, query.joint_values);
+  discrete_manager_->setCollisionObjectsTransform(state.link_transforms);
+
+  // The objects are moved back to the current state of the environment by the next query using the managers
+  state_changed_ = true;
+
+  context_.contacts.clear();
+  discrete_manager_->contactTest(context_.contacts, query.contact_request);
+  return true;
+}
+
+bool QueryReplayer::replayCheckTrajectory(const RecordedQuery& query)
+{
+  if (query.config.type == tesseract_collision::CollisionEvaluatorType::NONE)
+    return true;
+
+  updateManagers();
+
+  PooledJointGroup joint_group = env_->checkoutJointGroup(query.group_name);
+  const std::vector<std::string> active = joint_group->getActiveLinkNames();
+
+  trajectory_contacts_.clear();
+  if (query.config.type == tesseract_collision::CollisionEvaluatorType::DISCRETE ||
+      query.config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  {
+    if (active != discrete_active_)
+    {
+      discrete_manager_->setActiveCollisionObjects(active);
+      discrete_active_ = active;
+    }
+
+    checkTrajectory(trajectory_contacts_, *discrete_manager_, *joint_group, query.trajectory, query.config);
+    return true;
+  }
+
+  if (active != continuous_active_)
+  {
+    continuous_manager_->setActiveCollisionObjects(active);
+    continuous_active_ = active;
+  }
+
+  checkTrajectory(trajectory_contacts_, *continuous_manager_, *joint_group, query.trajectory, query.config);
+  return true;
+}
+
+bool QueryReplayer::replayCalcInvKin(const RecordedQuery& query)
+{
+  PooledKinematicGroup kin_group = env_->checkoutKinematicGroup(query.group_name);
+  if (kin_group == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("QueryReplayer, failed to get the kinematic group '%s'!", query.group_name.c_str());
+    return false;
+  }
+
+  kin_group->calcInvKin(ik_solutions_, query.ik_inputs, query.joint_values);
+  return true;
+}
+}  // namespace tesseract_environment
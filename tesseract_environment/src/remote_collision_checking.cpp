@@ -0,0 +1,464 @@
+/**
+ * @file remote_collision_checking.cpp
+ * @brief Distributes batches of contact tests and trajectory checks over collision checking servers
+ *
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/remote_collision_checking.h>
+#include <tesseract_environment/utils.h>
+#include <tesseract_collision/core/utils.h>
+#include <tesseract_common/eigen_serialization.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+void saveContactResult(boost::archive::binary_oarchive& oa, const tesseract_collision::ContactResult& contact)
+{
+  oa << contact.distance;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    auto cc_type = static_cast<int>(contact.cc_type[i]);
+    oa << contact.type_id[i] << contact.link_names[i] << contact.link_handles[i] << contact.shape_id[i]
+       << contact.subshape_id[i] << contact.nearest_points[i] << contact.nearest_points_local[i]
+       << contact.transform[i] << contact.cc_time[i] << cc_type << contact.cc_transform[i];
+  }
+  oa << contact.normal << contact.single_contact_point;
+}
+
+void loadContactResult(boost::archive::binary_iarchive& ia, tesseract_collision::ContactResult& contact)
+{
+  ia >> contact.distance;
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    int cc_type{ 0 };
+    ia >> contact.type_id[i] >> contact.link_names[i] >> contact.link_handles[i] >> contact.shape_id[i] >>
+        contact.subshape_id[i] >> contact.nearest_points[i] >> contact.nearest_points_local[i] >>
+        contact.transform[i] >> contact.cc_time[i] >> cc_type >> contact.cc_transform[i];
+    contact.cc_type[i] = static_cast<tesseract_collision::ContinuousCollisionType>(cc_type);
+  }
+  ia >> contact.normal >> contact.single_contact_point;
+}
+
+void saveContacts(boost::archive::binary_oarchive& oa, const tesseract_collision::ContactResultMap& contacts)
+{
+  std::size_t pair_count = contacts.size();
+  oa << pair_count;
+  for (const auto& pair : contacts)
+  {
+    std::size_t contact_count = pair.second.size();
+    oa << pair.first.first << pair.first.second << contact_count;
+    for (const auto& contact : pair.second)
+      saveContactResult(oa, contact);
+  }
+}
+
+void loadContacts(boost::archive::binary_iarchive& ia, tesseract_collision::ContactResultMap& contacts)
+{
+  contacts.clear();
+  std::size_t pair_count{ 0 };
+  ia >> pair_count;
+  for (std::size_t i = 0; i < pair_count; ++i)
+  {
+    tesseract_collision::ContactResultMap::KeyType key;
+    std::size_t contact_count{ 0 };
+    ia >> key.first >> key.second >> contact_count;
+    tesseract_collision::ContactResultVector& pair_contacts = contacts[key];
+    pair_contacts.resize(contact_count);
+    for (auto& contact : pair_contacts)
+      loadContactResult(ia, contact);
+  }
+}
+
+/** @brief Get the unchecked results of queries */
+std::vector<RemoteCollisionResult> getUncheckedResults(std::size_t count, const std::string& message)
+{
+  std::vector<RemoteCollisionResult> results(count);
+  for (auto& result : results)
+    result.message = message;
+
+  return results;
+}
+}  // namespace
+
+std::string encodeRemoteCollisionRequest(const RemoteCollisionRequest& request)
+{
+  const std::string delta = encodeEnvironmentDelta(request.delta);
+  std::ostringstream os;
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << request.revision << delta << request.queries;
+  }
+  return os.str();
+}
+
+bool decodeRemoteCollisionRequest(RemoteCollisionRequest& request, const std::string& data)
+{
+  std::string delta;
+  try
+  {
+    std::istringstream is(data);
+    boost::archive::binary_iarchive ia(is, boost::archive::no_header);
+    ia >> request.revision >> delta >> request.queries;
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("decodeRemoteCollisionRequest, failed to decode the message: %s", e.what());
+    return false;
+  }
+
+  return decodeEnvironmentDelta(request.delta, delta);
+}
+
+std::string encodeRemoteCollisionResponse(const RemoteCollisionResponse& response)
+{
+  std::ostringstream os;
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    std::size_t result_count = response.results.size();
+    oa << response.revision << response.message << result_count;
+    for (const auto& result : response.results)
+    {
+      std::size_t step_count = result.contacts.size();
+      oa << result.checked << result.in_collision << result.message << step_count;
+      for (const auto& contacts : result.contacts)
+        saveContacts(oa, contacts);
+    }
+  }
+  return os.str();
+}
+
+bool decodeRemoteCollisionResponse(RemoteCollisionResponse& response, const std::string& data)
+{
+  try
+  {
+    std::istringstream is(data);
+    boost::archive::binary_iarchive ia(is, boost::archive::no_header);
+    std::size_t result_count{ 0 };
+    ia >> response.revision >> response.message >> result_count;
+    response.results.resize(result_count);
+    for (auto& result : response.results)
+    {
+      std::size_t step_count{ 0 };
+      ia >> result.checked >> result.in_collision >> result.message >> step_count;
+      result.contacts.resize(step_count);
+      for (auto& contacts : result.contacts)
+        loadContacts(ia, contacts);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("decodeRemoteCollisionResponse, failed to decode the message: %s", e.what());
+    return false;
+  }
+
+  return true;
+}
+
+/** @brief The contact managers of a worker of a server, taken from the environment at a revision */
+struct RemoteCollisionServer::Worker
+{
+  /** @brief The revision of the environment the objects were taken from */
+  int revision{ -1 };
+
+  tesseract_scene_graph::StateSolver::UPtr state_solver;
+
+  /** @brief The contact managers are only taken once a query needs them */
+  tesseract_collision::DiscreteContactManager::UPtr discrete_manager;
+  std::vector<std::string> discrete_active;
+  tesseract_collision::ContinuousContactManager::UPtr continuous_manager;
+  std::vector<std::string> continuous_active;
+
+  /** @brief Take the objects from the environment again if it changed */
+  void sync(const Environment& env)
+  {
+    if (revision == env.getRevision())
+      return;
+
+    revision = env.getRevision();
+    state_solver = env.getStateSolver();
+    discrete_manager = nullptr;
+    discrete_active.clear();
+    continuous_manager = nullptr;
+    continuous_active.clear();
+  }
+
+  tesseract_collision::DiscreteContactManager& getDiscreteManager(const Environment& env,
+                                                                  const std::vector<std::string>& active)
+  {
+    if (discrete_manager == nullptr)
+      discrete_manager = env.getDiscreteContactManager();
+
+    if (discrete_manager == nullptr)
+      throw std::runtime_error("The environment does not have a discrete contact manager");
+
+    if (active != discrete_active)
+    {
+      discrete_manager->setActiveCollisionObjects(active);
+      discrete_active = active;
+    }
+    return *discrete_manager;
+  }
+
+  tesseract_collision::ContinuousContactManager& getContinuousManager(const Environment& env,
+                                                                      const std::vector<std::string>& active)
+  {
+    if (continuous_manager == nullptr)
+      continuous_manager = env.getContinuousContactManager();
+
+    if (continuous_manager == nullptr)
+      throw std::runtime_error("The environment does not have a continuous contact manager");
+
+    if (active != continuous_active)
+    {
+      continuous_manager->setActiveCollisionObjects(active);
+      continuous_active = active;
+    }
+    return *continuous_manager;
+  }
+
+  /** @brief Check a query, the default active links are the active links of the environment */
+  RemoteCollisionResult check(const Environment& env,
+                              const RecordedQuery& query,
+                              const std::vector<std::string>& default_active)
+  {
+    RemoteCollisionResult result;
+    try
+    {
+      if (query.type == RecordedQueryType::CONTACT_TEST)
+      {
+        const std::vector<std::string>& active =
+            query.active_link_names.empty() ? default_active : query.active_link_names;
+        tesseract_collision::DiscreteContactManager& manager = getDiscreteManager(env, active);
+        const tesseract_scene_graph::SceneState state = state_solver->getState(query.joint_names, query.joint_values);
+        manager.setCollisionObjectsTransform(state.link_transforms);
+
+        result.contacts.resize(1);
+        manager.contactTest(result.contacts.front(), query.contact_request);
+        result.in_collision = !result.contacts.front().empty();
+      }
+      else if (query.type == RecordedQueryType::CHECK_TRAJECTORY)
+      {
+        PooledJointGroup joint_group = env.checkoutJointGroup(query.group_name);
+        const std::vector<std::string> active = joint_group->getActiveLinkNames();
+        const tesseract_collision::CollisionEvaluatorType type = query.config.type;
+        if (type == tesseract_collision::CollisionEvaluatorType::DISCRETE ||
+            type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+        {
+          tesseract_collision::DiscreteContactManager& manager = getDiscreteManager(env, active);
+          tesseract_collision::ContactManagerConfigGuard<tesseract_collision::DiscreteContactManager> guard(
+              manager, query.config.contact_manager_config);
+          result.in_collision = checkTrajectory(result.contacts, manager, *joint_group, query.trajectory, query.config);
+        }
+        else if (type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
+                 type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+        {
+          tesseract_collision::ContinuousContactManager& manager = getContinuousManager(env, active);
+          tesseract_collision::ContactManagerConfigGuard<tesseract_collision::ContinuousContactManager> guard(
+              manager, query.config.contact_manager_config);
+          result.in_collision = checkTrajectory(result.contacts, manager, *joint_group, query.trajectory, query.config);
+        }
+        else
+        {
+          throw std::runtime_error("The collision evaluator type is not supported");
+        }
+      }
+      else
+      {
+        throw std::runtime_error("The query is not a contact test or a trajectory check");
+      }
+    }
+    catch (const std::exception& e)
+    {
+      result = RemoteCollisionResult();
+      result.message = e.what();
+      return result;
+    }
+
+    result.checked = true;
+    return result;
+  }
+};
+
+RemoteCollisionServer::RemoteCollisionServer(Environment::Ptr env, tesseract_common::Executor::Ptr executor)
+  : env_(std::move(env)), executor_(std::move(executor))
+{
+  if (env_ == nullptr)
+    throw std::runtime_error("RemoteCollisionServer, the environment is a nullptr!");
+
+  if (executor_ == nullptr)
+    executor_ = tesseract_common::getDefaultExecutor();
+}
+
+RemoteCollisionServer::~RemoteCollisionServer() = default;
+
+RemoteCollisionResponse RemoteCollisionServer::handle(const RemoteCollisionRequest& request)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  RemoteCollisionResponse response;
+  if (request.delta.from_revision != request.delta.revision || !request.delta.commands.empty())
+  {
+    // A delta from revision zero may replace the environment with one of the same revision, so nothing is reused
+    applyEnvironmentDelta(*env_, request.delta);
+    workers_.clear();
+  }
+
+  response.revision = env_->getRevision();
+  if (!env_->isInitialized() || response.revision != request.revision)
+  {
+    response.message = "The environment is at revision " + std::to_string(response.revision) +
+                       " and must be synchronized from revision zero";
+    return response;
+  }
+
+  const std::size_t num_workers = std::min(executor_->getConcurrency(), request.queries.size());
+  while (workers_.size() < num_workers)
+    workers_.push_back(std::make_unique<Worker>());
+
+  for (std::size_t i = 0; i < num_workers; ++i)
+    workers_[i]->sync(*env_);
+
+  const std::vector<std::string> default_active = env_->getActiveLinkNames();
+  response.results.resize(request.queries.size());
+  std::atomic<std::size_t> next{ 0 };
+  executor_->parallelFor(num_workers, [&](std::size_t worker_idx) {
+    for (std::size_t i = next++; i < request.queries.size(); i = next++)
+      response.results[i] = workers_[worker_idx]->check(*env_, request.queries[i], default_active);
+  });
+
+  return response;
+}
+
+std::string RemoteCollisionServer::handle(const std::string& data)
+{
+  RemoteCollisionRequest request;
+  if (!decodeRemoteCollisionRequest(request, data))
+  {
+    RemoteCollisionResponse response;
+    response.revision = env_->getRevision();
+    response.message = "The request could not be decoded";
+    return encodeRemoteCollisionResponse(response);
+  }
+
+  return encodeRemoteCollisionResponse(handle(request));
+}
+
+const Environment::Ptr& RemoteCollisionServer::getEnvironment() const { return env_; }
+
+RemoteCollisionClient::RemoteCollisionClient(Environment::ConstPtr env,
+                                             std::vector<RemoteCollisionTransportFn> servers,
+                                             tesseract_common::Executor::Ptr executor)
+  : env_(std::move(env)), servers_(std::move(servers)), executor_(std::move(executor))
+{
+  if (env_ == nullptr)
+    throw std::runtime_error("RemoteCollisionClient, the environment is a nullptr!");
+
+  if (servers_.empty())
+    throw std::runtime_error("RemoteCollisionClient, at least one server is required!");
+
+  if (executor_ == nullptr)
+    executor_ = tesseract_common::getDefaultExecutor();
+
+  server_revisions_.resize(servers_.size(), 0);
+}
+
+std::vector<RemoteCollisionResult> RemoteCollisionClient::check(const std::vector<RecordedQuery>& queries)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<RemoteCollisionResult> results(queries.size());
+  const std::size_t num_shards = std::min(servers_.size(), queries.size());
+  executor_->parallelFor(
+      num_shards,
+      [&](std::size_t shard) {
+        const auto begin = static_cast<long>((shard * queries.size()) / num_shards);
+        const auto end = static_cast<long>(((shard + 1) * queries.size()) / num_shards);
+        std::vector<RemoteCollisionResult> shard_results =
+            checkShard(shard, std::vector<RecordedQuery>(queries.begin() + begin, queries.begin() + end));
+        std::move(shard_results.begin(), shard_results.end(), results.begin() + begin);
+      },
+      num_shards);
+
+  return results;
+}
+
+std::size_t RemoteCollisionClient::getServerCount() const { return servers_.size(); }
+
+const Environment::ConstPtr& RemoteCollisionClient::getEnvironment() const { return env_; }
+
+std::vector<RemoteCollisionResult> RemoteCollisionClient::checkShard(std::size_t server,
+                                                                     std::vector<RecordedQuery> queries)
+{
+  const std::size_t count = queries.size();
+  RemoteCollisionRequest request;
+  request.queries = std::move(queries);
+
+  // A second attempt synchronizes the server from revision zero if its revision did not match
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    request.delta = getEnvironmentDelta(*env_, server_revisions_[server]);
+    request.revision = request.delta.revision;
+
+    RemoteCollisionResponse response;
+    try
+    {
+      if (!decodeRemoteCollisionResponse(response, servers_[server](encodeRemoteCollisionRequest(request))))
+        throw std::runtime_error("The response could not be decoded");
+    }
+    catch (const std::exception& e)
+    {
+      server_revisions_[server] = 0;
+      CONSOLE_BRIDGE_logError("RemoteCollisionClient, server %d failed: %s", static_cast<int>(server), e.what());
+      return getUncheckedResults(count, std::string("The server failed: ") + e.what());
+    }
+
+    if (response.revision == request.revision && response.results.size() == count)
+    {
+      server_revisions_[server] = response.revision;
+      return std::move(response.results);
+    }
+
+    server_revisions_[server] = 0;
+    if (attempt > 0)
+      return getUncheckedResults(count, "The server could not be synchronized: " + response.message);
+  }
+
+  return getUncheckedResults(count, "The server could not be synchronized");
+}
+
+}  // namespace tesseract_environment
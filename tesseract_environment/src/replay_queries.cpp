@@ -0,0 +1,149 @@
+/**
+ * @file replay_queries.cpp
+ * @brief Replays a query log against an environment image and reports the time of each type of query
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/utils.h>
+#include <tesseract_environment/environment_image.h>
+#include <tesseract_environment/query_replayer.h>
+
+namespace
+{
+const int SUCCESS = 0;
+const int ERROR_IN_COMMAND_LINE = 1;
+const int ERROR_UNHANDLED_EXCEPTION = 2;
+
+const std::array<std::string, 4> QUERY_TYPE_NAMES{ "setState", "contactTest", "checkTrajectory", "calcInvKin" };
+
+/** @brief The replay time of a type of query */
+struct QueryTypeTime
+{
+  std::size_t count{ 0 };
+  std::size_t failed{ 0 };
+  double total{ 0 };
+  double max{ 0 };
+};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string image;
+  std::string log;
+  std::size_t iterations{ 1 };
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "image,e",
+      po::value<std::string>(&image)->required(),
+      "File path to the environment image, see saveEnvironmentImage.")(
+      "log,l", po::value<std::string>(&log)->required(), "File path to the query log, see QueryRecorder.")(
+      "iterations,n", po::value<std::size_t>(&iterations), "The number of times the log is replayed.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Replays a query log against an environment image and reports the time of each type of query"
+                << std::endl
+                << desc << std::endl;
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
+    std::cerr << desc << std::endl;
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  try
+  {
+    tesseract_environment::Environment::Ptr env = tesseract_environment::loadEnvironmentImage(image);
+    if (env == nullptr)
+    {
+      CONSOLE_BRIDGE_logError("Failed to load the environment image!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+
+    std::vector<tesseract_environment::RecordedQuery> queries;
+    if (!tesseract_environment::loadQueryLog(log, queries))
+    {
+      CONSOLE_BRIDGE_logError("Failed to load the query log!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+
+    tesseract_environment::QueryReplayer replayer(env);
+    std::array<QueryTypeTime, QUERY_TYPE_NAMES.size()> times;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      for (const auto& query : queries)
+      {
+        const auto start = std::chrono::steady_clock::now();
+        const bool replayed = replayer.replay(query);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        QueryTypeTime& time = times.at(static_cast<std::size_t>(query.type));
+        ++time.count;
+        time.failed += replayed ? 0 : 1;
+        time.total += elapsed;
+        time.max = std::max(time.max, elapsed);
+      }
+    }
+
+    std::cout << "Replayed " << queries.size() << " queries " << iterations << " times" << std::endl;
+    for (std::size_t i = 0; i < times.size(); ++i)
+    {
+      const QueryTypeTime& time = times.at(i);
+      if (time.count == 0)
+        continue;
+
+      std::cout << QUERY_TYPE_NAMES.at(i) << ": count " << time.count << ", failed " << time.failed << ", total "
+                << time.total * 1e3 << " ms, mean " << (time.total / static_cast<double>(time.count)) * 1e6
+                << " us, max " << time.max * 1e6 << " us" << std::endl;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    tesseract_common::printNestedException(e);
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return SUCCESS;
+}
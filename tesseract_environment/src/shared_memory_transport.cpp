@@ -0,0 +1,359 @@
+/**
+ * @file shared_memory_transport.cpp
+ * @brief Exchange scene states and trajectories between processes on one host through shared memory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/shared_memory_transport.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The number of doubles of a transform, its upper 3x4 matrix */
+constexpr std::size_t TRANSFORM_SIZE = 12;
+
+/** @brief The flags of a trajectory state telling which of its vectors are stored */
+constexpr uint64_t HAS_VELOCITY = 1;
+constexpr uint64_t HAS_ACCELERATION = 2;
+constexpr uint64_t HAS_EFFORT = 4;
+
+/** @brief Hash the names with FNV-1a, which unlike std::hash is the same in every process */
+uint64_t hashNames(uint64_t hash, const std::vector<std::string>& names)
+{
+  auto add = [&hash](const char* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      hash ^= static_cast<uint8_t>(data[i]);
+      hash *= 0x100000001B3;
+    }
+  };
+
+  for (const auto& name : names)
+    add(name.c_str(), name.size() + 1);
+
+  const uint64_t count = names.size();
+  add(reinterpret_cast<const char*>(&count), sizeof(count));  // NOLINT
+  return hash;
+}
+
+constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+
+/** @brief The number of bytes of a trajectory state */
+std::size_t getTrajectoryStateSize(std::size_t dof) { return sizeof(uint64_t) + ((1 + (4 * dof)) * sizeof(double)); }
+
+/** @brief The layout id of a trajectory ring buffer */
+uint64_t getTrajectoryLayoutId(const std::vector<std::string>& joint_names, std::size_t max_states)
+{
+  uint64_t id = hashNames(FNV_OFFSET_BASIS, joint_names);
+  return hashNames(id, { std::to_string(max_states) });
+}
+
+void writeTransform(uint8_t* data, const Eigen::Isometry3d& transform)
+{
+  const Eigen::Matrix<double, 3, 4> affine = transform.affine();
+  std::memcpy(data, affine.data(), TRANSFORM_SIZE * sizeof(double));
+}
+
+void readTransform(const uint8_t* data, Eigen::Isometry3d& transform)
+{
+  Eigen::Matrix<double, 3, 4> affine;
+  std::memcpy(affine.data(), data, TRANSFORM_SIZE * sizeof(double));
+  transform.affine() = affine;
+  transform.makeAffine();
+}
+
+void writeVector(uint8_t* data, const Eigen::VectorXd& values, std::size_t dof)
+{
+  if (static_cast<std::size_t>(values.size()) == dof)
+    std::memcpy(data, values.data(), dof * sizeof(double));
+}
+
+void readVector(const uint8_t* data, Eigen::VectorXd& values, std::size_t dof, bool stored)
+{
+  if (!stored)
+  {
+    values.resize(0);
+    return;
+  }
+
+  values.resize(static_cast<Eigen::Index>(dof));
+  std::memcpy(values.data(), data, dof * sizeof(double));
+}
+}  // namespace
+
+SceneStateLayout::SceneStateLayout(const Environment& env)
+  : active_joint_names(env.getActiveJointNames()), link_names(env.getLinkNames()), joint_names(env.getJointNames())
+{
+}
+
+std::size_t SceneStateLayout::getMessageSize() const
+{
+  return sizeof(int64_t) + (active_joint_names.size() * sizeof(double)) +
+         ((link_names.size() + joint_names.size()) * TRANSFORM_SIZE * sizeof(double));
+}
+
+uint64_t SceneStateLayout::getId() const
+{
+  uint64_t id = hashNames(FNV_OFFSET_BASIS, active_joint_names);
+  id = hashNames(id, link_names);
+  return hashNames(id, joint_names);
+}
+
+SceneStatePublisher::SceneStatePublisher(std::string name, SceneStateLayout layout, std::size_t slot_count)
+  : layout_(std::move(layout)), buffer_(std::move(name), layout_.getMessageSize(), slot_count, layout_.getId())
+{
+}
+
+const SceneStateLayout& SceneStatePublisher::getLayout() const { return layout_; }
+
+uint64_t SceneStatePublisher::publish(const tesseract_scene_graph::SceneState& state, int revision)
+{
+  return buffer_.write([this, &state, revision](uint8_t* data) {
+    const int64_t stored_revision = revision;
+    std::memcpy(data, &stored_revision, sizeof(stored_revision));
+    data += sizeof(stored_revision);
+
+    for (const auto& joint_name : layout_.active_joint_names)
+    {
+      auto it = state.joints.find(joint_name);
+      const double value = (it != state.joints.end()) ? it->second : std::numeric_limits<double>::quiet_NaN();
+      std::memcpy(data, &value, sizeof(double));
+      data += sizeof(double);
+    }
+
+    const Eigen::Isometry3d missing(Eigen::Matrix4d::Constant(std::numeric_limits<double>::quiet_NaN()));
+    auto write_transforms = [&data, &missing](const std::vector<std::string>& names,
+                                              const tesseract_common::TransformMap& transforms) {
+      for (const auto& name : names)
+      {
+        auto it = transforms.find(name);
+        writeTransform(data, (it != transforms.end()) ? it->second : missing);
+        data += TRANSFORM_SIZE * sizeof(double);
+      }
+    };
+    write_transforms(layout_.link_names, state.link_transforms);
+    write_transforms(layout_.joint_names, state.joint_transforms);
+  });
+}
+
+bool SceneStatePublisher::publish(const Environment& env)
+{
+  while (true)
+  {
+    const int revision = env.getRevision();
+    if (revision != checked_revision_)
+    {
+      if (SceneStateLayout(env).getId() != layout_.getId())
+      {
+        CONSOLE_BRIDGE_logDebug("SceneStatePublisher, the structure of the environment at revision %d does not match "
+                                "the layout!",
+                                revision);
+        return false;
+      }
+      checked_revision_ = revision;
+    }
+
+    // The revision is checked again in case the structure changed while the state was read
+    auto state = env.getStateSnapshot();
+    if (revision == env.getRevision())
+    {
+      publish(*state, revision);
+      return true;
+    }
+  }
+}
+
+SceneStateSubscriber::SceneStateSubscriber(std::string name, SceneStateLayout layout)
+  : layout_(std::move(layout)), buffer_(std::move(name), layout_.getId())
+{
+}
+
+const SceneStateLayout& SceneStateSubscriber::getLayout() const { return layout_; }
+
+uint64_t SceneStateSubscriber::getWriteSequence() const { return buffer_.getWriteSequence(); }
+
+bool SceneStateSubscriber::readLatest(tesseract_scene_graph::SceneState& state, int& revision, uint64_t* sequence) const
+{
+  int64_t stored_revision{ 0 };
+  bool read = buffer_.readLatest(
+      [this, &state, &stored_revision](const uint8_t* data) {
+        std::memcpy(&stored_revision, data, sizeof(stored_revision));
+        data += sizeof(stored_revision);
+
+        for (const auto& joint_name : layout_.active_joint_names)
+        {
+          std::memcpy(&state.joints[joint_name], data, sizeof(double));
+          data += sizeof(double);
+        }
+
+        for (const auto& link_name : layout_.link_names)
+        {
+          readTransform(data, state.link_transforms[link_name]);
+          data += TRANSFORM_SIZE * sizeof(double);
+        }
+
+        for (const auto& joint_name : layout_.joint_names)
+        {
+          readTransform(data, state.joint_transforms[joint_name]);
+          data += TRANSFORM_SIZE * sizeof(double);
+        }
+      },
+      sequence);
+
+  if (read)
+    revision = static_cast<int>(stored_revision);
+
+  return read;
+}
+
+bool SceneStateSubscriber::update(Environment& env) const
+{
+  int64_t revision{ 0 };
+  Eigen::VectorXd joint_values(static_cast<Eigen::Index>(layout_.active_joint_names.size()));
+  bool read = buffer_.readLatest([&revision, &joint_values](const uint8_t* data) {
+    std::memcpy(&revision, data, sizeof(revision));
+    std::memcpy(joint_values.data(),
+                data + sizeof(revision),
+                static_cast<std::size_t>(joint_values.size()) * sizeof(double));
+  });
+
+  if (!read)
+    return false;
+
+  if (env.getRevision() != revision)
+  {
+    CONSOLE_BRIDGE_logDebug("SceneStateSubscriber, the state is for revision %d but the environment is at revision %d!",
+                            static_cast<int>(revision),
+                            env.getRevision());
+    return false;
+  }
+
+  env.setState(layout_.active_joint_names, joint_values);
+  return true;
+}
+
+JointTrajectoryPublisher::JointTrajectoryPublisher(std::string name,
+                                                   std::vector<std::string> joint_names,
+                                                   std::size_t max_states,
+                                                   std::size_t slot_count)
+  : joint_names_(std::move(joint_names))
+  , max_states_(max_states)
+  , buffer_(std::move(name),
+            sizeof(uint64_t) + (max_states_ * getTrajectoryStateSize(joint_names_.size())),
+            slot_count,
+            getTrajectoryLayoutId(joint_names_, max_states_))
+{
+}
+
+uint64_t JointTrajectoryPublisher::publish(const tesseract_common::JointTrajectory& trajectory)
+{
+  if (trajectory.size() > max_states_)
+    throw std::runtime_error("JointTrajectoryPublisher, the trajectory has more than " + std::to_string(max_states_) +
+                             " states!");
+
+  const std::size_t dof = joint_names_.size();
+  auto matches = [dof](const Eigen::VectorXd& values) {
+    return (values.size() == 0 || static_cast<std::size_t>(values.size()) == dof);
+  };
+  for (const auto& state : trajectory)
+  {
+    if (state.joint_names != joint_names_ || static_cast<std::size_t>(state.position.size()) != dof ||
+        !matches(state.velocity) || !matches(state.acceleration) || !matches(state.effort))
+      throw std::runtime_error("JointTrajectoryPublisher, a state does not match the joint names!");
+  }
+
+  return buffer_.write([&trajectory, dof](uint8_t* data) {
+    const uint64_t count = trajectory.size();
+    std::memcpy(data, &count, sizeof(count));
+    data += sizeof(count);
+
+    for (const auto& state : trajectory)
+    {
+      uint64_t flags{ 0 };
+      flags |= (state.velocity.size() > 0) ? HAS_VELOCITY : 0;
+      flags |= (state.acceleration.size() > 0) ? HAS_ACCELERATION : 0;
+      flags |= (state.effort.size() > 0) ? HAS_EFFORT : 0;
+      std::memcpy(data, &flags, sizeof(flags));
+      std::memcpy(data + sizeof(flags), &state.time, sizeof(double));
+
+      uint8_t* values = data + sizeof(flags) + sizeof(double);
+      writeVector(values, state.position, dof);
+      writeVector(values + (dof * sizeof(double)), state.velocity, dof);
+      writeVector(values + (2 * dof * sizeof(double)), state.acceleration, dof);
+      writeVector(values + (3 * dof * sizeof(double)), state.effort, dof);
+      data += getTrajectoryStateSize(dof);
+    }
+  });
+}
+
+JointTrajectorySubscriber::JointTrajectorySubscriber(std::string name,
+                                                     std::vector<std::string> joint_names,
+                                                     std::size_t max_states)
+  : joint_names_(std::move(joint_names))
+  , max_states_(max_states)
+  , buffer_(std::move(name), getTrajectoryLayoutId(joint_names_, max_states_))
+{
+}
+
+uint64_t JointTrajectorySubscriber::getWriteSequence() const { return buffer_.getWriteSequence(); }
+
+bool JointTrajectorySubscriber::readLatest(tesseract_common::JointTrajectory& trajectory, uint64_t* sequence) const
+{
+  const std::size_t dof = joint_names_.size();
+  return buffer_.readLatest(
+      [this, &trajectory, dof](const uint8_t* data) {
+        uint64_t count{ 0 };
+        std::memcpy(&count, data, sizeof(count));
+        data += sizeof(count);
+
+        // The count may be garbage if the slot is overwritten while it is read, the read is then discarded
+        trajectory.states.resize(std::min<std::size_t>(count, max_states_));
+        for (auto& state : trajectory.states)
+        {
+          uint64_t flags{ 0 };
+          std::memcpy(&flags, data, sizeof(flags));
+          std::memcpy(&state.time, data + sizeof(flags), sizeof(double));
+          if (state.joint_names != joint_names_)
+            state.joint_names = joint_names_;
+
+          const uint8_t* values = data + sizeof(flags) + sizeof(double);
+          readVector(values, state.position, dof, true);
+          readVector(values + (dof * sizeof(double)), state.velocity, dof, (flags & HAS_VELOCITY) != 0);
+          readVector(values + (2 * dof * sizeof(double)), state.acceleration, dof, (flags & HAS_ACCELERATION) != 0);
+          readVector(values + (3 * dof * sizeof(double)), state.effort, dof, (flags & HAS_EFFORT) != 0);
+          data += getTrajectoryStateSize(dof);
+        }
+      },
+      sequence);
+}
+
+}  // namespace tesseract_environment
@@ -0,0 +1,239 @@
+/**
+ * @file swept_volume_broadphase.cpp
+ * @brief A coarse pass finding the collision object pairs which may be in contact along a trajectory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/swept_volume_broadphase.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_common/link_transforms.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief A pair of collision objects, the second is a static object or an active link */
+struct ObjectPair
+{
+  std::size_t link_index;
+  std::size_t other_index;
+  bool other_active;
+  double margin;
+
+  /** @brief The index of the candidate of the previous window, -1 if the pair did not overlap in it */
+  long candidate{ -1 };
+};
+
+Eigen::AlignedBox3d getInfiniteAABB()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  return { Eigen::Vector3d::Constant(-inf), Eigen::Vector3d::Constant(inf) };
+}
+
+/** @brief Grow a box by a distance in every direction */
+Eigen::AlignedBox3d grow(const Eigen::AlignedBox3d& aabb, double distance)
+{
+  if (aabb.isEmpty())
+    return aabb;
+
+  if (!std::isfinite(distance))
+    return getInfiniteAABB();
+
+  return { (aabb.min().array() - distance).matrix(), (aabb.max().array() + distance).matrix() };
+}
+
+/** @brief Check if two boxes are closer than a distance */
+bool overlap(const Eigen::AlignedBox3d& aabb1, const Eigen::AlignedBox3d& aabb2, double distance)
+{
+  if (aabb1.isEmpty() || aabb2.isEmpty())
+    return false;
+
+  return ((aabb1.min().array() <= aabb2.max().array() + distance).all() &&
+          (aabb2.min().array() <= aabb1.max().array() + distance).all());
+}
+}  // namespace
+
+std::vector<SweptVolumeCandidate>
+calcSweptVolumeCandidates(const tesseract_collision::ContinuousContactManager& manager,
+                          const tesseract_kinematics::JointGroup& manip,
+                          const tesseract_common::TrajArray& traj,
+                          long window_size)
+{
+  if (traj.rows() < 2)
+    throw std::runtime_error("calcSweptVolumeCandidates, the trajectory must have at least two states!");
+
+  if (window_size < 1)
+    throw std::runtime_error("calcSweptVolumeCandidates, the window size must be greater than zero!");
+
+  // The enabled active links and their bounding boxes in the link frame
+  std::vector<std::string> link_names;
+  std::vector<Eigen::AlignedBox3d> link_aabbs;
+  std::unordered_set<std::string> active_links;
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+  {
+    active_links.insert(link_name);
+    if (!manager.isCollisionObjectEnabled(link_name))
+      continue;
+
+    link_names.push_back(link_name);
+    link_aabbs.push_back(tesseract_collision::calcCollisionObjectAABB(
+        manager.getCollisionObjectGeometries(link_name), manager.getCollisionObjectGeometriesTransforms(link_name)));
+  }
+
+  // The enabled static objects and their bounding boxes in world
+  std::vector<std::string> static_names;
+  std::vector<Eigen::AlignedBox3d> static_aabbs;
+  for (const auto& name : manager.getCollisionObjects())
+  {
+    if (active_links.find(name) != active_links.end() || !manager.isCollisionObjectEnabled(name))
+      continue;
+
+    Eigen::AlignedBox3d aabb = tesseract_collision::calcCollisionObjectAABB(
+        manager.getCollisionObjectGeometries(name), manager.getCollisionObjectGeometriesTransforms(name));
+    if (aabb.isEmpty())
+      continue;
+
+    Eigen::Isometry3d pose;
+    static_names.push_back(name);
+    const bool has_pose = manager.getCollisionObjectTransform(name, pose);
+    static_aabbs.push_back(has_pose ? tesseract_collision::transformAABB(aabb, pose) : getInfiniteAABB());
+  }
+
+  // The bounding box of each active link at each state
+  const long num_segments = traj.rows() - 1;
+  const std::size_t num_links = link_names.size();
+  std::vector<Eigen::AlignedBox3d> state_aabbs(static_cast<std::size_t>(traj.rows()) * num_links);
+  tesseract_common::LinkTransforms link_transforms(std::make_shared<const tesseract_common::LinkNameTable>(link_names));
+  for (long i = 0; i < traj.rows(); ++i)
+  {
+    manip.calcFwdKin(link_transforms, traj.row(i));
+    for (std::size_t j = 0; j < num_links; ++j)
+      state_aabbs[(static_cast<std::size_t>(i) * num_links) + j] =
+          tesseract_collision::transformAABB(link_aabbs[j], link_transforms[j]);
+  }
+
+  // The box swept by each active link during each window and during the whole trajectory
+  const Eigen::VectorXd& motion_bounds = manip.getJointMotionBounds();
+  const long num_windows = (num_segments + window_size - 1) / window_size;
+  std::vector<Eigen::AlignedBox3d> window_aabbs(static_cast<std::size_t>(num_windows) * num_links);
+  std::vector<Eigen::AlignedBox3d> traj_aabbs(num_links);
+  for (long w = 0; w < num_windows; ++w)
+  {
+    const long first_segment = w * window_size;
+    const long last_segment = std::min(first_segment + window_size, num_segments) - 1;
+
+    // No point of a link moves further than this during a segment, a zero motion of an unbounded joint adds nothing
+    double max_motion{ 0 };
+    for (long s = first_segment; s <= last_segment; ++s)
+    {
+      const Eigen::VectorXd joint_motion = (traj.row(s + 1) - traj.row(s)).transpose().cwiseAbs();
+      double motion{ 0 };
+      for (Eigen::Index j = 0; j < joint_motion.size(); ++j)
+      {
+        if (joint_motion[j] > 0)
+          motion += motion_bounds[j] * joint_motion[j];
+      }
+      max_motion = std::max(max_motion, motion);
+    }
+
+    for (std::size_t j = 0; j < num_links; ++j)
+    {
+      Eigen::AlignedBox3d aabb;
+      for (long s = first_segment; s <= last_segment + 1; ++s)
+        aabb.extend(state_aabbs[(static_cast<std::size_t>(s) * num_links) + j]);
+
+      aabb = grow(aabb, max_motion / 2.0);
+      window_aabbs[(static_cast<std::size_t>(w) * num_links) + j] = aabb;
+      traj_aabbs[j].extend(aabb);
+    }
+  }
+
+  // The pairs which may be in contact at some point along the trajectory
+  const tesseract_collision::IsContactAllowedFn is_contact_allowed = manager.getIsContactAllowedFn();
+  const tesseract_common::CollisionMarginData& margin_data = manager.getCollisionMarginData();
+  auto is_allowed = [&is_contact_allowed](const std::string& name1, const std::string& name2) {
+    return (is_contact_allowed != nullptr && is_contact_allowed(name1, name2));
+  };
+
+  std::vector<ObjectPair> pairs;
+  for (std::size_t i = 0; i < num_links; ++i)
+  {
+    for (std::size_t j = 0; j < static_names.size(); ++j)
+    {
+      const double margin = margin_data.getPairCollisionMargin(link_names[i], static_names[j]);
+      if (!is_allowed(link_names[i], static_names[j]) && overlap(traj_aabbs[i], static_aabbs[j], margin))
+        pairs.push_back({ i, j, false, margin });
+    }
+
+    for (std::size_t j = i + 1; j < num_links; ++j)
+    {
+      const double margin = margin_data.getPairCollisionMargin(link_names[i], link_names[j]);
+      if (!is_allowed(link_names[i], link_names[j]) && overlap(traj_aabbs[i], traj_aabbs[j], margin))
+        pairs.push_back({ i, j, true, margin });
+    }
+  }
+
+  // The windows during which each pair may be in contact
+  std::vector<SweptVolumeCandidate> candidates;
+  for (long w = 0; w < num_windows; ++w)
+  {
+    const long first_segment = w * window_size;
+    const long last_segment = std::min(first_segment + window_size, num_segments) - 1;
+    const Eigen::AlignedBox3d* aabbs = &window_aabbs[static_cast<std::size_t>(w) * num_links];
+    for (auto& pair : pairs)
+    {
+      const Eigen::AlignedBox3d& other_aabb =
+          pair.other_active ? aabbs[pair.other_index] : static_aabbs[pair.other_index];
+      if (!overlap(aabbs[pair.link_index], other_aabb, pair.margin))
+      {
+        pair.candidate = -1;
+        continue;
+      }
+
+      if (pair.candidate >= 0)
+      {
+        candidates[static_cast<std::size_t>(pair.candidate)].last_segment = last_segment;
+        continue;
+      }
+
+      SweptVolumeCandidate candidate;
+      candidate.link_name = link_names[pair.link_index];
+      candidate.other_name = pair.other_active ? link_names[pair.other_index] : static_names[pair.other_index];
+      candidate.first_segment = first_segment;
+      candidate.last_segment = last_segment;
+      pair.candidate = static_cast<long>(candidates.size());
+      candidates.push_back(std::move(candidate));
+    }
+  }
+
+  return candidates;
+}
+
+}  // namespace tesseract_environment
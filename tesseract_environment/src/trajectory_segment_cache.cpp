@@ -0,0 +1,186 @@
+/**
+ * @file trajectory_segment_cache.cpp
+ * @brief A cache of continuous collision check results for trajectory segments
+ *
+ * @date October 14, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <mutex>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/common.h>
+#include <tesseract_environment/trajectory_segment_cache.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+void hashCombine(std::size_t& seed, std::size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); }
+}  // namespace
+
+bool TrajectorySegmentCache::Key::operator==(const Key& rhs) const
+{
+  return (type == rhs.type && calculate_penetration == rhs.calculate_penetration &&
+          calculate_distance == rhs.calculate_distance && contact_limit == rhs.contact_limit && detail == rhs.detail &&
+          transforms == rhs.transforms);
+}
+
+std::size_t TrajectorySegmentCache::KeyHash::operator()(const Key& key) const
+{
+  std::size_t seed{ 0 };
+  hashCombine(seed, std::hash<int>()(static_cast<int>(key.type)));
+  hashCombine(seed, std::hash<bool>()(key.calculate_penetration));
+  hashCombine(seed, std::hash<bool>()(key.calculate_distance));
+  hashCombine(seed, std::hash<long>()(key.contact_limit));
+  hashCombine(seed, std::hash<int>()(static_cast<int>(key.detail)));
+  for (const double& value : key.transforms)
+    hashCombine(seed, std::hash<double>()(value));
+
+  return seed;
+}
+
+TrajectorySegmentCache::TrajectorySegmentCache(std::size_t cache_size) : cache_size_(cache_size) {}
+
+bool TrajectorySegmentCache::get(tesseract_collision::ContactResultMap& results,
+                                 const tesseract_collision::ContinuousContactManager& manager,
+                                 const tesseract_common::TransformMap& state0,
+                                 const tesseract_common::TransformMap& state1,
+                                 const tesseract_collision::ContactRequest& contact_request) const
+{
+  Key key;
+  if (!createKey(key, manager.getActiveCollisionObjects(), state0, state1, contact_request))
+    return false;
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  if (cache_.empty() || !isCurrent(manager))
+    return false;
+
+  auto it = cache_.find(key);
+  if (it == cache_.end())
+    return false;
+
+  results = it->second;
+  return true;
+}
+
+void TrajectorySegmentCache::insert(const tesseract_collision::ContinuousContactManager& manager,
+                                    const tesseract_common::TransformMap& state0,
+                                    const tesseract_common::TransformMap& state1,
+                                    const tesseract_collision::ContactRequest& contact_request,
+                                    const tesseract_collision::ContactResultMap& results)
+{
+  Key key;
+  if (!createKey(key, manager.getActiveCollisionObjects(), state0, state1, contact_request))
+    return;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (cache_size_ == 0)
+    return;
+
+  if (!isCurrent(manager))
+  {
+    cache_.clear();
+    order_.clear();
+    active_links_ = manager.getActiveCollisionObjects();
+    margin_data_ = manager.getCollisionMarginData();
+    acm_ = tesseract_collision::getCompiledAllowedCollisionMatrix(manager.getIsContactAllowedFn());
+  }
+
+  auto it = cache_.emplace(std::move(key), results);
+  if (!it.second)
+    return;
+
+  order_.push_back(&it.first->first);
+  shrinkHelper();
+}
+
+void TrajectorySegmentCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  cache_.clear();
+  order_.clear();
+}
+
+std::size_t TrajectorySegmentCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cache_.size();
+}
+
+void TrajectorySegmentCache::setCacheSize(std::size_t size)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  cache_size_ = size;
+  shrinkHelper();
+}
+
+std::size_t TrajectorySegmentCache::getCacheSize() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cache_size_;
+}
+
+bool TrajectorySegmentCache::isCurrent(const tesseract_collision::ContinuousContactManager& manager) const
+{
+  return (manager.getActiveCollisionObjects() == active_links_ && manager.getCollisionMarginData() == margin_data_ &&
+          tesseract_collision::getCompiledAllowedCollisionMatrix(manager.getIsContactAllowedFn()) == acm_);
+}
+
+bool TrajectorySegmentCache::createKey(Key& key,
+                                       const std::vector<std::string>& active_links,
+                                       const tesseract_common::TransformMap& state0,
+                                       const tesseract_common::TransformMap& state1,
+                                       const tesseract_collision::ContactRequest& contact_request)
+{
+  // The results depend on the validation function which can not be compared
+  if (contact_request.is_valid != nullptr)
+    return false;
+
+  key.type = contact_request.type;
+  key.calculate_penetration = contact_request.calculate_penetration;
+  key.calculate_distance = contact_request.calculate_distance;
+  key.contact_limit = contact_request.contact_limit;
+  key.detail = contact_request.detail;
+
+  key.transforms.reserve(active_links.size() * 32);
+  for (const auto& link_name : active_links)
+  {
+    const Eigen::Matrix4d& pose0 = state0.at(link_name).matrix();
+    const Eigen::Matrix4d& pose1 = state1.at(link_name).matrix();
+    key.transforms.insert(key.transforms.end(), pose0.data(), pose0.data() + pose0.size());
+    key.transforms.insert(key.transforms.end(), pose1.data(), pose1.data() + pose1.size());
+  }
+
+  return true;
+}
+
+void TrajectorySegmentCache::shrinkHelper()
+{
+  while (cache_.size() > cache_size_)
+  {
+    cache_.erase(cache_.find(*order_.front()));
+    order_.pop_front();
+  }
+}
+}  // namespace tesseract_environment
@@ -0,0 +1,471 @@
+/**
+ * @file trajectory_validator.cpp
+ * @brief A pool of workers validating trajectories against an environment
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/trajectory_validator.h>
+#include <tesseract_environment/utils.h>
+#include <tesseract_collision/core/utils.h>
+
+namespace tesseract_environment
+{
+namespace
+{
+/** @brief The objects of a worker, taken from the environment at a revision */
+struct Worker
+{
+  /** @brief The revision of the environment the objects were taken from */
+  int revision{ -1 };
+
+  tesseract_scene_graph::StateSolver::UPtr state_solver;
+
+  /** @brief The contact managers are only taken once a request needs them */
+  tesseract_collision::DiscreteContactManager::UPtr discrete_manager;
+  tesseract_collision::ContinuousContactManager::UPtr continuous_manager;
+  bool has_discrete_manager{ false };
+  bool has_continuous_manager{ false };
+};
+
+/** @brief Update the objects of the worker to the revision of the environment if it changed */
+void syncWorker(Worker& worker, const Environment& env, bool discrete)
+{
+  while (true)
+  {
+    // The revision is read before the objects, so if it did not change afterwards they are from this revision
+    const int revision = env.getRevision();
+    if (revision != worker.revision)
+    {
+      worker.revision = revision;
+      worker.state_solver = env.getStateSolver();
+      worker.discrete_manager = nullptr;
+      worker.continuous_manager = nullptr;
+      worker.has_discrete_manager = false;
+      worker.has_continuous_manager = false;
+    }
+
+    if (discrete && !worker.has_discrete_manager)
+    {
+      worker.discrete_manager = env.getDiscreteContactManager();
+      worker.has_discrete_manager = true;
+    }
+    else if (!discrete && !worker.has_continuous_manager)
+    {
+      worker.continuous_manager = env.getContinuousContactManager();
+      worker.has_continuous_manager = true;
+    }
+
+    if (env.getRevision() == worker.revision)
+      return;
+  }
+}
+
+/** @brief Check a trajectory and undo the contact manager config of the request, so the manager can be reused */
+template <typename ManagerType>
+bool checkRequest(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                  ManagerType& manager,
+                  const tesseract_scene_graph::StateSolver& state_solver,
+                  const TrajectoryValidationRequest& request)
+{
+  tesseract_collision::ContactManagerConfigGuard<ManagerType> guard(manager, request.config.contact_manager_config);
+  return checkTrajectory(contacts, manager, state_solver, request.joint_names, request.trajectory, request.config);
+}
+
+/**
+ * @brief Check a trajectory one step at a time, stopping when the token is cancelled
+ * @details The contact manager config is undone after each step, because checkTrajectoryStep applies it again
+ */
+template <typename ManagerType>
+std::vector<tesseract_collision::ContactResultMap> checkRequestSteps(ManagerType& manager,
+                                                                     const tesseract_scene_graph::StateSolver& solver,
+                                                                     const TrajectoryValidationRequest& request,
+                                                                     long num_steps,
+                                                                     const tesseract_common::CancellationToken& token)
+{
+  if (num_steps < 1)
+    throw std::runtime_error("AsyncContactChecker, the trajectory does not have enough states to check.");
+
+  const bool stop_on_first = (request.config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+  std::vector<tesseract_collision::ContactResultMap> contacts(static_cast<std::size_t>(num_steps));
+  tesseract_collision::ContactManagerConfigGuard<ManagerType> guard(manager, request.config.contact_manager_config);
+  for (long step = 0; step < num_steps; ++step)
+  {
+    token.throwIfCancelled("AsyncContactChecker, the trajectory check was cancelled.");
+    const bool found = checkTrajectoryStep(contacts[static_cast<std::size_t>(step)],
+                                           manager,
+                                           solver,
+                                           request.joint_names,
+                                           request.trajectory,
+                                           step,
+                                           request.config);
+    guard.restore();
+    if (found && stop_on_first)
+      break;
+  }
+
+  return contacts;
+}
+
+/** @brief Check if the config selects a discrete check, throws if its type is not supported */
+bool isDiscreteCheck(const tesseract_collision::CollisionCheckConfig& config)
+{
+  switch (config.type)
+  {
+    case tesseract_collision::CollisionEvaluatorType::DISCRETE:
+    case tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE:
+      return true;
+    case tesseract_collision::CollisionEvaluatorType::CONTINUOUS:
+    case tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS:
+      return false;
+    default:
+      throw std::runtime_error("AsyncContactChecker, the collision evaluator type is not supported.");
+  }
+}
+
+TrajectoryValidationResult validateRequest(Worker& worker,
+                                           const Environment& env,
+                                           const TrajectoryValidationRequest& request)
+{
+  TrajectoryValidationResult result;
+  const tesseract_collision::CollisionEvaluatorType type = request.config.type;
+  const bool discrete = (type == tesseract_collision::CollisionEvaluatorType::DISCRETE ||
+                         type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE);
+  const bool continuous = (type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
+                           type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS);
+  if (!discrete && !continuous)
+  {
+    result.message = "The collision evaluator type is not supported";
+    return result;
+  }
+
+  if (!env.isInitialized())
+  {
+    result.message = "The environment is not initialized";
+    return result;
+  }
+
+  try
+  {
+    syncWorker(worker, env, discrete);
+    result.revision = worker.revision;
+    if (discrete)
+    {
+      if (worker.discrete_manager == nullptr)
+      {
+        result.message = "The environment does not have a discrete contact manager";
+        return result;
+      }
+
+      result.in_collision = checkRequest(result.contacts, *worker.discrete_manager, *worker.state_solver, request);
+    }
+    else
+    {
+      if (worker.continuous_manager == nullptr)
+      {
+        result.message = "The environment does not have a continuous contact manager";
+        return result;
+      }
+
+      result.in_collision = checkRequest(result.contacts, *worker.continuous_manager, *worker.state_solver, request);
+    }
+  }
+  catch (const std::exception& e)
+  {
+    result.in_collision = false;
+    result.contacts.clear();
+    result.message = e.what();
+    return result;
+  }
+
+  result.checked = true;
+  return result;
+}
+}  // namespace
+
+/** @brief The environment and the idle workers of an AsyncContactChecker */
+struct AsyncContactChecker::Pool
+{
+  Environment::ConstPtr env;
+
+  mutable std::mutex mutex;
+  std::vector<std::unique_ptr<Worker>> idle;
+  std::size_t count{ 0 };
+
+  /**
+   * @brief Call a function with an idle worker synced to the environment, a new worker is created if none is idle
+   * @param discrete Indicates if the discrete or continuous contact manager is used
+   * @param fn The function called with the worker
+   */
+  template <typename Fn>
+  auto run(bool discrete, const Fn& fn)
+  {
+    std::unique_ptr<Worker> worker;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (idle.empty())
+      {
+        worker = std::make_unique<Worker>();
+        ++count;
+      }
+      else
+      {
+        worker = std::move(idle.back());
+        idle.pop_back();
+      }
+    }
+
+    auto give_back = [this](std::unique_ptr<Worker> worker) {
+      std::lock_guard<std::mutex> lock(mutex);
+      idle.push_back(std::move(worker));
+    };
+
+    try
+    {
+      if (!env->isInitialized())
+        throw std::runtime_error("AsyncContactChecker, the environment is not initialized.");
+
+      syncWorker(*worker, *env, discrete);
+      auto result = fn(*worker);
+      give_back(std::move(worker));
+      return result;
+    }
+    catch (...)
+    {
+      give_back(std::move(worker));
+      throw;
+    }
+  }
+};
+
+bool TrajectoryValidationResult::isValid() const { return checked && !in_collision; }
+
+TrajectoryValidator::TrajectoryValidator(Environment::ConstPtr env, std::size_t threads) : env_(std::move(env))
+{
+  if (env_ == nullptr)
+    throw std::runtime_error("TrajectoryValidator, the environment is a nullptr!");
+
+  if (threads == 0)
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  threads_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i)
+    threads_.emplace_back([this]() { run(); });
+}
+
+TrajectoryValidator::~TrajectoryValidator()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queued_cv_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+std::future<TrajectoryValidationResult> TrajectoryValidator::validate(TrajectoryValidationRequest request)
+{
+  auto promise = std::make_shared<std::promise<TrajectoryValidationResult>>();
+  std::future<TrajectoryValidationResult> future = promise->get_future();
+
+  std::vector<Task> tasks(1);
+  tasks[0].request = std::move(request);
+  tasks[0].done = [promise](TrajectoryValidationResult result) { promise->set_value(std::move(result)); };
+  enqueue(std::move(tasks));
+
+  return future;
+}
+
+std::vector<std::future<TrajectoryValidationResult>>
+TrajectoryValidator::validate(std::vector<TrajectoryValidationRequest> requests)
+{
+  std::vector<std::future<TrajectoryValidationResult>> futures;
+  futures.reserve(requests.size());
+
+  std::vector<Task> tasks(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i)
+  {
+    auto promise = std::make_shared<std::promise<TrajectoryValidationResult>>();
+    futures.push_back(promise->get_future());
+    tasks[i].request = std::move(requests[i]);
+    tasks[i].done = [promise](TrajectoryValidationResult result) { promise->set_value(std::move(result)); };
+  }
+  enqueue(std::move(tasks));
+
+  return futures;
+}
+
+void TrajectoryValidator::validate(std::vector<TrajectoryValidationRequest> requests,
+                                   const TrajectoryValidationCallbackFn& callback)
+{
+  std::vector<Task> tasks(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i)
+  {
+    tasks[i].request = std::move(requests[i]);
+    tasks[i].done = [callback, i](TrajectoryValidationResult result) { callback(i, result); };
+  }
+  enqueue(std::move(tasks));
+}
+
+void TrajectoryValidator::wait() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return queue_.empty() && busy_ == 0; });
+}
+
+std::size_t TrajectoryValidator::getThreadCount() const { return threads_.size(); }
+
+const Environment::ConstPtr& TrajectoryValidator::getEnvironment() const { return env_; }
+
+void TrajectoryValidator::enqueue(std::vector<Task> tasks)
+{
+  if (tasks.empty())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& task : tasks)
+      queue_.push_back(std::move(task));
+  }
+
+  if (tasks.size() == 1)
+    queued_cv_.notify_one();
+  else
+    queued_cv_.notify_all();
+}
+
+void TrajectoryValidator::run()
+{
+  Worker worker;
+  while (true)
+  {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      queued_cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+
+      // The queued requests are checked before stopping
+      if (queue_.empty())
+        return;
+
+      task = std::move(queue_.front());
+      queue_.pop_front();
+      ++busy_;
+    }
+
+    try
+    {
+      task.done(validateRequest(worker, *env_, task.request));
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TrajectoryValidator, the result callback threw an exception: %s", e.what());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --busy_;
+      if (queue_.empty() && busy_ == 0)
+        done_cv_.notify_all();
+    }
+  }
+}
+
+AsyncContactChecker::AsyncContactChecker(Environment::ConstPtr env, tesseract_common::Executor::Ptr executor)
+  : pool_(std::make_shared<Pool>()), executor_(std::move(executor))
+{
+  if (env == nullptr)
+    throw std::runtime_error("AsyncContactChecker, the environment is a nullptr!");
+
+  pool_->env = std::move(env);
+  if (executor_ == nullptr)
+    executor_ = tesseract_common::getDefaultExecutor();
+}
+
+std::future<tesseract_collision::ContactResultMap>
+AsyncContactChecker::contactTest(std::vector<std::string> joint_names,
+                                 Eigen::VectorXd joint_values,
+                                 tesseract_collision::CollisionCheckConfig config,
+                                 tesseract_common::CancellationToken token)
+{
+  auto fn = [pool = pool_,
+             joint_names = std::move(joint_names),
+             joint_values = std::move(joint_values),
+             config = std::move(config)]() {
+    return pool->run(true, [&](Worker& worker) {
+      if (worker.discrete_manager == nullptr)
+        throw std::runtime_error("AsyncContactChecker, the environment does not have a discrete contact manager.");
+
+      tesseract_collision::DiscreteContactManager& manager = *worker.discrete_manager;
+      tesseract_collision::ContactManagerConfigGuard<tesseract_collision::DiscreteContactManager> guard(manager,
+                                                                                  config.contact_manager_config);
+      manager.applyContactManagerConfig(config.contact_manager_config);
+      manager.setCollisionObjectsTransform(worker.state_solver->getState(joint_names, joint_values).link_transforms);
+
+      tesseract_collision::ContactResultMap contacts;
+      manager.contactTest(contacts, config.contact_request);
+      return contacts;
+    });
+  };
+  return executor_->async(std::move(fn), std::move(token));
+}
+
+std::future<std::vector<tesseract_collision::ContactResultMap>>
+AsyncContactChecker::checkTrajectory(TrajectoryValidationRequest request, tesseract_common::CancellationToken token)
+{
+  auto fn = [pool = pool_, request = std::move(request), token]() {
+    const bool discrete = isDiscreteCheck(request.config);
+    return pool->run(discrete, [&](Worker& worker) {
+      const long num_states = request.trajectory.rows();
+      if (discrete)
+      {
+        if (worker.discrete_manager == nullptr)
+          throw std::runtime_error("AsyncContactChecker, the environment does not have a discrete contact manager.");
+
+        return checkRequestSteps(*worker.discrete_manager, *worker.state_solver, request, num_states, token);
+      }
+
+      if (worker.continuous_manager == nullptr)
+        throw std::runtime_error("AsyncContactChecker, the environment does not have a continuous contact manager.");
+
+      return checkRequestSteps(*worker.continuous_manager, *worker.state_solver, request, num_states - 1, token);
+    });
+  };
+  return executor_->async(std::move(fn), std::move(token));
+}
+
+const Environment::ConstPtr& AsyncContactChecker::getEnvironment() const { return pool_->env; }
+
+std::size_t AsyncContactChecker::getWorkerCount() const
+{
+  std::lock_guard<std::mutex> lock(pool_->mutex);
+  return pool_->count;
+}
+}  // namespace tesseract_environment
@@ -24,335 +24,737 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <numeric>
+#include <optional>
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/common.h>
 #include <tesseract_collision/core/utils.h>
 #include <tesseract_environment/utils.h>
+#include <tesseract_environment/contact_manager_binding.h>
+#include <tesseract_environment/query_context.h>
+#include <tesseract_environment/swept_volume_broadphase.h>
+#include <tesseract_common/interpolation.h>
+#include <tesseract_kinematics/core/utils.h>
 
 namespace tesseract_environment
 {
+namespace
+{
+/** @brief Calculate the link transforms for a joint state */
+using CalcStateFn = std::function<tesseract_common::TransformMap(const Eigen::Ref<const Eigen::VectorXd>&)>;
+
 /**
- * @brief Get the active Link Names Recursively
- *
- *        This currently only works for graphs that are trees. Need to create a generic method using boost::visitor
- *        TODO: Need to update using graph->getLinkChildren
- *
- * @param active_links
- * @param scene_graph
- * @param current_link
- * @param active
+ * @brief Perform the discrete collision check of the LVS sub states of a trajectory state, skipping the sub states
+ * which can not be in contact
+ * @details Every checked sub state also provides the distance of each pair which could come within its collision margin
+ * before the end of the sub states. No point on the links moves further than the motion bound between two sub states,
+ * so the sub states reached before any pair could close its clearance are skipped. The sub states in contact are
+ * checked again with the contact request, which makes the results identical to checking every sub state.
+ * @param motion_bounds The joint motion bounds, see JointGroup::getJointMotionBounds
+ * @return True if collision was found, otherwise false.
  */
-void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
-                                 const tesseract_scene_graph::SceneGraph& scene_graph,
-                                 const std::string& current_link,
-                                 bool active)
+bool checkSubStatesAdaptive(tesseract_collision::ContactResultMap& state_results,
+                            tesseract_collision::DiscreteContactManager& manager,
+                            const CalcStateFn& calc_state,
+                            const tesseract_common::TrajArray& subtraj,
+                            const Eigen::VectorXd& motion_bounds,
+                            const tesseract_collision::CollisionCheckConfig& config)
 {
-  // recursively get all active links
-  assert(scene_graph.isTree());
-  if (active)
-  {
-    active_links.push_back(current_link);
-    for (const auto& child_link : scene_graph.getAdjacentLinkNames(current_link))
-      getActiveLinkNamesRecursive(active_links, scene_graph, child_link, active);
-  }
-  else
-  {
-    for (const auto& child_link : scene_graph.getAdjacentLinkNames(current_link))
-      if (scene_graph.getInboundJoints(child_link)[0]->type != tesseract_scene_graph::JointType::FIXED)
-        getActiveLinkNamesRecursive(active_links, scene_graph, child_link, true);
-      else
-        getActiveLinkNamesRecursive(active_links, scene_graph, child_link, active);
-  }
-}
+  QueryContext::Scope context;
+  const long last_index = subtraj.rows() - 1;
+  const double step_motion = motion_bounds.dot((subtraj.row(1) - subtraj.row(0)).transpose().cwiseAbs());
+  const std::vector<std::string> active_links = manager.getActiveCollisionObjects();
 
-tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
-                                                             const tesseract_common::TransformMap& state0,
-                                                             const tesseract_common::TransformMap& state1,
-                                                             const tesseract_collision::CollisionCheckConfig& config)
-{
-  manager.applyContactManagerConfig(config.contact_manager_config);
-  return checkTrajectorySegment(manager, state0, state1, config.contact_request);
-}
+  // Report the distance of every pair which could come within its collision margin before the last sub state
+  const tesseract_common::CollisionMarginData margin_data = manager.getCollisionMarginData();
+  tesseract_common::CollisionMarginData query_margin_data = margin_data;
+  query_margin_data.incrementMargins(2.0 * step_motion * static_cast<double>(last_index));
+  manager.setCollisionMarginData(query_margin_data);
 
-tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
-                                                             const tesseract_common::TransformMap& state0,
-                                                             const tesseract_common::TransformMap& state1,
-                                                             const tesseract_collision::ContactRequest& contact_request)
-{
-  for (const auto& link_name : manager.getActiveCollisionObjects())
-    manager.setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
+  tesseract_collision::ContactRequest query_request(tesseract_collision::ContactTestType::CLOSEST);
+  query_request.detail = tesseract_collision::ContactResultDetail::BINARY;
+  query_request.is_valid = config.contact_request.is_valid;
 
-  tesseract_collision::ContactResultMap collisions;
-  manager.contactTest(collisions, contact_request);
+  auto is_active = [&active_links](const std::string& link_name) {
+    return (std::find(active_links.begin(), active_links.end(), link_name) != active_links.end());
+  };
 
-  if (!collisions.empty())
+  bool found = false;
+  tesseract_collision::ContactResultMap query_results;
+  for (long iSubStep = 0; iSubStep < last_index;)
   {
-    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    tesseract_common::TransformMap state = calc_state(subtraj.row(iSubStep));
+    for (const auto& link_name : active_links)
+      manager.setCollisionObjectsTransform(link_name, state.at(link_name));
+
+    query_results.clear();
+    manager.contactTest(query_results, query_request);
+
+    bool in_contact = false;
+    double clearance = std::numeric_limits<double>::max();
+    for (const auto& pair : query_results)
     {
-      for (auto& collision : collisions)
+      for (const auto& r : pair.second)
       {
-        std::stringstream ss;
-        ss << "Continuous collision detected between '" << collision.first.first << "' and '" << collision.first.second
-           << "' with distance " << collision.second.front().distance << std::endl;
+        const double margin = margin_data.getPairCollisionMargin(r.link_names[0], r.link_names[1]);
+        in_contact = in_contact || (r.distance < margin);
 
-        CONSOLE_BRIDGE_logError(ss.str().c_str());
+        // Both links move towards each other when they are active
+        const double pair_motion = (is_active(r.link_names[0]) && is_active(r.link_names[1])) ? 2.0 : 1.0;
+        clearance = std::min(clearance, (r.distance - margin) / pair_motion);
       }
     }
-  }
-
-  return collisions;
-}
-
-tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
-                                                           const tesseract_common::TransformMap& state,
-                                                           const tesseract_collision::CollisionCheckConfig& config)
-{
-  manager.applyContactManagerConfig(config.contact_manager_config);
-  return checkTrajectoryState(manager, state, config.contact_request);
-}
-
-tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
-                                                           const tesseract_common::TransformMap& state,
-                                                           const tesseract_collision::ContactRequest& contact_request)
-{
-  tesseract_collision::ContactResultMap collisions;
 
-  for (const auto& link_name : manager.getActiveCollisionObjects())
-    manager.setCollisionObjectsTransform(link_name, state.at(link_name));
-
-  manager.contactTest(collisions, contact_request);
-
-  if (!collisions.empty())
-  {
-    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    if (!in_contact)
     {
-      for (auto& collision : collisions)
-      {
-        std::stringstream ss;
-        ss << "Discrete collision detected between '" << collision.first.first << "' and '" << collision.first.second
-           << "' with distance " << collision.second.front().distance << std::endl;
+      const double skip = (step_motion > 0) ? std::floor(clearance / step_motion) : std::numeric_limits<double>::max();
+      iSubStep += (skip >= static_cast<double>(last_index - iSubStep)) ? (last_index - iSubStep) :
+                                                                         std::max(1L, static_cast<long>(skip));
+      continue;
+    }
 
-        CONSOLE_BRIDGE_logError(ss.str().c_str());
-      }
+    manager.setCollisionMarginData(margin_data);
+    tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    manager.setCollisionMarginData(query_margin_data);
+    if (!sub_state_results.empty())
+    {
+      found = true;
+      processInterpolatedSubSegmentCollisionResults(state_results,
+                                                    sub_state_results,
+                                                    static_cast<int>(iSubStep),
+                                                    static_cast<int>(last_index),
+                                                    active_links,
+                                                    true);
     }
+
+    if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+      break;
+
+    ++iSubStep;
   }
 
-  return collisions;
+  manager.setCollisionMarginData(margin_data);
+  return found;
 }
 
 /**
- * @brief This process contact results
- * @param segment_results
- * @param sub_segment_results
- * @param segment_index
- * @param segment_last_index
- * @param manip_active_link_names
- * @param discrete
+ * @brief Perform the discrete collision check for a single trajectory state, including the LVS sub states
+ * @param motion_bounds The joint motion bounds used by the adaptive LVS, if nullptr every sub state is checked
+ * @return True if collision was found, otherwise false.
  */
-void processInterpolatedSubSegmentCollisionResults(tesseract_collision::ContactResultMap& segment_results,
-                                                   tesseract_collision::ContactResultMap& sub_segment_results,
-                                                   int sub_segment_index,
-                                                   int sub_segment_last_index,
-                                                   const std::vector<std::string>& manip_active_link_names,
-                                                   bool discrete)
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& state_results,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const CalcStateFn& calc_state,
+                         const tesseract_common::TrajArray& traj,
+                         long iStep,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         const Eigen::VectorXd* motion_bounds = nullptr)
 {
-  double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
-  for (auto& pair : sub_segment_results)
+  QueryContext::Scope context;
+  state_results.clear();
+
+  double dist = -1;
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE && iStep < traj.rows() - 1)
+    dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
+
+  bool found = false;
+  if (dist > 0 && dist > config.longest_valid_segment_length)
   {
-    // Update cc_time and cc_type
-    for (auto& r : pair.second)
+    long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+    tesseract_common::TrajArray subtraj;
+    tesseract_common::interpolateLinear(subtraj, traj.row(iStep), traj.row(iStep + 1), cnt);
+
+    if (config.adaptive_longest_valid_segment && motion_bounds != nullptr && motion_bounds->allFinite())
     {
-      // Iterate over the two time values in r.cc_time
-      for (size_t j = 0; j < 2; ++j)
+      found = checkSubStatesAdaptive(state_results, manager, calc_state, subtraj, *motion_bounds, config);
+    }
+    else
+    {
+      for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
       {
-        if (std::find(manip_active_link_names.begin(), manip_active_link_names.end(), r.link_names[j]) !=
-            manip_active_link_names.end())
+        tesseract_common::TransformMap state = calc_state(subtraj.row(iSubStep));
+        tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+        if (!sub_state_results.empty())
         {
-          r.cc_time[j] = (r.cc_time[j] < 0) ?
-                             (static_cast<double>(sub_segment_index) * segment_dt) :
-                             (static_cast<double>(sub_segment_index) * segment_dt) + (r.cc_time[j] * segment_dt);
-          assert(r.cc_time[j] >= 0.0 && r.cc_time[j] <= 1.0);
-          if (sub_segment_index == 0 &&
-              (r.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Time0 || discrete))
-            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Time0;
-          else if (sub_segment_index == sub_segment_last_index &&
-                   (r.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Time1 || discrete))
-            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Time1;
-          else
-            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Between;
-
-          // If discrete set cc_transform for discrete continuous
-          if (discrete)
-            r.cc_transform = r.transform;
+          found = true;
+          processInterpolatedSubSegmentCollisionResults(state_results,
+                                                        sub_state_results,
+                                                        iSubStep,
+                                                        static_cast<int>(subtraj.rows() - 1),
+                                                        manager.getActiveCollisionObjects(),
+                                                        true);
         }
-      }
 
-      if (sub_segment_last_index > 0)
-      {
-        // Add results to the full segment results
-        auto it = segment_results.find(pair.first);
-        if (it == segment_results.end())
-          segment_results.insert(pair);
-        else
-          it->second.insert(it->second.end(), pair.second.begin(), pair.second.end());
+        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+          break;
       }
     }
   }
+  else
+  {
+    tesseract_common::TransformMap state = calc_state(traj.row(iStep));
+    tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    if (!sub_state_results.empty())
+    {
+      found = true;
+      processInterpolatedSubSegmentCollisionResults(
+          state_results, sub_state_results, 0, 0, manager.getActiveCollisionObjects(), true);
+    }
+  }
 
-  if (sub_segment_last_index == 0)
-    segment_results = sub_segment_results;
+  if (found && console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+  {
+    std::stringstream ss;
+    ss << "Discrete collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
+    ss << "    State: " << traj.row(iStep) << std::endl;
+    CONSOLE_BRIDGE_logError(ss.str().c_str());
+  }
+
+  return found;
 }
 
-bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                     tesseract_collision::ContinuousContactManager& manager,
-                     const tesseract_scene_graph::StateSolver& state_solver,
-                     const std::vector<std::string>& joint_names,
-                     const tesseract_common::TrajArray& traj,
-                     const tesseract_collision::CollisionCheckConfig& config)
+/**
+ * @brief Perform the discrete collision check of a trajectory visiting the states in bisection order
+ * @details The trajectory states, including the LVS sub states, are numbered along the trajectory and visited in van
+ * der Corput order, so every check halves the largest unchecked interval. The check stops at the first collision found.
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryBisection(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                              tesseract_collision::DiscreteContactManager& manager,
+                              const CalcStateFn& calc_state,
+                              const tesseract_common::TrajArray& traj,
+                              const tesseract_collision::CollisionCheckConfig& config)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-    throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type");
+  QueryContext::Scope context;
+  for (auto& state_results : contacts)
+    state_results.clear();
 
-  if (traj.rows() < 2)
-    throw std::runtime_error("checkTrajectory was given continuous contact manager with a trajectory that only has one "
-                             "state.");
+  // The number of states checked for each trajectory step and the index of its first state
+  std::vector<long> step_states(static_cast<std::size_t>(traj.rows()), 1);
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  {
+    for (long iStep = 0; iStep < traj.rows() - 1; ++iStep)
+    {
+      double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
+      if (dist > 0 && dist > config.longest_valid_segment_length)
+        step_states[static_cast<std::size_t>(iStep)] =
+            static_cast<long>(std::ceil(dist / config.longest_valid_segment_length));
+    }
+  }
 
-  manager.applyContactManagerConfig(config.contact_manager_config);
+  std::vector<long> step_offsets(step_states.size() + 1, 0);
+  std::partial_sum(step_states.begin(), step_states.end(), std::next(step_offsets.begin()));
+  const long num_states = step_offsets.back();
 
-  bool found = false;
-  contacts.resize(static_cast<size_t>(traj.rows() - 1));
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+  int bits = 0;
+  while ((1L << bits) < num_states)
+    ++bits;
+
+  for (long i = 0; i < (1L << bits); ++i)
   {
-    for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
+    // Reverse the bits of the sequence number to get the state index
+    long index = 0;
+    for (int b = 0; b < bits; ++b)
     {
-      tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+      if ((i & (1L << b)) != 0)
+        index |= (1L << (bits - 1 - b));
+    }
 
-      double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
-      if (dist > config.longest_valid_segment_length)
-      {
-        long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, traj.cols());
-        for (long iVar = 0; iVar < traj.cols(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(iStep)(iVar), traj.row(iStep + 1)(iVar));
+    if (index >= num_states)
+      continue;
 
-        for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
-        {
-          tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, subtraj.row(iSubStep + 1));
-          tesseract_collision::ContactResultMap sub_segment_results =
-              checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
-          if (!sub_segment_results.empty())
-          {
-            found = true;
-            processInterpolatedSubSegmentCollisionResults(segment_results,
-                                                          sub_segment_results,
-                                                          iSubStep,
-                                                          static_cast<int>(subtraj.rows() - 1),
-                                                          manager.getActiveCollisionObjects(),
-                                                          false);
+    auto it = std::upper_bound(step_offsets.begin(), step_offsets.end(), index);
+    const auto iStep = static_cast<long>(std::distance(step_offsets.begin(), it)) - 1;
+    const long iSubStep = index - step_offsets[static_cast<std::size_t>(iStep)];
+    const long sub_states = step_states[static_cast<std::size_t>(iStep)];
 
-            if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-            {
-              std::stringstream ss;
-              ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1)
-                 << " substep: " << iSubStep << std::endl;
+    Eigen::VectorXd joint_values = traj.row(iStep);
+    if (sub_states > 1)
+      joint_values += (static_cast<double>(iSubStep) / static_cast<double>(sub_states)) *
+                      (traj.row(iStep + 1) - traj.row(iStep)).transpose();
 
-              ss << "     Names:";
-              for (const auto& name : joint_names)
-                ss << " " << name;
+    tesseract_common::TransformMap state = calc_state(joint_values);
+    tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    if (sub_state_results.empty())
+      continue;
 
-              ss << std::endl
-                 << "    State0: " << subtraj.row(iSubStep) << std::endl
-                 << "    State1: " << subtraj.row(iSubStep + 1) << std::endl;
+    processInterpolatedSubSegmentCollisionResults(contacts[static_cast<std::size_t>(iStep)],
+                                                  sub_state_results,
+                                                  static_cast<int>(iSubStep),
+                                                  (sub_states > 1) ? static_cast<int>(sub_states) : 0,
+                                                  manager.getActiveCollisionObjects(),
+                                                  true);
 
-              CONSOLE_BRIDGE_logError(ss.str().c_str());
-            }
-          }
+    if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    {
+      std::stringstream ss;
+      ss << "Discrete collision detected at step: " << iStep << " of " << (traj.rows() - 1)
+         << " substate: " << iSubStep << std::endl;
+      ss << "    State: " << joint_values.transpose() << std::endl;
+      CONSOLE_BRIDGE_logError(ss.str().c_str());
+    }
 
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
-        }
+    return true;
+  }
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-      else
-      {
-        tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, traj.row(iStep));
-        tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
-        segment_results =
-            checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
-        if (!segment_results.empty())
-        {
-          found = true;
-          if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-          {
-            std::stringstream ss;
-            ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
+  return false;
+}
 
-            ss << "     Names:";
-            for (const auto& name : joint_names)
-              ss << " " << name;
+/**
+ * @brief Perform the continuous collision check for a single trajectory segment, including the LVS sub segments
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& segment_results,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const CalcStateFn& calc_state,
+                         const tesseract_common::TrajArray& traj,
+                         long iStep,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         TrajectorySegmentCache* cache)
+{
+  QueryContext::Scope context;
+  segment_results.clear();
 
-            ss << std::endl
-               << "    State0: " << traj.row(iStep) << std::endl
-               << "    State1: " << traj.row(iStep + 1) << std::endl;
+  double dist = -1;
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+    dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
 
-            CONSOLE_BRIDGE_logError(ss.str().c_str());
-          }
-        }
+  bool found = false;
+  if (dist > 0 && dist > config.longest_valid_segment_length)
+  {
+    long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+    tesseract_common::TrajArray subtraj;
+    tesseract_common::interpolateLinear(subtraj, traj.row(iStep), traj.row(iStep + 1), cnt);
+
+    // Each sub state is calculated once, the end state of a sub segment is the start state of the next
+    tesseract_common::TransformMap state0 = calc_state(subtraj.row(0));
+    tesseract_common::TransformMap state1;
+    for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
+    {
+      if (iSubStep > 0)
+        std::swap(state0, state1);
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
+      state1 = calc_state(subtraj.row(iSubStep + 1));
+      tesseract_collision::ContactResultMap& sub_segment_results = context->contacts;
+      checkTrajectorySegment(sub_segment_results, manager, state0, state1, config.contact_request, cache);
+      if (!sub_segment_results.empty())
+      {
+        found = true;
+        processInterpolatedSubSegmentCollisionResults(segment_results,
+                                                      sub_segment_results,
+                                                      iSubStep,
+                                                      static_cast<int>(subtraj.rows() - 1),
+                                                      manager.getActiveCollisionObjects(),
+                                                      false);
       }
+
+      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+        break;
     }
   }
   else
   {
-    for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
-    {
-      tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+    tesseract_common::TransformMap state0 = calc_state(traj.row(iStep));
+    tesseract_common::TransformMap state1 = calc_state(traj.row(iStep + 1));
+    checkTrajectorySegment(segment_results, manager, state0, state1, config.contact_request, cache);
+    found = !segment_results.empty();
+  }
 
-      tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, traj.row(iStep));
-      tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
+  if (found && console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+  {
+    std::stringstream ss;
+    ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
+    ss << "    State0: " << traj.row(iStep) << std::endl << "    State1: " << traj.row(iStep + 1) << std::endl;
+    CONSOLE_BRIDGE_logError(ss.str().c_str());
+  }
 
-      segment_results =
-          checkTrajectorySegment(manager, state0.link_transforms, state1.link_transforms, config.contact_request);
-      if (!segment_results.empty())
-      {
-        found = true;
-        if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-        {
-          std::stringstream ss;
-          ss << "Discrete collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
+  return found;
+}
 
-          ss << "     Names:";
-          for (const auto& name : joint_names)
-            ss << " " << name;
+/**
+ * @brief Distribute the trajectory steps across a pool of workers and check them in parallel
+ * @details Steps are handed out in increasing order so when ContactTestType::FIRST is requested every step before the
+ * first step in collision is guaranteed to be checked, which makes the results identical to the serial implementation.
+ * @param contacts The per step results, must already be sized to the number of steps
+ * @param executor The executor running the workers
+ * @param num_workers The number of workers
+ * @param stop_on_first Indicate if the workers should stop once a collision has been found
+ * @param check_step Function checking a single step given the worker index, the step index and its results
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryParallel(
+    std::vector<tesseract_collision::ContactResultMap>& contacts,
+    tesseract_common::Executor& executor,
+    std::size_t num_workers,
+    bool stop_on_first,
+    const std::function<bool(std::size_t, long, tesseract_collision::ContactResultMap&)>& check_step)
+{
+  const auto num_steps = static_cast<long>(contacts.size());
+  num_workers = std::min(num_workers, contacts.size());
 
-          ss << std::endl
-             << "    State0: " << traj.row(iStep) << std::endl
-             << "    State1: " << traj.row(iStep + 1) << std::endl;
+  std::atomic<long> next_step{ 0 };
+  std::atomic<long> first_found{ num_steps };
+  std::atomic<bool> abort{ false };
+  std::vector<std::exception_ptr> errors(num_workers);
 
-          CONSOLE_BRIDGE_logError(ss.str().c_str());
+  auto worker = [&](std::size_t worker_idx) {
+    try
+    {
+      for (long step = next_step++; step < num_steps && !abort; step = next_step++)
+      {
+        if (stop_on_first && step > first_found)
+          break;
+
+        if (check_step(worker_idx, step, contacts[static_cast<std::size_t>(step)]))
+        {
+          long current = first_found;
+          while (step < current && !first_found.compare_exchange_weak(current, step))
+          {
+          }
         }
       }
+    }
+    catch (...)
+    {
+      errors[worker_idx] = std::current_exception();
+      abort = true;
+    }
+  };
 
-      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+  executor.parallelFor(num_workers, worker);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  // Only the first state in collision is reported, matching the serial implementation
+  if (stop_on_first)
+  {
+    for (auto step = static_cast<std::size_t>(first_found + 1); step < contacts.size(); ++step)
+      contacts[step].clear();
+  }
+
+  return (first_found < num_steps);
+}
+
+/**
+ * @brief Log the contacts found by a collision check
+ * @param collisions The contact results
+ * @param type The type of the collision check, Discrete or Continuous
+ */
+void logContactResults(const tesseract_collision::ContactResultMap& collisions, const std::string& type)
+{
+  if (collisions.empty() || console_bridge::getLogLevel() <= console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+    return;
+
+  for (const auto& collision : collisions)
+  {
+    std::stringstream ss;
+    ss << type << " collision detected between '" << collision.first.first << "' and '" << collision.first.second
+       << "' with distance " << collision.second.front().distance << std::endl;
+
+    CONSOLE_BRIDGE_logError(ss.str().c_str());
+  }
+}
+
+/** @brief Calculate the transforms of the links of a LinkTransforms for a joint state */
+using CalcLinkTransformsFn =
+    std::function<void(tesseract_common::LinkTransforms&, const Eigen::Ref<const Eigen::VectorXd>&)>;
+
+/** @brief The object pairs which may be in contact during each step of a trajectory */
+using SegmentPairs = std::vector<std::unordered_set<tesseract_collision::ObjectPairKey, tesseract_common::PairHash>>;
+
+/**
+ * @brief Get the object pairs which may be in contact during each step of a trajectory
+ * @details See calcSweptVolumeCandidates
+ */
+SegmentPairs calcSegmentPairs(const tesseract_collision::ContinuousContactManager& manager,
+                              const tesseract_kinematics::JointGroup& manip,
+                              const tesseract_common::TrajArray& traj)
+{
+  SegmentPairs segment_pairs(static_cast<std::size_t>(traj.rows() - 1));
+  for (const auto& candidate : calcSweptVolumeCandidates(manager, manip, traj))
+  {
+    const tesseract_collision::ObjectPairKey key =
+        tesseract_collision::getObjectPairKey(candidate.link_name, candidate.other_name);
+    for (long s = candidate.first_segment; s <= candidate.last_segment; ++s)
+      segment_pairs[static_cast<std::size_t>(s)].insert(key);
+  }
+
+  return segment_pairs;
+}
+
+/** @brief Restores the IsContactAllowedFn of a contact manager when it goes out of scope */
+class ScopedIsContactAllowedFn
+{
+public:
+  ScopedIsContactAllowedFn(tesseract_collision::ContinuousContactManager& manager,
+                           tesseract_collision::IsContactAllowedFn fn)
+    : manager_(manager), original_(manager.getIsContactAllowedFn())
+  {
+    manager_.setIsContactAllowedFn(std::move(fn));
+  }
+  ~ScopedIsContactAllowedFn() { manager_.setIsContactAllowedFn(original_); }
+  ScopedIsContactAllowedFn(const ScopedIsContactAllowedFn&) = delete;
+  ScopedIsContactAllowedFn& operator=(const ScopedIsContactAllowedFn&) = delete;
+  ScopedIsContactAllowedFn(ScopedIsContactAllowedFn&&) = delete;
+  ScopedIsContactAllowedFn& operator=(ScopedIsContactAllowedFn&&) = delete;
+
+private:
+  tesseract_collision::ContinuousContactManager& manager_;
+  tesseract_collision::IsContactAllowedFn original_;
+};
+
+/** @brief Receives the contacts of each step of a trajectory collision check */
+class StepResults
+{
+public:
+  virtual ~StepResults() = default;
+
+  /** @brief Get the cleared contacts of a step to fill, the steps are visited in order */
+  virtual tesseract_collision::ContactResultMap& begin(long step) = 0;
+
+  /** @brief Called once the contacts of a step are complete */
+  virtual void end(long step) = 0;
+};
+
+/** @brief Stores the contacts of each step */
+class StepResultsVector : public StepResults
+{
+public:
+  StepResultsVector(std::vector<tesseract_collision::ContactResultMap>& contacts, long num_steps) : contacts_(contacts)
+  {
+    contacts_.resize(static_cast<std::size_t>(num_steps));
+  }
+
+  tesseract_collision::ContactResultMap& begin(long step) override
+  {
+    tesseract_collision::ContactResultMap& results = contacts_[static_cast<std::size_t>(step)];
+    results.clear();
+    return results;
+  }
+
+  void end(long /*step*/) override {}
+
+private:
+  std::vector<tesseract_collision::ContactResultMap>& contacts_;
+};
+
+/** @brief Stores the contacts of a single step */
+class StepResultsMap : public StepResults
+{
+public:
+  explicit StepResultsMap(tesseract_collision::ContactResultMap& contacts) : contacts_(contacts) {}
+
+  tesseract_collision::ContactResultMap& begin(long /*step*/) override
+  {
+    contacts_.clear();
+    return contacts_;
+  }
+
+  void end(long /*step*/) override {}
+
+private:
+  tesseract_collision::ContactResultMap& contacts_;
+};
+
+/** @brief Summarizes the contacts of each step, the contacts are checked into the same storage for every step */
+class StepResultsSummary : public StepResults
+{
+public:
+  StepResultsSummary(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::ContactResultMap& results,
+                     long num_steps)
+    : summary_(summary), results_(results)
+  {
+    summary_.clear(num_steps);
+  }
+
+  tesseract_collision::ContactResultMap& begin(long /*step*/) override
+  {
+    results_.clear();
+    return results_;
+  }
+
+  void end(long step) override { summary_.update(step, results_); }
+
+private:
+  TrajectoryCollisionSummary& summary_;
+  tesseract_collision::ContactResultMap& results_;
+};
+
+/**
+ * @brief Perform the continuous collision check of a trajectory, including the LVS sub segments
+ * @details Only the transforms of the active links are calculated and each state is calculated once, the end state of
+ * a step is kept as the start state of the next step. Without a segment cache the segments of a step are checked in
+ * one sweep of the contact manager, see ContinuousContactManager::contactTestSweep.
+ *
+ * When the object pairs which may be in contact during each step are provided, the steps without any are not checked
+ * and the other pairs are excluded from the checks of a step through the IsContactAllowedFn of the manager.
+ * @param segment_pairs The object pairs which may be in contact during each step, nullptr to check all pairs
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectoryContinuous(StepResults& contacts,
+                               tesseract_collision::ContinuousContactManager& manager,
+                               const CalcLinkTransformsFn& calc_state,
+                               const std::vector<std::string>& joint_names,
+                               const tesseract_common::TrajArray& traj,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               TrajectorySegmentCache* cache,
+                               const SegmentPairs* segment_pairs = nullptr)
+{
+  QueryContext::Scope context;
+  std::vector<tesseract_collision::ContactResultMap>& sub_segment_results = context->sweep_contacts;
+
+  const bool lvs = (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS);
+  const bool stop_on_first = (config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+  const std::vector<std::string>& active_links = manager.getActiveCollisionObjects();
+  auto name_table = std::make_shared<const tesseract_common::LinkNameTable>(active_links);
+
+  // The states of the current step, the first is the last state of the previous step
+  std::vector<tesseract_common::LinkTransforms> states(2, tesseract_common::LinkTransforms(name_table));
+  calc_state(states.front(), traj.row(0));
+
+  // Exclude the pairs which can not be in contact during the current step
+  const SegmentPairs::value_type* step_pairs{ nullptr };
+  std::optional<ScopedIsContactAllowedFn> scoped_fn;
+  if (segment_pairs != nullptr)
+  {
+    auto is_contact_allowed = [original = manager.getIsContactAllowedFn(),
+                               &step_pairs](const std::string& name1, const std::string& name2) {
+      if (original != nullptr && original(name1, name2))
+        return true;
+
+      return (step_pairs->find(tesseract_collision::getObjectPairKey(name1, name2)) == step_pairs->end());
+    };
+    scoped_fn.emplace(manager, is_contact_allowed);
+  }
+
+  bool found = false;
+  tesseract_common::TrajArray subtraj;
+  for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
+  {
+    tesseract_collision::ContactResultMap& segment_results = contacts.begin(iStep);
+    if (segment_pairs != nullptr)
+    {
+      step_pairs = &(*segment_pairs)[static_cast<std::size_t>(iStep)];
+      if (step_pairs->empty())
+      {
+        contacts.end(iStep);
+        states.resize(2, tesseract_common::LinkTransforms(name_table));
+        calc_state(states.back(), traj.row(iStep + 1));
+        std::swap(states.front(), states.back());
+        continue;
+      }
+    }
+
+    long cnt = 2;
+    double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
+    if (lvs && dist > config.longest_valid_segment_length)
+    {
+      cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+      tesseract_common::interpolateLinear(subtraj, traj.row(iStep), traj.row(iStep + 1), cnt);
+    }
+
+    states.resize(static_cast<std::size_t>(cnt), tesseract_common::LinkTransforms(name_table));
+    if (cnt > 2)
+    {
+      for (long i = 1; i < cnt; ++i)
+        calc_state(states[static_cast<std::size_t>(i)], subtraj.row(i));
+    }
+    else
+    {
+      calc_state(states.back(), traj.row(iStep + 1));
+    }
+
+    if (cache == nullptr)
+    {
+      manager.contactTestSweep(sub_segment_results, states, config.contact_request);
+    }
+    else
+    {
+      sub_segment_results.resize(static_cast<std::size_t>(cnt - 1));
+      for (std::size_t i = 0; i < sub_segment_results.size(); ++i)
+      {
+        sub_segment_results[i].clear();
+        if (found && stop_on_first)
+          continue;
+
+        checkTrajectorySegment(sub_segment_results[i],
+                               manager,
+                               states[i].toTransformMap(),
+                               states[i + 1].toTransformMap(),
+                               config.contact_request,
+                               cache);
+        found = found || !sub_segment_results[i].empty();
+      }
+    }
+
+    for (int iSubStep = 0; iSubStep < static_cast<int>(sub_segment_results.size()); ++iSubStep)
+    {
+      tesseract_collision::ContactResultMap& results = sub_segment_results[static_cast<std::size_t>(iSubStep)];
+      if (results.empty())
+        continue;
+
+      found = true;
+      logContactResults(results, "Continuous");
+      if (cnt > 2)
+        processInterpolatedSubSegmentCollisionResults(
+            segment_results, results, iSubStep, static_cast<int>(cnt - 1), active_links, false);
+      else
+        segment_results = results;
+
+      if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+      {
+        std::stringstream ss;
+        ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1);
+        if (cnt > 2)
+          ss << " substep: " << iSubStep;
+
+        ss << std::endl << "     Names:";
+        for (const auto& name : joint_names)
+          ss << " " << name;
+
+        ss << std::endl;
+        if (cnt > 2)
+          ss << "    State0: " << subtraj.row(iSubStep) << std::endl
+             << "    State1: " << subtraj.row(iSubStep + 1) << std::endl;
+        else
+          ss << "    State0: " << traj.row(iStep) << std::endl << "    State1: " << traj.row(iStep + 1) << std::endl;
+
+        CONSOLE_BRIDGE_logError(ss.str().c_str());
+      }
+
+      if (stop_on_first)
         break;
     }
+
+    contacts.end(iStep);
+    if (found && stop_on_first)
+      break;
+
+    std::swap(states.front(), states.back());
   }
 
   return found;
 }
 
-bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                     tesseract_collision::ContinuousContactManager& manager,
-                     const tesseract_kinematics::JointGroup& manip,
-                     const tesseract_common::TrajArray& traj,
-                     const tesseract_collision::CollisionCheckConfig& config)
+/** @brief Throw if the config or trajectory can not be used by a continuous collision check */
+void checkContinuousConfig(const tesseract_common::TrajArray& traj,
+                           const tesseract_collision::CollisionCheckConfig& config)
 {
   if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
       config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
@@ -362,134 +764,436 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   if (traj.rows() < 2)
     throw std::runtime_error("checkTrajectory was given continuous contact manager with a trajectory that only has one "
                              "state.");
+}
 
+/** @brief Throw if the config or trajectory can not be used by a discrete collision check */
+void checkDiscreteConfig(const tesseract_common::TrajArray& traj,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+    throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type");
+
+  if (traj.rows() == 0)
+    throw std::runtime_error("checkTrajectory was given continuous contact manager with empty trajectory.");
+}
+
+/** @brief Perform the continuous collision check of a trajectory using a state solver, see checkTrajectory */
+bool checkTrajectoryContinuous(StepResults& contacts,
+                               tesseract_collision::ContinuousContactManager& manager,
+                               const tesseract_scene_graph::StateSolver& state_solver,
+                               const std::vector<std::string>& joint_names,
+                               const tesseract_common::TrajArray& traj,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               TrajectorySegmentCache* cache)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+
+  auto calc_state = [&state_solver, &joint_names](tesseract_common::LinkTransforms& link_transforms,
+                                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+    state_solver.getLinkTransforms(link_transforms, joint_names, joint_values);
+  };
+  return checkTrajectoryContinuous(contacts, manager, calc_state, joint_names, traj, config, cache);
+}
+
+/** @brief Perform the continuous collision check of a trajectory using a joint group, see checkTrajectory */
+bool checkTrajectoryContinuous(StepResults& contacts,
+                               tesseract_collision::ContinuousContactManager& manager,
+                               const tesseract_kinematics::JointGroup& manip,
+                               const tesseract_common::TrajArray& traj,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               TrajectorySegmentCache* cache)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+
+  auto calc_state = [&manip](tesseract_common::LinkTransforms& link_transforms,
+                             const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+    manip.calcFwdKin(link_transforms, joint_values);
+  };
+
+  if (!config.swept_volume_broadphase)
+    return checkTrajectoryContinuous(contacts, manager, calc_state, manip.getJointNames(), traj, config, cache);
+
+  const SegmentPairs segment_pairs = calcSegmentPairs(manager, manip, traj);
+  return checkTrajectoryContinuous(
+      contacts, manager, calc_state, manip.getJointNames(), traj, config, cache, &segment_pairs);
+}
+
+/**
+ * @brief Perform the discrete collision check of a trajectory one state at a time, see checkTrajectory
+ * @param motion_bounds The joint motion bounds used by the adaptive LVS, if nullptr every sub state is checked
+ */
+bool checkTrajectorySteps(StepResults& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const CalcStateFn& calc_state,
+                          const tesseract_common::TrajArray& traj,
+                          const tesseract_collision::CollisionCheckConfig& config,
+                          const Eigen::VectorXd* motion_bounds = nullptr)
+{
   manager.applyContactManagerConfig(config.contact_manager_config);
 
   bool found = false;
-  contacts.resize(static_cast<size_t>(traj.rows() - 1));
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+  for (long iStep = 0; iStep < traj.rows(); ++iStep)
   {
-    for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
-    {
-      tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
+    const bool step_found =
+        checkTrajectoryStep(contacts.begin(iStep), manager, calc_state, traj, iStep, config, motion_bounds);
+    contacts.end(iStep);
+    found = found || step_found;
+    if (found && config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
+      break;
+  }
 
-      double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
-      if (dist > config.longest_valid_segment_length)
-      {
-        long cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, traj.cols());
-        for (long iVar = 0; iVar < traj.cols(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(iStep)(iVar), traj.row(iStep + 1)(iVar));
+  return found;
+}
 
-        for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
-        {
-          tesseract_common::TransformMap state0 = manip.calcFwdKin(subtraj.row(iSubStep));
-          tesseract_common::TransformMap state1 = manip.calcFwdKin(subtraj.row(iSubStep + 1));
-          tesseract_collision::ContactResultMap sub_segment_results =
-              checkTrajectorySegment(manager, state0, state1, config.contact_request);
-          if (!sub_segment_results.empty())
-          {
-            found = true;
-            processInterpolatedSubSegmentCollisionResults(segment_results,
-                                                          sub_segment_results,
-                                                          iSubStep,
-                                                          static_cast<int>(subtraj.rows() - 1),
-                                                          manager.getActiveCollisionObjects(),
-                                                          false);
+/** @brief Get the transforms of the active collision objects of a manager using a state solver */
+CalcStateFn getCalcStateFn(const tesseract_collision::DiscreteContactManager& manager,
+                           const tesseract_scene_graph::StateSolver& state_solver,
+                           const std::vector<std::string>& joint_names)
+{
+  return [&state_solver, &joint_names, &manager](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+    tesseract_common::TransformMap link_transforms;
+    state_solver.getLinkTransforms(link_transforms, manager.getActiveCollisionObjects(), joint_names, joint_values);
+    return link_transforms;
+  };
+}
 
-            if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-            {
-              std::stringstream ss;
-              ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1)
-                 << " substep: " << iSubStep << std::endl;
+/** @brief Get the transforms of the links of a joint group */
+CalcStateFn getCalcStateFn(const tesseract_kinematics::JointGroup& manip)
+{
+  return [&manip](const Eigen::Ref<const Eigen::VectorXd>& joint_values) { return manip.calcFwdKin(joint_values); };
+}
 
-              ss << "     Names:";
-              for (const auto& name : manip.getJointNames())
-                ss << " " << name;
+/** @brief Get the motion bounds of a joint group if the adaptive LVS is used */
+const Eigen::VectorXd* getAdaptiveMotionBounds(const tesseract_kinematics::JointGroup& manip,
+                                               const tesseract_collision::CollisionCheckConfig& config)
+{
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE && config.adaptive_longest_valid_segment)
+    return &manip.getJointMotionBounds();
 
-              ss << std::endl
-                 << "    State0: " << subtraj.row(iSubStep) << std::endl
-                 << "    State1: " << subtraj.row(iSubStep + 1) << std::endl;
+  return nullptr;
+}
+/** @brief Sort inverse kinematics solutions by their distance to a seed, optionally adding the redundant solutions */
+tesseract_kinematics::IKSolutions getSortedIKSolutions(const tesseract_kinematics::JointGroup& manip,
+                                                       const tesseract_kinematics::IKSolutions& solutions,
+                                                       const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                                       bool include_redundant)
+{
+  if (seed.size() != manip.numJoints())
+    throw std::runtime_error("filterCollisionFreeIKSolutions, the seed size does not match the joint group!");
+
+  tesseract_kinematics::IKSolutions sorted;
+  sorted.reserve(solutions.size());
+  const Eigen::MatrixX2d joint_limits = manip.getLimits().joint_limits;
+  const std::vector<Eigen::Index> redundancy_indices = manip.getRedundancyCapableJointIndices();
+  for (const auto& solution : solutions)
+  {
+    if (solution.size() != manip.numJoints())
+      throw std::runtime_error("filterCollisionFreeIKSolutions, a solution size does not match the joint group!");
 
-              CONSOLE_BRIDGE_logError(ss.str().c_str());
-            }
-          }
+    sorted.push_back(solution);
+    if (include_redundant && !redundancy_indices.empty())
+    {
+      tesseract_kinematics::forEachRedundantSolution<double>(
+          solution, joint_limits, redundancy_indices, [&sorted](const Eigen::VectorXd& redundant_solution) {
+            sorted.push_back(redundant_solution);
+            return true;
+          });
+    }
+  }
 
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
-        }
+  // The distances are calculated once, ties keep the order of the solver
+  std::vector<double> distances(sorted.size());
+  for (std::size_t i = 0; i < sorted.size(); ++i)
+    distances[i] = (sorted[i] - seed).norm();
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-      else
-      {
-        tesseract_common::TransformMap state0 = manip.calcFwdKin(traj.row(iStep));
-        tesseract_common::TransformMap state1 = manip.calcFwdKin(traj.row(iStep + 1));
-        segment_results = checkTrajectorySegment(manager, state0, state1, config.contact_request);
-        if (!segment_results.empty())
-        {
-          found = true;
-          if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
-          {
-            std::stringstream ss;
-            ss << "Continuous collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
+  std::vector<std::size_t> order(sorted.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+      order.begin(), order.end(), [&distances](std::size_t a, std::size_t b) { return distances[a] < distances[b]; });
 
-            ss << "     Names:";
-            for (const auto& name : manip.getJointNames())
-              ss << " " << name;
+  tesseract_kinematics::IKSolutions result;
+  result.reserve(sorted.size());
+  for (std::size_t i : order)
+    result.push_back(std::move(sorted[i]));
 
-            ss << std::endl
-               << "    State0: " << traj.row(iStep) << std::endl
-               << "    State1: " << traj.row(iStep + 1) << std::endl;
+  return result;
+}
 
-            CONSOLE_BRIDGE_logError(ss.str().c_str());
-          }
-        }
+/**
+ * @brief Checks joint states of a group for collision
+ * @details The active collision objects which are links of the group are looked up once, so each check only calculates
+ * the transforms of these links.
+ */
+class IKSolutionChecker
+{
+public:
+  IKSolutionChecker(tesseract_collision::DiscreteContactManager& manager,
+                    const tesseract_kinematics::JointGroup& manip,
+                    const tesseract_collision::CollisionCheckConfig& config)
+    : manager_(manager), request_(config.contact_request), binding_(manip, manager)
+  {
+    manager_.applyContactManagerConfig(config.contact_manager_config);
+  }
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-    }
+  /** @brief Check if a joint state of the group is collision free */
+  bool isCollisionFree(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+  {
+    QueryContext::Scope context;
+    binding_.update(joint_values);
+    contacts_.clear();
+    manager_.contactTest(contacts_, request_);
+    return contacts_.empty();
+  }
+
+private:
+  tesseract_collision::DiscreteContactManager& manager_;
+  tesseract_collision::ContactRequest request_;
+  ContactManagerBinding binding_;
+  tesseract_collision::ContactResultMap contacts_;
+};
+
+}  // namespace
+
+/**
+ * @brief Get the active Link Names Recursively
+ *
+ *        This currently only works for graphs that are trees. Need to create a generic method using boost::visitor
+ *        TODO: Need to update using graph->getLinkChildren
+ *
+ * @param active_links
+ * @param scene_graph
+ * @param current_link
+ * @param active
+ */
+void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
+                                 const tesseract_scene_graph::SceneGraph& scene_graph,
+                                 const std::string& current_link,
+                                 bool active)
+{
+  // recursively get all active links
+  assert(scene_graph.isTree());
+  if (active)
+  {
+    active_links.push_back(current_link);
+    for (const auto& child_link : scene_graph.getAdjacentLinkNames(current_link))
+      getActiveLinkNamesRecursive(active_links, scene_graph, child_link, active);
   }
   else
   {
-    for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
+    for (const auto& child_link : scene_graph.getAdjacentLinkNames(current_link))
+      if (scene_graph.getInboundJoints(child_link)[0]->type != tesseract_scene_graph::JointType::FIXED)
+        getActiveLinkNamesRecursive(active_links, scene_graph, child_link, true);
+      else
+        getActiveLinkNamesRecursive(active_links, scene_graph, child_link, active);
+  }
+}
+
+tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                                                             const tesseract_common::TransformMap& state0,
+                                                             const tesseract_common::TransformMap& state1,
+                                                             const tesseract_collision::CollisionCheckConfig& config,
+                                                             TrajectorySegmentCache* cache)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectorySegment(manager, state0, state1, config.contact_request, cache);
+}
+
+tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                                                             const tesseract_common::TransformMap& state0,
+                                                             const tesseract_common::TransformMap& state1,
+                                                             const tesseract_collision::ContactRequest& contact_request,
+                                                             TrajectorySegmentCache* cache)
+{
+  tesseract_collision::ContactResultMap collisions;
+  checkTrajectorySegment(collisions, manager, state0, state1, contact_request, cache);
+  return collisions;
+}
+
+void checkTrajectorySegment(tesseract_collision::ContactResultMap& contacts,
+                            tesseract_collision::ContinuousContactManager& manager,
+                            const tesseract_common::TransformMap& state0,
+                            const tesseract_common::TransformMap& state1,
+                            const tesseract_collision::ContactRequest& contact_request,
+                            TrajectorySegmentCache* cache)
+{
+  contacts.clear();
+  if (cache != nullptr && cache->get(contacts, manager, state0, state1, contact_request))
+    return;
+
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
+
+  manager.contactTest(contacts, contact_request);
+
+  if (cache != nullptr)
+    cache->insert(manager, state0, state1, contact_request, contacts);
+
+  logContactResults(contacts, "Continuous");
+}
+
+tesseract_collision::ContactResultMap checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                                                             const tesseract_common::LinkTransforms& state0,
+                                                             const tesseract_common::LinkTransforms& state1,
+                                                             const tesseract_collision::CollisionCheckConfig& config)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectorySegment(manager, state0, state1, config.contact_request);
+}
+
+tesseract_collision::ContactResultMap
+checkTrajectorySegment(tesseract_collision::ContinuousContactManager& manager,
+                       const tesseract_common::LinkTransforms& state0,
+                       const tesseract_common::LinkTransforms& state1,
+                       const tesseract_collision::ContactRequest& contact_request)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
+
+  tesseract_collision::ContactResultMap collisions;
+  manager.contactTest(collisions, contact_request);
+  logContactResults(collisions, "Continuous");
+  return collisions;
+}
+
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::TransformMap& state,
+                                                           const tesseract_collision::CollisionCheckConfig& config)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectoryState(manager, state, config.contact_request);
+}
+
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::TransformMap& state,
+                                                           const tesseract_collision::ContactRequest& contact_request)
+{
+  tesseract_collision::ContactResultMap collisions;
+  checkTrajectoryState(collisions, manager, state, contact_request);
+  return collisions;
+}
+
+void checkTrajectoryState(tesseract_collision::ContactResultMap& contacts,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request)
+{
+  contacts.clear();
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state.at(link_name));
+
+  manager.contactTest(contacts, contact_request);
+  logContactResults(contacts, "Discrete");
+}
+
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::LinkTransforms& state,
+                                                           const tesseract_collision::CollisionCheckConfig& config)
+{
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectoryState(manager, state, config.contact_request);
+}
+
+tesseract_collision::ContactResultMap checkTrajectoryState(tesseract_collision::DiscreteContactManager& manager,
+                                                           const tesseract_common::LinkTransforms& state,
+                                                           const tesseract_collision::ContactRequest& contact_request)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state.at(link_name));
+
+  tesseract_collision::ContactResultMap collisions;
+  manager.contactTest(collisions, contact_request);
+  logContactResults(collisions, "Discrete");
+  return collisions;
+}
+
+/**
+ * @brief This process contact results
+ * @param segment_results
+ * @param sub_segment_results
+ * @param segment_index
+ * @param segment_last_index
+ * @param manip_active_link_names
+ * @param discrete
+ */
+void processInterpolatedSubSegmentCollisionResults(tesseract_collision::ContactResultMap& segment_results,
+                                                   tesseract_collision::ContactResultMap& sub_segment_results,
+                                                   int sub_segment_index,
+                                                   int sub_segment_last_index,
+                                                   const std::vector<std::string>& manip_active_link_names,
+                                                   bool discrete)
+{
+  double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
+  for (auto& pair : sub_segment_results)
+  {
+    // Update cc_time and cc_type
+    for (auto& r : pair.second)
     {
-      tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
-      segment_results.clear();
-
-      tesseract_common::TransformMap state0 = manip.calcFwdKin(traj.row(iStep));
-      tesseract_common::TransformMap state1 = manip.calcFwdKin(traj.row(iStep + 1));
-
-      segment_results = checkTrajectorySegment(manager, state0, state1, config.contact_request);
-      if (!segment_results.empty())
+      // Iterate over the two time values in r.cc_time
+      for (size_t j = 0; j < 2; ++j)
       {
-        found = true;
-        if (console_bridge::getLogLevel() > console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
+        if (std::find(manip_active_link_names.begin(), manip_active_link_names.end(), r.link_names[j]) !=
+            manip_active_link_names.end())
         {
-          std::stringstream ss;
-          ss << "Discrete collision detected at step: " << iStep << " of " << (traj.rows() - 1) << std::endl;
-
-          ss << "     Names:";
-          for (const auto& name : manip.getJointNames())
-            ss << " " << name;
-
-          ss << std::endl
-             << "    State0: " << traj.row(iStep) << std::endl
-             << "    State1: " << traj.row(iStep + 1) << std::endl;
+          r.cc_time[j] = (r.cc_time[j] < 0) ?
+                             (static_cast<double>(sub_segment_index) * segment_dt) :
+                             (static_cast<double>(sub_segment_index) * segment_dt) + (r.cc_time[j] * segment_dt);
+          assert(r.cc_time[j] >= 0.0 && r.cc_time[j] <= 1.0);
+          if (sub_segment_index == 0 &&
+              (r.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Time0 || discrete))
+            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Time0;
+          else if (sub_segment_index == sub_segment_last_index &&
+                   (r.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Time1 || discrete))
+            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Time1;
+          else
+            r.cc_type[j] = tesseract_collision::ContinuousCollisionType::CCType_Between;
 
-          CONSOLE_BRIDGE_logError(ss.str().c_str());
+          // If discrete set cc_transform for discrete continuous
+          if (discrete)
+            r.cc_transform = r.transform;
         }
       }
 
-      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-        break;
+      if (sub_segment_last_index > 0)
+      {
+        // Add results to the full segment results
+        auto it = segment_results.find(pair.first);
+        if (it == segment_results.end())
+          segment_results.insert(pair);
+        else
+          it->second.insert(it->second.end(), pair.second.begin(), pair.second.end());
+      }
     }
   }
 
-  return found;
+  if (sub_segment_last_index == 0)
+    segment_results = sub_segment_results;
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache)
+{
+  checkContinuousConfig(traj, config);
+  StepResultsVector results(contacts, traj.rows() - 1);
+  return checkTrajectoryContinuous(results, manager, state_solver, joint_names, traj, config, cache);
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache)
+{
+  checkContinuousConfig(traj, config);
+  StepResultsVector results(contacts, traj.rows() - 1);
+  return checkTrajectoryContinuous(results, manager, manip, traj, config, cache);
 }
 
 bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
@@ -499,24 +1203,20 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_common::TrajArray& traj,
                      const tesseract_collision::CollisionCheckConfig& config)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
-    throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type");
-
-  if (traj.rows() == 0)
-    throw std::runtime_error("checkTrajectory was given continuous contact manager with empty trajectory.");
+  checkDiscreteConfig(traj, config);
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  QueryContext::Scope context;
+
   contacts.resize(static_cast<size_t>(traj.rows()));
   if (traj.rows() == 1)
   {
     tesseract_collision::ContactResultMap& state_results = contacts[0];
     state_results.clear();
     tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(0));
-    tesseract_collision::ContactResultMap sub_state_results =
-        checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+    tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+    checkTrajectoryState(sub_state_results, manager, state.link_transforms, config.contact_request);
     processInterpolatedSubSegmentCollisionResults(state_results,
                                                   sub_state_results,
                                                   0,
@@ -526,9 +1226,25 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     return (!state_results.empty());
   }
 
+  if (config.bisection_order && config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
+  {
+    auto calc_state = [&state_solver, &joint_names, &manager](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+      tesseract_common::TransformMap link_transforms;
+      state_solver.getLinkTransforms(link_transforms, manager.getActiveCollisionObjects(), joint_names, joint_values);
+      return link_transforms;
+    };
+    return checkTrajectoryBisection(contacts, manager, calc_state, traj, config);
+  }
+
   bool found = false;
+
+  // Only the transforms of the active collision objects are computed, updated in place for every state checked
+  const std::vector<std::string>& active_links = manager.getActiveCollisionObjects();
+  tesseract_common::TransformMap& link_transforms = context->link_transforms;
+
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
+    tesseract_common::TrajArray subtraj;
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
@@ -541,15 +1257,13 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       if (dist > 0 && dist > config.longest_valid_segment_length)
       {
         int cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, traj.cols());
-        for (long iVar = 0; iVar < traj.cols(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(iStep)(iVar), traj.row(iStep + 1)(iVar));
+        tesseract_common::interpolateLinear(subtraj, traj.row(iStep), traj.row(iStep + 1), cnt);
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
-          tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_collision::ContactResultMap sub_state_results =
-              checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+          state_solver.getLinkTransforms(link_transforms, active_links, joint_names, subtraj.row(iSubStep));
+          tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+          checkTrajectoryState(sub_state_results, manager, link_transforms, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -585,9 +1299,9 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       }
       else
       {
-        tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(iStep));
-        tesseract_collision::ContactResultMap sub_segment_results =
-            checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+        state_solver.getLinkTransforms(link_transforms, active_links, joint_names, traj.row(iStep));
+        tesseract_collision::ContactResultMap& sub_segment_results = context->contacts;
+        checkTrajectoryState(sub_segment_results, manager, link_transforms, config.contact_request);
         if (!sub_segment_results.empty())
         {
           found = true;
@@ -615,14 +1329,17 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   }
   else
   {
+    // The transforms of the collision objects are computed for the whole trajectory at once
+    const std::vector<tesseract_common::TransformMap> traj_link_transforms =
+        state_solver.getLinkTransforms(joint_names, traj, active_links);
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& state_results = contacts[static_cast<size_t>(iStep)];
       state_results.clear();
 
-      tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, traj.row(iStep));
-      tesseract_collision::ContactResultMap sub_state_results =
-          checkTrajectoryState(manager, state.link_transforms, config.contact_request);
+      tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+      checkTrajectoryState(
+          sub_state_results, manager, traj_link_transforms[static_cast<size_t>(iStep)], config.contact_request);
       if (!sub_state_results.empty())
       {
         found = true;
@@ -656,16 +1373,12 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_common::TrajArray& traj,
                      const tesseract_collision::CollisionCheckConfig& config)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
-    throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type");
-
-  if (traj.rows() == 0)
-    throw std::runtime_error("checkTrajectory was given continuous contact manager with empty trajectory.");
+  checkDiscreteConfig(traj, config);
 
   manager.applyContactManagerConfig(config.contact_manager_config);
 
+  QueryContext::Scope context;
+
   contacts.resize(static_cast<size_t>(traj.rows()));
   if (traj.rows() == 1)
   {
@@ -673,16 +1386,47 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     state_results.clear();
 
     tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(0));
-    tesseract_collision::ContactResultMap sub_state_results =
-        checkTrajectoryState(manager, state, config.contact_request);
+    tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
     processInterpolatedSubSegmentCollisionResults(
         state_results, sub_state_results, 0, 0, manager.getActiveCollisionObjects(), true);
     return (!state_results.empty());
   }
 
+  if (config.bisection_order && config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
+  {
+    auto calc_state = [&manip](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+      return manip.calcFwdKin(joint_values);
+    };
+    return checkTrajectoryBisection(contacts, manager, calc_state, traj, config);
+  }
+
   bool found = false;
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE && config.adaptive_longest_valid_segment)
+  {
+    auto calc_state = [&manip](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+      return manip.calcFwdKin(joint_values);
+    };
+
+    for (long iStep = 0; iStep < traj.rows(); ++iStep)
+    {
+      if (checkTrajectoryStep(contacts[static_cast<size_t>(iStep)],
+                              manager,
+                              calc_state,
+                              traj,
+                              iStep,
+                              config,
+                              &manip.getJointMotionBounds()))
+      {
+        found = true;
+        if (config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
+          break;
+      }
+    }
+  }
+  else if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
+    tesseract_common::TrajArray subtraj;
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
       tesseract_collision::ContactResultMap& segment_results = contacts[static_cast<size_t>(iStep)];
@@ -695,15 +1439,13 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       if (dist > 0 && dist > config.longest_valid_segment_length)
       {
         int cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, traj.cols());
-        for (long iVar = 0; iVar < traj.cols(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(iStep)(iVar), traj.row(iStep + 1)(iVar));
+        tesseract_common::interpolateLinear(subtraj, traj.row(iStep), traj.row(iStep + 1), cnt);
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
           tesseract_common::TransformMap state = manip.calcFwdKin(subtraj.row(iSubStep));
-          tesseract_collision::ContactResultMap sub_state_results =
-              checkTrajectoryState(manager, state, config.contact_request);
+          tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+          checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -740,8 +1482,8 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       else
       {
         tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(iStep));
-        tesseract_collision::ContactResultMap sub_state_results =
-            checkTrajectoryState(manager, state, config.contact_request);
+        tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
         if (!sub_state_results.empty())
         {
           found = true;
@@ -776,8 +1518,8 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       state_results.clear();
 
       tesseract_common::TransformMap state = manip.calcFwdKin(traj.row(iStep));
-      tesseract_collision::ContactResultMap sub_state_results =
-          checkTrajectoryState(manager, state, config.contact_request);
+      tesseract_collision::ContactResultMap& sub_state_results = context->contacts;
+      checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
       if (!sub_state_results.empty())
       {
         found = true;
@@ -806,4 +1548,474 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   return found;
 }
 
+void TrajectoryCollisionSummary::clear(long num_steps)
+{
+  first_collision_step = -1;
+  worst_step = -1;
+  num_collision_steps = 0;
+  min_distances.setConstant(num_steps, std::numeric_limits<double>::infinity());
+  worst_pairs.assign(static_cast<std::size_t>(num_steps), {});
+}
+
+void TrajectoryCollisionSummary::update(long step, const tesseract_collision::ContactResultMap& contacts)
+{
+  const tesseract_collision::ContactResult* worst{ nullptr };
+  for (const auto& pair : contacts)
+  {
+    for (const auto& result : pair.second)
+    {
+      if (worst == nullptr || result.distance < worst->distance)
+        worst = &result;
+    }
+  }
+
+  if (worst == nullptr)
+    return;
+
+  if (first_collision_step < 0 || step < first_collision_step)
+    first_collision_step = step;
+
+  ++num_collision_steps;
+  min_distances[step] = worst->distance;
+  worst_pairs[static_cast<std::size_t>(step)] = { tesseract_common::NameId(worst->link_names[0]),
+                                                  tesseract_common::NameId(worst->link_names[1]) };
+  if (worst_step < 0 || worst->distance < min_distances[worst_step])
+    worst_step = step;
+}
+
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache)
+{
+  checkContinuousConfig(traj, config);
+  QueryContext::Scope context;
+  StepResultsSummary results(summary, context->contacts, traj.rows() - 1);
+  return checkTrajectoryContinuous(results, manager, state_solver, joint_names, traj, config, cache);
+}
+
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache)
+{
+  checkContinuousConfig(traj, config);
+  QueryContext::Scope context;
+  StepResultsSummary results(summary, context->contacts, traj.rows() - 1);
+  return checkTrajectoryContinuous(results, manager, manip, traj, config, cache);
+}
+
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkDiscreteConfig(traj, config);
+  QueryContext::Scope context;
+  StepResultsSummary results(summary, context->contacts, traj.rows());
+  return checkTrajectorySteps(results, manager, getCalcStateFn(manager, state_solver, joint_names), traj, config);
+}
+
+bool checkTrajectory(TrajectoryCollisionSummary& summary,
+                     tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkDiscreteConfig(traj, config);
+  QueryContext::Scope context;
+  StepResultsSummary results(summary, context->contacts, traj.rows());
+  return checkTrajectorySteps(
+      results, manager, getCalcStateFn(manip), traj, config, getAdaptiveMotionBounds(manip, config));
+}
+
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const std::vector<std::string>& joint_names,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkContinuousConfig(traj, config);
+  if (step < 0 || step >= traj.rows() - 1)
+    throw std::out_of_range("checkTrajectoryStep was given a step which is not a segment of the trajectory.");
+
+  StepResultsMap results(contacts);
+  const tesseract_common::TrajArray segment = traj.middleRows(step, 2);
+  return checkTrajectoryContinuous(results, manager, state_solver, joint_names, segment, config, nullptr);
+}
+
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_kinematics::JointGroup& manip,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkContinuousConfig(traj, config);
+  if (step < 0 || step >= traj.rows() - 1)
+    throw std::out_of_range("checkTrajectoryStep was given a step which is not a segment of the trajectory.");
+
+  StepResultsMap results(contacts);
+  const tesseract_common::TrajArray segment = traj.middleRows(step, 2);
+  return checkTrajectoryContinuous(results, manager, manip, segment, config, nullptr);
+}
+
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const std::vector<std::string>& joint_names,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkDiscreteConfig(traj, config);
+  if (step < 0 || step >= traj.rows())
+    throw std::out_of_range("checkTrajectoryStep was given a step which is not a state of the trajectory.");
+
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectoryStep(contacts, manager, getCalcStateFn(manager, state_solver, joint_names), traj, step, config);
+}
+
+bool checkTrajectoryStep(tesseract_collision::ContactResultMap& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_kinematics::JointGroup& manip,
+                         const tesseract_common::TrajArray& traj,
+                         long step,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  checkDiscreteConfig(traj, config);
+  if (step < 0 || step >= traj.rows())
+    throw std::out_of_range("checkTrajectoryStep was given a step which is not a state of the trajectory.");
+
+  manager.applyContactManagerConfig(config.contact_manager_config);
+  return checkTrajectoryStep(
+      contacts, manager, getCalcStateFn(manip), traj, step, config, getAdaptiveMotionBounds(manip, config));
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::ContinuousContactManager::UPtr>& managers,
+                     const std::vector<tesseract_scene_graph::StateSolver::UPtr>& state_solvers,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache,
+                     const tesseract_common::Executor::Ptr& executor)
+{
+  checkContinuousConfig(traj, config);
+
+  if (managers.empty() || managers.size() != state_solvers.size())
+    throw std::runtime_error("checkTrajectory requires the same number of contact managers and state solvers.");
+
+  for (const auto& manager : managers)
+    manager->applyContactManagerConfig(config.contact_manager_config);
+
+  contacts.clear();
+  contacts.resize(static_cast<size_t>(traj.rows() - 1));
+  return checkTrajectoryParallel(
+      contacts,
+      (executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor(),
+      managers.size(),
+      (config.contact_request.type == tesseract_collision::ContactTestType::FIRST),
+      [&](std::size_t worker_idx, long iStep, tesseract_collision::ContactResultMap& segment_results) {
+        const tesseract_scene_graph::StateSolver& state_solver = *state_solvers[worker_idx];
+        auto calc_state = [&state_solver, &joint_names](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+          return state_solver.getState(joint_names, joint_values).link_transforms;
+        };
+        return checkTrajectoryStep(segment_results, *managers[worker_idx], calc_state, traj, iStep, config, cache);
+      });
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::ContinuousContactManager::UPtr>& managers,
+                     const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     TrajectorySegmentCache* cache,
+                     const tesseract_common::Executor::Ptr& executor)
+{
+  checkContinuousConfig(traj, config);
+
+  if (managers.empty() || managers.size() != manips.size())
+    throw std::runtime_error("checkTrajectory requires the same number of contact managers and joint groups.");
+
+  for (const auto& manager : managers)
+    manager->applyContactManagerConfig(config.contact_manager_config);
+
+  contacts.clear();
+  contacts.resize(static_cast<size_t>(traj.rows() - 1));
+  return checkTrajectoryParallel(
+      contacts,
+      (executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor(),
+      managers.size(),
+      (config.contact_request.type == tesseract_collision::ContactTestType::FIRST),
+      [&](std::size_t worker_idx, long iStep, tesseract_collision::ContactResultMap& segment_results) {
+        const tesseract_kinematics::JointGroup& manip = *manips[worker_idx];
+        auto calc_state = [&manip](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+          return manip.calcFwdKin(joint_values);
+        };
+        return checkTrajectoryStep(segment_results, *managers[worker_idx], calc_state, traj, iStep, config, cache);
+      });
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                     const std::vector<tesseract_scene_graph::StateSolver::UPtr>& state_solvers,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     const tesseract_common::Executor::Ptr& executor)
+{
+  checkDiscreteConfig(traj, config);
+
+  if (managers.empty() || managers.size() != state_solvers.size())
+    throw std::runtime_error("checkTrajectory requires the same number of contact managers and state solvers.");
+
+  for (const auto& manager : managers)
+    manager->applyContactManagerConfig(config.contact_manager_config);
+
+  contacts.clear();
+  contacts.resize(static_cast<size_t>(traj.rows()));
+  return checkTrajectoryParallel(
+      contacts,
+      (executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor(),
+      managers.size(),
+      (config.contact_request.type == tesseract_collision::ContactTestType::FIRST),
+      [&](std::size_t worker_idx, long iStep, tesseract_collision::ContactResultMap& state_results) {
+        const tesseract_scene_graph::StateSolver& state_solver = *state_solvers[worker_idx];
+        auto calc_state = [&state_solver, &joint_names](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+          return state_solver.getState(joint_names, joint_values).link_transforms;
+        };
+        return checkTrajectoryStep(state_results, *managers[worker_idx], calc_state, traj, iStep, config);
+      });
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                     const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     const tesseract_common::Executor::Ptr& executor)
+{
+  checkDiscreteConfig(traj, config);
+
+  if (managers.empty() || managers.size() != manips.size())
+    throw std::runtime_error("checkTrajectory requires the same number of contact managers and joint groups.");
+
+  for (const auto& manager : managers)
+    manager->applyContactManagerConfig(config.contact_manager_config);
+
+  contacts.clear();
+  contacts.resize(static_cast<size_t>(traj.rows()));
+  return checkTrajectoryParallel(
+      contacts,
+      (executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor(),
+      managers.size(),
+      (config.contact_request.type == tesseract_collision::ContactTestType::FIRST),
+      [&](std::size_t worker_idx, long iStep, tesseract_collision::ContactResultMap& state_results) {
+        const tesseract_kinematics::JointGroup& manip = *manips[worker_idx];
+        auto calc_state = [&manip](const Eigen::Ref<const Eigen::VectorXd>& joint_values) {
+          return manip.calcFwdKin(joint_values);
+        };
+        return checkTrajectoryStep(
+            state_results, *managers[worker_idx], calc_state, traj, iStep, config, &manip.getJointMotionBounds());
+      });
+}
+
+void calcContactDistanceGradients(Eigen::MatrixXd& gradients,
+                                  const tesseract_kinematics::JointGroup& group,
+                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                  const tesseract_collision::ContactResultVector& contacts)
+{
+  gradients.setZero(static_cast<Eigen::Index>(contacts.size()), group.numJoints());
+
+  // Collect the active links of the contacts so each link transform and jacobian is calculated once
+  const std::vector<std::string> active_links = group.getActiveLinkNames();
+  std::vector<std::string> link_names;
+  for (const auto& contact : contacts)
+  {
+    for (const auto& link_name : contact.link_names)
+    {
+      if (std::find(link_names.begin(), link_names.end(), link_name) == link_names.end() &&
+          std::find(active_links.begin(), active_links.end(), link_name) != active_links.end())
+        link_names.push_back(link_name);
+    }
+  }
+
+  if (link_names.empty())
+    return;
+
+  tesseract_common::VectorIsometry3d link_transforms(link_names.size());
+  group.calcFwdKin(link_transforms, joint_values, group.getLinkIndices(link_names));
+
+  std::vector<Eigen::MatrixXd> link_jacobians;
+  link_jacobians.reserve(link_names.size());
+  for (const auto& link_name : link_names)
+    link_jacobians.push_back(group.calcJacobian(joint_values, link_name));
+
+  Eigen::MatrixXd point_jacobian(6, group.numJoints());
+  for (std::size_t c = 0; c < contacts.size(); ++c)
+  {
+    const tesseract_collision::ContactResult& contact = contacts[c];
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+      auto it = std::find(link_names.begin(), link_names.end(), contact.link_names[i]);
+      if (it == link_names.end())
+        continue;
+
+      // Moving link_names[1] along the normal increases the distance, moving link_names[0] along it decreases it
+      const auto idx = static_cast<std::size_t>(std::distance(link_names.begin(), it));
+      point_jacobian = link_jacobians[idx];
+      tesseract_common::jacobianChangeRefPoint(point_jacobian,
+                                               contact.nearest_points[i] - link_transforms[idx].translation());
+
+      const double sign = (i == 0) ? -1.0 : 1.0;
+      gradients.row(static_cast<Eigen::Index>(c)).noalias() +=
+          sign * contact.normal.transpose() * point_jacobian.topRows<3>();
+    }
+  }
+}
+
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(tesseract_collision::DiscreteContactManager& manager,
+                               const tesseract_kinematics::JointGroup& manip,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions,
+                               bool include_redundant)
+{
+  tesseract_kinematics::IKSolutions sorted = getSortedIKSolutions(manip, solutions, seed, include_redundant);
+
+  IKSolutionChecker checker(manager, manip, config);
+  tesseract_kinematics::IKSolutions valid;
+  for (auto& solution : sorted)
+  {
+    if (max_solutions > 0 && valid.size() >= max_solutions)
+      break;
+
+    if (checker.isCollisionFree(solution))
+      valid.push_back(std::move(solution));
+  }
+
+  return valid;
+}
+
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(const std::vector<tesseract_collision::DiscreteContactManager::UPtr>& managers,
+                               const std::vector<tesseract_kinematics::JointGroup::UPtr>& manips,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions,
+                               bool include_redundant,
+                               const tesseract_common::Executor::Ptr& executor)
+{
+  if (managers.empty() || managers.size() != manips.size())
+    throw std::runtime_error("filterCollisionFreeIKSolutions requires the same number of contact managers and joint "
+                             "groups.");
+
+  tesseract_kinematics::IKSolutions sorted = getSortedIKSolutions(*manips.front(), solutions, seed, include_redundant);
+  const std::size_t num_workers = std::min(managers.size(), sorted.size());
+  if (num_workers == 0)
+    return {};
+
+  // Solutions are handed out in order, so once max_solutions are found every closer solution has been checked
+  std::vector<char> collision_free(sorted.size(), 0);
+  std::atomic<std::size_t> next{ 0 };
+  std::atomic<std::size_t> num_valid{ 0 };
+  std::atomic<bool> abort{ false };
+  std::vector<std::exception_ptr> errors(num_workers);
+
+  auto worker = [&](std::size_t worker_idx) {
+    try
+    {
+      IKSolutionChecker checker(*managers[worker_idx], *manips[worker_idx], config);
+      for (std::size_t i = next++; i < sorted.size() && !abort; i = next++)
+      {
+        if (max_solutions > 0 && num_valid >= max_solutions)
+          break;
+
+        if (checker.isCollisionFree(sorted[i]))
+        {
+          collision_free[i] = 1;
+          ++num_valid;
+        }
+      }
+    }
+    catch (...)
+    {
+      errors[worker_idx] = std::current_exception();
+      abort = true;
+    }
+  };
+
+  ((executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor()).parallelFor(num_workers, worker);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  tesseract_kinematics::IKSolutions valid;
+  for (std::size_t i = 0; i < sorted.size(); ++i)
+  {
+    if (max_solutions > 0 && valid.size() >= max_solutions)
+      break;
+
+    if (collision_free[i] != 0)
+      valid.push_back(std::move(sorted[i]));
+  }
+
+  return valid;
+}
+
+tesseract_kinematics::IKSolutions
+filterCollisionFreeIKSolutions(const Environment& env,
+                               const tesseract_kinematics::JointGroup& manip,
+                               const tesseract_kinematics::IKSolutions& solutions,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                               const tesseract_collision::CollisionCheckConfig& config,
+                               std::size_t max_solutions,
+                               bool include_redundant,
+                               std::size_t threads)
+{
+  const std::vector<std::string> active_links = manip.getActiveLinkNames();
+  auto createManager = [&env, &active_links]() {
+    tesseract_collision::DiscreteContactManager::UPtr manager = env.getDiscreteContactManager();
+    if (manager == nullptr)
+      throw std::runtime_error("filterCollisionFreeIKSolutions, the environment has no discrete contact manager!");
+
+    manager->setActiveCollisionObjects(active_links);
+    return manager;
+  };
+
+  if (threads <= 1)
+  {
+    tesseract_collision::DiscreteContactManager::UPtr manager = createManager();
+    return filterCollisionFreeIKSolutions(*manager, manip, solutions, seed, config, max_solutions, include_redundant);
+  }
+
+  std::vector<tesseract_collision::DiscreteContactManager::UPtr> managers;
+  std::vector<tesseract_kinematics::JointGroup::UPtr> manips;
+  managers.reserve(threads);
+  manips.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i)
+  {
+    managers.push_back(createManager());
+    manips.push_back(std::make_unique<tesseract_kinematics::JointGroup>(manip));
+  }
+
+  return filterCollisionFreeIKSolutions(managers, manips, solutions, seed, config, max_solutions, include_redundant);
+}
+
 }  // namespace tesseract_environment
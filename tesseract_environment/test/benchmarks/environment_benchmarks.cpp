@@ -0,0 +1,349 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands.h>
+#include <tesseract_environment/utils.h>
+#include <tesseract_geometry/impl/box.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+/** @brief The tesseract_support robot models the benchmarks are run with */
+struct RobotInfo
+{
+  /** @brief The name used in the benchmark names */
+  std::string name;
+  /** @brief The urdf file path */
+  std::string urdf_path;
+  /** @brief The srdf file path */
+  std::string srdf_path;
+  /** @brief The group used for the kinematics and trajectory benchmarks */
+  std::string group_name;
+};
+
+std::vector<RobotInfo> getRobots()
+{
+  const std::string urdf_dir = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/";
+  return { { "ABB_IRB2400", urdf_dir + "abb_irb2400.urdf", urdf_dir + "abb_irb2400.srdf", "manipulator" },
+           { "KUKA_IIWA_14", urdf_dir + "lbr_iiwa_14_r820.urdf", urdf_dir + "lbr_iiwa_14_r820.srdf", "manipulator" },
+           { "KUKA_IIWA_7", urdf_dir + "iiwa7.urdf", urdf_dir + "iiwa7.srdf", "manipulator" } };
+}
+
+Environment::Ptr getEnvironment(const RobotInfo& robot)
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  if (!env->init(tesseract_common::fs::path(robot.urdf_path), tesseract_common::fs::path(robot.srdf_path), locator))
+    throw std::runtime_error("Failed to initialize environment for robot: " + robot.name);
+
+  return env;
+}
+
+/**
+ * @brief Get the commands typically applied by an application, which leave the environment unchanged once all are
+ * applied
+ * @details A link is attached to the tip of the group, moved to the base of the group, has its collision disabled
+ * and is removed
+ */
+Commands getCommands(const Environment& env, const std::string& group_name)
+{
+  auto joint_group = env.getJointGroup(group_name);
+  const std::vector<std::string> link_names = joint_group->getLinkNames();
+
+  Link link("benchmark_link");
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1);
+  link.collision.push_back(collision);
+
+  Joint attach_joint("benchmark_joint");
+  attach_joint.type = JointType::FIXED;
+  attach_joint.parent_link_name = link_names.back();
+  attach_joint.child_link_name = link.getName();
+  attach_joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.1);
+
+  Joint move_joint = attach_joint.clone("benchmark_move_joint");
+  move_joint.parent_link_name = env.getRootLinkName();
+
+  Commands commands;
+  commands.push_back(std::make_shared<AddLinkCommand>(link, attach_joint));
+  commands.push_back(std::make_shared<MoveLinkCommand>(move_joint));
+  commands.push_back(std::make_shared<ChangeLinkCollisionEnabledCommand>(link.getName(), false));
+  commands.push_back(std::make_shared<RemoveLinkCommand>(link.getName()));
+  return commands;
+}
+
+/** @brief Get a trajectory from all joints at zero to all joints at the midpoint of their upper limits */
+tesseract_common::TrajArray getTrajectory(const tesseract_kinematics::JointGroup& joint_group)
+{
+  const Eigen::MatrixX2d limits = joint_group.getLimits().joint_limits;
+  const Eigen::VectorXd start = Eigen::VectorXd::Zero(limits.rows());
+  const Eigen::VectorXd end = 0.5 * limits.col(1);
+
+  const long steps = 10;
+  tesseract_common::TrajArray traj(steps, limits.rows());
+  for (long i = 0; i < steps; ++i)
+    traj.row(i) = start + (end - start) * (static_cast<double>(i) / static_cast<double>(steps - 1));
+
+  return traj;
+}
+
+/** @brief Benchmark that checks the environment init from the urdf and srdf files */
+static void BM_ENVIRONMENT_INIT(benchmark::State& state, RobotInfo robot)
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  const tesseract_common::fs::path urdf_path(robot.urdf_path);
+  const tesseract_common::fs::path srdf_path(robot.srdf_path);
+  for (auto _ : state)
+  {
+    Environment env;
+    benchmark::DoNotOptimize(env.init(urdf_path, srdf_path, locator));
+  }
+}
+
+/** @brief Benchmark that checks applying a typical mix of commands */
+static void BM_ENVIRONMENT_APPLY_COMMANDS(benchmark::State& state, Environment::Ptr env, Commands commands)
+{
+  for (auto _ : state)
+  {
+    if (!env->applyCommands(commands))
+    {
+      state.SkipWithError("Failed to apply commands");
+      break;
+    }
+  }
+}
+
+/** @brief Benchmark that checks setting the joint values of the environment */
+static void BM_ENVIRONMENT_SET_STATE(benchmark::State& state,
+                                     Environment::Ptr env,
+                                     std::vector<std::string> joint_names,
+                                     Eigen::VectorXd joint_values)
+{
+  for (auto _ : state)
+    env->setState(joint_names, joint_values);
+}
+
+/** @brief Benchmark that checks getting the current state of the environment */
+static void BM_ENVIRONMENT_GET_STATE(benchmark::State& state, Environment::Ptr env)
+{
+  SceneState scene_state;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_state = env->getState());
+  }
+}
+
+/** @brief Benchmark that checks calculating the state of the environment for joint values */
+static void BM_ENVIRONMENT_GET_STATE_JOINT_VALUES(benchmark::State& state,
+                                                  Environment::Ptr env,
+                                                  std::vector<std::string> joint_names,
+                                                  Eigen::VectorXd joint_values)
+{
+  SceneState scene_state;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_state = env->getState(joint_names, joint_values));
+  }
+}
+
+/** @brief Benchmark that checks getting a clone of the active discrete contact manager */
+static void BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER(benchmark::State& state, Environment::Ptr env)
+{
+  DiscreteContactManager::UPtr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getDiscreteContactManager());
+  }
+}
+
+/** @brief Benchmark that checks getting a clone of the active continuous contact manager */
+static void BM_ENVIRONMENT_GET_CONTINUOUS_CONTACT_MANAGER(benchmark::State& state, Environment::Ptr env)
+{
+  ContinuousContactManager::UPtr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getContinuousContactManager());
+  }
+}
+
+/** @brief Benchmark that checks getting a kinematic group */
+static void BM_ENVIRONMENT_GET_KINEMATIC_GROUP(benchmark::State& state, Environment::Ptr env, std::string group_name)
+{
+  tesseract_kinematics::KinematicGroup::UPtr kin_group;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(kin_group = env->getKinematicGroup(group_name));
+  }
+}
+
+/** @brief Benchmark that checks a trajectory with the longest valid segment discrete collision check */
+static void BM_CHECK_TRAJECTORY_LVS_DISCRETE(benchmark::State& state, Environment::Ptr env, std::string group_name)
+{
+  auto joint_group = env->getJointGroup(group_name);
+  auto manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+  const tesseract_common::TrajArray traj = getTrajectory(*joint_group);
+
+  CollisionCheckConfig config;
+  config.type = CollisionEvaluatorType::LVS_DISCRETE;
+  config.contact_request.type = ContactTestType::ALL;
+
+  std::vector<ContactResultMap> contacts;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(checkTrajectory(contacts, *manager, *joint_group, traj, config));
+  }
+}
+
+/** @brief Benchmark that checks a trajectory with the longest valid segment continuous collision check */
+static void BM_CHECK_TRAJECTORY_LVS_CONTINUOUS(benchmark::State& state, Environment::Ptr env, std::string group_name)
+{
+  auto joint_group = env->getJointGroup(group_name);
+  auto manager = env->getContinuousContactManager();
+  manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+  const tesseract_common::TrajArray traj = getTrajectory(*joint_group);
+
+  CollisionCheckConfig config;
+  config.type = CollisionEvaluatorType::LVS_CONTINUOUS;
+  config.contact_request.type = ContactTestType::ALL;
+
+  std::vector<ContactResultMap> contacts;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(checkTrajectory(contacts, *manager, *joint_group, traj, config));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  for (const RobotInfo& robot : getRobots())
+  {
+    Environment::Ptr env = getEnvironment(robot);
+    std::vector<std::string> joint_names = env->getGroupJointNames(robot.group_name);
+    Eigen::VectorXd joint_values = 0.5 * env->getJointGroup(robot.group_name)->getLimits().joint_limits.col(1);
+
+    //////////////////////////////////////
+    // Init
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, RobotInfo)> BM_INIT_FUNC = BM_ENVIRONMENT_INIT;
+      std::string name = "BM_ENVIRONMENT_INIT_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_INIT_FUNC, robot)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    //////////////////////////////////////
+    // Commands
+    //////////////////////////////////////
+
+    {
+      // Use a separate environment so the command history does not affect the other benchmarks
+      std::function<void(benchmark::State&, Environment::Ptr, Commands)> BM_APPLY_COMMANDS_FUNC =
+          BM_ENVIRONMENT_APPLY_COMMANDS;
+      std::string name = "BM_ENVIRONMENT_APPLY_COMMANDS_" + robot.name;
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_APPLY_COMMANDS_FUNC, getEnvironment(robot), getCommands(*env, robot.group_name))
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // State
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::vector<std::string>, Eigen::VectorXd)>
+          BM_SET_STATE_FUNC = BM_ENVIRONMENT_SET_STATE;
+      std::string name = "BM_ENVIRONMENT_SET_STATE_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, env, joint_names, joint_values)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr)> BM_GET_STATE_FUNC = BM_ENVIRONMENT_GET_STATE;
+      std::string name = "BM_ENVIRONMENT_GET_STATE_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_FUNC, env)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::vector<std::string>, Eigen::VectorXd)>
+          BM_GET_STATE_JOINT_VALUES_FUNC = BM_ENVIRONMENT_GET_STATE_JOINT_VALUES;
+      std::string name = "BM_ENVIRONMENT_GET_STATE_JOINT_VALUES_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_JOINT_VALUES_FUNC, env, joint_names, joint_values)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Contact Managers
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr)> BM_GET_DISCRETE_FUNC =
+          BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER;
+      std::string name = "BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_DISCRETE_FUNC, env)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr)> BM_GET_CONTINUOUS_FUNC =
+          BM_ENVIRONMENT_GET_CONTINUOUS_CONTACT_MANAGER;
+      std::string name = "BM_ENVIRONMENT_GET_CONTINUOUS_CONTACT_MANAGER_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_CONTINUOUS_FUNC, env)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Kinematics
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::string)> BM_GET_KINEMATIC_GROUP_FUNC =
+          BM_ENVIRONMENT_GET_KINEMATIC_GROUP;
+      std::string name = "BM_ENVIRONMENT_GET_KINEMATIC_GROUP_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_KINEMATIC_GROUP_FUNC, env, robot.group_name)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Check Trajectory
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::string)> BM_LVS_DISCRETE_FUNC =
+          BM_CHECK_TRAJECTORY_LVS_DISCRETE;
+      std::string name = "BM_CHECK_TRAJECTORY_LVS_DISCRETE_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_LVS_DISCRETE_FUNC, env, robot.group_name)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::string)> BM_LVS_CONTINUOUS_FUNC =
+          BM_CHECK_TRAJECTORY_LVS_CONTINUOUS;
+      std::string name = "BM_CHECK_TRAJECTORY_LVS_CONTINUOUS_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_LVS_CONTINUOUS_FUNC, env, robot.group_name)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
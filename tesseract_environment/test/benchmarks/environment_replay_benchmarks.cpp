@@ -0,0 +1,167 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_image.h>
+#include <tesseract_environment/query_replayer.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_environment;
+
+/**
+ * @brief Record a small log of typical queries for the ABB IRB2400, used when no log is provided
+ * @param env The environment, its state is changed while recording
+ * @return The recorded queries
+ */
+std::vector<RecordedQuery> recordQueries(Environment& env)
+{
+  const std::string group_name = "manipulator";
+  auto recorder = std::make_shared<QueryRecorder>();
+  env.setQueryRecorder(recorder);
+
+  auto joint_group = env.getJointGroup(group_name);
+  const std::vector<std::string> joint_names = joint_group->getJointNames();
+  const Eigen::VectorXd end = 0.5 * joint_group->getLimits().joint_limits.col(1);
+
+  const long steps = 10;
+  tesseract_common::TrajArray traj(steps, end.size());
+  for (long i = 0; i < steps; ++i)
+    traj.row(i) = end * (static_cast<double>(i) / static_cast<double>(steps - 1));
+
+  tesseract_collision::CollisionCheckConfig config(0.01);
+  config.type = tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE;
+
+  auto kin_group = env.getKinematicGroup(group_name);
+  for (long i = 0; i < steps; ++i)
+  {
+    const Eigen::VectorXd joint_values = traj.row(i);
+    env.setState(joint_names, joint_values);
+    recorder->recordContactTest(env.getRevision(),
+                                joint_names,
+                                joint_values,
+                                tesseract_collision::ContactRequest(tesseract_collision::ContactTestType::ALL));
+
+    if (kin_group != nullptr)
+    {
+      const std::string tip_link_name = kin_group->getAllPossibleTipLinkNames().front();
+      const std::string base_link_name = kin_group->getBaseLinkName();
+      const tesseract_common::TransformMap poses = kin_group->calcFwdKin(joint_values);
+      tesseract_kinematics::KinGroupIKInputs inputs;
+      inputs.emplace_back(
+          poses.at(base_link_name).inverse() * poses.at(tip_link_name), base_link_name, tip_link_name);
+      recorder->recordCalcInvKin(env.getRevision(), group_name, inputs, joint_values);
+    }
+  }
+
+  recorder->recordCheckTrajectory(env.getRevision(), group_name, traj, config);
+  env.setQueryRecorder(nullptr);
+  return recorder->getQueries();
+}
+
+/** @brief Benchmark that replays queries in order */
+static void BM_REPLAY(benchmark::State& state, Environment::Ptr env, std::vector<RecordedQuery> queries)
+{
+  QueryReplayer replayer(std::move(env));
+  for (auto _ : state)
+  {
+    if (replayer.replay(queries) != queries.size())
+    {
+      state.SkipWithError("Failed to replay the queries");
+      break;
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+/**
+ * @brief Get the value of an option and remove it from the arguments, so they can be passed to google benchmark
+ * @return The value, empty if the option is not provided
+ */
+std::string takeOption(int& argc, char** argv, const std::string& option)
+{
+  for (int i = 1; i + 1 < argc; ++i)
+  {
+    if (option != argv[i])  // NOLINT
+      continue;
+
+    std::string value = argv[i + 1];  // NOLINT
+    for (int j = i; j + 2 <= argc; ++j)
+      argv[j] = argv[j + 2];  // NOLINT
+    argc -= 2;
+    return value;
+  }
+
+  return {};
+}
+
+/**
+ * @brief Replay a production query log with --image <environment image> --log <query log>, otherwise a small log of
+ * the ABB IRB2400 is recorded and replayed
+ */
+int main(int argc, char** argv)
+{
+  const std::string image_path = takeOption(argc, argv, "--image");
+  const std::string log_path = takeOption(argc, argv, "--log");
+
+  Environment::Ptr env;
+  std::vector<RecordedQuery> queries;
+  if (!image_path.empty() && !log_path.empty())
+  {
+    env = loadEnvironmentImage(image_path);
+    if (env == nullptr || !loadQueryLog(log_path, queries))
+      return 1;
+  }
+  else
+  {
+    const std::string urdf_dir = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/";
+    auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+    env = std::make_shared<Environment>();
+    if (!env->init(tesseract_common::fs::path(urdf_dir + "abb_irb2400.urdf"),
+                   tesseract_common::fs::path(urdf_dir + "abb_irb2400.srdf"),
+                   locator))
+      return 1;
+
+    queries = recordQueries(*env);
+  }
+
+  {
+    std::function<void(benchmark::State&, Environment::Ptr, std::vector<RecordedQuery>)> BM_REPLAY_FUNC = BM_REPLAY;
+    benchmark::RegisterBenchmark("BM_REPLAY_ALL", BM_REPLAY_FUNC, Environment::Ptr(env->clone()), queries)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMillisecond);
+  }
+
+  const std::vector<std::pair<RecordedQueryType, std::string>> types{
+    { RecordedQueryType::SET_STATE, "SET_STATE" },
+    { RecordedQueryType::CONTACT_TEST, "CONTACT_TEST" },
+    { RecordedQueryType::CHECK_TRAJECTORY, "CHECK_TRAJECTORY" },
+    { RecordedQueryType::CALC_INV_KIN, "CALC_INV_KIN" }
+  };
+  for (const auto& type : types)
+  {
+    std::vector<RecordedQuery> type_queries;
+    std::copy_if(queries.begin(), queries.end(), std::back_inserter(type_queries), [&type](const RecordedQuery& q) {
+      return q.type == type.first;
+    });
+
+    if (type_queries.empty())
+      continue;
+
+    std::function<void(benchmark::State&, Environment::Ptr, std::vector<RecordedQuery>)> BM_REPLAY_FUNC = BM_REPLAY;
+    std::string name = "BM_REPLAY_" + type.second;
+    benchmark::RegisterBenchmark(name.c_str(), BM_REPLAY_FUNC, Environment::Ptr(env->clone()), type_queries)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
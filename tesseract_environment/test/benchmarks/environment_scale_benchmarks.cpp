@@ -0,0 +1,386 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_geometry/impl/box.h>
+#include <tesseract_geometry/impl/cylinder.h>
+#include <tesseract_srdf/srdf_model.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+/** @brief The number of links of each synthetic robot cell, a fixed base, six revolute joints and a fixed tool */
+const int CELL_LINK_COUNT = 8;
+
+/** @brief The link counts of the synthetic scene graphs */
+const std::vector<int> LINK_COUNTS = { 1000, 10000, 100000 };
+
+std::string getCellLinkName(int cell, int index)
+{
+  return "cell_" + std::to_string(cell) + "_link_" + std::to_string(index);
+}
+
+/**
+ * @brief Get a synthetic factory model with the provided number of links
+ * @details The world link has a grid of robot cells attached, each with a fixed base, a chain of six revolute joints
+ * and a fixed tool. The last cell is incomplete if the link count requires it. Every link uses the same two primitive
+ * geometries for its collision and visual, like a model of many identical robots loaded with a shared mesh cache.
+ */
+SceneGraph::Ptr getSyntheticSceneGraph(int link_count)
+{
+  auto box = std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2);
+  auto cylinder = std::make_shared<tesseract_geometry::Cylinder>(0.05, 0.3);
+
+  auto scene_graph = std::make_shared<SceneGraph>("synthetic_" + std::to_string(link_count));
+  scene_graph->addLink(Link("world"));
+
+  const int cells_per_row = 32;
+  for (int i = 1; i < link_count; ++i)
+  {
+    const int cell = (i - 1) / CELL_LINK_COUNT;
+    const int index = (i - 1) % CELL_LINK_COUNT;
+    const bool fixed = (index == 0 || index == CELL_LINK_COUNT - 1);
+
+    Link link(getCellLinkName(cell, index));
+    auto collision = std::make_shared<Collision>();
+    collision->geometry = fixed ? tesseract_geometry::Geometry::Ptr(box) : tesseract_geometry::Geometry::Ptr(cylinder);
+    link.collision.push_back(collision);
+    auto visual = std::make_shared<Visual>();
+    visual->geometry = collision->geometry;
+    link.visual.push_back(visual);
+
+    Joint joint("cell_" + std::to_string(cell) + "_joint_" + std::to_string(index));
+    joint.child_link_name = link.getName();
+    if (index == 0)
+    {
+      joint.type = JointType::FIXED;
+      joint.parent_link_name = "world";
+      joint.parent_to_joint_origin_transform.translation() =
+          Eigen::Vector3d(2.0 * (cell % cells_per_row), 2.0 * (cell / cells_per_row), 0);
+    }
+    else
+    {
+      joint.type = fixed ? JointType::FIXED : JointType::REVOLUTE;
+      joint.parent_link_name = getCellLinkName(cell, index - 1);
+      joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.3);
+      if (!fixed)
+      {
+        joint.axis = (index % 2 == 0) ? Eigen::Vector3d::UnitZ() : Eigen::Vector3d::UnitY();
+        joint.limits = std::make_shared<JointLimits>(-3.0, 3.0, 0.0, 1.0, 1.0);
+      }
+    }
+
+    scene_graph->addLink(link, joint);
+  }
+
+  return scene_graph;
+}
+
+/** @brief Get the srdf model providing the bullet contact managers */
+tesseract_srdf::SRDFModel::Ptr getSRDFModel()
+{
+  auto srdf = std::make_shared<tesseract_srdf::SRDFModel>();
+  auto& info = srdf->contact_managers_plugin_info;
+  info.search_libraries.insert("tesseract_collision_bullet_factories");
+  info.discrete_plugin_infos.default_plugin = "BulletDiscreteBVHManager";
+  info.discrete_plugin_infos.plugins["BulletDiscreteBVHManager"].class_name = "BulletDiscreteBVHManagerFactory";
+  info.continuous_plugin_infos.default_plugin = "BulletCastBVHManager";
+  info.continuous_plugin_infos.plugins["BulletCastBVHManager"].class_name = "BulletCastBVHManagerFactory";
+  return srdf;
+}
+
+/**
+ * @brief The synthetic scene graph and environment of a link count
+ * @details Only the model of the benchmarks being run is kept, so the largest models are not all in memory at once
+ */
+struct SyntheticModel
+{
+  int link_count{ 0 };
+  SceneGraph::Ptr scene_graph;
+  Environment::Ptr env;
+};
+
+SyntheticModel& getSyntheticModel(int link_count, bool with_environment)
+{
+  static SyntheticModel model;
+  if (model.link_count != link_count)
+  {
+    model = SyntheticModel();
+    model.link_count = link_count;
+    model.scene_graph = getSyntheticSceneGraph(link_count);
+  }
+
+  if (with_environment && model.env == nullptr)
+  {
+    model.env = std::make_shared<Environment>();
+    if (!model.env->init(*model.scene_graph, getSRDFModel()))
+      throw std::runtime_error("Failed to initialize the synthetic environment: " + std::to_string(link_count));
+  }
+
+  return model;
+}
+
+/** @brief The index of the last complete cell of a synthetic scene graph */
+int getLastCell(int link_count) { return ((link_count - 1) / CELL_LINK_COUNT) - 1; }
+
+/** @brief Benchmark that checks building the scene graph link by link */
+static void BM_SCENE_GRAPH_BUILD(benchmark::State& state, int link_count)
+{
+  SceneGraph::Ptr scene_graph;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_graph = getSyntheticSceneGraph(link_count));
+  }
+}
+
+/** @brief Benchmark that checks adding a link to the tool of the last cell and removing it */
+static void BM_SCENE_GRAPH_ADD_REMOVE_LINK(benchmark::State& state, int link_count)
+{
+  SceneGraph& scene_graph = *getSyntheticModel(link_count, false).scene_graph;
+
+  Link link("benchmark_link");
+  Joint joint("benchmark_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = getCellLinkName(getLastCell(link_count), CELL_LINK_COUNT - 1);
+  joint.child_link_name = link.getName();
+
+  for (auto _ : state)
+  {
+    if (!scene_graph.addLink(link, joint) || !scene_graph.removeLink(link.getName()))
+    {
+      state.SkipWithError("Failed to add and remove the link");
+      break;
+    }
+  }
+}
+
+/** @brief Benchmark that checks moving the last cell to the tool of the first cell and back */
+static void BM_SCENE_GRAPH_MOVE_JOINT(benchmark::State& state, int link_count)
+{
+  SceneGraph& scene_graph = *getSyntheticModel(link_count, false).scene_graph;
+  const std::string joint_name = "cell_" + std::to_string(getLastCell(link_count)) + "_joint_0";
+  const std::string parent_link_name = getCellLinkName(0, CELL_LINK_COUNT - 1);
+
+  for (auto _ : state)
+  {
+    if (!scene_graph.moveJoint(joint_name, parent_link_name) || !scene_graph.moveJoint(joint_name, "world"))
+    {
+      state.SkipWithError("Failed to move the joint");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Benchmark that checks the shortest path between the tools of the first and last cell
+ * @details If rebuild is true the scene graph is changed before each query, which is not timed, so the query includes
+ * compiling the scene graph instead of returning the cached path
+ */
+static void BM_SCENE_GRAPH_GET_SHORTEST_PATH(benchmark::State& state, int link_count, bool rebuild)
+{
+  SceneGraph& scene_graph = *getSyntheticModel(link_count, false).scene_graph;
+  const std::string root = getCellLinkName(0, CELL_LINK_COUNT - 1);
+  const std::string tip = getCellLinkName(getLastCell(link_count), CELL_LINK_COUNT - 1);
+
+  Link link("benchmark_link");
+  Joint joint("benchmark_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = "world";
+  joint.child_link_name = link.getName();
+
+  ShortestPath path;
+  for (auto _ : state)
+  {
+    if (rebuild)
+    {
+      state.PauseTiming();
+      scene_graph.addLink(link, joint);
+      scene_graph.removeLink(link.getName());
+      state.ResumeTiming();
+    }
+
+    benchmark::DoNotOptimize(path = scene_graph.getShortestPath(root, tip));
+  }
+}
+
+/** @brief Benchmark that checks the environment init from the scene graph */
+static void BM_ENVIRONMENT_INIT(benchmark::State& state, int link_count)
+{
+  const SceneGraph& scene_graph = *getSyntheticModel(link_count, false).scene_graph;
+  const tesseract_srdf::SRDFModel::Ptr srdf = getSRDFModel();
+  for (auto _ : state)
+  {
+    Environment env;
+    benchmark::DoNotOptimize(env.init(scene_graph, srdf));
+  }
+}
+
+/**
+ * @brief Benchmark that checks setting joint values of a state solver of the environment
+ * @param all Indicates if every active joint is set, otherwise only the first joint of the last cell is set
+ */
+static void BM_STATE_SOLVER_SET_STATE(benchmark::State& state, int link_count, bool all)
+{
+  StateSolver::UPtr solver = getSyntheticModel(link_count, true).env->getStateSolver();
+
+  std::vector<std::string> joint_names;
+  if (all)
+    joint_names = solver->getActiveJointNames();
+  else
+    joint_names.push_back("cell_" + std::to_string(getLastCell(link_count)) + "_joint_1");
+
+  const Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.5);
+  for (auto _ : state)
+    solver->setState(joint_names, joint_values);
+}
+
+/** @brief Benchmark that checks creating a discrete contact manager populated with the links of the environment */
+static void BM_ENVIRONMENT_POPULATE_DISCRETE_CONTACT_MANAGER(benchmark::State& state, int link_count)
+{
+  Environment::Ptr env = getSyntheticModel(link_count, true).env;
+  DiscreteContactManager::UPtr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getDiscreteContactManager("BulletDiscreteBVHManager"));
+  }
+}
+
+/** @brief Benchmark that checks creating a continuous contact manager populated with the links of the environment */
+static void BM_ENVIRONMENT_POPULATE_CONTINUOUS_CONTACT_MANAGER(benchmark::State& state, int link_count)
+{
+  Environment::Ptr env = getSyntheticModel(link_count, true).env;
+  ContinuousContactManager::UPtr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getContinuousContactManager("BulletCastBVHManager"));
+  }
+}
+
+/** @brief Benchmark that checks getting a clone of the active discrete contact manager */
+static void BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER(benchmark::State& state, int link_count)
+{
+  Environment::Ptr env = getSyntheticModel(link_count, true).env;
+  DiscreteContactManager::UPtr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getDiscreteContactManager());
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // The benchmarks of a link count are registered together, so the synthetic model is only created once for them
+  for (int link_count : LINK_COUNTS)
+  {
+    const std::string suffix = "_" + std::to_string(link_count);
+
+    //////////////////////////////////////
+    // Scene Graph
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, int)> BM_BUILD_FUNC = BM_SCENE_GRAPH_BUILD;
+      std::string name = "BM_SCENE_GRAPH_BUILD" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_BUILD_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, int)> BM_ADD_REMOVE_LINK_FUNC = BM_SCENE_GRAPH_ADD_REMOVE_LINK;
+      std::string name = "BM_SCENE_GRAPH_ADD_REMOVE_LINK" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_ADD_REMOVE_LINK_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, int)> BM_MOVE_JOINT_FUNC = BM_SCENE_GRAPH_MOVE_JOINT;
+      std::string name = "BM_SCENE_GRAPH_MOVE_JOINT" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_MOVE_JOINT_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, int, bool)> BM_SHORTEST_PATH_FUNC = BM_SCENE_GRAPH_GET_SHORTEST_PATH;
+      std::string name = "BM_SCENE_GRAPH_GET_SHORTEST_PATH_CACHED" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SHORTEST_PATH_FUNC, link_count, false)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      name = "BM_SCENE_GRAPH_GET_SHORTEST_PATH_REBUILD" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SHORTEST_PATH_FUNC, link_count, true)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Environment
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, int)> BM_INIT_FUNC = BM_ENVIRONMENT_INIT;
+      std::string name = "BM_ENVIRONMENT_INIT" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_INIT_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    //////////////////////////////////////
+    // State Solver
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, int, bool)> BM_SET_STATE_FUNC = BM_STATE_SOLVER_SET_STATE;
+      std::string name = "BM_STATE_SOLVER_SET_STATE_ALL_JOINTS" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, link_count, true)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+      name = "BM_STATE_SOLVER_SET_STATE_ONE_JOINT" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, link_count, false)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Contact Managers
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, int)> BM_POPULATE_DISCRETE_FUNC =
+          BM_ENVIRONMENT_POPULATE_DISCRETE_CONTACT_MANAGER;
+      std::string name = "BM_ENVIRONMENT_POPULATE_DISCRETE_CONTACT_MANAGER" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_POPULATE_DISCRETE_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, int)> BM_POPULATE_CONTINUOUS_FUNC =
+          BM_ENVIRONMENT_POPULATE_CONTINUOUS_CONTACT_MANAGER;
+      std::string name = "BM_ENVIRONMENT_POPULATE_CONTINUOUS_CONTACT_MANAGER" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_POPULATE_CONTINUOUS_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, int)> BM_GET_DISCRETE_FUNC = BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER;
+      std::string name = "BM_ENVIRONMENT_GET_DISCRETE_CONTACT_MANAGER" + suffix;
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_DISCRETE_FUNC, link_count)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,231 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_support/benchmark_scenes.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+/** @brief The query set of a benchmark scene */
+struct SceneQueries
+{
+  /** @brief The joint names of the queries */
+  std::vector<std::string> joint_names;
+  /** @brief The joint values of each query */
+  std::vector<Eigen::VectorXd> joint_values;
+  /** @brief The joint values of each query for the joints of the scene group */
+  std::vector<Eigen::VectorXd> group_joint_values;
+};
+
+Environment::Ptr getEnvironment(const tesseract_common::BenchmarkScene& scene)
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  const std::string urdf_path = locator->locateResource(scene.urdf_url)->getFilePath();
+  const std::string srdf_path = locator->locateResource(scene.srdf_url)->getFilePath();
+  auto env = std::make_shared<Environment>();
+  if (!env->init(tesseract_common::fs::path(urdf_path), tesseract_common::fs::path(srdf_path), locator))
+    throw std::runtime_error("Failed to initialize environment for scene: " + scene.name);
+
+  return env;
+}
+
+SceneQueries getQueries(const Environment& env, const tesseract_common::BenchmarkScene& scene)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  SceneQueries queries;
+  if (!tesseract_common::loadBenchmarkQueries(
+          queries.joint_names, queries.joint_values, *locator.locateResource(scene.queries_url)))
+    throw std::runtime_error("Failed to load queries for scene: " + scene.name);
+
+  std::vector<Eigen::Index> indices;
+  for (const auto& joint_name : env.getGroupJointNames(scene.group_name))
+  {
+    auto it = std::find(queries.joint_names.begin(), queries.joint_names.end(), joint_name);
+    if (it == queries.joint_names.end())
+      throw std::runtime_error("Queries for scene '" + scene.name + "' are missing joint: " + joint_name);
+
+    indices.push_back(static_cast<Eigen::Index>(std::distance(queries.joint_names.begin(), it)));
+  }
+
+  queries.group_joint_values.reserve(queries.joint_values.size());
+  for (const auto& values : queries.joint_values)
+  {
+    Eigen::VectorXd group_values(static_cast<Eigen::Index>(indices.size()));
+    for (std::size_t i = 0; i < indices.size(); ++i)
+      group_values(static_cast<Eigen::Index>(i)) = values(indices[i]);
+
+    queries.group_joint_values.push_back(group_values);
+  }
+
+  return queries;
+}
+
+/** @brief Benchmark that checks the environment init from the scene urdf and srdf files */
+static void BM_SCENE_INIT(benchmark::State& state, tesseract_common::BenchmarkScene scene)
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  const tesseract_common::fs::path urdf_path(locator->locateResource(scene.urdf_url)->getFilePath());
+  const tesseract_common::fs::path srdf_path(locator->locateResource(scene.srdf_url)->getFilePath());
+  for (auto _ : state)
+  {
+    Environment env;
+    benchmark::DoNotOptimize(env.init(urdf_path, srdf_path, locator));
+  }
+}
+
+/** @brief Benchmark that checks setting the joint values of the environment to each query in turn */
+static void BM_SCENE_SET_STATE(benchmark::State& state, Environment::Ptr env, SceneQueries queries)
+{
+  std::size_t i{ 0 };
+  for (auto _ : state)
+  {
+    env->setState(queries.joint_names, queries.joint_values[i]);
+    i = (i + 1) % queries.joint_values.size();
+  }
+}
+
+/** @brief Benchmark that checks a discrete contact test of the whole scene at each query in turn */
+static void BM_SCENE_DISCRETE_CONTACT_TEST(benchmark::State& state, Environment::Ptr env, SceneQueries queries)
+{
+  auto manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(env->getActiveLinkNames());
+
+  std::vector<tesseract_common::TransformMap> transforms;
+  transforms.reserve(queries.joint_values.size());
+  for (const auto& values : queries.joint_values)
+    transforms.push_back(env->getState(queries.joint_names, values).link_transforms);
+
+  const ContactRequest request(ContactTestType::ALL);
+  ContactResultMap results;
+  std::size_t i{ 0 };
+  for (auto _ : state)
+  {
+    results.clear();
+    manager->setCollisionObjectsTransform(transforms[i]);
+    manager->contactTest(results, request);
+    benchmark::DoNotOptimize(results);
+    i = (i + 1) % transforms.size();
+  }
+}
+
+/** @brief Benchmark that checks the forward kinematics of the scene group at each query in turn */
+static void BM_SCENE_FWD_KIN(benchmark::State& state,
+                             Environment::Ptr env,
+                             std::string group_name,
+                             SceneQueries queries)
+{
+  auto joint_group = env->getJointGroup(group_name);
+  tesseract_common::TransformMap link_transforms;
+  std::size_t i{ 0 };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(link_transforms = joint_group->calcFwdKin(queries.group_joint_values[i]));
+    i = (i + 1) % queries.group_joint_values.size();
+  }
+}
+
+/** @brief Benchmark that checks the inverse kinematics of the scene group for the tip pose of each query in turn */
+static void BM_SCENE_INV_KIN(benchmark::State& state,
+                             Environment::Ptr env,
+                             tesseract_common::BenchmarkScene scene,
+                             SceneQueries queries)
+{
+  auto kin_group = env->getKinematicGroup(scene.group_name);
+  const std::string working_frame = env->getRootLinkName();
+
+  std::vector<tesseract_kinematics::KinGroupIKInput> inputs;
+  inputs.reserve(queries.group_joint_values.size());
+  for (const auto& values : queries.group_joint_values)
+  {
+    const tesseract_common::TransformMap link_transforms = kin_group->calcFwdKin(values);
+    inputs.emplace_back(link_transforms.at(scene.tip_link_name), working_frame, scene.tip_link_name);
+  }
+
+  const Eigen::VectorXd seed = Eigen::VectorXd::Zero(kin_group->numJoints());
+  tesseract_kinematics::IKSolutions solutions;
+  std::size_t i{ 0 };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(solutions = kin_group->calcInvKin(inputs[i], seed));
+    i = (i + 1) % inputs.size();
+  }
+}
+
+int main(int argc, char** argv)
+{
+  for (const tesseract_common::BenchmarkScene& scene : tesseract_common::getBenchmarkScenes())
+  {
+    Environment::Ptr env = getEnvironment(scene);
+    SceneQueries queries = getQueries(*env, scene);
+
+    //////////////////////////////////////
+    // Init
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, tesseract_common::BenchmarkScene)> BM_INIT_FUNC = BM_SCENE_INIT;
+      std::string name = "BM_SCENE_INIT_" + scene.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_INIT_FUNC, scene)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    //////////////////////////////////////
+    // State
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, SceneQueries)> BM_SET_STATE_FUNC = BM_SCENE_SET_STATE;
+      std::string name = "BM_SCENE_SET_STATE_" + scene.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, env, queries)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Contact Checking
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, SceneQueries)> BM_DISCRETE_CONTACT_TEST_FUNC =
+          BM_SCENE_DISCRETE_CONTACT_TEST;
+      std::string name = "BM_SCENE_DISCRETE_CONTACT_TEST_" + scene.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_DISCRETE_CONTACT_TEST_FUNC, env, queries)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Kinematics
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, std::string, SceneQueries)> BM_FWD_KIN_FUNC =
+          BM_SCENE_FWD_KIN;
+      std::string name = "BM_SCENE_FWD_KIN_" + scene.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_FWD_KIN_FUNC, env, scene.group_name, queries)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, Environment::Ptr, tesseract_common::BenchmarkScene, SceneQueries)>
+          BM_INV_KIN_FUNC = BM_SCENE_INV_KIN;
+      std::string name = "BM_SCENE_INV_KIN_" + scene.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_INV_KIN_FUNC, env, scene, queries)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
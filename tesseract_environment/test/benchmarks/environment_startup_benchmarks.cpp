@@ -0,0 +1,261 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+#include <tesseract_srdf/srdf_model.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_environment;
+
+/** @brief The tesseract_support robot models the benchmarks are run with */
+struct RobotInfo
+{
+  /** @brief The name used in the benchmark names */
+  std::string name;
+  /** @brief The urdf file path */
+  std::string urdf_path;
+  /** @brief The srdf file path */
+  std::string srdf_path;
+  /** @brief The kinematics plugins file path, empty if the robot has none */
+  std::string plugins_path;
+};
+
+std::vector<RobotInfo> getRobots()
+{
+  const std::string urdf_dir = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/";
+  return { { "ABB_IRB2400",
+             urdf_dir + "abb_irb2400.urdf",
+             urdf_dir + "abb_irb2400.srdf",
+             urdf_dir + "abb_irb2400_plugins.yaml" },
+           { "KUKA_IIWA_14",
+             urdf_dir + "lbr_iiwa_14_r820.urdf",
+             urdf_dir + "lbr_iiwa_14_r820.srdf",
+             urdf_dir + "lbr_iiwa_14_r820_plugins.yaml" },
+           { "KUKA_IIWA_7", urdf_dir + "iiwa7.urdf", urdf_dir + "iiwa7.srdf", "" },
+           { "CAR_SEAT_DEMO", urdf_dir + "car_seat_demo.urdf", urdf_dir + "car_seat_demo.srdf", "" },
+           { "PUZZLE_PIECE_WORKCELL",
+             urdf_dir + "puzzle_piece_workcell.urdf",
+             urdf_dir + "puzzle_piece_workcell.srdf",
+             "" } };
+}
+
+/** @brief Create a scene graph with a chain of links connected by fixed joints */
+SceneGraph::UPtr getChainSceneGraph(int link_count)
+{
+  auto scene_graph = std::make_unique<SceneGraph>("benchmark");
+  scene_graph->addLink(Link("link_0"));
+  for (int i = 1; i < link_count; ++i)
+  {
+    scene_graph->addLink(Link("link_" + std::to_string(i)));
+
+    Joint joint("joint_" + std::to_string(i));
+    joint.type = JointType::FIXED;
+    joint.parent_link_name = "link_" + std::to_string(i - 1);
+    joint.child_link_name = "link_" + std::to_string(i);
+    scene_graph->addJoint(joint);
+  }
+  scene_graph->setRoot("link_0");
+
+  return scene_graph;
+}
+
+/** @brief Create a srdf which disables the collision of every pair of links of the chain scene graph */
+std::string getDisabledCollisionsSRDF(int link_count)
+{
+  std::stringstream srdf;
+  srdf << R"(<robot name="benchmark" version="1.0.0">)" << "\n";
+  for (int i = 0; i < link_count; ++i)
+  {
+    for (int j = i + 1; j < link_count; ++j)
+    {
+      srdf << R"(  <disable_collisions link1="link_)" << i << R"(" link2="link_)" << j << R"(" reason="Never"/>)"
+           << "\n";
+    }
+  }
+  srdf << "</robot>\n";
+  return srdf.str();
+}
+
+/** @brief Benchmark that parses a urdf file */
+static void BM_PARSE_URDF_FILE(benchmark::State& state, const std::string& urdf_path, bool load_visuals)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  SceneGraph::UPtr scene_graph;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(scene_graph = tesseract_urdf::parseURDFFile(urdf_path, locator, 1, load_visuals));
+}
+
+/** @brief Benchmark that parses a srdf file */
+static void BM_SRDF_INIT_FILE(benchmark::State& state, const SceneGraph::Ptr& scene_graph, const std::string& srdf_path)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  for (auto _ : state)
+  {
+    tesseract_srdf::SRDFModel srdf;
+    srdf.initFile(*scene_graph, srdf_path, locator);
+    benchmark::DoNotOptimize(srdf);
+  }
+}
+
+/** @brief Benchmark that parses a srdf string */
+static void BM_SRDF_INIT_STRING(benchmark::State& state,
+                                const SceneGraph::Ptr& scene_graph,
+                                const std::string& srdf_xml)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  for (auto _ : state)
+  {
+    tesseract_srdf::SRDFModel srdf;
+    srdf.initString(*scene_graph, srdf_xml, locator);
+    benchmark::DoNotOptimize(srdf);
+  }
+}
+
+/** @brief Benchmark that initializes an environment from a urdf and srdf file */
+static void BM_ENVIRONMENT_INIT(benchmark::State& state, const RobotInfo& robot)
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  for (auto _ : state)
+  {
+    Environment env;
+    benchmark::DoNotOptimize(
+        env.init(tesseract_common::fs::path(robot.urdf_path), tesseract_common::fs::path(robot.srdf_path), locator));
+  }
+}
+
+/** @brief Benchmark that constructs the kinematics plugin factory from a YAML file */
+static void BM_KINEMATICS_PLUGIN_FACTORY(benchmark::State& state, const std::string& plugins_path)
+{
+  for (auto _ : state)
+  {
+    tesseract_kinematics::KinematicsPluginFactory factory{ tesseract_common::fs::path(plugins_path) };
+    benchmark::DoNotOptimize(factory);
+  }
+}
+
+/** @brief Benchmark that constructs the kinematics plugin factory and creates the default solvers of a group */
+static void BM_KINEMATICS_PLUGIN_FACTORY_CREATE(benchmark::State& state,
+                                                const Environment::Ptr& env,
+                                                const std::string& plugins_path)
+{
+  const std::string group_name = "manipulator";
+  SceneGraph::ConstPtr scene_graph = env->getSceneGraph();
+  SceneState scene_state = env->getState();
+  for (auto _ : state)
+  {
+    tesseract_kinematics::KinematicsPluginFactory factory{ tesseract_common::fs::path(plugins_path) };
+    tesseract_kinematics::ForwardKinematics::UPtr fwd_kin;
+    tesseract_kinematics::InverseKinematics::UPtr inv_kin;
+    benchmark::DoNotOptimize(
+        fwd_kin = factory.createFwdKin(
+            group_name, factory.getDefaultFwdKinPlugin(group_name), *scene_graph, scene_state));
+    benchmark::DoNotOptimize(
+        inv_kin = factory.createInvKin(
+            group_name, factory.getDefaultInvKinPlugin(group_name), *scene_graph, scene_state));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+
+  for (const auto& robot : getRobots())
+  {
+    //////////////////////////////////////
+    // URDF
+    //////////////////////////////////////
+
+    for (bool load_visuals : { true, false })
+    {
+      std::function<void(benchmark::State&, std::string, bool)> BM_PARSE_URDF_FILE_FUNC = BM_PARSE_URDF_FILE;
+      std::string name = "BM_PARSE_URDF_FILE_" + robot.name + (load_visuals ? "" : "_NO_VISUALS");
+      benchmark::RegisterBenchmark(name.c_str(), BM_PARSE_URDF_FILE_FUNC, robot.urdf_path, load_visuals)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    //////////////////////////////////////
+    // SRDF
+    //////////////////////////////////////
+
+    {
+      SceneGraph::Ptr scene_graph = tesseract_urdf::parseURDFFile(robot.urdf_path, locator, 1, false);
+      std::function<void(benchmark::State&, SceneGraph::Ptr, std::string)> BM_SRDF_INIT_FILE_FUNC = BM_SRDF_INIT_FILE;
+      std::string name = "BM_SRDF_INIT_FILE_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_SRDF_INIT_FILE_FUNC, scene_graph, robot.srdf_path)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Environment
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, RobotInfo)> BM_ENVIRONMENT_INIT_FUNC = BM_ENVIRONMENT_INIT;
+      std::string name = "BM_ENVIRONMENT_INIT_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_ENVIRONMENT_INIT_FUNC, robot)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    //////////////////////////////////////
+    // Kinematics Plugin Factory
+    //////////////////////////////////////
+
+    if (robot.plugins_path.empty())
+      continue;
+
+    {
+      std::function<void(benchmark::State&, std::string)> BM_KINEMATICS_PLUGIN_FACTORY_FUNC =
+          BM_KINEMATICS_PLUGIN_FACTORY;
+      std::string name = "BM_KINEMATICS_PLUGIN_FACTORY_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_KINEMATICS_PLUGIN_FACTORY_FUNC, robot.plugins_path)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      auto env = std::make_shared<Environment>();
+      if (!env->init(tesseract_common::fs::path(robot.urdf_path),
+                     tesseract_common::fs::path(robot.srdf_path),
+                     std::make_shared<tesseract_common::TesseractSupportResourceLocator>()))
+        throw std::runtime_error("Failed to initialize environment for robot: " + robot.name);
+
+      std::function<void(benchmark::State&, Environment::Ptr, std::string)> BM_KINEMATICS_PLUGIN_FACTORY_CREATE_FUNC =
+          BM_KINEMATICS_PLUGIN_FACTORY_CREATE;
+      std::string name = "BM_KINEMATICS_PLUGIN_FACTORY_CREATE_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_KINEMATICS_PLUGIN_FACTORY_CREATE_FUNC, env, robot.plugins_path)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // SRDF Disabled Collisions
+  //////////////////////////////////////
+
+  for (int link_count : { 10, 50, 100, 200 })
+  {
+    SceneGraph::Ptr scene_graph = getChainSceneGraph(link_count);
+    std::function<void(benchmark::State&, SceneGraph::Ptr, std::string)> BM_SRDF_INIT_STRING_FUNC =
+        BM_SRDF_INIT_STRING;
+    std::string name = "BM_SRDF_DISABLED_COLLISIONS_" + std::to_string((link_count * (link_count - 1)) / 2);
+    benchmark::RegisterBenchmark(
+        name.c_str(), BM_SRDF_INIT_STRING_FUNC, scene_graph, getDisabledCollisionsSRDF(link_count))
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMillisecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,154 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_cache.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_environment;
+
+/**
+ * @brief The largest number of threads
+ * @details The benchmarks run the same query on 1 to 64 threads sharing one environment. The throughput in items per
+ * second scales with the thread count until the threads contend for a lock, the allocator or a shared cache line, so
+ * these regressions show up as a flattening of the throughput at the thread count where they start.
+ */
+const int MAX_THREADS = 64;
+
+const std::string GROUP_NAME = "manipulator";
+
+Environment::Ptr getEnvironment()
+{
+  const std::string urdf_dir = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/";
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  if (!env->init(tesseract_common::fs::path(urdf_dir + "abb_irb2400.urdf"),
+                 tesseract_common::fs::path(urdf_dir + "abb_irb2400.srdf"),
+                 locator))
+    throw std::runtime_error("Failed to initialize environment");
+
+  return env;
+}
+
+/** @brief Get joint values of the group which differ for each thread, so the threads do not share results */
+Eigen::VectorXd getJointValues(const Environment& env, int thread_index)
+{
+  const Eigen::MatrixX2d limits = env.getJointGroup(GROUP_NAME)->getLimits().joint_limits;
+  const double fraction = static_cast<double>(thread_index + 1) / static_cast<double>(MAX_THREADS + 1);
+  return limits.col(0) + fraction * (limits.col(1) - limits.col(0));
+}
+
+/** @brief Benchmark that runs contact tests with a contact manager cloned for each thread */
+static void BM_CLONED_CONTACT_MANAGER_CONTACT_TEST(benchmark::State& state, Environment::Ptr env)
+{
+  // Each thread clones its manager before it is timed, like the per thread managers of a planner
+  tesseract_collision::DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(env->getActiveLinkNames());
+  const tesseract_scene_graph::SceneState scene_state =
+      env->getState(env->getGroupJointNames(GROUP_NAME), getJointValues(*env, state.thread_index()));
+
+  tesseract_collision::ContactResultMap contacts;
+  const tesseract_collision::ContactRequest request(tesseract_collision::ContactTestType::ALL);
+  for (auto _ : state)
+  {
+    manager->setCollisionObjectsTransform(scene_state.link_transforms);
+    contacts.clear();
+    manager->contactTest(contacts, request);
+    benchmark::DoNotOptimize(contacts);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** @brief Benchmark that gets a clone of the discrete contact manager of the environment */
+static void BM_GET_DISCRETE_CONTACT_MANAGER(benchmark::State& state, Environment::Ptr env)
+{
+  for (auto _ : state)
+  {
+    tesseract_collision::DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+    benchmark::DoNotOptimize(manager);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** @brief Benchmark that gets a kinematic group of the environment */
+static void BM_GET_KINEMATIC_GROUP(benchmark::State& state, Environment::Ptr env)
+{
+  for (auto _ : state)
+  {
+    tesseract_kinematics::KinematicGroup::UPtr kin_group = env->getKinematicGroup(GROUP_NAME);
+    benchmark::DoNotOptimize(kin_group);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** @brief Benchmark that calculates the state of the environment for joint values of the group */
+static void BM_GET_STATE(benchmark::State& state, Environment::Ptr env)
+{
+  const std::vector<std::string> joint_names = env->getGroupJointNames(GROUP_NAME);
+  const Eigen::VectorXd joint_values = getJointValues(*env, state.thread_index());
+  for (auto _ : state)
+  {
+    tesseract_scene_graph::SceneState scene_state = env->getState(joint_names, joint_values);
+    benchmark::DoNotOptimize(scene_state);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/** @brief Benchmark that gets environments from a cache shared by the threads */
+static void BM_DEFAULT_ENVIRONMENT_CACHE(benchmark::State& state, std::shared_ptr<DefaultEnvironmentCache> cache)
+{
+  for (auto _ : state)
+  {
+    Environment::UPtr cached_env = cache->getCachedEnvironment();
+    benchmark::DoNotOptimize(cached_env);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+int main(int argc, char** argv)
+{
+  Environment::Ptr env = getEnvironment();
+
+  // Create the contact managers and the kinematics caches, so the benchmarks do not measure the first use
+  env->getDiscreteContactManager();
+  env->getKinematicGroup(GROUP_NAME);
+
+  const std::vector<std::pair<std::string, std::function<void(benchmark::State&, Environment::Ptr)>>> benchmarks{
+    { "BM_CLONED_CONTACT_MANAGER_CONTACT_TEST", BM_CLONED_CONTACT_MANAGER_CONTACT_TEST },
+    { "BM_GET_DISCRETE_CONTACT_MANAGER", BM_GET_DISCRETE_CONTACT_MANAGER },
+    { "BM_GET_KINEMATIC_GROUP", BM_GET_KINEMATIC_GROUP },
+    { "BM_GET_STATE", BM_GET_STATE }
+  };
+
+  for (const auto& bm : benchmarks)
+  {
+    benchmark::RegisterBenchmark(bm.first.c_str(), bm.second, env)
+        ->ThreadRange(1, MAX_THREADS)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    // The cache holds an environment for each thread, so it is only refilled when it runs out
+    auto cache = std::make_shared<DefaultEnvironmentCache>(env, MAX_THREADS);
+    std::function<void(benchmark::State&, std::shared_ptr<DefaultEnvironmentCache>)> BM_CACHE_FUNC =
+        BM_DEFAULT_ENVIRONMENT_CACHE;
+    benchmark::RegisterBenchmark("BM_DEFAULT_ENVIRONMENT_CACHE", BM_CACHE_FUNC, cache)
+        ->ThreadRange(1, MAX_THREADS)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
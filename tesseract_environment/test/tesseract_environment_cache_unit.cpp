@@ -94,6 +94,60 @@ TEST(TesseractEnvironmentCache, defaultEnvironmentCacheTest)  // NOLINT
   cache.refreshCache();
 }
 
+TEST(TesseractEnvironmentCache, asyncEnvironmentCacheTest)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  DefaultEnvironmentCache cache(env, 5, true);
+  EXPECT_TRUE(cache.isAsync());
+  EXPECT_EQ(cache.getCacheSize(), 5);
+
+  for (int i = 0; i < 20; ++i)
+  {
+    Environment::UPtr cached_env = cache.getCachedEnvironment();
+    EXPECT_TRUE(cached_env != nullptr);
+    EXPECT_EQ(cached_env->getRevision(), 3);
+  }
+
+  EnvironmentCacheMetrics metrics = cache.getMetrics();
+  EXPECT_EQ(metrics.hits + metrics.misses, 20);
+  EXPECT_GE(metrics.total_wait_time, metrics.max_wait_time);
+
+  addLink(*env);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    Environment::UPtr cached_env = cache.getCachedEnvironment();
+    EXPECT_TRUE(cached_env != nullptr);
+    EXPECT_EQ(cached_env->getRevision(), 4);
+  }
+
+  EXPECT_EQ(cache.getMetrics().hits + cache.getMetrics().misses, 30);
+
+  cache.resetMetrics();
+  metrics = cache.getMetrics();
+  EXPECT_EQ(metrics.hits, 0);
+  EXPECT_EQ(metrics.misses, 0);
+  EXPECT_EQ(metrics.total_wait_time.count(), 0);
+  EXPECT_EQ(metrics.max_wait_time.count(), 0);
+
+  DefaultEnvironmentCache sync_cache(env, 5);
+  EXPECT_FALSE(sync_cache.isAsync());
+  Environment::UPtr cached_env = sync_cache.getCachedEnvironment();
+  EXPECT_EQ(cached_env->getRevision(), 4);
+  EXPECT_EQ(sync_cache.getMetrics().misses, 1);
+  cached_env = sync_cache.getCachedEnvironment();
+  EXPECT_EQ(sync_cache.getMetrics().hits, 1);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
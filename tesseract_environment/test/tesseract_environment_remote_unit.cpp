@@ -0,0 +1,215 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include <tesseract_urdf/urdf_parser.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/commands/change_link_collision_enabled_command.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/remote_collision_checking.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_srdf;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+Environment::Ptr getEnvironment()
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  const std::string urdf_path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/boxbot.urdf";
+  const std::string srdf_path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/boxbot.srdf";
+  SceneGraph::UPtr scene_graph = tesseract_urdf::parseURDFFile(urdf_path, locator);
+  auto srdf = std::make_shared<SRDFModel>();
+  srdf->initFile(*scene_graph, srdf_path, locator);
+
+  auto env = std::make_shared<Environment>();
+  env->init(*scene_graph, srdf);
+  return env;
+}
+
+RecordedQuery getContactTest(const Eigen::Vector2d& joint_values)
+{
+  RecordedQuery query;
+  query.type = RecordedQueryType::CONTACT_TEST;
+  query.joint_names = { "boxbot_x_joint", "boxbot_y_joint" };
+  query.joint_values = joint_values;
+  query.contact_request.type = ContactTestType::ALL;
+  return query;
+}
+
+TEST(TesseractEnvironmentRemoteUnit, encodeDecodeResponse)  // NOLINT
+{
+  ContactResult contact;
+  contact.distance = -0.1;
+  contact.link_names = { "link_a", "link_b" };
+  contact.nearest_points[0] = Eigen::Vector3d(1, 2, 3);
+  contact.normal = Eigen::Vector3d(0, 0, 1);
+  contact.transform[1].translation() = Eigen::Vector3d(4, 5, 6);
+  contact.cc_type[0] = ContinuousCollisionType::CCType_Between;
+  contact.cc_time[0] = 0.5;
+
+  RemoteCollisionResponse response;
+  response.revision = 3;
+  response.results.resize(2);
+  response.results[0].checked = true;
+  response.results[0].in_collision = true;
+  response.results[0].contacts.resize(2);
+  response.results[0].contacts[1][{ "link_a", "link_b" }].push_back(contact);
+  response.results[1].message = "failed";
+
+  RemoteCollisionResponse decoded;
+  EXPECT_TRUE(decodeRemoteCollisionResponse(decoded, encodeRemoteCollisionResponse(response)));
+  EXPECT_EQ(decoded.revision, 3);
+  ASSERT_EQ(decoded.results.size(), 2);
+  EXPECT_TRUE(decoded.results[0].checked);
+  EXPECT_TRUE(decoded.results[0].in_collision);
+  ASSERT_EQ(decoded.results[0].contacts.size(), 2);
+  EXPECT_TRUE(decoded.results[0].contacts[0].empty());
+  ASSERT_EQ(decoded.results[0].contacts[1].numContacts(), 1);
+
+  const ContactResult& decoded_contact = decoded.results[0].contacts[1].begin()->second.front();
+  EXPECT_NEAR(decoded_contact.distance, -0.1, 1e-12);
+  EXPECT_EQ(decoded_contact.link_names[1], "link_b");
+  EXPECT_TRUE(decoded_contact.nearest_points[0].isApprox(contact.nearest_points[0]));
+  EXPECT_TRUE(decoded_contact.normal.isApprox(contact.normal));
+  EXPECT_TRUE(decoded_contact.transform[1].isApprox(contact.transform[1]));
+  EXPECT_EQ(decoded_contact.cc_type[0], ContinuousCollisionType::CCType_Between);
+  EXPECT_NEAR(decoded_contact.cc_time[0], 0.5, 1e-12);
+
+  EXPECT_FALSE(decoded.results[1].checked);
+  EXPECT_EQ(decoded.results[1].message, "failed");
+
+  EXPECT_FALSE(decodeRemoteCollisionResponse(decoded, "invalid"));
+  RemoteCollisionRequest request;
+  EXPECT_FALSE(decodeRemoteCollisionRequest(request, "invalid"));
+}
+
+TEST(TesseractEnvironmentRemoteUnit, serverClient)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  ASSERT_TRUE(env->isInitialized());
+
+  RemoteCollisionServer server1;
+  RemoteCollisionServer server2(std::make_shared<Environment>(),
+                                std::make_shared<tesseract_common::SequentialExecutor>());
+  std::vector<RemoteCollisionTransportFn> servers{
+    [&server1](const std::string& data) { return server1.handle(data); },
+    [&server2](const std::string& data) { return server2.handle(data); },
+  };
+
+  EXPECT_ANY_THROW(RemoteCollisionClient(nullptr, servers));  // NOLINT
+  EXPECT_ANY_THROW(RemoteCollisionClient(env, {}));           // NOLINT
+
+  RemoteCollisionClient client(env, servers);
+  EXPECT_EQ(client.getServerCount(), 2);
+  EXPECT_TRUE(client.getEnvironment() == env);
+
+  std::vector<RecordedQuery> queries;
+  for (int i = 0; i < 5; ++i)
+    queries.push_back(getContactTest((i % 2 == 0) ? Eigen::Vector2d(0, 0) : Eigen::Vector2d(1.05, 0)));
+
+  RecordedQuery trajectory_query;
+  trajectory_query.type = RecordedQueryType::CHECK_TRAJECTORY;
+  trajectory_query.group_name = "manipulator";
+  trajectory_query.trajectory.resize(3, 2);
+  trajectory_query.trajectory << 1.05, 2, 1.05, 0, 0, 0;
+  trajectory_query.config.type = CollisionEvaluatorType::DISCRETE;
+  trajectory_query.config.contact_request.type = ContactTestType::ALL;
+  queries.push_back(trajectory_query);
+
+  RecordedQuery ik_query;
+  ik_query.type = RecordedQueryType::CALC_INV_KIN;
+  queries.push_back(ik_query);
+
+  {  // The results match the local checks and the servers are synchronized
+    std::vector<RemoteCollisionResult> results = client.check(queries);
+    ASSERT_EQ(results.size(), queries.size());
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      EXPECT_TRUE(results[i].checked);
+      EXPECT_EQ(results[i].in_collision, i % 2 == 0);
+      ASSERT_EQ(results[i].contacts.size(), 1);
+
+      DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+      const SceneState state = env->getState(queries[i].joint_names, queries[i].joint_values);
+      manager->setCollisionObjectsTransform(state.link_transforms);
+      ContactResultMap expected;
+      manager->contactTest(expected, queries[i].contact_request);
+      EXPECT_EQ(results[i].contacts.front().numContacts(), expected.numContacts());
+    }
+
+    EXPECT_TRUE(results[5].checked);
+    EXPECT_TRUE(results[5].in_collision);
+    EXPECT_FALSE(results[5].contacts.empty());
+
+    EXPECT_FALSE(results[6].checked);
+    EXPECT_FALSE(results[6].message.empty());
+
+    EXPECT_EQ(server1.getEnvironment()->getRevision(), env->getRevision());
+    EXPECT_EQ(server2.getEnvironment()->getRevision(), env->getRevision());
+  }
+
+  {  // The changes of the environment are sent to the servers
+    env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("boxbot_link", false));
+    std::vector<RemoteCollisionResult> results = client.check(queries);
+    ASSERT_EQ(results.size(), queries.size());
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+      EXPECT_TRUE(results[i].checked);
+      EXPECT_FALSE(results[i].in_collision);
+    }
+
+    EXPECT_EQ(server1.getEnvironment()->getRevision(), env->getRevision());
+    EXPECT_EQ(server2.getEnvironment()->getRevision(), env->getRevision());
+  }
+
+  {  // A server which was reset is synchronized from revision zero
+    server1.getEnvironment()->clear();
+    std::vector<RemoteCollisionResult> results = client.check(queries);
+    EXPECT_TRUE(results.front().checked);
+    EXPECT_EQ(server1.getEnvironment()->getRevision(), env->getRevision());
+  }
+
+  {  // A server which is not synchronized does not check the queries
+    RemoteCollisionRequest request;
+    request.revision = env->getRevision() + 1;
+    request.delta.from_revision = request.revision;
+    request.delta.revision = request.revision;
+    request.queries = queries;
+    RemoteCollisionResponse response = server2.handle(request);
+    EXPECT_EQ(response.revision, env->getRevision());
+    EXPECT_TRUE(response.results.empty());
+    EXPECT_FALSE(response.message.empty());
+  }
+}
+
+TEST(TesseractEnvironmentRemoteUnit, clientTransportFailure)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  ASSERT_TRUE(env->isInitialized());
+
+  RemoteCollisionServer server;
+  std::vector<RemoteCollisionTransportFn> servers{
+    [&server](const std::string& data) { return server.handle(data); },
+    [](const std::string& /*data*/) -> std::string { throw std::runtime_error("The server is unreachable"); },
+  };
+  RemoteCollisionClient client(env, servers);
+
+  std::vector<RecordedQuery> queries{ getContactTest(Eigen::Vector2d(0, 0)), getContactTest(Eigen::Vector2d(0, 0)) };
+  std::vector<RemoteCollisionResult> results = client.check(queries);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_TRUE(results[0].checked);
+  EXPECT_TRUE(results[0].in_collision);
+  EXPECT_FALSE(results[1].checked);
+  EXPECT_FALSE(results[1].message.empty());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
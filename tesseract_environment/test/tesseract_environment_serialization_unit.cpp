@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <fstream>
+#include <iterator>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/serialization.h>
@@ -35,6 +37,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/utils.h>
 #include <tesseract_environment/commands.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_image.h>
+#include <tesseract_environment/environment_sync.h>
+#include <tesseract_environment/query_replayer.h>
+#include <tesseract_geometry/impl/box.h>
+#include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_srdf/srdf_model.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
@@ -78,6 +85,207 @@ TEST(EnvironmentSerializeUnit, Environment)  // NOLINT
   testSerializationPtr<Environment>(env, "Environment");
 }
 
+TEST(EnvironmentSerializeUnit, EnvironmentCommandPayloads)  // NOLINT
+{
+  // Binary archives store each command in its own archive, which are decoded in parallel and applied as one batch
+  Environment::Ptr env = getEnvironment();
+  for (int i = 0; i < 10; ++i)
+  {
+    Link link("part_" + std::to_string(i));
+    auto collision = std::make_shared<Collision>();
+    collision->geometry = std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1);
+    link.collision.push_back(collision);
+
+    Joint joint("joint_" + link.getName());
+    joint.parent_link_name = "tool0";
+    joint.child_link_name = link.getName();
+    joint.type = JointType::FIXED;
+    joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.1 * i);
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+  }
+  env->setState(env->getActiveJointNames(), Eigen::VectorXd::Constant(7, 0.1));
+
+  const std::string file_path = tesseract_common::getTempPath() + "environment_command_payloads.binary";
+  EXPECT_TRUE(tesseract_common::Serialization::toArchiveFileBinary<Environment::Ptr>(env, file_path));
+  auto loaded_env = tesseract_common::Serialization::fromArchiveFileBinary<Environment::Ptr>(file_path);
+  ASSERT_TRUE(loaded_env != nullptr);
+  EXPECT_TRUE(*env == *loaded_env);
+  EXPECT_EQ(loaded_env->getRevision(), env->getRevision());
+  EXPECT_EQ(loaded_env->getCommandHistory().size(), env->getCommandHistory().size());
+  EXPECT_TRUE(loaded_env->getCurrentJointValues().isApprox(env->getCurrentJointValues()));
+  EXPECT_TRUE(loaded_env->getLinkTransform("part_9").isApprox(env->getLinkTransform("part_9")));
+  EXPECT_EQ(loaded_env->getDiscreteContactManager()->getCollisionObjects().size(),
+            env->getDiscreteContactManager()->getCollisionObjects().size());
+}
+
+TEST(EnvironmentSerializeUnit, EnvironmentImage)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  const std::string file_path = tesseract_common::getTempPath() + "environment_image.bin";
+  EXPECT_TRUE(saveEnvironmentImage(*env, file_path));
+
+  Environment::UPtr loaded_env = loadEnvironmentImage(file_path);
+  ASSERT_TRUE(loaded_env != nullptr);
+  EXPECT_TRUE(*env == *loaded_env);
+  EXPECT_EQ(loaded_env->getDiscreteContactManager()->getCollisionObjects().size(),
+            env->getDiscreteContactManager()->getCollisionObjects().size());
+
+  // Images are checked before they are read
+  std::ifstream ifs(file_path, std::ios_base::binary);
+  std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  EXPECT_TRUE(loadEnvironmentImage(data.data(), data.size()) != nullptr);
+  EXPECT_TRUE(loadEnvironmentImage(data.data(), data.size() - 1) == nullptr);
+  EXPECT_TRUE(loadEnvironmentImage(data.data(), 4) == nullptr);
+
+  data[0] = 'X';
+  EXPECT_TRUE(loadEnvironmentImage(data.data(), data.size()) == nullptr);
+  EXPECT_TRUE(loadEnvironmentImage(tesseract_common::getTempPath() + "does_not_exist.bin") == nullptr);
+
+  EXPECT_FALSE(saveEnvironmentImage(Environment(), file_path));
+}
+
+TEST(EnvironmentSerializeUnit, QueryLog)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  auto recorder = std::make_shared<QueryRecorder>();
+  env->setQueryRecorder(recorder);
+  EXPECT_EQ(env->getQueryRecorder(), recorder);
+
+  // The state changes are recorded by the environment, the other queries next to the calls
+  const std::vector<std::string> joint_names = env->getGroupJointNames("manipulator");
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+  EXPECT_EQ(recorder->size(), 1);
+
+  tesseract_collision::ContactRequest request(tesseract_collision::ContactTestType::CLOSEST);
+  request.contact_limit = 5;
+  recorder->recordContactTest(env->getRevision(), joint_names, joint_values, request);
+
+  tesseract_common::TrajArray traj(3, joint_values.size());
+  traj.row(0) = Eigen::VectorXd::Zero(joint_values.size());
+  traj.row(1) = joint_values;
+  traj.row(2) = 2 * joint_values;
+  tesseract_collision::CollisionCheckConfig config(0.02);
+  config.type = tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS;
+  config.longest_valid_segment_length = 0.1;
+  recorder->recordCheckTrajectory(env->getRevision(), "manipulator", traj, config);
+
+  auto kin_group = env->getKinematicGroup("manipulator");
+  ASSERT_TRUE(kin_group != nullptr);
+  tesseract_kinematics::KinGroupIKInputs inputs;
+  inputs.emplace_back(kin_group->calcFwdKin(joint_values).at("tool0"), "base_link", "tool0");
+  recorder->recordCalcInvKin(env->getRevision(), "manipulator", inputs, joint_values);
+
+  env->setQueryRecorder(nullptr);
+  env->setState(joint_names, 2 * joint_values);
+  ASSERT_EQ(recorder->size(), 4);
+
+  const std::string log_path = tesseract_common::getTempPath() + "query_log.bin";
+  EXPECT_TRUE(recorder->save(log_path));
+
+  std::vector<RecordedQuery> queries;
+  ASSERT_TRUE(loadQueryLog(log_path, queries));
+  ASSERT_EQ(queries.size(), 4);
+  EXPECT_EQ(queries[0].type, RecordedQueryType::SET_STATE);
+  EXPECT_EQ(queries[0].joint_names, joint_names);
+  EXPECT_TRUE(queries[0].joint_values.isApprox(joint_values));
+  EXPECT_EQ(queries[1].type, RecordedQueryType::CONTACT_TEST);
+  EXPECT_EQ(queries[1].contact_request.type, tesseract_collision::ContactTestType::CLOSEST);
+  EXPECT_EQ(queries[1].contact_request.contact_limit, 5);
+  EXPECT_EQ(queries[2].type, RecordedQueryType::CHECK_TRAJECTORY);
+  EXPECT_EQ(queries[2].group_name, "manipulator");
+  EXPECT_TRUE(queries[2].trajectory.isApprox(traj));
+  EXPECT_EQ(queries[2].config.type, tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS);
+  EXPECT_NEAR(queries[2].config.longest_valid_segment_length, 0.1, 1e-12);
+  EXPECT_EQ(queries[3].type, RecordedQueryType::CALC_INV_KIN);
+  ASSERT_EQ(queries[3].ik_inputs.size(), 1);
+  EXPECT_TRUE(queries[3].ik_inputs[0].pose.isApprox(inputs[0].pose));
+  EXPECT_EQ(queries[3].ik_inputs[0].tip_link_name, "tool0");
+  EXPECT_LE(queries[0].time, queries[3].time);
+
+  // The queries are replayed against an image of the environment
+  const std::string image_path = tesseract_common::getTempPath() + "query_log_environment_image.bin";
+  EXPECT_TRUE(saveEnvironmentImage(*env, image_path));
+  Environment::Ptr replay_env = loadEnvironmentImage(image_path);
+  ASSERT_TRUE(replay_env != nullptr);
+
+  QueryReplayer replayer(replay_env);
+  EXPECT_EQ(replayer.replay(queries), queries.size());
+  EXPECT_TRUE(replay_env->getCurrentJointValues(joint_names).isApprox(joint_values));
+
+  RecordedQuery unknown_group = queries[2];
+  unknown_group.group_name = "does_not_exist";
+  EXPECT_FALSE(replayer.replay(unknown_group));
+
+  std::vector<RecordedQuery> missing;
+  EXPECT_FALSE(loadQueryLog(tesseract_common::getTempPath() + "does_not_exist.bin", missing));
+  EXPECT_FALSE(loadQueryLog(image_path, missing));
+}
+
+TEST(EnvironmentSerializeUnit, EnvironmentSync)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  Environment::Ptr remote_env = std::make_shared<Environment>();
+
+  // A remote environment without a revision is initialized from the whole command history
+  EnvironmentDelta delta;
+  EXPECT_TRUE(decodeEnvironmentDelta(delta, encodeEnvironmentDelta(getEnvironmentDelta(*env, 0))));
+  EXPECT_EQ(delta.from_revision, 0);
+  EXPECT_TRUE(applyEnvironmentDelta(*remote_env, delta));
+  EXPECT_EQ(remote_env->getRevision(), env->getRevision());
+  EXPECT_EQ(remote_env->getLinkNames().size(), env->getLinkNames().size());
+
+  // Afterwards only the new commands are sent, the same mesh loaded for each part is encoded once
+  auto add_part = [](const std::string& name) {
+    auto vertices = std::make_shared<tesseract_common::VectorVector3d>(1000, Eigen::Vector3d(0.1, 0.2, 0.3));
+    auto faces = std::make_shared<Eigen::VectorXi>(Eigen::VectorXi::Constant(1000, 3));
+
+    Link link(name);
+    auto collision = std::make_shared<Collision>();
+    collision->geometry = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+    link.collision.push_back(collision);
+
+    Joint joint("joint_" + name);
+    joint.parent_link_name = "tool0";
+    joint.child_link_name = name;
+    joint.type = JointType::FIXED;
+    return std::make_shared<AddLinkCommand>(link, joint);
+  };
+
+  const int revision = env->getRevision();
+  EXPECT_TRUE(env->applyCommand(add_part("part_1")));
+  const std::size_t single_size = encodeEnvironmentDelta(getEnvironmentDelta(*env, revision)).size();
+  EXPECT_TRUE(env->applyCommand(add_part("part_2")));
+
+  std::string data = encodeEnvironmentDelta(getEnvironmentDelta(*env, revision));
+  EXPECT_LT(data.size(), 2 * single_size);
+  EXPECT_TRUE(decodeEnvironmentDelta(delta, data));
+  EXPECT_EQ(delta.from_revision, revision);
+  EXPECT_EQ(delta.commands.size(), 2);
+  EXPECT_TRUE(applyEnvironmentDelta(*remote_env, delta));
+  EXPECT_EQ(remote_env->getRevision(), env->getRevision());
+  EXPECT_TRUE(remote_env->getLink("part_2") != nullptr);
+  EXPECT_EQ(remote_env->getLink("part_1")->collision.front()->geometry,
+            remote_env->getLink("part_2")->collision.front()->geometry);
+
+  // A delta for another revision is rejected
+  EXPECT_FALSE(applyEnvironmentDelta(*remote_env, delta));
+  EXPECT_FALSE(decodeEnvironmentDelta(delta, "invalid"));
+
+  // The joint values are sent separately and only applied to the same revision
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+  EnvironmentStateUpdate update;
+  EXPECT_TRUE(decodeEnvironmentStateUpdate(update, encodeEnvironmentStateUpdate(getEnvironmentStateUpdate(*env))));
+  EXPECT_TRUE(applyEnvironmentStateUpdate(*remote_env, update));
+  EXPECT_TRUE(remote_env->getCurrentJointValues().isApprox(joint_values));
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("part_2")));
+  update = getEnvironmentStateUpdate(*env);
+  EXPECT_FALSE(applyEnvironmentStateUpdate(*remote_env, update));
+}
+
 TEST(EnvironmentCommandsSerializeUnit, ModifyAllowedCollisionsCommand)  // NOLINT
 {
   {  // ADD
@@ -150,6 +358,15 @@ TEST(EnvironmentCommandsSerializeUnit, AddSceneGraphCommand)  // NOLINT
   testSerializationDerivedClass<Command, AddSceneGraphCommand>(object, "AddSceneGraphCommand");
 }
 
+TEST(EnvironmentCommandsSerializeUnit, AttachLinkCommand)  // NOLINT
+{
+  Eigen::Isometry3d origin = Eigen::Isometry3d::Identity();
+  origin.translate(Eigen::Vector3d(1, 5, 9));
+  auto object = std::make_shared<AttachLinkCommand>("link_1", "tool0", origin);
+  testSerialization<AttachLinkCommand>(*object, "AttachLinkCommand");
+  testSerializationDerivedClass<Command, AttachLinkCommand>(object, "AttachLinkCommand");
+}
+
 TEST(EnvironmentCommandsSerializeUnit, ChangeCollisionMarginsCommand)  // NOLINT
 {
   CollisionMarginData collision_margin_data = getEnvironment()->getCollisionMarginData();
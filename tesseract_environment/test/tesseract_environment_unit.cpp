@@ -2,7 +2,11 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <vector>
+#include <sstream>
 #include <omp.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -11,10 +15,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_collision/core/common.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_environment/allowed_collision_matrix_generator.h>
 #include <tesseract_environment/commands.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/shared_memory_transport.h>
+#include <tesseract_environment/swept_volume_broadphase.h>
 #include <tesseract_environment/utils.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
@@ -397,6 +405,99 @@ TEST(TesseractEnvironmentUnit, EnvInitURDFOnlyUnit)  // NOLINT
   getEnvironmentURDFOnly(EnvironmentInitType::FILEPATH);
 }
 
+TEST(TesseractEnvironmentUnit, EnvInitThreadsUnit)  // NOLINT
+{
+  auto rl = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+
+  auto env = std::make_shared<Environment>();
+  EXPECT_EQ(env->getInitThreads(), 1U);
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, rl));
+
+  auto env_threaded = std::make_shared<Environment>();
+  env_threaded->setInitThreads(4);
+  EXPECT_EQ(env_threaded->getInitThreads(), 4U);
+  EXPECT_TRUE(env_threaded->init(urdf_path, srdf_path, rl));
+  EXPECT_TRUE(env_threaded->isInitialized());
+  EXPECT_EQ(env_threaded->getRevision(), env->getRevision());
+  EXPECT_TRUE(*env_threaded->getSceneGraph() == *env->getSceneGraph());
+
+  // Zero threads is the same as one
+  env_threaded->setInitThreads(0);
+  EXPECT_EQ(env_threaded->getInitThreads(), 1U);
+}
+
+TEST(TesseractEnvironmentUnit, EnvInitLoadVisualsUnit)  // NOLINT
+{
+  auto rl = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+
+  auto env = std::make_shared<Environment>();
+  EXPECT_TRUE(env->getInitLoadVisuals());
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, rl));
+  EXPECT_FALSE(env->getLink("link_1")->visual.empty());
+
+  auto env_headless = std::make_shared<Environment>();
+  env_headless->setInitLoadVisuals(false);
+  EXPECT_FALSE(env_headless->getInitLoadVisuals());
+  EXPECT_TRUE(env_headless->init(urdf_path, srdf_path, rl));
+  EXPECT_TRUE(env_headless->isInitialized());
+  EXPECT_EQ(env_headless->getLinkNames().size(), env->getLinkNames().size());
+  for (const auto& link_name : env_headless->getLinkNames())
+  {
+    EXPECT_TRUE(env_headless->getLink(link_name)->visual.empty());
+    EXPECT_EQ(env_headless->getLink(link_name)->collision.size(), env->getLink(link_name)->collision.size());
+  }
+}
+
+TEST(TesseractEnvironmentUnit, EnvInitDeferCollisionMeshesUnit)  // NOLINT
+{
+  auto rl = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+
+  auto env = std::make_shared<Environment>();
+  EXPECT_FALSE(env->getInitDeferCollisionMeshes());
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, rl));
+  EXPECT_FALSE(env->hasDeferredCollisionGeometry());
+
+  auto env_deferred = std::make_shared<Environment>();
+  env_deferred->setInitDeferCollisionMeshes(true);
+  EXPECT_TRUE(env_deferred->getInitDeferCollisionMeshes());
+  EXPECT_TRUE(env_deferred->init(urdf_path, srdf_path, rl));
+  EXPECT_TRUE(env_deferred->hasDeferredCollisionGeometry());
+
+  // The collision meshes are boxes until the loaded geometry is applied
+  auto link = env_deferred->getLink("link_1");
+  ASSERT_EQ(link->collision.size(), 1);
+  EXPECT_EQ(link->collision[0]->geometry->getType(), tesseract_geometry::GeometryType::BOX);
+  EXPECT_TRUE(link->collision[0]->deferred_geometry.valid());
+
+  const int revision = env_deferred->getRevision();
+  EXPECT_TRUE(env_deferred->applyDeferredCollisionGeometry(true));
+  EXPECT_FALSE(env_deferred->hasDeferredCollisionGeometry());
+  EXPECT_GT(env_deferred->getRevision(), revision);
+
+  for (const auto& link_name : env_deferred->getLinkNames())
+  {
+    auto deferred_link = env_deferred->getLink(link_name);
+    auto expected_link = env->getLink(link_name);
+    ASSERT_EQ(deferred_link->collision.size(), expected_link->collision.size());
+    for (std::size_t i = 0; i < deferred_link->collision.size(); ++i)
+    {
+      EXPECT_EQ(deferred_link->collision[i]->geometry->getType(), expected_link->collision[i]->geometry->getType());
+      EXPECT_TRUE(deferred_link->collision[i]->origin.isApprox(expected_link->collision[i]->origin, 1e-6));
+    }
+  }
+
+  // Nothing is left to apply
+  const int applied_revision = env_deferred->getRevision();
+  EXPECT_TRUE(env_deferred->applyDeferredCollisionGeometry());
+  EXPECT_EQ(env_deferred->getRevision(), applied_revision);
+}
+
 TEST(TesseractEnvironmentUnit, EnvInitFailuresUnit)  // NOLINT
 {
   auto rl = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
@@ -518,6 +619,188 @@ TEST(TesseractEnvironmentUnit, EnvCloneContactManagerUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvLazyContactManagerUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+
+  // Links added before the managers are built are part of them once built
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  Link link("link_n1");
+  link.collision.push_back(collision);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link)));
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_n1", false)));
+
+  EXPECT_TRUE(env->prebuildContactManagers(true, false).get());
+  auto discrete_manager = env->getDiscreteContactManager();
+  EXPECT_EQ(discrete_manager->getCollisionObjects().size(), 9);
+  EXPECT_FALSE(discrete_manager->isCollisionObjectEnabled("link_n1"));
+
+  auto continuous_manager = env->getContinuousContactManager();
+  EXPECT_EQ(continuous_manager->getCollisionObjects().size(), 9);
+  EXPECT_FALSE(continuous_manager->isCollisionObjectEnabled("link_n1"));
+
+  // Changing the active plugin builds the new manager on first use
+  EXPECT_TRUE(env->setActiveDiscreteContactManager("BulletDiscreteSimpleManager"));
+  EXPECT_FALSE(env->setActiveDiscreteContactManager("does_not_exist"));
+  EXPECT_TRUE(env->prebuildContactManagers().get());
+  EXPECT_EQ(env->getDiscreteContactManager()->getName(), "BulletDiscreteSimpleManager");
+  EXPECT_EQ(env->getDiscreteContactManager()->getCollisionObjects().size(), 9);
+}
+
+TEST(TesseractEnvironmentUnit, EnvCheckoutDiscreteContactManagerUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  const double margin = 0.123;
+
+  {
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager->getName(), env->getDiscreteContactManager()->getName());
+    EXPECT_EQ(manager->getCollisionObjects(), env->getDiscreteContactManager()->getCollisionObjects());
+    manager->setDefaultCollisionMarginData(margin);
+
+    // Checking out while the pooled manager is in use returns a copy
+    PooledDiscreteContactManager nested = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(nested != nullptr);
+    EXPECT_NE(nested.get(), manager.get());
+    EXPECT_NE(nested->getCollisionMarginData().getDefaultCollisionMargin(), margin);
+  }
+
+  {  // The pooled manager is reused as is while the environment does not change
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_NEAR(manager->getCollisionMarginData().getDefaultCollisionMargin(), margin, 1e-12);
+  }
+
+  {  // Other threads use their own manager
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    std::thread thread([&env, &manager, margin]() {
+      PooledDiscreteContactManager thread_manager = env->checkoutDiscreteContactManager();
+      ASSERT_TRUE(thread_manager != nullptr);
+      EXPECT_NE(thread_manager.get(), manager.get());
+      EXPECT_NE(thread_manager->getCollisionMarginData().getDefaultCollisionMargin(), margin);
+    });
+    thread.join();
+  }
+
+  {  // A manager returned on another thread is destroyed and the pool of this thread keeps working
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    std::thread thread([&manager]() { manager = nullptr; });
+    thread.join();
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_NE(manager->getCollisionMarginData().getDefaultCollisionMargin(), margin);
+    manager->setDefaultCollisionMarginData(margin);
+    manager = nullptr;
+
+    manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_NEAR(manager->getCollisionMarginData().getDefaultCollisionMargin(), margin, 1e-12);
+  }
+
+  // Changing the environment copies the manager again
+  Link link("link_pool");
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  link.collision.push_back(collision);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link)));
+
+  {
+    PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_TRUE(manager->hasCollisionObject("link_pool"));
+    EXPECT_NE(manager->getCollisionMarginData().getDefaultCollisionMargin(), margin);
+  }
+
+  // The pooled manager outlives the environment
+  PooledDiscreteContactManager manager = env->checkoutDiscreteContactManager();
+  env = nullptr;
+  ASSERT_TRUE(manager != nullptr);
+  EXPECT_TRUE(manager->hasCollisionObject("link_pool"));
+}
+
+TEST(TesseractEnvironmentUnit, EnvCheckoutKinematicGroupUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+
+  const tesseract_kinematics::JointGroup* pooled_joint_group{ nullptr };
+  const tesseract_kinematics::KinematicGroup* pooled_kinematic_group{ nullptr };
+  {
+    PooledJointGroup joint_group = env->checkoutJointGroup("manipulator");
+    ASSERT_TRUE(joint_group != nullptr);
+    EXPECT_EQ(joint_group->getJointNames(), env->getGroupJointNames("manipulator"));
+    pooled_joint_group = joint_group.get();
+
+    PooledKinematicGroup kinematic_group = env->checkoutKinematicGroup("manipulator");
+    ASSERT_TRUE(kinematic_group != nullptr);
+    EXPECT_EQ(kinematic_group->getJointNames(), env->getGroupJointNames("manipulator"));
+    pooled_kinematic_group = kinematic_group.get();
+
+    // Checking out while the pooled group is in use returns a copy
+    PooledKinematicGroup nested = env->checkoutKinematicGroup("manipulator");
+    ASSERT_TRUE(nested != nullptr);
+    EXPECT_NE(nested.get(), kinematic_group.get());
+  }
+
+  {  // The pooled groups are reused while the environment does not change
+    PooledJointGroup joint_group = env->checkoutJointGroup("manipulator");
+    EXPECT_EQ(joint_group.get(), pooled_joint_group);
+
+    PooledKinematicGroup kinematic_group = env->checkoutKinematicGroup("manipulator");
+    EXPECT_EQ(kinematic_group.get(), pooled_kinematic_group);
+
+    // Other threads use their own group
+    std::thread thread([&env, &kinematic_group]() {
+      PooledKinematicGroup thread_group = env->checkoutKinematicGroup("manipulator");
+      ASSERT_TRUE(thread_group != nullptr);
+      EXPECT_NE(thread_group.get(), kinematic_group.get());
+    });
+    thread.join();
+  }
+
+  {  // A group returned on another thread is destroyed and the pool of this thread keeps working
+    PooledKinematicGroup kinematic_group = env->checkoutKinematicGroup("manipulator");
+    ASSERT_TRUE(kinematic_group != nullptr);
+    std::thread thread([&kinematic_group]() { kinematic_group = nullptr; });
+    thread.join();
+
+    kinematic_group = env->checkoutKinematicGroup("manipulator");
+    ASSERT_TRUE(kinematic_group != nullptr);
+    pooled_kinematic_group = kinematic_group.get();
+    kinematic_group = nullptr;
+
+    kinematic_group = env->checkoutKinematicGroup("manipulator");
+    EXPECT_EQ(kinematic_group.get(), pooled_kinematic_group);
+  }
+
+  EXPECT_ANY_THROW(env->checkoutJointGroup("does_not_exist"));      // NOLINT
+  EXPECT_ANY_THROW(env->checkoutKinematicGroup("does_not_exist"));  // NOLINT
+
+  // Changing the environment copies the groups again
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", 1.0, 2.0)));
+
+  {
+    PooledJointGroup joint_group = env->checkoutJointGroup("manipulator");
+    ASSERT_TRUE(joint_group != nullptr);
+    EXPECT_NEAR(joint_group->getLimits().joint_limits(0, 0), 1.0, 1e-6);
+    EXPECT_NEAR(joint_group->getLimits().joint_limits(0, 1), 2.0, 1e-6);
+
+    PooledKinematicGroup kinematic_group = env->checkoutKinematicGroup("manipulator");
+    ASSERT_TRUE(kinematic_group != nullptr);
+    EXPECT_NEAR(kinematic_group->getLimits().joint_limits(0, 0), 1.0, 1e-6);
+    EXPECT_NEAR(kinematic_group->getLimits().joint_limits(0, 1), 2.0, 1e-6);
+  }
+
+  // The pooled group outlives the environment
+  PooledKinematicGroup kinematic_group = env->checkoutKinematicGroup("manipulator");
+  env = nullptr;
+  ASSERT_TRUE(kinematic_group != nullptr);
+  EXPECT_EQ(kinematic_group->getJointNames().size(), 7);
+}
+
 TEST(TesseractEnvironmentUnit, EnvAddAndRemoveAllowedCollisionCommandUnit)  // NOLINT
 {
   // Get the environment
@@ -563,10 +846,17 @@ TEST(TesseractEnvironmentUnit, EnvAddAndRemoveAllowedCollisionCommandUnit)  // N
   EXPECT_EQ(cmd_remove->getAllowedCollisionMatrix().getAllAllowedCollisions().size(), 1);
   EXPECT_TRUE(cmd_remove->getAllowedCollisionMatrix().isCollisionAllowed(l1, l2));
 
+  tesseract_collision::IsContactAllowedFn is_contact_allowed_fn =
+      env->getDiscreteContactManager()->getIsContactAllowedFn();
+  EXPECT_TRUE(env->getCompiledAllowedCollisionMatrix()->isCollisionAllowed(l1, l2));
+  EXPECT_TRUE(is_contact_allowed_fn(l1, l2));
+
   EXPECT_TRUE(env->applyCommand(cmd_remove));
   EXPECT_EQ(callback_counter, 2);
 
   EXPECT_FALSE(acm->isCollisionAllowed(l1, l2));
+  EXPECT_FALSE(env->getCompiledAllowedCollisionMatrix()->isCollisionAllowed(l1, l2));
+  EXPECT_FALSE(is_contact_allowed_fn(l1, l2));
   EXPECT_EQ(env->getRevision(), 4);
   EXPECT_EQ(env->getCommandHistory().size(), 4);
   EXPECT_EQ(env->getCommandHistory().back(), cmd_remove);
@@ -583,6 +873,8 @@ TEST(TesseractEnvironmentUnit, EnvAddAndRemoveAllowedCollisionCommandUnit)  // N
   EXPECT_EQ(callback_counter, 4);
 
   EXPECT_TRUE(acm->isCollisionAllowed(l1, l2));
+  EXPECT_TRUE(env->getCompiledAllowedCollisionMatrix()->isCollisionAllowed(l1, l2));
+  EXPECT_TRUE(is_contact_allowed_fn(l1, l2));
   EXPECT_EQ(env->getRevision(), 5);
   EXPECT_EQ(env->getCommandHistory().size(), 5);
   EXPECT_EQ(env->getCommandHistory().back(), cmd_add);
@@ -602,6 +894,9 @@ TEST(TesseractEnvironmentUnit, EnvAddAndRemoveAllowedCollisionCommandUnit)  // N
   EXPECT_FALSE(acm->isCollisionAllowed(l1, "link_5"));
   EXPECT_FALSE(acm->isCollisionAllowed(l1, "link_6"));
   EXPECT_FALSE(acm->isCollisionAllowed(l1, "link_7"));
+  EXPECT_EQ(env->getCompiledAllowedCollisionMatrix()->getLinkIndex(l1), -1);
+  EXPECT_FALSE(is_contact_allowed_fn(l1, "base_link"));
+  EXPECT_TRUE(is_contact_allowed_fn("link_2", "link_3"));
   EXPECT_EQ(env->getRevision(), 6);
   EXPECT_EQ(env->getCommandHistory().size(), 6);
   EXPECT_EQ(env->getCommandHistory().back(), cmd_remove_link);
@@ -1471,6 +1766,94 @@ TEST(TesseractEnvironmentUnit, EnvMoveLinkCommandUnit)  // NOLINT
   env->getSceneGraph()->saveDOT(tesseract_common::getTempPath() + "after_move_link_unit.dot");
 }
 
+TEST(TesseractEnvironmentUnit, EnvAttachLinkCommandUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+  EXPECT_EQ(env->getRevision(), 3);
+
+  const std::string link_name1 = "link_n1";
+  const std::string link_name2 = "link_n2";
+  const std::string joint_name1 = "joint_n1";
+  const std::string joint_name2 = "joint_n2";
+  Link link_1(link_name1);
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1);
+  link_1.collision.push_back(collision);
+  Link link_2(link_name2);
+
+  Joint joint_1(joint_name1);
+  joint_1.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(1, 0, 0);
+  joint_1.parent_link_name = env->getRootLinkName();
+  joint_1.child_link_name = link_name1;
+  joint_1.type = JointType::FIXED;
+
+  Joint joint_2(joint_name2);
+  joint_2.parent_link_name = link_name1;
+  joint_2.child_link_name = link_name2;
+  joint_2.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_1, joint_1)));
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_2, joint_2)));
+  EXPECT_EQ(env->getRevision(), 5);
+
+  std::vector<std::string> active_links = env->getActiveLinkNames();
+  EXPECT_TRUE(std::find(active_links.begin(), active_links.end(), link_name1) == active_links.end());
+  auto compiled_acm = env->getCompiledAllowedCollisionMatrix();
+
+  // Attach the link where it is, it keeps its joint and follows the new parent
+  const Eigen::Isometry3d link_tf = env->getLinkTransform(link_name1);
+  auto cmd =
+      std::make_shared<AttachLinkCommand>(link_name1, "tool0", env->getRelativeLinkTransform("tool0", link_name1));
+  EXPECT_EQ(cmd->getType(), CommandType::ATTACH_LINK);
+  EXPECT_EQ(cmd->getLinkName(), link_name1);
+  EXPECT_EQ(cmd->getParentLinkName(), "tool0");
+  EXPECT_TRUE(env->applyCommand(cmd));
+  EXPECT_EQ(env->getRevision(), 6);
+  EXPECT_EQ(env->getCommandHistory().back(), cmd);
+  EXPECT_EQ(env->getJoint(joint_name1)->parent_link_name, "tool0");
+  EXPECT_TRUE(env->getLinkTransform(link_name1).isApprox(link_tf, 1e-6));
+
+  // The allowed collision matrix did not change, so the contact managers keep it
+  EXPECT_EQ(env->getCompiledAllowedCollisionMatrix(), compiled_acm);
+
+  active_links = env->getActiveLinkNames();
+  EXPECT_TRUE(std::find(active_links.begin(), active_links.end(), link_name1) != active_links.end());
+  EXPECT_TRUE(std::find(active_links.begin(), active_links.end(), link_name2) != active_links.end());
+  std::vector<std::string> active_objects = env->getDiscreteContactManager()->getActiveCollisionObjects();
+  EXPECT_TRUE(std::find(active_objects.begin(), active_objects.end(), link_name1) != active_objects.end());
+
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.5));
+  EXPECT_FALSE(env->getLinkTransform(link_name1).isApprox(link_tf, 1e-6));
+  EXPECT_TRUE(env->getRelativeLinkTransform("tool0", link_name1).isApprox(cmd->getOrigin(), 1e-6));
+
+  // Detach the link by attaching it to the root link
+  const Eigen::Isometry3d attached_tf = env->getLinkTransform(link_name1);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AttachLinkCommand>(link_name1, env->getRootLinkName(), attached_tf)));
+  EXPECT_EQ(env->getRevision(), 7);
+  EXPECT_EQ(env->getJoint(joint_name1)->parent_link_name, env->getRootLinkName());
+  EXPECT_TRUE(env->getLinkTransform(link_name1).isApprox(attached_tf, 1e-6));
+
+  active_links = env->getActiveLinkNames();
+  EXPECT_TRUE(std::find(active_links.begin(), active_links.end(), link_name1) == active_links.end());
+  active_objects = env->getDiscreteContactManager()->getActiveCollisionObjects();
+  EXPECT_TRUE(std::find(active_objects.begin(), active_objects.end(), link_name1) == active_objects.end());
+
+  // Links which do not exist, the root link and attaching a link to its children fail
+  EXPECT_FALSE(env->applyCommand(std::make_shared<AttachLinkCommand>("missing_link", "tool0")));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<AttachLinkCommand>(link_name1, "missing_link")));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<AttachLinkCommand>(env->getRootLinkName(), "tool0")));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<AttachLinkCommand>(link_name1, link_name2)));
+  EXPECT_FALSE(env->applyCommand(std::make_shared<AttachLinkCommand>(link_name1, link_name1)));
+  EXPECT_EQ(env->getRevision(), 7);
+
+  // A clone replays the attach commands
+  auto clone = env->clone();
+  EXPECT_EQ(clone->getJoint(joint_name1)->parent_link_name, env->getRootLinkName());
+  EXPECT_TRUE(clone->getLinkTransform(link_name1).isApprox(attached_tf, 1e-6));
+}
+
 TEST(TesseractEnvironmentUnit, EnvCurrentStatePreservedWhenEnvChanges)  // NOLINT
 {
   // Get the environment
@@ -2174,6 +2557,236 @@ TEST(TesseractEnvironmentUnit, EnvClone)  // NOLINT
   EXPECT_EQ(env->getCollisionMarginData(), clone->getCollisionMarginData());
 }
 
+TEST(TesseractEnvironmentUnit, EnvCloneCopyOnWriteUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+  EXPECT_TRUE(env->getJointGroup("manipulator") != nullptr);
+  EXPECT_TRUE(env->getKinematicGroup("manipulator") != nullptr);
+
+  // The clone shares the scene graph
+  auto clone = env->clone();
+  tesseract_scene_graph::SceneGraph::ConstPtr scene_graph = env->getSceneGraph();
+  EXPECT_TRUE(clone->getSceneGraph() == scene_graph);
+  EXPECT_TRUE(clone->getJointGroup("manipulator") != nullptr);
+  EXPECT_TRUE(clone->getKinematicGroup("manipulator") != nullptr);
+
+  // Commands which do not change the scene graph do not copy it
+  tesseract_common::CollisionMarginData collision_margin_data(0.1);
+  EXPECT_TRUE(clone->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(
+      collision_margin_data, tesseract_common::CollisionMarginOverrideType::REPLACE)));
+  EXPECT_TRUE(clone->getSceneGraph() == scene_graph);
+
+  // Changing the scene graph of the clone copies it first
+  Link link("link_n1");
+  Joint joint("joint_n1");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = "link_n1";
+  joint.type = JointType::FIXED;
+  EXPECT_TRUE(clone->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+  EXPECT_TRUE(clone->getSceneGraph() != scene_graph);
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+  EXPECT_TRUE(env->getLink("link_n1") == nullptr);
+  EXPECT_TRUE(scene_graph->getLink("link_n1") == nullptr);
+
+  // The scene graph is no longer shared, so changing it does not copy it
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkVisibilityCommand>("link_1", false)));
+  EXPECT_TRUE(env->getSceneGraph() == scene_graph);
+  EXPECT_FALSE(env->getLinkVisibility("link_1"));
+  EXPECT_TRUE(clone->getLinkVisibility("link_1"));
+
+  // A clone of a clone is independent of both
+  auto clone2 = clone->clone();
+  EXPECT_TRUE(clone2->applyCommand(std::make_shared<RemoveLinkCommand>("link_n1")));
+  EXPECT_TRUE(clone2->getLink("link_n1") == nullptr);
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+  EXPECT_TRUE(clone2->getKinematicGroup("manipulator") != nullptr);
+}
+
+TEST(TesseractEnvironmentUnit, EnvUpdateUnit)  // NOLINT
+{
+  // Get the environment
+  Environment::Ptr env = getEnvironment();
+  Environment::UPtr clone = env->clone();
+  EXPECT_FALSE(clone->update(nullptr));
+
+  // Only the missing commands are applied
+  Link link("link_n1");
+  Joint joint("joint_n1");
+  joint.parent_link_name = "tool0";
+  joint.child_link_name = "link_n1";
+  joint.type = JointType::FIXED;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+
+  Commands history = clone->getCommandHistory();
+  EXPECT_TRUE(clone->update(env));
+  EXPECT_EQ(clone->getRevision(), env->getRevision());
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+  EXPECT_TRUE(clone->getCurrentJointValues(joint_names).isApprox(joint_values));
+  EXPECT_TRUE(clone->getLinkTransform("link_n1").isApprox(env->getLinkTransform("link_n1")));
+  Commands updated_history = clone->getCommandHistory();
+  EXPECT_TRUE(std::equal(history.begin(), history.end(), updated_history.begin()));
+  EXPECT_TRUE(updated_history.back() == env->getCommandHistory().back());
+
+  // Updating again only updates the state
+  joint_values.setZero();
+  env->setState(joint_names, joint_values);
+  EXPECT_TRUE(clone->update(env));
+  EXPECT_EQ(clone->getRevision(), env->getRevision());
+  EXPECT_TRUE(clone->getCurrentJointValues(joint_names).isApprox(joint_values));
+
+  // A history which is not the start of the history of the source is initialized from the source
+  EXPECT_TRUE(clone->applyCommand(std::make_shared<ChangeLinkVisibilityCommand>("link_1", false)));
+  EXPECT_TRUE(clone->update(env));
+  EXPECT_EQ(clone->getRevision(), env->getRevision());
+  EXPECT_TRUE(clone->getLinkVisibility("link_1"));
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+}
+
+TEST(TesseractEnvironmentUnit, EnvApplyCommandsBatchUnit)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  Environment::Ptr batch_env = getEnvironment();
+
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+  batch_env->setState(joint_names, joint_values);
+
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+
+  Commands commands;
+  for (int i = 0; i < 20; ++i)
+  {
+    Link link("link_n" + std::to_string(i));
+    link.collision.push_back(collision);
+
+    Joint joint("joint_n" + std::to_string(i));
+    joint.parent_link_name = (i == 0) ? "tool0" : "link_n" + std::to_string(i - 1);
+    joint.child_link_name = link.getName();
+    joint.type = JointType::FIXED;
+    joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.1);
+    commands.push_back(std::make_shared<AddLinkCommand>(link, joint));
+  }
+  commands.push_back(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_n3", false));
+  commands.push_back(std::make_shared<RemoveLinkCommand>("link_n19"));
+  commands.push_back(std::make_shared<ChangeJointOriginCommand>("joint_n0", Eigen::Isometry3d::Identity()));
+
+  int callback_counter{ 0 };
+  batch_env->addEventCallback(0, [&callback_counter](const Event& /*event*/) { ++callback_counter; });
+
+  EXPECT_TRUE(env->applyCommands(commands));
+  EXPECT_TRUE(batch_env->applyCommandsBatch(commands));
+  EXPECT_EQ(callback_counter, 2);
+
+  // The batch gives the same environment as applying the commands one by one
+  EXPECT_EQ(batch_env->getRevision(), env->getRevision());
+  EXPECT_EQ(batch_env->getLinkNames().size(), env->getLinkNames().size());
+  EXPECT_TRUE(batch_env->getCurrentJointValues(joint_names).isApprox(joint_values));
+  for (const auto& link_name : env->getLinkNames())
+    EXPECT_TRUE(batch_env->getLinkTransform(link_name).isApprox(env->getLinkTransform(link_name), 1e-6));
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto batch_discrete_manager = batch_env->getDiscreteContactManager();
+  EXPECT_EQ(batch_discrete_manager->getCollisionObjects().size(), discrete_manager->getCollisionObjects().size());
+  EXPECT_EQ(batch_discrete_manager->getActiveCollisionObjects().size(),
+            discrete_manager->getActiveCollisionObjects().size());
+  EXPECT_FALSE(batch_discrete_manager->hasCollisionObject("link_n19"));
+  EXPECT_TRUE(batch_discrete_manager->hasCollisionObject("link_n18"));
+  EXPECT_FALSE(batch_discrete_manager->isCollisionObjectEnabled("link_n3"));
+
+  auto batch_continuous_manager = batch_env->getContinuousContactManager();
+  EXPECT_EQ(batch_continuous_manager->getCollisionObjects().size(),
+            env->getContinuousContactManager()->getCollisionObjects().size());
+  EXPECT_FALSE(batch_continuous_manager->isCollisionObjectEnabled("link_n3"));
+
+  // Commands applied afterwards update the state solver and contact managers directly again
+  EXPECT_TRUE(batch_env->applyCommand(std::make_shared<RemoveLinkCommand>("link_n18")));
+  EXPECT_FALSE(batch_env->getDiscreteContactManager()->hasCollisionObject("link_n18"));
+  EXPECT_TRUE(batch_env->getStateSolver()->getLinkNames().size() == batch_env->getLinkNames().size());
+}
+
+TEST(TesseractEnvironmentUnit, EnvCompactCommandHistoryUnit)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  Environment::UPtr cloned_env = env->clone();
+
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+
+  // Attach and detach a part many times like a long running cell
+  for (int i = 0; i < 50; ++i)
+  {
+    Link link("part");
+    link.collision.push_back(collision);
+
+    Joint joint("part_joint");
+    joint.parent_link_name = "tool0";
+    joint.child_link_name = link.getName();
+    joint.type = JointType::FIXED;
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+    EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("part")));
+  }
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false)));
+
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("link_1", "link_5", "Test");
+  EXPECT_TRUE(
+      env->applyCommand(std::make_shared<ModifyAllowedCollisionsCommand>(acm, ModifyAllowedCollisionsType::ADD)));
+
+  std::vector<std::string> link_names = env->getLinkNames();
+  tesseract_common::TransformMap link_transforms = env->getState().link_transforms;
+  EXPECT_GT(env->getCommandHistory().size(), 100);
+
+  int callback_counter{ 0 };
+  env->addEventCallback(0, [&callback_counter](const Event& /*event*/) { ++callback_counter; });
+
+  EXPECT_TRUE(env->compactCommandHistory());
+  EXPECT_EQ(callback_counter, 1);
+  EXPECT_EQ(env->getCommandHistory().size(), 4);
+  EXPECT_EQ(env->getRevision(), 4);
+
+  // The environment is unchanged
+  EXPECT_EQ(env->getLinkNames().size(), link_names.size());
+  EXPECT_TRUE(env->getCurrentJointValues(joint_names).isApprox(joint_values));
+  EXPECT_FALSE(env->getLinkCollisionEnabled("link_1"));
+  EXPECT_TRUE(env->getAllowedCollisionMatrix()->isCollisionAllowed("link_1", "link_5"));
+  for (const auto& link_name : link_names)
+    EXPECT_TRUE(env->getLinkTransform(link_name).isApprox(link_transforms.at(link_name), 1e-6));
+
+  // Compacting again does not change the history
+  EXPECT_TRUE(env->compactCommandHistory());
+  EXPECT_EQ(env->getCommandHistory().size(), 4);
+
+  // An environment initialized from the compacted history is equal to it
+  auto init_env = std::make_shared<Environment>();
+  EXPECT_TRUE(init_env->init(env->getCommandHistory()));
+  EXPECT_EQ(init_env->getLinkNames().size(), link_names.size());
+  EXPECT_FALSE(init_env->getLinkCollisionEnabled("link_1"));
+  EXPECT_TRUE(init_env->getAllowedCollisionMatrix()->isCollisionAllowed("link_1", "link_5"));
+  EXPECT_EQ(init_env->getGroupNames().size(), env->getGroupNames().size());
+
+  // A clone made before compacting is no longer in sync and is initialized from the checkpoint
+  EXPECT_TRUE(cloned_env->update(env));
+  EXPECT_EQ(cloned_env->getRevision(), 4);
+  EXPECT_FALSE(cloned_env->getLinkCollisionEnabled("link_1"));
+
+  // Applying commands continues from the checkpoint and reset returns to it
+  EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("link_6")));
+  EXPECT_EQ(env->getRevision(), 5);
+  EXPECT_TRUE(env->reset());
+  EXPECT_EQ(env->getRevision(), 4);
+  EXPECT_EQ(env->getLinkNames().size(), link_names.size());
+}
+
 TEST(TesseractEnvironmentUnit, EnvSetState)  // NOLINT
 {
   // Get the environment
@@ -2335,6 +2948,50 @@ TEST(TesseractEnvironmentUnit, EnvSetState)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvStateSnapshotUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+
+  // A snapshot is never modified, a change publishes a new one
+  auto snapshot = env->getStateSnapshot();
+  EXPECT_TRUE(*snapshot == env->getState());
+  joint_values(0) = 0.5;
+  env->setState(joint_names, joint_values);
+  EXPECT_NEAR(snapshot->joints.at(joint_names[0]), 0, 1e-8);
+  EXPECT_NEAR(env->getStateSnapshot()->joints.at(joint_names[0]), 0.5, 1e-8);
+
+  // The current state is always consistent with its active joints while links are added and removed
+  const auto num_joints = static_cast<Eigen::Index>(joint_names.size());
+  std::atomic<bool> done{ false };
+  std::thread reader([&env, &done, num_joints]() {
+    while (!done)
+    {
+      Eigen::VectorXd values;
+      EXPECT_NO_THROW(values = env->getCurrentJointValues());  // NOLINT
+      EXPECT_TRUE(values.size() == num_joints || values.size() == num_joints + 1);
+    }
+  });
+
+  for (int i = 0; i < 20; ++i)
+  {
+    Link link("part");
+    Joint joint("part_joint");
+    joint.parent_link_name = "tool0";
+    joint.child_link_name = link.getName();
+    joint.type = JointType::REVOLUTE;
+    joint.limits = std::make_shared<JointLimits>(-1, 1, 0, 1, 1);
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+    EXPECT_EQ(env->getCurrentJointValues().size(), num_joints + 1);
+    EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("part")));
+    EXPECT_EQ(env->getCurrentJointValues().size(), num_joints);
+  }
+
+  done = true;
+  reader.join();
+}
+
 TEST(TesseractEnvironmentUnit, EnvSetState2)  // NOLINT
 {
   // Get the environment
@@ -2437,6 +3094,156 @@ TEST(TesseractEnvironmentUnit, EnvSetState2)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvStateStreamUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  std::vector<std::string> changed_link_names;
+  int state_changed_counter{ 0 };
+  EventCallbackFn callback = [&changed_link_names, &state_changed_counter](const Event& event) {
+    if (event.type == Events::LINK_TRANSFORMS_CHANGED)
+      changed_link_names = static_cast<const LinkTransformsChangedEvent&>(event).link_names;
+    else if (event.type == Events::SCENE_STATE_CHANGED)
+      ++state_changed_counter;
+  };
+  env->addEventCallback(0, callback);
+
+  std::vector<std::string> arm_joint_names = { "joint_a1", "joint_a2", "joint_a3", "joint_a4", "joint_a5" };
+  std::vector<std::string> wrist_joint_names = { "joint_a6", "joint_a7" };
+  EXPECT_ANY_THROW(env->registerStateStream({ "missing_joint" }));  // NOLINT
+  std::size_t arm_stream = env->registerStateStream(arm_joint_names);
+  std::size_t wrist_stream = env->registerStateStream(wrist_joint_names);
+  EXPECT_NE(arm_stream, wrist_stream);
+  EXPECT_ANY_THROW(env->setStreamState(wrist_stream + 1, Eigen::VectorXd::Zero(2)));  // NOLINT
+  EXPECT_ANY_THROW(env->setStreamState(wrist_stream, Eigen::VectorXd::Zero(3)));     // NOLINT
+
+  // Nothing is applied until flushed
+  EXPECT_FALSE(env->flushStateStreams());
+  tesseract_scene_graph::SceneState initial_state = env->getState();
+  Eigen::VectorXd arm_values = Eigen::VectorXd::Constant(5, 0.1);
+  Eigen::VectorXd wrist_values = Eigen::VectorXd::Constant(2, 0.2);
+  env->setStreamState(arm_stream, Eigen::VectorXd::Constant(5, -0.1));
+  env->setStreamState(arm_stream, arm_values);
+  env->setStreamState(wrist_stream, wrist_values);
+  EXPECT_TRUE(env->getState().link_transforms.at("tool0").isApprox(initial_state.link_transforms.at("tool0")));
+
+  // Only the latest values of each stream are applied
+  std::vector<std::string> joint_names = arm_joint_names;
+  joint_names.insert(joint_names.end(), wrist_joint_names.begin(), wrist_joint_names.end());
+  Eigen::VectorXd joint_values(7);
+  joint_values << arm_values, wrist_values;
+  EXPECT_TRUE(env->flushStateStreams());
+  EXPECT_EQ(state_changed_counter, 0);
+  EXPECT_EQ(changed_link_names.size(), 8);
+  EXPECT_TRUE(env->getCurrentJointValues(joint_names).isApprox(joint_values));
+
+  auto checkState = [&env](const std::vector<std::string>& joint_names, const Eigen::VectorXd& joint_values) {
+    tesseract_scene_graph::SceneState state = env->getState();
+    tesseract_scene_graph::SceneState check_state = env->getState(joint_names, joint_values);
+    for (const auto& link_tf : check_state.link_transforms)
+      EXPECT_TRUE(link_tf.second.isApprox(state.link_transforms.at(link_tf.first), 1e-12));
+
+    for (const auto& joint_tf : check_state.joint_transforms)
+      EXPECT_TRUE(joint_tf.second.isApprox(state.joint_transforms.at(joint_tf.first), 1e-12));
+
+    for (const auto& joint : check_state.joints)
+      EXPECT_NEAR(joint.second, state.joints.at(joint.first), 1e-12);
+  };
+  checkState(joint_names, joint_values);
+
+  // Nothing is pending and setting the same values does not move any link
+  changed_link_names.clear();
+  EXPECT_FALSE(env->flushStateStreams());
+  env->setStreamState(arm_stream, arm_values);
+  EXPECT_FALSE(env->flushStateStreams());
+  EXPECT_TRUE(changed_link_names.empty());
+
+  // Only the links moved by the changed joint are provided
+  wrist_values(1) = 0.3;
+  joint_values(6) = 0.3;
+  env->setStreamState(wrist_stream, wrist_values);
+  EXPECT_TRUE(env->flushStateStreams());
+  EXPECT_EQ(changed_link_names.size(), 2);
+  EXPECT_TRUE(std::find(changed_link_names.begin(), changed_link_names.end(), "link_7") != changed_link_names.end());
+  EXPECT_TRUE(std::find(changed_link_names.begin(), changed_link_names.end(), "tool0") != changed_link_names.end());
+  checkState(joint_names, joint_values);
+
+  // The streams are resolved again after the environment changed
+  Link link("link_n1");
+  Joint joint("joint_n1");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = "link_n1";
+  joint.type = JointType::FIXED;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+
+  arm_values(0) = -0.2;
+  joint_values(0) = -0.2;
+  env->setStreamState(arm_stream, arm_values);
+  EXPECT_TRUE(env->flushStateStreams());
+  checkState(joint_names, joint_values);
+}
+
+TEST(TesseractEnvironmentUnit, EnvAsyncEventCallbackUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+
+  std::mutex mutex;
+  Commands commands;
+  int revision{ 0 };
+  std::size_t num_command_events{ 0 };
+  std::size_t num_state_events{ 0 };
+  tesseract_scene_graph::SceneState state;
+  EventCallbackFn callback = [&](const Event& event) {
+    // A slow subscriber, the events queued meanwhile are coalesced
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::lock_guard<std::mutex> lock(mutex);
+    if (event.type == Events::COMMAND_APPLIED)
+    {
+      const auto& e = static_cast<const CommandAppliedEvent&>(event);
+      EXPECT_EQ(e.first_command_index, commands.size());
+      commands.insert(commands.end(), e.commands.begin(), e.commands.end());
+      revision = e.revision;
+      ++num_command_events;
+    }
+    else if (event.type == Events::SCENE_STATE_CHANGED)
+    {
+      state = static_cast<const SceneStateChangedEvent&>(event).state;
+      ++num_state_events;
+    }
+  };
+  env->addAsyncEventCallback(0, callback);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    Link link("link_n" + std::to_string(i));
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link)));
+  }
+
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  env->setState(joint_names, joint_values);
+  env->waitForAsyncEvents();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    Commands history = env->getCommandHistory();
+    ASSERT_EQ(commands.size(), history.size());
+    EXPECT_TRUE(std::equal(commands.begin(), commands.end(), history.begin()));
+    EXPECT_EQ(revision, env->getRevision());
+    EXPECT_LE(num_command_events, 10);
+    EXPECT_LE(num_state_events, 11);
+    EXPECT_TRUE(state.joints == env->getState().joints);
+  }
+
+  // The callback is removed with the synchronous callbacks
+  env->removeEventCallback(0);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("link_n0")));
+  env->waitForAsyncEvents();
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(revision, env->getRevision() - 1);
+}
+
 TEST(TesseractEnvironmentUnit, EnvFindTCPUnit)  // NOLINT
 {
   // Get the environment
@@ -2472,6 +3279,67 @@ TEST(TesseractEnvironmentUnit, EnvFindTCPUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvTransformCacheUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  std::vector<std::string> link_names = env->getLinkNames();
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+
+  // The cached transforms match the state, including after the state changes
+  for (double value : { 0.1, -0.2 })
+  {
+    env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), value));
+    SceneState state = env->getState();
+    for (int i = 0; i < 2; ++i)
+    {
+      for (const auto& link1 : link_names)
+      {
+        for (const auto& link2 : link_names)
+        {
+          Eigen::Isometry3d expected = state.link_transforms.at(link1).inverse() * state.link_transforms.at(link2);
+          EXPECT_TRUE(expected.isApprox(env->getRelativeLinkTransform(link1, link2), 1e-6));
+        }
+      }
+    }
+  }
+
+  // The transforms of links connected by fixed joints are updated when the environment changes
+  Eigen::Isometry3d origin = Eigen::Isometry3d::Identity();
+  origin.translation() = Eigen::Vector3d(0, 0, 0.2);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeJointOriginCommand>("joint_a7-tool0", origin)));
+  EXPECT_TRUE(env->getRelativeLinkTransform("link_7", "tool0").isApprox(origin, 1e-6));
+  EXPECT_TRUE(env->getRelativeLinkTransform("base_link", "base").isApprox(Eigen::Isometry3d::Identity(), 1e-6));
+
+  // The offsets found by a callback are cached until the state changes or a callback is added
+  int num_calls{ 0 };
+  env->addFindTCPOffsetCallback([&num_calls](const tesseract_common::ManipulatorInfo& manip_info) {
+    if (std::get<0>(manip_info.tcp_offset) != "counted_callback")
+      throw std::runtime_error("Not found");
+
+    ++num_calls;
+    return Eigen::Isometry3d(Eigen::Translation3d(0, 0, 0.3));
+  });
+
+  tesseract_common::ManipulatorInfo manip_info("manipulator", "base_link", "tool0");
+  manip_info.tcp_offset = "counted_callback";
+  EXPECT_TRUE(env->findTCPOffset(manip_info).isApprox(Eigen::Isometry3d(Eigen::Translation3d(0, 0, 0.3)), 1e-6));
+  EXPECT_TRUE(env->findTCPOffset(manip_info).isApprox(Eigen::Isometry3d(Eigen::Translation3d(0, 0, 0.3)), 1e-6));
+  EXPECT_EQ(num_calls, 1);
+
+  env->setState(joint_names, Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size())));
+  env->findTCPOffset(manip_info);
+  EXPECT_EQ(num_calls, 2);
+
+  // The offset of another manipulator info is found separately
+  manip_info.working_frame = "base";
+  env->findTCPOffset(manip_info);
+  EXPECT_EQ(num_calls, 3);
+
+  env->addFindTCPOffsetCallback(tcpCallback);
+  env->findTCPOffset(manip_info);
+  EXPECT_EQ(num_calls, 4);
+}
+
 TEST(TesseractEnvironmentUnit, getActiveLinkNamesRecursiveUnit)  // NOLINT
 {
   // Get the environment
@@ -2950,6 +3818,32 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
     checkProcessInterpolatedResults(contacts);
   }
 
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::LVS_DISCRETE;
+    config.contact_request.type = tesseract_collision::ContactTestType::FIRST;
+    config.bisection_order = true;
+    std::vector<tesseract_collision::ContactResultMap> contacts;
+    EXPECT_TRUE(tesseract_environment::checkTrajectory(contacts, *discrete_manager, *joint_group, traj, config));
+    EXPECT_EQ(contacts.size(), static_cast<std::size_t>(traj.rows()));
+    EXPECT_EQ(getContactCount(contacts), static_cast<int>(1));
+    checkProcessInterpolatedResults(contacts);
+
+    contacts.clear();
+    EXPECT_TRUE(tesseract_environment::checkTrajectory(
+        contacts, *discrete_manager, *state_solver, joint_names, traj2, config));
+    EXPECT_EQ(contacts.size(), static_cast<std::size_t>(traj2.rows()));
+    EXPECT_EQ(getContactCount(contacts), static_cast<int>(1));
+    checkProcessInterpolatedResults(contacts);
+
+    contacts.clear();
+    config.type = CollisionEvaluatorType::DISCRETE;
+    EXPECT_TRUE(tesseract_environment::checkTrajectory(contacts, *discrete_manager, *joint_group, traj, config));
+    EXPECT_EQ(contacts.size(), static_cast<std::size_t>(traj.rows()));
+    EXPECT_EQ(getContactCount(contacts), static_cast<int>(1));
+    checkProcessInterpolatedResults(contacts);
+  }
+
   {
     tesseract_collision::CollisionCheckConfig config;
     config.type = CollisionEvaluatorType::LVS_DISCRETE;
@@ -2979,6 +3873,40 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
     checkProcessInterpolatedResults(contacts);
   }
 
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::LVS_DISCRETE;
+    config.adaptive_longest_valid_segment = true;
+    const tesseract_common::CollisionMarginData margin_data = discrete_manager->getCollisionMarginData();
+    std::vector<tesseract_collision::ContactResultMap> contacts;
+    EXPECT_TRUE(tesseract_environment::checkTrajectory(contacts, *discrete_manager, *joint_group, traj, config));
+    EXPECT_EQ(contacts.size(), static_cast<std::size_t>(traj.rows()));
+    EXPECT_EQ(contacts[0].size(), 2);
+    EXPECT_EQ(contacts[1].size(), 2);
+    EXPECT_EQ(contacts[2].size(), 3);
+    EXPECT_EQ(contacts[3].size(), 2);
+    EXPECT_EQ(contacts[4].size(), 0);
+    EXPECT_EQ(getContactCount(contacts), static_cast<int>(285));
+    checkProcessInterpolatedResultsNoTime0(contacts[0]);
+    checkProcessInterpolatedResultsNoTime1(contacts[3]);  // Second to last because using LVS
+    checkProcessInterpolatedResults(contacts);
+
+    contacts.clear();
+    EXPECT_TRUE(tesseract_environment::checkTrajectory(contacts, *discrete_manager, *joint_group, traj2, config));
+    EXPECT_EQ(contacts.size(), static_cast<std::size_t>(traj2.rows()));
+    EXPECT_EQ(contacts[0].size(), 2);
+    EXPECT_EQ(contacts[1].size(), 2);
+    EXPECT_EQ(contacts[2].size(), 2);
+    EXPECT_EQ(getContactCount(contacts), static_cast<int>(125));
+    checkProcessInterpolatedResultsNoTime0(contacts[0]);
+    EXPECT_TRUE(hasProcessInterpolatedResultsTime0(contacts[2]));
+    checkProcessInterpolatedResultsNoTime1(contacts[1]);  // Second to last because using LVS
+    checkProcessInterpolatedResults(contacts);
+
+    // The collision margins are restored after the checks
+    EXPECT_TRUE(discrete_manager->getCollisionMarginData() == margin_data);
+  }
+
   {
     tesseract_collision::CollisionCheckConfig config;
     config.type = CollisionEvaluatorType::CONTINUOUS;
@@ -3315,6 +4243,542 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, checkTrajectoryParallelUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  collision->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract_environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  auto joint_group = env->getJointGroup("manipulator");
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  tesseract_common::TrajArray traj(11, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(11, joint_start_pos(i), joint_end_pos(i));
+
+  const std::size_t num_workers{ 3 };
+  std::vector<DiscreteContactManager::UPtr> discrete_managers;
+  std::vector<ContinuousContactManager::UPtr> continuous_managers;
+  std::vector<StateSolver::UPtr> state_solvers;
+  std::vector<tesseract_kinematics::JointGroup::UPtr> joint_groups;
+  for (std::size_t i = 0; i < num_workers; ++i)
+  {
+    discrete_managers.push_back(env->getDiscreteContactManager());
+    continuous_managers.push_back(env->getContinuousContactManager());
+    state_solvers.push_back(env->getStateSolver());
+    joint_groups.push_back(env->getJointGroup("manipulator"));
+  }
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto continuous_manager = env->getContinuousContactManager();
+  auto state_solver = env->getStateSolver();
+
+  auto compare = [](const std::vector<ContactResultMap>& serial, const std::vector<ContactResultMap>& parallel) {
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+      ASSERT_EQ(serial[i].size(), parallel[i].size());
+      for (const auto& pair : serial[i])
+      {
+        auto it = parallel[i].find(pair.first);
+        ASSERT_TRUE(it != parallel[i].end());
+        ASSERT_EQ(pair.second.size(), it->second.size());
+        for (std::size_t j = 0; j < pair.second.size(); ++j)
+        {
+          EXPECT_NEAR(pair.second[j].distance, it->second[j].distance, 1e-6);
+          EXPECT_NEAR(pair.second[j].cc_time[0], it->second[j].cc_time[0], 1e-6);
+          EXPECT_NEAR(pair.second[j].cc_time[1], it->second[j].cc_time[1], 1e-6);
+        }
+      }
+    }
+  };
+
+  for (auto test_type : { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST })
+  {
+    for (auto type : { CollisionEvaluatorType::DISCRETE, CollisionEvaluatorType::LVS_DISCRETE })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.05;
+
+      std::vector<ContactResultMap> serial_contacts;
+      std::vector<ContactResultMap> parallel_contacts;
+      bool serial_found =
+          checkTrajectory(serial_contacts, *discrete_manager, *state_solver, joint_names, traj, config);
+      bool parallel_found =
+          checkTrajectory(parallel_contacts, discrete_managers, state_solvers, joint_names, traj, config);
+      EXPECT_TRUE(serial_found);
+      EXPECT_EQ(serial_found, parallel_found);
+      compare(serial_contacts, parallel_contacts);
+
+      parallel_contacts.clear();
+      parallel_found = checkTrajectory(parallel_contacts, discrete_managers, joint_groups, traj, config);
+      EXPECT_EQ(serial_found, parallel_found);
+      compare(serial_contacts, parallel_contacts);
+    }
+
+    for (auto type : { CollisionEvaluatorType::CONTINUOUS, CollisionEvaluatorType::LVS_CONTINUOUS })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.05;
+
+      std::vector<ContactResultMap> serial_contacts;
+      std::vector<ContactResultMap> parallel_contacts;
+      bool serial_found =
+          checkTrajectory(serial_contacts, *continuous_manager, *state_solver, joint_names, traj, config);
+      bool parallel_found =
+          checkTrajectory(parallel_contacts, continuous_managers, state_solvers, joint_names, traj, config);
+      EXPECT_TRUE(serial_found);
+      EXPECT_EQ(serial_found, parallel_found);
+      compare(serial_contacts, parallel_contacts);
+
+      parallel_contacts.clear();
+      parallel_found = checkTrajectory(parallel_contacts, continuous_managers, joint_groups, traj, config);
+      EXPECT_EQ(serial_found, parallel_found);
+      compare(serial_contacts, parallel_contacts);
+    }
+  }
+
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::DISCRETE;
+    std::vector<ContactResultMap> contacts;
+    std::vector<StateSolver::UPtr> empty_solvers;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectory(contacts, discrete_managers, empty_solvers, joint_names, traj, config));
+
+    config.type = CollisionEvaluatorType::CONTINUOUS;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectory(contacts, discrete_managers, state_solvers, joint_names, traj, config));
+  }
+}
+
+TEST(TesseractEnvironmentUnit, checkTrajectorySweptVolumeBroadphaseUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  collision->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract_environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  auto joint_group = env->getJointGroup("manipulator");
+  auto continuous_manager = env->getContinuousContactManager();
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  tesseract_common::TrajArray traj(21, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(21, joint_start_pos(i), joint_end_pos(i));
+
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::CONTINUOUS;
+    continuous_manager->applyContactManagerConfig(config.contact_manager_config);
+    std::vector<SweptVolumeCandidate> candidates =
+        calcSweptVolumeCandidates(*continuous_manager, *joint_group, traj, 4);
+    EXPECT_FALSE(candidates.empty());
+
+    bool sphere_found{ false };
+    for (const auto& candidate : candidates)
+    {
+      EXPECT_LE(candidate.first_segment, candidate.last_segment);
+      EXPECT_GE(candidate.first_segment, 0);
+      EXPECT_LT(candidate.last_segment, traj.rows() - 1);
+      EXPECT_FALSE(continuous_manager->getIsContactAllowedFn()(candidate.link_name, candidate.other_name));
+      if (candidate.other_name == link_sphere.getName() || candidate.link_name == link_sphere.getName())
+        sphere_found = true;
+    }
+    EXPECT_TRUE(sphere_found);
+
+    EXPECT_ANY_THROW(calcSweptVolumeCandidates(*continuous_manager, *joint_group, traj, 0));  // NOLINT
+    EXPECT_ANY_THROW(calcSweptVolumeCandidates(*continuous_manager, *joint_group, traj.topRows(1)));  // NOLINT
+  }
+
+  // The broadphase does not change the results
+  const bool static_allowed = continuous_manager->getIsContactAllowedFn()("base_link", link_sphere.getName());
+  for (auto test_type : { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST })
+  {
+    for (auto type : { CollisionEvaluatorType::CONTINUOUS, CollisionEvaluatorType::LVS_CONTINUOUS })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.05;
+
+      std::vector<ContactResultMap> contacts;
+      bool found = checkTrajectory(contacts, *continuous_manager, *joint_group, traj, config);
+      EXPECT_TRUE(found);
+
+      config.swept_volume_broadphase = true;
+      std::vector<ContactResultMap> broadphase_contacts;
+      bool broadphase_found = checkTrajectory(broadphase_contacts, *continuous_manager, *joint_group, traj, config);
+      EXPECT_EQ(found, broadphase_found);
+      ASSERT_EQ(contacts.size(), broadphase_contacts.size());
+      for (std::size_t i = 0; i < contacts.size(); ++i)
+      {
+        ASSERT_EQ(contacts[i].size(), broadphase_contacts[i].size());
+        for (const auto& pair : contacts[i])
+        {
+          auto it = broadphase_contacts[i].find(pair.first);
+          ASSERT_TRUE(it != broadphase_contacts[i].end());
+          ASSERT_EQ(pair.second.size(), it->second.size());
+          for (std::size_t j = 0; j < pair.second.size(); ++j)
+            EXPECT_NEAR(pair.second[j].distance, it->second[j].distance, 1e-6);
+        }
+      }
+
+      // The contact allowed function of the manager is restored, the static pair is never a candidate
+      EXPECT_EQ(continuous_manager->getIsContactAllowedFn()("base_link", link_sphere.getName()), static_allowed);
+    }
+  }
+}
+
+TEST(TesseractEnvironmentUnit, checkTrajectorySummaryUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  collision->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract_environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  auto joint_group = env->getJointGroup("manipulator");
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto continuous_manager = env->getContinuousContactManager();
+  auto state_solver = env->getStateSolver();
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  tesseract_common::TrajArray traj(11, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(11, joint_start_pos(i), joint_end_pos(i));
+
+  // The summary matches the full contacts and the contacts of each step can be recalculated
+  auto compare = [](const std::vector<ContactResultMap>& contacts,
+                    const TrajectoryCollisionSummary& summary,
+                    const std::function<bool(ContactResultMap&, long)>& check_step) {
+    ASSERT_EQ(summary.min_distances.size(), static_cast<Eigen::Index>(contacts.size()));
+    ASSERT_EQ(summary.worst_pairs.size(), contacts.size());
+
+    long first_collision_step{ -1 };
+    long num_collision_steps{ 0 };
+    for (std::size_t i = 0; i < contacts.size(); ++i)
+    {
+      const auto step = static_cast<long>(i);
+      if (contacts[i].empty())
+      {
+        EXPECT_FALSE(std::isfinite(summary.min_distances[step]));
+        EXPECT_TRUE(summary.worst_pairs[i].first.empty());
+        continue;
+      }
+
+      ++num_collision_steps;
+      if (first_collision_step < 0)
+        first_collision_step = step;
+
+      double min_distance = std::numeric_limits<double>::max();
+      for (const auto& pair : contacts[i])
+      {
+        for (const auto& result : pair.second)
+          min_distance = std::min(min_distance, result.distance);
+      }
+      EXPECT_NEAR(summary.min_distances[step], min_distance, 1e-6);
+      EXPECT_LE(summary.min_distances[summary.worst_step], summary.min_distances[step]);
+
+      ContactResultMap step_contacts;
+      EXPECT_TRUE(check_step(step_contacts, step));
+      EXPECT_EQ(step_contacts.size(), contacts[i].size());
+      const auto& worst_pair = summary.worst_pairs[i];
+      const ObjectPairKey key = getObjectPairKey(worst_pair.first.getName(), worst_pair.second.getName());
+      EXPECT_TRUE(step_contacts.find(key) != step_contacts.end());
+    }
+
+    EXPECT_EQ(summary.first_collision_step, first_collision_step);
+    EXPECT_EQ(summary.num_collision_steps, num_collision_steps);
+    EXPECT_EQ(summary.empty(), (first_collision_step < 0));
+  };
+
+  for (auto test_type : { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST })
+  {
+    for (auto type : { CollisionEvaluatorType::DISCRETE, CollisionEvaluatorType::LVS_DISCRETE })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.05;
+
+      std::vector<ContactResultMap> contacts;
+      TrajectoryCollisionSummary summary;
+      EXPECT_TRUE(checkTrajectory(contacts, *discrete_manager, *state_solver, joint_names, traj, config));
+      EXPECT_TRUE(checkTrajectory(summary, *discrete_manager, *state_solver, joint_names, traj, config));
+      compare(contacts, summary, [&](ContactResultMap& step_contacts, long step) {
+        return checkTrajectoryStep(step_contacts, *discrete_manager, *state_solver, joint_names, traj, step, config);
+      });
+
+      contacts.clear();
+      EXPECT_TRUE(checkTrajectory(contacts, *discrete_manager, *joint_group, traj, config));
+      EXPECT_TRUE(checkTrajectory(summary, *discrete_manager, *joint_group, traj, config));
+      compare(contacts, summary, [&](ContactResultMap& step_contacts, long step) {
+        return checkTrajectoryStep(step_contacts, *discrete_manager, *joint_group, traj, step, config);
+      });
+    }
+
+    for (auto type : { CollisionEvaluatorType::CONTINUOUS, CollisionEvaluatorType::LVS_CONTINUOUS })
+    {
+      tesseract_collision::CollisionCheckConfig config;
+      config.type = type;
+      config.contact_request.type = test_type;
+      config.longest_valid_segment_length = 0.05;
+
+      std::vector<ContactResultMap> contacts;
+      TrajectoryCollisionSummary summary;
+      EXPECT_TRUE(checkTrajectory(contacts, *continuous_manager, *state_solver, joint_names, traj, config));
+      EXPECT_TRUE(checkTrajectory(summary, *continuous_manager, *state_solver, joint_names, traj, config));
+      compare(contacts, summary, [&](ContactResultMap& step_contacts, long step) {
+        return checkTrajectoryStep(step_contacts, *continuous_manager, *state_solver, joint_names, traj, step, config);
+      });
+
+      contacts.clear();
+      EXPECT_TRUE(checkTrajectory(contacts, *continuous_manager, *joint_group, traj, config));
+      EXPECT_TRUE(checkTrajectory(summary, *continuous_manager, *joint_group, traj, config));
+      compare(contacts, summary, [&](ContactResultMap& step_contacts, long step) {
+        return checkTrajectoryStep(step_contacts, *continuous_manager, *joint_group, traj, step, config);
+      });
+    }
+  }
+
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::CONTINUOUS;
+    ContactResultMap step_contacts;
+    const long num_segments = traj.rows() - 1;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectoryStep(step_contacts, *continuous_manager, *joint_group, traj, num_segments, config));
+
+    config.type = CollisionEvaluatorType::DISCRETE;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectoryStep(step_contacts, *discrete_manager, *joint_group, traj, traj.rows(), config));
+  }
+}
+
+TEST(TesseractEnvironmentUnit, generateAllowedCollisionMatrixUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+
+  // A link without collision geometry between base_link and the sphere
+  Link link_empty("empty_link");
+  Joint joint_empty("joint_empty_link");
+  joint_empty.parent_link_name = "base_link";
+  joint_empty.child_link_name = link_empty.getName();
+  joint_empty.type = JointType::FIXED;
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_empty, joint_empty)));
+
+  Link link_sphere("far_sphere");
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Sphere>(0.1);
+  link_sphere.collision.push_back(collision);
+  Joint joint_sphere("joint_far_sphere");
+  joint_sphere.parent_link_name = link_empty.getName();
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+  joint_sphere.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(10, 0, 0);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_sphere, joint_sphere)));
+
+  AllowedCollisionMatrixGeneratorConfig config;
+  config.samples = 200;
+  config.threads = 2;
+  config.batch_size = 16;
+  config.seed = 1;
+  tesseract_common::AllowedCollisionMatrix acm = generateAllowedCollisionMatrix(*env, config);
+
+  const auto& entries = acm.getAllAllowedCollisions();
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("base_link", "link_1")),
+            AllowedCollisionReasons::ADJACENT);
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("link_6", "link_7")), AllowedCollisionReasons::ADJACENT);
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("base_link", "far_sphere")),
+            AllowedCollisionReasons::ADJACENT);
+  EXPECT_EQ(entries.at(tesseract_common::makeOrderedLinkPair("link_7", "far_sphere")), AllowedCollisionReasons::NEVER);
+  EXPECT_EQ(entries.count(tesseract_common::makeOrderedLinkPair("empty_link", "base_link")), 0);
+  for (const auto& entry : entries)
+  {
+    EXPECT_TRUE(entry.second == AllowedCollisionReasons::ADJACENT || entry.second == AllowedCollisionReasons::DEFAULT ||
+                entry.second == AllowedCollisionReasons::ALWAYS || entry.second == AllowedCollisionReasons::NEVER);
+  }
+
+  // The result only depends on the seed and the number of threads
+  EXPECT_EQ(generateAllowedCollisionMatrix(*env, config), acm);
+
+  // Without samples only the adjacent and default pairs are allowed
+  config.samples = 0;
+  tesseract_common::AllowedCollisionMatrix adjacent_acm = generateAllowedCollisionMatrix(*env, config);
+  EXPECT_LT(adjacent_acm.getAllAllowedCollisions().size(), entries.size());
+  for (const auto& entry : adjacent_acm.getAllAllowedCollisions())
+  {
+    EXPECT_TRUE(entry.second == AllowedCollisionReasons::ADJACENT || entry.second == AllowedCollisionReasons::DEFAULT);
+  }
+
+  env->applyCommand(std::make_shared<ModifyAllowedCollisionsCommand>(tesseract_common::AllowedCollisionMatrix(),
+                                                                     ModifyAllowedCollisionsType::REPLACE));
+  EXPECT_FALSE(env->getAllowedCollisionMatrix()->isCollisionAllowed("link_7", "far_sphere"));
+  EXPECT_TRUE(env->applyCommand(createModifyAllowedCollisionsCommand(acm)));
+  EXPECT_TRUE(env->getAllowedCollisionMatrix()->isCollisionAllowed("link_7", "far_sphere"));
+
+  Environment uninitialized_env;
+  EXPECT_ANY_THROW(generateAllowedCollisionMatrix(uninitialized_env));  // NOLINT
+}
+
+TEST(TesseractEnvironmentUnit, EnvSharedMemoryTransportUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.25);
+  env->setState(joint_names, joint_values);
+
+  {  // Scene states
+    SceneStateLayout layout(*env);
+    SceneStatePublisher publisher("tesseract_env_unit_scene_state", layout);
+    SceneStateSubscriber subscriber("tesseract_env_unit_scene_state", layout);
+
+    SceneState state;
+    int revision{ -1 };
+    EXPECT_FALSE(subscriber.readLatest(state, revision));
+    EXPECT_TRUE(publisher.publish(*env));
+    EXPECT_EQ(subscriber.getWriteSequence(), 1);
+    EXPECT_TRUE(subscriber.readLatest(state, revision));
+    EXPECT_EQ(revision, env->getRevision());
+    EXPECT_TRUE(state == env->getState());
+
+    // A subscriber with another layout is rejected
+    SceneStateLayout other_layout = layout;
+    other_layout.link_names.pop_back();
+    EXPECT_ANY_THROW(SceneStateSubscriber("tesseract_env_unit_scene_state", other_layout));  // NOLINT
+
+    // The joint values are applied to an environment at the same revision
+    auto other_env = env->clone();
+    env->setState(joint_names, Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size())));
+    EXPECT_TRUE(publisher.publish(*env));
+    EXPECT_TRUE(subscriber.update(*other_env));
+    EXPECT_TRUE(other_env->getCurrentJointValues().isApprox(env->getCurrentJointValues()));
+
+    // The structure changed, so the publisher must be recreated with a new layout
+    Link link("shared_memory_part");
+    Joint joint("shared_memory_part_joint");
+    joint.parent_link_name = "tool0";
+    joint.child_link_name = link.getName();
+    joint.type = JointType::FIXED;
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+    EXPECT_FALSE(publisher.publish(*env));
+  }
+
+  {  // Trajectories
+    const auto dof = static_cast<Eigen::Index>(joint_names.size());
+    tesseract_common::JointTrajectory trajectory;
+    for (int i = 0; i < 3; ++i)
+    {
+      tesseract_common::JointState joint_state(joint_names, Eigen::VectorXd::Constant(dof, i));
+      joint_state.velocity = joint_state.position;
+      joint_state.time = i;
+      trajectory.push_back(joint_state);
+    }
+
+    JointTrajectoryPublisher publisher("tesseract_env_unit_trajectory", joint_names, 3);
+    JointTrajectorySubscriber subscriber("tesseract_env_unit_trajectory", joint_names, 3);
+    EXPECT_ANY_THROW(JointTrajectorySubscriber("tesseract_env_unit_trajectory", joint_names, 4));  // NOLINT
+
+    tesseract_common::JointTrajectory received;
+    EXPECT_FALSE(subscriber.readLatest(received));
+    publisher.publish(trajectory);
+    EXPECT_TRUE(subscriber.readLatest(received));
+    EXPECT_TRUE(received.states == trajectory.states);
+
+    trajectory.push_back(trajectory.back());
+    EXPECT_ANY_THROW(publisher.publish(trajectory));  // NOLINT
+  }
+}
+
+TEST(TesseractEnvironmentUnit, EnvMemoryUsageUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+
+  tesseract_common::MemoryUsageTracker tracker;
+  tesseract_common::MemoryUsage usage = env->getMemoryUsage(tracker);
+  EXPECT_GT(usage.getTotalBytes(), 0);
+  EXPECT_NE(usage.getChild("scene_graph " + env->getSceneGraph()->getName()), nullptr);
+  EXPECT_NE(usage.getChild("commands"), nullptr);
+  EXPECT_NE(usage.getChild("kinematics_cache"), nullptr);
+
+  const auto* discrete_usage = usage.getChild(env->getDiscreteContactManager()->getName());
+  ASSERT_NE(discrete_usage, nullptr);
+  EXPECT_FALSE(discrete_usage->children.empty());
+
+  // The geometry of a clone is shared with the environment, so with the same tracker it only adds its own storage
+  auto clone = env->clone();
+  tesseract_common::MemoryUsage clone_usage = clone->getMemoryUsage(tracker);
+  EXPECT_LT(clone_usage.getTotalBytes(), clone->getMemoryUsage().getTotalBytes());
+
+  std::stringstream ss;
+  usage.print(ss, 2);
+  EXPECT_FALSE(ss.str().empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -2,13 +2,19 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_common/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_environment/commands/change_link_collision_enabled_command.h>
+#include <tesseract_environment/contact_manager_autotune.h>
+#include <tesseract_environment/contact_manager_binding.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/query_context.h>
+#include <tesseract_environment/trajectory_validator.h>
 #include <tesseract_environment/utils.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
@@ -287,6 +293,17 @@ TEST(TesseractEnvironmentUtils, checkTrajectoryState)  // NOLINT
       tesseract_collision::ContactResultMap contacts = checkTrajectoryState(*manager, tmap, config);
       EXPECT_FALSE(contacts.empty());
     }
+    // The results written into a reused map replace the previous results
+    {
+      tesseract_collision::ContactResultMap contacts;
+      checkTrajectoryState(contacts, *manager, tmap, config.contact_request);
+      EXPECT_FALSE(contacts.empty());
+
+      config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.0);
+      manager->applyContactManagerConfig(config.contact_manager_config);
+      checkTrajectoryState(contacts, *manager, tmap, config.contact_request);
+      EXPECT_TRUE(contacts.empty());
+    }
   }
 
   // Check Continuous
@@ -334,6 +351,643 @@ TEST(TesseractEnvironmentUtils, checkTrajectoryState)  // NOLINT
       tesseract_collision::ContactResultMap contacts = checkTrajectorySegment(*manager, tmap1, tmap2, config);
       EXPECT_FALSE(contacts.empty());
     }
+    // The results written into a reused map replace the previous results
+    {
+      tesseract_collision::ContactResultMap contacts;
+      checkTrajectorySegment(contacts, *manager, tmap1, tmap2, config.contact_request);
+      EXPECT_FALSE(contacts.empty());
+
+      config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.0);
+      manager->applyContactManagerConfig(config.contact_manager_config);
+      checkTrajectorySegment(contacts, *manager, tmap1, tmap2, config.contact_request);
+      EXPECT_TRUE(contacts.empty());
+    }
+  }
+}
+
+TEST(TesseractEnvironmentUtils, queryContextScope)  // NOLINT
+{
+  QueryContext* outer_context{ nullptr };
+  {
+    QueryContext::Scope outer;
+    outer_context = &(*outer);
+    outer->contacts[tesseract_common::makeOrderedLinkPair("link_1", "link_2")].emplace_back();
+    outer->ik_solutions.num_joints = 1;
+    outer->ik_solutions.addPose({ Eigen::VectorXd::Zero(1) });
+
+    // A nested query gets its own context
+    {
+      QueryContext::Scope inner;
+      EXPECT_NE(&(*inner), outer_context);
+      EXPECT_TRUE(inner->contacts.empty());
+    }
+
+    EXPECT_FALSE(outer->contacts.empty());
+  }
+
+  // The context is reused by the next query on this thread and was cleared keeping its storage
+  QueryContext::Scope scope;
+  EXPECT_EQ(&(*scope), outer_context);
+  EXPECT_TRUE(scope->contacts.empty());
+  EXPECT_EQ(scope->contacts.getContainer().size(), 1);
+  EXPECT_EQ(scope->ik_solutions.numPoses(), 0);
+
+  scope->release();
+  EXPECT_TRUE(scope->contacts.getContainer().empty());
+}
+
+TEST(TesseractEnvironmentUtils, checkTrajectorySegmentCache)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  ContinuousContactManager::Ptr manager = env->getContinuousContactManager();
+  std::vector<std::string> active_links = { "boxbot_link", "test_box_link" };
+  manager->setActiveCollisionObjects(active_links);
+  manager->setDefaultCollisionMarginData(0.1);
+
+  // Put the swept volume of the boxes 0.05m away from each other
+  tesseract_common::TransformMap tmap1;
+  tmap1["boxbot_link"] = Eigen::Isometry3d::Identity();
+  tmap1["test_box_link"] = Eigen::Isometry3d::Identity();
+  tmap1["test_box_link"].translate(Eigen::Vector3d(1.05, 2, 0));
+
+  tesseract_common::TransformMap tmap2;
+  tmap2["boxbot_link"] = Eigen::Isometry3d::Identity();
+  tmap2["test_box_link"] = Eigen::Isometry3d::Identity();
+  tmap2["test_box_link"].translate(Eigen::Vector3d(1.05, -2, 0));
+
+  ContactRequest request(ContactTestType::ALL);
+  TrajectorySegmentCache cache(2);
+  EXPECT_EQ(cache.getCacheSize(), 2);
+
+  ContactResultMap contacts = checkTrajectorySegment(*manager, tmap1, tmap2, request, &cache);
+  EXPECT_FALSE(contacts.empty());
+  EXPECT_EQ(cache.size(), 1);
+
+  // The cached results match the manager results
+  ContactResultMap cached_contacts;
+  EXPECT_TRUE(cache.get(cached_contacts, *manager, tmap1, tmap2, request));
+  EXPECT_EQ(cached_contacts.size(), contacts.size());
+  EXPECT_EQ(checkTrajectorySegment(*manager, tmap1, tmap2, request, &cache).size(), contacts.size());
+  EXPECT_EQ(cache.size(), 1);
+
+  // A different request or segment is not cached
+  EXPECT_FALSE(cache.get(cached_contacts, *manager, tmap1, tmap2, ContactRequest(ContactTestType::FIRST)));
+  EXPECT_FALSE(cache.get(cached_contacts, *manager, tmap2, tmap1, request));
+
+  // The oldest segment is removed when the cache is full
+  checkTrajectorySegment(*manager, tmap2, tmap1, request, &cache);
+  checkTrajectorySegment(*manager, tmap1, tmap1, request, &cache);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_FALSE(cache.get(cached_contacts, *manager, tmap1, tmap2, request));
+  EXPECT_TRUE(cache.get(cached_contacts, *manager, tmap2, tmap1, request));
+
+  // Changing the collision margin invalidates the cache
+  manager->setDefaultCollisionMarginData(0.0);
+  EXPECT_FALSE(cache.get(cached_contacts, *manager, tmap2, tmap1, request));
+  contacts = checkTrajectorySegment(*manager, tmap1, tmap2, request, &cache);
+  EXPECT_TRUE(contacts.empty());
+  EXPECT_EQ(cache.size(), 1);
+
+  // Requests with a validation function are not cached
+  request.is_valid = [](const ContactResult&) { return true; };
+  checkTrajectorySegment(*manager, tmap2, tmap1, request, &cache);
+  EXPECT_EQ(cache.size(), 1);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(TesseractEnvironmentUtils, activeCollisionObjectsProfiles)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  std::vector<std::string> group_link_names =
+      env->getSceneGraph()->getJointChildrenNames(env->getGroupJointNames("manipulator"));
+  std::sort(group_link_names.begin(), group_link_names.end());
+
+  auto check_manager = [&group_link_names](auto& manager) {
+    EXPECT_EQ(manager.getActiveCollisionObjectsProfiles()->size(), 1U);
+    EXPECT_FALSE(manager.applyActiveCollisionObjectsProfile("missing"));
+
+    manager.setActiveCollisionObjects({ "test_box_link" });
+    EXPECT_TRUE(manager.applyActiveCollisionObjectsProfile("manipulator"));
+    std::vector<std::string> active = manager.getActiveCollisionObjects();
+    std::sort(active.begin(), active.end());
+    EXPECT_EQ(active, group_link_names);
+
+    // Applying the active profile again does not change anything
+    EXPECT_TRUE(manager.applyActiveCollisionObjectsProfile("manipulator"));
+    EXPECT_EQ(manager.getActiveCollisionObjects().size(), group_link_names.size());
+
+    // The profiles are shared with clones and copied before they are changed
+    auto clone = manager.clone();
+    EXPECT_EQ(clone->getActiveCollisionObjectsProfiles(), manager.getActiveCollisionObjectsProfiles());
+    clone->addActiveCollisionObjectsProfile("test", { "test_box_link" });
+    EXPECT_EQ(manager.getActiveCollisionObjectsProfiles()->size(), 1U);
+    EXPECT_TRUE(clone->applyActiveCollisionObjectsProfile("test"));
+    EXPECT_EQ(clone->getActiveCollisionObjects(), std::vector<std::string>{ "test_box_link" });
+    EXPECT_TRUE(clone->removeActiveCollisionObjectsProfile("test"));
+    EXPECT_FALSE(clone->removeActiveCollisionObjectsProfile("test"));
+  };
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  check_manager(*discrete_manager);
+
+  auto continuous_manager = env->getContinuousContactManager();
+  check_manager(*continuous_manager);
+}
+
+TEST(TesseractEnvironmentUtils, trajectoryValidator)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  EXPECT_ANY_THROW(TrajectoryValidator(nullptr));  // NOLINT
+
+  // Sweep the box past the test box 0.05m away from it
+  TrajectoryValidationRequest free_request;
+  free_request.joint_names = { "boxbot_x_joint", "boxbot_y_joint" };
+  free_request.trajectory.resize(2, 2);
+  free_request.trajectory << 1.05, 2, 1.05, -2;
+  free_request.config.type = CollisionEvaluatorType::CONTINUOUS;
+  free_request.config.contact_request.type = ContactTestType::FIRST;
+
+  // Move the box onto the test box
+  TrajectoryValidationRequest collision_request = free_request;
+  collision_request.trajectory << 1.05, 0, 0, 0;
+  collision_request.config.type = CollisionEvaluatorType::DISCRETE;
+
+  // The swept box is in collision with a larger margin
+  TrajectoryValidationRequest margin_request = free_request;
+  margin_request.config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.1);
+  margin_request.config.contact_manager_config.margin_data_override_type = CollisionMarginOverrideType::REPLACE;
+
+  TrajectoryValidationRequest unsupported_request = free_request;
+  unsupported_request.config.type = CollisionEvaluatorType::NONE;
+
+  {  // Batch with futures
+    TrajectoryValidator validator(env, 2);
+    EXPECT_EQ(validator.getThreadCount(), 2);
+    EXPECT_TRUE(validator.getEnvironment() == env);
+
+    auto futures = validator.validate({ free_request, collision_request, margin_request, unsupported_request });
+    ASSERT_EQ(futures.size(), 4);
+
+    TrajectoryValidationResult result = futures[0].get();
+    EXPECT_TRUE(result.checked);
+    EXPECT_TRUE(result.isValid());
+    EXPECT_EQ(result.revision, env->getRevision());
+    EXPECT_EQ(result.contacts.size(), 1);
+
+    result = futures[1].get();
+    EXPECT_TRUE(result.checked);
+    EXPECT_TRUE(result.in_collision);
+    EXPECT_FALSE(result.isValid());
+    EXPECT_EQ(result.contacts.size(), 2);
+    EXPECT_FALSE(result.contacts[1].empty());
+
+    result = futures[2].get();
+    EXPECT_TRUE(result.checked);
+    EXPECT_TRUE(result.in_collision);
+
+    result = futures[3].get();
+    EXPECT_FALSE(result.checked);
+    EXPECT_FALSE(result.isValid());
+    EXPECT_FALSE(result.message.empty());
+  }
+
+  {  // The config of a request does not affect the next request checked by the same worker
+    TrajectoryValidator validator(env, 1);
+    EXPECT_TRUE(validator.validate(margin_request).get().in_collision);
+    EXPECT_TRUE(validator.validate(free_request).get().isValid());
+  }
+
+  {  // Batch with a callback
+    TrajectoryValidator validator(env, 2);
+    std::atomic<std::size_t> num_results{ 0 };
+    std::atomic<std::size_t> num_valid{ 0 };
+    std::vector<TrajectoryValidationRequest> requests(10, free_request);
+    requests[3] = collision_request;
+    validator.validate(requests, [&](std::size_t index, const TrajectoryValidationResult& result) {
+      EXPECT_EQ(result.isValid(), index != 3);
+      if (result.isValid())
+        ++num_valid;
+
+      ++num_results;
+    });
+    validator.wait();
+    EXPECT_EQ(num_results, 10);
+    EXPECT_EQ(num_valid, 9);
+  }
+
+  {  // The workers are updated when the environment changes
+    TrajectoryValidator validator(env, 2);
+    EXPECT_TRUE(validator.validate(collision_request).get().in_collision);
+
+    EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("test_box_link", false)));
+    TrajectoryValidationResult result = validator.validate(collision_request).get();
+    EXPECT_TRUE(result.isValid());
+    EXPECT_EQ(result.revision, env->getRevision());
+  }
+}
+
+TEST(TesseractEnvironmentUtils, asyncContactChecker)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  EXPECT_ANY_THROW(AsyncContactChecker(nullptr));  // NOLINT
+
+  const std::vector<std::string> joint_names{ "boxbot_x_joint", "boxbot_y_joint" };
+  const Eigen::Vector2d collision_state(0, 0);
+  const Eigen::Vector2d free_state(1.05, 0);
+  CollisionCheckConfig config;
+  config.contact_request.type = ContactTestType::ALL;
+
+  CollisionCheckConfig margin_config = config;
+  margin_config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.1);
+  margin_config.contact_manager_config.margin_data_override_type = CollisionMarginOverrideType::REPLACE;
+
+  {  // Queries running at the same time on the default executor
+    AsyncContactChecker checker(env);
+    EXPECT_TRUE(checker.getEnvironment() == env);
+
+    std::vector<std::future<ContactResultMap>> futures;
+    for (int i = 0; i < 8; ++i)
+      futures.push_back(checker.contactTest(joint_names, (i % 2 == 0) ? collision_state : free_state, config));
+
+    for (std::size_t i = 0; i < futures.size(); ++i)
+      EXPECT_EQ(futures[i].get().empty(), i % 2 != 0);
+
+    EXPECT_GE(checker.getWorkerCount(), 1U);
+    EXPECT_LE(checker.getWorkerCount(), futures.size());
+  }
+
+  // Each query is run when it is submitted, so a single worker is reused
+  AsyncContactChecker checker(env, std::make_shared<tesseract_common::SequentialExecutor>());
+
+  {  // The config of a query does not affect the next query
+    EXPECT_FALSE(checker.contactTest(joint_names, free_state, margin_config).get().empty());
+    EXPECT_TRUE(checker.contactTest(joint_names, free_state, config).get().empty());
+    EXPECT_EQ(checker.getWorkerCount(), 1U);
+  }
+
+  {  // The trajectory checks match the serial checks
+    TrajectoryValidationRequest request;
+    request.joint_names = joint_names;
+    request.trajectory.resize(3, 2);
+    request.trajectory << 1.05, 2, 1.05, 0, 0, 0;
+    request.config = config;
+
+    tesseract_scene_graph::StateSolver::UPtr state_solver = env->getStateSolver();
+    for (auto type : { CollisionEvaluatorType::DISCRETE,
+                       CollisionEvaluatorType::LVS_DISCRETE,
+                       CollisionEvaluatorType::CONTINUOUS,
+                       CollisionEvaluatorType::LVS_CONTINUOUS })
+    {
+      request.config.type = type;
+      std::vector<ContactResultMap> expected;
+      if (type == CollisionEvaluatorType::DISCRETE || type == CollisionEvaluatorType::LVS_DISCRETE)
+      {
+        DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+        checkTrajectory(expected, *manager, *state_solver, joint_names, request.trajectory, request.config);
+      }
+      else
+      {
+        ContinuousContactManager::UPtr manager = env->getContinuousContactManager();
+        checkTrajectory(expected, *manager, *state_solver, joint_names, request.trajectory, request.config);
+      }
+
+      std::vector<ContactResultMap> contacts = checker.checkTrajectory(request).get();
+      ASSERT_EQ(contacts.size(), expected.size());
+      for (std::size_t i = 0; i < contacts.size(); ++i)
+        EXPECT_EQ(contacts[i].size(), expected[i].size());
+    }
+
+    // A cancelled query is not checked
+    tesseract_common::CancellationToken token;
+    tesseract_common::CancellationToken copy = token;
+    copy.cancel();
+    EXPECT_TRUE(token.isCancelled());
+    std::future<std::vector<ContactResultMap>> cancelled = checker.checkTrajectory(request, token);
+    EXPECT_THROW(cancelled.get(), tesseract_common::CancelledError);  // NOLINT
+    std::future<ContactResultMap> cancelled_state = checker.contactTest(joint_names, free_state, config, token);
+    EXPECT_THROW(cancelled_state.get(), tesseract_common::CancelledError);  // NOLINT
+
+    // Invalid queries
+    request.config.type = CollisionEvaluatorType::NONE;
+    std::future<std::vector<ContactResultMap>> unsupported = checker.checkTrajectory(request);
+    EXPECT_ANY_THROW(unsupported.get());  // NOLINT
+    AsyncContactChecker uninitialized(std::make_shared<Environment>());
+    std::future<ContactResultMap> not_checked = uninitialized.contactTest(joint_names, free_state, config);
+    EXPECT_ANY_THROW(not_checked.get());  // NOLINT
+  }
+
+  {  // The workers are updated when the environment changes
+    EXPECT_FALSE(checker.contactTest(joint_names, collision_state, config).get().empty());
+    EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("test_box_link", false)));
+    EXPECT_TRUE(checker.contactTest(joint_names, collision_state, config).get().empty());
+  }
+}
+
+TEST(TesseractEnvironmentUtils, calcContactDistanceGradients)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  auto joint_group = env->getJointGroup("manipulator");
+  ASSERT_EQ(joint_group->getJointNames(), std::vector<std::string>({ "boxbot_x_joint", "boxbot_y_joint" }));
+
+  // Put the boxes 0.2m away from each other along x
+  Eigen::VectorXd joint_values(2);
+  joint_values << 1.2, 0.3;
+
+  DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects({ "boxbot_link", "test_box_link" });
+  manager->setDefaultCollisionMarginData(0.5);
+
+  ContactRequest request(ContactTestType::ALL);
+  auto calcContacts = [&](const Eigen::VectorXd& values) {
+    ContactResultVector contacts;
+    flattenMoveResults(checkTrajectoryState(*manager, joint_group->calcFwdKin(values), request), contacts);
+    return contacts;
+  };
+
+  ContactResultVector contacts = calcContacts(joint_values);
+  ASSERT_EQ(contacts.size(), 1);
+  EXPECT_NEAR(contacts[0].distance, 0.2, 1e-6);
+
+  Eigen::MatrixXd gradients;
+  calcContactDistanceGradients(gradients, *joint_group, joint_values, contacts);
+  ASSERT_EQ(gradients.rows(), 1);
+  ASSERT_EQ(gradients.cols(), 2);
+  EXPECT_NEAR(gradients(0, 0), 1.0, 1e-6);
+  EXPECT_NEAR(gradients(0, 1), 0.0, 1e-6);
+
+  // Compare to a finite difference of the distance
+  const double delta = 1e-4;
+  for (Eigen::Index j = 0; j < joint_values.size(); ++j)
+  {
+    Eigen::VectorXd perturbed = joint_values;
+    perturbed(j) += delta;
+    ContactResultVector perturbed_contacts = calcContacts(perturbed);
+    ASSERT_EQ(perturbed_contacts.size(), 1);
+    EXPECT_NEAR((perturbed_contacts[0].distance - contacts[0].distance) / delta, gradients(0, j), 1e-4);
+  }
+
+  // A contact between links which are not active in the group has a zero gradient
+  ContactResultVector static_contacts(1);
+  static_contacts[0].link_names = { "base_link", "test_box_link" };
+  static_contacts[0].normal = Eigen::Vector3d::UnitX();
+  calcContactDistanceGradients(gradients, *joint_group, joint_values, static_contacts);
+  ASSERT_EQ(gradients.rows(), 1);
+  EXPECT_TRUE(gradients.isZero());
+
+  // No contacts
+  calcContactDistanceGradients(gradients, *joint_group, joint_values, ContactResultVector());
+  EXPECT_EQ(gradients.rows(), 0);
+  EXPECT_EQ(gradients.cols(), 2);
+}
+
+TEST(TesseractEnvironmentUtils, filterCollisionFreeIKSolutions)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  auto joint_group = env->getJointGroup("manipulator");
+
+  CollisionCheckConfig config;
+  config.contact_manager_config.margin_data = CollisionMarginData(0.0);
+  config.contact_manager_config.margin_data_override_type = tesseract_common::CollisionMarginOverrideType::REPLACE;
+
+  // The boxes overlap for the first two solutions
+  tesseract_kinematics::IKSolutions solutions(5, Eigen::VectorXd::Zero(2));
+  solutions[1] << 0.9, 0;
+  solutions[2] << 0, 3.0;
+  solutions[3] << -1.5, 0;
+  solutions[4] << 1.2, 0;
+  Eigen::VectorXd seed(2);
+  seed << 0.5, 0;
+
+  auto expectSolutions = [](const tesseract_kinematics::IKSolutions& actual,
+                            const tesseract_kinematics::IKSolutions& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i)
+      EXPECT_TRUE(actual[i].isApprox(expected[i], 1e-8));
+  };
+
+  // The collision free solutions are sorted by their distance to the seed
+  const tesseract_kinematics::IKSolutions expected{ solutions[4], solutions[3], solutions[2] };
+  DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+  expectSolutions(filterCollisionFreeIKSolutions(*manager, *joint_group, solutions, seed, config), expected);
+  expectSolutions(filterCollisionFreeIKSolutions(*manager, *joint_group, solutions, seed, config, 2),
+                  { solutions[4], solutions[3] });
+
+  // The environment and parallel versions return the same solutions
+  for (std::size_t threads : { 1, 2, 4 })
+  {
+    expectSolutions(filterCollisionFreeIKSolutions(*env, *joint_group, solutions, seed, config, 0, false, threads),
+                    expected);
+    expectSolutions(filterCollisionFreeIKSolutions(*env, *joint_group, solutions, seed, config, 1, false, threads),
+                    { solutions[4] });
+  }
+
+  std::vector<DiscreteContactManager::UPtr> managers;
+  std::vector<tesseract_kinematics::JointGroup::UPtr> manips;
+  for (int i = 0; i < 3; ++i)
+  {
+    managers.push_back(env->getDiscreteContactManager());
+    managers.back()->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+    manips.push_back(env->getJointGroup("manipulator"));
+  }
+  expectSolutions(filterCollisionFreeIKSolutions(managers, manips, solutions, seed, config), expected);
+  expectSolutions(filterCollisionFreeIKSolutions(managers, manips, {}, seed, config), {});
+
+  // Invalid inputs
+  Eigen::VectorXd wrong_seed = Eigen::VectorXd::Zero(3);
+  EXPECT_ANY_THROW(filterCollisionFreeIKSolutions(*manager, *joint_group, solutions, wrong_seed, config));  // NOLINT
+  manips.pop_back();
+  EXPECT_ANY_THROW(filterCollisionFreeIKSolutions(managers, manips, solutions, seed, config));  // NOLINT
+}
+
+TEST(TesseractEnvironmentUtils, contactManagerBinding)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  auto joint_group = env->getJointGroup("manipulator");
+  DiscreteContactManager::UPtr manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+  manager->setDefaultCollisionMarginData(0);
+
+  ContactManagerBinding binding(*joint_group, *manager);
+  EXPECT_EQ(binding.getLinkNames(), std::vector<std::string>({ "boxbot_link" }));
+  EXPECT_EQ(binding.getLinkTransforms().size(), binding.getLinkNames().size());
+
+  // The binding sets the same transforms as the scene state
+  ContactRequest request(ContactTestType::ALL);
+  for (double position : { 0.0, 0.9, 1.2, -1.5 })
+  {
+    Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(2);
+    joint_values(0) = position;
+
+    tesseract_scene_graph::SceneState state = env->getState(joint_group->getJointNames(), joint_values);
+    manager->setCollisionObjectsTransform(state.link_transforms);
+    ContactResultMap expected;
+    manager->contactTest(expected, request);
+
+    manager->setCollisionObjectsTransform(env->getState().link_transforms);
+    binding.update(joint_values);
+    for (std::size_t i = 0; i < binding.getLinkNames().size(); ++i)
+    {
+      const Eigen::Isometry3d& link_transform = state.link_transforms.at(binding.getLinkNames()[i]);
+      EXPECT_TRUE(binding.getLinkTransforms()[i].isApprox(link_transform, 1e-8));
+    }
+
+    ContactResultMap contacts;
+    manager->contactTest(contacts, request);
+    EXPECT_EQ(contacts.size(), expected.size());
+  }
+
+  // Handles are resolved again after a collision object is removed
+  manager->removeCollisionObject("test_box_link");
+  binding.rebind();
+  binding.update(Eigen::VectorXd::Zero(2));
+  EXPECT_TRUE(binding.getLinkTransforms()[0].isApprox(env->getLinkTransform("boxbot_link"), 1e-8));
+  manager->removeCollisionObject("boxbot_link");
+  EXPECT_ANY_THROW(binding.rebind());  // NOLINT
+
+  // Links which are not collision objects can not be bound
+  EXPECT_ANY_THROW(ContactManagerBinding(*joint_group, *manager, { "boxbot_linkX" }));    // NOLINT
+  EXPECT_ANY_THROW(ContactManagerBinding(*joint_group, *manager, { "does_not_exist" }));  // NOLINT
+}
+
+TEST(TesseractEnvironmentUtils, contactManagerAutotune)  // NOLINT
+{
+  auto scene_graph = getSceneGraph();
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  // The hash only depends on the structure of the environment
+  const std::uint64_t hash = getEnvironmentHash(*env);
+  EXPECT_EQ(getEnvironmentHash(*env->clone()), hash);
+  env->setState({ "boxbot_x_joint" }, Eigen::VectorXd::Constant(1, 0.5));
+  EXPECT_EQ(getEnvironmentHash(*env), hash);
+
+  ContactManagerAutotuneConfig config;
+  config.num_states = 20;
+  config.repetitions = 1;
+  const tesseract_common::ContactManagersPluginInfo plugin_info = env->getContactManagersPluginInfo();
+
+  {  // Every plugin is benchmarked and the reference is accurate
+    ContactManagerAutotuneResult result = benchmarkContactManagers(*env, config);
+    EXPECT_EQ(result.environment_hash, hash);
+    ASSERT_EQ(result.discrete_timings.size(), plugin_info.discrete_plugin_infos.plugins.size());
+    ASSERT_EQ(result.continuous_timings.size(), plugin_info.continuous_plugin_infos.plugins.size());
+    EXPECT_EQ(result.discrete_timings.front().name, plugin_info.discrete_plugin_infos.default_plugin);
+    EXPECT_TRUE(result.discrete_timings.front().accurate);
+    EXPECT_TRUE(result.continuous_timings.front().accurate);
+    EXPECT_EQ(plugin_info.discrete_plugin_infos.plugins.count(result.discrete_manager), 1);
+    EXPECT_EQ(plugin_info.continuous_plugin_infos.plugins.count(result.continuous_manager), 1);
+  }
+
+  {  // The cached result is used and made active
+    ContactManagerAutotuneCache cache;
+    ContactManagerAutotuneResult cached;
+    cached.environment_hash = hash;
+    cached.discrete_manager = "BulletDiscreteSimpleManager";
+    cached.continuous_manager = "BulletCastSimpleManager";
+    cache.set(cached);
+
+    ContactManagerAutotuneResult result = autotuneContactManagers(*env, config, &cache);
+    EXPECT_EQ(result.discrete_manager, "BulletDiscreteSimpleManager");
+    EXPECT_TRUE(result.discrete_timings.empty());
+    EXPECT_EQ(env->getDiscreteContactManager()->getName(), "BulletDiscreteSimpleManager");
+    EXPECT_EQ(env->getContinuousContactManager()->getName(), "BulletCastSimpleManager");
+
+    // The result of a changed environment is benchmarked and added to the cache
+    EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("test_box_link", false)));
+    EXPECT_NE(getEnvironmentHash(*env), hash);
+    result = autotuneContactManagers(*env, config, &cache);
+    EXPECT_EQ(result.environment_hash, getEnvironmentHash(*env));
+    EXPECT_FALSE(result.discrete_timings.empty());
+    EXPECT_EQ(cache.size(), 2);
+
+    const std::string file_path = tesseract_common::getTempPath() + "contact_manager_autotune.yaml";
+    EXPECT_TRUE(cache.save(file_path));
+    ContactManagerAutotuneCache loaded;
+    EXPECT_TRUE(loaded.load(file_path));
+    EXPECT_EQ(loaded.size(), 2);
+    ContactManagerAutotuneResult loaded_result;
+    EXPECT_TRUE(loaded.get(loaded_result, hash));
+    EXPECT_EQ(loaded_result.discrete_manager, "BulletDiscreteSimpleManager");
+    EXPECT_EQ(loaded_result.continuous_manager, "BulletCastSimpleManager");
+    EXPECT_FALSE(loaded.load(tesseract_common::getTempPath() + "does_not_exist.yaml"));
+  }
+
+  {  // An environment which is not initialized is not benchmarked
+    ContactManagerAutotuneResult result = benchmarkContactManagers(Environment(), config);
+    EXPECT_TRUE(result.discrete_manager.empty());
+    EXPECT_TRUE(result.discrete_timings.empty());
   }
 }
 
@@ -34,6 +34,7 @@
 #include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_geometry/impl/octree.h>
 #include <tesseract_geometry/impl/plane.h>
+#include <tesseract_geometry/impl/point_cloud.h>
 #include <tesseract_geometry/impl/polygon_mesh.h>
 #include <tesseract_geometry/impl/sdf_mesh.h>
 #include <tesseract_geometry/impl/sphere.h>
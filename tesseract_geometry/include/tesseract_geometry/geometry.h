@@ -30,11 +30,15 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/export.hpp>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/memory_usage.h>
+
 namespace tesseract_geometry
 {
 enum GeometryType
@@ -50,11 +54,13 @@ enum GeometryType
   CONVEX_MESH,
   SDF_MESH,
   OCTREE,
-  POLYGON_MESH
+  POLYGON_MESH,
+  POINT_CLOUD
 };
 static const std::vector<std::string> GeometryTypeStrings = { "UNINITIALIZED", "SPHERE",   "CYLINDER", "CAPSULE",
                                                               "CONE",          "BOX",      "PLANE",    "MESH",
-                                                              "CONVEX_MESH",   "SDF_MESH", "OCTREE",   "POLYGON_MESH" };
+                                                              "CONVEX_MESH",   "SDF_MESH", "OCTREE",   "POLYGON_MESH",
+                                                              "POINT_CLOUD" };
 
 class Geometry
 {
@@ -64,23 +70,62 @@ public:
 
   explicit Geometry(GeometryType type = GeometryType::UNINITIALIZED) : type_(type) {}
   virtual ~Geometry() = default;
-  Geometry(const Geometry&) = default;
-  Geometry& operator=(const Geometry&) = default;
-  Geometry(Geometry&&) = default;
-  Geometry& operator=(Geometry&&) = default;
+  Geometry(const Geometry& other);
+  Geometry& operator=(const Geometry& other);
+  Geometry(Geometry&& other) noexcept;
+  Geometry& operator=(Geometry&& other) noexcept;
 
   /** \brief Create a copy of this shape */
   virtual Geometry::Ptr clone() const = 0;
 
   GeometryType getType() const { return type_; }
 
+  /**
+   * @brief Get a hash of the content of the geometry
+   * @details The hash is computed on first use and cached, because the content of a geometry does not change once it
+   * is created. Geometries with exactly the same content have the same hash.
+   * @return The hash
+   */
+  std::size_t getHash() const;
+
+  /**
+   * @brief Get the memory used by the geometry
+   * @details A geometry which was reported to the tracker before is reported without bytes
+   * @param tracker Tracks the storage shared with other objects
+   * @return The memory used by the geometry, named by its type
+   */
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
   bool operator==(const Geometry& rhs) const;
   bool operator!=(const Geometry& rhs) const;
 
+protected:
+  /**
+   * @brief Compute the hash of the content of the geometry
+   * @details Derived classes combine the hash of their content with the hash of their base class
+   */
+  virtual std::size_t computeHash() const;
+
+  /**
+   * @brief Add the memory used by the geometry, it is only called the first time the geometry is reported
+   * @details Derived classes holding arrays add the size of their object and count the arrays through the tracker
+   */
+  virtual void addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                              tesseract_common::MemoryUsageTracker& tracker) const;
+
+  /** @brief Combine a hash into a seed */
+  static void hashCombine(std::size_t& seed, std::size_t hash)
+  {
+    seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
 private:
   /** \brief The type of the shape */
   GeometryType type_;
 
+  /** @brief The cached hash of the content, zero until it is computed */
+  mutable std::atomic<std::size_t> hash_{ 0 };
+
   friend class boost::serialization::access;
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
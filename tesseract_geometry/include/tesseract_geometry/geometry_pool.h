@@ -0,0 +1,131 @@
+/**
+ * @file geometry_pool.h
+ * @brief A process wide pool sharing identical meshes
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_GEOMETRY_GEOMETRY_POOL_H
+#define TESSERACT_GEOMETRY_GEOMETRY_POOL_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/geometry.h>
+
+namespace tesseract_geometry
+{
+/**
+ * @brief A process wide pool of meshes, so a mesh loaded or created several times is shared instead of copied
+ * @details Meshes loaded from a resource are keyed by the resource URL, the scale and the load options. Other meshes
+ * are interned by their content. Meshes are never changed after they are created, so sharing them is safe, and the
+ * contact managers which cache their shapes and convex hulls by the mesh then build them once.
+ *
+ * The pool only holds weak references, a mesh is loaded again once every user of it has been destroyed.
+ */
+class GeometryPool
+{
+public:
+  using LoadFn = std::function<std::vector<Geometry::Ptr>()>;
+
+  GeometryPool() = default;
+  ~GeometryPool() = default;
+  GeometryPool(const GeometryPool&) = delete;
+  GeometryPool& operator=(const GeometryPool&) = delete;
+  GeometryPool(GeometryPool&&) = delete;
+  GeometryPool& operator=(GeometryPool&&) = delete;
+
+  /** @brief Get the process wide pool */
+  static GeometryPool& getInstance();
+
+  /**
+   * @brief Get the meshes loaded with a key, loading them if they are not in the pool
+   * @details The meshes are loaded outside of the lock, so different keys are loaded in parallel. If the same key is
+   * loaded by several threads at once the meshes loaded first are kept.
+   * @param key Identifies the meshes, for example the resource URL, scale and load options
+   * @param load_fn Loads the meshes, nothing is added to the pool if it returns no meshes
+   * @return The meshes
+   */
+  template <class T>
+  std::vector<std::shared_ptr<T>> getMeshes(const std::string& key,
+                                            const std::function<std::vector<std::shared_ptr<T>>()>& load_fn)
+  {
+    // The type is part of the key, so the meshes can be cast back to it
+    LoadFn fn = [&load_fn]() {
+      std::vector<std::shared_ptr<T>> meshes = load_fn();
+      return std::vector<Geometry::Ptr>(meshes.begin(), meshes.end());
+    };
+
+    std::vector<Geometry::Ptr> geometries = getGeometries(std::string(typeid(T).name()) + " " + key, fn);
+    std::vector<std::shared_ptr<T>> meshes;
+    meshes.reserve(geometries.size());
+    for (const auto& geometry : geometries)
+      meshes.push_back(std::static_pointer_cast<T>(geometry));
+
+    return meshes;
+  }
+
+  /**
+   * @brief Get the geometry in the pool with the same content, adding the geometry if there is none
+   * @details Only polygon meshes are interned, other geometry is returned as is. Meshes with a material or textures
+   * are only equal to themselves.
+   * @param geometry The geometry
+   * @return The pooled geometry
+   */
+  Geometry::Ptr intern(const Geometry::Ptr& geometry);
+
+  /** @brief Get the number of meshes in the pool which are still in use */
+  std::size_t size() const;
+
+  /** @brief Remove all meshes from the pool, the meshes in use are not affected */
+  void clear();
+
+private:
+  std::vector<Geometry::Ptr> getGeometries(const std::string& key, const LoadFn& load_fn);
+
+  /** @brief Remove the entries of meshes which are no longer in use once the pool has grown */
+  void purge();
+
+  mutable std::mutex mutex_;
+
+  /** @brief The meshes loaded by key */
+  std::unordered_map<std::string, std::vector<std::weak_ptr<Geometry>>> loaded_;
+
+  /** @brief The interned meshes by the hash of their content */
+  std::unordered_multimap<std::size_t, std::weak_ptr<Geometry>> interned_;
+
+  /** @brief The interned meshes by address, so interning a pooled mesh again does not compare the content */
+  std::unordered_map<const Geometry*, std::weak_ptr<Geometry>> addresses_;
+
+  /** @brief The number of entries at which expired entries are removed */
+  std::size_t purge_size_{ 64 };
+};
+
+}  // namespace tesseract_geometry
+
+#endif  // TESSERACT_GEOMETRY_GEOMETRY_POOL_H
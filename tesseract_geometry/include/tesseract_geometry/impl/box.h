@@ -55,6 +55,9 @@ public:
   bool operator==(const Box& rhs) const;
   bool operator!=(const Box& rhs) const;
 
+protected:
+  std::size_t computeHash() const override;
+
 private:
   double x_{ 0 };
   double y_{ 0 };
@@ -54,6 +54,9 @@ public:
   bool operator==(const Cone& rhs) const;
   bool operator!=(const Cone& rhs) const;
 
+protected:
+  std::size_t computeHash() const override;
+
 private:
   double r_{ 0 };
   double l_{ 0 };
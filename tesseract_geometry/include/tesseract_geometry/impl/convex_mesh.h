@@ -150,7 +150,9 @@ public:
 
   Geometry::Ptr clone() const override
   {
-    return std::make_shared<ConvexMesh>(getVertices(), getFaces(), getFaceCount(), getResource(), getScale());
+    auto ptr = std::make_shared<ConvexMesh>(getVertices(), getFaces(), getFaceCount(), getResource(), getScale());
+    ptr->shareAttachments(*this);
+    return ptr;
   }
   bool operator==(const ConvexMesh& rhs) const;
   bool operator!=(const ConvexMesh& rhs) const;
@@ -158,6 +158,7 @@ public:
                                    nullptr,
                                    getTextures());
     }
+    ptr->shareAttachments(*this);
     return ptr;
   }
   bool operator==(const Mesh& rhs) const;
@@ -32,9 +32,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/export.hpp>
 #include <Eigen/Geometry>
 #include <memory>
+#include <vector>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/types.h>
 #include <tesseract_geometry/geometry.h>
 
 namespace tesseract_geometry
@@ -49,7 +51,9 @@ public:
   {
     BOX,
     SPHERE_INSIDE,
-    SPHERE_OUTSIDE
+    SPHERE_OUTSIDE,
+    /** @brief Adjacent occupied cells are merged into larger boxes, see getMergedBoxes */
+    MERGED_BOX
   };
 
   Octree(std::shared_ptr<const octomap::OcTree> octree, const SubType sub_type)
@@ -57,6 +61,11 @@ public:
   {
   }
 
+  /**
+   * @brief Create an octree from a point cloud
+   * @details The points are converted to leaf keys in parallel and sorted by their Morton code, so each leaf is
+   * updated once and the leaves are inserted in depth first order.
+   */
   template <typename PointT>
   Octree(const PointT& point_cloud,
          const double resolution,
@@ -65,26 +74,44 @@ public:
          const bool binary = true)
     : Geometry(GeometryType::OCTREE), sub_type_(sub_type), resolution_(resolution)
   {
-    auto ot = std::make_shared<octomap::OcTree>(resolution);
-
+    tesseract_common::VectorVector3d points;
+    points.reserve(point_cloud.points.size());
     for (auto& point : point_cloud.points)
-      ot->updateNode(point.x, point.y, point.z, true, true);
+      points.emplace_back(point.x, point.y, point.z);
 
-    // Per the documentation for overload updateNode above with lazy_eval enabled this must be called after all points
-    // are added
-    ot->updateInnerOccupancy();
-    if (binary)
-    {
-      ot->toMaxLikelihood();
-      binary_octree_ = binary;
-    }
+    auto ot = std::make_shared<octomap::OcTree>(resolution);
+    insertPoints(*ot, points);
+    finalize(*ot, prune, binary);
+    octree_ = ot;
+  }
 
-    if (prune)
-    {
-      tesseract_geometry::Octree::prune(*ot);
-      pruned_ = prune;
-    }
+  /**
+   * @brief Create an octree from a point cloud captured by a sensor
+   * @details The voxels along the ray from the sensor origin to each point are marked free, which clears space the
+   * sensor can see through. The points are discretized to the resolution first, so each voxel casts a single ray.
+   * @param max_range If positive, the rays are truncated to this length and their end points are not marked occupied
+   */
+  template <typename PointT>
+  Octree(const PointT& point_cloud,
+         const Eigen::Vector3d& sensor_origin,
+         const double resolution,
+         const SubType sub_type,
+         const bool prune,
+         const bool binary = true,
+         const double max_range = -1)
+    : Geometry(GeometryType::OCTREE), sub_type_(sub_type), resolution_(resolution)
+  {
+    octomap::Pointcloud scan;
+    scan.reserve(point_cloud.points.size());
+    for (auto& point : point_cloud.points)
+      scan.push_back(static_cast<float>(point.x), static_cast<float>(point.y), static_cast<float>(point.z));
 
+    auto ot = std::make_shared<octomap::OcTree>(resolution);
+    const octomap::point3d origin(static_cast<float>(sensor_origin.x()),
+                                  static_cast<float>(sensor_origin.y()),
+                                  static_cast<float>(sensor_origin.z()));
+    ot->insertPointCloud(scan, origin, max_range, true, true);
+    finalize(*ot, prune, binary);
     octree_ = ot;
   }
 
@@ -97,7 +124,26 @@ public:
 
   bool getPruned() const { return pruned_; }
 
-  Geometry::Ptr clone() const override final { return std::make_shared<Octree>(octree_, sub_type_); }
+  /**
+   * @brief Set the error allowed in distance queries against the octree
+   * @details The contact managers traverse the octree from the root. When the shape of an inner node is not larger
+   * than the tolerance it is checked as a single cell instead of refining it to its occupied leaves, which
+   * underestimates the distance to the leaves by at most the tolerance. The coarse cells are only used for the BOX sub
+   * type, because the box of an inner node contains the boxes of its children while its sphere does not contain the
+   * spheres of its children. The default of zero always checks the leaves.
+   * @param tolerance The allowed error, not negative
+   */
+  void setDistanceTolerance(double tolerance) { distance_tolerance_ = tolerance; }
+
+  /** @brief Get the error allowed in distance queries against the octree */
+  double getDistanceTolerance() const { return distance_tolerance_; }
+
+  Geometry::Ptr clone() const override final
+  {
+    auto octree = std::make_shared<Octree>(octree_, sub_type_);
+    octree->distance_tolerance_ = distance_tolerance_;
+    return octree;
+  }
   bool operator==(const Octree& rhs) const;
   bool operator!=(const Octree& rhs) const;
 
@@ -126,12 +172,21 @@ public:
     return cnt;
   }
 
+protected:
+  /** @brief The hash of the sub type and resolution, the cells are not hashed because they may be updated in place */
+  std::size_t computeHash() const override;
+
+  /** @brief Count the octree, as reported by octomap */
+  void addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                      tesseract_common::MemoryUsageTracker& tracker) const override;
+
 private:
   std::shared_ptr<const octomap::OcTree> octree_;
   SubType sub_type_{ SubType::BOX };
   double resolution_{ 0.01 };
   bool pruned_{ false };
   bool binary_octree_{ false };
+  double distance_tolerance_{ 0 };
 
   static bool isNodeCollapsible(octomap::OcTree& octree, octomap::OcTreeNode* node)
   {
@@ -179,35 +234,29 @@ private:
   }
 
   // NOLINTNEXTLINE(misc-no-recursion)
-  static void pruneRecurs(octomap::OcTree& octree,
-                          octomap::OcTreeNode* node,
-                          unsigned int depth,
-                          unsigned int max_depth,
-                          unsigned int& num_pruned)
+  static void pruneRecurs(octomap::OcTree& octree, octomap::OcTreeNode* node)
   {
     assert(node);
 
-    if (depth < max_depth)
-    {
-      for (unsigned int i = 0; i < 8; i++)
-      {
-        if (octree.nodeChildExists(node, i))
-        {
-          pruneRecurs(octree, octree.getNodeChild(node, i), depth + 1, max_depth, num_pruned);
-        }
-      }
-    }  // end if depth
-
-    else
+    for (unsigned int i = 0; i < 8; i++)
     {
-      // max level reached
-      if (pruneNode(octree, node))
-      {
-        num_pruned++;
-      }
+      if (octree.nodeChildExists(node, i))
+        pruneRecurs(octree, octree.getNodeChild(node, i));
     }
+
+    pruneNode(octree, node);
   }
 
+  /**
+   * @brief Insert occupied points into the octree with lazy evaluation
+   * @details Each leaf is updated once with the sum of the hits of its points, which gives the same occupancy as
+   * updating it once per point because the hits are clamped to the same upper bound.
+   */
+  static void insertPoints(octomap::OcTree& octree, const tesseract_common::VectorVector3d& points);
+
+  /** @brief Update the inner nodes and apply the binary and prune options after the points are inserted */
+  void finalize(octomap::OcTree& octree, bool prune, bool binary);
+
   friend class boost::serialization::access;
   template <class Archive>
   void save(Archive& ar, const unsigned int version) const;  // NOLINT
@@ -232,18 +281,30 @@ public:
     if (octree.getRoot() == nullptr)
       return;
 
-    for (unsigned int depth = octree.getTreeDepth() - 1; depth > 0; --depth)
+    // The children of a node are pruned before the node, so a single bottom up pass prunes every level
+    for (unsigned int i = 0; i < 8; i++)
     {
-      unsigned int num_pruned = 0;
-      pruneRecurs(octree, octree.getRoot(), 0, depth, num_pruned);
-      if (num_pruned == 0)
-        break;
+      if (octree.nodeChildExists(octree.getRoot(), i))
+        pruneRecurs(octree, octree.getNodeChild(octree.getRoot(), i));
     }
   }
+
+  /**
+   * @brief Greedily merge the occupied cells of an octree into axis aligned boxes
+   * @details Pruned cells are kept as boxes. Starting from the lowest occupied cell at the finest depth not yet
+   * covered, a box is grown along x, then y, then z while every cell it would cover is occupied and not yet covered.
+   * The boxes do not overlap and cover exactly the occupied cells, so walls, floors and tables become a few boxes.
+   * @param octree The octree
+   * @return The boxes in the frame of the octree
+   */
+  static std::vector<Eigen::AlignedBox3d> getMergedBoxes(const octomap::OcTree& octree);
 };
 }  // namespace tesseract_geometry
 
 #include <boost/serialization/tracking.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_geometry::Octree, "Octree")
 BOOST_CLASS_TRACKING(tesseract_geometry::Octree, boost::serialization::track_never)
+#include <boost/serialization/version.hpp>
+// Version 1 stores the octree data compressed in binary archives, version 2 adds the distance tolerance
+BOOST_CLASS_VERSION(tesseract_geometry::Octree, 2)
 #endif
@@ -56,6 +56,9 @@ public:
   bool operator==(const Plane& rhs) const;
   bool operator!=(const Plane& rhs) const;
 
+protected:
+  std::size_t computeHash() const override;
+
 private:
   double a_{ 0 };
   double b_{ 0 };
@@ -0,0 +1,105 @@
+/**
+ * @file point_cloud.h
+ * @brief Tesseract Point Cloud Geometry
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_GEOMETRY_POINT_CLOUD_H
+#define TESSERACT_GEOMETRY_POINT_CLOUD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/export.hpp>
+#include <memory>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/eigen_serialization.h>
+#include <tesseract_common/types.h>
+#include <tesseract_geometry/geometry.h>
+
+namespace tesseract_geometry
+{
+/**
+ * @brief A point cloud where each point is a sphere of the same radius
+ * @details Unlike an Octree this does not build a tree from the points, the contact managers index the spheres
+ * directly. This makes it cheap to replace a sensor cloud every frame by adding a new collision object with the same
+ * name. The points are shared between copies of the geometry, use voxelDownsample to reduce a dense cloud first.
+ */
+class PointCloud : public Geometry
+{
+public:
+  using Ptr = std::shared_ptr<PointCloud>;
+  using ConstPtr = std::shared_ptr<const PointCloud>;
+
+  /**
+   * @brief Point cloud constructor
+   * @param points The points of the cloud
+   * @param point_radius The radius of the sphere around each point, must be greater than zero
+   */
+  PointCloud(std::shared_ptr<const tesseract_common::VectorVector3d> points, double point_radius);
+  PointCloud() = default;
+  ~PointCloud() override = default;
+
+  /** @brief The points of the cloud */
+  const std::shared_ptr<const tesseract_common::VectorVector3d>& getPoints() const { return points_; }
+
+  /** @brief The number of points of the cloud */
+  std::size_t getPointCount() const { return (points_ == nullptr) ? 0 : points_->size(); }
+
+  /** @brief The radius of the sphere around each point */
+  double getPointRadius() const { return point_radius_; }
+
+  Geometry::Ptr clone() const override final { return std::make_shared<PointCloud>(points_, point_radius_); }
+  bool operator==(const PointCloud& rhs) const;
+  bool operator!=(const PointCloud& rhs) const;
+
+  /**
+   * @brief Reduce a point cloud to one point per cell of a uniform voxel grid
+   * @details The points are hashed to the cell containing them and replaced by the centroid of the points of each
+   * cell. The points are kept in the order their cell was first reached. This is linear in the number of points.
+   * @param points The points to downsample
+   * @param resolution The edge length of the cells, if not greater than zero the points are copied
+   * @return The downsampled points
+   */
+  static std::shared_ptr<const tesseract_common::VectorVector3d>
+  voxelDownsample(const tesseract_common::VectorVector3d& points, double resolution);
+
+protected:
+  std::size_t computeHash() const override;
+
+  void addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                      tesseract_common::MemoryUsageTracker& tracker) const override;
+
+private:
+  std::shared_ptr<const tesseract_common::VectorVector3d> points_;
+  double point_radius_{ 0 };
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+}  // namespace tesseract_geometry
+
+#include <boost/serialization/tracking.hpp>
+BOOST_CLASS_EXPORT_KEY2(tesseract_geometry::PointCloud, "PointCloud")
+BOOST_CLASS_TRACKING(tesseract_geometry::PointCloud, boost::serialization::track_never)
+#endif
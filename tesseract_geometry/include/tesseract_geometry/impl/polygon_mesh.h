@@ -31,7 +31,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/export.hpp>
 #include <Eigen/Geometry>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/eigen_serialization.h>
@@ -49,6 +52,13 @@ public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   // LCOV_EXCL_STOP
 
+  /** @brief A view of the vertices as the columns of a matrix */
+  using VertexMap = Eigen::Map<const Eigen::Matrix3Xd>;
+
+  /** @brief A view of the vertex indices of triangles as the columns of a matrix, skipping the count of each face */
+  using TriangleMap =
+      Eigen::Map<const Eigen::Matrix<int, 3, Eigen::Dynamic>, Eigen::Unaligned, Eigen::OuterStride<4>>;
+
   using Ptr = std::shared_ptr<PolygonMesh>;
   using ConstPtr = std::shared_ptr<const PolygonMesh>;
 
@@ -163,6 +173,28 @@ public:
    */
   int getFaceCount() const { return face_count_; }
 
+  /**
+   * @brief Get a view of the vertices as the columns of a 3xN matrix
+   * @details The view refers to the vertices of the mesh, so it can be passed to Eigen expressions or to libraries
+   * taking strided arrays without copying the vertices. It is valid as long as the vertices are.
+   * @return The vertices
+   */
+  VertexMap getVertexMap() const;
+
+  /**
+   * @brief Check if every face of the mesh is a triangle
+   * @return True if the faces can be viewed with getTriangleMap, otherwise false
+   */
+  bool isTriangleMesh() const;
+
+  /**
+   * @brief Get a view of the vertex indices of each triangle as the columns of a 3xN matrix
+   * @details The view refers to the faces of the mesh and strides over the vertex count of each face, so the faces are
+   * not copied. It is only valid for a triangle mesh, see isTriangleMesh.
+   * @return The vertex indices of the triangles
+   */
+  TriangleMap getTriangleMap() const;
+
   /**
    * @brief Get the path to file used to generate the mesh
    *
@@ -218,13 +250,73 @@ public:
    */
   const std::shared_ptr<const std::vector<MeshTexture::Ptr>>& getTextures() const { return mesh_textures_; }
 
+  /**
+   * @brief Get a structure computed from the vertices and faces, creating it on first use
+   * @details Contact managers attach their acceleration structures, for example the bounding volume hierarchy of the
+   * mesh, so they are created once and shared by every manager using the mesh, its copies and its clones. The
+   * structure may only depend on the vertices, the faces and the parameters included in the key. Attachments are not
+   * serialized, they are created again on first use.
+   * @param key The key of the structure, unique for each kind of structure and its parameters
+   * @param create Creates the structure, nothing is attached if it returns nullptr
+   * @return The structure
+   */
+  template <class T, class Create>
+  std::shared_ptr<T> getAttachment(const std::string& key, Create&& create) const
+  {
+    {
+      std::scoped_lock lock(attachments_->mutex);
+      auto it = attachments_->entries.find(key);
+      if (it != attachments_->entries.end())
+        return std::static_pointer_cast<T>(it->second);
+    }
+
+    // Create outside of the lock so other structures can be created in parallel
+    std::shared_ptr<T> attachment = create();
+    if (attachment == nullptr)
+      return nullptr;
+
+    // Another thread may have created the same structure in the meantime
+    std::scoped_lock lock(attachments_->mutex);
+    auto it = attachments_->entries.emplace(key, attachment).first;
+    return std::static_pointer_cast<T>(it->second);
+  }
+
+  /**
+   * @brief Check if a structure is attached to the mesh
+   * @param key The key of the structure
+   * @return True if the structure was created, otherwise false
+   */
+  bool hasAttachment(const std::string& key) const
+  {
+    std::scoped_lock lock(attachments_->mutex);
+    return attachments_->entries.find(key) != attachments_->entries.end();
+  }
+
   Geometry::Ptr clone() const override
   {
-    return std::make_shared<PolygonMesh>(vertices_, faces_, face_count_, resource_, scale_);
+    auto ptr = std::make_shared<PolygonMesh>(vertices_, faces_, face_count_, resource_, scale_);
+    ptr->shareAttachments(*this);
+    return ptr;
   }
+  /**
+   * @brief Check if two meshes are equal
+   * @details The vertices and faces must be exactly equal. The cached hash of the content tells most different meshes
+   * apart without comparing their vertices and faces.
+   */
   bool operator==(const PolygonMesh& rhs) const;
   bool operator!=(const PolygonMesh& rhs) const;
 
+protected:
+  /** @brief The hash of the vertices and faces, the scale is already applied to the vertices */
+  std::size_t computeHash() const override;
+
+  /** @brief Count the vertices, faces, normals and vertex colors, which are shared by the copies of the mesh */
+  void addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                      tesseract_common::MemoryUsageTracker& tracker) const override;
+
+  /** @brief Share the attachments of a mesh with the same vertices and faces, used when cloning */
+  void shareAttachments(const PolygonMesh& mesh) { attachments_ = mesh.attachments_; }
+
 private:
   std::shared_ptr<const tesseract_common::VectorVector3d> vertices_;
   std::shared_ptr<const Eigen::VectorXi> faces_;
@@ -238,12 +330,29 @@ private:
   MeshMaterial::Ptr mesh_material_;
   std::shared_ptr<const std::vector<MeshTexture::Ptr>> mesh_textures_;
 
+  /** @brief The structures attached to the mesh, shared with the copies and clones of the mesh */
+  struct Attachments
+  {
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<void>> entries;
+  };
+  std::shared_ptr<Attachments> attachments_{ std::make_shared<Attachments>() };
+
   friend class boost::serialization::access;
+  template <class Archive>
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
 
 }  // namespace tesseract_geometry
 #include <boost/serialization/tracking.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_geometry::PolygonMesh, "PolygonMesh")
+// Version 1 stores the arrays compressed in binary archives
+BOOST_CLASS_VERSION(tesseract_geometry::PolygonMesh, 1)
 #endif  // POLYGON_MESH_H
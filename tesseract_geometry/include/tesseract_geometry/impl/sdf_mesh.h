@@ -130,7 +130,9 @@ public:
 
   Geometry::Ptr clone() const override
   {
-    return std::make_shared<SDFMesh>(getVertices(), getFaces(), getFaceCount(), getResource(), getScale());
+    auto ptr = std::make_shared<SDFMesh>(getVertices(), getFaces(), getFaceCount(), getResource(), getScale());
+    ptr->shareAttachments(*this);
+    return ptr;
   }
 
   bool operator==(const SDFMesh& rhs) const;
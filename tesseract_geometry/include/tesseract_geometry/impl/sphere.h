@@ -53,6 +53,9 @@ public:
   bool operator==(const Sphere& rhs) const;
   bool operator!=(const Sphere& rhs) const;
 
+protected:
+  std::size_t computeHash() const override;
+
 private:
   double r_{ 0 };
 
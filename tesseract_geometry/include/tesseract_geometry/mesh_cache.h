@@ -0,0 +1,196 @@
+/**
+ * @file mesh_cache.h
+ * @brief A persistent on-disk cache of the meshes imported by the mesh parser
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_GEOMETRY_MESH_CACHE_H
+#define TESSERACT_GEOMETRY_MESH_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_common/types.h>
+
+namespace tesseract_geometry
+{
+/** @brief The imported arrays of a mesh stored in the cache */
+struct MeshCacheData
+{
+  std::shared_ptr<const tesseract_common::VectorVector3d> vertices;
+  std::shared_ptr<const Eigen::VectorXi> faces;
+  int face_count{ 0 };
+  std::shared_ptr<const tesseract_common::VectorVector3d> normals;
+  std::shared_ptr<const tesseract_common::VectorVector4d> vertex_colors;
+};
+
+/**
+ * @brief A persistent on-disk cache of the vertices, faces, normals and vertex colors produced by the mesh parser
+ * @details An entry is keyed by a hash of the mesh file content, the file type, the scale and the import options, so
+ * a changed file is imported again. Each entry is a file holding a small header followed by the raw arrays of each
+ * mesh, aligned to eight bytes. Entries are memory mapped and the arrays are copied into the meshes without parsing.
+ *
+ * Meshes with materials and textures are not cached because the textures refer to other resources.
+ *
+ * The cache is disabled by default. The directory and the size limit are read from the TESSERACT_MESH_CACHE_DIR and
+ * TESSERACT_MESH_CACHE_MAX_SIZE (in bytes) environment variables and can be changed at runtime. Once the entries
+ * exceed the size limit the least recently used entries are removed.
+ */
+class MeshCache
+{
+public:
+  MeshCache();
+  ~MeshCache() = default;
+  MeshCache(const MeshCache&) = delete;
+  MeshCache& operator=(const MeshCache&) = delete;
+  MeshCache(MeshCache&&) = delete;
+  MeshCache& operator=(MeshCache&&) = delete;
+
+  /** @brief Get the process wide cache */
+  static MeshCache& getInstance();
+
+  /**
+   * @brief Set the cache directory, it is created when the first entry is stored
+   * @param directory The directory, an empty string disables the cache
+   */
+  void setDirectory(const std::string& directory);
+
+  /** @brief Get the cache directory, empty if the cache is disabled */
+  std::string getDirectory() const;
+
+  /** @brief Set the maximum total size of the entries in bytes */
+  void setMaxSize(std::uintmax_t max_size);
+
+  /** @brief Get the maximum total size of the entries in bytes */
+  std::uintmax_t getMaxSize() const;
+
+  /** @brief Check if the cache is enabled */
+  bool isEnabled() const;
+
+  /**
+   * @brief Get the key of an entry
+   * @param data The mesh file content
+   * @param hint The file type, for example the extension
+   * @param scale The scale applied to the vertices
+   * @param triangulate The triangulate option of the import
+   * @param flatten The flatten option of the import
+   * @param normals The normals option of the import
+   * @param vertex_colors The vertex colors option of the import
+   * @return The key
+   */
+  static std::string getKey(const std::vector<uint8_t>& data,
+                            const std::string& hint,
+                            const Eigen::Vector3d& scale,
+                            bool triangulate,
+                            bool flatten,
+                            bool normals,
+                            bool vertex_colors);
+
+  /**
+   * @brief Get the key of an entry created by other means than importing a mesh file
+   * @param data The content the entry is created from, for example the arrays of a mesh
+   * @param options The options the entry is created with, which must differ from the options of other creators
+   * @return The key
+   */
+  static std::string getKey(const std::vector<uint8_t>& data, const std::string& options);
+
+  /**
+   * @brief Load an entry
+   * @param key The key of the entry
+   * @param meshes The meshes of the entry
+   * @return True if the entry exists and is valid, otherwise false
+   */
+  bool load(const std::string& key, std::vector<MeshCacheData>& meshes) const;
+
+  /**
+   * @brief Store an entry, replacing an existing entry with the same key
+   * @param key The key of the entry
+   * @param meshes The meshes of the entry
+   * @return True if the entry was stored, otherwise false
+   */
+  bool store(const std::string& key, const std::vector<MeshCacheData>& meshes);
+
+  /** @brief Remove all entries from the cache directory */
+  void clear();
+
+  /**
+   * @brief Create meshes from the arrays of an entry
+   * @param meshes The meshes of the entry
+   * @param resource The resource the meshes were imported from
+   * @param scale The scale applied to the vertices
+   */
+  template <class T>
+  static std::vector<std::shared_ptr<T>> createMeshes(const std::vector<MeshCacheData>& meshes,
+                                                      const tesseract_common::Resource::Ptr& resource,
+                                                      const Eigen::Vector3d& scale)
+  {
+    std::vector<std::shared_ptr<T>> result;
+    result.reserve(meshes.size());
+    for (const auto& mesh : meshes)
+    {
+      result.push_back(std::make_shared<T>(
+          mesh.vertices, mesh.faces, mesh.face_count, resource, scale, mesh.normals, mesh.vertex_colors));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Get the arrays of imported meshes to store them
+   * @param meshes The imported meshes
+   */
+  template <class T>
+  static std::vector<MeshCacheData> getData(const std::vector<std::shared_ptr<T>>& meshes)
+  {
+    std::vector<MeshCacheData> data;
+    data.reserve(meshes.size());
+    for (const auto& mesh : meshes)
+    {
+      MeshCacheData entry;
+      entry.vertices = mesh->getVertices();
+      entry.faces = mesh->getFaces();
+      entry.face_count = mesh->getFaceCount();
+      entry.normals = mesh->getNormals();
+      entry.vertex_colors = mesh->getVertexColors();
+      data.push_back(entry);
+    }
+    return data;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::string directory_;
+  std::uintmax_t max_size_{ 0 };
+
+  /** @brief Remove the least recently used entries until the entries fit in the size limit */
+  void trim(const std::string& directory, std::uintmax_t max_size) const;
+};
+
+}  // namespace tesseract_geometry
+
+#endif  // TESSERACT_GEOMETRY_MESH_CACHE_H
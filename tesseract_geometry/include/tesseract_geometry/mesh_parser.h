@@ -43,6 +43,9 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
 
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
@@ -62,6 +65,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_geometry/geometry_pool.h>
+#include <tesseract_geometry/mesh_cache.h>
 #include <tesseract_geometry/impl/mesh_material.h>
 
 namespace tesseract_geometry
@@ -341,6 +346,26 @@ std::vector<std::shared_ptr<T>> createMeshFromPath(const std::string& path,
                                                    bool vertex_colors = false,
                                                    bool material_and_texture = false)
 {
+  // Meshes with materials and textures are not cached, they refer to other resources
+  MeshCache& cache = MeshCache::getInstance();
+  std::string cache_key;
+  if (!material_and_texture && cache.isEnabled())
+  {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!data.empty())
+    {
+      std::string hint = boost::filesystem::path(path).extension().string();
+      if (!hint.empty())
+        hint = hint.substr(1);
+
+      cache_key = MeshCache::getKey(data, hint, scale, triangulate, flatten, normals, vertex_colors);
+      std::vector<MeshCacheData> cached;
+      if (cache.load(cache_key, cached))
+        return MeshCache::createMeshes<T>(cached, nullptr, scale);
+    }
+  }
+
   // Create an instance of the Importer class
   Assimp::Importer importer;
 
@@ -398,7 +423,12 @@ std::vector<std::shared_ptr<T>> createMeshFromPath(const std::string& path,
     importer.ApplyPostProcessing(aiProcess_OptimizeGraph);
   }
 
-  return createMeshFromAsset<T>(scene, scale, nullptr, normals, vertex_colors, material_and_texture);
+  std::vector<std::shared_ptr<T>> meshes =
+      createMeshFromAsset<T>(scene, scale, nullptr, normals, vertex_colors, material_and_texture);
+  if (!cache_key.empty() && !meshes.empty())
+    cache.store(cache_key, MeshCache::getData(meshes));
+
+  return meshes;
 }
 
 /**
@@ -441,7 +471,9 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract_common::Resourc
     }
   }
 
-  std::vector<uint8_t> data = resource->getResourceContents();
+  // The bytes are shared with other resources referring to the same file, they are not copied
+  std::shared_ptr<const std::vector<uint8_t>> shared_data = resource->getSharedResourceContents();
+  const std::vector<uint8_t>& data = *shared_data;
   if (data.empty())
   {
     if (resource->isFile())
@@ -451,6 +483,17 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract_common::Resourc
     return std::vector<std::shared_ptr<T>>();
   }
 
+  // Meshes with materials and textures are not cached, they refer to other resources
+  MeshCache& cache = MeshCache::getInstance();
+  std::string cache_key;
+  if (!material_and_texture && cache.isEnabled())
+  {
+    cache_key = MeshCache::getKey(data, hint_storage, scale, triangulate, flatten, normals, vertex_colors);
+    std::vector<MeshCacheData> cached;
+    if (cache.load(cache_key, cached))
+      return MeshCache::createMeshes<T>(cached, resource, scale);
+  }
+
   // Create an instance of the Importer class
   Assimp::Importer importer;
 
@@ -513,7 +556,54 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract_common::Resourc
     importer.ApplyPostProcessing(aiProcess_OptimizeGraph);
   }
 
-  return createMeshFromAsset<T>(scene, scale, resource, normals, vertex_colors, material_and_texture);
+  std::vector<std::shared_ptr<T>> meshes =
+      createMeshFromAsset<T>(scene, scale, resource, normals, vertex_colors, material_and_texture);
+  if (!cache_key.empty() && !meshes.empty())
+    cache.store(cache_key, MeshCache::getData(meshes));
+
+  return meshes;
+}
+
+/**
+ * @brief Create a mesh from a resource, sharing the meshes already loaded from the same resource
+ * @details The meshes are shared through the GeometryPool keyed by the resource URL, the scale and the load options,
+ * so a resource used by several links is only loaded once. A resource without a URL is always loaded.
+ * @param resource The resource
+ * @param scale Perform an axis scaling
+ * @param triangulate If true the mesh will be triangulated. This should be done for visual meshes.
+ *        In the case of collision meshes do not triangulate convex hull meshes.
+ * @param flatten If true all meshes will be condensed into a single mesh. This should only be used for visual meshes,
+ * do not flatten collision meshes.
+ * @param normals If true, loads mesh normals
+ * @param vertex_colors If true, loads mesh vertex colors
+ * @param material_and_texture If true, loads mesh materials and textures
+ * @return
+ */
+template <typename T>
+std::vector<std::shared_ptr<T>> createSharedMeshFromResource(tesseract_common::Resource::Ptr resource,
+                                                             const Eigen::Vector3d& scale = Eigen::Vector3d(1, 1, 1),
+                                                             bool triangulate = false,
+                                                             bool flatten = false,
+                                                             bool normals = false,
+                                                             bool vertex_colors = false,
+                                                             bool material_and_texture = false)
+{
+  if (!resource)
+    return std::vector<std::shared_ptr<T>>();
+
+  const std::string url = resource->getUrl();
+  if (url.empty())
+    return createMeshFromResource<T>(
+        resource, scale, triangulate, flatten, normals, vertex_colors, material_and_texture);
+
+  std::stringstream key;
+  key << std::setprecision(17) << url << " " << scale.x() << " " << scale.y() << " " << scale.z() << " "
+      << triangulate << flatten << normals << vertex_colors << material_and_texture;
+
+  return GeometryPool::getInstance().getMeshes<T>(key.str(), [&]() {
+    return createMeshFromResource<T>(
+        resource, scale, triangulate, flatten, normals, vertex_colors, material_and_texture);
+  });
 }
 
 /**
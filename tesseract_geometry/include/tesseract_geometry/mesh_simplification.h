@@ -0,0 +1,60 @@
+/**
+ * @file mesh_simplification.h
+ * @brief Simplification of triangle meshes within an error bound
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_GEOMETRY_MESH_SIMPLIFICATION_H
+#define TESSERACT_GEOMETRY_MESH_SIMPLIFICATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/impl/mesh.h>
+
+namespace tesseract_geometry
+{
+/**
+ * @brief Simplify a triangle mesh by clustering its vertices on a grid
+ * @details The vertices in each grid cell are merged into their mean and the triangles which collapse are removed. The
+ * cell size is chosen so every vertex moves at most max_error, so every point of the simplified mesh is within
+ * max_error of the original mesh. It runs in linear time, so it is suited to high resolution CAD meshes.
+ * @param mesh The triangle mesh
+ * @param max_error The maximum distance a vertex is moved
+ * @return The simplified mesh, or nullptr if the whole mesh collapses at this error
+ */
+Mesh::Ptr simplifyMesh(const Mesh& mesh, double max_error);
+
+/**
+ * @brief Create a chain of increasingly coarse simplifications of a triangle mesh
+ * @details Each level is simplified from the original mesh with the error bound of the level, so the errors do not
+ * accumulate. The chain stops at the first level where the mesh collapses or is not reduced further.
+ * @param mesh The triangle mesh
+ * @param max_errors The increasing error bound of each level
+ * @return The simplified meshes, starting with the finest
+ */
+std::vector<Mesh::Ptr> createMeshLODChain(const Mesh& mesh, const std::vector<double>& max_errors);
+
+}  // namespace tesseract_geometry
+
+#endif  // TESSERACT_GEOMETRY_MESH_SIMPLIFICATION_H
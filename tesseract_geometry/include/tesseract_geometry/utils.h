@@ -111,6 +111,9 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
       if (s1.getFaceCount() != s2.getFaceCount())
         return false;
 
+      if (s1.getHash() != s2.getHash())
+        return false;
+
       break;
     }
     case GeometryType::CONVEX_MESH:
@@ -124,6 +127,9 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
       if (s1.getFaceCount() != s2.getFaceCount())
         return false;
 
+      if (s1.getHash() != s2.getHash())
+        return false;
+
       break;
     }
     case GeometryType::SDF_MESH:
@@ -137,6 +143,9 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
       if (s1.getFaceCount() != s2.getFaceCount())
         return false;
 
+      if (s1.getHash() != s2.getHash())
+        return false;
+
       break;
     }
     case GeometryType::OCTREE:
@@ -175,6 +184,9 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
       if (s1.getFaceCount() != s2.getFaceCount())
         return false;
 
+      if (s1.getHash() != s2.getHash())
+        return false;
+
       break;
     }
     default:
@@ -186,5 +198,75 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
 
   return true;
 }
+
+/**
+ * @brief Calculate the radius of a sphere about the geometry origin which contains the geometry
+ * @details The radius is not necessarily the smallest, an octree is bounded by all of its nodes
+ * @param geom The geometry
+ * @return The radius, infinity for a plane
+ */
+inline double calcBoundingSphereRadius(const Geometry& geom)
+{
+  switch (geom.getType())
+  {
+    case GeometryType::BOX:
+    {
+      const Box& s = static_cast<const Box&>(geom);
+      return 0.5 * Eigen::Vector3d(s.getX(), s.getY(), s.getZ()).norm();
+    }
+    case GeometryType::SPHERE:
+      return static_cast<const Sphere&>(geom).getRadius();
+    case GeometryType::CYLINDER:
+    {
+      const Cylinder& s = static_cast<const Cylinder&>(geom);
+      return std::hypot(s.getRadius(), s.getLength() / 2.0);
+    }
+    case GeometryType::CONE:
+    {
+      const Cone& s = static_cast<const Cone&>(geom);
+      return std::hypot(s.getRadius(), s.getLength() / 2.0);
+    }
+    case GeometryType::CAPSULE:
+    {
+      const Capsule& s = static_cast<const Capsule&>(geom);
+      return s.getRadius() + (s.getLength() / 2.0);
+    }
+    case GeometryType::MESH:
+    case GeometryType::CONVEX_MESH:
+    case GeometryType::SDF_MESH:
+    case GeometryType::POLYGON_MESH:
+    {
+      double radius{ 0 };
+      for (const auto& v : *static_cast<const PolygonMesh&>(geom).getVertices())
+        radius = std::max(radius, v.norm());
+
+      return radius;
+    }
+    case GeometryType::OCTREE:
+    {
+      const std::shared_ptr<const octomap::OcTree>& octree = static_cast<const Octree&>(geom).getOctree();
+      Eigen::Vector3d min, max;
+      octree->getMetricMin(min.x(), min.y(), min.z());
+      octree->getMetricMax(max.x(), max.y(), max.z());
+      return min.cwiseAbs().cwiseMax(max.cwiseAbs()).norm();
+    }
+    case GeometryType::POINT_CLOUD:
+    {
+      const PointCloud& s = static_cast<const PointCloud&>(geom);
+      double radius{ 0 };
+      for (const auto& p : *s.getPoints())
+        radius = std::max(radius, p.norm());
+
+      return radius + s.getPointRadius();
+    }
+    case GeometryType::PLANE:
+      return std::numeric_limits<double>::infinity();
+    default:
+    {
+      CONSOLE_BRIDGE_logError("This geometric shape type (%d) is not supported", static_cast<int>(geom.getType()));
+      return std::numeric_limits<double>::infinity();
+    }
+  }
+}
 }  // namespace tesseract_geometry
 #endif
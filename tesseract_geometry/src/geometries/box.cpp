@@ -27,6 +27,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -46,6 +47,15 @@ bool Box::operator==(const Box& rhs) const
 }
 bool Box::operator!=(const Box& rhs) const { return !operator==(rhs); }
 
+std::size_t Box::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<double>()(x_));
+  hashCombine(seed, std::hash<double>()(y_));
+  hashCombine(seed, std::hash<double>()(z_));
+  return seed;
+}
+
 template <class Archive>
 void Box::serialize(Archive& ar, const unsigned int /*version*/)
 {
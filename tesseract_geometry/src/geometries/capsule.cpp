@@ -27,6 +27,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -45,6 +46,14 @@ bool Capsule::operator==(const Capsule& rhs) const
 }
 bool Capsule::operator!=(const Capsule& rhs) const { return !operator==(rhs); }
 
+std::size_t Capsule::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<double>()(r_));
+  hashCombine(seed, std::hash<double>()(l_));
+  return seed;
+}
+
 template <class Archive>
 void Capsule::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -24,19 +24,222 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/binary_object.hpp>
 #include <boost/serialization/split_member.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <type_traits>
+#include <unordered_set>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/compact_serialization.h>
+#include <tesseract_common/executor.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_geometry/impl/octree.h>
 
 namespace tesseract_geometry
 {
+namespace
+{
+/** @brief Clouds smaller than this are converted to leaf keys on the calling thread */
+const std::size_t PARALLEL_INSERT_MIN_SIZE = 65536;
+
+/** @brief The number of bits of each coordinate of an octree key */
+const unsigned int KEY_BITS = 16;
+
+/** @brief Interleave the bits of an octree key, so sorting by the code visits the leaves in depth first order */
+uint64_t getMortonCode(const octomap::OcTreeKey& key)
+{
+  uint64_t code{ 0 };
+  for (unsigned int bit = 0; bit < KEY_BITS; ++bit)
+  {
+    for (unsigned int axis = 0; axis < 3; ++axis)
+      code |= static_cast<uint64_t>((key[axis] >> bit) & 1U) << ((3 * bit) + axis);
+  }
+  return code;
+}
+
+/** @brief Get the octree key of a Morton code */
+octomap::OcTreeKey getMortonKey(uint64_t code)
+{
+  octomap::OcTreeKey key(0, 0, 0);
+  for (unsigned int bit = 0; bit < KEY_BITS; ++bit)
+  {
+    for (unsigned int axis = 0; axis < 3; ++axis)
+      key[axis] |= static_cast<octomap::key_type>(((code >> ((3 * bit) + axis)) & 1U) << bit);
+  }
+  return key;
+}
+}  // namespace
+
+void Octree::insertPoints(octomap::OcTree& octree, const tesseract_common::VectorVector3d& points)
+{
+  // Points outside of the octree bounds get a code which sorts after every valid code
+  const uint64_t invalid_code = std::numeric_limits<uint64_t>::max();
+  std::vector<uint64_t> codes(points.size());
+  auto compute_codes = [&octree, &points, &codes, invalid_code](std::size_t begin, std::size_t end) {
+    octomap::OcTreeKey key;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const Eigen::Vector3d& p = points[i];
+      codes[i] = octree.coordToKeyChecked(p.x(), p.y(), p.z(), key) ? getMortonCode(key) : invalid_code;
+    }
+  };
+
+  tesseract_common::Executor::Ptr executor = tesseract_common::getDefaultExecutor();
+  const std::size_t threads = executor->getConcurrency();
+  if (points.size() < PARALLEL_INSERT_MIN_SIZE || threads == 1)
+  {
+    compute_codes(0, points.size());
+  }
+  else
+  {
+    const std::size_t chunk = (points.size() + threads - 1) / threads;
+    executor->parallelFor((points.size() + chunk - 1) / chunk, [&](std::size_t i) {
+      compute_codes(i * chunk, std::min((i + 1) * chunk, points.size()));
+    });
+  }
+
+  std::sort(codes.begin(), codes.end());
+
+  // The octree nodes are not thread safe, so the leaves are inserted serially once per voxel
+  const float hit = octree.getProbHitLog();
+  for (std::size_t i = 0; i < codes.size() && codes[i] != invalid_code;)
+  {
+    std::size_t j = i + 1;
+    while (j < codes.size() && codes[j] == codes[i])
+      ++j;
+
+    octree.updateNode(getMortonKey(codes[i]), static_cast<float>(j - i) * hit, true);
+    i = j;
+  }
+}
+
+void Octree::finalize(octomap::OcTree& octree, bool prune, bool binary)
+{
+  // Per the documentation for updateNode with lazy_eval enabled this must be called after all points are added
+  octree.updateInnerOccupancy();
+  if (binary)
+  {
+    octree.toMaxLikelihood();
+    binary_octree_ = binary;
+  }
+
+  if (prune)
+  {
+    tesseract_geometry::Octree::prune(octree);
+    pruned_ = prune;
+  }
+}
+
+std::vector<Eigen::AlignedBox3d> Octree::getMergedBoxes(const octomap::OcTree& octree)
+{
+  // A cell at the finest depth is identified by its key packed as x | y << 16 | z << 32, so the packed keys sort by z,
+  // then y, then x
+  auto pack = [](uint64_t x, uint64_t y, uint64_t z) { return x | (y << KEY_BITS) | (z << (2 * KEY_BITS)); };
+  const uint64_t key_mask = (uint64_t(1) << KEY_BITS) - 1;
+  const uint64_t max_key = key_mask;
+
+  const double resolution = octree.getResolution();
+  const double occupancy_threshold = octree.getOccupancyThres();
+  const unsigned int tree_depth = octree.getTreeDepth();
+  std::vector<Eigen::AlignedBox3d> boxes;
+  std::vector<uint64_t> cells;
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold)
+      continue;
+
+    const Eigen::Vector3d center(it.getX(), it.getY(), it.getZ());
+    if (it.getDepth() < tree_depth)
+    {
+      // A pruned leaf is already a large box
+      const Eigen::Vector3d half_size = Eigen::Vector3d::Constant(it.getSize() / 2.0);
+      boxes.emplace_back(center - half_size, center + half_size);
+      continue;
+    }
+
+    const octomap::OcTreeKey key = it.getKey();
+    cells.push_back(pack(key[0], key[1], key[2]));
+  }
+  std::sort(cells.begin(), cells.end());
+
+  const std::unordered_set<uint64_t> occupied(cells.begin(), cells.end());
+  std::unordered_set<uint64_t> covered;
+  covered.reserve(cells.size());
+  auto is_uncovered = [&occupied, &covered](uint64_t cell) {
+    return occupied.count(cell) > 0 && covered.count(cell) == 0;
+  };
+
+  for (uint64_t cell : cells)
+  {
+    if (covered.count(cell) > 0)
+      continue;
+
+    const uint64_t x0 = cell & key_mask;
+    const uint64_t y0 = (cell >> KEY_BITS) & key_mask;
+    const uint64_t z0 = cell >> (2 * KEY_BITS);
+
+    uint64_t x1 = x0;
+    while (x1 < max_key && is_uncovered(pack(x1 + 1, y0, z0)))
+      ++x1;
+
+    auto is_uncovered_row = [&](uint64_t y, uint64_t z) {
+      for (uint64_t x = x0; x <= x1; ++x)
+      {
+        if (!is_uncovered(pack(x, y, z)))
+          return false;
+      }
+      return true;
+    };
+
+    uint64_t y1 = y0;
+    while (y1 < max_key && is_uncovered_row(y1 + 1, z0))
+      ++y1;
+
+    auto is_uncovered_layer = [&](uint64_t z) {
+      for (uint64_t y = y0; y <= y1; ++y)
+      {
+        if (!is_uncovered_row(y, z))
+          return false;
+      }
+      return true;
+    };
+
+    uint64_t z1 = z0;
+    while (z1 < max_key && is_uncovered_layer(z1 + 1))
+      ++z1;
+
+    for (uint64_t z = z0; z <= z1; ++z)
+    {
+      for (uint64_t y = y0; y <= y1; ++y)
+      {
+        for (uint64_t x = x0; x <= x1; ++x)
+          covered.insert(pack(x, y, z));
+      }
+    }
+
+    const double half = resolution / 2.0;
+    const Eigen::Vector3d min(octree.keyToCoord(static_cast<octomap::key_type>(x0)) - half,
+                              octree.keyToCoord(static_cast<octomap::key_type>(y0)) - half,
+                              octree.keyToCoord(static_cast<octomap::key_type>(z0)) - half);
+    const Eigen::Vector3d max(octree.keyToCoord(static_cast<octomap::key_type>(x1)) + half,
+                              octree.keyToCoord(static_cast<octomap::key_type>(y1)) + half,
+                              octree.keyToCoord(static_cast<octomap::key_type>(z1)) + half);
+    boxes.emplace_back(min, max);
+  }
+
+  return boxes;
+}
+
 bool Octree::operator==(const Octree& rhs) const
 {
   using namespace tesseract_common;
@@ -46,6 +249,7 @@ bool Octree::operator==(const Octree& rhs) const
   equal &= sub_type_ == rhs.sub_type_;
   equal &= pruned_ == rhs.pruned_;
   equal &= resolution_ == rhs.resolution_;
+  equal &= almostEqualRelativeAndAbs(distance_tolerance_, rhs.distance_tolerance_);
 
   // octree_ == rhs.octree_ looks for exact double equality
   equal &= octree_->getTreeDepth() == rhs.octree_->getTreeDepth();                             // tree_depth
@@ -73,6 +277,21 @@ bool Octree::operator==(const Octree& rhs) const
 }
 bool Octree::operator!=(const Octree& rhs) const { return !operator==(rhs); }
 
+void Octree::addMemoryUsage(tesseract_common::MemoryUsage& usage, tesseract_common::MemoryUsageTracker& tracker) const
+{
+  usage.unique_bytes += sizeof(Octree);
+  if (octree_ != nullptr)
+    tracker.count(usage, octree_, octree_->memoryUsage());
+}
+
+std::size_t Octree::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<int>()(static_cast<int>(sub_type_)));
+  hashCombine(seed, std::hash<double>()(resolution_));
+  return seed;
+}
+
 template <class Archive>
 void Octree::save(Archive& ar, const unsigned int /*version*/) const
 {
@@ -82,6 +301,7 @@ void Octree::save(Archive& ar, const unsigned int /*version*/) const
   ar& BOOST_SERIALIZATION_NVP(resolution_);
   ar& BOOST_SERIALIZATION_NVP(pruned_);
   ar& BOOST_SERIALIZATION_NVP(binary_octree_);
+  ar& BOOST_SERIALIZATION_NVP(distance_tolerance_);
 
   // Read the data to a stream which does not guarantee contiguous memory
   std::ostringstream s;
@@ -92,13 +312,21 @@ void Octree::save(Archive& ar, const unsigned int /*version*/) const
 
   // Write it to a string, wich does guarantee contiguous memory
   std::string data_string = s.str();
-  std::size_t octree_data_size = data_string.size();
-  ar& make_nvp("octree_data_size", octree_data_size);
-  ar& make_nvp("octree_data", make_binary_object(data_string.data(), octree_data_size));
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Binary archives are used to transfer environments, so the octree data is stored compressed
+    tesseract_common::saveCompressed(ar, std::vector<uint8_t>(data_string.begin(), data_string.end()));
+  }
+  else
+  {
+    std::size_t octree_data_size = data_string.size();
+    ar& make_nvp("octree_data_size", octree_data_size);
+    ar& make_nvp("octree_data", make_binary_object(data_string.data(), octree_data_size));
+  }
 }
 
 template <class Archive>
-void Octree::load(Archive& ar, const unsigned int /*version*/)
+void Octree::load(Archive& ar, const unsigned int version)
 {
   using namespace boost::serialization;
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
@@ -106,20 +334,36 @@ void Octree::load(Archive& ar, const unsigned int /*version*/)
   ar& BOOST_SERIALIZATION_NVP(resolution_);
   ar& BOOST_SERIALIZATION_NVP(pruned_);
   ar& BOOST_SERIALIZATION_NVP(binary_octree_);
+  if (version > 1)
+    ar& BOOST_SERIALIZATION_NVP(distance_tolerance_);
 
   // Initialize the octree to the right size
   auto local_octree = std::make_shared<octomap::OcTree>(resolution_);
 
   // Read the data into a string
-  std::size_t octree_data_size = 0;
-  ar& make_nvp("octree_data_size", octree_data_size);
   std::string data_string;
-  data_string.resize(octree_data_size);
-  ar& make_nvp("octree_data", make_binary_object(data_string.data(), octree_data_size));
+  bool compressed{ false };
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+    {
+      std::vector<uint8_t> data = tesseract_common::loadCompressed(ar);
+      data_string.assign(data.begin(), data.end());
+      compressed = true;
+    }
+  }
+
+  if (!compressed)
+  {
+    std::size_t octree_data_size = 0;
+    ar& make_nvp("octree_data_size", octree_data_size);
+    data_string.resize(octree_data_size);
+    ar& make_nvp("octree_data", make_binary_object(data_string.data(), octree_data_size));
+  }
 
   // Write that data into the stringstream required by octree and load data
   std::stringstream s;
-  s.write(data_string.data(), static_cast<std::streamsize>(octree_data_size));
+  s.write(data_string.data(), static_cast<std::streamsize>(data_string.size()));
 
   if (binary_octree_)
     local_octree->readBinary(s);
@@ -27,6 +27,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -47,6 +48,16 @@ bool Plane::operator==(const Plane& rhs) const
 }
 bool Plane::operator!=(const Plane& rhs) const { return !operator==(rhs); }
 
+std::size_t Plane::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<double>()(a_));
+  hashCombine(seed, std::hash<double>()(b_));
+  hashCombine(seed, std::hash<double>()(c_));
+  hashCombine(seed, std::hash<double>()(d_));
+  return seed;
+}
+
 template <class Archive>
 void Plane::serialize(Archive& ar, const unsigned int /*version*/)
 {
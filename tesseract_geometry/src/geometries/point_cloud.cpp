@@ -0,0 +1,171 @@
+/**
+ * @file point_cloud.cpp
+ * @brief Tesseract Point Cloud Geometry
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/utils.h>
+#include <tesseract_geometry/impl/point_cloud.h>
+
+namespace tesseract_geometry
+{
+namespace
+{
+/** @brief The integer coordinates of a voxel */
+struct VoxelKey
+{
+  long x{ 0 };
+  long y{ 0 };
+  long z{ 0 };
+
+  bool operator==(const VoxelKey& rhs) const { return x == rhs.x && y == rhs.y && z == rhs.z; }
+};
+
+struct VoxelKeyHash
+{
+  std::size_t operator()(const VoxelKey& key) const
+  {
+    // Large primes spread neighboring voxels over the buckets
+    return static_cast<std::size_t>(key.x) * 73856093UL ^ static_cast<std::size_t>(key.y) * 19349663UL ^
+           static_cast<std::size_t>(key.z) * 83492791UL;
+  }
+};
+}  // namespace
+
+PointCloud::PointCloud(std::shared_ptr<const tesseract_common::VectorVector3d> points, double point_radius)
+  : Geometry(GeometryType::POINT_CLOUD), points_(std::move(points)), point_radius_(point_radius)
+{
+  if (points_ == nullptr)
+    throw std::runtime_error("PointCloud, the points must not be null");
+
+  if (!(point_radius_ > 0))
+    throw std::runtime_error("PointCloud, the point radius must be greater than zero");
+}
+
+bool PointCloud::operator==(const PointCloud& rhs) const
+{
+  bool equal = true;
+  equal &= Geometry::operator==(rhs);
+  equal &= tesseract_common::almostEqualRelativeAndAbs(point_radius_, rhs.point_radius_);
+  equal &= getPointCount() == rhs.getPointCount();
+  if (!equal || getHash() != rhs.getHash())
+    return false;
+
+  if (points_ != rhs.points_)
+  {
+    if (points_ == nullptr || rhs.points_ == nullptr || *points_ != *rhs.points_)
+      return false;
+  }
+
+  return true;
+}
+bool PointCloud::operator!=(const PointCloud& rhs) const { return !operator==(rhs); }
+
+void PointCloud::addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                                tesseract_common::MemoryUsageTracker& tracker) const
+{
+  usage.unique_bytes += sizeof(PointCloud);
+  if (points_ != nullptr)
+    tracker.count(usage, points_, tesseract_common::getVectorBytes(*points_));
+}
+
+std::size_t PointCloud::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<double>()(point_radius_));
+  if (points_ != nullptr)
+  {
+    for (const auto& point : *points_)
+    {
+      for (Eigen::Index i = 0; i < 3; ++i)
+        hashCombine(seed, std::hash<double>()(point[i]));
+    }
+  }
+
+  return seed;
+}
+
+std::shared_ptr<const tesseract_common::VectorVector3d>
+PointCloud::voxelDownsample(const tesseract_common::VectorVector3d& points, double resolution)
+{
+  if (!(resolution > 0))
+    return std::make_shared<const tesseract_common::VectorVector3d>(points);
+
+  // The sum of the points of each voxel and the number of points, in the order the voxels are reached
+  tesseract_common::VectorVector3d sums;
+  std::vector<std::size_t> counts;
+  std::unordered_map<VoxelKey, std::size_t, VoxelKeyHash> voxels;
+  voxels.reserve(points.size());
+
+  const double scale = 1.0 / resolution;
+  for (const auto& point : points)
+  {
+    const VoxelKey key{ static_cast<long>(std::floor(point.x() * scale)),
+                        static_cast<long>(std::floor(point.y() * scale)),
+                        static_cast<long>(std::floor(point.z() * scale)) };
+
+    auto it = voxels.find(key);
+    if (it == voxels.end())
+    {
+      voxels.emplace(key, sums.size());
+      sums.push_back(point);
+      counts.push_back(1);
+    }
+    else
+    {
+      sums[it->second] += point;
+      ++counts[it->second];
+    }
+  }
+
+  for (std::size_t i = 0; i < sums.size(); ++i)
+    sums[i] /= static_cast<double>(counts[i]);
+
+  return std::make_shared<const tesseract_common::VectorVector3d>(std::move(sums));
+}
+
+template <class Archive>
+void PointCloud::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
+  ar& BOOST_SERIALIZATION_NVP(points_);
+  ar& BOOST_SERIALIZATION_NVP(point_radius_);
+}
+}  // namespace tesseract_geometry
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_geometry::PointCloud)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_geometry::PointCloud)
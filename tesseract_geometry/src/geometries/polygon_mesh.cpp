@@ -25,21 +25,106 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <cassert>
+#include <functional>
 #include <memory>
+#include <type_traits>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/compact_serialization.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_common/eigen_serialization.h>
 #include <tesseract_geometry/impl/polygon_mesh.h>
 
 namespace tesseract_geometry
 {
+namespace
+{
+/** @brief Save an array of points, which may be null, as compressed bytes */
+template <class Archive, class PointVector>
+void saveCompressedPoints(Archive& ar, const std::shared_ptr<const PointVector>& points)
+{
+  using Point = typename PointVector::value_type;
+  bool valid = (points != nullptr);
+  ar& BOOST_SERIALIZATION_NVP(valid);
+  if (!valid)
+    return;
+
+  std::size_t count = points->size();
+  ar& BOOST_SERIALIZATION_NVP(count);
+  tesseract_common::saveCompressed(
+      ar,
+      tesseract_common::encodeDoubles(reinterpret_cast<const double*>(points->data()),
+                                      count * Point::RowsAtCompileTime,
+                                      Point::RowsAtCompileTime));
+}
+
+/** @brief Load an array of points saved with saveCompressedPoints */
+template <class Archive, class PointVector>
+void loadCompressedPoints(Archive& ar, std::shared_ptr<const PointVector>& points)
+{
+  using Point = typename PointVector::value_type;
+  bool valid{ false };
+  ar& BOOST_SERIALIZATION_NVP(valid);
+  if (!valid)
+  {
+    points = nullptr;
+    return;
+  }
+
+  std::size_t count{ 0 };
+  ar& BOOST_SERIALIZATION_NVP(count);
+  auto loaded = std::make_shared<PointVector>(count);
+  tesseract_common::decodeDoubles(tesseract_common::loadCompressed(ar),
+                                  reinterpret_cast<double*>(loaded->data()),
+                                  count * Point::RowsAtCompileTime,
+                                  Point::RowsAtCompileTime);
+  points = loaded;
+}
+
+/** @brief Save an array of indices, which may be null, as compressed bytes */
+template <class Archive>
+void saveCompressedIndices(Archive& ar, const std::shared_ptr<const Eigen::VectorXi>& indices)
+{
+  bool valid = (indices != nullptr);
+  ar& BOOST_SERIALIZATION_NVP(valid);
+  if (!valid)
+    return;
+
+  auto count = static_cast<std::size_t>(indices->size());
+  ar& BOOST_SERIALIZATION_NVP(count);
+  tesseract_common::saveCompressed(ar, tesseract_common::encodeDeltaIntegers(indices->data(), count));
+}
+
+/** @brief Load an array of indices saved with saveCompressedIndices */
+template <class Archive>
+void loadCompressedIndices(Archive& ar, std::shared_ptr<const Eigen::VectorXi>& indices)
+{
+  bool valid{ false };
+  ar& BOOST_SERIALIZATION_NVP(valid);
+  if (!valid)
+  {
+    indices = nullptr;
+    return;
+  }
+
+  std::size_t count{ 0 };
+  ar& BOOST_SERIALIZATION_NVP(count);
+  auto loaded = std::make_shared<Eigen::VectorXi>(static_cast<Eigen::Index>(count));
+  tesseract_common::decodeDeltaIntegers(tesseract_common::loadCompressed(ar), loaded->data(), count);
+  indices = loaded;
+}
+}  // namespace
+
 bool PolygonMesh::operator==(const PolygonMesh& rhs) const
 {
   bool equal = true;
@@ -47,15 +132,146 @@ bool PolygonMesh::operator==(const PolygonMesh& rhs) const
   equal &= vertex_count_ == rhs.vertex_count_;
   equal &= face_count_ == rhs.face_count_;
   equal &= tesseract_common::almostEqualRelativeAndAbs(scale_, rhs.scale_);
-  /// @todo Finish PolygonMesh == operator
-  return equal;
+  if (!equal || getHash() != rhs.getHash())
+    return false;
+
+  if (vertices_ != rhs.vertices_)
+  {
+    if (vertices_ == nullptr || rhs.vertices_ == nullptr || *vertices_ != *rhs.vertices_)
+      return false;
+  }
+
+  if (faces_ != rhs.faces_)
+  {
+    if (faces_ == nullptr || rhs.faces_ == nullptr || faces_->size() != rhs.faces_->size() || *faces_ != *rhs.faces_)
+      return false;
+  }
+
+  return true;
 }
 bool PolygonMesh::operator!=(const PolygonMesh& rhs) const { return !operator==(rhs); }
 
+void PolygonMesh::addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                                 tesseract_common::MemoryUsageTracker& tracker) const
+{
+  usage.unique_bytes += sizeof(PolygonMesh);
+  if (vertices_ != nullptr)
+    tracker.count(usage, vertices_, tesseract_common::getVectorBytes(*vertices_));
+
+  if (faces_ != nullptr)
+    tracker.count(usage, faces_, static_cast<std::size_t>(faces_->size()) * sizeof(int));
+
+  if (normals_ != nullptr)
+    tracker.count(usage, normals_, tesseract_common::getVectorBytes(*normals_));
+
+  if (vertex_colors_ != nullptr)
+    tracker.count(usage, vertex_colors_, tesseract_common::getVectorBytes(*vertex_colors_));
+
+  tracker.count(usage, mesh_material_, sizeof(MeshMaterial));
+}
+
+std::size_t PolygonMesh::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  if (vertices_ != nullptr)
+  {
+    for (const auto& vertex : *vertices_)
+    {
+      for (Eigen::Index i = 0; i < 3; ++i)
+        hashCombine(seed, std::hash<double>()(vertex[i]));
+    }
+  }
+
+  if (faces_ != nullptr)
+  {
+    for (Eigen::Index i = 0; i < faces_->size(); ++i)
+      hashCombine(seed, std::hash<int>()((*faces_)[i]));
+  }
+
+  return seed;
+}
+
+PolygonMesh::VertexMap PolygonMesh::getVertexMap() const
+{
+  // The vertices are stored without padding, so they can be viewed as the columns of a matrix
+  static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double), "Eigen::Vector3d must not be padded");
+  if (vertices_ == nullptr || vertices_->empty())
+    return { nullptr, 3, 0 };
+
+  return { vertices_->front().data(), 3, static_cast<Eigen::Index>(vertices_->size()) };
+}
+
+bool PolygonMesh::isTriangleMesh() const
+{
+  if (faces_ == nullptr || faces_->size() != 4L * face_count_)
+    return false;
+
+  for (Eigen::Index i = 0; i < faces_->size(); i += 4)
+  {
+    if ((*faces_)[i] != 3)
+      return false;
+  }
+  return true;
+}
+
+PolygonMesh::TriangleMap PolygonMesh::getTriangleMap() const
+{
+  if (faces_ == nullptr || face_count_ == 0)
+    return { nullptr, 3, 0 };
+
+  assert(isTriangleMesh());
+  return { faces_->data() + 1, 3, face_count_ };
+}
+
 template <class Archive>
-void PolygonMesh::serialize(Archive& ar, const unsigned int /*version*/)
+void PolygonMesh::save(Archive& ar, const unsigned int /*version*/) const
 {
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Binary archives are used to transfer environments, so the large arrays are stored compressed
+    saveCompressedPoints(ar, vertices_);
+    saveCompressedIndices(ar, faces_);
+    ar& BOOST_SERIALIZATION_NVP(vertex_count_);
+    ar& BOOST_SERIALIZATION_NVP(face_count_);
+    ar& BOOST_SERIALIZATION_NVP(scale_);
+    saveCompressedPoints(ar, normals_);
+    saveCompressedPoints(ar, vertex_colors_);
+  }
+  else
+  {
+    ar& BOOST_SERIALIZATION_NVP(vertices_);
+    ar& BOOST_SERIALIZATION_NVP(faces_);
+    ar& BOOST_SERIALIZATION_NVP(vertex_count_);
+    ar& BOOST_SERIALIZATION_NVP(face_count_);
+    ar& BOOST_SERIALIZATION_NVP(scale_);
+    ar& BOOST_SERIALIZATION_NVP(normals_);
+    ar& BOOST_SERIALIZATION_NVP(vertex_colors_);
+  }
+  /// @todo Serialize mesh materials and textures
+  //    ar& BOOST_SERIALIZATION_NVP(mesh_material_);
+  //    ar& BOOST_SERIALIZATION_NVP(mesh_textures_);
+}
+
+template <class Archive>
+void PolygonMesh::load(Archive& ar, const unsigned int version)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Geometry);
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+    {
+      loadCompressedPoints(ar, vertices_);
+      loadCompressedIndices(ar, faces_);
+      ar& BOOST_SERIALIZATION_NVP(vertex_count_);
+      ar& BOOST_SERIALIZATION_NVP(face_count_);
+      ar& BOOST_SERIALIZATION_NVP(scale_);
+      loadCompressedPoints(ar, normals_);
+      loadCompressedPoints(ar, vertex_colors_);
+      return;
+    }
+  }
+
   ar& BOOST_SERIALIZATION_NVP(vertices_);
   ar& BOOST_SERIALIZATION_NVP(faces_);
   ar& BOOST_SERIALIZATION_NVP(vertex_count_);
@@ -63,12 +279,15 @@ void PolygonMesh::serialize(Archive& ar, const unsigned int /*version*/)
   ar& BOOST_SERIALIZATION_NVP(scale_);
   ar& BOOST_SERIALIZATION_NVP(normals_);
   ar& BOOST_SERIALIZATION_NVP(vertex_colors_);
-  /// @todo Serialize mesh materials and textures
-  //    ar& BOOST_SERIALIZATION_NVP(mesh_material_);
-  //    ar& BOOST_SERIALIZATION_NVP(mesh_textures_);
+}
+
+template <class Archive>
+void PolygonMesh::serialize(Archive& ar, const unsigned int version)
+{
+  boost::serialization::split_member(ar, *this, version);
 }
 }  // namespace tesseract_geometry
 
 #include <tesseract_common/serialization.h>
-TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_geometry::PolygonMesh)
+TESSERACT_SERIALIZE_SAVE_LOAD_ARCHIVES_INSTANTIATE(tesseract_geometry::PolygonMesh)
 BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_geometry::PolygonMesh)
@@ -27,6 +27,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -44,6 +45,13 @@ bool Sphere::operator==(const Sphere& rhs) const
 }
 bool Sphere::operator!=(const Sphere& rhs) const { return !operator==(rhs); }
 
+std::size_t Sphere::computeHash() const
+{
+  std::size_t seed = Geometry::computeHash();
+  hashCombine(seed, std::hash<double>()(r_));
+  return seed;
+}
+
 template <class Archive>
 void Sphere::serialize(Archive& ar, const unsigned int /*version*/)
 {
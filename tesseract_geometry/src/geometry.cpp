@@ -27,6 +27,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -34,6 +35,58 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_geometry
 {
+// The content of a copy is the same, so the cached hash is copied along
+Geometry::Geometry(const Geometry& other) : type_(other.type_), hash_(other.hash_.load()) {}
+
+Geometry& Geometry::operator=(const Geometry& other)
+{
+  type_ = other.type_;
+  hash_ = other.hash_.load();
+  return *this;
+}
+
+Geometry::Geometry(Geometry&& other) noexcept : type_(other.type_), hash_(other.hash_.load()) {}
+
+Geometry& Geometry::operator=(Geometry&& other) noexcept
+{
+  type_ = other.type_;
+  hash_ = other.hash_.load();
+  return *this;
+}
+
+std::size_t Geometry::getHash() const
+{
+  std::size_t hash = hash_.load();
+  if (hash == 0)
+  {
+    // Several threads may compute the hash at the same time, they all store the same value
+    hash = computeHash();
+    if (hash == 0)
+      hash = 1;
+
+    hash_ = hash;
+  }
+  return hash;
+}
+
+std::size_t Geometry::computeHash() const { return std::hash<int>()(static_cast<int>(type_)); }
+
+tesseract_common::MemoryUsage Geometry::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage(GeometryTypeStrings[static_cast<std::size_t>(type_)]);
+  if (tracker.visit(this))
+    addMemoryUsage(usage, tracker);
+
+  return usage;
+}
+
+void Geometry::addMemoryUsage(tesseract_common::MemoryUsage& usage,
+                              tesseract_common::MemoryUsageTracker& /*tracker*/) const
+{
+  // The primitives only hold a few parameters
+  usage.unique_bytes += sizeof(Geometry) + 4 * sizeof(double);
+}
+
 bool Geometry::operator==(const Geometry& rhs) const
 {
   bool equal = true;
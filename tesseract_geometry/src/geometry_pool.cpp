@@ -0,0 +1,238 @@
+/**
+ * @file geometry_pool.cpp
+ * @brief A process wide pool sharing identical meshes
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/geometry_pool.h>
+#include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_geometry/impl/polygon_mesh.h>
+
+namespace tesseract_geometry
+{
+namespace
+{
+bool isPolygonMesh(const Geometry& geometry)
+{
+  switch (geometry.getType())
+  {
+    case GeometryType::MESH:
+    case GeometryType::CONVEX_MESH:
+    case GeometryType::SDF_MESH:
+    case GeometryType::POLYGON_MESH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+bool isContentEqual(const std::shared_ptr<const T>& data1, const std::shared_ptr<const T>& data2)
+{
+  if (data1 == data2)
+    return true;
+
+  if (data1 == nullptr || data2 == nullptr || data1->size() != data2->size())
+    return false;
+
+  return std::equal(data1->begin(), data1->end(), data2->begin());
+}
+
+bool isContentEqual(const std::shared_ptr<const Eigen::VectorXi>& faces1,
+                    const std::shared_ptr<const Eigen::VectorXi>& faces2)
+{
+  if (faces1 == faces2)
+    return true;
+
+  if (faces1 == nullptr || faces2 == nullptr || faces1->size() != faces2->size())
+    return false;
+
+  return (*faces1 == *faces2);
+}
+
+/** @brief Check if two meshes are interchangeable, the material and textures are compared by address */
+bool isContentEqual(const PolygonMesh& mesh1, const PolygonMesh& mesh2)
+{
+  if (mesh1.getType() != mesh2.getType() || mesh1.getScale() != mesh2.getScale())
+    return false;
+
+  if (mesh1.getMaterial() != mesh2.getMaterial() || mesh1.getTextures() != mesh2.getTextures())
+    return false;
+
+  const tesseract_common::Resource::ConstPtr& resource1 = mesh1.getResource();
+  const tesseract_common::Resource::ConstPtr& resource2 = mesh2.getResource();
+  if ((resource1 == nullptr) != (resource2 == nullptr))
+    return false;
+
+  if (resource1 != nullptr && resource1 != resource2 && resource1->getUrl() != resource2->getUrl())
+    return false;
+
+  if (mesh1.getType() == GeometryType::CONVEX_MESH &&
+      static_cast<const ConvexMesh&>(mesh1).getCreationMethod() !=
+          static_cast<const ConvexMesh&>(mesh2).getCreationMethod())
+    return false;
+
+  return isContentEqual(mesh1.getVertices(), mesh2.getVertices()) &&
+         isContentEqual(mesh1.getFaces(), mesh2.getFaces()) &&
+         isContentEqual(mesh1.getNormals(), mesh2.getNormals()) &&
+         isContentEqual(mesh1.getVertexColors(), mesh2.getVertexColors());
+}
+}  // namespace
+
+GeometryPool& GeometryPool::getInstance()
+{
+  static GeometryPool pool;
+  return pool;
+}
+
+Geometry::Ptr GeometryPool::intern(const Geometry::Ptr& geometry)
+{
+  if (geometry == nullptr || !isPolygonMesh(*geometry))
+    return geometry;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = addresses_.find(geometry.get());
+    if (it != addresses_.end() && it->second.lock() == geometry)
+      return geometry;
+  }
+
+  const auto& mesh = static_cast<const PolygonMesh&>(*geometry);
+  const std::size_t hash = mesh.getHash();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto range = interned_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    Geometry::Ptr pooled = it->second.lock();
+    if (pooled != nullptr && isContentEqual(static_cast<const PolygonMesh&>(*pooled), mesh))
+      return pooled;
+  }
+
+  interned_.emplace(hash, geometry);
+  addresses_[geometry.get()] = geometry;
+  purge();
+  return geometry;
+}
+
+std::size_t GeometryPool::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<std::size_t>(std::count_if(addresses_.begin(), addresses_.end(), [](const auto& entry) {
+    return entry.second.lock().get() == entry.first;
+  }));
+}
+
+void GeometryPool::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  loaded_.clear();
+  interned_.clear();
+  addresses_.clear();
+  purge_size_ = 64;
+}
+
+std::vector<Geometry::Ptr> GeometryPool::getGeometries(const std::string& key, const LoadFn& load_fn)
+{
+  auto get_loaded = [this, &key]() {
+    std::vector<Geometry::Ptr> geometries;
+    auto it = loaded_.find(key);
+    if (it == loaded_.end())
+      return geometries;
+
+    geometries.reserve(it->second.size());
+    for (const auto& entry : it->second)
+    {
+      Geometry::Ptr geometry = entry.lock();
+      if (geometry == nullptr)
+        return std::vector<Geometry::Ptr>();
+
+      geometries.push_back(geometry);
+    }
+    return geometries;
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Geometry::Ptr> geometries = get_loaded();
+    if (!geometries.empty())
+      return geometries;
+  }
+
+  // Load outside of the lock so different resources are loaded in parallel
+  std::vector<Geometry::Ptr> geometries = load_fn();
+  if (geometries.empty())
+    return geometries;
+
+  std::vector<std::size_t> hashes;
+  hashes.reserve(geometries.size());
+  for (const auto& geometry : geometries)
+    hashes.push_back(isPolygonMesh(*geometry) ? geometry->getHash() : 0);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Another thread may have loaded the same resource in the meantime
+  std::vector<Geometry::Ptr> existing = get_loaded();
+  if (!existing.empty())
+    return existing;
+
+  std::vector<std::weak_ptr<Geometry>>& entry = loaded_[key];
+  entry.assign(geometries.begin(), geometries.end());
+  for (std::size_t i = 0; i < geometries.size(); ++i)
+  {
+    if (!isPolygonMesh(*geometries[i]))
+      continue;
+
+    interned_.emplace(hashes[i], geometries[i]);
+    addresses_[geometries[i].get()] = geometries[i];
+  }
+
+  purge();
+  return geometries;
+}
+
+void GeometryPool::purge()
+{
+  if (loaded_.size() + interned_.size() < purge_size_)
+    return;
+
+  for (auto it = loaded_.begin(); it != loaded_.end();)
+  {
+    bool expired = std::any_of(it->second.begin(), it->second.end(), [](const auto& e) { return e.expired(); });
+    it = expired ? loaded_.erase(it) : std::next(it);
+  }
+
+  for (auto it = interned_.begin(); it != interned_.end();)
+    it = it->second.expired() ? interned_.erase(it) : std::next(it);
+
+  for (auto it = addresses_.begin(); it != addresses_.end();)
+    it = it->second.expired() ? addresses_.erase(it) : std::next(it);
+
+  // Grow the limit with the entries in use, so the purge is amortized over the added entries
+  purge_size_ = std::max<std::size_t>(64, 2 * (loaded_.size() + interned_.size()));
+}
+}  // namespace tesseract_geometry
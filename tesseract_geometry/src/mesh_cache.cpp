@@ -0,0 +1,406 @@
+/**
+ * @file mesh_cache.cpp
+ * @brief A persistent on-disk cache of the meshes imported by the mesh parser
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/mesh_cache.h>
+
+namespace tesseract_geometry
+{
+namespace
+{
+/** @brief Identifies an entry file, the last byte is the version of the layout */
+const uint64_t MESH_CACHE_MAGIC = 0x014853454D534554;  // "TESMESH" and version 1
+
+const char* const MESH_CACHE_EXTENSION = ".mesh";
+
+/** @brief The default size limit of the entries, 1 GiB */
+const std::uintmax_t MESH_CACHE_DEFAULT_MAX_SIZE = 1ULL << 30U;
+
+/** @brief The header of each mesh in an entry, followed by its arrays */
+struct MeshRecord
+{
+  uint64_t vertex_count;
+  uint64_t face_size;
+  uint64_t normal_count;
+  uint64_t vertex_color_count;
+  int64_t face_count;
+};
+
+/** @brief The 64 bit FNV-1a hash, which unlike std::hash is the same in every process */
+void hashBytes(uint64_t& hash, const void* data, std::size_t size)
+{
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+}
+
+/** @brief The faces are padded to keep the arrays after them aligned to eight bytes */
+uint64_t getPaddedFaceSize(uint64_t face_size) { return face_size + (face_size % 2); }
+
+bool write(std::ofstream& out, const void* data, std::size_t size)
+{
+  out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+  return out.good();
+}
+
+std::string getEntryPath(const std::string& directory, const std::string& key)
+{
+  return (boost::filesystem::path(directory) / (key + MESH_CACHE_EXTENSION)).string();
+}
+}  // namespace
+
+MeshCache::MeshCache() : max_size_(MESH_CACHE_DEFAULT_MAX_SIZE)
+{
+  if (const char* directory = std::getenv("TESSERACT_MESH_CACHE_DIR"))
+    directory_ = directory;
+
+  if (const char* max_size = std::getenv("TESSERACT_MESH_CACHE_MAX_SIZE"))
+  {
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(max_size, &end, 10);
+    if (end != max_size && *end == '\0')
+      max_size_ = static_cast<std::uintmax_t>(value);
+    else
+      CONSOLE_BRIDGE_logWarn("MeshCache, TESSERACT_MESH_CACHE_MAX_SIZE is not a number of bytes: '%s'", max_size);
+  }
+}
+
+MeshCache& MeshCache::getInstance()
+{
+  static MeshCache cache;
+  return cache;
+}
+
+void MeshCache::setDirectory(const std::string& directory)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  directory_ = directory;
+}
+
+std::string MeshCache::getDirectory() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return directory_;
+}
+
+void MeshCache::setMaxSize(std::uintmax_t max_size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_size_ = max_size;
+}
+
+std::uintmax_t MeshCache::getMaxSize() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_size_;
+}
+
+bool MeshCache::isEnabled() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !directory_.empty();
+}
+
+std::string MeshCache::getKey(const std::vector<uint8_t>& data,
+                              const std::string& hint,
+                              const Eigen::Vector3d& scale,
+                              bool triangulate,
+                              bool flatten,
+                              bool normals,
+                              bool vertex_colors)
+{
+  std::stringstream options;
+  options << std::setprecision(17) << hint << " " << scale.x() << " " << scale.y() << " " << scale.z() << " "
+          << triangulate << flatten << normals << vertex_colors;
+  return getKey(data, options.str());
+}
+
+std::string MeshCache::getKey(const std::vector<uint8_t>& data, const std::string& options)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  hashBytes(hash, data.data(), data.size());
+  hashBytes(hash, options.data(), options.size());
+
+  std::stringstream key;
+  key << std::hex << std::setfill('0') << std::setw(16) << hash << "-" << data.size();
+  return key.str();
+}
+
+bool MeshCache::load(const std::string& key, std::vector<MeshCacheData>& meshes) const
+{
+  const std::string directory = getDirectory();
+  if (directory.empty())
+    return false;
+
+  const std::string path = getEntryPath(directory, key);
+  boost::system::error_code ec;
+  if (!boost::filesystem::exists(path, ec))
+    return false;
+
+  // The entry is mapped, so the arrays are copied once from the page cache into the meshes
+  boost::interprocess::mapped_region region;
+  try
+  {
+    boost::interprocess::file_mapping file(path.c_str(), boost::interprocess::read_only);
+    region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {
+    return false;
+  }
+
+  const auto* data = static_cast<const uint8_t*>(region.get_address());
+  std::size_t remaining = region.get_size();
+
+  // The counts are checked against the size of the entry, so a corrupt entry does not cause a large allocation
+  auto fits = [&remaining](uint64_t count, std::size_t element_size) { return count <= remaining / element_size; };
+  auto copy = [&data, &remaining, &fits](void* out, uint64_t count, std::size_t element_size) {
+    if (!fits(count, element_size))
+      return false;
+
+    const std::size_t size = static_cast<std::size_t>(count) * element_size;
+    if (size > 0)
+      std::memcpy(out, data, size);
+
+    data += size;
+    remaining -= size;
+    return true;
+  };
+
+  uint64_t magic{ 0 };
+  uint64_t mesh_count{ 0 };
+  if (!copy(&magic, 1, sizeof(magic)) || magic != MESH_CACHE_MAGIC || !copy(&mesh_count, 1, sizeof(mesh_count)) ||
+      !fits(mesh_count, sizeof(MeshRecord)))
+    return false;
+
+  std::vector<MeshCacheData> result;
+  result.reserve(mesh_count);
+  for (uint64_t i = 0; i < mesh_count; ++i)
+  {
+    MeshRecord record{};
+    if (!copy(&record, 1, sizeof(record)))
+      return false;
+
+    const uint64_t padded_face_size = getPaddedFaceSize(record.face_size);
+    if (!fits(record.vertex_count, sizeof(Eigen::Vector3d)) || !fits(padded_face_size, sizeof(int)))
+      return false;
+
+    auto vertices = std::make_shared<tesseract_common::VectorVector3d>(record.vertex_count);
+    auto faces = std::make_shared<Eigen::VectorXi>(static_cast<Eigen::Index>(padded_face_size));
+    if (!copy(vertices->data(), vertices->size(), sizeof(Eigen::Vector3d)) ||
+        !copy(faces->data(), padded_face_size, sizeof(int)))
+      return false;
+
+    faces->conservativeResize(static_cast<Eigen::Index>(record.face_size));
+
+    MeshCacheData mesh;
+    mesh.vertices = vertices;
+    mesh.faces = faces;
+    mesh.face_count = static_cast<int>(record.face_count);
+
+    if (record.normal_count > 0)
+    {
+      if (!fits(record.normal_count, sizeof(Eigen::Vector3d)))
+        return false;
+
+      auto normals = std::make_shared<tesseract_common::VectorVector3d>(record.normal_count);
+      if (!copy(normals->data(), normals->size(), sizeof(Eigen::Vector3d)))
+        return false;
+
+      mesh.normals = normals;
+    }
+
+    if (record.vertex_color_count > 0)
+    {
+      if (!fits(record.vertex_color_count, sizeof(Eigen::Vector4d)))
+        return false;
+
+      auto vertex_colors = std::make_shared<tesseract_common::VectorVector4d>(record.vertex_color_count);
+      if (!copy(vertex_colors->data(), vertex_colors->size(), sizeof(Eigen::Vector4d)))
+        return false;
+
+      mesh.vertex_colors = vertex_colors;
+    }
+
+    result.push_back(mesh);
+  }
+
+  if (remaining != 0)
+    return false;
+
+  // Mark the entry as used, so it is removed last when the cache is trimmed
+  boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+
+  meshes = std::move(result);
+  return true;
+}
+
+bool MeshCache::store(const std::string& key, const std::vector<MeshCacheData>& meshes)
+{
+  std::string directory;
+  std::uintmax_t max_size{ 0 };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    directory = directory_;
+    max_size = max_size_;
+  }
+
+  if (directory.empty())
+    return false;
+
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(directory, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logWarn("MeshCache, failed to create directory '%s': %s", directory.c_str(), ec.message().c_str());
+    return false;
+  }
+
+  // The entry is written to a unique file and renamed, so a concurrent load never reads a partial entry
+  const std::string path = getEntryPath(directory, key);
+  const std::string temp_path = path + "." + boost::filesystem::unique_path().string() + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    const uint64_t mesh_count = meshes.size();
+    bool ok = out.good() && write(out, &MESH_CACHE_MAGIC, sizeof(MESH_CACHE_MAGIC)) &&
+              write(out, &mesh_count, sizeof(mesh_count));
+
+    for (const auto& mesh : meshes)
+    {
+      if (!ok || mesh.vertices == nullptr || mesh.faces == nullptr)
+      {
+        ok = false;
+        break;
+      }
+
+      MeshRecord record{};
+      record.vertex_count = mesh.vertices->size();
+      record.face_size = static_cast<uint64_t>(mesh.faces->size());
+      record.normal_count = (mesh.normals != nullptr) ? mesh.normals->size() : 0;
+      record.vertex_color_count = (mesh.vertex_colors != nullptr) ? mesh.vertex_colors->size() : 0;
+      record.face_count = mesh.face_count;
+
+      const int padding{ 0 };
+      ok = write(out, &record, sizeof(record)) &&
+           write(out, mesh.vertices->data(), mesh.vertices->size() * sizeof(Eigen::Vector3d)) &&
+           write(out, mesh.faces->data(), record.face_size * sizeof(int)) &&
+           write(out, &padding, (getPaddedFaceSize(record.face_size) - record.face_size) * sizeof(int));
+
+      if (ok && record.normal_count > 0)
+        ok = write(out, mesh.normals->data(), mesh.normals->size() * sizeof(Eigen::Vector3d));
+
+      if (ok && record.vertex_color_count > 0)
+        ok = write(out, mesh.vertex_colors->data(), mesh.vertex_colors->size() * sizeof(Eigen::Vector4d));
+    }
+
+    out.close();
+    if (!ok || out.fail())
+    {
+      CONSOLE_BRIDGE_logWarn("MeshCache, failed to write entry '%s'", path.c_str());
+      boost::filesystem::remove(temp_path, ec);
+      return false;
+    }
+  }
+
+  boost::filesystem::rename(temp_path, path, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logWarn("MeshCache, failed to write entry '%s': %s", path.c_str(), ec.message().c_str());
+    boost::filesystem::remove(temp_path, ec);
+    return false;
+  }
+
+  trim(directory, max_size);
+  return true;
+}
+
+void MeshCache::clear()
+{
+  const std::string directory = getDirectory();
+  if (directory.empty())
+    return;
+
+  trim(directory, 0);
+}
+
+void MeshCache::trim(const std::string& directory, std::uintmax_t max_size) const
+{
+  struct Entry
+  {
+    boost::filesystem::path path;
+    std::time_t time;
+    std::uintmax_t size;
+  };
+
+  boost::system::error_code ec;
+  std::vector<Entry> entries;
+  std::uintmax_t total_size{ 0 };
+  for (boost::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+  {
+    const boost::filesystem::path& path = it->path();
+    if (path.extension() != MESH_CACHE_EXTENSION)
+      continue;
+
+    boost::system::error_code time_ec;
+    boost::system::error_code size_ec;
+    Entry entry{ path, boost::filesystem::last_write_time(path, time_ec), boost::filesystem::file_size(path, size_ec) };
+    if (time_ec || size_ec)
+      continue;
+
+    total_size += entry.size;
+    entries.push_back(entry);
+  }
+
+  if (total_size <= max_size)
+    return;
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.time < b.time; });
+  for (const auto& entry : entries)
+  {
+    if (total_size <= max_size)
+      break;
+
+    if (boost::filesystem::remove(entry.path, ec))
+      total_size -= entry.size;
+  }
+}
+
+}  // namespace tesseract_geometry
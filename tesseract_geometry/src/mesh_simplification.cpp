@@ -0,0 +1,174 @@
+/**
+ * @file mesh_simplification.cpp
+ * @brief Simplification of triangle meshes within an error bound
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/mesh_simplification.h>
+
+namespace tesseract_geometry
+{
+namespace
+{
+using CellKey = std::array<int64_t, 3>;
+using TriangleKey = std::array<int, 3>;
+
+template <typename Key>
+struct ArrayHash
+{
+  std::size_t operator()(const Key& key) const
+  {
+    std::size_t seed{ 0 };
+    for (const auto& value : key)
+      seed ^= std::hash<typename Key::value_type>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+    return seed;
+  }
+};
+
+/** @brief The vertices merged into a cluster */
+struct Cluster
+{
+  Eigen::Vector3d sum{ Eigen::Vector3d::Zero() };
+  int count{ 0 };
+  int index{ -1 };
+};
+}  // namespace
+
+Mesh::Ptr simplifyMesh(const Mesh& mesh, double max_error)
+{
+  const PolygonMesh::VertexMap vertices = mesh.getVertexMap();
+  if (vertices.cols() == 0 || mesh.getFaceCount() == 0)
+    return nullptr;
+
+  if (!mesh.isTriangleMesh())
+  {
+    CONSOLE_BRIDGE_logError("simplifyMesh, the mesh must only contain triangles!");
+    return nullptr;
+  }
+
+  const PolygonMesh::TriangleMap triangles = mesh.getTriangleMap();
+  if (!(max_error > 0))
+  {
+    return std::make_shared<Mesh>(mesh.getVertices(),
+                                  mesh.getFaces(),
+                                  mesh.getFaceCount(),
+                                  mesh.getResource(),
+                                  mesh.getScale(),
+                                  mesh.getNormals(),
+                                  mesh.getVertexColors());
+  }
+
+  // A cluster lies in a cell, so its mean is at most the cell diagonal from each of its vertices
+  const double cell_size = max_error / std::sqrt(3.0);
+  const Eigen::Vector3d origin = vertices.rowwise().minCoeff();
+
+  std::unordered_map<CellKey, int, ArrayHash<CellKey>> cell_clusters;
+  std::vector<Cluster> clusters;
+  std::vector<int> vertex_clusters(static_cast<std::size_t>(vertices.cols()));
+  for (Eigen::Index i = 0; i < vertices.cols(); ++i)
+  {
+    const Eigen::Vector3d cell = ((vertices.col(i) - origin) / cell_size).array().floor();
+    const CellKey key{ static_cast<int64_t>(cell.x()), static_cast<int64_t>(cell.y()), static_cast<int64_t>(cell.z()) };
+    auto it = cell_clusters.emplace(key, static_cast<int>(clusters.size())).first;
+    if (it->second == static_cast<int>(clusters.size()))
+      clusters.emplace_back();
+
+    Cluster& cluster = clusters[static_cast<std::size_t>(it->second)];
+    cluster.sum += vertices.col(i);
+    ++cluster.count;
+    vertex_clusters[static_cast<std::size_t>(i)] = it->second;
+  }
+
+  // Keep the triangles which do not collapse, once for each set of vertices
+  std::unordered_set<TriangleKey, ArrayHash<TriangleKey>> kept;
+  std::vector<TriangleKey> simplified_triangles;
+  for (Eigen::Index i = 0; i < triangles.cols(); ++i)
+  {
+    TriangleKey triangle;
+    for (Eigen::Index j = 0; j < 3; ++j)
+      triangle[static_cast<std::size_t>(j)] = vertex_clusters[static_cast<std::size_t>(triangles(j, i))];
+
+    if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+      continue;
+
+    TriangleKey sorted = triangle;
+    std::sort(sorted.begin(), sorted.end());
+    if (kept.insert(sorted).second)
+      simplified_triangles.push_back(triangle);
+  }
+
+  if (simplified_triangles.empty())
+    return nullptr;
+
+  auto simplified_vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto simplified_faces = std::make_shared<Eigen::VectorXi>(4 * static_cast<Eigen::Index>(simplified_triangles.size()));
+  Eigen::Index f{ 0 };
+  for (const auto& triangle : simplified_triangles)
+  {
+    (*simplified_faces)[f++] = 3;
+    for (int c : triangle)
+    {
+      Cluster& cluster = clusters[static_cast<std::size_t>(c)];
+      if (cluster.index < 0)
+      {
+        cluster.index = static_cast<int>(simplified_vertices->size());
+        simplified_vertices->push_back(cluster.sum / static_cast<double>(cluster.count));
+      }
+      (*simplified_faces)[f++] = cluster.index;
+    }
+  }
+
+  return std::make_shared<Mesh>(simplified_vertices,
+                                simplified_faces,
+                                static_cast<int>(simplified_triangles.size()),
+                                mesh.getResource(),
+                                mesh.getScale());
+}
+
+std::vector<Mesh::Ptr> createMeshLODChain(const Mesh& mesh, const std::vector<double>& max_errors)
+{
+  std::vector<Mesh::Ptr> chain;
+  int face_count = mesh.getFaceCount();
+  for (double max_error : max_errors)
+  {
+    Mesh::Ptr level = simplifyMesh(mesh, max_error);
+    if (level == nullptr || level->getFaceCount() >= face_count)
+      break;
+
+    face_count = level->getFaceCount();
+    chain.push_back(level);
+  }
+  return chain;
+}
+
+}  // namespace tesseract_geometry
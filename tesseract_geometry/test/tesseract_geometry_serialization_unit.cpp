@@ -109,6 +109,7 @@ TEST(TesseractGeometrySerializeUnit, Octree)  // NOLINT
   {
     auto object =
         std::make_shared<tesseract_geometry::Octree>(pc, 1, tesseract_geometry::Octree::SubType::BOX, false, true);
+    object->setDistanceTolerance(0.5);
     tesseract_common::testSerialization<Octree>(*object, "Binary_Octree");
     tesseract_common::testSerializationDerivedClass<Geometry, Octree>(object, "Binary_Octree");
   }
@@ -127,6 +128,16 @@ TEST(TesseractGeometrySerializeUnit, Plane)  // NOLINT
   tesseract_common::testSerializationDerivedClass<Geometry, Plane>(object, "Plane");
 }
 
+TEST(TesseractGeometrySerializeUnit, PointCloud)  // NOLINT
+{
+  auto points = std::make_shared<tesseract_common::VectorVector3d>();
+  points->emplace_back(0.1, 0.2, 0.3);
+  points->emplace_back(-1, 2, 0.5);
+  auto object = std::make_shared<PointCloud>(points, 0.05);
+  tesseract_common::testSerialization<PointCloud>(*object, "PointCloud");
+  tesseract_common::testSerializationDerivedClass<Geometry, PointCloud>(object, "PointCloud");
+}
+
 TEST(TesseractGeometrySerializeUnit, PolygonMesh)  // NOLINT
 {
   std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.stl";
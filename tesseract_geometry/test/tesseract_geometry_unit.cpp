@@ -4,10 +4,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <algorithm>
 #include <memory>
 #include <octomap/octomap.h>
+#include <boost/filesystem.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_geometry/geometries.h>
+#include <tesseract_geometry/geometry_pool.h>
+#include <tesseract_geometry/mesh_cache.h>
 #include <tesseract_geometry/mesh_parser.h>
+#include <tesseract_geometry/mesh_simplification.h>
+#include <tesseract_geometry/utils.h>
 
 TEST(TesseractGeometryUnit, Instantiation)  // NOLINT
 {
@@ -121,6 +126,45 @@ TEST(TesseractGeometryUnit, Plane)  // NOLINT
   EXPECT_NEAR(std::static_pointer_cast<T>(geom_clone)->getD(), 1, 1e-5);
 }
 
+TEST(TesseractGeometryUnit, PointCloud)  // NOLINT
+{
+  using T = tesseract_geometry::PointCloud;
+  auto points = std::make_shared<tesseract_common::VectorVector3d>();
+  points->emplace_back(1, 0, 0);
+  points->emplace_back(0, 2, 0);
+  auto geom = std::make_shared<T>(points, 0.1);
+  EXPECT_EQ(geom->getType(), tesseract_geometry::GeometryType::POINT_CLOUD);
+  EXPECT_EQ(geom->getPointCount(), 2);
+  EXPECT_NEAR(geom->getPointRadius(), 0.1, 1e-5);
+  EXPECT_NEAR(tesseract_geometry::calcBoundingSphereRadius(*geom), 2.1, 1e-5);
+
+  auto geom_clone = geom->clone();
+  EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getPoints() == points);
+  EXPECT_TRUE(*geom == *std::static_pointer_cast<T>(geom_clone));
+  EXPECT_TRUE(tesseract_geometry::isIdentical(*geom, *geom_clone));
+
+  auto other_points = std::make_shared<tesseract_common::VectorVector3d>(*points);
+  other_points->back().z() = 1;
+  EXPECT_FALSE(*geom == T(other_points, 0.1));
+  EXPECT_FALSE(*geom == T(points, 0.2));
+
+  EXPECT_ANY_THROW(T(nullptr, 0.1));  // NOLINT
+  EXPECT_ANY_THROW(T(points, 0));     // NOLINT
+
+  // The points of each voxel are replaced by their centroid in the order the voxels are reached
+  tesseract_common::VectorVector3d cloud;
+  cloud.emplace_back(0.01, 0.01, 0.01);
+  cloud.emplace_back(0.55, 0.05, 0.05);
+  cloud.emplace_back(0.03, 0.05, 0.07);
+  cloud.emplace_back(-0.05, 0.05, 0.05);
+  auto downsampled = T::voxelDownsample(cloud, 0.1);
+  ASSERT_EQ(downsampled->size(), 3);
+  EXPECT_TRUE((*downsampled)[0].isApprox(Eigen::Vector3d(0.02, 0.03, 0.04)));
+  EXPECT_TRUE((*downsampled)[1].isApprox(cloud[1]));
+  EXPECT_TRUE((*downsampled)[2].isApprox(cloud[3]));
+  EXPECT_EQ(T::voxelDownsample(cloud, 0)->size(), cloud.size());
+}
+
 TEST(TesseractGeometryUnit, PolygonMesh)  // NOLINT
 {
   auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
@@ -151,6 +195,36 @@ TEST(TesseractGeometryUnit, PolygonMesh)  // NOLINT
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getFaceCount() == 1);
 }
 
+TEST(TesseractGeometryUnit, PolygonMeshMapUnit)  // NOLINT
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(1, 1, 0);
+  vertices->emplace_back(1, -1, 0);
+  vertices->emplace_back(-1, -1, 0);
+  vertices->emplace_back(-1, 1, 0);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(8);
+  (*faces) << 3, 0, 1, 2, 3, 0, 2, 3;
+
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(vertices, faces);
+  tesseract_geometry::PolygonMesh::VertexMap vertex_map = mesh->getVertexMap();
+  EXPECT_EQ(vertex_map.cols(), 4);
+  EXPECT_EQ(vertex_map.data(), vertices->front().data());
+  for (std::size_t i = 0; i < vertices->size(); ++i)
+    EXPECT_TRUE(vertex_map.col(static_cast<Eigen::Index>(i)).isApprox((*vertices)[i]));
+
+  EXPECT_TRUE(mesh->isTriangleMesh());
+  tesseract_geometry::PolygonMesh::TriangleMap triangle_map = mesh->getTriangleMap();
+  EXPECT_EQ(triangle_map.cols(), 2);
+  EXPECT_EQ(triangle_map.col(0), Eigen::Vector3i(0, 1, 2));
+  EXPECT_EQ(triangle_map.col(1), Eigen::Vector3i(0, 2, 3));
+
+  auto quad_faces = std::make_shared<Eigen::VectorXi>(5);
+  (*quad_faces) << 4, 0, 1, 2, 3;
+  auto quad = std::make_shared<tesseract_geometry::PolygonMesh>(vertices, quad_faces);
+  EXPECT_FALSE(quad->isTriangleMesh());
+}
+
 TEST(TesseractGeometryUnit, ConvexMesh)  // NOLINT
 {
   auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
@@ -293,9 +367,136 @@ TEST(TesseractGeometryUnit, Octree)  // NOLINT
   EXPECT_TRUE(geom->getOctree() != nullptr);
   EXPECT_TRUE(geom->getSubType() == tesseract_geometry::Octree::SubType::BOX);
 
+  EXPECT_NEAR(geom->getDistanceTolerance(), 0, 1e-10);
+  geom->setDistanceTolerance(0.1);
+
   auto geom_clone = geom->clone();
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getOctree() != nullptr);
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getSubType() == tesseract_geometry::Octree::SubType::BOX);
+  EXPECT_NEAR(std::static_pointer_cast<T>(geom_clone)->getDistanceTolerance(), 0.1, 1e-10);
+}
+
+TEST(TesseractGeometryUnit, OctreeFromPointCloudUnit)  // NOLINT
+{
+  using T = tesseract_geometry::Octree;
+  struct TestPointCloud
+  {
+    struct point
+    {
+      double x;
+      double y;
+      double z;
+    };
+
+    std::vector<point> points;
+  };
+
+  // A wall two voxels thick with several points in each voxel
+  TestPointCloud pc;
+  for (double x : { 1.01, 1.11 })
+  {
+    for (int i = 0; i < 40; ++i)
+    {
+      for (int j = 0; j < 40; ++j)
+        pc.points.push_back({ x, -0.5 + (0.025 * i), -0.5 + (0.025 * j) });
+    }
+  }
+
+  // The octree matches one built by updating a node for each point
+  octomap::OcTree reference(0.1);
+  for (const auto& point : pc.points)
+    reference.updateNode(point.x, point.y, point.z, true, true);
+  reference.updateInnerOccupancy();
+
+  auto geom = std::make_shared<T>(pc, 0.1, T::SubType::BOX, false, false);
+  EXPECT_EQ(geom->getOctree()->getNumLeafNodes(), reference.getNumLeafNodes());
+  for (auto it = reference.begin_leafs(), end = reference.end_leafs(); it != end; ++it)
+  {
+    const octomap::OcTreeNode* node = geom->getOctree()->search(it.getKey());
+    ASSERT_TRUE(node != nullptr);
+    EXPECT_NEAR(node->getLogOdds(), it->getLogOdds(), 1e-5);
+  }
+
+  // Pruning collapses the fully occupied parents of the wall
+  auto pruned = std::make_shared<T>(pc, 0.1, T::SubType::BOX, true);
+  EXPECT_TRUE(pruned->getPruned());
+  EXPECT_LT(pruned->getOctree()->getNumLeafNodes(), geom->getOctree()->getNumLeafNodes());
+
+  // The space between the sensor and the wall is cleared
+  auto sensed = std::make_shared<T>(pc, Eigen::Vector3d::Zero(), 0.1, T::SubType::BOX, false);
+  const octomap::OcTreeNode* free_node = sensed->getOctree()->search(0.5, 0, 0);
+  ASSERT_TRUE(free_node != nullptr);
+  EXPECT_FALSE(sensed->getOctree()->isNodeOccupied(free_node));
+  const octomap::OcTreeNode* occupied_node = sensed->getOctree()->search(1.01, 0, 0);
+  ASSERT_TRUE(occupied_node != nullptr);
+  EXPECT_TRUE(sensed->getOctree()->isNodeOccupied(occupied_node));
+}
+
+TEST(TesseractGeometryUnit, OctreeMergedBoxesUnit)  // NOLINT
+{
+  // A floor of 10 x 10 cells and a single cell above it
+  octomap::OcTree octree(0.1);
+  for (int i = 0; i < 10; ++i)
+  {
+    for (int j = 0; j < 10; ++j)
+      octree.updateNode(0.05 + (0.1 * i), 0.05 + (0.1 * j), 0.05, true);
+  }
+  octree.updateNode(0.55, 0.55, 0.55, true);
+
+  std::vector<Eigen::AlignedBox3d> boxes = tesseract_geometry::Octree::getMergedBoxes(octree);
+  ASSERT_EQ(boxes.size(), 2U);
+
+  double volume{ 0 };
+  for (const auto& box : boxes)
+    volume += box.volume();
+  EXPECT_NEAR(volume, 101 * 0.001, 1e-9);
+
+  EXPECT_TRUE(boxes[0].min().isApprox(Eigen::Vector3d(0, 0, 0), 1e-9));
+  EXPECT_TRUE(boxes[0].max().isApprox(Eigen::Vector3d(1, 1, 0.1), 1e-9));
+  EXPECT_TRUE(boxes[1].min().isApprox(Eigen::Vector3d(0.5, 0.5, 0.5), 1e-9));
+  EXPECT_TRUE(boxes[1].max().isApprox(Eigen::Vector3d(0.6, 0.6, 0.6), 1e-9));
+
+  // Pruned cells are kept as boxes
+  tesseract_geometry::Octree::prune(octree);
+  boxes = tesseract_geometry::Octree::getMergedBoxes(octree);
+  volume = 0;
+  for (const auto& box : boxes)
+    volume += box.volume();
+  EXPECT_NEAR(volume, 101 * 0.001, 1e-9);
+}
+
+TEST(TesseractGeometryUnit, GeometryHashUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  Box box(1, 2, 3);
+  EXPECT_EQ(box.getHash(), Box(1, 2, 3).getHash());
+  EXPECT_EQ(box.getHash(), box.clone()->getHash());
+  EXPECT_NE(box.getHash(), Box(1, 2, 4).getHash());
+  EXPECT_NE(Sphere(1).getHash(), Cylinder(1, 0).getHash());
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(0, 0, 0);
+  vertices->emplace_back(1, 0, 0);
+  vertices->emplace_back(0, 1, 0);
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  *faces << 3, 0, 1, 2;
+
+  // Meshes with the same content in different arrays are equal
+  auto mesh = std::make_shared<Mesh>(vertices, faces);
+  auto mesh_copy = std::make_shared<Mesh>(std::make_shared<tesseract_common::VectorVector3d>(*vertices),
+                                          std::make_shared<Eigen::VectorXi>(*faces));
+  EXPECT_EQ(mesh->getHash(), mesh_copy->getHash());
+  EXPECT_TRUE(*mesh == *mesh_copy);
+  EXPECT_TRUE(isIdentical(*mesh, *mesh_copy));
+
+  // Meshes with the same counts but different vertices are not
+  auto moved_vertices = std::make_shared<tesseract_common::VectorVector3d>(*vertices);
+  (*moved_vertices)[2] = Eigen::Vector3d(0, 2, 0);
+  auto moved_mesh = std::make_shared<Mesh>(moved_vertices, faces);
+  EXPECT_NE(mesh->getHash(), moved_mesh->getHash());
+  EXPECT_FALSE(*mesh == *moved_mesh);
+  EXPECT_FALSE(isIdentical(*mesh, *moved_mesh));
 }
 
 TEST(TesseractGeometryUnit, LoadMeshUnit)  // NOLINT
@@ -348,6 +549,203 @@ TEST(TesseractGeometryUnit, LoadMeshUnit)  // NOLINT
   EXPECT_TRUE(convex_meshes[0]->getVertexCount() == 8);
 }
 
+TEST(TesseractGeometryUnit, GeometryPoolUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  GeometryPool& pool = GeometryPool::getInstance();
+  pool.clear();
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(1, 1, 0);
+  vertices->emplace_back(1, -1, 0);
+  vertices->emplace_back(-1, -1, 0);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  (*faces) << 3, 0, 1, 2;
+
+  // Meshes with the same content are interned to the first one
+  auto mesh = std::make_shared<Mesh>(vertices, faces);
+  auto mesh_copy = std::make_shared<Mesh>(std::make_shared<tesseract_common::VectorVector3d>(*vertices),
+                                          std::make_shared<Eigen::VectorXi>(*faces));
+  EXPECT_TRUE(pool.intern(mesh) == mesh);
+  EXPECT_TRUE(pool.intern(mesh_copy) == mesh);
+  EXPECT_EQ(pool.size(), 1U);
+
+  // Meshes with a different scale or type are not equal
+  auto mesh_scaled = std::make_shared<Mesh>(vertices, faces, nullptr, Eigen::Vector3d(2, 2, 2));
+  EXPECT_TRUE(pool.intern(mesh_scaled) == mesh_scaled);
+  auto sdf_mesh = std::make_shared<SDFMesh>(vertices, faces);
+  EXPECT_TRUE(pool.intern(sdf_mesh) == sdf_mesh);
+  EXPECT_EQ(pool.size(), 3U);
+
+  // Other geometry is not interned
+  auto box = std::make_shared<Box>(1, 1, 1);
+  EXPECT_TRUE(pool.intern(box) == box);
+  EXPECT_TRUE(pool.intern(std::make_shared<Box>(1, 1, 1)) != box);
+  EXPECT_EQ(pool.size(), 3U);
+
+  // Meshes are loaded once per key
+  int load_count = 0;
+  auto load_fn = [&load_count, &vertices, &faces]() {
+    ++load_count;
+    return std::vector<Mesh::Ptr>{ std::make_shared<Mesh>(vertices, faces) };
+  };
+  std::vector<Mesh::Ptr> loaded = pool.getMeshes<Mesh>("mesh", load_fn);
+  EXPECT_EQ(loaded.size(), 1U);
+  EXPECT_EQ(pool.getMeshes<Mesh>("mesh", load_fn), loaded);
+  EXPECT_EQ(load_count, 1);
+  EXPECT_TRUE(pool.getMeshes<Mesh>("other", load_fn) != loaded);
+  EXPECT_EQ(load_count, 2);
+
+  // The pool only holds weak references
+  loaded.clear();
+  EXPECT_EQ(pool.getMeshes<Mesh>("mesh", load_fn).size(), 1U);
+  EXPECT_EQ(load_count, 3);
+
+  mesh_copy = std::make_shared<Mesh>(vertices, faces);
+  mesh = nullptr;
+  EXPECT_TRUE(pool.intern(mesh_copy) == mesh_copy);
+
+  pool.clear();
+  EXPECT_EQ(pool.size(), 0U);
+}
+
+TEST(TesseractGeometryUnit, MeshCacheUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  MeshCache& cache = MeshCache::getInstance();
+  const std::string directory = cache.getDirectory();
+  const std::uintmax_t max_size = cache.getMaxSize();
+  const boost::filesystem::path cache_dir =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("tesseract_mesh_cache_%%%%-%%%%");
+  cache.setDirectory(cache_dir.string());
+  EXPECT_TRUE(cache.isEnabled());
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(1, 1, 0);
+  vertices->emplace_back(1, -1, 0);
+  vertices->emplace_back(-1, -1, 0);
+
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  (*faces) << 3, 0, 1, 2;
+
+  auto normals = std::make_shared<tesseract_common::VectorVector3d>(3, Eigen::Vector3d::UnitZ());
+
+  std::vector<MeshCacheData> data(1);
+  data[0].vertices = vertices;
+  data[0].faces = faces;
+  data[0].face_count = 1;
+  data[0].normals = normals;
+
+  const std::vector<uint8_t> content{ 1, 2, 3 };
+  const std::string key = MeshCache::getKey(content, "stl", Eigen::Vector3d(1, 1, 1), true, false, false, false);
+  EXPECT_EQ(key, MeshCache::getKey(content, "stl", Eigen::Vector3d(1, 1, 1), true, false, false, false));
+  EXPECT_NE(key, MeshCache::getKey(content, "stl", Eigen::Vector3d(2, 1, 1), true, false, false, false));
+  EXPECT_NE(key, MeshCache::getKey(content, "stl", Eigen::Vector3d(1, 1, 1), false, false, false, false));
+  EXPECT_NE(key, MeshCache::getKey({ 1, 2, 4 }, "stl", Eigen::Vector3d(1, 1, 1), true, false, false, false));
+
+  std::vector<MeshCacheData> loaded;
+  EXPECT_FALSE(cache.load(key, loaded));
+  EXPECT_TRUE(cache.store(key, data));
+  EXPECT_TRUE(cache.load(key, loaded));
+  ASSERT_EQ(loaded.size(), 1U);
+  EXPECT_TRUE(*loaded[0].vertices == *vertices);
+  EXPECT_TRUE(*loaded[0].faces == *faces);
+  EXPECT_EQ(loaded[0].face_count, 1);
+  ASSERT_TRUE(loaded[0].normals != nullptr);
+  EXPECT_TRUE(*loaded[0].normals == *normals);
+  EXPECT_TRUE(loaded[0].vertex_colors == nullptr);
+
+  std::vector<Mesh::Ptr> meshes = MeshCache::createMeshes<Mesh>(loaded, nullptr, Eigen::Vector3d(1, 1, 1));
+  ASSERT_EQ(meshes.size(), 1U);
+  EXPECT_EQ(meshes[0]->getVertexCount(), 3);
+  EXPECT_EQ(meshes[0]->getFaceCount(), 1);
+
+  // A truncated entry is ignored
+  const boost::filesystem::path entry_path = cache_dir / (key + ".mesh");
+  boost::filesystem::resize_file(entry_path, boost::filesystem::file_size(entry_path) - 8);
+  EXPECT_FALSE(cache.load(key, loaded));
+
+  // The entries are removed once they exceed the size limit
+  cache.setMaxSize(0);
+  EXPECT_TRUE(cache.store(key, data));
+  EXPECT_FALSE(boost::filesystem::exists(entry_path));
+  cache.setMaxSize(max_size);
+
+  // Meshes loaded again are read from the cache
+  std::string mesh_file = std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.stl";
+  meshes = createMeshFromPath<Mesh>(mesh_file);
+  EXPECT_FALSE(boost::filesystem::is_empty(cache_dir));
+  std::vector<Mesh::Ptr> cached_meshes = createMeshFromPath<Mesh>(mesh_file);
+  ASSERT_EQ(meshes.size(), 1U);
+  ASSERT_EQ(cached_meshes.size(), 1U);
+  EXPECT_TRUE(*meshes[0]->getVertices() == *cached_meshes[0]->getVertices());
+  EXPECT_TRUE(*meshes[0]->getFaces() == *cached_meshes[0]->getFaces());
+  EXPECT_EQ(meshes[0]->getFaceCount(), cached_meshes[0]->getFaceCount());
+
+  cache.clear();
+  EXPECT_TRUE(boost::filesystem::is_empty(cache_dir));
+  boost::filesystem::remove_all(cache_dir);
+  cache.setDirectory(directory);
+}
+
+TEST(TesseractGeometryUnit, SimplifyMeshUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  // A one meter square made of 40 x 40 cells
+  const int n = 40;
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i <= n; ++i)
+    for (int j = 0; j <= n; ++j)
+      vertices->emplace_back(static_cast<double>(i) / n, static_cast<double>(j) / n, 0);
+
+  std::vector<int> local_faces;
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      const int v = (i * (n + 1)) + j;
+      local_faces.insert(local_faces.end(), { 3, v, v + n + 1, v + 1, 3, v + 1, v + n + 1, v + n + 2 });
+    }
+  }
+  auto faces = std::make_shared<Eigen::VectorXi>(
+      Eigen::Map<Eigen::VectorXi>(local_faces.data(), static_cast<Eigen::Index>(local_faces.size())));
+  Mesh mesh(vertices, faces);
+  EXPECT_EQ(mesh.getFaceCount(), 2 * n * n);
+
+  const double max_error = 0.1;
+  Mesh::Ptr simplified = simplifyMesh(mesh, max_error);
+  ASSERT_TRUE(simplified != nullptr);
+  EXPECT_GT(simplified->getFaceCount(), 0);
+  EXPECT_LT(simplified->getFaceCount(), mesh.getFaceCount());
+  EXPECT_TRUE(simplified->isTriangleMesh());
+
+  // Every vertex of the simplified mesh is the mean of nearby vertices of the original mesh
+  for (const auto& v : *simplified->getVertices())
+  {
+    double distance = std::numeric_limits<double>::max();
+    for (const auto& o : *vertices)
+      distance = std::min(distance, (v - o).norm());
+
+    EXPECT_LE(distance, max_error);
+  }
+
+  // A zero error returns the mesh unchanged and a large error collapses it
+  Mesh::Ptr unchanged = simplifyMesh(mesh, 0);
+  ASSERT_TRUE(unchanged != nullptr);
+  EXPECT_EQ(unchanged->getFaceCount(), mesh.getFaceCount());
+  EXPECT_TRUE(simplifyMesh(mesh, 10) == nullptr);
+
+  std::vector<Mesh::Ptr> chain = createMeshLODChain(mesh, { 0.05, 0.1, 0.2, 10 });
+  ASSERT_EQ(chain.size(), 3U);
+  EXPECT_LT(chain[0]->getFaceCount(), mesh.getFaceCount());
+  EXPECT_LT(chain[1]->getFaceCount(), chain[0]->getFaceCount());
+  EXPECT_LT(chain[2]->getFaceCount(), chain[1]->getFaceCount());
+}
+
 #ifdef TESSERACT_ASSIMP_USE_PBRMATERIAL
 
 TEST(TesseractGeometryUnit, LoadMeshWithMaterialGltf2Unit)  // NOLINT
@@ -423,6 +821,66 @@ TEST(TesseractGeometryUnit, LoadMeshWithMaterialGltf2Unit)  // NOLINT
 }
 #endif
 
+TEST(TesseractGeometryUnit, CalcBoundingSphereRadiusUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  EXPECT_NEAR(calcBoundingSphereRadius(Box(2, 2, 1)), 1.5, 1e-8);
+  EXPECT_NEAR(calcBoundingSphereRadius(Sphere(0.5)), 0.5, 1e-8);
+  EXPECT_NEAR(calcBoundingSphereRadius(Cylinder(0.3, 0.8)), 0.5, 1e-8);
+  EXPECT_NEAR(calcBoundingSphereRadius(Cone(0.3, 0.8)), 0.5, 1e-8);
+  EXPECT_NEAR(calcBoundingSphereRadius(Capsule(0.25, 1)), 0.75, 1e-8);
+  EXPECT_TRUE(std::isinf(calcBoundingSphereRadius(Plane(0, 0, 1, 0))));
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->push_back(Eigen::Vector3d(1, 1, 0));
+  vertices->push_back(Eigen::Vector3d(1, -1, 0));
+  vertices->push_back(Eigen::Vector3d(-1, -1, 3));
+
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  (*faces)[0] = 3;
+  (*faces)[1] = 0;
+  (*faces)[2] = 1;
+  (*faces)[3] = 2;
+
+  EXPECT_NEAR(calcBoundingSphereRadius(Mesh(vertices, faces)), std::sqrt(11.0), 1e-8);
+}
+
+TEST(TesseractGeometryUnit, MemoryUsageUnit)  // NOLINT
+{
+  using namespace tesseract_geometry;
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->push_back(Eigen::Vector3d(1, 1, 0));
+  vertices->push_back(Eigen::Vector3d(1, -1, 0));
+  vertices->push_back(Eigen::Vector3d(-1, -1, 0));
+
+  auto faces = std::make_shared<Eigen::VectorXi>(4);
+  (*faces)[0] = 3;
+  (*faces)[1] = 0;
+  (*faces)[2] = 1;
+  (*faces)[3] = 2;
+
+  // The vertices and faces are shared by both meshes, so they are counted once as shared storage
+  Mesh mesh(vertices, faces);
+  Mesh other_mesh(vertices, faces);
+
+  tesseract_common::MemoryUsageTracker tracker;
+  tesseract_common::MemoryUsage usage = mesh.getMemoryUsage(tracker);
+  EXPECT_EQ(usage.name, "Mesh");
+  EXPECT_GE(usage.shared_bytes, (3 * sizeof(Eigen::Vector3d)) + (4 * sizeof(int)));
+
+  tesseract_common::MemoryUsage other_usage = other_mesh.getMemoryUsage(tracker);
+  EXPECT_EQ(other_usage.shared_bytes, 0);
+  EXPECT_GT(other_usage.unique_bytes, 0);
+
+  // A geometry reported twice is only counted the first time
+  EXPECT_EQ(mesh.getMemoryUsage(tracker).getTotalBytes(), 0);
+
+  Box box(1, 1, 1);
+  EXPECT_GT(box.getMemoryUsage(tracker).unique_bytes, 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
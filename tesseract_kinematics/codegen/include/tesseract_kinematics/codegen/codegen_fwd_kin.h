@@ -0,0 +1,175 @@
+/**
+ * @file codegen_fwd_kin.h
+ * @brief Tesseract forward kinematics wrapper for a generated kinematic chain
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_H
+#define TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/forward_kinematics.h>
+#include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+
+namespace tesseract_kinematics
+{
+static const std::string CODEGEN_FWD_KIN_SOLVER_NAME = "CodegenFwdKin";
+
+/**
+ * @brief Forward kinematics of a kinematic chain generated by generateCodegenFwdKin
+ *
+ * The Model is the struct defined in the generated header. To create a plugin for it, add a source file similar to
+ * what is shown below to a library and add the library to the kinematics plugins:
+ *
+ * #include <tesseract_kinematics/codegen/codegen_fwd_kin.h>
+ * #include <my_robot_kinematics/my_robot_fwd_kin.h>
+ *
+ * TESSERACT_ADD_FWD_KIN_PLUGIN(tesseract_kinematics::CodegenFwdKinFactory<my_robot::MyRobotFwdKin>,
+ *                              MyRobotFwdKinFactory);
+ */
+template <typename Model>
+class CodegenFwdKin : public ForwardKinematics
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<CodegenFwdKin<Model>>;
+  using ConstPtr = std::shared_ptr<const CodegenFwdKin<Model>>;
+  using UPtr = std::unique_ptr<CodegenFwdKin<Model>>;
+  using ConstUPtr = std::unique_ptr<const CodegenFwdKin<Model>>;
+
+  ~CodegenFwdKin() override = default;
+  CodegenFwdKin(const CodegenFwdKin&) = default;
+  CodegenFwdKin& operator=(const CodegenFwdKin&) = default;
+  CodegenFwdKin(CodegenFwdKin&&) = default;
+  CodegenFwdKin& operator=(CodegenFwdKin&&) = default;
+
+  /**
+   * @brief Construct the generated forward kinematics
+   * @param solver_name The solver name of the kinematic chain
+   */
+  explicit CodegenFwdKin(std::string solver_name = CODEGEN_FWD_KIN_SOLVER_NAME)
+    : solver_name_(std::move(solver_name))
+  {
+  }
+
+  tesseract_common::TransformMap calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const override final
+  {
+    assert(joint_angles.size() == Model::NUM_JOINTS);
+    Eigen::Isometry3d pose;
+    Model::calcFwdKin(pose, joint_angles.data());
+
+    tesseract_common::TransformMap poses;
+    poses[Model::TIP_LINK_NAME] = pose;
+    return poses;
+  }
+
+  Eigen::MatrixXd calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                               const std::string& link_name) const override final
+  {
+    assert(joint_angles.size() == Model::NUM_JOINTS);
+    if (link_name != Model::TIP_LINK_NAME)
+      throw std::runtime_error("CodegenFwdKin, the jacobian is only available for the tip link '" +
+                               std::string(Model::TIP_LINK_NAME) + "'");
+
+    Eigen::MatrixXd jacobian(6, Model::NUM_JOINTS);
+    Model::calcJacobian(jacobian, joint_angles.data());
+    return jacobian;
+  }
+
+  std::string getBaseLinkName() const override final { return Model::BASE_LINK_NAME; }
+
+  std::vector<std::string> getJointNames() const override final
+  {
+    return { Model::JOINT_NAMES.begin(), Model::JOINT_NAMES.end() };
+  }
+
+  std::vector<std::string> getTipLinkNames() const override final { return { Model::TIP_LINK_NAME }; }
+
+  Eigen::Index numJoints() const override final { return Model::NUM_JOINTS; }
+
+  std::string getSolverName() const override final { return solver_name_; }
+
+  ForwardKinematics::UPtr clone() const override final { return std::make_unique<CodegenFwdKin<Model>>(*this); }
+
+private:
+  std::string solver_name_{ CODEGEN_FWD_KIN_SOLVER_NAME }; /**< @brief Name of this solver */
+};
+
+/**
+ * @brief Factory creating the forward kinematics of a generated kinematic chain
+ * @details The links and joints of the generated chain must exist in the scene graph. The optional 'base_link' and
+ * 'tip_link' config entries must match the generated chain.
+ */
+template <typename Model>
+class CodegenFwdKinFactory : public FwdKinFactory
+{
+public:
+  ForwardKinematics::UPtr create(const std::string& solver_name,
+                                 const tesseract_scene_graph::SceneGraph& scene_graph,
+                                 const tesseract_scene_graph::SceneState& /*scene_state*/,
+                                 const KinematicsPluginFactory& /*plugin_factory*/,
+                                 const YAML::Node& config) const override final
+  {
+    try
+    {
+      if (YAML::Node n = config["base_link"])
+      {
+        if (n.as<std::string>() != Model::BASE_LINK_NAME)
+          throw std::runtime_error("CodegenFwdKinFactory, 'base_link' does not match the generated chain");
+      }
+
+      if (YAML::Node n = config["tip_link"])
+      {
+        if (n.as<std::string>() != Model::TIP_LINK_NAME)
+          throw std::runtime_error("CodegenFwdKinFactory, 'tip_link' does not match the generated chain");
+      }
+
+      if (scene_graph.getLink(Model::BASE_LINK_NAME) == nullptr || scene_graph.getLink(Model::TIP_LINK_NAME) == nullptr)
+        throw std::runtime_error("CodegenFwdKinFactory, the scene graph is missing a link of the generated chain");
+
+      for (const auto* joint_name : Model::JOINT_NAMES)
+      {
+        if (scene_graph.getJoint(joint_name) == nullptr)
+          throw std::runtime_error("CodegenFwdKinFactory, the scene graph is missing joint '" +
+                                   std::string(joint_name) + "'");
+      }
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("CodegenFwdKinFactory: Failed to create solver! Details: %s", e.what());
+      return nullptr;
+    }
+
+    return std::make_unique<CodegenFwdKin<Model>>(solver_name);
+  }
+};
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_H
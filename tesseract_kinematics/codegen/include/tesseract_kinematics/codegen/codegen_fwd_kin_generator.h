@@ -0,0 +1,61 @@
+/**
+ * @file codegen_fwd_kin_generator.h
+ * @brief Generates a specialized forward kinematics solver for a fixed kinematic chain
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_GENERATOR_H
+#define TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_GENERATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_scene_graph/graph.h>
+
+namespace tesseract_kinematics
+{
+/**
+ * @brief Generate a C++ header with the forward kinematics and jacobian of a kinematic chain
+ *
+ * The generated header defines a struct that can be used with CodegenFwdKin and CodegenFwdKinFactory. The kinematics
+ * are fully unrolled: the joint axes are fixed, consecutive static transforms including fixed joints are folded
+ * together, and every constant is written as a literal so the compiler can fold it.
+ *
+ * Only revolute, continuous, prismatic and fixed joints without mimic are supported.
+ *
+ * @param scene_graph The scene graph
+ * @param base_link The base link of the chain, it must be an ancestor of the tip link
+ * @param tip_link The tip link of the chain
+ * @param class_name The name of the generated struct
+ * @param name_space The namespace of the generated struct
+ * @return The generated header, throws if the chain is not supported
+ */
+std::string generateCodegenFwdKin(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                  const std::string& base_link,
+                                  const std::string& tip_link,
+                                  const std::string& class_name,
+                                  const std::string& name_space);
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_CODEGEN_FWD_KIN_GENERATOR_H
@@ -0,0 +1,359 @@
+/**
+ * @file codegen_fwd_kin_generator.cpp
+ * @brief Generates a specialized forward kinematics solver for a fixed kinematic chain
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/codegen/codegen_fwd_kin_generator.h>
+
+namespace tesseract_kinematics
+{
+namespace
+{
+/** @brief An active joint of the chain and the folded static transform from the previous active joint */
+struct CodegenJoint
+{
+  tesseract_scene_graph::JointType type;
+  Eigen::Vector3d axis;
+  Eigen::Isometry3d static_tf;
+  std::string name;
+};
+
+/** @brief The shortest string that reads back as the same double */
+std::string toString(double value)
+{
+  if (value == 0)
+    return "0";
+
+  std::string result;
+  for (int precision = 1; precision <= 17; ++precision)
+  {
+    std::ostringstream os;
+    os.imbue(std::locale::classic());
+    os << std::setprecision(precision) << value;
+    result = os.str();
+
+    std::istringstream is(result);
+    is.imbue(std::locale::classic());
+    double check{ 0 };
+    is >> check;
+    if (check == value)
+      break;
+  }
+
+  return result;
+}
+
+/** @brief Join terms with + or -, a term starting with - is subtracted */
+std::string joinTerms(const std::vector<std::string>& terms)
+{
+  if (terms.empty())
+    return "0";
+
+  std::string result = terms.front();
+  for (std::size_t i = 1; i < terms.size(); ++i)
+  {
+    if (terms[i].front() == '-')
+      result += " - " + terms[i].substr(1);
+    else
+      result += " + " + terms[i];
+  }
+  return result;
+}
+
+/** @brief A variable scaled by a coefficient, empty if the coefficient is zero */
+std::string scaledTerm(double coeff, const std::string& variable)
+{
+  if (coeff == 0)
+    return "";
+
+  if (coeff == 1)
+    return variable;
+
+  if (coeff == -1)
+    return "-" + variable;
+
+  return toString(coeff) + " * " + variable;
+}
+
+/** @brief The index of the axis if it is a unit axis of the frame, -1 otherwise */
+int unitAxisIndex(const Eigen::Vector3d& axis)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    if (std::abs(axis(i)) == 1 && axis((i + 1) % 3) == 0 && axis((i + 2) % 3) == 0)
+      return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief An element of the rotation about an axis using Rodrigues' formula
+ * @details R = c * I + s * [a]x + v * a * a^T, where v = 1 - c
+ */
+std::string rotationElement(const Eigen::Vector3d& a,
+                            int r,
+                            int k,
+                            const std::string& c,
+                            const std::string& s,
+                            const std::string& v)
+{
+  Eigen::Matrix3d skew;
+  skew << 0, -a.z(), a.y(), a.z(), 0, -a.x(), -a.y(), a.x(), 0;
+  const double aa = a(r) * a(k);
+
+  std::vector<std::string> terms;
+  if (r == k)
+  {
+    // The element along a unit axis is c + (1 - c) = 1
+    if (aa == 1)
+      return "1";
+
+    terms.push_back(c);
+  }
+
+  for (const auto& term : { scaledTerm(skew(r, k), s), scaledTerm(aa, v) })
+  {
+    if (!term.empty())
+      terms.push_back(term);
+  }
+
+  return joinTerms(terms);
+}
+
+/** @brief Write the code applying a static transform to pose */
+void writeStaticTransform(std::ostream& os, const Eigen::Isometry3d& tf)
+{
+  const Eigen::Vector3d& t = tf.translation();
+  if (!t.isZero(0))
+    os << "    pose.translate(Eigen::Vector3d(" << toString(t.x()) << ", " << toString(t.y()) << ", "
+       << toString(t.z()) << "));\n";
+
+  if (!tf.linear().isIdentity(0))
+  {
+    os << "    pose.rotate((Eigen::Matrix3d() << ";
+    for (int r = 0; r < 3; ++r)
+    {
+      for (int k = 0; k < 3; ++k)
+        os << ((r == 0 && k == 0) ? "" : ", ") << toString(tf.linear()(r, k));
+    }
+    os << ").finished());\n";
+  }
+}
+
+/** @brief Write the code computing the world axis of a joint before it is applied */
+void writeJointAxis(std::ostream& os, const CodegenJoint& joint, std::size_t i)
+{
+  const int unit_axis = unitAxisIndex(joint.axis);
+  os << "    const Eigen::Vector3d z" << i << " = ";
+  if (unit_axis >= 0)
+  {
+    os << ((joint.axis(unit_axis) < 0) ? "-" : "") << "pose.linear().col(" << unit_axis << ");\n";
+  }
+  else
+  {
+    os << "pose.linear() * Eigen::Vector3d(" << toString(joint.axis.x()) << ", " << toString(joint.axis.y()) << ", "
+       << toString(joint.axis.z()) << ");\n";
+  }
+
+  if (joint.type != tesseract_scene_graph::JointType::PRISMATIC)
+    os << "    const Eigen::Vector3d p" << i << " = pose.translation();\n";
+}
+
+/** @brief Write the code applying a joint to pose */
+void writeJoint(std::ostream& os, const CodegenJoint& joint, std::size_t i)
+{
+  const std::string q = "q[" + std::to_string(i) + "]";
+  if (joint.type == tesseract_scene_graph::JointType::PRISMATIC)
+  {
+    std::vector<std::string> components;
+    for (int k = 0; k < 3; ++k)
+    {
+      std::string term = scaledTerm(joint.axis(k), q);
+      components.push_back(term.empty() ? "0" : term);
+    }
+    os << "    pose.translate(Eigen::Vector3d(" << components[0] << ", " << components[1] << ", " << components[2]
+       << "));\n";
+    return;
+  }
+
+  const std::string c = "c" + std::to_string(i);
+  const std::string s = "s" + std::to_string(i);
+  const std::string v = "v" + std::to_string(i);
+  os << "    pose.rotate((Eigen::Matrix3d() << ";
+  for (int r = 0; r < 3; ++r)
+  {
+    for (int k = 0; k < 3; ++k)
+      os << ((r == 0 && k == 0) ? "" : ", ") << rotationElement(joint.axis, r, k, c, s, v);
+  }
+  os << ").finished());\n";
+}
+
+/** @brief Write the sine and cosine of the revolute joints */
+void writeTrigonometry(std::ostream& os, const std::vector<CodegenJoint>& joints)
+{
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    if (joints[i].type == tesseract_scene_graph::JointType::PRISMATIC)
+      continue;
+
+    os << "    const double c" << i << " = std::cos(q[" << i << "]);\n";
+    os << "    const double s" << i << " = std::sin(q[" << i << "]);\n";
+    if (unitAxisIndex(joints[i].axis) < 0)
+      os << "    const double v" << i << " = 1 - c" << i << ";\n";
+  }
+}
+
+/** @brief Write the unrolled kinematics of the chain, optionally recording the world axis of each joint */
+void writeChain(std::ostream& os,
+                const std::vector<CodegenJoint>& joints,
+                const Eigen::Isometry3d& tip_tf,
+                bool jacobian)
+{
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    writeStaticTransform(os, joints[i].static_tf);
+    if (jacobian)
+      writeJointAxis(os, joints[i], i);
+    writeJoint(os, joints[i], i);
+  }
+  writeStaticTransform(os, tip_tf);
+}
+}  // namespace
+
+std::string generateCodegenFwdKin(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                  const std::string& base_link,
+                                  const std::string& tip_link,
+                                  const std::string& class_name,
+                                  const std::string& name_space)
+{
+  if (scene_graph.getLink(base_link) == nullptr)
+    throw std::runtime_error("generateCodegenFwdKin, base link '" + base_link + "' does not exist");
+
+  if (scene_graph.getLink(tip_link) == nullptr)
+    throw std::runtime_error("generateCodegenFwdKin, tip link '" + tip_link + "' does not exist");
+
+  // Walk from the tip link up to the base link
+  std::vector<tesseract_scene_graph::Joint::ConstPtr> chain;
+  for (std::string link_name = tip_link; link_name != base_link;)
+  {
+    std::vector<tesseract_scene_graph::Joint::ConstPtr> inbound_joints = scene_graph.getInboundJoints(link_name);
+    if (inbound_joints.empty())
+      throw std::runtime_error("generateCodegenFwdKin, base link '" + base_link + "' is not an ancestor of tip link '" +
+                               tip_link + "'");
+
+    chain.push_back(inbound_joints.front());
+    link_name = inbound_joints.front()->parent_link_name;
+  }
+  std::reverse(chain.begin(), chain.end());
+
+  // Fold the static transforms, including fixed joints, into the active joint that follows them
+  std::vector<CodegenJoint> joints;
+  Eigen::Isometry3d static_tf = Eigen::Isometry3d::Identity();
+  for (const auto& joint : chain)
+  {
+    if (joint->mimic != nullptr)
+      throw std::runtime_error("generateCodegenFwdKin, mimic joint '" + joint->getName() + "' is not supported");
+
+    static_tf = static_tf * joint->parent_to_joint_origin_transform;
+    switch (joint->type)
+    {
+      case tesseract_scene_graph::JointType::FIXED:
+        break;
+      case tesseract_scene_graph::JointType::REVOLUTE:
+      case tesseract_scene_graph::JointType::CONTINUOUS:
+      case tesseract_scene_graph::JointType::PRISMATIC:
+        joints.push_back(CodegenJoint{ joint->type, joint->axis, static_tf, joint->getName() });
+        static_tf = Eigen::Isometry3d::Identity();
+        break;
+      default:
+        throw std::runtime_error("generateCodegenFwdKin, joint '" + joint->getName() + "' has an unsupported type");
+    }
+  }
+
+  if (joints.empty())
+    throw std::runtime_error("generateCodegenFwdKin, the chain has no active joints");
+
+  std::string guard = name_space + "_" + class_name + "_H";
+  for (std::size_t pos = guard.find("::"); pos != std::string::npos; pos = guard.find("::", pos))
+    guard.replace(pos, 2, "_");
+  std::transform(guard.begin(), guard.end(), guard.begin(), [](unsigned char c) { return std::toupper(c); });
+
+  std::ostringstream os;
+  os.imbue(std::locale::classic());
+  os << "// Generated by tesseract_kinematics generateCodegenFwdKin, do not edit\n";
+  os << "#ifndef " << guard << "\n";
+  os << "#define " << guard << "\n\n";
+  os << "#include <array>\n";
+  os << "#include <cmath>\n";
+  os << "#include <Eigen/Geometry>\n\n";
+  os << "namespace " << name_space << "\n{\n";
+  os << "/** @brief The kinematics of the chain from '" << base_link << "' to '" << tip_link << "' */\n";
+  os << "struct " << class_name << "\n{\n";
+  os << "  static constexpr Eigen::Index NUM_JOINTS{ " << joints.size() << " };\n";
+  os << "  static constexpr const char* BASE_LINK_NAME{ \"" << base_link << "\" };\n";
+  os << "  static constexpr const char* TIP_LINK_NAME{ \"" << tip_link << "\" };\n";
+  os << "  static constexpr std::array<const char*, " << joints.size() << "> JOINT_NAMES{ {";
+  for (std::size_t i = 0; i < joints.size(); ++i)
+    os << ((i == 0) ? " " : ", ") << "\"" << joints[i].name << "\"";
+  os << " } };\n\n";
+
+  os << "  /** @brief Compute the transform of the tip link relative to the base link */\n";
+  os << "  static void calcFwdKin(Eigen::Isometry3d& pose, const double* q)\n  {\n";
+  writeTrigonometry(os, joints);
+  os << "    pose.setIdentity();\n";
+  writeChain(os, joints, static_tf, false);
+  os << "  }\n\n";
+
+  os << "  /** @brief Compute the jacobian of the tip link in the base link frame */\n";
+  os << "  static void calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian, const double* q)\n  {\n";
+  writeTrigonometry(os, joints);
+  os << "    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();\n";
+  writeChain(os, joints, static_tf, true);
+  for (std::size_t i = 0; i < joints.size(); ++i)
+  {
+    if (joints[i].type == tesseract_scene_graph::JointType::PRISMATIC)
+      os << "    jacobian.col(" << i << ") << z" << i << ", Eigen::Vector3d::Zero();\n";
+    else
+      os << "    jacobian.col(" << i << ") << z" << i << ".cross(pose.translation() - p" << i << "), z" << i << ";\n";
+  }
+  os << "  }\n";
+  os << "};\n\n";
+  os << "}  // namespace " << name_space << "\n\n";
+  os << "#endif  // " << guard << "\n";
+
+  return os.str();
+}
+
+}  // namespace tesseract_kinematics
@@ -0,0 +1,74 @@
+/**
+ * @file cached_factory.h
+ * @brief Cached inverse kinematics factory.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_CACHED_FACTORY_H
+#define TESSERACT_KINEMATICS_CACHED_FACTORY_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <mutex>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+#include <tesseract_kinematics/core/cached_inv_kin.h>
+
+namespace tesseract_kinematics
+{
+/**
+ * @brief Creates a CachedInvKin wrapping the inverse kinematics described by the 'solver' entry of the config
+ * @details The solvers created for the same solver name and config share a cache as long as the kinematics they are
+ * created for do not change. The kinematics are compared using the joints between the base link and tip links of the
+ * wrapped solver, the limits of its joints and the transform from its working frame to its base link. When the
+ * environment rebuilds its kinematic groups after a change, a new cache is started if any of these changed.
+ */
+class CachedInvKinFactory : public InvKinFactory
+{
+  InverseKinematics::UPtr create(const std::string& solver_name,
+                                 const tesseract_scene_graph::SceneGraph& scene_graph,
+                                 const tesseract_scene_graph::SceneState& scene_state,
+                                 const KinematicsPluginFactory& plugin_factory,
+                                 const YAML::Node& config) const override final;
+
+private:
+  /** @brief A cache along with the kinematics it was created for */
+  struct CacheEntry
+  {
+    std::vector<double> kinematics;
+    IKSolutionCache::Ptr cache;
+  };
+
+  /** @brief The caches of the solvers created, keyed by solver name and config */
+  mutable std::map<std::string, CacheEntry> caches_;
+
+  /** @brief The mutex used when accessing the caches */
+  mutable std::mutex mutex_;
+};
+
+TESSERACT_PLUGIN_ANCHOR_DECL(CachedInvKinFactoriesAnchor)
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_CACHED_FACTORY_H
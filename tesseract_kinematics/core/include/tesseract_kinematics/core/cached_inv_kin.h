@@ -0,0 +1,232 @@
+/**
+ * @file cached_inv_kin.h
+ * @brief Inverse kinematics decorator returning cached solutions for repeated requests.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_CACHED_INVERSE_KINEMATICS_H
+#define TESSERACT_KINEMATICS_CACHED_INVERSE_KINEMATICS_H
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_kinematics
+{
+static const std::string DEFAULT_CACHED_INV_KIN_SOLVER_NAME = "CachedInvKin";
+
+/**
+ * @brief A cache of inverse kinematics solutions
+ * @details A request is identified by the pose of every tip link and the seed, each discretised by a resolution. The
+ * position is discretised by the position resolution and the coefficients of the unit quaternion, with a non negative
+ * scalar part, by the orientation resolution. Requests falling into the same cell return the same solutions, so the
+ * resolutions should be small compared to the accuracy required of the solutions.
+ *
+ * The cache may be shared between threads.
+ */
+class IKSolutionCache
+{
+public:
+  using Ptr = std::shared_ptr<IKSolutionCache>;
+  using ConstPtr = std::shared_ptr<const IKSolutionCache>;
+  using UPtr = std::unique_ptr<IKSolutionCache>;
+  using ConstUPtr = std::unique_ptr<const IKSolutionCache>;
+
+  /**
+   * @brief Constructor
+   * @param cache_size The maximum number of requests stored, the oldest request is removed when it is reached
+   * @param position_resolution The resolution the tip link positions are discretised by, must be greater than zero
+   * @param orientation_resolution The resolution the tip link orientations are discretised by, must be greater than
+   * zero
+   * @param seed_resolution The resolution the seed is discretised by, zero ignores the seed which suits solvers that do
+   * not depend on it like closed form solvers
+   */
+  explicit IKSolutionCache(std::size_t cache_size = 1024,
+                           double position_resolution = 1e-6,
+                           double orientation_resolution = 1e-6,
+                           double seed_resolution = 1e-6);
+  ~IKSolutionCache() = default;
+  IKSolutionCache(const IKSolutionCache&) = delete;
+  IKSolutionCache& operator=(const IKSolutionCache&) = delete;
+  IKSolutionCache(IKSolutionCache&&) = delete;
+  IKSolutionCache& operator=(IKSolutionCache&&) = delete;
+
+  /**
+   * @brief Get the cached solutions of a request
+   * @param solutions The cached solutions, only modified if the request is cached
+   * @param tip_link_names The tip link names of the solver
+   * @param tip_link_poses The tip link poses of the request
+   * @param seed The seed of the request
+   * @return True if the request is cached, otherwise false
+   */
+  bool get(IKSolutions& solutions,
+           const std::vector<std::string>& tip_link_names,
+           const tesseract_common::TransformMap& tip_link_poses,
+           const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Store the solutions of a request
+   * @param tip_link_names The tip link names of the solver
+   * @param tip_link_poses The tip link poses of the request
+   * @param seed The seed of the request
+   * @param solutions The solutions of the request
+   */
+  void insert(const std::vector<std::string>& tip_link_names,
+              const tesseract_common::TransformMap& tip_link_poses,
+              const Eigen::Ref<const Eigen::VectorXd>& seed,
+              const IKSolutions& solutions);
+
+  /** @brief Remove all cached requests */
+  void clear();
+
+  /** @brief Get the number of cached requests */
+  std::size_t size() const;
+
+  /**
+   * @brief Set the maximum number of requests stored
+   * @param size The size of the cache
+   */
+  void setCacheSize(std::size_t size);
+
+  /** @brief Get the maximum number of requests stored */
+  std::size_t getCacheSize() const;
+
+  /** @brief Get the resolution the tip link positions are discretised by */
+  double getPositionResolution() const;
+
+  /** @brief Get the resolution the tip link orientations are discretised by */
+  double getOrientationResolution() const;
+
+  /** @brief Get the resolution the seed is discretised by, zero if the seed is ignored */
+  double getSeedResolution() const;
+
+private:
+  /** @brief The hash of a request key */
+  struct KeyHash
+  {
+    std::size_t operator()(const std::vector<long>& key) const;
+  };
+
+  /** @brief The maximum number of requests stored */
+  std::size_t cache_size_;
+
+  /** @brief The resolution the tip link positions are discretised by */
+  double position_resolution_;
+
+  /** @brief The resolution the tip link orientations are discretised by */
+  double orientation_resolution_;
+
+  /** @brief The resolution the seed is discretised by */
+  double seed_resolution_;
+
+  /** @brief The cached solutions */
+  std::unordered_map<std::vector<long>, IKSolutions, KeyHash> cache_;
+
+  /** @brief The cached keys ordered from oldest to newest, these point to the keys stored in cache_ */
+  std::deque<const std::vector<long>*> order_;
+
+  /** @brief The mutex used when reading and writing to the cache */
+  mutable std::shared_mutex mutex_;
+
+  /**
+   * @brief Create the key of a request
+   * @return False if a tip link pose is missing, otherwise true
+   */
+  bool createKey(std::vector<long>& key,
+                 const std::vector<std::string>& tip_link_names,
+                 const tesseract_common::TransformMap& tip_link_poses,
+                 const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /** @brief Remove the oldest requests until the cache size is satisfied, this does not take a lock */
+  void shrinkHelper();
+};
+
+/**
+ * @brief Inverse kinematics decorator returning cached solutions for repeated requests
+ * @details Requests are solved by the wrapped solver the first time and returned from the cache afterwards. Copies
+ * made by clone() share the cache, so the copies of a kinematic group handed out by the environment benefit from each
+ * others requests.
+ *
+ * The cached solutions are the unfiltered solutions of the wrapped solver, so joint limits applied by the kinematic
+ * group after solving do not affect the cache. The cache is not aware of changes to the kinematics; the
+ * CachedInvKinFactory only shares a cache between solvers it creates for identical kinematics.
+ */
+class CachedInvKin : public InverseKinematics
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<CachedInvKin>;
+  using ConstPtr = std::shared_ptr<const CachedInvKin>;
+  using UPtr = std::unique_ptr<CachedInvKin>;
+  using ConstUPtr = std::unique_ptr<const CachedInvKin>;
+
+  ~CachedInvKin() override = default;
+  CachedInvKin(const CachedInvKin& other);
+  CachedInvKin& operator=(const CachedInvKin& other);
+  CachedInvKin(CachedInvKin&&) = default;
+  CachedInvKin& operator=(CachedInvKin&&) = default;
+
+  /**
+   * @brief Construct a caching decorator
+   * @param solver The inverse kinematics solving the requests not in the cache
+   * @param cache The cache, a new cache with default settings is created if it is a nullptr
+   * @param solver_name The name given to the solver
+   */
+  CachedInvKin(InverseKinematics::UPtr solver,
+               IKSolutionCache::Ptr cache = nullptr,
+               std::string solver_name = DEFAULT_CACHED_INV_KIN_SOLVER_NAME);
+
+  using InverseKinematics::calcInvKin;
+  IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
+                         const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
+  /** @brief Get the cache, which is shared with the clones of this solver */
+  IKSolutionCache::Ptr getCache() const;
+
+  /** @brief Get the inverse kinematics solving the requests not in the cache */
+  const InverseKinematics& getSolver() const;
+
+  std::vector<std::string> getJointNames() const override final;
+  Eigen::Index numJoints() const override final;
+  std::string getBaseLinkName() const override final;
+  std::string getWorkingFrame() const override final;
+  std::vector<std::string> getTipLinkNames() const override final;
+  std::string getSolverName() const override final;
+  InverseKinematics::UPtr clone() const override final;
+
+private:
+  InverseKinematics::UPtr solver_;          /**< @brief The solver of the requests not in the cache */
+  IKSolutionCache::Ptr cache_;              /**< @brief The cache shared with the clones */
+  std::vector<std::string> tip_link_names_; /**< @brief The tip link names of the solver */
+  std::string solver_name_{ DEFAULT_CACHED_INV_KIN_SOLVER_NAME }; /**< @brief Name of this solver */
+};
+}  // namespace tesseract_kinematics
+#endif  // TESSERACT_KINEMATICS_CACHED_INVERSE_KINEMATICS_H
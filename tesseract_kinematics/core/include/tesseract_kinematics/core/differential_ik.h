@@ -0,0 +1,186 @@
+/**
+ * @file differential_ik.h
+ * @brief Real-time differential inverse kinematics of a joint group.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_DIFFERENTIAL_IK_H
+#define TESSERACT_KINEMATICS_DIFFERENTIAL_IK_H
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/joint_group.h>
+
+namespace tesseract_kinematics
+{
+/** @brief The settings of the differential inverse kinematics */
+struct DifferentialIKConfig
+{
+  /** @brief The smallest singular value of the jacobian below which the solution is damped */
+  double singular_value_threshold{ 0.05 };
+
+  /** @brief The damping factor applied at a singularity, it decreases to zero at the singular value threshold */
+  double max_damping{ 0.05 };
+
+  /** @brief The distance kept from the position limits of the joints */
+  double joint_limit_margin{ 0 };
+
+  /** @brief If true the joint velocities are scaled down to satisfy the velocity limits of the joints */
+  bool enforce_velocity_limits{ true };
+};
+
+/** @brief Information about the last solve of the differential inverse kinematics */
+struct DifferentialIKResult
+{
+  /** @brief The smallest singular value of the jacobian of the unlocked joints */
+  double min_singular_value{ 0 };
+
+  /** @brief The damping factor used */
+  double damping{ 0 };
+
+  /** @brief The factor the joint velocities were scaled by to satisfy the velocity limits, one if not scaled */
+  double velocity_scale{ 1 };
+
+  /** @brief The number of joints locked because they would leave their position limits */
+  Eigen::Index num_locked_joints{ 0 };
+};
+
+/**
+ * @brief Solves the joint velocities of a joint group for a tip link twist, intended for real-time servoing
+ * @details The joint velocities are solved by damped least squares, qd = J^T (J J^T + lambda^2 I)^-1 v, where J is
+ * the 6 x n jacobian of the tip link. The system is solved in the six dimensional task space with fixed size matrices,
+ * so the cost of the decomposition does not depend on the number of joints. The damping is zero away from
+ * singularities and increases as the smallest singular value of the jacobian drops below the threshold.
+ *
+ * A joint which would leave its position limits within the time step is locked and the twist is solved again with
+ * the remaining joints. Afterwards all joint velocities are scaled by the same factor to satisfy the velocity limits,
+ * which preserves the direction of the tip link motion.
+ *
+ * All buffers are allocated by the constructor and the jacobian is calculated without a SceneState, so solve() does
+ * not allocate memory after its first call on a thread. An instance is not thread safe, each control loop should own
+ * its own instance.
+ */
+class DifferentialIK
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<DifferentialIK>;
+  using ConstPtr = std::shared_ptr<const DifferentialIK>;
+  using UPtr = std::unique_ptr<DifferentialIK>;
+  using ConstUPtr = std::unique_ptr<const DifferentialIK>;
+
+  /**
+   * @brief Constructor
+   * @param joint_group The joint group, throws if it is null
+   * @param tip_link_name The link the twist is applied to, throws if it is not a link of the joint group
+   * @param config The settings of the solver
+   */
+  DifferentialIK(JointGroup::ConstPtr joint_group, std::string tip_link_name, DifferentialIKConfig config = {});
+  ~DifferentialIK() = default;
+  DifferentialIK(const DifferentialIK&) = default;
+  DifferentialIK& operator=(const DifferentialIK&) = default;
+  DifferentialIK(DifferentialIK&&) = default;
+  DifferentialIK& operator=(DifferentialIK&&) = default;
+
+  /**
+   * @brief Solve the joint velocities for a twist of the tip link
+   * @param joint_velocities The solved joint velocities, must be the size of the number of joints
+   * @param joint_angles The current joint angles, must be the size of the number of joints
+   * @param twist The linear and angular velocity of the tip link origin relative to the joint group base link
+   * @param dt The time step used to check the position limits, must be greater than zero
+   * @return False if the inputs are invalid or the system could not be solved, otherwise true
+   */
+  bool solve(Eigen::Ref<Eigen::VectorXd> joint_velocities,
+             const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+             const Eigen::Ref<const Eigen::Matrix<double, 6, 1>>& twist,
+             double dt);
+
+  /** @brief Get information about the last solve */
+  const DifferentialIKResult& getResult() const;
+
+  /** @brief Get the jacobian of the tip link calculated by the last solve */
+  const Eigen::MatrixXd& getJacobian() const;
+
+  /** @brief Get the settings of the solver */
+  const DifferentialIKConfig& getConfig() const;
+
+  /** @brief Set the settings of the solver */
+  void setConfig(const DifferentialIKConfig& config);
+
+  /** @brief Get the joint group */
+  const JointGroup& getJointGroup() const;
+
+  /** @brief Get the link the twist is applied to */
+  const std::string& getTipLinkName() const;
+
+private:
+  /** @brief The joint group */
+  JointGroup::ConstPtr joint_group_;
+
+  /** @brief The link the twist is applied to */
+  std::string tip_link_name_;
+
+  /** @brief The settings of the solver */
+  DifferentialIKConfig config_;
+
+  /** @brief The position limits of the joints */
+  Eigen::MatrixX2d joint_limits_;
+
+  /** @brief The velocity limits of the joints */
+  Eigen::VectorXd velocity_limits_;
+
+  /** @brief The jacobian of the tip link */
+  Eigen::MatrixXd jacobian_;
+
+  /** @brief The jacobian with the columns of the locked joints set to zero */
+  Eigen::MatrixXd active_jacobian_;
+
+  /** @brief Indicates the joints locked at their position limits */
+  Eigen::Array<bool, Eigen::Dynamic, 1> locked_;
+
+  /** @brief The damped task space matrix J J^T + lambda^2 I */
+  Eigen::Matrix<double, 6, 6> jjt_;
+
+  /** @brief The decomposition of the task space matrix */
+  Eigen::LDLT<Eigen::Matrix<double, 6, 6>> ldlt_;
+
+  /** @brief The eigenvalue solver used for the smallest singular value */
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix<double, 6, 6>> eigen_solver_;
+
+  /** @brief The solution in task space */
+  Eigen::Matrix<double, 6, 1> task_;
+
+  /** @brief Information about the last solve */
+  DifferentialIKResult result_;
+};
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_DIFFERENTIAL_IK_H
@@ -78,6 +78,34 @@ public:
   virtual IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                  const Eigen::Ref<const Eigen::VectorXd>& seed) const = 0;
 
+  /**
+   * @brief Calculates joint solutions given a pose for each tip link, writing them to a caller owned matrix
+   * @details Each solution is written to a column of the matrix. The matrix is only resized if it does not have a row
+   * per joint or has too few columns, so reusing it between calls avoids allocating every solution. The default
+   * implementation copies the solutions of the other overload, closed form solvers override it to write the solutions
+   * directly.
+   * @param solutions The matrix the solutions are written to, one solution per column
+   * @param tip_link_poses A map of poses corresponding to each tip link provided in getTipLinkNames and relative to the
+   * working frame of the kinematics group for which to solve inverse kinematics
+   * @param seed Vector of seed joint angles (size must match number of joints in kinematic object)
+   * @return The number of solutions, which are the first columns of the matrix
+   */
+  virtual Eigen::Index calcInvKin(Eigen::MatrixXd& solutions,
+                                  const tesseract_common::TransformMap& tip_link_poses,
+                                  const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Calculates joint solutions for many poses of a single tip link
+   * @details The default implementation solves one pose at a time. Closed form solvers override it to solve several
+   * poses at once.
+   * @param solutions The buffer the solutions are written to, it is cleared first
+   * @param tip_link_poses The poses of the tip link relative to the working frame, the solver must have one tip link
+   * @param seed Vector of seed joint angles used for every pose (size must match number of joints in kinematic object)
+   */
+  virtual void calcInvKinBatch(IKSolutionsBuffer& solutions,
+                               const tesseract_common::VectorIsometry3d& tip_link_poses,
+                               const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
   /**
    * @brief Get list of joint names for kinematic object
    * @return A vector of joint names, joint_list_
@@ -26,6 +26,7 @@
 #ifndef TESSERACT_KINEMATICS_JOINT_GROUP_H
 #define TESSERACT_KINEMATICS_JOINT_GROUP_H
 
+#include <tesseract_common/link_transforms.h>
 #include <tesseract_common/types.h>
 #include <tesseract_scene_graph/scene_state.h>
 #include <tesseract_state_solver/kdl/kdl_state_solver.h>
@@ -77,6 +78,40 @@ public:
    */
   tesseract_common::TransformMap calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const;
 
+  /**
+   * @brief Calculates the transforms of only the provided links, without building a TransformMap
+   * @details This is intended for repeated calls that only need a few links, like the tool pose in a cost function.
+   * Only the transforms of the requested links are calculated and no map or scene state is built.
+   * @param link_transforms The buffer the transform of each link relative to the root is written to, it must be the
+   * same size as link_indices
+   * @param joint_angles Vector of joint angles (size must match number of joints in robot chain)
+   * @param link_indices The index of each link, see getLinkIndices
+   */
+  void calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                  const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                  const std::vector<long>& link_indices) const;
+
+  /**
+   * @brief Get the index of each link, used to calculate the transforms of only these links
+   * @param link_names The link names, throws if a link does not exist
+   * @return The index of each link
+   */
+  std::vector<long> getLinkIndices(const std::vector<std::string>& link_names) const;
+
+  /**
+   * @brief Calculates the transforms of the links of a LinkTransforms, without building a TransformMap
+   * @details If link_transforms has no name table it is created for all links of the group, see getLinkNameTable. The
+   * links of the name table of the group are resolved without any lookup, other name tables are resolved by name and
+   * throw if a link does not exist.
+   * @param link_transforms The link transforms relative to the root to update
+   * @param joint_angles Vector of joint angles (size must match number of joints in robot chain)
+   */
+  void calcFwdKin(tesseract_common::LinkTransforms& link_transforms,
+                  const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const;
+
+  /** @brief Get the table of all link names of the group, in the order of getLinkNames */
+  const tesseract_common::LinkNameTable::ConstPtr& getLinkNameTable() const;
+
   /**
    * @brief Calculated jacobian of robot given joint angles
    * @param joint_angles Input vector of joint angles
@@ -86,6 +121,18 @@ public:
   Eigen::MatrixXd calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                const std::string& link_name) const;
 
+  /**
+   * @brief Calculated jacobian of robot given joint angles into a preallocated matrix
+   * @details No memory is allocated after the first call on a thread, intended for real-time loops
+   * @param jacobian The jacobian at the provided link_name relative to the joint group base link, must be 6 x
+   * numJoints()
+   * @param joint_angles Input vector of joint angles
+   * @param link_name The frame that the jacobian is calculated for
+   */
+  void calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                    const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                    const std::string& link_name) const;
+
   /**
    * @brief Calculated jacobian of robot given joint angles
    * @param joint_angles Input vector of joint angles
@@ -174,6 +221,15 @@ public:
    */
   void setLimits(const tesseract_common::KinematicLimits& limits);
 
+  /**
+   * @brief Get the upper bound of the motion of the collision geometry per unit of motion of each joint
+   * @details No point on the collision geometry of the links moves further than the sum of the absolute joint motion
+   * times these bounds, for any motion of the joints. The bound of a revolute joint is in meters per radian and the
+   * bound of a prismatic joint is one. A joint whose motion can not be bounded, like a floating joint, is infinite.
+   * @return A vector of motion bounds the same size as the number of joints
+   */
+  const Eigen::VectorXd& getJointMotionBounds() const;
+
   /**
    * @brief Get vector indicating which joints are capable of producing redundant solutions
    * @return A vector of joint indices
@@ -202,14 +258,18 @@ public:
 protected:
   std::string name_;
   tesseract_scene_graph::SceneState state_;
-  tesseract_scene_graph::StateSolver::UPtr state_solver_;
+  tesseract_scene_graph::KDLStateSolver::UPtr state_solver_;
   std::vector<std::string> joint_names_;
   std::vector<std::string> link_names_;
+  tesseract_common::LinkNameTable::ConstPtr link_name_table_;
   std::vector<std::string> static_link_names_;
   tesseract_common::TransformMap static_link_transforms_;
+  std::vector<long> solver_link_indices_;
+  tesseract_common::VectorIsometry3d link_transforms_;
   tesseract_common::KinematicLimits limits_;
   std::vector<Eigen::Index> redundancy_indices_;
   std::vector<Eigen::Index> jacobian_map_;
+  Eigen::VectorXd motion_bounds_;
 };
 
 }  // namespace tesseract_kinematics
@@ -32,6 +32,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/executor.h>
+#include <tesseract_common/metrics.h>
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/inverse_kinematics.h>
 
@@ -74,6 +76,37 @@ struct KinGroupIKInput
 };
 using KinGroupIKInputs = tesseract_common::AlignedVector<KinGroupIKInput>;
 
+/** @brief The settings used by KinematicGroup::calcCartesianPath */
+struct KinGroupCartesianPathSettings
+{
+  /** @brief The maximum distance of the tip link from the straight line between the poses */
+  double translation_tolerance{ 0.001 };
+
+  /** @brief The maximum angle of the tip link from the interpolated orientation between the poses */
+  double rotation_tolerance{ 0.01 };
+
+  /** @brief The maximum number of states of the path, calcCartesianPath fails if more are required */
+  std::size_t max_states{ 1000 };
+};
+
+/** @brief A state of a cartesian path calculated by KinematicGroup::calcCartesianPath */
+struct KinGroupCartesianState
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief The pose of the tip link relative to the working frame on the straight line between the poses */
+  Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+
+  /** @brief The joint values reaching the pose */
+  Eigen::VectorXd joint_values;
+
+  /** @brief The link transforms at the joint values, the same as JointGroup::calcFwdKin for collision checking */
+  tesseract_common::TransformMap link_transforms;
+};
+using KinGroupCartesianPath = tesseract_common::AlignedVector<KinGroupCartesianState>;
+
 class KinematicGroup : public JointGroup
 {
 public:
@@ -125,6 +158,68 @@ public:
    */
   IKSolutions calcInvKin(const KinGroupIKInput& tip_link_pose, const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
+  /**
+   * @brief Calculates joint solutions given a pose, writing them to a caller owned matrix
+   * @details The solutions are written by InverseKinematics::calcInvKin to the columns of the matrix and the ones
+   * outside the joint limits are removed in place, so reusing the matrix between calls avoids allocating.
+   * @param solutions The matrix the solutions are written to, one solution per column
+   * @param tip_link_poses The input information to solve inverse kinematics for. There must be an input for each link
+   * provided in getTipLinkNames
+   * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
+   * @return The number of solutions, which are the first columns of the matrix. If zero it failed to find a solution.
+   */
+  Eigen::Index calcInvKin(Eigen::MatrixXd& solutions,
+                          const KinGroupIKInputs& tip_link_poses,
+                          const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Calculates joint solutions for many poses of the same tip link and working frame, like a toolpath
+   * @details The working frame and tip link transforms are resolved once for all poses, the poses are solved with
+   * InverseKinematics::calcInvKinBatch and the solutions are written to a flat buffer that can be reused between
+   * calls. The inverse kinematics solver is shared by all threads, so it is only run in parallel if it is safe to call
+   * concurrently which is the case for the provided solvers.
+   * @param solutions The buffer the solutions are written to, it is cleared first
+   * @param poses The desired poses of the tip link relative to the working frame
+   * @param working_frame The link name the poses are relative to, must be listed in getAllValidWorkingFrames
+   * @param tip_link_name The tip link to solve for, must be listed in getAllPossibleTipLinkNames
+   * @param seed Vector of seed joint angles used for every pose (size must match number of joints in robot chain)
+   * @param threads The maximum number of blocks of poses solved at the same time
+   * @param executor The executor solving the blocks of poses, nullptr uses the default executor
+   */
+  void calcInvKin(IKSolutionsBuffer& solutions,
+                  const tesseract_common::VectorIsometry3d& poses,
+                  const std::string& working_frame,
+                  const std::string& tip_link_name,
+                  const Eigen::Ref<const Eigen::VectorXd>& seed,
+                  std::size_t threads = 1,
+                  const tesseract_common::Executor::Ptr& executor = nullptr) const;
+
+  /**
+   * @brief Calculate the joint states moving the tip link along the straight line between two poses
+   * @details The states are added until interpolating the joint values between neighboring states keeps the tip link
+   * within the tolerances, checked at the middle of each pair of states. Each state is solved with the solution of the
+   * previous state as the seed and the solution closest to it is used, so the path does not change configuration. The
+   * forward kinematics of each state is calculated once, it is used to check the state and returned for collision
+   * checking.
+   * @param path The states of the path, it is cleared first. The first state is at the start pose and the last state at
+   * the end pose.
+   * @param start_pose The start pose of the tip link relative to the working frame
+   * @param end_pose The end pose of the tip link relative to the working frame
+   * @param working_frame The link name the poses are relative to, must be listed in getAllValidWorkingFrames
+   * @param tip_link_name The tip link of the path, must be listed in getAllPossibleTipLinkNames
+   * @param seed The seed of the first state (size must match number of joints in robot chain)
+   * @param settings The tolerances of the path
+   * @return False if a state has no solution or more than the maximum number of states are required, otherwise true.
+   * On failure the path holds the states calculated up to the failure.
+   */
+  bool calcCartesianPath(KinGroupCartesianPath& path,
+                         const Eigen::Isometry3d& start_pose,
+                         const Eigen::Isometry3d& end_pose,
+                         const std::string& working_frame,
+                         const std::string& tip_link_name,
+                         const Eigen::Ref<const Eigen::VectorXd>& seed,
+                         const KinGroupCartesianPathSettings& settings = KinGroupCartesianPathSettings()) const;
+
   /** @brief Returns all possible working frames in which goal poses can be defined
    * @details The inverse kinematics solver requires that all poses be defined relative to a single working frame.
    * However if this working frame is static, a pose can be defined in another static frame in the environment and
@@ -153,6 +248,22 @@ private:
   Eigen::Isometry3d inv_to_fwd_base_{ Eigen::Isometry3d::Identity() };
   std::vector<std::string> working_frames_;
   std::unordered_map<std::string, std::string> inv_tip_links_map_;
+
+  /** @brief The metrics of the inverse kinematics solver, shared by all groups using a solver of the same name */
+  tesseract_common::MetricHistogram* ik_latency_{ nullptr };
+  tesseract_common::MetricCounter* ik_solved_{ nullptr };
+  tesseract_common::MetricCounter* ik_failed_{ nullptr };
+
+  /** @brief Convert the inputs to poses of the inverse kinematics solver tip links in its working frame */
+  tesseract_common::TransformMap getInvKinInputs(const KinGroupIKInputs& tip_link_poses) const;
+
+  /**
+   * @brief Reorder the solutions of the inverse kinematics solver and append the ones within the limits to a buffer
+   * @param buffer The buffer to append the solutions to, the offset of the pose is added
+   * @param solutions The solutions of the inverse kinematics solver
+   * @param pose The index of the pose in solutions to append
+   */
+  void appendSolutions(IKSolutionsBuffer& buffer, const IKSolutionsBuffer& solutions, std::size_t pose) const;
 };
 
 }  // namespace tesseract_kinematics
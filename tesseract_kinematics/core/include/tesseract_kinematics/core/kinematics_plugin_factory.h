@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <string>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <yaml-cpp/yaml.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -264,6 +266,42 @@ public:
                                        const tesseract_scene_graph::SceneGraph& scene_graph,
                                        const tesseract_scene_graph::SceneState& scene_state) const;
 
+  /**
+   * @brief Get forward kinematics object given group name and solver name, reusing the solver of the same revision
+   * @details The first solver created for a group and solver at a revision is kept as a prototype and later calls
+   * return a clone of it, which avoids building it again, for example the KDL tree or the sub-solvers of REP and ROP.
+   * Solvers may keep transforms taken from the scene state, so the prototype is only used if the joints which are not
+   * joints of the solver have the same values. A prototype is not used once the plugin info of the solver changes.
+   * @param group_name The group name
+   * @param solver_name The solver
+   * @param scene_graph The scene graph
+   * @param scene_state The scene state
+   * @param scene_graph_revision The revision of the scene graph, which must change whenever the scene graph changes
+   */
+  ForwardKinematics::UPtr createFwdKin(const std::string& group_name,
+                                       const std::string& solver_name,
+                                       const tesseract_scene_graph::SceneGraph& scene_graph,
+                                       const tesseract_scene_graph::SceneState& scene_state,
+                                       int scene_graph_revision) const;
+
+  /**
+   * @brief Get inverse kinematics object given group name and solver name, reusing the solver of the same revision
+   * @details See the createFwdKin with a revision
+   * @param group_name The group name
+   * @param solver_name The solver
+   * @param scene_graph The scene graph
+   * @param scene_state The scene state
+   * @param scene_graph_revision The revision of the scene graph, which must change whenever the scene graph changes
+   */
+  InverseKinematics::UPtr createInvKin(const std::string& group_name,
+                                       const std::string& solver_name,
+                                       const tesseract_scene_graph::SceneGraph& scene_graph,
+                                       const tesseract_scene_graph::SceneState& scene_state,
+                                       int scene_graph_revision) const;
+
+  /** @brief Remove the solvers kept by createFwdKin and createInvKin with a revision */
+  void clearSolverCache() const;
+
   /**
    * @brief Get forward kinematics object given plugin info
    * @param plugin_info The plugin information to create kinematics object
@@ -299,6 +337,36 @@ public:
   YAML::Node getConfig() const;
 
 private:
+  /** @brief A solver kept for a revision of the scene graph */
+  struct SolverCacheEntry
+  {
+    /** @brief The revision of the scene graph */
+    int revision{ 0 };
+
+    /** @brief The class name and config of the plugin */
+    std::string config;
+
+    /** @brief The values of the joints which are not joints of the solver */
+    std::unordered_map<std::string, double> joint_values;
+
+    ForwardKinematics::ConstPtr fwd_kin;
+    InverseKinematics::ConstPtr inv_kin;
+  };
+
+  /** @brief The solvers kept by group and solver name, a copy of the factory copies the solvers */
+  struct SolverCache
+  {
+    SolverCache() = default;
+    ~SolverCache() = default;
+    SolverCache(const SolverCache& other);
+    SolverCache& operator=(const SolverCache& other);
+
+    mutable std::mutex mutex;
+    std::map<std::pair<std::string, std::string>, SolverCacheEntry> fwd_kin;
+    std::map<std::pair<std::string, std::string>, SolverCacheEntry> inv_kin;
+  };
+
+  mutable SolverCache solver_cache_;
   mutable std::map<std::string, FwdKinFactory::Ptr> fwd_kin_factories_;
   mutable std::map<std::string, InvKinFactory::Ptr> inv_kin_factories_;
   std::map<std::string, tesseract_common::PluginInfoContainer> fwd_plugin_info_;
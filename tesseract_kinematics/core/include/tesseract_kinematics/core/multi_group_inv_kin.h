@@ -0,0 +1,149 @@
+/**
+ * @file multi_group_inv_kin.h
+ * @brief Coordinated inverse kinematics of several independent kinematic groups.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_MULTI_GROUP_INV_KIN_H
+#define TESSERACT_KINEMATICS_MULTI_GROUP_INV_KIN_H
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_kinematics
+{
+/**
+ * @brief Filter of the joint values of the first groups of a combination, returns false to prune it
+ * @details The joint values are the concatenated solutions of the first num_groups groups in group order. A combination
+ * that is pruned is not extended by the solutions of the remaining groups, so checks like self-collision between the
+ * groups solved so far remove every combination sharing them at once.
+ */
+using MultiGroupIKFilter =
+    std::function<bool(const Eigen::Ref<const Eigen::VectorXd>& joint_values, std::size_t num_groups)>;
+
+/**
+ * @brief The combinations of the solutions of several kinematic groups, enumerated lazily
+ * @details The combinations are the cartesian product of the group solutions in lexicographic order, the last group
+ * changing fastest. Only the solutions of each group are stored, a combination is assembled when it is requested.
+ */
+class MultiGroupIKSolutions
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  MultiGroupIKSolutions() = default;
+
+  /**
+   * @brief Construct the combinations of the solutions of each group
+   * @details Throws if the number of groups does not match
+   * @param group_solutions The solutions of each group
+   * @param num_joints The number of joints of each group, the size of its solutions
+   * @param filter The filter of the combinations, if empty every combination is returned
+   */
+  MultiGroupIKSolutions(std::vector<IKSolutions> group_solutions,
+                        const std::vector<Eigen::Index>& num_joints,
+                        MultiGroupIKFilter filter = nullptr);
+
+  /**
+   * @brief Get the next combination that passes the filter
+   * @param joint_values The concatenated joint values of the combination
+   * @return True if a combination was found, false if all combinations have been enumerated
+   */
+  bool next(Eigen::VectorXd& joint_values);
+
+  /** @brief Restart the enumeration from the first combination */
+  void reset();
+
+  /** @brief Get the solutions of each group */
+  const std::vector<IKSolutions>& getGroupSolutions() const;
+
+  /** @brief Get the number of joints of a combination */
+  Eigen::Index numJoints() const;
+
+  /** @brief Get the number of combinations before filtering, the product of the number of solutions of each group */
+  std::size_t numCombinations() const;
+
+private:
+  std::vector<IKSolutions> group_solutions_;
+  MultiGroupIKFilter filter_;
+  std::vector<Eigen::Index> offsets_{ 0 };  /**< @brief The offset of each group in the joint values and the size */
+  std::vector<std::size_t> indices_;        /**< @brief The next solution of each group to try */
+  std::size_t level_{ 0 };                  /**< @brief The group currently being chosen */
+  Eigen::VectorXd joint_values_;            /**< @brief The joint values of the groups chosen so far */
+};
+
+/**
+ * @brief Inverse kinematics of several independent kinematic groups, like two arms and a positioner
+ * @details The groups are solved concurrently and their solutions combined lazily by MultiGroupIKSolutions instead of
+ * materialising every combination. The groups must not share joints. Each group filters its own solutions by its joint
+ * limits, so only the interaction between groups is left to the filter.
+ */
+class MultiGroupInvKin
+{
+public:
+  using Ptr = std::shared_ptr<MultiGroupInvKin>;
+  using ConstPtr = std::shared_ptr<const MultiGroupInvKin>;
+  using UPtr = std::unique_ptr<MultiGroupInvKin>;
+  using ConstUPtr = std::unique_ptr<const MultiGroupInvKin>;
+
+  /**
+   * @brief Construct the coordinated inverse kinematics of the groups
+   * @details Throws if there are no groups, a group is a nullptr or the groups share a joint
+   * @param groups The kinematic groups, they are solved concurrently so a group must not be used by another thread
+   */
+  explicit MultiGroupInvKin(std::vector<KinematicGroup::ConstPtr> groups);
+
+  /**
+   * @brief Solve the groups and return the combinations of their solutions
+   * @param tip_link_poses The inverse kinematics inputs of each group
+   * @param seeds The seed of each group
+   * @param filter The filter of the combinations, if empty every combination is returned
+   * @param threads The number of threads the groups are solved on, the calling thread is one of them
+   * @return The lazily enumerated combinations
+   */
+  MultiGroupIKSolutions calcInvKin(const std::vector<KinGroupIKInputs>& tip_link_poses,
+                                   const std::vector<Eigen::VectorXd>& seeds,
+                                   MultiGroupIKFilter filter = nullptr,
+                                   std::size_t threads = 1) const;
+
+  /** @brief Get the kinematic groups */
+  const std::vector<KinematicGroup::ConstPtr>& getGroups() const;
+
+  /** @brief Get the joint names of the combinations, the joint names of each group in group order */
+  const std::vector<std::string>& getJointNames() const;
+
+private:
+  std::vector<KinematicGroup::ConstPtr> groups_;
+  std::vector<std::string> joint_names_;
+};
+
+}  // namespace tesseract_kinematics
+#endif  // TESSERACT_KINEMATICS_MULTI_GROUP_INV_KIN_H
@@ -0,0 +1,214 @@
+/**
+ * @file reachability_map.h
+ * @brief A precomputed map of the poses reachable by a kinematic group.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_REACHABILITY_MAP_H
+#define TESSERACT_KINEMATICS_REACHABILITY_MAP_H
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Geometry>
+#include <boost/serialization/access.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_kinematics
+{
+class JointGroup;
+
+/**
+ * @brief A voxelised map of the poses of a tip link reachable by a kinematic group
+ * @details The positions of the tip link relative to the working frame are discretised into voxels of equal size and
+ * the direction of the tip link z-axis into orientation bins. Each of the six faces of a cube enclosing the unit sphere
+ * is divided into orientation_bins x orientation_bins cells and a direction falls into the cell it intersects. The
+ * rotation about the z-axis is not discretised.
+ *
+ * A cell is reachable if a sampled joint state placed the tip link in it. The map is a prefilter, a pose in a
+ * reachable cell is likely but not guaranteed to be reachable and a pose in an unreachable cell may be reachable if the
+ * sampling missed it. The joint states stored with each cell are good seeds for the inverse kinematics.
+ */
+class ReachabilityMap
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<ReachabilityMap>;
+  using ConstPtr = std::shared_ptr<const ReachabilityMap>;
+  using UPtr = std::unique_ptr<ReachabilityMap>;
+  using ConstUPtr = std::unique_ptr<const ReachabilityMap>;
+
+  ReachabilityMap() = default;
+
+  /**
+   * @brief Construct an empty map
+   * @param joint_names The joint names of the stored seeds
+   * @param working_frame The frame the tip link poses are relative to
+   * @param tip_link_name The tip link the map is calculated for
+   * @param origin The minimum corner of the voxel grid
+   * @param dimensions The number of voxels along each axis
+   * @param resolution The edge length of a voxel, must be greater than zero
+   * @param orientation_bins The number of orientation bins along each edge of a cube face, must be greater than zero
+   * @param max_seeds The maximum number of seeds stored per cell
+   */
+  ReachabilityMap(std::vector<std::string> joint_names,
+                  std::string working_frame,
+                  std::string tip_link_name,
+                  const Eigen::Vector3d& origin,
+                  const Eigen::VectorXi& dimensions,
+                  double resolution,
+                  int orientation_bins,
+                  std::size_t max_seeds = 1);
+
+  /**
+   * @brief Mark the cell containing a pose as reachable
+   * @param pose The tip link pose relative to the working frame
+   * @param seed The joint state placing the tip link at the pose, stored if the cell has less than max_seeds
+   * @return False if the pose is outside of the voxel grid, otherwise true
+   */
+  bool insert(const Eigen::Isometry3d& pose, const Eigen::Ref<const Eigen::VectorXd>& seed);
+
+  /**
+   * @brief Check if a pose is likely reachable, this is constant time
+   * @param pose The tip link pose relative to the working frame
+   * @return True if the cell containing the pose is reachable, otherwise false
+   */
+  bool isLikelyReachable(const Eigen::Isometry3d& pose) const;
+
+  /**
+   * @brief Check if a position is likely reachable with any orientation
+   * @param position The tip link position relative to the working frame
+   * @return True if any cell of the voxel containing the position is reachable, otherwise false
+   */
+  bool isLikelyReachable(const Eigen::Vector3d& position) const;
+
+  /**
+   * @brief Get the seeds stored for the cell containing a pose
+   * @param pose The tip link pose relative to the working frame
+   * @return The seeds, empty if the cell is not reachable
+   */
+  std::vector<Eigen::VectorXd> getSeeds(const Eigen::Isometry3d& pose) const;
+
+  /** @brief Get the number of reachable cells */
+  std::size_t size() const;
+
+  /** @brief Get the joint names of the stored seeds */
+  const std::vector<std::string>& getJointNames() const;
+
+  /** @brief Get the frame the tip link poses are relative to */
+  const std::string& getWorkingFrame() const;
+
+  /** @brief Get the tip link the map is calculated for */
+  const std::string& getTipLinkName() const;
+
+  /** @brief Get the minimum corner of the voxel grid */
+  const Eigen::Vector3d& getOrigin() const;
+
+  /** @brief Get the number of voxels along each axis */
+  const Eigen::VectorXi& getDimensions() const;
+
+  /** @brief Get the edge length of a voxel */
+  double getResolution() const;
+
+  /** @brief Get the number of orientation bins along each edge of a cube face */
+  int getOrientationBins() const;
+
+  /** @brief Get the maximum number of seeds stored per cell */
+  std::size_t getMaxSeeds() const;
+
+  bool operator==(const ReachabilityMap& rhs) const;
+  bool operator!=(const ReachabilityMap& rhs) const;
+
+private:
+  std::vector<std::string> joint_names_;
+  std::string working_frame_;
+  std::string tip_link_name_;
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() };
+  Eigen::VectorXi dimensions_{ Eigen::VectorXi::Zero(3) };
+  double resolution_{ 1 };
+  int orientation_bins_{ 1 };
+  std::size_t max_seeds_{ 1 };
+
+  /**
+   * @brief The seeds of each reachable cell stored back to back
+   * @details The key is the voxel index times the number of orientation bins plus the orientation bin
+   */
+  std::unordered_map<std::size_t, std::vector<double>> cells_;
+
+  /**
+   * @brief Get the voxel index of a position
+   * @return False if the position is outside of the voxel grid, otherwise true
+   */
+  bool getVoxelIndex(std::size_t& index, const Eigen::Vector3d& position) const;
+
+  /** @brief Get the orientation bin of a direction */
+  std::size_t getOrientationBin(const Eigen::Vector3d& direction) const;
+
+  /** @brief Get the number of orientation bins per voxel */
+  std::size_t numOrientationBins() const;
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+/** @brief The settings used to create a reachability map */
+struct ReachabilityMapSettings
+{
+  /** @brief The edge length of a voxel */
+  double resolution{ 0.05 };
+
+  /** @brief The number of orientation bins along each edge of a cube face, giving 6 x bins x bins directions */
+  int orientation_bins{ 2 };
+
+  /** @brief The number of joint states sampled uniformly within the joint limits */
+  std::size_t num_samples{ 100000 };
+
+  /** @brief The maximum number of seeds stored per cell */
+  std::size_t max_seeds{ 1 };
+
+  /** @brief The seed of the random number generator, so the same settings create the same map */
+  unsigned random_seed{ 0 };
+};
+
+/**
+ * @brief Create a reachability map by sampling the joint states of a group
+ * @details Joints with infinite limits are sampled between -pi and pi. The voxel grid is sized to the bounding box of
+ * the sampled tip link positions.
+ * @param group The joint group, usually a kinematic group
+ * @param working_frame The frame the tip link poses are relative to, must be a link of the group
+ * @param tip_link_name The tip link, must be a link of the group
+ * @param settings The settings used to create the map
+ * @return The reachability map
+ */
+ReachabilityMap createReachabilityMap(const JointGroup& group,
+                                      const std::string& working_frame,
+                                      const std::string& tip_link_name,
+                                      const ReachabilityMapSettings& settings = ReachabilityMapSettings());
+}  // namespace tesseract_kinematics
+#endif  // TESSERACT_KINEMATICS_REACHABILITY_MAP_H
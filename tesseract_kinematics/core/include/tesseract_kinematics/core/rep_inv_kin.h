@@ -104,9 +104,33 @@ public:
             const Eigen::VectorXd& positioner_sample_resolution,
             std::string solver_name = DEFAULT_REP_INV_KIN_SOLVER_NAME);
 
+  using InverseKinematics::calcInvKin;
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  /**
+   * @brief Set the number of threads used to search the positioner samples
+   * @details Each additional thread searches with its own clone of the manipulator inverse kinematics and positioner
+   * forward kinematics. Unless the number of solutions is limited, the solutions are returned in the same order as
+   * when searching on one thread.
+   * @param threads The number of threads, one searches on the calling thread only
+   */
+  void setThreads(std::size_t threads);
+
+  /** @brief Get the number of threads used to search the positioner samples */
+  std::size_t getThreads() const;
+
+  /**
+   * @brief Set the number of solutions after which the search of the positioner samples stops
+   * @details When searching on more than one thread, which solutions are found first depends on the scheduling of
+   * the threads.
+   * @param max_solutions The maximum number of solutions, zero searches all positioner samples
+   */
+  void setMaxSolutions(std::size_t max_solutions);
+
+  /** @brief Get the number of solutions after which the search of the positioner samples stops */
+  std::size_t getMaxSolutions() const;
+
   std::vector<std::string> getJointNames() const override final;
   Eigen::Index numJoints() const override final;
   std::string getBaseLinkName() const override final;
@@ -126,6 +150,12 @@ private:
   Eigen::Index dof_{ -1 };
   std::vector<Eigen::VectorXd> dof_range_;
   std::string solver_name_{ DEFAULT_REP_INV_KIN_SOLVER_NAME }; /**< @brief Name of this solver */
+  std::size_t threads_{ 1 };       /**< @brief The number of threads searching the positioner samples */
+  std::size_t max_solutions_{ 0 }; /**< @brief The number of solutions after which the search stops, zero for all */
+
+  /** @brief The manipulator inverse kinematics and positioner forward kinematics of each additional thread */
+  std::vector<InverseKinematics::UPtr> worker_manip_inv_kin_;
+  std::vector<ForwardKinematics::UPtr> worker_positioner_fwd_kin_;
 
   void init(const tesseract_scene_graph::SceneGraph& scene_graph,
             const tesseract_scene_graph::SceneState& scene_state,
@@ -140,14 +170,29 @@ private:
   IKSolutions calcInvKinHelper(const tesseract_common::TransformMap& tip_link_poses,
                                const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
-  void nested_ik(IKSolutions& solutions,
-                 int loop_level,
-                 const std::vector<Eigen::VectorXd>& dof_range,
-                 const tesseract_common::TransformMap& tip_link_poses,
-                 Eigen::VectorXd& positioner_pose,
-                 const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+  /**
+   * @brief Solve the manipulator inverse kinematics at a range of positioner samples
+   * @details The samples are numbered with the last positioner joint changing fastest. The search stops early once
+   * solutions holds the maximum number of solutions.
+   * @param solutions The solutions to append to
+   * @param manip_inv_kin The manipulator inverse kinematics to use
+   * @param positioner_fwd_kin The positioner forward kinematics to use
+   * @param tip_link_poses The tip link poses
+   * @param seed The seed
+   * @param start The first sample
+   * @param end One past the last sample
+   */
+  void ikAtSamples(IKSolutions& solutions,
+                   const InverseKinematics& manip_inv_kin,
+                   const ForwardKinematics& positioner_fwd_kin,
+                   const tesseract_common::TransformMap& tip_link_poses,
+                   const Eigen::Ref<const Eigen::VectorXd>& seed,
+                   std::size_t start,
+                   std::size_t end) const;
 
   void ikAt(IKSolutions& solutions,
+            const InverseKinematics& manip_inv_kin,
+            const ForwardKinematics& positioner_fwd_kin,
             const tesseract_common::TransformMap& tip_link_poses,
             Eigen::VectorXd& positioner_pose,
             const Eigen::Ref<const Eigen::VectorXd>& seed) const;
@@ -30,6 +30,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <string>
 #include <vector>
+#include <Eigen/Core>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
@@ -40,6 +41,68 @@ namespace tesseract_kinematics
 /** @brief The inverse kinematics solutions container */
 using IKSolutions = std::vector<Eigen::VectorXd>;
 
+/**
+ * @brief The inverse kinematics solutions of many poses stored in one flat buffer
+ * @details The solutions of pose i are solutions offsets[i] through offsets[i + 1] - 1, each stored as num_joints
+ * consecutive values in data. The buffer keeps its capacity between calls, so reusing it for every toolpath avoids
+ * allocating per pose.
+ */
+struct IKSolutionsBuffer
+{
+  /** @brief The number of joints of each solution */
+  Eigen::Index num_joints{ 0 };
+
+  /** @brief The joint values of all solutions */
+  std::vector<double> data;
+
+  /** @brief The index of the first solution of each pose, followed by the total number of solutions */
+  std::vector<std::size_t> offsets{ 0 };
+
+  /** @brief Remove all solutions, keeping the allocated capacity */
+  void clear()
+  {
+    data.clear();
+    offsets.assign(1, 0);
+  }
+
+  /** @brief Add the solutions of the next pose */
+  void addPose(const IKSolutions& pose_solutions)
+  {
+    for (const auto& solution : pose_solutions)
+      data.insert(data.end(), solution.data(), solution.data() + solution.size());
+
+    offsets.push_back(offsets.back() + pose_solutions.size());
+  }
+
+  /** @brief Get the number of poses */
+  std::size_t numPoses() const { return offsets.size() - 1; }
+
+  /** @brief Get the number of solutions of a pose */
+  std::size_t numSolutions(std::size_t pose) const { return offsets[pose + 1] - offsets[pose]; }
+
+  /**
+   * @brief Get a solution of a pose
+   * @param pose The index of the pose
+   * @param solution The index of the solution of the pose
+   */
+  Eigen::Map<const Eigen::VectorXd> getSolution(std::size_t pose, std::size_t solution) const
+  {
+    const std::size_t index = (offsets[pose] + solution) * static_cast<std::size_t>(num_joints);
+    return { data.data() + index, num_joints };
+  }
+
+  /** @brief Get the solutions of a pose */
+  IKSolutions getSolutions(std::size_t pose) const
+  {
+    IKSolutions solutions;
+    solutions.reserve(numSolutions(pose));
+    for (std::size_t i = 0; i < numSolutions(pose); ++i)
+      solutions.emplace_back(getSolution(pose, i));
+
+    return solutions;
+  }
+};
+
 /** @brief The Universal Robot kinematic parameters */
 struct URParameters
 {
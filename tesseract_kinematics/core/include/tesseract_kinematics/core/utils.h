@@ -128,6 +128,41 @@ inline static void numericalJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
   }
 }
 
+/**
+ * @brief Calculate the damped pseudoinverse of A using fixed size matrices
+ * @details This avoids the heap allocations of the dynamic size decomposition for the common 6 and 7 joint jacobians.
+ * This should not be used directly, use solvePInv or dampedPInv.
+ * @param A Input matrix, must be Rows x Cols
+ * @param eps Singular value threshold
+ * @param lambda Damping factor
+ * @return The pseudoinverse of A
+ */
+template <int Rows, int Cols>
+inline Eigen::Matrix<double, Cols, Rows> calcDampedPInvFixed(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                                                             double eps,
+                                                             double lambda)
+{
+  constexpr int Size = (Rows < Cols) ? Rows : Cols;
+  assert(A.rows() == Rows && A.cols() == Cols);
+
+  Eigen::JacobiSVD<Eigen::Matrix<double, Rows, Cols>> svd(A, Eigen::ComputeFullU | Eigen::ComputeFullV);
+  const Eigen::Matrix<double, Size, 1>& Sv = svd.singularValues();
+
+  // calculate the reciprocal of Singular-Values
+  // damp inverse with lambda so that inverse doesn't oscillate near solution
+  Eigen::Matrix<double, Size, 1> inv_Sv;
+  for (int i = 0; i < Size; ++i)
+  {
+    if (fabs(Sv(i)) > eps)
+      inv_Sv(i) = 1 / Sv(i);
+    else
+      inv_Sv(i) = Sv(i) / (Sv(i) * Sv(i) + lambda * lambda);
+  }
+
+  return svd.matrixV().template leftCols<Size>() * inv_Sv.asDiagonal() *
+         svd.matrixU().template leftCols<Size>().transpose();
+}
+
 /**
  * @brief Solve equation Ax=b for x
  * Use this SVD to compute A+ (pseudoinverse of A). Weighting still TBD.
@@ -155,6 +190,19 @@ inline static bool solvePInv(const Eigen::Ref<const Eigen::MatrixXd>& A,
     return false;
   }
 
+  // Use fixed size matrices for the common 6 and 7 joint jacobians
+  if (A.rows() == 6 && A.cols() == 6)
+  {
+    x = calcDampedPInvFixed<6, 6>(A, eps, lambda) * b;
+    return true;
+  }
+
+  if (A.rows() == 6 && A.cols() == 7)
+  {
+    x = calcDampedPInvFixed<6, 7>(A, eps, lambda) * b;
+    return true;
+  }
+
   // Calculate A+ (pseudoinverse of A) = V S+ U*, where U* is Hermition of U (just transpose if all values of U are
   // real)
   // in order to solve Ax=b -> x*=A+ b
@@ -198,6 +246,19 @@ inline static bool dampedPInv(const Eigen::Ref<const Eigen::MatrixXd>& A,
     return false;
   }
 
+  // Use fixed size matrices for the common 6 and 7 joint jacobians
+  if (A.rows() == 6 && A.cols() == 6)
+  {
+    P = calcDampedPInvFixed<6, 6>(A, eps, lambda);
+    return true;
+  }
+
+  if (A.rows() == 6 && A.cols() == 7)
+  {
+    P = calcDampedPInvFixed<6, 7>(A, eps, lambda);
+    return true;
+  }
+
   // Calculate A+ (pseudoinverse of A) = V S+ U*, where U* is Hermition of U (just transpose if all values of U are
   // real)
   // in order to solve Ax=b -> x*=A+ b
@@ -223,6 +284,20 @@ inline static bool dampedPInv(const Eigen::Ref<const Eigen::MatrixXd>& A,
   return true;
 }
 
+/**
+ * @brief Calculate the singular values of a jacobian
+ * @details Only the singular values are computed, using a fixed size decomposition for jacobians with six rows.
+ * @param jacobian The jacobian
+ * @return The min(rows, cols) singular values in decreasing order
+ */
+inline Eigen::VectorXd calcSingularValues(const Eigen::Ref<const Eigen::MatrixXd>& jacobian)
+{
+  if (jacobian.rows() == 6)
+    return Eigen::JacobiSVD<Eigen::Matrix<double, 6, Eigen::Dynamic>>(jacobian).singularValues();
+
+  return Eigen::JacobiSVD<Eigen::MatrixXd>(jacobian).singularValues();
+}
+
 /**
  * @brief Check if the provided jacobian is near a singularity
  * @details This is keep separated from the forward kinematics because special consideration may need to be made
@@ -233,9 +308,7 @@ inline static bool dampedPInv(const Eigen::Ref<const Eigen::MatrixXd>& A,
  */
 inline bool isNearSingularity(const Eigen::Ref<const Eigen::MatrixXd>& jacobian, double threshold = 0.01)
 {
-  Eigen::JacobiSVD<Eigen::MatrixXd> svd(jacobian, Eigen::ComputeThinU | Eigen::ComputeThinV);
-  const Eigen::VectorXd& sv = svd.singularValues();
-  return (sv.tail(1).value() < threshold);
+  return (calcSingularValues(jacobian).tail(1).value() < threshold);
 }
 
 /** @brief Used to store Manipulability and Force Ellipsoid data */
@@ -294,6 +367,138 @@ struct Manipulability
   ManipulabilityEllipsoid f_angular;
 };
 
+/**
+ * @brief Calculate the manipulability ellipsoid data from its eigen values
+ * @param eigen_values The eigen values of the ellipsoid matrix in increasing order
+ * @return The manipulability ellipsoid data
+ */
+inline ManipulabilityEllipsoid calcManipulabilityEllipsoid(const Eigen::Ref<const Eigen::VectorXd>& eigen_values)
+{
+  ManipulabilityEllipsoid data;
+  data.eigen_values = eigen_values;
+
+  // Set eigenvalues near zero to zero. This also implies zero volume
+  for (Eigen::Index i = 0; i < data.eigen_values.size(); ++i)
+  {
+    if (tesseract_common::almostEqualRelativeAndAbs(data.eigen_values[i], 0))
+      data.eigen_values[i] = +0;
+  }
+
+  // If the minimum eigen value is approximately zero set measure and condition to max double
+  if (tesseract_common::almostEqualRelativeAndAbs(data.eigen_values.minCoeff(), 0))
+  {
+    data.measure = std::numeric_limits<double>::max();
+    data.condition = std::numeric_limits<double>::max();
+  }
+  else
+  {
+    data.condition = data.eigen_values.maxCoeff() / data.eigen_values.minCoeff();
+    data.measure = std::sqrt(data.condition);
+  }
+
+  data.volume = std::sqrt(data.eigen_values.prod());
+
+  return data;
+}
+
+/**
+ * @brief Get the eigen values of the inverse of a matrix from its eigen values
+ * @details Eigen values that are not positive have no inverse and are set to max double
+ * @param eigen_values The eigen values of the matrix in increasing order
+ * @return The eigen values of the inverse in increasing order
+ */
+inline Eigen::VectorXd calcInverseEigenValues(const Eigen::Ref<const Eigen::VectorXd>& eigen_values)
+{
+  const Eigen::Index n = eigen_values.size();
+  Eigen::VectorXd inv_eigen_values(n);
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    const double v = eigen_values(n - 1 - i);
+    inv_eigen_values(i) = (v > 0) ? (1.0 / v) : std::numeric_limits<double>::max();
+  }
+  return inv_eigen_values;
+}
+
+/** @brief Manipulability, condition and singularity data of a jacobian */
+struct JacobianMetrics
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief The manipulability and force ellipsoids */
+  Manipulability manipulability;
+
+  /** @brief The min(rows, cols) singular values of the jacobian in decreasing order */
+  Eigen::VectorXd singular_values;
+
+  /** @brief The smallest singular value, which goes to zero at a singularity */
+  double min_singular_value{ 0 };
+
+  /** @brief True if the smallest singular value is less than the threshold, see isNearSingularity */
+  bool near_singularity{ false };
+};
+
+/**
+ * @brief Calculate the manipulability, condition and singularity data of a jacobian
+ * @details The matrix A = J*J^T is formed once and decomposed once, its eigen values being the squared singular values
+ * of the jacobian. For a jacobian with six rows this is a fixed size decomposition and the linear and angular
+ * ellipsoids use a closed form decomposition of the 3x3 diagonal blocks of A. The force ellipsoids invert the eigen
+ * values instead of the matrices.
+ * @param jacobian The jacobian with the linear rows above the angular rows
+ * @param threshold The threshold the smallest singular value must be greater than or equal to not be considered near
+ * a singularity
+ * @return The jacobian metrics
+ */
+inline JacobianMetrics calcJacobianMetrics(const Eigen::Ref<const Eigen::MatrixXd>& jacobian, double threshold = 0.01)
+{
+  JacobianMetrics metrics;
+  Eigen::VectorXd eigen_values;
+  Eigen::Vector3d eigen_values_linear;
+  Eigen::Vector3d eigen_values_angular;
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> sm3;
+  if (jacobian.rows() == 6)
+  {
+    Eigen::Matrix<double, 6, 6> a;
+    a.noalias() = jacobian * jacobian.transpose();
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix<double, 6, 6>> sm(a, Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values = sm.eigenvalues();
+
+    sm3.computeDirect(a.topLeftCorner<3, 3>(), Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values_linear = sm3.eigenvalues();
+    sm3.computeDirect(a.bottomRightCorner<3, 3>(), Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values_angular = sm3.eigenvalues();
+  }
+  else
+  {
+    const Eigen::MatrixXd a = jacobian * jacobian.transpose();
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> sm(a, Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values = sm.eigenvalues();
+
+    sm3.computeDirect(a.topLeftCorner<3, 3>(), Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values_linear = sm3.eigenvalues();
+    sm3.computeDirect(a.bottomRightCorner<3, 3>(), Eigen::DecompositionOptions::EigenvaluesOnly);
+    eigen_values_angular = sm3.eigenvalues();
+  }
+
+  // The largest eigen values of A are the squared min(rows, cols) singular values of the jacobian, the rest are zero
+  const Eigen::Index num_sv = std::min(jacobian.rows(), jacobian.cols());
+  eigen_values.head(jacobian.rows() - num_sv).setZero();
+  metrics.singular_values = eigen_values.tail(num_sv).reverse().cwiseMax(0).cwiseSqrt();
+  metrics.min_singular_value = metrics.singular_values.tail(1).value();
+  metrics.near_singularity = (metrics.min_singular_value < threshold);
+
+  Manipulability& manip = metrics.manipulability;
+  manip.m = calcManipulabilityEllipsoid(eigen_values);
+  manip.m_linear = calcManipulabilityEllipsoid(eigen_values_linear);
+  manip.m_angular = calcManipulabilityEllipsoid(eigen_values_angular);
+  manip.f = calcManipulabilityEllipsoid(calcInverseEigenValues(eigen_values));
+  manip.f_linear = calcManipulabilityEllipsoid(calcInverseEigenValues(eigen_values_linear));
+  manip.f_angular = calcManipulabilityEllipsoid(calcInverseEigenValues(eigen_values_angular));
+
+  return metrics;
+}
+
 /**
  * @brief Calculate manipulability data about the provided jacobian
  * @param jacobian The jacobian used to calculate manipulability
@@ -301,54 +506,62 @@ struct Manipulability
  */
 inline Manipulability calcManipulability(const Eigen::Ref<const Eigen::MatrixXd>& jacobian)
 {
-  Manipulability manip;
-  Eigen::MatrixXd jacob_linear = jacobian.topRows(3);
-  Eigen::MatrixXd jacob_angular = jacobian.bottomRows(3);
+  return calcJacobianMetrics(jacobian).manipulability;
+}
 
-  auto fn = [](const Eigen::MatrixXd& m) {
-    ManipulabilityEllipsoid data;
-    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> sm(m, Eigen::DecompositionOptions::EigenvaluesOnly);
-    data.eigen_values = sm.eigenvalues().real();
+/** @brief The jacobian metrics of every state of a trajectory and their worst values */
+struct TrajectoryJacobianMetrics
+{
+  /** @brief The jacobian metrics of each state */
+  std::vector<JacobianMetrics> states;
 
-    // Set eigenvalues near zero to zero. This also implies zero volume
-    for (Eigen::Index i = 0; i < data.eigen_values.size(); ++i)
-    {
-      if (tesseract_common::almostEqualRelativeAndAbs(data.eigen_values[i], 0))
-        data.eigen_values[i] = +0;
-    }
+  /** @brief The smallest singular value of all states */
+  double min_singular_value{ std::numeric_limits<double>::max() };
 
-    // If the minimum eigen value is approximately zero set measure and condition to max double
-    if (tesseract_common::almostEqualRelativeAndAbs(data.eigen_values.minCoeff(), 0))
-    {
-      data.measure = std::numeric_limits<double>::max();
-      data.condition = std::numeric_limits<double>::max();
-    }
-    else
+  /** @brief The index of the state with the smallest singular value */
+  Eigen::Index min_singular_value_index{ -1 };
+
+  /** @brief The smallest manipulability volume of all states */
+  double min_volume{ std::numeric_limits<double>::max() };
+
+  /** @brief The number of states near a singularity */
+  long num_near_singularity{ 0 };
+};
+
+/**
+ * @brief Calculate the jacobian metrics of every state of a trajectory
+ * @param group The joint group used to calculate the jacobians
+ * @param trajectory The trajectory, each row is a state
+ * @param link_name The link the jacobians are calculated for, relative to the group base link
+ * @param threshold The threshold the smallest singular value must be greater than or equal to not be considered near
+ * a singularity
+ * @return The jacobian metrics of the trajectory
+ */
+inline TrajectoryJacobianMetrics calcJacobianMetrics(const JointGroup& group,
+                                                     const tesseract_common::TrajArray& trajectory,
+                                                     const std::string& link_name,
+                                                     double threshold = 0.01)
+{
+  TrajectoryJacobianMetrics metrics;
+  metrics.states.reserve(static_cast<std::size_t>(trajectory.rows()));
+  for (Eigen::Index i = 0; i < trajectory.rows(); ++i)
+  {
+    const Eigen::VectorXd state = trajectory.row(i).transpose();
+    metrics.states.push_back(calcJacobianMetrics(group.calcJacobian(state, link_name), threshold));
+
+    const JacobianMetrics& state_metrics = metrics.states.back();
+    if (state_metrics.min_singular_value < metrics.min_singular_value)
     {
-      data.condition = data.eigen_values.maxCoeff() / data.eigen_values.minCoeff();
-      data.measure = std::sqrt(data.condition);
+      metrics.min_singular_value = state_metrics.min_singular_value;
+      metrics.min_singular_value_index = i;
     }
 
-    data.volume = std::sqrt(data.eigen_values.prod());
-
-    return data;
-  };
+    metrics.min_volume = std::min(metrics.min_volume, state_metrics.manipulability.m.volume);
+    if (state_metrics.near_singularity)
+      ++metrics.num_near_singularity;
+  }
 
-  Eigen::MatrixXd a = jacobian * jacobian.transpose();
-  Eigen::MatrixXd a_linear = jacob_linear * jacob_linear.transpose();
-  Eigen::MatrixXd a_angular = jacob_angular * jacob_angular.transpose();
-  manip.m = fn(a);
-  manip.m_linear = fn(a_linear);
-  manip.m_angular = fn(a_angular);
-
-  Eigen::MatrixXd a_inv = a.inverse();
-  Eigen::MatrixXd a_linear_inv = a_linear.inverse();
-  Eigen::MatrixXd a_angular_inv = a_angular.inverse();
-  manip.f = fn(a_inv);
-  manip.f_linear = fn(a_linear_inv);
-  manip.f_angular = fn(a_angular_inv);
-
-  return manip;
+  return metrics;
 }
 
 /**
@@ -430,20 +643,20 @@ inline void getRedundantSolutionsHelper(std::vector<VectorX<FloatType>>& redunda
 }
 
 /**
- * @brief Kinematics only return solution between PI and -PI. Provided the limits it will append redundant solutions.
- * @details The list of redundant solutions does not include the provided solutions.
+ * @brief Visit each redundant solution of a solution without allocating per solution
+ * @details The redundant solutions and their order are the same as getRedundantSolutions. They are enumerated without
+ * recursion into a single buffer that is reused for each solution, so the visitor must copy a solution to keep it.
  * @param sol The solution to calculate redundant solutions about
  * @param limits The joint limits of the robot
  * @param redundancy_capable_joints The indices of the redundancy capable joints
+ * @param visitor Called with each redundant solution, the enumeration stops early if it returns false
  */
-template <typename FloatType>
-inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<const VectorX<FloatType>>& sol,
-                                                             const Eigen::MatrixX2d& limits,
-                                                             const std::vector<Eigen::Index>& redundancy_capable_joints)
+template <typename FloatType, typename Visitor>
+inline void forEachRedundantSolution(const Eigen::Ref<const VectorX<FloatType>>& sol,
+                                     const Eigen::MatrixX2d& limits,
+                                     const std::vector<Eigen::Index>& redundancy_capable_joints,
+                                     Visitor&& visitor)
 {
-  if (redundancy_capable_joints.empty())
-    return {};
-
   for (const Eigen::Index& idx : redundancy_capable_joints)
   {
     if (idx >= sol.size())
@@ -455,15 +668,174 @@ inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<co
     }
   }
 
+  // The values each redundancy capable joint can be shifted to by multiples of 2 PI within its limits
+  const std::size_t num_joints = redundancy_capable_joints.size();
+  std::vector<double> shifted_values;
+  std::vector<std::size_t> shifted_starts{ 0 };
+  shifted_starts.reserve(num_joints + 1);
+  for (const Eigen::Index& idx : redundancy_capable_joints)
+  {
+    const double value = static_cast<double>(sol[idx]);
+    double val{ 0 };
+    if (std::isinf(limits(idx, 0)))
+    {
+      std::stringstream ss;
+      ss << "Lower limit of joint " << idx << " is infinite; no redundant solutions will be generated" << std::endl;
+      CONSOLE_BRIDGE_logWarn(ss.str().c_str());
+    }
+    else
+    {
+      val = value;
+      while ((val -= (2.0 * M_PI)) > limits(idx, 0) || tesseract_common::almostEqualRelativeAndAbs(val, limits(idx, 0)))
+      {
+        // It not guaranteed that the provided solution is within limits so this check is needed
+        if (val < limits(idx, 1) || tesseract_common::almostEqualRelativeAndAbs(val, limits(idx, 1)))
+          shifted_values.push_back(val);
+      }
+    }
+
+    if (std::isinf(limits(idx, 1)))
+    {
+      std::stringstream ss;
+      ss << "Upper limit of joint " << idx << " is infinite; no redundant solutions will be generated" << std::endl;
+      CONSOLE_BRIDGE_logWarn(ss.str().c_str());
+    }
+    else
+    {
+      val = value;
+      while ((val += (2.0 * M_PI)) < limits(idx, 1) || tesseract_common::almostEqualRelativeAndAbs(val, limits(idx, 1)))
+      {
+        // It not guaranteed that the provided solution is within limits so this check is needed
+        if (val > limits(idx, 0) || tesseract_common::almostEqualRelativeAndAbs(val, limits(idx, 0)))
+          shifted_values.push_back(val);
+      }
+    }
+
+    shifted_starts.push_back(shifted_values.size());
+  }
+
+  auto num_shifted = [&shifted_starts](std::size_t i) { return shifted_starts[i + 1] - shifted_starts[i]; };
+  auto next_shiftable = [&num_shifted, num_joints](std::size_t from) {
+    while (from < num_joints && num_shifted(from) == 0)
+      ++from;
+    return from;
+  };
+
+  // The combinations of shifted joints are visited in the order of a depth first search, where each combination is
+  // followed by the combinations that additionally shift a later joint. shifted[i] is the index of the shifted value of
+  // joint i, or -1 if it is not shifted, and last is the last shifted joint.
+  std::vector<long> shifted(num_joints, -1);
+  std::size_t last = next_shiftable(0);
+  if (last == num_joints)
+    return;
+
+  shifted[last] = 0;
+  Eigen::VectorXd redundant_sol = sol.template cast<double>();
+  VectorX<FloatType> result(sol.size());
+  while (true)
+  {
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      const Eigen::Index idx = redundancy_capable_joints[i];
+      redundant_sol[idx] = (shifted[i] < 0) ? static_cast<double>(sol[idx]) :
+                                              shifted_values[shifted_starts[i] + static_cast<std::size_t>(shifted[i])];
+    }
+
+    if (tesseract_common::satisfiesPositionLimits<double>(redundant_sol, limits))
+    {
+      tesseract_common::enforcePositionLimits<double>(redundant_sol, limits);
+      result = redundant_sol.template cast<FloatType>();
+      if (!visitor(static_cast<const VectorX<FloatType>&>(result)))
+        return;
+    }
+
+    // Shift a later joint first, otherwise move on to the next value of the last shifted joint
+    std::size_t next = next_shiftable(last + 1);
+    if (next < num_joints)
+    {
+      shifted[next] = 0;
+      last = next;
+      continue;
+    }
+
+    while (true)
+    {
+      if (static_cast<std::size_t>(shifted[last] + 1) < num_shifted(last))
+      {
+        ++shifted[last];
+        break;
+      }
+
+      // The values of the last shifted joint are exhausted, shift the next joint after it or back up to the joint
+      // shifted before it
+      shifted[last] = -1;
+      next = next_shiftable(last + 1);
+      if (next < num_joints)
+      {
+        shifted[next] = 0;
+        last = next;
+        break;
+      }
+
+      do
+      {
+        if (last == 0)
+          return;
+        --last;
+      } while (shifted[last] < 0);
+    }
+  }
+}
+
+/**
+ * @brief Kinematics only return solution between PI and -PI. Provided the limits it will append redundant solutions.
+ * @details The list of redundant solutions does not include the provided solutions.
+ * @param sol The solution to calculate redundant solutions about
+ * @param limits The joint limits of the robot
+ * @param redundancy_capable_joints The indices of the redundancy capable joints
+ */
+template <typename FloatType>
+inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<const VectorX<FloatType>>& sol,
+                                                             const Eigen::MatrixX2d& limits,
+                                                             const std::vector<Eigen::Index>& redundancy_capable_joints)
+{
   std::vector<VectorX<FloatType>> redundant_sols;
-  getRedundantSolutionsHelper<FloatType>(redundant_sols,
-                                         sol.template cast<double>(),
-                                         limits,
-                                         redundancy_capable_joints.begin(),
-                                         redundancy_capable_joints.end());
+  forEachRedundantSolution<FloatType>(
+      sol, limits, redundancy_capable_joints, [&redundant_sols](const VectorX<FloatType>& redundant_sol) {
+        redundant_sols.push_back(redundant_sol);
+        return true;
+      });
+
   return redundant_sols;
 }
 
+/**
+ * @brief Append the redundant solutions of a solution to a flat buffer
+ * @details Each redundant solution appends sol.size() values, so a buffer reused between calls does not allocate once
+ * it has grown to its working size. The redundant solutions are the same as getRedundantSolutions.
+ * @param redundant_sols The buffer to append the redundant solutions to
+ * @param sol The solution to calculate redundant solutions about
+ * @param limits The joint limits of the robot
+ * @param redundancy_capable_joints The indices of the redundancy capable joints
+ * @return The number of redundant solutions appended
+ */
+template <typename FloatType>
+inline std::size_t getRedundantSolutions(std::vector<FloatType>& redundant_sols,
+                                         const Eigen::Ref<const VectorX<FloatType>>& sol,
+                                         const Eigen::MatrixX2d& limits,
+                                         const std::vector<Eigen::Index>& redundancy_capable_joints)
+{
+  std::size_t num_sols = 0;
+  forEachRedundantSolution<FloatType>(
+      sol, limits, redundancy_capable_joints, [&redundant_sols, &num_sols](const VectorX<FloatType>& redundant_sol) {
+        redundant_sols.insert(redundant_sols.end(), redundant_sol.data(), redundant_sol.data() + redundant_sol.size());
+        ++num_sols;
+        return true;
+      });
+
+  return num_sols;
+}
+
 /**
  * @brief Given a vector of floats, this check if they are finite
  *
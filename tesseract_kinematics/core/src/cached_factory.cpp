@@ -0,0 +1,160 @@
+/**
+ * @file cached_factory.cpp
+ * @brief Cached inverse kinematics factory.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_kinematics/core/cached_factory.h>
+
+namespace tesseract_kinematics
+{
+namespace
+{
+/** @brief Append the parameters of a joint affecting the kinematics */
+void appendJoint(std::vector<double>& kinematics, const tesseract_scene_graph::Joint& joint)
+{
+  const Eigen::Matrix4d& origin = joint.parent_to_joint_origin_transform.matrix();
+  kinematics.push_back(static_cast<double>(joint.type));
+  kinematics.insert(kinematics.end(), origin.data(), origin.data() + origin.size());
+  kinematics.insert(kinematics.end(), joint.axis.data(), joint.axis.data() + joint.axis.size());
+}
+
+/** @brief Get the parameters the solutions of a solver depend on */
+std::vector<double> getKinematics(const InverseKinematics& solver,
+                                  const tesseract_scene_graph::SceneGraph& scene_graph,
+                                  const tesseract_scene_graph::SceneState& scene_state)
+{
+  std::vector<double> kinematics;
+  for (const auto& tip_link_name : solver.getTipLinkNames())
+  {
+    tesseract_scene_graph::ShortestPath path = scene_graph.getShortestPath(solver.getBaseLinkName(), tip_link_name);
+    for (const auto& joint_name : path.joints)
+      appendJoint(kinematics, *scene_graph.getJoint(joint_name));
+  }
+
+  for (const auto& joint_name : solver.getJointNames())
+  {
+    auto joint = scene_graph.getJoint(joint_name);
+    appendJoint(kinematics, *joint);
+    if (joint->limits != nullptr)
+    {
+      kinematics.push_back(joint->limits->lower);
+      kinematics.push_back(joint->limits->upper);
+    }
+  }
+
+  Eigen::Isometry3d working_frame_to_base = scene_state.link_transforms.at(solver.getWorkingFrame()).inverse() *
+                                            scene_state.link_transforms.at(solver.getBaseLinkName());
+  kinematics.insert(kinematics.end(),
+                    working_frame_to_base.matrix().data(),
+                    working_frame_to_base.matrix().data() + working_frame_to_base.matrix().size());
+  return kinematics;
+}
+}  // namespace
+
+InverseKinematics::UPtr CachedInvKinFactory::create(const std::string& solver_name,
+                                                    const tesseract_scene_graph::SceneGraph& scene_graph,
+                                                    const tesseract_scene_graph::SceneState& scene_state,
+                                                    const KinematicsPluginFactory& plugin_factory,
+                                                    const YAML::Node& config) const
+{
+  InverseKinematics::UPtr inv_kin;
+  std::size_t cache_size{ 1024 };
+  double position_resolution{ 1e-6 };
+  double orientation_resolution{ 1e-6 };
+  double seed_resolution{ 1e-6 };
+  std::vector<double> kinematics;
+
+  try
+  {
+    if (YAML::Node n = config["cache_size"])
+      cache_size = n.as<std::size_t>();
+
+    if (YAML::Node n = config["position_resolution"])
+      position_resolution = n.as<double>();
+
+    if (YAML::Node n = config["orientation_resolution"])
+      orientation_resolution = n.as<double>();
+
+    if (YAML::Node n = config["seed_resolution"])
+      seed_resolution = n.as<double>();
+
+    if (!(position_resolution > 0))
+      throw std::runtime_error("CachedInvKinFactory, 'position_resolution' is not greater than zero!");
+
+    if (!(orientation_resolution > 0))
+      throw std::runtime_error("CachedInvKinFactory, 'orientation_resolution' is not greater than zero!");
+
+    if (!(seed_resolution >= 0))
+      throw std::runtime_error("CachedInvKinFactory, 'seed_resolution' is less than zero!");
+
+    // Get Solver
+    if (YAML::Node solver = config["solver"])
+    {
+      tesseract_common::PluginInfo s_info;
+      if (YAML::Node n = solver["class"])
+        s_info.class_name = n.as<std::string>();
+      else
+        throw std::runtime_error("CachedInvKinFactory, 'solver' missing 'class' entry!");
+
+      if (YAML::Node n = solver["config"])
+        s_info.config = n;
+
+      inv_kin = plugin_factory.createInvKin(s_info.class_name, s_info, scene_graph, scene_state);
+      if (inv_kin == nullptr)
+        throw std::runtime_error("CachedInvKinFactory, failed to create solver inverse kinematics!");
+    }
+    else
+    {
+      throw std::runtime_error("CachedInvKinFactory, missing 'solver' entry!");
+    }
+
+    kinematics = getKinematics(*inv_kin, scene_graph, scene_state);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("CachedInvKinFactory: Failed to parse yaml config data! Details: %s", e.what());
+    return nullptr;
+  }
+
+  // Share the cache with the solvers previously created for the same kinematics
+  IKSolutionCache::Ptr cache;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    CacheEntry& entry = caches_[solver_name + "\n" + YAML::Dump(config)];
+    if (entry.cache == nullptr || entry.kinematics != kinematics)
+    {
+      entry.kinematics = std::move(kinematics);
+      entry.cache =
+          std::make_shared<IKSolutionCache>(cache_size, position_resolution, orientation_resolution, seed_resolution);
+    }
+    cache = entry.cache;
+  }
+
+  return std::make_unique<CachedInvKin>(std::move(inv_kin), std::move(cache), solver_name);
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(CachedInvKinFactoriesAnchor)
+
+}  // namespace tesseract_kinematics
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_INV_KIN_PLUGIN(tesseract_kinematics::CachedInvKinFactory, CachedInvKinFactory);
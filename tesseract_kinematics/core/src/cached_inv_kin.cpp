@@ -0,0 +1,241 @@
+/**
+ * @file cached_inv_kin.cpp
+ * @brief Inverse kinematics decorator returning cached solutions for repeated requests.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
+#include <functional>
+#include <mutex>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/cached_inv_kin.h>
+
+namespace tesseract_kinematics
+{
+namespace
+{
+void hashCombine(std::size_t& seed, std::size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); }
+}  // namespace
+
+std::size_t IKSolutionCache::KeyHash::operator()(const std::vector<long>& key) const
+{
+  std::size_t seed{ 0 };
+  for (const long& value : key)
+    hashCombine(seed, std::hash<long>()(value));
+
+  return seed;
+}
+
+IKSolutionCache::IKSolutionCache(std::size_t cache_size,
+                                 double position_resolution,
+                                 double orientation_resolution,
+                                 double seed_resolution)
+  : cache_size_(cache_size)
+  , position_resolution_(position_resolution)
+  , orientation_resolution_(orientation_resolution)
+  , seed_resolution_(seed_resolution)
+{
+  if (!(position_resolution_ > 0))
+    throw std::runtime_error("IKSolutionCache, position resolution is not greater than zero");
+
+  if (!(orientation_resolution_ > 0))
+    throw std::runtime_error("IKSolutionCache, orientation resolution is not greater than zero");
+
+  if (!(seed_resolution_ >= 0))
+    throw std::runtime_error("IKSolutionCache, seed resolution is less than zero");
+}
+
+bool IKSolutionCache::get(IKSolutions& solutions,
+                          const std::vector<std::string>& tip_link_names,
+                          const tesseract_common::TransformMap& tip_link_poses,
+                          const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  std::vector<long> key;
+  if (!createKey(key, tip_link_names, tip_link_poses, seed))
+    return false;
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = cache_.find(key);
+  if (it == cache_.end())
+    return false;
+
+  solutions = it->second;
+  return true;
+}
+
+void IKSolutionCache::insert(const std::vector<std::string>& tip_link_names,
+                             const tesseract_common::TransformMap& tip_link_poses,
+                             const Eigen::Ref<const Eigen::VectorXd>& seed,
+                             const IKSolutions& solutions)
+{
+  std::vector<long> key;
+  if (!createKey(key, tip_link_names, tip_link_poses, seed))
+    return;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (cache_size_ == 0)
+    return;
+
+  auto it = cache_.emplace(std::move(key), solutions);
+  if (!it.second)
+    return;
+
+  order_.push_back(&it.first->first);
+  shrinkHelper();
+}
+
+void IKSolutionCache::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  cache_.clear();
+  order_.clear();
+}
+
+std::size_t IKSolutionCache::size() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cache_.size();
+}
+
+void IKSolutionCache::setCacheSize(std::size_t size)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  cache_size_ = size;
+  shrinkHelper();
+}
+
+std::size_t IKSolutionCache::getCacheSize() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return cache_size_;
+}
+
+double IKSolutionCache::getPositionResolution() const { return position_resolution_; }
+
+double IKSolutionCache::getOrientationResolution() const { return orientation_resolution_; }
+
+double IKSolutionCache::getSeedResolution() const { return seed_resolution_; }
+
+bool IKSolutionCache::createKey(std::vector<long>& key,
+                                const std::vector<std::string>& tip_link_names,
+                                const tesseract_common::TransformMap& tip_link_poses,
+                                const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  key.reserve((tip_link_names.size() * 7) + static_cast<std::size_t>(seed.size()) + 1);
+  for (const auto& tip_link_name : tip_link_names)
+  {
+    auto it = tip_link_poses.find(tip_link_name);
+    if (it == tip_link_poses.end())
+      return false;
+
+    const Eigen::Vector3d& position = it->second.translation();
+    for (Eigen::Index i = 0; i < 3; ++i)
+      key.push_back(std::lround(position(i) / position_resolution_));
+
+    // A rotation is represented by two quaternions, use the one with a non negative scalar part
+    Eigen::Quaterniond orientation(it->second.linear());
+    if (orientation.w() < 0)
+      orientation.coeffs() *= -1;
+
+    for (Eigen::Index i = 0; i < 4; ++i)
+      key.push_back(std::lround(orientation.coeffs()(i) / orientation_resolution_));
+  }
+
+  key.push_back(static_cast<long>(seed.size()));
+  if (seed_resolution_ > 0)
+  {
+    for (Eigen::Index i = 0; i < seed.size(); ++i)
+      key.push_back(std::lround(seed(i) / seed_resolution_));
+  }
+
+  return true;
+}
+
+void IKSolutionCache::shrinkHelper()
+{
+  while (cache_.size() > cache_size_)
+  {
+    cache_.erase(cache_.find(*order_.front()));
+    order_.pop_front();
+  }
+}
+
+CachedInvKin::CachedInvKin(InverseKinematics::UPtr solver, IKSolutionCache::Ptr cache, std::string solver_name)
+  : solver_(std::move(solver)), cache_(std::move(cache)), solver_name_(std::move(solver_name))
+{
+  if (solver_name_.empty())
+    throw std::runtime_error("Solver name must not be empty.");
+
+  if (solver_ == nullptr)
+    throw std::runtime_error("Provided solver is a nullptr");
+
+  if (cache_ == nullptr)
+    cache_ = std::make_shared<IKSolutionCache>();
+
+  tip_link_names_ = solver_->getTipLinkNames();
+}
+
+CachedInvKin::CachedInvKin(const CachedInvKin& other) { *this = other; }
+
+CachedInvKin& CachedInvKin::operator=(const CachedInvKin& other)
+{
+  solver_ = other.solver_->clone();
+  cache_ = other.cache_;
+  tip_link_names_ = other.tip_link_names_;
+  solver_name_ = other.solver_name_;
+
+  return *this;
+}
+
+IKSolutions CachedInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
+                                     const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  IKSolutions solutions;
+  if (cache_->get(solutions, tip_link_names_, tip_link_poses, seed))
+    return solutions;
+
+  solutions = solver_->calcInvKin(tip_link_poses, seed);
+  cache_->insert(tip_link_names_, tip_link_poses, seed, solutions);
+  return solutions;
+}
+
+IKSolutionCache::Ptr CachedInvKin::getCache() const { return cache_; }
+
+const InverseKinematics& CachedInvKin::getSolver() const { return *solver_; }
+
+std::vector<std::string> CachedInvKin::getJointNames() const { return solver_->getJointNames(); }
+
+Eigen::Index CachedInvKin::numJoints() const { return solver_->numJoints(); }
+
+std::string CachedInvKin::getBaseLinkName() const { return solver_->getBaseLinkName(); }
+
+std::string CachedInvKin::getWorkingFrame() const { return solver_->getWorkingFrame(); }
+
+std::vector<std::string> CachedInvKin::getTipLinkNames() const { return tip_link_names_; }
+
+std::string CachedInvKin::getSolverName() const { return solver_name_; }
+
+InverseKinematics::UPtr CachedInvKin::clone() const { return std::make_unique<CachedInvKin>(*this); }
+
+}  // namespace tesseract_kinematics
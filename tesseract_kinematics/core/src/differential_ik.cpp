@@ -0,0 +1,166 @@
+/**
+ * @file differential_ik.cpp
+ * @brief Real-time differential inverse kinematics of a joint group.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/differential_ik.h>
+#include <tesseract_common/tracing.h>
+
+namespace tesseract_kinematics
+{
+DifferentialIK::DifferentialIK(JointGroup::ConstPtr joint_group,
+                               std::string tip_link_name,
+                               DifferentialIKConfig config)
+  : joint_group_(std::move(joint_group)), tip_link_name_(std::move(tip_link_name)), config_(config)
+{
+  if (joint_group_ == nullptr)
+    throw std::runtime_error("DifferentialIK: The joint group is a nullptr!");
+
+  if (!joint_group_->hasLinkName(tip_link_name_))
+    throw std::runtime_error("DifferentialIK: Link name '" + tip_link_name_ + "' does not exist!");
+
+  const Eigen::Index n = joint_group_->numJoints();
+  const tesseract_common::KinematicLimits limits = joint_group_->getLimits();
+  joint_limits_ = limits.joint_limits;
+  velocity_limits_ = limits.velocity_limits;
+  jacobian_ = Eigen::MatrixXd::Zero(6, n);
+  active_jacobian_ = Eigen::MatrixXd::Zero(6, n);
+  locked_ = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(n, false);
+  jjt_.setZero();
+  task_.setZero();
+}
+
+bool DifferentialIK::solve(Eigen::Ref<Eigen::VectorXd> joint_velocities,
+                           const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                           const Eigen::Ref<const Eigen::Matrix<double, 6, 1>>& twist,
+                           double dt)
+{
+  TESSERACT_TRACE_ZONE("DifferentialIK::solve");
+  const Eigen::Index n = jacobian_.cols();
+  if (joint_velocities.size() != n || joint_angles.size() != n)
+  {
+    CONSOLE_BRIDGE_logError("DifferentialIK: The number of joint values does not match the joint group (%d)",
+                            static_cast<int>(n));
+    return false;
+  }
+
+  if (!(dt > 0) || !joint_angles.allFinite() || !twist.allFinite())
+  {
+    CONSOLE_BRIDGE_logError("DifferentialIK: The time step must be positive and the inputs must be finite");
+    return false;
+  }
+
+  joint_group_->calcJacobian(jacobian_, joint_angles, tip_link_name_);
+
+  result_ = DifferentialIKResult();
+  locked_.setConstant(false);
+
+  // The columns of the locked joints are zero so their velocities are zero. Each pass either locks at least one more
+  // joint or ends the loop, so it ends after at most n + 1 passes.
+  const double threshold = config_.singular_value_threshold;
+  for (Eigen::Index pass = 0; pass <= n; ++pass)
+  {
+    active_jacobian_ = jacobian_;
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      if (locked_(i))
+        active_jacobian_.col(i).setZero();
+    }
+
+    // The eigenvalues of J J^T are the squared singular values of J
+    jjt_.noalias() = active_jacobian_ * active_jacobian_.transpose();
+    eigen_solver_.compute(jjt_, Eigen::EigenvaluesOnly);
+    result_.min_singular_value = std::sqrt(std::max(eigen_solver_.eigenvalues()(0), 0.0));
+
+    double damping_sq{ 0 };
+    if (result_.min_singular_value < threshold)
+    {
+      const double ratio = result_.min_singular_value / threshold;
+      damping_sq = (1.0 - ratio * ratio) * config_.max_damping * config_.max_damping;
+    }
+    result_.damping = std::sqrt(damping_sq);
+
+    // Without damping a singular system can not be solved, so a minimal damping is always applied
+    jjt_.diagonal().array() += std::max(damping_sq, 1e-12);
+    ldlt_.compute(jjt_);
+    if (ldlt_.info() != Eigen::Success)
+      return false;
+
+    task_ = ldlt_.solve(twist);
+    joint_velocities.noalias() = active_jacobian_.transpose() * task_;
+
+    bool locked_joint{ false };
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      if (locked_(i))
+        continue;
+
+      const double next = joint_angles(i) + joint_velocities(i) * dt;
+      if ((joint_velocities(i) > 0 && next > joint_limits_(i, 1) - config_.joint_limit_margin) ||
+          (joint_velocities(i) < 0 && next < joint_limits_(i, 0) + config_.joint_limit_margin))
+      {
+        locked_(i) = true;
+        locked_joint = true;
+        ++result_.num_locked_joints;
+      }
+    }
+
+    if (!locked_joint)
+      break;
+  }
+
+  if (config_.enforce_velocity_limits)
+  {
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      const double velocity = std::abs(joint_velocities(i));
+      if (velocity_limits_(i) > 0 && velocity * result_.velocity_scale > velocity_limits_(i))
+        result_.velocity_scale = velocity_limits_(i) / velocity;
+    }
+    joint_velocities *= result_.velocity_scale;
+  }
+
+  return joint_velocities.allFinite();
+}
+
+const DifferentialIKResult& DifferentialIK::getResult() const { return result_; }
+
+const Eigen::MatrixXd& DifferentialIK::getJacobian() const { return jacobian_; }
+
+const DifferentialIKConfig& DifferentialIK::getConfig() const { return config_; }
+
+void DifferentialIK::setConfig(const DifferentialIKConfig& config) { config_ = config; }
+
+const JointGroup& DifferentialIK::getJointGroup() const { return *joint_group_; }
+
+const std::string& DifferentialIK::getTipLinkName() const { return tip_link_name_; }
+
+}  // namespace tesseract_kinematics
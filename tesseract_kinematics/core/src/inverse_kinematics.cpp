@@ -0,0 +1,64 @@
+/**
+ * @file inverse_kinematics.cpp
+ * @brief Inverse kinematics functions.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_kinematics/core/inverse_kinematics.h>
+
+namespace tesseract_kinematics
+{
+Eigen::Index InverseKinematics::calcInvKin(Eigen::MatrixXd& solutions,
+                                           const tesseract_common::TransformMap& tip_link_poses,
+                                           const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  const IKSolutions solution_set = calcInvKin(tip_link_poses, seed);
+  const auto num_solutions = static_cast<Eigen::Index>(solution_set.size());
+  if (solutions.rows() != numJoints() || solutions.cols() < num_solutions)
+    solutions.resize(numJoints(), num_solutions);
+
+  for (Eigen::Index i = 0; i < num_solutions; ++i)
+    solutions.col(i) = solution_set[static_cast<std::size_t>(i)];
+
+  return num_solutions;
+}
+
+void InverseKinematics::calcInvKinBatch(IKSolutionsBuffer& solutions,
+                                        const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                        const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  const std::vector<std::string> tip_link_names = getTipLinkNames();
+  if (tip_link_names.size() != 1)
+    throw std::runtime_error("InverseKinematics: calcInvKinBatch requires a solver with one tip link!");
+
+  solutions.clear();
+  solutions.num_joints = numJoints();
+  solutions.offsets.reserve(tip_link_poses.size() + 1);
+
+  tesseract_common::TransformMap ik_inputs;
+  Eigen::Isometry3d& ik_input = ik_inputs[tip_link_names.front()];
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    ik_input = tip_link_pose;
+    solutions.addPose(calcInvKin(ik_inputs, seed));
+  }
+}
+}  // namespace tesseract_kinematics
@@ -26,15 +26,84 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <numeric>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_geometry/utils.h>
 
 #include <tesseract_scene_graph/kdl_parser.h>
+#include <tesseract_common/tracing.h>
 
 namespace tesseract_kinematics
 {
+namespace
+{
+/**
+ * @brief Calculate the largest distance from a link origin to the collision geometry of the link and its children
+ * @details The joints which are not part of the group are fixed at their position in the scene state
+ */
+double calcLinkReach(const tesseract_scene_graph::SceneGraph& scene_graph,
+                     const tesseract_scene_graph::SceneState& scene_state,
+                     const std::vector<std::string>& joint_names,
+                     const std::string& link_name)
+{
+  double reach{ 0 };
+  for (const auto& collision : scene_graph.getLink(link_name)->collision)
+    reach = std::max(reach,
+                     collision->origin.translation().norm() +
+                         tesseract_geometry::calcBoundingSphereRadius(*collision->geometry));
+
+  for (const auto& joint : scene_graph.getOutboundJoints(link_name))
+  {
+    double offset{ std::numeric_limits<double>::infinity() };
+    if (std::find(joint_names.begin(), joint_names.end(), joint->getName()) == joint_names.end())
+    {
+      const Eigen::Isometry3d& parent = scene_state.link_transforms.at(link_name);
+      const Eigen::Isometry3d& child = scene_state.link_transforms.at(joint->child_link_name);
+      offset = (parent.inverse() * child).translation().norm();
+    }
+    else if (joint->type == tesseract_scene_graph::JointType::REVOLUTE ||
+             joint->type == tesseract_scene_graph::JointType::CONTINUOUS)
+    {
+      offset = joint->parent_to_joint_origin_transform.translation().norm();
+    }
+    else if (joint->type == tesseract_scene_graph::JointType::PRISMATIC)
+    {
+      offset = joint->parent_to_joint_origin_transform.translation().norm() +
+               std::max(std::abs(joint->limits->lower), std::abs(joint->limits->upper));
+    }
+
+    reach = std::max(reach, offset + calcLinkReach(scene_graph, scene_state, joint_names, joint->child_link_name));
+  }
+
+  return reach;
+}
+
+/**
+ * @brief Calculate the largest distance a point on the collision geometry moved by a joint travels per unit of motion
+ * @details A revolute joint rotates its child link about an axis through the child link origin, so no point moves
+ * further than its distance to the origin times the angle.
+ */
+double calcJointMotionBound(const tesseract_scene_graph::SceneGraph& scene_graph,
+                            const tesseract_scene_graph::SceneState& scene_state,
+                            const std::vector<std::string>& joint_names,
+                            const tesseract_scene_graph::Joint& joint)
+{
+  switch (joint.type)
+  {
+    case tesseract_scene_graph::JointType::REVOLUTE:
+    case tesseract_scene_graph::JointType::CONTINUOUS:
+      return calcLinkReach(scene_graph, scene_state, joint_names, joint.child_link_name);
+    case tesseract_scene_graph::JointType::PRISMATIC:
+      return 1.0;
+    default:
+      return std::numeric_limits<double>::infinity();
+  }
+}
+}  // namespace
+
 JointGroup::JointGroup(std::string name,
                        std::vector<std::string> joint_names,
                        const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -93,6 +162,36 @@ JointGroup::JointGroup(std::string name,
 
   if (static_link_names_.size() + active_link_names.size() != scene_graph.getLinks().size())
     throw std::runtime_error("JointGroup: Static link names are not correct!");
+
+  // The active links are calculated by the solver, the static links keep their transform in the scene state
+  solver_link_indices_.reserve(link_names_.size());
+  link_transforms_.reserve(link_names_.size());
+  for (const auto& link_name : link_names_)
+  {
+    if (std::find(active_link_names.begin(), active_link_names.end(), link_name) != active_link_names.end())
+      solver_link_indices_.push_back(state_solver_->getLinkIndices({ link_name }).front());
+    else
+      solver_link_indices_.push_back(-1);
+
+    link_transforms_.push_back(scene_state.link_transforms.at(link_name));
+  }
+
+  link_name_table_ = std::make_shared<const tesseract_common::LinkNameTable>(link_names_);
+
+  motion_bounds_.resize(static_cast<Eigen::Index>(joint_names_.size()));
+  for (Eigen::Index i = 0; i < static_cast<Eigen::Index>(joint_names_.size()); ++i)
+  {
+    const std::string& joint_name = joint_names_[static_cast<std::size_t>(i)];
+    motion_bounds_(i) = calcJointMotionBound(scene_graph, scene_state, joint_names_, *scene_graph.getJoint(joint_name));
+
+    // Joints mimicking this joint move with it
+    for (const auto& joint : scene_graph.getJoints())
+    {
+      if (joint->mimic != nullptr && joint->mimic->joint_name == joint_name)
+        motion_bounds_(i) += std::abs(joint->mimic->multiplier) *
+                             calcJointMotionBound(scene_graph, scene_state, joint_names_, *joint);
+    }
+  }
 }
 
 JointGroup::JointGroup(const JointGroup& other) { *this = other; }
@@ -101,27 +200,100 @@ JointGroup& JointGroup::operator=(const JointGroup& other)
 {
   name_ = other.name_;
   state_ = other.state_;
-  state_solver_ = other.state_solver_->clone();
+  state_solver_ = std::make_unique<tesseract_scene_graph::KDLStateSolver>(*other.state_solver_);
   joint_names_ = other.joint_names_;
   link_names_ = other.link_names_;
+  link_name_table_ = other.link_name_table_;
   static_link_names_ = other.static_link_names_;
   static_link_transforms_ = other.static_link_transforms_;
+  solver_link_indices_ = other.solver_link_indices_;
+  link_transforms_ = other.link_transforms_;
   limits_ = other.limits_;
   redundancy_indices_ = other.redundancy_indices_;
   jacobian_map_ = other.jacobian_map_;
+  motion_bounds_ = other.motion_bounds_;
   return *this;
 }
 
 tesseract_common::TransformMap JointGroup::calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const
 {
+  TESSERACT_TRACE_ZONE("JointGroup::calcFwdKin");
   tesseract_common::TransformMap state = state_solver_->getState(joint_names_, joint_angles).link_transforms;
   state.insert(static_link_transforms_.begin(), static_link_transforms_.end());
   return state;
 }
 
+void JointGroup::calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                            const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                            const std::vector<long>& link_indices) const
+{
+  TESSERACT_TRACE_ZONE("JointGroup::calcFwdKin");
+  assert(link_transforms.size() == link_indices.size());
+  assert(joint_angles.size() == numJoints());
+
+  // The solver calculates the links with a solver index, the static links are copied here
+  thread_local std::vector<long> solver_link_indices;
+  solver_link_indices.resize(link_indices.size());
+  for (std::size_t i = 0; i < link_indices.size(); ++i)
+  {
+    const auto link_index = static_cast<std::size_t>(link_indices[i]);
+    solver_link_indices[i] = solver_link_indices_[link_index];
+    if (solver_link_indices[i] < 0)
+      link_transforms[i] = link_transforms_[link_index];
+  }
+
+  // The solver expects the joint angles in the order of its active joints
+  thread_local Eigen::VectorXd solver_joint_angles;
+  solver_joint_angles.resize(numJoints());
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    solver_joint_angles(jacobian_map_[static_cast<std::size_t>(i)]) = joint_angles(i);
+
+  state_solver_->getLinkTransforms(link_transforms, solver_link_indices, solver_joint_angles);
+}
+
+void JointGroup::calcFwdKin(tesseract_common::LinkTransforms& link_transforms,
+                            const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const
+{
+  TESSERACT_TRACE_ZONE("JointGroup::calcFwdKin");
+  if (link_transforms.getNameTable() == nullptr)
+    link_transforms = tesseract_common::LinkTransforms(link_name_table_);
+
+  thread_local std::vector<long> link_indices;
+  if (link_transforms.getNameTable() == link_name_table_)
+  {
+    link_indices.resize(link_names_.size());
+    std::iota(link_indices.begin(), link_indices.end(), 0);
+  }
+  else
+  {
+    link_indices = getLinkIndices(link_transforms.getNames());
+  }
+
+  calcFwdKin(link_transforms.getTransforms(), joint_angles, link_indices);
+}
+
+const tesseract_common::LinkNameTable::ConstPtr& JointGroup::getLinkNameTable() const { return link_name_table_; }
+
+std::vector<long> JointGroup::getLinkIndices(const std::vector<std::string>& link_names) const
+{
+  std::vector<long> link_indices;
+  link_indices.reserve(link_names.size());
+  for (const auto& link_name : link_names)
+  {
+    auto it = std::find(link_names_.begin(), link_names_.end(), link_name);
+    if (it == link_names_.end())
+      throw std::runtime_error("JointGroup: Link name '" + link_name + "' does not exist!");
+
+    link_indices.push_back(std::distance(link_names_.begin(), it));
+  }
+
+  return link_indices;
+}
+
 Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                          const std::string& link_name) const
 {
+  TESSERACT_TRACE_ZONE("JointGroup::calcJacobian");
   Eigen::MatrixXd solver_jac = state_solver_->getJacobian(joint_names_, joint_angles, link_name);
 
   Eigen::MatrixXd kin_jac(6, numJoints());
@@ -131,10 +303,33 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
   return kin_jac;
 }
 
+void JointGroup::calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                              const std::string& link_name) const
+{
+  TESSERACT_TRACE_ZONE("JointGroup::calcJacobian");
+  assert(jacobian.rows() == 6 && jacobian.cols() == numJoints());
+  assert(joint_angles.size() == numJoints());
+
+  // The solver expects the joint angles in the order of its active joints and returns the columns in that order
+  thread_local Eigen::VectorXd solver_joint_angles;
+  thread_local Eigen::MatrixXd solver_jac;
+  solver_joint_angles.resize(numJoints());
+  solver_jac.resize(6, numJoints());
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    solver_joint_angles(jacobian_map_[static_cast<std::size_t>(i)]) = joint_angles(i);
+
+  state_solver_->getJacobian(solver_jac, solver_joint_angles, link_name);
+
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    jacobian.col(i) = solver_jac.col(jacobian_map_[static_cast<std::size_t>(i)]);
+}
+
 Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                          const std::string& link_name,
                                          const Eigen::Vector3d& link_point) const
 {
+  TESSERACT_TRACE_ZONE("JointGroup::calcJacobian");
   Eigen::MatrixXd kin_jac = calcJacobian(joint_angles, link_name);
 
   tesseract_scene_graph::SceneState state = state_solver_->getState(joint_names_, joint_angles);
@@ -150,6 +345,7 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
                                          const std::string& base_link_name,
                                          const std::string& link_name) const
 {
+  TESSERACT_TRACE_ZONE("JointGroup::calcJacobian");
   if (base_link_name == getBaseLinkName())
     return calcJacobian(joint_angles, link_name);
 
@@ -189,6 +385,7 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
                                          const std::string& link_name,
                                          const Eigen::Vector3d& link_point) const
 {
+  TESSERACT_TRACE_ZONE("JointGroup::calcJacobian");
   if (base_link_name == getBaseLinkName())
     return calcJacobian(joint_angles, link_name, link_point);
 
@@ -273,6 +470,8 @@ bool JointGroup::hasLinkName(const std::string& link_name) const
 
 tesseract_common::KinematicLimits JointGroup::getLimits() const { return limits_; }
 
+const Eigen::VectorXd& JointGroup::getJointMotionBounds() const { return motion_bounds_; }
+
 void JointGroup::setLimits(const tesseract_common::KinematicLimits& limits)
 {
   Eigen::Index nj = numJoints();
@@ -25,6 +25,7 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -32,6 +33,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/utils.h>
 
 #include <tesseract_scene_graph/kdl_parser.h>
+#include <tesseract_common/metrics.h>
+#include <tesseract_common/tracing.h>
 
 namespace tesseract_kinematics
 {
@@ -91,6 +94,16 @@ KinematicGroup::KinematicGroup(std::string name,
 
   if (static_link_names_.size() + active_link_names.size() != scene_graph.getLinks().size())
     throw std::runtime_error("KinematicGroup: Static link names are not correct!");
+
+  auto& registry = tesseract_common::MetricsRegistry::getInstance();
+  const std::string solver_name = inv_kin_->getSolverName();
+  const std::string solves_help = "The number of inverse kinematics poses solved, by whether a solution was found";
+  ik_latency_ = &registry.getHistogram(
+      "tesseract_ik_solve_seconds", "The latency of inverse kinematics solves", { { "solver", solver_name } });
+  const tesseract_common::MetricLabels solved_labels{ { "solver", solver_name }, { "result", "solved" } };
+  const tesseract_common::MetricLabels failed_labels{ { "solver", solver_name }, { "result", "failed" } };
+  ik_solved_ = &registry.getCounter("tesseract_ik_solves_total", solves_help, solved_labels);
+  ik_failed_ = &registry.getCounter("tesseract_ik_solves_total", solves_help, failed_labels);
 }
 
 KinematicGroup::KinematicGroup(const KinematicGroup& other) : JointGroup(other) { *this = other; }
@@ -105,80 +118,271 @@ KinematicGroup& KinematicGroup::operator=(const KinematicGroup& other)
   inv_to_fwd_base_ = other.inv_to_fwd_base_;
   working_frames_ = other.working_frames_;
   inv_tip_links_map_ = other.inv_tip_links_map_;
+  ik_latency_ = other.ik_latency_;
+  ik_solved_ = other.ik_solved_;
+  ik_failed_ = other.ik_failed_;
   return *this;
 }
 
 IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInputs& tip_link_poses,
                                        const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
-  // Convert to IK Inputs
-  tesseract_common::TransformMap ik_inputs;
-  for (const auto& tip_link_pose : tip_link_poses)
+  TESSERACT_TRACE_ZONE("KinematicGroup::calcInvKin");
+  const tesseract_common::MetricTimer timer(*ik_latency_);
+  const tesseract_common::TransformMap ik_inputs = getInvKinInputs(tip_link_poses);
+  auto outside_limits = [this](const Eigen::VectorXd& solution) {
+    return !tesseract_common::satisfiesPositionLimits<double>(solution, limits_.joint_limits);
+  };
+
+  // format seed for inverse kinematic solver
+  if (reorder_required_)
   {
-    assert(std::find(working_frames_.begin(), working_frames_.end(), tip_link_pose.working_frame) !=
-           working_frames_.end());
-    assert(std::abs(1.0 - tip_link_pose.pose.matrix().determinant()) < 1e-6);  // NOLINT
+    Eigen::VectorXd ordered_seed = seed;
+    for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+      ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
 
-    // The IK Solvers tip link and working frame
-    std::string ik_solver_tip_link = inv_tip_links_map_.at(tip_link_pose.tip_link_name);
-    std::string working_frame = inv_kin_->getWorkingFrame();
+    // The solutions are reordered in place through one copy of the solver order
+    IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, ordered_seed);
+    Eigen::VectorXd solution_copy(inv_kin_->numJoints());
+    for (auto& solution : solutions)
+    {
+      solution_copy = solution;
+      for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+        solution(i) = solution_copy(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
+    }
 
-    // Get transform from working frame to user working frame (reference frame for the target IK pose)
-    const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(tip_link_pose.working_frame);
-    const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(working_frame);
-    const Eigen::Isometry3d wf_to_user_wf = world_to_wf.inverse() * world_to_user_wf;
+    solutions.erase(std::remove_if(solutions.begin(), solutions.end(), outside_limits), solutions.end());
+    (solutions.empty() ? ik_failed_ : ik_solved_)->increment();
+    return solutions;
+  }
 
-    // Get the transform from IK solver tip link to the user tip link
-    const Eigen::Isometry3d& world_to_user_tl = state_.link_transforms.at(tip_link_pose.tip_link_name);
-    const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(ik_solver_tip_link);
-    const Eigen::Isometry3d tl_to_user_tl = world_to_tl.inverse() * world_to_user_tl;
+  IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, seed);
+  solutions.erase(std::remove_if(solutions.begin(), solutions.end(), outside_limits), solutions.end());
+  (solutions.empty() ? ik_failed_ : ik_solved_)->increment();
+  return solutions;
+}
 
-    // Get the transformation from the IK solver working frame to the IK solver tip frame
-    const Eigen::Isometry3d& user_wf_to_user_tl = tip_link_pose.pose;  // an unnecessary but helpful alias
-    const Eigen::Isometry3d wf_to_tl = wf_to_user_wf * user_wf_to_user_tl * tl_to_user_tl.inverse();
+IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
+                                       const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  return calcInvKin(KinGroupIKInputs{ tip_link_pose }, seed);
+}
 
-    ik_inputs[ik_solver_tip_link] = wf_to_tl;
-  }
+Eigen::Index KinematicGroup::calcInvKin(Eigen::MatrixXd& solutions,
+                                        const KinGroupIKInputs& tip_link_poses,
+                                        const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  TESSERACT_TRACE_ZONE("KinematicGroup::calcInvKin");
+  const tesseract_common::MetricTimer timer(*ik_latency_);
+  const tesseract_common::TransformMap ik_inputs = getInvKinInputs(tip_link_poses);
 
-  // format seed for inverse kinematic solver
+  // The solutions within the limits are moved to the front columns
+  Eigen::Index num_solutions{ 0 };
   if (reorder_required_)
   {
     Eigen::VectorXd ordered_seed = seed;
     for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
       ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
 
-    IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, ordered_seed);
-    IKSolutions solutions_filtered;
-    solutions_filtered.reserve(solutions.size());
-    for (const auto& solution : solutions)
+    const Eigen::Index num_ik_solutions = inv_kin_->calcInvKin(solutions, ik_inputs, ordered_seed);
+    Eigen::VectorXd ordered_sol(inv_kin_->numJoints());
+    for (Eigen::Index j = 0; j < num_ik_solutions; ++j)
     {
-      Eigen::VectorXd ordered_sol = solution;
       for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
-        ordered_sol(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
+        ordered_sol(i) = solutions(inv_kin_joint_map_[static_cast<std::size_t>(i)], j);
 
       if (tesseract_common::satisfiesPositionLimits<double>(ordered_sol, limits_.joint_limits))
-        solutions_filtered.push_back(ordered_sol);
+        solutions.col(num_solutions++) = ordered_sol;
     }
 
-    return solutions_filtered;
+    ((num_solutions == 0) ? ik_failed_ : ik_solved_)->increment();
+    return num_solutions;
   }
 
-  IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, seed);
-  IKSolutions solutions_filtered;
-  solutions_filtered.reserve(solutions.size());
-  for (auto& solution : solutions)
+  const Eigen::Index num_ik_solutions = inv_kin_->calcInvKin(solutions, ik_inputs, seed);
+  for (Eigen::Index j = 0; j < num_ik_solutions; ++j)
   {
-    if (tesseract_common::satisfiesPositionLimits<double>(solution, limits_.joint_limits))
-      solutions_filtered.push_back(solution);
+    if (!tesseract_common::satisfiesPositionLimits<double>(solutions.col(j), limits_.joint_limits))
+      continue;
+
+    if (num_solutions != j)
+      solutions.col(num_solutions) = solutions.col(j);
+
+    ++num_solutions;
   }
 
-  return solutions_filtered;
+  ((num_solutions == 0) ? ik_failed_ : ik_solved_)->increment();
+  return num_solutions;
 }
 
-IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
-                                       const Eigen::Ref<const Eigen::VectorXd>& seed) const
+void KinematicGroup::calcInvKin(IKSolutionsBuffer& solutions,
+                                const tesseract_common::VectorIsometry3d& poses,
+                                const std::string& working_frame,
+                                const std::string& tip_link_name,
+                                const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                std::size_t threads,
+                                const tesseract_common::Executor::Ptr& executor) const
 {
-  return calcInvKin(KinGroupIKInputs{ tip_link_pose }, seed);
+  TESSERACT_TRACE_ZONE("KinematicGroup::calcInvKin");
+  assert(std::find(working_frames_.begin(), working_frames_.end(), working_frame) != working_frames_.end());
+
+  // The transforms between the user frames and the IK solver frames are the same for every pose
+  const std::string& ik_solver_tip_link = inv_tip_links_map_.at(tip_link_name);
+  const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(inv_kin_->getWorkingFrame());
+  const Eigen::Isometry3d wf_to_user_wf = world_to_wf.inverse() * state_.link_transforms.at(working_frame);
+  const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(ik_solver_tip_link);
+  const Eigen::Isometry3d user_tl_to_tl = state_.link_transforms.at(tip_link_name).inverse() * world_to_tl;
+
+  // format seed for inverse kinematic solver
+  Eigen::VectorXd ordered_seed = seed;
+  if (reorder_required_)
+  {
+    for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+      ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
+  }
+
+  auto solve_poses = [&](IKSolutionsBuffer& buffer, std::size_t start, std::size_t end) {
+    tesseract_common::VectorIsometry3d ik_inputs;
+    ik_inputs.reserve(end - start);
+    for (std::size_t i = start; i < end; ++i)
+    {
+      assert(std::abs(1.0 - poses[i].matrix().determinant()) < 1e-6);  // NOLINT
+      ik_inputs.push_back(wf_to_user_wf * poses[i] * user_tl_to_tl);
+    }
+
+    IKSolutionsBuffer ik_solutions;
+    inv_kin_->calcInvKinBatch(ik_solutions, ik_inputs, ordered_seed);
+    std::size_t num_solved{ 0 };
+    for (std::size_t i = 0; i < ik_solutions.numPoses(); ++i)
+    {
+      appendSolutions(buffer, ik_solutions, i);
+      num_solved += (buffer.numSolutions(buffer.numPoses() - 1) > 0) ? 1 : 0;
+    }
+
+    // The batch latency is not comparable to single solves, so only the results are recorded
+    ik_solved_->increment(num_solved);
+    ik_failed_->increment(ik_solutions.numPoses() - num_solved);
+  };
+
+  const std::size_t num_poses = poses.size();
+  solutions.clear();
+  solutions.num_joints = numJoints();
+  solutions.offsets.reserve(num_poses + 1);
+
+  const std::size_t num_workers = std::min(std::max<std::size_t>(threads, 1), std::max<std::size_t>(num_poses, 1));
+  if (num_workers == 1)
+  {
+    solve_poses(solutions, 0, num_poses);
+    return;
+  }
+
+  // Each worker solves a contiguous block of poses into its own buffer, the first block is solved into the output
+  const std::size_t block_size = (num_poses + num_workers - 1) / num_workers;
+  std::vector<IKSolutionsBuffer> blocks(num_workers - 1);
+  for (auto& block : blocks)
+    block.num_joints = solutions.num_joints;
+
+  auto solve_block = [&](std::size_t i) {
+    const std::size_t start = std::min(i * block_size, num_poses);
+    const std::size_t end = std::min(start + block_size, num_poses);
+    solve_poses((i == 0) ? solutions : blocks[i - 1], start, end);
+  };
+  ((executor != nullptr) ? *executor : *tesseract_common::getDefaultExecutor()).parallelFor(num_workers, solve_block);
+
+  // Append the blocks in order, shifting their offsets by the solutions before them
+  for (const auto& block : blocks)
+  {
+    const std::size_t offset = solutions.offsets.back();
+    solutions.data.insert(solutions.data.end(), block.data.begin(), block.data.end());
+    for (std::size_t i = 1; i < block.offsets.size(); ++i)
+      solutions.offsets.push_back(offset + block.offsets[i]);
+  }
+}
+
+bool KinematicGroup::calcCartesianPath(KinGroupCartesianPath& path,
+                                       const Eigen::Isometry3d& start_pose,
+                                       const Eigen::Isometry3d& end_pose,
+                                       const std::string& working_frame,
+                                       const std::string& tip_link_name,
+                                       const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                       const KinGroupCartesianPathSettings& settings) const
+{
+  path.clear();
+
+  const Eigen::Quaterniond start_rotation(start_pose.linear());
+  const Eigen::Quaterniond end_rotation(end_pose.linear());
+  auto interpolatePose = [&](double s) {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = start_pose.translation() + (s * (end_pose.translation() - start_pose.translation()));
+    pose.linear() = start_rotation.slerp(s, end_rotation).toRotationMatrix();
+    return pose;
+  };
+
+  auto withinTolerance = [&settings](const Eigen::Isometry3d& target, const Eigen::Isometry3d& actual) {
+    const Eigen::Isometry3d error = target.inverse() * actual;
+    return (error.translation().norm() <= settings.translation_tolerance &&
+            Eigen::AngleAxisd(error.linear()).angle() <= settings.rotation_tolerance);
+  };
+
+  // The solution closest to the seed is used and its forward kinematics is kept for checking the path later
+  auto solveState = [&](KinGroupCartesianState& state, double s, const Eigen::VectorXd& state_seed) {
+    state.pose = interpolatePose(s);
+    IKSolutions solutions = calcInvKin(KinGroupIKInput(state.pose, working_frame, tip_link_name), state_seed);
+    if (solutions.empty())
+      return false;
+
+    state.joint_values = *std::min_element(
+        solutions.begin(), solutions.end(), [&state_seed](const Eigen::VectorXd& a, const Eigen::VectorXd& b) {
+          return (a - state_seed).squaredNorm() < (b - state_seed).squaredNorm();
+        });
+    state.link_transforms = calcFwdKin(state.joint_values);
+    return withinTolerance(state.pose,
+                           state.link_transforms.at(working_frame).inverse() * state.link_transforms.at(tip_link_name));
+  };
+
+  KinGroupCartesianState start_state;
+  if (!solveState(start_state, 0, seed))
+    return false;
+
+  path.push_back(std::move(start_state));
+
+  // The states between the last state of the path and the end, the last one is the next state of the path
+  KinGroupCartesianPath pending(1);
+  std::vector<double> pending_s{ 1 };
+  if (!solveState(pending[0], 1, path.back().joint_values))
+    return false;
+
+  // Only the working frame and tip link are needed to check the middle of a pair of states
+  const std::vector<long> link_indices = getLinkIndices({ working_frame, tip_link_name });
+  tesseract_common::VectorIsometry3d link_transforms(link_indices.size());
+  Eigen::VectorXd mid_joint_values;
+  double s = 0;
+  while (!pending.empty())
+  {
+    const double mid_s = 0.5 * (s + pending_s.back());
+    mid_joint_values = 0.5 * (path.back().joint_values + pending.back().joint_values);
+    calcFwdKin(link_transforms, mid_joint_values, link_indices);
+    if (withinTolerance(interpolatePose(mid_s), link_transforms[0].inverse() * link_transforms[1]))
+    {
+      s = pending_s.back();
+      path.push_back(std::move(pending.back()));
+      pending.pop_back();
+      pending_s.pop_back();
+      continue;
+    }
+
+    if (path.size() + pending.size() >= settings.max_states)
+      return false;
+
+    KinGroupCartesianState mid_state;
+    if (!solveState(mid_state, mid_s, path.back().joint_values))
+      return false;
+
+    pending.push_back(std::move(mid_state));
+    pending_s.push_back(mid_s);
+  }
+
+  return true;
 }
 
 std::vector<std::string> KinematicGroup::getAllValidWorkingFrames() const { return working_frames_; }
@@ -192,4 +396,69 @@ std::vector<std::string> KinematicGroup::getAllPossibleTipLinkNames() const
 
   return ik_tip_links;
 }
+
+tesseract_common::TransformMap KinematicGroup::getInvKinInputs(const KinGroupIKInputs& tip_link_poses) const
+{
+  // Convert to IK Inputs
+  tesseract_common::TransformMap ik_inputs;
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    assert(std::find(working_frames_.begin(), working_frames_.end(), tip_link_pose.working_frame) !=
+           working_frames_.end());
+    assert(std::abs(1.0 - tip_link_pose.pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+    // The IK Solvers tip link and working frame
+    std::string ik_solver_tip_link = inv_tip_links_map_.at(tip_link_pose.tip_link_name);
+    std::string working_frame = inv_kin_->getWorkingFrame();
+
+    // Get transform from working frame to user working frame (reference frame for the target IK pose)
+    const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(tip_link_pose.working_frame);
+    const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(working_frame);
+    const Eigen::Isometry3d wf_to_user_wf = world_to_wf.inverse() * world_to_user_wf;
+
+    // Get the transform from IK solver tip link to the user tip link
+    const Eigen::Isometry3d& world_to_user_tl = state_.link_transforms.at(tip_link_pose.tip_link_name);
+    const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(ik_solver_tip_link);
+    const Eigen::Isometry3d tl_to_user_tl = world_to_tl.inverse() * world_to_user_tl;
+
+    // Get the transformation from the IK solver working frame to the IK solver tip frame
+    const Eigen::Isometry3d& user_wf_to_user_tl = tip_link_pose.pose;  // an unnecessary but helpful alias
+    const Eigen::Isometry3d wf_to_tl = wf_to_user_wf * user_wf_to_user_tl * tl_to_user_tl.inverse();
+
+    ik_inputs[ik_solver_tip_link] = wf_to_tl;
+  }
+
+  return ik_inputs;
+}
+
+void KinematicGroup::appendSolutions(IKSolutionsBuffer& buffer,
+                                     const IKSolutionsBuffer& solutions,
+                                     std::size_t pose) const
+{
+  const Eigen::Index num_joints = inv_kin_->numJoints();
+  std::size_t num_solutions = 0;
+  for (std::size_t j = 0; j < solutions.numSolutions(pose); ++j)
+  {
+    const Eigen::Map<const Eigen::VectorXd> solution = solutions.getSolution(pose, j);
+    const std::size_t start = buffer.data.size();
+    buffer.data.resize(start + static_cast<std::size_t>(num_joints));
+    Eigen::Map<Eigen::VectorXd> ordered_sol(buffer.data.data() + start, num_joints);
+    if (reorder_required_)
+    {
+      for (Eigen::Index i = 0; i < num_joints; ++i)
+        ordered_sol(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
+    }
+    else
+    {
+      ordered_sol = solution;
+    }
+
+    if (tesseract_common::satisfiesPositionLimits<double>(ordered_sol, limits_.joint_limits))
+      ++num_solutions;
+    else
+      buffer.data.resize(start);
+  }
+
+  buffer.offsets.push_back(buffer.offsets.back() + num_solutions);
+}
 }  // namespace tesseract_kinematics
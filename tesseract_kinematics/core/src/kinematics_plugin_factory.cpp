@@ -39,6 +39,49 @@ using tesseract_common::KinematicsPluginInfo;
 
 namespace tesseract_kinematics
 {
+namespace
+{
+/** @brief Get the class name and config of a plugin, empty if the plugin does not exist */
+std::string getPluginConfig(const std::map<std::string, tesseract_common::PluginInfoContainer>& plugin_infos,
+                            const std::string& group_name,
+                            const std::string& solver_name)
+{
+  auto group_it = plugin_infos.find(group_name);
+  if (group_it == plugin_infos.end())
+    return {};
+
+  auto solver_it = group_it->second.plugins.find(solver_name);
+  if (solver_it == group_it->second.plugins.end())
+    return {};
+
+  return solver_it->second.class_name + "\n" + solver_it->second.getConfigString();
+}
+
+/** @brief Get the values of the joints which are not joints of the solver */
+std::unordered_map<std::string, double> getOtherJointValues(const std::vector<std::string>& joint_names,
+                                                            const tesseract_scene_graph::SceneState& scene_state)
+{
+  std::unordered_map<std::string, double> joint_values = scene_state.joints;
+  for (const auto& joint_name : joint_names)
+    joint_values.erase(joint_name);
+
+  return joint_values;
+}
+
+/** @brief Check if the values of the joints match the scene state */
+bool hasJointValues(const std::unordered_map<std::string, double>& joint_values,
+                    const tesseract_scene_graph::SceneState& scene_state)
+{
+  for (const auto& joint : joint_values)
+  {
+    auto it = scene_state.joints.find(joint.first);
+    if (it == scene_state.joints.end() || it->second != joint.second)
+      return false;
+  }
+  return true;
+}
+}  // namespace
+
 const std::string InvKinFactory::SECTION_NAME = "InvKin";
 const std::string FwdKinFactory::SECTION_NAME = "FwdKin";
 
@@ -323,6 +366,99 @@ KinematicsPluginFactory::createInvKin(const std::string& solver_name,
   }
 }
 
+ForwardKinematics::UPtr KinematicsPluginFactory::createFwdKin(const std::string& group_name,
+                                                              const std::string& solver_name,
+                                                              const tesseract_scene_graph::SceneGraph& scene_graph,
+                                                              const tesseract_scene_graph::SceneState& scene_state,
+                                                              int scene_graph_revision) const
+{
+  const std::string config = getPluginConfig(fwd_plugin_info_, group_name, solver_name);
+  if (config.empty())
+    return createFwdKin(group_name, solver_name, scene_graph, scene_state);
+
+  const auto key = std::make_pair(group_name, solver_name);
+  {
+    std::lock_guard<std::mutex> lock(solver_cache_.mutex);
+    auto it = solver_cache_.fwd_kin.find(key);
+    if (it != solver_cache_.fwd_kin.end() && it->second.revision == scene_graph_revision &&
+        it->second.config == config && hasJointValues(it->second.joint_values, scene_state))
+      return it->second.fwd_kin->clone();
+  }
+
+  ForwardKinematics::UPtr fwd_kin = createFwdKin(group_name, solver_name, scene_graph, scene_state);
+  if (fwd_kin == nullptr)
+    return nullptr;
+
+  SolverCacheEntry entry;
+  entry.revision = scene_graph_revision;
+  entry.config = config;
+  entry.joint_values = getOtherJointValues(fwd_kin->getJointNames(), scene_state);
+  entry.fwd_kin = fwd_kin->clone();
+
+  std::lock_guard<std::mutex> lock(solver_cache_.mutex);
+  solver_cache_.fwd_kin[key] = std::move(entry);
+  return fwd_kin;
+}
+
+InverseKinematics::UPtr KinematicsPluginFactory::createInvKin(const std::string& group_name,
+                                                              const std::string& solver_name,
+                                                              const tesseract_scene_graph::SceneGraph& scene_graph,
+                                                              const tesseract_scene_graph::SceneState& scene_state,
+                                                              int scene_graph_revision) const
+{
+  const std::string config = getPluginConfig(inv_plugin_info_, group_name, solver_name);
+  if (config.empty())
+    return createInvKin(group_name, solver_name, scene_graph, scene_state);
+
+  const auto key = std::make_pair(group_name, solver_name);
+  {
+    std::lock_guard<std::mutex> lock(solver_cache_.mutex);
+    auto it = solver_cache_.inv_kin.find(key);
+    if (it != solver_cache_.inv_kin.end() && it->second.revision == scene_graph_revision &&
+        it->second.config == config && hasJointValues(it->second.joint_values, scene_state))
+      return it->second.inv_kin->clone();
+  }
+
+  InverseKinematics::UPtr inv_kin = createInvKin(group_name, solver_name, scene_graph, scene_state);
+  if (inv_kin == nullptr)
+    return nullptr;
+
+  SolverCacheEntry entry;
+  entry.revision = scene_graph_revision;
+  entry.config = config;
+  entry.joint_values = getOtherJointValues(inv_kin->getJointNames(), scene_state);
+  entry.inv_kin = inv_kin->clone();
+
+  std::lock_guard<std::mutex> lock(solver_cache_.mutex);
+  solver_cache_.inv_kin[key] = std::move(entry);
+  return inv_kin;
+}
+
+void KinematicsPluginFactory::clearSolverCache() const
+{
+  std::lock_guard<std::mutex> lock(solver_cache_.mutex);
+  solver_cache_.fwd_kin.clear();
+  solver_cache_.inv_kin.clear();
+}
+
+KinematicsPluginFactory::SolverCache::SolverCache(const SolverCache& other)
+{
+  std::lock_guard<std::mutex> lock(other.mutex);
+  fwd_kin = other.fwd_kin;
+  inv_kin = other.inv_kin;
+}
+
+KinematicsPluginFactory::SolverCache& KinematicsPluginFactory::SolverCache::operator=(const SolverCache& other)
+{
+  if (this == &other)
+    return *this;
+
+  std::scoped_lock lock(mutex, other.mutex);
+  fwd_kin = other.fwd_kin;
+  inv_kin = other.inv_kin;
+  return *this;
+}
+
 void KinematicsPluginFactory::saveConfig(const tesseract_common::fs::path& file_path) const
 {
   YAML::Node config = getConfig();
@@ -0,0 +1,185 @@
+/**
+ * @file multi_group_inv_kin.cpp
+ * @brief Coordinated inverse kinematics of several independent kinematic groups.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_kinematics/core/multi_group_inv_kin.h>
+
+namespace tesseract_kinematics
+{
+MultiGroupIKSolutions::MultiGroupIKSolutions(std::vector<IKSolutions> group_solutions,
+                                             const std::vector<Eigen::Index>& num_joints,
+                                             MultiGroupIKFilter filter)
+  : group_solutions_(std::move(group_solutions)), filter_(std::move(filter)), indices_(group_solutions_.size(), 0)
+{
+  if (num_joints.size() != group_solutions_.size())
+    throw std::runtime_error("MultiGroupIKSolutions: The number of joints must be provided for each group!");
+
+  offsets_.reserve(num_joints.size() + 1);
+  for (const auto& group_num_joints : num_joints)
+    offsets_.push_back(offsets_.back() + group_num_joints);
+
+  joint_values_.resize(offsets_.back());
+}
+
+bool MultiGroupIKSolutions::next(Eigen::VectorXd& joint_values)
+{
+  if (group_solutions_.empty())
+    return false;
+
+  while (true)
+  {
+    if (indices_[level_] >= group_solutions_[level_].size())
+    {
+      // The group is exhausted, continue with the next solution of the previous group
+      if (level_ == 0)
+        return false;
+
+      indices_[level_] = 0;
+      --level_;
+      ++indices_[level_];
+      continue;
+    }
+
+    const Eigen::VectorXd& solution = group_solutions_[level_][indices_[level_]];
+    joint_values_.segment(offsets_[level_], solution.size()) = solution;
+
+    // A pruned solution skips every combination with the groups chosen so far
+    if (filter_ && !filter_(joint_values_.head(offsets_[level_ + 1]), level_ + 1))
+    {
+      ++indices_[level_];
+      continue;
+    }
+
+    if (level_ + 1 < group_solutions_.size())
+    {
+      ++level_;
+      continue;
+    }
+
+    joint_values = joint_values_;
+    ++indices_[level_];
+    return true;
+  }
+}
+
+void MultiGroupIKSolutions::reset()
+{
+  std::fill(indices_.begin(), indices_.end(), 0);
+  level_ = 0;
+}
+
+const std::vector<IKSolutions>& MultiGroupIKSolutions::getGroupSolutions() const { return group_solutions_; }
+
+Eigen::Index MultiGroupIKSolutions::numJoints() const { return offsets_.back(); }
+
+std::size_t MultiGroupIKSolutions::numCombinations() const
+{
+  if (group_solutions_.empty())
+    return 0;
+
+  std::size_t num_combinations{ 1 };
+  for (const auto& solutions : group_solutions_)
+    num_combinations *= solutions.size();
+
+  return num_combinations;
+}
+
+MultiGroupInvKin::MultiGroupInvKin(std::vector<KinematicGroup::ConstPtr> groups) : groups_(std::move(groups))
+{
+  if (groups_.empty())
+    throw std::runtime_error("MultiGroupInvKin: At least one kinematic group must be provided!");
+
+  std::unordered_set<std::string> joint_names;
+  for (const auto& group : groups_)
+  {
+    if (group == nullptr)
+      throw std::runtime_error("MultiGroupInvKin: Provided kinematic group is a nullptr!");
+
+    for (const auto& joint_name : group->getJointNames())
+    {
+      if (!joint_names.insert(joint_name).second)
+        throw std::runtime_error("MultiGroupInvKin: Joint '" + joint_name + "' is shared by more than one group!");
+
+      joint_names_.push_back(joint_name);
+    }
+  }
+}
+
+MultiGroupIKSolutions MultiGroupInvKin::calcInvKin(const std::vector<KinGroupIKInputs>& tip_link_poses,
+                                                   const std::vector<Eigen::VectorXd>& seeds,
+                                                   MultiGroupIKFilter filter,
+                                                   std::size_t threads) const
+{
+  if (tip_link_poses.size() != groups_.size() || seeds.size() != groups_.size())
+    throw std::runtime_error("MultiGroupInvKin: An input and seed must be provided for each group!");
+
+  const std::size_t num_groups = groups_.size();
+  std::vector<IKSolutions> group_solutions(num_groups);
+  std::vector<std::exception_ptr> errors(num_groups);
+  auto solve_groups = [&](std::size_t start, std::size_t step) {
+    for (std::size_t i = start; i < num_groups; i += step)
+    {
+      try
+      {
+        group_solutions[i] = groups_[i]->calcInvKin(tip_link_poses[i], seeds[i]);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  // The groups are independent, each worker solves every num_workers-th group starting at its own index
+  const std::size_t num_workers = std::min(std::max<std::size_t>(threads, 1), num_groups);
+  auto run = [&](std::size_t worker) { solve_groups(worker, num_workers); };
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, run);
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  std::vector<Eigen::Index> num_joints;
+  num_joints.reserve(num_groups);
+  for (const auto& group : groups_)
+    num_joints.push_back(group->numJoints());
+
+  return MultiGroupIKSolutions(std::move(group_solutions), num_joints, std::move(filter));
+}
+
+const std::vector<KinematicGroup::ConstPtr>& MultiGroupInvKin::getGroups() const { return groups_; }
+
+const std::vector<std::string>& MultiGroupInvKin::getJointNames() const { return joint_names_; }
+
+}  // namespace tesseract_kinematics
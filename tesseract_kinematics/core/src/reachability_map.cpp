@@ -0,0 +1,278 @@
+/**
+ * @file reachability_map.cpp
+ * @brief A precomputed map of the poses reachable by a kinematic group.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <boost/serialization/library_version_type.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/vector.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/reachability_map.h>
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_common/eigen_serialization.h>
+
+namespace tesseract_kinematics
+{
+ReachabilityMap::ReachabilityMap(std::vector<std::string> joint_names,
+                                 std::string working_frame,
+                                 std::string tip_link_name,
+                                 const Eigen::Vector3d& origin,
+                                 const Eigen::VectorXi& dimensions,
+                                 double resolution,
+                                 int orientation_bins,
+                                 std::size_t max_seeds)
+  : joint_names_(std::move(joint_names))
+  , working_frame_(std::move(working_frame))
+  , tip_link_name_(std::move(tip_link_name))
+  , origin_(origin)
+  , dimensions_(dimensions)
+  , resolution_(resolution)
+  , orientation_bins_(orientation_bins)
+  , max_seeds_(max_seeds)
+{
+  if (dimensions_.size() != 3 || (dimensions_.array() < 1).any())
+    throw std::runtime_error("ReachabilityMap: The dimensions must be three values greater than zero!");
+
+  if (!(resolution_ > 0))
+    throw std::runtime_error("ReachabilityMap: The resolution must be greater than zero!");
+
+  if (orientation_bins_ < 1)
+    throw std::runtime_error("ReachabilityMap: The number of orientation bins must be greater than zero!");
+}
+
+bool ReachabilityMap::insert(const Eigen::Isometry3d& pose, const Eigen::Ref<const Eigen::VectorXd>& seed)
+{
+  assert(seed.size() == static_cast<Eigen::Index>(joint_names_.size()));
+
+  std::size_t voxel{ 0 };
+  if (!getVoxelIndex(voxel, pose.translation()))
+    return false;
+
+  std::vector<double>& seeds = cells_[(voxel * numOrientationBins()) + getOrientationBin(pose.linear().col(2))];
+  if (seeds.size() < max_seeds_ * joint_names_.size())
+    seeds.insert(seeds.end(), seed.data(), seed.data() + seed.size());
+
+  return true;
+}
+
+bool ReachabilityMap::isLikelyReachable(const Eigen::Isometry3d& pose) const
+{
+  std::size_t voxel{ 0 };
+  if (!getVoxelIndex(voxel, pose.translation()))
+    return false;
+
+  return (cells_.find((voxel * numOrientationBins()) + getOrientationBin(pose.linear().col(2))) != cells_.end());
+}
+
+bool ReachabilityMap::isLikelyReachable(const Eigen::Vector3d& position) const
+{
+  std::size_t voxel{ 0 };
+  if (!getVoxelIndex(voxel, position))
+    return false;
+
+  const std::size_t num_bins = numOrientationBins();
+  for (std::size_t bin = 0; bin < num_bins; ++bin)
+  {
+    if (cells_.find((voxel * num_bins) + bin) != cells_.end())
+      return true;
+  }
+  return false;
+}
+
+std::vector<Eigen::VectorXd> ReachabilityMap::getSeeds(const Eigen::Isometry3d& pose) const
+{
+  std::vector<Eigen::VectorXd> seeds;
+  std::size_t voxel{ 0 };
+  if (!getVoxelIndex(voxel, pose.translation()))
+    return seeds;
+
+  auto it = cells_.find((voxel * numOrientationBins()) + getOrientationBin(pose.linear().col(2)));
+  if (it == cells_.end() || joint_names_.empty())
+    return seeds;
+
+  const auto num_joints = static_cast<Eigen::Index>(joint_names_.size());
+  seeds.reserve(it->second.size() / joint_names_.size());
+  for (std::size_t i = 0; i < it->second.size(); i += joint_names_.size())
+    seeds.emplace_back(Eigen::Map<const Eigen::VectorXd>(it->second.data() + i, num_joints));
+
+  return seeds;
+}
+
+std::size_t ReachabilityMap::size() const { return cells_.size(); }
+
+const std::vector<std::string>& ReachabilityMap::getJointNames() const { return joint_names_; }
+
+const std::string& ReachabilityMap::getWorkingFrame() const { return working_frame_; }
+
+const std::string& ReachabilityMap::getTipLinkName() const { return tip_link_name_; }
+
+const Eigen::Vector3d& ReachabilityMap::getOrigin() const { return origin_; }
+
+const Eigen::VectorXi& ReachabilityMap::getDimensions() const { return dimensions_; }
+
+double ReachabilityMap::getResolution() const { return resolution_; }
+
+int ReachabilityMap::getOrientationBins() const { return orientation_bins_; }
+
+std::size_t ReachabilityMap::getMaxSeeds() const { return max_seeds_; }
+
+bool ReachabilityMap::operator==(const ReachabilityMap& rhs) const
+{
+  bool ret_val = true;
+  ret_val &= (joint_names_ == rhs.joint_names_);
+  ret_val &= (working_frame_ == rhs.working_frame_);
+  ret_val &= (tip_link_name_ == rhs.tip_link_name_);
+  ret_val &= (origin_.isApprox(rhs.origin_, 1e-5));
+  ret_val &= (dimensions_ == rhs.dimensions_);
+  ret_val &= (std::abs(resolution_ - rhs.resolution_) < 1e-8);
+  ret_val &= (orientation_bins_ == rhs.orientation_bins_);
+  ret_val &= (max_seeds_ == rhs.max_seeds_);
+  ret_val &= (cells_ == rhs.cells_);
+  return ret_val;
+}
+
+bool ReachabilityMap::operator!=(const ReachabilityMap& rhs) const { return !operator==(rhs); }
+
+bool ReachabilityMap::getVoxelIndex(std::size_t& index, const Eigen::Vector3d& position) const
+{
+  const Eigen::Array3d cell = ((position - origin_) / resolution_).array().floor();
+  if ((cell < 0).any() || (cell >= dimensions_.array().cast<double>()).any())
+    return false;
+
+  const auto x = static_cast<std::size_t>(cell.x());
+  const auto y = static_cast<std::size_t>(cell.y());
+  const auto z = static_cast<std::size_t>(cell.z());
+  index = (((z * static_cast<std::size_t>(dimensions_.y())) + y) * static_cast<std::size_t>(dimensions_.x())) + x;
+  return true;
+}
+
+std::size_t ReachabilityMap::getOrientationBin(const Eigen::Vector3d& direction) const
+{
+  // Project the direction onto the face of the cube along its largest component
+  Eigen::Index axis{ 0 };
+  direction.cwiseAbs().maxCoeff(&axis);
+  const double major = direction(axis);
+  const std::size_t face = (2 * static_cast<std::size_t>(axis)) + ((major < 0) ? 1 : 0);
+
+  const auto n = static_cast<std::size_t>(orientation_bins_);
+  auto toCell = [n, major](double minor) {
+    const double u = ((minor / std::abs(major)) + 1.0) / 2.0;
+    return std::min(static_cast<std::size_t>(std::max(u, 0.0) * static_cast<double>(n)), n - 1);
+  };
+
+  const std::size_t u = toCell(direction((axis + 1) % 3));
+  const std::size_t v = toCell(direction((axis + 2) % 3));
+  return (((face * n) + u) * n) + v;
+}
+
+std::size_t ReachabilityMap::numOrientationBins() const
+{
+  const auto n = static_cast<std::size_t>(orientation_bins_);
+  return 6 * n * n;
+}
+
+template <class Archive>
+void ReachabilityMap::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+{
+  ar& BOOST_SERIALIZATION_NVP(joint_names_);
+  ar& BOOST_SERIALIZATION_NVP(working_frame_);
+  ar& BOOST_SERIALIZATION_NVP(tip_link_name_);
+  ar& BOOST_SERIALIZATION_NVP(origin_);
+  ar& BOOST_SERIALIZATION_NVP(dimensions_);
+  ar& BOOST_SERIALIZATION_NVP(resolution_);
+  ar& BOOST_SERIALIZATION_NVP(orientation_bins_);
+  ar& BOOST_SERIALIZATION_NVP(max_seeds_);
+  ar& BOOST_SERIALIZATION_NVP(cells_);
+}
+
+ReachabilityMap createReachabilityMap(const JointGroup& group,
+                                      const std::string& working_frame,
+                                      const std::string& tip_link_name,
+                                      const ReachabilityMapSettings& settings)
+{
+  if (settings.num_samples == 0)
+    throw std::runtime_error("createReachabilityMap: The number of samples must be greater than zero!");
+
+  // Joints with infinite limits are sampled over a single revolution
+  Eigen::MatrixX2d limits = group.getLimits().joint_limits;
+  for (Eigen::Index i = 0; i < limits.rows(); ++i)
+  {
+    if (!std::isfinite(limits(i, 0)))
+      limits(i, 0) = -M_PI;
+
+    if (!std::isfinite(limits(i, 1)))
+      limits(i, 1) = M_PI;
+  }
+
+  const std::vector<long> link_indices = group.getLinkIndices({ working_frame, tip_link_name });
+  tesseract_common::VectorIsometry3d link_transforms(link_indices.size());
+
+  // The tip link poses are kept to size the voxel grid before inserting them
+  std::mt19937 generator(settings.random_seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const Eigen::Index num_joints = group.numJoints();
+  Eigen::MatrixXd samples(num_joints, static_cast<Eigen::Index>(settings.num_samples));
+  tesseract_common::VectorIsometry3d poses;
+  poses.reserve(settings.num_samples);
+  Eigen::Vector3d min_position = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d max_position = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (Eigen::Index s = 0; s < samples.cols(); ++s)
+  {
+    for (Eigen::Index i = 0; i < num_joints; ++i)
+      samples(i, s) = limits(i, 0) + (distribution(generator) * (limits(i, 1) - limits(i, 0)));
+
+    group.calcFwdKin(link_transforms, samples.col(s), link_indices);
+    poses.push_back(link_transforms[0].inverse() * link_transforms[1]);
+    min_position = min_position.cwiseMin(poses.back().translation());
+    max_position = max_position.cwiseMax(poses.back().translation());
+  }
+
+  const Eigen::VectorXi dimensions =
+      (((max_position - min_position) / settings.resolution).array().floor() + 1).cast<int>().matrix();
+  ReachabilityMap map(group.getJointNames(),
+                      working_frame,
+                      tip_link_name,
+                      min_position,
+                      dimensions,
+                      settings.resolution,
+                      settings.orientation_bins,
+                      settings.max_seeds);
+
+  for (std::size_t s = 0; s < poses.size(); ++s)
+    map.insert(poses[s], samples.col(static_cast<Eigen::Index>(s)));
+
+  return map;
+}
+}  // namespace tesseract_kinematics
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_kinematics::ReachabilityMap)
@@ -40,6 +40,8 @@ InverseKinematics::UPtr ROPInvKinFactory::create(const std::string& solver_name,
   double m_reach{ 0 };
   Eigen::MatrixX2d sample_range;
   Eigen::VectorXd sample_res;
+  std::size_t threads{ 1 };
+  std::size_t max_solutions{ 0 };
 
   try
   {
@@ -49,6 +51,13 @@ InverseKinematics::UPtr ROPInvKinFactory::create(const std::string& solver_name,
     else
       throw std::runtime_error("ROPInvKinFactory, missing 'manipulator_reach' entry!");
 
+    // Get the optional search settings
+    if (YAML::Node n = config["threads"])
+      threads = n.as<std::size_t>();
+
+    if (YAML::Node n = config["max_solutions"])
+      max_solutions = n.as<std::size_t>();
+
     // Get positioner sample resolution
     std::map<std::string, std::array<double, 3>> sample_res_map;
     if (YAML::Node sample_res_node = config["positioner_sample_resolution"])
@@ -167,8 +176,11 @@ InverseKinematics::UPtr ROPInvKinFactory::create(const std::string& solver_name,
     return nullptr;
   }
 
-  return std::make_unique<ROPInvKin>(
+  auto rop_inv_kin = std::make_unique<ROPInvKin>(
       scene_graph, scene_state, std::move(inv_kin), m_reach, std::move(fwd_kin), sample_range, sample_res, solver_name);
+  rop_inv_kin->setThreads(threads);
+  rop_inv_kin->setMaxSolutions(max_solutions);
+  return rop_inv_kin;
 }
 
 TESSERACT_PLUGIN_ANCHOR_IMPL(ROPInvKinFactoriesAnchor)
@@ -25,9 +25,11 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/executor.h>
 #include <tesseract_kinematics/core/rop_inv_kin.h>
 
 namespace tesseract_kinematics
@@ -35,6 +37,9 @@ namespace tesseract_kinematics
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
+/** @brief The number of positioner samples a worker claims at a time when searching with more than one worker */
+static const std::size_t SAMPLE_CHUNK_SIZE = 16;
+
 ROPInvKin::ROPInvKin(const tesseract_scene_graph::SceneGraph& scene_graph,
                      const tesseract_scene_graph::SceneState& scene_state,
                      InverseKinematics::UPtr manipulator,
@@ -142,7 +147,7 @@ void ROPInvKin::init(const tesseract_scene_graph::SceneGraph& scene_graph,
   joint_names_.insert(joint_names_.end(), manip_joints.begin(), manip_joints.end());
 
   // For the kinematics object to be sampled we need to create the joint values at the sampling resolution
-  // The sampled joints results are stored in dof_range[joint index] to be used by the nested_ik function
+  // The sampled joints results are stored in dof_range[joint index] to be used by the ikAtSamples function
   auto positioner_num_joints = static_cast<int>(positioner_fwd_kin_->numJoints());
   dof_range_.reserve(static_cast<std::size_t>(positioner_num_joints));
   for (int d = 0; d < positioner_num_joints; ++d)
@@ -170,56 +175,131 @@ ROPInvKin& ROPInvKin::operator=(const ROPInvKin& other)
   manip_reach_ = other.manip_reach_;
   joint_names_ = other.joint_names_;
   dof_ = other.dof_;
+  positioner_to_robot_ = other.positioner_to_robot_;
   dof_range_ = other.dof_range_;
+  max_solutions_ = other.max_solutions_;
+  setThreads(other.threads_);
 
   return *this;
 }
 
+void ROPInvKin::setThreads(std::size_t threads)
+{
+  threads_ = std::max<std::size_t>(threads, 1);
+  worker_manip_inv_kin_.clear();
+  worker_positioner_fwd_kin_.clear();
+  for (std::size_t i = 1; i < threads_; ++i)
+  {
+    worker_manip_inv_kin_.push_back(manip_inv_kin_->clone());
+    worker_positioner_fwd_kin_.push_back(positioner_fwd_kin_->clone());
+  }
+}
+
+std::size_t ROPInvKin::getThreads() const { return threads_; }
+
+void ROPInvKin::setMaxSolutions(std::size_t max_solutions) { max_solutions_ = max_solutions; }
+
+std::size_t ROPInvKin::getMaxSolutions() const { return max_solutions_; }
+
 IKSolutions ROPInvKin::calcInvKinHelper(const tesseract_common::TransformMap& tip_link_poses,
                                         const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
-  Eigen::VectorXd positioner_pose(positioner_fwd_kin_->numJoints());
+  std::size_t num_samples = 1;
+  for (const auto& range : dof_range_)
+    num_samples *= static_cast<std::size_t>(range.size());
+
   IKSolutions solutions;
-  nested_ik(solutions, 0, dof_range_, tip_link_poses, positioner_pose, seed);
+  const std::size_t num_chunks = (num_samples + SAMPLE_CHUNK_SIZE - 1) / SAMPLE_CHUNK_SIZE;
+  const std::size_t num_workers = std::min(threads_, num_chunks);
+  if (num_workers <= 1)
+  {
+    ikAtSamples(solutions, *manip_inv_kin_, *positioner_fwd_kin_, tip_link_poses, seed, 0, num_samples);
+    return solutions;
+  }
+
+  // The threads claim chunks of samples in turn, each chunk keeps its own solutions so they are returned in sample
+  // order. Once the maximum number of solutions is found no more chunks are claimed.
+  std::vector<IKSolutions> chunk_solutions(num_chunks);
+  std::atomic<std::size_t> next_chunk{ 0 };
+  std::atomic<std::size_t> num_found{ 0 };
+  auto search = [&](const InverseKinematics& manip_inv_kin, const ForwardKinematics& positioner_fwd_kin) {
+    for (std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+    {
+      if (max_solutions_ > 0 && num_found >= max_solutions_)
+        return;
+
+      const std::size_t start = chunk * SAMPLE_CHUNK_SIZE;
+      const std::size_t end = std::min(start + SAMPLE_CHUNK_SIZE, num_samples);
+      ikAtSamples(chunk_solutions[chunk], manip_inv_kin, positioner_fwd_kin, tip_link_poses, seed, start, end);
+      num_found += chunk_solutions[chunk].size();
+    }
+  };
+
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, [&](std::size_t i) {
+    if (i == 0)
+      search(*manip_inv_kin_, *positioner_fwd_kin_);
+    else
+      search(*worker_manip_inv_kin_[i - 1], *worker_positioner_fwd_kin_[i - 1]);
+  });
+
+  for (auto& chunk : chunk_solutions)
+    solutions.insert(solutions.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+
+  if (max_solutions_ > 0 && solutions.size() > max_solutions_)
+    solutions.resize(max_solutions_);
+
   return solutions;
 }
 
-void ROPInvKin::nested_ik(IKSolutions& solutions,
-                          int loop_level,
-                          const std::vector<Eigen::VectorXd>& dof_range,
-                          const tesseract_common::TransformMap& tip_link_poses,
-                          Eigen::VectorXd& positioner_pose,
-                          const Eigen::Ref<const Eigen::VectorXd>& seed) const
+void ROPInvKin::ikAtSamples(IKSolutions& solutions,
+                            const InverseKinematics& manip_inv_kin,
+                            const ForwardKinematics& positioner_fwd_kin,
+                            const tesseract_common::TransformMap& tip_link_poses,
+                            const Eigen::Ref<const Eigen::VectorXd>& seed,
+                            std::size_t start,
+                            std::size_t end) const
 {
-  if (loop_level >= positioner_fwd_kin_->numJoints())
+  Eigen::VectorXd positioner_pose(positioner_fwd_kin.numJoints());
+  for (std::size_t sample = start; sample < end; ++sample)
   {
-    ikAt(solutions, tip_link_poses, positioner_pose, seed);
-    return;
+    if (max_solutions_ > 0 && solutions.size() >= max_solutions_)
+      break;
+
+    // The last positioner joint changes fastest, the order of nested loops over the positioner joints
+    std::size_t index = sample;
+    for (Eigen::Index d = positioner_pose.size() - 1; d >= 0; --d)
+    {
+      const Eigen::VectorXd& range = dof_range_[static_cast<std::size_t>(d)];
+      const auto range_size = static_cast<std::size_t>(range.size());
+      positioner_pose(d) = range(static_cast<Eigen::Index>(index % range_size));
+      index /= range_size;
+    }
+
+    ikAt(solutions, manip_inv_kin, positioner_fwd_kin, tip_link_poses, positioner_pose, seed);
   }
 
-  for (long i = 0; i < static_cast<long>(dof_range[static_cast<std::size_t>(loop_level)].size()); ++i)
-  {
-    positioner_pose(loop_level) = dof_range[static_cast<std::size_t>(loop_level)][i];
-    nested_ik(solutions, loop_level + 1, dof_range, tip_link_poses, positioner_pose, seed);
-  }
+  if (max_solutions_ > 0 && solutions.size() > max_solutions_)
+    solutions.resize(max_solutions_);
 }
 
 void ROPInvKin::ikAt(IKSolutions& solutions,
+                     const InverseKinematics& manip_inv_kin,
+                     const ForwardKinematics& positioner_fwd_kin,
                      const tesseract_common::TransformMap& tip_link_poses,
                      Eigen::VectorXd& positioner_pose,
                      const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
-  tesseract_common::TransformMap positioner_poses = positioner_fwd_kin_->calcFwdKin(positioner_pose);
+  tesseract_common::TransformMap positioner_poses = positioner_fwd_kin.calcFwdKin(positioner_pose);
   Eigen::Isometry3d positioner_tf = positioner_poses[positioner_tip_link_] * positioner_to_robot_;
   Eigen::Isometry3d robot_target_pose = positioner_tf.inverse() * tip_link_poses.at(manip_tip_link_);
   if (robot_target_pose.translation().norm() > manip_reach_)
     return;
 
   tesseract_common::TransformMap robot_target_poses{ std::make_pair(manip_tip_link_, robot_target_pose) };
-  auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin_->numJoints());
+  auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin.numJoints());
   auto positioner_dof = static_cast<Eigen::Index>(positioner_pose.size());
 
-  IKSolutions robot_solution_set = manip_inv_kin_->calcInvKin(robot_target_poses, seed.tail(robot_dof));
+  IKSolutions robot_solution_set = manip_inv_kin.calcInvKin(robot_target_poses, seed.tail(robot_dof));
   if (robot_solution_set.empty())
     return;
 
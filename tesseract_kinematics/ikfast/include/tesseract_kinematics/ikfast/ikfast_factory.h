@@ -0,0 +1,56 @@
+/**
+ * @file ikfast_factory.h
+ * @brief Tesseract IKFast Inverse kinematics Factory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_IKFAST_FACTORY_H
+#define TESSERACT_KINEMATICS_IKFAST_FACTORY_H
+
+#include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+
+namespace tesseract_kinematics
+{
+/**
+ * @brief Creates IKFastLibraryInvKin solvers loading a generated IKFast solver by path
+ * @details The config entries are:
+ *   - base_link: The base link of the solver
+ *   - tip_link: The tip link of the solver
+ *   - library: The path of the shared library the generated solver is compiled into
+ *   - free_joint_states: (Optional) The combinations of free joint values to solve for, for example [[-1.0], [1.0]]
+ *   - free_joint_samples: (Optional) The values of each free joint to solve for, all combinations are solved for. For
+ *     example [[0, 1, 2], [3, 4]]. Only one of free_joint_states and free_joint_samples may be provided.
+ *   - threads: (Optional) The number of threads searching the free joint states, defaults to one
+ *   - max_solutions: (Optional) The search stops once this many solutions are found, defaults to zero returning all
+ */
+class IKFastLibraryInvKinFactory : public InvKinFactory
+{
+  InverseKinematics::UPtr create(const std::string& solver_name,
+                                 const tesseract_scene_graph::SceneGraph& scene_graph,
+                                 const tesseract_scene_graph::SceneState& scene_state,
+                                 const KinematicsPluginFactory& plugin_factory,
+                                 const YAML::Node& config) const override final;
+};
+
+TESSERACT_PLUGIN_ANCHOR_DECL(IKFastFactoriesAnchor)
+
+}  // namespace tesseract_kinematics
+#endif  // TESSERACT_KINEMATICS_IKFAST_FACTORY_H
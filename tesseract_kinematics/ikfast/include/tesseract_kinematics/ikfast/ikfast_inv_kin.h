@@ -106,6 +106,7 @@ public:
                std::string solver_name = IKFAST_INV_KIN_CHAIN_SOLVER_NAME,
                std::vector<std::vector<double>> free_joint_states = {});
 
+  using InverseKinematics::calcInvKin;
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override;
 
@@ -0,0 +1,206 @@
+/**
+ * @file ikfast_library_inv_kin.h
+ * @brief IKFast inverse kinematics loading a generated solver from a shared library at runtime.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_IKFAST_LIBRARY_INV_KIN_H
+#define TESSERACT_KINEMATICS_IKFAST_LIBRARY_INV_KIN_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <vector>
+#include <tesseract_kinematics/ikfast/external/ikfast.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace boost::dll
+{
+class shared_library;
+}
+
+namespace tesseract_kinematics
+{
+static const std::string IKFAST_LIBRARY_INV_KIN_SOLVER_NAME = "IKFastLibraryInvKin";
+
+/**
+ * @brief A generated IKFast solver loaded from a shared library
+ * @details The generated solver must be compiled into a shared library with IKFAST_HAS_LIBRARY, IKFAST_CLIBRARY and
+ * IKFAST_NO_MAIN defined and without IKFAST_NAMESPACE, so its functions are exported with C linkage. IkReal must be
+ * double. For example:
+ *
+ * add_library(my_robot_ikfast_solver SHARED my_robot_ikfast_solver.cpp)
+ * target_compile_definitions(my_robot_ikfast_solver PRIVATE IKFAST_HAS_LIBRARY IKFAST_CLIBRARY IKFAST_NO_MAIN)
+ * target_link_libraries(my_robot_ikfast_solver PRIVATE ${LAPACK_LIBRARIES})
+ *
+ * The library stays loaded while this object or any solver using it exists.
+ */
+class IKFastLibrary
+{
+public:
+  using Ptr = std::shared_ptr<IKFastLibrary>;
+  using ConstPtr = std::shared_ptr<const IKFastLibrary>;
+  using UPtr = std::unique_ptr<IKFastLibrary>;
+  using ConstUPtr = std::unique_ptr<const IKFastLibrary>;
+
+  /**
+   * @brief Load a generated IKFast solver
+   * @details Throws if the library can not be loaded, does not export the IKFast functions or uses another real type
+   * @param library_path The path of the shared library
+   */
+  explicit IKFastLibrary(std::string library_path);
+  ~IKFastLibrary();
+  IKFastLibrary(const IKFastLibrary&) = delete;
+  IKFastLibrary& operator=(const IKFastLibrary&) = delete;
+  IKFastLibrary(IKFastLibrary&&) = delete;
+  IKFastLibrary& operator=(IKFastLibrary&&) = delete;
+
+  /**
+   * @brief Compute all solutions for a pose and the values of the free joints
+   * @param translation The three translation values
+   * @param rotation The nine rotation matrix values in row major order
+   * @param free_joint_values The values of the free joints, nullptr if there are none
+   * @param solutions The solution list the solutions are added to
+   * @return True if a solution was found, otherwise false
+   */
+  bool computeIk(const double* translation,
+                 const double* rotation,
+                 const double* free_joint_values,
+                 ikfast::IkSolutionListBase<double>& solutions) const;
+
+  /** @brief Get the number of joints of the solver */
+  int getNumJoints() const;
+
+  /** @brief Get the indices of the free joints of the solver */
+  std::vector<int> getFreeParameters() const;
+
+  /** @brief Get the path of the shared library */
+  const std::string& getLibraryPath() const;
+
+private:
+  std::string library_path_;
+  std::unique_ptr<boost::dll::shared_library> library_;
+  ikfast::IkFastFunctions<double> functions_;
+};
+
+/**
+ * @brief IKFast inverse kinematics using a generated solver loaded at runtime
+ * @details Unlike IKFastInvKin this does not require compiling a library per robot against tesseract, the generated
+ * solver is loaded by path. Solvers with free joints are solved for each of the provided free joint states, which can
+ * be searched on multiple threads.
+ */
+class IKFastLibraryInvKin : public InverseKinematics
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<IKFastLibraryInvKin>;
+  using ConstPtr = std::shared_ptr<const IKFastLibraryInvKin>;
+  using UPtr = std::unique_ptr<IKFastLibraryInvKin>;
+  using ConstUPtr = std::unique_ptr<const IKFastLibraryInvKin>;
+
+  ~IKFastLibraryInvKin() override = default;
+  IKFastLibraryInvKin(const IKFastLibraryInvKin& other) = default;
+  IKFastLibraryInvKin& operator=(const IKFastLibraryInvKin& other) = default;
+  IKFastLibraryInvKin(IKFastLibraryInvKin&&) = default;
+  IKFastLibraryInvKin& operator=(IKFastLibraryInvKin&&) = default;
+
+  /**
+   * @brief Construct IKFast Inverse Kinematics using a loaded solver
+   * @param library The loaded solver, throws if it is a nullptr or its number of joints does not match
+   * @param base_link_name The name of the base link for the kinematic chain
+   * @param tip_link_name The name of the tip link for the kinematic chain
+   * @param joint_names The joint names for the kinematic chain
+   * @param redundancy_capable_joints The indices of the joints the solutions are harmonized toward zero for
+   * @param free_joint_states The combinations of free joint values to solve for, see
+   * IKFastInvKin::generateAllFreeJointStateCombinations. Throws if it is empty while the solver has free joints.
+   * @param solver_name The solver name of the kinematic chain
+   */
+  IKFastLibraryInvKin(IKFastLibrary::ConstPtr library,
+                      std::string base_link_name,
+                      std::string tip_link_name,
+                      std::vector<std::string> joint_names,
+                      std::vector<Eigen::Index> redundancy_capable_joints,
+                      std::vector<std::vector<double>> free_joint_states = {},
+                      std::string solver_name = IKFAST_LIBRARY_INV_KIN_SOLVER_NAME);
+
+  using InverseKinematics::calcInvKin;
+  IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
+                         const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
+  /**
+   * @brief Set the number of threads used to search the free joint states
+   * @details The calling thread is one of them, so one searches on the calling thread only
+   * @param threads The number of threads
+   */
+  void setThreads(std::size_t threads);
+
+  /** @brief Get the number of threads used to search the free joint states */
+  std::size_t getThreads() const;
+
+  /**
+   * @brief Set the maximum number of solutions returned
+   * @details The search of the free joint states stops once this many solutions are found. The solutions returned are
+   * the same as a search on one thread.
+   * @param max_solutions The maximum number of solutions, zero returns all solutions
+   */
+  void setMaxSolutions(std::size_t max_solutions);
+
+  /** @brief Get the maximum number of solutions returned, zero if all solutions are returned */
+  std::size_t getMaxSolutions() const;
+
+  /** @brief Get the loaded solver */
+  IKFastLibrary::ConstPtr getLibrary() const;
+
+  Eigen::Index numJoints() const override final;
+  std::vector<std::string> getJointNames() const override final;
+  std::string getBaseLinkName() const override final;
+  std::string getWorkingFrame() const override final;
+  std::vector<std::string> getTipLinkNames() const override final;
+  std::string getSolverName() const override final;
+  InverseKinematics::UPtr clone() const override final;
+
+private:
+  IKFastLibrary::ConstPtr library_;                     /**< @brief The loaded solver, shared with the clones */
+  std::string base_link_name_;                          /**< @brief Link name of first link in the kinematic object */
+  std::string tip_link_name_;                           /**< @brief Link name of last kink in the kinematic object */
+  std::vector<std::string> joint_names_;                /**< @brief Joint names for the kinematic object */
+  std::vector<Eigen::Index> redundancy_capable_joints_; /**< @brief Redundancy capable joints */
+  std::vector<std::vector<double>> free_joint_states_;  /**< @brief Combinations of free joints to solve for */
+  std::string solver_name_{ IKFAST_LIBRARY_INV_KIN_SOLVER_NAME }; /**< @brief Name of this solver */
+  std::size_t threads_{ 1 };       /**< @brief The number of threads searching the free joint states */
+  std::size_t max_solutions_{ 0 }; /**< @brief The maximum number of solutions returned, zero for all */
+
+  /** @brief Solve for the free joint states in [start, end) and append the solutions in order */
+  void ikAtFreeJointStates(IKSolutions& solutions,
+                           const double* translation,
+                           const double* rotation,
+                           std::size_t start,
+                           std::size_t end) const;
+};
+}  // namespace tesseract_kinematics
+#endif  // TESSERACT_KINEMATICS_IKFAST_LIBRARY_INV_KIN_H
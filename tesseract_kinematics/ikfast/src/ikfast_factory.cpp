@@ -0,0 +1,141 @@
+/**
+ * @file ikfast_factory.cpp
+ * @brief Tesseract IKFast Inverse kinematics Factory
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_kinematics/ikfast/ikfast_factory.h>
+#include <tesseract_kinematics/ikfast/ikfast_library_inv_kin.h>
+
+namespace tesseract_kinematics
+{
+InverseKinematics::UPtr IKFastLibraryInvKinFactory::create(const std::string& solver_name,
+                                                           const tesseract_scene_graph::SceneGraph& scene_graph,
+                                                           const tesseract_scene_graph::SceneState& /*scene_state*/,
+                                                           const KinematicsPluginFactory& /*plugin_factory*/,
+                                                           const YAML::Node& config) const
+{
+  std::string base_link;
+  std::string tip_link;
+  std::string library_path;
+  std::vector<std::vector<double>> free_joint_states;
+  std::size_t threads{ 1 };
+  std::size_t max_solutions{ 0 };
+  tesseract_scene_graph::ShortestPath path;
+  std::vector<Eigen::Index> redundancy_capable_joints;
+
+  try
+  {
+    if (YAML::Node n = config["base_link"])
+      base_link = n.as<std::string>();
+    else
+      throw std::runtime_error("IKFastLibraryInvKinFactory, missing 'base_link' entry");
+
+    if (YAML::Node n = config["tip_link"])
+      tip_link = n.as<std::string>();
+    else
+      throw std::runtime_error("IKFastLibraryInvKinFactory, missing 'tip_link' entry");
+
+    if (YAML::Node n = config["library"])
+      library_path = n.as<std::string>();
+    else
+      throw std::runtime_error("IKFastLibraryInvKinFactory, missing 'library' entry");
+
+    if (config["free_joint_states"] && config["free_joint_samples"])
+      throw std::runtime_error("IKFastLibraryInvKinFactory, only one of 'free_joint_states' and 'free_joint_samples' "
+                               "may be provided");
+
+    if (YAML::Node n = config["free_joint_states"])
+      free_joint_states = n.as<std::vector<std::vector<double>>>();
+
+    // Solve for all combinations of the free joint samples, the last free joint changes fastest
+    if (YAML::Node n = config["free_joint_samples"])
+    {
+      auto free_joint_samples = n.as<std::vector<std::vector<double>>>();
+      free_joint_states.emplace_back();
+      for (const auto& samples : free_joint_samples)
+      {
+        if (samples.empty())
+          throw std::runtime_error("IKFastLibraryInvKinFactory, 'free_joint_samples' has a free joint without samples");
+
+        std::vector<std::vector<double>> combinations;
+        combinations.reserve(free_joint_states.size() * samples.size());
+        for (const auto& state : free_joint_states)
+        {
+          for (double sample : samples)
+          {
+            combinations.push_back(state);
+            combinations.back().push_back(sample);
+          }
+        }
+        free_joint_states = std::move(combinations);
+      }
+    }
+
+    if (YAML::Node n = config["threads"])
+      threads = n.as<std::size_t>();
+
+    if (YAML::Node n = config["max_solutions"])
+      max_solutions = n.as<std::size_t>();
+
+    path = scene_graph.getShortestPath(base_link, tip_link);
+    for (std::size_t i = 0; i < path.active_joints.size(); ++i)
+    {
+      auto joint = scene_graph.getJoint(path.active_joints[i]);
+      if (joint->type == tesseract_scene_graph::JointType::REVOLUTE ||
+          joint->type == tesseract_scene_graph::JointType::CONTINUOUS)
+        redundancy_capable_joints.push_back(static_cast<Eigen::Index>(i));
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("IKFastLibraryInvKinFactory: Failed to parse yaml config data! Details: %s", e.what());
+    return nullptr;
+  }
+
+  try
+  {
+    auto library = std::make_shared<IKFastLibrary>(library_path);
+    auto inv_kin = std::make_unique<IKFastLibraryInvKin>(library,
+                                                         base_link,
+                                                         tip_link,
+                                                         path.active_joints,
+                                                         redundancy_capable_joints,
+                                                         free_joint_states,
+                                                         solver_name);
+    inv_kin->setThreads(threads);
+    inv_kin->setMaxSolutions(max_solutions);
+    return inv_kin;
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("IKFastLibraryInvKinFactory: Failed to create solver! Details: %s", e.what());
+    return nullptr;
+  }
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(IKFastFactoriesAnchor)
+
+}  // namespace tesseract_kinematics
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+TESSERACT_ADD_INV_KIN_PLUGIN(tesseract_kinematics::IKFastLibraryInvKinFactory, IKFastLibraryInvKinFactory);
@@ -0,0 +1,248 @@
+/**
+ * @file ikfast_library_inv_kin.cpp
+ * @brief IKFast inverse kinematics loading a generated solver from a shared library at runtime.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/dll/shared_library.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_kinematics/ikfast/ikfast_library_inv_kin.h>
+#include <tesseract_kinematics/core/utils.h>
+
+namespace tesseract_kinematics
+{
+/** @brief The number of free joint states a worker claims at a time when searching with more than one worker */
+static const std::size_t FREE_JOINT_STATE_CHUNK_SIZE = 4;
+
+IKFastLibrary::IKFastLibrary(std::string library_path) : library_path_(std::move(library_path))
+{
+  boost::system::error_code ec;
+  library_ = std::make_unique<boost::dll::shared_library>(library_path_, ec);
+  if (ec)
+    throw std::runtime_error("IKFastLibrary: Failed to load library '" + library_path_ + "' with error: " +
+                             ec.message());
+
+  auto getFunction = [this](auto& function, const std::string& symbol_name) {
+    if (!library_->has(symbol_name))
+      throw std::runtime_error("IKFastLibrary: Library '" + library_path_ + "' is missing symbol '" + symbol_name +
+                               "', it must be compiled with IKFAST_CLIBRARY defined!");
+
+    using FunctionType = std::remove_pointer_t<std::remove_reference_t<decltype(function)>>;
+    function = &library_->get<FunctionType>(symbol_name);
+  };
+
+  getFunction(functions_._ComputeIk, "ComputeIk");
+  getFunction(functions_._ComputeFk, "ComputeFk");
+  getFunction(functions_._GetNumFreeParameters, "GetNumFreeParameters");
+  getFunction(functions_._GetFreeParameters, "GetFreeParameters");
+  getFunction(functions_._GetNumJoints, "GetNumJoints");
+  getFunction(functions_._GetIkRealSize, "GetIkRealSize");
+
+  if (functions_._GetIkRealSize() != static_cast<int>(sizeof(double)))
+    throw std::runtime_error("IKFastLibrary: Library '" + library_path_ + "' must be generated with IkReal as double!");
+}
+
+// The shared library type is incomplete in the header
+IKFastLibrary::~IKFastLibrary() = default;
+
+bool IKFastLibrary::computeIk(const double* translation,
+                              const double* rotation,
+                              const double* free_joint_values,
+                              ikfast::IkSolutionListBase<double>& solutions) const
+{
+  return functions_._ComputeIk(translation, rotation, free_joint_values, solutions);
+}
+
+int IKFastLibrary::getNumJoints() const { return functions_._GetNumJoints(); }
+
+std::vector<int> IKFastLibrary::getFreeParameters() const
+{
+  const int* free_parameters = functions_._GetFreeParameters();
+  return { free_parameters, free_parameters + functions_._GetNumFreeParameters() };
+}
+
+const std::string& IKFastLibrary::getLibraryPath() const { return library_path_; }
+
+IKFastLibraryInvKin::IKFastLibraryInvKin(IKFastLibrary::ConstPtr library,
+                                         std::string base_link_name,
+                                         std::string tip_link_name,
+                                         std::vector<std::string> joint_names,
+                                         std::vector<Eigen::Index> redundancy_capable_joints,
+                                         std::vector<std::vector<double>> free_joint_states,
+                                         std::string solver_name)
+  : library_(std::move(library))
+  , base_link_name_(std::move(base_link_name))
+  , tip_link_name_(std::move(tip_link_name))
+  , joint_names_(std::move(joint_names))
+  , redundancy_capable_joints_(std::move(redundancy_capable_joints))
+  , free_joint_states_(std::move(free_joint_states))
+  , solver_name_(std::move(solver_name))
+{
+  if (library_ == nullptr)
+    throw std::runtime_error("IKFastLibraryInvKin: Provided library is a nullptr");
+
+  if (static_cast<std::size_t>(library_->getNumJoints()) != joint_names_.size())
+    throw std::runtime_error("IKFastLibraryInvKin: The number of joint names does not match the library '" +
+                             library_->getLibraryPath() + "'");
+
+  const std::size_t num_free = library_->getFreeParameters().size();
+  if (num_free > 0 && free_joint_states_.empty())
+    throw std::runtime_error("IKFastLibraryInvKin: The library has free joints but no free joint states provided");
+
+  for (const auto& free_joint_state : free_joint_states_)
+  {
+    if (free_joint_state.size() != num_free)
+      throw std::runtime_error("IKFastLibraryInvKin: A free joint state does not match the number of free joints");
+  }
+}
+
+InverseKinematics::UPtr IKFastLibraryInvKin::clone() const { return std::make_unique<IKFastLibraryInvKin>(*this); }
+
+IKSolutions IKFastLibraryInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
+                                            const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  assert(tip_link_poses.size() == 1);
+  assert(tip_link_poses.find(tip_link_name_) != tip_link_poses.end());
+  assert(std::abs(1.0 - tip_link_poses.at(tip_link_name_).matrix().determinant()) < 1e-6);
+
+  const Eigen::Isometry3d& pose = tip_link_poses.at(tip_link_name_);
+  const Eigen::Vector3d translation = pose.translation();
+
+  // Note the row major ordering here: IkFast expects the matrix in r00, r01, r02, ..., r11, r12, r13 ordering
+  const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> rotation = pose.rotation();
+
+  IKSolutions solutions;
+  if (free_joint_states_.empty())
+  {
+    ikAtFreeJointStates(solutions, translation.data(), rotation.data(), 0, 0);
+    return solutions;
+  }
+
+  const std::size_t num_states = free_joint_states_.size();
+  const std::size_t num_chunks = (num_states + FREE_JOINT_STATE_CHUNK_SIZE - 1) / FREE_JOINT_STATE_CHUNK_SIZE;
+  const std::size_t num_workers = std::min(threads_, num_chunks);
+  if (num_workers <= 1)
+  {
+    ikAtFreeJointStates(solutions, translation.data(), rotation.data(), 0, num_states);
+    return solutions;
+  }
+
+  // The workers claim chunks of free joint states in turn, each chunk keeps its own solutions so they are returned in
+  // free joint state order. Once the maximum number of solutions is found no more chunks are claimed.
+  std::vector<IKSolutions> chunk_solutions(num_chunks);
+  std::atomic<std::size_t> next_chunk{ 0 };
+  std::atomic<std::size_t> num_found{ 0 };
+  auto search = [&]() {
+    for (std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+    {
+      if (max_solutions_ > 0 && num_found >= max_solutions_)
+        return;
+
+      const std::size_t start = chunk * FREE_JOINT_STATE_CHUNK_SIZE;
+      const std::size_t end = std::min(start + FREE_JOINT_STATE_CHUNK_SIZE, num_states);
+      ikAtFreeJointStates(chunk_solutions[chunk], translation.data(), rotation.data(), start, end);
+      num_found += chunk_solutions[chunk].size();
+    }
+  };
+
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, [&search](std::size_t /*worker*/) { search(); });
+
+  for (auto& chunk : chunk_solutions)
+    solutions.insert(solutions.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+
+  if (max_solutions_ > 0 && solutions.size() > max_solutions_)
+    solutions.resize(max_solutions_);
+
+  return solutions;
+}
+
+void IKFastLibraryInvKin::ikAtFreeJointStates(IKSolutions& solutions,
+                                              const double* translation,
+                                              const double* rotation,
+                                              std::size_t start,
+                                              std::size_t end) const
+{
+  const auto ikfast_dof = static_cast<Eigen::Index>(joint_names_.size());
+  ikfast::IkSolutionList<double> ikfast_solution_set;
+  Eigen::VectorXd sol(ikfast_dof);
+
+  // Without free joints the solver is called once with a nullptr
+  auto addSols = [&](const double* pfree) {
+    ikfast_solution_set.Clear();
+    library_->computeIk(translation, rotation, pfree, ikfast_solution_set);
+
+    const auto n_sols = ikfast_solution_set.GetNumSolutions();
+    for (std::size_t i = 0; i < n_sols; ++i)
+    {
+      if (max_solutions_ > 0 && solutions.size() >= max_solutions_)
+        return;
+
+      // This actually walks the list EVERY time from the start of i.
+      ikfast_solution_set.GetSolution(i).GetSolution(sol.data(), pfree);
+      if (sol.array().allFinite())
+      {
+        harmonizeTowardZero<double>(sol, redundancy_capable_joints_);  // Modifies 'sol' in place
+        solutions.push_back(sol);
+      }
+    }
+  };
+
+  if (free_joint_states_.empty())
+  {
+    addSols(nullptr);
+    return;
+  }
+
+  for (std::size_t s = start; s < end; ++s)
+  {
+    if (max_solutions_ > 0 && solutions.size() >= max_solutions_)
+      return;
+
+    addSols(free_joint_states_[s].data());
+  }
+}
+
+void IKFastLibraryInvKin::setThreads(std::size_t threads) { threads_ = std::max<std::size_t>(threads, 1); }
+
+std::size_t IKFastLibraryInvKin::getThreads() const { return threads_; }
+
+void IKFastLibraryInvKin::setMaxSolutions(std::size_t max_solutions) { max_solutions_ = max_solutions; }
+
+std::size_t IKFastLibraryInvKin::getMaxSolutions() const { return max_solutions_; }
+
+IKFastLibrary::ConstPtr IKFastLibraryInvKin::getLibrary() const { return library_; }
+
+Eigen::Index IKFastLibraryInvKin::numJoints() const { return static_cast<Eigen::Index>(joint_names_.size()); }
+std::vector<std::string> IKFastLibraryInvKin::getJointNames() const { return joint_names_; }
+std::string IKFastLibraryInvKin::getBaseLinkName() const { return base_link_name_; }
+std::string IKFastLibraryInvKin::getWorkingFrame() const { return base_link_name_; }
+std::vector<std::string> IKFastLibraryInvKin::getTipLinkNames() const { return { tip_link_name_ }; }
+std::string IKFastLibraryInvKin::getSolverName() const { return solver_name_; }
+
+}  // namespace tesseract_kinematics
@@ -90,9 +90,21 @@ public:
                     const std::vector<std::pair<std::string, std::string> >& chains,
                     std::string solver_name = KDL_INV_KIN_CHAIN_LMA_SOLVER_NAME);
 
+  using InverseKinematics::calcInvKin;
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  /**
+   * @brief Set the settings of the multiple seed search
+   * @details By default only the provided seed is tried. Each additional thread solves with its own KDL solver, which
+   * is kept for the following calls.
+   * @param settings The seed settings
+   */
+  void setSeedSettings(const KDLInvKinSeedSettings& settings);
+
+  /** @brief Get the settings of the multiple seed search */
+  const KDLInvKinSeedSettings& getSeedSettings() const;
+
   std::vector<std::string> getJointNames() const override final;
   Eigen::Index numJoints() const override final;
   std::string getBaseLinkName() const override final;
@@ -102,15 +114,39 @@ public:
   InverseKinematics::UPtr clone() const override final;
 
 private:
+  /** @brief A KDL solver with its own copy of the chain, so it can solve concurrently with the other solvers */
+  struct Worker
+  {
+    explicit Worker(const KDL::Chain& robot_chain) : chain(robot_chain), ik_solver(chain) {}
+    KDL::Chain chain;
+    KDL::ChainIkSolverPos_LMA ik_solver;
+  };
+
   KDLChainData kdl_data_;                                        /**< @brief KDL data parsed from Scene Graph */
   std::unique_ptr<KDL::ChainIkSolverPos_LMA> ik_solver_;         /**< @brief KDL Inverse kinematic solver */
   std::string solver_name_{ KDL_INV_KIN_CHAIN_LMA_SOLVER_NAME }; /**< @brief Name of this solver */
   mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
+  Eigen::MatrixX2d joint_limits_;       /**< @brief The joint limits the additional seeds are sampled from */
+  KDLInvKinSeedSettings seed_settings_; /**< @brief The settings of the multiple seed search */
+  std::vector<std::unique_ptr<Worker>> workers_; /**< @brief The KDL solver of each additional thread */
 
   /** @brief calcFwdKin helper function */
   IKSolutions calcInvKinHelper(const Eigen::Isometry3d& pose,
                                const Eigen::Ref<const Eigen::VectorXd>& seed,
                                int segment_num = -1) const;
+
+  /**
+   * @brief Solve with a KDL solver
+   * @param ik_solver The KDL solver
+   * @param pose The tip link pose
+   * @param seed The seed
+   * @param solution The solution, only valid if the solver converged
+   * @return True if the solver converged, otherwise false
+   */
+  static bool solve(KDL::ChainIkSolverPos_LMA& ik_solver,
+                    const KDL::Frame& pose,
+                    const Eigen::VectorXd& seed,
+                    Eigen::VectorXd& solution);
 };
 
 }  // namespace tesseract_kinematics
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <kdl/frames.hpp>
 #include <kdl/jntarray.hpp>
 #include <Eigen/Eigen>
+#include <functional>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
@@ -94,12 +95,12 @@ void KDLToEigen(const KDL::JntArray& joints, Eigen::Ref<Eigen::VectorXd> vec);
 struct KDLChainData
 {
   KDL::Chain robot_chain;                   /**< @brief KDL Chain object */
-  KDL::Tree kdl_tree;                       /**< @brief KDL tree object */
   std::vector<std::string> joint_names;     /**< @brief List of joint names */
   std::string base_link_name;               /**< @brief Link name of first link in the kinematic object */
   std::string tip_link_name;                /**< @brief Link name of last kink in the kinematic object */
   std::map<std::string, int> segment_index; /**< @brief A map from chain link name to kdl chain segment number */
   std::vector<std::pair<std::string, std::string>> chains; /**< The chains used to create the object */
+  tesseract_scene_graph::KDLTreeData::ConstPtr tree_data;  /**< @brief KDL tree data shared with the scene graph */
 };
 
 /**
@@ -126,5 +127,59 @@ bool parseSceneGraph(KDLChainData& results,
                      const tesseract_scene_graph::SceneGraph& scene_graph,
                      const std::string& base_name,
                      const std::string& tip_name);
+
+/** @brief The settings of the multiple seed search of the KDL inverse kinematics solvers */
+struct KDLInvKinSeedSettings
+{
+  /**
+   * @brief The number of seeds tried
+   * @details The first seed is the provided seed and the others are stratified samples of the joint limits, which are
+   * the same for every call.
+   */
+  std::size_t num_seeds{ 1 };
+
+  /** @brief The number of threads trying seeds, each additional thread uses its own KDL solver */
+  std::size_t threads{ 1 };
+
+  /**
+   * @brief If true the solution of the first seed which converges is returned and the remaining seeds are skipped,
+   * otherwise every seed is tried and the solution closest to the provided seed is returned
+   */
+  bool return_first{ true };
+};
+
+/**
+ * @brief Get a stratified sample of the joint limits
+ * @details The samples are the points of a Halton sequence scaled to the joint limits, so the first samples spread
+ * over the whole range of every joint. An infinite limit is replaced by plus or minus PI.
+ * @param limits The joint limits
+ * @param index The index of the sample, starting at one
+ * @return The sample
+ */
+Eigen::VectorXd getStratifiedSeed(const Eigen::Ref<const Eigen::MatrixX2d>& limits, std::size_t index);
+
+/**
+ * @brief Solve inverse kinematics from multiple seeds
+ * @param solve Solves from a seed using the KDL solver of a thread, the calling thread is thread zero. It returns true
+ * and sets the solution if the solver converged.
+ * @param seed The provided seed, which is tried first
+ * @param limits The joint limits the other seeds are sampled from
+ * @param settings The seed settings
+ * @return The solution selected by the settings, empty if no seed converged
+ */
+IKSolutions solveFromSeeds(
+    const std::function<bool(std::size_t, const Eigen::VectorXd&, Eigen::VectorXd&)>& solve,
+    const Eigen::Ref<const Eigen::VectorXd>& seed,
+    const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+    const KDLInvKinSeedSettings& settings);
+
+/**
+ * @brief Get the position limits of the joints of a KDL chain
+ * @details A joint without limits is given the limits plus and minus PI.
+ * @param data The KDL chain data
+ * @param scene_graph The Scene Graph the chain data was parsed from
+ * @return The joint limits
+ */
+Eigen::MatrixX2d getJointLimits(const KDLChainData& data, const tesseract_scene_graph::SceneGraph& scene_graph);
 }  // namespace tesseract_kinematics
 #endif  // TESSERACT_KINEMATICS_KDL_UTILS_H
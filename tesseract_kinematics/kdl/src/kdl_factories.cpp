@@ -69,6 +69,7 @@ InverseKinematics::UPtr KDLInvKinChainLMAFactory::create(const std::string& solv
 {
   std::string base_link;
   std::string tip_link;
+  KDLInvKinSeedSettings seed_settings;
 
   try
   {
@@ -81,6 +82,16 @@ InverseKinematics::UPtr KDLInvKinChainLMAFactory::create(const std::string& solv
       tip_link = n.as<std::string>();
     else
       throw std::runtime_error("KDLInvKinChainLMAFactory, missing 'tip_link' entry");
+
+    // Get the optional multiple seed search settings
+    if (YAML::Node n = config["num_seeds"])
+      seed_settings.num_seeds = n.as<std::size_t>();
+
+    if (YAML::Node n = config["threads"])
+      seed_settings.threads = n.as<std::size_t>();
+
+    if (YAML::Node n = config["return_first"])
+      seed_settings.return_first = n.as<bool>();
   }
   catch (const std::exception& e)
   {
@@ -88,7 +99,9 @@ InverseKinematics::UPtr KDLInvKinChainLMAFactory::create(const std::string& solv
     return nullptr;
   }
 
-  return std::make_unique<KDLInvKinChainLMA>(scene_graph, base_link, tip_link, solver_name);
+  auto inv_kin = std::make_unique<KDLInvKinChainLMA>(scene_graph, base_link, tip_link, solver_name);
+  inv_kin->setSeedSettings(seed_settings);
+  return inv_kin;
 }
 
 InverseKinematics::UPtr KDLInvKinChainNRFactory::create(const std::string& solver_name,
@@ -99,6 +112,7 @@ InverseKinematics::UPtr KDLInvKinChainNRFactory::create(const std::string& solve
 {
   std::string base_link;
   std::string tip_link;
+  KDLInvKinSeedSettings seed_settings;
 
   try
   {
@@ -111,6 +125,16 @@ InverseKinematics::UPtr KDLInvKinChainNRFactory::create(const std::string& solve
       tip_link = n.as<std::string>();
     else
       throw std::runtime_error("KDLInvKinChainNRFactory, missing 'tip_link' entry");
+
+    // Get the optional multiple seed search settings
+    if (YAML::Node n = config["num_seeds"])
+      seed_settings.num_seeds = n.as<std::size_t>();
+
+    if (YAML::Node n = config["threads"])
+      seed_settings.threads = n.as<std::size_t>();
+
+    if (YAML::Node n = config["return_first"])
+      seed_settings.return_first = n.as<bool>();
   }
   catch (const std::exception& e)
   {
@@ -118,7 +142,9 @@ InverseKinematics::UPtr KDLInvKinChainNRFactory::create(const std::string& solve
     return nullptr;
   }
 
-  return std::make_unique<KDLInvKinChainNR>(scene_graph, base_link, tip_link, solver_name);
+  auto inv_kin = std::make_unique<KDLInvKinChainNR>(scene_graph, base_link, tip_link, solver_name);
+  inv_kin->setSeedSettings(seed_settings);
+  return inv_kin;
 }
 
 TESSERACT_PLUGIN_ANCHOR_IMPL(KDLFactoriesAnchor)
@@ -52,6 +52,7 @@ KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& sc
 
   // Create KDL IK Solver
   ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_LMA>(kdl_data_.robot_chain);
+  joint_limits_ = getJointLimits(kdl_data_, scene_graph);
 }
 
 KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -71,28 +72,53 @@ KDLInvKinChainLMA& KDLInvKinChainLMA::operator=(const KDLInvKinChainLMA& other)
   kdl_data_ = other.kdl_data_;
   ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_LMA>(kdl_data_.robot_chain);
   solver_name_ = other.solver_name_;
+  joint_limits_ = other.joint_limits_;
+  setSeedSettings(other.seed_settings_);
 
   return *this;
 }
 
+void KDLInvKinChainLMA::setSeedSettings(const KDLInvKinSeedSettings& settings)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  seed_settings_ = settings;
+  workers_.clear();
+  for (std::size_t i = 1; i < seed_settings_.threads; ++i)
+    workers_.push_back(std::make_unique<Worker>(kdl_data_.robot_chain));
+}
+
+const KDLInvKinSeedSettings& KDLInvKinChainLMA::getSeedSettings() const { return seed_settings_; }
+
 IKSolutions KDLInvKinChainLMA::calcInvKinHelper(const Eigen::Isometry3d& pose,
                                                 const Eigen::Ref<const Eigen::VectorXd>& seed,
                                                 int /*segment_num*/) const
 {
   assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
+  KDL::Frame kdl_pose;
+  EigenToKDL(pose, kdl_pose);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  return solveFromSeeds(
+      [this, &kdl_pose](std::size_t thread, const Eigen::VectorXd& sample, Eigen::VectorXd& solution) {
+        KDL::ChainIkSolverPos_LMA& ik_solver = (thread == 0) ? *ik_solver_ : workers_[thread - 1]->ik_solver;
+        return solve(ik_solver, kdl_pose, sample, solution);
+      },
+      seed,
+      joint_limits_,
+      seed_settings_);
+}
+
+bool KDLInvKinChainLMA::solve(KDL::ChainIkSolverPos_LMA& ik_solver,
+                              const KDL::Frame& pose,
+                              const Eigen::VectorXd& seed,
+                              Eigen::VectorXd& solution)
+{
   KDL::JntArray kdl_seed, kdl_solution;
   EigenToKDL(seed, kdl_seed);
   kdl_solution.resize(static_cast<unsigned>(seed.size()));
-  Eigen::VectorXd solution(seed.size());
 
   // run IK solver
-  KDL::Frame kdl_pose;
-  EigenToKDL(pose, kdl_pose);
-  int status{ -1 };
-  {
-    std::lock_guard<std::mutex> guard(mutex_);
-    status = ik_solver_->CartToJnt(kdl_seed, kdl_pose, kdl_solution);
-  }
+  int status = ik_solver.CartToJnt(kdl_seed, pose, kdl_solution);
   if (status < 0)
   {
     // LCOV_EXCL_START
@@ -113,12 +139,12 @@ IKSolutions KDLInvKinChainLMA::calcInvKinHelper(const Eigen::Isometry3d& pose,
     CONSOLE_BRIDGE_logDebug("KDL LMA Failed to calculate IK");
 #endif
     // LCOV_EXCL_STOP
-    return {};
+    return false;
   }
 
+  solution.resize(seed.size());
   KDLToEigen(kdl_solution, solution);
-
-  return { solution };
+  return true;
 }
 
 IKSolutions KDLInvKinChainLMA::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
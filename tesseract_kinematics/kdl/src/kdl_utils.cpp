@@ -24,6 +24,12 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
 #include <tesseract_kinematics/kdl/kdl_utils.h>
 
 namespace tesseract_kinematics
@@ -82,8 +88,7 @@ bool parseSceneGraph(KDLChainData& results,
 {
   try
   {
-    tesseract_scene_graph::KDLTreeData data = tesseract_scene_graph::parseSceneGraph(scene_graph);
-    results.kdl_tree = data.tree;
+    results.tree_data = tesseract_scene_graph::getKDLTreeData(scene_graph);
   }
   catch (...)
   {
@@ -96,7 +101,7 @@ bool parseSceneGraph(KDLChainData& results,
   for (const auto& chain : chains)
   {
     KDL::Chain sub_chain;
-    if (!results.kdl_tree.getChain(chain.first, chain.second, sub_chain))
+    if (!results.tree_data->tree.getChain(chain.first, chain.second, sub_chain))
     {
       CONSOLE_BRIDGE_logError(
           "Failed to initialize KDL between links: '%s' and '%s'", chain.first.c_str(), chain.second.c_str());
@@ -143,4 +148,115 @@ bool parseSceneGraph(KDLChainData& results,
   chains.emplace_back(base_name, tip_name);
   return parseSceneGraph(results, scene_graph, chains);
 }
+
+Eigen::VectorXd getStratifiedSeed(const Eigen::Ref<const Eigen::MatrixX2d>& limits, std::size_t index)
+{
+  Eigen::VectorXd sample(limits.rows());
+  std::size_t base{ 1 };
+  for (Eigen::Index i = 0; i < limits.rows(); ++i)
+  {
+    // Each joint uses the next prime as the base of its radical inverse
+    bool prime{ false };
+    while (!prime)
+    {
+      ++base;
+      prime = true;
+      for (std::size_t d = 2; d * d <= base && prime; ++d)
+        prime = (base % d != 0);
+    }
+
+    double value{ 0 };
+    double scale{ 1 };
+    for (std::size_t n = index; n > 0; n /= base)
+    {
+      scale /= static_cast<double>(base);
+      value += static_cast<double>(n % base) * scale;
+    }
+
+    double lower = std::isfinite(limits(i, 0)) ? limits(i, 0) : -M_PI;
+    double upper = std::isfinite(limits(i, 1)) ? limits(i, 1) : M_PI;
+    sample(i) = lower + (value * (upper - lower));
+  }
+
+  return sample;
+}
+
+IKSolutions solveFromSeeds(const std::function<bool(std::size_t, const Eigen::VectorXd&, Eigen::VectorXd&)>& solve,
+                           const Eigen::Ref<const Eigen::VectorXd>& seed,
+                           const Eigen::Ref<const Eigen::MatrixX2d>& limits,
+                           const KDLInvKinSeedSettings& settings)
+{
+  const std::size_t num_seeds = std::max<std::size_t>(settings.num_seeds, 1);
+  const std::size_t threads = std::min(std::max<std::size_t>(settings.threads, 1), num_seeds);
+
+  // Each seed writes to its own solution, so the threads only share the seed counter
+  std::vector<Eigen::VectorXd> solutions(num_seeds);
+  std::vector<char> converged(num_seeds, 0);
+  std::atomic<std::size_t> next_seed{ 0 };
+  std::atomic<bool> done{ false };
+  auto search = [&](std::size_t thread) {
+    Eigen::VectorXd sample;
+    for (std::size_t i = next_seed++; i < num_seeds && !done; i = next_seed++)
+    {
+      sample = (i == 0) ? Eigen::VectorXd(seed) : getStratifiedSeed(limits, i);
+      if (solve(thread, sample, solutions[i]))
+      {
+        converged[i] = 1;
+        if (settings.return_first)
+          done = true;
+      }
+    }
+  };
+
+  tesseract_common::getDefaultExecutor()->parallelFor(threads, search);
+
+  // Select the first converged seed, or the solution closest to the provided seed
+  std::size_t selected{ num_seeds };
+  double selected_dist{ std::numeric_limits<double>::max() };
+  for (std::size_t i = 0; i < num_seeds; ++i)
+  {
+    if (converged[i] == 0)
+      continue;
+
+    if (settings.return_first)
+    {
+      selected = i;
+      break;
+    }
+
+    double dist = (solutions[i] - seed).norm();
+    if (dist < selected_dist)
+    {
+      selected = i;
+      selected_dist = dist;
+    }
+  }
+
+  if (selected == num_seeds)
+    return {};
+
+  return { solutions[selected] };
+}
+
+Eigen::MatrixX2d getJointLimits(const KDLChainData& data, const tesseract_scene_graph::SceneGraph& scene_graph)
+{
+  Eigen::MatrixX2d limits(static_cast<Eigen::Index>(data.joint_names.size()), 2);
+  for (std::size_t i = 0; i < data.joint_names.size(); ++i)
+  {
+    auto joint = scene_graph.getJoint(data.joint_names[i]);
+    const auto row = static_cast<Eigen::Index>(i);
+    if (joint != nullptr && joint->limits != nullptr)
+    {
+      limits(row, 0) = joint->limits->lower;
+      limits(row, 1) = joint->limits->upper;
+    }
+    else
+    {
+      limits(row, 0) = -M_PI;
+      limits(row, 1) = M_PI;
+    }
+  }
+
+  return limits;
+}
 }  // namespace tesseract_kinematics
@@ -96,6 +96,70 @@ IKSolutions OPWInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link
   return solution_set;
 }
 
+Eigen::Index OPWInvKin::calcInvKin(Eigen::MatrixXd& solutions,
+                                   const tesseract_common::TransformMap& tip_link_poses,
+                                   const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  assert(tip_link_poses.size() == 1);                                                       // NOLINT
+  assert(tip_link_poses.find(tip_link_name_) != tip_link_poses.end());                      // NOLINT
+  assert(std::abs(1.0 - tip_link_poses.at(tip_link_name_).matrix().determinant()) < 1e-6);  // NOLINT
+
+  opw_kinematics::Solutions<double> sols = opw_kinematics::inverse(params_, tip_link_poses.at(tip_link_name_));
+
+  const auto max_solutions = static_cast<Eigen::Index>(sols.size());
+  if (solutions.rows() != 6 || solutions.cols() < max_solutions)
+    solutions.resize(6, max_solutions);
+
+  // The valid solutions are written to the columns directly instead of through an IKSolutions
+  Eigen::Index num_solutions{ 0 };
+  for (auto& sol : sols)
+  {
+    if (opw_kinematics::isValid<double>(sol))
+    {
+      Eigen::Map<Eigen::VectorXd> eigen_sol(sol.data(), static_cast<Eigen::Index>(sol.size()));
+
+      // Harmonize between [-PI, PI]
+      harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
+
+      solutions.col(num_solutions++) = eigen_sol;
+    }
+  }
+
+  return num_solutions;
+}
+
+void OPWInvKin::calcInvKinBatch(IKSolutionsBuffer& solutions,
+                                const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  solutions.clear();
+  solutions.num_joints = 6;
+  solutions.offsets.reserve(tip_link_poses.size() + 1);
+
+  // The solutions are written to the buffer directly instead of through an IKSolutions per pose
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+    opw_kinematics::Solutions<double> sols = opw_kinematics::inverse(params_, tip_link_pose);
+    std::size_t num_sols = 0;
+    for (auto& sol : sols)
+    {
+      if (opw_kinematics::isValid<double>(sol))
+      {
+        Eigen::Map<Eigen::VectorXd> eigen_sol(sol.data(), static_cast<Eigen::Index>(sol.size()));
+
+        // Harmonize between [-PI, PI]
+        harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
+        solutions.data.insert(solutions.data.end(), sol.begin(), sol.end());
+        ++num_sols;
+      }
+    }
+
+    solutions.offsets.push_back(solutions.offsets.back() + num_sols);
+  }
+}
+
 Eigen::Index OPWInvKin::numJoints() const { return 6; }
 
 std::vector<std::string> OPWInvKin::getJointNames() const { return joint_names_; }
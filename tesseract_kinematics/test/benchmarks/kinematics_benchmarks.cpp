@@ -0,0 +1,342 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/rep_inv_kin.h>
+#include <tesseract_kinematics/core/rop_inv_kin.h>
+#include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_lma.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_nr.h>
+#include <tesseract_kinematics/opw/opw_inv_kin.h>
+#include <tesseract_kinematics/ur/ur_inv_kin.h>
+#include <tesseract_kinematics/ikfast/ikfast_library_inv_kin.h>
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+#include "abb_irb2400_ikfast_kinematics.h"
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_kinematics;
+
+/** @brief The tesseract_support robot models and inverse kinematics solvers the benchmarks are run with */
+struct RobotInfo
+{
+  /** @brief The name used in the benchmark names */
+  std::string name;
+  /** @brief The scene graph of the robot */
+  SceneGraph::ConstPtr scene_graph;
+  /** @brief The base link of the chain used for the forward kinematics benchmarks */
+  std::string base_link;
+  /** @brief The tip link of the chain used for the forward kinematics and jacobian benchmarks */
+  std::string tip_link;
+  /** @brief The inverse kinematics solvers of the robot */
+  std::vector<InverseKinematics::ConstPtr> inv_kins;
+};
+
+SceneGraph::ConstPtr getSceneGraph(const std::string& urdf_file)
+{
+  const std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/" + urdf_file;
+  tesseract_common::TesseractSupportResourceLocator locator;
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+opw_kinematics::Parameters<double> getOPWKinematicsParamABB()
+{
+  opw_kinematics::Parameters<double> opw_params;
+  opw_params.a1 = (0.100);
+  opw_params.a2 = (-0.135);
+  opw_params.b = (0.000);
+  opw_params.c1 = (0.615);
+  opw_params.c2 = (0.705);
+  opw_params.c3 = (0.755);
+  opw_params.c4 = (0.085);
+
+  opw_params.offsets[2] = -M_PI / 2.0;
+
+  return opw_params;
+}
+
+std::vector<RobotInfo> getRobots()
+{
+  std::vector<RobotInfo> robots;
+
+  {
+    RobotInfo robot{ "KUKA_IIWA_14", getSceneGraph("lbr_iiwa_14_r820.urdf"), "base_link", "tool0", {} };
+    robot.inv_kins.push_back(std::make_shared<KDLInvKinChainLMA>(*robot.scene_graph, robot.base_link, robot.tip_link));
+    robot.inv_kins.push_back(std::make_shared<KDLInvKinChainNR>(*robot.scene_graph, robot.base_link, robot.tip_link));
+    robots.push_back(robot);
+  }
+
+  {
+    RobotInfo robot{ "ABB_IRB2400", getSceneGraph("abb_irb2400.urdf"), "base_link", "tool0", {} };
+    KDLFwdKinChain fwd_kin(*robot.scene_graph, robot.base_link, robot.tip_link);
+    robot.inv_kins.push_back(std::make_shared<OPWInvKin>(
+        getOPWKinematicsParamABB(), robot.base_link, robot.tip_link, fwd_kin.getJointNames()));
+    robot.inv_kins.push_back(
+        std::make_shared<AbbIRB2400Kinematics>(robot.base_link, robot.tip_link, fwd_kin.getJointNames()));
+    robot.inv_kins.push_back(std::make_shared<KDLInvKinChainLMA>(*robot.scene_graph, robot.base_link, robot.tip_link));
+    robots.push_back(robot);
+  }
+
+  {
+    RobotInfo robot{ "KUKA_IIWA_7", getSceneGraph("iiwa7.urdf"), "link_0", "ikfast_tcp_link", {} };
+    KDLFwdKinChain fwd_kin(*robot.scene_graph, robot.base_link, robot.tip_link);
+    auto library = std::make_shared<IKFastLibrary>(IIWA7_IKFAST_SOLVER_LIBRARY);
+    std::vector<std::vector<double>> free_joint_states = { { -2.0 }, { -1.0 }, { 0.0 }, { 1.0 }, { 2.0 } };
+    robot.inv_kins.push_back(std::make_shared<IKFastLibraryInvKin>(library,
+                                                                   robot.base_link,
+                                                                   robot.tip_link,
+                                                                   fwd_kin.getJointNames(),
+                                                                   std::vector<Eigen::Index>{ 0, 1, 2, 3, 4, 5 },
+                                                                   free_joint_states));
+    robot.inv_kins.push_back(std::make_shared<KDLInvKinChainLMA>(*robot.scene_graph, robot.base_link, robot.tip_link));
+    robots.push_back(robot);
+  }
+
+  {
+    RobotInfo robot{ "ABB_IRB2400_EXTERNAL_POSITIONER",
+                     getSceneGraph("abb_irb2400_external_positioner.urdf"),
+                     "positioner_tool0",
+                     "tool0",
+                     {} };
+    KDLStateSolver state_solver(*robot.scene_graph);
+    KDLFwdKinChain robot_fwd_kin(*robot.scene_graph, "base_link", "tool0");
+    OPWInvKin opw_kin(getOPWKinematicsParamABB(), "base_link", "tool0", robot_fwd_kin.getJointNames());
+    robot.inv_kins.push_back(std::make_shared<REPInvKin>(
+        *robot.scene_graph,
+        state_solver.getState(),
+        opw_kin.clone(),
+        2.5,
+        std::make_unique<KDLFwdKinChain>(*robot.scene_graph, "positioner_base_link", "positioner_tool0"),
+        Eigen::VectorXd::Constant(2, 0.1)));
+    robots.push_back(robot);
+  }
+
+  {
+    RobotInfo robot{ "ABB_IRB2400_ON_POSITIONER",
+                     getSceneGraph("abb_irb2400_on_positioner.urdf"),
+                     "positioner_base_link",
+                     "tool0",
+                     {} };
+    KDLStateSolver state_solver(*robot.scene_graph);
+    KDLFwdKinChain robot_fwd_kin(*robot.scene_graph, "base_link", "tool0");
+    OPWInvKin opw_kin(getOPWKinematicsParamABB(), "base_link", "tool0", robot_fwd_kin.getJointNames());
+    robot.inv_kins.push_back(std::make_shared<ROPInvKin>(
+        *robot.scene_graph,
+        state_solver.getState(),
+        opw_kin.clone(),
+        2.5,
+        std::make_unique<KDLFwdKinChain>(*robot.scene_graph, "positioner_base_link", "positioner_tool0"),
+        Eigen::VectorXd::Constant(1, 0.1)));
+    robots.push_back(robot);
+  }
+
+  return robots;
+}
+
+/** @brief Benchmark that checks the forward kinematics of a chain */
+static void BM_FWD_KIN_CHAIN(benchmark::State& state, ForwardKinematics::ConstPtr fwd_kin, Eigen::VectorXd joint_values)
+{
+  tesseract_common::TransformMap poses;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(poses = fwd_kin->calcFwdKin(joint_values));
+  }
+}
+
+/** @brief Benchmark that checks the forward kinematics of all links of a joint group */
+static void BM_JOINT_GROUP_FWD_KIN(benchmark::State& state, JointGroup::ConstPtr group, Eigen::VectorXd joint_values)
+{
+  tesseract_common::TransformMap poses;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(poses = group->calcFwdKin(joint_values));
+  }
+}
+
+/** @brief Benchmark that checks the forward kinematics of a single link of a joint group using its index */
+static void BM_JOINT_GROUP_FWD_KIN_LINK(benchmark::State& state,
+                                        JointGroup::ConstPtr group,
+                                        Eigen::VectorXd joint_values,
+                                        std::string link_name)
+{
+  const std::vector<long> link_indices = group->getLinkIndices({ link_name });
+  tesseract_common::VectorIsometry3d poses(link_indices.size());
+  for (auto _ : state)
+  {
+    group->calcFwdKin(poses, joint_values, link_indices);
+    benchmark::DoNotOptimize(poses);
+  }
+}
+
+/** @brief Benchmark that checks the jacobian of a link of a joint group */
+static void BM_JOINT_GROUP_JACOBIAN(benchmark::State& state,
+                                    JointGroup::ConstPtr group,
+                                    Eigen::VectorXd joint_values,
+                                    std::string link_name)
+{
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(jacobian = group->calcJacobian(joint_values, link_name));
+  }
+}
+
+/** @brief Benchmark that checks the inverse kinematics of a solver without a kinematic group */
+static void BM_INV_KIN(benchmark::State& state,
+                       InverseKinematics::ConstPtr inv_kin,
+                       tesseract_common::TransformMap poses,
+                       Eigen::VectorXd seed)
+{
+  IKSolutions solutions;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(solutions = inv_kin->calcInvKin(poses, seed));
+  }
+}
+
+/** @brief Benchmark that checks the inverse kinematics of a solver through a kinematic group */
+static void BM_KINEMATIC_GROUP_INV_KIN(benchmark::State& state,
+                                       KinematicGroup::ConstPtr group,
+                                       KinGroupIKInput input,
+                                       Eigen::VectorXd seed)
+{
+  IKSolutions solutions;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(solutions = group->calcInvKin(input, seed));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  for (const RobotInfo& robot : getRobots())
+  {
+    KDLStateSolver state_solver(*robot.scene_graph);
+    SceneState scene_state = state_solver.getState();
+
+    ForwardKinematics::ConstPtr fwd_kin =
+        std::make_shared<KDLFwdKinChain>(*robot.scene_graph, robot.base_link, robot.tip_link);
+    JointGroup::ConstPtr joint_group =
+        std::make_shared<JointGroup>("manipulator", fwd_kin->getJointNames(), *robot.scene_graph, scene_state);
+    Eigen::VectorXd joint_values = 0.5 * joint_group->getLimits().joint_limits.col(1);
+
+    //////////////////////////////////////
+    // Forward Kinematics
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, ForwardKinematics::ConstPtr, Eigen::VectorXd)> BM_FWD_KIN_CHAIN_FUNC =
+          BM_FWD_KIN_CHAIN;
+      std::string name = "BM_FWD_KIN_CHAIN_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_FWD_KIN_CHAIN_FUNC, fwd_kin, joint_values)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, JointGroup::ConstPtr, Eigen::VectorXd)> BM_JOINT_GROUP_FWD_KIN_FUNC =
+          BM_JOINT_GROUP_FWD_KIN;
+      std::string name = "BM_JOINT_GROUP_FWD_KIN_" + robot.name;
+      benchmark::RegisterBenchmark(name.c_str(), BM_JOINT_GROUP_FWD_KIN_FUNC, joint_group, joint_values)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    {
+      std::function<void(benchmark::State&, JointGroup::ConstPtr, Eigen::VectorXd, std::string)>
+          BM_JOINT_GROUP_FWD_KIN_LINK_FUNC = BM_JOINT_GROUP_FWD_KIN_LINK;
+      std::string name = "BM_JOINT_GROUP_FWD_KIN_LINK_" + robot.name;
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_JOINT_GROUP_FWD_KIN_LINK_FUNC, joint_group, joint_values, robot.tip_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Jacobian
+    //////////////////////////////////////
+
+    {
+      std::function<void(benchmark::State&, JointGroup::ConstPtr, Eigen::VectorXd, std::string)>
+          BM_JOINT_GROUP_JACOBIAN_FUNC = BM_JOINT_GROUP_JACOBIAN;
+      std::string name = "BM_JOINT_GROUP_JACOBIAN_" + robot.name;
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_JOINT_GROUP_JACOBIAN_FUNC, joint_group, joint_values, robot.tip_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+
+    //////////////////////////////////////
+    // Inverse Kinematics
+    //////////////////////////////////////
+
+    for (const auto& inv_kin : robot.inv_kins)
+    {
+      // The kinematic group is given the pose in the working frame of the solver so both solve the same request
+      auto kin_group = std::make_shared<KinematicGroup>(
+          "manipulator", inv_kin->getJointNames(), inv_kin->clone(), *robot.scene_graph, scene_state);
+      Eigen::VectorXd seed = 0.5 * kin_group->getLimits().joint_limits.col(1);
+
+      const std::string working_frame = inv_kin->getWorkingFrame();
+      const std::string tip_link = inv_kin->getTipLinkNames()[0];
+      tesseract_common::TransformMap link_poses = kin_group->calcFwdKin(seed);
+      Eigen::Isometry3d pose = link_poses.at(working_frame).inverse() * link_poses.at(tip_link);
+
+      {
+        std::function<void(
+            benchmark::State&, InverseKinematics::ConstPtr, tesseract_common::TransformMap, Eigen::VectorXd)>
+            BM_INV_KIN_FUNC = BM_INV_KIN;
+        std::string name = "BM_INV_KIN_" + inv_kin->getSolverName() + "_" + robot.name;
+        tesseract_common::TransformMap poses{ { tip_link, pose } };
+        benchmark::RegisterBenchmark(name.c_str(), BM_INV_KIN_FUNC, inv_kin, poses, seed)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+
+      {
+        std::function<void(benchmark::State&, KinematicGroup::ConstPtr, KinGroupIKInput, Eigen::VectorXd)>
+            BM_KINEMATIC_GROUP_INV_KIN_FUNC = BM_KINEMATIC_GROUP_INV_KIN;
+        std::string name = "BM_KINEMATIC_GROUP_INV_KIN_" + inv_kin->getSolverName() + "_" + robot.name;
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_KINEMATIC_GROUP_INV_KIN_FUNC,
+                                     kin_group,
+                                     KinGroupIKInput(pose, working_frame, tip_link),
+                                     seed)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // UR
+  //////////////////////////////////////
+
+  {
+    // There is no UR model in tesseract_support, so only the solver is benchmarked
+    std::vector<std::string> joint_names{ "shoulder_pan_joint", "shoulder_lift_joint", "elbow_joint",
+                                          "wrist_1_joint",      "wrist_2_joint",       "wrist_3_joint" };
+    InverseKinematics::ConstPtr inv_kin = std::make_shared<URInvKin>(UR10Parameters, "base_link", "tool0", joint_names);
+
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(0.75, 0, 0.75);
+
+    std::function<void(
+        benchmark::State&, InverseKinematics::ConstPtr, tesseract_common::TransformMap, Eigen::VectorXd)>
+        BM_INV_KIN_FUNC = BM_INV_KIN;
+    std::string name = "BM_INV_KIN_" + inv_kin->getSolverName() + "_UR10";
+    tesseract_common::TransformMap poses{ { "tool0", pose } };
+    benchmark::RegisterBenchmark(name.c_str(), BM_INV_KIN_FUNC, inv_kin, poses, Eigen::VectorXd::Zero(6))
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
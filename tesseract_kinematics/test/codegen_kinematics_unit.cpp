@@ -0,0 +1,84 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include "kinematics_test_utils.h"
+#include "iiwa_codegen_fwd_kin.h"
+
+#include <tesseract_kinematics/codegen/codegen_fwd_kin.h>
+#include <tesseract_kinematics/codegen/codegen_fwd_kin_generator.h>
+#include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+
+using namespace tesseract_kinematics::test_suite;
+using namespace tesseract_kinematics;
+
+TEST(TesseractKinematicsUnit, CodegenFwdKinGeneratorUnit)  // NOLINT
+{
+  auto scene_graph = getSceneGraphIIWA();
+
+  // The checked in header must match the generator output
+  tesseract_common::fs::path file_path(__FILE__);
+  std::ifstream file((file_path.parent_path() / "iiwa_codegen_fwd_kin.h").string());
+  std::stringstream expected;
+  expected << file.rdbuf();
+  std::string generated =
+      generateCodegenFwdKin(*scene_graph, "base_link", "tool0", "IIWAFwdKin", "tesseract_kinematics::test_suite");
+  EXPECT_EQ(generated, expected.str());
+
+  EXPECT_ANY_THROW(  // NOLINT
+      generateCodegenFwdKin(*scene_graph, "missing_link", "tool0", "IIWAFwdKin", "tesseract_kinematics::test_suite"));
+  EXPECT_ANY_THROW(  // NOLINT
+      generateCodegenFwdKin(*scene_graph, "tool0", "base_link", "IIWAFwdKin", "tesseract_kinematics::test_suite"));
+}
+
+TEST(TesseractKinematicsUnit, CodegenFwdKinUnit)  // NOLINT
+{
+  auto scene_graph = getSceneGraphIIWA();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  KinematicsPluginFactory plugin_factory;
+
+  YAML::Node config;
+  config["base_link"] = "base_link";
+  config["tip_link"] = "tool0";
+
+  CodegenFwdKinFactory<IIWAFwdKin> factory;
+  ForwardKinematics::UPtr kin =
+      factory.create("CodegenFwdKin", *scene_graph, state_solver.getState(), plugin_factory, config);
+  ASSERT_TRUE(kin != nullptr);
+
+  KDLFwdKinChain kdl_kin(*scene_graph, "base_link", "tool0");
+  EXPECT_EQ(kin->getSolverName(), "CodegenFwdKin");
+  EXPECT_EQ(kin->numJoints(), 7);
+  EXPECT_EQ(kin->getBaseLinkName(), "base_link");
+  runStringVectorEqualTest(kin->getJointNames(), kdl_kin.getJointNames());
+  runStringVectorEqualTest(kin->getTipLinkNames(), kdl_kin.getTipLinkNames());
+
+  runFwdKinIIWATest(*kin);
+  runJacobianIIWATest(*kin);
+
+  // Compare against KDL for random states
+  for (int i = 0; i < 10; ++i)
+  {
+    Eigen::VectorXd jvals = Eigen::VectorXd::Random(7);
+    EXPECT_TRUE(kin->calcFwdKin(jvals).at("tool0").isApprox(kdl_kin.calcFwdKin(jvals).at("tool0"), 1e-8));
+    EXPECT_TRUE(kin->calcJacobian(jvals, "tool0").isApprox(kdl_kin.calcJacobian(jvals, "tool0"), 1e-8));
+  }
+
+  ForwardKinematics::UPtr kin_clone = kin->clone();
+  runFwdKinIIWATest(*kin_clone);
+
+  // The config must match the generated chain
+  config["tip_link"] = "link_7";
+  EXPECT_TRUE(factory.create("CodegenFwdKin", *scene_graph, state_solver.getState(), plugin_factory, config) ==
+              nullptr);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
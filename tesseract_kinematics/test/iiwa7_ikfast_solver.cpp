@@ -0,0 +1,23 @@
+/*
+ * Software License Agreement (Apache License)
+ *
+ * Copyright (c) 2026, Southwest Research Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The generated solver on its own, built as a shared library loaded at runtime by IKFastLibrary
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include "iiwa7_ikfast_solver.hpp"
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -0,0 +1,105 @@
+// Generated by tesseract_kinematics generateCodegenFwdKin, do not edit
+#ifndef TESSERACT_KINEMATICS_TEST_SUITE_IIWAFWDKIN_H
+#define TESSERACT_KINEMATICS_TEST_SUITE_IIWAFWDKIN_H
+
+#include <array>
+#include <cmath>
+#include <Eigen/Geometry>
+
+namespace tesseract_kinematics::test_suite
+{
+/** @brief The kinematics of the chain from 'base_link' to 'tool0' */
+struct IIWAFwdKin
+{
+  static constexpr Eigen::Index NUM_JOINTS{ 7 };
+  static constexpr const char* BASE_LINK_NAME{ "base_link" };
+  static constexpr const char* TIP_LINK_NAME{ "tool0" };
+  static constexpr std::array<const char*, 7> JOINT_NAMES{ { "joint_a1", "joint_a2", "joint_a3", "joint_a4", "joint_a5", "joint_a6", "joint_a7" } };
+
+  /** @brief Compute the transform of the tip link relative to the base link */
+  static void calcFwdKin(Eigen::Isometry3d& pose, const double* q)
+  {
+    const double c0 = std::cos(q[0]);
+    const double s0 = std::sin(q[0]);
+    const double c1 = std::cos(q[1]);
+    const double s1 = std::sin(q[1]);
+    const double c2 = std::cos(q[2]);
+    const double s2 = std::sin(q[2]);
+    const double c3 = std::cos(q[3]);
+    const double s3 = std::sin(q[3]);
+    const double c4 = std::cos(q[4]);
+    const double s4 = std::sin(q[4]);
+    const double c5 = std::cos(q[5]);
+    const double s5 = std::sin(q[5]);
+    const double c6 = std::cos(q[6]);
+    const double s6 = std::sin(q[6]);
+    pose.setIdentity();
+    pose.rotate((Eigen::Matrix3d() << c0, -s0, 0, s0, c0, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(-0.00043624, 0, 0.36));
+    pose.rotate((Eigen::Matrix3d() << c1, 0, s1, 0, 1, 0, -s1, 0, c1).finished());
+    pose.rotate((Eigen::Matrix3d() << c2, -s2, 0, s2, c2, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0.00043624, 0, 0.42));
+    pose.rotate((Eigen::Matrix3d() << c3, 0, -s3, 0, 1, 0, s3, 0, c3).finished());
+    pose.rotate((Eigen::Matrix3d() << c4, -s4, 0, s4, c4, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0, 0, 0.4));
+    pose.rotate((Eigen::Matrix3d() << c5, 0, s5, 0, 1, 0, -s5, 0, c5).finished());
+    pose.rotate((Eigen::Matrix3d() << c6, -s6, 0, s6, c6, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0, 0, 0.126));
+  }
+
+  /** @brief Compute the jacobian of the tip link in the base link frame */
+  static void calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian, const double* q)
+  {
+    const double c0 = std::cos(q[0]);
+    const double s0 = std::sin(q[0]);
+    const double c1 = std::cos(q[1]);
+    const double s1 = std::sin(q[1]);
+    const double c2 = std::cos(q[2]);
+    const double s2 = std::sin(q[2]);
+    const double c3 = std::cos(q[3]);
+    const double s3 = std::sin(q[3]);
+    const double c4 = std::cos(q[4]);
+    const double s4 = std::sin(q[4]);
+    const double c5 = std::cos(q[5]);
+    const double s5 = std::sin(q[5]);
+    const double c6 = std::cos(q[6]);
+    const double s6 = std::sin(q[6]);
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    const Eigen::Vector3d z0 = pose.linear().col(2);
+    const Eigen::Vector3d p0 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c0, -s0, 0, s0, c0, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(-0.00043624, 0, 0.36));
+    const Eigen::Vector3d z1 = pose.linear().col(1);
+    const Eigen::Vector3d p1 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c1, 0, s1, 0, 1, 0, -s1, 0, c1).finished());
+    const Eigen::Vector3d z2 = pose.linear().col(2);
+    const Eigen::Vector3d p2 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c2, -s2, 0, s2, c2, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0.00043624, 0, 0.42));
+    const Eigen::Vector3d z3 = -pose.linear().col(1);
+    const Eigen::Vector3d p3 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c3, 0, -s3, 0, 1, 0, s3, 0, c3).finished());
+    const Eigen::Vector3d z4 = pose.linear().col(2);
+    const Eigen::Vector3d p4 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c4, -s4, 0, s4, c4, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0, 0, 0.4));
+    const Eigen::Vector3d z5 = pose.linear().col(1);
+    const Eigen::Vector3d p5 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c5, 0, s5, 0, 1, 0, -s5, 0, c5).finished());
+    const Eigen::Vector3d z6 = pose.linear().col(2);
+    const Eigen::Vector3d p6 = pose.translation();
+    pose.rotate((Eigen::Matrix3d() << c6, -s6, 0, s6, c6, 0, 0, 0, 1).finished());
+    pose.translate(Eigen::Vector3d(0, 0, 0.126));
+    jacobian.col(0) << z0.cross(pose.translation() - p0), z0;
+    jacobian.col(1) << z1.cross(pose.translation() - p1), z1;
+    jacobian.col(2) << z2.cross(pose.translation() - p2), z2;
+    jacobian.col(3) << z3.cross(pose.translation() - p3), z3;
+    jacobian.col(4) << z4.cross(pose.translation() - p4), z4;
+    jacobian.col(5) << z5.cross(pose.translation() - p5), z5;
+    jacobian.col(6) << z6.cross(pose.translation() - p6), z6;
+  }
+};
+
+}  // namespace tesseract_kinematics::test_suite
+
+#endif  // TESSERACT_KINEMATICS_TEST_SUITE_IIWAFWDKIN_H
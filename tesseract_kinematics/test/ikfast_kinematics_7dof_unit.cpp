@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include "kinematics_test_utils.h"
 #include "iiwa7_ikfast_kinematics.h"
+#include <tesseract_kinematics/ikfast/ikfast_library_inv_kin.h>
 #include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
 
 using namespace tesseract_kinematics::test_suite;
@@ -84,6 +85,87 @@ TEST(TesseractKinematicsUnit, IKFastInvKin7DOF)  // NOLINT
   runInvKinTest(*iiwa_inv_kin2, fwd_kin, pose, tip_link_name, seed);
 }
 
+TEST(TesseractKinematicsUnit, IKFastLibraryInvKin7DOF)  // NOLINT
+{
+  // Inverse target pose and seed
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+  pose.translation()[0] = 0.223;
+  pose.translation()[1] = 0.354;
+  pose.translation()[2] = 0.5;
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+
+  // Setup test
+  auto scene_graph = getSceneGraphIIWA7();
+  std::string base_link_name = "link_0";
+  std::string tip_link_name = "ikfast_tcp_link";
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6", "joint_7" };
+
+  KDLFwdKinChain fwd_kin(*scene_graph, base_link_name, tip_link_name);
+
+  std::vector<std::vector<double>> free_joint_states;
+  for (int i = -20; i <= 20; ++i)
+    free_joint_states.push_back({ 0.1 * i });
+
+  auto library = std::make_shared<IKFastLibrary>(IIWA7_IKFAST_SOLVER_LIBRARY);
+  EXPECT_EQ(library->getNumJoints(), 7);
+  EXPECT_EQ(library->getFreeParameters().size(), 1);
+  EXPECT_EQ(library->getLibraryPath(), IIWA7_IKFAST_SOLVER_LIBRARY);
+
+  IKFastLibraryInvKin inv_kin(
+      library, base_link_name, tip_link_name, joint_names, { 0, 1, 2, 3, 4, 5 }, free_joint_states);
+
+  EXPECT_EQ(inv_kin.getSolverName(), IKFAST_LIBRARY_INV_KIN_SOLVER_NAME);
+  EXPECT_EQ(inv_kin.numJoints(), 7);
+  EXPECT_EQ(inv_kin.getBaseLinkName(), base_link_name);
+  EXPECT_EQ(inv_kin.getWorkingFrame(), base_link_name);
+  EXPECT_EQ(inv_kin.getTipLinkNames().size(), 1);
+  EXPECT_EQ(inv_kin.getTipLinkNames()[0], tip_link_name);
+  EXPECT_EQ(inv_kin.getJointNames(), joint_names);
+  EXPECT_EQ(inv_kin.getThreads(), 1);
+  EXPECT_EQ(inv_kin.getMaxSolutions(), 0);
+
+  runInvKinTest(inv_kin, fwd_kin, pose, tip_link_name, seed);
+
+  // Searching on multiple threads returns the same solutions in the same order
+  tesseract_common::TransformMap tip_link_poses;
+  tip_link_poses[tip_link_name] = pose;
+  IKSolutions solutions = inv_kin.calcInvKin(tip_link_poses, seed);
+  EXPECT_FALSE(solutions.empty());
+
+  inv_kin.setThreads(4);
+  EXPECT_EQ(inv_kin.getThreads(), 4);
+  IKSolutions threaded_solutions = inv_kin.calcInvKin(tip_link_poses, seed);
+  ASSERT_EQ(threaded_solutions.size(), solutions.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+    EXPECT_TRUE(threaded_solutions[i].isApprox(solutions[i], 1e-12));
+
+  // The search stops at the maximum number of solutions
+  inv_kin.setMaxSolutions(3);
+  EXPECT_EQ(inv_kin.getMaxSolutions(), 3);
+  IKSolutions limited_solutions = inv_kin.calcInvKin(tip_link_poses, seed);
+  ASSERT_EQ(limited_solutions.size(), 3);
+  for (std::size_t i = 0; i < limited_solutions.size(); ++i)
+    EXPECT_TRUE(limited_solutions[i].isApprox(solutions[i], 1e-12));
+
+  // Check cloned
+  InverseKinematics::Ptr inv_kin2 = inv_kin.clone();
+  EXPECT_TRUE(inv_kin2 != nullptr);
+  EXPECT_EQ(inv_kin2->getSolverName(), IKFAST_LIBRARY_INV_KIN_SOLVER_NAME);
+  EXPECT_EQ(inv_kin2->numJoints(), 7);
+  EXPECT_EQ(inv_kin2->getJointNames(), joint_names);
+  EXPECT_EQ(inv_kin2->calcInvKin(tip_link_poses, seed).size(), 3);
+
+  // Failures
+  EXPECT_ANY_THROW(std::make_shared<IKFastLibrary>("does_not_exist.so"));  // NOLINT
+  EXPECT_ANY_THROW(IKFastLibraryInvKin(nullptr, base_link_name, tip_link_name, joint_names, {}));  // NOLINT
+  EXPECT_ANY_THROW(IKFastLibraryInvKin(library, base_link_name, tip_link_name, { "joint_1" }, {}));  // NOLINT
+  EXPECT_ANY_THROW(IKFastLibraryInvKin(library, base_link_name, tip_link_name, joint_names, {}));    // NOLINT
+  EXPECT_ANY_THROW(                                                                                  // NOLINT
+      IKFastLibraryInvKin(library, base_link_name, tip_link_name, joint_names, {}, { { 0.0, 0.0 } }));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -32,6 +32,91 @@ TEST(TesseractKinematicsUnit, KDLKinChainNRInverseKinematicUnit)  // NOLINT
   runInvKinIIWATest(factory, "KDLInvKinChainNRFactory", "KDLFwdKinChainFactory");
 }
 
+template <typename InvKinType>
+void runMultiSeedInvKinTest(const std::string& inv_factory_name)
+{
+  auto scene_graph = getSceneGraphIIWA();
+  tesseract_kinematics::KDLFwdKinChain fwd_kin(*scene_graph, "base_link", "tool0");
+  InvKinType inv_kin(*scene_graph, "base_link", "tool0");
+  EXPECT_EQ(inv_kin.getSeedSettings().num_seeds, 1);
+  EXPECT_EQ(inv_kin.getSeedSettings().threads, 1);
+  EXPECT_TRUE(inv_kin.getSeedSettings().return_first);
+
+  // The zero seed is a singular configuration of the IIWA
+  Eigen::VectorXd target(7);
+  target << 0.3, 0.5, -0.2, -1.0, 0.4, 0.6, 0.1;
+  Eigen::Isometry3d pose = fwd_kin.calcFwdKin(target).at("tool0");
+  tesseract_common::TransformMap input{ std::make_pair("tool0", pose) };
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+
+  for (bool return_first : { true, false })
+  {
+    for (std::size_t threads : std::vector<std::size_t>{ 1, 4 })
+    {
+      tesseract_kinematics::KDLInvKinSeedSettings settings;
+      settings.num_seeds = 8;
+      settings.threads = threads;
+      settings.return_first = return_first;
+      inv_kin.setSeedSettings(settings);
+
+      // The settings and solvers are kept by the clones
+      tesseract_kinematics::InverseKinematics::UPtr inv_kin_clone = inv_kin.clone();
+      EXPECT_EQ(dynamic_cast<InvKinType&>(*inv_kin_clone).getSeedSettings().threads, threads);
+
+      std::vector<const InvKinType*> solvers{ &inv_kin, dynamic_cast<InvKinType*>(inv_kin_clone.get()) };
+      for (const auto* solver : solvers)
+      {
+        tesseract_kinematics::IKSolutions solutions = solver->calcInvKin(input, seed);
+        ASSERT_EQ(solutions.size(), 1);
+
+        Eigen::Isometry3d result = fwd_kin.calcFwdKin(solutions[0]).at("tool0");
+        EXPECT_TRUE(pose.translation().isApprox(result.translation(), 1e-4));
+        EXPECT_TRUE(Eigen::Quaterniond(pose.rotation()).isApprox(Eigen::Quaterniond(result.rotation()), 1e-3));
+      }
+    }
+  }
+
+  {  // The seeds are sampled within the limits
+    Eigen::MatrixX2d limits(2, 2);
+    limits << -1, 1, 0, std::numeric_limits<double>::infinity();
+    for (std::size_t i = 1; i < 20; ++i)
+    {
+      Eigen::VectorXd sample = tesseract_kinematics::getStratifiedSeed(limits, i);
+      EXPECT_TRUE(sample(0) >= -1 && sample(0) <= 1);
+      EXPECT_TRUE(sample(1) >= 0 && sample(1) <= M_PI);
+    }
+  }
+
+  {  // The settings are loaded by the factory
+    tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+    tesseract_common::PluginInfo plugin_info;
+    plugin_info.class_name = inv_factory_name;
+    plugin_info.config["base_link"] = "base_link";
+    plugin_info.config["tip_link"] = "tool0";
+    plugin_info.config["num_seeds"] = 6;
+    plugin_info.config["threads"] = 2;
+    plugin_info.config["return_first"] = false;
+
+    tesseract_kinematics::KinematicsPluginFactory factory;
+    auto factory_inv_kin = factory.createInvKin(inv_factory_name, plugin_info, *scene_graph, state_solver.getState());
+    ASSERT_TRUE(factory_inv_kin != nullptr);
+    const auto& settings = dynamic_cast<InvKinType&>(*factory_inv_kin).getSeedSettings();
+    EXPECT_EQ(settings.num_seeds, 6);
+    EXPECT_EQ(settings.threads, 2);
+    EXPECT_FALSE(settings.return_first);
+  }
+}
+
+TEST(TesseractKinematicsUnit, KDLKinChainLMAMultiSeedInverseKinematicUnit)  // NOLINT
+{
+  runMultiSeedInvKinTest<tesseract_kinematics::KDLInvKinChainLMA>("KDLInvKinChainLMAFactory");
+}
+
+TEST(TesseractKinematicsUnit, KDLKinChainNRMultiSeedInverseKinematicUnit)  // NOLINT
+{
+  runMultiSeedInvKinTest<tesseract_kinematics::KDLInvKinChainNR>("KDLInvKinChainNRFactory");
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -4,7 +4,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract_kinematics/kdl/kdl_inv_kin_chain_lma.h>
 #include <tesseract_kinematics/core/utils.h>
+#include <tesseract_kinematics/core/differential_ik.h>
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/multi_group_inv_kin.h>
+#include <tesseract_kinematics/core/reachability_map.h>
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_common/unit_test_utils.h>
 #include "kinematics_test_utils.h"
 
 const static std::string FACTORY_NAME = "TestFactory";
@@ -114,6 +122,49 @@ void runRedundantSolutionsTest()
     expect_unique_solutions(solutions);
   }
 
+  {  // Test the visitor and flat buffer variants match
+    Eigen::MatrixX2d limits(4, 2);
+    limits << -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI;
+
+    tesseract_kinematics::VectorX<FloatType> q(4);
+    q << static_cast<FloatType>(-4.0 * M_PI), static_cast<FloatType>(-4.0 * M_PI), static_cast<FloatType>(0.0),
+        static_cast<FloatType>(4.0 * M_PI);
+
+    std::vector<Eigen::Index> redundancy_capable_joints = { 0, 1, 2, 3 };
+    std::vector<tesseract_kinematics::VectorX<FloatType>> solutions =
+        tesseract_kinematics::getRedundantSolutions<FloatType>(q, limits, redundancy_capable_joints);
+
+    std::vector<tesseract_kinematics::VectorX<FloatType>> visited;
+    tesseract_kinematics::forEachRedundantSolution<FloatType>(
+        q, limits, redundancy_capable_joints, [&visited](const tesseract_kinematics::VectorX<FloatType>& sol) {
+          visited.push_back(sol);
+          return true;
+        });
+
+    std::vector<FloatType> buffer;
+    std::size_t cnt =
+        tesseract_kinematics::getRedundantSolutions<FloatType>(buffer, q, limits, redundancy_capable_joints);
+
+    EXPECT_EQ(solutions.size(), 81);
+    EXPECT_EQ(visited.size(), solutions.size());
+    EXPECT_EQ(cnt, solutions.size());
+    EXPECT_EQ(buffer.size(), solutions.size() * 4);
+    for (std::size_t i = 0; i < solutions.size(); ++i)
+    {
+      EXPECT_TRUE(visited[i].isApprox(solutions[i]));
+      Eigen::Map<const tesseract_kinematics::VectorX<FloatType>> sol(buffer.data() + (i * 4), 4);
+      EXPECT_TRUE(sol.isApprox(solutions[i]));
+    }
+
+    // The enumeration stops when the visitor returns false
+    std::size_t stop_cnt = 0;
+    tesseract_kinematics::forEachRedundantSolution<FloatType>(
+        q, limits, redundancy_capable_joints, [&stop_cnt](const tesseract_kinematics::VectorX<FloatType>& /*sol*/) {
+          return (++stop_cnt < 5);
+        });
+    EXPECT_EQ(stop_cnt, 5);
+  }
+
   {  // Edge-case tests
     Eigen::MatrixX2d limits(4, 2);
     limits << -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI;
@@ -142,6 +193,53 @@ TEST(TesseractKinematicsUnit, RedundantSolutionsUnit)  // NOLINT
   runRedundantSolutionsTest<double>();
 }
 
+TEST(TesseractKinematicsUnit, UtilsPInvUnit)  // NOLINT
+{
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = tesseract_kinematics::test_suite::getSceneGraphABB();
+
+  tesseract_kinematics::KDLFwdKinChain fwd_kin(*scene_graph, "base_link", "tool0");
+
+  Eigen::VectorXd jv = Eigen::VectorXd::Zero(6);
+  jv << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6;
+  Eigen::MatrixXd jacobian = fwd_kin.calcJacobian(jv, "tool0");
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(6);
+  b << 0.01, -0.02, 0.03, 0.1, -0.2, 0.3;
+
+  // Six joints use the fixed size path and away from a singularity this is the inverse
+  Eigen::MatrixXd p6(6, 6);
+  EXPECT_TRUE(tesseract_kinematics::dampedPInv(jacobian, p6));
+  EXPECT_TRUE((jacobian * p6).isApprox(Eigen::MatrixXd::Identity(6, 6), 1e-8));
+  Eigen::VectorXd x6(6);
+  EXPECT_TRUE(tesseract_kinematics::solvePInv(jacobian, b, x6));
+  EXPECT_TRUE((jacobian * x6).isApprox(b, 1e-8));
+
+  // Seven joints use the fixed size path and the result is a right inverse
+  Eigen::MatrixXd jacobian7(6, 7);
+  jacobian7 << jacobian, jacobian.col(0) + jacobian.col(3);
+  Eigen::MatrixXd p7(7, 6);
+  EXPECT_TRUE(tesseract_kinematics::dampedPInv(jacobian7, p7));
+  EXPECT_TRUE((jacobian7 * p7).isApprox(Eigen::MatrixXd::Identity(6, 6), 1e-8));
+  EXPECT_TRUE((jacobian7 * p7 * jacobian7).isApprox(jacobian7, 1e-8));
+  Eigen::VectorXd x7(7);
+  EXPECT_TRUE(tesseract_kinematics::solvePInv(jacobian7, b, x7));
+  EXPECT_TRUE(x7.isApprox(p7 * b, 1e-8));
+
+  // Other sizes use the dynamic size path and the result is a left inverse
+  Eigen::MatrixXd jacobian5 = jacobian.leftCols(5);
+  Eigen::MatrixXd p5(5, 6);
+  EXPECT_TRUE(tesseract_kinematics::dampedPInv(jacobian5, p5));
+  EXPECT_TRUE((p5 * jacobian5).isApprox(Eigen::MatrixXd::Identity(5, 5), 1e-8));
+  Eigen::VectorXd x5(5);
+  EXPECT_TRUE(tesseract_kinematics::solvePInv(jacobian5, b, x5));
+  EXPECT_TRUE(x5.isApprox(p5 * b, 1e-8));
+
+  // Empty and mismatched matrices
+  Eigen::MatrixXd empty;
+  EXPECT_FALSE(tesseract_kinematics::dampedPInv(empty, p6));
+  EXPECT_FALSE(tesseract_kinematics::solvePInv(empty, b, x6));
+  EXPECT_FALSE(tesseract_kinematics::solvePInv(jacobian, Eigen::VectorXd::Zero(5), x6));
+}
+
 TEST(TesseractKinematicsUnit, UtilsNearSingularityUnit)  // NOLINT
 {
   tesseract_scene_graph::SceneGraph::Ptr scene_graph = tesseract_kinematics::test_suite::getSceneGraphABB();
@@ -218,6 +316,395 @@ TEST(TesseractKinematicsUnit, UtilscalcManipulabilityUnit)  // NOLINT
   EXPECT_NEAR(m.f_angular.volume, 0.408248290463863, 1e-6);
 }
 
+TEST(TesseractKinematicsUnit, UtilscalcJacobianMetricsUnit)  // NOLINT
+{
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = tesseract_kinematics::test_suite::getSceneGraphABB();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  tesseract_kinematics::JointGroup joint_group("manip", joint_names, *scene_graph, scene_state);
+
+  // The metrics of a single jacobian match the individual functions
+  Eigen::VectorXd jv = Eigen::VectorXd::Zero(6);
+  jv << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6;
+  Eigen::MatrixXd jacobian = joint_group.calcJacobian(jv, "tool0");
+  tesseract_kinematics::JacobianMetrics metrics = tesseract_kinematics::calcJacobianMetrics(jacobian);
+  Eigen::VectorXd sv = Eigen::JacobiSVD<Eigen::MatrixXd>(jacobian).singularValues();
+  EXPECT_TRUE(tesseract_common::almostEqualRelativeAndAbs(metrics.singular_values, sv, 1e-8));
+  EXPECT_NEAR(metrics.min_singular_value, sv.tail(1).value(), 1e-8);
+  EXPECT_EQ(metrics.near_singularity, tesseract_kinematics::isNearSingularity(jacobian));
+  EXPECT_NEAR(metrics.manipulability.m.volume, sv.prod(), 1e-6);
+  EXPECT_NEAR(metrics.manipulability.m.measure, sv(0) / sv(5), 1e-6);
+  EXPECT_NEAR(metrics.manipulability.f.volume, 1.0 / sv.prod(), 1e-6);
+
+  // The jacobian of a partial chain has fewer singular values than rows
+  metrics = tesseract_kinematics::calcJacobianMetrics(jacobian.leftCols(4));
+  EXPECT_EQ(metrics.singular_values.size(), 4);
+  EXPECT_EQ(metrics.manipulability.m.eigen_values.size(), 6);
+  EXPECT_NEAR(metrics.manipulability.m.volume, 0, 1e-6);
+  EXPECT_EQ(metrics.manipulability.f.eigen_values.tail(1).value(), std::numeric_limits<double>::max());
+
+  // The metrics of a trajectory, the second state is in a singularity
+  tesseract_common::TrajArray trajectory(3, 6);
+  trajectory.row(0) = jv.transpose();
+  trajectory.row(1).setZero();
+  trajectory.row(2) = -jv.transpose();
+  tesseract_kinematics::TrajectoryJacobianMetrics traj_metrics =
+      tesseract_kinematics::calcJacobianMetrics(joint_group, trajectory, "tool0");
+  ASSERT_EQ(traj_metrics.states.size(), 3);
+  EXPECT_FALSE(traj_metrics.states[0].near_singularity);
+  EXPECT_TRUE(traj_metrics.states[1].near_singularity);
+  EXPECT_FALSE(traj_metrics.states[2].near_singularity);
+  EXPECT_EQ(traj_metrics.num_near_singularity, 1);
+  EXPECT_EQ(traj_metrics.min_singular_value_index, 1);
+  EXPECT_NEAR(traj_metrics.min_singular_value, 0, 1e-6);
+  EXPECT_NEAR(traj_metrics.min_volume, 0, 1e-6);
+}
+
+TEST(TesseractKinematicsUnit, DifferentialIKUnit)  // NOLINT
+{
+  using namespace tesseract_kinematics;
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = test_suite::getSceneGraphABB();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  auto joint_group = std::make_shared<const JointGroup>("manip", joint_names, *scene_graph, scene_state);
+
+  EXPECT_ANY_THROW(DifferentialIK(nullptr, "tool0"));             // NOLINT
+  EXPECT_ANY_THROW(DifferentialIK(joint_group, "missing_link"));  // NOLINT
+
+  // The preallocated jacobian matches the allocating one
+  Eigen::VectorXd jv(6);
+  jv << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6;
+  Eigen::MatrixXd jacobian(6, 6);
+  joint_group->calcJacobian(jacobian, jv, "tool0");
+  EXPECT_TRUE(jacobian.isApprox(joint_group->calcJacobian(jv, "tool0"), 1e-8));
+
+  // The threshold is below the smallest singular value at jv, which is not close to a singularity
+  DifferentialIKConfig config;
+  config.singular_value_threshold = 1e-3;
+  DifferentialIK diff_ik(joint_group, "tool0", config);
+  Eigen::VectorXd joint_velocities(6);
+  Eigen::Matrix<double, 6, 1> twist;
+  twist << 0.01, -0.02, 0.01, 0.0, 0.05, 0.0;
+  const double dt = 0.002;
+
+  // Away from singularities and limits the twist is reproduced exactly
+  ASSERT_TRUE(diff_ik.solve(joint_velocities, jv, twist, dt));
+  EXPECT_GT(diff_ik.getResult().min_singular_value, diff_ik.getConfig().singular_value_threshold);
+  EXPECT_NEAR(diff_ik.getResult().damping, 0, 1e-12);
+  EXPECT_EQ(diff_ik.getResult().num_locked_joints, 0);
+  EXPECT_NEAR(diff_ik.getResult().velocity_scale, 1, 1e-12);
+  EXPECT_TRUE((jacobian * joint_velocities).isApprox(twist, 1e-6));
+
+  // The zero position is singular, the solution is damped and remains bounded
+  ASSERT_TRUE(diff_ik.solve(joint_velocities, Eigen::VectorXd::Zero(6), twist, dt));
+  EXPECT_LT(diff_ik.getResult().min_singular_value, diff_ik.getConfig().singular_value_threshold);
+  EXPECT_GT(diff_ik.getResult().damping, 0);
+  EXPECT_TRUE(joint_velocities.allFinite());
+
+  // A joint at its upper limit moving outward is locked
+  const tesseract_common::KinematicLimits limits = joint_group->getLimits();
+  Eigen::VectorXd at_limit = jv;
+  at_limit(0) = limits.joint_limits(0, 1);
+  joint_group->calcJacobian(jacobian, at_limit, "tool0");
+  ASSERT_TRUE(diff_ik.solve(joint_velocities, at_limit, 0.01 * jacobian.col(0), dt));
+  EXPECT_GE(diff_ik.getResult().num_locked_joints, 1);
+  EXPECT_DOUBLE_EQ(joint_velocities(0), 0);
+
+  // A large twist is scaled to the velocity limits, preserving its direction. The small time step keeps the joints
+  // away from their position limits.
+  ASSERT_TRUE(diff_ik.solve(joint_velocities, jv, 1000 * twist, 1e-6));
+  EXPECT_EQ(diff_ik.getResult().num_locked_joints, 0);
+  EXPECT_LT(diff_ik.getResult().velocity_scale, 1);
+  EXPECT_TRUE((joint_velocities.array().abs() <= limits.velocity_limits.array() + 1e-12).all());
+  joint_group->calcJacobian(jacobian, jv, "tool0");
+  Eigen::Matrix<double, 6, 1> scaled_twist = jacobian * joint_velocities;
+  EXPECT_TRUE(scaled_twist.isApprox(1000 * diff_ik.getResult().velocity_scale * twist, 1e-6));
+
+  // Invalid inputs
+  Eigen::VectorXd wrong_size(5);
+  EXPECT_FALSE(diff_ik.solve(wrong_size, jv, twist, dt));
+  EXPECT_FALSE(diff_ik.solve(joint_velocities, jv, twist, 0));
+}
+
+TEST(TesseractKinematicsUnit, ReachabilityMapUnit)  // NOLINT
+{
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = tesseract_kinematics::test_suite::getSceneGraphABB();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  tesseract_kinematics::JointGroup joint_group("manip", joint_names, *scene_graph, scene_state);
+
+  tesseract_kinematics::ReachabilityMapSettings settings;
+  settings.resolution = 0.1;
+  settings.num_samples = 20000;
+  settings.max_seeds = 2;
+  tesseract_kinematics::ReachabilityMap map =
+      tesseract_kinematics::createReachabilityMap(joint_group, "base_link", "tool0", settings);
+  EXPECT_GT(map.size(), 0);
+  EXPECT_EQ(map.getJointNames(), joint_names);
+  EXPECT_EQ(map.getWorkingFrame(), "base_link");
+  EXPECT_EQ(map.getTipLinkName(), "tool0");
+
+  // An inserted pose is reachable and the seeds of its cell place the tool in the same cell
+  Eigen::VectorXd jv = Eigen::VectorXd::Zero(6);
+  jv << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6;
+  Eigen::Isometry3d pose = joint_group.calcFwdKin(jv).at("tool0");
+  ASSERT_TRUE(map.insert(pose, jv));
+  EXPECT_TRUE(map.isLikelyReachable(pose));
+  EXPECT_TRUE(map.isLikelyReachable(Eigen::Vector3d(pose.translation())));
+
+  std::vector<Eigen::VectorXd> seeds = map.getSeeds(pose);
+  EXPECT_FALSE(seeds.empty());
+  EXPECT_LE(seeds.size(), 2);
+  for (const auto& seed : seeds)
+  {
+    Eigen::Isometry3d seed_pose = joint_group.calcFwdKin(seed).at("tool0");
+    EXPECT_LT((seed_pose.translation() - pose.translation()).norm(), std::sqrt(3.0) * settings.resolution);
+    EXPECT_TRUE(map.isLikelyReachable(seed_pose));
+  }
+
+  // Poses far outside of the workspace are not reachable
+  Eigen::Isometry3d far_pose = Eigen::Isometry3d::Identity();
+  far_pose.translation() = Eigen::Vector3d(10, 0, 0);
+  EXPECT_FALSE(map.isLikelyReachable(far_pose));
+  EXPECT_FALSE(map.isLikelyReachable(Eigen::Vector3d(far_pose.translation())));
+  EXPECT_TRUE(map.getSeeds(far_pose).empty());
+  EXPECT_FALSE(map.insert(far_pose, jv));
+
+  // The same settings create the same map
+  EXPECT_TRUE(map != tesseract_kinematics::ReachabilityMap());
+  tesseract_kinematics::ReachabilityMap map2 =
+      tesseract_kinematics::createReachabilityMap(joint_group, "base_link", "tool0", settings);
+  EXPECT_TRUE(map2.insert(pose, jv));
+  EXPECT_TRUE(map == map2);
+
+  tesseract_common::testSerialization<tesseract_kinematics::ReachabilityMap>(map, "ReachabilityMap");
+
+  // Invalid settings
+  EXPECT_ANY_THROW(tesseract_kinematics::ReachabilityMap(  // NOLINT
+      joint_names, "base_link", "tool0", Eigen::Vector3d::Zero(), Eigen::VectorXi::Zero(3), 0.1, 2));
+  EXPECT_ANY_THROW(tesseract_kinematics::ReachabilityMap(  // NOLINT
+      joint_names, "base_link", "tool0", Eigen::Vector3d::Zero(), Eigen::VectorXi::Ones(3), 0, 2));
+  EXPECT_ANY_THROW(tesseract_kinematics::ReachabilityMap(  // NOLINT
+      joint_names, "base_link", "tool0", Eigen::Vector3d::Zero(), Eigen::VectorXi::Ones(3), 0.1, 0));
+  settings.num_samples = 0;
+  EXPECT_ANY_THROW(tesseract_kinematics::createReachabilityMap(  // NOLINT
+      joint_group, "base_link", "tool0", settings));
+}
+
+TEST(TesseractKinematicsUnit, KinGroupCartesianPathUnit)  // NOLINT
+{
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = tesseract_kinematics::test_suite::getSceneGraphIIWA();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  auto inv_kin = std::make_unique<tesseract_kinematics::KDLInvKinChainLMA>(*scene_graph, "base_link", "tool0");
+  std::vector<std::string> joint_names = inv_kin->getJointNames();
+  tesseract_kinematics::KinematicGroup kin_group("manip", joint_names, std::move(inv_kin), *scene_graph, scene_state);
+
+  Eigen::VectorXd seed(7);
+  seed << 0, 0.5, 0, -1.5, 0, 0.5, 0;
+  Eigen::Isometry3d start_pose = kin_group.calcFwdKin(seed).at("tool0");
+  Eigen::Isometry3d end_pose = start_pose;
+  end_pose.translation() += Eigen::Vector3d(0.1, 0.1, -0.1);
+
+  tesseract_kinematics::KinGroupCartesianPathSettings settings;
+  tesseract_kinematics::KinGroupCartesianPath path;
+  ASSERT_TRUE(kin_group.calcCartesianPath(path, start_pose, end_pose, "base_link", "tool0", seed, settings));
+  ASSERT_GT(path.size(), 2);
+  EXPECT_TRUE(path.front().pose.isApprox(start_pose, 1e-6));
+  EXPECT_TRUE(path.back().pose.isApprox(end_pose, 1e-6));
+  EXPECT_TRUE(path.front().joint_values.isApprox(seed, 1e-3));
+
+  const Eigen::Vector3d direction = (end_pose.translation() - start_pose.translation()).normalized();
+  auto distanceFromLine = [&](const Eigen::Vector3d& position) {
+    const Eigen::Vector3d offset = position - start_pose.translation();
+    return (offset - (offset.dot(direction) * direction)).norm();
+  };
+
+  for (std::size_t i = 0; i < path.size(); ++i)
+  {
+    // The link transforms are the forward kinematics of the state
+    const auto& state = path[i];
+    Eigen::Isometry3d pose = state.link_transforms.at("tool0");
+    EXPECT_TRUE(pose.isApprox(kin_group.calcFwdKin(state.joint_values).at("tool0"), 1e-6));
+    EXPECT_LT((pose.translation() - state.pose.translation()).norm(), settings.translation_tolerance);
+    EXPECT_LT(distanceFromLine(pose.translation()), settings.translation_tolerance);
+
+    // Interpolating the joint values between the states stays close to the line
+    if (i > 0)
+    {
+      Eigen::VectorXd mid = 0.5 * (path[i - 1].joint_values + state.joint_values);
+      EXPECT_LT(distanceFromLine(kin_group.calcFwdKin(mid).at("tool0").translation()),
+                settings.translation_tolerance);
+    }
+  }
+
+  // The path fails if it requires too many states or a pose can not be reached
+  settings.max_states = 2;
+  EXPECT_FALSE(kin_group.calcCartesianPath(path, start_pose, end_pose, "base_link", "tool0", seed, settings));
+
+  settings.max_states = 1000;
+  Eigen::Isometry3d far_pose = end_pose;
+  far_pose.translation() = Eigen::Vector3d(10, 0, 0);
+  EXPECT_FALSE(kin_group.calcCartesianPath(path, start_pose, far_pose, "base_link", "tool0", seed, settings));
+
+  // The same start and end pose only requires the two states
+  EXPECT_TRUE(kin_group.calcCartesianPath(path, start_pose, start_pose, "base_link", "tool0", seed, settings));
+  EXPECT_EQ(path.size(), 2);
+}
+
+TEST(TesseractKinematicsUnit, MultiGroupIKSolutionsUnit)  // NOLINT
+{
+  using namespace tesseract_kinematics;
+  std::vector<IKSolutions> group_solutions(3);
+  for (int i = 0; i < 2; ++i)
+    group_solutions[0].push_back(Eigen::VectorXd::Constant(2, i));
+
+  for (int i = 0; i < 3; ++i)
+    group_solutions[1].push_back(Eigen::VectorXd::Constant(1, 10 + i));
+
+  for (int i = 0; i < 2; ++i)
+    group_solutions[2].push_back(Eigen::VectorXd::Constant(3, 20 + i));
+
+  const std::vector<Eigen::Index> num_joints{ 2, 1, 3 };
+  EXPECT_ANY_THROW(MultiGroupIKSolutions(group_solutions, { 2, 1 }));  // NOLINT
+
+  {  // Every combination in lexicographic order
+    MultiGroupIKSolutions combinations(group_solutions, num_joints);
+    EXPECT_EQ(combinations.numJoints(), 6);
+    EXPECT_EQ(combinations.numCombinations(), 12);
+
+    Eigen::VectorXd joint_values;
+    std::size_t count{ 0 };
+    while (combinations.next(joint_values))
+    {
+      std::size_t i = count / 6;
+      std::size_t j = (count / 2) % 3;
+      std::size_t k = count % 2;
+      EXPECT_EQ(joint_values.size(), 6);
+      EXPECT_TRUE(joint_values.head(2).isApprox(group_solutions[0][i]));
+      EXPECT_TRUE(joint_values.segment(2, 1).isApprox(group_solutions[1][j]));
+      EXPECT_TRUE(joint_values.tail(3).isApprox(group_solutions[2][k]));
+      ++count;
+    }
+    EXPECT_EQ(count, 12);
+    EXPECT_FALSE(combinations.next(joint_values));
+
+    combinations.reset();
+    EXPECT_TRUE(combinations.next(joint_values));
+    EXPECT_TRUE(joint_values.head(2).isApprox(group_solutions[0][0]));
+  }
+
+  {  // Pruning the first group skips all of its combinations without extending them
+    const std::vector<Eigen::Index> prefix_sizes{ 2, 3, 6 };
+    std::size_t num_calls{ 0 };
+    auto filter = [&](const Eigen::Ref<const Eigen::VectorXd>& joint_values, std::size_t num_groups) {
+      ++num_calls;
+      EXPECT_EQ(joint_values.size(), prefix_sizes[num_groups - 1]);
+      if (num_groups == 1)
+        return joint_values(0) > 0.5;
+
+      if (num_groups == 2)
+        return joint_values(2) < 11.5;
+
+      return true;
+    };
+
+    MultiGroupIKSolutions combinations(group_solutions, num_joints, filter);
+    Eigen::VectorXd joint_values;
+    std::size_t count{ 0 };
+    while (combinations.next(joint_values))
+    {
+      EXPECT_DOUBLE_EQ(joint_values(0), 1);
+      EXPECT_LT(joint_values(2), 11.5);
+      ++count;
+    }
+    EXPECT_EQ(count, 4);
+    EXPECT_EQ(num_calls, 2 + 3 + 4);
+  }
+
+  {  // A group without solutions has no combinations
+    group_solutions[1].clear();
+    MultiGroupIKSolutions combinations(group_solutions, num_joints);
+    Eigen::VectorXd joint_values;
+    EXPECT_EQ(combinations.numJoints(), 6);
+    EXPECT_EQ(combinations.numCombinations(), 0);
+    EXPECT_FALSE(combinations.next(joint_values));
+  }
+}
+
+TEST(TesseractKinematicsUnit, MultiGroupInvKinUnit)  // NOLINT
+{
+  using namespace tesseract_kinematics;
+  tesseract_scene_graph::SceneGraph::Ptr scene_graph = test_suite::getSceneGraphABBExternalPositioner();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  auto createGroup = [&](const std::string& name, const std::string& base_link, const std::string& tip_link) {
+    auto inv_kin = std::make_unique<KDLInvKinChainLMA>(*scene_graph, base_link, tip_link);
+    std::vector<std::string> joint_names = inv_kin->getJointNames();
+    return std::make_shared<const KinematicGroup>(name, joint_names, std::move(inv_kin), *scene_graph, scene_state);
+  };
+
+  KinematicGroup::ConstPtr robot = createGroup("robot", "base_link", "tool0");
+  KinematicGroup::ConstPtr positioner = createGroup("positioner", "positioner_base_link", "positioner_tool0");
+
+  EXPECT_ANY_THROW(MultiGroupInvKin({}));                 // NOLINT
+  EXPECT_ANY_THROW(MultiGroupInvKin({ robot, nullptr }));  // NOLINT
+  EXPECT_ANY_THROW(MultiGroupInvKin({ robot, robot }));    // NOLINT
+
+  MultiGroupInvKin multi_inv_kin({ robot, positioner });
+  std::vector<std::string> joint_names = robot->getJointNames();
+  std::vector<std::string> positioner_joint_names = positioner->getJointNames();
+  joint_names.insert(joint_names.end(), positioner_joint_names.begin(), positioner_joint_names.end());
+  EXPECT_EQ(multi_inv_kin.getJointNames(), joint_names);
+  EXPECT_EQ(multi_inv_kin.getGroups().size(), 2);
+
+  Eigen::VectorXd robot_target(6);
+  robot_target << 0.1, 0.2, 0.1, 0.3, 0.4, 0.1;
+  Eigen::VectorXd positioner_target(2);
+  positioner_target << 0.2, -0.3;
+
+  std::vector<KinGroupIKInputs> inputs{
+    { KinGroupIKInput(robot->calcFwdKin(robot_target).at("tool0"), "base_link", "tool0") },
+    { KinGroupIKInput(positioner->calcFwdKin(positioner_target).at("positioner_tool0"),
+                      "positioner_base_link",
+                      "positioner_tool0") }
+  };
+  std::vector<Eigen::VectorXd> seeds{ Eigen::VectorXd::Zero(6), Eigen::VectorXd::Zero(2) };
+  EXPECT_ANY_THROW(multi_inv_kin.calcInvKin({ inputs[0] }, seeds));  // NOLINT
+
+  for (std::size_t threads : { 1, 2 })
+  {
+    MultiGroupIKSolutions solutions = multi_inv_kin.calcInvKin(inputs, seeds, nullptr, threads);
+    ASSERT_EQ(solutions.getGroupSolutions().size(), 2);
+    EXPECT_EQ(solutions.numJoints(), 8);
+    EXPECT_GT(solutions.numCombinations(), 0);
+
+    Eigen::VectorXd joint_values;
+    ASSERT_TRUE(solutions.next(joint_values));
+    Eigen::Isometry3d robot_pose = robot->calcFwdKin(joint_values.head(6)).at("tool0");
+    Eigen::Isometry3d positioner_pose = positioner->calcFwdKin(joint_values.tail(2)).at("positioner_tool0");
+    EXPECT_TRUE(robot_pose.isApprox(inputs[0][0].pose, 1e-4));
+    EXPECT_TRUE(positioner_pose.isApprox(inputs[1][0].pose, 1e-4));
+  }
+
+  // A filter rejecting the robot solutions prunes every combination
+  auto filter = [](const Eigen::Ref<const Eigen::VectorXd>& /*joint_values*/, std::size_t num_groups) {
+    EXPECT_EQ(num_groups, 1);
+    return false;
+  };
+  MultiGroupIKSolutions solutions = multi_inv_kin.calcInvKin(inputs, seeds, filter, 2);
+  Eigen::VectorXd joint_values;
+  EXPECT_FALSE(solutions.next(joint_values));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include "kinematics_test_utils.h"
 #include <tesseract_kinematics/core/kinematics_plugin_factory.h>
+#include <tesseract_kinematics/core/cached_inv_kin.h>
 #include <tesseract_state_solver/kdl/kdl_state_solver.h>
 
 using namespace tesseract_kinematics::test_suite;
@@ -1101,6 +1102,173 @@ TEST(TesseractKinematicsFactoryUnit, LoadROPKinematicsUnit)  // NOLINT
   }
 }
 
+TEST(TesseractKinematicsFactoryUnit, LoadCachedKinematicsUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+
+  tesseract_scene_graph::SceneGraph::UPtr scene_graph = getSceneGraphABB();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::string yaml_string =
+      R"(kinematic_plugins:
+           inv_kin_plugins:
+             manipulator:
+               default: CachedInvKin
+               plugins:
+                 CachedInvKin:
+                   class: CachedInvKinFactory
+                   config:
+                     cache_size: 10
+                     position_resolution: 0.0001
+                     orientation_resolution: 0.0001
+                     seed_resolution: 0
+                     solver:
+                       class: OPWInvKinFactory
+                       config:
+                         base_link: base_link
+                         tip_link: tool0
+                         params:
+                           a1: 0.100
+                           a2: -0.135
+                           b: 0.00
+                           c1: 0.615
+                           c2: 0.705
+                           c3: 0.755
+                           c4: 0.086
+                           offsets: [0, 0, -1.57079632679, 0, 0, 0]
+                           sign_corrections: [1, 1, 1, 1, 1, 1])";
+
+  KinematicsPluginFactory factory(YAML::Load(yaml_string));
+  auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+  ASSERT_TRUE(inv_kin != nullptr);
+  EXPECT_EQ(inv_kin->getSolverName(), "CachedInvKin");
+
+  auto* cached_inv_kin = dynamic_cast<CachedInvKin*>(inv_kin.get());
+  ASSERT_TRUE(cached_inv_kin != nullptr);
+  IKSolutionCache::Ptr cache = cached_inv_kin->getCache();
+  EXPECT_EQ(cache->getCacheSize(), 10);
+  EXPECT_NEAR(cache->getPositionResolution(), 0.0001, 1e-12);
+  EXPECT_NEAR(cache->getOrientationResolution(), 0.0001, 1e-12);
+  EXPECT_NEAR(cache->getSeedResolution(), 0, 1e-12);
+  EXPECT_EQ(inv_kin->getJointNames(), cached_inv_kin->getSolver().getJointNames());
+  EXPECT_EQ(inv_kin->getBaseLinkName(), "base_link");
+  EXPECT_EQ(inv_kin->getWorkingFrame(), "base_link");
+  EXPECT_EQ(inv_kin->getTipLinkNames(), std::vector<std::string>{ "tool0" });
+
+  {  // The solutions match the solver and repeated requests are returned from the cache
+    tesseract_common::TransformMap tip_link_poses;
+    tip_link_poses["tool0"] = Eigen::Isometry3d::Identity();
+    tip_link_poses["tool0"].translation() = Eigen::Vector3d(1, 0, 1.306);
+    Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+
+    IKSolutions expected = cached_inv_kin->getSolver().calcInvKin(tip_link_poses, seed);
+    IKSolutions solutions = inv_kin->calcInvKin(tip_link_poses, seed);
+    EXPECT_FALSE(solutions.empty());
+    ASSERT_EQ(solutions.size(), expected.size());
+    for (std::size_t i = 0; i < solutions.size(); ++i)
+      EXPECT_TRUE(solutions[i].isApprox(expected[i], 1e-8));
+    EXPECT_EQ(cache->size(), 1);
+
+    // A request in the same cell returns the cached solutions
+    tip_link_poses["tool0"].translation().x() += 1e-6;
+    solutions = inv_kin->calcInvKin(tip_link_poses, Eigen::VectorXd::Ones(6));
+    ASSERT_EQ(solutions.size(), expected.size());
+    for (std::size_t i = 0; i < solutions.size(); ++i)
+      EXPECT_TRUE(solutions[i].isApprox(expected[i], 1e-8));
+    EXPECT_EQ(cache->size(), 1);
+
+    // The clones share the cache
+    InverseKinematics::UPtr inv_kin_clone = inv_kin->clone();
+    EXPECT_EQ(dynamic_cast<CachedInvKin&>(*inv_kin_clone).getCache(), cache);
+    tip_link_poses["tool0"].translation().x() -= 0.1;
+    inv_kin_clone->calcInvKin(tip_link_poses, seed);
+    EXPECT_EQ(cache->size(), 2);
+
+    cache->setCacheSize(1);
+    EXPECT_EQ(cache->size(), 1);
+
+    cache->clear();
+    EXPECT_EQ(cache->size(), 0);
+  }
+
+  {  // Solvers created for the same kinematics share the cache
+    auto inv_kin2 = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    ASSERT_TRUE(inv_kin2 != nullptr);
+    EXPECT_EQ(dynamic_cast<CachedInvKin&>(*inv_kin2).getCache(), cache);
+  }
+
+  {  // Changing the kinematics or limits creates a new cache
+    Eigen::Isometry3d origin = scene_graph->getJoint("joint_2")->parent_to_joint_origin_transform;
+    origin.translation().z() += 0.01;
+    scene_graph->changeJointOrigin("joint_2", origin);
+    auto inv_kin2 = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    ASSERT_TRUE(inv_kin2 != nullptr);
+    IKSolutionCache::Ptr cache2 = dynamic_cast<CachedInvKin&>(*inv_kin2).getCache();
+    EXPECT_NE(cache2, cache);
+
+    scene_graph->changeJointPositionLimits("joint_1", -1, 1);
+    auto inv_kin3 = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    ASSERT_TRUE(inv_kin3 != nullptr);
+    EXPECT_NE(dynamic_cast<CachedInvKin&>(*inv_kin3).getCache(), cache2);
+  }
+
+  {  // missing config
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin.remove("config");
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+  {  // missing solver entry class
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin["config"]["solver"].remove("class");
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+  {  // invalid solver
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin["config"]["solver"]["config"].remove("base_link");
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+  {  // invalid position resolution
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin["config"]["position_resolution"] = 0;
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+  {  // invalid orientation resolution
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin["config"]["orientation_resolution"] = -1;
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+  {  // invalid seed resolution
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["CachedInvKin"];
+    plugin["config"]["seed_resolution"] = -1;
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "CachedInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
+}
+
 TEST(TesseractKinematicsFactoryUnit, LoadKDLKinematicsUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
@@ -1239,6 +1407,76 @@ TEST(TesseractKinematicsFactoryUnit, LoadKDLKinematicsUnit)  // NOLINT
   }
 }
 
+TEST(TesseractKinematicsFactoryUnit, SolverCacheUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+
+  tesseract_scene_graph::SceneGraph::UPtr scene_graph = getSceneGraphABB();
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  std::string yaml_string =
+      R"(kinematic_plugins:
+           fwd_kin_plugins:
+             manipulator:
+               default: KDLFwdKinChain
+               plugins:
+                 KDLFwdKinChain:
+                   class: KDLFwdKinChainFactory
+                   config:
+                     base_link: base_link
+                     tip_link: tool0
+           inv_kin_plugins:
+             manipulator:
+               default: KDLInvKinChainLMA
+               plugins:
+                 KDLInvKinChainLMA:
+                   class: KDLInvKinChainLMAFactory
+                   config:
+                     base_link: base_link
+                     tip_link: tool0)";
+
+  KinematicsPluginFactory factory(YAML::Load(yaml_string));
+  const Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(6, 0.1);
+  auto fwd_kin = factory.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 1);
+  ASSERT_TRUE(fwd_kin != nullptr);
+  const Eigen::Isometry3d pose = fwd_kin->calcFwdKin(joint_values).at("tool0");
+
+  auto inv_kin = factory.createInvKin("manipulator", "KDLInvKinChainLMA", *scene_graph, scene_state, 1);
+  ASSERT_TRUE(inv_kin != nullptr);
+  EXPECT_EQ(inv_kin->getJointNames(), fwd_kin->getJointNames());
+
+  // The solver of a revision is reused, so a change of the scene graph requires a new revision
+  Eigen::Isometry3d origin = scene_graph->getJoint("joint_1")->parent_to_joint_origin_transform;
+  origin.translation().z() += 0.1;
+  EXPECT_TRUE(scene_graph->changeJointOrigin("joint_1", origin));
+
+  auto cached = factory.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 1);
+  ASSERT_TRUE(cached != nullptr);
+  EXPECT_TRUE(cached->calcFwdKin(joint_values).at("tool0").isApprox(pose, 1e-8));
+
+  // A copy of the factory has the same solvers
+  KinematicsPluginFactory copy(factory);
+  cached = copy.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 1);
+  ASSERT_TRUE(cached != nullptr);
+  EXPECT_TRUE(cached->calcFwdKin(joint_values).at("tool0").isApprox(pose, 1e-8));
+
+  auto updated = factory.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 2);
+  ASSERT_TRUE(updated != nullptr);
+  EXPECT_NEAR(updated->calcFwdKin(joint_values).at("tool0").translation().z(), pose.translation().z() + 0.1, 1e-8);
+
+  // The solvers are created again after the cache is cleared
+  copy.clearSolverCache();
+  updated = copy.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 1);
+  ASSERT_TRUE(updated != nullptr);
+  EXPECT_NEAR(updated->calcFwdKin(joint_values).at("tool0").translation().z(), pose.translation().z() + 0.1, 1e-8);
+
+  // A change of the plugin info is not hidden by the cache
+  factory.addFwdKinPlugin("manipulator", "KDLFwdKinChain", tesseract_common::PluginInfo());
+  EXPECT_TRUE(factory.createFwdKin("manipulator", "KDLFwdKinChain", *scene_graph, scene_state, 2) == nullptr);
+  EXPECT_TRUE(factory.createFwdKin("manipulator", "DoesNotExist", *scene_graph, scene_state, 2) == nullptr);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -299,6 +299,21 @@ inline void runJacobianTest(tesseract_kinematics::KinematicGroup& kin_group,
   jacobian.resize(6, kin_group.numJoints());
 
   tesseract_common::TransformMap poses = kin_group.calcFwdKin(jvals);
+  {  // Test the forward kinematics of only the link
+    tesseract_common::VectorIsometry3d link_transforms(1);
+    kin_group.calcFwdKin(link_transforms, jvals, kin_group.getLinkIndices({ link_name }));
+    EXPECT_TRUE(link_transforms[0].isApprox(poses.at(link_name), 1e-8));
+  }
+
+  {  // Test the forward kinematics of all links into flat link transforms
+    tesseract_common::LinkTransforms link_transforms;
+    kin_group.calcFwdKin(link_transforms, jvals);
+    EXPECT_EQ(link_transforms.getNameTable(), kin_group.getLinkNameTable());
+    EXPECT_TRUE(link_transforms.at(link_name).isApprox(poses.at(link_name), 1e-8));
+    for (std::size_t i = 0; i < link_transforms.size(); ++i)
+      EXPECT_TRUE(link_transforms[i].isApprox(poses.at(link_transforms.getNames()[i]), 1e-8));
+  }
+
   {  // Test with all information
     jacobian = kin_group.calcJacobian(jvals, link_name, link_point);
 
@@ -437,6 +452,31 @@ inline void runInvKinTest(const tesseract_kinematics::InverseKinematics& inv_kin
     Eigen::Quaterniond rot_result(result.rotation());
     EXPECT_TRUE(rot_pose.isApprox(rot_result, 1e-3));
   }
+
+  {  // Test solving many poses at once
+    tesseract_common::VectorIsometry3d poses(5, target_pose);
+    IKSolutionsBuffer buffer;
+    inv_kin.calcInvKinBatch(buffer, poses, seed);
+    EXPECT_EQ(buffer.numPoses(), poses.size());
+    for (std::size_t i = 0; i < buffer.numPoses(); ++i)
+    {
+      EXPECT_EQ(buffer.numSolutions(i), solutions.size());
+      for (std::size_t j = 0; j < std::min(buffer.numSolutions(i), solutions.size()); ++j)
+        EXPECT_TRUE(buffer.getSolution(i, j).isApprox(solutions[j], 1e-8));
+    }
+  }
+
+  {  // Test solving into a reused solution matrix
+    Eigen::MatrixXd matrix_solutions;
+    for (int k = 0; k < 2; ++k)
+    {
+      const Eigen::Index num_solutions = inv_kin.calcInvKin(matrix_solutions, input, seed);
+      EXPECT_EQ(num_solutions, static_cast<Eigen::Index>(solutions.size()));
+      EXPECT_EQ(matrix_solutions.rows(), inv_kin.numJoints());
+      for (Eigen::Index j = 0; j < std::min(num_solutions, static_cast<Eigen::Index>(solutions.size())); ++j)
+        EXPECT_TRUE(matrix_solutions.col(j).isApprox(solutions[static_cast<std::size_t>(j)], 1e-8));
+    }
+  }
 }
 
 /**
@@ -469,6 +509,32 @@ inline void runInvKinTest(const tesseract_kinematics::KinematicGroup& kin_group,
     EXPECT_TRUE(rot_pose.isApprox(rot_result, 1e-3));
   }
 
+  {  // Test solving many poses at once
+    tesseract_common::VectorIsometry3d poses(5, target_pose);
+    IKSolutionsBuffer buffer;
+    kin_group.calcInvKin(buffer, poses, working_frame, tip_link_name, seed, 2);
+    EXPECT_EQ(buffer.numPoses(), poses.size());
+    for (std::size_t i = 0; i < buffer.numPoses(); ++i)
+    {
+      IKSolutions pose_solutions = buffer.getSolutions(i);
+      EXPECT_EQ(pose_solutions.size(), solutions.size());
+      for (std::size_t j = 0; j < std::min(pose_solutions.size(), solutions.size()); ++j)
+        EXPECT_TRUE(pose_solutions[j].isApprox(solutions[j], 1e-8));
+    }
+  }
+
+  {  // Test solving into a reused solution matrix
+    Eigen::MatrixXd matrix_solutions;
+    for (int k = 0; k < 2; ++k)
+    {
+      const Eigen::Index num_solutions = kin_group.calcInvKin(matrix_solutions, inputs, seed);
+      EXPECT_EQ(num_solutions, static_cast<Eigen::Index>(solutions.size()));
+      EXPECT_EQ(matrix_solutions.rows(), kin_group.numJoints());
+      for (Eigen::Index j = 0; j < std::min(num_solutions, static_cast<Eigen::Index>(solutions.size())); ++j)
+        EXPECT_TRUE(matrix_solutions.col(j).isApprox(solutions[static_cast<std::size_t>(j)], 1e-8));
+    }
+  }
+
   EXPECT_TRUE(checkKinematics(kin_group));
 }
 
@@ -191,6 +191,49 @@ TEST(TesseractKinematicsUnit, RobotWithExternalPositionerInverseKinematicUnit)
   runKinSetJointLimitsTest(kin_group2);
 }
 
+TEST(TesseractKinematicsUnit, RobotWithExternalPositionerParallelInverseKinematicUnit)  // NOLINT
+{
+  auto scene_graph = getSceneGraphABBExternalPositioner();
+  auto inv_kin = getFullInvKinematics(*scene_graph);
+
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+  pose.translation()[0] = 0;
+  pose.translation()[1] = 0;
+  pose.translation()[2] = 0.1;
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(8);
+
+  tesseract_common::TransformMap input{ std::make_pair(std::string("tool0"), pose) };
+  IKSolutions solutions = inv_kin->calcInvKin(input, seed);
+  ASSERT_FALSE(solutions.empty());
+
+  // Searching on more than one thread finds the same solutions in the same order
+  auto parallel_inv_kin = std::make_unique<REPInvKin>(dynamic_cast<const REPInvKin&>(*inv_kin));
+  parallel_inv_kin->setThreads(4);
+  EXPECT_EQ(parallel_inv_kin->getThreads(), 4);
+  EXPECT_EQ(dynamic_cast<const REPInvKin&>(*parallel_inv_kin->clone()).getThreads(), 4);
+
+  IKSolutions parallel_solutions = parallel_inv_kin->calcInvKin(input, seed);
+  ASSERT_EQ(parallel_solutions.size(), solutions.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+    EXPECT_TRUE(parallel_solutions[i].isApprox(solutions[i], 1e-8));
+
+  // Limiting the number of solutions stops the search early
+  const std::size_t max_solutions = std::min<std::size_t>(3, solutions.size());
+  auto limited_inv_kin = std::make_unique<REPInvKin>(dynamic_cast<const REPInvKin&>(*inv_kin));
+  limited_inv_kin->setMaxSolutions(max_solutions);
+  EXPECT_EQ(limited_inv_kin->getMaxSolutions(), max_solutions);
+
+  IKSolutions limited_solutions = limited_inv_kin->calcInvKin(input, seed);
+  ASSERT_EQ(limited_solutions.size(), max_solutions);
+  for (std::size_t i = 0; i < max_solutions; ++i)
+    EXPECT_TRUE(limited_solutions[i].isApprox(solutions[i], 1e-8));
+
+  parallel_inv_kin->setMaxSolutions(max_solutions);
+  EXPECT_EQ(parallel_inv_kin->calcInvKin(input, seed).size(), max_solutions);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
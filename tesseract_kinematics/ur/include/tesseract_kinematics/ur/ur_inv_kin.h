@@ -81,6 +81,14 @@ public:
   tesseract_kinematics::IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                                const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  Eigen::Index calcInvKin(Eigen::MatrixXd& solutions,
+                          const tesseract_common::TransformMap& tip_link_poses,
+                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
+  void calcInvKinBatch(IKSolutionsBuffer& solutions,
+                       const tesseract_common::VectorIsometry3d& tip_link_poses,
+                       const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
   Eigen::Index numJoints() const override final;
   std::vector<std::string> getJointNames() const override final;
   std::string getBaseLinkName() const override final;
@@ -220,6 +220,189 @@ int inverse(const Eigen::Isometry3d& T, const URParameters& params, double* q_so
   }
   return num_sols;
 }
+
+namespace
+{
+/** @brief The number of poses solved at once by inverseBatch */
+constexpr int BATCH_SIZE = 4;
+using BatchArray = Eigen::Array<double, BATCH_SIZE, 1>;
+using BatchMask = Eigen::Array<bool, BATCH_SIZE, 1>;
+
+BatchArray batchAtan2(const BatchArray& y, const BatchArray& x)
+{
+  return y.binaryExpr(x, [](double a, double b) { return std::atan2(a, b); });
+}
+
+/** @brief Wrap angles to [0, 2 PI), snapping angles within ZERO_THRESH of zero to zero */
+BatchArray batchWrap(const BatchArray& q)
+{
+  const BatchArray snapped = (q.abs() < ZERO_THRESH).select(0.0, q);
+  return (snapped < 0.0).select(snapped + 2.0 * PI, snapped);
+}
+
+/**
+ * @brief Solve the inverse kinematics of BATCH_SIZE poses at once
+ *
+ * This follows inverse, but each pose is a lane of an Eigen array so the arithmetic is vectorized across poses. The
+ * cosine and sine of each intermediate joint angle are derived algebraically from the arguments of the acos or atan2
+ * that produced it, which leaves only the acos and atan2 calls that produce the solutions. Poses that hit one of the
+ * special cases of inverse (a singular shoulder, a wrist on the edge of its range or a degenerate elbow) are solved
+ * by inverse.
+ *
+ * @param T The poses
+ * @param params The UR kinematic parameters
+ * @param q_sols The solutions, up to 8 solutions of 6 joints for each pose
+ * @param num_sols The number of solutions of each pose
+ * @param q6_des The value of the last joint when it is not determined by the pose
+ */
+void inverseBatch(const Eigen::Isometry3d* T, const URParameters& params, double* q_sols, int* num_sols, double q6_des)
+{
+  BatchArray T00, T01, T02, T03, T10, T11, T12, T13, T20, T21, T22, T23;  // NOLINT
+  for (int l = 0; l < BATCH_SIZE; ++l)
+  {
+    T00(l) = T[l](0, 0);
+    T01(l) = T[l](0, 1);
+    T02(l) = T[l](0, 2);
+    T03(l) = T[l](0, 3);
+    T10(l) = T[l](1, 0);
+    T11(l) = T[l](1, 1);
+    T12(l) = T[l](1, 2);
+    T13(l) = T[l](1, 3);
+    T20(l) = T[l](2, 0);
+    T21(l) = T[l](2, 1);
+    T22(l) = T[l](2, 2);
+    T23(l) = T[l](2, 3);
+    num_sols[l] = 0;
+  }
+
+  ////////////////////////////// shoulder rotate joint (q1) //////////////////////////////
+  const BatchArray A = params.d6 * T12 - T13;
+  const BatchArray B = params.d6 * T02 - T03;
+  const BatchArray R = A * A + B * B;
+  BatchMask fallback = (A.abs() < ZERO_THRESH) || (B.abs() < ZERO_THRESH) || (R < params.d4 * params.d4);
+
+  // q1 = +/- acos(d4 / sqrt(R)) + atan2(-B, A)
+  const BatchArray sqrt_R = R.sqrt();
+  const BatchArray c_acos = params.d4 / sqrt_R;
+  const BatchArray s_acos = (1.0 - c_acos.square()).max(0.0).sqrt();
+  const BatchArray c_atan = A / sqrt_R;
+  const BatchArray s_atan = -B / sqrt_R;
+  const BatchArray arccos1 = c_acos.acos();
+  const BatchArray arctan1 = batchAtan2(-B, A);
+  const std::array<BatchArray, 2> q1{ batchWrap(arccos1 + arctan1), batchWrap(arctan1 - arccos1) };
+  const std::array<BatchArray, 2> c1{ c_acos * c_atan - s_acos * s_atan, c_acos * c_atan + s_acos * s_atan };
+  const std::array<BatchArray, 2> s1{ s_acos * c_atan + c_acos * s_atan, c_acos * s_atan - s_acos * c_atan };
+  ////////////////////////////////////////////////////////////////////////////////
+
+  ////////////////////////////// wrist 2 joint (q5) //////////////////////////////
+  std::array<BatchArray, 2> c5;
+  std::array<BatchArray, 2> s5;
+  std::array<BatchArray, 2> arccos5;
+  for (std::size_t i = 0; i < 2; i++)
+  {
+    const BatchArray numer = T03 * s1[i] - T13 * c1[i] - params.d4;
+    const BatchMask edge = (numer.abs() - std::abs(params.d6)).abs() < ZERO_THRESH;
+    c5[i] = edge.select(numer.sign() * SIGN(params.d6), numer / params.d6);
+    s5[i] = (1.0 - c5[i].square()).max(0.0).sqrt();
+    arccos5[i] = c5[i].acos();
+    fallback = fallback || !(c5[i].abs() <= 1.0);
+  }
+  ////////////////////////////////////////////////////////////////////////////////
+
+  for (std::size_t i = 0; i < 2; i++)
+  {
+    for (std::size_t j = 0; j < 2; j++)
+    {
+      // The second solution of q5 is 2 PI - acos, its sine is negated
+      const BatchArray q5 = (j == 0) ? arccos5[i] : BatchArray(2.0 * PI - arccos5[i]);
+      const BatchArray& c1_i = c1[i];
+      const BatchArray& s1_i = s1[i];
+      const BatchArray& c5_ij = c5[i];
+      const BatchArray s5_ij = (j == 0) ? s5[i] : BatchArray(-s5[i]);
+
+      ////////////////////////////// wrist 3 joint (q6) //////////////////////////////
+      const BatchMask s5_zero = s5_ij.abs() < ZERO_THRESH;
+      const BatchArray x6 = s5_ij.sign() * (T00 * s1_i - T10 * c1_i);
+      const BatchArray y6 = s5_ij.sign() * -(T01 * s1_i - T11 * c1_i);
+      const BatchArray r6 = (x6.square() + y6.square()).sqrt();
+      fallback = fallback || (!s5_zero && !(r6 >= ZERO_THRESH));
+      const BatchArray q6 = s5_zero.select(q6_des, batchWrap(batchAtan2(y6, x6)));
+      const BatchArray c6 = s5_zero.select(std::cos(q6_des), x6 / r6);
+      const BatchArray s6 = s5_zero.select(std::sin(q6_des), y6 / r6);
+      ////////////////////////////////////////////////////////////////////////////////
+
+      ///////////////////////////// RRR joints (q2,q3,q4) ////////////////////////////
+      const BatchArray x04x = -s5_ij * (T02 * c1_i + T12 * s1_i) -
+                              c5_ij * (s6 * (T01 * c1_i + T11 * s1_i) - c6 * (T00 * c1_i + T10 * s1_i));
+      const BatchArray x04y = c5_ij * (T20 * c6 - T21 * s6) - T22 * s5_ij;
+      const BatchArray p13x = params.d5 * (s6 * (T00 * c1_i + T10 * s1_i) + c6 * (T01 * c1_i + T11 * s1_i)) -
+                              params.d6 * (T02 * c1_i + T12 * s1_i) + T03 * c1_i + T13 * s1_i;
+      const BatchArray p13y = T23 - params.d1 - params.d6 * T22 + params.d5 * (T21 * c6 + T20 * s6);
+
+      BatchArray c3 = (p13x.square() + p13y.square() - params.a2 * params.a2 - params.a3 * params.a3) /
+                      (2.0 * params.a2 * params.a3);
+      c3 = ((c3.abs() - 1.0).abs() < ZERO_THRESH).select(c3.sign(), c3);
+      const BatchMask valid = c3.abs() <= 1.0;
+
+      // q3 is acos(c3) for the first solution and 2 PI - acos(c3) for the second, its sine is negated
+      const BatchArray arccos3 = c3.acos();
+      const BatchArray s3 = (1.0 - c3.square()).max(0.0).sqrt();
+      const BatchArray denom = params.a2 * params.a2 + params.a3 * params.a3 + 2 * params.a2 * params.a3 * c3;
+      const BatchArray A3 = params.a2 + params.a3 * c3;
+      const BatchArray B3 = params.a3 * s3;
+      const BatchArray x2_0 = (A3 * p13x + B3 * p13y) / denom;
+      const BatchArray y2_0 = (A3 * p13y - B3 * p13x) / denom;
+      const BatchArray x2_1 = (A3 * p13x - B3 * p13y) / denom;
+      const BatchArray y2_1 = (A3 * p13y + B3 * p13x) / denom;
+      const BatchArray r2_0 = (x2_0.square() + y2_0.square()).sqrt();
+      const BatchArray r2_1 = (x2_1.square() + y2_1.square()).sqrt();
+      fallback = fallback || (valid && !(r2_0.min(r2_1) >= ZERO_THRESH));
+
+      // cos(q2 + q3) and sin(q2 + q3) of both solutions
+      const BatchArray c2_0 = x2_0 / r2_0;
+      const BatchArray s2_0 = y2_0 / r2_0;
+      const BatchArray c2_1 = x2_1 / r2_1;
+      const BatchArray s2_1 = y2_1 / r2_1;
+      const BatchArray c23_0 = c2_0 * c3 - s2_0 * s3;
+      const BatchArray s23_0 = s2_0 * c3 + c2_0 * s3;
+      const BatchArray c23_1 = c2_1 * c3 + s2_1 * s3;
+      const BatchArray s23_1 = s2_1 * c3 - c2_1 * s3;
+
+      const std::array<BatchArray, 2> q2{ batchWrap(batchAtan2(y2_0, x2_0)), batchWrap(batchAtan2(y2_1, x2_1)) };
+      const std::array<BatchArray, 2> q3{ arccos3, BatchArray(2.0 * PI - arccos3) };
+      const std::array<BatchArray, 2> q4{
+        batchWrap(batchAtan2(c23_0 * x04y - s23_0 * x04x, x04x * c23_0 + x04y * s23_0)),
+        batchWrap(batchAtan2(c23_1 * x04y - s23_1 * x04x, x04x * c23_1 + x04y * s23_1))
+      };
+      ////////////////////////////////////////////////////////////////////////////////
+
+      for (int l = 0; l < BATCH_SIZE; ++l)
+      {
+        if (!valid(l))
+          continue;
+
+        for (std::size_t k = 0; k < 2; k++)
+        {
+          double* q_sol = q_sols + ((l * 8) + num_sols[l]) * 6;
+          q_sol[0] = q1[i](l);
+          q_sol[1] = q2[k](l);
+          q_sol[2] = q3[k](l);
+          q_sol[3] = q4[k](l);
+          q_sol[4] = q5(l);
+          q_sol[5] = q6(l);
+          num_sols[l]++;
+        }
+      }
+    }
+  }
+
+  for (int l = 0; l < BATCH_SIZE; ++l)
+  {
+    if (fallback(l))
+      num_sols[l] = inverse(T[l], params, q_sols + (l * 8 * 6), q6_des);
+  }
+}
+}  // namespace
 // LCOV_EXCL_STOP
 
 URInvKin::URInvKin(URParameters params,
@@ -284,6 +467,76 @@ IKSolutions URInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link_
   return solution_set;
 }
 
+Eigen::Index URInvKin::calcInvKin(Eigen::MatrixXd& solutions,
+                                  const tesseract_common::TransformMap& tip_link_poses,
+                                  const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  assert(tip_link_poses.size() == 1);
+  assert(tip_link_poses.find(tip_link_name_) != tip_link_poses.end());
+  assert(std::abs(1.0 - tip_link_poses.at(tip_link_name_).matrix().determinant()) < 1e-6);  // NOLINT
+
+  Eigen::Isometry3d base_offset = Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ());
+  Eigen::Isometry3d corrected_pose = base_offset.inverse() * tip_link_poses.at(tip_link_name_);
+
+  // Each column is six contiguous values, so the analytic IK writes its solutions into the matrix directly
+  if (solutions.rows() != 6 || solutions.cols() < 8)  // maximum of 8 IK solutions
+    solutions.resize(6, 8);
+
+  const auto num_sols = static_cast<Eigen::Index>(inverse(corrected_pose, params_, solutions.data(), 0));
+  for (Eigen::Index i = 0; i < num_sols; ++i)
+  {
+    // Harmonize between [-PI, PI]
+    harmonizeTowardZero<double>(solutions.col(i), REDUNDANT_CAPABLE_JOINTS);  // Modifies the column in place
+  }
+
+  return num_sols;
+}
+
+void URInvKin::calcInvKinBatch(IKSolutionsBuffer& solutions,
+                               const tesseract_common::VectorIsometry3d& tip_link_poses,
+                               const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  const Eigen::Isometry3d base_offset_inv =
+      (Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ())).inverse();
+
+  solutions.clear();
+  solutions.num_joints = 6;
+  solutions.offsets.reserve(tip_link_poses.size() + 1);
+
+  // The poses are solved BATCH_SIZE at a time, the last batch is padded with its last pose
+  // NOLINTNEXTLINE
+  std::array<std::array<double, 6>, 8 * BATCH_SIZE> sols;  // maximum of 8 IK solutions per pose
+  std::array<Eigen::Isometry3d, BATCH_SIZE> corrected_poses;
+  std::array<int, BATCH_SIZE> num_sols{};
+  for (std::size_t start = 0; start < tip_link_poses.size(); start += corrected_poses.size())
+  {
+    const std::size_t batch_size = std::min(corrected_poses.size(), tip_link_poses.size() - start);
+    for (std::size_t i = 0; i < corrected_poses.size(); ++i)
+    {
+      const Eigen::Isometry3d& tip_link_pose = tip_link_poses[start + std::min(i, batch_size - 1)];
+      assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
+      corrected_poses[i] = base_offset_inv * tip_link_pose;
+    }
+
+    inverseBatch(corrected_poses.data(), params_, sols[0].data(), num_sols.data(), 0);
+
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      for (std::size_t j = 0; j < static_cast<std::size_t>(num_sols[i]); ++j)
+      {
+        std::array<double, 6>& sol = sols[(i * 8) + j];
+        Eigen::Map<Eigen::VectorXd> eigen_sol(sol.data(), static_cast<Eigen::Index>(sol.size()));
+
+        // Harmonize between [-PI, PI]
+        harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
+        solutions.data.insert(solutions.data.end(), sol.begin(), sol.end());
+      }
+
+      solutions.offsets.push_back(solutions.offsets.back() + static_cast<std::size_t>(num_sols[i]));
+    }
+  }
+}
+
 Eigen::Index URInvKin::numJoints() const { return 6; }
 std::vector<std::string> URInvKin::getJointNames() const { return joint_names_; }
 std::string URInvKin::getBaseLinkName() const { return base_link_name_; }
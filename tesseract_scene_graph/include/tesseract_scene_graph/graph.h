@@ -36,12 +36,19 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 #include <string>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_scene_graph/link.h>
 #include <tesseract_scene_graph/joint.h>
 #include <tesseract_common/allowed_collision_matrix.h>
+#include <tesseract_common/memory_usage.h>
+#include <tesseract_common/types.h>
 
 #ifndef SWIG
 
@@ -117,6 +124,116 @@ struct ShortestPath
   std::vector<std::string> active_joints;
 };
 
+/**
+ * @brief A frozen, index based copy of the structure of a scene graph
+ * @details Links and joints are identified by their index. The outbound joints of a link have consecutive indices in
+ * the order of the outbound edges of the graph, and the inbound joints of each link are stored in compressed sparse row
+ * form, so the traversals are array scans instead of graph searches using maps.
+ *
+ * If the scene graph is a forest, every link has at most one inbound joint and there are no cycles, the links are also
+ * stored in depth first order so the link and its descendants are a contiguous range of the tour.
+ */
+class CompiledSceneGraph
+{
+public:
+  using Ptr = std::shared_ptr<CompiledSceneGraph>;
+  using ConstPtr = std::shared_ptr<const CompiledSceneGraph>;
+
+  CompiledSceneGraph() = default;
+#ifndef SWIG
+  explicit CompiledSceneGraph(const Graph& graph);
+#endif  // SWIG
+
+  /**
+   * @brief Get the index of a link
+   * @param link_name The link name
+   * @return The index of the link, -1 if the link does not exist
+   */
+  int getLinkIndex(const std::string& link_name) const;
+
+  /**
+   * @brief Get the index of a joint
+   * @param joint_name The joint name
+   * @return The index of the joint, -1 if the joint does not exist
+   */
+  int getJointIndex(const std::string& joint_name) const;
+
+  /** @brief Get the link names indexed by link index */
+  const std::vector<std::string>& getLinkNames() const;
+
+  /** @brief Get the joint names indexed by joint index */
+  const std::vector<std::string>& getJointNames() const;
+
+  /** @brief Get the joints indexed by joint index */
+  const std::vector<Joint::ConstPtr>& getJoints() const;
+
+  /** @brief Get the index of the parent link of a joint */
+  int getJointParentLink(int joint_index) const;
+
+  /** @brief Get the index of the child link of a joint */
+  int getJointChildLink(int joint_index) const;
+
+  /**
+   * @brief Get the outbound joints of a link
+   * @return The first joint index and one past the last joint index
+   */
+  std::pair<int, int> getOutboundJoints(int link_index) const;
+
+  /**
+   * @brief Get the inbound joints of a link
+   * @return A pointer to the first joint index and one past the last joint index
+   */
+  std::pair<const int*, const int*> getInboundJoints(int link_index) const;
+
+  /** @brief Check if the scene graph is a forest, which is required by the functions using the tour */
+  bool isForest() const;
+
+  /** @brief Get the inbound joint of a link, -1 for a root link or if the scene graph is not a forest */
+  int getParentJoint(int link_index) const;
+
+  /** @brief Get the link indices in depth first order, empty if the scene graph is not a forest */
+  const std::vector<int>& getTour() const;
+
+  /**
+   * @brief Get the range of the tour containing a link and its descendants
+   * @return The position of the link in the tour and one past the position of its last descendant
+   */
+  std::pair<int, int> getSubtree(int link_index) const;
+
+  /**
+   * @brief Check if a link is the root of a subtree or one of its descendants, this requires a forest
+   * @param subtree_link_index The root link of the subtree
+   * @param link_index The link to check
+   * @return True if the link is in the subtree
+   */
+  bool isInSubtree(int subtree_link_index, int link_index) const;
+
+private:
+  std::vector<std::string> link_names_;
+  std::vector<std::string> joint_names_;
+  std::vector<Joint::ConstPtr> joints_;
+  std::unordered_map<std::string, int> link_indices_;
+  std::unordered_map<std::string, int> joint_indices_;
+
+  std::vector<int> joint_parent_links_;
+  std::vector<int> joint_child_links_;
+
+  /** @brief The outbound joints of link i are the indices outbound_offsets_[i] to outbound_offsets_[i + 1] */
+  std::vector<int> outbound_offsets_;
+
+  /** @brief The inbound joints of link i are inbound_joints_[inbound_offsets_[i]] to inbound_offsets_[i + 1] */
+  std::vector<int> inbound_offsets_;
+  std::vector<int> inbound_joints_;
+
+  bool forest_{ false };
+  std::vector<int> parent_joints_;
+  std::vector<int> tour_;
+  std::vector<int> tour_begin_;
+  std::vector<int> tour_end_;
+};
+
+struct KDLTreeData;
+
 class SceneGraph
 #ifndef SWIG
   : public Graph,
@@ -143,6 +260,8 @@ public:
 
   /**
    * @brief Clone the scene graph
+   * @details Only the structure is copied. The links and joints are shared with the clone, a shared joint is copied
+   * before either scene graph changes it.
    * @return The cloned scene graph
    */
   SceneGraph::UPtr clone() const;
@@ -392,6 +511,16 @@ public:
    */
   tesseract_common::AllowedCollisionMatrix::Ptr getAllowedCollisionMatrix();
 
+  /**
+   * @brief Get the memory used by the scene graph
+   * @details The report has a part for each link with the geometry of its visuals and collisions, and parts for the
+   * joints, the allowed collision matrix and the cached query results. Links and geometry are shared with the clones
+   * of the scene graph and the contact managers, they are only counted by the first report passed the tracker.
+   * @param tracker Tracks the storage shared with other objects
+   * @return The memory used by the scene graph
+   */
+  tesseract_common::MemoryUsage getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const;
+
   /**
    * @brief Get the source link (parent link) for a joint
    * @param joint_name The name of the joint
@@ -462,6 +591,7 @@ public:
 
   /**
    * @brief Get all children for a given link name
+   * @details The result is cached until the structure of the scene graph changes
    * @param name Name of Link
    * @return A vector of child link names
    */
@@ -477,6 +607,7 @@ public:
   /**
    * @brief Create mapping between links in the scene to the provided links if they are directly affected if the link
    * moves
+   * @details The result is cached until the structure of the scene graph changes
    * @param link_names The links to map other links to
    * @return A map of affected links to on of the provided link names.
    */
@@ -484,7 +615,6 @@ public:
 
   /**
    * @brief Get all children link names for the given joint names
-   * @todo Need to create custom visitor so already process joint_names do not get processed again.
    * @param names Name of joints
    * @return A vector of child link names
    */
@@ -498,12 +628,21 @@ public:
 
   /**
    * @brief Get the shortest path between two links
+   * @details The result is cached until the structure of the scene graph changes
    * @param root The base link
    * @param tip The tip link
    * @return The shortest path between the two links
    */
   ShortestPath getShortestPath(const std::string& root, const std::string& tip) const;
 
+  /**
+   * @brief Get the compiled structure of the scene graph
+   * @details It is built when first requested after the structure changed and is shared until the next change. Changes
+   * made directly to the underlying boost graph are not tracked.
+   * @return The compiled scene graph
+   */
+  CompiledSceneGraph::ConstPtr getCompiledSceneGraph() const;
+
 #ifndef SWIG
   /**
    * @brief Get the graph vertex by name
@@ -527,7 +666,8 @@ public:
    * Merge a sub-graph into the current environment, considering that the root of the merged graph is attached to the
    * root of the environment by a fixed joint and no displacement. Every joint and link of the sub-graph will be copied
    * into the environment graph. The prefix argument is meant to allow adding multiple copies of the same sub-graph with
-   * different names
+   * different names. Without a prefix the links and joints are shared like clone, with a prefix the renamed links
+   * share their inertial, visual and collision elements.
    */
   bool insertSceneGraph(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix = "");
 
@@ -573,9 +713,53 @@ private:
   std::unordered_map<std::string, std::pair<Joint::Ptr, Edge>> joint_map_;
   tesseract_common::AllowedCollisionMatrix::Ptr acm_;
 
+  /**
+   * @brief The names of the joints which may be shared with another scene graph
+   * @details The links are never changed in place, but a shared joint is copied before it is changed
+   */
+  mutable std::unordered_set<std::string> shared_joints_;
+  mutable std::mutex shared_joints_mutex_;
+
+  /** @brief The compiled structure, nullptr until requested after the structure changed */
+  mutable CompiledSceneGraph::ConstPtr compiled_;
+
+  /** @brief The results of the queries on the compiled structure, cleared with it */
+  mutable std::unordered_map<tesseract_common::LinkNamesPair, ShortestPath, tesseract_common::PairHash>
+      shortest_path_cache_;
+  mutable std::unordered_map<std::string, std::vector<std::string>> link_children_cache_;
+  mutable std::map<std::vector<std::string>, std::unordered_map<std::string, std::string>> adjacency_map_cache_;
+
+  /** @brief The KDL tree of the scene graph, cleared with the compiled structure, see getKDLTreeData */
+  mutable std::shared_ptr<const KDLTreeData> kdl_tree_data_;
+
+  /** @brief Protects the compiled structure and the cached query results */
+  mutable std::mutex compiled_mutex_;
+
+  friend std::shared_ptr<const KDLTreeData> getKDLTreeData(const SceneGraph& scene_graph);
+
   /** @brief The rebuild the link and joint map by extraction information from the graph */
   void rebuildLinkAndJointMaps();
 
+  /** @brief Mark the joints as shared with another scene graph */
+  void shareJoints() const;
+
+  /**
+   * @brief Copy a joint if it is shared with another scene graph, so it can be changed
+   * @param entry The joint map entry of the joint
+   */
+  void unshareJoint(std::pair<Joint::Ptr, Edge>& entry);
+
+  /** @brief Clear the compiled structure and the cached query results because the structure changed */
+  void clearCompiledSceneGraph();
+
+  /** @brief Get the shortest path between two links without using the cache */
+  ShortestPath getShortestPathHelper(const CompiledSceneGraph& compiled,
+                                     const std::string& root,
+                                     const std::string& tip) const;
+
+  /** @brief Get the children of a link including the link, using the cache */
+  std::vector<std::string> getLinkChildrenHelper(const CompiledSceneGraph::ConstPtr& compiled, int link_index) const;
+
   struct cycle_detector : public boost::dfs_visitor<>
   {
     cycle_detector(bool& ascyclic) : ascyclic_(ascyclic) {}
@@ -634,92 +818,6 @@ private:
     bool found_root_{ false };
   };
 
-  struct children_detector : public boost::default_bfs_visitor
-  {
-    children_detector(std::vector<std::string>& children) : children_(children) {}
-
-    template <class u, class g>
-    void discover_vertex(u vertex, const g& graph)
-    {
-      children_.push_back(boost::get(boost::vertex_link, graph)[vertex]->getName());
-    }
-
-  protected:
-    std::vector<std::string>& children_;
-  };
-
-  struct adjacency_detector : public boost::default_bfs_visitor
-  {
-    adjacency_detector(std::unordered_map<std::string, std::string>& adjacency_map,
-                       std::map<Vertex, boost::default_color_type>& color_map,
-                       const std::string& base_link_name,
-                       const std::vector<std::string>& terminate_on_links)
-      : adjacency_map_(adjacency_map)
-      , color_map_(color_map)
-      , base_link_name_(base_link_name)
-      , terminate_on_links_(terminate_on_links)
-    {
-    }
-
-    template <class u, class g>
-    void examine_vertex(u vertex, const g& graph)
-    {
-      for (auto vd : boost::make_iterator_range(adjacent_vertices(vertex, graph)))
-      {
-        std::string adj_link = boost::get(boost::vertex_link, graph)[vd]->getName();
-        if (std::find(terminate_on_links_.begin(), terminate_on_links_.end(), adj_link) != terminate_on_links_.end())
-          color_map_[vd] = boost::default_color_type::black_color;
-      }
-    }
-
-    template <class u, class g>
-    void discover_vertex(u vertex, const g& graph)
-    {
-      std::string adj_link = boost::get(boost::vertex_link, graph)[vertex]->getName();
-      adjacency_map_[adj_link] = base_link_name_;
-    }
-
-  protected:
-    std::unordered_map<std::string, std::string>& adjacency_map_;
-    std::map<Vertex, boost::default_color_type>& color_map_;
-    const std::string& base_link_name_;
-    const std::vector<std::string>& terminate_on_links_;
-  };
-
-  /**
-   * @brief Get the children of a vertex starting with start_vertex
-   *
-   * Note: This list will include the start vertex
-   *
-   * @param start_vertex The vertex to find childeren for.
-   * @return A list of child link names including the start vertex
-   */
-  std::vector<std::string> getLinkChildrenHelper(Vertex start_vertex) const
-  {
-    const auto& graph = static_cast<const Graph&>(*this);
-    std::vector<std::string> child_link_names;
-
-    std::map<Vertex, size_t> index_map;
-    boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
-
-    std::map<Vertex, boost::default_color_type> color_map;
-    boost::associative_property_map<std::map<Vertex, boost::default_color_type>> prop_color_map(color_map);
-
-    int c = 0;
-    Graph::vertex_iterator i, iend;
-    for (boost::tie(i, iend) = boost::vertices(graph); i != iend; ++i, ++c)
-      boost::put(prop_index_map, *i, c);
-
-    children_detector vis(child_link_names);
-    // NOLINTNEXTLINE
-    boost::breadth_first_search(
-        graph,
-        start_vertex,
-        boost::visitor(vis).root_vertex(start_vertex).vertex_index_map(prop_index_map).color_map(prop_color_map));
-
-    return child_link_names;
-  }
-
   friend class boost::serialization::access;
   template <class Archive>
   void save(Archive& ar, const unsigned int version) const;  // NOLINT
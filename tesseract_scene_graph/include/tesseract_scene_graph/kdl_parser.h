@@ -39,6 +39,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -118,6 +119,9 @@ KDL::RigidBodyInertia convert(const Inertial::ConstPtr& inertial);
 /** @brief The KDLTreeData populated when parsing scene graph */
 struct KDLTreeData
 {
+  using Ptr = std::shared_ptr<KDLTreeData>;
+  using ConstPtr = std::shared_ptr<const KDLTreeData>;
+
   KDL::Tree tree;
   std::string base_link_name;
   std::vector<std::string> joint_names;
@@ -136,6 +140,17 @@ struct KDLTreeData
  */
 KDLTreeData parseSceneGraph(const SceneGraph& scene_graph);
 
+/**
+ * @brief Get the KDL Tree of a Tesseract SceneGraph, see parseSceneGraph
+ * @details The tree is converted the first time it is requested and cached by the scene graph until its structure or
+ * a joint origin changes, so building many state solvers or kinematic chains from the same scene graph converts it
+ * once. Chains are extracted from the cached tree with KDL::Tree::getChain.
+ * @throws If graph is not a tree
+ * @param scene_graph The Tesseract Scene Graph
+ * @return Returns the shared KDL tree data representation of the scene graph
+ */
+KDLTreeData::ConstPtr getKDLTreeData(const SceneGraph& scene_graph);
+
 /**
  * @brief Convert a portion of a Tesseract SceneGraph into a KDL Tree
  * @details This will create a new tree from multiple sub tree defined by the provided joint names
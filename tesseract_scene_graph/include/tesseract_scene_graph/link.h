@@ -40,6 +40,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <future>
 #include <string>
 #include <vector>
 #include <map>
@@ -171,10 +172,18 @@ public:
     origin.setIdentity();
     geometry.reset();
     name.clear();
+    deferred_geometry = {};
   }
 
   std::string name;
 
+  /**
+   * @brief The collisions replacing this one once their geometry is loaded
+   * @details It is only valid if the geometry is a conservative stand-in, like the bounding box of a mesh which is
+   * loaded in the background. It is neither compared nor serialized.
+   */
+  std::shared_future<std::vector<std::shared_ptr<Collision>>> deferred_geometry;
+
   bool operator==(const Collision& rhs) const;
   bool operator!=(const Collision& rhs) const;
 
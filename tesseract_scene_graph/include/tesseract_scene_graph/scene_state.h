@@ -84,5 +84,8 @@ private:
 
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/tracking.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_scene_graph::SceneState, "SceneState")
+// Version 1 stores the joint values and transforms as contiguous arrays in binary archives
+BOOST_CLASS_VERSION(tesseract_scene_graph::SceneState, 1)
 #endif  // TESSERACT_SCENE_GRAPH_SCENE_STATE_H
@@ -69,6 +69,230 @@ struct ugraph_vertex_copier
   mutable typename boost::property_map<UGraph, boost::vertex_all_t>::type vertex_all_map2;
 };
 
+CompiledSceneGraph::CompiledSceneGraph(const Graph& graph)
+{
+  std::unordered_map<Graph::vertex_descriptor, int> vertex_indices;
+  Graph::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = boost::vertices(graph); vi != vi_end; ++vi)
+  {
+    const std::string& name = boost::get(boost::vertex_link, graph)[*vi]->getName();
+    vertex_indices[*vi] = static_cast<int>(link_names_.size());
+    link_indices_[name] = static_cast<int>(link_names_.size());
+    link_names_.push_back(name);
+  }
+
+  // The joints are numbered by parent link, so the outbound joints of a link are consecutive
+  const auto num_links = static_cast<int>(link_names_.size());
+  outbound_offsets_.reserve(link_names_.size() + 1);
+  outbound_offsets_.push_back(0);
+  for (boost::tie(vi, vi_end) = boost::vertices(graph); vi != vi_end; ++vi)
+  {
+    Graph::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi, graph); ei != ei_end; ++ei)
+    {
+      const Joint::ConstPtr& joint = boost::get(boost::edge_joint, graph)[*ei];
+      joint_indices_[joint->getName()] = static_cast<int>(joints_.size());
+      joint_names_.push_back(joint->getName());
+      joints_.push_back(joint);
+      joint_parent_links_.push_back(vertex_indices.at(*vi));
+      joint_child_links_.push_back(vertex_indices.at(boost::target(*ei, graph)));
+    }
+    outbound_offsets_.push_back(static_cast<int>(joints_.size()));
+  }
+
+  inbound_offsets_.assign(link_names_.size() + 1, 0);
+  for (int child : joint_child_links_)
+    ++inbound_offsets_[static_cast<std::size_t>(child) + 1];
+
+  for (std::size_t i = 1; i < inbound_offsets_.size(); ++i)
+    inbound_offsets_[i] += inbound_offsets_[i - 1];
+
+  inbound_joints_.resize(joints_.size());
+  std::vector<int> next(inbound_offsets_.begin(), inbound_offsets_.end() - 1);
+  for (std::size_t j = 0; j < joints_.size(); ++j)
+    inbound_joints_[static_cast<std::size_t>(next[static_cast<std::size_t>(joint_child_links_[j])]++)] =
+        static_cast<int>(j);
+
+  // The tour requires every link to have at most one inbound joint
+  forest_ = true;
+  parent_joints_.assign(link_names_.size(), -1);
+  for (int l = 0; l < num_links && forest_; ++l)
+  {
+    const auto begin = inbound_offsets_[static_cast<std::size_t>(l)];
+    const auto end = inbound_offsets_[static_cast<std::size_t>(l) + 1];
+    if (end - begin > 1)
+      forest_ = false;
+    else if (end - begin == 1)
+      parent_joints_[static_cast<std::size_t>(l)] = inbound_joints_[static_cast<std::size_t>(begin)];
+  }
+
+  if (forest_)
+  {
+    tour_.reserve(link_names_.size());
+    tour_begin_.assign(link_names_.size(), 0);
+    tour_end_.assign(link_names_.size(), 0);
+
+    // Depth first from each root link, the stack holds the link and its next outbound joint
+    std::vector<std::pair<int, int>> stack;
+    for (int root = 0; root < num_links; ++root)
+    {
+      if (parent_joints_[static_cast<std::size_t>(root)] != -1)
+        continue;
+
+      tour_begin_[static_cast<std::size_t>(root)] = static_cast<int>(tour_.size());
+      tour_.push_back(root);
+      stack.emplace_back(root, outbound_offsets_[static_cast<std::size_t>(root)]);
+      while (!stack.empty())
+      {
+        const int link = stack.back().first;
+        const int joint = stack.back().second;
+        if (joint < outbound_offsets_[static_cast<std::size_t>(link) + 1])
+        {
+          ++stack.back().second;
+          const int child = joint_child_links_[static_cast<std::size_t>(joint)];
+          tour_begin_[static_cast<std::size_t>(child)] = static_cast<int>(tour_.size());
+          tour_.push_back(child);
+          stack.emplace_back(child, outbound_offsets_[static_cast<std::size_t>(child)]);
+        }
+        else
+        {
+          tour_end_[static_cast<std::size_t>(link)] = static_cast<int>(tour_.size());
+          stack.pop_back();
+        }
+      }
+    }
+
+    // Links on a cycle are not reachable from a root link
+    if (tour_.size() != link_names_.size())
+    {
+      forest_ = false;
+      tour_.clear();
+      tour_begin_.clear();
+      tour_end_.clear();
+    }
+  }
+
+  if (!forest_)
+    parent_joints_.assign(link_names_.size(), -1);
+}
+
+int CompiledSceneGraph::getLinkIndex(const std::string& link_name) const
+{
+  auto it = link_indices_.find(link_name);
+  return (it != link_indices_.end()) ? it->second : -1;
+}
+
+int CompiledSceneGraph::getJointIndex(const std::string& joint_name) const
+{
+  auto it = joint_indices_.find(joint_name);
+  return (it != joint_indices_.end()) ? it->second : -1;
+}
+
+const std::vector<std::string>& CompiledSceneGraph::getLinkNames() const { return link_names_; }
+
+const std::vector<std::string>& CompiledSceneGraph::getJointNames() const { return joint_names_; }
+
+const std::vector<Joint::ConstPtr>& CompiledSceneGraph::getJoints() const { return joints_; }
+
+int CompiledSceneGraph::getJointParentLink(int joint_index) const
+{
+  return joint_parent_links_[static_cast<std::size_t>(joint_index)];
+}
+
+int CompiledSceneGraph::getJointChildLink(int joint_index) const
+{
+  return joint_child_links_[static_cast<std::size_t>(joint_index)];
+}
+
+std::pair<int, int> CompiledSceneGraph::getOutboundJoints(int link_index) const
+{
+  return { outbound_offsets_[static_cast<std::size_t>(link_index)],
+           outbound_offsets_[static_cast<std::size_t>(link_index) + 1] };
+}
+
+std::pair<const int*, const int*> CompiledSceneGraph::getInboundJoints(int link_index) const
+{
+  const int* data = inbound_joints_.data();
+  return { data + inbound_offsets_[static_cast<std::size_t>(link_index)],
+           data + inbound_offsets_[static_cast<std::size_t>(link_index) + 1] };
+}
+
+bool CompiledSceneGraph::isForest() const { return forest_; }
+
+int CompiledSceneGraph::getParentJoint(int link_index) const
+{
+  return parent_joints_[static_cast<std::size_t>(link_index)];
+}
+
+const std::vector<int>& CompiledSceneGraph::getTour() const { return tour_; }
+
+std::pair<int, int> CompiledSceneGraph::getSubtree(int link_index) const
+{
+  return { tour_begin_[static_cast<std::size_t>(link_index)], tour_end_[static_cast<std::size_t>(link_index)] };
+}
+
+bool CompiledSceneGraph::isInSubtree(int subtree_link_index, int link_index) const
+{
+  const int position = tour_begin_[static_cast<std::size_t>(link_index)];
+  return (tour_begin_[static_cast<std::size_t>(subtree_link_index)] <= position &&
+          position < tour_end_[static_cast<std::size_t>(subtree_link_index)]);
+}
+
+namespace
+{
+/**
+ * @brief Append a link and the links reachable from it in breadth first order, skipping links already visited
+ * @param names The link names are appended to this vector
+ * @param visited The links already visited, updated with the appended links
+ * @param graph The compiled scene graph
+ * @param start_link The first link
+ */
+void appendLinkChildren(std::vector<std::string>& names,
+                        std::vector<char>& visited,
+                        const CompiledSceneGraph& graph,
+                        int start_link)
+{
+  if (visited[static_cast<std::size_t>(start_link)] != 0)
+    return;
+
+  std::vector<int> queue{ start_link };
+  visited[static_cast<std::size_t>(start_link)] = 1;
+  for (std::size_t i = 0; i < queue.size(); ++i)
+  {
+    names.push_back(graph.getLinkNames()[static_cast<std::size_t>(queue[i])]);
+    const auto joints = graph.getOutboundJoints(queue[i]);
+    for (int j = joints.first; j < joints.second; ++j)
+    {
+      const int child = graph.getJointChildLink(j);
+      if (visited[static_cast<std::size_t>(child)] == 0)
+      {
+        visited[static_cast<std::size_t>(child)] = 1;
+        queue.push_back(child);
+      }
+    }
+  }
+}
+
+/** @brief Check if the limits of a continuous joint must be set when it is added to a scene graph */
+bool requiresLimitsUpdate(const Joint& joint)
+{
+  if (joint.type != JointType::CONTINUOUS)
+    return false;
+
+  return (joint.limits == nullptr ||
+          tesseract_common::almostEqualRelativeAndAbs(joint.limits->lower, joint.limits->upper, 1e-5));
+}
+
+/** @brief Append the inbound joint of a link to a shortest path */
+void appendPathJoint(ShortestPath& path, const CompiledSceneGraph& graph, int link_index)
+{
+  const Joint::ConstPtr& joint = graph.getJoints()[static_cast<std::size_t>(graph.getParentJoint(link_index))];
+  path.joints.push_back(joint->getName());
+  if (joint->type != JointType::FIXED && joint->type != JointType::FLOATING)
+    path.active_joints.push_back(joint->getName());
+}
+}  // namespace
+
 SceneGraph::SceneGraph(const std::string& name) : acm_(std::make_shared<tesseract_common::AllowedCollisionMatrix>())
 {
   boost::set_property(static_cast<Graph&>(*this), boost::graph_name, name);
@@ -79,6 +303,7 @@ SceneGraph::SceneGraph(SceneGraph&& other) noexcept
   , link_map_(std::move(other.link_map_))
   , joint_map_(std::move(other.joint_map_))
   , acm_(std::move(other.acm_))
+  , shared_joints_(std::move(other.shared_joints_))
 {
   rebuildLinkAndJointMaps();
 }
@@ -90,6 +315,7 @@ SceneGraph& SceneGraph::operator=(SceneGraph&& other) noexcept
   link_map_ = std::move(other.link_map_);
   joint_map_ = std::move(other.joint_map_);
   acm_ = std::move(other.acm_);
+  shared_joints_ = std::move(other.shared_joints_);
 
   rebuildLinkAndJointMaps();
 
@@ -100,15 +326,24 @@ SceneGraph::UPtr SceneGraph::clone() const
 {
   auto cloned_graph = std::make_unique<SceneGraph>();
 
-  for (auto& link : getLinks())
+  for (const auto& link : link_map_)
   {
-    cloned_graph->addLink(link->clone(link->getName()));
-    cloned_graph->setLinkVisibility(link->getName(), getLinkVisibility(link->getName()));
-    cloned_graph->setLinkCollisionEnabled(link->getName(), getLinkCollisionEnabled(link->getName()));
+    cloned_graph->addLinkHelper(link.second.first);
+    cloned_graph->setLinkVisibility(link.first, getLinkVisibility(link.first));
+    cloned_graph->setLinkCollisionEnabled(link.first, getLinkCollisionEnabled(link.first));
   }
 
-  for (auto& joint : getJoints())
-    cloned_graph->addJoint(joint->clone(joint->getName()));
+  for (const auto& joint : joint_map_)
+  {
+    // A joint which is changed when added is copied
+    if (requiresLimitsUpdate(*joint.second.first))
+      cloned_graph->addJoint(*joint.second.first);
+    else
+      cloned_graph->addJointHelper(joint.second.first);
+  }
+
+  shareJoints();
+  cloned_graph->shareJoints();
 
   cloned_graph->getAllowedCollisionMatrix()->insertAllowedCollisionMatrix(*getAllowedCollisionMatrix());
 
@@ -124,6 +359,10 @@ void SceneGraph::clear()
   link_map_.clear();
   joint_map_.clear();
   acm_->clearAllowedCollisions();
+  clearCompiledSceneGraph();
+
+  std::lock_guard<std::mutex> lock(shared_joints_mutex_);
+  shared_joints_.clear();
 }
 
 void SceneGraph::setName(const std::string& name)
@@ -131,6 +370,91 @@ void SceneGraph::setName(const std::string& name)
   boost::set_property(static_cast<Graph&>(*this), boost::graph_name, name);
 }
 
+tesseract_common::MemoryUsage SceneGraph::getMemoryUsage(tesseract_common::MemoryUsageTracker& tracker) const
+{
+  tesseract_common::MemoryUsage usage("scene_graph " + getName());
+  usage.unique_bytes += sizeof(SceneGraph);
+
+  tesseract_common::MemoryUsage& links_usage = usage.addChild("links");
+  for (const auto& link_pair : link_map_)
+  {
+    const Link::Ptr& link = link_pair.second.first;
+    tesseract_common::MemoryUsage& link_usage = links_usage.addChild(link->getName());
+    if (!tracker.count(link_usage,
+                       link,
+                       sizeof(Link) + tesseract_common::getVectorBytes(link->visual) +
+                           tesseract_common::getVectorBytes(link->collision)))
+      continue;
+
+    if (!link->visual.empty())
+    {
+      tesseract_common::MemoryUsage& visual_usage = link_usage.addChild("visual");
+      for (const auto& visual : link->visual)
+      {
+        if (visual->geometry != nullptr)
+          visual_usage.children.push_back(visual->geometry->getMemoryUsage(tracker));
+      }
+    }
+
+    if (!link->collision.empty())
+    {
+      tesseract_common::MemoryUsage& collision_usage = link_usage.addChild("collision");
+      for (const auto& collision : link->collision)
+      {
+        if (collision->geometry != nullptr)
+          collision_usage.children.push_back(collision->geometry->getMemoryUsage(tracker));
+      }
+    }
+  }
+
+  tesseract_common::MemoryUsage& joints_usage = usage.addChild("joints");
+  for (const auto& joint_pair : joint_map_)
+    tracker.count(joints_usage, joint_pair.second.first, sizeof(Joint));
+
+  tesseract_common::MemoryUsage& acm_usage = usage.addChild("allowed_collision_matrix");
+  if (acm_ != nullptr)
+  {
+    const tesseract_common::AllowedCollisionEntries& entries = acm_->getAllAllowedCollisions();
+    tracker.count(acm_usage,
+                  acm_,
+                  sizeof(tesseract_common::AllowedCollisionMatrix) +
+                      entries.size() * (sizeof(tesseract_common::AllowedCollisionEntries::value_type) + sizeof(void*)) +
+                      entries.bucket_count() * sizeof(void*));
+  }
+
+  // The compiled structure and the query results are rebuilt on demand after the structure changes
+  tesseract_common::MemoryUsage& cache_usage = usage.addChild("cache");
+  {
+    std::lock_guard<std::mutex> lock(compiled_mutex_);
+    if (compiled_ != nullptr)
+    {
+      // Each link and joint has its name, an index entry and a few indices
+      const std::size_t count = compiled_->getLinkNames().size() + compiled_->getJointNames().size();
+      const std::size_t bytes_per_element =
+          2 * sizeof(std::string) + sizeof(std::pair<const std::string, int>) + 6 * sizeof(int);
+      tracker.count(cache_usage, compiled_, sizeof(CompiledSceneGraph) + count * bytes_per_element);
+    }
+
+    for (const auto& path : shortest_path_cache_)
+    {
+      cache_usage.unique_bytes += sizeof(path) + tesseract_common::getVectorBytes(path.second.links) +
+                                  tesseract_common::getVectorBytes(path.second.joints) +
+                                  tesseract_common::getVectorBytes(path.second.active_joints);
+    }
+
+    for (const auto& children : link_children_cache_)
+      cache_usage.unique_bytes += sizeof(children) + tesseract_common::getVectorBytes(children.second);
+
+    for (const auto& adjacency_map : adjacency_map_cache_)
+    {
+      cache_usage.unique_bytes += sizeof(adjacency_map) + tesseract_common::getVectorBytes(adjacency_map.first) +
+                                  adjacency_map.second.size() * 2 * sizeof(std::string);
+    }
+  }
+
+  return usage;
+}
+
 const std::string& SceneGraph::getName() const
 {
   return boost::get_property(static_cast<const Graph&>(*this), boost::graph_name);
@@ -207,6 +531,8 @@ bool SceneGraph::addLinkHelper(const Link::Ptr& link_ptr, bool replace_allowed)
     // First link added set as root
     if (link_map_.size() == 1)
       setRoot(link_ptr->getName());
+
+    clearCompiledSceneGraph();
   }
 
   return true;
@@ -272,6 +598,7 @@ bool SceneGraph::removeLink(const std::string& name, bool recursive)
   // Now remove vertex
   boost::remove_vertex(found->second.second, static_cast<Graph&>(*this));
   link_map_.erase(name);
+  clearCompiledSceneGraph();
 
   // Need to remove any reference to link in allowed collision matrix
   removeAllowedCollision(name);
@@ -381,13 +708,13 @@ bool SceneGraph::addJointHelper(const Joint::Ptr& joint_ptr)
 
   // Need to set limits for continuous joints. TODO: This may not be required
   // by the optimization library but may be nice to have
-  if (joint_ptr->type == tesseract_scene_graph::JointType::CONTINUOUS)
+  if (requiresLimitsUpdate(*joint_ptr))
   {
     if (joint_ptr->limits == nullptr)
     {
       joint_ptr->limits = std::make_shared<JointLimits>(-4 * M_PI, 4 * M_PI, 0, 2, 1);
     }
-    else if (tesseract_common::almostEqualRelativeAndAbs(joint_ptr->limits->lower, joint_ptr->limits->upper, 1e-5))
+    else
     {
       joint_ptr->limits->lower = -4 * M_PI;
       joint_ptr->limits->upper = +4 * M_PI;
@@ -401,6 +728,7 @@ bool SceneGraph::addJointHelper(const Joint::Ptr& joint_ptr)
       boost::add_edge(parent->second.second, child->second.second, info, static_cast<Graph&>(*this));
   assert(e.second == true);
   joint_map_[joint_ptr->getName()] = std::make_pair(joint_ptr, e.first);
+  clearCompiledSceneGraph();
 
   return true;
 }
@@ -424,6 +752,10 @@ bool SceneGraph::removeJoint(const std::string& name, bool recursive)
   {
     boost::remove_edge(found->second.second, static_cast<Graph&>(*this));
     joint_map_.erase(name);
+    clearCompiledSceneGraph();
+
+    std::lock_guard<std::mutex> lock(shared_joints_mutex_);
+    shared_joints_.erase(name);
   }
   else
   {
@@ -457,6 +789,7 @@ bool SceneGraph::moveJoint(const std::string& name, const std::string& parent_li
     return false;
   }
 
+  unshareJoint(found_joint->second);
   Joint::Ptr joint = found_joint->second.first;
   if (!removeJoint(name))
     return false;
@@ -500,6 +833,7 @@ bool SceneGraph::changeJointOrigin(const std::string& name, const Eigen::Isometr
   }
 
   // Update transform associated with the joint
+  unshareJoint(found->second);
   Joint::Ptr joint = found->second.first;
   joint->parent_to_joint_origin_transform = new_origin;
 
@@ -508,6 +842,9 @@ bool SceneGraph::changeJointOrigin(const std::string& name, const Eigen::Isometr
   double d = joint->parent_to_joint_origin_transform.translation().norm();
   boost::put(boost::edge_weight_t(), *this, e, d);
 
+  // The cached shortest paths depend on the edge weights and the cached KDL tree on the origin
+  clearCompiledSceneGraph();
+
   return true;
 }
 
@@ -528,6 +865,7 @@ bool SceneGraph::changeJointLimits(const std::string& name, const JointLimits& l
     return false;
   }
 
+  unshareJoint(found->second);
   if (found->second.first->limits == nullptr)
     found->second.first->limits = std::make_shared<JointLimits>();
 
@@ -557,6 +895,7 @@ bool SceneGraph::changeJointPositionLimits(const std::string& name, double lower
     return false;
   }
 
+  unshareJoint(found->second);
   found->second.first->limits->lower = lower;
   found->second.first->limits->upper = upper;
 
@@ -580,6 +919,7 @@ bool SceneGraph::changeJointVelocityLimits(const std::string& name, double limit
     return false;
   }
 
+  unshareJoint(found->second);
   found->second.first->limits->velocity = limit;
   return true;
 }
@@ -603,6 +943,7 @@ bool SceneGraph::changeJointAccelerationLimits(const std::string& name, double l
     return false;
   }
 
+  unshareJoint(found->second);
   if (found->second.first->limits == nullptr)
     found->second.first->limits = std::make_shared<JointLimits>();
 
@@ -764,59 +1105,103 @@ std::vector<std::string> SceneGraph::getInvAdjacentLinkNames(const std::string&
 
 std::vector<std::string> SceneGraph::getLinkChildrenNames(const std::string& name) const
 {
-  Vertex v = getVertex(name);
-  std::vector<std::string> child_link_names = getLinkChildrenHelper(v);
+  CompiledSceneGraph::ConstPtr graph = getCompiledSceneGraph();
+  const int link_index = graph->getLinkIndex(name);
+  if (link_index < 0)
+    throw std::runtime_error("SceneGraph, vertex with name '" + name + "' does not exist!");
+
+  std::vector<std::string> child_link_names = getLinkChildrenHelper(graph, link_index);
 
-  // This always includes the start vertex, so must remove
+  // This always includes the start link, so must remove
   child_link_names.erase(child_link_names.begin());
   return child_link_names;
 }
 
 std::vector<std::string> SceneGraph::getJointChildrenNames(const std::string& name) const
 {
-  const auto& graph = static_cast<const Graph&>(*this);
-  Edge e = getEdge(name);
-  Vertex v = boost::target(e, graph);
-  return getLinkChildrenHelper(v);  // NOLINT
+  CompiledSceneGraph::ConstPtr graph = getCompiledSceneGraph();
+  const int joint_index = graph->getJointIndex(name);
+  if (joint_index < 0)
+    throw std::runtime_error("SceneGraph, edge with name '" + name + "' does not exist!");
+
+  return getLinkChildrenHelper(graph, graph->getJointChildLink(joint_index));
 }
 
 std::vector<std::string> SceneGraph::getJointChildrenNames(const std::vector<std::string>& names) const
 {
-  std::set<std::string> link_names;
+  CompiledSceneGraph::ConstPtr graph = getCompiledSceneGraph();
+
+  // The visited links are shared, so links below several of the joints are only visited once
+  std::vector<std::string> link_names;
+  std::vector<char> visited(graph->getLinkNames().size(), 0);
   for (const auto& name : names)
   {
-    std::vector<std::string> joint_children = getJointChildrenNames(name);
-    link_names.insert(joint_children.begin(), joint_children.end());
+    const int joint_index = graph->getJointIndex(name);
+    if (joint_index < 0)
+      throw std::runtime_error("SceneGraph, edge with name '" + name + "' does not exist!");
+
+    appendLinkChildren(link_names, visited, *graph, graph->getJointChildLink(joint_index));
   }
 
-  return std::vector<std::string>{ link_names.begin(), link_names.end() };
+  std::sort(link_names.begin(), link_names.end());
+  return link_names;
 }
 
 std::unordered_map<std::string, std::string>
 SceneGraph::getAdjacencyMap(const std::vector<std::string>& link_names) const
 {
-  std::map<Vertex, size_t> index_map;
-  boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
+  CompiledSceneGraph::ConstPtr graph = getCompiledSceneGraph();
+  {
+    std::lock_guard<std::mutex> lock(compiled_mutex_);
+    auto it = adjacency_map_cache_.find(link_names);
+    if (it != adjacency_map_cache_.end())
+      return it->second;
+  }
 
-  std::map<Vertex, boost::default_color_type> color_map;
-  boost::associative_property_map<std::map<Vertex, boost::default_color_type>> prop_color_map(color_map);
+  const std::size_t num_links = graph->getLinkNames().size();
 
-  int c = 0;
-  Graph::vertex_iterator i, iend;
-  for (boost::tie(i, iend) = boost::vertices(*this); i != iend; ++i, ++c)
-    boost::put(prop_index_map, *i, c);
+  // The search from each link stops at the other links
+  std::vector<char> terminate(num_links, 0);
+  std::vector<int> start_links;
+  start_links.reserve(link_names.size());
+  for (const auto& link_name : link_names)
+  {
+    const int link_index = graph->getLinkIndex(link_name);
+    if (link_index < 0)
+      throw std::runtime_error("SceneGraph, vertex with name '" + link_name + "' does not exist!");
+
+    terminate[static_cast<std::size_t>(link_index)] = 1;
+    start_links.push_back(link_index);
+  }
 
   std::unordered_map<std::string, std::string> adjacency_map;
-  for (const auto& link_name : link_names)
+  std::vector<int> visited(num_links, -1);
+  std::vector<int> queue;
+  for (std::size_t i = 0; i < start_links.size(); ++i)
   {
-    Vertex start_vertex = getVertex(link_name);
-    adjacency_detector vis(adjacency_map, color_map, link_name, link_names);
+    const auto search = static_cast<int>(i);
+    queue.assign(1, start_links[i]);
+    visited[static_cast<std::size_t>(start_links[i])] = search;
+    for (std::size_t q = 0; q < queue.size(); ++q)
+    {
+      adjacency_map[graph->getLinkNames()[static_cast<std::size_t>(queue[q])]] = link_names[i];
+      const auto joints = graph->getOutboundJoints(queue[q]);
+      for (int j = joints.first; j < joints.second; ++j)
+      {
+        const int child = graph->getJointChildLink(j);
+        if (terminate[static_cast<std::size_t>(child)] == 0 && visited[static_cast<std::size_t>(child)] != search)
+        {
+          visited[static_cast<std::size_t>(child)] = search;
+          queue.push_back(child);
+        }
+      }
+    }
+  }
 
-    // NOLINTNEXTLINE
-    boost::breadth_first_search(
-        *this,
-        start_vertex,
-        boost::visitor(vis).root_vertex(start_vertex).vertex_index_map(prop_index_map).color_map(prop_color_map));
+  {
+    std::lock_guard<std::mutex> lock(compiled_mutex_);
+    if (compiled_ == graph)
+      adjacency_map_cache_[link_names] = adjacency_map;
   }
 
   return adjacency_map;
@@ -855,6 +1240,74 @@ void SceneGraph::saveDOT(const std::string& path) const
 
 ShortestPath SceneGraph::getShortestPath(const std::string& root, const std::string& tip) const
 {
+  CompiledSceneGraph::ConstPtr compiled = getCompiledSceneGraph();
+  const tesseract_common::LinkNamesPair key(root, tip);
+  {
+    std::lock_guard<std::mutex> lock(compiled_mutex_);
+    auto it = shortest_path_cache_.find(key);
+    if (it != shortest_path_cache_.end())
+      return it->second;
+  }
+
+  ShortestPath path = getShortestPathHelper(*compiled, root, tip);
+
+  std::lock_guard<std::mutex> lock(compiled_mutex_);
+  if (compiled_ == compiled)
+    shortest_path_cache_[key] = path;
+
+  return path;
+}
+
+ShortestPath SceneGraph::getShortestPathHelper(const CompiledSceneGraph& compiled,
+                                               const std::string& root,
+                                               const std::string& tip) const
+{
+  // In a forest the path is unique, so it is found by walking up from the tip until reaching an ancestor of the root
+  if (compiled.isForest())
+  {
+    const int root_index = compiled.getLinkIndex(root);
+    const int tip_index = compiled.getLinkIndex(tip);
+    if (root_index < 0)
+      throw std::runtime_error("SceneGraph, vertex with name '" + root + "' does not exist!");
+
+    if (tip_index < 0)
+      throw std::runtime_error("SceneGraph, vertex with name '" + tip + "' does not exist!");
+
+    ShortestPath path;
+    int common_index = tip_index;
+    while (!compiled.isInSubtree(common_index, root_index))
+    {
+      const int joint_index = compiled.getParentJoint(common_index);
+      if (joint_index < 0)
+      {
+        // The links are not connected
+        path.links.push_back(root);
+        return path;
+      }
+      common_index = compiled.getJointParentLink(joint_index);
+    }
+
+    for (int l = root_index; l != common_index; l = compiled.getJointParentLink(compiled.getParentJoint(l)))
+    {
+      path.links.push_back(compiled.getLinkNames()[static_cast<std::size_t>(l)]);
+      appendPathJoint(path, compiled, l);
+    }
+    path.links.push_back(compiled.getLinkNames()[static_cast<std::size_t>(common_index)]);
+
+    const auto links_begin = static_cast<long>(path.links.size());
+    const auto joints_begin = static_cast<long>(path.joints.size());
+    const auto active_joints_begin = static_cast<long>(path.active_joints.size());
+    for (int l = tip_index; l != common_index; l = compiled.getJointParentLink(compiled.getParentJoint(l)))
+    {
+      path.links.push_back(compiled.getLinkNames()[static_cast<std::size_t>(l)]);
+      appendPathJoint(path, compiled, l);
+    }
+    std::reverse(path.links.begin() + links_begin, path.links.end());
+    std::reverse(path.joints.begin() + joints_begin, path.joints.end());
+    std::reverse(path.active_joints.begin() + active_joints_begin, path.active_joints.end());
+    return path;
+  }
+
   // Must copy to undirected graph because order does not matter for creating kinematics chains.
 
   // Copy Graph
@@ -954,6 +1407,69 @@ ShortestPath SceneGraph::getShortestPath(const std::string& root, const std::str
   return path;
 }
 
+CompiledSceneGraph::ConstPtr SceneGraph::getCompiledSceneGraph() const
+{
+  std::lock_guard<std::mutex> lock(compiled_mutex_);
+  if (compiled_ == nullptr)
+    compiled_ = std::make_shared<const CompiledSceneGraph>(static_cast<const Graph&>(*this));
+
+  return compiled_;
+}
+
+void SceneGraph::shareJoints() const
+{
+  std::lock_guard<std::mutex> lock(shared_joints_mutex_);
+  for (const auto& joint : joint_map_)
+    shared_joints_.insert(joint.first);
+}
+
+void SceneGraph::unshareJoint(std::pair<Joint::Ptr, Edge>& entry)
+{
+  {
+    std::lock_guard<std::mutex> lock(shared_joints_mutex_);
+    if (shared_joints_.erase(entry.first->getName()) == 0)
+      return;
+  }
+
+  entry.first = std::make_shared<Joint>(entry.first->clone());
+  boost::put(boost::edge_joint, static_cast<Graph&>(*this), entry.second, entry.first);
+
+  // The compiled structure references the shared joint
+  clearCompiledSceneGraph();
+}
+
+void SceneGraph::clearCompiledSceneGraph()
+{
+  std::lock_guard<std::mutex> lock(compiled_mutex_);
+  compiled_ = nullptr;
+  kdl_tree_data_ = nullptr;
+  shortest_path_cache_.clear();
+  link_children_cache_.clear();
+  adjacency_map_cache_.clear();
+}
+
+std::vector<std::string> SceneGraph::getLinkChildrenHelper(const CompiledSceneGraph::ConstPtr& compiled,
+                                                           int link_index) const
+{
+  const std::string& link_name = compiled->getLinkNames()[static_cast<std::size_t>(link_index)];
+  {
+    std::lock_guard<std::mutex> lock(compiled_mutex_);
+    auto it = link_children_cache_.find(link_name);
+    if (it != link_children_cache_.end())
+      return it->second;
+  }
+
+  std::vector<std::string> link_names;
+  std::vector<char> visited(compiled->getLinkNames().size(), 0);
+  appendLinkChildren(link_names, visited, *compiled, link_index);
+
+  std::lock_guard<std::mutex> lock(compiled_mutex_);
+  if (compiled_ == compiled)
+    link_children_cache_[link_name] = link_names;
+
+  return link_names;
+}
+
 SceneGraph::Vertex SceneGraph::getVertex(const std::string& name) const
 {
   auto found = link_map_.find(name);
@@ -975,9 +1491,17 @@ SceneGraph::Edge SceneGraph::getEdge(const std::string& name) const
 /** addSceneGraph needs a couple helpers to handle prefixing, we hide them in an anonymous namespace here **/
 namespace
 {
-tesseract_scene_graph::Link clone_prefix(const tesseract_scene_graph::Link::ConstPtr& link, const std::string& prefix)
+tesseract_scene_graph::Link::Ptr clone_prefix(const tesseract_scene_graph::Link::Ptr& link, const std::string& prefix)
 {
-  return link->clone(prefix + link->getName());
+  if (prefix.empty())
+    return link;
+
+  // Links are never changed in place, so the renamed link shares the elements
+  auto new_link = std::make_shared<tesseract_scene_graph::Link>(prefix + link->getName());
+  new_link->inertial = link->inertial;
+  new_link->visual = link->visual;
+  new_link->collision = link->collision;
+  return new_link;
 }
 
 tesseract_scene_graph::Joint clone_prefix(const tesseract_scene_graph::Joint::ConstPtr& joint,
@@ -1029,9 +1553,10 @@ bool SceneGraph::insertSceneGraph(const tesseract_scene_graph::SceneGraph& scene
     }
   }
 
-  for (const auto& link : scene_graph.getLinks())
+  for (const auto& entry : scene_graph.link_map_)
   {
-    auto new_link = std::make_shared<Link>(clone_prefix(link, prefix));
+    const Link::Ptr& link = entry.second.first;
+    auto new_link = clone_prefix(link, prefix);
     bool res = addLinkHelper(new_link);
     if (!res)
     {
@@ -1044,15 +1569,29 @@ bool SceneGraph::insertSceneGraph(const tesseract_scene_graph::SceneGraph& scene
     setLinkVisibility(new_link->getName(), scene_graph.getLinkVisibility(link->getName()));
   }
 
-  for (const auto& joint : scene_graph.getJoints())
+  for (const auto& entry : scene_graph.joint_map_)
   {
-    auto new_joint = std::make_shared<Joint>(clone_prefix(joint, prefix));
+    const Joint::Ptr& joint = entry.second.first;
+
+    // Without a prefix the joint is shared like a clone, unless it is changed when added
+    const bool share = (prefix.empty() && !requiresLimitsUpdate(*joint));
+    auto new_joint = share ? joint : std::make_shared<Joint>(clone_prefix(joint, prefix));
     bool res = addJointHelper(new_joint);
     if (!res)
     {
       CONSOLE_BRIDGE_logError("Failed to add inserted graph joint: %s", joint->getName().c_str());
       return false;
     }
+
+    if (share)
+    {
+      {
+        std::lock_guard<std::mutex> lock(scene_graph.shared_joints_mutex_);
+        scene_graph.shared_joints_.insert(joint->getName());
+      }
+      std::lock_guard<std::mutex> lock(shared_joints_mutex_);
+      shared_joints_.insert(joint->getName());
+    }
   }
 
   acm_->insertAllowedCollisionMatrix(*clone_prefix(scene_graph.getAllowedCollisionMatrix(), prefix));
@@ -1098,6 +1637,7 @@ void SceneGraph::rebuildLinkAndJointMaps()
 {
   link_map_.clear();
   joint_map_.clear();
+  clearCompiledSceneGraph();
 
   {  // Rebuild link map
     Graph::vertex_iterator i, iend;
@@ -34,6 +34,11 @@
 
 /* Author: Wim Meeussen & Levi Armstrong */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_scene_graph/kdl_parser.h>
 
 namespace tesseract_scene_graph
@@ -208,15 +213,19 @@ struct kdl_tree_builder : public boost::dfs_visitor<>
     {
       data_.active_joint_names.push_back(parent_joint->getName());
       data_.active_link_names.push_back(link->getName());
+      active_links_.insert(link->getName());
     }
     else
     {
-      auto it =
-          std::find(data_.active_link_names.begin(), data_.active_link_names.end(), parent_joint->parent_link_name);
-      if (it != data_.active_link_names.end())
+      if (active_links_.find(parent_joint->parent_link_name) != active_links_.end())
+      {
         data_.active_link_names.push_back(link->getName());
+        active_links_.insert(link->getName());
+      }
       else
+      {
         data_.static_link_names.push_back(link->getName());
+      }
     }
 
     // construct the kdl segment
@@ -228,6 +237,9 @@ struct kdl_tree_builder : public boost::dfs_visitor<>
 
 protected:
   KDLTreeData& data_;
+
+  /** @brief The active link names, so a link is found without searching the vector */
+  std::unordered_set<std::string> active_links_;
 };
 
 /**
@@ -239,7 +251,7 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
   kdl_sub_tree_builder(KDLTreeData& data,
                        const std::vector<std::string>& joint_names,
                        const std::unordered_map<std::string, double>& joint_values)
-    : data_(data), joint_names_(joint_names), joint_values_(joint_values)
+    : data_(data), joint_names_(joint_names.begin(), joint_names.end()), joint_values_(joint_values)
   {
   }
 
@@ -277,7 +289,7 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
     boost::tie(ei, ei_end) = boost::in_edges(vertex, graph);
     SceneGraph::Edge e = *ei;
     const Joint::ConstPtr& parent_joint = boost::get(boost::edge_joint, graph)[e];
-    bool found = (std::find(joint_names_.begin(), joint_names_.end(), parent_joint->getName()) != joint_names_.end());
+    bool found = (joint_names_.find(parent_joint->getName()) != joint_names_.end());
     KDL::Joint kdl_jnt = convert(parent_joint);
     KDL::Frame parent_to_joint = convert(parent_joint->parent_to_joint_origin_transform);
     KDL::Segment kdl_sgm(link->getName(), kdl_jnt, parent_to_joint, inert);
@@ -303,8 +315,9 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
                                               KDL::RigidBodyInertia(0));
         data_.tree.addSegment(world_sgm, data_.base_link_name);
       }
-      link_names_.push_back(parent_link_name);
-      link_names_.push_back(link->getName());
+      link_names_.insert(parent_link_name);
+      link_names_.insert(link->getName());
+      active_links_.insert(link->getName());
       data_.static_link_names.push_back(parent_link_name);
       data_.link_names.push_back(parent_link_name);
       data_.link_names.push_back(link->getName());
@@ -319,7 +332,7 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
     }
     else if (started_)
     {
-      auto it = std::find(link_names_.begin(), link_names_.end(), parent_link_name);
+      auto it = link_names_.find(parent_link_name);
 
       if (it == link_names_.end() && !found)
         return;
@@ -327,7 +340,7 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
       if (it == link_names_.end() && found)
       {
         data_.link_names.push_back(parent_link_name);
-        link_names_.push_back(parent_link_name);
+        link_names_.insert(parent_link_name);
         data_.static_link_names.push_back(parent_link_name);
 
         KDL::Frame new_tree_parent_to_joint =
@@ -354,11 +367,13 @@ struct kdl_sub_tree_builder : public boost::dfs_visitor<>
       }
 
       data_.link_names.push_back(link->getName());
-      link_names_.push_back(link->getName());
+      link_names_.insert(link->getName());
 
-      auto active_it = std::find(data_.active_link_names.begin(), data_.active_link_names.end(), parent_link_name);
-      if (active_it != data_.active_link_names.end() || kdl_jnt.getType() != KDL::Joint::None)
+      if (active_links_.find(parent_link_name) != active_links_.end() || kdl_jnt.getType() != KDL::Joint::None)
+      {
         data_.active_link_names.push_back(link->getName());
+        active_links_.insert(link->getName());
+      }
       else
         data_.static_link_names.push_back(link->getName());
 
@@ -378,9 +393,12 @@ protected:
   int search_cnt_{ -1 };
   bool started_{ false };
   std::map<std::string, KDL::Frame> segment_transforms_;
-  std::vector<std::string> link_names_;
+  std::unordered_set<std::string> link_names_;
+
+  /** @brief The active link names, so a link is found without searching the vector */
+  std::unordered_set<std::string> active_links_;
 
-  const std::vector<std::string>& joint_names_;
+  const std::unordered_set<std::string> joint_names_;
   const std::unordered_map<std::string, double>& joint_values_;
 };
 
@@ -424,6 +442,25 @@ KDLTreeData parseSceneGraph(const SceneGraph& scene_graph)
   return data;
 }
 
+KDLTreeData::ConstPtr getKDLTreeData(const SceneGraph& scene_graph)
+{
+  // The compiled structure is replaced whenever the cached tree is cleared, so it identifies the revision
+  CompiledSceneGraph::ConstPtr compiled = scene_graph.getCompiledSceneGraph();
+  {
+    std::lock_guard<std::mutex> lock(scene_graph.compiled_mutex_);
+    if (scene_graph.kdl_tree_data_ != nullptr)
+      return scene_graph.kdl_tree_data_;
+  }
+
+  auto data = std::make_shared<const KDLTreeData>(parseSceneGraph(scene_graph));
+
+  std::lock_guard<std::mutex> lock(scene_graph.compiled_mutex_);
+  if (scene_graph.compiled_ == compiled)
+    scene_graph.kdl_tree_data_ = data;
+
+  return data;
+}
+
 KDLTreeData parseSceneGraph(const SceneGraph& scene_graph,
                             const std::vector<std::string>& joint_names,
                             const std::unordered_map<std::string, double>& joint_values)
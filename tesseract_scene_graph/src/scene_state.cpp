@@ -31,10 +31,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
+#include <boost/serialization/array.hpp>
 #include <boost/serialization/map.hpp>
 #include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
 #include <boost/serialization/unordered_map.hpp>
+#include <boost/serialization/vector.hpp>
 #include <memory>
+#include <type_traits>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/eigen_serialization.h>
@@ -69,9 +73,99 @@ bool SceneState::operator==(const SceneState& rhs) const
 }
 bool SceneState::operator!=(const SceneState& rhs) const { return !operator==(rhs); }
 
+namespace
+{
+/** @brief Save the joint values as a list of names and a contiguous array of values */
+void saveCompactJoints(boost::archive::binary_oarchive& ar, const std::unordered_map<std::string, double>& joints)
+{
+  std::vector<std::string> names;
+  std::vector<double> values;
+  names.reserve(joints.size());
+  values.reserve(joints.size());
+  for (const auto& joint : joints)
+  {
+    names.push_back(joint.first);
+    values.push_back(joint.second);
+  }
+
+  ar& boost::serialization::make_nvp("names", names);
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), values.size()));
+}
+
+/** @brief Load the joint values saved with saveCompactJoints */
+void loadCompactJoints(boost::archive::binary_iarchive& ar, std::unordered_map<std::string, double>& joints)
+{
+  std::vector<std::string> names;
+  ar& boost::serialization::make_nvp("names", names);
+  std::vector<double> values(names.size());
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), values.size()));
+
+  joints.clear();
+  joints.reserve(names.size());
+  for (std::size_t i = 0; i < names.size(); ++i)
+    joints.emplace(std::move(names[i]), values[i]);
+}
+
+/** @brief Save the transforms as a list of names and a contiguous array of their 3x4 matrices */
+void saveCompactTransforms(boost::archive::binary_oarchive& ar, const tesseract_common::TransformMap& transforms)
+{
+  std::vector<std::string> names;
+  std::vector<double> values(12 * transforms.size());
+  names.reserve(transforms.size());
+  std::size_t i{ 0 };
+  for (const auto& transform : transforms)
+  {
+    names.push_back(transform.first);
+    Eigen::Map<Eigen::Matrix<double, 3, 4>>(values.data() + (12 * i++)) = transform.second.affine();
+  }
+
+  ar& boost::serialization::make_nvp("names", names);
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), values.size()));
+}
+
+/** @brief Load the transforms saved with saveCompactTransforms */
+void loadCompactTransforms(boost::archive::binary_iarchive& ar, tesseract_common::TransformMap& transforms)
+{
+  std::vector<std::string> names;
+  ar& boost::serialization::make_nvp("names", names);
+  std::vector<double> values(12 * names.size());
+  ar& boost::serialization::make_nvp("values", boost::serialization::make_array(values.data(), values.size()));
+
+  transforms.clear();
+  for (std::size_t i = 0; i < names.size(); ++i)
+  {
+    Eigen::Isometry3d transform;
+    transform.affine() = Eigen::Map<const Eigen::Matrix<double, 3, 4>>(values.data() + (12 * i));
+    transform.makeAffine();
+    // The names were saved in order
+    transforms.emplace_hint(transforms.end(), std::move(names[i]), transform);
+  }
+}
+}  // namespace
+
 template <class Archive>
-void SceneState::serialize(Archive& ar, const unsigned int /*version*/)
+void SceneState::serialize(Archive& ar, const unsigned int version)
 {
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_oarchive>)
+  {
+    // Binary archives are used for logging and IPC, so the values are stored as contiguous arrays
+    saveCompactJoints(ar, joints);
+    saveCompactTransforms(ar, link_transforms);
+    saveCompactTransforms(ar, joint_transforms);
+    return;
+  }
+
+  if constexpr (std::is_same_v<Archive, boost::archive::binary_iarchive>)
+  {
+    if (version > 0)
+    {
+      loadCompactJoints(ar, joints);
+      loadCompactTransforms(ar, link_transforms);
+      loadCompactTransforms(ar, joint_transforms);
+      return;
+    }
+  }
+
   ar& BOOST_SERIALIZATION_NVP(joints);
   ar& BOOST_SERIALIZATION_NVP(link_transforms);
   ar& BOOST_SERIALIZATION_NVP(joint_transforms);
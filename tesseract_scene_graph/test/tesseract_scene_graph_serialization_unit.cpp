@@ -229,6 +229,12 @@ TEST(TesseractSceneGraphSerializationUnit, SceneState)  // NOLINT
   object->joint_transforms["joint_transforms_key"].setIdentity();
   object->joint_transforms["joint_transforms_key"].translate(Eigen::Vector3d(5, 6, 7));
   tesseract_common::testSerialization<SceneState>(*object, "SceneState");
+
+  object->link_transforms["rotated_link"] =
+      Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitZ());
+  object->joint_transforms.clear();
+  tesseract_common::testSerialization<SceneState>(*object, "SceneStateRotated");
+  tesseract_common::testSerialization<SceneState>(SceneState(), "EmptySceneState");
 }
 
 int main(int argc, char** argv)
@@ -289,6 +289,194 @@ TEST(TesseractSceneGraphUnit, TesseractSceneGraphUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSceneGraphUnit, TesseractSceneGraphCompiledUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  SceneGraph g = createTestSceneGraph();
+
+  CompiledSceneGraph::ConstPtr compiled = g.getCompiledSceneGraph();
+  EXPECT_EQ(compiled, g.getCompiledSceneGraph());
+  EXPECT_EQ(compiled->getLinkNames().size(), 5);
+  EXPECT_EQ(compiled->getJointNames().size(), 4);
+  EXPECT_EQ(compiled->getLinkIndex("missing"), -1);
+  EXPECT_EQ(compiled->getJointIndex("missing"), -1);
+  EXPECT_TRUE(compiled->isForest());
+
+  const int link_1 = compiled->getLinkIndex("link_1");
+  const int link_2 = compiled->getLinkIndex("link_2");
+  const int link_3 = compiled->getLinkIndex("link_3");
+  const int link_4 = compiled->getLinkIndex("link_4");
+  const int link_5 = compiled->getLinkIndex("link_5");
+  const int joint_4 = compiled->getJointIndex("joint_4");
+  EXPECT_EQ(compiled->getJointParentLink(joint_4), link_2);
+  EXPECT_EQ(compiled->getJointChildLink(joint_4), link_5);
+  EXPECT_EQ(compiled->getParentJoint(link_5), joint_4);
+  EXPECT_EQ(compiled->getParentJoint(link_1), -1);
+
+  auto outbound = compiled->getOutboundJoints(link_2);
+  EXPECT_EQ(outbound.second - outbound.first, 2);
+  auto inbound = compiled->getInboundJoints(link_5);
+  ASSERT_EQ(inbound.second - inbound.first, 1);
+  EXPECT_EQ(*inbound.first, joint_4);
+
+  auto subtree = compiled->getSubtree(link_2);
+  EXPECT_EQ(subtree.second - subtree.first, 4);
+  EXPECT_TRUE(compiled->isInSubtree(link_2, link_4));
+  EXPECT_TRUE(compiled->isInSubtree(link_2, link_2));
+  EXPECT_FALSE(compiled->isInSubtree(link_3, link_5));
+  EXPECT_FALSE(compiled->isInSubtree(link_2, link_1));
+
+  {  // The path between two branches of the tree
+    ShortestPath path = g.getShortestPath("link_4", "link_5");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_4", "link_3", "link_2", "link_5" }));
+    EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_3", "joint_2", "joint_4" }));
+    EXPECT_EQ(path.active_joints, std::vector<std::string>({ "joint_2", "joint_4" }));
+  }
+
+  {
+    ShortestPath path = g.getShortestPath("link_1", "link_4");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_1", "link_2", "link_3", "link_4" }));
+    EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_1", "joint_2", "joint_3" }));
+  }
+
+  {
+    ShortestPath path = g.getShortestPath("link_3", "link_3");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_3" }));
+    EXPECT_TRUE(path.joints.empty());
+  }
+
+  EXPECT_ANY_THROW(g.getShortestPath("link_1", "missing"));       // NOLINT
+  EXPECT_ANY_THROW(g.getLinkChildrenNames("missing"));           // NOLINT
+  EXPECT_ANY_THROW(g.getJointChildrenNames("missing"));          // NOLINT
+  EXPECT_ANY_THROW(g.getAdjacencyMap({ "link_1", "missing" }));  // NOLINT
+
+  // A link which is not connected is a root of the forest
+  EXPECT_TRUE(g.addLink(Link("link_6")));
+  CompiledSceneGraph::ConstPtr changed = g.getCompiledSceneGraph();
+  EXPECT_NE(compiled, changed);
+  EXPECT_EQ(compiled->getLinkNames().size(), 5);
+  EXPECT_EQ(changed->getLinkNames().size(), 6);
+  EXPECT_TRUE(changed->isForest());
+
+  {
+    ShortestPath path = g.getShortestPath("link_1", "link_6");
+    EXPECT_EQ(path.links, std::vector<std::string>({ "link_1" }));
+    EXPECT_TRUE(path.joints.empty());
+  }
+
+  // A link with two inbound joints is not a forest
+  Joint joint_5("joint_5");
+  joint_5.parent_link_name = "link_5";
+  joint_5.child_link_name = "link_4";
+  joint_5.type = JointType::FIXED;
+  EXPECT_TRUE(g.addJoint(joint_5));
+  changed = g.getCompiledSceneGraph();
+  EXPECT_FALSE(changed->isForest());
+  EXPECT_TRUE(changed->getTour().empty());
+  EXPECT_EQ(changed->getParentJoint(changed->getLinkIndex("link_4")), -1);
+
+  std::vector<std::string> child_link_names =
+      g.getJointChildrenNames(std::vector<std::string>({ "joint_2", "joint_4" }));
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_3", "link_4", "link_5" }));
+
+  EXPECT_TRUE(g.removeJoint("joint_5"));
+  EXPECT_TRUE(g.getCompiledSceneGraph()->isForest());
+}
+
+TEST(TesseractSceneGraphUnit, TesseractSceneGraphQueryCacheUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  SceneGraph g = createTestSceneGraph();
+
+  // The cached results are the same as the first results
+  ShortestPath path = g.getShortestPath("link_4", "link_5");
+  EXPECT_EQ(path.links, std::vector<std::string>({ "link_4", "link_3", "link_2", "link_5" }));
+  EXPECT_EQ(g.getShortestPath("link_4", "link_5").links, path.links);
+  EXPECT_EQ(g.getShortestPath("link_4", "link_5").joints, path.joints);
+
+  std::vector<std::string> child_link_names = g.getLinkChildrenNames("link_2");
+  EXPECT_EQ(child_link_names.size(), 3);
+  EXPECT_EQ(g.getLinkChildrenNames("link_2"), child_link_names);
+  EXPECT_EQ(g.getJointChildrenNames("joint_1").size(), 4);
+
+  std::unordered_map<std::string, std::string> adj_map = g.getAdjacencyMap({ "link_2", "link_3" });
+  EXPECT_EQ(adj_map.size(), 4);
+  EXPECT_EQ(g.getAdjacencyMap({ "link_2", "link_3" }), adj_map);
+
+  // The cached results are cleared when the structure changes
+  EXPECT_TRUE(g.moveJoint("joint_4", "link_1"));
+
+  path = g.getShortestPath("link_4", "link_5");
+  EXPECT_EQ(path.links, std::vector<std::string>({ "link_4", "link_3", "link_2", "link_1", "link_5" }));
+  EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_3", "joint_2", "joint_1", "joint_4" }));
+
+  child_link_names = g.getLinkChildrenNames("link_2");
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_3", "link_4" }));
+
+  adj_map = g.getAdjacencyMap({ "link_2", "link_3" });
+  EXPECT_EQ(adj_map.size(), 3);
+  EXPECT_TRUE(adj_map.find("link_5") == adj_map.end());
+
+  g.clear();
+  EXPECT_ANY_THROW(g.getShortestPath("link_4", "link_5"));  // NOLINT
+  EXPECT_ANY_THROW(g.getLinkChildrenNames("link_2"));       // NOLINT
+}
+
+TEST(TesseractSceneGraphUnit, TesseractSceneGraphCloneSharingUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  SceneGraph g = createTestSceneGraph();
+  g.setLinkVisibility("link_3", false);
+
+  // The links and joints are shared with the clone
+  SceneGraph::Ptr g_clone = g.clone();
+  EXPECT_TRUE(*g_clone == g);
+  EXPECT_FALSE(g_clone->getLinkVisibility("link_3"));
+  EXPECT_EQ(g_clone->getLink("link_2"), g.getLink("link_2"));
+  EXPECT_EQ(g_clone->getJoint("joint_4"), g.getJoint("joint_4"));
+
+  // A shared joint is copied before it is changed
+  Eigen::Isometry3d origin = g.getJoint("joint_4")->parent_to_joint_origin_transform;
+  origin.translation().x() += 5;
+  EXPECT_TRUE(g_clone->changeJointOrigin("joint_4", origin));
+  EXPECT_NE(g_clone->getJoint("joint_4"), g.getJoint("joint_4"));
+  EXPECT_TRUE(g_clone->getJoint("joint_4")->parent_to_joint_origin_transform.isApprox(origin));
+  EXPECT_FALSE(g.getJoint("joint_4")->parent_to_joint_origin_transform.isApprox(origin));
+
+  // The original copies the joint it shares with the clone
+  Joint::ConstPtr joint_2 = g_clone->getJoint("joint_2");
+  EXPECT_TRUE(g.changeJointPositionLimits("joint_2", -0.5, 0.5));
+  EXPECT_DOUBLE_EQ(g.getJoint("joint_2")->limits->lower, -0.5);
+  EXPECT_DOUBLE_EQ(joint_2->limits->lower, -1);
+  EXPECT_EQ(g_clone->getJoint("joint_2"), joint_2);
+
+  // A joint which is not shared is changed in place
+  Joint::ConstPtr joint_4 = g_clone->getJoint("joint_4");
+  EXPECT_TRUE(g_clone->changeJointVelocityLimits("joint_4", 10));
+  EXPECT_EQ(g_clone->getJoint("joint_4"), joint_4);
+  EXPECT_DOUBLE_EQ(joint_4->limits->velocity, 10);
+
+  EXPECT_TRUE(g_clone->moveJoint("joint_2", "link_1"));
+  EXPECT_EQ(g.getJoint("joint_2")->parent_link_name, "link_2");
+  EXPECT_EQ(g_clone->getJoint("joint_2")->parent_link_name, "link_1");
+
+  // Inserting without a prefix shares the links and joints, with a prefix the link elements are shared
+  SceneGraph::Ptr g_insert = g.clone();
+  g_insert->clear();
+  EXPECT_TRUE(g_insert->insertSceneGraph(g));
+  EXPECT_EQ(g_insert->getLink("link_2"), g.getLink("link_2"));
+  EXPECT_EQ(g_insert->getJoint("joint_1"), g.getJoint("joint_1"));
+  EXPECT_TRUE(g_insert->changeJointLimits("joint_4", JointLimits(-2, 2, 0, 2, 3)));
+  EXPECT_DOUBLE_EQ(g.getJoint("joint_4")->limits->lower, -1);
+
+  auto link_1 = std::make_shared<Link>("box_link");
+  link_1->collision.push_back(std::make_shared<Collision>());
+  SceneGraph sub_graph;
+  EXPECT_TRUE(sub_graph.addLink(*link_1));
+  EXPECT_TRUE(g_insert->insertSceneGraph(sub_graph, "prefix_"));
+  EXPECT_EQ(g_insert->getLink("prefix_box_link")->collision.front(), sub_graph.getLink("box_link")->collision.front());
+}
+
 TEST(TesseractSceneGraphUnit, TesseractSceneGraphClearUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
@@ -1189,6 +1377,54 @@ TEST(TesseractSceneGraphUnit, LoadKDLUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSceneGraphUnit, LoadKDLCacheUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  SceneGraph g = buildTestSceneGraph();
+
+  KDLTreeData::ConstPtr data = getKDLTreeData(g);
+  ASSERT_TRUE(data != nullptr);
+  EXPECT_EQ(getKDLTreeData(g), data);
+
+  KDLTreeData parsed = parseSceneGraph(g);
+  EXPECT_EQ(data->link_names, parsed.link_names);
+  EXPECT_EQ(data->active_joint_names, parsed.active_joint_names);
+  EXPECT_EQ(data->tree.getNrOfSegments(), parsed.tree.getNrOfSegments());
+  testSceneGraphKDLTree(data->tree);
+
+  // Changing the limits does not change the tree
+  EXPECT_TRUE(g.changeJointVelocityLimits("joint_1", 2.0));
+  EXPECT_EQ(getKDLTreeData(g), data);
+
+  // Changing a joint origin converts the tree again
+  Eigen::Isometry3d origin = g.getJoint("joint_1")->parent_to_joint_origin_transform;
+  origin.translation()(0) += 1.0;
+  EXPECT_TRUE(g.changeJointOrigin("joint_1", origin));
+  KDLTreeData::ConstPtr changed_data = getKDLTreeData(g);
+  EXPECT_NE(changed_data, data);
+  EXPECT_EQ(getKDLTreeData(g), changed_data);
+  const KDL::Segment& segment = GetTreeElementSegment(changed_data->tree.getSegment("link_2")->second);
+  EXPECT_NEAR(segment.getFrameToTip().p.x(), origin.translation()(0), 1e-6);
+
+  // Changing the structure converts the tree again and the previous data is not changed
+  Link link("link_6");
+  Joint joint("joint_6");
+  joint.parent_link_name = "link_5";
+  joint.child_link_name = "link_6";
+  joint.type = JointType::FIXED;
+  EXPECT_TRUE(g.addLink(link, joint));
+  KDLTreeData::ConstPtr added_data = getKDLTreeData(g);
+  EXPECT_NE(added_data, changed_data);
+  EXPECT_EQ(added_data->link_names.size(), changed_data->link_names.size() + 1);
+
+  // The clone has its own cache
+  SceneGraph::Ptr g_clone = g.clone();
+  KDLTreeData::ConstPtr clone_data = getKDLTreeData(*g_clone);
+  EXPECT_NE(clone_data, added_data);
+  EXPECT_EQ(clone_data->link_names.size(), added_data->link_names.size());
+  EXPECT_EQ(getKDLTreeData(g), added_data);
+}
+
 TEST(TesseractSceneGraphUnit, LoadSubKDLUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
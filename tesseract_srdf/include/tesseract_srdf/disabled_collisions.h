@@ -30,6 +30,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <array>
+#include <cstdint>
+#include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tinyxml2
@@ -58,6 +60,40 @@ tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract
                                                                  const tinyxml2::XMLElement* srdf_xml,
                                                                  const std::array<int, 3>& version);
 
+/**
+ * @brief Get the key of a disabled collisions cache file
+ * @details The allowed collision matrix depends on the srdf and on the links of the scene graph, because pairs of
+ * unknown links are skipped, so both are part of the key.
+ * @param scene_graph The tesseract scene graph
+ * @param srdf_xml_string The srdf xml string
+ * @return The key
+ */
+uint64_t getDisabledCollisionsCacheKey(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                       const std::string& srdf_xml_string);
+
+/**
+ * @brief Save an allowed collision matrix to a binary disabled collisions cache file
+ * @details The link names and reasons are stored once in a string table and the pairs refer to them by index.
+ * @param file_path The cache file path
+ * @param acm The allowed collision matrix
+ * @param key The key of the cache file, see getDisabledCollisionsCacheKey
+ * @return True if the file was written, otherwise false
+ */
+bool saveDisabledCollisionsCache(const std::string& file_path,
+                                 const tesseract_common::AllowedCollisionMatrix& acm,
+                                 uint64_t key);
+
+/**
+ * @brief Load an allowed collision matrix from a binary disabled collisions cache file
+ * @param file_path The cache file path
+ * @param key The expected key of the cache file, see getDisabledCollisionsCacheKey
+ * @param acm The allowed collision matrix, only modified on success
+ * @return True if the file exists, matches the key and is valid, otherwise false
+ */
+bool loadDisabledCollisionsCache(const std::string& file_path,
+                                 uint64_t key,
+                                 tesseract_common::AllowedCollisionMatrix& acm);
+
 }  // namespace tesseract_srdf
 
 #endif  // TESSERACT_SRDF_DISABLED_COLLISIONS_H
@@ -68,6 +68,9 @@ public:
 
   /**
    * @brief Load Model given a filename
+   * @details If the TESSERACT_SRDF_ACM_CACHE environment variable is set to a value other than 0, the allowed
+   * collision matrix is stored in a binary sidecar file next to the srdf file (filename + ".acm") and loaded from it
+   * instead of being parsed as long as neither the srdf nor the links of the scene graph changed.
    * @throws std::nested_exception if an error occurs during parsing srdf
    */
   void initFile(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -113,6 +116,16 @@ public:
   bool operator!=(const SRDFModel& rhs) const;
 
 private:
+  /**
+   * @brief Load Model from a XML-string
+   * @param parse_disabled_collisions If false the allowed collision matrix is left empty
+   * @throws std::nested_exception if an error occurs during parsing srdf
+   */
+  void initString(const tesseract_scene_graph::SceneGraph& scene_graph,
+                  const std::string& xmlstring,
+                  const tesseract_common::ResourceLocator& locator,
+                  bool parse_disabled_collisions);
+
   friend class boost::serialization::access;
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
@@ -27,6 +27,11 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <tinyxml2.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -37,6 +42,53 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_srdf
 {
+namespace
+{
+/**
+ * @brief Parse a config file, reusing the result of an earlier parse while the file is unchanged
+ * @details Every environment created from the same SRDF parses the same plugin configs, so the parsed configs are
+ * cached process wide. An entry is reused while the size and the modification time of the file are unchanged. The
+ * YAML nodes of the plugin configs are shared with the cache and must not be modified.
+ * @param file_path The config file path
+ * @param parse The function loading and parsing the file
+ * @return The parsed config
+ */
+template <typename T>
+T parseCachedConfigFile(const tesseract_common::fs::path& file_path,
+                        const std::function<T(const tesseract_common::fs::path&)>& parse)
+{
+  struct Entry
+  {
+    std::time_t write_time;
+    std::uintmax_t size;
+    T config;
+  };
+
+  static std::mutex mutex;
+  static std::map<std::string, Entry> cache;
+
+  boost::system::error_code ec;
+  const std::time_t write_time = tesseract_common::fs::last_write_time(file_path, ec);
+  const std::uintmax_t size = (ec) ? 0 : tesseract_common::fs::file_size(file_path, ec);
+  if (ec)
+    return parse(file_path);
+
+  const std::string key = file_path.string();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(key);
+    if (it != cache.end() && it->second.write_time == write_time && it->second.size == size)
+      return it->second.config;
+  }
+
+  T config = parse(file_path);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  cache[key] = Entry{ write_time, size, config };
+  return config;
+}
+}  // namespace
+
 tesseract_common::fs::path parseConfigFilePath(const tesseract_common::ResourceLocator& locator,
                                                const tinyxml2::XMLElement* xml_element,
                                                const std::array<int, 3>& /*version*/)
@@ -67,22 +119,25 @@ tesseract_common::CalibrationInfo parseCalibrationConfig(const tesseract_scene_g
                                                          const std::array<int, 3>& version)
 {
   tesseract_common::fs::path cal_config_file_path = parseConfigFilePath(locator, xml_element, version);
-  YAML::Node config;
-  try
-  {
-    config = YAML::LoadFile(cal_config_file_path.string());
-  }
-  // LCOV_EXCL_START
-  catch (...)
-  {
-    std::throw_with_nested(std::runtime_error("calibration_config: YAML failed to parse calibration config "
-                                              "file '" +
-                                              cal_config_file_path.string() + "'."));
-  }
-  // LCOV_EXCL_STOP
+  auto info = parseCachedConfigFile<tesseract_common::CalibrationInfo>(
+      cal_config_file_path, [](const tesseract_common::fs::path& file_path) {
+        YAML::Node config;
+        try
+        {
+          config = YAML::LoadFile(file_path.string());
+        }
+        // LCOV_EXCL_START
+        catch (...)
+        {
+          std::throw_with_nested(std::runtime_error("calibration_config: YAML failed to parse calibration config "
+                                                    "file '" +
+                                                    file_path.string() + "'."));
+        }
+        // LCOV_EXCL_STOP
 
-  const YAML::Node& cal_info = config[tesseract_common::CalibrationInfo::CONFIG_KEY];
-  auto info = cal_info.as<tesseract_common::CalibrationInfo>();
+        const YAML::Node& cal_info = config[tesseract_common::CalibrationInfo::CONFIG_KEY];
+        return cal_info.as<tesseract_common::CalibrationInfo>();
+      });
 
   // Check to make sure calibration joints exist
   for (const auto& cal_joint : info.joints)
@@ -99,23 +154,25 @@ tesseract_common::KinematicsPluginInfo parseKinematicsPluginConfig(const tessera
                                                                    const std::array<int, 3>& version)
 {
   tesseract_common::fs::path kin_plugin_file_path = parseConfigFilePath(locator, xml_element, version);
-  YAML::Node config;
-  try
-  {
-    config = YAML::LoadFile(kin_plugin_file_path.string());
-  }
-  // LCOV_EXCL_START
-  catch (...)
-  {
-    std::throw_with_nested(std::runtime_error("kinematics_plugin_config: YAML failed to parse kinematics plugins "
-                                              "file '" +
-                                              kin_plugin_file_path.string() + "'."));
-  }
-  // LCOV_EXCL_STOP
-
-  const YAML::Node& kin_plugin_info = config[tesseract_common::KinematicsPluginInfo::CONFIG_KEY];
+  return parseCachedConfigFile<tesseract_common::KinematicsPluginInfo>(
+      kin_plugin_file_path, [](const tesseract_common::fs::path& file_path) {
+        YAML::Node config;
+        try
+        {
+          config = YAML::LoadFile(file_path.string());
+        }
+        // LCOV_EXCL_START
+        catch (...)
+        {
+          std::throw_with_nested(std::runtime_error("kinematics_plugin_config: YAML failed to parse kinematics "
+                                                    "plugins file '" +
+                                                    file_path.string() + "'."));
+        }
+        // LCOV_EXCL_STOP
 
-  return kin_plugin_info.as<tesseract_common::KinematicsPluginInfo>();
+        const YAML::Node& kin_plugin_info = config[tesseract_common::KinematicsPluginInfo::CONFIG_KEY];
+        return kin_plugin_info.as<tesseract_common::KinematicsPluginInfo>();
+      });
 }
 
 tesseract_common::ContactManagersPluginInfo
@@ -124,22 +181,25 @@ parseContactManagersPluginConfig(const tesseract_common::ResourceLocator& locato
                                  const std::array<int, 3>& version)
 {
   tesseract_common::fs::path cm_plugin_file_path = parseConfigFilePath(locator, xml_element, version);
-  YAML::Node config;
-  try
-  {
-    config = YAML::LoadFile(cm_plugin_file_path.string());
-  }
-  // LCOV_EXCL_START
-  catch (...)
-  {
-    std::throw_with_nested(std::runtime_error("contact_managers_plugin_config: YAML failed to parse contact "
-                                              "managers plugins "
-                                              "file '" +
-                                              cm_plugin_file_path.string() + "'."));
-  }
-  // LCOV_EXCL_STOP
+  return parseCachedConfigFile<tesseract_common::ContactManagersPluginInfo>(
+      cm_plugin_file_path, [](const tesseract_common::fs::path& file_path) {
+        YAML::Node config;
+        try
+        {
+          config = YAML::LoadFile(file_path.string());
+        }
+        // LCOV_EXCL_START
+        catch (...)
+        {
+          std::throw_with_nested(std::runtime_error("contact_managers_plugin_config: YAML failed to parse contact "
+                                                    "managers plugins "
+                                                    "file '" +
+                                                    file_path.string() + "'."));
+        }
+        // LCOV_EXCL_STOP
 
-  const YAML::Node& cm_plugin_info = config[tesseract_common::ContactManagersPluginInfo::CONFIG_KEY];
-  return cm_plugin_info.as<tesseract_common::ContactManagersPluginInfo>();
+        const YAML::Node& cm_plugin_info = config[tesseract_common::ContactManagersPluginInfo::CONFIG_KEY];
+        return cm_plugin_info.as<tesseract_common::ContactManagersPluginInfo>();
+      });
 }
 }  // namespace tesseract_srdf
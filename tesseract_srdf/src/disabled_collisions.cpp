@@ -26,10 +26,17 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <console_bridge/console.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <tinyxml2.h>
+#include <unordered_map>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/types.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_srdf/disabled_collisions.h>
 #include <tesseract_scene_graph/graph.h>
@@ -37,11 +44,93 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_srdf
 {
+namespace
+{
+/** @brief Identifies a cache file, the last byte is the version of the layout */
+const uint64_t DISABLED_COLLISIONS_CACHE_MAGIC = 0x01004D4341534554;  // "TESACM" and version 1
+
+/** @brief The 64 bit FNV-1a hash, which unlike std::hash is the same in every process */
+void hashBytes(uint64_t& hash, const void* data, std::size_t size)
+{
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+}
+
+void hashString(uint64_t& hash, const std::string& value)
+{
+  const auto size = static_cast<uint64_t>(value.size());
+  hashBytes(hash, &size, sizeof(size));
+  hashBytes(hash, value.data(), value.size());
+}
+
+template <class T>
+void write(std::ofstream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT
+}
+
+/** @brief Reads values from a buffer, failing instead of reading past its end */
+class BufferReader
+{
+public:
+  explicit BufferReader(const std::vector<char>& buffer) : buffer_(buffer) {}
+
+  template <class T>
+  bool read(T& value)
+  {
+    if (buffer_.size() - pos_ < sizeof(T))
+      return false;
+
+    std::copy_n(buffer_.data() + pos_, sizeof(T), reinterpret_cast<char*>(&value));  // NOLINT
+    pos_ += sizeof(T);
+    return true;
+  }
+
+  bool read(std::string& value, std::size_t size)
+  {
+    if (buffer_.size() - pos_ < size)
+      return false;
+
+    value.assign(buffer_.data() + pos_, size);  // NOLINT
+    pos_ += size;
+    return true;
+  }
+
+  bool atEnd() const { return pos_ == buffer_.size(); }
+
+private:
+  const std::vector<char>& buffer_;
+  std::size_t pos_{ 0 };
+};
+}  // namespace
+
 tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract_scene_graph::SceneGraph& scene_graph,
                                                                  const tinyxml2::XMLElement* srdf_xml,
                                                                  const std::array<int, 3>& /*version*/)
 {
-  tesseract_common::AllowedCollisionMatrix acm;
+  // Large srdf files have tens of thousands of entries, so the table is sized once and filled in bulk
+  std::size_t count{ 0 };
+  for (const tinyxml2::XMLElement* xml_element = srdf_xml->FirstChildElement("disable_collisions");
+       xml_element != nullptr;
+       xml_element = xml_element->NextSiblingElement("disable_collisions"))
+    ++count;
+
+  tesseract_common::AllowedCollisionEntries entries;
+  entries.reserve(count);
+
+  // Many entries refer to the same links, so each link is looked up in the scene graph once
+  std::unordered_map<std::string, bool> known_links;
+  known_links.reserve(scene_graph.getLinks().size());
+  auto isKnownLink = [&known_links, &scene_graph](const std::string& link_name) {
+    auto it = known_links.find(link_name);
+    if (it == known_links.end())
+      it = known_links.emplace(link_name, scene_graph.getLink(link_name) != nullptr).first;
+    return it->second;
+  };
 
   for (const tinyxml2::XMLElement* xml_element = srdf_xml->FirstChildElement("disable_collisions");
        xml_element != nullptr;
@@ -56,12 +145,12 @@ tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract
     if (status != tinyxml2::XML_SUCCESS)
       std::throw_with_nested(std::runtime_error("DisabledCollisions: Missing or failed to parse attribute 'link2'!"));
 
-    if (!scene_graph.getLink(link1_name))
+    if (!isKnownLink(link1_name))
     {
       CONSOLE_BRIDGE_logWarn("Link '%s' is not known to URDF. Cannot disable collisons.", link1_name.c_str());
       continue;
     }
-    if (!scene_graph.getLink(link2_name))
+    if (!isKnownLink(link2_name))
     {
       CONSOLE_BRIDGE_logWarn("Link '%s' is not known to URDF. Cannot disable collisons.", link2_name.c_str());
       continue;
@@ -73,9 +162,141 @@ tesseract_common::AllowedCollisionMatrix parseDisabledCollisions(const tesseract
       std::throw_with_nested(std::runtime_error("DisabledCollisions: Missing or failed to parse attribute 'reason'!"));
     // LCOV_EXCL_STOP
 
-    acm.addAllowedCollision(link1_name, link2_name, reason);
+    entries[tesseract_common::makeOrderedLinkPair(link1_name, link2_name)] = std::move(reason);
   }
 
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollisions(std::move(entries));
   return acm;
 }
+
+uint64_t getDisabledCollisionsCacheKey(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                       const std::string& srdf_xml_string)
+{
+  std::vector<std::string> link_names;
+  for (const auto& link : scene_graph.getLinks())
+    link_names.push_back(link->getName());
+  std::sort(link_names.begin(), link_names.end());
+
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  hashString(hash, srdf_xml_string);
+  for (const auto& link_name : link_names)
+    hashString(hash, link_name);
+
+  return hash;
+}
+
+bool saveDisabledCollisionsCache(const std::string& file_path,
+                                 const tesseract_common::AllowedCollisionMatrix& acm,
+                                 uint64_t key)
+{
+  // The link names and reasons repeat across entries, so each is stored once and referred to by index
+  std::vector<const std::string*> strings;
+  std::unordered_map<std::string, uint32_t> string_indices;
+  auto intern = [&strings, &string_indices](const std::string& value) {
+    auto it = string_indices.emplace(value, static_cast<uint32_t>(strings.size()));
+    if (it.second)
+      strings.push_back(&it.first->first);
+    return it.first->second;
+  };
+
+  const tesseract_common::AllowedCollisionEntries& entries = acm.getAllAllowedCollisions();
+  std::vector<std::array<uint32_t, 3>> indices;
+  indices.reserve(entries.size());
+  for (const auto& entry : entries)
+    indices.push_back({ intern(entry.first.first), intern(entry.first.second), intern(entry.second) });
+
+  // The file is written next to its final path and renamed, so a reader never sees a partial file
+  const std::string tmp_path = file_path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      CONSOLE_BRIDGE_logDebug("Failed to write disabled collisions cache file '%s'", file_path.c_str());
+      return false;
+    }
+
+    write(out, DISABLED_COLLISIONS_CACHE_MAGIC);
+    write(out, key);
+    write(out, static_cast<uint32_t>(strings.size()));
+    for (const std::string* value : strings)
+    {
+      write(out, static_cast<uint32_t>(value->size()));
+      out.write(value->data(), static_cast<std::streamsize>(value->size()));
+    }
+    write(out, static_cast<uint32_t>(indices.size()));
+    for (const auto& index : indices)
+      out.write(reinterpret_cast<const char*>(index.data()), sizeof(index));  // NOLINT
+
+    if (!out.good())
+    {
+      out.close();
+      std::remove(tmp_path.c_str());
+      CONSOLE_BRIDGE_logDebug("Failed to write disabled collisions cache file '%s'", file_path.c_str());
+      return false;
+    }
+  }
+
+  boost::system::error_code ec;
+  tesseract_common::fs::rename(tmp_path, file_path, ec);
+  if (ec)
+  {
+    std::remove(tmp_path.c_str());
+    CONSOLE_BRIDGE_logDebug("Failed to write disabled collisions cache file '%s'", file_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool loadDisabledCollisionsCache(const std::string& file_path,
+                                 uint64_t key,
+                                 tesseract_common::AllowedCollisionMatrix& acm)
+{
+  std::ifstream in(file_path, std::ios::binary);
+  if (!in)
+    return false;
+
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  BufferReader reader(buffer);
+
+  uint64_t magic{ 0 };
+  uint64_t file_key{ 0 };
+  if (!reader.read(magic) || magic != DISABLED_COLLISIONS_CACHE_MAGIC || !reader.read(file_key) || file_key != key)
+    return false;
+
+  // The counts are checked against the size of the file, so a corrupt file does not cause a large allocation
+  uint32_t string_count{ 0 };
+  if (!reader.read(string_count) || string_count > buffer.size() / sizeof(uint32_t))
+    return false;
+
+  std::vector<std::string> strings(string_count);
+  for (auto& value : strings)
+  {
+    uint32_t size{ 0 };
+    if (!reader.read(size) || !reader.read(value, size))
+      return false;
+  }
+
+  uint32_t entry_count{ 0 };
+  if (!reader.read(entry_count) || entry_count > buffer.size() / (3 * sizeof(uint32_t)))
+    return false;
+
+  tesseract_common::AllowedCollisionEntries entries;
+  entries.reserve(entry_count);
+  for (uint32_t i = 0; i < entry_count; ++i)
+  {
+    std::array<uint32_t, 3> index{};
+    if (!reader.read(index) || index[0] >= string_count || index[1] >= string_count || index[2] >= string_count)
+      return false;
+
+    entries[tesseract_common::makeOrderedLinkPair(strings[index[0]], strings[index[1]])] = strings[index[2]];
+  }
+
+  if (!reader.atEnd())
+    return false;
+
+  acm.clearAllowedCollisions();
+  acm.addAllowedCollisions(std::move(entries));
+  return true;
+}
 }  // namespace tesseract_srdf
@@ -73,7 +73,27 @@ void SRDFModel::initFile(const tesseract_scene_graph::SceneGraph& scene_graph,
     xml_file.close();
     try
     {
-      initString(scene_graph, xml_string, *resource);
+      const char* acm_cache = std::getenv("TESSERACT_SRDF_ACM_CACHE");
+      if (acm_cache == nullptr || std::strcmp(acm_cache, "0") == 0 || std::strlen(acm_cache) == 0)
+      {
+        initString(scene_graph, xml_string, *resource);
+      }
+      else
+      {
+        const std::string cache_path = filename + ".acm";
+        const uint64_t cache_key = getDisabledCollisionsCacheKey(scene_graph, xml_string);
+        tesseract_common::AllowedCollisionMatrix cached_acm;
+        if (loadDisabledCollisionsCache(cache_path, cache_key, cached_acm))
+        {
+          initString(scene_graph, xml_string, *resource, false);
+          acm = std::move(cached_acm);
+        }
+        else
+        {
+          initString(scene_graph, xml_string, *resource, true);
+          saveDisabledCollisionsCache(cache_path, acm, cache_key);
+        }
+      }
     }
     catch (...)
     {
@@ -89,6 +109,14 @@ void SRDFModel::initFile(const tesseract_scene_graph::SceneGraph& scene_graph,
 void SRDFModel::initString(const tesseract_scene_graph::SceneGraph& scene_graph,
                            const std::string& xmlstring,
                            const tesseract_common::ResourceLocator& locator)
+{
+  initString(scene_graph, xmlstring, locator, true);
+}
+
+void SRDFModel::initString(const tesseract_scene_graph::SceneGraph& scene_graph,
+                           const std::string& xmlstring,
+                           const tesseract_common::ResourceLocator& locator,
+                           bool parse_disabled_collisions)
 {
   tinyxml2::XMLDocument xml_doc;
   tinyxml2::XMLError status = xml_doc.Parse(xmlstring.c_str());
@@ -209,7 +237,8 @@ void SRDFModel::initString(const tesseract_scene_graph::SceneGraph& scene_graph,
 
   try
   {
-    acm = parseDisabledCollisions(scene_graph, srdf_xml, version);
+    if (parse_disabled_collisions)
+      acm = parseDisabledCollisions(scene_graph, srdf_xml, version);
   }
   catch (...)
   {
@@ -914,6 +914,47 @@ TEST(TesseractSRDFUnit, LoadSRDFAllowedCollisionMatrixUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSRDFUnit, AllowedCollisionMatrixCacheUnit)  // NOLINT
+{
+  using namespace tesseract_scene_graph;
+  using namespace tesseract_srdf;
+
+  SceneGraph::Ptr g = getABBSceneGraph();
+
+  std::string xml_string =
+      R"(<robot name="abb_irb2400">
+           <disable_collisions link1="base_link" link2="link_1" reason="Adjacent" />
+           <disable_collisions link1="base_link" link2="link_2" reason="Never" />
+           <disable_collisions link1="base_link" link2="link_3" reason="Never" />
+         </robot>)";
+  tinyxml2::XMLDocument xml_doc;
+  EXPECT_TRUE(xml_doc.Parse(xml_string.c_str()) == tinyxml2::XML_SUCCESS);
+  tesseract_common::AllowedCollisionMatrix acm =
+      parseDisabledCollisions(*g, xml_doc.FirstChildElement("robot"), std::array<int, 3>({ 1, 0, 0 }));
+
+  const std::string cache_path = tesseract_common::getTempPath() + "abb_irb2400.srdf.acm";
+  const uint64_t key = getDisabledCollisionsCacheKey(*g, xml_string);
+  EXPECT_EQ(key, getDisabledCollisionsCacheKey(*g, xml_string));
+  EXPECT_NE(key, getDisabledCollisionsCacheKey(*g, xml_string + " "));
+  EXPECT_TRUE(saveDisabledCollisionsCache(cache_path, acm, key));
+
+  tesseract_common::AllowedCollisionMatrix cached_acm;
+  EXPECT_TRUE(loadDisabledCollisionsCache(cache_path, key, cached_acm));
+  EXPECT_EQ(cached_acm, acm);
+
+  // A cache of a different srdf or scene graph is not used
+  tesseract_common::AllowedCollisionMatrix stale_acm;
+  EXPECT_FALSE(loadDisabledCollisionsCache(cache_path, key + 1, stale_acm));
+  EXPECT_TRUE(stale_acm.getAllAllowedCollisions().empty());
+
+  // A truncated cache is not used
+  tesseract_common::fs::resize_file(cache_path, tesseract_common::fs::file_size(cache_path) - 1);
+  EXPECT_FALSE(loadDisabledCollisionsCache(cache_path, key, stale_acm));
+  EXPECT_TRUE(stale_acm.getAllAllowedCollisions().empty());
+  tesseract_common::fs::remove(cache_path);
+  EXPECT_FALSE(loadDisabledCollisionsCache(cache_path, key, stale_acm));
+}
+
 TEST(TesseractSRDFUnit, SRDFChainGroupUnit)  // NOLINT
 {
   using namespace tesseract_scene_graph;
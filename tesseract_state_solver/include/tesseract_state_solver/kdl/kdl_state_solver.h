@@ -66,9 +66,27 @@ public:
   SceneState getState(const std::unordered_map<std::string, double>& joint_values) const override final;
   SceneState getState(const std::vector<std::string>& joint_names,
                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
 
   SceneState getState() const override final;
 
+  std::vector<tesseract_common::TransformMap>
+  getLinkTransforms(const std::vector<std::string>& joint_names,
+                    const tesseract_common::TrajArray& traj,
+                    const std::vector<std::string>& link_names = std::vector<std::string>(),
+                    std::size_t threads = 1) const override final;
+
+  void getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                         const std::vector<std::string>& link_names,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -105,6 +123,37 @@ public:
 
   tesseract_common::KinematicLimits getLimits() const override final;
 
+  /**
+   * @brief Get the index of each link, used to calculate the transforms of only these links
+   * @param link_names The link names, throws if a link does not exist
+   * @return The index of each link
+   */
+  std::vector<long> getLinkIndices(const std::vector<std::string>& link_names) const;
+
+  /**
+   * @brief Calculate the transforms of the provided links without building a SceneState
+   * @details Only the segments between the root and each link are computed
+   * @param link_transforms The buffer the transform of each link is written to, must be the same size as link_indices
+   * @param link_indices The index of each link, see getLinkIndices. The buffer entry of a negative index is not
+   * changed.
+   * @param joint_values The joint values, in the order of the active joint names
+   */
+  void getLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                         const std::vector<long>& link_indices,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Calculate the jacobian of a link into a preallocated matrix
+   * @details The KDL joint array and jacobian are thread local, so no memory is allocated after the first call on a
+   * thread. Throws if the jacobian can not be calculated.
+   * @param jacobian The jacobian, must be 6 x number of active joints
+   * @param joint_values The joint values, in the order of the active joint names
+   * @param link_name The link name to calculate the jacobian for
+   */
+  void getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                   const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                   const std::string& link_name) const;
+
 private:
   SceneState current_state_;                                   /**< Current state of the environment */
   KDLTreeData data_;                                           /**< KDL tree data */
@@ -115,6 +164,9 @@ private:
   tesseract_common::KinematicLimits limits_; /**< The kinematic limits */
   mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
 
+  /** @brief The kdl segment of each link in the link names, the end of the segments if it is not in the tree */
+  std::vector<KDL::SegmentMap::const_iterator> link_segments_;
+
   void calculateTransforms(SceneState& state,
                            const KDL::JntArray& q_in,
                            const KDL::SegmentMap::const_iterator& it,
@@ -135,6 +187,9 @@ private:
   KDL::JntArray getKDLJntArray(const std::unordered_map<std::string, double>& joint_values) const;
 
   bool processKDLData(const tesseract_scene_graph::SceneGraph& scene_graph);
+
+  /** @brief Find the kdl segment of each link, required after data_ is assigned */
+  void loadLinkSegments();
 };
 
 }  // namespace tesseract_scene_graph
@@ -0,0 +1,185 @@
+/**
+ * @file ofkt_compiled_tree.h
+ * @brief A flattened representation of the Optimized Forward Kinematic Tree.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_STATE_SOLVER_OFKT_COMPILED_TREE_H
+#define TESSERACT_STATE_SOLVER_OFKT_COMPILED_TREE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/compact_transform.h>
+#include <tesseract_common/types.h>
+#include <tesseract_scene_graph/joint.h>
+
+namespace tesseract_scene_graph
+{
+/**
+ * @brief A flattened representation of the OFKT used to compute the world transforms of its links
+ *
+ * The nodes of the tree, excluding the root, are stored as a structure of arrays in depth first order so every node is
+ * after its parent. The world transform of each node is then computed in a single loop over contiguous memory:
+ *
+ *   - W = W(parent) * S * J(joint value)
+ *
+ * where the world transform of the root is identity. The tree only holds the structure, the joint values are provided
+ * to each computation, so once compiled it is never modified and can be shared between threads and solvers.
+ */
+struct OFKTCompiledTree
+{
+  using Ptr = std::shared_ptr<OFKTCompiledTree>;
+  using ConstPtr = std::shared_ptr<const OFKTCompiledTree>;
+
+  /** @brief The root link name, empty if the tree has no root */
+  std::string root_link_name;
+
+  /** @brief The joint type of each node */
+  std::vector<JointType> joint_types;
+
+  /** @brief The joint axis of each node, zero for fixed nodes */
+  tesseract_common::VectorVector3d axes;
+
+  /** @brief The index of the parent of each node, -1 if the parent is the root */
+  std::vector<long> parent_indices;
+
+  /** @brief The static transform of each node */
+  tesseract_common::VectorIsometry3d static_transforms;
+
+  /** @brief The static transform of each node in the compact form used when computing transforms */
+  tesseract_common::VectorCompactTransform compact_static_transforms;
+
+  /** @brief The child link name of each node */
+  std::vector<std::string> link_names;
+
+  /** @brief The joint name of each node */
+  std::vector<std::string> joint_names;
+
+  /** @brief Map of link name to node index */
+  std::unordered_map<std::string, long> link_indices;
+
+  /** @brief Map of joint name to node index */
+  std::unordered_map<std::string, long> joint_indices;
+
+  /** @brief The node index of each active joint, in the order of the state solvers active joint names */
+  std::vector<long> active_joint_indices;
+
+  /** @brief The jacobian column of each node, the inverse of active_joint_indices, -1 if not an active joint */
+  std::vector<long> jacobian_columns;
+
+  /** @brief The index one past the last descendant of each node, so its subtree is the range [index, subtree_end) */
+  std::vector<long> subtree_ends;
+
+  /**
+   * @brief The node index of each mimic joint
+   * @details A mimic joint that follows another mimic joint is after it, so applying them in order resolves chains
+   */
+  std::vector<long> mimic_indices;
+
+  /** @brief The node index of the joint followed by each mimic joint */
+  std::vector<long> mimic_driver_indices;
+
+  /** @brief The multiplier of each mimic joint */
+  std::vector<double> mimic_multipliers;
+
+  /** @brief The offset of each mimic joint */
+  std::vector<double> mimic_offsets;
+
+  /** @brief Remove all nodes */
+  void clear();
+
+  /** @brief Get the number of nodes */
+  std::size_t size() const;
+
+  /**
+   * @brief Append a node, its parent must already be added
+   * @param type The joint type
+   * @param axis The joint axis
+   * @param parent_index The index of the parent node, -1 if the parent is the root
+   * @param static_tf The static transform
+   * @param link_name The child link name
+   * @param joint_name The joint name
+   * @return The index of the node
+   */
+  long addNode(JointType type,
+               const Eigen::Vector3d& axis,
+               long parent_index,
+               const Eigen::Isometry3d& static_tf,
+               const std::string& link_name,
+               const std::string& joint_name);
+
+  /**
+   * @brief Add a mimic joint, it must be added after the joint it follows if that is a mimic joint
+   * @param index The node index of the mimic joint
+   * @param driver_index The node index of the joint it follows
+   * @param multiplier The multiplier applied to the joint value it follows
+   * @param offset The offset added to the joint value it follows
+   */
+  void addMimicJoint(long index, long driver_index, double multiplier, double offset);
+
+  /**
+   * @brief Set the joint value of each mimic joint from the joint it follows
+   * @param values The joint value of each node, must be the same size as the tree
+   */
+  void applyMimicJoints(std::vector<double>& values) const;
+
+  /**
+   * @brief Compute the world transform of a single node, its parent world transform must already be computed
+   * @param transforms The world transform of each node, must be the same size as the tree
+   * @param index The index of the node
+   * @param value The joint value of the node
+   */
+  void computeTransform(tesseract_common::VectorIsometry3d& transforms, std::size_t index, double value) const;
+
+  /**
+   * @brief Compute the world transform of every node
+   * @param transforms The world transform of each node, must be the same size as the tree
+   * @param values The joint value of each node, must be the same size as the tree
+   */
+  void computeTransforms(tesseract_common::VectorIsometry3d& transforms, const std::vector<double>& values) const;
+
+  /**
+   * @brief Compute the world transform of a single node, its parent world transform must already be computed
+   * @details This is the compact form used for scratch transforms, it moves less memory than Eigen::Isometry3d
+   * @param transforms The world transform of each node, must be the same size as the tree
+   * @param index The index of the node
+   * @param value The joint value of the node
+   */
+  void computeTransform(tesseract_common::VectorCompactTransform& transforms, std::size_t index, double value) const;
+
+  /**
+   * @brief Compute the world transform of every node
+   * @param transforms The world transform of each node, must be the same size as the tree
+   * @param values The joint value of each node, must be the same size as the tree
+   */
+  void computeTransforms(tesseract_common::VectorCompactTransform& transforms, const std::vector<double>& values) const;
+};
+
+}  // namespace tesseract_scene_graph
+
+#endif  // TESSERACT_STATE_SOLVER_OFKT_COMPILED_TREE_H
@@ -0,0 +1,250 @@
+/**
+ * @file ofkt_state_snapshot.h
+ * @brief An immutable snapshot of the Optimized Forward Kinematic Tree state solver.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_STATE_SOLVER_OFKT_STATE_SNAPSHOT_H
+#define TESSERACT_STATE_SOLVER_OFKT_STATE_SNAPSHOT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/link_transforms.h>
+#include <tesseract_common/types.h>
+#include <tesseract_scene_graph/scene_state.h>
+#include <tesseract_state_solver/ofkt/ofkt_compiled_tree.h>
+
+namespace tesseract_scene_graph
+{
+class OFKTStateSolver;
+
+/**
+ * @brief The state of an OFKTStateSolver at a point in time
+ *
+ * A snapshot holds the compiled tree along with the joint values and world transforms of the solver when it was
+ * taken. It is never modified once handed out by OFKTStateSolver::getSnapshot, so its queries do not take any lock
+ * and it can be used from any number of threads while the solver keeps changing. The compiled tree is shared with the
+ * solver and the other snapshots until the structure of the solver changes.
+ */
+class OFKTStateSnapshot
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<OFKTStateSnapshot>;
+  using ConstPtr = std::shared_ptr<const OFKTStateSnapshot>;
+
+  OFKTStateSnapshot();
+
+  /**
+   * @brief Construct a snapshot and compute its world transforms
+   * @param tree The compiled tree
+   * @param joint_values The joint value of each node of the compiled tree
+   */
+  OFKTStateSnapshot(OFKTCompiledTree::ConstPtr tree, std::vector<double> joint_values);
+
+  /** @brief Get the compiled tree */
+  const OFKTCompiledTree& getCompiledTree() const;
+
+  /** @brief Get the joint value of each node of the compiled tree */
+  const std::vector<double>& getJointValues() const;
+
+  /** @brief Get the world transform of each node of the compiled tree */
+  const tesseract_common::VectorIsometry3d& getNodeTransforms() const;
+
+  /** @copydoc StateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>&) const */
+  SceneState getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /** @copydoc StateSolver::getState(const std::unordered_map<std::string, double>&) const */
+  SceneState getState(const std::unordered_map<std::string, double>& joint_values) const;
+
+  /** @copydoc StateSolver::getState(const std::vector<std::string>&, const Eigen::Ref<const Eigen::VectorXd>&) const */
+  SceneState getState(const std::vector<std::string>& joint_names,
+                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Get the state of the scene for a given set of joint values, updating a provided state
+   * @param state The state to update, it is reused if it was previously filled by a snapshot of the same tree
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  void getState(SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /** @copydoc StateSolver::getLinkTransforms(const std::vector<std::string>&, const tesseract_common::TrajArray&,
+   * const std::vector<std::string>&, std::size_t) const */
+  std::vector<tesseract_common::TransformMap>
+  getLinkTransforms(const std::vector<std::string>& joint_names,
+                    const tesseract_common::TrajArray& traj,
+                    const std::vector<std::string>& link_names = std::vector<std::string>(),
+                    std::size_t threads = 1) const;
+
+  /** @copydoc StateSolver::getLinkTransforms(tesseract_common::TransformMap&, const std::vector<std::string>&,
+   * const std::vector<std::string>&, const Eigen::Ref<const Eigen::VectorXd>&) const */
+  void getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                         const std::vector<std::string>& link_names,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /** @copydoc StateSolver::getLinkTransforms(tesseract_common::LinkTransforms&, const std::vector<std::string>&,
+   * const Eigen::Ref<const Eigen::VectorXd>&) const */
+  void getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /** @copydoc StateSolver::getJacobian(const Eigen::Ref<const Eigen::VectorXd>&, const std::string&) const */
+  Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                              const std::string& link_name) const;
+
+  /** @copydoc StateSolver::getJacobian(const std::unordered_map<std::string, double>&, const std::string&) const */
+  Eigen::MatrixXd getJacobian(const std::unordered_map<std::string, double>& joints_values,
+                              const std::string& link_name) const;
+
+  /** @copydoc StateSolver::getJacobian(const std::vector<std::string>&, const Eigen::Ref<const Eigen::VectorXd>&,
+   * const std::string&) const */
+  Eigen::MatrixXd getJacobian(const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                              const std::string& link_name) const;
+
+  /** @copydoc OFKTStateSolver::getJacobian(Eigen::Ref<Eigen::MatrixXd>, const Eigen::Ref<const Eigen::VectorXd>&,
+   * const std::string&) const */
+  void getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                   const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                   const std::string& link_name) const;
+
+  /** @copydoc OFKTStateSolver::getJacobians */
+  std::vector<Eigen::MatrixXd> getJacobians(const std::vector<std::string>& joint_names,
+                                            const tesseract_common::TrajArray& traj,
+                                            const std::string& link_name) const;
+
+  /** @copydoc OFKTStateSolver::getJacobianHessian */
+  std::vector<Eigen::MatrixXd> getJacobianHessian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                                  const std::string& link_name) const;
+
+  /** @copydoc OFKTStateSolver::getJacobianDerivative */
+  Eigen::MatrixXd getJacobianDerivative(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_velocities,
+                                        const std::string& link_name) const;
+
+  /** @brief Get the active joint names, in the order of the solvers active joint names */
+  std::vector<std::string> getActiveJointNames() const;
+
+  /** @brief Get the root link name */
+  const std::string& getBaseLinkName() const;
+
+  /** @brief Get the names of the links moved by an active joint, directly or through an ancestor */
+  std::vector<std::string> getActiveLinkNames() const;
+
+  /** @brief Get the names of the links not moved by any active joint, including the root link */
+  std::vector<std::string> getStaticLinkNames() const;
+
+  /** @brief Check if a link is moved by an active joint */
+  bool isActiveLinkName(const std::string& link_name) const;
+
+  /** @brief Check if a link exists */
+  bool hasLinkName(const std::string& link_name) const;
+
+  /** @brief Get the world transform of a link, throws if the link does not exist */
+  Eigen::Isometry3d getLinkTransform(const std::string& link_name) const;
+
+  /** @brief Get the transform of to_link_name relative to from_link_name */
+  Eigen::Isometry3d getRelativeLinkTransform(const std::string& from_link_name, const std::string& to_link_name) const;
+
+private:
+  OFKTCompiledTree::ConstPtr tree_;                     /**< The compiled tree, never modified */
+  std::vector<double> joint_values_;                    /**< The joint value of each node */
+  tesseract_common::VectorIsometry3d link_transforms_;  /**< The world transform of each node */
+
+  /** @brief Derive the mimic joint values and compute the world transforms from the joint values */
+  void update();
+
+  /** @brief Mark each node of the compiled tree moved by an active joint, directly or through an ancestor */
+  void loadActiveNodes(std::vector<char>& active) const;
+
+  /**
+   * @brief Compute the world transforms for the provided joint values and store them and the joint values in the state
+   * @param state The state to store the transforms in
+   * @param joint_values The joint value of each node of the compiled tree, the mimic joint values are derived in place
+   */
+  void update(SceneState& state, std::vector<double>& joint_values) const;
+
+  /**
+   * @brief Copy the joint values, overwrite the active joint values and derive the mimic joint values
+   * @param values The joint value of each node of the compiled tree
+   * @param joint_values The joint values, in the order of the active joint names
+   */
+  void loadJointValues(std::vector<double>& values, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Copy the joint values, overwrite the provided ones and derive the mimic joint values
+   * @param values The joint value of each node of the compiled tree
+   * @param joint_names The joint names, unknown joints are ignored
+   * @param joint_values The joint values
+   */
+  void loadJointValues(std::vector<double>& values,
+                       const std::vector<std::string>& joint_names,
+                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Compute the transforms of a set of links, only the ancestors of the links are computed
+   * @param link_transforms The transform of each link, in the order of the link names
+   * @param link_names The links to get the transforms of
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  void calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                          const std::vector<std::string>& link_names,
+                          const std::vector<std::string>& joint_names,
+                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Given a set of joint values calculate the jacobian for the provided link_name
+   *
+   * Only the transforms of the ancestors of the link are computed. The column of each active joint on the chain is
+   * precomputed in the compiled tree, so no per column lookup is needed.
+   *
+   * @param jacobian The geometric jacobian to fill, 6 x the number of active joints
+   * @param values The joint value of each node of the compiled tree
+   * @param link_name The link name to calculate the jacobian for
+   * @param hessian If not null, it is filled with the derivative of the jacobian with respect to each active joint
+   */
+  void calcJacobianHelper(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                          const std::vector<double>& values,
+                          const std::string& link_name,
+                          std::vector<Eigen::MatrixXd>* hessian = nullptr) const;
+
+  /** @brief The solver updates the joint values and world transforms of the snapshot it has not handed out */
+  friend class OFKTStateSolver;
+};
+
+}  // namespace tesseract_scene_graph
+
+#endif  // TESSERACT_STATE_SOLVER_OFKT_STATE_SNAPSHOT_H
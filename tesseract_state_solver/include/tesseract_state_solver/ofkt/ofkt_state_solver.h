@@ -34,6 +34,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 #include <shared_mutex>
@@ -41,15 +43,34 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_state_solver/mutable_state_solver.h>
 #include <tesseract_state_solver/ofkt/ofkt_node.h>
+#include <tesseract_state_solver/ofkt/ofkt_compiled_tree.h>
+#include <tesseract_state_solver/ofkt/ofkt_state_snapshot.h>
 
 namespace tesseract_scene_graph
 {
+/**
+ * @brief Called for each link whose transform was changed by OFKTStateSolver::setState
+ * @details It is provided the compiled tree index of the link, its new world transform, which is also the world
+ * transform of its parent joint, and the value of its parent joint.
+ */
+using OFKTLinkChangedFn =
+    std::function<void(long link_index, const Eigen::Isometry3d& link_transform, double joint_value)>;
+
 /**
  * @brief An implementation of the Optimized Forward Kinematic Tree as a stat solver
  *
  * Starke, S., Hendrich, N., & Zhang, J. (2018). A Forward Kinematics Data Structure for Efficient Evolutionary Inverse
  * Kinematics. In Computational Kinematics (pp. 560-568). Springer, Cham.
  *
+ * The queries of the solver take a shared lock so the solver can be changed from another thread. Readers that do not
+ * need to see later changes can instead take a snapshot with getSnapshot and query it without any locking.
+ *
+ * Copies and clones share the compiled tree of the original solver and only copy the current state. The nodes of the
+ * tree are rebuilt from the compiled tree the first time the structure of a copy is changed.
+ *
+ * Mimic joints are compiled into the tree by node index, so setting a joint updates the joints mimicking it without a
+ * lookup by name. The value of a mimic joint is always derived from the joint it follows, a value set directly is
+ * replaced.
  */
 class OFKTStateSolver : public MutableStateSolver
 {
@@ -80,13 +101,54 @@ public:
   void setState(const std::vector<std::string>& joint_names,
                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) override final;
 
+  /**
+   * @brief Set the current state of the solver, only updating the links moved by the joints whose value changed
+   *
+   * This is intended for streaming joint states. The joints are addressed by their compiled tree index, so no name is
+   * hashed, and only the subtrees of the joints whose value changed are recomputed.
+   *
+   * @param joint_indices The compiled tree index of each joint, see getJointIndices. The indices are valid until the
+   * structure of the solver changes.
+   * @param joint_values The joint values
+   * @param changed If provided, it is called for each link whose transform was updated. It is called while the solver
+   * is locked, so it must not call the solver.
+   */
+  void setState(const std::vector<long>& joint_indices,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                const OFKTLinkChangedFn& changed = nullptr);
+
+  /**
+   * @brief Get the compiled tree index of each joint, used to set the state by index
+   * @param joint_names The joint names, throws if a joint does not exist
+   * @return The compiled tree index of each joint
+   */
+  std::vector<long> getJointIndices(const std::vector<std::string>& joint_names) const;
+
   SceneState getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
   SceneState getState(const std::unordered_map<std::string, double>& joint_values) const override final;
   SceneState getState(const std::vector<std::string>& joint_names,
                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+  void getState(SceneState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
 
   SceneState getState() const override final;
 
+  std::vector<tesseract_common::TransformMap>
+  getLinkTransforms(const std::vector<std::string>& joint_names,
+                    const tesseract_common::TrajArray& traj,
+                    const std::vector<std::string>& link_names = std::vector<std::string>(),
+                    std::size_t threads = 1) const override final;
+
+  void getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                         const std::vector<std::string>& link_names,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                         const std::vector<std::string>& joint_names,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -98,6 +160,61 @@ public:
                               const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                               const std::string& link_name) const override final;
 
+  /**
+   * @brief Get the jacobian of the solver given the joint values, writing it into a preallocated matrix
+   * @param jacobian The jacobian to fill, it must be 6 x the number of active joints
+   * @param joint_values The joint values, in the order of the active joint names
+   * @param link_name The link name to calculate the jacobian
+   */
+  void getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                   const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                   const std::string& link_name) const;
+
+  /**
+   * @brief Get the jacobian for every state of a trajectory
+   *
+   * This does not change the internal state of the solver. Joints not in joint_names keep their current values.
+   *
+   * @param joint_names The joint names of the trajectory columns
+   * @param traj The trajectory, each row is a state
+   * @param link_name The link name to calculate the jacobians
+   * @return The jacobian of each state, the columns are in the order of the active joint names
+   */
+  std::vector<Eigen::MatrixXd> getJacobians(const std::vector<std::string>& joint_names,
+                                            const tesseract_common::TrajArray& traj,
+                                            const std::string& link_name) const;
+
+  /**
+   * @brief Get the partial derivatives of the jacobian with respect to each joint
+   * @param joint_values The joint values, in the order of the active joint names
+   * @param link_name The link name to calculate the hessian
+   * @return The derivative of the jacobian with respect to each active joint, in the order of the active joint names
+   */
+  std::vector<Eigen::MatrixXd> getJacobianHessian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                                  const std::string& link_name) const;
+
+  /**
+   * @brief Get the time derivative of the jacobian
+   * @param joint_values The joint values, in the order of the active joint names
+   * @param joint_velocities The joint velocities, in the order of the active joint names
+   * @param link_name The link name to calculate the jacobian derivative
+   * @return The time derivative of the jacobian
+   */
+  Eigen::MatrixXd getJacobianDerivative(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_velocities,
+                                        const std::string& link_name) const;
+
+  /**
+   * @brief Get an immutable snapshot of the current state of the solver
+   *
+   * The snapshot is not affected by later changes to the solver and its queries do not take any lock. Taking a
+   * snapshot is cheap, the next change to the solver copies the joint values and world transforms before modifying
+   * them and the compiled tree is only replaced when the structure of the solver changes.
+   *
+   * @return The snapshot
+   */
+  OFKTStateSnapshot::ConstPtr getSnapshot() const;
+
   std::vector<std::string> getJointNames() const override final;
 
   std::vector<std::string> getActiveJointNames() const override final;
@@ -160,6 +277,31 @@ private:
   OFKTNode::UPtr root_;                                   /**< The root node of the tree */
   int revision_{ 0 };                                     /**< The revision number */
 
+  /** @brief The joint name map to the joint it mimics, including the prefix the joint was added with */
+  std::unordered_map<std::string, JointMimic> mimic_joints_;
+
+  /**
+   * @brief The compiled tree with the current joint values and world transforms
+   * @details It is replaced when the tree changes and copied on write once handed out by getSnapshot or shared with a
+   * copy of the solver
+   */
+  OFKTStateSnapshot::Ptr snapshot_{ std::make_shared<OFKTStateSnapshot>() };
+
+  /** @brief Indicates snapshot_ has been handed out by getSnapshot or shared with a copy of the solver */
+  mutable std::atomic<bool> snapshot_shared_{ false };
+
+  /** @brief The entry in current_state_.link_transforms of each node of the compiled tree */
+  std::vector<Eigen::Isometry3d*> state_link_transforms_;
+
+  /** @brief The entry in current_state_.joint_transforms of each node of the compiled tree */
+  std::vector<Eigen::Isometry3d*> state_joint_transforms_;
+
+  /** @brief The entry in current_state_.joints of each node of the compiled tree, nullptr if it is not active */
+  std::vector<double*> state_joint_values_;
+
+  /** @brief The nodes whose joint value changed during a setState by index, always cleared before it returns */
+  std::vector<char> dirty_nodes_;
+
   /** @brief The state solver can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
@@ -167,44 +309,35 @@ private:
 
   void clear();
 
-  /** @brief load the active link names */
-  void loadActiveLinkNamesRecursive(std::vector<std::string>& active_link_names,
-                                    const OFKTNode* node,
-                                    bool active) const;
+  /** @brief Rebuild the compiled tree from the nodes and publish a new snapshot, called after the tree is modified */
+  void compile();
 
-  /** @brief load the static link names */
-  void loadStaticLinkNamesRecursive(std::vector<std::string>& static_link_names, const OFKTNode* node) const;
+  /** @brief Add the mimic joints to the compiled tree, in the order they are resolved */
+  void compileMimicJoints(OFKTCompiledTree& tree) const;
 
   /**
-   * @brief This update the local and world transforms
-   * @param node The node to start from
-   * @param update_required Indicates if work transform update is required
+   * @brief Add a node and its children to the compiled tree
+   * @param tree The compiled tree
+   * @param joint_values The joint value of each node of the compiled tree
+   * @param node The node to add
+   * @param parent_index The compiled tree index of the nodes parent, -1 if the parent is the root
    */
-  void update(OFKTNode* node, bool update_required);
+  void compileHelper(OFKTCompiledTree& tree,
+                     std::vector<double>& joint_values,
+                     const OFKTNode* node,
+                     long parent_index);
 
-  /**
-   * @brief This is a const version of the function above
-   * @param node The node to start from
-   * @param parent_world_tf The nodes parent's world transformaiton
-   * @param update_required Indicates if work transform update is required
-   */
-  void update(SceneState& state, const OFKTNode* node, Eigen::Isometry3d parent_world_tf, bool update_required) const;
+  /** @brief Compute the world transforms from the current joint values and store them in the current state */
+  void update();
 
-  /**
-   * @brief Given a set of joint values calculate the jacobian for the provided link_name
-   * @param joints The joint values to calculate the jacobian for
-   * @param link_name The link name to calculate the jacobian for
-   * @return The calculated geometric jacobian
-   */
-  Eigen::MatrixXd calcJacobianHelper(const std::unordered_map<std::string, double>& joints,
-                                     const std::string& link_name) const;
+  /** @brief Get the snapshot to modify, it is copied first if it has been handed out by getSnapshot */
+  OFKTStateSnapshot& mutableSnapshot();
 
-  /**
-   * @brief A helper function used for cloning the OFKTStateSolver
-   * @param cloned The cloned object
-   * @param node The node cloning
-   */
-  void cloneHelper(OFKTStateSolver& cloned, const OFKTNode* node) const;
+  /** @brief Cache the entries of current_state_ written by update and setState for each node of the compiled tree */
+  void loadStateEntries();
+
+  /** @brief Rebuild the nodes from the compiled tree if they have not been built, required before changing the tree */
+  void loadNodes();
 
   /**
    * @brief Add a node to the tree
@@ -217,12 +350,22 @@ private:
    * @param parent_link_name The joints parent link name
    * @param child_link_name The joints child link name
    * @param kinematic_joints The vector to store new kinematic joints added to the solver
+   * @param prefix The prefix of the name of the joint it mimics
    */
   void addNode(const Joint& joint,
                const std::string& joint_name,
                const std::string& parent_link_name,
                const std::string& child_link_name,
-               std::vector<JointLimits::ConstPtr>& new_joint_limits);
+               std::vector<JointLimits::ConstPtr>& new_joint_limits,
+               const std::string& prefix = "");
+
+  /**
+   * @brief Store or remove the joint a joint mimics
+   * @param joint The joint
+   * @param joint_name The joints name
+   * @param prefix The prefix of the name of the joint it mimics
+   */
+  void setMimicJoint(const Joint& joint, const std::string& joint_name, const std::string& prefix);
 
   /**
    * @brief Remove a node and all of its children
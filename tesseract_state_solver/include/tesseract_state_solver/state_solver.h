@@ -38,6 +38,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/scene_state.h>
+#include <tesseract_common/link_transforms.h>
+#include <tesseract_common/sampling.h>
 #include <tesseract_common/types.h>
 
 namespace tesseract_scene_graph
@@ -101,12 +103,75 @@ public:
   virtual SceneState getState(const std::vector<std::string>& joint_names,
                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
 
+  /**
+   * @brief Get the state of the scene for a given set or subset of joint values, writing it into the provided state
+   *
+   * This does not change the internal state of the solver. If the state was previously filled by this solver its
+   * entries are updated in place, so calling this repeatedly with the same state avoids reallocating it.
+   *
+   * @param state The state to update
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  virtual void getState(SceneState& state,
+                        const std::vector<std::string>& joint_names,
+                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
   /**
    * @brief Get the current state of the scene
    * @return The current state
    */
   virtual SceneState getState() const = 0;
 
+  /**
+   * @brief Get the link transforms for every state of a trajectory
+   *
+   * This does not change the internal state of the solver. Joints not in joint_names keep their current values.
+   *
+   * @param joint_names The joint names of the trajectory columns
+   * @param traj The trajectory, each row is a state
+   * @param link_names The links to get the transforms of, if empty the transforms of all links are returned
+   * @param threads The number of threads used to compute the states, zero is treated as one
+   * @return The link transforms of each state of the trajectory
+   */
+  virtual std::vector<tesseract_common::TransformMap>
+  getLinkTransforms(const std::vector<std::string>& joint_names,
+                    const tesseract_common::TrajArray& traj,
+                    const std::vector<std::string>& link_names = std::vector<std::string>(),
+                    std::size_t threads = 1) const = 0;
+
+  /**
+   * @brief Get the transforms of a set of links for a given set or subset of joint values
+   *
+   * This does not change the internal state of the solver. Only the transforms needed by the requested links are
+   * computed, so it is cheaper than getState when only a few links are needed, like the active links of a contact
+   * manager. The entries of link_transforms are updated in place, other entries are left unchanged.
+   *
+   * @param link_transforms The link transforms to update
+   * @param link_names The links to get the transforms of
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  virtual void getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                                 const std::vector<std::string>& link_names,
+                                 const std::vector<std::string>& joint_names,
+                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the transforms of the links of a LinkTransforms for a given set or subset of joint values
+   *
+   * This does not change the internal state of the solver. It is the same as the TransformMap overload for the links of
+   * the name table of link_transforms, but the transforms are written in place by index so no map is built or walked.
+   * Throws if a link of the name table does not exist.
+   *
+   * @param link_transforms The link transforms to update
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  virtual void getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                                 const std::vector<std::string>& joint_names,
+                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
   /**
    * @brief Get the jacobian of the solver given the joint values
    * @details This must be the same size and order as what is returned by getJointNames
@@ -140,6 +205,21 @@ public:
    */
   virtual SceneState getRandomState() const = 0;
 
+  /**
+   * @brief Get random values of the active joints within their limits
+   * @details This avoids computing a full state for each sample when only the joint values are needed, for example
+   * to seed a sampling based planner. The samples are drawn from the generator of the calling thread.
+   * @param count The number of samples
+   * @return The samples, each row holds the values of the active joints in the order of getActiveJointNames()
+   */
+  virtual tesseract_common::TrajArray getRandomJointValues(Eigen::Index count) const
+  {
+    const Eigen::MatrixX2d limits = getLimits().joint_limits;
+    tesseract_common::TrajArray samples(count, limits.rows());
+    tesseract_common::sampleUniform(samples, limits, tesseract_common::getThreadRandomGenerator());
+    return samples;
+  }
+
   /**
    * @brief Get the vector of joint names
    * @return A vector of joint names
@@ -26,11 +26,13 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
 #include <tesseract_scene_graph/kdl_parser.h>
 #include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_common/tracing.h>
 
 namespace tesseract_scene_graph
 {
@@ -47,7 +49,7 @@ KDLStateSolver::KDLStateSolver(const tesseract_scene_graph::SceneGraph& scene_gr
   if (scene_graph.isEmpty())
     throw std::runtime_error("Cannot create a state solver form empty scene!");
 
-  data_ = tesseract_scene_graph::parseSceneGraph(scene_graph);
+  data_ = *tesseract_scene_graph::getKDLTreeData(scene_graph);
   processKDLData(scene_graph);
 }
 
@@ -67,11 +69,13 @@ KDLStateSolver& KDLStateSolver::operator=(const KDLStateSolver& other)
   kdl_jnt_array_ = other.kdl_jnt_array_;
   limits_ = other.limits_;
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
+  loadLinkSegments();
   return *this;
 }
 
 void KDLStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::setState");
   assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
   for (auto i = 0U; i < data_.active_joint_names.size(); ++i)
   {
@@ -84,6 +88,7 @@ void KDLStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_val
 
 void KDLStateSolver::setState(const std::unordered_map<std::string, double>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::setState");
   for (const auto& joint : joint_values)
   {
     if (setJointValuesHelper(kdl_jnt_array_, joint.first, joint.second))
@@ -96,6 +101,7 @@ void KDLStateSolver::setState(const std::unordered_map<std::string, double>& joi
 void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
                               const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::setState");
   assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
   for (auto i = 0U; i < joint_names.size(); ++i)
   {
@@ -108,6 +114,7 @@ void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
 
 SceneState KDLStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getState");
   assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
   SceneState state{ current_state_ };
   KDL::JntArray jnt_array = kdl_jnt_array_;
@@ -125,6 +132,7 @@ SceneState KDLStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joi
 
 SceneState KDLStateSolver::getState(const std::unordered_map<std::string, double>& joint_values) const
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getState");
   SceneState state{ current_state_ };
   KDL::JntArray jnt_array = kdl_jnt_array_;
 
@@ -143,6 +151,7 @@ SceneState KDLStateSolver::getState(const std::unordered_map<std::string, double
 SceneState KDLStateSolver::getState(const std::vector<std::string>& joint_names,
                                     const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getState");
   SceneState state{ current_state_ };
   KDL::JntArray jnt_array = kdl_jnt_array_;
 
@@ -158,8 +167,90 @@ SceneState KDLStateSolver::getState(const std::vector<std::string>& joint_names,
   return state;
 }
 
+void KDLStateSolver::getState(SceneState& state,
+                              const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getState");
+  // Reuse the entries of a state previously filled by this solver
+  if (state.joints.size() != current_state_.joints.size() ||
+      state.link_transforms.size() != current_state_.link_transforms.size() ||
+      state.joint_transforms.size() != current_state_.joint_transforms.size())
+  {
+    state = current_state_;
+  }
+  else
+  {
+    for (const auto& joint : current_state_.joints)
+      state.joints[joint.first] = joint.second;
+  }
+
+  thread_local KDL::JntArray jnt_array;
+  jnt_array = kdl_jnt_array_;
+
+  for (auto i = 0U; i < joint_names.size(); ++i)
+  {
+    if (setJointValuesHelper(jnt_array, joint_names[i], joint_values[i]))
+      state.joints[joint_names[i]] = joint_values[i];
+  }
+
+  Eigen::Isometry3d parent_frame{ Eigen::Isometry3d::Identity() };
+  calculateTransforms(state, jnt_array, data_.tree.getRootSegment(), parent_frame);  // NOLINT
+}
+
 SceneState KDLStateSolver::getState() const { return current_state_; }
 
+std::vector<tesseract_common::TransformMap>
+KDLStateSolver::getLinkTransforms(const std::vector<std::string>& joint_names,
+                                  const tesseract_common::TrajArray& traj,
+                                  const std::vector<std::string>& link_names,
+                                  std::size_t /*threads*/) const
+{
+  std::vector<tesseract_common::TransformMap> link_transforms(static_cast<std::size_t>(traj.rows()));
+  SceneState state;
+  for (Eigen::Index i = 0; i < traj.rows(); ++i)
+  {
+    getState(state, joint_names, traj.row(i));
+    tesseract_common::TransformMap& transforms = link_transforms[static_cast<std::size_t>(i)];
+    if (link_names.empty())
+    {
+      transforms.insert(state.link_transforms.begin(), state.link_transforms.end());
+    }
+    else
+    {
+      for (const auto& link_name : link_names)
+        transforms[link_name] = state.link_transforms.at(link_name);
+    }
+  }
+
+  return link_transforms;
+}
+
+void KDLStateSolver::getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                                       const std::vector<std::string>& link_names,
+                                       const std::vector<std::string>& joint_names,
+                                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getLinkTransforms");
+  // KDL computes the transforms of the whole tree, so only the copy is limited to the requested links
+  thread_local SceneState state;
+  getState(state, joint_names, joint_values);
+  for (const auto& link_name : link_names)
+    link_transforms[link_name] = state.link_transforms.at(link_name);
+}
+
+void KDLStateSolver::getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                                       const std::vector<std::string>& joint_names,
+                                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("KDLStateSolver::getLinkTransforms");
+  thread_local SceneState state;
+  getState(state, joint_names, joint_values);
+  const std::vector<std::string>& link_names = link_transforms.getNames();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    link_transforms[i] = state.link_transforms.at(link_names[i]);
+}
+
 SceneState KDLStateSolver::getRandomState() const
 {
   Eigen::VectorXd rs = tesseract_common::generateRandomNumber(limits_.joint_limits);
@@ -247,6 +338,83 @@ Eigen::Isometry3d KDLStateSolver::getRelativeLinkTransform(const std::string& fr
 
 tesseract_common::KinematicLimits KDLStateSolver::getLimits() const { return limits_; }
 
+std::vector<long> KDLStateSolver::getLinkIndices(const std::vector<std::string>& link_names) const
+{
+  std::vector<long> link_indices;
+  link_indices.reserve(link_names.size());
+  for (const auto& link_name : link_names)
+  {
+    auto it = std::find(data_.link_names.begin(), data_.link_names.end(), link_name);
+    const long link_index = std::distance(data_.link_names.begin(), it);
+    if (it == data_.link_names.end() ||
+        link_segments_[static_cast<std::size_t>(link_index)] == data_.tree.getSegments().end())
+      throw std::runtime_error("KDLStateSolver: Link name '" + link_name + "' does not exist!");
+
+    link_indices.push_back(link_index);
+  }
+
+  return link_indices;
+}
+
+void KDLStateSolver::getLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                       const std::vector<long>& link_indices,
+                                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(link_transforms.size() == link_indices.size());
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
+  thread_local KDL::JntArray jnt_array;
+  jnt_array = kdl_jnt_array_;
+  for (std::size_t i = 0; i < joint_qnr_.size(); ++i)
+    jnt_array(static_cast<unsigned>(joint_qnr_[i])) = joint_values(static_cast<Eigen::Index>(i));
+
+  const KDL::SegmentMap::const_iterator root = data_.tree.getRootSegment();
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (std::size_t i = 0; i < link_indices.size(); ++i)
+  {
+    if (link_indices[i] < 0)
+      continue;
+
+    // Walk from the link to the root, the root segment has no joint so its pose is identity
+    KDL::Frame frame = KDL::Frame::Identity();
+    for (auto it = link_segments_[static_cast<std::size_t>(link_indices[i])]; it != root;
+         it = GetTreeElementParent(it->second))
+    {
+      const KDL::TreeElementType& element = it->second;
+      const double value = (jnt_array.data.size() > 0) ? jnt_array(GetTreeElementQNr(element)) : 0;
+      frame = GetTreeElementSegment(element).pose(value) * frame;
+    }
+
+    link_transforms[i] = convert(frame);
+  }
+}
+
+void KDLStateSolver::getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                 const std::string& link_name) const
+{
+  assert(jacobian.rows() == 6);
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == jacobian.cols());
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
+  thread_local KDL::JntArray jnt_array;
+  thread_local KDL::Jacobian kdl_jacobian;
+  jnt_array = kdl_jnt_array_;
+  for (std::size_t i = 0; i < joint_qnr_.size(); ++i)
+    jnt_array(static_cast<unsigned>(joint_qnr_[i])) = joint_values(static_cast<Eigen::Index>(i));
+
+  // The resize only allocates when the number of joints changes
+  if (kdl_jacobian.columns() != kdl_jnt_array_.rows())
+    kdl_jacobian.resize(kdl_jnt_array_.rows());
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (jac_solver_->JntToJac(jnt_array, kdl_jacobian, link_name) < 0)
+      throw std::runtime_error("KDLStateSolver: Failed to calculate jacobian.");
+  }
+
+  for (std::size_t i = 0; i < joint_qnr_.size(); ++i)
+    jacobian.col(static_cast<Eigen::Index>(i)) = kdl_jacobian.data.col(joint_qnr_[i]);
+}
+
 bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& scene_graph)
 {
   current_state_ = SceneState();
@@ -281,11 +449,20 @@ bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& sce
   }
 
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
+  loadLinkSegments();
 
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
   return true;
 }
 
+void KDLStateSolver::loadLinkSegments()
+{
+  link_segments_.clear();
+  link_segments_.reserve(data_.link_names.size());
+  for (const auto& link_name : data_.link_names)
+    link_segments_.push_back(data_.tree.getSegment(link_name));
+}
+
 bool KDLStateSolver::setJointValuesHelper(KDL::JntArray& q,
                                           const std::string& joint_name,
                                           const double& joint_value) const
@@ -0,0 +1,176 @@
+/**
+ * @file ofkt_compiled_tree.cpp
+ * @brief A flattened representation of the Optimized Forward Kinematic Tree.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_state_solver/ofkt/ofkt_compiled_tree.h>
+
+namespace tesseract_scene_graph
+{
+void OFKTCompiledTree::clear()
+{
+  root_link_name.clear();
+  joint_types.clear();
+  axes.clear();
+  parent_indices.clear();
+  static_transforms.clear();
+  compact_static_transforms.clear();
+  link_names.clear();
+  joint_names.clear();
+  link_indices.clear();
+  joint_indices.clear();
+  active_joint_indices.clear();
+  jacobian_columns.clear();
+  subtree_ends.clear();
+  mimic_indices.clear();
+  mimic_driver_indices.clear();
+  mimic_multipliers.clear();
+  mimic_offsets.clear();
+}
+
+std::size_t OFKTCompiledTree::size() const { return joint_types.size(); }
+
+long OFKTCompiledTree::addNode(JointType type,
+                               const Eigen::Vector3d& axis,
+                               long parent_index,
+                               const Eigen::Isometry3d& static_tf,
+                               const std::string& link_name,
+                               const std::string& joint_name)
+{
+  assert(parent_index < static_cast<long>(size()));
+  const auto index = static_cast<long>(size());
+  joint_types.push_back(type);
+  axes.push_back(axis);
+  parent_indices.push_back(parent_index);
+  static_transforms.push_back(static_tf);
+  compact_static_transforms.emplace_back(static_tf);
+  link_names.push_back(link_name);
+  joint_names.push_back(joint_name);
+  link_indices[link_name] = index;
+  joint_indices[joint_name] = index;
+
+  // Nodes are added in depth first order, so the new node is the last descendant of each of its ancestors so far
+  subtree_ends.push_back(index + 1);
+  for (long i = parent_index; i >= 0; i = parent_indices[static_cast<std::size_t>(i)])
+    subtree_ends[static_cast<std::size_t>(i)] = index + 1;
+
+  return index;
+}
+
+void OFKTCompiledTree::addMimicJoint(long index, long driver_index, double multiplier, double offset)
+{
+  assert(index >= 0 && index < static_cast<long>(size()));
+  assert(driver_index >= 0 && driver_index < static_cast<long>(size()));
+
+  mimic_indices.push_back(index);
+  mimic_driver_indices.push_back(driver_index);
+  mimic_multipliers.push_back(multiplier);
+  mimic_offsets.push_back(offset);
+}
+
+void OFKTCompiledTree::applyMimicJoints(std::vector<double>& values) const
+{
+  assert(values.size() == size());
+  for (std::size_t i = 0; i < mimic_indices.size(); ++i)
+  {
+    const double driver_value = values[static_cast<std::size_t>(mimic_driver_indices[i])];
+    values[static_cast<std::size_t>(mimic_indices[i])] = (mimic_multipliers[i] * driver_value) + mimic_offsets[i];
+  }
+}
+
+void OFKTCompiledTree::computeTransform(tesseract_common::VectorIsometry3d& transforms,
+                                        std::size_t index,
+                                        double value) const
+{
+  assert(transforms.size() == size());
+  const long parent_index = parent_indices[index];
+  Eigen::Isometry3d& tf = transforms[index];
+  if (parent_index < 0)
+    tf = static_transforms[index];
+  else
+    tf = transforms[static_cast<std::size_t>(parent_index)] * static_transforms[index];
+
+  switch (joint_types[index])
+  {
+    case JointType::REVOLUTE:
+    case JointType::CONTINUOUS:
+      tf.rotate(Eigen::AngleAxisd(value, axes[index]));
+      break;
+    case JointType::PRISMATIC:
+      tf.translate(value * axes[index]);
+      break;
+    default:
+      break;
+  }
+}
+
+void OFKTCompiledTree::computeTransforms(tesseract_common::VectorIsometry3d& transforms,
+                                         const std::vector<double>& values) const
+{
+  assert(transforms.size() == size());
+  assert(values.size() == size());
+  for (std::size_t i = 0; i < joint_types.size(); ++i)
+    computeTransform(transforms, i, values[i]);
+}
+
+void OFKTCompiledTree::computeTransform(tesseract_common::VectorCompactTransform& transforms,
+                                        std::size_t index,
+                                        double value) const
+{
+  assert(transforms.size() == size());
+  const long parent_index = parent_indices[index];
+  tesseract_common::CompactTransform& tf = transforms[index];
+  if (parent_index < 0)
+    tf = compact_static_transforms[index];
+  else
+    tf = transforms[static_cast<std::size_t>(parent_index)] * compact_static_transforms[index];
+
+  switch (joint_types[index])
+  {
+    case JointType::REVOLUTE:
+    case JointType::CONTINUOUS:
+      tf.rotate(Eigen::AngleAxisd(value, axes[index]));
+      break;
+    case JointType::PRISMATIC:
+      tf.translate(value * axes[index]);
+      break;
+    default:
+      break;
+  }
+}
+
+void OFKTCompiledTree::computeTransforms(tesseract_common::VectorCompactTransform& transforms,
+                                         const std::vector<double>& values) const
+{
+  assert(transforms.size() == size());
+  assert(values.size() == size());
+  for (std::size_t i = 0; i < joint_types.size(); ++i)
+    computeTransform(transforms, i, values[i]);
+}
+
+}  // namespace tesseract_scene_graph
@@ -0,0 +1,714 @@
+/**
+ * @file ofkt_state_snapshot.cpp
+ * @brief An immutable snapshot of the Optimized Forward Kinematic Tree state solver.
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/executor.h>
+#include <tesseract_state_solver/ofkt/ofkt_state_snapshot.h>
+
+namespace tesseract_scene_graph
+{
+OFKTStateSnapshot::OFKTStateSnapshot() : tree_(std::make_shared<const OFKTCompiledTree>()) {}
+
+OFKTStateSnapshot::OFKTStateSnapshot(OFKTCompiledTree::ConstPtr tree, std::vector<double> joint_values)
+  : tree_(std::move(tree)), joint_values_(std::move(joint_values))
+{
+  assert(joint_values_.size() == tree_->size());
+  update();
+}
+
+const OFKTCompiledTree& OFKTStateSnapshot::getCompiledTree() const { return *tree_; }
+
+const std::vector<double>& OFKTStateSnapshot::getJointValues() const { return joint_values_; }
+
+const tesseract_common::VectorIsometry3d& OFKTStateSnapshot::getNodeTransforms() const { return link_transforms_; }
+
+SceneState OFKTStateSnapshot::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(tree_->active_joint_indices.size()) == joint_values.size());
+  thread_local std::vector<double> values;
+  loadJointValues(values, joint_values);
+
+  SceneState state;
+  update(state, values);
+  return state;
+}
+
+SceneState OFKTStateSnapshot::getState(const std::unordered_map<std::string, double>& joint_values) const
+{
+  thread_local std::vector<double> values;
+  values = joint_values_;
+  for (const auto& joint : joint_values)
+    values[static_cast<std::size_t>(tree_->joint_indices.at(joint.first))] = joint.second;
+
+  SceneState state;
+  update(state, values);
+  return state;
+}
+
+SceneState OFKTStateSnapshot::getState(const std::vector<std::string>& joint_names,
+                                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  SceneState state;
+  getState(state, joint_names, joint_values);
+  return state;
+}
+
+void OFKTStateSnapshot::getState(SceneState& state,
+                                 const std::vector<std::string>& joint_names,
+                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+
+  // Reuse the entries of a state previously filled from this tree, every entry is overwritten by update
+  const std::size_t num_nodes = tree_->size();
+  const std::size_t num_links = num_nodes + (tree_->root_link_name.empty() ? 0 : 1);
+  if (state.joints.size() != tree_->active_joint_indices.size() || state.link_transforms.size() != num_links ||
+      state.joint_transforms.size() != num_nodes)
+  {
+    state = SceneState();
+  }
+
+  thread_local std::vector<double> values;
+  values = joint_values_;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    const auto idx = static_cast<std::size_t>(tree_->joint_indices.at(joint_names[i]));
+    values[idx] = joint_values[static_cast<long>(i)];
+  }
+
+  update(state, values);
+}
+
+std::vector<tesseract_common::TransformMap>
+OFKTStateSnapshot::getLinkTransforms(const std::vector<std::string>& joint_names,
+                                     const tesseract_common::TrajArray& traj,
+                                     const std::vector<std::string>& link_names,
+                                     std::size_t threads) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == traj.cols());
+
+  const std::size_t num_nodes = tree_->size();
+  const auto num_states = static_cast<std::size_t>(traj.rows());
+  const std::string& root_link_name = tree_->root_link_name;
+
+  // The trajectory column of each node, -1 if its joint is not part of the trajectory
+  std::vector<long> columns(num_nodes, -1);
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+    columns[static_cast<std::size_t>(tree_->joint_indices.at(joint_names[i]))] = static_cast<long>(i);
+
+  // A mimic joint is derived from the joint it follows, so it moves with it instead of with its own column
+  const std::size_t num_mimic = tree_->mimic_indices.size();
+  std::vector<char> mimic_moved(num_nodes, 0);
+  for (std::size_t k = 0; k < num_mimic; ++k)
+  {
+    const auto idx = static_cast<std::size_t>(tree_->mimic_indices[k]);
+    const auto driver_idx = static_cast<std::size_t>(tree_->mimic_driver_indices[k]);
+    columns[idx] = -1;
+    mimic_moved[idx] = static_cast<char>(columns[driver_idx] >= 0 || mimic_moved[driver_idx] != 0);
+  }
+
+  // Only the nodes moved by the trajectory are recomputed, the rest keep their current world transform
+  std::vector<char> varying(num_nodes, 0);
+  for (std::size_t i = 0; i < num_nodes; ++i)
+  {
+    const long parent_index = tree_->parent_indices[i];
+    const bool parent_varying = (parent_index >= 0 && varying[static_cast<std::size_t>(parent_index)] != 0);
+    varying[i] = static_cast<char>(columns[i] >= 0 || mimic_moved[i] != 0 || parent_varying);
+  }
+
+  // Only the requested links and their ancestors are computed
+  std::vector<char> required(num_nodes, static_cast<char>(link_names.empty()));
+  for (const auto& link_name : link_names)
+  {
+    if (link_name == root_link_name)
+      continue;
+
+    long index = tree_->link_indices.at(link_name);
+    while (index >= 0 && required[static_cast<std::size_t>(index)] == 0)
+    {
+      required[static_cast<std::size_t>(index)] = 1;
+      index = tree_->parent_indices[static_cast<std::size_t>(index)];
+    }
+  }
+
+  // The sine and cosine of every joint value are computed a column at a time so they are vectorized across states
+  const Eigen::ArrayXXd sin_values = traj.array().sin();
+  const Eigen::ArrayXXd cos_values = traj.array().cos();
+
+  std::vector<tesseract_common::TransformMap> link_transforms(num_states);
+  auto compute_states = [&](std::size_t start, std::size_t end) {
+    tesseract_common::VectorCompactTransform transforms(num_nodes);
+    std::vector<double> values = joint_values_;
+    for (std::size_t s = start; s < end; ++s)
+    {
+      const auto row = static_cast<Eigen::Index>(s);
+      for (std::size_t k = 0; k < num_mimic; ++k)
+      {
+        const auto idx = static_cast<std::size_t>(tree_->mimic_indices[k]);
+        if (mimic_moved[idx] == 0)
+          continue;
+
+        const auto driver_idx = static_cast<std::size_t>(tree_->mimic_driver_indices[k]);
+        const long driver_column = columns[driver_idx];
+        const double driver_value = (driver_column < 0) ? values[driver_idx] : traj(row, driver_column);
+        values[idx] = (tree_->mimic_multipliers[k] * driver_value) + tree_->mimic_offsets[k];
+      }
+
+      for (std::size_t i = 0; i < num_nodes; ++i)
+      {
+        if (required[i] == 0)
+          continue;
+
+        tesseract_common::CompactTransform& tf = transforms[i];
+        if (varying[i] == 0)
+        {
+          tf = tesseract_common::CompactTransform(link_transforms_[i]);
+          continue;
+        }
+
+        const long parent_index = tree_->parent_indices[i];
+        if (parent_index < 0)
+          tf = tree_->compact_static_transforms[i];
+        else
+          tf = transforms[static_cast<std::size_t>(parent_index)] * tree_->compact_static_transforms[i];
+
+        const long column = columns[i];
+        const Eigen::Vector3d& axis = tree_->axes[i];
+        switch (tree_->joint_types[i])
+        {
+          case JointType::REVOLUTE:
+          case JointType::CONTINUOUS:
+          {
+            if (column < 0)
+            {
+              tf.rotate(Eigen::AngleAxisd(values[i], axis));
+              break;
+            }
+
+            // Rodrigues' rotation formula from the precomputed sine and cosine
+            const double s_value = sin_values(row, column);
+            const double c_value = cos_values(row, column);
+            Eigen::Matrix3d skew;
+            skew << 0, -axis.z(), axis.y(), axis.z(), 0, -axis.x(), -axis.y(), axis.x(), 0;
+            const Eigen::Matrix3d rotation = c_value * Eigen::Matrix3d::Identity() + s_value * skew +
+                                             (1.0 - c_value) * (axis * axis.transpose());
+            tf.rotate(rotation);
+            break;
+          }
+          case JointType::PRISMATIC:
+          {
+            const double value = (column < 0) ? values[i] : traj(row, column);
+            tf.translate(value * axis);
+            break;
+          }
+          default:
+            break;
+        }
+      }
+
+      tesseract_common::TransformMap& state_transforms = link_transforms[s];
+      if (link_names.empty())
+      {
+        state_transforms[root_link_name] = Eigen::Isometry3d::Identity();
+        for (std::size_t i = 0; i < num_nodes; ++i)
+          state_transforms[tree_->link_names[i]] = transforms[i].toIsometry();
+      }
+      else
+      {
+        for (const auto& link_name : link_names)
+        {
+          if (link_name == root_link_name)
+          {
+            state_transforms[link_name] = Eigen::Isometry3d::Identity();
+            continue;
+          }
+
+          const auto idx = static_cast<std::size_t>(tree_->link_indices.at(link_name));
+          state_transforms[link_name] = transforms[idx].toIsometry();
+        }
+      }
+    }
+  };
+
+  const std::size_t num_workers = std::min(std::max<std::size_t>(threads, 1), std::max<std::size_t>(num_states, 1));
+  if (num_workers == 1)
+  {
+    compute_states(0, num_states);
+    return link_transforms;
+  }
+
+  // Each worker computes a contiguous block of states
+  const std::size_t block_size = (num_states + num_workers - 1) / num_workers;
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, [&](std::size_t i) {
+    const std::size_t start = std::min(i * block_size, num_states);
+    compute_states(start, std::min(start + block_size, num_states));
+  });
+
+  return link_transforms;
+}
+
+void OFKTStateSnapshot::getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                                          const std::vector<std::string>& link_names,
+                                          const std::vector<std::string>& joint_names,
+                                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  thread_local tesseract_common::VectorIsometry3d computed;
+  calcLinkTransforms(computed, link_names, joint_names, joint_values);
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    link_transforms[link_names[i]] = computed[i];
+}
+
+void OFKTStateSnapshot::getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                                          const std::vector<std::string>& joint_names,
+                                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  calcLinkTransforms(link_transforms.getTransforms(), link_transforms.getNames(), joint_names, joint_values);
+}
+
+void OFKTStateSnapshot::calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                           const std::vector<std::string>& link_names,
+                                           const std::vector<std::string>& joint_names,
+                                           const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+
+  const std::size_t num_nodes = tree_->size();
+  const std::string& root_link_name = tree_->root_link_name;
+
+  // The nodes whose joint value is provided
+  thread_local std::vector<char> moved;
+  thread_local std::vector<double> values;
+  moved.assign(num_nodes, 0);
+  values.resize(num_nodes);
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    const auto idx = static_cast<std::size_t>(tree_->joint_indices.at(joint_names[i]));
+    moved[idx] = 1;
+    values[idx] = joint_values[static_cast<long>(i)];
+  }
+
+  // A mimic joint moves with the joint it follows
+  for (std::size_t i = 0; i < tree_->mimic_indices.size(); ++i)
+  {
+    const auto driver_idx = static_cast<std::size_t>(tree_->mimic_driver_indices[i]);
+    if (moved[driver_idx] == 0)
+      continue;
+
+    const auto idx = static_cast<std::size_t>(tree_->mimic_indices[i]);
+    moved[idx] = 1;
+    values[idx] = (tree_->mimic_multipliers[i] * values[driver_idx]) + tree_->mimic_offsets[i];
+  }
+
+  // The status of each node, 0 if not computed yet, 1 if its current transform is reused and 2 if it moved
+  thread_local std::vector<char> status;
+  thread_local std::vector<std::size_t> path;
+  thread_local tesseract_common::VectorCompactTransform transforms;
+  status.assign(num_nodes, 0);
+  transforms.resize(num_nodes);
+  link_transforms.resize(link_names.size());
+  for (std::size_t l = 0; l < link_names.size(); ++l)
+  {
+    const std::string& link_name = link_names[l];
+    if (link_name == root_link_name)
+    {
+      link_transforms[l] = Eigen::Isometry3d::Identity();
+      continue;
+    }
+
+    // Walk up the ancestors of the link until reaching the root or a node computed for a previous link
+    const auto link_index = static_cast<std::size_t>(tree_->link_indices.at(link_name));
+    path.clear();
+    long index = static_cast<long>(link_index);
+    while (index >= 0 && status[static_cast<std::size_t>(index)] == 0)
+    {
+      path.push_back(static_cast<std::size_t>(index));
+      index = tree_->parent_indices[static_cast<std::size_t>(index)];
+    }
+
+    // Nodes not moved by the provided joints, directly or through an ancestor, reuse their current transform
+    for (auto it = path.rbegin(); it != path.rend(); ++it)
+    {
+      const std::size_t i = *it;
+      const long parent_index = tree_->parent_indices[i];
+      const bool parent_moved = (parent_index >= 0 && status[static_cast<std::size_t>(parent_index)] == 2);
+      if (moved[i] == 0 && !parent_moved)
+      {
+        transforms[i] = tesseract_common::CompactTransform(link_transforms_[i]);
+        status[i] = 1;
+      }
+      else
+      {
+        tree_->computeTransform(transforms, i, (moved[i] != 0) ? values[i] : joint_values_[i]);
+        status[i] = 2;
+      }
+    }
+
+    link_transforms[l] = transforms[link_index].toIsometry();
+  }
+}
+
+Eigen::MatrixXd OFKTStateSnapshot::getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                               const std::string& link_name) const
+{
+  Eigen::MatrixXd jacobian(6, static_cast<Eigen::Index>(tree_->active_joint_indices.size()));
+  thread_local std::vector<double> values;
+  loadJointValues(values, joint_values);
+
+  calcJacobianHelper(jacobian, values, link_name);
+  return jacobian;
+}
+
+Eigen::MatrixXd OFKTStateSnapshot::getJacobian(const std::unordered_map<std::string, double>& joints_values,
+                                               const std::string& link_name) const
+{
+  Eigen::MatrixXd jacobian(6, static_cast<Eigen::Index>(tree_->active_joint_indices.size()));
+  thread_local std::vector<double> values;
+  values = joint_values_;
+  for (const auto& joint : joints_values)
+  {
+    auto it = tree_->joint_indices.find(joint.first);
+    if (it != tree_->joint_indices.end())
+      values[static_cast<std::size_t>(it->second)] = joint.second;
+  }
+
+  tree_->applyMimicJoints(values);
+  calcJacobianHelper(jacobian, values, link_name);
+  return jacobian;
+}
+
+Eigen::MatrixXd OFKTStateSnapshot::getJacobian(const std::vector<std::string>& joint_names,
+                                               const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                               const std::string& link_name) const
+{
+  Eigen::MatrixXd jacobian(6, static_cast<Eigen::Index>(tree_->active_joint_indices.size()));
+  thread_local std::vector<double> values;
+  loadJointValues(values, joint_names, joint_values);
+  calcJacobianHelper(jacobian, values, link_name);
+  return jacobian;
+}
+
+void OFKTStateSnapshot::getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                                    const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                    const std::string& link_name) const
+{
+  assert(jacobian.rows() == 6 && jacobian.cols() == static_cast<Eigen::Index>(tree_->active_joint_indices.size()));
+  thread_local std::vector<double> values;
+  loadJointValues(values, joint_values);
+
+  calcJacobianHelper(jacobian, values, link_name);
+}
+
+std::vector<Eigen::MatrixXd> OFKTStateSnapshot::getJacobians(const std::vector<std::string>& joint_names,
+                                                             const tesseract_common::TrajArray& traj,
+                                                             const std::string& link_name) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == traj.cols());
+
+  // The node of each trajectory column is looked up once for the whole trajectory
+  std::vector<std::size_t> indices;
+  indices.reserve(joint_names.size());
+  for (const auto& joint_name : joint_names)
+    indices.push_back(static_cast<std::size_t>(tree_->joint_indices.at(joint_name)));
+
+  const auto num_columns = static_cast<Eigen::Index>(tree_->active_joint_indices.size());
+  std::vector<Eigen::MatrixXd> jacobians(static_cast<std::size_t>(traj.rows()), Eigen::MatrixXd(6, num_columns));
+  std::vector<double> values = joint_values_;
+  for (Eigen::Index r = 0; r < traj.rows(); ++r)
+  {
+    for (std::size_t c = 0; c < indices.size(); ++c)
+      values[indices[c]] = traj(r, static_cast<Eigen::Index>(c));
+
+    tree_->applyMimicJoints(values);
+
+    calcJacobianHelper(jacobians[static_cast<std::size_t>(r)], values, link_name);
+  }
+
+  return jacobians;
+}
+
+std::vector<Eigen::MatrixXd>
+OFKTStateSnapshot::getJacobianHessian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                      const std::string& link_name) const
+{
+  thread_local std::vector<double> values;
+  loadJointValues(values, joint_values);
+
+  Eigen::MatrixXd jacobian(6, static_cast<Eigen::Index>(tree_->active_joint_indices.size()));
+  std::vector<Eigen::MatrixXd> hessian;
+  calcJacobianHelper(jacobian, values, link_name, &hessian);
+  return hessian;
+}
+
+Eigen::MatrixXd OFKTStateSnapshot::getJacobianDerivative(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                                         const Eigen::Ref<const Eigen::VectorXd>& joint_velocities,
+                                                         const std::string& link_name) const
+{
+  std::vector<Eigen::MatrixXd> hessian = getJacobianHessian(joint_values, link_name);
+  assert(static_cast<Eigen::Index>(hessian.size()) == joint_velocities.rows());
+
+  Eigen::MatrixXd jacobian_dot = Eigen::MatrixXd::Zero(6, static_cast<Eigen::Index>(hessian.size()));
+  for (std::size_t k = 0; k < hessian.size(); ++k)
+    jacobian_dot += hessian[k] * joint_velocities[static_cast<Eigen::Index>(k)];
+
+  return jacobian_dot;
+}
+
+void OFKTStateSnapshot::loadJointValues(std::vector<double>& values,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  values = joint_values_;
+  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
+  {
+    const auto idx = static_cast<std::size_t>(tree_->active_joint_indices[static_cast<std::size_t>(i)]);
+    values[idx] = joint_values[i];
+  }
+
+  tree_->applyMimicJoints(values);
+}
+
+void OFKTStateSnapshot::loadJointValues(std::vector<double>& values,
+                                        const std::vector<std::string>& joint_names,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  values = joint_values_;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto it = tree_->joint_indices.find(joint_names[i]);
+    if (it != tree_->joint_indices.end())
+      values[static_cast<std::size_t>(it->second)] = joint_values[static_cast<Eigen::Index>(i)];
+  }
+
+  tree_->applyMimicJoints(values);
+}
+
+void OFKTStateSnapshot::calcJacobianHelper(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                                           const std::vector<double>& values,
+                                           const std::string& link_name,
+                                           std::vector<Eigen::MatrixXd>* hessian) const
+{
+  const auto num_columns = static_cast<Eigen::Index>(tree_->active_joint_indices.size());
+  jacobian.setZero();
+  if (hessian != nullptr)
+    hessian->assign(tree_->active_joint_indices.size(), Eigen::MatrixXd::Zero(6, num_columns));
+
+  // The root link does not move
+  if (link_name == tree_->root_link_name)
+    return;
+
+  // The ancestors of the link, from the link to the root
+  thread_local std::vector<std::size_t> path;
+  thread_local tesseract_common::VectorCompactTransform transforms;
+  path.clear();
+  transforms.resize(tree_->size());
+  const auto link_index = static_cast<std::size_t>(tree_->link_indices.at(link_name));
+  for (long index = static_cast<long>(link_index); index >= 0;
+       index = tree_->parent_indices[static_cast<std::size_t>(index)])
+    path.push_back(static_cast<std::size_t>(index));
+
+  for (auto it = path.rbegin(); it != path.rend(); ++it)
+    tree_->computeTransform(transforms, *it, values[*it]);
+
+  const Eigen::Vector3d& link_point = transforms[link_index].translation;
+  for (const std::size_t i : path)
+  {
+    const long column = tree_->jacobian_columns[i];
+    if (column < 0)
+      continue;
+
+    const Eigen::Vector3d axis = transforms[i].linear * tree_->axes[i];
+    if (tree_->joint_types[i] == JointType::PRISMATIC)
+    {
+      jacobian.col(column).head<3>() = axis;
+    }
+    else
+    {
+      jacobian.col(column).head<3>() = axis.cross(link_point - transforms[i].translation);
+      jacobian.col(column).tail<3>() = axis;
+    }
+  }
+
+  if (hessian == nullptr)
+    return;
+
+  // The derivative of column i with respect to joint k, where path is ordered from the link to the root:
+  //   - k is an ancestor of i: [w_k x v_i; w_k x w_i]
+  //   - otherwise: [w_i x v_k; 0]
+  for (std::size_t a = 0; a < path.size(); ++a)
+  {
+    const long k = tree_->jacobian_columns[path[a]];
+    if (k < 0)
+      continue;
+
+    const Eigen::Vector3d v_k = jacobian.col(k).head<3>();
+    const Eigen::Vector3d w_k = jacobian.col(k).tail<3>();
+    Eigen::MatrixXd& hessian_k = (*hessian)[static_cast<std::size_t>(k)];
+    for (std::size_t b = 0; b < path.size(); ++b)
+    {
+      const long i = tree_->jacobian_columns[path[b]];
+      if (i < 0)
+        continue;
+
+      const Eigen::Vector3d v_i = jacobian.col(i).head<3>();
+      const Eigen::Vector3d w_i = jacobian.col(i).tail<3>();
+      if (a > b)
+      {
+        hessian_k.col(i).head<3>() = w_k.cross(v_i);
+        hessian_k.col(i).tail<3>() = w_k.cross(w_i);
+      }
+      else
+      {
+        hessian_k.col(i).head<3>() = w_i.cross(v_k);
+      }
+    }
+  }
+}
+
+void OFKTStateSnapshot::update(SceneState& state, std::vector<double>& joint_values) const
+{
+  tree_->applyMimicJoints(joint_values);
+  if (!tree_->root_link_name.empty())
+    state.link_transforms[tree_->root_link_name] = Eigen::Isometry3d::Identity();
+
+  thread_local tesseract_common::VectorCompactTransform link_transforms;
+  link_transforms.resize(tree_->size());
+  tree_->computeTransforms(link_transforms, joint_values);
+  for (std::size_t i = 0; i < link_transforms.size(); ++i)
+  {
+    const Eigen::Isometry3d transform = link_transforms[i].toIsometry();
+    state.link_transforms[tree_->link_names[i]] = transform;
+    state.joint_transforms[tree_->joint_names[i]] = transform;
+    if (tree_->joint_types[i] != JointType::FIXED)
+      state.joints[tree_->joint_names[i]] = joint_values[i];
+  }
+}
+
+std::vector<std::string> OFKTStateSnapshot::getActiveJointNames() const
+{
+  std::vector<std::string> active_joint_names;
+  active_joint_names.reserve(tree_->active_joint_indices.size());
+  for (const long index : tree_->active_joint_indices)
+    active_joint_names.push_back(tree_->joint_names[static_cast<std::size_t>(index)]);
+
+  return active_joint_names;
+}
+
+const std::string& OFKTStateSnapshot::getBaseLinkName() const { return tree_->root_link_name; }
+
+std::vector<std::string> OFKTStateSnapshot::getActiveLinkNames() const
+{
+  std::vector<char> active;
+  loadActiveNodes(active);
+
+  std::vector<std::string> active_link_names;
+  active_link_names.reserve(tree_->size());
+  for (std::size_t i = 0; i < tree_->size(); ++i)
+  {
+    if (active[i] != 0)
+      active_link_names.push_back(tree_->link_names[i]);
+  }
+
+  return active_link_names;
+}
+
+std::vector<std::string> OFKTStateSnapshot::getStaticLinkNames() const
+{
+  std::vector<std::string> static_link_names;
+  if (tree_->root_link_name.empty())
+    return static_link_names;
+
+  std::vector<char> active;
+  loadActiveNodes(active);
+
+  static_link_names.reserve(tree_->size() + 1);
+  static_link_names.push_back(tree_->root_link_name);
+  for (std::size_t i = 0; i < tree_->size(); ++i)
+  {
+    if (active[i] == 0)
+      static_link_names.push_back(tree_->link_names[i]);
+  }
+
+  return static_link_names;
+}
+
+bool OFKTStateSnapshot::isActiveLinkName(const std::string& link_name) const
+{
+  auto it = tree_->link_indices.find(link_name);
+  if (it == tree_->link_indices.end())
+    return false;
+
+  // Walk up the ancestors of the link until reaching an active joint or the root
+  for (long index = it->second; index >= 0; index = tree_->parent_indices[static_cast<std::size_t>(index)])
+  {
+    if (tree_->jacobian_columns[static_cast<std::size_t>(index)] >= 0)
+      return true;
+  }
+
+  return false;
+}
+
+bool OFKTStateSnapshot::hasLinkName(const std::string& link_name) const
+{
+  return (link_name == tree_->root_link_name && !link_name.empty()) ||
+         (tree_->link_indices.find(link_name) != tree_->link_indices.end());
+}
+
+Eigen::Isometry3d OFKTStateSnapshot::getLinkTransform(const std::string& link_name) const
+{
+  if (link_name == tree_->root_link_name && !link_name.empty())
+    return Eigen::Isometry3d::Identity();
+
+  return link_transforms_[static_cast<std::size_t>(tree_->link_indices.at(link_name))];
+}
+
+Eigen::Isometry3d OFKTStateSnapshot::getRelativeLinkTransform(const std::string& from_link_name,
+                                                              const std::string& to_link_name) const
+{
+  return getLinkTransform(from_link_name).inverse() * getLinkTransform(to_link_name);
+}
+
+void OFKTStateSnapshot::loadActiveNodes(std::vector<char>& active) const
+{
+  // The nodes are in depth first order, so the parent of a node is always checked before the node
+  active.assign(tree_->size(), 0);
+  for (std::size_t i = 0; i < tree_->size(); ++i)
+  {
+    const long parent_index = tree_->parent_indices[i];
+    const bool parent_active = (parent_index >= 0 && active[static_cast<std::size_t>(parent_index)] != 0);
+    active[i] = static_cast<char>(tree_->jacobian_columns[i] >= 0 || parent_active);
+  }
+}
+
+void OFKTStateSnapshot::update()
+{
+  tree_->applyMimicJoints(joint_values_);
+  link_transforms_.resize(tree_->size());
+  tree_->computeTransforms(link_transforms_, joint_values_);
+}
+
+}  // namespace tesseract_scene_graph
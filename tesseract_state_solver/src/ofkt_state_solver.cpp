@@ -31,12 +31,14 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
 #include <tesseract_state_solver/ofkt/ofkt_nodes.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_common/tracing.h>
 
 namespace tesseract_scene_graph
 {
@@ -64,7 +66,7 @@ struct ofkt_builder : public boost::dfs_visitor<>
     std::string parent_link_name = prefix_ + joint->parent_link_name;
     std::string child_link_name = prefix_ + joint->child_link_name;
 
-    tree_.addNode(*joint, joint_name, parent_link_name, child_link_name, new_joints_limits_);
+    tree_.addNode(*joint, joint_name, parent_link_name, child_link_name, new_joints_limits_, prefix_);
   }
 
 protected:
@@ -73,70 +75,6 @@ protected:
   std::string prefix_;
 };
 
-void OFKTStateSolver::cloneHelper(OFKTStateSolver& cloned, const OFKTNode* node) const
-{
-  OFKTNode* parent_node = cloned.link_map_[node->getLinkName()];
-  for (const OFKTNode* child : node->getChildren())
-  {
-    if (child->getType() == tesseract_scene_graph::JointType::FIXED)
-    {
-      auto n = std::make_unique<OFKTFixedNode>(
-          parent_node, child->getLinkName(), child->getJointName(), child->getStaticTransformation());
-      cloned.link_map_[child->getLinkName()] = n.get();
-      parent_node->addChild(n.get());
-      cloned.nodes_[child->getJointName()] = std::move(n);
-    }
-    else if (child->getType() == tesseract_scene_graph::JointType::REVOLUTE)
-    {
-      const auto* cn = static_cast<const OFKTRevoluteNode*>(child);
-
-      auto n = std::make_unique<OFKTRevoluteNode>(
-          parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
-
-      cloned.link_map_[cn->getLinkName()] = n.get();
-      parent_node->addChild(n.get());
-      cloned.nodes_[cn->getJointName()] = std::move(n);
-    }
-    else if (child->getType() == tesseract_scene_graph::JointType::CONTINUOUS)
-    {
-      const auto* cn = static_cast<const OFKTContinuousNode*>(child);
-
-      auto n = std::make_unique<OFKTContinuousNode>(
-          parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
-
-      cloned.link_map_[cn->getLinkName()] = n.get();
-      parent_node->addChild(n.get());
-      cloned.nodes_[cn->getJointName()] = std::move(n);
-    }
-    else if (child->getType() == tesseract_scene_graph::JointType::PRISMATIC)
-    {
-      const auto* cn = static_cast<const OFKTPrismaticNode*>(child);
-
-      auto n = std::make_unique<OFKTPrismaticNode>(
-          parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
-
-      cloned.link_map_[cn->getLinkName()] = n.get();
-      parent_node->addChild(n.get());
-      cloned.nodes_[cn->getJointName()] = std::move(n);
-    }
-    else
-    {
-      throw std::runtime_error("Unsupported OFKTNode type!");  // LCOV_EXCL_LINE
-    }
-
-    cloneHelper(cloned, child);
-  }
-}
-
 OFKTStateSolver::OFKTStateSolver(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix)
 {
   initHelper(scene_graph, prefix);
@@ -148,21 +86,33 @@ OFKTStateSolver::OFKTStateSolver(const std::string& root_name)
   link_map_[root_name] = root_.get();
   link_names_ = { root_name };
   current_state_.link_transforms[root_name] = root_->getWorldTransformation();
+  compile();
 }
 
 OFKTStateSolver::OFKTStateSolver(const OFKTStateSolver& other) { *this = other; }
 
 OFKTStateSolver& OFKTStateSolver::operator=(const OFKTStateSolver& other)
 {
+  if (this == &other)
+    return *this;
+
   current_state_ = other.current_state_;
   joint_names_ = other.joint_names_;
   active_joint_names_ = other.active_joint_names_;
   link_names_ = other.link_names_;
-  root_ = std::make_unique<OFKTRootNode>(other.root_->getLinkName());
-  link_map_[other.root_->getLinkName()] = root_.get();
   limits_ = other.limits_;
   revision_ = other.revision_;
-  cloneHelper(*this, other.root_.get());
+  mimic_joints_ = other.mimic_joints_;
+
+  // The compiled tree, joint values and world transforms are shared and copied by whichever solver changes them first.
+  // The nodes are only rebuilt from the compiled tree if the structure of this solver is changed.
+  nodes_.clear();
+  link_map_.clear();
+  root_ = nullptr;
+  snapshot_ = other.snapshot_;
+  snapshot_shared_ = true;
+  other.snapshot_shared_ = true;
+  loadStateEntries();
   return *this;
 }
 
@@ -196,83 +146,176 @@ void OFKTStateSolver::clear()
   link_map_.clear();
   limits_ = tesseract_common::KinematicLimits();
   root_ = nullptr;
+  mimic_joints_.clear();
+  snapshot_ = std::make_shared<OFKTStateSnapshot>();
+  snapshot_shared_ = false;
+  state_link_transforms_.clear();
+  state_joint_transforms_.clear();
+  state_joint_values_.clear();
+  dirty_nodes_.clear();
 }
 
 void OFKTStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::setState");
   std::unique_lock<std::shared_mutex> lock(mutex_);
   assert(active_joint_names_.size() == static_cast<std::size_t>(joint_values.size()));
-  Eigen::VectorXd jv = joint_values;
+  OFKTStateSnapshot& snapshot = mutableSnapshot();
   for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
   {
-    nodes_[active_joint_names_[i]]->storeJointValue(joint_values(static_cast<long>(i)));
+    const auto idx = static_cast<std::size_t>(snapshot.tree_->active_joint_indices[i]);
+    snapshot.joint_values_[idx] = joint_values(static_cast<long>(i));
     current_state_.joints[active_joint_names_[i]] = joint_values(static_cast<long>(i));
   }
 
-  update(root_.get(), false);
+  update();
 }
 
 void OFKTStateSolver::setState(const std::unordered_map<std::string, double>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::setState");
   std::unique_lock<std::shared_mutex> lock(mutex_);
-
+  OFKTStateSnapshot& snapshot = mutableSnapshot();
   for (const auto& joint : joint_values)
   {
-    nodes_[joint.first]->storeJointValue(joint.second);
+    const auto idx = static_cast<std::size_t>(snapshot.tree_->joint_indices.at(joint.first));
+    snapshot.joint_values_[idx] = joint.second;
     current_state_.joints[joint.first] = joint.second;
   }
 
-  update(root_.get(), false);
+  update();
 }
 
 void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
                                const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::setState");
   std::unique_lock<std::shared_mutex> lock(mutex_);
   assert(joint_names.size() == static_cast<std::size_t>(joint_values.size()));
-  Eigen::VectorXd jv = joint_values;
+  OFKTStateSnapshot& snapshot = mutableSnapshot();
   for (std::size_t i = 0; i < joint_names.size(); ++i)
   {
-    nodes_[joint_names[i]]->storeJointValue(joint_values(static_cast<long>(i)));
+    const auto idx = static_cast<std::size_t>(snapshot.tree_->joint_indices.at(joint_names[i]));
+    snapshot.joint_values_[idx] = joint_values(static_cast<long>(i));
     current_state_.joints[joint_names[i]] = joint_values(static_cast<long>(i));
   }
 
-  update(root_.get(), false);
+  update();
 }
 
-SceneState OFKTStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+void OFKTStateSolver::setState(const std::vector<long>& joint_indices,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                               const OFKTLinkChangedFn& changed)
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::setState");
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  assert(joint_indices.size() == static_cast<std::size_t>(joint_values.size()));
+  OFKTStateSnapshot& snapshot = mutableSnapshot();
+  const OFKTCompiledTree& tree = *snapshot.tree_;
+  const auto size = static_cast<long>(tree.size());
+  long first = size;
+  long last = -1;
+  for (std::size_t i = 0; i < joint_indices.size(); ++i)
+  {
+    const long index = joint_indices[i];
+    assert(index >= 0 && index < size);
+    const auto idx = static_cast<std::size_t>(index);
+    const double value = joint_values(static_cast<long>(i));
+    if (snapshot.joint_values_[idx] == value)
+      continue;
+
+    snapshot.joint_values_[idx] = value;
+    if (state_joint_values_[idx] != nullptr)
+      *state_joint_values_[idx] = value;
+
+    dirty_nodes_[idx] = 1;
+    first = std::min(first, index);
+    last = std::max(last, index);
+  }
+
+  // The mimic joints are in the order they are resolved, so a mimic joint following another is updated after it
+  for (std::size_t i = 0; i < tree.mimic_indices.size(); ++i)
+  {
+    const long index = tree.mimic_indices[i];
+    const auto idx = static_cast<std::size_t>(index);
+    const double driver_value = snapshot.joint_values_[static_cast<std::size_t>(tree.mimic_driver_indices[i])];
+    const double value = (tree.mimic_multipliers[i] * driver_value) + tree.mimic_offsets[i];
+    if (snapshot.joint_values_[idx] == value)
+      continue;
+
+    snapshot.joint_values_[idx] = value;
+    if (state_joint_values_[idx] != nullptr)
+      *state_joint_values_[idx] = value;
+
+    dirty_nodes_[idx] = 1;
+    first = std::min(first, index);
+    last = std::max(last, index);
+  }
+
+  // The descendants of a node directly follow it in the compiled tree, so each dirty subtree is a contiguous range of
+  // nodes and all their parents are either up to date or recomputed before them
+  long end = first;
+  for (long i = first; i < size && (i < end || i <= last); ++i)
+  {
+    const auto idx = static_cast<std::size_t>(i);
+    if (dirty_nodes_[idx] != 0)
+    {
+      dirty_nodes_[idx] = 0;
+      end = std::max(end, tree.subtree_ends[idx]);
+    }
+
+    if (i >= end)
+      continue;
+
+    tree.computeTransform(snapshot.link_transforms_, idx, snapshot.joint_values_[idx]);
+    *state_link_transforms_[idx] = snapshot.link_transforms_[idx];
+    *state_joint_transforms_[idx] = snapshot.link_transforms_[idx];
+    if (changed)
+      changed(i, snapshot.link_transforms_[idx], snapshot.joint_values_[idx]);
+  }
+}
+
+std::vector<long> OFKTStateSolver::getJointIndices(const std::vector<std::string>& joint_names) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
-  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
-    state.joints[active_joint_names_[i]] = joint_values[static_cast<long>(i)];
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  std::vector<long> joint_indices;
+  joint_indices.reserve(joint_names.size());
+  for (const auto& joint_name : joint_names)
+    joint_indices.push_back(tree.joint_indices.at(joint_name));
 
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+  return joint_indices;
 }
 
-SceneState OFKTStateSolver::getState(const std::unordered_map<std::string, double>& joint_values) const
+SceneState OFKTStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  auto state = SceneState(current_state_);
-  for (const auto& joint : joint_values)
-    state.joints[joint.first] = joint.second;
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getState");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getState(joint_values);
+}
 
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+SceneState OFKTStateSolver::getState(const std::unordered_map<std::string, double>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getState");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getState(joint_values);
 }
 
 SceneState OFKTStateSolver::getState(const std::vector<std::string>& joint_names,
                                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getState");
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
-  for (std::size_t i = 0; i < joint_names.size(); ++i)
-    state.joints[joint_names[i]] = joint_values[static_cast<long>(i)];
+  return snapshot_->getState(joint_names, joint_values);
+}
 
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+void OFKTStateSolver::getState(SceneState& state,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getState");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  snapshot_->getState(state, joint_names, joint_values);
 }
 
 SceneState OFKTStateSolver::getState() const
@@ -281,32 +324,54 @@ SceneState OFKTStateSolver::getState() const
   return current_state_;
 }
 
+std::vector<tesseract_common::TransformMap>
+OFKTStateSolver::getLinkTransforms(const std::vector<std::string>& joint_names,
+                                   const tesseract_common::TrajArray& traj,
+                                   const std::vector<std::string>& link_names,
+                                   std::size_t threads) const
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getLinkTransforms");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getLinkTransforms(joint_names, traj, link_names, threads);
+}
+
+void OFKTStateSolver::getLinkTransforms(tesseract_common::TransformMap& link_transforms,
+                                        const std::vector<std::string>& link_names,
+                                        const std::vector<std::string>& joint_names,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getLinkTransforms");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  snapshot_->getLinkTransforms(link_transforms, link_names, joint_names, joint_values);
+}
+
+void OFKTStateSolver::getLinkTransforms(tesseract_common::LinkTransforms& link_transforms,
+                                        const std::vector<std::string>& joint_names,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  TESSERACT_TRACE_ZONE("OFKTStateSolver::getLinkTransforms");
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  snapshot_->getLinkTransforms(link_transforms, joint_names, joint_values);
+}
+
 SceneState OFKTStateSolver::getRandomState() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return getState(active_joint_names_, tesseract_common::generateRandomNumber(limits_.joint_limits));
+  return snapshot_->getState(active_joint_names_, tesseract_common::generateRandomNumber(limits_.joint_limits));
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                                              const std::string& link_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
-  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
-    joints[active_joint_names_[static_cast<std::size_t>(i)]] = joint_values[i];
-
-  return calcJacobianHelper(joints, link_name);
+  return snapshot_->getJacobian(joint_values, link_name);
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const std::unordered_map<std::string, double>& joints_values,
                                              const std::string& link_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
-  for (const auto& joint : joints_values)
-    joints[joint.first] = joint.second;
-
-  return calcJacobianHelper(joints, link_name);
+  return snapshot_->getJacobian(joints_values, link_name);
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const std::vector<std::string>& joint_names,
@@ -314,45 +379,45 @@ Eigen::MatrixXd OFKTStateSolver::getJacobian(const std::vector<std::string>& joi
                                              const std::string& link_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
-  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
-    joints[joint_names[static_cast<std::size_t>(i)]] = joint_values[i];
+  return snapshot_->getJacobian(joint_names, joint_values, link_name);
+}
 
-  return calcJacobianHelper(joints, link_name);
+void OFKTStateSolver::getJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                  const std::string& link_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  snapshot_->getJacobian(jacobian, joint_values, link_name);
 }
 
-Eigen::MatrixXd OFKTStateSolver::calcJacobianHelper(const std::unordered_map<std::string, double>& joints,
-                                                    const std::string& link_name) const
+std::vector<Eigen::MatrixXd> OFKTStateSolver::getJacobians(const std::vector<std::string>& joint_names,
+                                                           const tesseract_common::TrajArray& traj,
+                                                           const std::string& link_name) const
 {
-  OFKTNode* node = link_map_.at(link_name);
-  Eigen::MatrixXd jacobian = Eigen::MatrixXd::Zero(6, static_cast<Eigen::Index>(active_joint_names_.size()));
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getJacobians(joint_names, traj, link_name);
+}
 
-  Eigen::Isometry3d total_tf = Eigen::Isometry3d::Identity();
-  while (node != root_.get())
-  {
-    if (node->getType() == JointType::FIXED || node->getType() == JointType::FLOATING)
-    {
-      total_tf = node->getLocalTransformation() * total_tf;
-    }
-    else
-    {
-      Eigen::Isometry3d local_tf = node->computeLocalTransformation(joints.at(node->getJointName()));
-      total_tf = local_tf * total_tf;
-
-      Eigen::Index idx =
-          std::distance(active_joint_names_.begin(),
-                        std::find(active_joint_names_.begin(), active_joint_names_.end(), node->getJointName()));
-      Eigen::VectorXd twist = node->getLocalTwist();
-      tesseract_common::twistChangeRefPoint(twist, total_tf.translation() - local_tf.translation());
-      tesseract_common::twistChangeBase(twist, total_tf.inverse());
-      jacobian.col(idx) = twist;
-    }
+std::vector<Eigen::MatrixXd> OFKTStateSolver::getJacobianHessian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                                                 const std::string& link_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getJacobianHessian(joint_values, link_name);
+}
 
-    node = node->getParent();
-  }
+Eigen::MatrixXd OFKTStateSolver::getJacobianDerivative(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                                       const Eigen::Ref<const Eigen::VectorXd>& joint_velocities,
+                                                       const std::string& link_name) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return snapshot_->getJacobianDerivative(joint_values, joint_velocities, link_name);
+}
 
-  tesseract_common::jacobianChangeBase(jacobian, total_tf);
-  return jacobian;
+OFKTStateSnapshot::ConstPtr OFKTStateSolver::getSnapshot() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  snapshot_shared_ = true;
+  return snapshot_;
 }
 
 std::vector<std::string> OFKTStateSolver::getJointNames() const
@@ -370,7 +435,7 @@ std::vector<std::string> OFKTStateSolver::getActiveJointNames() const
 std::string OFKTStateSolver::getBaseLinkName() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return root_->getLinkName();
+  return snapshot_->getBaseLinkName();
 }
 
 std::vector<std::string> OFKTStateSolver::getLinkNames() const
@@ -382,26 +447,19 @@ std::vector<std::string> OFKTStateSolver::getLinkNames() const
 std::vector<std::string> OFKTStateSolver::getActiveLinkNames() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::vector<std::string> link_names;
-  link_names.reserve(nodes_.size());
-  loadActiveLinkNamesRecursive(link_names, root_.get(), false);
-  return link_names;
+  return snapshot_->getActiveLinkNames();
 }
 
 std::vector<std::string> OFKTStateSolver::getStaticLinkNames() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::vector<std::string> link_names;
-  link_names.reserve(nodes_.size());
-  loadStaticLinkNamesRecursive(link_names, root_.get());
-  return link_names;
+  return snapshot_->getStaticLinkNames();
 }
 
 bool OFKTStateSolver::isActiveLinkName(const std::string& link_name) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::vector<std::string> active_link_names = getActiveLinkNames();
-  return (std::find(active_link_names.begin(), active_link_names.end(), link_name) != active_link_names.end());
+  return snapshot_->isActiveLinkName(link_name);
 }
 
 bool OFKTStateSolver::hasLinkName(const std::string& link_name) const
@@ -440,6 +498,7 @@ tesseract_common::KinematicLimits OFKTStateSolver::getLimits() const
 bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   if (link_map_.find(link.getName()) != link_map_.end())
   {
     return false;
@@ -454,7 +513,8 @@ bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
   addNode(joint, joint.getName(), joint.parent_link_name, joint.child_link_name, new_joint_limits);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -467,6 +527,7 @@ bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
 bool OFKTStateSolver::replaceJoint(const Joint& joint)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   auto it = nodes_.find(joint.getName());
   if (it == nodes_.end())
   {
@@ -493,7 +554,8 @@ bool OFKTStateSolver::replaceJoint(const Joint& joint)
   replaceJointHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -501,6 +563,7 @@ bool OFKTStateSolver::replaceJoint(const Joint& joint)
 bool OFKTStateSolver::moveLink(const Joint& joint)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
 
   if (link_map_.find(joint.child_link_name) == link_map_.end())
   {
@@ -519,7 +582,8 @@ bool OFKTStateSolver::moveLink(const Joint& joint)
   moveLinkHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -527,6 +591,7 @@ bool OFKTStateSolver::moveLink(const Joint& joint)
 bool OFKTStateSolver::removeLink(const std::string& name)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   auto it = link_map_.find(name);
   if (it == link_map_.end())
   {
@@ -551,7 +616,8 @@ bool OFKTStateSolver::removeLink(const std::string& name)
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -559,6 +625,7 @@ bool OFKTStateSolver::removeLink(const std::string& name)
 bool OFKTStateSolver::removeJoint(const std::string& name)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   auto it = nodes_.find(name);
   if (it == nodes_.end())
   {
@@ -583,7 +650,8 @@ bool OFKTStateSolver::removeJoint(const std::string& name)
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -591,6 +659,7 @@ bool OFKTStateSolver::removeJoint(const std::string& name)
 bool OFKTStateSolver::moveJoint(const std::string& name, const std::string& parent_link)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   auto it = nodes_.find(name);
   if (it == nodes_.end())
   {
@@ -612,7 +681,8 @@ bool OFKTStateSolver::moveJoint(const std::string& name, const std::string& pare
   n->setParent(new_parent);
   new_parent->addChild(n.get());
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -620,6 +690,7 @@ bool OFKTStateSolver::moveJoint(const std::string& name, const std::string& pare
 bool OFKTStateSolver::changeJointOrigin(const std::string& name, const Eigen::Isometry3d& new_origin)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   auto it = nodes_.find(name);
   if (it == nodes_.end())
   {
@@ -629,7 +700,8 @@ bool OFKTStateSolver::changeJointOrigin(const std::string& name, const Eigen::Is
 
   it->second->setStaticTransformation(new_origin);
 
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -637,8 +709,8 @@ bool OFKTStateSolver::changeJointOrigin(const std::string& name, const Eigen::Is
 bool OFKTStateSolver::changeJointPositionLimits(const std::string& name, double lower, double upper)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  auto it = nodes_.find(name);
-  if (it == nodes_.end())
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  if (tree.joint_indices.find(name) == tree.joint_indices.end())
   {
     CONSOLE_BRIDGE_logError("OFKTStateSolver, tried to change joint '%s' positioner limits which does not exist!",
                             name.c_str());
@@ -655,8 +727,8 @@ bool OFKTStateSolver::changeJointPositionLimits(const std::string& name, double
 bool OFKTStateSolver::changeJointVelocityLimits(const std::string& name, double limit)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  auto it = nodes_.find(name);
-  if (it == nodes_.end())
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  if (tree.joint_indices.find(name) == tree.joint_indices.end())
   {
     CONSOLE_BRIDGE_logError("OFKTStateSolver, tried to change joint '%s' positioner limits which does not exist!",
                             name.c_str());
@@ -672,8 +744,8 @@ bool OFKTStateSolver::changeJointVelocityLimits(const std::string& name, double
 bool OFKTStateSolver::changeJointAccelerationLimits(const std::string& name, double limit)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  auto it = nodes_.find(name);
-  if (it == nodes_.end())
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  if (tree.joint_indices.find(name) == tree.joint_indices.end())
   {
     CONSOLE_BRIDGE_logError("OFKTStateSolver, tried to change joint '%s' positioner limits which does not exist!",
                             name.c_str());
@@ -689,6 +761,7 @@ bool OFKTStateSolver::changeJointAccelerationLimits(const std::string& name, dou
 bool OFKTStateSolver::insertSceneGraph(const SceneGraph& scene_graph, const Joint& joint, const std::string& prefix)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  loadNodes();
   if (root_ == nullptr)
     return false;  // LCOV_EXCL_LINE
 
@@ -737,102 +810,211 @@ bool OFKTStateSolver::insertSceneGraph(const SceneGraph& scene_graph, const Join
   // Populate Joint Limits
   addNewJointLimits(new_joints_limits);
 
-  update(root_.get(), false);
+  compile();
+  update();
   return true;
 }
 
-void OFKTStateSolver::loadActiveLinkNamesRecursive(std::vector<std::string>& active_link_names,
-                                                   const OFKTNode* node,
-                                                   bool active) const
+void OFKTStateSolver::compile()
 {
-  if (active)
+  auto tree = std::make_shared<OFKTCompiledTree>();
+  std::vector<double> joint_values;
+  if (root_ != nullptr)
   {
-    active_link_names.push_back(node->getLinkName());
-    for (const auto* child : node->getChildren())
-      loadActiveLinkNamesRecursive(active_link_names, child, active);
+    tree->root_link_name = root_->getLinkName();
+    tree->joint_types.reserve(nodes_.size());
+    joint_values.reserve(nodes_.size());
+    for (const auto* child : root_->getChildren())
+      compileHelper(*tree, joint_values, child, -1);
+
+    compileMimicJoints(*tree);
+
+    tree->active_joint_indices.reserve(active_joint_names_.size());
+    tree->jacobian_columns.assign(tree->size(), -1);
+    for (const auto& joint_name : active_joint_names_)
+    {
+      const long index = tree->joint_indices.at(joint_name);
+      tree->jacobian_columns[static_cast<std::size_t>(index)] = static_cast<long>(tree->active_joint_indices.size());
+      tree->active_joint_indices.push_back(index);
+    }
   }
-  else
+
+  // The previous snapshot is left untouched for anyone still holding it
+  snapshot_ = std::make_shared<OFKTStateSnapshot>(std::move(tree), std::move(joint_values));
+  snapshot_shared_ = false;
+  loadStateEntries();
+}
+
+void OFKTStateSolver::compileMimicJoints(OFKTCompiledTree& tree) const
+{
+  // The number of mimic joints each mimic joint follows through others, so they are added after those
+  std::vector<std::pair<std::size_t, const std::string*>> mimic_order;
+  mimic_order.reserve(mimic_joints_.size());
+  for (const auto& mimic_joint : mimic_joints_)
   {
-    if (node->getType() == tesseract_scene_graph::JointType::FIXED ||
-        node->getType() == tesseract_scene_graph::JointType::FLOATING)
+    std::size_t depth{ 0 };
+    for (auto it = mimic_joints_.find(mimic_joint.second.joint_name); it != mimic_joints_.end();
+         it = mimic_joints_.find(it->second.joint_name))
     {
-      for (const auto* child : node->getChildren())
-        loadActiveLinkNamesRecursive(active_link_names, child, active);
+      if (++depth > mimic_joints_.size())
+        throw std::runtime_error("OFKTStateSolver: Mimic joint '" + mimic_joint.first + "' mimics itself!");
     }
-    else
+
+    mimic_order.emplace_back(depth, &mimic_joint.first);
+  }
+
+  std::sort(mimic_order.begin(), mimic_order.end(), [](const auto& lhs, const auto& rhs) {
+    return (lhs.first == rhs.first) ? (*lhs.second < *rhs.second) : (lhs.first < rhs.first);
+  });
+
+  // A mimic joint of a joint that does not exist or is fixed moves independently
+  for (const auto& entry : mimic_order)
+  {
+    const JointMimic& mimic = mimic_joints_.at(*entry.second);
+    auto driver_it = tree.joint_indices.find(mimic.joint_name);
+    if (driver_it == tree.joint_indices.end() ||
+        tree.joint_types[static_cast<std::size_t>(driver_it->second)] == JointType::FIXED)
     {
-      active_link_names.push_back(node->getLinkName());
-      for (const auto* child : node->getChildren())
-        loadActiveLinkNamesRecursive(active_link_names, child, true);
+      CONSOLE_BRIDGE_logWarn("OFKTStateSolver: Mimic joint '%s' follows joint '%s' which is missing or fixed",
+                             entry.second->c_str(),
+                             mimic.joint_name.c_str());
+      continue;
     }
+
+    tree.addMimicJoint(tree.joint_indices.at(*entry.second), driver_it->second, mimic.multiplier, mimic.offset);
   }
 }
 
-void OFKTStateSolver::loadStaticLinkNamesRecursive(std::vector<std::string>& static_link_names,
-                                                   const OFKTNode* node) const
+void OFKTStateSolver::compileHelper(OFKTCompiledTree& tree,
+                                    std::vector<double>& joint_values,
+                                    const OFKTNode* node,
+                                    long parent_index)
 {
-  if (node->getType() == tesseract_scene_graph::JointType::FIXED ||
-      node->getType() == tesseract_scene_graph::JointType::FLOATING)
+  Eigen::Vector3d axis = Eigen::Vector3d::Zero();
+  double joint_value{ 0 };
+  switch (node->getType())
   {
-    static_link_names.push_back(node->getLinkName());
-    for (const auto* child : node->getChildren())
-      loadStaticLinkNamesRecursive(static_link_names, child);
+    case JointType::REVOLUTE:
+      axis = static_cast<const OFKTRevoluteNode*>(node)->getAxis();
+      joint_value = current_state_.joints.at(node->getJointName());
+      break;
+    case JointType::CONTINUOUS:
+      axis = static_cast<const OFKTContinuousNode*>(node)->getAxis();
+      joint_value = current_state_.joints.at(node->getJointName());
+      break;
+    case JointType::PRISMATIC:
+      axis = static_cast<const OFKTPrismaticNode*>(node)->getAxis();
+      joint_value = current_state_.joints.at(node->getJointName());
+      break;
+    default:
+      break;
   }
+
+  long index = tree.addNode(
+      node->getType(), axis, parent_index, node->getStaticTransformation(), node->getLinkName(), node->getJointName());
+  joint_values.push_back(joint_value);
+
+  for (const auto* child : node->getChildren())
+    compileHelper(tree, joint_values, child, index);
 }
 
-void OFKTStateSolver::update(OFKTNode* node, bool update_required)
+void OFKTStateSolver::loadStateEntries()
 {
-  if (node->hasJointValueChanged())
+  // Map entries are not invalidated by inserting other entries, so they can be written without a lookup
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  state_link_transforms_.clear();
+  state_joint_transforms_.clear();
+  state_joint_values_.clear();
+  state_link_transforms_.reserve(tree.size());
+  state_joint_transforms_.reserve(tree.size());
+  state_joint_values_.reserve(tree.size());
+  for (std::size_t i = 0; i < tree.size(); ++i)
   {
-    node->computeAndStoreLocalTransformation();
-    update_required = true;
+    state_link_transforms_.push_back(&current_state_.link_transforms[tree.link_names[i]]);
+    state_joint_transforms_.push_back(&current_state_.joint_transforms[tree.joint_names[i]]);
+    auto it = current_state_.joints.find(tree.joint_names[i]);
+    state_joint_values_.push_back((it == current_state_.joints.end()) ? nullptr : &it->second);
   }
+  dirty_nodes_.assign(tree.size(), 0);
+}
 
-  if (node->updateWorldTransformationRequired())
-    update_required = true;
-
-  if (update_required)
+void OFKTStateSolver::loadNodes()
+{
+  const OFKTCompiledTree& tree = snapshot_->getCompiledTree();
+  if (root_ != nullptr || tree.root_link_name.empty())
+    return;
+
+  // The nodes are in depth first order, so the parent of a node is always created before the node
+  root_ = std::make_unique<OFKTRootNode>(tree.root_link_name);
+  link_map_[tree.root_link_name] = root_.get();
+  std::vector<OFKTNode*> tree_nodes;
+  tree_nodes.reserve(tree.size());
+  for (std::size_t i = 0; i < tree.size(); ++i)
   {
-    node->computeAndStoreWorldTransformation();
-    current_state_.link_transforms[node->getLinkName()] = node->getWorldTransformation();
-    current_state_.joint_transforms[node->getJointName()] = node->getWorldTransformation();
-  }
+    const long parent_index = tree.parent_indices[i];
+    OFKTNode* parent_node = (parent_index < 0) ? root_.get() : tree_nodes[static_cast<std::size_t>(parent_index)];
+    const std::string& link_name = tree.link_names[i];
+    const std::string& joint_name = tree.joint_names[i];
+
+    OFKTNode::UPtr n;
+    switch (tree.joint_types[i])
+    {
+      case JointType::FIXED:
+        n = std::make_unique<OFKTFixedNode>(parent_node, link_name, joint_name, tree.static_transforms[i]);
+        break;
+      case JointType::REVOLUTE:
+        n = std::make_unique<OFKTRevoluteNode>(
+            parent_node, link_name, joint_name, tree.static_transforms[i], tree.axes[i]);
+        break;
+      case JointType::CONTINUOUS:
+        n = std::make_unique<OFKTContinuousNode>(
+            parent_node, link_name, joint_name, tree.static_transforms[i], tree.axes[i]);
+        break;
+      case JointType::PRISMATIC:
+        n = std::make_unique<OFKTPrismaticNode>(
+            parent_node, link_name, joint_name, tree.static_transforms[i], tree.axes[i]);
+        break;
+      default:
+        throw std::runtime_error("Unsupported OFKTNode type!");  // LCOV_EXCL_LINE
+    }
 
-  for (auto* child : node->getChildren())
-    update(child, update_required);
+    parent_node->addChild(n.get());
+    link_map_[link_name] = n.get();
+    tree_nodes.push_back(n.get());
+    nodes_[joint_name] = std::move(n);
+  }
 }
 
-void OFKTStateSolver::update(SceneState& state,
-                             const OFKTNode* node,
-                             Eigen::Isometry3d parent_world_tf,
-                             bool update_required) const
+void OFKTStateSolver::update()
 {
-  if (node->getType() != tesseract_scene_graph::JointType::FIXED)
+  OFKTStateSnapshot& snapshot = mutableSnapshot();
+  snapshot.update();
+  for (std::size_t i = 0; i < snapshot.link_transforms_.size(); ++i)
   {
-    double jv = state.joints[node->getJointName()];
-    if (!tesseract_common::almostEqualRelativeAndAbs(node->getJointValue(), jv, 1e-8))
-    {
-      parent_world_tf = parent_world_tf * node->computeLocalTransformation(jv);
-      update_required = true;
-    }
-    else
-    {
-      parent_world_tf = parent_world_tf * node->getLocalTransformation();
-    }
+    *state_link_transforms_[i] = snapshot.link_transforms_[i];
+    *state_joint_transforms_[i] = snapshot.link_transforms_[i];
   }
-  else
+
+  // The mimic joint values were derived from the joints they follow
+  for (const long index : snapshot.tree_->mimic_indices)
   {
-    parent_world_tf = parent_world_tf * node->getLocalTransformation();
+    const auto idx = static_cast<std::size_t>(index);
+    if (state_joint_values_[idx] != nullptr)
+      *state_joint_values_[idx] = snapshot.joint_values_[idx];
   }
+}
 
-  if (update_required)
+OFKTStateSnapshot& OFKTStateSolver::mutableSnapshot()
+{
+  // A snapshot handed out by getSnapshot must never change, so it is copied before the first change after that. The
+  // copy shares the compiled tree and only duplicates the joint values and world transforms.
+  if (snapshot_shared_)
   {
-    state.link_transforms[node->getLinkName()] = parent_world_tf;
-    state.joint_transforms[node->getJointName()] = parent_world_tf;
+    snapshot_ = std::make_shared<OFKTStateSnapshot>(*snapshot_);
+    snapshot_shared_ = false;
   }
 
-  for (const auto* child : node->getChildren())
-    update(state, child, parent_world_tf, update_required);
+  return *snapshot_;
 }
 
 bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix)
@@ -872,7 +1054,8 @@ bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_
   addNewJointLimits(new_joints_limits);
 
   // Update transforms
-  update(root_.get(), false);
+  compile();
+  update();
 
   return true;
 }
@@ -917,20 +1100,22 @@ void OFKTStateSolver::moveLinkHelper(std::vector<JointLimits::ConstPtr>& new_joi
     child->setParent(replaced_node.get());
   }
 
-  update(replaced_node.get(), true);
 }
 
 void OFKTStateSolver::replaceJointHelper(std::vector<JointLimits::ConstPtr>& new_joint_limits, const Joint& joint)
 {
   auto& n = nodes_[joint.getName()];
 
-  if (n->getType() == joint.type && n->getParent()->getLinkName() == joint.parent_link_name)
+  // A fixed joint has no limits or state, so it is re-parented in place, like attaching or detaching an object
+  if (n->getType() == joint.type &&
+      (joint.type == JointType::FIXED || n->getParent()->getLinkName() == joint.parent_link_name))
   {
     n->getParent()->removeChild(n.get());
     n->setStaticTransformation(joint.parent_to_joint_origin_transform);
     OFKTNode* new_parent = link_map_[joint.parent_link_name];
     n->setParent(new_parent);
     new_parent->addChild(n.get());
+    setMimicJoint(joint, joint.getName(), "");
   }
   else
   {
@@ -954,6 +1139,9 @@ void OFKTStateSolver::removeJointHelper(const std::vector<std::string>& removed_
                       link_names_.end());
   }
 
+  for (const auto& removed_joint : removed_joints)
+    mimic_joints_.erase(removed_joint);
+
   if (!removed_joints.empty())
   {
     joint_names_.erase(std::remove_if(joint_names_.begin(),
@@ -1002,8 +1190,10 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
                               const std::string& joint_name,
                               const std::string& parent_link_name,
                               const std::string& child_link_name,
-                              std::vector<JointLimits::ConstPtr>& new_joint_limits)
+                              std::vector<JointLimits::ConstPtr>& new_joint_limits,
+                              const std::string& prefix)
 {
+  setMimicJoint(joint, joint_name, prefix);
   switch (joint.type)
   {
     case tesseract_scene_graph::JointType::FIXED:
@@ -1084,6 +1274,18 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
   }
 }
 
+void OFKTStateSolver::setMimicJoint(const Joint& joint, const std::string& joint_name, const std::string& prefix)
+{
+  if (joint.mimic == nullptr || joint.type == JointType::FIXED)
+  {
+    mimic_joints_.erase(joint_name);
+    return;
+  }
+
+  const JointMimic& mimic = *joint.mimic;
+  mimic_joints_[joint_name] = JointMimic(mimic.offset, mimic.multiplier, prefix + mimic.joint_name);
+}
+
 void OFKTStateSolver::removeNode(OFKTNode* node,
                                  std::vector<std::string>& removed_links,
                                  std::vector<std::string>& removed_joints,
@@ -1104,8 +1306,9 @@ void OFKTStateSolver::removeNode(OFKTNode* node,
   current_state_.joints.erase(node->getJointName());
   current_state_.joint_transforms.erase(node->getJointName());
 
+  // Removing a child modifies the children of the node, so iterate over a copy
   std::vector<OFKTNode*> children = node->getChildren();
-  for (auto* child : node->getChildren())
+  for (auto* child : children)
     removeNode(child, removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
 
   if (node->getParent() != nullptr)
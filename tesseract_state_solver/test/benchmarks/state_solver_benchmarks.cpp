@@ -0,0 +1,345 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_state_solver/kdl/kdl_state_solver.h>
+#include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
+#include <tesseract_urdf/urdf_parser.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_scene_graph;
+
+/** @brief The tesseract_support robot models the benchmarks are run with */
+struct RobotInfo
+{
+  /** @brief The name used in the benchmark names */
+  std::string name;
+  /** @brief The urdf file path */
+  std::string urdf_path;
+  /** @brief The link used for the jacobian and structural benchmarks */
+  std::string tip_link_name;
+};
+
+std::vector<RobotInfo> getRobots()
+{
+  const std::string urdf_dir = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/";
+  return { { "ABB_IRB2400", urdf_dir + "abb_irb2400.urdf", "tool0" },
+           { "KUKA_IIWA_14", urdf_dir + "lbr_iiwa_14_r820.urdf", "tool0" },
+           { "KUKA_IIWA_7", urdf_dir + "iiwa7.urdf", "link_ee" } };
+}
+
+SceneGraph::Ptr getSceneGraph(const RobotInfo& robot)
+{
+  tesseract_common::TesseractSupportResourceLocator locator;
+  SceneGraph::Ptr scene_graph = tesseract_urdf::parseURDFFile(robot.urdf_path, locator);
+  if (scene_graph == nullptr)
+    throw std::runtime_error("Failed to parse urdf for robot: " + robot.name);
+
+  return scene_graph;
+}
+
+/** @brief Get a synthetic tree of 1024 links, 128 chains of 8 revolute joints attached to the root link */
+SceneGraph::Ptr getLargeSceneGraph()
+{
+  const int chains = 128;
+  const int chain_length = 8;
+
+  auto scene_graph = std::make_shared<SceneGraph>("large_tree");
+  scene_graph->addLink(Link("base_link"));
+  for (int i = 0; i < chains; ++i)
+  {
+    std::string parent_link_name = "base_link";
+    for (int j = 0; j < chain_length; ++j)
+    {
+      const std::string suffix = std::to_string(i) + "_" + std::to_string(j);
+      Link link("link_" + suffix);
+      Joint joint("joint_" + suffix);
+      joint.type = JointType::REVOLUTE;
+      joint.parent_link_name = parent_link_name;
+      joint.child_link_name = link.getName();
+      joint.axis = (j % 2 == 0) ? Eigen::Vector3d::UnitZ() : Eigen::Vector3d::UnitY();
+      joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0.01 * i, 0, 0.1);
+      joint.limits = std::make_shared<JointLimits>(-3.0, 3.0, 0.0, 1.0, 1.0);
+      scene_graph->addLink(link, joint);
+      parent_link_name = link.getName();
+    }
+  }
+
+  return scene_graph;
+}
+
+/** @brief Get the joint values at the midpoint of the upper limits of the active joints of the solver */
+Eigen::VectorXd getJointValues(const StateSolver& solver)
+{
+  return 0.5 * solver.getLimits().joint_limits.col(1);
+}
+
+/** @brief Benchmark that checks constructing the solver from a scene graph */
+template <typename S>
+static void BM_CONSTRUCT(benchmark::State& state, SceneGraph::Ptr scene_graph)
+{
+  for (auto _ : state)
+  {
+    S solver(*scene_graph);
+    benchmark::DoNotOptimize(solver);
+  }
+}
+
+/** @brief Benchmark that checks setting the joint values of the solver */
+template <typename S>
+static void BM_SET_STATE(benchmark::State& state,
+                         std::shared_ptr<S> solver,
+                         std::vector<std::string> joint_names,
+                         Eigen::VectorXd joint_values)
+{
+  for (auto _ : state)
+    solver->setState(joint_names, joint_values);
+}
+
+/** @brief Benchmark that checks calculating the state of the solver for a vector of joint values */
+template <typename S>
+static void BM_GET_STATE_VECTOR(benchmark::State& state,
+                                std::shared_ptr<S> solver,
+                                std::vector<std::string> joint_names,
+                                Eigen::VectorXd joint_values)
+{
+  SceneState scene_state;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_state = solver->getState(joint_names, joint_values));
+  }
+}
+
+/** @brief Benchmark that checks calculating the state of the solver for a map of joint values */
+template <typename S>
+static void BM_GET_STATE_MAP(benchmark::State& state,
+                             std::shared_ptr<S> solver,
+                             std::unordered_map<std::string, double> joint_values)
+{
+  SceneState scene_state;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(scene_state = solver->getState(joint_values));
+  }
+}
+
+/** @brief Benchmark that checks calculating the jacobian of a link */
+template <typename S>
+static void BM_GET_JACOBIAN(benchmark::State& state,
+                            std::shared_ptr<S> solver,
+                            std::vector<std::string> joint_names,
+                            Eigen::VectorXd joint_values,
+                            std::string link_name)
+{
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(jacobian = solver->getJacobian(joint_names, joint_values, link_name));
+  }
+}
+
+/** @brief Benchmark that checks cloning the solver */
+template <typename S>
+static void BM_CLONE(benchmark::State& state, std::shared_ptr<S> solver)
+{
+  StateSolver::UPtr clone;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(clone = solver->clone());
+  }
+}
+
+/** @brief Benchmark that checks adding a link to the solver, the link is removed again so each iteration is the same */
+static void BM_ADD_LINK_OFKT(benchmark::State& state, SceneGraph::Ptr scene_graph, std::string parent_link_name)
+{
+  OFKTStateSolver solver(*scene_graph);
+  Link link("benchmark_link");
+  Joint joint("benchmark_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = parent_link_name;
+  joint.child_link_name = link.getName();
+  joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.1);
+  for (auto _ : state)
+  {
+    if (!solver.addLink(link, joint) || !solver.removeLink(link.getName()))
+    {
+      state.SkipWithError("Failed to add link");
+      break;
+    }
+  }
+}
+
+/** @brief Benchmark that checks moving the joint of a link to the root link and back */
+static void BM_MOVE_JOINT_OFKT(benchmark::State& state, SceneGraph::Ptr scene_graph, std::string link_name)
+{
+  OFKTStateSolver solver(*scene_graph);
+  const Joint::ConstPtr joint = scene_graph->getInboundJoints(link_name).front();
+  for (auto _ : state)
+  {
+    if (!solver.moveJoint(joint->getName(), scene_graph->getRoot()) ||
+        !solver.moveJoint(joint->getName(), joint->parent_link_name))
+    {
+      state.SkipWithError("Failed to move joint");
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Benchmark that checks inserting a scene graph into the solver, it is removed again so each iteration is the
+ * same
+ */
+static void BM_INSERT_SCENE_GRAPH_OFKT(benchmark::State& state,
+                                       SceneGraph::Ptr scene_graph,
+                                       SceneGraph::Ptr insert_scene_graph,
+                                       std::string parent_link_name)
+{
+  OFKTStateSolver solver(*scene_graph);
+  const std::string prefix = "benchmark_";
+  Joint joint("benchmark_insert_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = parent_link_name;
+  joint.child_link_name = prefix + insert_scene_graph->getRoot();
+  for (auto _ : state)
+  {
+    if (!solver.insertSceneGraph(*insert_scene_graph, joint, prefix) ||
+        !solver.removeLink(prefix + insert_scene_graph->getRoot()))
+    {
+      state.SkipWithError("Failed to insert scene graph");
+      break;
+    }
+  }
+}
+
+/** @brief Register the benchmarks common to all state solvers */
+template <typename S>
+void registerStateSolverBenchmarks(const std::string& solver_name,
+                                   const std::string& model_name,
+                                   const SceneGraph::Ptr& scene_graph,
+                                   const std::string& tip_link_name)
+{
+  auto solver = std::make_shared<S>(*scene_graph);
+  std::vector<std::string> joint_names = solver->getActiveJointNames();
+  Eigen::VectorXd joint_values = getJointValues(*solver);
+  std::unordered_map<std::string, double> joint_values_map;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+    joint_values_map[joint_names[i]] = joint_values(static_cast<long>(i));
+
+  const std::string suffix = "_" + solver_name + "_" + model_name;
+
+  {
+    std::function<void(benchmark::State&, SceneGraph::Ptr)> BM_CONSTRUCT_FUNC = BM_CONSTRUCT<S>;
+    std::string name = "BM_CONSTRUCT" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_CONSTRUCT_FUNC, scene_graph)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::shared_ptr<S>, std::vector<std::string>, Eigen::VectorXd)>
+        BM_SET_STATE_FUNC = BM_SET_STATE<S>;
+    std::string name = "BM_SET_STATE" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_SET_STATE_FUNC, solver, joint_names, joint_values)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::shared_ptr<S>, std::vector<std::string>, Eigen::VectorXd)>
+        BM_GET_STATE_VECTOR_FUNC = BM_GET_STATE_VECTOR<S>;
+    std::string name = "BM_GET_STATE_VECTOR" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_VECTOR_FUNC, solver, joint_names, joint_values)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::shared_ptr<S>, std::unordered_map<std::string, double>)>
+        BM_GET_STATE_MAP_FUNC = BM_GET_STATE_MAP<S>;
+    std::string name = "BM_GET_STATE_MAP" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_MAP_FUNC, solver, joint_values_map)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::shared_ptr<S>, std::vector<std::string>, Eigen::VectorXd, std::string)>
+        BM_GET_JACOBIAN_FUNC = BM_GET_JACOBIAN<S>;
+    std::string name = "BM_GET_JACOBIAN" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_GET_JACOBIAN_FUNC, solver, joint_names, joint_values, tip_link_name)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, std::shared_ptr<S>)> BM_CLONE_FUNC = BM_CLONE<S>;
+    std::string name = "BM_CLONE" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_CLONE_FUNC, solver)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+}
+
+/**
+ * @brief Register the structural benchmarks, only the OFKTStateSolver can be changed
+ * @details The KDLStateSolver has to be constructed again after a change, which is covered by BM_CONSTRUCT
+ */
+void registerStructureBenchmarks(const std::string& model_name,
+                                 const SceneGraph::Ptr& scene_graph,
+                                 const std::string& tip_link_name)
+{
+  const std::string suffix = "_OFKT_" + model_name;
+
+  {
+    std::function<void(benchmark::State&, SceneGraph::Ptr, std::string)> BM_ADD_LINK_FUNC = BM_ADD_LINK_OFKT;
+    std::string name = "BM_ADD_LINK" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_ADD_LINK_FUNC, scene_graph, tip_link_name)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, SceneGraph::Ptr, std::string)> BM_MOVE_JOINT_FUNC = BM_MOVE_JOINT_OFKT;
+    std::string name = "BM_MOVE_JOINT" + suffix;
+    benchmark::RegisterBenchmark(name.c_str(), BM_MOVE_JOINT_FUNC, scene_graph, tip_link_name)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    // Insert a copy of the robot model so the inserted scene graph has joints of every type used by the model
+    std::function<void(benchmark::State&, SceneGraph::Ptr, SceneGraph::Ptr, std::string)> BM_INSERT_SCENE_GRAPH_FUNC =
+        BM_INSERT_SCENE_GRAPH_OFKT;
+    std::string name = "BM_INSERT_SCENE_GRAPH" + suffix;
+    benchmark::RegisterBenchmark(
+        name.c_str(), BM_INSERT_SCENE_GRAPH_FUNC, scene_graph, scene_graph, scene_graph->getRoot())
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  for (const RobotInfo& robot : getRobots())
+  {
+    SceneGraph::Ptr scene_graph = getSceneGraph(robot);
+    registerStateSolverBenchmarks<OFKTStateSolver>("OFKT", robot.name, scene_graph, robot.tip_link_name);
+    registerStateSolverBenchmarks<KDLStateSolver>("KDL", robot.name, scene_graph, robot.tip_link_name);
+    registerStructureBenchmarks(robot.name, scene_graph, robot.tip_link_name);
+  }
+
+  {
+    SceneGraph::Ptr scene_graph = getLargeSceneGraph();
+    const std::string tip_link_name = "link_127_7";
+    registerStateSolverBenchmarks<OFKTStateSolver>("OFKT", "LARGE_TREE", scene_graph, tip_link_name);
+    registerStateSolverBenchmarks<KDLStateSolver>("KDL", "LARGE_TREE", scene_graph, tip_link_name);
+    registerStructureBenchmarks("LARGE_TREE", scene_graph, tip_link_name);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -99,6 +99,7 @@ inline void runCompareStateSolver(const StateSolver& base_solver, StateSolver& c
     EXPECT_TRUE(comp_solver.hasLinkName(link_name));
   }
 
+  SceneState comp_state_reused;
   for (int i = 0; i < 10; ++i)
   {
     SceneState base_random_state;
@@ -142,6 +143,32 @@ inline void runCompareStateSolver(const StateSolver& base_solver, StateSolver& c
     runCompareSceneStates(base_random_state, comp_state_const);
     runCompareSceneStates(base_random_state, comp_state);
 
+    // The same state is updated in place every iteration
+    std::vector<std::string> active_joint_names = comp_solver.getActiveJointNames();
+    comp_solver.getState(comp_state_reused, active_joint_names, base_random_state.getJointValues(active_joint_names));
+    runCompareSceneStates(base_random_state, comp_state_reused);
+
+    // Only the requested link transforms are computed
+    std::vector<std::string> partial_link_names = comp_solver.getActiveLinkNames();
+    partial_link_names.push_back(comp_solver.getBaseLinkName());
+    tesseract_common::TransformMap partial_link_tfs;
+    comp_solver.getLinkTransforms(partial_link_tfs,
+                                  partial_link_names,
+                                  active_joint_names,
+                                  base_random_state.getJointValues(active_joint_names));
+    EXPECT_EQ(partial_link_tfs.size(), partial_link_names.size());
+    for (const auto& link_name : partial_link_names)
+      EXPECT_TRUE(base_random_state.link_transforms[link_name].isApprox(partial_link_tfs.at(link_name), 1e-6));
+
+    // The flat link transforms are computed in the order of their name table
+    tesseract_common::LinkTransforms flat_link_tfs(
+        std::make_shared<const tesseract_common::LinkNameTable>(partial_link_names));
+    comp_solver.getLinkTransforms(
+        flat_link_tfs, active_joint_names, base_random_state.getJointValues(active_joint_names));
+    ASSERT_EQ(flat_link_tfs.size(), partial_link_names.size());
+    for (std::size_t j = 0; j < partial_link_names.size(); ++j)
+      EXPECT_TRUE(base_random_state.link_transforms[partial_link_names[j]].isApprox(flat_link_tfs[j], 1e-6));
+
     // Test differetn link transform methods
     for (const auto& base_link_tf : base_random_state.link_transforms)
     {
@@ -166,6 +193,37 @@ inline void runCompareStateSolver(const StateSolver& base_solver, StateSolver& c
       }
     }
   }
+
+  // Test the link transforms of a trajectory, for all links and a subset of links using one or more threads
+  std::vector<std::string> active_joint_names = comp_solver.getActiveJointNames();
+  tesseract_common::TrajArray traj(5, static_cast<Eigen::Index>(active_joint_names.size()));
+  for (Eigen::Index i = 0; i < traj.rows(); ++i)
+    traj.row(i) = base_solver.getRandomState().getJointValues(active_joint_names);
+
+  std::vector<std::string> link_names_subset = comp_solver.getActiveLinkNames();
+  link_names_subset.push_back(comp_solver.getBaseLinkName());
+  for (std::size_t threads : { 1, 3 })
+  {
+    std::vector<tesseract_common::TransformMap> comp_link_tfs =
+        comp_solver.getLinkTransforms(active_joint_names, traj, std::vector<std::string>(), threads);
+    std::vector<tesseract_common::TransformMap> comp_link_tfs_subset =
+        comp_solver.getLinkTransforms(active_joint_names, traj, link_names_subset, threads);
+    ASSERT_EQ(comp_link_tfs.size(), static_cast<std::size_t>(traj.rows()));
+    ASSERT_EQ(comp_link_tfs_subset.size(), static_cast<std::size_t>(traj.rows()));
+    for (Eigen::Index i = 0; i < traj.rows(); ++i)
+    {
+      SceneState base_state = base_solver.getState(active_joint_names, traj.row(i));
+      const auto& link_tfs = comp_link_tfs[static_cast<std::size_t>(i)];
+      const auto& link_tfs_subset = comp_link_tfs_subset[static_cast<std::size_t>(i)];
+      EXPECT_EQ(link_tfs.size(), base_state.link_transforms.size());
+      EXPECT_EQ(link_tfs_subset.size(), link_names_subset.size());
+      for (const auto& base_link_tf : base_state.link_transforms)
+        EXPECT_TRUE(base_link_tf.second.isApprox(link_tfs.at(base_link_tf.first), 1e-6));
+
+      for (const auto& link_name : link_names_subset)
+        EXPECT_TRUE(base_state.link_transforms[link_name].isApprox(link_tfs_subset.at(link_name), 1e-6));
+    }
+  }
 }
 
 inline void runCompareStateSolverLimits(const SceneGraph& scene_graph, const StateSolver& comp_solver)
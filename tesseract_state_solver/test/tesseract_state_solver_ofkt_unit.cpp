@@ -4,6 +4,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_state_solver/ofkt/ofkt_nodes.h>
+#include <tesseract_state_solver/ofkt/ofkt_compiled_tree.h>
 #include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
 #include "state_solver_test_suite.h"
 
@@ -108,6 +109,45 @@ TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
   }
 }
 
+TEST(TesseractStateSolverUnit, OFKTCompiledTreeUnit)  // NOLINT
+{
+  Eigen::Isometry3d static_tf = Eigen::Isometry3d::Identity();
+  static_tf.translation() = Eigen::Vector3d(0, 0, 1);
+
+  OFKTCompiledTree tree;
+  long a1 = tree.addNode(JointType::REVOLUTE, Eigen::Vector3d(0, 0, 1), -1, static_tf, "link_1", "joint_a1");
+  long a2 = tree.addNode(JointType::PRISMATIC, Eigen::Vector3d(1, 0, 0), a1, static_tf, "link_2", "joint_a2");
+  long a3 = tree.addNode(JointType::FIXED, Eigen::Vector3d::Zero(), a1, static_tf, "link_3", "joint_a3");
+  EXPECT_EQ(tree.size(), 3U);
+  EXPECT_EQ(tree.link_indices.at("link_2"), a2);
+  EXPECT_EQ(tree.joint_indices.at("joint_a3"), a3);
+  EXPECT_EQ(tree.subtree_ends[static_cast<std::size_t>(a1)], a3 + 1);
+  EXPECT_EQ(tree.subtree_ends[static_cast<std::size_t>(a2)], a2 + 1);
+  EXPECT_EQ(tree.subtree_ends[static_cast<std::size_t>(a3)], a3 + 1);
+
+  std::vector<double> values{ M_PI_2, 0.5, 0 };
+  tesseract_common::VectorIsometry3d transforms(tree.size());
+  tree.computeTransforms(transforms, values);
+
+  Eigen::Isometry3d link_1 = static_tf * Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d(0, 0, 1));
+  Eigen::Isometry3d link_2 = link_1 * static_tf * Eigen::Translation3d(0.5, 0, 0);
+  Eigen::Isometry3d link_3 = link_1 * static_tf;
+  EXPECT_TRUE(transforms[static_cast<std::size_t>(a1)].isApprox(link_1, 1e-6));
+  EXPECT_TRUE(transforms[static_cast<std::size_t>(a2)].isApprox(link_2, 1e-6));
+  EXPECT_TRUE(transforms[static_cast<std::size_t>(a3)].isApprox(link_3, 1e-6));
+
+  // The compact transforms match
+  tesseract_common::VectorCompactTransform compact_transforms(tree.size());
+  tree.computeTransforms(compact_transforms, values);
+  for (std::size_t i = 0; i < tree.size(); ++i)
+    EXPECT_TRUE(compact_transforms[i].toIsometry().isApprox(transforms[i], 1e-6));
+
+  tree.clear();
+  EXPECT_EQ(tree.size(), 0U);
+  EXPECT_TRUE(tree.link_indices.empty());
+  EXPECT_TRUE(tree.compact_static_transforms.empty());
+}
+
 TEST(TesseractStateSolverUnit, OFKTAddRemoveLinkUnit)  // NOLINT
 {
   test_suite::runAddandRemoveLinkTest<OFKTStateSolver>();
@@ -153,6 +193,319 @@ TEST(TesseractStateSolverUnit, OFKTGetJacobianUnit)  // NOLINT
   test_suite::runJacobianTest<OFKTStateSolver>();
 }
 
+TEST(TesseractStateSolverUnit, OFKTJacobianDerivativesUnit)  // NOLINT
+{
+  auto scene_graph = test_suite::getSceneGraph();
+  OFKTStateSolver state_solver(*scene_graph);
+
+  const std::string link_name = "tool0";
+  const std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  const auto dof = static_cast<Eigen::Index>(joint_names.size());
+  Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(joint_names);
+  Eigen::VectorXd joint_velocities = Eigen::VectorXd::Constant(dof, 0.5);
+
+  // The jacobian written into a preallocated matrix matches the returned jacobian
+  Eigen::MatrixXd jacobian = state_solver.getJacobian(joint_values, link_name);
+  Eigen::MatrixXd jacobian_preallocated(6, dof);
+  state_solver.getJacobian(jacobian_preallocated, joint_values, link_name);
+  EXPECT_TRUE(jacobian.isApprox(jacobian_preallocated, 1e-12));
+
+  // The hessian matches a finite difference of the jacobian
+  const double delta = 1e-6;
+  std::vector<Eigen::MatrixXd> hessian = state_solver.getJacobianHessian(joint_values, link_name);
+  ASSERT_EQ(hessian.size(), joint_names.size());
+  for (Eigen::Index k = 0; k < dof; ++k)
+  {
+    Eigen::VectorXd perturbed = joint_values;
+    perturbed(k) += delta;
+    Eigen::MatrixXd numerical = (state_solver.getJacobian(perturbed, link_name) - jacobian) / delta;
+    EXPECT_TRUE(numerical.isApprox(hessian[static_cast<std::size_t>(k)], 1e-4));
+  }
+
+  // The jacobian time derivative matches a finite difference along the joint velocities
+  Eigen::MatrixXd jacobian_dot = state_solver.getJacobianDerivative(joint_values, joint_velocities, link_name);
+  Eigen::VectorXd perturbed = joint_values + delta * joint_velocities;
+  Eigen::MatrixXd numerical = (state_solver.getJacobian(perturbed, link_name) - jacobian) / delta;
+  EXPECT_TRUE(numerical.isApprox(jacobian_dot, 1e-4));
+
+  // The batched jacobians match the jacobian of each state
+  tesseract_common::TrajArray traj(4, dof);
+  for (Eigen::Index i = 0; i < traj.rows(); ++i)
+    traj.row(i) = state_solver.getRandomState().getJointValues(joint_names);
+
+  std::vector<Eigen::MatrixXd> jacobians = state_solver.getJacobians(joint_names, traj, link_name);
+  ASSERT_EQ(jacobians.size(), static_cast<std::size_t>(traj.rows()));
+  for (Eigen::Index i = 0; i < traj.rows(); ++i)
+  {
+    Eigen::MatrixXd check = state_solver.getJacobian(joint_names, traj.row(i), link_name);
+    EXPECT_TRUE(check.isApprox(jacobians[static_cast<std::size_t>(i)], 1e-12));
+  }
+}
+
+TEST(TesseractStateSolverUnit, OFKTStateSnapshotUnit)  // NOLINT
+{
+  auto scene_graph = test_suite::getSceneGraph();
+  OFKTStateSolver state_solver(*scene_graph);
+
+  const std::string link_name = "tool0";
+  const std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(joint_names);
+  state_solver.setState(joint_names, joint_values);
+
+  OFKTStateSnapshot::ConstPtr snapshot = state_solver.getSnapshot();
+  SceneState state = state_solver.getState();
+  EXPECT_EQ(snapshot->getBaseLinkName(), state_solver.getBaseLinkName());
+  EXPECT_EQ(snapshot->getActiveJointNames(), joint_names);
+  EXPECT_TRUE(snapshot->hasLinkName(link_name));
+  EXPECT_FALSE(snapshot->hasLinkName("missing_link"));
+  EXPECT_TRUE(snapshot->getLinkTransform(link_name).isApprox(state.link_transforms.at(link_name), 1e-12));
+
+  // The snapshot queries match the solver queries
+  Eigen::VectorXd check_values = state_solver.getRandomState().getJointValues(joint_names);
+  SceneState check_state = state_solver.getState(check_values);
+  for (const auto& link_tf : snapshot->getState(check_values).link_transforms)
+    EXPECT_TRUE(link_tf.second.isApprox(check_state.link_transforms.at(link_tf.first), 1e-12));
+
+  EXPECT_TRUE(snapshot->getJacobian(check_values, link_name)
+                  .isApprox(state_solver.getJacobian(check_values, link_name), 1e-12));
+
+  // Changing the state of the solver does not change a snapshot already taken, only the following ones
+  state_solver.setState(joint_names, check_values);
+  EXPECT_TRUE(snapshot->getLinkTransform(link_name).isApprox(state.link_transforms.at(link_name), 1e-12));
+  EXPECT_TRUE(snapshot->getState(joint_names, joint_values).link_transforms.at(link_name).isApprox(
+      state.link_transforms.at(link_name), 1e-12));
+
+  OFKTStateSnapshot::ConstPtr current_snapshot = state_solver.getSnapshot();
+  EXPECT_TRUE(
+      current_snapshot->getLinkTransform(link_name).isApprox(check_state.link_transforms.at(link_name), 1e-12));
+  EXPECT_EQ(&current_snapshot->getCompiledTree(), &snapshot->getCompiledTree());
+
+  // Changing the structure of the solver publishes a new compiled tree
+  Link link("snapshot_link");
+  Joint joint("snapshot_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = link_name;
+  joint.child_link_name = link.getName();
+  EXPECT_TRUE(state_solver.addLink(link, joint));
+
+  OFKTStateSnapshot::ConstPtr structure_snapshot = state_solver.getSnapshot();
+  EXPECT_NE(&structure_snapshot->getCompiledTree(), &snapshot->getCompiledTree());
+  EXPECT_TRUE(structure_snapshot->hasLinkName(link.getName()));
+  EXPECT_FALSE(snapshot->hasLinkName(link.getName()));
+}
+
+TEST(TesseractStateSolverUnit, OFKTCloneUnit)  // NOLINT
+{
+  auto scene_graph = test_suite::getSceneGraph();
+  OFKTStateSolver state_solver(*scene_graph);
+
+  const std::string link_name = "tool0";
+  const std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  StateSolver::UPtr cloned = state_solver.clone();
+  auto* cloned_solver = dynamic_cast<OFKTStateSolver*>(cloned.get());
+  ASSERT_TRUE(cloned_solver != nullptr);
+
+  // The clone shares the compiled tree
+  EXPECT_EQ(&cloned_solver->getSnapshot()->getCompiledTree(), &state_solver.getSnapshot()->getCompiledTree());
+  EXPECT_EQ(cloned_solver->getActiveLinkNames(), state_solver.getActiveLinkNames());
+  EXPECT_EQ(cloned_solver->getStaticLinkNames(), state_solver.getStaticLinkNames());
+
+  // Changing the state of the clone does not change the original
+  Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(joint_names);
+  SceneState state = state_solver.getState();
+  cloned_solver->setState(joint_names, joint_values);
+  EXPECT_TRUE(state_solver.getLinkTransform(link_name).isApprox(state.link_transforms.at(link_name), 1e-12));
+  EXPECT_TRUE(cloned_solver->getLinkTransform(link_name).isApprox(
+      state_solver.getState(joint_names, joint_values).link_transforms.at(link_name), 1e-12));
+
+  // Changing the structure of the clone does not change the original
+  Link link("clone_link");
+  Joint joint("clone_joint");
+  joint.type = JointType::FIXED;
+  joint.parent_link_name = link_name;
+  joint.child_link_name = link.getName();
+  EXPECT_TRUE(cloned_solver->addLink(link, joint));
+  EXPECT_TRUE(cloned_solver->hasLinkName(link.getName()));
+  EXPECT_FALSE(state_solver.hasLinkName(link.getName()));
+  EXPECT_NE(&cloned_solver->getSnapshot()->getCompiledTree(), &state_solver.getSnapshot()->getCompiledTree());
+  Eigen::Isometry3d link_tf = cloned_solver->getLinkTransform(link.getName());
+  EXPECT_TRUE(link_tf.isApprox(cloned_solver->getLinkTransform(link_name), 1e-12));
+}
+
+TEST(TesseractStateSolverUnit, OFKTRemoveLinkWithChildrenUnit)  // NOLINT
+{
+  auto scene_graph = test_suite::getSceneGraph();
+  OFKTStateSolver state_solver(*scene_graph);
+  const std::size_t link_count = state_solver.getLinkNames().size();
+
+  // Removing a link removes all of its children, which must not skip any of them
+  Link parent_link("parent_link");
+  Joint parent_joint("parent_joint");
+  parent_joint.type = JointType::FIXED;
+  parent_joint.parent_link_name = state_solver.getBaseLinkName();
+  parent_joint.child_link_name = parent_link.getName();
+  EXPECT_TRUE(state_solver.addLink(parent_link, parent_joint));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    Link link("child_link_" + std::to_string(i));
+    Joint joint("child_joint_" + std::to_string(i));
+    joint.type = JointType::FIXED;
+    joint.parent_link_name = parent_link.getName();
+    joint.child_link_name = link.getName();
+    EXPECT_TRUE(state_solver.addLink(link, joint));
+  }
+
+  EXPECT_EQ(state_solver.getLinkNames().size(), link_count + 5);
+  EXPECT_TRUE(state_solver.removeLink(parent_link.getName()));
+  EXPECT_EQ(state_solver.getLinkNames().size(), link_count);
+  EXPECT_FALSE(state_solver.hasLinkName("child_link_0"));
+  EXPECT_FALSE(state_solver.hasLinkName("child_link_3"));
+  EXPECT_EQ(state_solver.getState().link_transforms.size(), link_count);
+}
+
+TEST(TesseractStateSolverUnit, OFKTSetStateByIndexUnit)  // NOLINT
+{
+  auto scene_graph = test_suite::getSceneGraph();
+  OFKTStateSolver state_solver(*scene_graph);
+  OFKTStateSolver check_solver(*scene_graph);
+
+  const std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  const std::vector<long> joint_indices = state_solver.getJointIndices(joint_names);
+  EXPECT_ANY_THROW(state_solver.getJointIndices({ "missing_joint" }));  // NOLINT
+
+  OFKTStateSnapshot::ConstPtr snapshot = state_solver.getSnapshot();
+  const OFKTCompiledTree& tree = snapshot->getCompiledTree();
+  std::vector<long> changed_links;
+  auto changed_fn = [&changed_links](long link_index, const Eigen::Isometry3d& /*link_transform*/, double /*value*/) {
+    changed_links.push_back(link_index);
+  };
+
+  // Setting every joint updates every link
+  Eigen::VectorXd joint_values = state_solver.getRandomState().getJointValues(joint_names);
+  state_solver.setState(joint_indices, joint_values, changed_fn);
+  check_solver.setState(joint_names, joint_values);
+  EXPECT_EQ(changed_links.size(), tree.size());
+
+  // Setting the same values does not update any link
+  changed_links.clear();
+  state_solver.setState(joint_indices, joint_values, changed_fn);
+  EXPECT_TRUE(changed_links.empty());
+
+  // Changing the last joint only updates the links it moves
+  changed_links.clear();
+  joint_values(joint_values.size() - 1) += 0.1;
+  state_solver.setState(joint_indices, joint_values, changed_fn);
+  check_solver.setState(joint_names, joint_values);
+  const long last_index = joint_indices.back();
+  EXPECT_FALSE(changed_links.empty());
+  EXPECT_LT(changed_links.size(), tree.size());
+  for (long link_index : changed_links)
+  {
+    EXPECT_GE(link_index, last_index);
+    EXPECT_LT(link_index, tree.subtree_ends[static_cast<std::size_t>(last_index)]);
+  }
+
+  SceneState state = state_solver.getState();
+  SceneState check_state = check_solver.getState();
+  for (const auto& link_tf : check_state.link_transforms)
+    EXPECT_TRUE(link_tf.second.isApprox(state.link_transforms.at(link_tf.first), 1e-12));
+
+  for (const auto& joint_tf : check_state.joint_transforms)
+    EXPECT_TRUE(joint_tf.second.isApprox(state.joint_transforms.at(joint_tf.first), 1e-12));
+
+  for (const auto& joint : check_state.joints)
+    EXPECT_NEAR(joint.second, state.joints.at(joint.first), 1e-12);
+
+  // A snapshot taken before is not changed
+  EXPECT_FALSE(snapshot->getJointValues() == state_solver.getSnapshot()->getJointValues());
+}
+
+TEST(TesseractStateSolverUnit, OFKTMimicJointUnit)  // NOLINT
+{
+  OFKTStateSolver state_solver("world");
+  auto addFinger = [&state_solver](const std::string& name, const JointMimic::Ptr& mimic) {
+    Link link(name + "_link");
+    Joint joint(name + "_joint");
+    joint.type = JointType::PRISMATIC;
+    joint.axis = Eigen::Vector3d::UnitX();
+    joint.parent_link_name = "world";
+    joint.child_link_name = link.getName();
+    joint.limits = std::make_shared<JointLimits>(-1, 1, 0, 1, 1);
+    joint.mimic = mimic;
+    EXPECT_TRUE(state_solver.addLink(link, joint));
+  };
+
+  // The third finger mimics the second which mimics the first, added before it to check the order they are resolved
+  addFinger("finger_3", std::make_shared<JointMimic>(0.1, 2, "finger_2_joint"));
+  addFinger("finger_2", std::make_shared<JointMimic>(0.01, -1, "finger_1_joint"));
+  addFinger("finger_1", nullptr);
+
+  auto checkState = [](const SceneState& state, double value) {
+    const double value_2 = 0.01 - value;
+    const double value_3 = 0.1 + (2 * value_2);
+    EXPECT_NEAR(state.joints.at("finger_1_joint"), value, 1e-12);
+    EXPECT_NEAR(state.joints.at("finger_2_joint"), value_2, 1e-12);
+    EXPECT_NEAR(state.joints.at("finger_3_joint"), value_3, 1e-12);
+    EXPECT_NEAR(state.link_transforms.at("finger_2_link").translation().x(), value_2, 1e-12);
+    EXPECT_NEAR(state.link_transforms.at("finger_3_link").translation().x(), value_3, 1e-12);
+  };
+
+  // The mimic joints are derived even before a state is set
+  checkState(state_solver.getState(), 0);
+
+  state_solver.setState({ "finger_1_joint" }, Eigen::VectorXd::Constant(1, 0.2));
+  checkState(state_solver.getState(), 0.2);
+
+  // A value set directly on a mimic joint is replaced
+  state_solver.setState({ { "finger_1_joint", 0.3 }, { "finger_3_joint", 0.5 } });
+  checkState(state_solver.getState(), 0.3);
+
+  // Setting the driver by index marks the mimic joints as changed
+  std::vector<long> changed_links;
+  std::vector<double> changed_values;
+  auto changed_fn = [&changed_links, &changed_values](
+                        long link_index, const Eigen::Isometry3d& /*link_transform*/, double joint_value) {
+    changed_links.push_back(link_index);
+    changed_values.push_back(joint_value);
+  };
+  state_solver.setState(
+      state_solver.getJointIndices({ "finger_1_joint" }), Eigen::VectorXd::Constant(1, 0.4), changed_fn);
+  checkState(state_solver.getState(), 0.4);
+  EXPECT_EQ(changed_links.size(), 3);
+  EXPECT_TRUE(std::any_of(changed_values.begin(), changed_values.end(), [](double value) {
+    return std::abs(value - (0.1 + (2 * (0.01 - 0.4)))) < 1e-12;
+  }));
+
+  // The queries that do not change the state also derive the mimic joints
+  checkState(state_solver.getState({ "finger_1_joint" }, Eigen::VectorXd::Constant(1, 0.6)), 0.6);
+
+  tesseract_common::TransformMap link_transforms;
+  const Eigen::VectorXd finger_values = Eigen::VectorXd::Constant(1, 0.6);
+  state_solver.getLinkTransforms(link_transforms, { "finger_3_link" }, { "finger_1_joint" }, finger_values);
+  EXPECT_NEAR(link_transforms.at("finger_3_link").translation().x(), 0.1 + (2 * (0.01 - 0.6)), 1e-12);
+
+  tesseract_common::TrajArray traj(2, 1);
+  traj << 0.6, -0.2;
+  std::vector<tesseract_common::TransformMap> traj_transforms =
+      state_solver.getLinkTransforms({ "finger_1_joint" }, traj);
+  for (Eigen::Index i = 0; i < traj.rows(); ++i)
+  {
+    const double value_3 = 0.1 + (2 * (0.01 - traj(i, 0)));
+    const auto& state_transforms = traj_transforms[static_cast<std::size_t>(i)];
+    EXPECT_NEAR(state_transforms.at("finger_3_link").translation().x(), value_3, 1e-12);
+  }
+
+  // The mimic joints are kept by copies, and a mimic joint of a removed joint moves independently
+  OFKTStateSolver copy_solver(state_solver);
+  EXPECT_TRUE(copy_solver.removeJoint("finger_1_joint"));
+  copy_solver.setState({ "finger_2_joint" }, Eigen::VectorXd::Constant(1, 0.5));
+  SceneState copy_state = copy_solver.getState();
+  EXPECT_NEAR(copy_state.joints.at("finger_2_joint"), 0.5, 1e-12);
+  EXPECT_NEAR(copy_state.joints.at("finger_3_joint"), 1.1, 1e-12);
+  checkState(state_solver.getState(), 0.4);
+}
+
 TEST(TesseractStateSolverUnit, OFKTUnit)  // NOLINT
 {
   OFKTStateSolver solver("test");
@@ -0,0 +1,93 @@
+/**
+ * @file benchmark_scenes.h
+ * @brief Reference benchmark scenes and their query sets in tesseract_support
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_SUPPORT_BENCHMARK_SCENES_H
+#define TESSERACT_SUPPORT_BENCHMARK_SCENES_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/resource_locator.h>
+
+namespace tesseract_common
+{
+/**
+ * @brief A reference scene used to benchmark the environment, contact checking and kinematics
+ * @details The files are located in urdf/benchmarks and meshes/benchmarks of tesseract_support and are referenced by
+ * package url so they can be located with the TesseractSupportResourceLocator.
+ */
+struct BenchmarkScene
+{
+  /** @brief The name of the scene */
+  std::string name;
+
+  /** @brief The package url of the URDF */
+  std::string urdf_url;
+
+  /** @brief The package url of the SRDF */
+  std::string srdf_url;
+
+  /** @brief The package url of the query set, see loadBenchmarkQueries */
+  std::string queries_url;
+
+  /** @brief The kinematic group the queries are solved for */
+  std::string group_name;
+
+  /** @brief The tip link of the kinematic group */
+  std::string tip_link_name;
+};
+
+/**
+ * @brief Get the reference benchmark scenes
+ *
+ * The scenes are:
+ *   - dense_cell: An ABB IRB2400 surrounded by 216 primitive fixtures on racks
+ *   - octree_work_area: An ABB IRB2400 in a scanned work area stored as an octree
+ *   - dual_arm_positioner: Two ABB IRB2400 robots facing a two axis positioner
+ *   - high_poly_part: An ABB IRB2400 next to a table holding a mesh part with 25600 triangles
+ *
+ * @return The benchmark scenes
+ */
+std::vector<BenchmarkScene> getBenchmarkScenes();
+
+/**
+ * @brief Load the query set of a benchmark scene
+ *
+ * The query set is a comma separated file where the first row is the joint names and every other row is a joint state.
+ *
+ * @param joint_names The joint names of the queries
+ * @param joint_values The joint values of each query
+ * @param resource The resource of the query set
+ * @return True if successful, otherwise false
+ */
+bool loadBenchmarkQueries(std::vector<std::string>& joint_names,
+                          std::vector<Eigen::VectorXd>& joint_values,
+                          const Resource& resource);
+}  // namespace tesseract_common
+
+#endif  // TESSERACT_SUPPORT_BENCHMARK_SCENES_H
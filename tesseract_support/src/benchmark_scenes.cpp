@@ -0,0 +1,121 @@
+/**
+ * @file benchmark_scenes.cpp
+ * @brief Reference benchmark scenes and their query sets in tesseract_support
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <sstream>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_support/benchmark_scenes.h>
+
+namespace tesseract_common
+{
+namespace
+{
+BenchmarkScene makeBenchmarkScene(const std::string& name,
+                                  const std::string& group_name,
+                                  const std::string& tip_link_name)
+{
+  const std::string prefix = "package://tesseract_support/urdf/benchmarks/" + name;
+  return { name, prefix + ".urdf", prefix + ".srdf", prefix + "_queries.csv", group_name, tip_link_name };
+}
+
+std::vector<std::string> splitRow(const std::string& line)
+{
+  std::vector<std::string> tokens;
+  std::stringstream ss(line);
+  std::string token;
+  while (std::getline(ss, token, ','))
+    tokens.push_back(token);
+
+  return tokens;
+}
+}  // namespace
+
+std::vector<BenchmarkScene> getBenchmarkScenes()
+{
+  return { makeBenchmarkScene("dense_cell", "manipulator", "tool0"),
+           makeBenchmarkScene("octree_work_area", "manipulator", "tool0"),
+           makeBenchmarkScene("dual_arm_positioner", "left_manipulator", "left_tool0"),
+           makeBenchmarkScene("high_poly_part", "manipulator", "tool0") };
+}
+
+bool loadBenchmarkQueries(std::vector<std::string>& joint_names,
+                          std::vector<Eigen::VectorXd>& joint_values,
+                          const Resource& resource)
+{
+  joint_names.clear();
+  joint_values.clear();
+
+  std::shared_ptr<std::istream> stream = resource.getResourceContentStream();
+  if (stream == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Failed to open benchmark queries: %s", resource.getUrl().c_str());
+    return false;
+  }
+
+  std::string line;
+  if (!std::getline(*stream, line))
+  {
+    CONSOLE_BRIDGE_logError("Benchmark queries are empty: %s", resource.getUrl().c_str());
+    return false;
+  }
+  joint_names = splitRow(line);
+
+  while (std::getline(*stream, line))
+  {
+    if (line.empty())
+      continue;
+
+    const std::vector<std::string> tokens = splitRow(line);
+    if (tokens.size() != joint_names.size())
+    {
+      CONSOLE_BRIDGE_logError("Benchmark query %d does not match the number of joints: %s",
+                              static_cast<int>(joint_values.size()),
+                              resource.getUrl().c_str());
+      return false;
+    }
+
+    Eigen::VectorXd values(static_cast<Eigen::Index>(tokens.size()));
+    try
+    {
+      for (std::size_t i = 0; i < tokens.size(); ++i)
+        values(static_cast<Eigen::Index>(i)) = std::stod(tokens[i]);
+    }
+    catch (const std::exception&)
+    {
+      CONSOLE_BRIDGE_logError("Benchmark query %d has an invalid joint value: %s",
+                              static_cast<int>(joint_values.size()),
+                              resource.getUrl().c_str());
+      return false;
+    }
+    joint_values.push_back(values);
+  }
+
+  return true;
+}
+}  // namespace tesseract_common
@@ -6,6 +6,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_support/tesseract_support_resource_locator.h>
+#include <tesseract_support/benchmark_scenes.h>
 #include <tesseract_common/types.h>
 #include <tesseract_common/unit_test_utils.h>
 
@@ -52,6 +53,55 @@ TEST(TesseractSupportUnit, TesseractSupportResourceLocatorSerializUnit)  // NOLI
                                                                                                     "sourceLocator");
 }
 
+TEST(TesseractSupportUnit, BenchmarkScenesUnit)  // NOLINT
+{
+  using namespace tesseract_common;
+  ResourceLocator::Ptr locator = std::make_shared<TesseractSupportResourceLocator>();
+
+  std::vector<BenchmarkScene> scenes = getBenchmarkScenes();
+  EXPECT_EQ(scenes.size(), 4);
+  for (const auto& scene : scenes)
+  {
+    EXPECT_FALSE(scene.group_name.empty());
+    EXPECT_FALSE(scene.tip_link_name.empty());
+
+    Resource::Ptr urdf = locator->locateResource(scene.urdf_url);
+    EXPECT_TRUE(urdf != nullptr);
+    EXPECT_TRUE(tesseract_common::fs::exists(urdf->getFilePath()));
+
+    Resource::Ptr srdf = locator->locateResource(scene.srdf_url);
+    EXPECT_TRUE(srdf != nullptr);
+    EXPECT_TRUE(tesseract_common::fs::exists(srdf->getFilePath()));
+
+    Resource::Ptr queries = locator->locateResource(scene.queries_url);
+    EXPECT_TRUE(queries != nullptr);
+
+    std::vector<std::string> joint_names;
+    std::vector<Eigen::VectorXd> joint_values;
+    EXPECT_TRUE(loadBenchmarkQueries(joint_names, joint_values, *queries));
+    EXPECT_FALSE(joint_names.empty());
+    EXPECT_EQ(joint_values.size(), 100);
+    for (const auto& values : joint_values)
+      EXPECT_EQ(values.size(), joint_names.size());
+  }
+
+  {  // Missing query set
+    Resource::Ptr queries = locator->locateResource("package://tesseract_support/urdf/benchmarks/does_not_exist.csv");
+    std::vector<std::string> joint_names;
+    std::vector<Eigen::VectorXd> joint_values;
+    EXPECT_FALSE(loadBenchmarkQueries(joint_names, joint_values, *queries));
+  }
+
+  {  // A query which does not match the joint names
+    std::string contents = "joint_1,joint_2\n0.1,0.2\n0.3\n";
+    std::vector<uint8_t> data(contents.begin(), contents.end());
+    BytesResource queries("package://tesseract_support/invalid_queries.csv", data);
+    std::vector<std::string> joint_names;
+    std::vector<Eigen::VectorXd> joint_values;
+    EXPECT_FALSE(loadBenchmarkQueries(joint_names, joint_values, queries));
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -48,15 +48,23 @@ class ResourceLocator;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element collision
  * @param xml_element The xml element
  * @param locator The Tesseract resource locator
  * @param version The version number
+ * @param defer_meshes Indicate if a mesh or convex mesh is replaced by a box around its vertices. The mesh is then
+ * loaded, converted and simplified on the default executor and the collisions replacing the box are the deferred
+ * geometry of the returned collision.
  * @return A vector tesseract_scene_graph Collision objects
  */
 std::vector<std::shared_ptr<tesseract_scene_graph::Collision>>
-parseCollision(const tinyxml2::XMLElement* xml_element, const tesseract_common::ResourceLocator& locator, int version);
+parseCollision(const tinyxml2::XMLElement* xml_element,
+               const tesseract_common::ResourceLocator& locator,
+               int version,
+               bool defer_meshes = false);
 
 /**
  * @brief writeCollision Write collision object to URDF XML
@@ -67,13 +75,15 @@ parseCollision(const tinyxml2::XMLElement* xml_element, const tesseract_common::
  * @param link_name Name of link to which collision object is attached
  * @param id If set, this ID will be appended to the geometry name for saving to distinguish between multiple collision
  * geometries on the same link.
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return An XML element representing the collision object in URDF format.
  */
 tinyxml2::XMLElement* writeCollision(const std::shared_ptr<const tesseract_scene_graph::Collision>& collision,
                                      tinyxml2::XMLDocument& doc,
                                      const std::string& package_path,
                                      const std::string& link_name,
-                                     int id);
+                                     int id,
+                                     GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 
@@ -49,6 +49,8 @@ class Geometry;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element geometry
  * @param xml_element The xml element
@@ -72,12 +74,14 @@ parseGeometry(const tinyxml2::XMLElement* xml_element,
  * @param filename The desired filename.  The extension will be added according to geometry type.  If package_path is
  * set, this should be relative to the package (e.g. "collision/link1_geometry").  If package_path is not set, this
  * should be an absolute path (e.g. "/tmp/link1_geometry")
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return xml element representing the geometry in URDF format.
  */
 tinyxml2::XMLElement* writeGeometry(const std::shared_ptr<const tesseract_geometry::Geometry>& geometry,
                                     tinyxml2::XMLDocument& doc,
                                     const std::string& package_path,
-                                    const std::string& filename);
+                                    const std::string& filename,
+                                    GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 
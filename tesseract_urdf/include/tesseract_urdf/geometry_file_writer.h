@@ -0,0 +1,120 @@
+/**
+ * @file geometry_file_writer.h
+ * @brief Writes the geometry files of a URDF on background threads
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_URDF_GEOMETRY_FILE_WRITER_H
+#define TESSERACT_URDF_GEOMETRY_FILE_WRITER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_geometry
+{
+class PolygonMesh;
+class Octree;
+}  // namespace tesseract_geometry
+
+namespace tesseract_urdf
+{
+/**
+ * @brief Writes the mesh and octree files referenced by a URDF on background threads
+ * @details The XML of a link only needs the name of its geometry files, so the files are queued here and written while
+ * the rest of the URDF is generated. Call wait() before using the files, it rethrows the first error of a write.
+ *
+ * When meshes are deduplicated, a mesh equal to a mesh that was already queued is not written again and the filename
+ * of the first mesh is returned instead, so links sharing the same geometry reference a single file.
+ */
+class GeometryFileWriter
+{
+public:
+  /**
+   * @brief Constructor
+   * @param threads The number of threads writing the files, zero uses one per hardware thread
+   * @param deduplicate_meshes Write meshes with the same content only once
+   */
+  explicit GeometryFileWriter(std::size_t threads = 1, bool deduplicate_meshes = false);
+  ~GeometryFileWriter();
+  GeometryFileWriter(const GeometryFileWriter&) = delete;
+  GeometryFileWriter& operator=(const GeometryFileWriter&) = delete;
+  GeometryFileWriter(GeometryFileWriter&&) = delete;
+  GeometryFileWriter& operator=(GeometryFileWriter&&) = delete;
+
+  /**
+   * @brief Queue a mesh to be written to a PLY file
+   * @param mesh The mesh
+   * @param package_path The package path, see writeMesh
+   * @param filename The desired filename, see writeMesh
+   * @return The filename to reference in the URDF, which differs from filename if an equal mesh was already queued
+   */
+  std::string writeMesh(const std::shared_ptr<const tesseract_geometry::PolygonMesh>& mesh,
+                        const std::string& package_path,
+                        const std::string& filename);
+
+  /**
+   * @brief Queue an octree to be written to a binary octree file
+   * @param octree The octree
+   * @param filepath The path of the file
+   */
+  void writeOctree(const std::shared_ptr<const tesseract_geometry::Octree>& octree, const std::string& filepath);
+
+  /**
+   * @brief Wait until all queued files are written
+   * @details Throws the first error that occurred while writing the files
+   */
+  void wait();
+
+private:
+  std::mutex mutex_;
+  std::condition_variable queued_cv_;
+  std::condition_variable done_cv_;
+  std::deque<std::function<void()>> queue_;
+  std::size_t running_{ 0 };
+  bool stop_{ false };
+  std::exception_ptr error_;
+  std::vector<std::thread> threads_;
+
+  bool deduplicate_meshes_;
+  /** @brief The meshes that were queued and their filenames, by the hash of the mesh */
+  std::unordered_map<std::size_t,
+                     std::vector<std::pair<std::shared_ptr<const tesseract_geometry::PolygonMesh>, std::string>>>
+      meshes_;
+
+  void enqueue(std::function<void()> task);
+  void run();
+};
+
+}  // namespace tesseract_urdf
+
+#endif  // TESSERACT_URDF_GEOMETRY_FILE_WRITER_H
@@ -50,19 +50,25 @@ class ResourceLocator;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element link
  * @param xml_element The xml element
  * @param locator The Tesseract resource locator
  * @param available_materials The current available materials
  * @param version The version number
+ * @param load_visuals Indicate if the visual elements are parsed, otherwise the link has no visuals
+ * @param defer_collision_meshes Indicate if the collision meshes are loaded in the background, see parseCollision
  * @return A Tesseract Link
  */
 std::shared_ptr<tesseract_scene_graph::Link>
 parseLink(const tinyxml2::XMLElement* xml_element,
           const tesseract_common::ResourceLocator& locator,
           std::unordered_map<std::string, std::shared_ptr<tesseract_scene_graph::Material>>& available_materials,
-          int version);
+          int version,
+          bool load_visuals = true,
+          bool defer_collision_meshes = false);
 
 /**
  * @brief writeLink Write a link to URDF XML
@@ -70,11 +76,13 @@ parseLink(const tinyxml2::XMLElement* xml_element,
  * @param doc XML Document to which element will belong
  * @param package_path /<path>/<to>/<your-package>.  If set, geometry will be saved relative to the package.  If not
  * set, geometry will be saved with absolute paths.
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return XML element representing link in URDF format
  */
 tinyxml2::XMLElement* writeLink(const std::shared_ptr<const tesseract_scene_graph::Link>& link,
                                 tinyxml2::XMLDocument& doc,
-                                const std::string& package_path);
+                                const std::string& package_path,
+                                GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 #endif  // TESSERACT_URDF_LINK_H
@@ -50,6 +50,8 @@ class Mesh;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element mesh
  * @param xml_element The xml element
@@ -71,12 +73,14 @@ std::vector<std::shared_ptr<tesseract_geometry::Mesh>> parseMesh(const tinyxml2:
  * set, geometry will be saved with absolute paths.
  * @param filename Desired file location.  If package_path is set, this should be relative to the package, If not, this
  * should be an absolute path
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return XML element representing the mesh object in URDF format.
  */
 tinyxml2::XMLElement* writeMesh(const std::shared_ptr<const tesseract_geometry::Mesh>& mesh,
                                 tinyxml2::XMLDocument& doc,
                                 const std::string& package_path,
-                                const std::string& filename);
+                                const std::string& filename,
+                                GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 
@@ -49,6 +49,8 @@ class Octree;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element octomap
  * @param xml_element The xml element
@@ -70,12 +72,14 @@ std::shared_ptr<tesseract_geometry::Octree> parseOctomap(const tinyxml2::XMLElem
  * set, geometry will be saved with absolute paths.
  * @param filename Desired file location.  If package_path is set, this should be relative to the package.  Otherwise,
  * this should be an absolute path.
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return XML element representing the octomap object in URDF Format
  */
 tinyxml2::XMLElement* writeOctomap(const std::shared_ptr<const tesseract_geometry::Octree>& octree,
                                    tinyxml2::XMLDocument& doc,
                                    const std::string& package_path,
-                                   const std::string& filename);
+                                   const std::string& filename,
+                                   GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 #endif  // TESSERACT_URDF_OCTOMAP_H
@@ -46,6 +46,8 @@ class ResourceLocator;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element octree
  * @param xml_element The xml element
@@ -67,12 +69,14 @@ std::shared_ptr<tesseract_geometry::Octree> parseOctree(const tinyxml2::XMLEleme
  * @param package_path /<path>/<to>/<your-package>.  If set, geometry will be saved relative to the package.  If not
  * set, geometry will be saved with absolute paths.
  * @param filename Desired filename relative to the working directory ("octree.ot" or "collision/octree.ot")
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return An XML element containing information on the saved file.
  */
 tinyxml2::XMLElement* writeOctree(const std::shared_ptr<const tesseract_geometry::Octree>& octree,
                                   tinyxml2::XMLDocument& doc,
                                   const std::string& package_path,
-                                  const std::string& filename);
+                                  const std::string& filename,
+                                  GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 
@@ -35,27 +35,58 @@ namespace tesseract_urdf
  * @brief Parse a URDF string into a Tesseract Scene Graph
  * @param urdf_xml_string URDF xml string
  * @param locator The resource locator function
+ * @param threads The number of threads used to parse the links. The links are parsed in parallel because loading
+ * their meshes and creating convex hulls dominates the time, the result and errors are the same as parsing serially.
+ * With more than one thread the distinct meshes of all links are loaded on the threads first and the links are then
+ * assembled from them. The resource locator must be safe to call from several threads when more than one is used.
+ * @param load_visuals Indicate if the visual elements of the links are parsed. Applications which never render, like
+ * planning servers, can skip them so the visual meshes, materials and textures are never loaded.
+ * @param defer_collision_meshes Indicate if the collision meshes and convex meshes are loaded in the background. Each
+ * is replaced by a box around the vertices of its file, which is imported without converting or simplifying it, and
+ * the collisions replacing the box are its deferred geometry. The resource locator is only called while parsing.
  * @throws std::nested_exception Thrown if error occurs during parsing. Use printNestedException to print contents of
  * the nested exception.
  * @return Tesseract Scene Graph, nullptr if failed to parse URDF
  */
 tesseract_scene_graph::SceneGraph::UPtr parseURDFString(const std::string& urdf_xml_string,
-                                                        const tesseract_common::ResourceLocator& locator);
+                                                        const tesseract_common::ResourceLocator& locator,
+                                                        std::size_t threads = 1,
+                                                        bool load_visuals = true,
+                                                        bool defer_collision_meshes = false);
 
 /**
  * @brief Parse a URDF file into a Tesseract Scene Graph
  * @param URDF file path
  * @param The resource locator function
+ * @param threads The number of threads used to parse the links, see parseURDFString
+ * @param load_visuals Indicate if the visual elements of the links are parsed, see parseURDFString
+ * @param defer_collision_meshes Indicate if the collision meshes are loaded in the background, see parseURDFString
  * @throws std::nested_exception Thrown if error occurs during parsing. Use printNestedException to print contents of
  * the nested exception.
  * @return Tesseract Scene Graph, nullptr if failed to parse URDF
  */
 tesseract_scene_graph::SceneGraph::UPtr parseURDFFile(const std::string& path,
-                                                      const tesseract_common::ResourceLocator& locator);
+                                                      const tesseract_common::ResourceLocator& locator,
+                                                      std::size_t threads = 1,
+                                                      bool load_visuals = true,
+                                                      bool defer_collision_meshes = false);
 
+/**
+ * @brief Write a Tesseract Scene Graph to a URDF file
+ * @details The XML is streamed to the file one link or joint at a time, so it is never held for the whole scene graph,
+ * and the mesh and octree files are written on background threads while the XML is generated.
+ * @param sg The scene graph
+ * @param package_path The package the URDF is written to, the file is written to <package_path>/urdf/
+ * @param urdf_name The name of the URDF file without extension, the scene graph name is used if empty
+ * @param threads The number of threads writing the geometry files, zero uses one per hardware thread
+ * @param deduplicate_meshes Write meshes with the same content only once, links sharing a mesh reference one file
+ * @throws std::nested_exception Thrown if an error occurs while writing
+ */
 void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
                    const std::string& package_path,
-                   const std::string& urdf_name = "");
+                   const std::string& urdf_name = "",
+                   std::size_t threads = 1,
+                   bool deduplicate_meshes = false);
 }  // namespace tesseract_urdf
 
 #endif
@@ -50,6 +50,8 @@ class ResourceLocator;
 
 namespace tesseract_urdf
 {
+class GeometryFileWriter;
+
 /**
  * @brief Parse xml element visual
  * @param xml_element The xml element
@@ -72,13 +74,15 @@ parseVisual(const tinyxml2::XMLElement* xml_element,
  * @param link_name Name of link to which collision object is attached
  * @param id If set, this ID will be appended to the geometry name for distinguishing between multiple geometries on
  * the same link.
+ * @param file_writer If set, the geometry files are queued on it instead of being written before returning
  * @return An XML element representing the collision object in URDF format.
  */
 tinyxml2::XMLElement* writeVisual(const std::shared_ptr<const tesseract_scene_graph::Visual>& visual,
                                   tinyxml2::XMLDocument& doc,
                                   const std::string& package_path,
                                   const std::string& link_name,
-                                  int id);
+                                  int id,
+                                  GeometryFileWriter* file_writer = nullptr);
 
 }  // namespace tesseract_urdf
 
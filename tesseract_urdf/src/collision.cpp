@@ -26,26 +26,145 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <limits>
 #include <stdexcept>
+#include <string>
 
 #include <Eigen/Geometry>
 #include <tesseract_common/utils.h>
 #include <tinyxml2.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/executor.h>
 #include <tesseract_common/resource_locator.h>
+#include <tesseract_geometry/geometries.h>
 #include <tesseract_scene_graph/link.h>
 #include <tesseract_urdf/collision.h>
 #include <tesseract_urdf/geometry.h>
+#include <tesseract_urdf/mesh.h>
 #include <tesseract_urdf/origin.h>
 
+namespace
+{
+/** @brief A resource locator returning the resource of a deferred mesh, which is located while parsing the URDF */
+class LocatedResourceLocator : public tesseract_common::ResourceLocator
+{
+public:
+  explicit LocatedResourceLocator(tesseract_common::Resource::Ptr resource) : resource_(std::move(resource)) {}
+
+  tesseract_common::Resource::Ptr locateResource(const std::string& /*url*/) const override { return resource_; }
+
+private:
+  tesseract_common::Resource::Ptr resource_;
+};
+
+/** @brief Create a collision for each geometry of a collision element */
 std::vector<tesseract_scene_graph::Collision::Ptr>
-tesseract_urdf::parseCollision(const tinyxml2::XMLElement* xml_element,
-                               const tesseract_common::ResourceLocator& locator,
-                               int version)
+makeCollisions(const std::string& collision_name,
+               const Eigen::Isometry3d& collision_origin,
+               const std::vector<tesseract_geometry::Geometry::Ptr>& geometries)
 {
   std::vector<tesseract_scene_graph::Collision::Ptr> collisions;
+  if (geometries.size() == 1)
+  {
+    auto collision = std::make_shared<tesseract_scene_graph::Collision>();
+    collision->name = collision_name;
+    collision->origin = collision_origin;
+    collision->geometry = geometries[0];
+    collisions.push_back(collision);
+  }
+  else
+  {
+    int i = 0;
+    for (const auto& g : geometries)
+    {
+      auto collision = std::make_shared<tesseract_scene_graph::Collision>();
+
+      if (collision_name.empty())
+        collision->name = collision_name;
+      else
+        collision->name = collision_name + "_" + std::to_string(i);
+
+      collision->origin = collision_origin;
+      collision->geometry = g;
+      collisions.push_back(collision);
+    }
+  }
+
+  return collisions;
+}
 
+/**
+ * @brief Create a box around the vertices of a mesh or convex mesh standing in for it until it is loaded
+ * @details Only the vertices of the mesh file are imported here. Loading the geometry, which converts convex meshes
+ * and simplifies meshes, is queued on the default executor with a copy of the geometry element.
+ */
+tesseract_scene_graph::Collision::Ptr parseDeferredMesh(const tinyxml2::XMLElement* geometry,
+                                                        const tesseract_common::ResourceLocator& locator,
+                                                        int version,
+                                                        const std::string& collision_name,
+                                                        const Eigen::Isometry3d& collision_origin)
+{
+  const tinyxml2::XMLElement* shape = geometry->FirstChildElement();
+  std::string filename;
+  if (tesseract_common::QueryStringAttribute(shape, "filename", filename) != tinyxml2::XML_SUCCESS)
+    std::throw_with_nested(std::runtime_error("Collision: Missing or failed parsing mesh attribute 'filename'!"));
+
+  auto located_locator = std::make_shared<LocatedResourceLocator>(locator.locateResource(filename));
+
+  // The element is copied, the document is destroyed before the mesh is loaded
+  auto doc = std::make_shared<tinyxml2::XMLDocument>();
+  doc->InsertEndChild(geometry->DeepClone(doc.get()));
+
+  // The vertices are imported like a plain mesh, sharing them with the loaded geometry through the geometry pool
+  tinyxml2::XMLElement* plain_mesh = shape->DeepClone(doc.get())->ToElement();
+  plain_mesh->SetName("mesh");
+  plain_mesh->DeleteAttribute("simplify");
+  plain_mesh->DeleteAttribute("convert");
+  plain_mesh->DeleteAttribute("max_vertices");
+  const std::vector<tesseract_geometry::Mesh::Ptr> meshes =
+      tesseract_urdf::parseMesh(plain_mesh, *located_locator, false, version);
+  doc->DeleteNode(plain_mesh);
+
+  Eigen::Vector3d aabb_min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d aabb_max = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (const auto& mesh : meshes)
+  {
+    for (const auto& vertex : *mesh->getVertices())
+    {
+      aabb_min = aabb_min.cwiseMin(vertex);
+      aabb_max = aabb_max.cwiseMax(vertex);
+    }
+  }
+
+  if ((aabb_min.array() > aabb_max.array()).any())
+    std::throw_with_nested(std::runtime_error("Collision: Mesh '" + filename + "' has no vertices!"));
+
+  const Eigen::Vector3d extents = aabb_max - aabb_min;
+  auto collision = std::make_shared<tesseract_scene_graph::Collision>();
+  collision->name = collision_name;
+  collision->origin = collision_origin * Eigen::Translation3d(0.5 * (aabb_min + aabb_max));
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(extents.x(), extents.y(), extents.z());
+  collision->deferred_geometry =
+      tesseract_common::getDefaultExecutor()
+          ->async([doc, located_locator, meshes, version, collision_name, collision_origin]() {
+            (void)meshes;  // Keeps the imported meshes in the geometry pool until the geometry is loaded
+            const std::vector<tesseract_geometry::Geometry::Ptr> geometries =
+                tesseract_urdf::parseGeometry(doc->FirstChildElement(), *located_locator, false, version);
+            return makeCollisions(collision_name, collision_origin, geometries);
+          })
+          .share();
+
+  return collision;
+}
+}  // namespace
+
+std::vector<tesseract_scene_graph::Collision::Ptr>
+tesseract_urdf::parseCollision(const tinyxml2::XMLElement* xml_element,
+                               const tesseract_common::ResourceLocator& locator,
+                               int version,
+                               bool defer_meshes)
+{
   // get name
   std::string collision_name = tesseract_common::StringAttribute(xml_element, "name", "");
 
@@ -69,6 +188,20 @@ tesseract_urdf::parseCollision(const tinyxml2::XMLElement* xml_element,
   if (geometry == nullptr)
     std::throw_with_nested(std::runtime_error("Collision: Error missing 'geometry' element!"));
 
+  const tinyxml2::XMLElement* shape = geometry->FirstChildElement();
+  if (defer_meshes && shape != nullptr &&
+      (std::string(shape->Value()) == "mesh" || std::string(shape->Value()) == "convex_mesh"))
+  {
+    try
+    {
+      return { parseDeferredMesh(geometry, locator, version, collision_name, collision_origin) };
+    }
+    catch (...)
+    {
+      std::throw_with_nested(std::runtime_error("Collision: Error parsing 'geometry' element!"));
+    }
+  }
+
   std::vector<tesseract_geometry::Geometry::Ptr> geometries;
   try
   {
@@ -79,33 +212,7 @@ tesseract_urdf::parseCollision(const tinyxml2::XMLElement* xml_element,
     std::throw_with_nested(std::runtime_error("Collision: Error parsing 'geometry' element!"));
   }
 
-  if (geometries.size() == 1)
-  {
-    auto collision = std::make_shared<tesseract_scene_graph::Collision>();
-    collision->name = collision_name;
-    collision->origin = collision_origin;
-    collision->geometry = geometries[0];
-    collisions.push_back(collision);
-  }
-  else
-  {
-    int i = 0;
-    for (const auto& g : geometries)
-    {
-      auto collision = std::make_shared<tesseract_scene_graph::Collision>();
-
-      if (collision_name.empty())
-        collision->name = collision_name;
-      else
-        collision->name = collision_name + "_" + std::to_string(i);
-
-      collision->origin = collision_origin;
-      collision->geometry = g;
-      collisions.push_back(collision);
-    }
-  }
-
-  return collisions;
+  return makeCollisions(collision_name, collision_origin, geometries);
 }
 
 tinyxml2::XMLElement*
@@ -113,7 +220,8 @@ tesseract_urdf::writeCollision(const std::shared_ptr<const tesseract_scene_graph
                                tinyxml2::XMLDocument& doc,
                                const std::string& package_path,
                                const std::string& link_name,
-                               const int id = -1)
+                               const int id = -1,
+                               GeometryFileWriter* file_writer)
 {
   if (collision == nullptr)
     std::throw_with_nested(std::runtime_error("Collision is nullptr and cannot be converted to XML"));
@@ -146,7 +254,8 @@ tesseract_urdf::writeCollision(const std::shared_ptr<const tesseract_scene_graph
 
   try
   {
-    tinyxml2::XMLElement* xml_geometry = writeGeometry(collision->geometry, doc, package_path, filename);
+    tinyxml2::XMLElement* xml_geometry =
+        writeGeometry(collision->geometry, doc, package_path, filename, file_writer);
     xml_element->InsertEndChild(xml_geometry);
   }
   catch (...)
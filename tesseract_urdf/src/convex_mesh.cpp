@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/algorithm/string.hpp>
+#include <iomanip>
+#include <sstream>
 #include <stdexcept>
 
 #include <tesseract_common/utils.h>
@@ -34,10 +36,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/convex_hull_utils.h>
+#include <tesseract_geometry/geometry_pool.h>
 #include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_geometry/mesh_parser.h>
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_urdf/convex_mesh.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/utils.h>
 
 std::vector<tesseract_geometry::ConvexMesh::Ptr>
@@ -82,26 +86,47 @@ tesseract_urdf::parseConvexMesh(const tinyxml2::XMLElement* xml_element,
   bool convert = false;
   xml_element->QueryBoolAttribute("convert", &convert);
 
+  int max_vertices{ 0 };
+  auto xml_status = xml_element->QueryIntAttribute("max_vertices", &max_vertices);
+  if ((xml_status != tinyxml2::XML_NO_ATTRIBUTE && xml_status != tinyxml2::XML_SUCCESS) || max_vertices < 0)
+    std::throw_with_nested(std::runtime_error("ConvexMesh: Failed parsing attribute 'max_vertices'!"));
+
   if (visual)
-    meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::ConvexMesh>(
+    meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::ConvexMesh>(
         locator.locateResource(filename), scale, true, true, true, true, true);
   else
   {
     if (!convert)
     {
-      meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::ConvexMesh>(
+      meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::ConvexMesh>(
           locator.locateResource(filename), scale, false, false);
     }
     else
     {
-      std::vector<tesseract_geometry::Mesh::Ptr> temp_meshes =
-          tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(
-              locator.locateResource(filename), scale, true, false);
-      for (auto& mesh : temp_meshes)
+      tesseract_common::Resource::Ptr resource = locator.locateResource(filename);
+      auto load_fn = [&resource, &scale, max_vertices]() {
+        std::vector<tesseract_geometry::Mesh::Ptr> temp_meshes =
+            tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(resource, scale, true, false);
+        std::vector<tesseract_geometry::ConvexMesh::Ptr> convex_meshes =
+            tesseract_collision::makeConvexMeshes(temp_meshes, max_vertices);
+        for (auto& convex_mesh : convex_meshes)
+          convex_mesh->setCreationMethod(tesseract_geometry::ConvexMesh::CONVERTED);
+
+        return convex_meshes;
+      };
+
+      // The convex hulls are shared like the meshes, so a resource is only converted once
+      if (resource != nullptr && !resource->getUrl().empty())
+      {
+        std::stringstream key;
+        key << std::setprecision(17) << "convert " << resource->getUrl() << " " << scale.x() << " " << scale.y()
+            << " " << scale.z() << " " << max_vertices;
+        auto& pool = tesseract_geometry::GeometryPool::getInstance();
+        meshes = pool.getMeshes<tesseract_geometry::ConvexMesh>(key.str(), load_fn);
+      }
+      else
       {
-        auto convex_mesh = tesseract_collision::makeConvexMesh(*mesh);
-        convex_mesh->setCreationMethod(tesseract_geometry::ConvexMesh::CONVERTED);
-        meshes.push_back(convex_mesh);
+        meshes = load_fn();
       }
     }
   }
@@ -115,16 +140,21 @@ tesseract_urdf::parseConvexMesh(const tinyxml2::XMLElement* xml_element,
 tinyxml2::XMLElement* tesseract_urdf::writeConvexMesh(const std::shared_ptr<const tesseract_geometry::ConvexMesh>& mesh,
                                                       tinyxml2::XMLDocument& doc,
                                                       const std::string& package_path,
-                                                      const std::string& filename)
+                                                      const std::string& filename,
+                                                      GeometryFileWriter* file_writer)
 {
   if (mesh == nullptr)
     std::throw_with_nested(std::runtime_error("Mesh is nullptr and cannot be converted to XML"));
   tinyxml2::XMLElement* xml_element = doc.NewElement("convex_mesh");
   Eigen::IOFormat eigen_format(Eigen::StreamPrecision, Eigen::DontAlignCols, " ", " ");
 
+  std::string mesh_filename = filename;
   try
   {
-    writeMeshToFile(mesh, trailingSlash(package_path) + noLeadingSlash(filename));
+    if (file_writer != nullptr)
+      mesh_filename = file_writer->writeMesh(mesh, package_path, filename);
+    else
+      writeMeshToFile(mesh, trailingSlash(package_path) + noLeadingSlash(filename));
   }
   catch (...)
   {
@@ -132,7 +162,7 @@ tinyxml2::XMLElement* tesseract_urdf::writeConvexMesh(const std::shared_ptr<cons
   }
 
   // Write the path to the xml element
-  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, filename).c_str());
+  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, mesh_filename).c_str());
 
   // Write the scale to the xml element
   if (!mesh->getScale().isOnes())
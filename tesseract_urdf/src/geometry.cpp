@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <Eigen/Geometry>
 #include <tinyxml2.h>
@@ -162,8 +164,24 @@ tesseract_urdf::parseGeometry(const tinyxml2::XMLElement* xml_element,
 
     if (version < 2 && !visual)
     {
+      // The convex meshes are attached to the shared meshes, so a mesh used by several links is only converted once
+      const std::string key = "urdf_convex_mesh";
+      std::vector<tesseract_geometry::Mesh::Ptr> unconverted;
       for (const auto& mesh : meshes)
-        geometries.push_back(tesseract_collision::makeConvexMesh(*mesh));
+      {
+        if (!mesh->hasAttachment(key))
+          unconverted.push_back(mesh);
+      }
+
+      std::vector<tesseract_geometry::ConvexMesh::Ptr> converted = tesseract_collision::makeConvexMeshes(unconverted);
+      for (std::size_t i = 0; i < unconverted.size(); ++i)
+        unconverted[i]->getAttachment<tesseract_geometry::ConvexMesh>(key, [&converted, i]() { return converted[i]; });
+
+      for (const auto& mesh : meshes)
+      {
+        geometries.push_back(mesh->getAttachment<tesseract_geometry::ConvexMesh>(
+            key, [&mesh]() { return tesseract_collision::makeConvexMesh(*mesh); }));
+      }
     }
     else
     {
@@ -209,7 +227,8 @@ tesseract_urdf::parseGeometry(const tinyxml2::XMLElement* xml_element,
 tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const tesseract_geometry::Geometry>& geometry,
                                                     tinyxml2::XMLDocument& doc,
                                                     const std::string& package_path,
-                                                    const std::string& filename)
+                                                    const std::string& filename,
+                                                    GeometryFileWriter* file_writer)
 {
   if (geometry == nullptr)
     std::throw_with_nested(std::runtime_error("Geometry is nullptr and cannot be converted to XML"));
@@ -289,8 +308,11 @@ tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const
   {
     try
     {
-      tinyxml2::XMLElement* xml_mesh = writeMesh(
-          std::static_pointer_cast<const tesseract_geometry::Mesh>(geometry), doc, package_path, filename + ".ply");
+      tinyxml2::XMLElement* xml_mesh = writeMesh(std::static_pointer_cast<const tesseract_geometry::Mesh>(geometry),
+                                                 doc,
+                                                 package_path,
+                                                 filename + ".ply",
+                                                 file_writer);
       xml_element->InsertEndChild(xml_mesh);
     }
     catch (...)
@@ -306,7 +328,8 @@ tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const
           writeConvexMesh(std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(geometry),
                           doc,
                           package_path,
-                          filename + ".ply");
+                          filename + ".ply",
+                          file_writer);
       xml_element->InsertEndChild(xml_convex_mesh);
     }
     catch (...)
@@ -318,8 +341,12 @@ tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const
   {
     try
     {
-      tinyxml2::XMLElement* xml_sdf_mesh = writeSDFMesh(
-          std::static_pointer_cast<const tesseract_geometry::SDFMesh>(geometry), doc, package_path, filename + ".ply");
+      tinyxml2::XMLElement* xml_sdf_mesh =
+          writeSDFMesh(std::static_pointer_cast<const tesseract_geometry::SDFMesh>(geometry),
+                       doc,
+                       package_path,
+                       filename + ".ply",
+                       file_writer);
       xml_element->InsertEndChild(xml_sdf_mesh);
     }
     catch (...)
@@ -331,8 +358,12 @@ tinyxml2::XMLElement* tesseract_urdf::writeGeometry(const std::shared_ptr<const
   {
     try
     {
-      tinyxml2::XMLElement* xml_octree = writeOctomap(
-          std::static_pointer_cast<const tesseract_geometry::Octree>(geometry), doc, package_path, filename + ".bt");
+      tinyxml2::XMLElement* xml_octree =
+          writeOctomap(std::static_pointer_cast<const tesseract_geometry::Octree>(geometry),
+                       doc,
+                       package_path,
+                       filename + ".bt",
+                       file_writer);
       xml_element->InsertEndChild(xml_octree);
     }
     catch (...)
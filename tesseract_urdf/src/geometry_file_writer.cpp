@@ -0,0 +1,153 @@
+/**
+ * @file geometry_file_writer.cpp
+ * @brief Writes the geometry files of a URDF on background threads
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/impl/octree.h>
+#include <tesseract_geometry/impl/polygon_mesh.h>
+#include <tesseract_urdf/geometry_file_writer.h>
+#include <tesseract_urdf/utils.h>
+
+namespace tesseract_urdf
+{
+GeometryFileWriter::GeometryFileWriter(std::size_t threads, bool deduplicate_meshes)
+  : deduplicate_meshes_(deduplicate_meshes)
+{
+  if (threads == 0)
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  threads_.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i)
+    threads_.emplace_back([this]() { run(); });
+}
+
+GeometryFileWriter::~GeometryFileWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queued_cv_.notify_all();
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+std::string GeometryFileWriter::writeMesh(const std::shared_ptr<const tesseract_geometry::PolygonMesh>& mesh,
+                                          const std::string& package_path,
+                                          const std::string& filename)
+{
+  if (mesh == nullptr)
+    throw std::runtime_error("GeometryFileWriter, the mesh is nullptr!");
+
+  if (deduplicate_meshes_)
+  {
+    auto& candidates = meshes_[mesh->getHash()];
+    for (const auto& candidate : candidates)
+    {
+      if (candidate.first == mesh || *candidate.first == *mesh)
+        return candidate.second;
+    }
+    candidates.emplace_back(mesh, filename);
+  }
+
+  std::string filepath = trailingSlash(package_path) + noLeadingSlash(filename);
+  enqueue([mesh, filepath]() { writeMeshToFile(mesh, filepath); });
+  return filename;
+}
+
+void GeometryFileWriter::writeOctree(const std::shared_ptr<const tesseract_geometry::Octree>& octree,
+                                     const std::string& filepath)
+{
+  if (octree == nullptr)
+    throw std::runtime_error("GeometryFileWriter, the octree is nullptr!");
+
+  enqueue([octree, filepath]() {
+    // writeBinary prunes the tree before writing it, so it needs a copy like writeOctree
+    auto underlying_tree = std::make_shared<octomap::OcTree>(*(octree->getOctree()));
+    if (!underlying_tree->writeBinary(filepath))
+      throw std::runtime_error("Could not write octree to file `" + filepath + "`!");
+  });
+}
+
+void GeometryFileWriter::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return queue_.empty() && running_ == 0; });
+  if (error_ != nullptr)
+  {
+    std::exception_ptr error;
+    std::swap(error, error_);
+    std::rethrow_exception(error);
+  }
+}
+
+void GeometryFileWriter::enqueue(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(task));
+  }
+  queued_cv_.notify_one();
+}
+
+void GeometryFileWriter::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    queued_cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+    if (queue_.empty())
+      return;
+
+    std::function<void()> task = std::move(queue_.front());
+    queue_.pop_front();
+    ++running_;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    --running_;
+    if (error != nullptr && error_ == nullptr)
+      error_ = error;
+
+    if (queue_.empty() && running_ == 0)
+      done_cv_.notify_all();
+  }
+}
+
+}  // namespace tesseract_urdf
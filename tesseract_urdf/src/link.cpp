@@ -45,7 +45,9 @@ tesseract_scene_graph::Link::Ptr
 tesseract_urdf::parseLink(const tinyxml2::XMLElement* xml_element,
                           const tesseract_common::ResourceLocator& locator,
                           std::unordered_map<std::string, tesseract_scene_graph::Material::Ptr>& available_materials,
-                          int version)
+                          int version,
+                          bool load_visuals,
+                          bool defer_collision_meshes)
 {
   std::string link_name;
   if (tesseract_common::QueryStringAttribute(xml_element, "name", link_name) != tinyxml2::XML_SUCCESS)
@@ -69,7 +71,8 @@ tesseract_urdf::parseLink(const tinyxml2::XMLElement* xml_element,
   }
 
   // get visual if it exists
-  for (const tinyxml2::XMLElement* visual = xml_element->FirstChildElement("visual"); visual != nullptr;
+  const tinyxml2::XMLElement* first_visual = load_visuals ? xml_element->FirstChildElement("visual") : nullptr;
+  for (const tinyxml2::XMLElement* visual = first_visual; visual != nullptr;
        visual = visual->NextSiblingElement("visual"))
   {
     std::vector<tesseract_scene_graph::Visual::Ptr> temp_visual;
@@ -92,7 +95,7 @@ tesseract_urdf::parseLink(const tinyxml2::XMLElement* xml_element,
     std::vector<tesseract_scene_graph::Collision::Ptr> temp_collision;
     try
     {
-      temp_collision = parseCollision(collision, locator, version);
+      temp_collision = parseCollision(collision, locator, version, defer_collision_meshes);
     }
     catch (...)
     {
@@ -108,7 +111,8 @@ tesseract_urdf::parseLink(const tinyxml2::XMLElement* xml_element,
 
 tinyxml2::XMLElement* tesseract_urdf::writeLink(const std::shared_ptr<const tesseract_scene_graph::Link>& link,
                                                 tinyxml2::XMLDocument& doc,
-                                                const std::string& package_path)
+                                                const std::string& package_path,
+                                                GeometryFileWriter* file_writer)
 {
   if (link == nullptr)
     std::throw_with_nested(std::runtime_error("Link is nullptr and cannot be converted to XML"));
@@ -133,7 +137,7 @@ tinyxml2::XMLElement* tesseract_urdf::writeLink(const std::shared_ptr<const tess
     try
     {
       boost::filesystem::create_directory(boost::filesystem::path(trailingSlash(package_path) + "visual/"));
-      tinyxml2::XMLElement* xml_visual = writeVisual(vis, doc, package_path, link->getName(), id++);
+      tinyxml2::XMLElement* xml_visual = writeVisual(vis, doc, package_path, link->getName(), id++, file_writer);
       xml_element->InsertEndChild(xml_visual);
     }
     catch (...)
@@ -151,7 +155,8 @@ tinyxml2::XMLElement* tesseract_urdf::writeLink(const std::shared_ptr<const tess
     try
     {
       boost::filesystem::create_directory(boost::filesystem::path(trailingSlash(package_path) + "collision/"));
-      tinyxml2::XMLElement* xml_collision = writeCollision(col, doc, package_path, link->getName(), id++);
+      tinyxml2::XMLElement* xml_collision =
+          writeCollision(col, doc, package_path, link->getName(), id++, file_writer);
       xml_element->InsertEndChild(xml_collision);
     }
     catch (...)
@@ -26,6 +26,8 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <iomanip>
+#include <sstream>
 #include <stdexcept>
 
 #include <boost/algorithm/string/classification.hpp>
@@ -35,10 +37,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tinyxml2.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_geometry/geometry_pool.h>
 #include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_geometry/mesh_parser.h>
+#include <tesseract_geometry/mesh_simplification.h>
 #include <tesseract_urdf/mesh.h>
 #include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/utils.h>
 
 std::vector<tesseract_geometry::Mesh::Ptr> tesseract_urdf::parseMesh(const tinyxml2::XMLElement* xml_element,
@@ -79,12 +84,50 @@ std::vector<tesseract_geometry::Mesh::Ptr> tesseract_urdf::parseMesh(const tinyx
     scale = Eigen::Vector3d(sx, sy, sz);
   }
 
+  double simplify{ 0 };
+  auto xml_status = xml_element->QueryDoubleAttribute("simplify", &simplify);
+  if ((xml_status != tinyxml2::XML_NO_ATTRIBUTE && xml_status != tinyxml2::XML_SUCCESS) || simplify < 0)
+    std::throw_with_nested(std::runtime_error("Mesh: Failed parsing attribute 'simplify'!"));
+
   if (visual)
-    meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(
+  {
+    meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::Mesh>(
         locator.locateResource(filename), scale, true, true, true, true, true);
+  }
+  else if (simplify > 0)
+  {
+    // The collision meshes are simplified within the error bound, a mesh which collapses entirely is kept as is
+    tesseract_common::Resource::Ptr resource = locator.locateResource(filename);
+    auto load_fn = [&resource, &scale, simplify]() {
+      std::vector<tesseract_geometry::Mesh::Ptr> simplified_meshes =
+          tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::Mesh>(resource, scale, true, false);
+      for (auto& mesh : simplified_meshes)
+      {
+        if (tesseract_geometry::Mesh::Ptr simplified_mesh = tesseract_geometry::simplifyMesh(*mesh, simplify))
+          mesh = simplified_mesh;
+      }
+      return simplified_meshes;
+    };
+
+    // The simplified meshes are shared like the meshes, so a resource is only simplified once
+    if (resource != nullptr && !resource->getUrl().empty())
+    {
+      std::stringstream key;
+      key << std::setprecision(17) << "simplify " << resource->getUrl() << " " << scale.x() << " " << scale.y() << " "
+          << scale.z() << " " << simplify;
+      auto& pool = tesseract_geometry::GeometryPool::getInstance();
+      meshes = pool.getMeshes<tesseract_geometry::Mesh>(key.str(), load_fn);
+    }
+    else
+    {
+      meshes = load_fn();
+    }
+  }
   else
-    meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(
+  {
+    meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::Mesh>(
         locator.locateResource(filename), scale, true, false);
+  }
 
   if (meshes.empty())
     std::throw_with_nested(std::runtime_error("Mesh: Error importing meshes from filename: '" + filename + "'!"));
@@ -95,22 +138,27 @@ std::vector<tesseract_geometry::Mesh::Ptr> tesseract_urdf::parseMesh(const tinyx
 tinyxml2::XMLElement* tesseract_urdf::writeMesh(const std::shared_ptr<const tesseract_geometry::Mesh>& mesh,
                                                 tinyxml2::XMLDocument& doc,
                                                 const std::string& package_path,
-                                                const std::string& filename)
+                                                const std::string& filename,
+                                                GeometryFileWriter* file_writer)
 {
   if (mesh == nullptr)
     std::throw_with_nested(std::runtime_error("Mesh is nullptr and cannot be converted to XML"));
   tinyxml2::XMLElement* xml_element = doc.NewElement("mesh");
   Eigen::IOFormat eigen_format(Eigen::StreamPrecision, Eigen::DontAlignCols, " ", " ");
 
+  std::string mesh_filename = filename;
   try
   {
-    writeMeshToFile(mesh, trailingSlash(package_path) + noLeadingSlash(filename));
+    if (file_writer != nullptr)
+      mesh_filename = file_writer->writeMesh(mesh, package_path, filename);
+    else
+      writeMeshToFile(mesh, trailingSlash(package_path) + noLeadingSlash(filename));
   }
   catch (...)
   {
     std::throw_with_nested(std::runtime_error("Failed to write mesh to file: " + package_path + filename));
   }
-  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, filename).c_str());
+  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, mesh_filename).c_str());
 
   if (!mesh->getScale().isOnes(std::numeric_limits<double>::epsilon()))
   {
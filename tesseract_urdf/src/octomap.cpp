@@ -58,9 +58,11 @@ tesseract_geometry::Octree::Ptr tesseract_urdf::parseOctomap(const tinyxml2::XML
     sub_type = tesseract_geometry::Octree::SubType::SPHERE_INSIDE;
   else if (shape_type == "sphere_outside")
     sub_type = tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE;
+  else if (shape_type == "merged_box")
+    sub_type = tesseract_geometry::Octree::SubType::MERGED_BOX;
   else
-    std::throw_with_nested(std::runtime_error("Octomap: Invalid sub shape type, must be 'box', 'sphere_inside', or "
-                                              "'sphere_outside'!"));
+    std::throw_with_nested(std::runtime_error("Octomap: Invalid sub shape type, must be 'box', 'sphere_inside', "
+                                              "'sphere_outside', or 'merged_box'!"));
 
   bool prune = false;
   xml_element->QueryBoolAttribute("prune", &prune);
@@ -99,7 +101,8 @@ tesseract_geometry::Octree::Ptr tesseract_urdf::parseOctomap(const tinyxml2::XML
 tinyxml2::XMLElement* tesseract_urdf::writeOctomap(const std::shared_ptr<const tesseract_geometry::Octree>& octree,
                                                    tinyxml2::XMLDocument& doc,
                                                    const std::string& package_path,
-                                                   const std::string& filename)
+                                                   const std::string& filename,
+                                                   GeometryFileWriter* file_writer)
 {
   if (octree == nullptr)
     std::throw_with_nested(std::runtime_error("Octree is nullptr and cannot be converted to XML"));
@@ -112,6 +115,8 @@ tinyxml2::XMLElement* tesseract_urdf::writeOctomap(const std::shared_ptr<const t
     type_string = "sphere_inside";
   else if (octree->getSubType() == tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE)
     type_string = "sphere_outside";
+  else if (octree->getSubType() == tesseract_geometry::Octree::SubType::MERGED_BOX)
+    type_string = "merged_box";
   else
     std::throw_with_nested(std::runtime_error("Octree subtype is invalid and cannot be converted to XML"));
   xml_element->SetAttribute("shape_type", type_string.c_str());
@@ -120,7 +125,7 @@ tinyxml2::XMLElement* tesseract_urdf::writeOctomap(const std::shared_ptr<const t
 
   try
   {
-    tinyxml2::XMLElement* xml_octree = writeOctree(octree, doc, package_path, filename);
+    tinyxml2::XMLElement* xml_octree = writeOctree(octree, doc, package_path, filename, file_writer);
     xml_element->InsertEndChild(xml_octree);
   }
   catch (...)
@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_urdf/octree.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/utils.h>
 
 tesseract_geometry::Octree::Ptr tesseract_urdf::parseOctree(const tinyxml2::XMLElement* xml_element,
@@ -70,13 +71,20 @@ tesseract_geometry::Octree::Ptr tesseract_urdf::parseOctree(const tinyxml2::XMLE
 tinyxml2::XMLElement* tesseract_urdf::writeOctree(const tesseract_geometry::Octree::ConstPtr& octree,
                                                   tinyxml2::XMLDocument& doc,
                                                   const std::string& package_path,
-                                                  const std::string& filename)
+                                                  const std::string& filename,
+                                                  GeometryFileWriter* file_writer)
 {
   if (octree == nullptr)
     std::throw_with_nested(std::runtime_error("Octree is nullptr and cannot be converted to XML"));
   tinyxml2::XMLElement* xml_element = doc.NewElement("octree");
 
   std::string filepath = trailingSlash(package_path) + noLeadingSlash(filename);
+  if (file_writer != nullptr)
+  {
+    file_writer->writeOctree(octree, filepath);
+    xml_element->SetAttribute("filename", makeURDFFilePath(package_path, filename).c_str());
+    return xml_element;
+  }
 
   // This copy is unfortunate, but avoiding the copy requires flowing mutability up to a lot of
   // functions and their arguments. Don't know why writeBinary is non-const anyway, but we'll live.
@@ -39,6 +39,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_geometry/mesh_parser.h>
 #include <tesseract_urdf/sdf_mesh.h>
 #include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/utils.h>
 
 std::vector<tesseract_geometry::SDFMesh::Ptr>
@@ -81,10 +82,10 @@ tesseract_urdf::parseSDFMesh(const tinyxml2::XMLElement* xml_element,
   }
 
   if (visual)
-    meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::SDFMesh>(
+    meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::SDFMesh>(
         locator.locateResource(filename), scale, true, true, true, true, true);
   else
-    meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::SDFMesh>(
+    meshes = tesseract_geometry::createSharedMeshFromResource<tesseract_geometry::SDFMesh>(
         locator.locateResource(filename), scale, true, false);
 
   if (meshes.empty())
@@ -96,22 +97,27 @@ tesseract_urdf::parseSDFMesh(const tinyxml2::XMLElement* xml_element,
 tinyxml2::XMLElement* tesseract_urdf::writeSDFMesh(const std::shared_ptr<const tesseract_geometry::SDFMesh>& sdf_mesh,
                                                    tinyxml2::XMLDocument& doc,
                                                    const std::string& package_path,
-                                                   const std::string& filename)
+                                                   const std::string& filename,
+                                                   GeometryFileWriter* file_writer)
 {
   if (sdf_mesh == nullptr)
     std::throw_with_nested(std::runtime_error("SDF Mesh is nullptr and cannot be converted to XML"));
   tinyxml2::XMLElement* xml_element = doc.NewElement("sdf_mesh");
   Eigen::IOFormat eigen_format(Eigen::StreamPrecision, Eigen::DontAlignCols, " ", " ");
 
+  std::string mesh_filename = filename;
   try
   {
-    writeMeshToFile(sdf_mesh, trailingSlash(package_path) + noLeadingSlash(filename));
+    if (file_writer != nullptr)
+      mesh_filename = file_writer->writeMesh(sdf_mesh, package_path, filename);
+    else
+      writeMeshToFile(sdf_mesh, trailingSlash(package_path) + noLeadingSlash(filename));
   }
   catch (...)
   {
     std::throw_with_nested(std::runtime_error("Failed to write convex mesh to file: " + package_path + filename));
   }
-  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, filename).c_str());
+  xml_element->SetAttribute("filename", makeURDFFilePath(package_path, mesh_filename).c_str());
 
   if (!sdf_mesh->getScale().isOnes())
   {
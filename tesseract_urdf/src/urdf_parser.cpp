@@ -26,14 +26,27 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 #include <tesseract_common/utils.h>
 #include <tinyxml2.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/executor.h>
+#include <tesseract_urdf/geometry.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/joint.h>
 #include <tesseract_urdf/link.h>
 #include <tesseract_urdf/material.h>
@@ -42,8 +55,214 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_urdf
 {
+namespace
+{
+using MaterialMap = std::unordered_map<std::string, tesseract_scene_graph::Material::Ptr>;
+
+/**
+ * @brief Call a function for the indices from zero to size on several workers of the default executor, each index
+ * is taken in order
+ * @param fn Called with each index, once it returns false no more indices are taken
+ */
+void parallelFor(std::size_t size, std::size_t num_workers, const std::function<bool(std::size_t)>& fn)
+{
+  if (size == 0)
+    return;
+
+  num_workers = std::min(std::max<std::size_t>(num_workers, 1), size);
+  std::atomic<std::size_t> next{ 0 };
+  auto worker = [&]() {
+    for (std::size_t i = next++; i < size; i = next++)
+    {
+      if (!fn(i))
+        next = size;
+    }
+  };
+
+  tesseract_common::getDefaultExecutor()->parallelFor(num_workers, [&worker](std::size_t /*index*/) { worker(); });
+}
+
+/**
+ * @brief Load the meshes of the links in parallel before the links are parsed
+ * @details Each distinct mesh, convex mesh and sdf mesh of the visuals and collisions is parsed once, so the loading
+ * and conversion of the meshes is spread over the threads instead of a link with many meshes loading them on one
+ * thread. The meshes are shared through the geometry pool, so parsing the links afterwards only looks them up. Errors
+ * are ignored, they are reported when the links are parsed.
+ * @param load_visuals Indicate if the meshes of the visuals are loaded
+ * @param defer_collision_meshes Indicate if the meshes and convex meshes of the collisions are skipped because they
+ * are loaded in the background
+ * @return The geometries, which keep the meshes in the pool until the links are parsed
+ */
+std::vector<std::vector<tesseract_geometry::Geometry::Ptr>>
+loadLinkMeshes(const std::vector<const tinyxml2::XMLElement*>& links,
+               const tesseract_common::ResourceLocator& locator,
+               int version,
+               std::size_t threads,
+               bool load_visuals,
+               bool defer_collision_meshes)
+{
+  std::vector<std::pair<const tinyxml2::XMLElement*, bool>> geometries;
+  std::unordered_set<std::string> keys;
+  for (const tinyxml2::XMLElement* link : links)
+  {
+    for (const char* tag : { "visual", "collision" })
+    {
+      const bool visual = (std::string(tag) == "visual");
+      if (visual && !load_visuals)
+        continue;
+
+      for (const tinyxml2::XMLElement* element = link->FirstChildElement(tag); element != nullptr;
+           element = element->NextSiblingElement(tag))
+      {
+        const tinyxml2::XMLElement* geometry = element->FirstChildElement("geometry");
+        const tinyxml2::XMLElement* shape = (geometry != nullptr) ? geometry->FirstChildElement() : nullptr;
+        if (shape == nullptr)
+          continue;
+
+        const std::string type = shape->Value();
+        if (type != "mesh" && type != "convex_mesh" && type != "sdf_mesh")
+          continue;
+
+        if (!visual && defer_collision_meshes && type != "sdf_mesh")
+          continue;
+
+        std::string key = std::string(tag) + " " + type;
+
+        for (const tinyxml2::XMLAttribute* attr = shape->FirstAttribute(); attr != nullptr; attr = attr->Next())
+          key.append(" ").append(attr->Name()).append("=").append(attr->Value());
+
+        if (keys.insert(key).second)
+          geometries.emplace_back(geometry, visual);
+      }
+    }
+  }
+
+  std::vector<std::vector<tesseract_geometry::Geometry::Ptr>> loaded(geometries.size());
+  parallelFor(geometries.size(), threads, [&](std::size_t i) {
+    try
+    {
+      loaded[i] = parseGeometry(geometries[i].first, locator, geometries[i].second, version);
+    }
+    catch (...)
+    {
+      // The error is reported when the link is parsed
+    }
+    return true;
+  });
+
+  return loaded;
+}
+
+/**
+ * @brief Parse the link elements of a robot in document order
+ * @details A visual may define a named material used by the links after it, so when parsing in parallel each link is
+ * parsed with a copy of the materials available before it. These are found by parsing the materials of the visuals
+ * first, which is cheap compared to the meshes of the links. The meshes of all links are loaded before the links are
+ * parsed, see loadLinkMeshes.
+ * @param load_visuals Indicate if the visual elements of the links are parsed
+ * @param defer_collision_meshes Indicate if the collision meshes are loaded in the background
+ * @param errors The error of each link which failed to parse, the link is a nullptr. A link after the first which
+ * failed may not be parsed.
+ * @return The links in document order
+ */
+std::vector<tesseract_scene_graph::Link::Ptr> parseLinks(const tinyxml2::XMLElement* robot,
+                                                         const tesseract_common::ResourceLocator& locator,
+                                                         MaterialMap& available_materials,
+                                                         int version,
+                                                         std::size_t threads,
+                                                         bool load_visuals,
+                                                         bool defer_collision_meshes,
+                                                         std::vector<std::exception_ptr>& errors)
+{
+  std::vector<const tinyxml2::XMLElement*> elements;
+  for (const tinyxml2::XMLElement* link = robot->FirstChildElement("link"); link != nullptr;
+       link = link->NextSiblingElement("link"))
+    elements.push_back(link);
+
+  std::vector<tesseract_scene_graph::Link::Ptr> links(elements.size());
+  errors.assign(elements.size(), nullptr);
+
+  const std::size_t num_workers = std::min(std::max<std::size_t>(threads, 1), elements.size());
+  if (num_workers <= 1)
+  {
+    for (std::size_t i = 0; i < elements.size(); ++i)
+    {
+      try
+      {
+        links[i] = parseLink(elements[i], locator, available_materials, version, load_visuals, defer_collision_meshes);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+        break;
+      }
+    }
+
+    return links;
+  }
+
+  // The materials available to each link, a new copy is only made by a link defining a material
+  std::vector<std::shared_ptr<const MaterialMap>> link_materials;
+  link_materials.reserve(elements.size());
+  auto current = std::make_shared<const MaterialMap>(available_materials);
+  for (const tinyxml2::XMLElement* link : elements)
+  {
+    link_materials.push_back(current);
+    std::shared_ptr<MaterialMap> defined;
+    const tinyxml2::XMLElement* first_visual = load_visuals ? link->FirstChildElement("visual") : nullptr;
+    for (const tinyxml2::XMLElement* visual = first_visual; visual != nullptr;
+         visual = visual->NextSiblingElement("visual"))
+    {
+      const tinyxml2::XMLElement* material = visual->FirstChildElement("material");
+      if (material == nullptr ||
+          (material->FirstChildElement("color") == nullptr && material->FirstChildElement("texture") == nullptr))
+        continue;
+
+      if (defined == nullptr)
+        defined = std::make_shared<MaterialMap>(*current);
+
+      try
+      {
+        parseMaterial(material, *defined, true, version);
+      }
+      catch (...)
+      {
+        // The error is reported when the link is parsed
+      }
+    }
+
+    if (defined != nullptr)
+      current = defined;
+  }
+
+  // Load the meshes first, the links then share them
+  const std::vector<std::vector<tesseract_geometry::Geometry::Ptr>> meshes =
+      loadLinkMeshes(elements, locator, version, threads, load_visuals, defer_collision_meshes);
+
+  parallelFor(elements.size(), num_workers, [&](std::size_t i) {
+    try
+    {
+      MaterialMap materials(*link_materials[i]);
+      links[i] = parseLink(elements[i], locator, materials, version, load_visuals, defer_collision_meshes);
+      return true;
+    }
+    catch (...)
+    {
+      // Links are taken in order, so every link before this one is still parsed
+      errors[i] = std::current_exception();
+      return false;
+    }
+  });
+
+  return links;
+}
+}  // namespace
+
 tesseract_scene_graph::SceneGraph::UPtr parseURDFString(const std::string& urdf_xml_string,
-                                                        const tesseract_common::ResourceLocator& locator)
+                                                        const tesseract_common::ResourceLocator& locator,
+                                                        std::size_t threads,
+                                                        bool load_visuals,
+                                                        bool defer_collision_meshes)
 {
   tinyxml2::XMLDocument xml_doc;
   if (xml_doc.Parse(urdf_xml_string.c_str()) != tinyxml2::XML_SUCCESS)
@@ -85,17 +304,23 @@ tesseract_scene_graph::SceneGraph::UPtr parseURDFString(const std::string& urdf_
     available_materials[m->getName()] = m;
   }
 
-  for (tinyxml2::XMLElement* link = robot->FirstChildElement("link"); link != nullptr;
-       link = link->NextSiblingElement("link"))
+  std::vector<std::exception_ptr> link_errors;
+  std::vector<tesseract_scene_graph::Link::Ptr> links = parseLinks(
+      robot, locator, available_materials, urdf_version, threads, load_visuals, defer_collision_meshes, link_errors);
+  for (std::size_t i = 0; i < links.size(); ++i)
   {
-    tesseract_scene_graph::Link::Ptr l = nullptr;
-    try
-    {
-      l = parseLink(link, locator, available_materials, urdf_version);
-    }
-    catch (...)
+    const tesseract_scene_graph::Link::Ptr& l = links[i];
+    if (l == nullptr)
     {
-      std::throw_with_nested(std::runtime_error("URDF: Error parsing 'link' element for robot '" + robot_name + "'!"));
+      try
+      {
+        std::rethrow_exception(link_errors[i]);
+      }
+      catch (...)
+      {
+        std::throw_with_nested(
+            std::runtime_error("URDF: Error parsing 'link' element for robot '" + robot_name + "'!"));
+      }
     }
 
     // Check if link name is unique
@@ -158,7 +383,10 @@ tesseract_scene_graph::SceneGraph::UPtr parseURDFString(const std::string& urdf_
 }
 
 tesseract_scene_graph::SceneGraph::UPtr parseURDFFile(const std::string& path,
-                                                      const tesseract_common::ResourceLocator& locator)
+                                                      const tesseract_common::ResourceLocator& locator,
+                                                      std::size_t threads,
+                                                      bool load_visuals,
+                                                      bool defer_collision_meshes)
 {
   std::ifstream ifs(path);
   if (!ifs)
@@ -168,7 +396,7 @@ tesseract_scene_graph::SceneGraph::UPtr parseURDFFile(const std::string& path,
   tesseract_scene_graph::SceneGraph::UPtr sg;
   try
   {
-    sg = parseURDFString(urdf_xml_string, locator);
+    sg = parseURDFString(urdf_xml_string, locator, threads, load_visuals, defer_collision_meshes);
   }
   catch (...)
   {
@@ -180,7 +408,9 @@ tesseract_scene_graph::SceneGraph::UPtr parseURDFFile(const std::string& path,
 
 void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
                    const std::string& package_path,
-                   const std::string& urdf_name)
+                   const std::string& urdf_name,
+                   std::size_t threads,
+                   bool deduplicate_meshes)
 {
   // Check for null input
   if (sg == nullptr)
@@ -195,18 +425,34 @@ void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
   // boost::filesystem::create_directory(boost::filesystem::path(directory + "collision"));
   // boost::filesystem::create_directory(boost::filesystem::path(directory + "visual"));
 
-  // Create XML Document
+  // Prepare the urdf directory
+  boost::filesystem::create_directory(boost::filesystem::path(trailingSlash(package_path) + "urdf/"));
+
+  // Open the URDF file, the XML is written to it one link or joint at a time
+  std::string full_filepath;
+  if (!urdf_name.empty())
+    full_filepath = trailingSlash(package_path) + "urdf/" + noLeadingSlash(urdf_name) + ".urdf";
+  else
+    full_filepath = trailingSlash(package_path) + "urdf/" + sg->getName() + ".urdf";
+
+  std::unique_ptr<FILE, int (*)(FILE*)> file(std::fopen(full_filepath.c_str(), "w"), &std::fclose);
+  if (file == nullptr)
+    std::throw_with_nested(std::runtime_error("Could not open URDF file '" + full_filepath + "' for writing"));
+
+  // The mesh and octree files are written on background threads while the XML is generated
+  GeometryFileWriter file_writer(threads, deduplicate_meshes);
+
+  // Document holding the XML of the link or joint being written
   tinyxml2::XMLDocument doc;
+  tinyxml2::XMLPrinter printer(file.get());
 
   // Add XML Declaration
-  tinyxml2::XMLDeclaration* xml_declaration = doc.NewDeclaration(R"(xml version="1.0")");
-  doc.InsertFirstChild(xml_declaration);
+  printer.PushDeclaration(R"(xml version="1.0")");
 
   // Assign Robot Name
-  tinyxml2::XMLElement* xml_robot = doc.NewElement("robot");
-  xml_robot->SetAttribute("name", sg->getName().c_str());
+  printer.OpenElement("robot");
+  printer.PushAttribute("name", sg->getName().c_str());
   // version?
-  doc.InsertEndChild(xml_robot);
 
   // Materials were not saved anywhere at load
 
@@ -230,8 +476,9 @@ void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
     const tesseract_scene_graph::Link::ConstPtr& l = sg->getLink(s);
     try
     {
-      tinyxml2::XMLElement* xml_link = writeLink(l, doc, package_path);
-      xml_robot->InsertEndChild(xml_link);
+      tinyxml2::XMLElement* xml_link = writeLink(l, doc, package_path, &file_writer);
+      xml_link->Accept(&printer);
+      doc.DeleteNode(xml_link);
     }
     catch (...)
     {
@@ -260,7 +507,8 @@ void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
     try
     {
       tinyxml2::XMLElement* xml_joint = writeJoint(j, doc);
-      xml_robot->InsertEndChild(xml_joint);
+      xml_joint->Accept(&printer);
+      doc.DeleteNode(xml_joint);
     }
     catch (...)
     {
@@ -270,16 +518,18 @@ void writeURDFFile(const tesseract_scene_graph::SceneGraph::ConstPtr& sg,
 
   // Check for acyclic?
 
-  // Prepare the urdf directory
-  boost::filesystem::create_directory(boost::filesystem::path(trailingSlash(package_path) + "urdf/"));
+  printer.CloseElement();
+  if (std::fclose(file.release()) != 0)
+    std::throw_with_nested(std::runtime_error("Could not write URDF file '" + full_filepath + "'"));
 
-  // Write the URDF XML to a file
-  std::string full_filepath;
-  if (!urdf_name.empty())
-    full_filepath = trailingSlash(package_path) + "urdf/" + noLeadingSlash(urdf_name) + ".urdf";
-  else
-    full_filepath = trailingSlash(package_path) + "urdf/" + sg->getName() + ".urdf";
-  doc.SaveFile(full_filepath.c_str());
+  try
+  {
+    file_writer.wait();
+  }
+  catch (...)
+  {
+    std::throw_with_nested(std::runtime_error("Could not write out urdf geometry files"));
+  }
 }
 
 }  // namespace tesseract_urdf
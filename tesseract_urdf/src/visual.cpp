@@ -131,7 +131,8 @@ tinyxml2::XMLElement* tesseract_urdf::writeVisual(const std::shared_ptr<const te
                                                   tinyxml2::XMLDocument& doc,
                                                   const std::string& package_path,
                                                   const std::string& link_name,
-                                                  const int id = -1)
+                                                  const int id = -1,
+                                                  GeometryFileWriter* file_writer)
 {
   if (visual == nullptr)
     std::throw_with_nested(std::runtime_error("Visual is nullptr and cannot be converted to XML"));
@@ -173,7 +174,8 @@ tinyxml2::XMLElement* tesseract_urdf::writeVisual(const std::shared_ptr<const te
     std::string filename = "visual/" + link_name + "_visual";
     if (id >= 0)
       filename += "_" + std::to_string(id);
-    tinyxml2::XMLElement* xml_geometry = writeGeometry(visual->geometry, doc, package_path, filename);
+    tinyxml2::XMLElement* xml_geometry =
+        writeGeometry(visual->geometry, doc, package_path, filename, file_writer);
     xml_element->InsertEndChild(xml_geometry);
   }
   catch (...)
@@ -93,6 +93,56 @@ TEST(TesseractURDFUnit, parse_collision)  // NOLINT
   }
 }
 
+TEST(TesseractURDFUnit, parse_collision_deferred)  // NOLINT
+{
+  tesseract_common::TesseractSupportResourceLocator resource_locator;
+
+  std::string str = R"(<collision name="test">
+                         <origin xyz="1 2 3" rpy="0 0 0" />
+                         <geometry>
+                           <convex_mesh filename="package://tesseract_support/meshes/box_2m.ply" scale="1 2 1"
+                                        convert="true"/>
+                         </geometry>
+                       </collision>)";
+  tinyxml2::XMLDocument xml_doc;
+  EXPECT_TRUE(xml_doc.Parse(str.c_str()) == tinyxml2::XML_SUCCESS);
+  const tinyxml2::XMLElement* element = xml_doc.FirstChildElement("collision");
+
+  std::vector<tesseract_scene_graph::Collision::Ptr> elem =
+      tesseract_urdf::parseCollision(element, resource_locator, 2, true);
+  xml_doc.Clear();
+
+  // The stand-in is the box around the vertices of the mesh
+  ASSERT_EQ(elem.size(), 1);
+  EXPECT_EQ(elem[0]->name, "test");
+  EXPECT_TRUE(elem[0]->origin.translation().isApprox(Eigen::Vector3d(1, 2, 3), 1e-6));
+  ASSERT_EQ(elem[0]->geometry->getType(), tesseract_geometry::GeometryType::BOX);
+  auto box = std::static_pointer_cast<const tesseract_geometry::Box>(elem[0]->geometry);
+  EXPECT_NEAR(box->getX(), 2, 1e-5);
+  EXPECT_NEAR(box->getY(), 4, 1e-5);
+  EXPECT_NEAR(box->getZ(), 2, 1e-5);
+  ASSERT_TRUE(elem[0]->deferred_geometry.valid());
+
+  // The loaded collision is the converted convex mesh at the origin of the element
+  const std::vector<tesseract_scene_graph::Collision::Ptr>& loaded = elem[0]->deferred_geometry.get();
+  ASSERT_EQ(loaded.size(), 1);
+  EXPECT_EQ(loaded[0]->name, "test");
+  EXPECT_TRUE(loaded[0]->origin.isApprox(elem[0]->origin, 1e-6));
+  EXPECT_EQ(loaded[0]->geometry->getType(), tesseract_geometry::GeometryType::CONVEX_MESH);
+  EXPECT_FALSE(loaded[0]->deferred_geometry.valid());
+
+  // Primitive geometry is never deferred
+  str = R"(<collision>
+             <geometry>
+               <box size="1 2 3" />
+             </geometry>
+           </collision>)";
+  EXPECT_TRUE(xml_doc.Parse(str.c_str()) == tinyxml2::XML_SUCCESS);
+  elem = tesseract_urdf::parseCollision(xml_doc.FirstChildElement("collision"), resource_locator, 2, true);
+  ASSERT_EQ(elem.size(), 1);
+  EXPECT_FALSE(elem[0]->deferred_geometry.valid());
+}
+
 TEST(TesseractURDFUnit, write_collision)  // NOLINT
 {
   {  // trigger check for an assigned name and check for specified ID
@@ -14,6 +14,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_urdf/geometry_file_writer.h>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
@@ -101,6 +102,35 @@ bool runTest(
   return true;
 }
 
+template <typename ElementType>
+bool runTest(
+    ElementType& type,
+    std::function<ElementType(const tinyxml2::XMLElement*, const tesseract_common::ResourceLocator&, const int, bool)>
+        func,
+    const std::string& xml_string,
+    const std::string& element_name,
+    const tesseract_common::ResourceLocator& locator,
+    int version)
+{
+  tinyxml2::XMLDocument xml_doc;
+  EXPECT_TRUE(xml_doc.Parse(xml_string.c_str()) == tinyxml2::XML_SUCCESS);
+
+  tinyxml2::XMLElement* element = xml_doc.FirstChildElement(element_name.c_str());
+  EXPECT_TRUE(element != nullptr);
+
+  try
+  {
+    type = func(element, locator, version, false);
+  }
+  catch (const std::exception& e)
+  {
+    tesseract_common::printNestedException(e);
+    return false;
+  }
+
+  return true;
+}
+
 template <typename ElementType>
 bool runTest(ElementType& type,
              std::function<ElementType(const tinyxml2::XMLElement*,
@@ -132,6 +162,39 @@ bool runTest(ElementType& type,
   return true;
 }
 
+template <typename ElementType>
+bool runTest(ElementType& type,
+             std::function<ElementType(const tinyxml2::XMLElement*,
+                                       const tesseract_common::ResourceLocator&,
+                                       std::unordered_map<std::string, tesseract_scene_graph::Material::Ptr>&,
+                                       const int,
+                                       bool,
+                                       bool)> func,
+             const std::string& xml_string,
+             const std::string& element_name,
+             const tesseract_common::ResourceLocator& locator,
+             std::unordered_map<std::string, tesseract_scene_graph::Material::Ptr>& available_materials,
+             int version)
+{
+  tinyxml2::XMLDocument xml_doc;
+  EXPECT_TRUE(xml_doc.Parse(xml_string.c_str()) == tinyxml2::XML_SUCCESS);
+
+  tinyxml2::XMLElement* element = xml_doc.FirstChildElement(element_name.c_str());
+  EXPECT_TRUE(element != nullptr);
+
+  try
+  {
+    type = func(element, locator, available_materials, version, true, false);
+  }
+  catch (const std::exception& e)
+  {
+    tesseract_common::printNestedException(e);
+    return false;
+  }
+
+  return true;
+}
+
 template <typename ElementType>
 bool runTest(ElementType& type,
              std::function<ElementType(const tinyxml2::XMLElement*,
@@ -233,7 +296,10 @@ int writeTest(TessType& type,
  */
 template <typename TessType>
 int writeTest(TessType& type,
-              std::function<tinyxml2::XMLElement*(const TessType&, tinyxml2::XMLDocument&, const std::string&)> func,
+              std::function<tinyxml2::XMLElement*(const TessType&,
+                                                  tinyxml2::XMLDocument&,
+                                                  const std::string&,
+                                                  tesseract_urdf::GeometryFileWriter*)> func,
               std::string& text,
               const std::string& directory)
 {
@@ -241,7 +307,7 @@ int writeTest(TessType& type,
   int status = 0;
   try
   {
-    tinyxml2::XMLElement* element = func(type, doc, directory);
+    tinyxml2::XMLElement* element = func(type, doc, directory, nullptr);
     text = toString(element);
     if (element != nullptr)
       status = 0;
@@ -266,19 +332,21 @@ int writeTest(TessType& type,
  * @return 0 if success, 1 if exception thrown, 2 if nullptr generated
  */
 template <typename TessType>
-int writeTest(
-    TessType& type,
-    std::function<
-        tinyxml2::XMLElement*(const TessType&, tinyxml2::XMLDocument&, const std::string&, const std::string&)> func,
-    std::string& text,
-    const std::string& directory,
-    const std::string& filename)
+int writeTest(TessType& type,
+              std::function<tinyxml2::XMLElement*(const TessType&,
+                                                  tinyxml2::XMLDocument&,
+                                                  const std::string&,
+                                                  const std::string&,
+                                                  tesseract_urdf::GeometryFileWriter*)> func,
+              std::string& text,
+              const std::string& directory,
+              const std::string& filename)
 {
   tinyxml2::XMLDocument doc;
   int status = 0;
   try
   {
-    tinyxml2::XMLElement* element = func(type, doc, directory, filename);
+    tinyxml2::XMLElement* element = func(type, doc, directory, filename, nullptr);
     text = toString(element);
     if (element != nullptr)
       status = 0;
@@ -309,7 +377,8 @@ int writeTest(TessType& type,
                                                   tinyxml2::XMLDocument&,
                                                   const std::string&,
                                                   const std::string&,
-                                                  const int)> func,
+                                                  const int,
+                                                  tesseract_urdf::GeometryFileWriter*)> func,
               std::string& text,
               const std::string& directory,
               const std::string& link_name,
@@ -319,7 +388,7 @@ int writeTest(TessType& type,
   int status = 0;
   try
   {
-    tinyxml2::XMLElement* element = func(type, doc, directory, link_name, id);
+    tinyxml2::XMLElement* element = func(type, doc, directory, link_name, id, nullptr);
     text = toString(element);
     if (element != nullptr)
       status = 0;
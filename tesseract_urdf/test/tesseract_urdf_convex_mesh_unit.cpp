@@ -72,6 +72,35 @@ TEST(TesseractURDFUnit, parse_convex_mesh)  // NOLINT
     EXPECT_TRUE(geom.size() == 2);
   }
 
+  {
+    std::string str = R"(<convex_mesh filename="package://tesseract_support/meshes/box_2m.ply" convert="true" )"
+                      R"(max_vertices="6"/>)";
+    std::vector<tesseract_geometry::ConvexMesh::Ptr> geom;
+    EXPECT_TRUE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+        geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.size() == 1);
+    EXPECT_TRUE(geom[0]->getVertexCount() <= 6);
+    EXPECT_TRUE(geom[0]->getVertexCount() >= 4);
+  }
+
+  {
+    std::string str = R"(<convex_mesh filename="package://tesseract_support/meshes/box_2m.ply" convert="true" )"
+                      R"(max_vertices="a"/>)";
+    std::vector<tesseract_geometry::ConvexMesh::Ptr> geom;
+    EXPECT_FALSE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+        geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.empty());
+  }
+
+  {
+    std::string str = R"(<convex_mesh filename="package://tesseract_support/meshes/box_2m.ply" convert="true" )"
+                      R"(max_vertices="-1"/>)";
+    std::vector<tesseract_geometry::ConvexMesh::Ptr> geom;
+    EXPECT_FALSE(runTest<std::vector<tesseract_geometry::ConvexMesh::Ptr>>(
+        geom, &tesseract_urdf::parseConvexMesh, str, "convex_mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.empty());
+  }
+
   {
     std::string str = R"(<convex_mesh filename="package://tesseract_support/meshes/box_2m.ply"/>)";
     std::vector<tesseract_geometry::ConvexMesh::Ptr> geom;
@@ -50,6 +50,33 @@ TEST(TesseractURDFUnit, parse_mesh)  // NOLINT
     EXPECT_NEAR(geom[0]->getScale()[2], 1, 1e-5);
   }
 
+  {
+    std::string str = R"(<mesh filename="package://tesseract_support/meshes/sphere_p25m.stl" simplify="0.3"/>)";
+    std::vector<tesseract_geometry::Mesh::Ptr> geom;
+    EXPECT_TRUE(runTest<std::vector<tesseract_geometry::Mesh::Ptr>>(
+        geom, &tesseract_urdf::parseMesh, str, "mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.size() == 1);
+    EXPECT_GT(geom[0]->getFaceCount(), 0);
+    EXPECT_LT(geom[0]->getFaceCount(), 80);
+    EXPECT_LT(geom[0]->getVertexCount(), 42);
+  }
+
+  {
+    std::string str = R"(<mesh filename="package://tesseract_support/meshes/sphere_p25m.stl" simplify="a"/>)";
+    std::vector<tesseract_geometry::Mesh::Ptr> geom;
+    EXPECT_FALSE(runTest<std::vector<tesseract_geometry::Mesh::Ptr>>(
+        geom, &tesseract_urdf::parseMesh, str, "mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.empty());
+  }
+
+  {
+    std::string str = R"(<mesh filename="package://tesseract_support/meshes/sphere_p25m.stl" simplify="-1"/>)";
+    std::vector<tesseract_geometry::Mesh::Ptr> geom;
+    EXPECT_FALSE(runTest<std::vector<tesseract_geometry::Mesh::Ptr>>(
+        geom, &tesseract_urdf::parseMesh, str, "mesh", resource_locator, 2, false));
+    EXPECT_TRUE(geom.empty());
+  }
+
   {
     std::string str = R"(<mesh filename="abc" scale="1 2 1"/>)";
     std::vector<tesseract_geometry::Mesh::Ptr> geom;
@@ -114,6 +114,18 @@ TEST(TesseractURDFUnit, parse_octree)  // NOLINT
     EXPECT_EQ(geom->calcNumSubShapes(), 8);
   }
 
+  {
+    std::string str = R"(<octomap shape_type="merged_box" prune="true">
+                           <octree filename="package://tesseract_support/meshes/box_2m.bt"/>
+                         </octomap>)";
+    tesseract_geometry::Octree::Ptr geom;
+    EXPECT_TRUE(runTest<tesseract_geometry::Octree::Ptr>(
+        geom, &tesseract_urdf::parseOctomap, str, "octomap", resource_locator, 2, true));
+    EXPECT_TRUE(geom->getSubType() == geom->MERGED_BOX);
+    EXPECT_TRUE(geom->getOctree() != nullptr);
+    EXPECT_FALSE(tesseract_geometry::Octree::getMergedBoxes(*geom->getOctree()).empty());
+  }
+
   {
     std::string str = R"(<octomap shape_type="sphere_outside" prune="true">
                            <octree />
@@ -2,9 +2,11 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <Eigen/Geometry>
+#include <boost/filesystem.hpp>
 #include <tesseract_common/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_geometry/impl/mesh.h>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 #include "tesseract_urdf_common_unit.h"
@@ -327,6 +329,12 @@ TEST(TesseractURDFUnit, parse_urdf_with_available_materials)  // NOLINT
     EXPECT_TRUE(sg->getJoints().size() == 1);
     EXPECT_TRUE(sg->getLinks().size() == 2);
     EXPECT_EQ(sg->getLink("l1")->visual[0]->material->getName(), "test_material");
+
+    // The material defined by the first link is available to the second link when parsed in parallel
+    tesseract_scene_graph::SceneGraph::Ptr sg_threaded = tesseract_urdf::parseURDFString(str, resource_locator, 2);
+    EXPECT_TRUE(sg_threaded != nullptr);
+    EXPECT_TRUE(*sg_threaded == *sg);
+    EXPECT_TRUE(*sg_threaded->getLink("l2")->visual[0]->material == *sg->getLink("l1")->visual[0]->material);
   }
 
   {
@@ -363,7 +371,8 @@ TEST(TesseractURDFUnit, parse_urdf_with_available_materials)  // NOLINT
                </visual>
              </link>
            </robot>)";
-    EXPECT_ANY_THROW(tesseract_urdf::parseURDFString(str, resource_locator));  // NOLINT
+    EXPECT_ANY_THROW(tesseract_urdf::parseURDFString(str, resource_locator));     // NOLINT
+    EXPECT_ANY_THROW(tesseract_urdf::parseURDFString(str, resource_locator, 2));  // NOLINT
   }
 
   {
@@ -421,6 +430,30 @@ TEST(TesseractURDFUnit, LoadURDFUnit)  // NOLINT
   EXPECT_TRUE(g->isTree());
   EXPECT_TRUE(g->isAcyclic());
 
+  // Parsing the links in parallel provides the same scene graph
+  auto g_threaded = tesseract_urdf::parseURDFFile(urdf_file, locator, 4);
+  EXPECT_TRUE(*g_threaded == *g);
+
+  // The collision meshes are loaded and converted to convex meshes once, then shared
+  EXPECT_EQ(g_threaded->getLink("link_1")->collision.front()->geometry,
+            g->getLink("link_1")->collision.front()->geometry);
+  EXPECT_EQ(g_threaded->getLink("link_1")->collision.front()->geometry->getType(),
+            tesseract_geometry::GeometryType::CONVEX_MESH);
+
+  // Skipping the visuals only removes the visuals of the links
+  for (std::size_t threads : std::vector<std::size_t>{ 1, 4 })
+  {
+    auto g_headless = tesseract_urdf::parseURDFFile(urdf_file, locator, threads, false);
+    EXPECT_EQ(g_headless->getLinks().size(), g->getLinks().size());
+    EXPECT_EQ(g_headless->getJoints().size(), g->getJoints().size());
+    EXPECT_FALSE(g->getLink("link_1")->visual.empty());
+    for (const auto& link : g_headless->getLinks())
+    {
+      EXPECT_TRUE(link->visual.empty());
+      EXPECT_EQ(link->collision.size(), g->getLink(link->getName())->collision.size());
+    }
+  }
+
   // Save Graph
   g->saveDOT(tesseract_common::getTempPath() + "tesseract_urdf_import.dot");
 
@@ -520,3 +553,76 @@ TEST(TesseractURDFUnit, write_urdf)  // NOLINT
   }
   */
 }
+
+TEST(TesseractURDFUnit, write_urdf_deduplicate_meshes)  // NOLINT
+{
+  tesseract_common::VectorVector3d vertices = { Eigen::Vector3d(0, 0, 0),
+                                                Eigen::Vector3d(1, 0, 0),
+                                                Eigen::Vector3d(0, 1, 0) };
+  Eigen::VectorXi indices(4);
+  indices << 3, 0, 1, 2;
+
+  // Two links with distinct but equal meshes
+  tesseract_scene_graph::SceneGraph::Ptr sg = std::make_shared<tesseract_scene_graph::SceneGraph>("dedup");
+  for (const char* name : { "link_0", "link_1" })
+  {
+    tesseract_scene_graph::Link link(name);
+    auto visual = std::make_shared<tesseract_scene_graph::Visual>();
+    visual->geometry = std::make_shared<tesseract_geometry::Mesh>(
+        std::make_shared<tesseract_common::VectorVector3d>(vertices), std::make_shared<Eigen::VectorXi>(indices));
+    link.visual.push_back(visual);
+    sg->addLink(link);
+  }
+
+  tesseract_scene_graph::Joint joint("joint_0");
+  joint.type = tesseract_scene_graph::JointType::FIXED;
+  joint.parent_link_name = "link_0";
+  joint.child_link_name = "link_1";
+  sg->addJoint(joint);
+
+  auto getMeshFilenames = [](const std::string& filepath) {
+    std::vector<std::string> filenames;
+    tinyxml2::XMLDocument doc;
+    EXPECT_EQ(doc.LoadFile(filepath.c_str()), tinyxml2::XML_SUCCESS);
+    const tinyxml2::XMLElement* robot = doc.FirstChildElement("robot");
+    EXPECT_TRUE(robot != nullptr);
+    if (robot == nullptr)
+      return filenames;
+
+    for (const tinyxml2::XMLElement* link = robot->FirstChildElement("link"); link != nullptr;
+         link = link->NextSiblingElement("link"))
+      filenames.emplace_back(
+          link->FirstChildElement("visual")->FirstChildElement("geometry")->FirstChildElement("mesh")->Attribute(
+              "filename"));
+
+    return filenames;
+  };
+
+  auto countMeshFiles = [](const std::string& directory) {
+    return std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator());
+  };
+
+  {  // Each link writes its own mesh file
+    std::string package_path = tesseract_common::getTempPath() + "tesseract_urdf_write_pkg";
+    boost::filesystem::remove_all(package_path);
+    boost::filesystem::create_directories(package_path + "/visual");
+    EXPECT_NO_THROW(tesseract_urdf::writeURDFFile(sg, package_path, "", 2, false));  // NOLINT
+
+    std::vector<std::string> filenames = getMeshFilenames(package_path + "/urdf/dedup.urdf");
+    ASSERT_EQ(filenames.size(), 2);
+    EXPECT_NE(filenames[0], filenames[1]);
+    EXPECT_EQ(countMeshFiles(package_path + "/visual"), 2);
+  }
+
+  {  // The links share a single mesh file
+    std::string package_path = tesseract_common::getTempPath() + "tesseract_urdf_dedup_pkg";
+    boost::filesystem::remove_all(package_path);
+    boost::filesystem::create_directories(package_path + "/visual");
+    EXPECT_NO_THROW(tesseract_urdf::writeURDFFile(sg, package_path, "", 2, true));  // NOLINT
+
+    std::vector<std::string> filenames = getMeshFilenames(package_path + "/urdf/dedup.urdf");
+    ASSERT_EQ(filenames.size(), 2);
+    EXPECT_EQ(filenames[0], filenames[1]);
+    EXPECT_EQ(countMeshFiles(package_path + "/visual"), 1);
+  }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file async_visualization.h
+ * @brief A visualization wrapper plotting on a worker thread
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_VISUALIZATION_ASYNC_VISUALIZATION_H
+#define TESSERACT_VISUALIZATION_ASYNC_VISUALIZATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/visualization.h>
+
+namespace tesseract_visualization
+{
+/**
+ * @brief A visualization which queues the plot calls and runs them on a worker thread
+ * @details The calling thread only copies what the plot call needs, the wrapped visualization converts and publishes
+ * on the worker thread, so plotting from planner code does not add the latency of the visualization to a request.
+ * The environment is cloned and the state solver of a trajectory is cloned, both share most of their data with the
+ * original. Markers passed to plotMarkers are shared and must not be changed after they are plotted.
+ *
+ * The queue is bounded. Plotting the environment, a state or a trajectory replaces a pending plot of the same kind in
+ * the same namespace, since only the latest is visible anyway. If the queue is full the oldest pending call is
+ * dropped, and clearing a namespace drops its pending markers.
+ *
+ * The wrapped visualization is only used by the worker thread, except for isConnected and waitForInput.
+ */
+class AsyncVisualization : public Visualization
+{
+public:
+  using Ptr = std::shared_ptr<AsyncVisualization>;
+  using ConstPtr = std::shared_ptr<const AsyncVisualization>;
+
+  /**
+   * @brief Wrap a visualization
+   * @details Throws std::runtime_error if the visualization is nullptr or the queue size is zero
+   * @param visualization The visualization plotting on the worker thread
+   * @param queue_size The maximum number of pending plot calls
+   */
+  explicit AsyncVisualization(Visualization::Ptr visualization, std::size_t queue_size = 64);
+
+  /** @brief Runs the pending plot calls and stops the worker thread */
+  ~AsyncVisualization() override;
+  AsyncVisualization(const AsyncVisualization&) = delete;
+  AsyncVisualization& operator=(const AsyncVisualization&) = delete;
+  AsyncVisualization(AsyncVisualization&&) = delete;
+  AsyncVisualization& operator=(AsyncVisualization&&) = delete;
+
+  bool isConnected() const override;
+
+  /** @brief Does not block, the worker thread waits for the connection before running the following plot calls */
+  void waitForConnection(long seconds = 0) const override;
+
+  void plotEnvironment(const tesseract_environment::Environment& env, std::string ns = "") override;
+
+  void plotEnvironmentState(const tesseract_scene_graph::SceneState& state, std::string ns = "") override;
+
+  void plotTrajectory(const tesseract_common::JointTrajectory& traj,
+                      const tesseract_scene_graph::StateSolver& state_solver,
+                      std::string ns = "") override;
+
+  /** @brief The marker is copied, markers of user defined types are not supported and ignored */
+  void plotMarker(const Marker& marker, std::string ns = "") override;
+
+  void plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns = "") override;
+
+  void clear(std::string ns = "") override;
+
+  /** @brief Waits for the pending plot calls so the user sees them, then waits for input on the calling thread */
+  void waitForInput(std::string message = "Hit enter key to continue!") override;
+
+  /** @brief Wait until all pending plot calls are done */
+  void flush() const;
+
+  /** @brief The number of plot calls dropped because the queue was full */
+  std::size_t getDroppedCount() const;
+
+  /** @brief The number of pending plot calls */
+  std::size_t getPendingCount() const;
+
+  /** @brief Get the wrapped visualization */
+  const Visualization::Ptr& getVisualization() const;
+
+private:
+  /** @brief A pending plot call */
+  struct Request
+  {
+    /** @brief Pending requests with the same non empty key are replaced */
+    std::string key;
+
+    /** @brief The namespace of a marker request, empty for other requests */
+    std::string marker_ns;
+
+    /** @brief Indicates if the request plots markers */
+    bool marker{ false };
+
+    std::function<void(Visualization&)> function;
+  };
+
+  Visualization::Ptr visualization_;
+  std::size_t queue_size_;
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable cv_;
+  mutable std::condition_variable idle_cv_;
+  mutable std::deque<Request> queue_;
+  mutable bool busy_{ false };
+  bool stop_{ false };
+  mutable std::size_t dropped_{ 0 };
+
+  std::thread worker_;
+
+  /** @brief Add a request to the queue, replacing a pending request with the same key */
+  void enqueue(Request request) const;
+
+  /** @brief The loop of the worker thread */
+  void run();
+};
+}  // namespace tesseract_visualization
+
+#endif  // TESSERACT_VISUALIZATION_ASYNC_VISUALIZATION_H
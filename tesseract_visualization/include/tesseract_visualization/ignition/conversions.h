@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ignition/msgs/scene.pb.h>
+#include <ignition/msgs/link.pb.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/ignition/entity_manager.h>
@@ -43,6 +44,20 @@ bool toMsg(ignition::msgs::Scene& scene_msg,
            EntityManager& entity_manager,
            const tesseract_scene_graph::SceneGraph& scene_graph,
            const tesseract_common::TransformMap& link_transforms);
+
+/**
+ * @brief Convert a link and its visuals to a message
+ * @details Meshes are referenced by their resource file path, the mesh data is not part of the message.
+ * @param link_msg The link message to populate
+ * @param entity_manager The entity manager assigning the link and visual ids
+ * @param link The link
+ * @param link_transform The world transform of the link
+ * @return True if successful
+ */
+bool toMsg(ignition::msgs::Link& link_msg,
+           EntityManager& entity_manager,
+           const tesseract_scene_graph::Link& link,
+           const Eigen::Isometry3d& link_transform);
 }  // namespace tesseract_visualization
 
 #endif  // TESSERACT_VISUALIZATION_IGNITION_CONVERSIONS_H
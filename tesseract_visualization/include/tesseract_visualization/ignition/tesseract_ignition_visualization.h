@@ -31,10 +31,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ignition/msgs/scene.pb.h>
 #include <ignition/msgs/boolean.pb.h>
 #include <ignition/transport/Node.hh>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/visualization.h>
 #include <tesseract_visualization/ignition/entity_manager.h>
+#include <tesseract_visualization/markers/contact_results_marker.h>
+#include <tesseract_visualization/markers/toolpath_marker.h>
 #include <tesseract_environment/environment.h>
 
 namespace tesseract_visualization
@@ -68,15 +74,86 @@ public:
 
   void waitForInput(std::string message = "Hit enter key to continue!") override;
 
+  /**
+   * @brief Set how far a link has to move before its pose is published again
+   * @details Link poses are compared to the last pose published for the link, so small motions accumulate until they
+   * exceed a threshold and are never lost.
+   * @param translation The translation threshold in meters
+   * @param rotation The rotation threshold in radians
+   */
+  void setPoseUpdateThreshold(double translation, double rotation);
+
+  /**
+   * @brief Set the level of detail of toolpath markers
+   * @details Set the view point to the camera position for view dependent detail
+   * @param lod The level of detail
+   */
+  void setToolpathLevelOfDetail(const ToolpathLevelOfDetail& lod);
+
 private:
   ignition::transport::Node node_;                    /**< Ignition communication node. */
   ignition::transport::Node::Publisher scene_pub_;    /**< Scene publisher */
   ignition::transport::Node::Publisher pose_pub_;     /**< Pose publisher */
   ignition::transport::Node::Publisher deletion_pub_; /**< Deletion publisher */
+  ignition::transport::Node::Publisher marker_pub_;   /**< Marker publisher */
   EntityManager entity_manager_;
 
+  /** @brief The name of the scene graph that was plotted, empty if none */
+  std::string plotted_scene_name_;
+
+  /** @brief The revision of the environment that was plotted */
+  int plotted_revision_{ -1 };
+
+  /** @brief The hash of the message of each plotted link, without its pose, used to only resend changed links */
+  std::unordered_map<std::string, std::size_t> plotted_link_hashes_;
+
+  /** @brief The last pose published for each link */
+  tesseract_common::TransformMap published_poses_;
+
+  /** @brief The translation a link has to move before its pose is published again */
+  double translation_threshold_{ 1e-5 };
+
+  /** @brief The rotation a link has to move before its pose is published again */
+  double rotation_threshold_{ 1e-5 };
+
+  /**
+   * @brief Append a marker to a scene message
+   * @param scene_msg The scene message, the marker is added to the model of its type which is created if needed
+   * @param cnt The counter used to name the links and visuals of the markers in the scene message
+   * @param marker The marker
+   */
+  void addMarker(ignition::msgs::Scene& scene_msg, long& cnt, const Marker& marker);
+
+  /** @brief The latest contact results of each namespace, shared with the conversion tasks */
+  struct ContactMarkerState;
+  std::shared_ptr<ContactMarkerState> contact_marker_state_;
+
+  /**
+   * @brief Publish contact results as one message of line lists for the namespace
+   * @details The contacts are filtered and converted on the default executor, so large contact sets like those of
+   * octree checks do not block the caller. Each contact is a line, not a visual, and only the latest contact results of
+   * a namespace are published.
+   * @param markers The contact results markers, they must not be changed after this call
+   * @param ns The namespace
+   */
+  void plotContactResults(std::vector<std::shared_ptr<const ContactResultsMarker>> markers, const std::string& ns);
+
+  /** @brief The level of detail of toolpath markers */
+  ToolpathLevelOfDetail toolpath_lod_;
+
+  /** @brief The number of chunks published for the toolpath of each namespace */
+  std::unordered_map<std::string, std::size_t> toolpath_chunk_counts_;
+
+  /**
+   * @brief Publish a toolpath as decimated chunks, one marker message per chunk
+   * @param marker The toolpath marker
+   * @param ns The namespace
+   */
+  void plotToolpath(const ToolpathMarker& marker, const std::string& ns);
+
   /**
    * @brief Helper function for sending state to visualization tool
+   * @details Only the poses of links that moved more than the pose update threshold are sent
    * @param scene_state Environment state
    */
   void sendSceneState(const tesseract_scene_graph::SceneState& scene_state);
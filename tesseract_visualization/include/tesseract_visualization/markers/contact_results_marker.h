@@ -3,6 +3,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <limits>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -38,10 +39,31 @@ public:
 
   int getType() const override { return static_cast<int>(MarkerType::CONTACT_RESULTS); }
 
+  /**
+   * @brief Get the collision margin of the pair of links of a contact
+   * @param contact The contact
+   * @return The margin from margin_fn if provided, otherwise from margin_data
+   */
+  double getContactMargin(const tesseract_collision::ContactResult& contact) const;
+
+  /**
+   * @brief Get the indices of the contacts to render
+   * @details Contacts with a distance larger than distance_threshold are skipped. If max_contacts is not zero only the
+   * closest max_contacts contacts are kept, which is the level of detail for large contact sets like octree checks.
+   * @return The indices into dist_results, ordered by distance if max_contacts is not zero
+   */
+  std::vector<std::size_t> getRenderedContacts() const;
+
   std::vector<std::string> link_names;
   tesseract_collision::ContactResultVector dist_results;
   tesseract_collision::CollisionMarginData margin_data;
   std::function<double(const std::string&, const std::string&)> margin_fn;
+
+  /** @brief Contacts with a distance larger than this are not rendered */
+  double distance_threshold{ std::numeric_limits<double>::max() };
+
+  /** @brief The maximum number of contacts rendered, the closest contacts are kept. Zero renders all contacts */
+  std::size_t max_contacts{ 0 };
 };
 
 }  // namespace tesseract_visualization
@@ -3,6 +3,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <optional>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -11,7 +12,41 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_visualization
 {
-/** @brief An arrow defined by two points */
+/** @brief The level of detail used to render a toolpath */
+struct ToolpathLevelOfDetail
+{
+  /** @brief The maximum distance of a removed pose from the decimated path */
+  double tolerance{ 0.001 };
+
+  /** @brief The minimum distance along the path between two rendered frames */
+  double frame_spacing{ 0.05 };
+
+  /** @brief The maximum number of poses of the toolpath in one chunk */
+  std::size_t chunk_size{ 5000 };
+
+  /**
+   * @brief The position of the viewer, if set the tolerance and frame spacing of a chunk grow linearly with its
+   * distance from the viewer beyond reference_distance
+   */
+  std::optional<Eigen::Vector3d> view_point;
+
+  /** @brief The distance from the viewer up to which the tolerance and frame spacing are not scaled */
+  double reference_distance{ 1.0 };
+};
+
+/** @brief A decimated piece of a toolpath */
+struct ToolpathChunk
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /** @brief The positions of the line strip of the path */
+  std::vector<Eigen::Vector3d> points;
+
+  /** @brief The poses rendered as frames */
+  tesseract_common::VectorIsometry3d frames;
+};
+
+/** @brief A toolpath marker, the path of each segment is a line strip and the poses are frames */
 class ToolpathMarker : public Marker
 {
 public:
@@ -22,6 +57,17 @@ public:
 
   int getType() const override { return static_cast<int>(MarkerType::TOOLPATH); }
 
+  /**
+   * @brief Get a decimated representation of the toolpath split in chunks
+   * @details Each segment is split in chunks of at most chunk_size poses which share their end pose with the next
+   * chunk, so the line strips connect. The positions of a chunk are decimated with the Ramer-Douglas-Peucker algorithm
+   * and only poses at least frame_spacing apart along the path are kept as frames. This keeps very long toolpaths cheap
+   * to convert and send, and each chunk can be sent as its own message.
+   * @param lod The level of detail
+   * @return The chunks in the order of the toolpath
+   */
+  std::vector<ToolpathChunk> getChunks(const ToolpathLevelOfDetail& lod = ToolpathLevelOfDetail()) const;
+
   bool show_path{ true };
   bool show_axis{ true };
   tesseract_common::Toolpath toolpath;
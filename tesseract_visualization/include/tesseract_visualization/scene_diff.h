@@ -0,0 +1,74 @@
+/**
+ * @file scene_diff.h
+ * @brief Compute the changes of a scene that has to be sent to an incremental visualization
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_VISUALIZATION_SCENE_DIFF_H
+#define TESSERACT_VISUALIZATION_SCENE_DIFF_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_visualization
+{
+/** @brief The links a visualization has to send, delete or resend to show a new version of a scene */
+struct SceneDiff
+{
+  /** @brief The links which are new or changed and have to be sent */
+  std::vector<std::string> sent_links;
+
+  /** @brief The links which have to be deleted, the changed links which are resent and the removed links */
+  std::vector<std::string> deleted_links;
+};
+
+/**
+ * @brief Compute the links which have to be sent or deleted to update a plotted scene
+ * @param plotted_link_hashes The hash of the content of each plotted link
+ * @param link_hashes The hash of the content of each link of the new scene
+ * @return The links to delete and send, a link with an unchanged hash is neither
+ */
+SceneDiff computeSceneDiff(const std::unordered_map<std::string, std::size_t>& plotted_link_hashes,
+                           const std::unordered_map<std::string, std::size_t>& link_hashes);
+
+/**
+ * @brief Get the links whose pose moved more than a threshold from the pose last published for it
+ * @details The poses are compared to the last published pose, not the previous pose, so small motions accumulate
+ * until they exceed a threshold. Links which were never published are always returned.
+ * @param published_poses The last pose published for each link
+ * @param link_transforms The current pose of each link
+ * @param translation_threshold The translation threshold in meters
+ * @param rotation_threshold The rotation threshold in radians
+ * @return The names of the links whose pose has to be published
+ */
+std::vector<std::string> getMovedLinks(const tesseract_common::TransformMap& published_poses,
+                                       const tesseract_common::TransformMap& link_transforms,
+                                       double translation_threshold,
+                                       double rotation_threshold);
+}  // namespace tesseract_visualization
+
+#endif  // TESSERACT_VISUALIZATION_SCENE_DIFF_H
@@ -0,0 +1,136 @@
+/**
+ * @file gltf_scene.h
+ * @brief A scene exported to a glTF file
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_VISUALIZATION_SNAPSHOT_GLTF_SCENE_H
+#define TESSERACT_VISUALIZATION_SNAPSHOT_GLTF_SCENE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_geometry/geometry.h>
+#include <tesseract_scene_graph/graph.h>
+#include <tesseract_common/types.h>
+#include <tesseract_visualization/markers/marker.h>
+
+namespace tesseract_visualization
+{
+/**
+ * @brief A scene of geometries and lines which is written as a self contained glTF 2.0 file
+ * @details Adding to the scene only records the geometry pointers and poses, the geometries are tessellated and
+ * encoded when the scene is serialized, so a scene can be built cheaply on one thread and exported on another. Each
+ * geometry is tessellated and stored once per color no matter how many nodes use it, so exporting many states of the
+ * same scene, like the waypoints of a trajectory, only adds nodes.
+ */
+class GLTFScene
+{
+public:
+  /**
+   * @brief Start a group, the nodes added after it are its children until the next group is started
+   * @param name The name of the group
+   */
+  void beginGroup(const std::string& name);
+
+  /**
+   * @brief Add a geometry
+   * @details Octrees are not supported and skipped
+   * @param name The name of the node
+   * @param geometry The geometry, it must not be changed until the scene is serialized
+   * @param pose The world pose of the geometry
+   * @param color The rgba color
+   */
+  void addGeometry(const std::string& name,
+                   const tesseract_geometry::Geometry::ConstPtr& geometry,
+                   const Eigen::Isometry3d& pose,
+                   const Eigen::Vector4d& color);
+
+  /**
+   * @brief Add line segments
+   * @param name The name of the node
+   * @param points The world positions of the ends of the segments, two per segment
+   * @param color The rgba color
+   */
+  void addLines(const std::string& name, std::vector<Eigen::Vector3d> points, const Eigen::Vector4d& color);
+
+  /**
+   * @brief Add the nodes of another scene, its groups become groups of this scene
+   * @param other The other scene
+   */
+  void append(const GLTFScene& other);
+
+  /** @brief Check if the scene has no nodes */
+  bool empty() const;
+
+  /** @brief Serialize the scene as glTF 2.0 json with the buffer embedded as a base64 data uri */
+  std::string toString() const;
+
+  /**
+   * @brief Write the scene to a .gltf file
+   * @details Throws std::runtime_error if the file can not be written
+   * @param file_path The file path
+   */
+  void save(const std::string& file_path) const;
+
+private:
+  struct Node
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    std::string name;
+    int group{ -1 };
+    tesseract_geometry::Geometry::ConstPtr geometry;
+    Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+    std::vector<Eigen::Vector3d> lines;
+    Eigen::Vector4d color{ Eigen::Vector4d::Ones() };
+  };
+
+  std::vector<std::string> groups_;
+  tesseract_common::AlignedVector<Node> nodes_;
+};
+
+/**
+ * @brief Add the visuals of the links of a scene graph
+ * @param scene The scene
+ * @param scene_graph The scene graph
+ * @param link_transforms The world transforms of the links, links without a transform are skipped
+ */
+void addSceneGraph(GLTFScene& scene,
+                   const tesseract_scene_graph::SceneGraph& scene_graph,
+                   const tesseract_common::TransformMap& link_transforms);
+
+/**
+ * @brief Add a marker
+ * @details Geometry markers are added as geometries, arrow, axis, contact results and toolpath markers as lines
+ * @param scene The scene
+ * @param marker The marker
+ * @return False if the marker type is not supported
+ */
+bool addMarker(GLTFScene& scene, const Marker& marker);
+
+}  // namespace tesseract_visualization
+
+#endif  // TESSERACT_VISUALIZATION_SNAPSHOT_GLTF_SCENE_H
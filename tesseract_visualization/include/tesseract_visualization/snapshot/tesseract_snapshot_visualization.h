@@ -0,0 +1,139 @@
+/**
+ * @file tesseract_snapshot_visualization.h
+ * @brief A headless visualization writing snapshots of the scene to glTF files
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_VISUALIZATION_SNAPSHOT_TESSERACT_SNAPSHOT_VISUALIZATION_H
+#define TESSERACT_VISUALIZATION_SNAPSHOT_TESSERACT_SNAPSHOT_VISUALIZATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/visualization.h>
+#include <tesseract_visualization/snapshot/gltf_scene.h>
+#include <tesseract_common/executor.h>
+
+namespace tesseract_visualization
+{
+/**
+ * @brief A visualization without a GUI which writes each plot to a glTF file
+ * @details Every plot call writes one snapshot of the environment, its latest state and the markers of all namespaces.
+ * A trajectory is written as one file with a group of nodes per waypoint and a batch of markers as one file, the
+ * geometries are stored once per file. The calling thread only records the geometry pointers and poses, tessellating,
+ * encoding and writing the file run on the executor so the planner is not blocked.
+ *
+ * Files are named <ns>_<sequence>_<kind>.gltf, where ns is "snapshot" if empty and kind is environment, state,
+ * trajectory or markers. The default output directory is read from the TESSERACT_SNAPSHOT_DIRECTORY environment
+ * variable, otherwise it is tesseract_snapshots in the temporary directory. Marker parent links are ignored, markers
+ * are in world coordinates.
+ */
+class TesseractSnapshotVisualization : public tesseract_visualization::Visualization
+{
+public:
+  using Ptr = std::shared_ptr<TesseractSnapshotVisualization>;
+  using ConstPtr = std::shared_ptr<const TesseractSnapshotVisualization>;
+
+  TesseractSnapshotVisualization();
+
+  /**
+   * @brief Create a snapshot visualization
+   * @param output_directory The directory of the snapshots, it is created if it does not exist
+   * @param executor The executor writing the snapshots, nullptr uses the default executor
+   */
+  explicit TesseractSnapshotVisualization(std::string output_directory,
+                                          tesseract_common::Executor::Ptr executor = nullptr);
+
+  /** @brief Waits for the pending snapshots to be written */
+  ~TesseractSnapshotVisualization() override;
+  TesseractSnapshotVisualization(const TesseractSnapshotVisualization&) = delete;
+  TesseractSnapshotVisualization& operator=(const TesseractSnapshotVisualization&) = delete;
+  TesseractSnapshotVisualization(TesseractSnapshotVisualization&&) = delete;
+  TesseractSnapshotVisualization& operator=(TesseractSnapshotVisualization&&) = delete;
+
+  /** @brief Always true, there is nothing to connect to */
+  bool isConnected() const override;
+
+  void waitForConnection(long seconds = 0) const override;
+
+  void plotEnvironment(const tesseract_environment::Environment& env, std::string ns = "") override;
+
+  /** @brief Requires plotEnvironment to be called first for the geometry of the scene */
+  void plotEnvironmentState(const tesseract_scene_graph::SceneState& state, std::string ns = "") override;
+
+  /** @brief Requires plotEnvironment to be called first for the geometry of the scene */
+  void plotTrajectory(const tesseract_common::JointTrajectory& traj,
+                      const tesseract_scene_graph::StateSolver& state_solver,
+                      std::string ns = "") override;
+
+  void plotMarker(const Marker& marker, std::string ns = "") override;
+
+  void plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns = "") override;
+
+  /** @brief Remove the markers of a namespace, or of all namespaces if ns is empty */
+  void clear(std::string ns = "") override;
+
+  /** @brief Does not wait, there is no user in a headless session */
+  void waitForInput(std::string message = "Hit enter key to continue!") override;
+
+  /** @brief Get the directory the snapshots are written to */
+  const std::string& getOutputDirectory() const;
+
+  /** @brief Wait for the pending snapshots to be written */
+  void wait() const;
+
+  /** @brief The number of snapshots requested so far, it is the next sequence number */
+  std::size_t getSnapshotCount() const;
+
+private:
+  struct Pending;
+
+  std::string output_directory_;
+  tesseract_common::Executor::Ptr executor_;
+  std::shared_ptr<Pending> pending_;
+  std::atomic<std::size_t> sequence_{ 0 };
+
+  /** @brief The scene graph of the last plotted environment */
+  tesseract_scene_graph::SceneGraph::ConstPtr scene_graph_;
+
+  /** @brief The link transforms of the last plotted state */
+  tesseract_common::TransformMap link_transforms_;
+
+  /** @brief The markers of each namespace */
+  std::map<std::string, GLTFScene> markers_;
+
+  /** @brief Add the environment at its last plotted state and all markers */
+  void addScene(GLTFScene& scene, bool include_state) const;
+
+  /** @brief Write the scene to its file on the executor */
+  void write(GLTFScene scene, const std::string& ns, const std::string& kind);
+};
+
+TESSERACT_PLUGIN_ANCHOR_DECL(SnapshotVisualizationAnchor)
+
+}  // namespace tesseract_visualization
+
+#endif  // TESSERACT_VISUALIZATION_SNAPSHOT_TESSERACT_SNAPSHOT_VISUALIZATION_H
@@ -29,9 +29,12 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <chrono>
+#include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/trajectory_interpolator.h>
+#include <tesseract_state_solver/state_solver.h>
+#include <tesseract_common/executor.h>
 
 namespace tesseract_visualization
 {
@@ -116,6 +119,38 @@ public:
   /** @brief The size of the tajectory */
   long size() const;
 
+  /**
+   * @brief Precompute the link transforms of the trajectory at a fixed frame rate
+   * @details The frames are interpolated immediately and their forward kinematics is computed in batches by a single
+   * background task on the executor, so playback does not run the state solver and does not compete with other work
+   * for more than one thread. Frames are available through getNextFrame as soon as they are computed. Setting a new
+   * trajectory or precomputing again stops the background task.
+   * @param state_solver The state solver, it is cloned so it may be changed or destroyed after this call
+   * @param frame_rate The number of frames per second of trajectory duration
+   * @param executor The executor running the background task, nullptr uses the default executor
+   */
+  void precompute(const tesseract_scene_graph::StateSolver& state_solver,
+                  double frame_rate,
+                  const tesseract_common::Executor::Ptr& executor = nullptr);
+
+  /** @brief Check if the link transforms were precomputed by calling precompute */
+  bool isPrecomputed() const;
+
+  /** @brief The number of frames to precompute, zero if precompute was not called */
+  long getFrameCount() const;
+
+  /** @brief The number of frames which are already computed */
+  long getComputedFrameCount() const;
+
+  /**
+   * @brief Get the precomputed link transforms at the next time interval
+   * @details This advances the player like getNext. If the frame of the current duration is not computed yet the last
+   * computed frame is returned. Throws if precompute was not called.
+   * @return The link transforms of the frame, valid until the trajectory is changed or precomputed again. It is
+   * nullptr if no frame has been computed yet.
+   */
+  const tesseract_common::TransformMap* getNextFrame();
+
 private:
   TrajectoryInterpolator::UPtr trajectory_{ nullptr };
   double trajectory_duration_{ 0 };
@@ -125,6 +160,13 @@ private:
   bool finished_{ false };
 
   std::chrono::time_point<std::chrono::high_resolution_clock> start_time_;
+
+  /** @brief The precomputed frames, the background task stops once it is released */
+  struct Frames;
+  std::shared_ptr<Frames> frames_;
+
+  /** @brief Update the current duration from the clock, return true if the end of the trajectory was reached */
+  bool updateCurrentDuration();
 };
 
 }  // namespace tesseract_visualization
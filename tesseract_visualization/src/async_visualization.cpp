@@ -0,0 +1,260 @@
+/**
+ * @file async_visualization.cpp
+ * @brief A visualization wrapper plotting on a worker thread
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/async_visualization.h>
+#include <tesseract_visualization/markers/arrow_marker.h>
+#include <tesseract_visualization/markers/axis_marker.h>
+#include <tesseract_visualization/markers/contact_results_marker.h>
+#include <tesseract_visualization/markers/geometry_marker.h>
+#include <tesseract_visualization/markers/toolpath_marker.h>
+
+namespace tesseract_visualization
+{
+namespace
+{
+template <typename MarkerT>
+Marker::Ptr copyMarker(const Marker& marker)
+{
+  return std::make_shared<MarkerT>(static_cast<const MarkerT&>(marker));
+}
+
+/** @brief Copy a marker of a known type, nullptr for user defined types */
+Marker::Ptr copyMarker(const Marker& marker)
+{
+  switch (static_cast<MarkerType>(marker.getType()))
+  {
+    case MarkerType::ARROW:
+      return copyMarker<ArrowMarker>(marker);
+    case MarkerType::AXIS:
+      return copyMarker<AxisMarker>(marker);
+    case MarkerType::CONTACT_RESULTS:
+      return copyMarker<ContactResultsMarker>(marker);
+    case MarkerType::GEOMETRY:
+      return copyMarker<GeometryMarker>(marker);
+    case MarkerType::TOOLPATH:
+      return copyMarker<ToolpathMarker>(marker);
+    default:
+      return nullptr;
+  }
+}
+}  // namespace
+
+AsyncVisualization::AsyncVisualization(Visualization::Ptr visualization, std::size_t queue_size)
+  : visualization_(std::move(visualization)), queue_size_(queue_size)
+{
+  if (visualization_ == nullptr)
+    throw std::runtime_error("AsyncVisualization, the visualization is a nullptr!");
+
+  if (queue_size_ == 0)
+    throw std::runtime_error("AsyncVisualization, the queue size must be greater than zero!");
+
+  worker_ = std::thread(&AsyncVisualization::run, this);
+}
+
+AsyncVisualization::~AsyncVisualization()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  worker_.join();
+}
+
+bool AsyncVisualization::isConnected() const { return visualization_->isConnected(); }
+
+void AsyncVisualization::waitForConnection(long seconds) const
+{
+  Request request;
+  request.function = [seconds](Visualization& visualization) { visualization.waitForConnection(seconds); };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::plotEnvironment(const tesseract_environment::Environment& env, std::string ns)
+{
+  std::shared_ptr<const tesseract_environment::Environment> env_copy = env.clone();
+
+  Request request;
+  request.key = "environment/" + ns;
+  request.function = [env_copy, ns](Visualization& visualization) { visualization.plotEnvironment(*env_copy, ns); };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::plotEnvironmentState(const tesseract_scene_graph::SceneState& state, std::string ns)
+{
+  auto state_copy = std::make_shared<const tesseract_scene_graph::SceneState>(state);
+
+  Request request;
+  request.key = "state/" + ns;
+  request.function = [state_copy, ns](Visualization& visualization) {
+    visualization.plotEnvironmentState(*state_copy, ns);
+  };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::plotTrajectory(const tesseract_common::JointTrajectory& traj,
+                                        const tesseract_scene_graph::StateSolver& state_solver,
+                                        std::string ns)
+{
+  auto traj_copy = std::make_shared<const tesseract_common::JointTrajectory>(traj);
+  std::shared_ptr<const tesseract_scene_graph::StateSolver> state_solver_copy = state_solver.clone();
+
+  Request request;
+  request.key = "trajectory/" + ns;
+  request.function = [traj_copy, state_solver_copy, ns](Visualization& visualization) {
+    visualization.plotTrajectory(*traj_copy, *state_solver_copy, ns);
+  };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::plotMarker(const Marker& marker, std::string ns)
+{
+  Marker::ConstPtr marker_copy = copyMarker(marker);
+  if (marker_copy == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("AsyncVisualization, unsupported marker type: %i", marker.getType());
+    return;
+  }
+
+  Request request;
+  request.marker = true;
+  request.marker_ns = ns;
+  request.function = [marker_copy, ns](Visualization& visualization) { visualization.plotMarker(*marker_copy, ns); };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns)
+{
+  Request request;
+  request.marker = true;
+  request.marker_ns = ns;
+  request.function = [markers, ns](Visualization& visualization) { visualization.plotMarkers(markers, ns); };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::clear(std::string ns)
+{
+  {
+    // The pending markers of the namespace would be cleared anyway
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.erase(std::remove_if(queue_.begin(),
+                                queue_.end(),
+                                [&ns](const Request& request) {
+                                  return request.marker && (ns.empty() || request.marker_ns == ns);
+                                }),
+                 queue_.end());
+  }
+
+  Request request;
+  request.function = [ns](Visualization& visualization) { visualization.clear(ns); };
+  enqueue(std::move(request));
+}
+
+void AsyncVisualization::waitForInput(std::string message)
+{
+  flush();
+  visualization_->waitForInput(message);
+}
+
+void AsyncVisualization::flush() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_cv_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+}
+
+std::size_t AsyncVisualization::getDroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return dropped_;
+}
+
+std::size_t AsyncVisualization::getPendingCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size() + (busy_ ? 1 : 0);
+}
+
+const Visualization::Ptr& AsyncVisualization::getVisualization() const { return visualization_; }
+
+void AsyncVisualization::enqueue(Request request) const
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!request.key.empty())
+    {
+      // The replaced request moves to the back so it stays ordered after the requests queued before it
+      auto it = std::find_if(
+          queue_.begin(), queue_.end(), [&request](const Request& pending) { return pending.key == request.key; });
+      if (it != queue_.end())
+        queue_.erase(it);
+    }
+
+    if (queue_.size() >= queue_size_)
+    {
+      queue_.pop_front();
+      ++dropped_;
+    }
+
+    queue_.push_back(std::move(request));
+  }
+  cv_.notify_one();
+}
+
+void AsyncVisualization::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+    if (queue_.empty())
+      return;
+
+    Request request = std::move(queue_.front());
+    queue_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    try
+    {
+      request.function(*visualization_);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("AsyncVisualization, plot call failed: %s", e.what());
+    }
+
+    lock.lock();
+    busy_ = false;
+    if (queue_.empty())
+      idle_cv_.notify_all();
+  }
+}
+}  // namespace tesseract_visualization
@@ -29,18 +29,22 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ignition/msgs/MessageTypes.hh>
 #include <ignition/common/Console.hh>
 #include <ignition/math/eigen3/Conversions.hh>
+#include <ignition/msgs/marker_v.pb.h>
 #include <chrono>
+#include <mutex>
 #include <numeric>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/ignition/tesseract_ignition_visualization.h>
 #include <tesseract_visualization/ignition/conversions.h>
+#include <tesseract_visualization/scene_diff.h>
 #include <tesseract_visualization/trajectory_player.h>
 #include <tesseract_visualization/markers/arrow_marker.h>
 #include <tesseract_visualization/markers/axis_marker.h>
 #include <tesseract_visualization/markers/contact_results_marker.h>
 #include <tesseract_visualization/markers/toolpath_marker.h>
 #include <tesseract_common/class_loader.h>
+#include <tesseract_common/executor.h>
 
 /** @brief Message type is ignition::msgs::Scene */
 static const std::string DEFAULT_SCENE_TOPIC_NAME = "/tesseract_ignition/topic/scene";
@@ -51,18 +55,33 @@ static const std::string DEFAULT_POSE_TOPIC_NAME = "/tesseract_ignition/topic/po
 /** @brief Message type is ignition::msgs::UInt32_V */
 static const std::string DEFAULT_DELETION_TOPIC_NAME = "/tesseract_ignition/topic/deletion";
 
-static const std::string COLLISION_RESULTS_MODEL_NAME = "tesseract_collision_results_model";
+/** @brief Message type is ignition::msgs::Marker_V */
+static const std::string DEFAULT_MARKER_TOPIC_NAME = "/tesseract_ignition/topic/marker";
+
+/** @brief Appended to the namespace of toolpath markers so they do not clash with the contact results markers */
+static const std::string TOOLPATH_NAMESPACE_SUFFIX = "/tesseract_toolpath";
+
 static const std::string AXES_MODEL_NAME = "tesseract_axes_model";
 static const std::string ARROW_MODEL_NAME = "tesseract_arrow_model";
 static const std::string TOOL_PATH_MODEL_NAME = "tesseract_tool_path_model";
 
 namespace tesseract_visualization
 {
+struct TesseractIgnitionVisualization::ContactMarkerState
+{
+  std::mutex mutex;
+
+  /** @brief The sequence number of the latest contact results plotted in each namespace */
+  std::unordered_map<std::string, std::uint64_t> sequences;
+};
+
 TesseractIgnitionVisualization::TesseractIgnitionVisualization()
+  : contact_marker_state_(std::make_shared<ContactMarkerState>())
 {
   scene_pub_ = node_.Advertise<ignition::msgs::Scene>(DEFAULT_SCENE_TOPIC_NAME);
   pose_pub_ = node_.Advertise<ignition::msgs::Pose_V>(DEFAULT_POSE_TOPIC_NAME);
   deletion_pub_ = node_.Advertise<ignition::msgs::UInt32_V>(DEFAULT_DELETION_TOPIC_NAME);
+  marker_pub_ = node_.Advertise<ignition::msgs::Marker_V>(DEFAULT_MARKER_TOPIC_NAME);
 }
 
 bool TesseractIgnitionVisualization::isConnected() const
@@ -86,9 +105,75 @@ void TesseractIgnitionVisualization::waitForConnection(long seconds) const
 
 void TesseractIgnitionVisualization::plotEnvironment(const tesseract_environment::Environment& env, std::string /*ns*/)
 {
-  ignition::msgs::Scene msg;
-  toMsg(msg, entity_manager_, *(env.getSceneGraph()), env.getState().link_transforms);
-  scene_pub_.Publish(msg);
+  tesseract_scene_graph::SceneGraph::ConstPtr scene_graph = env.getSceneGraph();
+  tesseract_scene_graph::SceneState state = env.getState();
+
+  // The links were already sent, only the poses that changed need to be sent
+  if (scene_graph->getName() == plotted_scene_name_ && env.getRevision() == plotted_revision_)
+  {
+    sendSceneState(state);
+    return;
+  }
+
+  if (scene_graph->getName() != plotted_scene_name_)
+  {
+    plotted_link_hashes_.clear();
+    published_poses_.clear();
+  }
+
+  ignition::msgs::Scene scene_msg;
+  scene_msg.set_name("scene");
+  ignition::msgs::Model* model = scene_msg.add_model();
+  model->set_name(scene_graph->getName());
+  EntityID model_id = entity_manager_.getModel(scene_graph->getName());
+  if (model_id == NULL_ENTITY_ID || plotted_link_hashes_.empty())
+    model_id = entity_manager_.addModel(scene_graph->getName());
+  model->set_id(static_cast<unsigned>(model_id));
+
+  // Only links that are new or whose visuals changed are sent, meshes are referenced by file path and loaded and
+  // cached by the client so they are never part of the message
+  std::unordered_map<std::string, std::size_t> link_hashes;
+  link_hashes.reserve(scene_graph->getLinks().size());
+  for (const auto& link : scene_graph->getLinks())
+  {
+    // Use a scratch entity manager so the hash only depends on the content of the link
+    EntityManager scratch_entity_manager;
+    ignition::msgs::Link scratch_msg;
+    toMsg(scratch_msg, scratch_entity_manager, *link, Eigen::Isometry3d::Identity());
+    link_hashes[link->getName()] = std::hash<std::string>()(scratch_msg.SerializeAsString());
+  }
+
+  const SceneDiff diff = computeSceneDiff(plotted_link_hashes_, link_hashes);
+
+  ignition::msgs::UInt32_V deletion_msg;
+  for (const auto& link_name : diff.deleted_links)
+  {
+    EntityID id = entity_manager_.getLink(link_name);
+    if (id != NULL_ENTITY_ID)
+      deletion_msg.add_data(static_cast<unsigned>(id));
+
+    published_poses_.erase(link_name);
+  }
+
+  for (const auto& link_name : diff.sent_links)
+  {
+    const Eigen::Isometry3d& link_transform = state.link_transforms.at(link_name);
+    toMsg(*model->add_link(), entity_manager_, *scene_graph->getLink(link_name), link_transform);
+    published_poses_[link_name] = link_transform;
+  }
+
+  if (deletion_msg.data_size() > 0)
+    deletion_pub_.Publish(deletion_msg);
+
+  if (model->link_size() > 0)
+    scene_pub_.Publish(scene_msg);
+
+  plotted_scene_name_ = scene_graph->getName();
+  plotted_revision_ = env.getRevision();
+  plotted_link_hashes_ = std::move(link_hashes);
+
+  // Links that were not resent may have moved
+  sendSceneState(state);
 }
 
 void TesseractIgnitionVisualization::plotEnvironmentState(const tesseract_scene_graph::SceneState& state,
@@ -200,152 +285,273 @@ void addAxis(EntityManager& entity_manager, ignition::msgs::Link& link, long& su
   addCylinder(entity_manager, link, sub_index, position, position + (scale(2) * z_axis), axis_blue, scale * (1.0 / 20));
 }
 
-void TesseractIgnitionVisualization::plotMarker(const Marker& marker, std::string /*ns*/)
+/** @brief Get the model of a marker type in the scene message, it is added if it does not exist */
+ignition::msgs::Model* getMarkerModel(ignition::msgs::Scene& scene_msg,
+                                      EntityManager& entity_manager,
+                                      const std::string& model_name)
+{
+  for (auto& model : *scene_msg.mutable_model())
+  {
+    if (model.name() == model_name)
+      return &model;
+  }
+
+  ignition::msgs::Model* model = scene_msg.add_model();
+  model->set_name(model_name);
+  model->set_id(static_cast<unsigned>(entity_manager.addModel(model_name)));
+  return model;
+}
+
+void TesseractIgnitionVisualization::addMarker(ignition::msgs::Scene& scene_msg, long& cnt, const Marker& marker)
 {
   switch (marker.getType())
   {
     case static_cast<int>(MarkerType::ARROW):
     {
       const auto& m = dynamic_cast<const ArrowMarker&>(marker);
-      ignition::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      ignition::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = ARROW_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
-
-      long cnt = 0;
+      const std::string& model_name = ARROW_MODEL_NAME;
+      ignition::msgs::Model* model = getMarkerModel(scene_msg, entity_manager_, model_name);
+
       std::string link_name = model_name + std::to_string(++cnt);
       ignition::msgs::Link* link_msg = model->add_link();
       link_msg->set_id(static_cast<unsigned>(entity_manager_.addVisual(link_name)));
       link_msg->set_name(link_name);
       addArrow(entity_manager_, *link_msg, cnt, m);
-      scene_pub_.Publish(scene_msg);
       break;
     }
     case static_cast<int>(MarkerType::AXIS):
     {
       const auto& m = dynamic_cast<const AxisMarker&>(marker);
 
-      ignition::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      ignition::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = AXES_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
+      const std::string& model_name = AXES_MODEL_NAME;
+      ignition::msgs::Model* model = getMarkerModel(scene_msg, entity_manager_, model_name);
 
-      long cnt = 0;
       std::string link_name = model_name + std::to_string(++cnt);
       ignition::msgs::Link* link_msg = model->add_link();
       link_msg->set_id(static_cast<unsigned>(entity_manager_.addVisual(link_name)));
       link_msg->set_name(link_name);
       addAxis(entity_manager_, *link_msg, cnt, m.axis);
-      scene_pub_.Publish(scene_msg);
       break;
     }
-    case static_cast<int>(MarkerType::CONTACT_RESULTS):
+    default:
     {
-      const auto& m = dynamic_cast<const ContactResultsMarker&>(marker);
+      ignwarn << "plotMarkers: Unsupported marker type: " << std::to_string(marker.getType()) << std::endl;
+    }
+  }
+}
 
-      ignition::msgs::Scene scene_msg;
-      scene_msg.set_name("scene");
-      ignition::msgs::Model* model = scene_msg.add_model();
-      std::string model_name = COLLISION_RESULTS_MODEL_NAME;
-      model->set_name(model_name);
-      model->set_id(static_cast<unsigned>(entity_manager_.addModel(model_name)));
+/** @brief Add a line list or line strip marker, or delete the marker if there are no points */
+void addLines(ignition::msgs::Marker_V& msg,
+              const std::string& ns,
+              unsigned id,
+              ignition::msgs::Marker::Type type,
+              const Eigen::Vector4d& color,
+              const std::vector<Eigen::Vector3d>& points)
+{
+  ignition::msgs::Marker* marker = msg.add_marker();
+  marker->set_ns(ns);
+  marker->set_id(id);
+  if (points.empty())
+  {
+    marker->set_action(ignition::msgs::Marker::DELETE_MARKER);
+    return;
+  }
 
-      long cnt = 0;
-      for (size_t i = 0; i < m.dist_results.size(); ++i)
-      {
-        const tesseract_collision::ContactResult& dist = m.dist_results[i];
-        double safety_distance = m.margin_data.getPairCollisionMargin(dist.link_names[0], dist.link_names[1]);
+  marker->set_action(ignition::msgs::Marker::ADD_MODIFY);
+  marker->set_type(type);
+  ignition::msgs::Color color_msg =
+      ignition::msgs::Convert(ignition::math::Color(static_cast<float>(color(0)),
+                                                    static_cast<float>(color(1)),
+                                                    static_cast<float>(color(2)),
+                                                    static_cast<float>(color(3))));
+  marker->mutable_material()->mutable_ambient()->CopyFrom(color_msg);
+  marker->mutable_material()->mutable_diffuse()->CopyFrom(color_msg);
+  for (const auto& point : points)
+    ignition::msgs::Set(marker->add_point(), ignition::math::eigen3::convert(point));
+}
 
-        std::string link_name = model_name + std::to_string(++cnt);
-        ignition::msgs::Link* link_msg = model->add_link();
-        link_msg->set_id(static_cast<unsigned>(entity_manager_.addVisual(link_name)));
-        link_msg->set_name(link_name);
+/**
+ * @brief Convert contact results to line lists, one per color
+ * @details Contacts in collision are red, contacts within their margin are yellow and other contacts are green. The
+ * motion of continuous contacts is blue.
+ */
+ignition::msgs::Marker_V toContactResultsMsg(const std::vector<std::shared_ptr<const ContactResultsMarker>>& markers,
+                                             const std::string& ns)
+{
+  std::vector<Eigen::Vector3d> collision;
+  std::vector<Eigen::Vector3d> within_margin;
+  std::vector<Eigen::Vector3d> separated;
+  std::vector<Eigen::Vector3d> continuous;
+  for (const auto& marker : markers)
+  {
+    for (std::size_t i : marker->getRenderedContacts())
+    {
+      const tesseract_collision::ContactResult& dist = marker->dist_results[i];
+      std::vector<Eigen::Vector3d>* lines = &separated;
+      if (dist.distance < 0)
+        lines = &collision;
+      else if (dist.distance < marker->getContactMargin(dist))
+        lines = &within_margin;
 
-        auto base_material = std::make_shared<tesseract_scene_graph::Material>("base_material");
-        if (dist.distance < 0)
-        {
-          base_material->color << 1.0, 0.0, 0.0, 1.0;
-        }
-        else if (dist.distance < safety_distance)
-        {
-          base_material->color << 1.0, 1.0, 0.0, 1.0;
-        }
-        else
-        {
-          base_material->color << 0.0, 1.0, 0.0, 1.0;
-        }
+      lines->push_back(dist.nearest_points[0]);
+      lines->push_back(dist.nearest_points[1]);
 
-        if (dist.cc_type[0] == tesseract_collision::ContinuousCollisionType::CCType_Between)
+      for (std::size_t j = 0; j < 2; ++j)
+      {
+        if (dist.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Between)
         {
-          ArrowMarker am(dist.transform[0] * dist.nearest_points_local[0],
-                         dist.cc_transform[0] * dist.nearest_points_local[0]);
-          am.material = std::make_shared<tesseract_scene_graph::Material>("cc_material");
-          am.material->color << 0.0, 0.0, 1.0, 1.0;
-          addArrow(entity_manager_, *link_msg, cnt, am);
+          continuous.emplace_back(dist.transform[j] * dist.nearest_points_local[j]);
+          continuous.emplace_back(dist.cc_transform[j] * dist.nearest_points_local[j]);
         }
+      }
+    }
+  }
 
-        if (dist.cc_type[1] == tesseract_collision::ContinuousCollisionType::CCType_Between)
-        {
-          ArrowMarker am(dist.transform[1] * dist.nearest_points_local[1],
-                         dist.cc_transform[1] * dist.nearest_points_local[1]);
-          am.material = std::make_shared<tesseract_scene_graph::Material>("cc_material");
-          am.material->color << 0.0, 0.0, 0.5, 1.0;
-          addArrow(entity_manager_, *link_msg, cnt, am);
-        }
+  ignition::msgs::Marker_V msg;
+  addLines(msg, ns, 0, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(1, 0, 0, 1), collision);
+  addLines(msg, ns, 1, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(1, 1, 0, 1), within_margin);
+  addLines(msg, ns, 2, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(0, 1, 0, 1), separated);
+  addLines(msg, ns, 3, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(0, 0, 1, 1), continuous);
+  return msg;
+}
 
-        auto it0 = std::find(m.link_names.begin(), m.link_names.end(), dist.link_names[0]);
-        auto it1 = std::find(m.link_names.begin(), m.link_names.end(), dist.link_names[1]);
+void TesseractIgnitionVisualization::plotContactResults(
+    std::vector<std::shared_ptr<const ContactResultsMarker>> markers,
+    const std::string& ns)
+{
+  std::uint64_t sequence{ 0 };
+  {
+    std::lock_guard<std::mutex> lock(contact_marker_state_->mutex);
+    sequence = ++contact_marker_state_->sequences[ns];
+  }
 
-        if (it0 != m.link_names.end() && it1 != m.link_names.end())
-        {
-          ArrowMarker am1(dist.nearest_points[0], dist.nearest_points[1]);
-          am1.material = base_material;
-          addArrow(entity_manager_, *link_msg, cnt, am1);
+  // Large contact sets are converted on the executor, only the latest contact results of a namespace are published
+  std::shared_ptr<ContactMarkerState> state = contact_marker_state_;
+  ignition::transport::Node::Publisher publisher = marker_pub_;
+  tesseract_common::getDefaultExecutor()->submit([state, publisher, markers = std::move(markers), ns, sequence]() {
+    try
+    {
+      ignition::msgs::Marker_V msg = toContactResultsMsg(markers, ns);
 
-          ArrowMarker am2(dist.nearest_points[1], dist.nearest_points[0]);
-          am2.material = base_material;
-          addArrow(entity_manager_, *link_msg, cnt, am2);
-        }
-        else if (it0 != m.link_names.end())
-        {
-          ArrowMarker am(dist.nearest_points[1], dist.nearest_points[0]);
-          am.material = base_material;
-          addArrow(entity_manager_, *link_msg, cnt, am);
-        }
-        else
-        {
-          ArrowMarker am(dist.nearest_points[0], dist.nearest_points[1]);
-          am.material = base_material;
-          addArrow(entity_manager_, *link_msg, cnt, am);
-        }
-      }
-      scene_pub_.Publish(scene_msg);
-      break;
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (state->sequences[ns] != sequence)
+        return;
+
+      if (!publisher.Publish(msg))
+        ignerr << "Failed to publish contact results marker!" << std::endl;
     }
-    default:
+    catch (const std::exception& e)
     {
-      ignwarn << "plotMarkers: Unsupported marker type: " << std::to_string(marker.getType()) << std::endl;
+      ignerr << "Failed to convert contact results marker: " << e.what() << std::endl;
+    }
+  });
+}
+
+void TesseractIgnitionVisualization::setToolpathLevelOfDetail(const ToolpathLevelOfDetail& lod) { toolpath_lod_ = lod; }
+
+void TesseractIgnitionVisualization::plotToolpath(const ToolpathMarker& marker, const std::string& ns)
+{
+  const std::string toolpath_ns = ns + TOOLPATH_NAMESPACE_SUFFIX;
+  const std::vector<ToolpathChunk> chunks = marker.getChunks(toolpath_lod_);
+
+  // Each chunk is its own message with a line strip of the path and a line list per axis of its frames
+  std::vector<Eigen::Vector3d> x_axes;
+  std::vector<Eigen::Vector3d> y_axes;
+  std::vector<Eigen::Vector3d> z_axes;
+  for (std::size_t i = 0; i < chunks.size(); ++i)
+  {
+    const ToolpathChunk& chunk = chunks[i];
+    x_axes.clear();
+    y_axes.clear();
+    z_axes.clear();
+    for (const auto& frame : chunk.frames)
+    {
+      x_axes.push_back(frame.translation());
+      x_axes.emplace_back(frame * Eigen::Vector3d(marker.scale.x(), 0, 0));
+      y_axes.push_back(frame.translation());
+      y_axes.emplace_back(frame * Eigen::Vector3d(0, marker.scale.y(), 0));
+      z_axes.push_back(frame.translation());
+      z_axes.emplace_back(frame * Eigen::Vector3d(0, 0, marker.scale.z()));
     }
+
+    const auto id = static_cast<unsigned>(4 * i);
+    ignition::msgs::Marker_V msg;
+    addLines(msg, toolpath_ns, id, ignition::msgs::Marker::LINE_STRIP, Eigen::Vector4d(1, 1, 1, 1), chunk.points);
+    addLines(msg, toolpath_ns, id + 1, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(1, 0, 0, 1), x_axes);
+    addLines(msg, toolpath_ns, id + 2, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(0, 1, 0, 1), y_axes);
+    addLines(msg, toolpath_ns, id + 3, ignition::msgs::Marker::LINE_LIST, Eigen::Vector4d(0, 0, 1, 1), z_axes);
+    if (!marker_pub_.Publish(msg))
+      ignerr << "Failed to publish toolpath marker!" << std::endl;
   }
+
+  // Remove the chunks of the previous toolpath of the namespace which are not replaced
+  std::size_t& chunk_count = toolpath_chunk_counts_[toolpath_ns];
+  if (chunk_count > chunks.size())
+  {
+    ignition::msgs::Marker_V msg;
+    for (auto id = static_cast<unsigned>(4 * chunks.size()); id < 4 * chunk_count; ++id)
+    {
+      ignition::msgs::Marker* m = msg.add_marker();
+      m->set_ns(toolpath_ns);
+      m->set_id(id);
+      m->set_action(ignition::msgs::Marker::DELETE_MARKER);
+    }
+    marker_pub_.Publish(msg);
+  }
+  chunk_count = chunks.size();
 }
 
-void TesseractIgnitionVisualization::plotMarkers(const std::vector<Marker::Ptr>& /*markers*/, std::string /*ns*/)
+void TesseractIgnitionVisualization::plotMarker(const Marker& marker, std::string ns)
 {
-  ignerr << "plotMarkers is currently not implemented!" << std::endl;
+  if (marker.getType() == static_cast<int>(MarkerType::CONTACT_RESULTS))
+  {
+    const auto& m = dynamic_cast<const ContactResultsMarker&>(marker);
+    plotContactResults({ std::make_shared<const ContactResultsMarker>(m) }, ns);
+    return;
+  }
+
+  if (marker.getType() == static_cast<int>(MarkerType::TOOLPATH))
+  {
+    plotToolpath(dynamic_cast<const ToolpathMarker&>(marker), ns);
+    return;
+  }
+
+  ignition::msgs::Scene scene_msg;
+  scene_msg.set_name("scene");
+  long cnt = 0;
+  addMarker(scene_msg, cnt, marker);
+  if (scene_msg.model_size() > 0)
+    scene_pub_.Publish(scene_msg);
 }
 
-void TesseractIgnitionVisualization::clear(std::string /*ns*/)
+void TesseractIgnitionVisualization::plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns)
 {
-  ignition::msgs::UInt32_V deletion_msg;
-  long id = entity_manager_.getModel(COLLISION_RESULTS_MODEL_NAME);
-  if (id >= 1000)
-    deletion_msg.add_data(static_cast<unsigned>(id));
+  // All markers are sent in a single scene message and all contact results in a single marker message
+  ignition::msgs::Scene scene_msg;
+  scene_msg.set_name("scene");
+  std::vector<std::shared_ptr<const ContactResultsMarker>> contact_markers;
+  long cnt = 0;
+  for (const auto& marker : markers)
+  {
+    if (marker->getType() == static_cast<int>(MarkerType::CONTACT_RESULTS))
+      contact_markers.push_back(std::dynamic_pointer_cast<const ContactResultsMarker>(marker));
+    else if (marker->getType() == static_cast<int>(MarkerType::TOOLPATH))
+      plotToolpath(dynamic_cast<const ToolpathMarker&>(*marker), ns);
+    else
+      addMarker(scene_msg, cnt, *marker);
+  }
+
+  if (scene_msg.model_size() > 0)
+    scene_pub_.Publish(scene_msg);
 
-  id = entity_manager_.getModel(ARROW_MODEL_NAME);
+  if (!contact_markers.empty())
+    plotContactResults(std::move(contact_markers), ns);
+}
+
+void TesseractIgnitionVisualization::clear(std::string ns)
+{
+  ignition::msgs::UInt32_V deletion_msg;
+  long id = entity_manager_.getModel(ARROW_MODEL_NAME);
   if (id >= 1000)
     deletion_msg.add_data(static_cast<unsigned>(id));
 
@@ -354,6 +560,34 @@ void TesseractIgnitionVisualization::clear(std::string /*ns*/)
     deletion_msg.add_data(static_cast<unsigned>(id));
 
   deletion_pub_.Publish(deletion_msg);
+
+  // Remove the contact results, pending conversions are dropped
+  ignition::msgs::Marker_V marker_msg;
+  std::lock_guard<std::mutex> lock(contact_marker_state_->mutex);
+  for (auto& sequence : contact_marker_state_->sequences)
+  {
+    if (!ns.empty() && sequence.first != ns)
+      continue;
+
+    ++sequence.second;
+    ignition::msgs::Marker* marker = marker_msg.add_marker();
+    marker->set_ns(sequence.first);
+    marker->set_action(ignition::msgs::Marker::DELETE_ALL);
+  }
+
+  for (auto& chunk_count : toolpath_chunk_counts_)
+  {
+    if (!ns.empty() && chunk_count.first != ns + TOOLPATH_NAMESPACE_SUFFIX)
+      continue;
+
+    chunk_count.second = 0;
+    ignition::msgs::Marker* marker = marker_msg.add_marker();
+    marker->set_ns(chunk_count.first);
+    marker->set_action(ignition::msgs::Marker::DELETE_ALL);
+  }
+
+  if (marker_msg.marker_size() > 0)
+    marker_pub_.Publish(marker_msg);
 }
 
 void TesseractIgnitionVisualization::waitForInput(std::string message)
@@ -362,21 +596,36 @@ void TesseractIgnitionVisualization::waitForInput(std::string message)
   std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
 
+void TesseractIgnitionVisualization::setPoseUpdateThreshold(double translation, double rotation)
+{
+  translation_threshold_ = translation;
+  rotation_threshold_ = rotation;
+}
+
 void TesseractIgnitionVisualization::sendSceneState(const tesseract_scene_graph::SceneState& scene_state)
 {
+  const std::vector<std::string> moved =
+      getMovedLinks(published_poses_, scene_state.link_transforms, translation_threshold_, rotation_threshold_);
+  if (moved.empty())
+    return;
+
   ignition::msgs::Pose_V pose_v;
-  for (const auto& pair : scene_state.link_transforms)
+  for (const auto& link_name : moved)
   {
     ignition::msgs::Pose* pose = pose_v.add_pose();
-    pose->CopyFrom(ignition::msgs::Convert(ignition::math::eigen3::convert(pair.second)));
-    pose->set_name(pair.first);
-    pose->set_id(static_cast<unsigned>(entity_manager_.getLink(pair.first)));
+    pose->CopyFrom(ignition::msgs::Convert(ignition::math::eigen3::convert(scene_state.link_transforms.at(link_name))));
+    pose->set_name(link_name);
+    pose->set_id(static_cast<unsigned>(entity_manager_.getLink(link_name)));
   }
 
   if (!pose_pub_.Publish(pose_v))
   {
     ignerr << "Failed to publish pose vector!" << std::endl;
+    return;
   }
+
+  for (const auto& link_name : moved)
+    published_poses_[link_name] = scene_state.link_transforms.at(link_name);
 }
 
 // void TesseractIgnitionVisualization::plotTrajectory(const tesseract_planning::Instruction& instruction)
@@ -0,0 +1,42 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/markers/contact_results_marker.h>
+
+namespace tesseract_visualization
+{
+double ContactResultsMarker::getContactMargin(const tesseract_collision::ContactResult& contact) const
+{
+  if (margin_fn)
+    return margin_fn(contact.link_names[0], contact.link_names[1]);
+
+  return margin_data.getPairCollisionMargin(contact.link_names[0], contact.link_names[1]);
+}
+
+std::vector<std::size_t> ContactResultsMarker::getRenderedContacts() const
+{
+  std::vector<std::size_t> indices;
+  indices.reserve(dist_results.size());
+  for (std::size_t i = 0; i < dist_results.size(); ++i)
+  {
+    if (dist_results[i].distance <= distance_threshold)
+      indices.push_back(i);
+  }
+
+  if (max_contacts == 0)
+    return indices;
+
+  auto closer = [this](std::size_t a, std::size_t b) { return dist_results[a].distance < dist_results[b].distance; };
+  if (indices.size() > max_contacts)
+  {
+    auto last = indices.begin() + static_cast<long>(max_contacts);
+    std::nth_element(indices.begin(), last, indices.end(), closer);
+    indices.erase(last, indices.end());
+  }
+  std::sort(indices.begin(), indices.end(), closer);
+  return indices;
+}
+
+}  // namespace tesseract_visualization
@@ -0,0 +1,124 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <limits>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/markers/toolpath_marker.h>
+
+namespace tesseract_visualization
+{
+namespace
+{
+/** @brief The distance of a point from the line segment between a and b */
+double distanceToSegment(const Eigen::Vector3d& point, const Eigen::Vector3d& a, const Eigen::Vector3d& b)
+{
+  const Eigen::Vector3d ab = b - a;
+  const double length_squared = ab.squaredNorm();
+  if (length_squared <= 0)
+    return (point - a).norm();
+
+  const double t = std::clamp((point - a).dot(ab) / length_squared, 0.0, 1.0);
+  return (point - (a + t * ab)).norm();
+}
+
+/** @brief Append the positions of the poses [first, last] kept by the Ramer-Douglas-Peucker algorithm */
+void decimate(const tesseract_common::VectorIsometry3d& poses,
+              std::size_t first,
+              std::size_t last,
+              double tolerance,
+              std::vector<Eigen::Vector3d>& points)
+{
+  std::vector<bool> keep(last - first + 1, false);
+  keep.front() = true;
+  keep.back() = true;
+
+  std::vector<std::pair<std::size_t, std::size_t>> ranges{ { first, last } };
+  while (!ranges.empty())
+  {
+    const auto [begin, end] = ranges.back();
+    ranges.pop_back();
+
+    double max_distance = 0;
+    std::size_t index = begin;
+    for (std::size_t i = begin + 1; i < end; ++i)
+    {
+      const double distance =
+          distanceToSegment(poses[i].translation(), poses[begin].translation(), poses[end].translation());
+      if (distance > max_distance)
+      {
+        max_distance = distance;
+        index = i;
+      }
+    }
+
+    if (max_distance > tolerance)
+    {
+      keep[index - first] = true;
+      ranges.emplace_back(begin, index);
+      ranges.emplace_back(index, end);
+    }
+  }
+
+  for (std::size_t i = first; i <= last; ++i)
+  {
+    if (keep[i - first])
+      points.emplace_back(poses[i].translation());
+  }
+}
+}  // namespace
+
+std::vector<ToolpathChunk> ToolpathMarker::getChunks(const ToolpathLevelOfDetail& lod) const
+{
+  const std::size_t chunk_size = std::max<std::size_t>(lod.chunk_size, 2);
+
+  std::vector<ToolpathChunk> chunks;
+  for (const auto& segment : toolpath)
+  {
+    if (segment.empty())
+      continue;
+
+    // The distance along the path since the last frame, the first pose of a segment is always a frame
+    double travelled = std::numeric_limits<double>::max();
+    for (std::size_t first = 0;; first += chunk_size - 1)
+    {
+      const std::size_t last = std::min(first + chunk_size - 1, segment.size() - 1);
+
+      double scale = 1;
+      if (lod.view_point.has_value() && lod.reference_distance > 0)
+      {
+        const Eigen::Vector3d center = segment[first + ((last - first) / 2)].translation();
+        scale = std::max(1.0, (center - *lod.view_point).norm() / lod.reference_distance);
+      }
+
+      ToolpathChunk chunk;
+      if (show_path)
+        decimate(segment, first, last, lod.tolerance * scale, chunk.points);
+
+      if (show_axis)
+      {
+        // The first pose of a chunk is the last pose of the previous chunk
+        for (std::size_t i = (first == 0) ? 0 : first + 1; i <= last; ++i)
+        {
+          if (i > 0)
+            travelled += (segment[i].translation() - segment[i - 1].translation()).norm();
+
+          if (travelled >= lod.frame_spacing * scale)
+          {
+            chunk.frames.push_back(segment[i]);
+            travelled = 0;
+          }
+        }
+      }
+
+      chunks.push_back(std::move(chunk));
+      if (last == segment.size() - 1)
+        break;
+    }
+  }
+
+  return chunks;
+}
+
+}  // namespace tesseract_visualization
@@ -0,0 +1,79 @@
+/**
+ * @file scene_diff.cpp
+ * @brief Compute the changes of a scene that has to be sent to an incremental visualization
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_visualization/scene_diff.h>
+
+namespace tesseract_visualization
+{
+SceneDiff computeSceneDiff(const std::unordered_map<std::string, std::size_t>& plotted_link_hashes,
+                           const std::unordered_map<std::string, std::size_t>& link_hashes)
+{
+  SceneDiff diff;
+  for (const auto& link_hash : link_hashes)
+  {
+    auto it = plotted_link_hashes.find(link_hash.first);
+    if (it != plotted_link_hashes.end())
+    {
+      if (it->second == link_hash.second)
+        continue;
+
+      diff.deleted_links.push_back(link_hash.first);
+    }
+
+    diff.sent_links.push_back(link_hash.first);
+  }
+
+  for (const auto& plotted_link_hash : plotted_link_hashes)
+  {
+    if (link_hashes.find(plotted_link_hash.first) == link_hashes.end())
+      diff.deleted_links.push_back(plotted_link_hash.first);
+  }
+
+  return diff;
+}
+
+std::vector<std::string> getMovedLinks(const tesseract_common::TransformMap& published_poses,
+                                       const tesseract_common::TransformMap& link_transforms,
+                                       double translation_threshold,
+                                       double rotation_threshold)
+{
+  std::vector<std::string> moved;
+  for (const auto& pair : link_transforms)
+  {
+    auto it = published_poses.find(pair.first);
+    if (it != published_poses.end())
+    {
+      const double translation = (pair.second.translation() - it->second.translation()).norm();
+      const double rotation = Eigen::AngleAxisd(it->second.linear().transpose() * pair.second.linear()).angle();
+      if (translation <= translation_threshold && rotation <= rotation_threshold)
+        continue;
+    }
+
+    moved.push_back(pair.first);
+  }
+
+  return moved;
+}
+}  // namespace tesseract_visualization
@@ -0,0 +1,719 @@
+/**
+ * @file gltf_scene.cpp
+ * @brief A scene exported to a glTF file
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/snapshot/gltf_scene.h>
+#include <tesseract_visualization/markers/arrow_marker.h>
+#include <tesseract_visualization/markers/axis_marker.h>
+#include <tesseract_visualization/markers/contact_results_marker.h>
+#include <tesseract_visualization/markers/geometry_marker.h>
+#include <tesseract_visualization/markers/toolpath_marker.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_visualization
+{
+namespace
+{
+/** @brief The number of segments around the axis of tessellated round shapes */
+const int ROUND_SECTORS = 32;
+
+/** @brief The number of segments from pole to pole of tessellated spheres and capsules, must be even */
+const int ROUND_RINGS = 16;
+
+/** @brief The glTF buffer view target of vertex attributes */
+const int ARRAY_BUFFER = 34962;
+
+/** @brief The glTF buffer view target of indices */
+const int ELEMENT_ARRAY_BUFFER = 34963;
+
+struct TriangleMesh
+{
+  std::vector<float> vertices;
+  std::vector<uint32_t> indices;
+
+  uint32_t addVertex(const Eigen::Vector3d& v)
+  {
+    vertices.push_back(static_cast<float>(v.x()));
+    vertices.push_back(static_cast<float>(v.y()));
+    vertices.push_back(static_cast<float>(v.z()));
+    return static_cast<uint32_t>((vertices.size() / 3) - 1);
+  }
+
+  void addTriangle(uint32_t a, uint32_t b, uint32_t c)
+  {
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+  }
+};
+
+/** @brief Add rings of vertices stacked along z connected by triangles, each ring is a (z, radius) pair */
+void addRings(TriangleMesh& mesh, const std::vector<std::pair<double, double>>& rings)
+{
+  const auto first = static_cast<uint32_t>(mesh.vertices.size() / 3);
+  for (const auto& ring : rings)
+  {
+    for (int s = 0; s < ROUND_SECTORS; ++s)
+    {
+      const double phi = 2 * M_PI * s / ROUND_SECTORS;
+      mesh.addVertex(Eigen::Vector3d(ring.second * std::cos(phi), ring.second * std::sin(phi), ring.first));
+    }
+  }
+
+  const auto sectors = static_cast<uint32_t>(ROUND_SECTORS);
+  for (uint32_t k = 0; k + 1 < rings.size(); ++k)
+  {
+    for (uint32_t s = 0; s < sectors; ++s)
+    {
+      const uint32_t a = first + (k * sectors) + s;
+      const uint32_t b = first + (k * sectors) + ((s + 1) % sectors);
+      const uint32_t c = a + sectors;
+      const uint32_t d = b + sectors;
+      mesh.addTriangle(a, c, b);
+      mesh.addTriangle(b, c, d);
+    }
+  }
+}
+
+/** @brief Close a ring at height z with a fan, facing +z if up is true */
+void addCap(TriangleMesh& mesh, double z, double radius, bool up)
+{
+  const uint32_t center = mesh.addVertex(Eigen::Vector3d(0, 0, z));
+  for (int s = 0; s < ROUND_SECTORS; ++s)
+  {
+    const double phi = 2 * M_PI * s / ROUND_SECTORS;
+    mesh.addVertex(Eigen::Vector3d(radius * std::cos(phi), radius * std::sin(phi), z));
+  }
+
+  const auto sectors = static_cast<uint32_t>(ROUND_SECTORS);
+  for (uint32_t s = 0; s < sectors; ++s)
+  {
+    const uint32_t a = center + 1 + s;
+    const uint32_t b = center + 1 + ((s + 1) % sectors);
+    if (up)
+      mesh.addTriangle(center, a, b);
+    else
+      mesh.addTriangle(center, b, a);
+  }
+}
+
+/** @brief A sphere split at its equator with the halves moved apart by length, a capsule if length is not zero */
+void addCapsule(TriangleMesh& mesh, double radius, double length)
+{
+  std::vector<std::pair<double, double>> rings;
+  for (int i = 0; i <= ROUND_RINGS; ++i)
+  {
+    const double theta = M_PI * i / ROUND_RINGS;
+    const double z = radius * std::cos(theta);
+    const double r = radius * std::sin(theta);
+    if (i <= ROUND_RINGS / 2)
+      rings.emplace_back(z + (length / 2), r);
+    if (i >= ROUND_RINGS / 2)
+      rings.emplace_back(z - (length / 2), r);
+  }
+  addRings(mesh, rings);
+}
+
+void addBox(TriangleMesh& mesh, const Eigen::Vector3d& size)
+{
+  const Eigen::Vector3d half = size / 2;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    for (double sign : { 1.0, -1.0 })
+    {
+      Eigen::Vector3d n = Eigen::Vector3d::Zero();
+      Eigen::Vector3d u = Eigen::Vector3d::Zero();
+      Eigen::Vector3d v = Eigen::Vector3d::Zero();
+      n(axis) = sign * half(axis);
+      u((axis + 1) % 3) = half((axis + 1) % 3);
+      v((axis + 2) % 3) = half((axis + 2) % 3);
+      if (sign < 0)
+        std::swap(u, v);
+
+      const uint32_t a = mesh.addVertex(n - u - v);
+      const uint32_t b = mesh.addVertex(n + u - v);
+      const uint32_t c = mesh.addVertex(n + u + v);
+      const uint32_t d = mesh.addVertex(n - u + v);
+      mesh.addTriangle(a, b, c);
+      mesh.addTriangle(a, c, d);
+    }
+  }
+}
+
+/** @brief Tessellate a geometry, return false if it is not supported */
+bool tessellate(const tesseract_geometry::Geometry& geometry, TriangleMesh& mesh)
+{
+  switch (geometry.getType())
+  {
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(geometry);
+      addBox(mesh, Eigen::Vector3d(box.getX(), box.getY(), box.getZ()));
+      return true;
+    }
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      addCapsule(mesh, static_cast<const tesseract_geometry::Sphere&>(geometry).getRadius(), 0);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(geometry);
+      addCapsule(mesh, capsule.getRadius(), capsule.getLength());
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(geometry);
+      const double half_length = cylinder.getLength() / 2;
+      addRings(mesh, { { half_length, cylinder.getRadius() }, { -half_length, cylinder.getRadius() } });
+      addCap(mesh, half_length, cylinder.getRadius(), true);
+      addCap(mesh, -half_length, cylinder.getRadius(), false);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::CONE:
+    {
+      // The apex is at +length / 2
+      const auto& cone = static_cast<const tesseract_geometry::Cone&>(geometry);
+      const double half_length = cone.getLength() / 2;
+      addRings(mesh, { { half_length, 0 }, { -half_length, cone.getRadius() } });
+      addCap(mesh, -half_length, cone.getRadius(), false);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::PLANE:
+    {
+      // A two meter square of the plane around the point of the plane closest to the origin
+      const auto& plane = static_cast<const tesseract_geometry::Plane&>(geometry);
+      const Eigen::Vector3d normal(plane.getA(), plane.getB(), plane.getC());
+      if (normal.squaredNorm() <= 0)
+        return false;
+
+      const Eigen::Vector3d center = -plane.getD() * normal / normal.squaredNorm();
+      const Eigen::Vector3d u = normal.unitOrthogonal();
+      const Eigen::Vector3d v = normal.normalized().cross(u);
+      const uint32_t a = mesh.addVertex(center - u - v);
+      const uint32_t b = mesh.addVertex(center + u - v);
+      const uint32_t c = mesh.addVertex(center + u + v);
+      const uint32_t d = mesh.addVertex(center - u + v);
+      mesh.addTriangle(a, b, c);
+      mesh.addTriangle(a, c, d);
+      return true;
+    }
+    case tesseract_geometry::GeometryType::MESH:
+    case tesseract_geometry::GeometryType::CONVEX_MESH:
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    case tesseract_geometry::GeometryType::POLYGON_MESH:
+    {
+      const auto& polygon_mesh = static_cast<const tesseract_geometry::PolygonMesh&>(geometry);
+      for (const auto& vertex : *polygon_mesh.getVertices())
+        mesh.addVertex(vertex);
+
+      // Faces are the vertex count followed by the vertex indices, they are triangulated as fans
+      const Eigen::VectorXi& faces = *polygon_mesh.getFaces();
+      for (Eigen::Index i = 0; i < faces.size();)
+      {
+        const int count = faces(i);
+        for (int j = 2; j < count; ++j)
+          mesh.addTriangle(static_cast<uint32_t>(faces(i + 1)),
+                           static_cast<uint32_t>(faces(i + j)),
+                           static_cast<uint32_t>(faces(i + j + 1)));
+        i += count + 1;
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+std::string escapeJson(const std::string& value)
+{
+  std::ostringstream os;
+  for (char c : value)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+    else
+      os << c;
+  }
+  return os.str();
+}
+
+std::string encodeBase64(const std::string& data)
+{
+  static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  encoded.reserve(((data.size() + 2) / 3) * 4);
+  for (std::size_t i = 0; i < data.size(); i += 3)
+  {
+    uint32_t chunk = static_cast<uint32_t>(static_cast<unsigned char>(data[i])) << 16U;
+    if (i + 1 < data.size())
+      chunk |= static_cast<uint32_t>(static_cast<unsigned char>(data[i + 1])) << 8U;
+    if (i + 2 < data.size())
+      chunk |= static_cast<uint32_t>(static_cast<unsigned char>(data[i + 2]));
+
+    encoded.push_back(table[(chunk >> 18U) & 0x3FU]);
+    encoded.push_back(table[(chunk >> 12U) & 0x3FU]);
+    encoded.push_back((i + 1 < data.size()) ? table[(chunk >> 6U) & 0x3FU] : '=');
+    encoded.push_back((i + 2 < data.size()) ? table[chunk & 0x3FU] : '=');
+  }
+  return encoded;
+}
+
+/** @brief Builds the arrays of the glTF json and the binary buffer */
+class GLTFWriter
+{
+public:
+  int addMaterial(const Eigen::Vector4d& color)
+  {
+    const std::array<double, 4> key{ color(0), color(1), color(2), color(3) };
+    auto it = material_indices_.find(key);
+    if (it != material_indices_.end())
+      return it->second;
+
+    std::ostringstream os;
+    os.precision(std::numeric_limits<float>::max_digits10);
+    os << R"({"pbrMetallicRoughness":{"baseColorFactor":[)";
+    for (Eigen::Index i = 0; i < 4; ++i)
+      os << ((i > 0) ? "," : "") << std::clamp(color(i), 0.0, 1.0);
+    os << R"(],"metallicFactor":0,"roughnessFactor":1},"doubleSided":true)";
+    if (color(3) < 1)
+      os << R"(,"alphaMode":"BLEND")";
+    os << "}";
+
+    const auto index = static_cast<int>(materials_.size());
+    materials_.push_back(os.str());
+    material_indices_[key] = index;
+    return index;
+  }
+
+  /** @brief Add a mesh with one primitive, mode 4 is triangles and mode 1 is lines */
+  int addMesh(const std::string& name, const TriangleMesh& mesh, int material, int mode)
+  {
+    const int positions = addPositions(mesh.vertices);
+    std::ostringstream os;
+    os << R"({"name":")" << escapeJson(name) << R"(","primitives":[{"attributes":{"POSITION":)" << positions << "}";
+    if (!mesh.indices.empty())
+      os << R"(,"indices":)" << addIndices(mesh.indices);
+    os << R"(,"material":)" << material << R"(,"mode":)" << mode << "}]}";
+
+    meshes_.push_back(os.str());
+    return static_cast<int>(meshes_.size()) - 1;
+  }
+
+  std::string finish(const std::vector<std::string>& nodes, const std::vector<int>& roots) const
+  {
+    std::ostringstream os;
+    os << R"({"asset":{"version":"2.0","generator":"tesseract_visualization"},"scene":0,"scenes":[{"nodes":[)";
+    for (std::size_t i = 0; i < roots.size(); ++i)
+      os << ((i > 0) ? "," : "") << roots[i];
+    os << "]}]";
+    writeArray(os, "nodes", nodes);
+    writeArray(os, "meshes", meshes_);
+    writeArray(os, "materials", materials_);
+    writeArray(os, "accessors", accessors_);
+    writeArray(os, "bufferViews", buffer_views_);
+    if (!buffer_.empty())
+    {
+      os << R"(,"buffers":[{"byteLength":)" << buffer_.size() << R"(,"uri":"data:application/octet-stream;base64,)"
+         << encodeBase64(buffer_) << R"("}])";
+    }
+    os << "}";
+    return os.str();
+  }
+
+private:
+  std::string buffer_;
+  std::vector<std::string> materials_;
+  std::map<std::array<double, 4>, int> material_indices_;
+  std::vector<std::string> meshes_;
+  std::vector<std::string> accessors_;
+  std::vector<std::string> buffer_views_;
+
+  int addBufferView(const void* data, std::size_t size, int target)
+  {
+    const std::size_t offset = buffer_.size();
+    buffer_.append(static_cast<const char*>(data), size);
+    std::ostringstream os;
+    os << R"({"buffer":0,"byteOffset":)" << offset << R"(,"byteLength":)" << size << R"(,"target":)" << target << "}";
+    buffer_views_.push_back(os.str());
+    return static_cast<int>(buffer_views_.size()) - 1;
+  }
+
+  int addPositions(const std::vector<float>& vertices)
+  {
+    std::array<float, 3> min_value{ std::numeric_limits<float>::max(),
+                                    std::numeric_limits<float>::max(),
+                                    std::numeric_limits<float>::max() };
+    std::array<float, 3> max_value{ std::numeric_limits<float>::lowest(),
+                                    std::numeric_limits<float>::lowest(),
+                                    std::numeric_limits<float>::lowest() };
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+      min_value[i % 3] = std::min(min_value[i % 3], vertices[i]);
+      max_value[i % 3] = std::max(max_value[i % 3], vertices[i]);
+    }
+
+    const int view = addBufferView(vertices.data(), vertices.size() * sizeof(float), ARRAY_BUFFER);
+    std::ostringstream os;
+    os.precision(std::numeric_limits<float>::max_digits10);
+    os << R"({"bufferView":)" << view << R"(,"componentType":5126,"count":)" << (vertices.size() / 3)
+       << R"(,"type":"VEC3","min":[)" << min_value[0] << "," << min_value[1] << "," << min_value[2] << "],\"max\":["
+       << max_value[0] << "," << max_value[1] << "," << max_value[2] << "]}";
+    accessors_.push_back(os.str());
+    return static_cast<int>(accessors_.size()) - 1;
+  }
+
+  int addIndices(const std::vector<uint32_t>& indices)
+  {
+    const int view = addBufferView(indices.data(), indices.size() * sizeof(uint32_t), ELEMENT_ARRAY_BUFFER);
+    std::ostringstream os;
+    os << R"({"bufferView":)" << view << R"(,"componentType":5125,"count":)" << indices.size()
+       << R"(,"type":"SCALAR"})";
+    accessors_.push_back(os.str());
+    return static_cast<int>(accessors_.size()) - 1;
+  }
+
+  static void writeArray(std::ostringstream& os, const std::string& name, const std::vector<std::string>& items)
+  {
+    if (items.empty())
+      return;
+
+    os << ",\"" << name << "\":[";
+    for (std::size_t i = 0; i < items.size(); ++i)
+      os << ((i > 0) ? "," : "") << items[i];
+    os << "]";
+  }
+};
+
+Eigen::Vector4d getColor(const tesseract_scene_graph::Material::ConstPtr& material)
+{
+  return (material != nullptr) ? material->color : Eigen::Vector4d(0.5, 0.5, 0.5, 1.0);
+}
+
+void addAxisLines(std::vector<Eigen::Vector3d>& x_axes,
+                  std::vector<Eigen::Vector3d>& y_axes,
+                  std::vector<Eigen::Vector3d>& z_axes,
+                  const Eigen::Isometry3d& frame,
+                  const Eigen::Vector3d& scale)
+{
+  x_axes.push_back(frame.translation());
+  x_axes.emplace_back(frame * Eigen::Vector3d(scale.x(), 0, 0));
+  y_axes.push_back(frame.translation());
+  y_axes.emplace_back(frame * Eigen::Vector3d(0, scale.y(), 0));
+  z_axes.push_back(frame.translation());
+  z_axes.emplace_back(frame * Eigen::Vector3d(0, 0, scale.z()));
+}
+
+void addAxes(GLTFScene& scene,
+             const std::string& name,
+             std::vector<Eigen::Vector3d> x_axes,
+             std::vector<Eigen::Vector3d> y_axes,
+             std::vector<Eigen::Vector3d> z_axes)
+{
+  scene.addLines(name + "/x", std::move(x_axes), Eigen::Vector4d(1, 0, 0, 1));
+  scene.addLines(name + "/y", std::move(y_axes), Eigen::Vector4d(0, 1, 0, 1));
+  scene.addLines(name + "/z", std::move(z_axes), Eigen::Vector4d(0, 0, 1, 1));
+}
+}  // namespace
+
+void GLTFScene::beginGroup(const std::string& name) { groups_.push_back(name); }
+
+void GLTFScene::addGeometry(const std::string& name,
+                            const tesseract_geometry::Geometry::ConstPtr& geometry,
+                            const Eigen::Isometry3d& pose,
+                            const Eigen::Vector4d& color)
+{
+  if (geometry == nullptr)
+    return;
+
+  if (geometry->getType() == tesseract_geometry::GeometryType::OCTREE)
+  {
+    CONSOLE_BRIDGE_logDebug("GLTFScene, octree '%s' is not supported and skipped", name.c_str());
+    return;
+  }
+
+  Node& node = nodes_.emplace_back();
+  node.name = name;
+  node.group = static_cast<int>(groups_.size()) - 1;
+  node.geometry = geometry;
+  node.pose = pose;
+  node.color = color;
+}
+
+void GLTFScene::addLines(const std::string& name, std::vector<Eigen::Vector3d> points, const Eigen::Vector4d& color)
+{
+  if (points.size() < 2)
+    return;
+
+  Node& node = nodes_.emplace_back();
+  node.name = name;
+  node.group = static_cast<int>(groups_.size()) - 1;
+  node.lines = std::move(points);
+  node.color = color;
+}
+
+void GLTFScene::append(const GLTFScene& other)
+{
+  const auto group_offset = static_cast<int>(groups_.size());
+  groups_.insert(groups_.end(), other.groups_.begin(), other.groups_.end());
+  for (const auto& node : other.nodes_)
+  {
+    nodes_.push_back(node);
+    nodes_.back().group = (node.group >= 0) ? node.group + group_offset : static_cast<int>(groups_.size()) - 1;
+  }
+}
+
+bool GLTFScene::empty() const { return nodes_.empty(); }
+
+std::string GLTFScene::toString() const
+{
+  GLTFWriter writer;
+
+  // Each geometry is tessellated once per material
+  std::map<std::pair<const tesseract_geometry::Geometry*, int>, int> geometry_meshes;
+  std::vector<std::string> node_json;
+  std::vector<std::vector<int>> group_children(groups_.size());
+  std::vector<int> roots;
+  std::vector<int> node_indices;
+  node_indices.reserve(nodes_.size());
+
+  const auto group_count = static_cast<int>(groups_.size());
+  for (const auto& node : nodes_)
+  {
+    const int material = writer.addMaterial(node.color);
+    int mesh_index{ -1 };
+    if (node.geometry != nullptr)
+    {
+      const auto key = std::make_pair(node.geometry.get(), material);
+      auto it = geometry_meshes.find(key);
+      if (it == geometry_meshes.end())
+      {
+        TriangleMesh mesh;
+        if (tessellate(*node.geometry, mesh) && !mesh.indices.empty())
+          mesh_index = writer.addMesh(node.name, mesh, material, 4);
+        it = geometry_meshes.emplace(key, mesh_index).first;
+      }
+      mesh_index = it->second;
+    }
+    else
+    {
+      TriangleMesh mesh;
+      for (const auto& point : node.lines)
+        mesh.addVertex(point);
+      mesh_index = writer.addMesh(node.name, mesh, material, 1);
+    }
+
+    if (mesh_index < 0)
+      continue;
+
+    std::ostringstream os;
+    os.precision(std::numeric_limits<double>::max_digits10);
+    os << R"({"name":")" << escapeJson(node.name) << R"(","mesh":)" << mesh_index;
+    if (!node.pose.matrix().isIdentity())
+    {
+      // glTF matrices are column major
+      os << R"(,"matrix":[)";
+      for (Eigen::Index c = 0; c < 4; ++c)
+        for (Eigen::Index r = 0; r < 4; ++r)
+          os << ((c + r > 0) ? "," : "") << node.pose.matrix()(r, c);
+      os << "]";
+    }
+    os << "}";
+
+    const auto index = group_count + static_cast<int>(node_json.size());
+    node_json.push_back(os.str());
+    if (node.group >= 0)
+      group_children[static_cast<std::size_t>(node.group)].push_back(index);
+    else
+      roots.push_back(index);
+  }
+
+  // The group nodes come first so the indices of the other nodes are known when they are written
+  std::vector<std::string> all_nodes;
+  all_nodes.reserve(groups_.size() + node_json.size());
+  for (std::size_t i = 0; i < groups_.size(); ++i)
+  {
+    std::ostringstream os;
+    os << R"({"name":")" << escapeJson(groups_[i]) << R"(")";
+    if (!group_children[i].empty())
+    {
+      os << R"(,"children":[)";
+      for (std::size_t j = 0; j < group_children[i].size(); ++j)
+        os << ((j > 0) ? "," : "") << group_children[i][j];
+      os << "]";
+    }
+    os << "}";
+    all_nodes.push_back(os.str());
+    roots.push_back(static_cast<int>(i));
+  }
+  all_nodes.insert(all_nodes.end(), node_json.begin(), node_json.end());
+
+  return writer.finish(all_nodes, roots);
+}
+
+void GLTFScene::save(const std::string& file_path) const
+{
+  const std::string json = toString();
+  std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+  if (!file)
+    throw std::runtime_error("GLTFScene, failed to open file '" + file_path + "'!");
+
+  file << json;
+  if (!file)
+    throw std::runtime_error("GLTFScene, failed to write file '" + file_path + "'!");
+}
+
+void addSceneGraph(GLTFScene& scene,
+                   const tesseract_scene_graph::SceneGraph& scene_graph,
+                   const tesseract_common::TransformMap& link_transforms)
+{
+  for (const auto& link : scene_graph.getLinks())
+  {
+    auto it = link_transforms.find(link->getName());
+    if (it == link_transforms.end())
+      continue;
+
+    for (std::size_t i = 0; i < link->visual.size(); ++i)
+    {
+      const auto& visual = link->visual[i];
+      const std::string name =
+          link->getName() + "/" + (visual->name.empty() ? std::to_string(i) : visual->name);
+      scene.addGeometry(name, visual->geometry, it->second * visual->origin, getColor(visual->material));
+    }
+  }
+}
+
+bool addMarker(GLTFScene& scene, const Marker& marker)
+{
+  switch (marker.getType())
+  {
+    case static_cast<int>(MarkerType::GEOMETRY):
+    {
+      const auto& m = dynamic_cast<const GeometryMarker&>(marker);
+      scene.addGeometry("geometry", m.geom, m.origin, Eigen::Vector4d(0.8, 0.8, 0.8, 1.0));
+      return true;
+    }
+    case static_cast<int>(MarkerType::ARROW):
+    {
+      const auto& m = dynamic_cast<const ArrowMarker&>(marker);
+      const double half_length = (m.shaft_length + m.head_length) / 2;
+      const Eigen::Vector3d tip = m.pose * Eigen::Vector3d(0, 0, half_length);
+      std::vector<Eigen::Vector3d> points{ m.pose * Eigen::Vector3d(0, 0, -half_length), tip };
+      for (const Eigen::Vector3d& side : { Eigen::Vector3d(m.head_radius, 0, 0), Eigen::Vector3d(0, m.head_radius, 0) })
+      {
+        points.push_back(tip);
+        points.emplace_back(m.pose * (Eigen::Vector3d(0, 0, half_length - m.head_length) + side));
+        points.push_back(tip);
+        points.emplace_back(m.pose * (Eigen::Vector3d(0, 0, half_length - m.head_length) - side));
+      }
+      scene.addLines("arrow", std::move(points), getColor(m.material));
+      return true;
+    }
+    case static_cast<int>(MarkerType::AXIS):
+    {
+      const auto& m = dynamic_cast<const AxisMarker&>(marker);
+      std::vector<Eigen::Vector3d> x_axes;
+      std::vector<Eigen::Vector3d> y_axes;
+      std::vector<Eigen::Vector3d> z_axes;
+      addAxisLines(x_axes, y_axes, z_axes, m.axis, m.getScale());
+      addAxes(scene, "axis", std::move(x_axes), std::move(y_axes), std::move(z_axes));
+      return true;
+    }
+    case static_cast<int>(MarkerType::CONTACT_RESULTS):
+    {
+      const auto& m = dynamic_cast<const ContactResultsMarker&>(marker);
+      std::vector<Eigen::Vector3d> collision;
+      std::vector<Eigen::Vector3d> within_margin;
+      std::vector<Eigen::Vector3d> separated;
+      std::vector<Eigen::Vector3d> continuous;
+      for (std::size_t i : m.getRenderedContacts())
+      {
+        const tesseract_collision::ContactResult& dist = m.dist_results[i];
+        std::vector<Eigen::Vector3d>* lines = &separated;
+        if (dist.distance < 0)
+          lines = &collision;
+        else if (dist.distance < m.getContactMargin(dist))
+          lines = &within_margin;
+
+        lines->push_back(dist.nearest_points[0]);
+        lines->push_back(dist.nearest_points[1]);
+        for (std::size_t j = 0; j < 2; ++j)
+        {
+          if (dist.cc_type[j] == tesseract_collision::ContinuousCollisionType::CCType_Between)
+          {
+            continuous.emplace_back(dist.transform[j] * dist.nearest_points_local[j]);
+            continuous.emplace_back(dist.cc_transform[j] * dist.nearest_points_local[j]);
+          }
+        }
+      }
+      scene.addLines("contacts/collision", std::move(collision), Eigen::Vector4d(1, 0, 0, 1));
+      scene.addLines("contacts/within_margin", std::move(within_margin), Eigen::Vector4d(1, 1, 0, 1));
+      scene.addLines("contacts/separated", std::move(separated), Eigen::Vector4d(0, 1, 0, 1));
+      scene.addLines("contacts/continuous", std::move(continuous), Eigen::Vector4d(0, 0, 1, 1));
+      return true;
+    }
+    case static_cast<int>(MarkerType::TOOLPATH):
+    {
+      const auto& m = dynamic_cast<const ToolpathMarker&>(marker);
+      std::vector<Eigen::Vector3d> path;
+      std::vector<Eigen::Vector3d> x_axes;
+      std::vector<Eigen::Vector3d> y_axes;
+      std::vector<Eigen::Vector3d> z_axes;
+      for (const ToolpathChunk& chunk : m.getChunks())
+      {
+        for (std::size_t i = 1; i < chunk.points.size(); ++i)
+        {
+          path.push_back(chunk.points[i - 1]);
+          path.push_back(chunk.points[i]);
+        }
+
+        for (const auto& frame : chunk.frames)
+          addAxisLines(x_axes, y_axes, z_axes, frame, m.scale);
+      }
+      scene.addLines("toolpath", std::move(path), Eigen::Vector4d(1, 1, 1, 1));
+      addAxes(scene, "toolpath", std::move(x_axes), std::move(y_axes), std::move(z_axes));
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace tesseract_visualization
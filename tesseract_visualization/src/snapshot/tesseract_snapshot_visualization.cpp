@@ -0,0 +1,231 @@
+/**
+ * @file tesseract_snapshot_visualization.cpp
+ * @brief A headless visualization writing snapshots of the scene to glTF files
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/snapshot/tesseract_snapshot_visualization.h>
+#include <tesseract_common/class_loader.h>
+
+/** @brief The environment variable of the default output directory */
+static const std::string TESSERACT_SNAPSHOT_DIRECTORY_ENV = "TESSERACT_SNAPSHOT_DIRECTORY";
+
+namespace tesseract_visualization
+{
+/** @brief The number of snapshots not written yet, shared with the write tasks */
+struct TesseractSnapshotVisualization::Pending
+{
+  mutable std::mutex mutex;
+  mutable std::condition_variable cv;
+  std::size_t count{ 0 };
+};
+
+std::string getDefaultSnapshotDirectory()
+{
+  const char* directory = std::getenv(TESSERACT_SNAPSHOT_DIRECTORY_ENV.c_str());  // NOLINT
+  if (directory != nullptr && directory[0] != '\0')
+    return directory;
+
+  return (std::filesystem::temp_directory_path() / "tesseract_snapshots").string();
+}
+
+TesseractSnapshotVisualization::TesseractSnapshotVisualization()
+  : TesseractSnapshotVisualization(getDefaultSnapshotDirectory())
+{
+}
+
+TesseractSnapshotVisualization::TesseractSnapshotVisualization(std::string output_directory,
+                                                               tesseract_common::Executor::Ptr executor)
+  : output_directory_(std::move(output_directory))
+  , executor_((executor != nullptr) ? std::move(executor) : tesseract_common::getDefaultExecutor())
+  , pending_(std::make_shared<Pending>())
+{
+  std::filesystem::create_directories(output_directory_);
+}
+
+TesseractSnapshotVisualization::~TesseractSnapshotVisualization() { wait(); }
+
+bool TesseractSnapshotVisualization::isConnected() const { return true; }
+
+void TesseractSnapshotVisualization::waitForConnection(long /*seconds*/) const {}
+
+void TesseractSnapshotVisualization::plotEnvironment(const tesseract_environment::Environment& env, std::string ns)
+{
+  scene_graph_ = env.getSceneGraph();
+  link_transforms_ = env.getState().link_transforms;
+
+  GLTFScene scene;
+  addScene(scene, true);
+  write(std::move(scene), ns, "environment");
+}
+
+void TesseractSnapshotVisualization::plotEnvironmentState(const tesseract_scene_graph::SceneState& state,
+                                                          std::string ns)
+{
+  if (scene_graph_ == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("TesseractSnapshotVisualization, plotEnvironment must be called before plotting a state");
+    return;
+  }
+
+  link_transforms_ = state.link_transforms;
+
+  GLTFScene scene;
+  addScene(scene, true);
+  write(std::move(scene), ns, "state");
+}
+
+void TesseractSnapshotVisualization::plotTrajectory(const tesseract_common::JointTrajectory& traj,
+                                                    const tesseract_scene_graph::StateSolver& state_solver,
+                                                    std::string ns)
+{
+  if (scene_graph_ == nullptr)
+  {
+    CONSOLE_BRIDGE_logWarn("TesseractSnapshotVisualization, plotEnvironment must be called before plotting a "
+                           "trajectory");
+    return;
+  }
+
+  // The markers and a group per waypoint, the geometries are shared by all waypoints
+  GLTFScene scene;
+  addScene(scene, false);
+  tesseract_scene_graph::SceneState state;
+  for (std::size_t i = 0; i < traj.size(); ++i)
+  {
+    state_solver.getState(state, traj[i].joint_names, traj[i].position);
+    scene.beginGroup("trajectory/" + std::to_string(i));
+    addSceneGraph(scene, *scene_graph_, state.link_transforms);
+  }
+  write(std::move(scene), ns, "trajectory");
+}
+
+void TesseractSnapshotVisualization::plotMarker(const Marker& marker, std::string ns)
+{
+  if (!addMarker(markers_[ns], marker))
+  {
+    CONSOLE_BRIDGE_logWarn("TesseractSnapshotVisualization, unsupported marker type: %i", marker.getType());
+    return;
+  }
+
+  GLTFScene scene;
+  addScene(scene, true);
+  write(std::move(scene), ns, "markers");
+}
+
+void TesseractSnapshotVisualization::plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns)
+{
+  GLTFScene& ns_markers = markers_[ns];
+  for (const auto& marker : markers)
+  {
+    if (!addMarker(ns_markers, *marker))
+      CONSOLE_BRIDGE_logWarn("TesseractSnapshotVisualization, unsupported marker type: %i", marker->getType());
+  }
+
+  GLTFScene scene;
+  addScene(scene, true);
+  write(std::move(scene), ns, "markers");
+}
+
+void TesseractSnapshotVisualization::clear(std::string ns)
+{
+  if (ns.empty())
+    markers_.clear();
+  else
+    markers_.erase(ns);
+}
+
+void TesseractSnapshotVisualization::waitForInput(std::string message)
+{
+  CONSOLE_BRIDGE_logInform("TesseractSnapshotVisualization, not waiting for input: %s", message.c_str());
+}
+
+const std::string& TesseractSnapshotVisualization::getOutputDirectory() const { return output_directory_; }
+
+void TesseractSnapshotVisualization::wait() const
+{
+  std::unique_lock<std::mutex> lock(pending_->mutex);
+  pending_->cv.wait(lock, [this]() { return pending_->count == 0; });
+}
+
+std::size_t TesseractSnapshotVisualization::getSnapshotCount() const { return sequence_.load(); }
+
+void TesseractSnapshotVisualization::addScene(GLTFScene& scene, bool include_state) const
+{
+  if (include_state && scene_graph_ != nullptr)
+  {
+    scene.beginGroup("environment");
+    addSceneGraph(scene, *scene_graph_, link_transforms_);
+  }
+
+  for (const auto& ns_markers : markers_)
+  {
+    scene.beginGroup("markers/" + ns_markers.first);
+    scene.append(ns_markers.second);
+  }
+}
+
+void TesseractSnapshotVisualization::write(GLTFScene scene, const std::string& ns, const std::string& kind)
+{
+  std::ostringstream file_name;
+  file_name << (ns.empty() ? "snapshot" : ns) << "_" << std::setw(6) << std::setfill('0') << sequence_++ << "_"
+            << kind << ".gltf";
+  const std::string file_path = (std::filesystem::path(output_directory_) / file_name.str()).string();
+
+  {
+    std::lock_guard<std::mutex> lock(pending_->mutex);
+    ++pending_->count;
+  }
+
+  // The scene only holds pointers to the geometries, the tessellation and encoding happen on the executor
+  auto shared_scene = std::make_shared<const GLTFScene>(std::move(scene));
+  std::shared_ptr<Pending> pending = pending_;
+  executor_->submit([shared_scene, file_path, pending]() {
+    try
+    {
+      shared_scene->save(file_path);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TesseractSnapshotVisualization, %s", e.what());
+    }
+
+    std::lock_guard<std::mutex> lock(pending->mutex);
+    --pending->count;
+    pending->cv.notify_all();
+  });
+}
+
+TESSERACT_PLUGIN_ANCHOR_IMPL(SnapshotVisualizationAnchor)
+}  // namespace tesseract_visualization
+
+TESSERACT_ADD_VISUALIZATION_PLUGIN(tesseract_visualization::TesseractSnapshotVisualization,
+                                   TesseractSnapshotVisualizationPlugin)
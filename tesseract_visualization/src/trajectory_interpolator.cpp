@@ -26,7 +26,13 @@
 
 /* Based on MoveIt code authored by: Ioan Sucan, Adam Leeper */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_visualization/trajectory_interpolator.h>
+#include <tesseract_common/interpolation.h>
 
 namespace tesseract_visualization
 {
@@ -77,25 +83,33 @@ void TrajectoryInterpolator::findStateIndices(const double& duration, long& befo
     return;
   }
 
-  // Find indicies
-  std::size_t index = 0;
-  std::size_t num_points = trajectory_.size();
-  double running_duration = 0.0;
-  for (; index < num_points; ++index)
+  // Find the first state at or after the duration, the state times are the running sum of the durations from the
+  // previous state so they are sorted
+  auto it = std::lower_bound(trajectory_.begin(),
+                             trajectory_.end(),
+                             duration,
+                             [](const tesseract_common::JointState& state, double d) { return state.time < d; });
+  auto index = static_cast<long>(std::distance(trajectory_.begin(), it));
+  auto num_points = static_cast<long>(trajectory_.size());
+
+  // The duration is past the end of the trajectory
+  if (index == num_points)
   {
-    running_duration += duration_from_previous_[index];
-    if (running_duration >= duration)
-      break;
+    before = num_points - 1;
+    after = num_points - 1;
+    blend = 1.0;
+    return;
   }
-  before = static_cast<int>(std::max<std::size_t>(index - 1, 0));
-  after = static_cast<int>(std::min<std::size_t>(index, num_points - 1));
+
+  before = index - 1;
+  after = index;
 
   // Compute duration blend
-  double before_time = running_duration - duration_from_previous_[index];
-  if ((index == 0) || (after == before))
+  if (index == 0)
     blend = 1.0;
   else
-    blend = (duration - before_time) / duration_from_previous_[index];
+    blend = (duration - trajectory_[static_cast<std::size_t>(before)].time) /
+            duration_from_previous_[static_cast<std::size_t>(index)];
 }
 
 tesseract_common::JointState TrajectoryInterpolator::getState(double request_duration) const
@@ -154,9 +168,7 @@ tesseract_common::JointState TrajectoryInterpolator::interpolate(const tesseract
   out.time = start.time + t;
   out.joint_names = start.joint_names;
   out.position.resize(static_cast<long>(out.joint_names.size()));
-
-  for (long i = 0; i < static_cast<long>(out.joint_names.size()); ++i)
-    out.position[i] = start.position[i] + (end.position[i] - start.position[i]) * t;
+  tesseract_common::interpolateSegment(out.position, start, end, t, tesseract_common::InterpolationType::LINEAR);
 
   return out;
 }
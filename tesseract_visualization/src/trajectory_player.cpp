@@ -26,17 +26,35 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <cmath>
 #include <memory>
+#include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_visualization/trajectory_player.h>
 
 namespace tesseract_visualization
 {
+/** @brief The number of frames computed by each batch forward kinematics call of the background task */
+static const std::size_t PRECOMPUTE_BATCH_SIZE = 64;
+
+struct TrajectoryPlayer::Frames
+{
+  double frame_rate{ 0 };
+
+  /** @brief The link transforms of each frame, preallocated so the background task never reallocates it */
+  std::vector<tesseract_common::TransformMap> link_transforms;
+
+  /** @brief The number of leading frames which are computed */
+  std::atomic<long> computed{ 0 };
+};
+
 void TrajectoryPlayer::setTrajectory(const tesseract_common::JointTrajectory& trajectory)
 {
   // Prepare the new trajectory message
   trajectory_ = std::make_unique<TrajectoryInterpolator>(trajectory);
+  frames_ = nullptr;
 
   // Get the duration
   trajectory_duration_ = trajectory_->getStateDuration(trajectory_->getStateCount() - 1);
@@ -97,13 +115,8 @@ tesseract_common::JointState TrajectoryPlayer::getNext()
   if (!trajectory_ || trajectory_->empty())
     throw std::runtime_error("Trajectory is empty!");
 
-  auto current_time = std::chrono::high_resolution_clock::now();
-  current_duration_ = (scale_ * std::chrono::duration<double>(current_time - start_time_).count());
-
-  if (current_duration_ > trajectory_duration_)
+  if (updateCurrentDuration())
   {
-    current_duration_ = trajectory_duration_;
-
     // Compute the interpolated state
     auto mi = trajectory_->getState(current_duration_);
 
@@ -148,4 +161,117 @@ void TrajectoryPlayer::reset()
 
 long TrajectoryPlayer::size() const { return (trajectory_) ? trajectory_->getStateCount() : 0; }
 
+void TrajectoryPlayer::precompute(const tesseract_scene_graph::StateSolver& state_solver,
+                                  double frame_rate,
+                                  const tesseract_common::Executor::Ptr& executor)
+{
+  if (!trajectory_ || trajectory_->empty())
+    throw std::runtime_error("Trajectory is empty!");
+
+  if (!(frame_rate > 0))
+    throw std::runtime_error("TrajectoryPlayer, the frame rate must be greater than zero!");
+
+  // Interpolate all frames up front, the last frame is at the end of the trajectory
+  const auto frame_count = static_cast<std::size_t>(std::ceil(trajectory_duration_ * frame_rate)) + 1;
+  std::vector<tesseract_common::JointState> states;
+  states.reserve(frame_count);
+  for (std::size_t i = 0; i < frame_count; ++i)
+    states.push_back(trajectory_->getState(std::min(static_cast<double>(i) / frame_rate, trajectory_duration_)));
+
+  auto frames = std::make_shared<Frames>();
+  frames->frame_rate = frame_rate;
+  frames->link_transforms.resize(frame_count);
+  frames_ = frames;
+
+  std::shared_ptr<const tesseract_scene_graph::StateSolver> solver = state_solver.clone();
+  std::weak_ptr<Frames> weak_frames = frames;
+  tesseract_common::Executor::Ptr task_executor =
+      (executor != nullptr) ? executor : tesseract_common::getDefaultExecutor();
+  task_executor->submit([weak_frames, solver, states = std::move(states)]() {
+    try
+    {
+      std::size_t start = 0;
+      while (start < states.size())
+      {
+        // Stop once the player released the frames
+        std::shared_ptr<Frames> frames = weak_frames.lock();
+        if (frames == nullptr)
+          return;
+
+        // A batch of consecutive frames with the same joints
+        const tesseract_common::JointState& first = states[start];
+        std::size_t end = start + 1;
+        while (end < states.size() && (end - start) < PRECOMPUTE_BATCH_SIZE &&
+               states[end].joint_names == first.joint_names)
+          ++end;
+
+        tesseract_common::TrajArray traj(static_cast<Eigen::Index>(end - start), first.position.size());
+        for (std::size_t i = start; i < end; ++i)
+          traj.row(static_cast<Eigen::Index>(i - start)) = states[i].position.transpose();
+
+        std::vector<tesseract_common::TransformMap> link_transforms =
+            solver->getLinkTransforms(first.joint_names, traj);
+        for (std::size_t i = start; i < end; ++i)
+          frames->link_transforms[i] = std::move(link_transforms[i - start]);
+
+        frames->computed.store(static_cast<long>(end), std::memory_order_release);
+        start = end;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TrajectoryPlayer, failed to precompute frames: %s", e.what());
+    }
+  });
+}
+
+bool TrajectoryPlayer::isPrecomputed() const { return (frames_ != nullptr); }
+
+long TrajectoryPlayer::getFrameCount() const
+{
+  return (frames_ != nullptr) ? static_cast<long>(frames_->link_transforms.size()) : 0;
+}
+
+long TrajectoryPlayer::getComputedFrameCount() const
+{
+  return (frames_ != nullptr) ? frames_->computed.load(std::memory_order_acquire) : 0;
+}
+
+const tesseract_common::TransformMap* TrajectoryPlayer::getNextFrame()
+{
+  if (frames_ == nullptr)
+    throw std::runtime_error("TrajectoryPlayer, the frames were not precomputed!");
+
+  const bool end_reached = updateCurrentDuration();
+
+  const long last_frame = static_cast<long>(frames_->link_transforms.size()) - 1;
+  long index = std::min(static_cast<long>(std::lround(current_duration_ * frames_->frame_rate)), last_frame);
+  index = std::min(index, frames_->computed.load(std::memory_order_acquire) - 1);
+
+  if (end_reached)
+  {
+    // Reset the player
+    if (loop_)
+      reset();
+    else
+      finished_ = true;
+  }
+
+  return (index >= 0) ? &frames_->link_transforms[static_cast<std::size_t>(index)] : nullptr;
+}
+
+bool TrajectoryPlayer::updateCurrentDuration()
+{
+  auto current_time = std::chrono::high_resolution_clock::now();
+  current_duration_ = (scale_ * std::chrono::duration<double>(current_time - start_time_).count());
+
+  if (current_duration_ > trajectory_duration_)
+  {
+    current_duration_ = trajectory_duration_;
+    return true;
+  }
+
+  return false;
+}
+
 }  // namespace tesseract_visualization
@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 const std::string TESSERACT_IGNITION_LIBRARY_NAME = "tesseract_visualization_ignition_visualization_plugin";
 const std::string TESSERACT_IGNITION_SYMBOL_NAME = "TesseractIgnitionVisualizationPlugin";
+const std::string TESSERACT_SNAPSHOT_LIBRARY_NAME = "tesseract_visualization_snapshot_visualization";
 
 const std::string TESSERACT_VISUALIZATION_PLUGIN_DIRECTORIES_ENV = "TESSERACT_VISUALIZATION_PLUGIN_DIRECTORIES";
 const std::string TESSERACT_VISUALIZATION_PLUGINS_ENV = "TESSERACT_VISUALIZATION_PLUGINS";
@@ -45,6 +46,7 @@ VisualizationLoader::VisualizationLoader()
   search_paths_env = TESSERACT_VISUALIZATION_PLUGIN_DIRECTORIES_ENV;
   search_libraries_env = TESSERACT_VISUALIZATION_PLUGINS_ENV;
   search_libraries.insert(TESSERACT_IGNITION_LIBRARY_NAME);
+  search_libraries.insert(TESSERACT_SNAPSHOT_LIBRARY_NAME);
   search_paths.insert(TESSERACT_VISUALIZATION_PLUGIN_PATH);
 }
 
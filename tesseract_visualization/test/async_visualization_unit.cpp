@@ -0,0 +1,159 @@
+/**
+ * @file async_visualization_unit.cpp
+ * @brief Tests of the asynchronous visualization wrapper
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/async_visualization.h>
+#include <tesseract_visualization/markers/axis_marker.h>
+
+using namespace tesseract_visualization;
+
+/** @brief Records the plot calls, waitForConnection blocks until the gate is opened */
+class RecordingVisualization : public Visualization
+{
+public:
+  std::shared_future<void> gate;
+  std::vector<std::string> calls;
+  std::thread::id thread_id;
+  mutable std::atomic<bool> waiting{ false };
+
+  bool isConnected() const override { return true; }
+  void waitForConnection(long /*seconds*/) const override
+  {
+    waiting = true;
+    gate.wait();
+  }
+  void plotEnvironment(const tesseract_environment::Environment& /*env*/, std::string ns) override
+  {
+    record("environment/" + ns);
+  }
+  void plotEnvironmentState(const tesseract_scene_graph::SceneState& state, std::string ns) override
+  {
+    record("state/" + ns + "/" + std::to_string(state.joints.at("joint_a")));
+  }
+  void plotTrajectory(const tesseract_common::JointTrajectory& /*traj*/,
+                      const tesseract_scene_graph::StateSolver& /*state_solver*/,
+                      std::string ns) override
+  {
+    record("trajectory/" + ns);
+  }
+  void plotMarker(const Marker& marker, std::string ns) override
+  {
+    record("marker/" + ns + "/" + std::to_string(marker.getType()));
+  }
+  void plotMarkers(const std::vector<Marker::Ptr>& markers, std::string ns) override
+  {
+    record("markers/" + ns + "/" + std::to_string(markers.size()));
+  }
+  void clear(std::string ns) override { record("clear/" + ns); }
+  void waitForInput(std::string /*message*/) override {}
+
+private:
+  void record(const std::string& call)
+  {
+    thread_id = std::this_thread::get_id();
+    calls.push_back(call);
+  }
+};
+
+tesseract_scene_graph::SceneState getState(double value)
+{
+  tesseract_scene_graph::SceneState state;
+  state.joints["joint_a"] = value;
+  return state;
+}
+
+TEST(TesseractVisualizationAsyncUnit, CoalesceAndClear)  // NOLINT
+{
+  std::promise<void> gate;
+  auto recording = std::make_shared<RecordingVisualization>();
+  recording->gate = gate.get_future().share();
+
+  {
+    AsyncVisualization visualization(recording);
+
+    // The worker blocks on the connection so the following calls stay pending
+    visualization.waitForConnection();
+    visualization.plotEnvironmentState(getState(1), "a");
+    visualization.plotMarker(AxisMarker(), "a");
+    visualization.plotMarkers({ std::make_shared<AxisMarker>(), std::make_shared<AxisMarker>() }, "b");
+    visualization.plotEnvironmentState(getState(2), "a");
+    visualization.clear("a");
+    visualization.plotEnvironmentState(getState(3), "b");
+
+    gate.set_value();
+    visualization.flush();
+    EXPECT_EQ(visualization.getPendingCount(), 0U);
+    EXPECT_EQ(visualization.getDroppedCount(), 0U);
+  }
+
+  std::vector<std::string> expected{ "markers/b/2", "state/a/2.000000", "clear/a", "state/b/3.000000" };
+  EXPECT_EQ(recording->calls, expected);
+  EXPECT_NE(recording->thread_id, std::this_thread::get_id());
+}
+
+TEST(TesseractVisualizationAsyncUnit, DropOldest)  // NOLINT
+{
+  std::promise<void> gate;
+  auto recording = std::make_shared<RecordingVisualization>();
+  recording->gate = gate.get_future().share();
+
+  {
+    AsyncVisualization visualization(recording, 2);
+    visualization.waitForConnection();
+
+    // Wait for the worker to take the connection request off the queue
+    while (!recording->waiting)
+      std::this_thread::yield();
+
+    visualization.plotEnvironmentState(getState(1), "a");
+    visualization.plotEnvironmentState(getState(2), "b");
+    visualization.plotEnvironmentState(getState(3), "c");
+    EXPECT_EQ(visualization.getDroppedCount(), 1U);
+
+    // Pending calls are run before the wrapper is destroyed
+    gate.set_value();
+  }
+
+  std::vector<std::string> expected{ "state/b/2.000000", "state/c/3.000000" };
+  EXPECT_EQ(recording->calls, expected);
+}
+
+TEST(TesseractVisualizationAsyncUnit, Construction)  // NOLINT
+{
+  EXPECT_ANY_THROW(AsyncVisualization(nullptr));                                        // NOLINT
+  EXPECT_ANY_THROW(AsyncVisualization(std::make_shared<RecordingVisualization>(), 0));  // NOLINT
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_visualization/markers/toolpath_marker.h>
+
+using namespace tesseract_visualization;
+
+/** @brief Create a toolpath of one helix segment with the number of poses, a raster like dense path */
+ToolpathMarker createHelixToolpath(std::size_t size)
+{
+  tesseract_common::VectorIsometry3d segment;
+  segment.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const double angle = 0.001 * static_cast<double>(i);
+    Eigen::Isometry3d pose(Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitZ()));
+    pose.translation() = Eigen::Vector3d(0.5 * std::cos(angle), 0.5 * std::sin(angle), 1e-5 * static_cast<double>(i));
+    segment.push_back(pose);
+  }
+
+  return ToolpathMarker({ segment });
+}
+
+/** @brief Benchmark that decimates and chunks a toolpath, the counters report the rendered points and frames */
+static void BM_TOOLPATH_GET_CHUNKS(benchmark::State& state, ToolpathMarker marker, ToolpathLevelOfDetail lod)
+{
+  std::vector<ToolpathChunk> chunks;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(chunks = marker.getChunks(lod));
+
+  std::size_t points{ 0 };
+  std::size_t frames{ 0 };
+  for (const auto& chunk : chunks)
+  {
+    points += chunk.points.size();
+    frames += chunk.frames.size();
+  }
+
+  state.counters["poses"] = static_cast<double>(marker.toolpath.front().size());
+  state.counters["chunks"] = static_cast<double>(chunks.size());
+  state.counters["points"] = static_cast<double>(points);
+  state.counters["frames"] = static_cast<double>(frames);
+}
+
+int main(int argc, char** argv)
+{
+  std::function<void(benchmark::State&, ToolpathMarker, ToolpathLevelOfDetail)> BM_GET_CHUNKS_FUNC =
+      BM_TOOLPATH_GET_CHUNKS;
+
+  for (std::size_t size : { 20000, 200000 })
+  {
+    const ToolpathMarker marker = createHelixToolpath(size);
+
+    {
+      std::string name = "BM_TOOLPATH_GET_CHUNKS_" + std::to_string(size);
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_CHUNKS_FUNC, marker, ToolpathLevelOfDetail())
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+
+    {
+      ToolpathLevelOfDetail lod;
+      lod.view_point = Eigen::Vector3d(0, 0, 10);
+      std::string name = "BM_TOOLPATH_GET_CHUNKS_FAR_VIEW_" + std::to_string(size);
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_CHUNKS_FUNC, marker, lod)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,86 @@
+/**
+ * @file gltf_scene_unit.cpp
+ * @brief Tests of the glTF scene export
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/snapshot/gltf_scene.h>
+#include <tesseract_geometry/impl/box.h>
+
+using namespace tesseract_visualization;
+
+/** @brief Count the occurrences of a string */
+std::size_t count(const std::string& str, const std::string& sub)
+{
+  std::size_t cnt{ 0 };
+  for (std::size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+    ++cnt;
+
+  return cnt;
+}
+
+TEST(TesseractVisualizationGLTFSceneUnit, EmptyScene)  // NOLINT
+{
+  GLTFScene scene;
+  EXPECT_TRUE(scene.empty());
+
+  std::string json = scene.toString();
+  EXPECT_NE(json.find("\"version\":\"2.0\""), std::string::npos);
+  EXPECT_EQ(json.find("\"meshes\""), std::string::npos);
+}
+
+TEST(TesseractVisualizationGLTFSceneUnit, SharedGeometry)  // NOLINT
+{
+  auto box = std::make_shared<tesseract_geometry::Box>(1, 2, 3);
+  const Eigen::Vector4d color(1, 0, 0, 1);
+
+  GLTFScene scene;
+  scene.beginGroup("state_0");
+  scene.addGeometry("box", box, Eigen::Isometry3d::Identity(), color);
+  scene.beginGroup("state_1");
+  scene.addGeometry("box", box, Eigen::Isometry3d(Eigen::Translation3d(1, 0, 0)), color);
+  scene.addLines("lines", { Eigen::Vector3d::Zero(), Eigen::Vector3d::UnitX() }, color);
+  EXPECT_FALSE(scene.empty());
+
+  // The box is stored once and used by both nodes
+  std::string json = scene.toString();
+  EXPECT_EQ(count(json, "\"mode\":4"), 1U);
+  EXPECT_EQ(count(json, "\"mode\":1"), 1U);
+  EXPECT_NE(json.find("\"name\":\"state_0\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"state_1\""), std::string::npos);
+  EXPECT_NE(json.find("data:application/octet-stream;base64,"), std::string::npos);
+
+  GLTFScene appended;
+  appended.append(scene);
+  EXPECT_EQ(appended.toString(), json);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
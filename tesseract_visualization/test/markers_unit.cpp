@@ -0,0 +1,272 @@
+/**
+ * @file markers_unit.cpp
+ * @brief Tests of the level of detail of the markers
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/markers/contact_results_marker.h>
+#include <tesseract_visualization/markers/toolpath_marker.h>
+
+using namespace tesseract_visualization;
+
+/** @brief Create a contact between two links with a distance */
+tesseract_collision::ContactResult createContact(const std::string& link1, const std::string& link2, double distance)
+{
+  tesseract_collision::ContactResult contact;
+  contact.link_names[0] = link1;
+  contact.link_names[1] = link2;
+  contact.distance = distance;
+  return contact;
+}
+
+/** @brief Create a marker with contacts whose distance is the reverse of their index */
+ContactResultsMarker createContactResultsMarker()
+{
+  tesseract_collision::ContactResultVector contacts;
+  for (int i = 0; i < 10; ++i)
+    contacts.push_back(createContact("link_a", "link_b", 0.1 * (9 - i) - 0.2));
+
+  return { { "link_a", "link_b" }, contacts, tesseract_collision::CollisionMarginData(0.05) };
+}
+
+TEST(TesseractVisualizationMarkersUnit, ContactResultsDistanceThreshold)  // NOLINT
+{
+  ContactResultsMarker marker = createContactResultsMarker();
+
+  // All contacts are rendered by default
+  std::vector<std::size_t> indices = marker.getRenderedContacts();
+  EXPECT_EQ(indices.size(), marker.dist_results.size());
+
+  // Contacts beyond the threshold are dropped
+  marker.distance_threshold = 0.25;
+  indices = marker.getRenderedContacts();
+  EXPECT_EQ(indices.size(), 5U);
+  for (std::size_t i : indices)
+    EXPECT_LE(marker.dist_results[i].distance, marker.distance_threshold);
+}
+
+TEST(TesseractVisualizationMarkersUnit, ContactResultsMaxContacts)  // NOLINT
+{
+  ContactResultsMarker marker = createContactResultsMarker();
+
+  // Zero renders all contacts
+  marker.max_contacts = 0;
+  EXPECT_EQ(marker.getRenderedContacts().size(), marker.dist_results.size());
+
+  // The closest contacts are kept, sorted by distance
+  marker.max_contacts = 3;
+  EXPECT_EQ(marker.getRenderedContacts(), std::vector<std::size_t>({ 9, 8, 7 }));
+
+  // The limit applies after the distance threshold
+  marker.distance_threshold = -0.05;
+  marker.max_contacts = 5;
+  EXPECT_EQ(marker.getRenderedContacts(), std::vector<std::size_t>({ 9, 8 }));
+
+  // A limit larger than the number of contacts keeps all of them
+  marker.distance_threshold = std::numeric_limits<double>::max();
+  marker.max_contacts = 100;
+  EXPECT_EQ(marker.getRenderedContacts().size(), marker.dist_results.size());
+}
+
+TEST(TesseractVisualizationMarkersUnit, ContactResultsMargin)  // NOLINT
+{
+  tesseract_collision::CollisionMarginData margin_data(0.05);
+  margin_data.setPairCollisionMargin("link_a", "link_c", 0.1);
+  ContactResultsMarker marker({ "link_a", "link_b", "link_c" }, {}, margin_data);
+
+  EXPECT_NEAR(marker.getContactMargin(createContact("link_a", "link_b", 0)), 0.05, 1e-12);
+  EXPECT_NEAR(marker.getContactMargin(createContact("link_a", "link_c", 0)), 0.1, 1e-12);
+
+  // The margin function takes precedence over the margin data
+  marker.margin_fn = [](const std::string& link1, const std::string& link2) {
+    return (link1 == "link_a" && link2 == "link_c") ? 0.3 : 0.2;
+  };
+  EXPECT_NEAR(marker.getContactMargin(createContact("link_a", "link_b", 0)), 0.2, 1e-12);
+  EXPECT_NEAR(marker.getContactMargin(createContact("link_a", "link_c", 0)), 0.3, 1e-12);
+}
+
+/** @brief Create a straight segment along the x axis with poses spaced by step */
+tesseract_common::VectorIsometry3d createLine(std::size_t size, double step)
+{
+  tesseract_common::VectorIsometry3d segment;
+  for (std::size_t i = 0; i < size; ++i)
+    segment.emplace_back(Eigen::Translation3d(static_cast<double>(i) * step, 0, 0));
+
+  return segment;
+}
+
+/** @brief Create a circle segment of radius 0.5 in the xy plane */
+tesseract_common::VectorIsometry3d createCircle(std::size_t size)
+{
+  tesseract_common::VectorIsometry3d segment;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(size);
+    segment.emplace_back(Eigen::Translation3d(0.5 * std::cos(angle), 0.5 * std::sin(angle), 0));
+  }
+
+  return segment;
+}
+
+/** @brief Count the points and frames of the chunks */
+std::pair<std::size_t, std::size_t> countToolpathChunks(const std::vector<ToolpathChunk>& chunks)
+{
+  std::pair<std::size_t, std::size_t> counts{ 0, 0 };
+  for (const auto& chunk : chunks)
+  {
+    counts.first += chunk.points.size();
+    counts.second += chunk.frames.size();
+  }
+
+  return counts;
+}
+
+TEST(TesseractVisualizationMarkersUnit, ToolpathDecimation)  // NOLINT
+{
+  ToolpathMarker marker({ createLine(100, 0.01) });
+  marker.show_axis = false;
+
+  // A straight line decimates to its end points
+  std::vector<ToolpathChunk> chunks = marker.getChunks();
+  ASSERT_EQ(chunks.size(), 1U);
+  ASSERT_EQ(chunks[0].points.size(), 2U);
+  EXPECT_TRUE(chunks[0].points.front().isApprox(marker.toolpath[0].front().translation()));
+  EXPECT_TRUE(chunks[0].points.back().isApprox(marker.toolpath[0].back().translation()));
+  EXPECT_TRUE(chunks[0].frames.empty());
+
+  // The corner of a path is kept
+  for (std::size_t i = 50; i < marker.toolpath[0].size(); ++i)
+    marker.toolpath[0][i].translation() = Eigen::Vector3d(0.5, static_cast<double>(i - 50) * 0.01, 0);
+
+  chunks = marker.getChunks();
+  ASSERT_EQ(chunks.size(), 1U);
+  ASSERT_EQ(chunks[0].points.size(), 3U);
+  EXPECT_TRUE(chunks[0].points[1].isApprox(marker.toolpath[0][50].translation()));
+}
+
+TEST(TesseractVisualizationMarkersUnit, ToolpathChunks)  // NOLINT
+{
+  ToolpathMarker marker({ createCircle(25) });
+  ToolpathLevelOfDetail lod;
+  lod.chunk_size = 10;
+
+  // Neighbouring chunks share their end pose and no chunk exceeds the chunk size
+  std::vector<ToolpathChunk> chunks = marker.getChunks(lod);
+  ASSERT_EQ(chunks.size(), 3U);
+  std::size_t points{ 0 };
+  for (std::size_t i = 0; i < chunks.size(); ++i)
+  {
+    EXPECT_LE(chunks[i].points.size(), lod.chunk_size);
+    points += chunks[i].points.size();
+    if (i > 0)
+    {
+      EXPECT_TRUE(chunks[i].points.front().isApprox(chunks[i - 1].points.back()));
+    }
+  }
+
+  // No pose of the circle is removed, so only the shared poses are counted twice
+  EXPECT_EQ(points, marker.toolpath[0].size() + chunks.size() - 1);
+  EXPECT_TRUE(chunks.front().points.front().isApprox(marker.toolpath[0].front().translation()));
+  EXPECT_TRUE(chunks.back().points.back().isApprox(marker.toolpath[0].back().translation()));
+
+  // Every segment starts a new chunk
+  marker.toolpath.push_back(createLine(5, 0.1));
+  EXPECT_EQ(marker.getChunks(lod).size(), 4U);
+}
+
+TEST(TesseractVisualizationMarkersUnit, ToolpathFrames)  // NOLINT
+{
+  ToolpathMarker marker({ createLine(101, 0.01) });
+  marker.show_path = false;
+  ToolpathLevelOfDetail lod;
+  lod.frame_spacing = 0.095;
+
+  // A frame is emitted every frame spacing along the path, also across chunks
+  for (std::size_t chunk_size : { std::size_t(1000), std::size_t(7) })
+  {
+    lod.chunk_size = chunk_size;
+    tesseract_common::VectorIsometry3d frames;
+    for (const auto& chunk : marker.getChunks(lod))
+    {
+      EXPECT_TRUE(chunk.points.empty());
+      frames.insert(frames.end(), chunk.frames.begin(), chunk.frames.end());
+    }
+
+    ASSERT_EQ(frames.size(), 11U);
+    for (std::size_t i = 0; i < frames.size(); ++i)
+      EXPECT_NEAR(frames[i].translation().x(), 0.1 * static_cast<double>(i), 1e-9);
+  }
+}
+
+TEST(TesseractVisualizationMarkersUnit, ToolpathViewPoint)  // NOLINT
+{
+  ToolpathMarker marker({ createCircle(1000) });
+  ToolpathLevelOfDetail lod;
+  const std::pair<std::size_t, std::size_t> near = countToolpathChunks(marker.getChunks(lod));
+
+  // Within the reference distance nothing changes
+  lod.view_point = Eigen::Vector3d(0, 0, 0.5);
+  EXPECT_EQ(countToolpathChunks(marker.getChunks(lod)), near);
+
+  // A distant view point reduces the points and frames
+  lod.view_point = Eigen::Vector3d(0, 0, 50);
+  const std::pair<std::size_t, std::size_t> far = countToolpathChunks(marker.getChunks(lod));
+  EXPECT_LT(far.first, near.first);
+  EXPECT_LT(far.second, near.second);
+  EXPECT_GE(far.first, 2U);
+  EXPECT_GE(far.second, 1U);
+}
+
+TEST(TesseractVisualizationMarkersUnit, ToolpathEdgeCases)  // NOLINT
+{
+  // Empty toolpaths and segments have no chunks
+  ToolpathMarker marker;
+  EXPECT_TRUE(marker.getChunks().empty());
+  marker.toolpath.emplace_back();
+  EXPECT_TRUE(marker.getChunks().empty());
+
+  // A single pose is a point and a frame
+  marker.toolpath.push_back(createLine(1, 0.01));
+  std::vector<ToolpathChunk> chunks = marker.getChunks();
+  ASSERT_EQ(chunks.size(), 1U);
+  ASSERT_EQ(chunks[0].points.size(), 1U);
+  ASSERT_EQ(chunks[0].frames.size(), 1U);
+  EXPECT_TRUE(chunks[0].frames[0].isApprox(marker.toolpath[1][0]));
+
+  // A chunk size below two still makes progress
+  marker.toolpath = { createLine(5, 0.01) };
+  ToolpathLevelOfDetail lod;
+  lod.chunk_size = 0;
+  EXPECT_EQ(marker.getChunks(lod).size(), 4U);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file scene_diff_unit.cpp
+ * @brief Tests of the incremental scene updates
+ *
+ * @date October 15, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_visualization/scene_diff.h>
+
+using namespace tesseract_visualization;
+
+/** @brief Sort the link names so they can be compared independent of the map order */
+std::vector<std::string> sorted(std::vector<std::string> link_names)
+{
+  std::sort(link_names.begin(), link_names.end());
+  return link_names;
+}
+
+TEST(TesseractVisualizationSceneDiffUnit, ComputeSceneDiff)  // NOLINT
+{
+  const std::unordered_map<std::string, std::size_t> plotted{ { "base_link", 1 }, { "link_1", 2 }, { "link_2", 3 } };
+
+  // Everything is sent the first time
+  SceneDiff diff = computeSceneDiff({}, plotted);
+  EXPECT_EQ(sorted(diff.sent_links), std::vector<std::string>({ "base_link", "link_1", "link_2" }));
+  EXPECT_TRUE(diff.deleted_links.empty());
+
+  // Unchanged links are not resent
+  diff = computeSceneDiff(plotted, plotted);
+  EXPECT_TRUE(diff.sent_links.empty());
+  EXPECT_TRUE(diff.deleted_links.empty());
+
+  // Changed links are deleted and sent again, new links are only sent and removed links are only deleted
+  const std::unordered_map<std::string, std::size_t> changed{ { "base_link", 1 }, { "link_1", 4 }, { "link_3", 5 } };
+  diff = computeSceneDiff(plotted, changed);
+  EXPECT_EQ(sorted(diff.sent_links), std::vector<std::string>({ "link_1", "link_3" }));
+  EXPECT_EQ(sorted(diff.deleted_links), std::vector<std::string>({ "link_1", "link_2" }));
+
+  // Removing every link deletes all of them
+  diff = computeSceneDiff(plotted, {});
+  EXPECT_TRUE(diff.sent_links.empty());
+  EXPECT_EQ(sorted(diff.deleted_links), std::vector<std::string>({ "base_link", "link_1", "link_2" }));
+}
+
+TEST(TesseractVisualizationSceneDiffUnit, GetMovedLinks)  // NOLINT
+{
+  const double translation_threshold = 1e-3;
+  const double rotation_threshold = 1e-2;
+
+  tesseract_common::TransformMap published;
+  tesseract_common::TransformMap transforms;
+  transforms["base_link"] = Eigen::Isometry3d::Identity();
+  transforms["link_1"] = Eigen::Isometry3d::Identity();
+
+  // Links which were never published are moved
+  std::vector<std::string> moved = getMovedLinks(published, transforms, translation_threshold, rotation_threshold);
+  EXPECT_EQ(sorted(moved), std::vector<std::string>({ "base_link", "link_1" }));
+  for (const auto& link_name : moved)
+    published[link_name] = transforms[link_name];
+
+  EXPECT_TRUE(getMovedLinks(published, transforms, translation_threshold, rotation_threshold).empty());
+
+  // Motion below the threshold accumulates until it crosses the threshold
+  int steps = 0;
+  do
+  {
+    ++steps;
+    transforms["link_1"].translate(Eigen::Vector3d(0.4 * translation_threshold, 0, 0));
+    moved = getMovedLinks(published, transforms, translation_threshold, rotation_threshold);
+  } while (moved.empty() && steps < 10);
+  EXPECT_EQ(steps, 3);
+  EXPECT_EQ(moved, std::vector<std::string>({ "link_1" }));
+  published["link_1"] = transforms["link_1"];
+  EXPECT_TRUE(getMovedLinks(published, transforms, translation_threshold, rotation_threshold).empty());
+
+  // Rotation is compared to its own threshold
+  steps = 0;
+  do
+  {
+    ++steps;
+    transforms["base_link"].rotate(Eigen::AngleAxisd(0.4 * rotation_threshold, Eigen::Vector3d::UnitZ()));
+    moved = getMovedLinks(published, transforms, translation_threshold, rotation_threshold);
+  } while (moved.empty() && steps < 10);
+  EXPECT_EQ(steps, 3);
+  EXPECT_EQ(moved, std::vector<std::string>({ "base_link" }));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
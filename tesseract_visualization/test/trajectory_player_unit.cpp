@@ -146,6 +146,48 @@ TEST(TesseracTrajectoryInterpolatorUnit, TrajectoryInterpolatorTest)  // NOLINT
   }
 }
 
+TEST(TesseracTrajectoryInterpolatorUnit, TrajectoryInterpolatorNonUniformTest)  // NOLINT
+{
+  using namespace tesseract_visualization;
+  using namespace tesseract_common;
+
+  std::vector<std::string> joint_names = { "joint_1", "joint_2" };
+  JointTrajectory trajectory;
+
+  // Define trajectory where the position equals the time and the time steps grow
+  double time = 0;
+  for (long i = 0; i < 100; ++i)
+  {
+    time += 0.01 * static_cast<double>(i);
+    Eigen::VectorXd p = Eigen::VectorXd::Zero(2);
+    p(0) = time;
+    trajectory.push_back(JointState(joint_names, p));
+    trajectory.back().time = time;
+  }
+
+  TrajectoryInterpolator interpolator(trajectory);
+  const double duration = interpolator.getStateDuration(99);
+  EXPECT_NEAR(duration, time, 1e-8);
+
+  for (long i = 0; i <= 1000; ++i)
+  {
+    const double d = duration * static_cast<double>(i) / 1000.0;
+    JointState s = interpolator.getState(d);
+    EXPECT_NEAR(s.position(0), d, 1e-8);
+  }
+
+  // Test states exactly at the waypoints
+  for (long i = 0; i < 100; ++i)
+  {
+    JointState s = interpolator.getState(interpolator.getStateDuration(i));
+    EXPECT_NEAR(s.position(0), trajectory[static_cast<std::size_t>(i)].position(0), 1e-8);
+  }
+
+  // Test above max duration
+  JointState s = interpolator.getState(duration + 1);
+  EXPECT_NEAR(s.position(0), duration, 1e-8);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);